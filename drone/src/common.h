@@ -88,9 +88,16 @@ typedef struct {
     int port;    // Destination port
 } rtp_streamer_config_t;
 
+#define MSP_OSD_PORT_DEFAULT 0       // disabled until an FC reader feeds msp_osd_process(), the GS listens on 7654
+
+typedef struct {
+    int port;    // OSD deltas to the rtp-streamer ip, 0 disables
+} msp_osd_config_t;
+
 struct common_config_t {
     camera_csi_config_t camera_csi_config;
     rtp_streamer_config_t rtp_streamer_config;
+    msp_osd_config_t msp_osd_config;
     encoder_config_t encoder_config;
     int stream_width;
     int stream_height;
@@ -258,6 +258,9 @@ static int FUNC(struct common_config_t *cfg, const char *val) {          \
 DEF_SETTER_IP   (set_rtp_ip,   cfg->rtp_streamer_config.ip,    "rtp-streamer.ip")
 DEF_SETTER_INT  (set_rtp_port, cfg->rtp_streamer_config.port,  1, 65535, "rtp-streamer.port")
 
+// msp-osd
+DEF_SETTER_INT  (set_msp_osd_port, cfg->msp_osd_config.port, 0, 65535, "msp-osd.port")
+
 // encoder (flat, width/height now driven by [video].resolution)
 DEF_SETTER_ENUM (set_encoder_codec,     cfg->encoder_config.codec,     parse_codec,     "encoder.codec")
 DEF_SETTER_ENUM (set_encoder_rate,      cfg->encoder_config.rate_mode, parse_rate_mode, "encoder.rate_mode")
@@ -339,6 +342,9 @@ static const config_entry_t CONFIG_TABLE[] = {
     MAP("rtp-streamer", "ip",                       set_rtp_ip),
     MAP("rtp-streamer", "port",                     set_rtp_port),
 
+    // msp-osd
+    MAP("msp-osd", "port",                          set_msp_osd_port),
+
     // encoder (no width/height keys anymore)
     MAP("encoder", "codec",                         set_encoder_codec),
     MAP("encoder", "rate_mode",                     set_encoder_rate),
@@ -461,6 +467,9 @@ void config_init_defaults(struct common_config_t *cfg)
     assign_dup(&cfg->rtp_streamer_config.ip, "127.0.0.1");
     cfg->rtp_streamer_config.port = 5602;
 
+    // MSP OSD defaults
+    cfg->msp_osd_config.port = MSP_OSD_PORT_DEFAULT;
+
     // Encoder defaults
     cfg->encoder_config.codec     = CODEC_H265;           // H.265 for better compression
     cfg->encoder_config.rate_mode = RATE_CONTROL_CBR;     // constant bitrate for stable channel
@@ -14,6 +14,7 @@
 #include "encoder/encoder.h"
 #include "config/config_parser.h"
 #include "rtp_streamer/rtp_streamer.h"
+#include "msp-osd/msp_osd.h"
 #include "screensaver/screensaver.h"
 
 #define PATH_TO_CONFIG_FILE "/etc/vd-link.config"
@@ -129,6 +130,8 @@ int main(int argc, char *argv[])
     printf("RTP Streamer:\n");
     printf(" ip: %s\n", config.rtp_streamer_config.ip);
     printf(" port: %d\n", config.rtp_streamer_config.port);
+    printf("MSP OSD:\n");
+    printf(" port: %d\n", config.msp_osd_config.port);
     printf("Encoder:\n");
     printf(" codec: %s\n", config.encoder_config.codec == CODEC_H264 ? "H.264" : "H.265");
     printf(" resolution: %dx%d\n", config.encoder_config.width, config.encoder_config.height);
@@ -161,9 +164,14 @@ int main(int argc, char *argv[])
         return -1;
     }
 
+    if (msp_osd_init(&config) != 0) {
+        printf("Failed to initialize MSP OSD, continuing without it\n");
+    }
+
     ret = encoder_init(&config.encoder_config);
     if (ret != 0) {
         printf("Failed to initialize encoder\n");
+        msp_osd_deinit();
         rtp_streamer_deinit();
         config_cleanup(&config);
         return -1;
@@ -174,6 +182,7 @@ int main(int argc, char *argv[])
                                   &screensaver) != 0) {
         printf("Failed to create screensaver frame\n");
         encoder_clean();
+        msp_osd_deinit();
         rtp_streamer_deinit();
         config_cleanup(&config);
         return -1;
@@ -186,6 +195,7 @@ int main(int argc, char *argv[])
     }
 
     encoder_clean();
+    msp_osd_deinit();
     rtp_streamer_deinit();
     config_cleanup(&config);
 
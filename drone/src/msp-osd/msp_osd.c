@@ -3,3 +3,198 @@
  * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
  */
 #include "msp_osd.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include "msp.h"
+#include "msp_dispatch.h"
+#include "osd_delta.h"
+
+#define MSP_OSD_IDLE_US             OSD_DELTA_KEYFRAME_US   // map resent this often without draws
+
+static int osd_socket = -1;
+static struct sockaddr_in dst_addr = {0};
+static pthread_t ack_thread;
+static volatile bool running = false;
+
+static msp_port_t msp_port;
+static msp_dispatch_t *msp_dispatch_table = NULL;
+
+/* Map drawn by the FC and the sender state, shared by the MSP and acknowledgement threads */
+static pthread_mutex_t osd_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint16_t character_map[OSD_DELTA_COLS][OSD_DELTA_ROWS];
+static uint8_t osd_options = OSD_DELTA_OPTIONS_UNKNOWN;
+static uint8_t osd_font = 0;
+static struct osd_delta_sender_t sender;
+static bool map_drawn = false;
+static uint64_t last_send_us = 0;
+static uint8_t packet[OSD_DELTA_MAX_PACKET];
+
+static uint64_t get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+/* Called with osd_lock held */
+static void send_map(uint64_t now_us)
+{
+    size_t len = osd_delta_sender_encode(&sender, &character_map[0][0], osd_options, osd_font, now_us, packet);
+    sendto(osd_socket, packet, len, MSG_DONTWAIT, (struct sockaddr *)&dst_addr, sizeof(dst_addr));
+    last_send_us = now_us;
+}
+
+static void draw_string(const uint8_t *payload, uint16_t size)
+{
+    if (size < 3)
+        return;
+    uint8_t row = payload[0];
+    uint8_t col = payload[1];
+    uint16_t page = (uint16_t)(payload[2] & 0x3) << 8;
+    const uint8_t *str = &payload[3];
+    const uint8_t *end = memchr(str, '\0', size - 3);
+    uint16_t len = end ? (uint16_t)(end - str) : (uint16_t)(size - 3);
+    if (row >= OSD_DELTA_ROWS)
+        return;
+    for (uint16_t i = 0; i < len && col < OSD_DELTA_COLS; i++, col++)
+        character_map[col][row] = page | str[i];
+}
+
+static void displayport_handler(void *user, const msp_view_t *msg)
+{
+    (void)user;
+    if (msg->type != MSP_PACKET_RESPONSE || msg->size < 1)
+        return;
+
+    pthread_mutex_lock(&osd_lock);
+    switch (msg->payload[0]) {
+    case MSP_DISPLAYPORT_CLEAR:
+        memset(character_map, 0, sizeof(character_map));
+        break;
+    case MSP_DISPLAYPORT_DRAW_STRING:
+        draw_string(&msg->payload[1], msg->size - 1);
+        break;
+    case MSP_DISPLAYPORT_DRAW_SCREEN:
+        map_drawn = true;
+        send_map(get_time_us());
+        break;
+    case MSP_DISPLAYPORT_SET_OPTIONS:
+        if (msg->size >= 3) {
+            osd_font = msg->payload[1];
+            osd_options = msg->payload[2];
+        }
+        break;
+    default:
+        break;
+    }
+    pthread_mutex_unlock(&osd_lock);
+}
+
+static void* msp_osd_ack_thread(void *arg)
+{
+    (void)arg;
+    uint8_t buf[OSD_DELTA_ACK_SIZE * 4];
+
+    while (running) {
+        struct pollfd fds[] = { { .fd = osd_socket, .events = POLLIN } };
+        int ret = poll(fds, 1, 100);
+        if (ret < 0 && errno != EINTR) {
+            perror("poll");
+            break;
+        }
+
+        pthread_mutex_lock(&osd_lock);
+        if (ret > 0 && (fds[0].revents & POLLIN)) {
+            ssize_t n;
+            while ((n = recv(osd_socket, buf, sizeof(buf), MSG_DONTWAIT)) > 0) {
+                int seq = osd_delta_parse_ack(buf, (size_t)n);
+                if (seq >= 0)
+                    osd_delta_sender_ack(&sender, (uint16_t)seq);
+            }
+        }
+        // a static OSD is still refreshed, a GS started later gets its keyframe
+        uint64_t now_us = get_time_us();
+        if (map_drawn && now_us - last_send_us >= MSP_OSD_IDLE_US)
+            send_map(now_us);
+        pthread_mutex_unlock(&osd_lock);
+    }
+    return NULL;
+}
+
+int msp_osd_init(struct common_config_t *cfg)
+{
+    if (cfg->msp_osd_config.port == 0) {
+        printf("[ MSP OSD ] Disabled\n");
+        return 0;
+    }
+
+    memset(&dst_addr, 0, sizeof(dst_addr));
+    dst_addr.sin_family = AF_INET;
+    dst_addr.sin_port = htons(cfg->msp_osd_config.port);
+    if (inet_pton(AF_INET, cfg->rtp_streamer_config.ip, &dst_addr.sin_addr) <= 0) {
+        perror("inet_pton");
+        return -1;
+    }
+    osd_socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if (osd_socket < 0) {
+        perror("socket");
+        return -1;
+    }
+
+    msp_dispatch_table = msp_dispatch_create();
+    if (!msp_dispatch_table || msp_dispatch_register(msp_dispatch_table, MSP_DISPLAYPORT, displayport_handler, NULL) < 0) {
+        printf("[ MSP OSD ] Failed to create MSP dispatch table\n");
+        msp_dispatch_destroy(msp_dispatch_table);
+        msp_dispatch_table = NULL;
+        close(osd_socket);
+        osd_socket = -1;
+        return -1;
+    }
+    memset(&msp_port, 0, sizeof(msp_port));
+    msp_port.dispatch = msp_dispatch_table;
+
+    memset(character_map, 0, sizeof(character_map));
+    osd_options = OSD_DELTA_OPTIONS_UNKNOWN;
+    osd_font = 0;
+    map_drawn = false;
+    osd_delta_sender_init(&sender);
+
+    running = true;
+    if (pthread_create(&ack_thread, NULL, msp_osd_ack_thread, NULL) != 0) {
+        running = false;
+        msp_dispatch_destroy(msp_dispatch_table);
+        msp_dispatch_table = NULL;
+        close(osd_socket);
+        osd_socket = -1;
+        return -1;
+    }
+
+    printf("[ MSP OSD ] Sending OSD to %s:%d\n", cfg->rtp_streamer_config.ip, cfg->msp_osd_config.port);
+    return 0;
+}
+
+void msp_osd_deinit(void)
+{
+    if (!running)
+        return;
+    running = false;
+    pthread_join(ack_thread, NULL);
+    msp_dispatch_destroy(msp_dispatch_table);
+    msp_dispatch_table = NULL;
+    close(osd_socket);
+    osd_socket = -1;
+}
+
+void msp_osd_process(const uint8_t *buf, size_t len)
+{
+    if (!running)
+        return;
+    msp_process_buffer(&msp_port, buf, len);
+}
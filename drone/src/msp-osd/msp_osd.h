@@ -4,5 +4,22 @@
  */
 #ifndef MSP_OSD_H
 #define MSP_OSD_H
+#include <stdint.h>
+#include <stddef.h>
+#include "common.h"
+
+/*
+ * The FC's MSP DisplayPort is drawn into a character map here and only the cells that changed are
+ * sent to the GS (osd_delta.h), on rtp-streamer ip : msp-osd port. Acknowledgements from the GS
+ * come back on the same socket and select the base of the next delta.
+ */
+
+/** Open the socket and start the acknowledgement thread. Does nothing when cfg->msp_osd_config.port is 0 */
+int msp_osd_init(struct common_config_t *cfg);
+
+void msp_osd_deinit(void);
+
+/** MSP bytes from the FC, in any chunks. A DisplayPort draw complete sends the map. No FC reader calls it yet */
+void msp_osd_process(const uint8_t *buf, size_t len);
 
 #endif //MSP_OSD_H
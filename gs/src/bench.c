@@ -0,0 +1,1605 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include "rtp_receiver.h"
+#include "msp-osd.h"
+#include "msp.h"
+#include "msp_dispatch.h"
+#include "osd_delta.h"
+#include "lz4/lz4.h"
+#include "msp/msp_displayport.h"
+#include "rec/rec.h"
+#include "rec/rec_pb.h"
+#include "ui/blend.h"
+#include "ui/compositor.h"
+#include "ui/telemetry.h"
+#include "ui/ui_font.h"
+#include "trace.h"
+
+#define BENCH_MAX_THREADS       16
+#define BENCH_MAX_METRICS       64
+#define BENCH_MAX_SERIES        16
+#define BENCH_INPUT_TIMEOUT_S   10      // pipeline: give up when no packet arrives
+#define BENCH_DRAIN_IDLE_US     500000  // pipeline: replay ended and no frame for this long
+#define BENCH_MSP_STREAM_BYTES  (1u << 20)  // msp: synthetic DisplayPort traffic parsed per pass
+#define BENCH_MSP_READ_MAX      256     // msp: largest chunk handed to the parser, like a UART/UDP read
+#define BENCH_OSD_DELTA_HZ      30      // osd-delta: draw rate of the FC, inputs carry no timestamps
+#define BENCH_OSD_DELTA_SYNTH_S 120     // osd-delta: length of the synthetic session
+#define BENCH_OSD_DELTA_MAX_MAPS (1u << 20)
+#define BENCH_OSD_SEEK_SYNTH_S  3600    // osd-seek: length of the recording written when none is given
+#define BENCH_OSD_SEEK_SCANS    16      // osd-seek: seeks by decoding from the start, for comparison
+#define BENCH_BLEND_WIDTH       1280    // blend: the LVGL frame
+#define BENCH_BLEND_HEIGHT      720
+#define BENCH_BLEND_CHECKS      4096    // blend: random runs compared with the scalar blend, per mode
+#define BENCH_BLEND_CHECK_MAX   256     // blend: longest of them, in pixels
+#define BENCH_COMPOSE_CELLS     6       // compose: OSD cells changed per frame of the HUD case
+#define BENCH_TELEM_SET_US      100     // telemetry: each producer thread sets its field this often
+#define BENCH_TELEM_PASS_US     16000   // telemetry: one LVGL pass per display refresh
+#define BENCH_TELEM_HOLD_US     2000    // telemetry: of which lv_timer_handler() holds lvgl_mutex
+#define BENCH_FONT_LAST_LETTER  0x2200  // font: letters looked up, from ' '
+#define BENCH_TRACE_THREADS     4       // trace: producer threads
+#define BENCH_TRACE_BATCH       1024    // trace: events recorded back to back, then a short sleep
+
+struct bench_thread_t {
+    const char *name;
+    clockid_t clock;
+    double cpu_ms;                      // snapshot, -1 if the thread is gone
+    bool exited;                        // cpu_ms was taken when the thread finished
+};
+
+struct bench_metric_t {
+    const char *name;
+    double value;
+};
+
+struct bench_kind_t {
+    const char *name;
+    const char *description;
+    int (*run)(struct config_t *cfg, volatile bool *running);
+};
+
+static atomic_bool g_active = false;
+
+static pthread_mutex_t g_threads_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct bench_thread_t g_threads[BENCH_MAX_THREADS];
+static int g_thread_count = 0;
+
+static struct bench_metric_t g_metrics[BENCH_MAX_METRICS];
+static int g_metric_count = 0;
+static struct bench_series_t *g_series[BENCH_MAX_SERIES];
+static int g_series_count = 0;
+
+/* pipeline */
+static atomic_uint_fast64_t g_packets;
+static atomic_uint_fast64_t g_bytes;
+static atomic_uint_fast64_t g_frames;
+static atomic_uint_fast64_t g_first_packet_us;
+static struct bench_series_t g_stage[BENCH_STAGE_COUNT];
+
+static uint64_t get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+static double timespec_ms(const struct timespec *ts)
+{
+    return ts->tv_sec * 1000.0 + ts->tv_nsec / 1e6;
+}
+
+bool bench_active(void)
+{
+    return atomic_load_explicit(&g_active, memory_order_relaxed);
+}
+
+void bench_thread_register(const char *name)
+{
+    if (!bench_active())
+        return;
+
+    clockid_t clock;
+    if (pthread_getcpuclockid(pthread_self(), &clock) != 0)
+        return;
+
+    pthread_mutex_lock(&g_threads_lock);
+    int idx = 0;
+    /* a restarted thread replaces its previous entry */
+    while (idx < g_thread_count && strcmp(g_threads[idx].name, name) != 0)
+        idx++;
+    if (idx < BENCH_MAX_THREADS) {
+        g_threads[idx].name = name;
+        g_threads[idx].clock = clock;
+        g_threads[idx].cpu_ms = -1;
+        g_threads[idx].exited = false;
+        if (idx == g_thread_count)
+            g_thread_count++;
+    }
+    pthread_mutex_unlock(&g_threads_lock);
+}
+
+void bench_thread_exit(const char *name)
+{
+    if (!bench_active())
+        return;
+
+    struct timespec ts;
+    pthread_mutex_lock(&g_threads_lock);
+    for (int i = 0; i < g_thread_count; i++) {
+        if (strcmp(g_threads[i].name, name) == 0) {
+            g_threads[i].cpu_ms = clock_gettime(g_threads[i].clock, &ts) == 0 ? timespec_ms(&ts) : -1;
+            g_threads[i].exited = true;
+        }
+    }
+    pthread_mutex_unlock(&g_threads_lock);
+}
+
+/* Must run while the registered threads are still alive */
+static void bench_threads_snapshot(void)
+{
+    pthread_mutex_lock(&g_threads_lock);
+    for (int i = 0; i < g_thread_count; i++) {
+        struct timespec ts;
+        if (g_threads[i].exited)
+            continue;
+        g_threads[i].cpu_ms = clock_gettime(g_threads[i].clock, &ts) == 0 ? timespec_ms(&ts) : -1;
+    }
+    pthread_mutex_unlock(&g_threads_lock);
+}
+
+void bench_count_packet(int bytes)
+{
+    if (!bench_active())
+        return;
+    if (atomic_fetch_add(&g_packets, 1) == 0)
+        atomic_store(&g_first_packet_us, get_time_us());
+    atomic_fetch_add(&g_bytes, (uint_fast64_t)bytes);
+}
+
+void bench_count_frame(void)
+{
+    if (bench_active())
+        atomic_fetch_add(&g_frames, 1);
+}
+
+void bench_stage_sample(bench_stage_t stage, uint64_t us)
+{
+    if (bench_active() && stage < BENCH_STAGE_COUNT)
+        bench_series_add(&g_stage[stage], us);
+}
+
+/* ---------------------- series / report --------------------- */
+
+int bench_series_init(struct bench_series_t *s, const char *name, uint32_t capacity)
+{
+    s->name = name;
+    s->capacity = capacity;
+    atomic_store(&s->count, 0);
+    s->samples = malloc((size_t)capacity * sizeof(uint32_t));
+    if (!s->samples) {
+        s->capacity = 0;
+        return -1;
+    }
+    return 0;
+}
+
+void bench_series_add(struct bench_series_t *s, uint64_t us)
+{
+    unsigned idx = atomic_fetch_add_explicit(&s->count, 1, memory_order_relaxed);
+    if (idx < s->capacity)
+        s->samples[idx] = us > UINT32_MAX ? UINT32_MAX : (uint32_t)us;
+}
+
+void bench_series_free(struct bench_series_t *s)
+{
+    free(s->samples);
+    s->samples = NULL;
+    s->capacity = 0;
+}
+
+void bench_report_metric(const char *name, double value)
+{
+    if (g_metric_count < BENCH_MAX_METRICS) {
+        g_metrics[g_metric_count].name = name;
+        g_metrics[g_metric_count].value = value;
+        g_metric_count++;
+    }
+}
+
+void bench_report_series(struct bench_series_t *s)
+{
+    if (g_series_count < BENCH_MAX_SERIES)
+        g_series[g_series_count++] = s;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_write_series(FILE *f, struct bench_series_t *s)
+{
+    unsigned total = atomic_load(&s->count);
+    unsigned n = total < s->capacity ? total : s->capacity;
+    fprintf(f, "\"%s\":{\"count\":%u", s->name, total);
+    if (n > 0) {
+        qsort(s->samples, n, sizeof(uint32_t), cmp_u32);
+        double sum = 0;
+        for (unsigned i = 0; i < n; i++)
+            sum += s->samples[i];
+        fprintf(f, ",\"mean\":%.1f,\"p50\":%u,\"p95\":%u,\"p99\":%u,\"max\":%u",
+                sum / n,
+                s->samples[(size_t)(n - 1) * 50 / 100],
+                s->samples[(size_t)(n - 1) * 95 / 100],
+                s->samples[(size_t)(n - 1) * 99 / 100],
+                s->samples[n - 1]);
+    }
+    if (total > n)
+        fprintf(f, ",\"dropped\":%u", total - n);
+    fprintf(f, "}");
+}
+
+static void bench_write_report(FILE *f, const char *kind, double duration_s, int result)
+{
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+
+    fprintf(f, "{\"bench\":\"%s\",\"version\":\"%s\",\"git\":\"%s\",\"result\":\"%s\",\"duration_s\":%.3f",
+            kind, GIT_TAG, GIT_HASH, result == 0 ? "ok" : "failed", duration_s);
+
+    fprintf(f, ",\"metrics\":{");
+    for (int i = 0; i < g_metric_count; i++)
+        fprintf(f, "%s\"%s\":%.3f", i ? "," : "", g_metrics[i].name, g_metrics[i].value);
+
+    fprintf(f, "},\"latency_us\":{");
+    for (int i = 0; i < g_series_count; i++) {
+        if (i)
+            fprintf(f, ",");
+        bench_write_series(f, g_series[i]);
+    }
+
+    fprintf(f, "},\"threads\":{");
+    int first = 1;
+    for (int i = 0; i < g_thread_count; i++) {
+        if (g_threads[i].cpu_ms < 0)
+            continue;
+        fprintf(f, "%s\"%s\":{\"cpu_ms\":%.1f}", first ? "" : ",", g_threads[i].name, g_threads[i].cpu_ms);
+        first = 0;
+    }
+
+    fprintf(f, "},\"process\":{\"cpu_user_ms\":%.1f,\"cpu_sys_ms\":%.1f,\"peak_rss_kb\":%ld}}\n",
+            ru.ru_utime.tv_sec * 1000.0 + ru.ru_utime.tv_usec / 1000.0,
+            ru.ru_stime.tv_sec * 1000.0 + ru.ru_stime.tv_usec / 1000.0,
+            ru.ru_maxrss);
+}
+
+/* ---------------------- benchmark kinds --------------------- */
+
+static int bench_pipeline(struct config_t *cfg, volatile bool *running)
+{
+    static const char *stage_names[BENCH_STAGE_COUNT] = { "queue", "decode", "sink" };
+    static const uint32_t stage_capacity[BENCH_STAGE_COUNT] = { 1u << 21, 1u << 18, 1u << 18 };
+
+    for (int i = 0; i < BENCH_STAGE_COUNT; i++) {
+        if (bench_series_init(&g_stage[i], stage_names[i], stage_capacity[i]) < 0) {
+            fprintf(stderr, "[ BENCH ] Out of memory\n");
+            return -1;
+        }
+        bench_report_series(&g_stage[i]);
+    }
+    atomic_store(&g_packets, 0);
+    atomic_store(&g_bytes, 0);
+    atomic_store(&g_frames, 0);
+    atomic_store(&g_first_packet_us, 0);
+
+    if (rtp_receiver_start(cfg) != 0) {
+        fprintf(stderr, "[ BENCH ] Can't start RTP receiver\n");
+        return -1;
+    }
+
+    /* measure from the first packet, not from start; a replay ends early once it is fully decoded */
+    uint64_t start = get_time_us();
+    uint64_t first = 0, now = start;
+    uint64_t last_frames = 0, last_frame_us = start;
+    while (*running) {
+        usleep(100000);
+        now = get_time_us();
+        first = atomic_load(&g_first_packet_us);
+        if (!first && (now - start > BENCH_INPUT_TIMEOUT_S * 1000000ULL || rtp_receiver_input_done())) {
+            if (cfg->replay_file)
+                fprintf(stderr, "[ BENCH ] No RTP input in %s\n", cfg->replay_file);
+            else
+                fprintf(stderr, "[ BENCH ] No RTP input on %s:%d\n", cfg->ip, cfg->port);
+            break;
+        }
+        if (first && now - first >= (uint64_t)cfg->bench_seconds * 1000000ULL)
+            break;
+        uint64_t frames = atomic_load(&g_frames);
+        if (frames != last_frames) {
+            last_frames = frames;
+            last_frame_us = now;
+        } else if (rtp_receiver_input_done() && now - last_frame_us >= BENCH_DRAIN_IDLE_US) {
+            now = last_frame_us;
+            break;
+        }
+    }
+
+    /* counters and thread clocks before the pipeline is torn down */
+    uint64_t packets = atomic_load(&g_packets);
+    uint64_t bytes = atomic_load(&g_bytes);
+    uint64_t frames = atomic_load(&g_frames);
+    bench_threads_snapshot();
+    rtp_receiver_stop();
+
+    double elapsed_s = first ? (now - first) / 1e6 : 0.0;
+    bench_report_metric("packets", (double)packets);
+    bench_report_metric("frames", (double)frames);
+    bench_report_metric("packets_per_s", elapsed_s > 0 ? packets / elapsed_s : 0.0);
+    bench_report_metric("frames_per_s", elapsed_s > 0 ? frames / elapsed_s : 0.0);
+    bench_report_metric("mbit_per_s", elapsed_s > 0 ? bytes * 8.0 / elapsed_s / 1e6 : 0.0);
+
+    return first && frames ? 0 : -1;
+}
+
+static struct bench_series_t g_osd_render;
+static struct bench_series_t g_osd_update;
+static struct bench_series_t g_osd_expand;
+
+static int bench_osd_surface(struct config_t *cfg, volatile bool *running, bool indexed)
+{
+    if (bench_series_init(&g_osd_render, "osd_render", 1u << 20) < 0 ||
+        bench_series_init(&g_osd_update, "osd_update", 1u << 20) < 0 ||
+        (indexed && bench_series_init(&g_osd_expand, "osd_expand", 1u << 20) < 0)) {
+        fprintf(stderr, "[ BENCH ] Out of memory\n");
+        bench_series_free(&g_osd_render);
+        bench_series_free(&g_osd_update);
+        return -1;
+    }
+    bench_report_series(&g_osd_render);
+    bench_report_series(&g_osd_update);
+    if (indexed)
+        bench_report_series(&g_osd_expand);
+
+    msp_osd_set_indexed(indexed);
+    uint64_t fb_bytes = 0;
+    uint64_t start = get_time_us();
+    int frames = msp_osd_bench_render(&g_osd_render, &g_osd_update, &g_osd_expand, &fb_bytes,
+                                      (uint64_t)cfg->bench_seconds * 1000000ULL, running);
+    double elapsed_s = (get_time_us() - start) / 1e6;
+    msp_osd_set_indexed(false);
+    if (frames <= 0)
+        return -1;
+
+    int width, height, rotate;
+    msp_osd_get_surface(&width, &height, &rotate);
+    bench_report_metric("frames", frames);
+    bench_report_metric("frames_per_s", frames / elapsed_s);
+    bench_report_metric("surface_bytes", (double)width * height * (indexed ? 1 : 4));
+    bench_report_metric("fb_bytes_per_frame", (double)fb_bytes / frames);
+    return 0;
+}
+
+static int bench_osd(struct config_t *cfg, volatile bool *running)
+{
+    return bench_osd_surface(cfg, running, false);
+}
+
+static int bench_osd_indexed(struct config_t *cfg, volatile bool *running)
+{
+    return bench_osd_surface(cfg, running, true);
+}
+
+/* msp: DisplayPort frames as a flight controller sends them, with some line noise between frames */
+static uint64_t g_msp_frames;
+static uint32_t g_msp_checksum;
+static struct bench_series_t g_msp_buffer;
+static struct bench_series_t g_msp_byte;
+
+static void bench_msp_frame(void *user, const msp_view_t *msg)
+{
+    (void)user;
+    g_msp_frames++;
+    g_msp_checksum += msg->cmd + (msg->size ? msg->payload[msg->size - 1] : 0);
+}
+
+static size_t bench_msp_stream(uint8_t *buf, size_t cap)
+{
+    size_t len = 0;
+    uint8_t payload[64];
+    srand(1);
+    while (len + 128 < cap) {
+        int row = rand() % 18, col = rand() % 50;
+        int n = 4 + rand() % 12;
+        payload[0] = 3;             // DisplayPort write string: row, column, attribute, text
+        payload[1] = (uint8_t)row;
+        payload[2] = (uint8_t)col;
+        payload[3] = 0;
+        for (int i = 0; i < n; i++)
+            payload[4 + i] = (uint8_t)(' ' + rand() % 64);
+        if (rand() % 4)
+            len += construct_msp_command_v1(buf + len, MSP_DISPLAYPORT, payload, (uint8_t)(4 + n), MSP_INBOUND);
+        else
+            len += construct_msp_command_v2(buf + len, MSP_DISPLAYPORT, payload, (uint8_t)(4 + n), MSP_PACKET_RESPONSE);
+        if (rand() % 16 == 0)
+            buf[len++] = (uint8_t)rand();
+    }
+    return len;
+}
+
+static int bench_msp(struct config_t *cfg, volatile bool *running)
+{
+    uint8_t *stream = malloc(BENCH_MSP_STREAM_BYTES);
+    msp_dispatch_t *dispatch = msp_dispatch_create();
+    if (!stream || !dispatch || bench_series_init(&g_msp_buffer, "msp_buffer_pass", 1u << 16) < 0 ||
+        bench_series_init(&g_msp_byte, "msp_byte_pass", 1u << 16) < 0) {
+        fprintf(stderr, "[ BENCH ] Out of memory\n");
+        bench_series_free(&g_msp_buffer);
+        msp_dispatch_destroy(dispatch);
+        free(stream);
+        return -1;
+    }
+    msp_dispatch_register(dispatch, MSP_DISPLAYPORT, bench_msp_frame, NULL);
+    bench_report_series(&g_msp_buffer);
+    bench_report_series(&g_msp_byte);
+    size_t len = bench_msp_stream(stream, BENCH_MSP_STREAM_BYTES);
+
+    /* alternate passes over the stream: msp_process_buffer in read-sized chunks, then byte at a time */
+    msp_port_t port = { .msp_state = MSP_IDLE, .dispatch = dispatch };
+    uint64_t buffer_us = 0, byte_us = 0, buffer_frames = 0, byte_frames = 0;
+    uint64_t start = get_time_us();
+    int passes = 0;
+    while (*running && get_time_us() - start < (uint64_t)cfg->bench_seconds * 1000000ULL) {
+        bool bytewise = passes & 1;
+        uint64_t frames = g_msp_frames;
+        uint64_t t0 = get_time_us();
+        if (bytewise) {
+            for (size_t i = 0; i < len; i++)
+                msp_process_received_data(&port, stream[i]);
+        } else {
+            for (size_t i = 0, chunk = 1; i < len; i += chunk) {
+                chunk = 1 + (i * 2654435761u >> 7) % BENCH_MSP_READ_MAX;
+                if (chunk > len - i)
+                    chunk = len - i;
+                msp_process_buffer(&port, stream + i, chunk);
+            }
+        }
+        uint64_t us = get_time_us() - t0;
+        if (bytewise) {
+            bench_series_add(&g_msp_byte, us);
+            byte_us += us;
+            byte_frames += g_msp_frames - frames;
+        } else {
+            bench_series_add(&g_msp_buffer, us);
+            buffer_us += us;
+            buffer_frames += g_msp_frames - frames;
+        }
+        passes++;
+    }
+    free(stream);
+    uint32_t dispatched = msp_dispatch_count(dispatch, MSP_DISPLAYPORT), unhandled = msp_dispatch_unhandled(dispatch);
+    msp_dispatch_destroy(dispatch);
+    if (passes < 2 || !buffer_us || !byte_us) {
+        fprintf(stderr, "[ BENCH ] MSP benchmark too short\n");
+        return -1;
+    }
+
+    double buffer_passes = (passes + 1) / 2, byte_passes = passes / 2;
+    bench_report_metric("stream_bytes", (double)len);
+    // the byte parser can lose a frame right after a stray '$', the buffer parser resyncs on it
+    bench_report_metric("buffer_frames_per_pass", buffer_frames / buffer_passes);
+    bench_report_metric("byte_frames_per_pass", byte_frames / byte_passes);
+    bench_report_metric("buffer_mb_per_s", len * buffer_passes / buffer_us);
+    bench_report_metric("byte_mb_per_s", len * byte_passes / byte_us);
+    bench_report_metric("buffer_frames_per_s", buffer_frames * 1e6 / buffer_us);
+    bench_report_metric("byte_frames_per_s", byte_frames * 1e6 / byte_us);
+    bench_report_metric("displayport_frames", dispatched);
+    bench_report_metric("unhandled_frames", unhandled);
+    bench_report_metric("checksum", g_msp_checksum & 0xFFFF);
+    return 0;
+}
+
+/*
+ * osd-delta: bytes on the link for an OSD session, forwarded as MSP DisplayPort vs sent as osd_delta packets.
+ * The session is a raw MSP capture (--replay <file>), an .osd recording (MSPOSD header, full maps) or a
+ * synthetic Betaflight-like session that redraws the whole OSD every frame.
+ */
+struct bench_osd_session_t {
+    uint16_t (*maps)[OSD_DELTA_CELLS];
+    uint8_t *options;
+    uint32_t count;
+    uint32_t capacity;
+    uint64_t msp_bytes;                 // DisplayPort bytes that drew the maps
+};
+
+static struct bench_osd_session_t g_osd_session;
+static uint16_t g_osd_draw_map[OSD_DELTA_COLS][OSD_DELTA_ROWS];
+static uint8_t g_osd_draw_options = OSD_DELTA_OPTIONS_UNKNOWN;
+static struct bench_series_t g_osd_delta_encode;
+static struct bench_series_t g_osd_delta_apply;
+
+static void bench_osd_session_add(struct bench_osd_session_t *session, const uint16_t *map, uint8_t options)
+{
+    if (session->count == session->capacity) {
+        uint32_t capacity = session->capacity ? session->capacity * 2 : 1024;
+        if (capacity > BENCH_OSD_DELTA_MAX_MAPS)
+            return;
+        void *maps = realloc(session->maps, (size_t)capacity * sizeof(session->maps[0]));
+        uint8_t *opts = realloc(session->options, capacity);
+        if (maps)
+            session->maps = maps;
+        if (opts)
+            session->options = opts;
+        if (!maps || !opts)
+            return;
+        session->capacity = capacity;
+    }
+    memcpy(session->maps[session->count], map, sizeof(session->maps[0]));
+    session->options[session->count] = options;
+    session->count++;
+}
+
+static void bench_osd_draw_character(uint32_t x, uint32_t y, uint16_t c)
+{
+    if (x < OSD_DELTA_COLS && y < OSD_DELTA_ROWS)
+        g_osd_draw_map[x][y] = c;
+}
+
+static void bench_osd_clear_screen(void)
+{
+    memset(g_osd_draw_map, 0, sizeof(g_osd_draw_map));
+}
+
+static void bench_osd_draw_complete(void)
+{
+    bench_osd_session_add(&g_osd_session, &g_osd_draw_map[0][0], g_osd_draw_options);
+}
+
+static void bench_osd_set_options(uint8_t font, msp_hd_options_e is_hd)
+{
+    (void)font;
+    g_osd_draw_options = (uint8_t)is_hd;
+}
+
+static displayport_vtable_t g_osd_session_driver = {
+    .draw_character = bench_osd_draw_character,
+    .clear_screen = bench_osd_clear_screen,
+    .draw_complete = bench_osd_draw_complete,
+    .set_options = bench_osd_set_options,
+};
+
+/* Draw MSP bytes into the session, one map per draw screen */
+static int bench_osd_session_msp(const uint8_t *buf, size_t len)
+{
+    msp_dispatch_t *dispatch = msp_dispatch_create();
+    if (!dispatch)
+        return -1;
+    msp_dispatch_register(dispatch, MSP_DISPLAYPORT, displayport_handle_message, &g_osd_session_driver);
+    msp_port_t port = { .msp_state = MSP_IDLE, .dispatch = dispatch };
+    bench_osd_clear_screen();
+    msp_process_buffer(&port, buf, len);
+    msp_dispatch_destroy(dispatch);
+    g_osd_session.msp_bytes += len;
+    return 0;
+}
+
+/* DisplayPort bytes a FC sends to redraw map: clear, a string per run of glyphs in a row, draw screen */
+static uint64_t bench_osd_msp_cost(const uint16_t *map)
+{
+    const int frame = 6;                // $ M > size cmd ... crc
+    uint64_t bytes = 2 * (frame + 1);
+    for (int row = 0; row < OSD_DELTA_ROWS; row++) {
+        int run = 0, page = -1;
+        for (int col = 0; col <= OSD_DELTA_COLS; col++) {
+            uint16_t c = col < OSD_DELTA_COLS ? map[col * OSD_DELTA_ROWS + row] : 0;
+            bool glyph = c != 0 && c != ' ';
+            if (run && (!glyph || (c >> 8) != page)) {
+                bytes += (uint64_t)(frame + 4 + run);
+                run = 0;
+            }
+            if (glyph) {
+                page = c >> 8;
+                run++;
+            }
+        }
+    }
+    return bytes;
+}
+
+/* .osd recording, every frame as played back */
+static int bench_osd_session_rec(const char *path)
+{
+    uint16_t map[OSD_DELTA_CELLS];
+    if (rec_pb_open(path) < 0) {
+        fprintf(stderr, "[ BENCH ] %s is not an OSD recording\n", path);
+        return -1;
+    }
+    while (rec_pb_do_next_frame(map, NULL) == 0) {
+        bench_osd_session_add(&g_osd_session, map, OSD_DELTA_OPTIONS_UNKNOWN);
+        g_osd_session.msp_bytes += bench_osd_msp_cost(map);
+    }
+    rec_pb_close();
+    return 0;
+}
+
+static size_t bench_osd_draw_string(uint8_t *buf, int row, int col, const char *text)
+{
+    uint8_t payload[64];
+    size_t n = strlen(text);
+    payload[0] = MSP_DISPLAYPORT_DRAW_STRING;
+    payload[1] = (uint8_t)row;
+    payload[2] = (uint8_t)col;
+    payload[3] = 0;
+    memcpy(payload + 4, text, n);
+    return construct_msp_command_v1(buf, MSP_DISPLAYPORT, payload, (uint8_t)(4 + n), MSP_INBOUND);
+}
+
+/* Betaflight-like: the whole OSD redrawn every frame, a few elements change, the horizon moves */
+static size_t bench_osd_session_synth(uint8_t *buf, size_t cap)
+{
+    size_t len = 0;
+    char text[32];
+    uint8_t cmd;
+    for (int f = 0; f < BENCH_OSD_DELTA_SYNTH_S * BENCH_OSD_DELTA_HZ && len + 2048 < cap; f++) {
+        int s = f / BENCH_OSD_DELTA_HZ;
+        cmd = MSP_DISPLAYPORT_CLEAR;
+        len += construct_msp_command_v1(buf + len, MSP_DISPLAYPORT, &cmd, 1, MSP_INBOUND);
+        snprintf(text, sizeof(text), "%2d.%02dV", 16 - s / 60, 80 - s % 60);
+        len += bench_osd_draw_string(buf + len, 1, 2, text);
+        snprintf(text, sizeof(text), "RSSI %3d", 99 - (f / 7) % 20);
+        len += bench_osd_draw_string(buf + len, 1, 44, text);
+        snprintf(text, sizeof(text), "%02d:%02d", s / 60, s % 60);
+        len += bench_osd_draw_string(buf + len, 18, 46, text);
+        snprintf(text, sizeof(text), "THR %3d", 40 + (f * 7) % 60);
+        len += bench_osd_draw_string(buf + len, 18, 2, text);
+        snprintf(text, sizeof(text), "%4dM", 120 + (f / 3) % 50);
+        len += bench_osd_draw_string(buf + len, 9, 46, text);
+        snprintf(text, sizeof(text), "%3dKM/H", 60 + (f / 2) % 40);
+        len += bench_osd_draw_string(buf + len, 9, 2, text);
+        len += bench_osd_draw_string(buf + len, 2, 22, "ACRO  BETAFLIGHT");
+        len += bench_osd_draw_string(buf + len, 17, 20, "HOME 0123M  SATS 14");
+        len += bench_osd_draw_string(buf + len, 9, 26, "+");
+        int tilt = (f / 4) % 7 - 3;
+        for (int i = 0; i < 9; i++)
+            len += bench_osd_draw_string(buf + len, 9 + tilt * (i - 4) / 4, 22 + i, "-");
+        cmd = MSP_DISPLAYPORT_DRAW_SCREEN;
+        len += construct_msp_command_v1(buf + len, MSP_DISPLAYPORT, &cmd, 1, MSP_INBOUND);
+    }
+    return len;
+}
+
+static int bench_osd_session_load(struct config_t *cfg)
+{
+    uint8_t *buf = NULL;
+    size_t len = 0;
+    int ret;
+    if (cfg->replay_file) {
+        FILE *f = fopen(cfg->replay_file, "rb");
+        if (!f) {
+            perror("[ BENCH ] fopen");
+            return -1;
+        }
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        buf = size > 0 ? malloc((size_t)size) : NULL;
+        len = buf ? fread(buf, 1, (size_t)size, f) : 0;
+        fclose(f);
+        if (!len) {
+            free(buf);
+            fprintf(stderr, "[ BENCH ] Can't read %s\n", cfg->replay_file);
+            return -1;
+        }
+        if (len >= sizeof(rec_file_header_t) && memcmp(buf, REC_MAGIC, sizeof(REC_MAGIC) - 1) == 0)
+            ret = bench_osd_session_rec(cfg->replay_file);
+        else
+            ret = bench_osd_session_msp(buf, len);
+    } else {
+        buf = malloc(BENCH_MSP_STREAM_BYTES * 8);
+        if (!buf)
+            return -1;
+        len = bench_osd_session_synth(buf, BENCH_MSP_STREAM_BYTES * 8);
+        ret = bench_osd_session_msp(buf, len);
+    }
+    free(buf);
+    return ret;
+}
+
+static int bench_osd_delta(struct config_t *cfg, volatile bool *running)
+{
+    struct bench_osd_session_t *session = &g_osd_session;
+    uint8_t *packet = malloc(OSD_DELTA_MAX_PACKET);
+    char *lz4 = malloc((size_t)LZ4_compressBound(sizeof(session->maps[0])));
+    struct osd_delta_sender_t *sender = malloc(sizeof(*sender));
+    if (!packet || !lz4 || !sender || bench_osd_session_load(cfg) < 0 ||
+        bench_series_init(&g_osd_delta_encode, "osd_delta_encode", 1u << 20) < 0 ||
+        bench_series_init(&g_osd_delta_apply, "osd_delta_apply", 1u << 20) < 0) {
+        fprintf(stderr, "[ BENCH ] OSD delta session setup failed\n");
+        bench_series_free(&g_osd_delta_encode);
+        free(packet);
+        free(lz4);
+        free(sender);
+        free(session->maps);
+        free(session->options);
+        return -1;
+    }
+    bench_report_series(&g_osd_delta_encode);
+    bench_report_series(&g_osd_delta_apply);
+
+    /* the first pass counts bytes and checks the receiver, later ones only time; acks come back at once */
+    uint64_t delta_bytes = 0, lz4_bytes = 0, keyframes = 0, mismatches = 0;
+    uint64_t start = get_time_us();
+    int passes = 0;
+    static uint16_t rx_map[OSD_DELTA_CELLS];
+    while (session->count && *running &&
+           (passes == 0 || get_time_us() - start < (uint64_t)cfg->bench_seconds * 1000000ULL)) {
+        osd_delta_sender_init(sender);
+        for (uint32_t i = 0; i < session->count && *running; i++) {
+            uint64_t session_us = (uint64_t)i * 1000000ULL / BENCH_OSD_DELTA_HZ;
+            uint64_t t0 = get_time_us();
+            size_t len = osd_delta_sender_encode(sender, session->maps[i], session->options[i], 0, session_us, packet);
+            uint64_t t1 = get_time_us();
+            int applied = osd_delta_apply(packet, len, rx_map);
+            bench_series_add(&g_osd_delta_encode, t1 - t0);
+            bench_series_add(&g_osd_delta_apply, get_time_us() - t1);
+            osd_delta_sender_ack(sender, (uint16_t)i);
+
+            if (passes == 0) {
+                delta_bytes += len;
+                keyframes += packet[1] == OSD_DELTA_KEYFRAME;
+                mismatches += applied < 0 || memcmp(rx_map, session->maps[i], sizeof(rx_map)) != 0;
+                lz4_bytes += (uint64_t)LZ4_compress_default((const char *)session->maps[i], lz4,
+                                                            sizeof(session->maps[0]),
+                                                            LZ4_compressBound(sizeof(session->maps[0])));
+            }
+        }
+        passes++;
+    }
+
+    uint32_t maps = session->count;
+    uint64_t msp_bytes = session->msp_bytes;
+    free(packet);
+    free(lz4);
+    free(sender);
+    free(session->maps);
+    free(session->options);
+    memset(session, 0, sizeof(*session));
+    if (!maps) {
+        fprintf(stderr, "[ BENCH ] No OSD maps in the session\n");
+        return -1;
+    }
+
+    double session_s = (double)maps / BENCH_OSD_DELTA_HZ;
+    bench_report_metric("maps", maps);
+    bench_report_metric("session_s", session_s);
+    bench_report_metric("raw_msp_bytes_per_s", msp_bytes / session_s);
+    bench_report_metric("lz4_map_bytes_per_s", lz4_bytes / session_s);
+    bench_report_metric("delta_bytes_per_s", delta_bytes / session_s);
+    bench_report_metric("delta_vs_msp_ratio", delta_bytes ? (double)msp_bytes / delta_bytes : 0);
+    bench_report_metric("delta_mean_packet", (double)delta_bytes / maps);
+    bench_report_metric("keyframes", keyframes);
+    bench_report_metric("mismatches", mismatches);
+    bench_report_metric("passes", passes);
+    return mismatches ? -1 : 0;
+}
+
+/*
+ * osd-seek: random seeks in an OSD recording (--replay <file.osd>, or an hour of the synthetic session
+ * written with the recorder) through the keyframe index, against decoding from the start as a player
+ * without the index does. Every seek is checked against a sequential pass over the file.
+ */
+static struct bench_series_t g_osd_seek;
+
+static uint32_t bench_map_hash(const uint16_t *map)
+{
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < OSD_DELTA_CELLS; i++)
+        h = (h ^ map[i]) * 16777619u;
+    return h;
+}
+
+static int bench_osd_seek_record(char *path, size_t path_size)
+{
+    uint8_t *buf = malloc(BENCH_MSP_STREAM_BYTES * 8);
+    if (!buf)
+        return -1;
+    size_t len = bench_osd_session_synth(buf, BENCH_MSP_STREAM_BYTES * 8);
+    int ret = bench_osd_session_msp(buf, len);
+    free(buf);
+
+    snprintf(path, path_size, "/tmp/vd-link-osd-seek-XXXXXX");
+    int fd = mkstemp(path);
+    if (ret < 0 || fd < 0 || !g_osd_session.count)
+        return -1;
+    close(fd);
+    rec_config_t config = { .char_width = OSD_DELTA_COLS, .char_height = OSD_DELTA_ROWS, .font_variant = "btfl" };
+    if (rec_start(path, &config) < 0)
+        return -1;
+
+    // the session over and over, paced so the writer drops nothing
+    uint32_t frames = BENCH_OSD_SEEK_SYNTH_S * BENCH_OSD_DELTA_HZ;
+    for (uint32_t i = 0; i < frames; i++) {
+        rec_stats_t stats;
+        for (rec_get_stats(&stats); i - stats.frames >= 48; rec_get_stats(&stats))
+            usleep(100);
+        rec_write_frame(g_osd_session.maps[i % g_osd_session.count], OSD_DELTA_CELLS,
+                        (uint64_t)i * 1000000ULL / BENCH_OSD_DELTA_HZ);
+    }
+    rec_stop();
+    free(g_osd_session.maps);
+    free(g_osd_session.options);
+    memset(&g_osd_session, 0, sizeof(g_osd_session));
+    return 0;
+}
+
+static int bench_osd_seek(struct config_t *cfg, volatile bool *running)
+{
+    char path[64];
+    const char *file = cfg->replay_file;
+    if (!file) {
+        if (bench_osd_seek_record(path, sizeof(path)) < 0) {
+            fprintf(stderr, "[ BENCH ] Can't write an OSD recording\n");
+            unlink(path);
+            return -1;
+        }
+        file = path;
+    }
+    int ret = rec_pb_open(file);
+    if (!cfg->replay_file)
+        unlink(path);   // stays mapped
+    if (ret < 0 || bench_series_init(&g_osd_seek, "osd_seek", 1u << 20) < 0) {
+        fprintf(stderr, "[ BENCH ] Can't open OSD recording %s\n", file);
+        rec_pb_close();
+        return -1;
+    }
+    bench_report_series(&g_osd_seek);
+
+    /* sequential pass: what each moment of the recording shows */
+    uint32_t frames = 0, capacity = 0;
+    uint64_t *times = NULL;
+    uint32_t *hashes = NULL;
+    uint16_t map[OSD_DELTA_CELLS];
+    uint64_t t;
+    uint64_t t0 = get_time_us();
+    while (rec_pb_do_next_frame(map, &t) == 0) {
+        if (frames == capacity) {
+            capacity = capacity ? capacity * 2 : 4096;
+            uint64_t *tt = realloc(times, capacity * sizeof(*tt));
+            uint32_t *hh = realloc(hashes, capacity * sizeof(*hh));
+            if (tt)
+                times = tt;
+            if (hh)
+                hashes = hh;
+            if (!tt || !hh)
+                break;
+        }
+        times[frames] = t;
+        hashes[frames] = bench_map_hash(map);
+        frames++;
+    }
+    uint64_t sequential_us = get_time_us() - t0;
+
+    uint64_t duration_us = rec_pb_duration_us(), seeks = 0, mismatches = 0, scan_us = 0;
+    int scans = 0;
+    srand(1);
+    uint64_t start = get_time_us();
+    while (frames && *running && get_time_us() - start < (uint64_t)cfg->bench_seconds * 1000000ULL) {
+        uint64_t offset = duration_us ? ((uint64_t)rand() << 16 ^ (uint64_t)rand()) % (duration_us + 1) : 0;
+        t0 = get_time_us();
+        int failed = rec_pb_seek(offset, map);
+        bench_series_add(&g_osd_seek, get_time_us() - t0);
+
+        // last frame at or before offset
+        uint32_t lo = 0, hi = frames;
+        while (hi - lo > 1) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (times[mid] <= offset)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        mismatches += failed < 0 || bench_map_hash(map) != hashes[lo];
+        seeks++;
+
+        // now and then the same seek by decoding from the start
+        if (scans < BENCH_OSD_SEEK_SCANS && seeks % 64 == 1) {
+            t0 = get_time_us();
+            rec_pb_seek(0, map);
+            uint16_t next[OSD_DELTA_CELLS];
+            while (rec_pb_do_next_frame(next, &t) == 0 && t <= offset)
+                memcpy(map, next, sizeof(map));
+            scan_us += get_time_us() - t0;
+            mismatches += bench_map_hash(map) != hashes[lo];
+            scans++;
+        }
+    }
+    uint32_t keyframes = rec_pb_keyframe_count();
+    rec_pb_close();
+    free(times);
+    free(hashes);
+    if (!seeks) {
+        fprintf(stderr, "[ BENCH ] No frames in %s\n", file);
+        return -1;
+    }
+
+    bench_report_metric("frames", frames);
+    bench_report_metric("duration_s", duration_us / 1e6);
+    bench_report_metric("keyframes", keyframes);
+    bench_report_metric("sequential_decode_ms", sequential_us / 1000.0);
+    bench_report_metric("seeks", (double)seeks);
+    bench_report_metric("scan_seek_us_mean", scans ? (double)scan_us / scans : 0);
+    bench_report_metric("mismatches", (double)mismatches);
+    return mismatches ? -1 : 0;
+}
+
+/*
+ * blend: SRC_OVER of an OSD-like layer (glyph cells on a transparent frame) into the LVGL frame by every
+ * blend implementation the CPU runs, premultiplied and straight, plus a layer without transparent or
+ * opaque spans for the arithmetic alone. Each implementation is first compared with the scalar one
+ * on random runs of pixels at random alignments.
+ */
+static struct bench_series_t g_blend_frame;
+static char g_blend_metric_names[16][32];
+static int g_blend_metric_count;
+
+static uint32_t bench_blend_rand(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static uint32_t bench_blend_pixel(uint32_t *state, uint32_t alpha, bool premul)
+{
+    uint32_t r = bench_blend_rand(state);
+    uint32_t px = alpha << 24;
+    for (int shift = 0; shift < 24; shift += 8) {
+        uint32_t c = (r >> shift) & 0xFF;
+        px |= (premul ? (c * alpha + 127) / 255 : c) << shift;
+    }
+    // now and then a color above its alpha, the premultiplied blends must saturate alike
+    if (premul && (r >> 24) == 0)
+        px |= 0xFF;
+    return px;
+}
+
+/* runs of transparent, opaque and partly transparent pixels, so spans of any length and alignment */
+static void bench_blend_fill(uint32_t *px, size_t count, uint32_t *state, bool premul)
+{
+    size_t i = 0;
+    while (i < count) {
+        uint32_t r = bench_blend_rand(state);
+        size_t run = 1 + r % 48;
+        for (size_t k = 0; k < run && i < count; k++, i++) {
+            uint32_t alpha = (r >> 8) % 3 == 0 ? 0 : (r >> 8) % 3 == 1 ? 255 : 1 + bench_blend_rand(state) % 254;
+            px[i] = bench_blend_pixel(state, alpha, premul);
+        }
+    }
+}
+
+/* Glyph cells of 24x36 on a quarter of the screen, the MSP OSD at 53x20 */
+static void bench_blend_osd_layer(uint32_t *px, uint32_t *state, bool premul)
+{
+    memset(px, 0, BENCH_BLEND_WIDTH * BENCH_BLEND_HEIGHT * sizeof(uint32_t));
+    for (int cy = 0; cy + 36 <= BENCH_BLEND_HEIGHT; cy += 36) {
+        for (int cx = 0; cx + 24 <= BENCH_BLEND_WIDTH; cx += 24) {
+            if (bench_blend_rand(state) % 4)
+                continue;
+            for (int y = 4; y < 32; y++) {
+                for (int x = 3; x < 21; x++) {
+                    uint32_t r = bench_blend_rand(state) % 8;
+                    uint32_t alpha = r < 3 ? 0 : r < 6 ? 255 : 64 + r * 16;    // stroke, outline, edge
+                    px[(cy + y) * BENCH_BLEND_WIDTH + cx + x] = bench_blend_pixel(state, alpha, premul);
+                }
+            }
+        }
+    }
+}
+
+static const char *bench_blend_metric(const char *impl, const char *what)
+{
+    if (g_blend_metric_count >= (int)(sizeof(g_blend_metric_names) / sizeof(g_blend_metric_names[0])))
+        return "blend_overflow";
+    char *name = g_blend_metric_names[g_blend_metric_count++];
+    snprintf(name, sizeof(g_blend_metric_names[0]), "%s_%s", impl, what);
+    return name;
+}
+
+static uint64_t bench_blend_check(const struct blend_impl_t *ref, const struct blend_impl_t *impl)
+{
+    uint32_t src[BENCH_BLEND_CHECK_MAX + 8], expect[BENCH_BLEND_CHECK_MAX + 8], got[BENCH_BLEND_CHECK_MAX + 8];
+    uint32_t state = 1;
+    uint64_t mismatches = 0;
+    for (int mode = 0; mode < 2; mode++) {
+        bool straight = mode == 1;
+        for (int i = 0; i < BENCH_BLEND_CHECKS; i++) {
+            size_t count = bench_blend_rand(&state) % (BENCH_BLEND_CHECK_MAX + 1);
+            size_t src_at = bench_blend_rand(&state) % 8, dst_at = bench_blend_rand(&state) % 8;
+            bench_blend_fill(src + src_at, count, &state, !straight);
+            bench_blend_fill(expect + dst_at, count, &state, true);
+            memcpy(got + dst_at, expect + dst_at, count * sizeof(uint32_t));
+            (straight ? ref->straight : ref->premul)(src + src_at, expect + dst_at, count);
+            (straight ? impl->straight : impl->premul)(src + src_at, got + dst_at, count);
+            mismatches += memcmp(got + dst_at, expect + dst_at, count * sizeof(uint32_t)) != 0;
+        }
+    }
+    return mismatches;
+}
+
+/* Pixels per second of fn over the whole layer, for budget_us */
+static double bench_blend_rate(blend_fn_t fn, const uint32_t *src, uint32_t *dst, uint64_t budget_us,
+                               struct bench_series_t *series, volatile bool *running)
+{
+    uint64_t frames = 0;
+    uint64_t start = get_time_us(), now = start;
+    while (*running && (now - start < budget_us || !frames)) {
+        uint64_t t0 = now;
+        fn(src, dst, BENCH_BLEND_WIDTH * BENCH_BLEND_HEIGHT);
+        now = get_time_us();
+        if (series)
+            bench_series_add(series, now - t0);
+        frames++;
+    }
+    return now > start ? (double)frames * BENCH_BLEND_WIDTH * BENCH_BLEND_HEIGHT / ((now - start) / 1e6) : 0;
+}
+
+static int bench_blend(struct config_t *cfg, volatile bool *running)
+{
+    size_t frame = (size_t)BENCH_BLEND_WIDTH * BENCH_BLEND_HEIGHT;
+    uint32_t *osd = malloc(frame * sizeof(uint32_t));
+    uint32_t *osd_straight = malloc(frame * sizeof(uint32_t));
+    uint32_t *dense = malloc(frame * sizeof(uint32_t));
+    uint32_t *dst = malloc(frame * sizeof(uint32_t));
+    if (!osd || !osd_straight || !dense || !dst || bench_series_init(&g_blend_frame, "blend_frame", 1u << 20) < 0) {
+        fprintf(stderr, "[ BENCH ] Out of memory\n");
+        free(osd);
+        free(osd_straight);
+        free(dense);
+        free(dst);
+        return -1;
+    }
+    bench_report_series(&g_blend_frame);
+
+    uint32_t state = 7;
+    bench_blend_osd_layer(osd, &state, true);
+    bench_blend_osd_layer(osd_straight, &state, false);
+    for (size_t i = 0; i < frame; i++)
+        dense[i] = bench_blend_pixel(&state, 1 + bench_blend_rand(&state) % 254, true);
+    bench_blend_fill(dst, frame, &state, true);
+
+    blend_init();
+    int count;
+    const struct blend_impl_t *impls = blend_impls(&count);
+    int runnable = 0;
+    for (int i = 0; i < count; i++)
+        runnable += !impls[i].supported || impls[i].supported();
+    uint64_t budget_us = (uint64_t)cfg->bench_seconds * 1000000ULL / (runnable * 3);
+
+    uint64_t mismatches = 0;
+    double scalar_rate = 0, selected_rate = 0;
+    for (int i = 0; i < count && *running; i++) {
+        const struct blend_impl_t *impl = &impls[i];
+        if (impl->supported && !impl->supported()) {
+            printf("[ BENCH ] Blend %s: not supported by this CPU\n", impl->name);
+            continue;
+        }
+        uint64_t bad = i ? bench_blend_check(&impls[0], impl) : 0;
+        mismatches += bad;
+
+        bool selected = impl == blend_impl();
+        double premul = bench_blend_rate(impl->premul, osd, dst, budget_us, selected ? &g_blend_frame : NULL, running);
+        double straight = bench_blend_rate(impl->straight, osd_straight, dst, budget_us, NULL, running);
+        double dense_rate = bench_blend_rate(impl->premul, dense, dst, budget_us, NULL, running);
+        printf("[ BENCH ] Blend %s%s: %.0f / %.0f / %.0f Mpixel/s (premul / straight / dense), %llu mismatching runs\n",
+               impl->name, selected ? " (selected)" : "", premul / 1e6, straight / 1e6, dense_rate / 1e6,
+               (unsigned long long)bad);
+        bench_report_metric(bench_blend_metric(impl->name, "premul_mpix_s"), premul / 1e6);
+        bench_report_metric(bench_blend_metric(impl->name, "straight_mpix_s"), straight / 1e6);
+        bench_report_metric(bench_blend_metric(impl->name, "dense_mpix_s"), dense_rate / 1e6);
+        if (i == 0)
+            scalar_rate = premul;
+        if (selected)
+            selected_rate = premul;
+    }
+    free(osd);
+    free(osd_straight);
+    free(dense);
+    free(dst);
+
+    bench_report_metric("speedup", scalar_rate > 0 ? selected_rate / scalar_rate : 0);
+    bench_report_metric("mismatches", (double)mismatches);
+    return mismatches ? -1 : 0;
+}
+
+/*
+ * compose: the tile compositor on the LVGL frame with an OSD-like layer over it. Per frame, in turn:
+ * nothing changed, a HUD update (a few OSD cells and an LVGL label), everything changed (what every
+ * flush cost before). The composed frame is then compared with a composition from scratch.
+ */
+static struct bench_series_t g_compose[3];
+
+static void bench_compose_cell(uint32_t *layer, uint32_t *state, struct osd_rect_t *r)
+{
+    for (int y = r->y; y < r->y + r->h; y++)
+        for (int x = r->x; x < r->x + r->w; x++)
+            layer[y * BENCH_BLEND_WIDTH + x] = bench_blend_pixel(state, bench_blend_rand(state) % 3 ? 0 : 255, true);
+}
+
+static int bench_compose(struct config_t *cfg, volatile bool *running)
+{
+    static const char *names[3] = { "compose_static", "compose_hud", "compose_full" };
+    size_t frame = (size_t)BENCH_BLEND_WIDTH * BENCH_BLEND_HEIGHT;
+    uint32_t *ui = malloc(frame * sizeof(uint32_t));
+    uint32_t *osd = malloc(frame * sizeof(uint32_t));
+    uint32_t *expect = malloc(frame * sizeof(uint32_t));
+    int ret = ui && osd && expect ? comp_init(BENCH_BLEND_WIDTH, BENCH_BLEND_HEIGHT) : -1;
+    for (int i = 0; i < 3 && ret == 0; i++)
+        ret = bench_series_init(&g_compose[i], names[i], 1u << 20);
+    if (ret < 0) {
+        fprintf(stderr, "[ BENCH ] Out of memory\n");
+        for (int i = 0; i < 3; i++)
+            bench_series_free(&g_compose[i]);
+        comp_deinit();
+        free(ui);
+        free(osd);
+        free(expect);
+        return -1;
+    }
+    for (int i = 0; i < 3; i++)
+        bench_report_series(&g_compose[i]);
+
+    blend_init();
+    uint32_t state = 11;
+    bench_blend_osd_layer(osd, &state, true);
+    bench_blend_osd_layer(ui, &state, true);
+    struct comp_layers_t layers = { .ui = ui, .osd = osd };
+    struct osd_rect_t damage[COMP_MAX_DAMAGE];
+    comp_compose(&layers, damage, COMP_MAX_DAMAGE);
+
+    uint64_t frames[3] = {0}, upload_bytes[3] = {0};
+    uint64_t budget_us = (uint64_t)cfg->bench_seconds * 1000000ULL / 3;
+    for (int kind = 0; kind < 3 && *running; kind++) {
+        uint64_t start = get_time_us();
+        while (*running && (get_time_us() - start < budget_us || !frames[kind])) {
+            if (kind == 1) {
+                for (int c = 0; c < BENCH_COMPOSE_CELLS; c++) {
+                    struct osd_rect_t r = { (int)(bench_blend_rand(&state) % 53) * 24, (int)(bench_blend_rand(&state) % 20) * 36, 24, 36 };
+                    bench_compose_cell(osd, &state, &r);
+                    comp_damage(COMP_LAYER_OSD, &r);
+                }
+                struct osd_rect_t label = { 1040, 680, 200, 24 };
+                bench_compose_cell(ui, &state, &label);
+                comp_damage(COMP_LAYER_UI, &label);
+            } else if (kind == 2) {
+                comp_damage_all();
+            }
+            uint64_t t0 = get_time_us();
+            int n = comp_compose(&layers, damage, COMP_MAX_DAMAGE);
+            bench_series_add(&g_compose[kind], get_time_us() - t0);
+            for (int i = 0; i < n; i++)
+                upload_bytes[kind] += (uint64_t)damage[i].w * damage[i].h * 4;
+            frames[kind]++;
+        }
+    }
+
+    memcpy(expect, ui, frame * sizeof(uint32_t));
+    blend_src_over_premul(osd, expect, frame);
+    bool mismatch = memcmp(expect, comp_frame(), frame * sizeof(uint32_t)) != 0;
+    struct comp_stats_t stats;
+    comp_get_stats(&stats);
+    comp_deinit();
+    free(ui);
+    free(osd);
+    free(expect);
+
+    bench_report_metric("frame_bytes", (double)frame * 4);
+    bench_report_metric("static_upload_bytes_per_frame", frames[0] ? (double)upload_bytes[0] / frames[0] : 0);
+    bench_report_metric("hud_upload_bytes_per_frame", frames[1] ? (double)upload_bytes[1] / frames[1] : 0);
+    bench_report_metric("full_upload_bytes_per_frame", frames[2] ? (double)upload_bytes[2] / frames[2] : 0);
+    bench_report_metric("tiles_composed", (double)stats.tiles);
+    bench_report_metric("idle_frames", (double)stats.idle_frames);
+    bench_report_metric("mismatches", mismatch);
+    return mismatch ? -1 : 0;
+}
+
+/*
+ * telemetry: one producer thread per field sets it while a consumer imitates LVGL passes, first
+ * through the lock-free mailbox, then the way a value shared under lvgl_mutex would be set.
+ */
+static struct bench_series_t g_telem_set[2];
+static pthread_mutex_t g_telem_lock = PTHREAD_MUTEX_INITIALIZER;
+static int32_t g_telem_locked[TELEM_COUNT];
+static atomic_int g_telem_mode = -1;    // 0 mailbox, 1 mutex, -1 stop
+
+static void bench_telem_spin(uint64_t us)
+{
+    uint64_t start = get_time_us();
+    while (get_time_us() - start < us)
+        ;
+}
+
+static void *bench_telem_producer(void *arg)
+{
+    telem_field_t field = (telem_field_t)(intptr_t)arg;
+    int32_t value = 0;
+    int mode;
+    while ((mode = atomic_load(&g_telem_mode)) >= 0) {
+        value++;
+        uint64_t t0 = get_time_us();
+        if (mode == 0) {
+            telem_set(field, value);
+        } else {
+            pthread_mutex_lock(&g_telem_lock);
+            g_telem_locked[field] = value;
+            pthread_mutex_unlock(&g_telem_lock);
+        }
+        bench_series_add(&g_telem_set[mode], get_time_us() - t0);
+        usleep(BENCH_TELEM_SET_US);
+    }
+    return NULL;
+}
+
+static int bench_telemetry(struct config_t *cfg, volatile bool *running)
+{
+    static const char *names[2] = { "telem_set_mailbox", "telem_set_mutex" };
+    static const char *applied_names[TELEM_COUNT] = { "applied_video_fps", "applied_server_ping", "applied_link_rssi" };
+    int ret = 0;
+    for (int i = 0; i < 2 && ret == 0; i++)
+        ret = bench_series_init(&g_telem_set[i], names[i], 1u << 22);
+    if (ret < 0) {
+        fprintf(stderr, "[ BENCH ] Out of memory\n");
+        for (int i = 0; i < 2; i++)
+            bench_series_free(&g_telem_set[i]);
+        return -1;
+    }
+    for (int i = 0; i < 2; i++)
+        bench_report_series(&g_telem_set[i]);
+
+    pthread_t producers[TELEM_COUNT];
+    atomic_store(&g_telem_mode, 0);
+    for (int f = 0; f < TELEM_COUNT; f++)
+        pthread_create(&producers[f], NULL, bench_telem_producer, (void *)(intptr_t)f);
+
+    uint64_t applied[TELEM_COUNT] = {0}, passes = 0;
+    int32_t shown[TELEM_COUNT] = {0};
+    uint64_t budget_us = (uint64_t)cfg->bench_seconds * 1000000ULL / 2;
+    uint64_t start = get_time_us();
+    for (int mode = 0; mode < 2 && *running; mode++) {
+        atomic_store(&g_telem_mode, mode);
+        uint64_t mode_start = get_time_us();
+        while (*running && get_time_us() - mode_start < budget_us) {
+            if (mode == 0) {
+                int32_t values[TELEM_COUNT];
+                uint32_t due = telem_take((uint32_t)((get_time_us() - start) / 1000), values, NULL);
+                for (int f = 0; f < TELEM_COUNT; f++) {
+                    if (due & (1u << f)) {
+                        shown[f] = values[f];
+                        applied[f]++;
+                    }
+                }
+                bench_telem_spin(BENCH_TELEM_HOLD_US);
+            } else {
+                pthread_mutex_lock(&g_telem_lock);
+                bench_telem_spin(BENCH_TELEM_HOLD_US);
+                pthread_mutex_unlock(&g_telem_lock);
+            }
+            passes++;
+            usleep(BENCH_TELEM_PASS_US - BENCH_TELEM_HOLD_US);
+        }
+    }
+    atomic_store(&g_telem_mode, -1);
+    for (int f = 0; f < TELEM_COUNT; f++)
+        pthread_join(producers[f], NULL);
+
+    // past every throttle interval the last value of each field has to come out
+    int32_t values[TELEM_COUNT];
+    uint32_t due = telem_take((uint32_t)((get_time_us() - start) / 1000) + 60000, values, NULL);
+    int mismatches = 0;
+    for (int f = 0; f < TELEM_COUNT; f++) {
+        if (due & (1u << f))
+            shown[f] = values[f];
+        mismatches += shown[f] != telem_get(f);
+        bench_report_metric(applied_names[f], (double)applied[f]);
+    }
+    bench_report_metric("consumer_passes", (double)passes);
+    bench_report_metric("mismatches", mismatches);
+    return mismatches ? -1 : 0;
+}
+
+/*
+ * font: every binary font in UI_FONT_PATH loaded by ui_font (mapped) and by lv_binfont_create() (read
+ * into the heap), then each glyph drawn from both: rasterised once, from the glyph cache, and decoded
+ * by LVGL each time. Descriptors and bitmaps of the two have to be the same.
+ */
+static struct bench_series_t g_font[5];
+
+static int bench_font_glyphs(const lv_font_t *font, const lv_font_t *ref, lv_draw_buf_t *buf)
+{
+    int mismatches = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        for (uint32_t letter = ' '; letter < BENCH_FONT_LAST_LETTER; letter++) {
+            lv_font_glyph_dsc_t g, r;
+            bool found = lv_font_get_glyph_dsc(font, &g, letter, 0);
+            if (found != lv_font_get_glyph_dsc(ref, &r, letter, 0)) {
+                mismatches++;
+                continue;
+            }
+            if (!found || g.box_w == 0 || g.box_h == 0)
+                continue;
+            if (g.adv_w != r.adv_w || g.box_w != r.box_w || g.box_h != r.box_h || g.ofs_x != r.ofs_x ||
+                g.ofs_y != r.ofs_y || g.format != r.format) {
+                mismatches++;
+                continue;
+            }
+
+            uint64_t t0 = get_time_us();
+            const lv_draw_buf_t *bitmap = lv_font_get_glyph_bitmap(&g, NULL);
+            bench_series_add(&g_font[2 + pass], get_time_us() - t0);
+            lv_draw_buf_t *draw_buf = lv_draw_buf_reshape(buf, LV_COLOR_FORMAT_A8, r.box_w, r.box_h, LV_STRIDE_AUTO);
+            t0 = get_time_us();
+            const lv_draw_buf_t *expected = draw_buf ? lv_font_get_glyph_bitmap(&r, draw_buf) : NULL;
+            bench_series_add(&g_font[4], get_time_us() - t0);
+
+            if (!bitmap || !expected) {
+                mismatches++;
+            } else if (pass == 0) {
+                for (uint32_t y = 0; y < g.box_h; y++) {
+                    if (memcmp(bitmap->data + y * bitmap->header.stride, expected->data + y * expected->header.stride,
+                               g.box_w) != 0) {
+                        mismatches++;
+                        break;
+                    }
+                }
+            }
+            lv_font_glyph_release_draw_data(&g);
+            lv_font_glyph_release_draw_data(&r);
+        }
+    }
+    return mismatches;
+}
+
+static void bench_font_stats_add(struct ui_font_stats_t *total, const struct ui_font_stats_t *s)
+{
+    total->loaded += s->loaded;
+    total->mapped_bytes += s->mapped_bytes;
+    total->heap_bytes += s->heap_bytes;
+    if (s->cache_bytes > total->cache_bytes)
+        total->cache_bytes = s->cache_bytes;    // the peak, it is dropped with the fonts
+    total->hits += s->hits;
+    total->misses += s->misses;
+    total->evictions += s->evictions;
+}
+
+static int bench_font(struct config_t *cfg, volatile bool *running)
+{
+    (void)cfg;
+    static const char *names[5] = { "font_load_mapped", "font_load_binfont", "glyph_rasterise", "glyph_cached",
+                                    "glyph_binfont" };
+    int ret = 0;
+    for (int i = 0; i < 5 && ret == 0; i++)
+        ret = bench_series_init(&g_font[i], names[i], 1u << 20);
+    DIR *dir = ret == 0 ? opendir(UI_FONT_PATH) : NULL;
+    if (!dir) {
+        fprintf(stderr, ret ? "[ BENCH ] Out of memory\n" : "[ BENCH ] No fonts in " UI_FONT_PATH "\n");
+        for (int i = 0; i < 5; i++)
+            bench_series_free(&g_font[i]);
+        return -1;
+    }
+    for (int i = 0; i < 5; i++)
+        bench_report_series(&g_font[i]);
+
+    lv_init();
+    lv_draw_buf_t *buf = lv_draw_buf_create(256, 256, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    int fonts = 0, mismatches = 0;
+    struct ui_font_stats_t total = {0};
+    struct dirent *de;
+    while (buf && *running && (de = readdir(dir)) != NULL) {
+        size_t len = strlen(de->d_name);
+        if (len < 5 || strcmp(de->d_name + len - 4, ".bin") != 0)
+            continue;
+        char path[512], lv_path[520];
+        snprintf(path, sizeof(path), "%s/%s", UI_FONT_PATH, de->d_name);
+        snprintf(lv_path, sizeof(lv_path), "A:%s", path);
+
+        uint64_t t0 = get_time_us();
+        const lv_font_t *font = ui_font_load(path);
+        bench_series_add(&g_font[0], get_time_us() - t0);
+        t0 = get_time_us();
+        lv_font_t *ref = lv_binfont_create(lv_path);
+        bench_series_add(&g_font[1], get_time_us() - t0);
+        if (!font || !ref) {
+            printf("[ BENCH ] Font %s: failed to load\n", de->d_name);
+            mismatches++;
+        } else {
+            int bad = bench_font_glyphs(font, ref, buf);
+            printf("[ BENCH ] Font %s: %d mismatching glyphs\n", de->d_name, bad);
+            mismatches += bad;
+            fonts++;
+        }
+        if (ref)
+            lv_binfont_destroy(ref);
+        // ui_font keeps at most UI_FONT_MAX_LOADED
+        struct ui_font_stats_t stats;
+        ui_font_get_stats(&stats);
+        if (stats.loaded == UI_FONT_MAX_LOADED) {
+            bench_font_stats_add(&total, &stats);
+            ui_font_deinit();
+        }
+    }
+    closedir(dir);
+
+    struct ui_font_stats_t stats;
+    ui_font_get_stats(&stats);
+    bench_font_stats_add(&total, &stats);
+    stats = total;
+    bench_report_metric("fonts", fonts);
+    bench_report_metric("mapped_bytes", (double)stats.mapped_bytes);
+    bench_report_metric("heap_bytes", (double)stats.heap_bytes);
+    bench_report_metric("cache_bytes", (double)stats.cache_bytes);
+    bench_report_metric("cache_hits", (double)stats.hits);
+    bench_report_metric("cache_misses", (double)stats.misses);
+    bench_report_metric("cache_evictions", (double)stats.evictions);
+    bench_report_metric("mismatches", mismatches);
+    if (buf)
+        lv_draw_buf_destroy(buf);
+    ui_font_deinit();
+    lv_deinit();
+    return mismatches || !fonts ? -1 : 0;
+}
+
+#ifdef ENABLE_TRACE
+/*
+ * trace: producer threads record trace points in batches while the main thread dumps the rings every
+ * second. Once they stop, a dump has to hold the last TRACE_RING_EVENTS events of each.
+ */
+static struct bench_series_t g_trace_dump;
+static atomic_bool g_trace_stop;
+static uint64_t g_trace_events[BENCH_TRACE_THREADS];
+static uint64_t g_trace_cpu_ns[BENCH_TRACE_THREADS];
+
+static uint64_t bench_thread_cpu_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void *bench_trace_producer(void *arg)
+{
+    int idx = (int)(intptr_t)arg;
+    char name[16];
+    snprintf(name, sizeof(name), "bench %d", idx);
+    TRACE_THREAD(name);
+
+    uint64_t n = 0, cpu_ns = 0;
+    while (!atomic_load(&g_trace_stop)) {
+        uint64_t t0 = bench_thread_cpu_ns();
+        for (int i = 0; i < BENCH_TRACE_BATCH; i++, n++)
+            TRACE_INSTANT((trace_point_t)(n % TRACE_POINT_COUNT), n);
+        cpu_ns += bench_thread_cpu_ns() - t0;
+        usleep(100);
+    }
+    g_trace_events[idx] = n;
+    g_trace_cpu_ns[idx] = cpu_ns;
+    return NULL;
+}
+
+static int bench_trace(struct config_t *cfg, volatile bool *running)
+{
+    static const char path[] = TRACE_DUMP_DIR "/vd-link-trace-bench.json";
+    if (bench_series_init(&g_trace_dump, "trace_dump", 1024) < 0) {
+        fprintf(stderr, "[ BENCH ] Out of memory\n");
+        return -1;
+    }
+    bench_report_series(&g_trace_dump);
+
+    pthread_t producers[BENCH_TRACE_THREADS];
+    atomic_store(&g_trace_stop, false);
+    for (int i = 0; i < BENCH_TRACE_THREADS; i++)
+        pthread_create(&producers[i], NULL, bench_trace_producer, (void *)(intptr_t)i);
+
+    uint64_t start = get_time_us();
+    while (*running && get_time_us() - start < (uint64_t)cfg->bench_seconds * 1000000ULL) {
+        sleep(1);
+        uint64_t t0 = get_time_us();
+        if (trace_dump(path) < 0) {
+            fprintf(stderr, "[ BENCH ] Can't write %s\n", path);
+            break;
+        }
+        bench_series_add(&g_trace_dump, get_time_us() - t0);
+    }
+    atomic_store(&g_trace_stop, true);
+
+    uint64_t events = 0, expect = 0, cpu_ns = 0;
+    for (int i = 0; i < BENCH_TRACE_THREADS; i++) {
+        pthread_join(producers[i], NULL);
+        events += g_trace_events[i];
+        expect += g_trace_events[i] < TRACE_RING_EVENTS ? g_trace_events[i] : TRACE_RING_EVENTS;
+        cpu_ns += g_trace_cpu_ns[i];
+    }
+
+    int written = trace_dump(path);
+    struct stat st;
+    bench_report_metric("dump_bytes", stat(path, &st) == 0 ? (double)st.st_size : 0);
+    unlink(path);
+
+    int missing = written < 0 ? (int)expect : (int)(expect - (uint64_t)written);
+    bench_report_metric("events", (double)events);
+    bench_report_metric("record_ns", events ? (double)cpu_ns / events : 0);
+    bench_report_metric("events_dumped", written);
+    bench_report_metric("missing", missing);
+    return missing ? -1 : 0;
+}
+#endif
+
+static const struct bench_kind_t bench_kinds[] = {
+    { "pipeline", "RTP receive -> decode -> null sink", bench_pipeline },
+    { "osd",      "full screen MSP OSD character map render", bench_osd },
+    { "osd-indexed", "the same on the 8-bit indexed OSD surface, plus expansion to ARGB", bench_osd_indexed },
+    { "msp",      "MSP DisplayPort parsing, buffer vs byte at a time", bench_msp },
+    { "osd-delta", "OSD link bandwidth, MSP DisplayPort vs character map deltas", bench_osd_delta },
+    { "osd-seek", "seeks in an OSD recording through its keyframe index", bench_osd_seek },
+    { "blend",    "OSD layer SRC_OVER blend, per SIMD implementation, checked against scalar", bench_blend },
+    { "compose",  "tile compositor per frame: static HUD, a few cells changed, everything changed", bench_compose },
+    { "telemetry", "UI telemetry set from producer threads, lock-free mailbox vs lvgl_mutex", bench_telemetry },
+    { "font",     "binary UI fonts, mapped with a glyph cache vs lv_binfont_create(), checked against it", bench_font },
+#ifdef ENABLE_TRACE
+    { "trace",    "trace point cost from producer threads and Chrome trace dumps of their rings", bench_trace },
+#endif
+};
+
+int bench_main(struct config_t *cfg, volatile bool *running)
+{
+    const char *kind_name = cfg->bench ? cfg->bench : BENCH_DEFAULT_KIND;
+    const struct bench_kind_t *kind = NULL;
+    for (size_t i = 0; i < sizeof(bench_kinds) / sizeof(bench_kinds[0]); i++) {
+        if (strcmp(bench_kinds[i].name, kind_name) == 0)
+            kind = &bench_kinds[i];
+    }
+    if (!kind) {
+        fprintf(stderr, "Unknown benchmark: %s\nAvailable:\n", kind_name);
+        for (size_t i = 0; i < sizeof(bench_kinds) / sizeof(bench_kinds[0]); i++)
+            fprintf(stderr, "  %-12s %s\n", bench_kinds[i].name, bench_kinds[i].description);
+        return 2;
+    }
+    if (cfg->bench_seconds <= 0)
+        cfg->bench_seconds = BENCH_DEFAULT_SECONDS;
+
+    printf("[ BENCH ] Running %s for %d s\n", kind->name, cfg->bench_seconds);
+    atomic_store(&g_active, true);
+    bench_thread_register("main");
+
+    uint64_t t0 = get_time_us();
+    int ret = kind->run(cfg, running);
+    double duration_s = (get_time_us() - t0) / 1e6;
+
+    atomic_store(&g_active, false);
+
+    /* the summary is a single JSON line: last line of stdout, or the --bench-out file */
+    FILE *out = stdout;
+    if (cfg->bench_out && !(out = fopen(cfg->bench_out, "w"))) {
+        perror("[ BENCH ] fopen");
+        out = stdout;
+    }
+    bench_write_report(out, kind->name, duration_s, ret);
+    if (out != stdout)
+        fclose(out);
+    fflush(stdout);
+
+    for (int i = 0; i < g_series_count; i++)
+        bench_series_free(g_series[i]);
+    return ret == 0 ? 0 : 1;
+}
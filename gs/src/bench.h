@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_BENCH_H
+#define VD_LINK_BENCH_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "common.h"
+
+/*
+ * Headless benchmark mode (--bench[=kind]).
+ * Runs one benchmark kind without display/UI and prints a JSON summary (stdout or --bench-out),
+ * so regressions can be caught in CI on plain Linux.
+ *
+ *  pipeline - RTP receiver + decoder into a null display sink, live or replayed input
+ *  osd      - MSP OSD full screen glyph render
+ *  osd-indexed - the same on the 8-bit indexed surface, plus its expansion to ARGB
+ *  msp      - MSP parser + dispatch throughput on synthetic DisplayPort traffic
+ *  osd-delta - OSD link bytes as MSP DisplayPort vs osd_delta packets, on a capture or synthetic session
+ *  osd-seek - random seeks in an OSD recording through its keyframe index, vs decoding from the start
+ *  blend    - SRC_OVER of the OSD layer into the LVGL frame by each SIMD implementation, checked against scalar
+ *  compose  - tile compositor cost and upload size per frame, static HUD vs a few changed cells vs full frame
+ *  telemetry - producer-side cost of a UI telemetry update, lock-free mailbox vs a lock held per LVGL pass
+ *  font     - binary UI font load and glyph draw, mapped with a glyph cache vs LVGL's loader
+ *  trace    - trace point cost and dump time with -DENABLE_TRACE=ON, see trace.h
+ */
+
+#define BENCH_DEFAULT_KIND      "pipeline"
+#define BENCH_DEFAULT_SECONDS   10
+
+typedef enum {
+    BENCH_STAGE_QUEUE = 0,      // RTP chunk received -> handed to the decoder
+    BENCH_STAGE_DECODE,         // handed to the decoder -> frame out
+    BENCH_STAGE_SINK,           // frame out -> handed to the display (conversion, copy)
+    BENCH_STAGE_COUNT
+} bench_stage_t;
+
+/* Latency samples in microseconds, percentiles are computed when the report is written */
+struct bench_series_t {
+    const char *name;
+    uint32_t *samples;
+    uint32_t capacity;
+    atomic_uint count;          // may exceed capacity, extra samples are dropped
+};
+
+/** True while a benchmark runs: decoders use a null display sink */
+bool bench_active(void);
+
+/** Register the calling thread for the per-thread CPU time report */
+void bench_thread_register(const char *name);
+
+/** Take the final CPU time of a registered thread that is about to finish */
+void bench_thread_exit(const char *name);
+
+/* pipeline counters, cheap no-ops when no benchmark runs */
+void bench_count_packet(int bytes);
+void bench_count_frame(void);
+void bench_stage_sample(bench_stage_t stage, uint64_t us);
+
+/* building blocks for benchmark kinds */
+int  bench_series_init(struct bench_series_t *s, const char *name, uint32_t capacity);
+void bench_series_add(struct bench_series_t *s, uint64_t us);
+void bench_series_free(struct bench_series_t *s);
+void bench_report_metric(const char *name, double value);
+void bench_report_series(struct bench_series_t *s);
+
+/**
+ * Run the benchmark selected by cfg->bench until done or *running goes false.
+ * Returns the process exit code.
+ */
+int bench_main(struct config_t *cfg, volatile bool *running);
+
+#endif //VD_LINK_BENCH_H
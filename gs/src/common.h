@@ -19,9 +19,24 @@ struct config_t {
     const char* ip;
     int port;
     int wfb_port;
+    int osd_port;               // MSP DisplayPort over UDP, 0 disables
     int pt;
     codec_type_t codec;
+    int latency_budget_ms;
+    const char *bench;          // benchmark kind, NULL when not benchmarking
+    int bench_seconds;
+    const char *bench_out;      // JSON summary file, stdout if NULL
+    const char *capture_file;   // rtpdump file to record received RTP into
+    const char *replay_file;    // rtpdump file to read RTP from instead of the socket
+    double replay_speed;        // 1.0 original pacing, 0 as fast as possible
+    bool osd_indexed;           // 8-bit indexed MSP OSD surface instead of ARGB
+    const char *osd_record_file; // .osd file to record the MSP OSD into, same clock as --capture
 } ;
 
+/* Region of an OSD frame in pixels */
+struct osd_rect_t {
+    int x, y, w, h;
+};
+
 
 #endif //VRX_COMMON_H
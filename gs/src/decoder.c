@@ -23,6 +23,11 @@
 #include <linux/dma-buf.h>
 #include "src/drm_display.h"
 #include "ui/ui.h"
+#include "nal_util.h"
+#include "latency_ctl.h"
+#include "rtp_receiver.h"
+#include "bench.h"
+#include "trace.h"
 
 #define DECODER_DEBUG 0
 
@@ -33,6 +38,15 @@ static MppCtx ctx = NULL;
 static MppApi *mpi = NULL;
 static MppBufferGroup frm_grp = NULL;
 static MppCodingType type = MPP_VIDEO_CodingUnused;
+static codec_type_t codec_type = CODEC_UNKNOWN;
+
+/* catch-up: lag is measured on the decoder output (pts is the input time in us) */
+static struct latency_ctl_t latency;
+static _Atomic uint64_t output_lag_us = 0;
+static _Atomic uint64_t output_pts_us = 0;
+static uint64_t keyframe_fed_us = 0;
+static bool first_frame_shown = false;
+static bool unpaced_input = false;      // replay without pacing: wait for the decoder, never drop
 
 struct video_frame_t {
     size_t size;            // Size of the video frame data
@@ -63,6 +77,13 @@ uint64_t get_time_ms()
     return spec.tv_sec * 1000 + spec.tv_nsec / 1e6;
 }
 
+static uint64_t get_time_us(void)
+{
+    struct timespec spec;
+    clock_gettime(CLOCK_MONOTONIC, &spec);
+    return (uint64_t)spec.tv_sec * 1000000ULL + (uint64_t)spec.tv_nsec / 1000ULL;
+}
+
 static int decoder_buff_init_internal(int w, int h, MppFrameFormat format)
 {
     if ((format != MPP_FMT_YUV420SP) && (format != MPP_FMT_YUV420SP_10BIT)) {
@@ -223,10 +244,13 @@ static void* decoder_thread_func(void* arg)
 {
     printf("[ DECODER ] Decoder thread started\n");
     (void)arg;
+    bench_thread_register("decoder");
+    TRACE_THREAD("decoder");
     int first_frames = 0;
 
      while (atomic_load(&decoder_running)) {
         MppFrame frame = NULL;
+        TRACE_BEGIN(t_get);
         // Get a decoded frame from MPP (non-blocking)
         MPP_RET ret = mpi->decode_get_frame(ctx, &frame);
         if (ret == MPP_OK && frame) {
@@ -268,7 +292,28 @@ static void* decoder_thread_func(void* arg)
 #if DECODER_DEBUG
                 printf("[ DECODER ] Frame ready: %dx%d, stride(%dx%d) dma_fd=%d\n", width, height, hor_stride, ver_stride, dma_fd);
 #endif
-                drm_push_new_video_frame(dma_fd, width, height, hor_stride, ver_stride);
+                uint64_t sink_start_us = get_time_us();
+                TRACE_END(TRACE_DECODER_GET, t_get,
+                          mpp_frame_get_pts(frame) > 0 ? (sink_start_us - (uint64_t)mpp_frame_get_pts(frame)) / 1000 : 0);
+                if (!bench_active()) {
+                    TRACE_BEGIN(t_push);
+                    drm_push_new_video_frame(dma_fd, width, height, hor_stride, ver_stride);
+                    TRACE_END(TRACE_VIDEO_PUSH, t_push, 0);
+                }
+                if (!first_frame_shown) {
+                    first_frame_shown = true;
+                    rtp_receiver_first_frame();
+                }
+
+                RK_S64 pts = mpp_frame_get_pts(frame);
+                uint64_t now_us = get_time_us();
+                if (pts > 0 && (uint64_t)pts <= sink_start_us) {
+                    atomic_store(&output_lag_us, now_us - (uint64_t)pts);
+                    atomic_store(&output_pts_us, (uint64_t)pts);
+                    bench_stage_sample(BENCH_STAGE_DECODE, sink_start_us - (uint64_t)pts);
+                }
+                bench_stage_sample(BENCH_STAGE_SINK, now_us - sink_start_us);
+                bench_count_frame();
                 mpp_frame_deinit(&frame);
 
                 // FPS calculation block
@@ -322,6 +367,13 @@ int decoder_start(struct config_t *cfg)
         printf("[ DECODER ] Unsupported codec: %d\n", cfg->codec);
         return -1;
     }
+    codec_type = cfg->codec;
+    latency_ctl_init(&latency, cfg->latency_budget_ms);
+    unpaced_input = rtp_receiver_unpaced(cfg);
+    atomic_store(&output_lag_us, 0);
+    atomic_store(&output_pts_us, 0);
+    keyframe_fed_us = 0;
+    first_frame_shown = false;
 
     MPP_RET ret = mpp_create(&ctx, &mpi);
     if (ret != MPP_OK) {
@@ -443,15 +495,18 @@ int decoder_start(struct config_t *cfg)
     return 0;
 }
 
-int decoder_put_frame(struct config_t *cfg, void *data, int size)
+void decoder_prepare(int width, int height)
 {
-    static int decoder_stalled_count=0;
+    if (width <= 0 || height <= 0 || bench_active())
+        return;
+    /* MPP allocates its frame buffers on the info change triggered by the cached SPS,
+     * here only the display side (rotate pool) is prepared */
+    drm_prepare_video(width, height, align16(width), align16(height));
+}
 
-    (void)cfg; // Unused parameter, can be removed if not needed
-    if (ctx == NULL || mpi == NULL) {
-        printf("[ DECODER ] Decoder not initialized\n");
-        return -1;
-    }
+static int decoder_feed(void *data, int size)
+{
+    static int decoder_stalled_count=0;
 
     MppPacket packet;
     MPP_RET ret = mpp_packet_init(&packet, data, size);
@@ -464,26 +519,76 @@ int decoder_put_frame(struct config_t *cfg, void *data, int size)
     mpp_packet_set_size(packet, size);
     mpp_packet_set_pos(packet, data);
     mpp_packet_set_length(packet, size);
-    mpp_packet_set_pts(packet,(RK_S64) get_time_ms());
+    // pts: when MPP took the packet, the wait for its input is BENCH_STAGE_QUEUE
+    mpp_packet_set_pts(packet, (RK_S64)get_time_us());
 
+    /* unpaced replay waits for the decoder instead of dropping, only a real stall gives up */
+    uint64_t stall_ms = unpaced_input ? 5000 : 100;
     uint64_t data_feed_begin = get_time_ms();
+    TRACE_BEGIN(t_put);
     while (MPP_OK != (ret = mpi->decode_put_packet(ctx, packet))) {
-        printf("[ DECODER ] decode_put_packet returned %d, retrying...\n", ret);
+        if (!unpaced_input)
+            printf("[ DECODER ] decode_put_packet returned %d, retrying...\n", ret);
         uint64_t elapsed = get_time_ms() - data_feed_begin;
-        if (elapsed > 100) {
+        if (elapsed > stall_ms) {
             decoder_stalled_count++;
             printf("[ DRM ] Cannot feed decoder, stalled %d \n?", decoder_stalled_count);
             mpp_packet_deinit(&packet);
+            latency_ctl_resync(&latency, "Decoder stalled");
             return -1;
         }
         usleep(1000);
+        mpp_packet_set_pts(packet, (RK_S64)get_time_us());
     }
 
     mpp_packet_deinit(&packet);
+    TRACE_END(TRACE_DECODER_PUT, t_put, size);
 
     return 0;
 }
 
+int decoder_put_frame(struct config_t *cfg, void *data, int size)
+{
+    static uint64_t last_report_us = 0;
+
+    (void)cfg; // Unused parameter, can be removed if not needed
+    if (ctx == NULL || mpi == NULL) {
+        printf("[ DECODER ] Decoder not initialized\n");
+        return -1;
+    }
+
+    struct nal_info_t nal;
+    nal_parse(codec_type, data, size, &nal);
+
+    /* output lag of frames fed before the last keyframe says nothing about the stream after it */
+    uint64_t now_us = get_time_us();
+    uint64_t lag_us = atomic_load(&output_pts_us) >= keyframe_fed_us ? atomic_load(&output_lag_us) : 0;
+    if (unpaced_input)
+        lag_us = 0;
+    if (now_us - last_report_us >= 1000000ULL) {
+        latency_ctl_report(&latency, "[ DECODER ] ");
+        last_report_us = now_us;
+    }
+
+    bool need_start_code = false;
+    if (latency_ctl_drop(&latency, &nal, lag_us, &need_start_code)) {
+        return 0;
+    }
+    if (nal.kind == NAL_KIND_KEYFRAME) {
+        keyframe_fed_us = now_us;
+    }
+
+    if (need_start_code) {
+        static uint8_t start_code[4] = {0, 0, 0, 1};
+        if (decoder_feed(start_code, sizeof(start_code)) < 0)
+            return -1;
+    }
+    int ret = decoder_feed(data, size);
+    if (ret == 0)
+        bench_stage_sample(BENCH_STAGE_QUEUE, get_time_us() - now_us);
+    return ret;
+}
+
 int decoder_stop(void)
 {
     if (ctx == NULL || mpi == NULL) {
@@ -493,7 +598,8 @@ int decoder_stop(void)
     atomic_store(&decoder_running, 0);
     pthread_join(decoder_thread, NULL);
     mpp_destroy(ctx);
-    mpp_destroy(mpi);
+    ctx = NULL;
+    mpi = NULL;
     type = MPP_VIDEO_CodingUnused;
 
     printf("[ DECODER ] decoder stopped\n");
@@ -9,6 +9,8 @@
 
 int decoder_start(struct config_t *cfg);
 int decoder_put_frame(struct config_t *cfg, void *data, int size);
+/** Pre-size decoder/display buffers from cached stream parameters, before the first packet */
+void decoder_prepare(int width, int height);
 int decoder_stop(void);
 
 #endif //VRX_DECODER_H
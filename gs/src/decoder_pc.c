@@ -14,6 +14,14 @@
 #include <pthread.h>
 #include <string.h>
 #include <time.h>
+#include <math.h>
+
+#include "nal_util.h"
+#include "latency_ctl.h"
+#include "param_cache.h"
+#include "rtp_receiver.h"
+#include "bench.h"
+#include "trace.h"
 
 /* FFmpeg */
 #include "ui/ui.h"
@@ -36,10 +44,22 @@ static uint64_t get_time_ms(void)
            (uint64_t)spec.tv_nsec / 1000000ULL;
 }
 
+static uint64_t get_time_us(void)
+{
+    struct timespec spec;
+    if (clock_gettime(CLOCK_MONOTONIC, &spec) == -1) {
+        return 0;
+    }
+    return (uint64_t)spec.tv_sec * 1000000ULL +
+           (uint64_t)spec.tv_nsec / 1000ULL;
+}
+
 /* ---------------------- decoder state ----------------------- */
 
 static AVCodecContext *g_dec_ctx = NULL;
 static AVFrame        *g_frame   = NULL;
+static const AVCodec  *g_codec   = NULL;
+static codec_type_t    g_codec_type = CODEC_UNKNOWN;
 
 static struct SwsContext *g_sws_ctx             = NULL;
 static enum AVPixelFormat g_sws_src_fmt         = AV_PIX_FMT_NONE;
@@ -58,27 +78,42 @@ static volatile bool g_decoder_running = false;
 struct pkt_item {
     uint8_t *data;
     int      size;
+    uint64_t arrival_us;
+    bool     lost;          /* older items were dropped on overflow before this one */
 };
 
 static struct pkt_item g_pkt_queue[DEC_PKT_QUEUE_SIZE];
 static int             g_pkt_head = 0;
 static int             g_pkt_tail = 0;
+static bool            g_pkt_lost = false;
+
+static struct latency_ctl_t g_latency;
+static bool g_first_frame_shown = false;
+static uint64_t g_fps_time = 0;        /* decoder thread: start of the FPS second, ms */
+static int g_fps_frames = 0;
+static bool g_null_sink = false;        /* --bench: decode without display */
+static bool g_backpressure = false;     /* unpaced replay: block the producer instead of dropping */
 
 static pthread_mutex_t g_pkt_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t  g_pkt_cond  = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  g_pkt_space_cond = PTHREAD_COND_INITIALIZER;
 
 static int pkt_queue_push(const void *data, int size)
 {
     pthread_mutex_lock(&g_pkt_mutex);
 
     int next_tail = (g_pkt_tail + 1) % DEC_PKT_QUEUE_SIZE;
+    while (g_backpressure && next_tail == g_pkt_head && g_decoder_running) {
+        pthread_cond_wait(&g_pkt_space_cond, &g_pkt_mutex);
+    }
     if (next_tail == g_pkt_head) {
-        /* queue full – drop oldest (low-latency) */
+        /* queue full – drop oldest (low-latency), it may be a reference so the decoder has to resync */
         struct pkt_item *old = &g_pkt_queue[g_pkt_head];
         free(old->data);
         old->data = NULL;
         old->size = 0;
         g_pkt_head = (g_pkt_head + 1) % DEC_PKT_QUEUE_SIZE;
+        g_pkt_lost = true;
     }
 
     struct pkt_item *item = &g_pkt_queue[g_pkt_tail];
@@ -89,6 +124,7 @@ static int pkt_queue_push(const void *data, int size)
     }
     memcpy(item->data, data, (size_t)size);
     item->size = size;
+    item->arrival_us = get_time_us();
 
     g_pkt_tail = next_tail;
 
@@ -112,11 +148,14 @@ static int pkt_queue_pop(struct pkt_item *out)
     }
 
     *out = g_pkt_queue[g_pkt_head];
+    out->lost = g_pkt_lost;
+    g_pkt_lost = false;
     g_pkt_queue[g_pkt_head].data = NULL;
     g_pkt_queue[g_pkt_head].size = 0;
 
     g_pkt_head = (g_pkt_head + 1) % DEC_PKT_QUEUE_SIZE;
 
+    pthread_cond_signal(&g_pkt_space_cond);
     pthread_mutex_unlock(&g_pkt_mutex);
     return 0;
 }
@@ -131,9 +170,321 @@ static void pkt_queue_flush(void)
         item->size = 0;
         g_pkt_head = (g_pkt_head + 1) % DEC_PKT_QUEUE_SIZE;
     }
+    g_pkt_lost = false;
     pthread_mutex_unlock(&g_pkt_mutex);
 }
 
+/* ---------------------- threading policy -------------------- */
+
+/*
+ * libavcodec threading is picked at runtime instead of at compile time:
+ *  - start single threaded (no added latency),
+ *  - if decoding takes too long compared to the frame interval, switch to slice threads
+ *    (no added latency, but only helps when the encoder emits several slices per frame),
+ *  - if still overloaded, switch to frame threads, which add (threads - 1) frames of delay,
+ *  - once the load stays under the low-water mark for a few windows, step back down one level, but
+ *    only when the level below would still keep up, so frame threading's delay isn't kept for good.
+ * Thread settings can't be changed on an open codec context, so a switch re-opens the decoder.
+ * Switches are applied on the next keyframe boundary (VPS/SPS/IDR) so no reference frame is lost.
+ */
+
+enum dec_thread_mode {
+    DEC_THREAD_SINGLE = 0,
+    DEC_THREAD_SLICE,
+    DEC_THREAD_FRAME,
+};
+
+#define DEC_POLICY_WINDOW_FRAMES  120   /* frames per measurement window */
+#define DEC_POLICY_HIGH_LOAD      0.80  /* escalate when decode time > 80% of frame interval */
+#define DEC_POLICY_TARGET_LOAD    0.70  /* frame threads are sized for this per-thread load */
+#define DEC_POLICY_LOW_LOAD       0.40  /* step down when the lower level stays under this */
+#define DEC_POLICY_LOW_WINDOWS    3     /* ... for this many windows in a row */
+#define DEC_POLICY_MAX_SLICE_THR  4
+#define DEC_POLICY_MAX_FRAME_THR  8
+
+struct dec_policy {
+    enum dec_thread_mode mode;
+    int       threads;
+    int       cores;
+
+    /* measurement window */
+    uint64_t  window_start_us;
+    uint64_t  busy_us;          /* wall time spent inside send_packet/receive_frame */
+    uint64_t  latency_us;       /* sum of packet -> frame latency (used in frame mode) */
+    int       frames;
+    int       width;
+    int       height;
+    int       low_windows;      /* consecutive windows under DEC_POLICY_LOW_LOAD */
+
+    /* last window measured */
+    double    cost_ms;
+    double    interval_ms;
+
+    /* switch scheduled for the next keyframe boundary */
+    bool      pending;
+    enum dec_thread_mode pending_mode;
+    int       pending_threads;
+
+    /* last seen parameter sets, re-fed after a re-open (VPS, SPS, PPS) */
+    struct stream_params_t params;
+};
+
+static struct dec_policy g_policy = { .mode = DEC_THREAD_SINGLE, .threads = 1 };
+
+static const char *dec_thread_mode_name(enum dec_thread_mode mode)
+{
+    switch (mode) {
+    case DEC_THREAD_SLICE:
+        return "slice";
+    case DEC_THREAD_FRAME:
+        return "frame";
+    default:
+        return "single";
+    }
+}
+
+static int clamp_int(int v, int lo, int hi)
+{
+    if (v < lo)
+        return lo;
+    if (v > hi)
+        return hi;
+    return v;
+}
+
+static void dec_policy_reset_window(struct dec_policy *p)
+{
+    p->window_start_us = 0;
+    p->busy_us = 0;
+    p->latency_us = 0;
+    p->frames = 0;
+}
+
+static void dec_policy_schedule(struct dec_policy *p, enum dec_thread_mode mode, int threads,
+                                double cost_ms, double interval_ms)
+{
+    if (mode == p->mode && threads == p->threads) {
+        return;
+    }
+    p->pending = true;
+    p->pending_mode = mode;
+    p->pending_threads = threads;
+    p->low_windows = 0;
+
+    if (interval_ms <= 0) {
+        /* nothing measured yet */
+        printf("[DECODER] Threading: %s x%d -> %s x%d, applied on next keyframe\n",
+               dec_thread_mode_name(p->mode), p->threads, dec_thread_mode_name(mode), threads);
+        return;
+    }
+    double added_ms = (mode == DEC_THREAD_FRAME) ? (threads - 1) * interval_ms : 0.0;
+    printf("[DECODER] Threading: %s x%d -> %s x%d (decode %.2f ms / frame interval %.2f ms, %d cores),"
+           " added latency %d frames = %.1f ms, applied on next keyframe\n",
+           dec_thread_mode_name(p->mode), p->threads,
+           dec_thread_mode_name(mode), threads,
+           cost_ms, interval_ms, p->cores,
+           (mode == DEC_THREAD_FRAME) ? threads - 1 : 0, added_ms);
+}
+
+/*
+ * One level down when the load there would stay under the low-water mark. Slice threads speed
+ * decoding up by at most their count, frame mode's cost is already that of one frame on one thread.
+ */
+static void dec_policy_step_down(struct dec_policy *p, double load, double cost_ms, double interval_ms)
+{
+    switch (p->mode) {
+    case DEC_THREAD_SLICE:
+        if (load * p->threads < DEC_POLICY_LOW_LOAD)
+            dec_policy_schedule(p, DEC_THREAD_SINGLE, 1, cost_ms * p->threads, interval_ms);
+        break;
+    case DEC_THREAD_FRAME:
+        if (p->threads > 2 && (int)ceil(load / DEC_POLICY_TARGET_LOAD) <= p->threads - 1)
+            dec_policy_schedule(p, DEC_THREAD_FRAME, p->threads - 1, cost_ms, interval_ms);
+        else if (p->threads <= 2)
+            dec_policy_schedule(p, DEC_THREAD_SLICE, clamp_int(p->cores, 2, DEC_POLICY_MAX_SLICE_THR),
+                                cost_ms, interval_ms);
+        break;
+    default:
+        break;
+    }
+}
+
+/* Called for every decoded frame */
+static void dec_policy_on_frame(struct dec_policy *p, int width, int height, uint64_t now_us, int64_t frame_pts_us)
+{
+    if (width != p->width || height != p->height) {
+        bool smaller = (int64_t)width * height < (int64_t)p->width * p->height;
+        if (p->width && p->height) {
+            printf("[DECODER] Resolution changed %dx%d -> %dx%d, re-evaluating threading\n",
+                   p->width, p->height, width, height);
+            /* a smaller stream may not need threads anymore: probe single thread again */
+            if (smaller && p->mode != DEC_THREAD_SINGLE) {
+                dec_policy_schedule(p, DEC_THREAD_SINGLE, 1, p->cost_ms, p->interval_ms);
+            }
+        }
+        p->width = width;
+        p->height = height;
+        dec_policy_reset_window(p);
+    }
+
+    if (!p->window_start_us) {
+        /* first frame only opens the window */
+        p->window_start_us = now_us;
+        p->busy_us = 0;
+        p->latency_us = 0;
+        return;
+    }
+
+    p->frames++;
+    if (frame_pts_us > 0 && (uint64_t)frame_pts_us <= now_us) {
+        p->latency_us += now_us - (uint64_t)frame_pts_us;
+    }
+
+    if (p->frames < DEC_POLICY_WINDOW_FRAMES || p->pending) {
+        return;
+    }
+
+    double interval_ms = (double)(now_us - p->window_start_us) / p->frames / 1000.0;
+    double cost_ms;
+    if (p->mode == DEC_THREAD_FRAME) {
+        /* calls return immediately in frame mode, estimate cost from latency minus pipeline delay */
+        cost_ms = (double)p->latency_us / p->frames / 1000.0 - (p->threads - 1) * interval_ms;
+        if (cost_ms < 0)
+            cost_ms = 0;
+    } else {
+        cost_ms = (double)p->busy_us / p->frames / 1000.0;
+    }
+    double load = interval_ms > 0 ? cost_ms / interval_ms : 0.0;
+    p->cost_ms = cost_ms;
+    p->interval_ms = interval_ms;
+    int max_frame_threads = clamp_int(p->cores, 2, DEC_POLICY_MAX_FRAME_THR);
+
+    if (load > DEC_POLICY_HIGH_LOAD) {
+        switch (p->mode) {
+        case DEC_THREAD_SINGLE:
+            if (p->cores >= 2) {
+                dec_policy_schedule(p, DEC_THREAD_SLICE, clamp_int(p->cores, 2, DEC_POLICY_MAX_SLICE_THR),
+                                    cost_ms, interval_ms);
+            }
+            break;
+        case DEC_THREAD_SLICE:
+            if (p->cores >= 2) {
+                /* slices did not help enough - size frame threads for the measured cost */
+                int n = (int)ceil(load / DEC_POLICY_TARGET_LOAD);
+                n = clamp_int(n, 2, max_frame_threads);
+                dec_policy_schedule(p, DEC_THREAD_FRAME, n, cost_ms, interval_ms);
+            }
+            break;
+        case DEC_THREAD_FRAME:
+            if (p->cores >= 2 && p->threads < max_frame_threads) {
+                dec_policy_schedule(p, DEC_THREAD_FRAME, p->threads + 1, cost_ms, interval_ms);
+            }
+            break;
+        }
+    }
+
+    /* hysteresis: only a load that stays low brings the level down */
+    p->low_windows = load < DEC_POLICY_LOW_LOAD ? p->low_windows + 1 : 0;
+    if (p->low_windows >= DEC_POLICY_LOW_WINDOWS && !p->pending) {
+        p->low_windows = 0;
+        dec_policy_step_down(p, load, cost_ms, interval_ms);
+    }
+
+    p->window_start_us = now_us;
+    p->busy_us = 0;
+    p->latency_us = 0;
+    p->frames = 0;
+}
+
+static void decoder_receive_frames(AVCodecContext *ctx);
+
+static AVCodecContext *decoder_open_ctx(enum dec_thread_mode mode, int threads)
+{
+    AVCodecContext *ctx = avcodec_alloc_context3(g_codec);
+    if (!ctx) {
+        printf("[DECODER] avcodec_alloc_context3 failed\n");
+        return NULL;
+    }
+
+    ctx->flags2 |= AV_CODEC_FLAG2_FAST;
+    switch (mode) {
+    case DEC_THREAD_SLICE:
+        ctx->thread_count = threads;
+        ctx->thread_type  = FF_THREAD_SLICE;
+        ctx->flags       |= AV_CODEC_FLAG_LOW_DELAY;
+        break;
+    case DEC_THREAD_FRAME:
+        /* libavcodec silently disables frame threads when LOW_DELAY is set */
+        ctx->thread_count = threads;
+        ctx->thread_type  = FF_THREAD_FRAME;
+        break;
+    default:
+        ctx->thread_count = 1;
+        ctx->thread_type  = 0;
+        ctx->flags       |= AV_CODEC_FLAG_LOW_DELAY;
+        break;
+    }
+
+    if (avcodec_open2(ctx, g_codec, NULL) < 0) {
+        printf("[DECODER] avcodec_open2 failed\n");
+        avcodec_free_context(&ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+/* Re-open the decoder with the pending threading mode. Called from the decoder thread only. */
+static void dec_policy_apply(struct dec_policy *p, const struct nal_info_t *info)
+{
+    AVCodecContext *ctx = decoder_open_ctx(p->pending_mode, p->pending_threads);
+    if (!ctx) {
+        p->pending = false;
+        printf("[DECODER] Threading switch failed, keeping %s x%d\n", dec_thread_mode_name(p->mode), p->threads);
+        return;
+    }
+
+    /* frame threads still hold up to threads - 1 frames: drain them to the display before closing */
+    AVCodecContext *old = g_dec_ctx;
+    if (avcodec_send_packet(old, NULL) == 0)
+        decoder_receive_frames(old);
+    avcodec_free_context(&old);
+    g_dec_ctx = ctx;
+    p->pending = false;
+
+    p->mode = p->pending_mode;
+    p->threads = p->pending_threads;
+    dec_policy_reset_window(p);
+    printf("[DECODER] Threading: now %s x%d\n", dec_thread_mode_name(p->mode), p->threads);
+
+    /* switched on a keyframe slice: the new context has not seen the parameter sets yet */
+    if (info->kind == NAL_KIND_KEYFRAME) {
+        AVPacket *pkt = av_packet_alloc();
+        if (!pkt)
+            return;
+        for (int i = 0; i < PARAM_SET_COUNT; i++) {
+            const struct param_set_t *set = &p->params.sets[i];
+            if (set->size <= 0)
+                continue;
+            if (av_new_packet(pkt, set->size) == 0) {
+                memcpy(pkt->data, set->data, (size_t)set->size);
+                avcodec_send_packet(g_dec_ctx, pkt);
+            }
+            av_packet_unref(pkt);
+        }
+        av_packet_free(&pkt);
+    }
+}
+
+/* Returns true when a pending switch may be applied before this packet */
+static bool dec_policy_is_switch_point(const struct nal_info_t *info)
+{
+    if (info->kind == NAL_KIND_KEYFRAME)
+        return true;
+    if (g_codec_type == CODEC_H264)
+        return info->kind == NAL_KIND_SPS;
+    return info->kind == NAL_KIND_VPS;
+}
+
 /* ---------------------- SWS (to YUV420P) -------------------- */
 
 static void sws_cleanup(void)
@@ -215,10 +566,112 @@ static void decoder_pc_cleanup(void)
 
 /* ---------------------- decoder thread ---------------------- */
 
+/* Every frame ctx has ready, to the display. Decoder thread only */
+static void decoder_receive_frames(AVCodecContext *ctx)
+{
+    int ret = 0;
+    uint64_t t0;
+    while (ret >= 0) {
+        t0 = get_time_us();
+        TRACE_BEGIN(t_get);
+        ret = avcodec_receive_frame(ctx, g_frame);
+        uint64_t t1 = get_time_us();
+        g_policy.busy_us += t1 - t0;
+        if (ret == AVERROR(EAGAIN) || ret == AVERROR_EOF) {
+            break;
+        } else if (ret < 0) {
+            char errbuf[128];
+            av_strerror(ret, errbuf, sizeof(errbuf));
+            printf("[DECODER] avcodec_receive_frame error: %s\n", errbuf);
+            break;
+        }
+
+        int width  = g_frame->width;
+        int height = g_frame->height;
+        TRACE_END(TRACE_DECODER_GET, t_get,
+                  g_frame->pts > 0 && (uint64_t)g_frame->pts <= t1 ? (t1 - (uint64_t)g_frame->pts) / 1000 : 0);
+
+        if (width <= 0 || height <= 0) {
+            continue;
+        }
+
+        dec_policy_on_frame(&g_policy, width, height, t1, g_frame->pts);
+        if (g_frame->pts > 0 && (uint64_t)g_frame->pts <= t1) {
+            bench_stage_sample(BENCH_STAGE_DECODE, t1 - (uint64_t)g_frame->pts);
+        }
+        bench_count_frame();
+        if (!g_first_frame_shown) {
+            g_first_frame_shown = true;
+            rtp_receiver_first_frame();
+        }
+
+        TRACE_BEGIN(t_push);
+        if (g_frame->format == AV_PIX_FMT_YUV420P) {
+            /* already YUV420P */
+            if (!g_null_sink) {
+                sdl2_push_new_video_frame(
+                    g_frame->data[0],
+                    g_frame->data[1],
+                    g_frame->data[2],
+                    width,
+                    height,
+                    g_frame->linesize[0],
+                    g_frame->linesize[1]
+                );
+            }
+        } else {
+            /* convert to YUV420P */
+            if (ensure_sws(width, height, (enum AVPixelFormat)g_frame->format) == 0) {
+                sws_scale(g_sws_ctx,
+                          (const uint8_t * const *)g_frame->data,
+                          g_frame->linesize,
+                          0,
+                          height,
+                          g_sws_dst_data,
+                          g_sws_dst_linesize);
+
+                if (!g_null_sink) {
+                    sdl2_push_new_video_frame(
+                        g_sws_dst_data[0],
+                        g_sws_dst_data[1],
+                        g_sws_dst_data[2],
+                        width,
+                        height,
+                        g_sws_dst_linesize[0],
+                        g_sws_dst_linesize[1]
+                    );
+                }
+            }
+        }
+
+        TRACE_END(TRACE_VIDEO_PUSH, t_push, 0);
+        bench_stage_sample(BENCH_STAGE_SINK, get_time_us() - t1);
+
+        /* FPS */
+        uint64_t now = get_time_ms();
+        if (!g_fps_time)
+            g_fps_time = now;
+        g_fps_frames++;
+
+        if (now - g_fps_time >= 1000) {
+            double current_fps = g_fps_frames * 1000.0 / (double)(now - g_fps_time);
+#if 1
+            //printf("[DECODER] FPS: %.2f\n", current_fps);
+            ui_set_fps((float)current_fps);
+#endif
+            latency_ctl_report(&g_latency, "[DECODER] ");
+            g_fps_frames = 0;
+            g_fps_time = now;
+        }
+    }
+}
+
 static void *decoder_thread_func(void *arg)
 {
     (void)arg;
     printf("[DECODER] libavcodec decoder thread started\n");
+    bench_thread_register("decoder");
+    TRACE_THREAD("decoder");
 
     AVPacket *pkt = av_packet_alloc();
     if (!pkt) {
@@ -226,10 +679,6 @@ static void *decoder_thread_func(void *arg)
         return NULL;
     }
 
-    uint64_t last_fps_time = 0;
-    int      frames_in_sec = 0;
-    double   current_fps   = 0.0;
-
     while (g_decoder_running) {
         struct pkt_item item = {0};
 
@@ -247,18 +696,51 @@ static void *decoder_thread_func(void *arg)
             continue;
         }
 
+        struct nal_info_t nal;
+        nal_parse(g_codec_type, item.data, item.size, &nal);
+        if (nal_is_param_set(&nal)) {
+            param_cache_update(&g_policy.params, &nal, item.data, item.size);
+        }
+
+        /* catch-up: keep the queue wait inside the latency budget */
+        if (item.lost) {
+            latency_ctl_resync(&g_latency, "Decoder queue overflow");
+        }
+        bool need_start_code = false;
+        uint64_t lag_us = get_time_us() - item.arrival_us;
+        bench_stage_sample(BENCH_STAGE_QUEUE, lag_us);
+        /* unpaced replay has no radio to keep up with, decode every frame */
+        if (latency_ctl_drop(&g_latency, &nal, g_backpressure ? 0 : lag_us, &need_start_code)) {
+            free(item.data);
+            continue;
+        }
+
+        /* threading switch: re-open on a keyframe boundary */
+        if (g_policy.pending && dec_policy_is_switch_point(&nal)) {
+            dec_policy_apply(&g_policy, &nal);
+        }
+        int prefix = need_start_code ? 4 : 0;
+
         av_packet_unref(pkt);
-        if (av_new_packet(pkt, item.size) < 0) {
+        if (av_new_packet(pkt, item.size + prefix) < 0) {
             printf("[DECODER] av_new_packet failed\n");
             free(item.data);
             continue;
         }
-        memcpy(pkt->data, item.data, (size_t)item.size);
-        pkt->pts = (int64_t)get_time_ms();
+        if (prefix) {
+            static const uint8_t start_code[4] = {0, 0, 0, 1};
+            memcpy(pkt->data, start_code, 4);
+        }
+        memcpy(pkt->data + prefix, item.data, (size_t)item.size);
+        pkt->pts = (int64_t)get_time_us();
 
         free(item.data);
 
+        uint64_t t0 = get_time_us();
+        TRACE_BEGIN(t_put);
         int ret = avcodec_send_packet(g_dec_ctx, pkt);
+        TRACE_END(TRACE_DECODER_PUT, t_put, pkt->size);
+        g_policy.busy_us += get_time_us() - t0;
         if (ret < 0 && ret != AVERROR(EAGAIN) && ret != AVERROR_EOF) {
             char errbuf[128];
             av_strerror(ret, errbuf, sizeof(errbuf));
@@ -266,74 +748,8 @@ static void *decoder_thread_func(void *arg)
             continue;
         }
 
-        while (ret >= 0) {
-            ret = avcodec_receive_frame(g_dec_ctx, g_frame);
-            if (ret == AVERROR(EAGAIN) || ret == AVERROR_EOF) {
-                break;
-            } else if (ret < 0) {
-                char errbuf[128];
-                av_strerror(ret, errbuf, sizeof(errbuf));
-                printf("[DECODER] avcodec_receive_frame error: %s\n", errbuf);
-                break;
-            }
-
-            int width  = g_frame->width;
-            int height = g_frame->height;
-
-            if (width <= 0 || height <= 0) {
-                continue;
-            }
-
-            if (g_frame->format == AV_PIX_FMT_YUV420P) {
-                /* already YUV420P */
-                sdl2_push_new_video_frame(
-                    g_frame->data[0],
-                    g_frame->data[1],
-                    g_frame->data[2],
-                    width,
-                    height,
-                    g_frame->linesize[0],
-                    g_frame->linesize[1]
-                );
-            } else {
-                /* convert to YUV420P */
-                if (ensure_sws(width, height, (enum AVPixelFormat)g_frame->format) == 0) {
-                    sws_scale(g_sws_ctx,
-                              (const uint8_t * const *)g_frame->data,
-                              g_frame->linesize,
-                              0,
-                              height,
-                              g_sws_dst_data,
-                              g_sws_dst_linesize);
-
-                    sdl2_push_new_video_frame(
-                        g_sws_dst_data[0],
-                        g_sws_dst_data[1],
-                        g_sws_dst_data[2],
-                        width,
-                        height,
-                        g_sws_dst_linesize[0],
-                        g_sws_dst_linesize[1]
-                    );
-                }
-            }
-
-            /* FPS */
-            uint64_t now = get_time_ms();
-            if (!last_fps_time)
-                last_fps_time = now;
-            frames_in_sec++;
-
-            if (now - last_fps_time >= 1000) {
-                current_fps = frames_in_sec * 1000.0 / (double)(now - last_fps_time);
-#if 1
-                //printf("[DECODER] FPS: %.2f\n", current_fps);
-                ui_set_fps((float)current_fps);
-#endif
-                frames_in_sec = 0;
-                last_fps_time = now;
-            }
-        }
+        if (ret >= 0)
+            decoder_receive_frames(g_dec_ctx);
     }
 
     av_packet_free(&pkt);
@@ -343,6 +759,32 @@ static void *decoder_thread_func(void *arg)
 
 /* ---------------------- public API -------------------------- */
 
+/*
+ * Called before the first packet with the cached stream resolution: a black frame of the right
+ * size makes the display allocate its planes and texture now instead of on the first decoded frame.
+ */
+void decoder_prepare(int width, int height)
+{
+    if (width <= 0 || height <= 0 || g_null_sink)
+        return;
+
+    int uv_width = (width + 1) / 2;
+    int uv_height = (height + 1) / 2;
+    size_t y_size = (size_t)width * height;
+    size_t uv_size = (size_t)uv_width * uv_height;
+    uint8_t *buf = malloc(y_size + 2 * uv_size);
+    if (!buf) {
+        printf("[DECODER] decoder_prepare: out of memory\n");
+        return;
+    }
+    memset(buf, 16, y_size);
+    memset(buf + y_size, 128, 2 * uv_size);
+
+    sdl2_push_new_video_frame(buf, buf + y_size, buf + y_size + uv_size, width, height, width, uv_width);
+    free(buf);
+    printf("[DECODER] Display prepared for %dx%d\n", width, height);
+}
+
 int decoder_start(struct config_t *cfg)
 {
     if (!cfg) {
@@ -351,6 +793,13 @@ int decoder_start(struct config_t *cfg)
     }
 
     enum AVCodecID codec_id;
+    g_codec_type = cfg->codec;
+    g_first_frame_shown = false;
+    g_fps_time = 0;
+    g_fps_frames = 0;
+    g_null_sink = bench_active();
+    g_backpressure = rtp_receiver_unpaced(cfg);
+    latency_ctl_init(&g_latency, cfg->latency_budget_ms);
     if (cfg->codec == CODEC_H264) {
         codec_id = AV_CODEC_ID_H264;
         printf("[DECODER] Using libavcodec H.264 decoder\n");
@@ -367,32 +816,23 @@ int decoder_start(struct config_t *cfg)
     /* mute FFmpeg logs (PPS/NALU warnings) */
     av_log_set_level(AV_LOG_QUIET);
 
-    const AVCodec *codec = avcodec_find_decoder(codec_id);
-    if (!codec) {
+    g_codec = avcodec_find_decoder(codec_id);
+    if (!g_codec) {
         printf("[DECODER] avcodec_find_decoder failed\n");
         return -1;
     }
 
-    g_dec_ctx = avcodec_alloc_context3(codec);
-    if (!g_dec_ctx) {
-        printf("[DECODER] avcodec_alloc_context3 failed\n");
-        return -1;
-    }
+    /* always start single threaded, the policy escalates when decoding can't keep up */
+    memset(&g_policy, 0, sizeof(g_policy));
+    g_policy.params.codec = g_codec_type;
+    g_policy.mode    = DEC_THREAD_SINGLE;
+    g_policy.threads = 1;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    g_policy.cores = cores > 0 ? (int)cores : 1;
+    printf("[DECODER] Threading: start single threaded, %d cores available\n", g_policy.cores);
 
-#ifdef SLOW_PC_MODE
-    g_dec_ctx->thread_count = 4;
-    g_dec_ctx->thread_type  = FF_THREAD_SLICE;
-#else
-    g_dec_ctx->thread_count = 1;
-    g_dec_ctx->thread_type  = 0;
-#endif
-
-    g_dec_ctx->flags  |= AV_CODEC_FLAG_LOW_DELAY;
-    g_dec_ctx->flags2 |= AV_CODEC_FLAG2_FAST;
-
-    if (avcodec_open2(g_dec_ctx, codec, NULL) < 0) {
-        printf("[DECODER] avcodec_open2 failed\n");
-        avcodec_free_context(&g_dec_ctx);
+    g_dec_ctx = decoder_open_ctx(g_policy.mode, g_policy.threads);
+    if (!g_dec_ctx) {
         return -1;
     }
 
@@ -445,6 +885,7 @@ int decoder_stop(void)
 
     pthread_mutex_lock(&g_pkt_mutex);
     pthread_cond_broadcast(&g_pkt_cond);
+    pthread_cond_broadcast(&g_pkt_space_cond);
     pthread_mutex_unlock(&g_pkt_mutex);
 
     pthread_join(g_decoder_thread, NULL);
@@ -28,6 +28,7 @@
 #include <stdatomic.h>
 #include <linux/dma-buf.h>
 #include <poll.h>
+#include "trace.h"
 
 #define DRM_DEBUG 0
 #define DRM_DEBUG_ROTATE 0
@@ -54,6 +55,10 @@ struct drm_fb_cleanup {
 
 static struct drm_fb_cleanup cleanup;
 
+#ifdef ENABLE_TRACE
+static uint64_t trace_commit_at;    // last commit, start of the flip span
+#endif
+
 static drmEventContext evctx = {
     .version = DRM_EVENT_CONTEXT_VERSION,
     .vblank_handler = NULL,
@@ -71,6 +76,7 @@ static atomic_int pending_commit = 0;
 #define MAX_VIDEO_BUFS 16
 #define ROTATE_BUF_COUNT (MAX_VIDEO_BUFS)
 
+// Largest frame drm_push_new_osd_frame() rotates, the LVGL layer
 #define OSD_WIDTH  1280
 #define OSD_HEIGHT  720
 
@@ -78,12 +84,22 @@ struct drm_fb_t osd_bufs[OSD_BUF_COUNT];
 
 struct {
     int dirty[OSD_BUF_COUNT];
-    int osd_width;
+    int frame_width[OSD_BUF_COUNT];     // part of the buffer the frame uses, scanned out scaled to fit
+    int frame_height[OSD_BUF_COUNT];
+    int osd_width;                      // buffer size
     int osd_height;
     int display_idx;   // Currently shown on screen (DRM is displaying)
     int ready_idx;     // Contains next OSD to be committed (prepared, but not displayed yet)
     int render_idx;    // Buffer for RGA/CPU to render the next OSD frame (not yet committed)
-} osd_db = { {0,0,0}, 0, 0, 1, 2 };
+} osd_db = { {0,0,0}, {0,0,0}, {0,0,0}, 0, 0, 0, 1, 2 };
+
+// What an OSD buffer misses of the newest frame: regions written into the others since it was rendered
+#define OSD_MAX_STALE 32
+struct osd_stale_t {
+    struct osd_rect_t rects[OSD_MAX_STALE];
+    int count;
+    bool full;
+} osd_stale[OSD_BUF_COUNT];
 
 struct {
     int dma_fd[MAX_VIDEO_BUFS];
@@ -101,6 +117,8 @@ struct rotate_video_pool_t {
     uint32_t fb_id[ROTATE_BUF_COUNT];
     int count;
 } rotate_video_pool = {0};
+// drm_prepare_video() runs on the RTP thread, the frames come from the decoder thread
+static pthread_mutex_t rotate_pool_lock = PTHREAD_MUTEX_INITIALIZER;
 
 static drm_osd_frame_done_cb_t osd_frame_done_cb = NULL;
 
@@ -613,12 +631,17 @@ int drm_atomic_commit_all_buffers(struct drm_context_t *ctx, struct drm_fb_t *os
     cleanup.fb_osd_id = osd_fb->fb_id;
     cleanup.ctx = ctx;
 
+    TRACE_BEGIN(t_commit);
     if (drmModeAtomicCommit(ctx->drm_fd, req, DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT, &cleanup) < 0) {
         fprintf(stderr, "[ DRM ] Atomic commit failed for all planes %s\n", strerror(errno));
         drmModeAtomicFree(req);
         atomic_store(&pending_commit, 1);
         return -1;
     }
+    TRACE_END(TRACE_DRM_COMMIT, t_commit, 0);
+#ifdef ENABLE_TRACE
+    trace_commit_at = t_commit;
+#endif
 
 #if DRM_DEBUG
     printf("[ DRM ] Atomic commit completed: video plane %d with FB %d, size %dx%d, osd plane %d with FB %d, size %dx%d\n",
@@ -1136,6 +1159,7 @@ static void drm_page_flip_handler(int fd, unsigned int frame, unsigned int sec,
     if (!atomic_load(&running)) {
         return;
     }
+    TRACE_END(TRACE_DRM_FLIP, trace_commit_at, frame);
 #if DRM_DEBUG
     static uint64_t prev_sec = 0;
     static uint64_t prev_usec = 0;
@@ -1165,7 +1189,7 @@ static void drm_page_flip_handler(int fd, unsigned int frame, unsigned int sec,
 
         drm_atomic_commit_all_buffers(
             cleanup.ctx,
-            &osd_bufs[osd_db.display_idx], osd_db.osd_width, osd_db.osd_height,
+            &osd_bufs[osd_db.display_idx], osd_db.frame_width[osd_db.display_idx], osd_db.frame_height[osd_db.display_idx],
             video_buf_map.fb_id[video_cur], video_buf_map.dma_fd[video_cur],
             video_buf_map.video_width, video_buf_map.video_height
         );
@@ -1191,6 +1215,13 @@ static int drm_create_osd_buff_pool(struct drm_context_t *ctx)
         width = OSD_HEIGHT;
         height = OSD_WIDTH;
     }
+    int frame_width = width;
+    int frame_height = height;
+    // Native frames (drm_push_new_osd_frame_rotated) are up to the display mode size
+    if (ctx->display_info.hdisplay > width)
+        width = ctx->display_info.hdisplay;
+    if (ctx->display_info.vdisplay > height)
+        height = ctx->display_info.vdisplay;
 
     for (int i = 0; i < OSD_BUF_COUNT; ++i) {
         ret = drm_create_dumb_argb8888_fb(ctx, width, height, &osd_bufs[i]);
@@ -1199,6 +1230,10 @@ static int drm_create_osd_buff_pool(struct drm_context_t *ctx)
             return ret;
         }
         osd_db.dirty[i] = 0;
+        osd_db.frame_width[i] = frame_width;
+        osd_db.frame_height[i] = frame_height;
+        osd_stale[i].count = 0;
+        osd_stale[i].full = true;
     }
     osd_db.osd_width = width;
     osd_db.osd_height = height;
@@ -1206,7 +1241,7 @@ static int drm_create_osd_buff_pool(struct drm_context_t *ctx)
     osd_db.ready_idx   = 1;
     osd_db.render_idx  = 2;
 
-    printf("[ DRM ] OSD buffer pool created successfully\n");
+    printf("[ DRM ] OSD buffer pool created successfully, %dx%d\n", width, height);
     return ret;
 
 }
@@ -1304,23 +1339,15 @@ void drm_set_osd_frame_done_callback(drm_osd_frame_done_cb_t cb)
     osd_frame_done_cb = cb;
 }
 
-void drm_push_new_osd_frame(const void *src_addr, int width, int height)
+static void drm_osd_copy_frame(const void *src_addr, int width, int height, struct drm_fb_t *fb)
 {
 #if DRM_DEBUG_ROTATE
     struct timespec t1, t2;
     clock_gettime(CLOCK_MONOTONIC, &t1);
 #endif
-    if (!src_addr) {
-        printf("[ DRM ] OSD source address is NULL\n");
-        return;
-    }
-    if (width != OSD_WIDTH || height != OSD_HEIGHT) {
-        printf("[ DRM ] OSD frame must be %dx%d - yours is: %dx%d\n", OSD_WIDTH, OSD_HEIGHT, width, height);
-        return;
-    }
-    int render = osd_db.render_idx;
-    struct drm_fb_t *fb = &osd_bufs[render];
     int rotate = drm_context.rotate;
+    // The frame may be smaller than the buffer, rows are pitch apart
+    int fb_wstride = (int)(fb->pitches[0] / 4);
     // Clear previous frame
     //memset(fb->buff_addr, 0x00, OSD_WIDTH * OSD_HEIGHT * 4);
 
@@ -1328,7 +1355,7 @@ void drm_push_new_osd_frame(const void *src_addr, int width, int height)
         // No rotation: direct copy
         imcopy(
             wrapbuffer_virtualaddr((void*)src_addr, width, height, RK_FORMAT_RGBA_8888),
-            wrapbuffer_virtualaddr(fb->buff_addr, width, height, RK_FORMAT_RGBA_8888)
+            wrapbuffer_virtualaddr(fb->buff_addr, width, height, RK_FORMAT_RGBA_8888, fb_wstride, osd_db.osd_height)
         );
     } else {
         // Rotation is needed
@@ -1343,9 +1370,9 @@ void drm_push_new_osd_frame(const void *src_addr, int width, int height)
         rga_buffer_t dst;
 
         if (rotate == 90 || rotate == 270) {
-            dst = wrapbuffer_virtualaddr(fb->buff_addr, height, width, RK_FORMAT_RGBA_8888); // Swapped!
+            dst = wrapbuffer_virtualaddr(fb->buff_addr, height, width, RK_FORMAT_RGBA_8888, fb_wstride, osd_db.osd_height); // Swapped!
         } else {
-            dst = wrapbuffer_virtualaddr(fb->buff_addr, width, height, RK_FORMAT_RGBA_8888);
+            dst = wrapbuffer_virtualaddr(fb->buff_addr, width, height, RK_FORMAT_RGBA_8888, fb_wstride, osd_db.osd_height);
         }
 
         int rga_rot;
@@ -1370,8 +1397,77 @@ void drm_push_new_osd_frame(const void *src_addr, int width, int height)
         printf("[ RGA ] OSD frame rotate completed %.3f ms\n", ms);
 #endif
     }
+}
+
+/* One damaged rect, in UI orientation, into fb: CPU copy when not rotated, RGA otherwise */
+static void drm_osd_copy_rect(const void *src_addr, int width, int height, struct drm_fb_t *fb,
+                              const struct osd_rect_t *r)
+{
+    int rotate = drm_context.rotate;
+    int fb_wstride = (int)(fb->pitches[0] / 4);
+    if (rotate == 0) {
+        for (int y = r->y; y < r->y + r->h; y++) {
+            memcpy((uint32_t *)fb->buff_addr + (size_t)y * fb_wstride + r->x,
+                   (const uint32_t *)src_addr + (size_t)y * width + r->x, (size_t)r->w * 4);
+        }
+        return;
+    }
+
+    // Where the rect lands after the clockwise rotation of the whole frame
+    rga_buffer_t src = wrapbuffer_virtualaddr((void*)src_addr, width, height, RK_FORMAT_RGBA_8888);
+    rga_buffer_t dst;
+    rga_buffer_t pat = {0};
+    im_rect srect = { r->x, r->y, r->w, r->h };
+    im_rect drect;
+    im_rect none = {0};
+    int usage = IM_SYNC;
+    if (rotate == 90) {
+        dst = wrapbuffer_virtualaddr(fb->buff_addr, height, width, RK_FORMAT_RGBA_8888, fb_wstride, osd_db.osd_height);
+        drect = (im_rect){ height - r->y - r->h, r->x, r->h, r->w };
+        usage |= IM_HAL_TRANSFORM_ROT_90;
+    } else if (rotate == 180) {
+        dst = wrapbuffer_virtualaddr(fb->buff_addr, width, height, RK_FORMAT_RGBA_8888, fb_wstride, osd_db.osd_height);
+        drect = (im_rect){ width - r->x - r->w, height - r->y - r->h, r->w, r->h };
+        usage |= IM_HAL_TRANSFORM_ROT_180;
+    } else {
+        dst = wrapbuffer_virtualaddr(fb->buff_addr, height, width, RK_FORMAT_RGBA_8888, fb_wstride, osd_db.osd_height);
+        drect = (im_rect){ r->y, width - r->x - r->w, r->h, r->w };
+        usage |= IM_HAL_TRANSFORM_ROT_270;
+    }
+    IM_STATUS ret = improcess(src, dst, pat, srect, drect, none, usage);
+    if (ret != IM_STATUS_SUCCESS)
+        printf("[ DRM ] Failed to rotate OSD region %d\n", ret);
+}
+
+static void drm_osd_stale_add(int idx, const struct osd_rect_t *r)
+{
+    struct osd_stale_t *st = &osd_stale[idx];
+    if (st->full)
+        return;
+    if (st->count < OSD_MAX_STALE)
+        st->rects[st->count++] = *r;
+    else
+        st->full = true;
+}
+
+/* The render buffer holds the newest frame, the others miss what it brought */
+static void drm_osd_commit_render(int out_width, int out_height, const struct osd_rect_t *damage, int count)
+{
+    int render = osd_db.render_idx;
+    osd_stale[render].count = 0;
+    osd_stale[render].full = false;
+    for (int i = 0; i < OSD_BUF_COUNT; i++) {
+        if (i == render)
+            continue;
+        if (!damage)
+            osd_stale[i].full = true;
+        for (int k = 0; damage && k < count; k++)
+            drm_osd_stale_add(i, &damage[k]);
+    }
 
     // Mark as ready to commit
+    osd_db.frame_width[render] = out_width;
+    osd_db.frame_height[render] = out_height;
     osd_db.dirty[render] = 1;
     // Swap ready/render indexes for next cycle
     int prev_ready = osd_db.ready_idx;
@@ -1379,8 +1475,80 @@ void drm_push_new_osd_frame(const void *src_addr, int width, int height)
     osd_db.render_idx = prev_ready;
 }
 
+void drm_push_new_osd_frame(const void *src_addr, int width, int height)
+{
+    drm_push_new_osd_frame_damage(src_addr, width, height, NULL, 0);
+}
+
+void drm_push_new_osd_frame_damage(const void *src_addr, int width, int height,
+                                   const struct osd_rect_t *damage, int count)
+{
+    if (!src_addr) {
+        printf("[ DRM ] OSD source address is NULL\n");
+        return;
+    }
+    int rotate = drm_context.rotate;
+    int out_width = (rotate == 90 || rotate == 270) ? height : width;
+    int out_height = (rotate == 90 || rotate == 270) ? width : height;
+    if (width <= 0 || height <= 0 || out_width > osd_db.osd_width || out_height > osd_db.osd_height) {
+        printf("[ DRM ] OSD frame %dx%d does not fit the %dx%d OSD plane\n", width, height, osd_db.osd_width, osd_db.osd_height);
+        return;
+    }
+    int render = osd_db.render_idx;
+    struct drm_fb_t *fb = &osd_bufs[render];
+
+    struct osd_stale_t *stale = &osd_stale[render];
+    if (!damage || stale->full ||
+        osd_db.frame_width[render] != out_width || osd_db.frame_height[render] != out_height) {
+        drm_osd_copy_frame(src_addr, width, height, fb);
+    } else {
+        // bring the buffer up to date, then the new damage
+        for (int i = 0; i < stale->count + count; i++) {
+            struct osd_rect_t r = i < stale->count ? stale->rects[i] : damage[i - stale->count];
+            if (r.x < 0 || r.y < 0 || r.w <= 0 || r.h <= 0 || r.x + r.w > width || r.y + r.h > height)
+                continue;
+            drm_osd_copy_rect(src_addr, width, height, fb, &r);
+        }
+    }
+    drm_osd_commit_render(out_width, out_height, damage, count);
+}
+
+void drm_push_new_osd_frame_rotated(const void *src_addr, int width, int height)
+{
+    if (!src_addr) {
+        printf("[ DRM ] OSD source address is NULL\n");
+        return;
+    }
+    if (width <= 0 || height <= 0 || width > osd_db.osd_width || height > osd_db.osd_height) {
+        printf("[ DRM ] OSD frame %dx%d does not fit the %dx%d OSD plane\n", width, height, osd_db.osd_width, osd_db.osd_height);
+        return;
+    }
+    int render = osd_db.render_idx;
+    struct drm_fb_t *fb = &osd_bufs[render];
+
+    // Already in panel orientation: plain copy, no per-frame rotation
+    IM_STATUS ret = imcopy(
+        wrapbuffer_virtualaddr((void*)src_addr, width, height, RK_FORMAT_RGBA_8888),
+        wrapbuffer_virtualaddr(fb->buff_addr, width, height, RK_FORMAT_RGBA_8888, (int)(fb->pitches[0] / 4), osd_db.osd_height)
+    );
+    if (ret != IM_STATUS_SUCCESS) {
+        printf("[ DRM ] Failed to copy OSD frame %d\n", ret);
+        return;
+    }
+
+    drm_osd_commit_render(width, height, NULL, 0);
+}
+
+void drm_get_osd_surface(int *width, int *height, int *rotate)
+{
+    *width = drm_context.display_info.hdisplay;
+    *height = drm_context.display_info.vdisplay;
+    *rotate = drm_context.rotate;
+}
+
 static int get_next_rotate_dma_fd(struct drm_context_t *ctx, int width, int height, int hor_stride, int ver_stride)
 {
+    pthread_mutex_lock(&rotate_pool_lock);
     if (rotate_video_pool.w != width || rotate_video_pool.h != height ||
         rotate_video_pool.hor_stride != hor_stride || rotate_video_pool.ver_stride != ver_stride) {
         rotate_video_pool_cleanup(ctx); // cleanup old buffers
@@ -1392,7 +1560,24 @@ static int get_next_rotate_dma_fd(struct drm_context_t *ctx, int width, int heig
     int idx = rotate_video_pool.count;
     rotate_video_pool.count = (rotate_video_pool.count + 1) % ROTATE_BUF_COUNT;
     //printf("[ DRM ] Using rotate pool buffer %d for rotation, size %dx%d (stride %dx%d)\n", idx, width, height, hor_stride, ver_stride);
-    return rotate_video_pool.dma_fd[idx];
+    int dma_fd = rotate_video_pool.dma_fd[idx];
+    pthread_mutex_unlock(&rotate_pool_lock);
+    return dma_fd;
+}
+
+void drm_prepare_video(int width, int height, int hor_stride, int ver_stride)
+{
+    struct drm_context_t *ctx = drm_get_ctx();
+    if (!ctx || !(ctx->rotate == 90 || ctx->rotate == 270 || ctx->rotate == 180))
+        return;
+
+    // Only an empty pool is filled here: buffers of a pool in use may be queued for scan-out, the
+    // decoder thread replaces them itself in get_next_rotate_dma_fd() between two of its frames.
+    // Same geometry drm_push_new_video_frame() asks the rotate pool for.
+    pthread_mutex_lock(&rotate_pool_lock);
+    if (rotate_video_pool.w == 0)
+        rotate_video_pool_init(ctx, height, width, ver_stride, hor_stride);
+    pthread_mutex_unlock(&rotate_pool_lock);
 }
 
 void drm_push_new_video_frame(int dma_fd, int width, int height, int hor_stride, int ver_stride)
@@ -1430,8 +1615,10 @@ void drm_push_new_video_frame(int dma_fd, int width, int height, int hor_stride,
         int rga_ret = rga_nv12_rotate(dma_fd, current_dma_fd, width, height, hor_stride, ver_stride, rotate);
         if (rga_ret != 0) {
             fprintf(stderr, "[ DRM ] RGA rotation failed\n");
+            pthread_mutex_lock(&rotate_pool_lock);
             rotate_video_pool_cleanup(ctx);
             rotate_video_pool_init(ctx, width, height, hor_stride, ver_stride);
+            pthread_mutex_unlock(&rotate_pool_lock);
             return;
         }
     } else {
@@ -1544,6 +1731,7 @@ static void* compositor_thread(void* arg)
     } else {
         printf("[ DRM ] Compositor thread started with DRM fd %d\n", ctx->drm_fd);
     }
+    TRACE_THREAD("compositor");
 
     for (int i = 0; i < OSD_BUF_COUNT; ++i) {
         fill_transparent_argb8888(&osd_bufs[i], osd_db.osd_width, osd_db.osd_height);
@@ -1576,7 +1764,7 @@ static void* compositor_thread(void* arg)
     // Force initial commit to display the first frame
     int video_cur = video_buf_map.cur;
     drm_atomic_commit_all_buffers(ctx,
-                                  &osd_bufs[osd_db.display_idx], osd_db.osd_width, osd_db.osd_height,
+                                  &osd_bufs[osd_db.display_idx], osd_db.frame_width[osd_db.display_idx], osd_db.frame_height[osd_db.display_idx],
                                   video_buf_map.fb_id[video_cur], video_buf_map.dma_fd[video_cur],
                                   video_buf_map.video_width, video_buf_map.video_height);
 
@@ -1586,7 +1774,7 @@ static void* compositor_thread(void* arg)
         if (atomic_load(&pending_commit)) {
             video_cur = video_buf_map.cur;
             drm_atomic_commit_all_buffers(ctx,
-                                          &osd_bufs[osd_db.display_idx], osd_db.osd_width, osd_db.osd_height,
+                                          &osd_bufs[osd_db.display_idx], osd_db.frame_width[osd_db.display_idx], osd_db.frame_height[osd_db.display_idx],
                                           video_buf_map.fb_id[video_cur], video_buf_map.dma_fd[video_cur],
                                           video_buf_map.video_width, video_buf_map.video_height);
             atomic_store(&pending_commit, 0);
@@ -71,10 +71,30 @@ struct drm_context_t *drm_get_ctx(void);
 
 void drm_push_new_video_frame(int dma_fd, int width, int height, int hor_stride, int ver_stride);
 
+/**
+ * Allocate rotation buffers for the expected stream size ahead of the first frame. Any thread; a pool
+ * already allocated is left to the decoder thread, which resizes it on the first frame that needs it
+ */
+void drm_prepare_video(int width, int height, int hor_stride, int ver_stride);
+
 void drm_set_osd_frame_done_callback(drm_osd_frame_done_cb_t cb);
 
+/** OSD frame in UI orientation, rotated by RGA for the panel */
 void drm_push_new_osd_frame(const void *src_addr, int width, int height);
 
+/**
+ * The same, only the count damage rects (UI orientation) changed since the previous frame. The OSD
+ * buffers remember what they miss of the newer frames, so just those regions are copied. NULL: all of it
+ */
+void drm_push_new_osd_frame_damage(const void *src_addr, int width, int height,
+                                   const struct osd_rect_t *damage, int count);
+
+/** OSD frame already in panel orientation, up to the display mode size, copied as is */
+void drm_push_new_osd_frame_rotated(const void *src_addr, int width, int height);
+
+/** Size of a native OSD frame (display mode, panel orientation) and the panel rotation in degrees */
+void drm_get_osd_surface(int *width, int *height, int *rotate);
+
 void drm_close(void);
 
 #endif //VRX_DRM_H
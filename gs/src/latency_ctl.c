@@ -0,0 +1,134 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "latency_ctl.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *latency_ctl_state_name(latency_ctl_state_t state)
+{
+    switch (state) {
+    case LATENCY_CTL_DROP_NONREF:
+        return "drop non-reference";
+    case LATENCY_CTL_WAIT_KEYFRAME:
+        return "wait keyframe";
+    default:
+        return "normal";
+    }
+}
+
+static void latency_ctl_set_state(struct latency_ctl_t *lc, latency_ctl_state_t state, uint64_t lag_us)
+{
+    if (lc->state == state)
+        return;
+    printf("[ LATENCY ] %s -> %s (lag %.1f ms, budget %.1f ms)\n",
+           latency_ctl_state_name(lc->state), latency_ctl_state_name(state),
+           lag_us / 1000.0, lc->budget_us / 1000.0);
+    lc->state = state;
+}
+
+void latency_ctl_init(struct latency_ctl_t *lc, int budget_ms)
+{
+    memset(lc, 0, sizeof(*lc));
+    if (budget_ms <= 0)
+        budget_ms = LATENCY_BUDGET_MS_DEFAULT;
+    lc->budget_us = (uint64_t)budget_ms * 1000ULL;
+    lc->state = LATENCY_CTL_NORMAL;
+}
+
+void latency_ctl_resync(struct latency_ctl_t *lc, const char *reason)
+{
+    if (lc->state != LATENCY_CTL_WAIT_KEYFRAME) {
+        printf("[ LATENCY ] %s, skipping to next keyframe\n", reason);
+        lc->state = LATENCY_CTL_WAIT_KEYFRAME;
+        lc->resyncs++;
+    }
+}
+
+bool latency_ctl_drop(struct latency_ctl_t *lc, const struct nal_info_t *info, uint64_t lag_us,
+                      bool *need_start_code)
+{
+    *need_start_code = false;
+
+    if (info->kind == NAL_KIND_START_CODE) {
+        lc->held_start_code = true;
+        return true;
+    }
+    bool had_start_code = lc->held_start_code;
+    lc->held_start_code = false;
+
+    if (lag_us > lc->max_lag_us)
+        lc->max_lag_us = lag_us;
+
+    if (info->kind == NAL_KIND_KEYFRAME) {
+        /* every slice of a keyframe is kept: it is where decoding resyncs, dropping it costs a GOP */
+        if (lc->state == LATENCY_CTL_WAIT_KEYFRAME) {
+            lc->skip_rasl = info->is_cra;
+            latency_ctl_set_state(lc, lag_us > lc->budget_us ? LATENCY_CTL_DROP_NONREF : LATENCY_CTL_NORMAL,
+                                  lag_us);
+        } else if (lag_us > lc->budget_us) {
+            latency_ctl_set_state(lc, LATENCY_CTL_DROP_NONREF, lag_us);
+        } else if (lag_us < lc->budget_us / 2) {
+            latency_ctl_set_state(lc, LATENCY_CTL_NORMAL, lag_us);
+        }
+    } else {
+        switch (lc->state) {
+        case LATENCY_CTL_NORMAL:
+            if (lag_us > 2 * lc->budget_us) {
+                latency_ctl_set_state(lc, LATENCY_CTL_WAIT_KEYFRAME, lag_us);
+                lc->resyncs++;
+            } else if (lag_us > lc->budget_us) {
+                latency_ctl_set_state(lc, LATENCY_CTL_DROP_NONREF, lag_us);
+            }
+            break;
+        case LATENCY_CTL_DROP_NONREF:
+            if (lag_us > 2 * lc->budget_us) {
+                /* dropping non-reference slices was not enough */
+                latency_ctl_set_state(lc, LATENCY_CTL_WAIT_KEYFRAME, lag_us);
+                lc->resyncs++;
+            } else if (lag_us < lc->budget_us / 2) {
+                latency_ctl_set_state(lc, LATENCY_CTL_NORMAL, lag_us);
+            }
+            break;
+        case LATENCY_CTL_WAIT_KEYFRAME:
+            break;
+        }
+        /* the trailing pictures of the CRA decoding resumed on reference nothing before it */
+        if (info->kind == NAL_KIND_SLICE && !info->is_leading)
+            lc->skip_rasl = false;
+    }
+
+    bool drop = false;
+    if (lc->state == LATENCY_CTL_WAIT_KEYFRAME) {
+        /* parameter sets are tiny and the keyframe needs them */
+        if (!nal_is_param_set(info)) {
+            lc->dropped_skip++;
+            drop = true;
+        }
+    } else if (lc->skip_rasl && info->is_rasl) {
+        lc->dropped_skip++;
+        drop = true;
+    } else if (lc->state == LATENCY_CTL_DROP_NONREF) {
+        if (info->kind == NAL_KIND_SLICE && !info->is_reference) {
+            lc->dropped_nonref++;
+            drop = true;
+        }
+    }
+
+    if (!drop && had_start_code && info->header_offset == 0)
+        *need_start_code = true;
+    return drop;
+}
+
+void latency_ctl_report(struct latency_ctl_t *lc, const char *tag)
+{
+    if (lc->dropped_nonref || lc->dropped_skip || lc->resyncs) {
+        printf("%sCatch-up: dropped %u non-reference, %u while waiting keyframe, %u resyncs, max lag %.1f ms\n",
+               tag, lc->dropped_nonref, lc->dropped_skip, lc->resyncs, lc->max_lag_us / 1000.0);
+    }
+    lc->dropped_nonref = 0;
+    lc->dropped_skip = 0;
+    lc->resyncs = 0;
+    lc->max_lag_us = 0;
+}
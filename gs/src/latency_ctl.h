@@ -0,0 +1,61 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_LATENCY_CTL_H
+#define VD_LINK_LATENCY_CTL_H
+#include <stdint.h>
+#include <stdbool.h>
+#include "nal_util.h"
+
+#define LATENCY_BUDGET_MS_DEFAULT 80
+
+/*
+ * Latency budget controller (catch-up mode) shared by both decoders.
+ *  - lag below budget:       decode everything
+ *  - lag above budget:       drop non-reference slices, nothing references them
+ *  - lag above 2x budget or
+ *    input lost:             drop everything up to the next keyframe, parameter sets are kept
+ * The state falls back to normal once the lag is below half of the budget.
+ * Keyframe slices are never dropped: one arriving resyncs right away, whatever the lag. After
+ * resuming on an H.265 CRA its RASL pictures are dropped, their references were skipped.
+ */
+typedef enum {
+    LATENCY_CTL_NORMAL = 0,
+    LATENCY_CTL_DROP_NONREF,
+    LATENCY_CTL_WAIT_KEYFRAME
+} latency_ctl_state_t;
+
+struct latency_ctl_t {
+    uint64_t budget_us;
+    latency_ctl_state_t state;
+    bool     held_start_code;       // bare start code chunk waiting for the NAL it belongs to
+    bool     skip_rasl;             // resumed on a CRA, until its trailing pictures start
+
+    /* statistics, reset by latency_ctl_report() */
+    uint32_t dropped_nonref;
+    uint32_t dropped_skip;
+    uint32_t resyncs;
+    uint64_t max_lag_us;
+};
+
+void latency_ctl_init(struct latency_ctl_t *lc, int budget_ms);
+
+/**
+ * Decide what to do with one decoder input chunk.
+ * lag_us is how far the chunk is behind real time (queue wait or decoder output latency).
+ * Returns true if the chunk must be dropped.
+ * Bare start code chunks are always held back (returned as dropped) so a dropped NAL doesn't
+ * leave an orphan start code in the stream; need_start_code is set when the caller must prepend
+ * a 4-byte start code to the kept chunk.
+ */
+bool latency_ctl_drop(struct latency_ctl_t *lc, const struct nal_info_t *info, uint64_t lag_us,
+                      bool *need_start_code);
+
+/** Input was lost before the decoder (queue overflow, decoder stall): references are broken */
+void latency_ctl_resync(struct latency_ctl_t *lc, const char *reason);
+
+/** Print and reset drop counters, prints nothing when nothing was dropped */
+void latency_ctl_report(struct latency_ctl_t *lc, const char *tag);
+
+#endif //VD_LINK_LATENCY_CTL_H
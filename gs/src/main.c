@@ -13,6 +13,10 @@
 #include "src/rtp_receiver.h"
 #include "src/common.h"
 #include "msp-osd.h"
+#include "msp_udp.h"
+#include "latency_ctl.h"
+#include "bench.h"
+#include "trace.h"
 #ifdef WFB_STATUS_LINK
 #include "wfb_status_link.h"
 #endif
@@ -34,6 +38,14 @@ static void signal_handler(int sig)
     running = 0;
 }
 
+#ifdef ENABLE_TRACE
+static void trace_signal_handler(int sig)
+{
+    (void)sig;
+    trace_request_dump();
+}
+#endif
+
 static void setup_signals(void)
 {
     struct sigaction sa = { .sa_handler = signal_handler };
@@ -42,6 +54,13 @@ static void setup_signals(void)
     sigaction(SIGTERM, &sa, NULL);
     sigaction(SIGHUP, &sa, NULL);
     sigaction(SIGKILL, &sa, NULL);
+#ifdef ENABLE_TRACE
+    // kill -USR1 dumps the pipeline trace, see trace.h
+    struct sigaction sa_trace = { .sa_handler = trace_signal_handler };
+    sigemptyset(&sa_trace.sa_mask);
+    sa_trace.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &sa_trace, NULL);
+#endif
 }
 
 static void print_banner(void)
@@ -65,10 +84,22 @@ static void print_usage(const char* prog)
     printf("Options:\n");
     printf("  --ip <address>   Set the IP address to listen on (default: 0.0.0.0)\n");
     printf("  --port <number>  Set the port to listen for RTP stream (default: 5602)\n");
+    printf("  --osd-port <number> Set the port to listen for MSP DisplayPort over UDP, 0 disables (default: %d)\n",
+           MSP_UDP_PORT_DEFAULT);
+    printf("  --latency <ms>   Max decoder lag behind the radio before frames are dropped (default: %d)\n",
+           LATENCY_BUDGET_MS_DEFAULT);
 #ifdef WFB_STATUS_LINK
     printf("  --wfb            Set the port to listen for wfb-server link status (default: 8003)\n");
 #endif
-    printf("Defaults: --ip 0.0.0.0 --port 5602 --wfb 8003\n");
+    printf("  --bench[=kind]   Run headless benchmark and print a JSON summary (default kind: %s)\n", BENCH_DEFAULT_KIND);
+    printf("  --bench-time <s> Benchmark duration in seconds (default: %d)\n", BENCH_DEFAULT_SECONDS);
+    printf("  --bench-out <f>  Write the benchmark JSON summary to a file instead of stdout\n");
+    printf("  --capture <f>    Record the received RTP stream to an rtpdump file\n");
+    printf("  --osd-record <f> Record the MSP OSD to an .osd file, in step with --capture\n");
+    printf("  --replay <f>     Read RTP from an rtpdump file instead of the network\n");
+    printf("  --replay-speed <x> Replay pacing: 1 original, N times faster, 0 as fast as possible (default: 1)\n");
+    printf("  --osd-indexed    Render the MSP OSD as 8-bit palette indices, expanded to ARGB when composited\n");
+    printf("Defaults: --ip 0.0.0.0 --port 5602 --osd-port %d --wfb 8003\n", MSP_UDP_PORT_DEFAULT);
 }
 
 static void parse_args(int argc, char* argv[], struct config_t* config)
@@ -76,6 +107,16 @@ static void parse_args(int argc, char* argv[], struct config_t* config)
     static struct option long_options[] = {
             {"ip", required_argument, 0, 'i'},
             {"port", required_argument, 0, 'p'},
+            {"osd-port", required_argument, 0, 'm'},
+            {"latency", required_argument, 0, 'l'},
+            {"bench", optional_argument, 0, 'b'},
+            {"bench-time", required_argument, 0, 't'},
+            {"bench-out", required_argument, 0, 'o'},
+            {"capture", required_argument, 0, 'c'},
+            {"replay", required_argument, 0, 'r'},
+            {"replay-speed", required_argument, 0, 's'},
+            {"osd-indexed", no_argument, 0, 'x'},
+            {"osd-record", required_argument, 0, 'd'},
 #ifdef WFB_STATUS_LINK
             {"wfb", required_argument, 0, 'w'},
 #endif
@@ -84,7 +125,7 @@ static void parse_args(int argc, char* argv[], struct config_t* config)
     };
 
     int opt;
-    while ((opt = getopt_long(argc, argv, "i:p:v:w:h", long_options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "i:p:m:l:v:w:b::t:o:c:r:s:xd:h", long_options, NULL)) != -1) {
         switch (opt) {
         case 'i':
             config->ip = optarg;
@@ -97,6 +138,57 @@ static void parse_args(int argc, char* argv[], struct config_t* config)
             }
             config->port = port;
         } break;
+        case 'm': {
+            int port = atoi(optarg);
+            if (port < 0 || port > 65535 || (port && (config->port == port || config->wfb_port == port))) {
+                fprintf(stderr, "Invalid OSD port number: %s\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            config->osd_port = port;
+        } break;
+        case 'l': {
+            int ms = atoi(optarg);
+            if (ms < 10 || ms > 2000) {
+                fprintf(stderr, "Invalid latency budget: %s\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            config->latency_budget_ms = ms;
+        } break;
+        case 'b':
+            config->bench = optarg ? optarg : BENCH_DEFAULT_KIND;
+            break;
+        case 't': {
+            int seconds = atoi(optarg);
+            if (seconds < 1) {
+                fprintf(stderr, "Invalid benchmark duration: %s\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            config->bench_seconds = seconds;
+        } break;
+        case 'o':
+            config->bench_out = optarg;
+            break;
+        case 'c':
+            config->capture_file = optarg;
+            break;
+        case 'r':
+            config->replay_file = optarg;
+            break;
+        case 's': {
+            char *end;
+            double speed = strtod(optarg, &end);
+            if (end == optarg || *end != '\0' || speed < 0 || speed > 1000) {
+                fprintf(stderr, "Invalid replay speed: %s\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            config->replay_speed = speed;
+        } break;
+        case 'x':
+            config->osd_indexed = true;
+            break;
+        case 'd':
+            config->osd_record_file = optarg;
+            break;
 #ifdef WFB_STATUS_LINK
         case 'w': {
             int port = atoi(optarg);
@@ -121,8 +213,18 @@ int main(int argc, char* argv[])
         .ip = "0.0.0.0",
         .port = 5602,
         .wfb_port = 8003,
+        .osd_port = MSP_UDP_PORT_DEFAULT,
         .pt = 0,
         .codec = CODEC_UNKNOWN,
+        .latency_budget_ms = LATENCY_BUDGET_MS_DEFAULT,
+        .bench = NULL,
+        .bench_seconds = BENCH_DEFAULT_SECONDS,
+        .bench_out = NULL,
+        .capture_file = NULL,
+        .replay_file = NULL,
+        .replay_speed = 1.0,
+        .osd_indexed = false,
+        .osd_record_file = NULL,
     };
 
     print_banner();
@@ -130,8 +232,19 @@ int main(int argc, char* argv[])
 
     setup_signals();
 
+    if (config.bench) {
+        /* headless: no display, OSD or UI */
+        running = true;
+        return bench_main(&config, &running);
+    }
+
 #ifdef PLATFORM_ROCKCHIP
-    drm_init("/dev/dri/card0", &config);
+    if (drm_init("/dev/dri/card0", &config) == 0) {
+        // MSP OSD at display resolution, pre-rotated for the panel
+        int osd_width, osd_height, osd_rotate;
+        drm_get_osd_surface(&osd_width, &osd_height, &osd_rotate);
+        msp_osd_set_surface(osd_width, osd_height, osd_rotate);
+    }
 #endif
 #ifdef PLATFORM_DESKTOP
     if (sdl2_display_init(&config) < 0) {
@@ -142,12 +255,20 @@ int main(int argc, char* argv[])
 
     rtp_receiver_start(&config);
 
-    msp_osd_init(&config);
+    msp_osd_set_indexed(config.osd_indexed);
+    if (msp_osd_init(&config) == 0 && config.osd_port)
+        msp_udp_start(&config);
 
     ui_init();
     running = true;
 
+    TRACE_THREAD("main");
+#ifdef ENABLE_TRACE
+    printf("[ MAIN ] Tracing on: kill -USR1 %d or long press the perf monitor to dump it\n", (int)getpid());
+#endif
+
     while (running) {
+        TRACE_POLL();
 #ifdef PLATFORM_DESKTOP
         if (sdl2_display_poll() < 0) {
             signal_handler(SIGINT); // sdl2 should quit
@@ -161,6 +282,8 @@ int main(int argc, char* argv[])
 #endif
     }
 
+    if (config.osd_port)
+        msp_udp_stop();
     msp_osd_stop();
     ui_deinit();
     rtp_receiver_stop();
@@ -16,9 +16,12 @@
 #include <sys/mman.h>
 #endif
 #include <stdlib.h>
+#include <math.h>
 #include <pthread.h>
 #include "msp-osd.h"
-#include "msp/msp.h"
+#include "msp.h"
+#include "msp_dispatch.h"
+#include "osd_delta.h"
 #include "msp/msp_displayport.h"
 #include "util/debug.h"
 #include "net/data_protocol.h"
@@ -29,10 +32,13 @@
 #include "wfb_status_link.h"
 #endif
 #include "font/font.h"
+#include "font/palette.h"
 #include "toast/toast.h"
 #include "fakehd/fakehd.h"
+#include "rec/rec.h"
 #include "lvgl/lvgl.h"
 #include "ui/ui.h"
+#include "trace.h"
 
 #define DEBUG_PRINT_LINK 0
 
@@ -40,34 +46,101 @@ static pthread_t msp_thread;
 static volatile bool running = false;
 
 static char current_fc_variant[5];
-static msp_state_t msp_state = {0, MSP_IDLE, 0, {0}};
+static msp_dispatch_t *msp_dispatch_table;
+static msp_port_t msp_port;
 
 #define SPLASH_STRING "MSP OSD WAITING..."
 #define SHUTDOWN_STRING "SHUTTING DOWN..."
 
 #define MAX_DISPLAY_X 53
 #define MAX_DISPLAY_Y 20
+#if MAX_DISPLAY_X != FAKEHD_MAP_COLS || MAX_DISPLAY_Y != FAKEHD_MAP_ROWS
+#error "fakehd remaps a character map of a different size"
+#endif
+#if MAX_DISPLAY_X != OSD_DELTA_COLS || MAX_DISPLAY_Y != OSD_DELTA_ROWS
+#error "OSD deltas carry a character map of a different size"
+#endif
 
 #define BYTES_PER_PIXEL 4
 
-#define OSD_WIDTH 1280
-#define OSD_HEIGHT 720
+/* Layout of the display presets, fitted to the actual surface */
+#define OSD_REF_WIDTH 1280
+#define OSD_REF_HEIGHT 720
 
-static uint16_t msp_character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
+#define OSD_FRAME_INTERVAL_US 16667    // render at most once per display refresh (60 Hz)
+
+/*
+ * Character maps are double buffered. Producers (MSP DisplayPort, link status) write their own map
+ * and publish it as a whole on draw complete; the render thread renders a consistent copy.
+ */
+static uint16_t msp_character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];       // MSP thread
+static uint16_t overlay_character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];   // link status thread
+static uint16_t published_msp_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
+static uint16_t published_overlay_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
+static uint16_t frame_msp_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];           // render thread
+static uint16_t frame_overlay_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
 static uint16_t msp_render_character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
-static uint16_t overlay_character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
 static displayport_vtable_t display_driver = {0, 0, 0, 0};
 struct timespec last_render;
-static volatile bool need_render = false;
 
-static void render_display(void);
-static void need_render_display(void);
+static pthread_mutex_t render_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t render_cond = PTHREAD_COND_INITIALIZER;
+static bool render_pending = false;
+
+/*
+ * Receive time of the MSP input (msp_osd_process_buffer) follows the map to the render thread, for the
+ * receive -> framebuffer latency. A batch (msp_osd_begin_batch) keeps the last completed map and
+ * publishes it once at the end.
+ */
+static uint64_t input_rx_us;                    // MSP thread
+static bool batch_open = false;
+static bool batch_completed = false;
+static uint16_t batch_msp_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
+static display_info_t *batch_display_info;
+static uint64_t batch_rx_us;
+static bool batch_fakehd_off;
+static uint64_t published_rx_us;                // render_lock, oldest update not rendered yet, 0: none
+/* HD options turn fakehd off: set by the MSP thread, applied by the render thread with the next map */
+static bool fakehd_off_pending = false;         // MSP thread
+static bool published_fakehd_off = false;       // render_lock
+
+/* Maps received as OSD deltas (msp_osd_apply_delta), the bases of later deltas. MSP thread */
+static uint16_t delta_maps[OSD_DELTA_HISTORY][MAX_DISPLAY_X][MAX_DISPLAY_Y];
+static uint16_t delta_seq[OSD_DELTA_HISTORY];
+static bool delta_valid[OSD_DELTA_HISTORY];
+static int delta_current = -1;                  // slot msp_character_map holds, -1: other content
+static uint8_t delta_options = OSD_DELTA_OPTIONS_UNKNOWN;
+static uint64_t frame_rx_us;                    // render thread
+static struct msp_osd_latency_t update_latency; // render_lock
 
 static void *fb_addr = NULL;
 
+/* OSD framebuffer as scanned out, content turned clockwise by surface_rotate */
+static int surface_width = OSD_REF_WIDTH;
+static int surface_height = OSD_REF_HEIGHT;
+static int surface_rotate = 0;
+
+/*
+ * Optional 8-bit indexed surface (msp_osd_set_indexed): glyphs are drawn from palette index atlases and
+ * diffed at 1 byte per pixel, the compositor expands them with osd_palette. Otherwise premultiplied BGRA.
+ */
+static bool indexed = false;
+static int fb_bpp = BYTES_PER_PIXEL;
+static uint32_t osd_palette[PALETTE_SIZE];
+
+/* What the framebuffer currently shows, so a frame only touches the cells that changed */
+static uint16_t shown_msp_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
+static uint16_t shown_overlay_map[MAX_DISPLAY_X][MAX_DISPLAY_Y];
+static display_info_t *shown_display_info = NULL;  // NULL: content unknown, next frame redraws all
+
+/* Changed framebuffer regions for the compositor, one rect per character row */
+static pthread_mutex_t dirty_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct osd_rect_t dirty_rows[MAX_DISPLAY_Y];
+static bool dirty_full = false;
+
 static char current_fc_variant[5];
 
-// TODO: add support for different display modes FULL HD, HD, SD, etc.
+/* Presets in 1280x720 layout pixels, fit_display_info() scales them to the surface */
 static display_info_t sd_display_info = {
     .char_width = 53,
     .char_height = 20,
@@ -114,7 +187,9 @@ static enum display_mode_s {
     DISPLAY_WAITING = 2
 } display_mode = DISPLAY_RUNNING;
 
-static display_info_t *current_display_info;
+static display_info_t *current_display_info;       // MSP thread, selected by set_options
+static display_info_t *published_display_info;
+static display_info_t *frame_display_info;         // render thread
 
 static void draw_character(display_info_t *display_info, uint16_t character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y], uint32_t x, uint32_t y, uint16_t c)
 {
@@ -139,7 +214,57 @@ static void msp_draw_character(uint32_t x, uint32_t y, uint16_t c)
 static void msp_clear_screen(void)
 {
     memset(msp_character_map, 0, sizeof(msp_character_map));
-    memset(msp_render_character_map, 0, sizeof(msp_render_character_map));
+}
+
+/* Hand finished maps to the render thread, bursts are coalesced into one render */
+static void publish_maps(uint16_t msp_map[MAX_DISPLAY_X][MAX_DISPLAY_Y], display_info_t *display_info,
+                         bool fakehd_off, bool overlay, uint64_t rx_us)
+{
+    pthread_mutex_lock(&render_lock);
+    if (msp_map) {
+        memcpy(published_msp_map, msp_map, sizeof(published_msp_map));
+        published_display_info = display_info;
+        published_fakehd_off |= fakehd_off;
+    }
+    if (overlay)
+        memcpy(published_overlay_map, overlay_character_map, sizeof(published_overlay_map));
+    if (rx_us && !published_rx_us)
+        published_rx_us = rx_us;
+    render_pending = true;
+    pthread_cond_signal(&render_cond);
+    pthread_mutex_unlock(&render_lock);
+}
+
+/* MSP thread: a fakehd switch-off not published yet, it goes with the next msp map */
+static bool take_fakehd_off(void)
+{
+    bool off = fakehd_off_pending;
+    fakehd_off_pending = false;
+    return off;
+}
+
+static void publish_frame(bool msp, bool overlay)
+{
+    publish_maps(msp ? msp_character_map : NULL, current_display_info, msp && take_fakehd_off(), overlay, 0);
+}
+
+/* Render thread: take the latest published maps */
+static void take_frame(void)
+{
+    pthread_mutex_lock(&render_lock);
+    memcpy(frame_msp_map, published_msp_map, sizeof(frame_msp_map));
+    memcpy(frame_overlay_map, published_overlay_map, sizeof(frame_overlay_map));
+    frame_display_info = published_display_info;
+    bool fakehd_off = published_fakehd_off;
+    published_fakehd_off = false;
+    frame_rx_us = published_rx_us;
+    published_rx_us = 0;
+    render_pending = false;
+    pthread_mutex_unlock(&render_lock);
+
+    // fakehd state is the render thread's, draw_screen reads it
+    if (fakehd_off)
+        fakehd_disable();
 }
 
 static void clear_framebuffer(void)
@@ -149,78 +274,311 @@ static void clear_framebuffer(void)
         return;
     }
     // DJI has a backwards alpha channel - FF is transparent, 00 is opaque.
-    memset(fb_addr, 0, OSD_WIDTH * OSD_HEIGHT * BYTES_PER_PIXEL);
+    // Indexed: PALETTE_TRANSPARENT is 0 as well
+    memset(fb_addr, 0, (size_t)surface_width * surface_height * fb_bpp);
 }
 
-static void draw_character_map(display_info_t *display_info, void* restrict fb_addr, uint16_t character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y])
+/* Surface size before rotation, the space the character grid is laid out in */
+static int logical_width(void)
 {
-    if (display_info->fonts[0] == NULL) {
-        DEBUG_PRINT("No font available, failed to draw.\n");
+    return (surface_rotate == 90 || surface_rotate == 270) ? surface_height : surface_width;
+}
+
+static int logical_height(void)
+{
+    return (surface_rotate == 90 || surface_rotate == 270) ? surface_width : surface_height;
+}
+
+/* Scale a preset to the surface, centered. Fonts loaded afterwards get glyphs of that size */
+static void fit_display_info(display_info_t *display_info)
+{
+    if (display_info->glyph_width)
         return;
+    int lw = logical_width(), lh = logical_height();
+    float scale = fminf((float)lw / OSD_REF_WIDTH, (float)lh / OSD_REF_HEIGHT);
+    int max_side = display_info->font_width > display_info->font_height ? display_info->font_width : display_info->font_height;
+    if (scale * max_side > 255.0f)
+        scale = 255.0f / max_side;
+
+    display_info->glyph_width = (uint8_t)fmaxf(1.0f, roundf(display_info->font_width * scale));
+    display_info->glyph_height = (uint8_t)fmaxf(1.0f, roundf(display_info->font_height * scale));
+    display_info->x_offset = (uint16_t)(roundf(display_info->x_offset * scale) + (lw - roundf(OSD_REF_WIDTH * scale)) / 2);
+    display_info->y_offset = (uint16_t)(roundf(display_info->y_offset * scale) + (lh - roundf(OSD_REF_HEIGHT * scale)) / 2);
+    display_info->rotate = (uint16_t)surface_rotate;
+}
+
+static void fit_all_display_info(void)
+{
+    fit_display_info(&sd_display_info);
+    fit_display_info(&hd_display_info);
+    fit_display_info(&full_display_info);
+    fit_display_info(&overlay_display_info);
+}
+
+/* Framebuffer area of grid cell (x, y) and the visible part of its glyph, in surface orientation */
+struct cell_clip_t {
+    int px, py;         // cell origin in the framebuffer
+    int gx0, gx1;       // visible atlas glyph columns
+    int gy0, gy1;       // visible atlas glyph rows
+};
+
+static bool clip_cell(const display_info_t *display_info, int x, int y, struct cell_clip_t *clip)
+{
+    /* clip in grid orientation */
+    int gw = display_info->glyph_width, gh = display_info->glyph_height;
+    int lw = logical_width(), lh = logical_height();
+    int lx = x * gw + display_info->x_offset;
+    int ly = y * gh + display_info->y_offset;
+    int lx0 = lx < 0 ? -lx : 0;
+    int ly0 = ly < 0 ? -ly : 0;
+    int lx1 = lx + gw > lw ? lw - lx : gw;
+    int ly1 = ly + gh > lh ? lh - ly : gh;
+    if (lx0 >= lx1 || ly0 >= ly1)
+        return false;
+
+    /* then turn the cell like the atlas glyphs (font.c), (x, y) clockwise */
+    switch (surface_rotate) {
+    case 90:    // (x, y) -> (lh - 1 - y, x)
+        *clip = (struct cell_clip_t){ lh - ly - gh, lx, gh - ly1, gh - ly0, lx0, lx1 };
+        break;
+    case 180:   // (x, y) -> (lw - 1 - x, lh - 1 - y)
+        *clip = (struct cell_clip_t){ lw - lx - gw, lh - ly - gh, gw - lx1, gw - lx0, gh - ly1, gh - ly0 };
+        break;
+    case 270:   // (x, y) -> (y, lw - 1 - x)
+        *clip = (struct cell_clip_t){ ly, lw - lx - gw, ly0, ly1, gw - lx1, gw - lx0 };
+        break;
+    default:
+        *clip = (struct cell_clip_t){ lx, ly, lx0, lx1, ly0, ly1 };
+        break;
+    }
+    return true;
+}
+
+/* The atlas is already in framebuffer format (see font.c), a glyph is copied row by row */
+static void draw_glyph(const display_info_t *display_info, void* restrict fb_addr, const struct cell_clip_t *clip, uint16_t c)
+{
+    const size_t glyph_row_bytes = (size_t)display_info_atlas_width(display_info) * fb_bpp;
+    const size_t glyph_bytes = glyph_row_bytes * display_info_atlas_height(display_info);
+    const size_t fb_stride = (size_t)surface_width * fb_bpp;
+
+    void *const *pages = indexed ? display_info->indexed_fonts : display_info->fonts;
+    int page = (c & 0x300) >> 8;
+    const uint8_t *font = pages[page];
+    if (!font) font = pages[0];
+
+    const uint8_t *src = font + (c & 0xFF) * glyph_bytes + clip->gy0 * glyph_row_bytes + clip->gx0 * fb_bpp;
+    uint8_t *dst = (uint8_t *)fb_addr + (size_t)(clip->py + clip->gy0) * fb_stride + (size_t)(clip->px + clip->gx0) * fb_bpp;
+    size_t row_bytes = (size_t)(clip->gx1 - clip->gx0) * fb_bpp;
+
+    for (int gy = clip->gy0; gy < clip->gy1; gy++) {
+        memcpy(dst, src, row_bytes);
+        src += glyph_row_bytes;
+        dst += fb_stride;
     }
+}
+
+static void clear_cell(void* restrict fb_addr, const struct cell_clip_t *clip)
+{
+    const size_t fb_stride = (size_t)surface_width * fb_bpp;
+    uint8_t *dst = (uint8_t *)fb_addr + (size_t)(clip->py + clip->gy0) * fb_stride + (size_t)(clip->px + clip->gx0) * fb_bpp;
+    size_t row_bytes = (size_t)(clip->gx1 - clip->gx0) * fb_bpp;
 
-    int fb_w = OSD_WIDTH;
-    int fb_h = OSD_HEIGHT;
-    int x_offset = display_info->x_offset;
-    int y_offset = display_info->y_offset;
+    for (int gy = clip->gy0; gy < clip->gy1; gy++) {
+        memset(dst, 0, row_bytes);
+        dst += fb_stride;
+    }
+}
 
-    int rx_min = 0, ry_min = 0;
-#if 0 // Debugging rotation and offsets
-    printf("rx_min=%d, ry_min=%d\n", rx_min, ry_min);
-    printf("Drawing character map with rotation %d, fb_w=%d, fb_h=%d, osd_w=%d, osd_h=%d, x_offset=%d, y_offset=%d\n", rotation, fb_w, fb_h, osd_w, osd_h, x_offset, y_offset);
-#endif
+static void draw_character_map(display_info_t *display_info, void* restrict fb_addr, uint16_t character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y])
+{
+    if (display_info->fonts[0] == NULL || (indexed && display_info->indexed_fonts[0] == NULL)) {
+        DEBUG_PRINT("No font available, failed to draw.\n");
+        return;
+    }
 
     for (int y = 0; y < display_info->char_height; y++) {
         for (int x = 0; x < display_info->char_width; x++) {
             uint16_t c = character_map[x][y];
-            if (c == 0) continue;
-
-            int page = (c & 0x300) >> 8;
-            c = c & 0xFF;
-            void* font = display_info->fonts[page];
-            if (!font) font = display_info->fonts[0];
+            struct cell_clip_t clip;
+            if (c == 0 || !clip_cell(display_info, x, y, &clip))
+                continue;
+            draw_glyph(display_info, fb_addr, &clip, c);
+        }
+    }
+}
 
-            uint32_t src_x = x * display_info->font_width + x_offset;
-            uint32_t src_y = y * display_info->font_height + y_offset;
+static void mark_dirty_full(void)
+{
+    pthread_mutex_lock(&dirty_lock);
+    dirty_full = true;
+    pthread_mutex_unlock(&dirty_lock);
+}
 
-            for (uint8_t gy = 0; gy < display_info->font_height; gy++) {
-                for (uint8_t gx = 0; gx < display_info->font_width; gx++) {
-                    uint32_t px = src_x + gx;
-                    uint32_t py = src_y + gy;
-                    int rx = px - rx_min;
-                    int ry = py - ry_min;
+static void mark_dirty_row(int row, int x0, int x1, int y0, int y1)
+{
+    pthread_mutex_lock(&dirty_lock);
+    struct osd_rect_t *r = &dirty_rows[row];
+    if (r->w == 0) {
+        *r = (struct osd_rect_t){ x0, y0, x1 - x0, y1 - y0 };
+    } else {
+        int rx1 = r->x + r->w, ry1 = r->y + r->h;
+        r->x = x0 < r->x ? x0 : r->x;
+        r->y = y0 < r->y ? y0 : r->y;
+        r->w = (x1 > rx1 ? x1 : rx1) - r->x;
+        r->h = (y1 > ry1 ? y1 : ry1) - r->y;
+    }
+    pthread_mutex_unlock(&dirty_lock);
+}
 
-                    if (rx < 0 || ry < 0 || rx >= fb_w || ry >= fb_h) continue;
+/* Narrow clip to the part inside the framebuffer rect of area, false when nothing is left */
+static bool clip_to_area(struct cell_clip_t *clip, const struct cell_clip_t *area)
+{
+    int ax0 = area->px + area->gx0 - clip->px, ax1 = area->px + area->gx1 - clip->px;
+    int ay0 = area->py + area->gy0 - clip->py, ay1 = area->py + area->gy1 - clip->py;
+    if (ax0 > clip->gx0) clip->gx0 = ax0;
+    if (ax1 < clip->gx1) clip->gx1 = ax1;
+    if (ay0 > clip->gy0) clip->gy0 = ay0;
+    if (ay1 < clip->gy1) clip->gy1 = ay1;
+    return clip->gx0 < clip->gx1 && clip->gy0 < clip->gy1;
+}
 
-                    uint32_t fb_offset = (ry * fb_w + rx) * BYTES_PER_PIXEL;
-                    uint32_t font_offset = (((display_info->font_height * display_info->font_width) * BYTES_PER_PIXEL) * c) + (gy * display_info->font_width + gx) * BYTES_PER_PIXEL;
+/* Grid index holding logical pixel v, -1 before the first cell */
+static int grid_index(int v, int offset, int size)
+{
+    return v < offset ? -1 : (v - offset) / size;
+}
 
-                    *((uint8_t *)fb_addr + fb_offset + 0) = *((uint8_t *)font + font_offset + 2); // B
-                    *((uint8_t *)fb_addr + fb_offset + 1) = *((uint8_t *)font + font_offset + 1); // G
-                    *((uint8_t *)fb_addr + fb_offset + 2) = *((uint8_t *)font + font_offset + 0); // R
-                    *((uint8_t *)fb_addr + fb_offset + 3) = *((uint8_t *)font + font_offset + 3); // A
-                }
-            }
+/* Draw the cells of a layer that overlap cell (ax, ay) of area_info, clipped to its framebuffer rect */
+static void draw_layer_in(const display_info_t *display_info, uint16_t character_map[MAX_DISPLAY_X][MAX_DISPLAY_Y],
+                          const display_info_t *area_info, int ax, int ay, const struct cell_clip_t *area)
+{
+    int lx = ax * area_info->glyph_width + area_info->x_offset;
+    int ly = ay * area_info->glyph_height + area_info->y_offset;
+    int x0 = grid_index(lx, display_info->x_offset, display_info->glyph_width);
+    int x1 = grid_index(lx + area_info->glyph_width - 1, display_info->x_offset, display_info->glyph_width);
+    int y0 = grid_index(ly, display_info->y_offset, display_info->glyph_height);
+    int y1 = grid_index(ly + area_info->glyph_height - 1, display_info->y_offset, display_info->glyph_height);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= display_info->char_width) x1 = display_info->char_width - 1;
+    if (y1 >= display_info->char_height) y1 = display_info->char_height - 1;
+
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            uint16_t c = character_map[x][y];
+            struct cell_clip_t clip;
+            if (c == 0 || !clip_cell(display_info, x, y, &clip) || !clip_to_area(&clip, area))
+                continue;
+            draw_glyph(display_info, fb_addr, &clip, c);
         }
     }
 }
 
-static void draw_screen(void)
+/* Clear cell (x, y) of area_info and draw what both layers have there, overlay on top */
+static void redraw_area(const display_info_t *area_info, int x, int y,
+                        const display_info_t *info, uint16_t msp_map[MAX_DISPLAY_X][MAX_DISPLAY_Y])
 {
-    clear_framebuffer();
+    struct cell_clip_t area;
+    if (!clip_cell(area_info, x, y, &area))
+        return;
+    clear_cell(fb_addr, &area);
+    draw_layer_in(info, msp_map, area_info, x, y, &area);
+    draw_layer_in(&overlay_display_info, frame_overlay_map, area_info, x, y, &area);
+    mark_dirty_row(y < MAX_DISPLAY_Y ? y : MAX_DISPLAY_Y - 1, area.px + area.gx0, area.px + area.gx1,
+                   area.py + area.gy0, area.py + area.gy1);
+}
+
+static bool same_grid(const display_info_t *a, const display_info_t *b)
+{
+    return a->char_width == b->char_width && a->char_height == b->char_height &&
+           a->font_width == b->font_width && a->font_height == b->font_height &&
+           a->glyph_width == b->glyph_width && a->glyph_height == b->glyph_height && a->rotate == b->rotate &&
+           a->x_offset == b->x_offset && a->y_offset == b->y_offset;
+}
 
+static void draw_screen(void)
+{
     if (fb_addr== NULL) {
         DEBUG_PRINT("Failed to get framebuffer address\n");
         return;
     }
 
-    if (fakehd_is_enabled()) {
-        fakehd_map_sd_character_map_to_hd(msp_character_map, msp_render_character_map);
-        draw_character_map(current_display_info, fb_addr, msp_render_character_map);
-    } else {
-        draw_character_map(current_display_info, fb_addr, msp_character_map);
+    /* fakehd: HD cells are gathered from the SD map through the precomputed remap */
+    uint16_t (*msp_map)[MAX_DISPLAY_Y] = frame_msp_map;
+    const uint16_t *remap = fakehd_is_enabled() ? fakehd_prepare_remap(frame_msp_map) : NULL;
+
+    display_info_t *info = frame_display_info;
+    if (!info)
+        return;
+    bool incremental = shown_display_info == info && info->fonts[0] && overlay_display_info.fonts[0];
+    if (!incremental) {
+        if (remap) {
+            fakehd_map_sd_character_map_to_hd(remap, frame_msp_map, msp_render_character_map);
+            msp_map = msp_render_character_map;
+        }
+        clear_framebuffer();
+        draw_character_map(info, fb_addr, msp_map);
+        draw_character_map(&overlay_display_info, fb_addr, frame_overlay_map);
+        memcpy(shown_msp_map, msp_map, sizeof(shown_msp_map));
+        memcpy(shown_overlay_map, frame_overlay_map, sizeof(shown_overlay_map));
+        shown_display_info = info;
+        mark_dirty_full();
+        return;
+    }
+
+    /*
+     * layers on different grids (SD/HD under the overlay): each layer is diffed against what it
+     * showed, a changed cell's rect is cleared and refilled from both layers clipped to it
+     */
+    if (!same_grid(info, &overlay_display_info)) {
+        if (remap) {
+            fakehd_map_sd_character_map_to_hd(remap, frame_msp_map, msp_render_character_map);
+            msp_map = msp_render_character_map;
+        }
+        for (int y = 0; y < info->char_height; y++)
+            for (int x = 0; x < info->char_width; x++)
+                if (msp_map[x][y] != shown_msp_map[x][y])
+                    redraw_area(info, x, y, info, msp_map);
+        for (int y = 0; y < overlay_display_info.char_height; y++)
+            for (int x = 0; x < overlay_display_info.char_width; x++)
+                if (frame_overlay_map[x][y] != shown_overlay_map[x][y])
+                    redraw_area(&overlay_display_info, x, y, info, msp_map);
+        memcpy(shown_msp_map, msp_map, sizeof(shown_msp_map));
+        memcpy(shown_overlay_map, frame_overlay_map, sizeof(shown_overlay_map));
+        return;
+    }
+
+    /*
+     * both layers share the grid: redraw a cell when either layer changed, overlay on top.
+     * With fakehd the remap is applied here, cells that moved show up as changed.
+     */
+    for (int y = 0; y < info->char_height; y++) {
+        int x0 = surface_width, x1 = 0, y0 = surface_height, y1 = 0;
+        for (int x = 0; x < info->char_width; x++) {
+            uint16_t c = remap ? fakehd_remap_cell(remap, frame_msp_map, x, y) : msp_map[x][y];
+            uint16_t o = frame_overlay_map[x][y];
+            if (c == shown_msp_map[x][y] && o == shown_overlay_map[x][y])
+                continue;
+            shown_msp_map[x][y] = c;
+            shown_overlay_map[x][y] = o;
+
+            struct cell_clip_t clip;
+            if (!clip_cell(info, x, y, &clip))
+                continue;
+            clear_cell(fb_addr, &clip);
+            if (c)
+                draw_glyph(info, fb_addr, &clip, c);
+            if (o)
+                draw_glyph(&overlay_display_info, fb_addr, &clip, o);
+
+            if (clip.px + clip.gx0 < x0) x0 = clip.px + clip.gx0;
+            if (clip.px + clip.gx1 > x1) x1 = clip.px + clip.gx1;
+            if (clip.py + clip.gy0 < y0) y0 = clip.py + clip.gy0;
+            if (clip.py + clip.gy1 > y1) y1 = clip.py + clip.gy1;
+        }
+        if (x0 < x1)
+            mark_dirty_row(y, x0, x1, y0, y1);
     }
-    draw_character_map(&overlay_display_info, fb_addr, overlay_character_map);
 }
 
 static void render_screen(void)
@@ -228,25 +586,48 @@ static void render_screen(void)
     draw_screen();
     if (display_mode == DISPLAY_DISABLED) {
         clear_framebuffer();
+        shown_display_info = NULL;
+        mark_dirty_full();
     }
     //DEBUG_PRINT("drew a frame\n");
     clock_gettime(CLOCK_MONOTONIC, &last_render);
+    ui_wakeup();
+
+    if (frame_rx_us) {
+        uint64_t now_us = (uint64_t)last_render.tv_sec * 1000000ULL + (uint64_t)last_render.tv_nsec / 1000ULL;
+        uint64_t latency_us = now_us > frame_rx_us ? now_us - frame_rx_us : 0;
+        pthread_mutex_lock(&render_lock);
+        update_latency.frames++;
+        update_latency.total_us += latency_us;
+        if (latency_us > update_latency.max_us)
+            update_latency.max_us = latency_us;
+        pthread_mutex_unlock(&render_lock);
+    }
 }
 
 
 static void msp_draw_complete(void)
 {
-    render_screen();
+    if (!batch_open) {
+        publish_maps(msp_character_map, current_display_info, take_fakehd_off(), false, input_rx_us);
+        return;
+    }
+    // the map may already hold strings of the next frame by the end of the batch
+    memcpy(batch_msp_map, msp_character_map, sizeof(batch_msp_map));
+    batch_display_info = current_display_info;
+    batch_fakehd_off |= take_fakehd_off();
+    if (!batch_completed)
+        batch_rx_us = input_rx_us;
+    batch_completed = true;
 }
 
 static void start_display(void)
 {
     memset(msp_character_map, 0, sizeof(msp_character_map));
-    memset(msp_render_character_map, 0, sizeof(msp_render_character_map));
     memset(overlay_character_map, 0, sizeof(overlay_character_map));
 
     display_print_string((MAX_DISPLAY_X/2) - (sizeof(SPLASH_STRING)/2), MAX_DISPLAY_Y - 1, SPLASH_STRING, sizeof(SPLASH_STRING));
-    msp_draw_complete();
+    publish_frame(true, true);
 }
 
 static void msp_set_options(uint8_t font_num, msp_hd_options_e is_hd) {
@@ -254,12 +635,12 @@ static void msp_set_options(uint8_t font_num, msp_hd_options_e is_hd) {
 
     switch (is_hd) {
     case MSP_HD_OPTION_60_22:
-        fakehd_disable();
+        fakehd_off_pending = true;
         current_display_info = &full_display_info;
         break;
     case MSP_HD_OPTION_50_18:
     case MSP_HD_OPTION_30_16:
-        fakehd_disable();
+        fakehd_off_pending = true;
         current_display_info = &hd_display_info;
         break;
     default:
@@ -268,11 +649,6 @@ static void msp_set_options(uint8_t font_num, msp_hd_options_e is_hd) {
     }
 }
 
-static void msp_callback(msp_msg_t *msp_message)
-{
-    displayport_process_message(&display_driver, msp_message);
-}
-
 static void load_fonts(char* font_variant)
 {
     char file_path[255];
@@ -284,8 +660,86 @@ static void load_fonts(char* font_variant)
     load_font(&overlay_display_info, font_variant);
 }
 
+static display_info_t *const all_display_info[] = {
+    &sd_display_info, &hd_display_info, &full_display_info, &overlay_display_info,
+};
+#define NUM_DISPLAY_INFO (int)(sizeof(all_display_info) / sizeof(all_display_info[0]))
+
+static void free_indexed_fonts(void)
+{
+    for (int i = 0; i < NUM_DISPLAY_INFO; i++) {
+        for (int p = 0; p < NUM_FONT_PAGES; p++) {
+            void *page = all_display_info[i]->indexed_fonts[p];
+            if (!page)
+                continue;
+            // display_infos sharing a font share its index atlas
+            for (int j = i; j < NUM_DISPLAY_INFO; j++) {
+                for (int q = 0; q < NUM_FONT_PAGES; q++) {
+                    if (all_display_info[j]->indexed_fonts[q] == page)
+                        all_display_info[j]->indexed_fonts[q] = NULL;
+                }
+            }
+            free(page);
+        }
+    }
+}
+
+/* One palette for every loaded atlas, then each atlas page as palette indices */
+static int index_fonts(void)
+{
+    const uint32_t *pages[NUM_DISPLAY_INFO * NUM_FONT_PAGES];
+    size_t pixels[NUM_DISPLAY_INFO * NUM_FONT_PAGES];
+    int count = 0;
+    for (int i = 0; i < NUM_DISPLAY_INFO; i++) {
+        const display_info_t *d = all_display_info[i];
+        for (int p = 0; p < NUM_FONT_PAGES; p++) {
+            if (!d->fonts[p])
+                continue;
+            int k = 0;
+            while (k < count && pages[k] != d->fonts[p])
+                k++;
+            if (k < count)
+                continue;
+            pages[count] = d->fonts[p];
+            pixels[count] = (size_t)display_info_atlas_width(d) * display_info_atlas_height(d) * NUM_CHARS;
+            count++;
+        }
+    }
+    if (count == 0)
+        return -1;
+
+    int colours = palette_build(pages, pixels, count, osd_palette);
+    if (colours < 0)
+        return -1;
+
+    for (int i = 0; i < NUM_DISPLAY_INFO; i++) {
+        display_info_t *d = all_display_info[i];
+        for (int p = 0; p < NUM_FONT_PAGES; p++) {
+            if (!d->fonts[p])
+                continue;
+            for (int j = 0; j < i && !d->indexed_fonts[p]; j++) {
+                for (int q = 0; q < NUM_FONT_PAGES; q++) {
+                    if (all_display_info[j]->fonts[q] == d->fonts[p])
+                        d->indexed_fonts[p] = all_display_info[j]->indexed_fonts[q];
+                }
+            }
+            if (d->indexed_fonts[p])
+                continue;
+            d->indexed_fonts[p] = palette_index_page(d->fonts[p],
+                (size_t)display_info_atlas_width(d) * display_info_atlas_height(d) * NUM_CHARS, osd_palette);
+            if (!d->indexed_fonts[p]) {
+                free_indexed_fonts();
+                return -1;
+            }
+        }
+    }
+    printf("[ MSP OSD ] Indexed OSD surface, %d palette colours for %d atlas pages\n", colours, count);
+    return 0;
+}
+
 static void close_all_fonts(void)
 {
+    free_indexed_fonts();
     close_font(&sd_display_info);
     close_font(&hd_display_info);
     close_font(&overlay_display_info);
@@ -326,7 +780,8 @@ void wfb_status_link_callback(const wfb_rx_status *st)
             if (l > 0 && l < (int)(sizeof(str) - len)) len += l;
         }
         display_print_string(0, MAX_DISPLAY_Y - 1, str, strlen(str));
-        need_render_display();  // TODO: need to synchronize with MSP data draw_complete
+        publish_frame(false, true);
+        ui_set_link_rssi((int)st->ants[0].rssi_avg);
     }
 
 #if DEBUG_PRINT_LINK
@@ -343,32 +798,11 @@ void wfb_status_link_callback(const wfb_rx_status *st)
 }
 #endif
 
-static void need_render_display(void)
-{
-    if (need_render) {
-        return; // already scheduled
-    }
-    need_render = true;
-    clock_gettime(CLOCK_MONOTONIC, &last_render);
-}
-
-static void render_display(void)
-{
-    msp_draw_complete();
-    need_render = false;
-}
-
 static void* msp_osd_thread(void *arg)
 {
     struct config_t *cfg = (struct config_t *)arg;
     printf("[ MSP OSD ] Starting MSP OSD thread\n");
-
-    fb_addr = malloc(OSD_WIDTH * OSD_HEIGHT * BYTES_PER_PIXEL);
-    if (fb_addr == NULL) {
-        printf("[ MSP OSD ] Failed to allocate framebuffer memory\n");
-        return NULL;
-    }
-    printf("[ MSP OSD ] OSD frame size: %dx%d\n", OSD_WIDTH, OSD_HEIGHT);
+    TRACE_THREAD("osd");
 
     memset(current_fc_variant, 0, sizeof(current_fc_variant));
 
@@ -376,16 +810,44 @@ static void* msp_osd_thread(void *arg)
     load_fakehd_config();
 
     fakehd_disable();
-    current_display_info = &hd_display_info; // TODO: add presets for 1920x1080, 1280x720 display
+    current_display_info = &hd_display_info;
+    fit_all_display_info();
 
     display_driver.draw_character = &msp_draw_character;
     display_driver.clear_screen = &msp_clear_screen;
     display_driver.draw_complete = &msp_draw_complete;
     display_driver.set_options = &msp_set_options;
 
-    msp_state.cb = &msp_callback;
+    msp_dispatch_register(msp_dispatch_table, MSP_DISPLAYPORT, displayport_handle_message, &display_driver);
 
     load_fonts("btfl");
+    if (indexed && index_fonts() < 0) {
+        printf("[ MSP OSD ] Failed to index the font atlas, using an ARGB surface\n");
+        indexed = false;
+    }
+    fb_bpp = indexed ? 1 : BYTES_PER_PIXEL;
+
+    fb_addr = calloc((size_t)surface_width * surface_height, (size_t)fb_bpp);
+    if (fb_addr == NULL) {
+        printf("[ MSP OSD ] Failed to allocate framebuffer memory\n");
+        close_all_fonts();
+        return NULL;
+    }
+    printf("[ MSP OSD ] OSD frame size: %dx%d, rotated %d, %s\n", surface_width, surface_height, surface_rotate,
+           indexed ? "8-bit indexed" : "ARGB");
+
+    if (cfg->osd_record_file) {
+        rec_config_t rec_config = {
+            .char_width = MAX_DISPLAY_X,
+            .char_height = MAX_DISPLAY_Y,
+            .font_width = hd_display_info.font_width,
+            .font_height = hd_display_info.font_height,
+            .x_offset = hd_display_info.x_offset,
+            .y_offset = hd_display_info.y_offset,
+            .font_variant = "btfl",
+        };
+        rec_start(cfg->osd_record_file, &rec_config);
+    }
 
     start_display();
     usleep(100000);
@@ -407,12 +869,29 @@ static void* msp_osd_thread(void *arg)
     msp_draw_complete();
 #endif
     while (running) {
-        // noting now
-        if(need_render) {
-            render_display();
-        }
-        usleep(16000); // Simulate 60 FPS
+        // sleep until a producer publishes a frame
+        pthread_mutex_lock(&render_lock);
+        while (running && !render_pending)
+            pthread_cond_wait(&render_cond, &render_lock);
+        pthread_mutex_unlock(&render_lock);
+        if (!running)
+            break;
+
+        // coalesce bursts: at most one render per display refresh, the latest maps win
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        int64_t since_us = (now.tv_sec - last_render.tv_sec) * 1000000LL + (now.tv_nsec - last_render.tv_nsec) / 1000;
+        if (since_us >= 0 && since_us < OSD_FRAME_INTERVAL_US)
+            usleep((useconds_t)(OSD_FRAME_INTERVAL_US - since_us));
+
+        take_frame();
+        if (frame_rx_us)
+            rec_write_frame(&frame_msp_map[0][0], MAX_DISPLAY_X * MAX_DISPLAY_Y, frame_rx_us);
+        TRACE_BEGIN(t_render);
+        render_screen();
+        TRACE_END(TRACE_OSD_RENDER, t_render, 0);
     }
+    rec_stop();
 #ifdef WFB_STATUS_LINK
     wfb_status_link_stop();
 #endif
@@ -429,22 +908,311 @@ static void* msp_osd_thread(void *arg)
     return NULL;
 }
 
+int msp_osd_take_dirty_rects(struct osd_rect_t *rects, int max)
+{
+    int n = 0;
+    pthread_mutex_lock(&dirty_lock);
+    for (int y = 0; y < MAX_DISPLAY_Y && !dirty_full; y++) {
+        if (dirty_rows[y].w == 0)
+            continue;
+        if (n == max)
+            dirty_full = true;     // caller can't take them all, report the whole frame
+        else
+            rects[n++] = dirty_rows[y];
+    }
+    if (dirty_full && max > 0) {
+        rects[0] = (struct osd_rect_t){ 0, 0, surface_width, surface_height };
+        n = 1;
+    }
+    dirty_full = false;
+    memset(dirty_rows, 0, sizeof(dirty_rows));
+    pthread_mutex_unlock(&dirty_lock);
+    return n;
+}
+
+void msp_osd_set_surface(int width, int height, int rotate)
+{
+    if (running) {
+        printf("[ MSP OSD ] Can't change the surface while running\n");
+        return;
+    }
+    if (width <= 0 || height <= 0 || (rotate != 0 && rotate != 90 && rotate != 180 && rotate != 270)) {
+        printf("[ MSP OSD ] Invalid surface %dx%d rotated %d, keeping %dx%d\n", width, height, rotate,
+               surface_width, surface_height);
+        return;
+    }
+    surface_width = width;
+    surface_height = height;
+    surface_rotate = rotate;
+}
+
+void msp_osd_get_surface(int *width, int *height, int *rotate)
+{
+    *width = surface_width;
+    *height = surface_height;
+    *rotate = surface_rotate;
+}
+
+void msp_osd_set_indexed(bool enable)
+{
+    if (running) {
+        printf("[ MSP OSD ] Can't change the surface format while running\n");
+        return;
+    }
+    indexed = enable;
+}
+
 void *msp_osd_get_fb_addr(void)
 {
-    if (fb_addr)
+    if (fb_addr && !indexed)
         return fb_addr;
 
     return NULL;
 }
 
+const uint8_t *msp_osd_get_indexed_fb(const uint32_t **palette)
+{
+    if (!fb_addr || !indexed)
+        return NULL;
+    *palette = osd_palette;
+    return fb_addr;
+}
+
+void msp_osd_expand_indexed(uint32_t *dst, const struct osd_rect_t *rect)
+{
+    const uint8_t *src = fb_addr;
+    if (!src || !indexed)
+        return;
+    for (int y = rect->y; y < rect->y + rect->h; y++) {
+        const uint8_t *s = src + (size_t)y * surface_width + rect->x;
+        uint32_t *d = dst + (size_t)y * surface_width + rect->x;
+        for (int x = 0; x < rect->w; x++)
+            d[x] = osd_palette[s[x]];
+    }
+}
+
+/* Stand-in glyphs for --bench=osd when no font is installed: solid rows with a soft edge */
+static int bench_synthetic_font(display_info_t *display_info)
+{
+    size_t glyph_row_bytes = (size_t)display_info_atlas_width(display_info) * BYTES_PER_PIXEL;
+    size_t glyph_bytes = glyph_row_bytes * display_info_atlas_height(display_info);
+    uint8_t *font = malloc(glyph_bytes * NUM_CHARS);
+    if (!font)
+        return -1;
+    for (size_t i = 0; i < glyph_bytes * NUM_CHARS; i += BYTES_PER_PIXEL) {
+        uint8_t a = ((i / glyph_row_bytes) % 3) ? 0xFF : 0x80;
+        font[i + 0] = font[i + 1] = font[i + 2] = a;
+        font[i + 3] = a;
+    }
+    display_info->fonts[0] = font;
+    return 0;
+}
+
+int msp_osd_bench_render(struct bench_series_t *full, struct bench_series_t *update, struct bench_series_t *expand,
+                         uint64_t *fb_bytes, uint64_t duration_us, volatile bool *bench_running)
+{
+    if (running) {
+        printf("[ MSP OSD ] Can't benchmark while the OSD thread runs\n");
+        return -1;
+    }
+
+    fakehd_disable();
+    current_display_info = &hd_display_info;
+    fit_all_display_info();
+    load_font(&hd_display_info, "btfl");
+    load_font(&overlay_display_info, "btfl");
+    if (!hd_display_info.fonts[0] || !overlay_display_info.fonts[0]) {
+        printf("[ MSP OSD ] No font found, benchmarking with synthetic glyphs\n");
+        close_font(&hd_display_info);
+        close_font(&overlay_display_info);
+        if (bench_synthetic_font(&hd_display_info) < 0 || bench_synthetic_font(&overlay_display_info) < 0) {
+            close_all_fonts();
+            return -1;
+        }
+    }
+    if (indexed && index_fonts() < 0) {
+        close_all_fonts();
+        return -1;
+    }
+    fb_bpp = indexed ? 1 : BYTES_PER_PIXEL;
+
+    /* indexed: the ARGB frame the Rockchip compositor keeps, dirty rects expanded into it */
+    size_t pixels = (size_t)surface_width * surface_height;
+    fb_addr = calloc(pixels, (size_t)fb_bpp);
+    uint32_t *argb = indexed ? calloc(pixels, sizeof(uint32_t)) : NULL;
+    if (fb_addr == NULL || (indexed && argb == NULL)) {
+        close_all_fonts();
+        free(fb_addr);
+        free(argb);
+        fb_addr = NULL;
+        return -1;
+    }
+    msp_osd_take_dirty_rects(NULL, 0);
+
+    /* worst case: every cell used, all font pages, plus the link status line on top */
+    int n = 0;
+    for (int y = 0; y < MAX_DISPLAY_Y; y++) {
+        for (int x = 0; x < MAX_DISPLAY_X; x++, n++)
+            msp_character_map[x][y] = (uint16_t)(((n / 255) % NUM_FONT_PAGES) << 8 | (n % 255 + 1));
+    }
+    memset(overlay_character_map, 0, sizeof(overlay_character_map));
+    display_print_string(0, MAX_DISPLAY_Y - 1, SPLASH_STRING, sizeof(SPLASH_STRING) - 1);
+    publish_frame(true, true);
+
+    /* alternate full redraws with typical updates: a few cells (timer, voltage) change per frame */
+    struct timespec t0, t1, start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int frames = 0;
+    while (*bench_running) {
+        bool redraw_all = (frames & 1) == 0;
+        if (redraw_all) {
+            shown_display_info = NULL;
+        } else {
+            for (int i = 0; i < 8; i++)
+                msp_character_map[40 + i][2] = (uint16_t)('0' + (frames / 2 + i) % 10);
+            publish_frame(true, false);
+        }
+        take_frame();
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        draw_screen();
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        bench_series_add(redraw_all ? full : update,
+                         (uint64_t)((t1.tv_sec - t0.tv_sec) * 1000000LL + (t1.tv_nsec - t0.tv_nsec) / 1000));
+        frames++;
+
+        /* framebuffer bytes the frame touched, and for indexed their expansion to ARGB */
+        struct osd_rect_t rects[MSP_OSD_MAX_DIRTY_RECTS];
+        int n_rects = msp_osd_take_dirty_rects(rects, MSP_OSD_MAX_DIRTY_RECTS);
+        for (int i = 0; i < n_rects; i++)
+            *fb_bytes += (uint64_t)rects[i].w * rects[i].h * fb_bpp;
+        if (argb) {
+            struct timespec e0, e1;
+            clock_gettime(CLOCK_MONOTONIC, &e0);
+            for (int i = 0; i < n_rects; i++)
+                msp_osd_expand_indexed(argb, &rects[i]);
+            clock_gettime(CLOCK_MONOTONIC, &e1);
+            bench_series_add(expand, (uint64_t)((e1.tv_sec - e0.tv_sec) * 1000000LL + (e1.tv_nsec - e0.tv_nsec) / 1000));
+        }
+        if ((uint64_t)((t1.tv_sec - start.tv_sec) * 1000000LL + (t1.tv_nsec - start.tv_nsec) / 1000) >= duration_us)
+            break;
+    }
+
+    memset(msp_character_map, 0, sizeof(msp_character_map));
+    memset(overlay_character_map, 0, sizeof(overlay_character_map));
+    publish_frame(true, true);
+    take_frame();
+    shown_display_info = NULL;
+    close_all_fonts();
+    free(fb_addr);
+    free(argb);
+    fb_addr = NULL;
+    return frames;
+}
+
 int msp_osd_init(struct config_t *cfg)
 {
     if (running) {
         printf("[ MSP OSD ] Already running\n");
         return -1;
     }
+    msp_dispatch_table = msp_dispatch_create();
+    if (!msp_dispatch_table) {
+        printf("[ MSP OSD ] Failed to allocate the MSP dispatch table\n");
+        return -1;
+    }
+    msp_port = (msp_port_t){ .msp_state = MSP_IDLE, .dispatch = msp_dispatch_table };
+    msp_osd_reset_delta();
+    delta_options = OSD_DELTA_OPTIONS_UNKNOWN;
     running = true;
-    return pthread_create(&msp_thread, NULL, msp_osd_thread, cfg);
+    int ret = pthread_create(&msp_thread, NULL, msp_osd_thread, cfg);
+    if (ret != 0) {
+        running = false;
+        msp_dispatch_destroy(msp_dispatch_table);
+        msp_dispatch_table = NULL;
+    }
+    return ret;
+}
+
+int msp_osd_process_buffer(const uint8_t *buf, size_t len, uint64_t rx_us)
+{
+    if (!msp_dispatch_table)
+        return 0;
+    input_rx_us = rx_us;
+    return msp_process_buffer(&msp_port, buf, len);
+}
+
+void msp_osd_reset_input(void)
+{
+    msp_port.msp_state = MSP_IDLE;
+}
+
+void msp_osd_reset_delta(void)
+{
+    memset(delta_valid, 0, sizeof(delta_valid));
+    delta_current = -1;
+}
+
+int msp_osd_apply_delta(const uint8_t *pkt, size_t len, uint64_t rx_us)
+{
+    struct osd_delta_info_t info;
+    if (!msp_dispatch_table || osd_delta_parse_header(pkt, len, &info) < 0)
+        return -1;
+
+    int base = info.base_seq % OSD_DELTA_HISTORY;
+    if (info.type == OSD_DELTA_DELTA && (!delta_valid[base] || delta_seq[base] != info.base_seq))
+        return -1;      // base not received, wait for the next keyframe
+
+    if (info.options != OSD_DELTA_OPTIONS_UNKNOWN && info.options != delta_options) {
+        msp_set_options(info.font, (msp_hd_options_e)info.options);
+        delta_options = info.options;
+        delta_current = -1;
+    }
+    if (info.type == OSD_DELTA_DELTA && base != delta_current)
+        memcpy(msp_character_map, delta_maps[base], sizeof(msp_character_map));
+
+    // only the changed cells are written, straight into the map DisplayPort draws into
+    if (osd_delta_apply(pkt, len, &msp_character_map[0][0]) < 0) {
+        delta_current = -1;
+        return -1;
+    }
+
+    int slot = info.seq % OSD_DELTA_HISTORY;
+    memcpy(delta_maps[slot], msp_character_map, sizeof(delta_maps[slot]));
+    delta_seq[slot] = info.seq;
+    delta_valid[slot] = true;
+    delta_current = slot;
+
+    input_rx_us = rx_us;
+    msp_draw_complete();
+    return info.seq;
+}
+
+void msp_osd_begin_batch(void)
+{
+    batch_open = true;
+    batch_completed = false;
+}
+
+void msp_osd_end_batch(void)
+{
+    batch_open = false;
+    if (batch_completed)
+        publish_maps(batch_msp_map, batch_display_info, batch_fakehd_off, false, batch_rx_us);
+    batch_completed = false;
+    batch_fakehd_off = false;
+}
+
+void msp_osd_take_latency(struct msp_osd_latency_t *latency)
+{
+    pthread_mutex_lock(&render_lock);
+    *latency = update_latency;
+    memset(&update_latency, 0, sizeof(update_latency));
+    pthread_mutex_unlock(&render_lock);
+}
+
+msp_dispatch_t *msp_osd_get_dispatch(void)
+{
+    return msp_dispatch_table;
 }
 
 void msp_osd_stop(void)
@@ -453,6 +1221,12 @@ void msp_osd_stop(void)
         printf("[ MSP OSD ] Not running, nothing to stop\n");
         return;
     }
+    pthread_mutex_lock(&render_lock);
     running = false;
+    pthread_cond_broadcast(&render_cond);
+    pthread_mutex_unlock(&render_lock);
     pthread_join(msp_thread, NULL);
+    msp_port.dispatch = NULL;
+    msp_dispatch_destroy(msp_dispatch_table);
+    msp_dispatch_table = NULL;
 }
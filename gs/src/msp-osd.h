@@ -5,11 +5,106 @@
 #ifndef VD_LINK_MSP_OSD_H
 #define VD_LINK_MSP_OSD_H
 #include "common.h"
+#include "bench.h"
+#include "msp_dispatch.h"
+
+#define MSP_OSD_MAX_DIRTY_RECTS 20     // one per character row
 
 int msp_osd_init(struct config_t *cfg);
 
 void msp_osd_stop(void);
 
+/**
+ * Received MSP bytes from the FC link, any chunking, received at rx_us (CLOCK_MONOTONIC, 0: unknown).
+ * Frames are dispatched by command: DisplayPort to the OSD, other commands to the handlers registered
+ * on msp_osd_get_dispatch(). Call from one thread, between msp_osd_init and msp_osd_stop.
+ * Returns the number of frames.
+ */
+int msp_osd_process_buffer(const uint8_t *buf, size_t len, uint64_t rx_us);
+
+/**
+ * OSD delta packet (osd_delta.h) from the drone: its changed cells are written into the MSP character
+ * map and the map is published as on a DisplayPort draw complete. Same thread as msp_osd_process_buffer.
+ * Returns the seq to acknowledge, -1 if it can't be applied (malformed, base map not received).
+ */
+int msp_osd_apply_delta(const uint8_t *pkt, size_t len, uint64_t rx_us);
+
+/** Input was lost or reordered: drop the frame the parser holds partially */
+void msp_osd_reset_input(void);
+
+/** The delta sender restarted: forget the maps received from it, later deltas need a new keyframe */
+void msp_osd_reset_delta(void);
+
+/**
+ * Input from the following msp_osd_process_buffer calls is one batch (e.g. every datagram queued on
+ * a socket): a DisplayPort draw complete only keeps the map, msp_osd_end_batch publishes the last
+ * complete map for a single render.
+ */
+void msp_osd_begin_batch(void);
+void msp_osd_end_batch(void);
+
+/* OSD updates rendered, and their latency from receive to the framebuffer */
+struct msp_osd_latency_t {
+    uint32_t frames;
+    uint64_t total_us;
+    uint64_t max_us;
+};
+
+/**
+ * Update latency since the previous call, then reset. A render that coalesced several updates
+ * counts once, from the receive time of the oldest.
+ */
+void msp_osd_take_latency(struct msp_osd_latency_t *latency);
+
+/**
+ * Dispatch table of the received MSP frames, to subscribe to commands (msp_dispatch_register) or
+ * read per-command message counts. Valid between msp_osd_init and msp_osd_stop, NULL otherwise.
+ */
+msp_dispatch_t *msp_osd_get_dispatch(void);
+
+/**
+ * Size of the OSD framebuffer as the display scans it out, and the clockwise rotation (0/90/180/270)
+ * of a rotated panel. Call before msp_osd_init. The character grid is fitted to the surface and the
+ * glyph atlas scaled and turned once when fonts load, so frames need no scaling or rotation later.
+ * Defaults to 1280x720, not rotated.
+ */
+void msp_osd_set_surface(int width, int height, int rotate);
+
+void msp_osd_get_surface(int *width, int *height, int *rotate);
+
+/**
+ * 8-bit indexed OSD surface: glyphs are drawn and diffed at 1 byte per pixel with a palette quantized
+ * from the font (index 0 transparent) and expanded to ARGB only when composited. Call before msp_osd_init.
+ * Falls back to ARGB if the font can't be indexed.
+ */
+void msp_osd_set_indexed(bool enable);
+
+/** ARGB (BGRA premultiplied) framebuffer, NULL when not running or the surface is indexed */
 void *msp_osd_get_fb_addr(void);
 
+/**
+ * Indexed framebuffer (surface size, 1 byte per pixel) and its PALETTE_SIZE entry BGRA premultiplied
+ * palette, NULL when not running or the surface is ARGB. Palette entries don't change while running.
+ */
+const uint8_t *msp_osd_get_indexed_fb(const uint32_t **palette);
+
+/** Expand rect of the indexed framebuffer into dst, a surface size BGRA frame */
+void msp_osd_expand_indexed(uint32_t *dst, const struct osd_rect_t *rect);
+
+/**
+ * Regions of the OSD framebuffer changed since the previous call, for partial blending/upload.
+ * Returns the number of rects written (at most max, one full frame rect if more changed), 0 if nothing changed.
+ */
+int msp_osd_take_dirty_rects(struct osd_rect_t *rects, int max);
+
+/**
+ * --bench=osd: render a full character map (every cell, all font pages) into a private framebuffer
+ * until duration_us passed. Frames alternate between a full redraw and an update of a few cells,
+ * one sample per frame in the matching series. fb_bytes accumulates the framebuffer bytes the frames
+ * touched. Indexed surface: every frame's dirty rects are also expanded to ARGB, timed in expand.
+ * Returns the number of frames, -1 on error. The OSD thread must not run.
+ */
+int msp_osd_bench_render(struct bench_series_t *full, struct bench_series_t *update, struct bench_series_t *expand,
+                         uint64_t *fb_bytes, uint64_t duration_us, volatile bool *bench_running);
+
 #endif //VD_LINK_MSP_OSD_H
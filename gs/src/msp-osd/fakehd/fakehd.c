@@ -5,6 +5,7 @@
 
 #include "json/osd_config.h"
 #include "toast/toast.h"
+#include "fakehd.h"
 
 #define FAKEHD_ENABLE_KEY "fakehd_enable"
 #define FAKEHD_LOCK_CENTER_KEY "fakehd_lock_center"
@@ -28,6 +29,16 @@ static int fakehd_trigger_y = 99;
 static char fakehd_columns = 'S';
 static char fakehd_rows[INPUT_COLS] = "WWWWWWCCWWWWWWWD";
 
+/*
+ * HD cell -> SD cell index for both layouts, rebuilt when the config changes.
+ * fakehd_dest is the inverse, SD cell -> HD cell, for the menu switch handling.
+ */
+enum { FAKEHD_LAYOUT_CONFIG, FAKEHD_LAYOUT_CENTER, FAKEHD_LAYOUTS };
+static uint16_t fakehd_remap[FAKEHD_LAYOUTS][FAKEHD_MAP_COLS * FAKEHD_MAP_ROWS];
+static uint16_t fakehd_dest[FAKEHD_LAYOUTS][FAKEHD_MAP_COLS * FAKEHD_MAP_ROWS];
+static uint16_t fakehd_frame_remap[FAKEHD_MAP_COLS * FAKEHD_MAP_ROWS];   // layout with hidden menu switch cells
+static int fakehd_remap_valid = 0;
+
 #ifdef DEBUG
 #define DEBUG_PRINT(fmt, args...)    fprintf(stderr, "[ MSP-OSD ] [ FAKE-HD] " fmt, ## args)
 #else
@@ -93,7 +104,8 @@ void load_fakehd_config()
     const char * rows = get_string_config_value(FAKEHD_ROWS_KEY);
     if (rows) {
         DEBUG_PRINT("fakehd found custom row conf\n");
-        memcpy(fakehd_rows, rows, INPUT_COLS);
+        // one layout letter per SD row, a shorter string keeps the defaults for the rest
+        memcpy(fakehd_rows, rows, strnlen(rows, INPUT_ROWS));
     }
 
     const char * cols = get_string_config_value(FAKEHD_COLUMNS_KEY);
@@ -102,6 +114,7 @@ void load_fakehd_config()
         DEBUG_PRINT("fakehd found col conf\n");
         fakehd_columns = cols[0];
     }
+    fakehd_remap_valid = 0;
     DEBUG_PRINT("fakehd finished config init\n");
 }
 
@@ -163,12 +176,47 @@ static void fakehd_get_row_config(int rownum, int row[INPUT_COLS])
 }
 
 
+static int fakehd_cell(int x, int y)
+{
+    return x * FAKEHD_MAP_ROWS + y;
+}
+
+/* Place SD cell (x, y) at HD (render_x, render_y), cells outside the HD map are dropped */
+static void fakehd_layout_set(int layout, int x, int y, int render_x, int render_y)
+{
+    if (render_x < 0 || render_x >= FAKEHD_MAP_COLS || render_y < 0 || render_y >= FAKEHD_MAP_ROWS)
+        return;
+    fakehd_remap[layout][fakehd_cell(render_x, render_y)] = (uint16_t)fakehd_cell(x, y);
+    fakehd_dest[layout][fakehd_cell(x, y)] = (uint16_t)fakehd_cell(render_x, render_y);
+}
+
+static void fakehd_build_remap(void)
+{
+    int row[INPUT_COLS];
+    int col[INPUT_ROWS];
+
+    memset(fakehd_remap, 0xFF, sizeof(fakehd_remap));   // FAKEHD_NO_CELL
+    memset(fakehd_dest, 0xFF, sizeof(fakehd_dest));
+    fakehd_get_column_config(col);
+    for (int y = 0; y < INPUT_ROWS; y++)
+    {
+        fakehd_get_row_config(y, row);
+        for (int x = 0; x < INPUT_COLS; x++)
+        {
+            fakehd_layout_set(FAKEHD_LAYOUT_CONFIG, x, y, row[x], col[y]);
+            // menu and postflight stats, centered
+            fakehd_layout_set(FAKEHD_LAYOUT_CENTER, x, y, x + 15, y + 3);
+        }
+    }
+    fakehd_remap_valid = 1;
+}
+
 // when possible, this should be called on reconnect. it will do what's needed to put fakehd back
 // into fresh booted state
 void fakehd_reset() {
     // clear saved centering trigger position
-    int fakehd_trigger_x = 99;
-    int fakehd_trigger_y = 99;
+    fakehd_trigger_x = 99;
+    fakehd_trigger_y = 99;
 }
 
 void fakehd_enable()
@@ -186,72 +234,72 @@ int fakehd_is_enabled() {
     return fakehd_enabled;
 }
 
-void fakehd_map_sd_character_map_to_hd(uint16_t sd_character_map[52][20], uint16_t hd_character_map[52][20])
+const uint16_t *fakehd_prepare_remap(uint16_t sd_character_map[FAKEHD_MAP_COLS][FAKEHD_MAP_ROWS])
 {
-    int row[INPUT_COLS];
-    int col[INPUT_ROWS];
+    if (!fakehd_remap_valid)
+        fakehd_build_remap();
 
-    fakehd_get_column_config(col);
+    // to visualise the layout better in dev
+    if (fakehd_layout_debug) {
+        for (int y = 0; y < INPUT_ROWS; y++)
+            for (int x = 0; x < INPUT_COLS; x++)
+                if (sd_character_map[x][y] == 0)
+                    sd_character_map[x][y] = 48 + (x % 10);
+    }
 
-    int render_x = 0;
-    int render_y = 0;
-    for (int y = INPUT_ROWS-1; y >= 0; y--)
+    // if current element is fly min or throttle icon
+    // record the current position as the 'trigger' position
+    for (int y = INPUT_ROWS - 1; y >= 0 && fakehd_trigger_x == 99; y--)
     {
-        fakehd_get_row_config(y, row);
-        for (int x = INPUT_COLS-1; x >= 0; x--)
+        for (int x = INPUT_COLS - 1; x >= 0; x--)
         {
-            // to visualise the layout better in dev
-            if (fakehd_layout_debug && sd_character_map[x][y] == 0) {
-                sd_character_map[x][y] = 48 + (x % 10);
+            if (sd_character_map[x][y] == fakehd_menu_switch_char)
+            {
+                DEBUG_PRINT("found fakehd triggger \n");
+                fakehd_trigger_x = x;
+                fakehd_trigger_y = y;
+                break;
             }
+        }
+    }
 
-            // skip if it's not a character
-            if (sd_character_map[x][y] != 0)
-            {
-                // if current element is fly min or throttle icon
-                // record the current position as the 'trigger' position
-                if (fakehd_trigger_x == 99 && sd_character_map[x][y] == fakehd_menu_switch_char)
-                {
-                    DEBUG_PRINT("found fakehd triggger \n");
-                    fakehd_trigger_x = x;
-                    fakehd_trigger_y = y;
-                }
-
-                // if we have seen a trigger (see above) - and it's now gone, switch to centering
-                // this is intented to center the menu + postflight stats, which don't contain
-                // timer/battery symbols
-                if (
-                    fakehd_lock_center ||
-                    (fakehd_trigger_x != 99 &&
-                     sd_character_map[fakehd_trigger_x][fakehd_trigger_y] != fakehd_menu_switch_char))
-                {
-                    render_x = x + 15;
-                    render_y = y + 3;
-                }
-                else
-                {
-                    render_y = col[y];
-                    render_x = row[x];
-                }
-                // 0 out the throttle element if configured to do so
-                // and also the three adjacent positions where the thottle percent will be
-                if (fakehd_trigger_x != 99 &&
-                    fakehd_hide_menu_switch &&
-                    sd_character_map[x][y] == fakehd_menu_switch_char)
-                {
-                    hd_character_map[render_x][render_y] = 0;
-                    (render_x <= 57) && (hd_character_map[render_x + 1][render_y] = 0);
-                    (render_x <= 56) && (hd_character_map[render_x + 2][render_y] = 0);
-                    (render_x <= 55) && (hd_character_map[render_x + 3][render_y] = 0);
-                    (render_x <= 54) && (hd_character_map[render_x + 4][render_y] = 0);
-                    (render_x <= 53) && (hd_character_map[render_x + 5][render_y] = 0);
-                }
-                else
-                {
-                    // otherwise, the normal path
-                    hd_character_map[render_x][render_y] = sd_character_map[x][y];
-                }
+    // if we have seen a trigger (see above) - and it's now gone, switch to centering
+    // this is intented to center the menu + postflight stats, which don't contain
+    // timer/battery symbols
+    int layout = FAKEHD_LAYOUT_CONFIG;
+    if (fakehd_lock_center ||
+        (fakehd_trigger_x != 99 && sd_character_map[fakehd_trigger_x][fakehd_trigger_y] != fakehd_menu_switch_char))
+        layout = FAKEHD_LAYOUT_CENTER;
+
+    if (fakehd_trigger_x == 99 || !fakehd_hide_menu_switch)
+        return fakehd_remap[layout];
+
+    // 0 out the throttle element if configured to do so
+    // and also the five following positions where the throttle percent will be
+    const uint16_t *remap = fakehd_remap[layout];
+    for (int y = 0; y < INPUT_ROWS; y++)
+    {
+        for (int x = 0; x < INPUT_COLS; x++)
+        {
+            uint16_t dest = fakehd_dest[layout][fakehd_cell(x, y)];
+            if (sd_character_map[x][y] != fakehd_menu_switch_char || dest == FAKEHD_NO_CELL)
+                continue;
+            if (remap != fakehd_frame_remap) {
+                memcpy(fakehd_frame_remap, remap, sizeof(fakehd_frame_remap));
+                remap = fakehd_frame_remap;
             }
+            int render_x = dest / FAKEHD_MAP_ROWS;
+            for (int i = 0; i <= 5 && render_x + i < FAKEHD_MAP_COLS; i++)
+                fakehd_frame_remap[dest + i * FAKEHD_MAP_ROWS] = FAKEHD_NO_CELL;
         }
     }
+    return remap;
+}
+
+void fakehd_map_sd_character_map_to_hd(const uint16_t *remap, uint16_t sd_character_map[FAKEHD_MAP_COLS][FAKEHD_MAP_ROWS],
+                                       uint16_t hd_character_map[FAKEHD_MAP_COLS][FAKEHD_MAP_ROWS])
+{
+    for (int x = 0; x < FAKEHD_MAP_COLS; x++)
+        for (int y = 0; y < FAKEHD_MAP_ROWS; y++)
+            hd_character_map[x][y] = fakehd_remap_cell(remap, sd_character_map, x, y);
 }
@@ -1,9 +1,31 @@
 #pragma once
 #include <stdint.h>
 
+/* Character map the remap reads and writes, [x][y] like msp-osd.c */
+#define FAKEHD_MAP_COLS 53
+#define FAKEHD_MAP_ROWS 20
+#define FAKEHD_NO_CELL 0xFFFF
+
 void load_fakehd_config();
 void fakehd_disable();
 void fakehd_enable();
 int fakehd_is_enabled();
 void fakehd_reset();
-void fakehd_map_sd_character_map_to_hd(uint16_t sd_character_map[52][20], uint16_t hd_character_map[52][20]);
\ No newline at end of file
+
+/**
+ * Source cell (x * FAKEHD_MAP_ROWS + y of the SD map) of every HD cell for this frame, FAKEHD_NO_CELL
+ * where the HD cell stays empty. The layouts are precomputed when the config changes, per frame only
+ * the menu switch state selects one. Valid until the next call.
+ */
+const uint16_t *fakehd_prepare_remap(uint16_t sd_character_map[FAKEHD_MAP_COLS][FAKEHD_MAP_ROWS]);
+
+static inline uint16_t fakehd_remap_cell(const uint16_t *remap, uint16_t sd_character_map[FAKEHD_MAP_COLS][FAKEHD_MAP_ROWS],
+                                         int x, int y)
+{
+    uint16_t src = remap[x * FAKEHD_MAP_ROWS + y];
+    return src == FAKEHD_NO_CELL ? 0 : sd_character_map[src / FAKEHD_MAP_ROWS][src % FAKEHD_MAP_ROWS];
+}
+
+/* Gather the whole HD map in one pass */
+void fakehd_map_sd_character_map_to_hd(const uint16_t *remap, uint16_t sd_character_map[FAKEHD_MAP_COLS][FAKEHD_MAP_ROWS],
+                                       uint16_t hd_character_map[FAKEHD_MAP_COLS][FAKEHD_MAP_ROWS]);
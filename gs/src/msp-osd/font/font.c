@@ -5,15 +5,58 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
 // #include <ctype.h>
 
 #include "../libspng/spng.h"
+#include "../lz4/lz4.h"
+#include "../../param_cache.h"
 #include "font.h"
 #include "../util/debug.h"
 
 #define BYTES_PER_PIXEL 4
 #define HD_FONT_WIDTH 24
 
+#define FONT_CACHE_SIZE     8
+#define FONT_BLOB_MAGIC     0x41464456u    // "VDFA"
+#define FONT_BLOB_VERSION   2
+
+/* Decoded atlases shared by every display_info using the same variant, glyph size and rotation */
+typedef struct font_cache_entry_s {
+    char variant[8];
+    uint8_t font_width;
+    uint8_t font_height;
+    uint8_t glyph_width;
+    uint8_t glyph_height;
+    uint16_t rotate;
+    int refs;
+    void *pages[NUM_FONT_PAGES];
+} font_cache_entry_t;
+
+static font_cache_entry_t font_cache[FONT_CACHE_SIZE];
+static pthread_mutex_t font_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Converted atlas of one PNG, stored LZ4 compressed in the cache directory so later starts skip
+ * PNG decoding. Valid while the PNG keeps its size and mtime. Followed by, per page,
+ * a uint32_t compressed size and the LZ4 data.
+ */
+struct font_blob_header_t {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t font_width;
+    uint8_t font_height;
+    uint8_t glyph_width;
+    uint8_t glyph_height;
+    uint16_t rotate;
+    uint32_t pages;
+    uint32_t page_size;
+    uint64_t src_size;
+    int64_t src_mtime;
+} __attribute__((packed));
+
 /* Font helper methods */
 #ifdef PLATFORM_DESKTOP
 #include <SDL2/SDL.h>
@@ -106,6 +149,307 @@ void get_font_path_with_extension(char *font_path_dest, const char *font_path, c
     DEBUG_PRINT("Font path: %s\n", font_path_dest);
 }
 
+static int font_blob_path(char *out, size_t out_size, const char *font_path, const display_info_t *display_info)
+{
+    char dir[256];
+    if (param_cache_dir(dir, sizeof(dir), true) < 0)
+        return -1;
+
+    uint32_t hash = 2166136261u;   // FNV-1a of the PNG path
+    for (const char *p = font_path; *p; p++)
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    snprintf(out, out_size, "%s/font-%08x-%dx%d-%dx%d-r%d.lz4", dir, hash, display_info->font_width,
+             display_info->font_height, display_info_atlas_width(display_info),
+             display_info_atlas_height(display_info), display_info->rotate);
+    return 0;
+}
+
+static uint32_t font_page_size(const display_info_t *display_info)
+{
+    return (uint32_t)display_info_atlas_width(display_info) * display_info_atlas_height(display_info) *
+           NUM_CHARS * BYTES_PER_PIXEL;
+}
+
+static int font_blob_load(const char *font_path, const struct stat *src, display_info_t *display_info)
+{
+    char path[320];
+    if (font_blob_path(path, sizeof(path), font_path, display_info) < 0)
+        return -1;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(struct font_blob_header_t)) {
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    const uint8_t *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return -1;
+
+    const struct font_blob_header_t *hdr = (const void *)map;
+    uint32_t page_size = font_page_size(display_info);
+    if (hdr->magic != FONT_BLOB_MAGIC || hdr->version != FONT_BLOB_VERSION ||
+        hdr->font_width != display_info->font_width || hdr->font_height != display_info->font_height ||
+        hdr->glyph_width != display_info->glyph_width || hdr->glyph_height != display_info->glyph_height ||
+        hdr->rotate != display_info->rotate ||
+        hdr->pages == 0 || hdr->pages > NUM_FONT_PAGES || hdr->page_size != page_size ||
+        hdr->src_size != (uint64_t)src->st_size || hdr->src_mtime != (int64_t)src->st_mtime) {
+        munmap((void *)map, size);
+        return -1;
+    }
+
+    size_t pos = sizeof(*hdr);
+    for (uint32_t page = 0; page < hdr->pages; page++) {
+        uint32_t lz4_size;
+        if (pos + sizeof(lz4_size) > size)
+            goto err;
+        memcpy(&lz4_size, map + pos, sizeof(lz4_size));
+        pos += sizeof(lz4_size);
+        if (lz4_size > size - pos)
+            goto err;
+        display_info->fonts[page] = malloc(page_size);
+        if (!display_info->fonts[page] ||
+            LZ4_decompress_safe((const char *)map + pos, display_info->fonts[page], (int)lz4_size, (int)page_size) != (int)page_size)
+            goto err;
+        pos += lz4_size;
+    }
+    munmap((void *)map, size);
+    DEBUG_PRINT("Font atlas loaded from %s\n", path);
+    return 0;
+
+err:
+    printf("Ignoring invalid font cache %s\n", path);
+    close_font(display_info);
+    munmap((void *)map, size);
+    return -1;
+}
+
+static void font_blob_save(const char *font_path, const struct stat *src, const display_info_t *display_info, int pages)
+{
+    char path[320], tmp[330];
+    if (font_blob_path(path, sizeof(path), font_path, display_info) < 0)
+        return;
+
+    uint32_t page_size = font_page_size(display_info);
+    int bound = LZ4_compressBound((int)page_size);
+    char *buf = malloc((size_t)bound);
+    if (!buf)
+        return;
+
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE *f = fopen(tmp, "wb");
+    if (!f) {
+        free(buf);
+        return;
+    }
+    struct font_blob_header_t hdr = {
+        .magic = FONT_BLOB_MAGIC,
+        .version = FONT_BLOB_VERSION,
+        .font_width = display_info->font_width,
+        .font_height = display_info->font_height,
+        .glyph_width = display_info->glyph_width,
+        .glyph_height = display_info->glyph_height,
+        .rotate = display_info->rotate,
+        .pages = (uint32_t)pages,
+        .page_size = page_size,
+        .src_size = (uint64_t)src->st_size,
+        .src_mtime = (int64_t)src->st_mtime,
+    };
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    for (int page = 0; ok && page < pages; page++) {
+        int n = LZ4_compress_default(display_info->fonts[page], buf, (int)page_size, bound);
+        uint32_t lz4_size = (uint32_t)n;
+        ok = n > 0 && fwrite(&lz4_size, sizeof(lz4_size), 1, f) == 1 && fwrite(buf, (size_t)n, 1, f) == 1;
+    }
+    ok = (fclose(f) == 0) && ok;
+    free(buf);
+    /* rename is atomic, a half written blob is never picked up */
+    if (!ok || rename(tmp, path) < 0) {
+        printf("Can't write font cache %s: %s\n", path, strerror(errno));
+        remove(tmp);
+    }
+}
+
+/*
+ * Glyph resampling for OSD surfaces other than the 1280x720 the fonts are drawn for. Done once per
+ * atlas: separable Mitchell-Netravali filter (B = C = 1/3), sharp on glyph edges without the ringing
+ * of Lanczos, widened when downscaling so it averages instead of skipping pixels. Works on the
+ * premultiplied atlas, so edges blend towards transparent instead of towards black.
+ */
+static float font_filter_weight(float x)
+{
+    x = fabsf(x);
+    if (x < 1.0f)
+        return (7.0f * x * x * x - 12.0f * x * x + 16.0f / 3.0f) / 6.0f;
+    if (x < 2.0f)
+        return (-7.0f / 3.0f * x * x * x + 12.0f * x * x - 20.0f * x + 32.0f / 3.0f) / 6.0f;
+    return 0.0f;
+}
+
+/* Source taps of every output sample along one axis, pixels outside the glyph are transparent */
+struct font_filter_t {
+    int taps;
+    int *first;         // first source index per output sample
+    float *weights;     // taps weights per output sample, normalized
+};
+
+static int font_filter_init(struct font_filter_t *f, int src_len, int dst_len)
+{
+    float scale = (float)dst_len / (float)src_len;
+    float width = scale < 1.0f ? 1.0f / scale : 1.0f;
+    f->taps = (int)ceilf(2.0f * width) * 2 + 1;
+    f->first = malloc(sizeof(int) * (size_t)dst_len);
+    f->weights = malloc(sizeof(float) * (size_t)dst_len * (size_t)f->taps);
+    if (!f->first || !f->weights) {
+        free(f->first);
+        free(f->weights);
+        return -1;
+    }
+
+    for (int i = 0; i < dst_len; i++) {
+        float center = ((float)i + 0.5f) / scale - 0.5f;
+        int first = (int)floorf(center - 2.0f * width) + 1;
+        float *w = f->weights + (size_t)i * f->taps;
+        float sum = 0.0f;
+        for (int t = 0; t < f->taps; t++) {
+            w[t] = font_filter_weight(((float)(first + t) - center) / width);
+            sum += w[t];
+        }
+        for (int t = 0; t < f->taps; t++)
+            w[t] /= sum;
+        f->first[i] = first;
+    }
+    return 0;
+}
+
+static void font_filter_free(struct font_filter_t *f)
+{
+    free(f->first);
+    free(f->weights);
+}
+
+static uint8_t font_clamp(float v, float max)
+{
+    if (v <= 0.0f)
+        return 0;
+    if (v >= max)
+        return (uint8_t)max;
+    return (uint8_t)(v + 0.5f);
+}
+
+/* Scale one glyph sw x sh -> dw x dh, tmp holds dw * sh * 4 floats */
+static void font_scale_glyph(const uint8_t *src, int sw, int sh, uint8_t *dst, int dw, int dh,
+                             const struct font_filter_t *fx, const struct font_filter_t *fy, float *tmp)
+{
+    for (int y = 0; y < sh; y++) {
+        for (int x = 0; x < dw; x++) {
+            const float *w = fx->weights + (size_t)x * fx->taps;
+            float acc[4] = {0};
+            for (int t = 0; t < fx->taps; t++) {
+                int sx = fx->first[x] + t;
+                if (sx < 0 || sx >= sw)
+                    continue;
+                const uint8_t *p = src + ((size_t)y * sw + sx) * BYTES_PER_PIXEL;
+                for (int c = 0; c < 4; c++)
+                    acc[c] += w[t] * p[c];
+            }
+            memcpy(tmp + ((size_t)y * dw + x) * 4, acc, sizeof(acc));
+        }
+    }
+    for (int y = 0; y < dh; y++) {
+        const float *w = fy->weights + (size_t)y * fy->taps;
+        for (int x = 0; x < dw; x++) {
+            float acc[4] = {0};
+            for (int t = 0; t < fy->taps; t++) {
+                int sy = fy->first[y] + t;
+                if (sy < 0 || sy >= sh)
+                    continue;
+                const float *p = tmp + ((size_t)sy * dw + x) * 4;
+                for (int c = 0; c < 4; c++)
+                    acc[c] += w[t] * p[c];
+            }
+            // premultiplied: a color channel can't exceed alpha, the filter lobes could push it over
+            uint8_t *o = dst + ((size_t)y * dw + x) * BYTES_PER_PIXEL;
+            o[3] = font_clamp(acc[3], 255.0f);
+            o[0] = font_clamp(acc[0], o[3]);
+            o[1] = font_clamp(acc[1], o[3]);
+            o[2] = font_clamp(acc[2], o[3]);
+        }
+    }
+}
+
+/* Turn a w x h glyph clockwise into the atlas layout */
+static void font_rotate_glyph(const uint8_t *src, int w, int h, uint8_t *dst, int rotate)
+{
+    const uint32_t *s = (const uint32_t *)src;
+    uint32_t *d = (uint32_t *)dst;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            uint32_t px = s[y * w + x];
+            if (rotate == 90)
+                d[x * h + (h - 1 - y)] = px;
+            else if (rotate == 180)
+                d[(h - 1 - y) * w + (w - 1 - x)] = px;
+            else
+                d[(w - 1 - x) * h + y] = px;
+        }
+    }
+}
+
+/* Replace the font-size pages with glyphs scaled and turned for the OSD surface */
+static int font_transform_pages(display_info_t *display_info, int pages)
+{
+    int sw = display_info->font_width, sh = display_info->font_height;
+    int dw = display_info->glyph_width ? display_info->glyph_width : sw;
+    int dh = display_info->glyph_height ? display_info->glyph_height : sh;
+    bool scale = dw != sw || dh != sh;
+    int rotate = display_info->rotate;
+    if (!scale && rotate == 0)
+        return 0;
+
+    size_t glyph_bytes = (size_t)dw * dh * BYTES_PER_PIXEL;
+    struct font_filter_t fx = {0}, fy = {0};
+    uint8_t *scaled = malloc(glyph_bytes);
+    float *tmp = malloc(sizeof(float) * 4 * (size_t)dw * sh);
+    int ret = -1;
+    if (!scaled || !tmp || (scale && (font_filter_init(&fx, sw, dw) < 0 || font_filter_init(&fy, sh, dh) < 0)))
+        goto out;
+
+    for (int page = 0; page < pages; page++) {
+        uint8_t *out = malloc(glyph_bytes * NUM_CHARS);
+        if (!out)
+            goto out;
+        const uint8_t *in = display_info->fonts[page];
+        for (int c = 0; c < NUM_CHARS; c++) {
+            const uint8_t *glyph = in + (size_t)c * sw * sh * BYTES_PER_PIXEL;
+            uint8_t *dst = out + (size_t)c * glyph_bytes;
+            if (scale) {
+                font_scale_glyph(glyph, sw, sh, rotate ? scaled : dst, dw, dh, &fx, &fy, tmp);
+                glyph = scaled;
+            }
+            if (rotate)
+                font_rotate_glyph(glyph, dw, dh, dst, rotate);
+        }
+        free(display_info->fonts[page]);
+        display_info->fonts[page] = out;
+    }
+    DEBUG_PRINT("Font scaled %dx%d -> %dx%d, rotated %d\n", sw, sh, dw, dh, rotate);
+    ret = 0;
+
+out:
+    if (scale) {
+        font_filter_free(&fx);
+        font_filter_free(&fy);
+    }
+    free(scaled);
+    free(tmp);
+    return ret;
+}
+
 static int open_font(const char *filename, display_info_t *display_info, const char *font_variant)
 {
 #ifdef PLATFORM_ROCKCHIP
@@ -184,6 +528,12 @@ static int open_font(const char *filename, display_info_t *display_info, const c
     }
 #endif
 
+    if (font_blob_load(file_path, &st, display_info) == 0) {
+        spng_ctx_free(ctx);
+        fclose(fd);
+        return 0;
+    }
+
     DEBUG_PRINT("Allocated PNG context\n");
     // Set some kind of reasonable PNG limit so we don't get blown up
     size_t limit = 1024 * 1024 * 64;
@@ -247,24 +597,48 @@ static int open_font(const char *filename, display_info_t *display_info, const c
         }
     }
 
-    for(int page = 0; page < num_pages; page++) {
+    // Convert to the atlas layout the OSD blitter copies from: per page, glyphs one after another,
+    // each glyph a run of contiguous rows, pixels already in framebuffer order (BGRA) with
+    // premultiplied alpha, so drawing a glyph row is a single memcpy.
+    int char_width_bytes = display_info->font_width * BYTES_PER_PIXEL;
+    int char_size_bytes_dest = (display_info->font_width * display_info->font_height * BYTES_PER_PIXEL);
+    int char_size_bytes_src =  (ihdr.width * display_info->font_height * BYTES_PER_PIXEL);
+    for(int page = 0; page < num_pages && page < NUM_FONT_PAGES; page++) {
         DEBUG_PRINT("Loading font page %d of %d, placing %p\n", page, num_pages, display_info->fonts);
-        display_info->fonts[page] = malloc(display_info->font_width * display_info->font_height * NUM_CHARS * BYTES_PER_PIXEL);
-        DEBUG_PRINT("Allocated %d bytes for font page buf at%p\n", display_info->font_width * display_info->font_height * NUM_CHARS * BYTES_PER_PIXEL, display_info->fonts[page]);
+        display_info->fonts[page] = malloc(char_size_bytes_dest * NUM_CHARS);
+        if (!display_info->fonts[page]) {
+            printf("Failed to allocate font page %d\n", page);
+            close_font(display_info);
+            free(font_data);
+            goto err;
+        }
+        DEBUG_PRINT("Allocated %d bytes for font page buf at%p\n", char_size_bytes_dest * NUM_CHARS, display_info->fonts[page]);
         for(int char_num = 0; char_num < NUM_CHARS; char_num++) {
             for(int y = 0; y < display_info->font_height; y++) {
-                // Copy each character line at a time into the correct font buffer
-                int char_width_bytes = display_info->font_width * BYTES_PER_PIXEL;
-                int char_size_bytes_dest = (display_info->font_width * display_info->font_height * BYTES_PER_PIXEL);
-                int char_size_bytes_src =  (ihdr.width * display_info->font_height * BYTES_PER_PIXEL);
-                memcpy((uint8_t *)display_info->fonts[page] + (char_num * char_size_bytes_dest) + (y * char_width_bytes), (uint8_t *)font_data + (char_num * char_size_bytes_src) + (ihdr.width * y * BYTES_PER_PIXEL) + (page * char_width_bytes), char_width_bytes);
+                const uint8_t *src = (uint8_t *)font_data + (char_num * char_size_bytes_src) + (ihdr.width * y * BYTES_PER_PIXEL) + (page * char_width_bytes);
+                uint8_t *dst = (uint8_t *)display_info->fonts[page] + (char_num * char_size_bytes_dest) + (y * char_width_bytes);
+                for (int x = 0; x < display_info->font_width; x++, src += 4, dst += 4) {
+                    uint8_t a = src[3];
+                    dst[0] = (uint8_t)((src[2] * a + 127) / 255); // B
+                    dst[1] = (uint8_t)((src[1] * a + 127) / 255); // G
+                    dst[2] = (uint8_t)((src[0] * a + 127) / 255); // R
+                    dst[3] = a;
+                }
             }
         }
     }
 
     free(font_data);
+    if (num_pages > NUM_FONT_PAGES)
+        num_pages = NUM_FONT_PAGES;
+    if (font_transform_pages(display_info, num_pages) < 0) {
+        printf("Failed to scale font to %dx%d\n", display_info->glyph_width, display_info->glyph_height);
+        close_font(display_info);
+        goto err;
+    }
     spng_ctx_free(ctx);
     fclose(fd);
+    font_blob_save(file_path, &st, display_info, num_pages);
     return 0;
     err:
         spng_ctx_free(ctx);
@@ -272,6 +646,69 @@ static int open_font(const char *filename, display_info_t *display_info, const c
         return -1;
 }
 
+/* Share an already decoded atlas of this variant and glyph size, returns 0 on a hit */
+static int font_cache_acquire(display_info_t *display_info, const char *variant)
+{
+    int ret = -1;
+    pthread_mutex_lock(&font_cache_lock);
+    for (int i = 0; i < FONT_CACHE_SIZE; i++) {
+        font_cache_entry_t *e = &font_cache[i];
+        if (e->refs > 0 && e->font_width == display_info->font_width &&
+            e->font_height == display_info->font_height && e->glyph_width == display_info->glyph_width &&
+            e->glyph_height == display_info->glyph_height && e->rotate == display_info->rotate &&
+            strcmp(e->variant, variant) == 0) {
+            memcpy(display_info->fonts, e->pages, sizeof(e->pages));
+            e->refs++;
+            ret = 0;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&font_cache_lock);
+    return ret;
+}
+
+static void font_cache_insert(const display_info_t *display_info, const char *variant)
+{
+    pthread_mutex_lock(&font_cache_lock);
+    for (int i = 0; i < FONT_CACHE_SIZE; i++) {
+        font_cache_entry_t *e = &font_cache[i];
+        if (e->refs == 0) {
+            snprintf(e->variant, sizeof(e->variant), "%s", variant);
+            e->font_width = display_info->font_width;
+            e->font_height = display_info->font_height;
+            e->glyph_width = display_info->glyph_width;
+            e->glyph_height = display_info->glyph_height;
+            e->rotate = display_info->rotate;
+            memcpy(e->pages, display_info->fonts, sizeof(e->pages));
+            e->refs = 1;
+            break;
+        }
+    }
+    // cache full: the font stays private to this display_info and close_font frees it
+    pthread_mutex_unlock(&font_cache_lock);
+}
+
+/* Drop a reference, the atlas is freed with the last one. Returns -1 if the font is not cached */
+static int font_cache_release(display_info_t *display_info)
+{
+    int ret = -1;
+    pthread_mutex_lock(&font_cache_lock);
+    for (int i = 0; i < FONT_CACHE_SIZE; i++) {
+        font_cache_entry_t *e = &font_cache[i];
+        if (e->refs > 0 && e->pages[0] == display_info->fonts[0]) {
+            if (--e->refs == 0) {
+                for (int page = 0; page < NUM_FONT_PAGES; page++)
+                    free(e->pages[page]);
+                memset(e, 0, sizeof(*e));
+            }
+            ret = 0;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&font_cache_lock);
+    return ret;
+}
+
 void load_font(display_info_t *display_info, const char *font_variant) {
 
     // Note: load_font will not replace an existing font.
@@ -296,6 +733,12 @@ void load_font(display_info_t *display_info, const char *font_variant) {
 
         DEBUG_PRINT("Loading font %s\n", font_variant_lower);
 
+        if (font_cache_acquire(display_info, font_variant_lower) == 0)
+        {
+            DEBUG_PRINT("Font %s %dx%d shared from cache\n", font_variant_lower, display_info->font_width, display_info->font_height);
+            return;
+        }
+
         char *fallback_font_variant = "";
         if (strcmp(font_variant_lower, "btfl") == 0)
         {
@@ -349,10 +792,19 @@ void load_font(display_info_t *display_info, const char *font_variant) {
                 loaded_font = open_font(ENTWARE_FONT_PATH, display_info, "");
             }
         }
+
+        if (display_info->fonts[0] != NULL)
+        {
+            font_cache_insert(display_info, font_variant_lower);
+        }
     }
 }
 
 void close_font(display_info_t *display_info) {
+    if (display_info->fonts[0] != NULL && font_cache_release(display_info) == 0) {
+        memset(display_info->fonts, 0, sizeof(display_info->fonts));
+        return;
+    }
     for(int i = 0; i < NUM_FONT_PAGES; i++) {
         if(display_info->fonts[i] != NULL) {
             free(display_info->fonts[i]);
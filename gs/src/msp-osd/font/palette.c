@@ -0,0 +1,253 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "palette.h"
+
+#define PALETTE_HASH_MIN_BITS 12
+
+/* Distinct colours with their pixel count (build) or palette index (mapping), open addressing */
+struct colour_entry_t {
+    uint32_t colour;
+    uint32_t value;
+};
+
+struct colour_table_t {
+    struct colour_entry_t *entries;
+    uint32_t mask;
+    uint32_t used;
+};
+
+static uint32_t colour_hash(uint32_t c)
+{
+    c ^= c >> 16;
+    c *= 0x7feb352du;
+    c ^= c >> 15;
+    c *= 0x846ca68bu;
+    return c ^ (c >> 16);
+}
+
+static int colour_table_init(struct colour_table_t *t, int bits)
+{
+    t->mask = (1u << bits) - 1;
+    t->used = 0;
+    t->entries = calloc((size_t)t->mask + 1, sizeof(*t->entries));
+    return t->entries ? 0 : -1;
+}
+
+/* Slot of colour, value 0 when newly added. Colour 0 (transparent) is never stored */
+static struct colour_entry_t *colour_table_get(struct colour_table_t *t, uint32_t colour)
+{
+    if ((t->used + 1) * 2 > t->mask + 1) {
+        struct colour_table_t grown;
+        if (colour_table_init(&grown, __builtin_ctz(t->mask + 1) + 1) < 0)
+            return NULL;
+        for (uint32_t i = 0; i <= t->mask; i++) {
+            if (!t->entries[i].colour)
+                continue;
+            uint32_t j = colour_hash(t->entries[i].colour) & grown.mask;
+            while (grown.entries[j].colour)
+                j = (j + 1) & grown.mask;
+            grown.entries[j] = t->entries[i];
+        }
+        grown.used = t->used;
+        free(t->entries);
+        *t = grown;
+    }
+
+    uint32_t i = colour_hash(colour) & t->mask;
+    while (t->entries[i].colour && t->entries[i].colour != colour)
+        i = (i + 1) & t->mask;
+    if (!t->entries[i].colour) {
+        t->entries[i].colour = colour;
+        t->used++;
+    }
+    return &t->entries[i];
+}
+
+static int channel(uint32_t c, int ch)
+{
+    return (int)(c >> (ch * 8)) & 0xFF;
+}
+
+#define COLOUR_CMP(ch) \
+    static int colour_cmp_##ch(const void *a, const void *b) \
+    { \
+        return channel(((const struct colour_entry_t *)a)->colour, ch) - \
+               channel(((const struct colour_entry_t *)b)->colour, ch); \
+    }
+COLOUR_CMP(0)
+COLOUR_CMP(1)
+COLOUR_CMP(2)
+COLOUR_CMP(3)
+
+static int (*const colour_cmp[4])(const void *, const void *) = {
+    colour_cmp_0, colour_cmp_1, colour_cmp_2, colour_cmp_3
+};
+
+/* Box of the colour space: a range of the colour list, split on the channel with the widest spread */
+struct palette_box_t {
+    uint32_t begin, end;
+    uint64_t weight;
+    int split_channel;
+    float score;            // spread * sqrt(weight), 0: can't be split
+};
+
+static void palette_box_measure(struct palette_box_t *box, const struct colour_entry_t *colours)
+{
+    int lo[4] = {255, 255, 255, 255}, hi[4] = {0, 0, 0, 0};
+    box->weight = 0;
+    for (uint32_t i = box->begin; i < box->end; i++) {
+        for (int ch = 0; ch < 4; ch++) {
+            int v = channel(colours[i].colour, ch);
+            if (v < lo[ch]) lo[ch] = v;
+            if (v > hi[ch]) hi[ch] = v;
+        }
+        box->weight += colours[i].value;
+    }
+    box->split_channel = 0;
+    for (int ch = 1; ch < 4; ch++) {
+        if (hi[ch] - lo[ch] > hi[box->split_channel] - lo[box->split_channel])
+            box->split_channel = ch;
+    }
+    int spread = hi[box->split_channel] - lo[box->split_channel];
+    box->score = (box->end - box->begin > 1 && spread > 0) ? spread * sqrtf((float)box->weight) : 0.0f;
+}
+
+/* Weighted mean, premultiplied colour never brighter than its alpha */
+static uint32_t palette_box_colour(const struct palette_box_t *box, const struct colour_entry_t *colours)
+{
+    uint64_t sum[4] = {0, 0, 0, 0};
+    for (uint32_t i = box->begin; i < box->end; i++) {
+        for (int ch = 0; ch < 4; ch++)
+            sum[ch] += (uint64_t)channel(colours[i].colour, ch) * colours[i].value;
+    }
+    uint32_t v[4];
+    for (int ch = 0; ch < 4; ch++)
+        v[ch] = (uint32_t)((sum[ch] + box->weight / 2) / box->weight);
+    for (int ch = 0; ch < 3; ch++)
+        v[ch] = v[ch] > v[3] ? v[3] : v[ch];
+    return v[0] | v[1] << 8 | v[2] << 16 | v[3] << 24;
+}
+
+int palette_build(const uint32_t *const *pages, const size_t *pixels, int count, uint32_t palette[PALETTE_SIZE])
+{
+    struct colour_table_t table;
+    if (colour_table_init(&table, PALETTE_HASH_MIN_BITS) < 0)
+        return -1;
+    for (int p = 0; p < count; p++) {
+        for (size_t i = 0; i < pixels[p]; i++) {
+            if (!pages[p][i])
+                continue;
+            struct colour_entry_t *e = colour_table_get(&table, pages[p][i]);
+            if (!e) {
+                free(table.entries);
+                return -1;
+            }
+            e->value++;
+        }
+    }
+
+    /* compact the table into the colour list the boxes partition */
+    struct colour_entry_t *colours = table.entries;
+    uint32_t n = 0;
+    for (uint32_t i = 0; i <= table.mask; i++) {
+        if (colours[i].colour)
+            colours[n++] = colours[i];
+    }
+
+    memset(palette, 0, PALETTE_SIZE * sizeof(palette[0]));
+    if (n == 0) {
+        free(colours);
+        return 1;
+    }
+
+    struct palette_box_t boxes[PALETTE_SIZE - 1];
+    int boxes_used = 1;
+    boxes[0] = (struct palette_box_t){ .begin = 0, .end = n };
+    palette_box_measure(&boxes[0], colours);
+
+    while (boxes_used < PALETTE_SIZE - 1) {
+        int best = -1;
+        for (int b = 0; b < boxes_used; b++) {
+            if (boxes[b].score > 0.0f && (best < 0 || boxes[b].score > boxes[best].score))
+                best = b;
+        }
+        if (best < 0)
+            break;
+
+        /* split at the weighted median of the widest channel */
+        struct palette_box_t *box = &boxes[best];
+        qsort(colours + box->begin, box->end - box->begin, sizeof(*colours), colour_cmp[box->split_channel]);
+        uint64_t half = box->weight / 2, acc = 0;
+        uint32_t mid = box->begin;
+        while (mid < box->end - 1 && acc + colours[mid].value <= half)
+            acc += colours[mid++].value;
+        if (mid == box->begin)
+            mid++;
+
+        boxes[boxes_used] = (struct palette_box_t){ .begin = mid, .end = box->end };
+        box->end = mid;
+        palette_box_measure(box, colours);
+        palette_box_measure(&boxes[boxes_used], colours);
+        boxes_used++;
+    }
+
+    for (int b = 0; b < boxes_used; b++)
+        palette[b + 1] = palette_box_colour(&boxes[b], colours);
+    free(colours);
+    return boxes_used + 1;
+}
+
+static uint8_t palette_nearest(uint32_t colour, const uint32_t palette[PALETTE_SIZE])
+{
+    int best = PALETTE_TRANSPARENT;
+    int best_dist = 4 * 255 * 255 + 1;
+    for (int i = 0; i < PALETTE_SIZE; i++) {
+        if (i != PALETTE_TRANSPARENT && palette[i] == 0)
+            continue;
+        int dist = 0;
+        for (int ch = 0; ch < 4; ch++) {
+            int d = channel(colour, ch) - channel(palette[i], ch);
+            dist += d * d;
+        }
+        if (dist < best_dist) {
+            best_dist = dist;
+            best = i;
+        }
+    }
+    return (uint8_t)best;
+}
+
+uint8_t *palette_index_page(const uint32_t *page, size_t pixels, const uint32_t palette[PALETTE_SIZE])
+{
+    uint8_t *indices = malloc(pixels);
+    struct colour_table_t table;
+    if (!indices || colour_table_init(&table, PALETTE_HASH_MIN_BITS) < 0) {
+        free(indices);
+        return NULL;
+    }
+
+    /* value: palette index + 1 once the nearest entry is known */
+    for (size_t i = 0; i < pixels; i++) {
+        if (!page[i]) {
+            indices[i] = PALETTE_TRANSPARENT;
+            continue;
+        }
+        struct colour_entry_t *e = colour_table_get(&table, page[i]);
+        if (!e) {
+            free(table.entries);
+            free(indices);
+            return NULL;
+        }
+        if (!e->value)
+            e->value = palette_nearest(page[i], palette) + 1u;
+        indices[i] = (uint8_t)(e->value - 1);
+    }
+    free(table.entries);
+    return indices;
+}
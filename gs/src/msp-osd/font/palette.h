@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define PALETTE_SIZE 256
+#define PALETTE_TRANSPARENT 0      // index of the fully transparent entry, always 0x00000000
+
+/**
+ * Quantize the colours of glyph atlas pages (BGRA premultiplied, see font.c) to a palette for the
+ * 8-bit indexed OSD surface. Median cut over the four channels weighted by pixel count, one entry
+ * per colour when the pages use fewer than 256. Entry 0 is transparent.
+ * Returns the number of entries used (unused ones are 0), -1 on error.
+ */
+int palette_build(const uint32_t *const *pages, const size_t *pixels, int count, uint32_t palette[PALETTE_SIZE]);
+
+/**
+ * Atlas page as palette indices, each pixel mapped to the nearest entry. 1 byte per pixel, free() it.
+ * NULL on error.
+ */
+uint8_t *palette_index_page(const uint32_t *page, size_t pixels, const uint32_t palette[PALETTE_SIZE]);
@@ -1,19 +1,18 @@
-#include "msp.h"
+#include <string.h>
 #include "msp_displayport.h"
 
-static void process_draw_string(displayport_vtable_t *display_driver, uint8_t *payload) {
+static void process_draw_string(displayport_vtable_t *display_driver, const uint8_t *payload, uint16_t size) {
     if(!display_driver || !display_driver->draw_character) return;
+    if(size < 3) return;
     uint8_t row = payload[0];
     uint8_t col = payload[1];
     uint8_t attrs = payload[2]; // INAV and Betaflight use this to specify a higher page number. 
-    uint8_t str_len;
-    for(str_len = 1; str_len < 255; str_len++) {
-        if(payload[2 + str_len] == '\0') {
-            break;
-        }
-    }
-    for(uint8_t idx = 0; idx < (str_len - 1); idx++) {
-        uint16_t character = payload[3 + idx];
+    // the string runs to the end of the payload, or up to a NUL
+    const uint8_t *str = &payload[3];
+    const uint8_t *end = memchr(str, '\0', size - 3);
+    uint16_t str_len = end ? (uint16_t)(end - str) : (uint16_t)(size - 3);
+    for(uint16_t idx = 0; idx < str_len; idx++) {
+        uint16_t character = str[idx];
         if(attrs & 0x3) {
             // shift over by the page number if they were specified
             character |= ((attrs & 0x3) * 0x100);
@@ -33,8 +32,9 @@ static void process_draw_complete(displayport_vtable_t *display_driver) {
     display_driver->draw_complete();
 }
 
-static void process_set_options(displayport_vtable_t *display_driver, uint8_t *payload) {
+static void process_set_options(displayport_vtable_t *display_driver, const uint8_t *payload, uint16_t size) {
     if(!display_driver || !display_driver->set_options) return;
+    if(size < 2) return;
     uint8_t font = payload[0];
     msp_hd_options_e is_hd = payload[1];
     display_driver->set_options(font, is_hd);
@@ -48,12 +48,10 @@ static void process_close(displayport_vtable_t *display_driver) {
     process_clear_screen(display_driver);
 }
 
-int displayport_process_message(displayport_vtable_t *display_driver, msp_msg_t *msg) {
-    if (msg->direction != MSP_INBOUND) {
-        return 1;
-    }
-    if (msg->cmd != MSP_CMD_DISPLAYPORT) {
-        return 1;
+void displayport_handle_message(void *user, const msp_view_t *msg) {
+    displayport_vtable_t *display_driver = user;
+    if (msg->type != MSP_PACKET_RESPONSE || msg->cmd != MSP_DISPLAYPORT || msg->size < 1) {
+        return;
     }
     msp_displayport_cmd_e sub_cmd = msg->payload[0];
     switch(sub_cmd) {
@@ -67,17 +65,15 @@ int displayport_process_message(displayport_vtable_t *display_driver, msp_msg_t
             process_clear_screen(display_driver);
             break;
         case MSP_DISPLAYPORT_DRAW_STRING: // 3 -> Draw String
-            process_draw_string(display_driver, &msg->payload[1]);
+            process_draw_string(display_driver, &msg->payload[1], msg->size - 1);
             break;
         case MSP_DISPLAYPORT_DRAW_SCREEN: // 4 -> Draw Screen
             process_draw_complete(display_driver);
             break;
         case MSP_DISPLAYPORT_SET_OPTIONS: // 5 -> Set Options (HDZero/iNav)
-            process_set_options(display_driver, &msg->payload[1]);
+            process_set_options(display_driver, &msg->payload[1], msg->size - 1);
             break;
         default:
             break;
     }
-    return 0;
 }
-
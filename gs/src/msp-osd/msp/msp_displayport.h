@@ -1,16 +1,6 @@
 #pragma once
 #include <stdint.h>
-#include "msp.h"
-
-typedef enum {
-    MSP_DISPLAYPORT_KEEPALIVE,
-    MSP_DISPLAYPORT_CLOSE,
-    MSP_DISPLAYPORT_CLEAR,
-    MSP_DISPLAYPORT_DRAW_STRING,
-    MSP_DISPLAYPORT_DRAW_SCREEN,
-    MSP_DISPLAYPORT_SET_OPTIONS,
-    MSP_DISPLAYPORT_DRAW_SYSTEM
-} msp_displayport_cmd_e;
+#include "msp_dispatch.h"
 
 typedef enum {
     MSP_SD_OPTION_30_16,
@@ -31,4 +21,5 @@ typedef struct displayport_vtable_s {
     set_options_func set_options;
 } displayport_vtable_t;
 
-int displayport_process_message(displayport_vtable_t *display_driver, msp_msg_t *msg);
\ No newline at end of file
+/* msp_handler_t for MSP_DISPLAYPORT, user is the displayport_vtable_t. Reads the payload in place */
+void displayport_handle_message(void *display_driver, const msp_view_t *msg);
\ No newline at end of file
@@ -1,14 +1,22 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
-#include "../json/osd_config.h"
+#include "osd_delta.h"
 
 #include "rec.h"
-#include "rec_shim.h"
-#include "rec_util.h"
 
-#define REC_CONFIG_ENABLED_KEY "rec_enabled"
+#define REC_QUEUE_SLOTS 64              // ~1 s of frames at the OSD render rate
+#define REC_MAP_BYTES (4u << 20)        // file preallocated and mapped in windows of this size
+#define REC_SYNC_US 1000000
+#define REC_IDLE_US 5000
 
 #ifdef DEBUG
 #define DEBUG_PRINT(fmt, args...) fprintf(stderr, "msp_osd.rec: " fmt "\n", ##args)
@@ -16,116 +24,330 @@
 #define DEBUG_PRINT(fmt, args...)
 #endif
 
-static bool rec_is_ready();
-static uint32_t rec_get_frame_idx();
+struct rec_slot_t
+{
+    uint64_t timestamp_us;
+    uint16_t map[OSD_DELTA_CELLS];
+};
+
+/*
+ * Single producer (render thread), single consumer (writer thread) queue of maps. The writer owns the
+ * file: it encodes straight into a shared mapping of it, extended with posix_fallocate a window at a
+ * time so a full disk fails the allocation instead of faulting a store. After a crash the file ends in
+ * the zeros of the preallocation, readers stop at a frame of size 0.
+ */
+static struct rec_slot_t rec_slots[REC_QUEUE_SLOTS];
+static atomic_uint rec_head;            // next slot to write, owned by the writer thread
+static atomic_uint rec_tail;            // next slot to fill, owned by the render thread
+static atomic_uint rec_dropped;
+static atomic_bool rec_stop_requested;
+static atomic_bool rec_recording;
+
+static pthread_t rec_thread;
+static char rec_path[256];
+static int rec_fd = -1;
+static uint8_t *rec_map = NULL;         // window of the file at rec_map_off
+static uint64_t rec_map_off = 0;
+static uint64_t rec_file_size = 0;      // allocated
+static uint64_t rec_pos = 0;            // written
 
-static bool rec_enabled = false;
-gs_lv_transcode_t *rec_lv_transcode = NULL;
-static FILE *rec_fd = NULL;
-static bool rec_recording = false;
+/* Writer thread */
+static uint16_t rec_prev_map[OSD_DELTA_CELLS];
+static uint32_t rec_frame_idx = 0;
+static uint64_t rec_keyframe_us = 0;
+static rec_index_entry_t *rec_index = NULL;    // keyframes written so far, appended on stop
+static uint32_t rec_index_count = 0;
+static uint32_t rec_index_capacity = 0;
 
-void rec_start(rec_config_t *config)
+static pthread_mutex_t rec_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static rec_stats_t rec_stats;
+
+static uint64_t rec_time_us(clockid_t clock)
 {
-    if (!rec_is_ready())
-        return;
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/* Make len bytes at rec_pos writable through rec_map */
+static uint8_t *rec_reserve(size_t len)
+{
+    if (rec_map && rec_pos + len <= rec_map_off + REC_MAP_BYTES)
+        return rec_map + (rec_pos - rec_map_off);
 
-    if (rec_fd != NULL)
+    if (rec_map)
     {
-        fflush(rec_fd);
-        fclose(rec_fd);
+        munmap(rec_map, REC_MAP_BYTES);
+        rec_map = NULL;
     }
-
-    char rec_file_name[256];
-    rec_util_osd_path_from_video_path(
-        rec_lv_transcode->file_name,
-        rec_file_name,
-        sizeof(rec_file_name));
-    DEBUG_PRINT("rec_file_name: %s", rec_file_name);
-
-    DEBUG_PRINT("Config:\n");
-    DEBUG_PRINT("  Char Width: %u\n", config->char_width);
-    DEBUG_PRINT("  Char Height: %u\n", config->char_height);
-    DEBUG_PRINT("  Font Width: %u\n", config->font_width);
-    DEBUG_PRINT("  Font Height: %u\n", config->font_height);
-    DEBUG_PRINT("  X Offset: %u\n", config->x_offset);
-    DEBUG_PRINT("  Y Offset: %u\n", config->y_offset);
-    DEBUG_PRINT("  Font Variant: %.5s\n", config->font_variant);
-
-    rec_fd = fopen(rec_file_name, "wb");
-    if (rec_fd == NULL)
+    uint64_t off = rec_pos & ~(uint64_t)(sysconf(_SC_PAGESIZE) - 1);
+    uint64_t end = off + REC_MAP_BYTES;
+    if (end > rec_file_size)
     {
-        DEBUG_PRINT("Failed to open file: %s", rec_file_name);
-        return;
+        int err = posix_fallocate(rec_fd, (off_t)rec_file_size, (off_t)(end - rec_file_size));
+        if (err != 0)
+        {
+            errno = err;
+            return NULL;
+        }
+        rec_file_size = end;
     }
+    void *map = mmap(NULL, REC_MAP_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, rec_fd, (off_t)off);
+    if (map == MAP_FAILED)
+        return NULL;
+    rec_map = map;
+    rec_map_off = off;
+    return rec_map + (rec_pos - rec_map_off);
+}
 
-    rec_file_header_t file_header = {
-        .magic = REC_MAGIC,
-        .version = REC_VERSION,
-    };
-    memcpy(&file_header.config, config, sizeof(rec_config_t));
-    fwrite(&file_header, sizeof(rec_file_header_t), 1, rec_fd);
-
-    rec_recording = true;
+static bool rec_append(const void *data, size_t len)
+{
+    uint8_t *dst = rec_reserve(len);
+    if (!dst)
+        return false;
+    memcpy(dst, data, len);
+    rec_pos += len;
+    return true;
 }
 
-void rec_stop()
+/* A keyframe missing from the index only makes seeks to it start at the one before */
+static void rec_index_add(uint32_t frame_idx, uint64_t timestamp_us, uint64_t offset)
 {
-    if (rec_fd != NULL)
+    if (rec_index_count == rec_index_capacity)
     {
-        fflush(rec_fd);
-        fclose(rec_fd);
-        rec_fd = NULL;
+        uint32_t capacity = rec_index_capacity ? rec_index_capacity * 2 : 1024;
+        rec_index_entry_t *index = realloc(rec_index, capacity * sizeof(*index));
+        if (!index)
+            return;
+        rec_index = index;
+        rec_index_capacity = capacity;
     }
+    rec_index_entry_t *e = &rec_index[rec_index_count++];
+    e->frame_idx = frame_idx;
+    e->timestamp_us = timestamp_us;
+    e->offset = offset;
+}
 
-    rec_recording = false;
+static bool rec_write_index()
+{
+    rec_index_footer_t footer = {
+        .index_offset = rec_pos,
+        .count = rec_index_count,
+    };
+    memcpy(footer.magic, REC_INDEX_MAGIC, sizeof(footer.magic));
+    for (uint32_t i = 0; i < rec_index_count; i++)
+    {
+        if (!rec_append(&rec_index[i], sizeof(rec_index[i])))
+            return false;
+    }
+    return rec_append(&footer, sizeof(footer));
 }
 
-void rec_write_frame(uint16_t *frame_data, size_t frame_size)
+/* Frame header and osd_delta packet, encoded in place */
+static bool rec_write_slot(const struct rec_slot_t *slot, rec_stats_t *stats)
 {
-    if (rec_fd == NULL)
-        return;
+    uint8_t *dst = rec_reserve(sizeof(rec_frame_header_v3_t) + OSD_DELTA_MAX_PACKET);
+    if (!dst)
+        return false;
 
-    rec_frame_header_t frame_header = {
-        .frame_idx = rec_get_frame_idx(),
-        .size = frame_size,
+    // timestamps going back: a restarted sender, the previous map is no base
+    bool keyframe = rec_frame_idx == 0 || slot->timestamp_us < rec_keyframe_us ||
+                    slot->timestamp_us - rec_keyframe_us >= REC_KEYFRAME_US;
+    struct osd_delta_info_t info = {
+        .type = keyframe ? OSD_DELTA_KEYFRAME : OSD_DELTA_DELTA,
+        .seq = (uint16_t)rec_frame_idx,
+        .base_seq = (uint16_t)(rec_frame_idx - 1),
+        .options = OSD_DELTA_OPTIONS_UNKNOWN,
+    };
+    size_t len = osd_delta_encode(slot->map, keyframe ? NULL : rec_prev_map, &info,
+                                  dst + sizeof(rec_frame_header_v3_t));
+    rec_frame_header_v3_t hdr = {
+        .frame_idx = rec_frame_idx,
+        .size = (uint32_t)len,
+        .timestamp_us = slot->timestamp_us,
     };
+    memcpy(dst, &hdr, sizeof(hdr));
+    if (keyframe)
+    {
+        rec_index_add(rec_frame_idx, slot->timestamp_us, rec_pos);
+        rec_keyframe_us = slot->timestamp_us;
+        stats->keyframes++;
+    }
+    rec_pos += sizeof(hdr) + len;
 
-    fwrite(&frame_header, sizeof(frame_header), 1, rec_fd);
-    fwrite(frame_data, sizeof(uint16_t), frame_size, rec_fd);
+    memcpy(rec_prev_map, slot->map, sizeof(rec_prev_map));
+    rec_frame_idx++;
+    stats->frames++;
+    stats->bytes += sizeof(hdr) + len;
+    return true;
 }
 
-void rec_load_config()
+static void *rec_writer_thread(void *arg)
 {
-    rec_enabled = get_boolean_config_value(REC_CONFIG_ENABLED_KEY);
+    (void)arg;
+    rec_stats_t stats = {0};
+    uint64_t last_sync_us = rec_time_us(CLOCK_MONOTONIC);
+
+    while (1)
+    {
+        unsigned head = atomic_load_explicit(&rec_head, memory_order_relaxed);
+        unsigned tail = atomic_load_explicit(&rec_tail, memory_order_acquire);
+
+        for (; head != tail; head++)
+        {
+            if (!rec_write_slot(&rec_slots[head % REC_QUEUE_SLOTS], &stats))
+            {
+                printf("[ OSD REC ] Write to %s failed: %s\n", rec_path, strerror(errno));
+                atomic_fetch_add(&rec_dropped, tail - head);
+                atomic_store_explicit(&rec_head, tail, memory_order_release);
+                atomic_store(&rec_recording, false);
+                return NULL;
+            }
+        }
+        atomic_store_explicit(&rec_head, head, memory_order_release);
+
+        pthread_mutex_lock(&rec_stats_lock);
+        rec_stats.frames = stats.frames;
+        rec_stats.keyframes = stats.keyframes;
+        rec_stats.bytes = stats.bytes;
+        pthread_mutex_unlock(&rec_stats_lock);
 
-    DEBUG_PRINT("rec_enabled: %d", rec_enabled);
+        uint64_t now_us = rec_time_us(CLOCK_MONOTONIC);
+        if (now_us - last_sync_us >= REC_SYNC_US)
+        {
+            // on Linux this also writes back the pages dirtied through the mapping
+            fdatasync(rec_fd);
+            last_sync_us = now_us;
+        }
+
+        if (head == atomic_load_explicit(&rec_tail, memory_order_acquire))
+        {
+            if (atomic_load(&rec_stop_requested))
+                break;
+            usleep(REC_IDLE_US);
+        }
+    }
+    return NULL;
 }
 
-bool rec_is_enabled()
+int rec_start(const char *path, const rec_config_t *config)
 {
-    return rec_enabled;
+    // also after the writer stopped on a failed write: its file, mapping and thread are still open
+    if (rec_fd >= 0)
+        rec_stop();
+
+    snprintf(rec_path, sizeof(rec_path), "%s", path);
+    rec_fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (rec_fd < 0)
+    {
+        printf("[ OSD REC ] Can't open %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    rec_map = NULL;
+    rec_map_off = 0;
+    rec_file_size = 0;
+    rec_pos = 0;
+    rec_frame_idx = 0;
+    rec_keyframe_us = 0;
+    rec_index_count = 0;
+    atomic_store(&rec_head, 0);
+    atomic_store(&rec_tail, 0);
+    atomic_store(&rec_dropped, 0);
+    atomic_store(&rec_stop_requested, false);
+    memset(&rec_stats, 0, sizeof(rec_stats));
+
+    rec_file_header_t file_header = {
+        .magic = REC_MAGIC,
+        .version = REC_VERSION,
+    };
+    memcpy(&file_header.config, config, sizeof(rec_config_t));
+    rec_timebase_t timebase = {
+        .realtime_us = rec_time_us(CLOCK_REALTIME),
+        .monotonic_us = rec_time_us(CLOCK_MONOTONIC),
+    };
+    if (!rec_append(&file_header, sizeof(file_header)) || !rec_append(&timebase, sizeof(timebase)))
+    {
+        printf("[ OSD REC ] Can't write %s: %s\n", path, strerror(errno));
+        goto fail;
+    }
+
+    if (pthread_create(&rec_thread, NULL, rec_writer_thread, NULL) != 0)
+    {
+        printf("[ OSD REC ] Failed to create writer thread\n");
+        goto fail;
+    }
+    atomic_store(&rec_recording, true);
+    printf("[ OSD REC ] Recording OSD to %s\n", path);
+    return 0;
+
+fail:
+    if (rec_map)
+        munmap(rec_map, REC_MAP_BYTES);
+    rec_map = NULL;
+    close(rec_fd);
+    rec_fd = -1;
+    unlink(path);
+    return -1;
 }
 
-bool rec_is_osd_recording()
+void rec_stop()
 {
-    return rec_recording;
+    if (rec_fd < 0)
+        return;
+
+    atomic_store(&rec_recording, false);
+    atomic_store(&rec_stop_requested, true);
+    pthread_join(rec_thread, NULL);
+
+    if (!rec_write_index())
+        printf("[ OSD REC ] Can't write the index of %s: %s\n", rec_path, strerror(errno));
+    free(rec_index);
+    rec_index = NULL;
+    rec_index_capacity = 0;
+
+    if (rec_map)
+        munmap(rec_map, REC_MAP_BYTES);
+    rec_map = NULL;
+    if (ftruncate(rec_fd, (off_t)rec_pos) != 0)
+        printf("[ OSD REC ] Can't trim %s: %s\n", rec_path, strerror(errno));
+    fdatasync(rec_fd);
+    close(rec_fd);
+    rec_fd = -1;
+
+    rec_stats_t stats;
+    rec_get_stats(&stats);
+    printf("[ OSD REC ] %s closed: %u frames (%u keyframes), %llu bytes, %u dropped\n", rec_path,
+           stats.frames, stats.keyframes, (unsigned long long)stats.bytes, stats.dropped);
 }
 
-bool rec_is_gls_recording()
+void rec_write_frame(const uint16_t *frame_data, size_t frame_size, uint64_t timestamp_us)
 {
-    if (rec_is_ready() == false)
-        return false;
+    if (!atomic_load_explicit(&rec_recording, memory_order_relaxed) || frame_size != OSD_DELTA_CELLS)
+        return;
+
+    unsigned tail = atomic_load_explicit(&rec_tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&rec_head, memory_order_acquire);
+    if (tail - head >= REC_QUEUE_SLOTS)
+    {
+        atomic_fetch_add_explicit(&rec_dropped, 1, memory_order_relaxed);
+        return;
+    }
 
-    return rec_lv_transcode->cur_state == RECORD_STATE_RECORDING;
+    struct rec_slot_t *slot = &rec_slots[tail % REC_QUEUE_SLOTS];
+    slot->timestamp_us = timestamp_us;
+    memcpy(slot->map, frame_data, sizeof(slot->map));
+    atomic_store_explicit(&rec_tail, tail + 1, memory_order_release);
 }
 
-static bool rec_is_ready()
+bool rec_is_osd_recording()
 {
-    return rec_lv_transcode != NULL;
+    return atomic_load(&rec_recording);
 }
 
-static uint32_t rec_get_frame_idx()
+void rec_get_stats(rec_stats_t *stats)
 {
-
-    return rec_lv_transcode->last_frame_idx;
+    pthread_mutex_lock(&rec_stats_lock);
+    *stats = rec_stats;
+    pthread_mutex_unlock(&rec_stats_lock);
+    stats->dropped = atomic_load(&rec_dropped);
 }
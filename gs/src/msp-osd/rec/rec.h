@@ -1,10 +1,11 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #define REC_MAGIC "MSPOSD"
-#define REC_VERSION 2
+#define REC_VERSION 3
 
 typedef struct rec_config_t
 {
@@ -42,17 +43,78 @@ typedef struct rec_file_header_v1_t
     rec_config_v1_t config;
 } __attribute__((packed)) rec_file_header_v1_t;
 
+/* v1, v2: frame_idx of the video frame, then size cells of the char_width x char_height map */
 typedef struct rec_frame_header_t
 {
     uint32_t frame_idx;
     uint32_t size;
 } __attribute__((packed)) rec_frame_header_t;
 
-void rec_start();
+/*
+ * v3: rec_file_header_t, rec_timebase_t, then frames of rec_frame_header_v3_t and an osd_delta packet
+ * (osd_delta.h) of size bytes: a keyframe at least every REC_KEYFRAME_US, otherwise the cells changed
+ * since the previous frame. Frame timestamps are CLOCK_MONOTONIC, the clock of the decoder PTS
+ * (receive time) and of rtpdump captures, so the OSD lines up with recorded video.
+ */
+#define REC_KEYFRAME_US 1000000
+
+typedef struct rec_timebase_t
+{
+    uint64_t realtime_us;       // CLOCK_REALTIME when the recording started
+    uint64_t monotonic_us;      // CLOCK_MONOTONIC at the same instant
+} __attribute__((packed)) rec_timebase_t;
+
+typedef struct rec_frame_header_v3_t
+{
+    uint32_t frame_idx;         // +1 per frame, the osd_delta seq is its low 16 bits
+    uint32_t size;
+    uint64_t timestamp_us;      // CLOCK_MONOTONIC receive time of the map
+} __attribute__((packed)) rec_frame_header_v3_t;
+
+/*
+ * v3 files closed by rec_stop end in an index of the keyframes and a footer, so playback seeks without
+ * reading the frames. Files without it (the recorder was killed) are indexed by a scan when opened.
+ */
+#define REC_INDEX_MAGIC "MSPOSDIX"
+
+typedef struct rec_index_entry_t
+{
+    uint32_t frame_idx;
+    uint64_t timestamp_us;
+    uint64_t offset;            // of the frame header
+} __attribute__((packed)) rec_index_entry_t;
+
+typedef struct rec_index_footer_t
+{
+    uint64_t index_offset;      // first entry, also the end of the frames
+    uint32_t count;
+    char magic[8];              // REC_INDEX_MAGIC without the NUL, last bytes of the file
+} __attribute__((packed)) rec_index_footer_t;
+
+/* Counters of the running (or last) recording */
+typedef struct rec_stats_t
+{
+    uint32_t frames;            // written to the file
+    uint32_t keyframes;
+    uint32_t dropped;           // the writer fell behind, or the disk failed
+    uint64_t bytes;
+} rec_stats_t;
+
+/**
+ * Start recording the OSD into path, a v3 file. Frames are queued by rec_write_frame and compressed and
+ * written by a background thread. Returns 0, -1 if the file can't be created.
+ */
+int rec_start(const char *path, const rec_config_t *config);
+
+/* Write out the queued frames and the index, trim the file to its content and close it */
 void rec_stop();
-void rec_load_config();
-void rec_write_frame(uint16_t *frame_data, size_t frame_size);
-bool rec_is_enabled();
+
+/**
+ * Queue a map of OSD_DELTA_CELLS cells (column major like the character maps) received at timestamp_us.
+ * Never blocks, a frame is dropped when the writer is behind. Render thread.
+ */
+void rec_write_frame(const uint16_t *frame_data, size_t frame_size, uint64_t timestamp_us);
+
 bool rec_is_osd_recording();
-bool rec_is_gls_recording();
 
+void rec_get_stats(rec_stats_t *stats);
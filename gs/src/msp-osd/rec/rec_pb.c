@@ -1,25 +1,23 @@
+#include <fcntl.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/ioctl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-#include "../json/osd_config.h"
+#include "osd_delta.h"
 
 #include "rec.h"
-#include "rec_shim.h"
-#include "rec_util.h"
 
 #include "rec_pb.h"
 
 #include "../font/font.h"
 
-#define REC_PB_CONFIG_ENABLED_KEY "rec_pb_enabled"
-
-#define MAX_X 60
-#define MAX_Y 22
-#define MAX_T (MAX_X * MAX_Y)
-
-#define FRAME_SIZE (sizeof(rec_frame_header_t) + (sizeof(uint16_t) * MAX_T))
+#define LEGACY_ROWS 22                  // v1/v2 maps are 60 x 22
+#define LEGACY_FRAME_US 16667           // v1/v2 frame_idx counts 60 fps video frames
 
 #ifdef DEBUG
 #define DEBUG_PRINT(fmt, args...) fprintf(stderr, "msp_osd.rec_pb: " fmt "\n", ##args)
@@ -27,225 +25,376 @@
 #define DEBUG_PRINT(fmt, args...)
 #endif
 
-cp_vdec_t *rec_pb_cp_vdec = NULL;
-vdec_local_player_t *rec_pb_vdec_local_player = NULL;
-uint8_t rec_pb_start_attempted = false;
+static uint8_t *pb_data = NULL;         // the whole file, read only
+static size_t pb_size = 0;
+static uint16_t pb_version = 0;
+static rec_config_t osd_config = {0};
 
-static bool rec_pb_enabled = false;
+static size_t pb_frames_off = 0;        // first frame
+static size_t pb_frames_end = 0;        // the index, or the end of the file
+static size_t pb_legacy_frame_size = 0; // v1/v2: header and map of every frame
 
-static FILE *osd_fd = NULL;
-static rec_config_t osd_config = {0};
+/* v3 keyframes: the index in the file, or built by a scan when the file has none */
+static const rec_index_entry_t *pb_index = NULL;
+static rec_index_entry_t *pb_index_built = NULL;
+static uint32_t pb_index_count = 0;
 
-static uint32_t header_size = 0;
-static int64_t frame_counter = 0;
+static uint64_t pb_first_us = 0;
+static uint64_t pb_last_us = 0;
+static size_t pb_cursor = 0;            // next frame
+static uint16_t pb_map[OSD_DELTA_CELLS];
 
-static uint32_t *frame_idxs;
-static uint32_t frame_idx_len = 0;
-static uint32_t current_frame_idx = 0;
+static void rec_pb_legacy_font_variant(uint8_t font_variant, char *out)
+{
+    switch (font_variant)
+    {
+    case FONT_VARIANT_BETAFLIGHT:
+        strcpy(out, "BTFL");
+        break;
+    case FONT_VARIANT_INAV:
+        strcpy(out, "INAV");
+        break;
+    case FONT_VARIANT_ARDUPILOT:
+        strcpy(out, "ARDU");
+        break;
+    case FONT_VARIANT_KISS_ULTRA:
+        strcpy(out, "ULTR");
+        break;
+    case FONT_VARIANT_QUICKSILVER:
+        strcpy(out, "QUIC");
+        break;
+    default:
+        out[0] = '\0'; // Empty string
+    }
+}
 
-void rec_pb_load_config()
+/* Decode the frame at off into pb_map. Returns the offset of the next frame, 0 if there is no valid frame */
+static size_t rec_pb_read_frame(size_t off, uint64_t *timestamp_us)
 {
-    rec_pb_enabled = get_boolean_config_value(REC_PB_CONFIG_ENABLED_KEY);
+    if (pb_version >= 3)
+    {
+        rec_frame_header_v3_t hdr;
+        if (off + sizeof(hdr) > pb_frames_end)
+            return 0;
+        memcpy(&hdr, pb_data + off, sizeof(hdr));
+        off += sizeof(hdr);
+        // a recording cut short ends in preallocated zeros
+        if (hdr.size == 0 || hdr.size > pb_frames_end - off || osd_delta_apply(pb_data + off, hdr.size, pb_map) < 0)
+            return 0;
+        *timestamp_us = hdr.timestamp_us;
+        return off + hdr.size;
+    }
 
-    DEBUG_PRINT("rec_pb_enabled: %d", rec_pb_enabled);
+    rec_frame_header_t hdr;
+    if (off + pb_legacy_frame_size > pb_frames_end)
+        return 0;
+    memcpy(&hdr, pb_data + off, sizeof(hdr));
+    const uint8_t *cells = pb_data + off + sizeof(hdr);
+    int rows = hdr.size == OSD_DELTA_CELLS ? OSD_DELTA_ROWS : LEGACY_ROWS;
+    int cols = (int)hdr.size / rows;
+    memset(pb_map, 0, sizeof(pb_map));
+    for (int x = 0; x < cols && x < OSD_DELTA_COLS; x++)
+        memcpy(&pb_map[x * OSD_DELTA_ROWS], cells + (size_t)x * rows * sizeof(uint16_t),
+               (rows < OSD_DELTA_ROWS ? rows : OSD_DELTA_ROWS) * sizeof(uint16_t));
+    *timestamp_us = (uint64_t)hdr.frame_idx * LEGACY_FRAME_US;
+    return off + pb_legacy_frame_size;
 }
 
-bool rec_pb_is_enabled()
+/* Timestamp of the frame at off without decoding it, false at the end */
+static bool rec_pb_peek_timestamp(size_t off, uint64_t *timestamp_us)
 {
-    return rec_pb_enabled;
+    if (pb_version >= 3)
+    {
+        rec_frame_header_v3_t hdr;
+        if (off + sizeof(hdr) > pb_frames_end)
+            return false;
+        memcpy(&hdr, pb_data + off, sizeof(hdr));
+        *timestamp_us = hdr.timestamp_us;
+        return hdr.size != 0;
+    }
+    rec_frame_header_t hdr;
+    if (off + pb_legacy_frame_size > pb_frames_end)
+        return false;
+    memcpy(&hdr, pb_data + off, sizeof(hdr));
+    *timestamp_us = (uint64_t)hdr.frame_idx * LEGACY_FRAME_US;
+    return true;
 }
 
-int rec_pb_start()
+static uint32_t rec_pb_key_count()
 {
-    if (rec_pb_is_ready() == false)
+    if (pb_version >= 3)
+        return pb_index_count;
+    return pb_legacy_frame_size ? (uint32_t)((pb_frames_end - pb_frames_off) / pb_legacy_frame_size) : 0;
+}
+
+static void rec_pb_key(uint32_t i, uint64_t *timestamp_us, size_t *offset)
+{
+    if (pb_version >= 3)
+    {
+        *timestamp_us = pb_index[i].timestamp_us;
+        *offset = pb_index[i].offset;
+        return;
+    }
+    *offset = pb_frames_off + (size_t)i * pb_legacy_frame_size;
+    rec_pb_peek_timestamp(*offset, timestamp_us);
+}
+
+/* The index from the footer, if the file was closed properly */
+static bool rec_pb_load_index()
+{
+    rec_index_footer_t footer;
+    if (pb_size < pb_frames_off + sizeof(footer))
+        return false;
+    memcpy(&footer, pb_data + pb_size - sizeof(footer), sizeof(footer));
+    if (memcmp(footer.magic, REC_INDEX_MAGIC, sizeof(footer.magic)) != 0 || footer.index_offset < pb_frames_off ||
+        footer.index_offset + (uint64_t)footer.count * sizeof(rec_index_entry_t) != pb_size - sizeof(footer))
+        return false;
+    pb_index = (const rec_index_entry_t *)(pb_data + footer.index_offset);
+    pb_index_count = footer.count;
+    pb_frames_end = footer.index_offset;
+    for (uint32_t i = 0; i < pb_index_count; i++)
     {
-        return 1;
+        if (pb_index[i].offset < pb_frames_off || pb_index[i].offset >= pb_frames_end ||
+            (i && pb_index[i].timestamp_us < pb_index[i - 1].timestamp_us))
+            return false;
     }
+    return true;
+}
 
-    if (osd_fd != NULL)
+/* No footer: read every frame once, keeping the keyframes */
+static bool rec_pb_build_index()
+{
+    uint32_t capacity = 0;
+    size_t off = pb_frames_off;
+    uint64_t timestamp_us;
+    pb_index_count = 0;
+    pb_frames_end = pb_size;
+    while (off + sizeof(rec_frame_header_v3_t) + sizeof(struct osd_delta_header_t) <= pb_size)
     {
-        return 1;
+        bool keyframe = pb_data[off + sizeof(rec_frame_header_v3_t) + 1] == OSD_DELTA_KEYFRAME;
+        size_t next = rec_pb_read_frame(off, &timestamp_us);
+        if (!next)
+            break;
+        if (keyframe && (!pb_index_count || timestamp_us >= pb_index_built[pb_index_count - 1].timestamp_us))
+        {
+            if (pb_index_count == capacity)
+            {
+                capacity = capacity ? capacity * 2 : 1024;
+                rec_index_entry_t *index = realloc(pb_index_built, capacity * sizeof(*index));
+                if (!index)
+                    return false;
+                pb_index_built = index;
+            }
+            rec_frame_header_v3_t hdr;
+            memcpy(&hdr, pb_data + off, sizeof(hdr));
+            pb_index_built[pb_index_count++] = (rec_index_entry_t){
+                .frame_idx = hdr.frame_idx,
+                .timestamp_us = timestamp_us,
+                .offset = off,
+            };
+        }
+        off = next;
     }
+    pb_frames_end = off;
+    pb_index = pb_index_built;
+    return true;
+}
 
-    // TODO: Mutex needed here? Can cause a crash if placback stops as we're trying to read info.
-    DEBUG_PRINT("playback on: %s", rec_pb_vdec_local_player->fmt_ctx->filename);
+/* Timestamp of the last frame: decode forward from the last keyframe */
+static uint64_t rec_pb_find_last_timestamp()
+{
+    uint32_t keys = rec_pb_key_count();
+    uint64_t timestamp_us = 0, t;
+    size_t off, next;
+    if (keys == 0)
+        return 0;
+    rec_pb_key(keys - 1, &timestamp_us, &off);
+    while ((next = rec_pb_read_frame(off, &t)) != 0)
+    {
+        timestamp_us = t;
+        off = next;
+    }
+    return timestamp_us;
+}
 
-    char osd_path[256];
-    rec_util_osd_path_from_video_path(rec_pb_vdec_local_player->fmt_ctx->filename, osd_path, sizeof(osd_path));
+int rec_pb_open(const char *path)
+{
+    rec_pb_close();
 
-    DEBUG_PRINT("osd path: %s", osd_path);
-    osd_fd = fopen(osd_path, "rb");
-    if (osd_fd == NULL)
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
     {
         DEBUG_PRINT("osd file not found");
-        return 1;
+        return -1;
     }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(rec_file_header_v1_t))
+    {
+        close(fd);
+        return -1;
+    }
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return -1;
+    pb_data = data;
+    pb_size = (size_t)st.st_size;
 
-    DEBUG_PRINT("osd file found");
     rec_file_header_t file_header;
-    fread(&file_header, sizeof(rec_file_header_t), 1, osd_fd);
-
+    memcpy(&file_header, pb_data, sizeof(rec_file_header_v1_t));
     if (strncmp(file_header.magic, REC_MAGIC, sizeof(REC_MAGIC)) != 0)
     {
         DEBUG_PRINT("invalid osd file");
-        fclose(osd_fd);
-        osd_fd = NULL;
-        return 1;
+        rec_pb_close();
+        return -1;
     }
+    pb_version = file_header.version;
 
-    if (file_header.version == REC_VERSION)
+    if (pb_version == 1)
     {
-        DEBUG_PRINT("header ok!");
-        memcpy(&osd_config, &file_header.config, sizeof(rec_config_t));
-        header_size = sizeof(rec_file_header_t);
+        rec_file_header_v1_t file_header_v1;
+        memcpy(&file_header_v1, pb_data, sizeof(file_header_v1));
+        memcpy(&osd_config, &file_header_v1.config, offsetof(rec_config_t, font_variant));
+        rec_pb_legacy_font_variant(file_header_v1.config.font_variant, osd_config.font_variant);
+        pb_frames_off = sizeof(rec_file_header_v1_t);
     }
-    else if (file_header.version == 1)
+    else
     {
-        DEBUG_PRINT("header is v1");
-        rec_file_header_v1_t file_header_v1;
-        fseek(osd_fd, 0, SEEK_SET);
-
-        fread(&file_header_v1, sizeof(rec_file_header_v1_t), 1, osd_fd);
-        if (strncmp(file_header_v1.magic, REC_MAGIC, sizeof(REC_MAGIC)) != 0)
+        if (pb_size < sizeof(rec_file_header_t))
         {
-            DEBUG_PRINT("invalid osd file");
-            fclose(osd_fd);
-            osd_fd = NULL;
-            return 1;
+            rec_pb_close();
+            return -1;
         }
+        memcpy(&file_header, pb_data, sizeof(file_header));
+        memcpy(&osd_config, &file_header.config, sizeof(rec_config_t));
+        pb_frames_off = sizeof(rec_file_header_t) + (pb_version >= 3 ? sizeof(rec_timebase_t) : 0);
+    }
 
-        switch (file_header_v1.config.font_variant)
+    if (pb_version >= 3)
+    {
+        if (!rec_pb_load_index())
         {
-        case FONT_VARIANT_BETAFLIGHT:
-            strcpy(file_header.config.font_variant, "BTFL");
-            break;
-        case FONT_VARIANT_INAV:
-            strcpy(file_header.config.font_variant, "INAV");
-            break;
-        case FONT_VARIANT_ARDUPILOT:
-            strcpy(file_header.config.font_variant, "ARDU");
-            break;
-        case FONT_VARIANT_KISS_ULTRA:
-            strcpy(file_header.config.font_variant, "ULTR");
-            break;
-        case FONT_VARIANT_QUICKSILVER:
-            strcpy(file_header.config.font_variant, "QUIC");
-            break;
-        default:
-            file_header.config.font_variant[0] = '\0'; // Empty string
+            printf("[ OSD REC ] %s has no index, scanning it\n", path);
+            if (!rec_pb_build_index())
+            {
+                rec_pb_close();
+                return -1;
+            }
         }
-
-        memcpy(&osd_config, &file_header.config, sizeof(rec_config_t));
-        header_size = sizeof(rec_file_header_v1_t);
     }
     else
     {
-        DEBUG_PRINT("invalid osd file version! expected: %d, got: %d", REC_VERSION, file_header.version);
-        fclose(osd_fd);
-        osd_fd = NULL;
-        return 1;
+        // every frame holds a map of the same size, frame i is at a fixed offset
+        rec_frame_header_t hdr;
+        pb_frames_end = pb_size;
+        if (pb_frames_off + sizeof(hdr) <= pb_size)
+        {
+            memcpy(&hdr, pb_data + pb_frames_off, sizeof(hdr));
+            pb_legacy_frame_size = sizeof(hdr) + (size_t)hdr.size * sizeof(uint16_t);
+        }
     }
 
-    DEBUG_PRINT("loading frame indexes");
-
-    fseek(osd_fd, 0, SEEK_END);
-    uint32_t file_size = ftell(osd_fd);
-    fseek(osd_fd, header_size, SEEK_SET);
-    DEBUG_PRINT("file size: %d", file_size);
-
-    frame_idx_len = file_size / FRAME_SIZE;
-    DEBUG_PRINT("frame_idx_len: %d", frame_idx_len);
-    frame_idxs = malloc(sizeof(uint32_t) * frame_idx_len);
-
-    for (uint32_t i = 0; i < frame_idx_len; i++)
+    if (rec_pb_key_count() == 0)
     {
-        rec_frame_header_t frame_header;
-        fread(&frame_header, sizeof(rec_frame_header_t), 1, osd_fd);
-        frame_idxs[i] = frame_header.frame_idx;
-        DEBUG_PRINT("frame_idx: %d = %d", i, frame_idxs[i]);
-        fseek(osd_fd, sizeof(uint16_t) * MAX_T, SEEK_CUR);
+        DEBUG_PRINT("no frames");
+        rec_pb_close();
+        return -1;
     }
-
-    fseek(osd_fd, header_size, SEEK_SET);
-
-    current_frame_idx = 0;
-    frame_counter = rec_pb_cp_vdec->frames_sent;
-
+    size_t off;
+    rec_pb_key(0, &pb_first_us, &off);
+    pb_last_us = rec_pb_find_last_timestamp();
+    pb_cursor = pb_frames_off;
+    memset(pb_map, 0, sizeof(pb_map));
+    DEBUG_PRINT("version %u, %u keyframes, %llu us", pb_version, rec_pb_key_count(),
+                (unsigned long long)(pb_last_us - pb_first_us));
     return 0;
 }
 
-void rec_pb_stop()
+void rec_pb_close()
 {
-    if (osd_fd != NULL)
-    {
-        fclose(osd_fd);
-        osd_fd = NULL;
-    }
-
-    rec_pb_cp_vdec = NULL;
-    rec_pb_vdec_local_player = NULL;
-
-    free(frame_idxs);
-    frame_idxs = NULL;
+    if (pb_data)
+        munmap(pb_data, pb_size);
+    pb_data = NULL;
+    pb_size = 0;
+    free(pb_index_built);
+    pb_index_built = NULL;
+    pb_index = NULL;
+    pb_index_count = 0;
+    pb_legacy_frame_size = 0;
+}
 
-    DEBUG_PRINT("playback stopped");
+bool rec_pb_is_ready()
+{
+    return pb_data != NULL;
 }
 
 rec_config_t *rec_pb_get_config()
 {
     if (rec_pb_is_ready() == false)
-    {
         return NULL;
-    }
-
     return &osd_config;
 }
 
-int rec_pb_do_next_frame(uint16_t *map_out)
+uint64_t rec_pb_duration_us()
 {
-    // -45 is absolutely a magic number based on testing, seems play_tm_ms lags by about that much.
-    uint64_t frame_counter = ((rec_pb_cp_vdec->play_tm_ms) * 60 / 1000) - 45;
-
-    uint32_t closest_frame_idx = 0;
-    for (uint32_t i = 0; i < frame_idx_len; i++)
-    {
-        if (frame_idxs[i] > frame_counter)
-        {
-            break;
-        }
-
-        closest_frame_idx = i;
-    }
-
-    if (closest_frame_idx == current_frame_idx && current_frame_idx != 0)
-    {
-        return 0;
-    }
-
-    fseek(
-        osd_fd,
-        header_size + (closest_frame_idx * FRAME_SIZE) + sizeof(rec_frame_header_t),
-        SEEK_SET);
-    fread(map_out, sizeof(uint16_t), MAX_T, osd_fd);
-
-    current_frame_idx = closest_frame_idx;
+    return pb_last_us - pb_first_us;
+}
 
-    return 0;
+uint32_t rec_pb_keyframe_count()
+{
+    return rec_pb_is_ready() ? rec_pb_key_count() : 0;
 }
 
-bool rec_pb_gls_is_playing()
+int rec_pb_seek(uint64_t offset_us, uint16_t *map_out)
 {
     if (rec_pb_is_ready() == false)
+        return -1;
+
+    // last keyframe at or before the target, the first one if there is none
+    uint64_t target_us = pb_first_us + offset_us;
+    uint32_t lo = 0, hi = rec_pb_key_count();
+    while (hi - lo > 1)
     {
-        return false;
+        uint32_t mid = lo + (hi - lo) / 2;
+        uint64_t timestamp_us;
+        size_t off;
+        rec_pb_key(mid, &timestamp_us, &off);
+        if (timestamp_us <= target_us)
+            lo = mid;
+        else
+            hi = mid;
     }
 
-    // state == 5 is stopped (i.e., when gs_player_stop is called)
-    return rec_pb_vdec_local_player->b_running && !rec_pb_vdec_local_player->b_v_eos && rec_pb_vdec_local_player->state != 5;
+    uint64_t timestamp_us;
+    size_t off;
+    rec_pb_key(lo, &timestamp_us, &off);
+    size_t next = rec_pb_read_frame(off, &timestamp_us);
+    if (!next)
+        return -1;
+    while (rec_pb_peek_timestamp(next, &timestamp_us) && timestamp_us <= target_us)
+    {
+        size_t after = rec_pb_read_frame(next, &timestamp_us);
+        if (!after)
+            break;
+        next = after;
+    }
+    pb_cursor = next;
+    memcpy(map_out, pb_map, sizeof(pb_map));
+    return 0;
 }
 
-bool rec_pb_is_ready()
+int rec_pb_do_next_frame(uint16_t *map_out, uint64_t *timestamp_us)
 {
-    return rec_pb_cp_vdec != NULL && rec_pb_vdec_local_player != NULL;
+    if (rec_pb_is_ready() == false)
+        return -1;
+
+    uint64_t t;
+    size_t next = rec_pb_read_frame(pb_cursor, &t);
+    if (!next)
+        return -1;
+    pb_cursor = next;
+    memcpy(map_out, pb_map, sizeof(pb_map));
+    if (timestamp_us)
+        *timestamp_us = t - pb_first_us;
+    return 0;
 }
-
@@ -4,17 +4,38 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-extern uint8_t rec_pb_start_attempted;
+#include "rec.h"
 
-void rec_pb_load_config();
-bool rec_pb_is_enabled();
+/*
+ * Playback of .osd recordings. The file is mapped read only; a seek binary-searches the keyframe index
+ * and decodes forward from the nearest keyframe, so it costs O(log n) plus at most REC_KEYFRAME_US of
+ * deltas however long the recording is. v1/v2 files (a full map per frame) are searched in place.
+ * Maps are OSD_DELTA_CELLS cells, column major; larger v1/v2 maps are cropped.
+ */
 
-int rec_pb_start();
-void rec_pb_stop();
+/** Map path and read its header and index. Returns 0, -1 if it isn't a recording */
+int rec_pb_open(const char *path);
 
-int rec_pb_do_next_frame(uint16_t *map_out);
+void rec_pb_close();
+
+bool rec_pb_is_ready();
 
 rec_config_t *rec_pb_get_config();
 
-bool rec_pb_is_ready();
-bool rec_pb_gls_is_playing();
+/* Time between the first and the last frame */
+uint64_t rec_pb_duration_us();
+
+/* Keyframes the seeks start from: the index entries, every frame of a v1/v2 file */
+uint32_t rec_pb_keyframe_count();
+
+/**
+ * The map shown offset_us after the first frame: the last frame at or before it.
+ * Playback continues after it with rec_pb_do_next_frame. Returns 0, -1 on a broken file.
+ */
+int rec_pb_seek(uint64_t offset_us, uint16_t *map_out);
+
+/**
+ * The frame after the last one returned, the first one after rec_pb_open.
+ * timestamp_us (may be NULL) is relative to the first frame. Returns 0, -1 at the end.
+ */
+int rec_pb_do_next_frame(uint16_t *map_out, uint64_t *timestamp_us);
@@ -8,9 +8,28 @@
 typedef struct display_info_s {
     uint8_t char_width;
     uint8_t char_height;
-    uint8_t font_width;
+    uint8_t font_width;             // glyph size in the font PNG
     uint8_t font_height;
     uint16_t x_offset;
     uint16_t y_offset;
-    void *fonts[NUM_FONT_PAGES];
-} display_info_t;
\ No newline at end of file
+    uint8_t glyph_width;            // glyph size on the OSD surface, 0: same as the font
+    uint8_t glyph_height;
+    uint16_t rotate;                // 0, 90, 180, 270: clockwise turn of the atlas glyphs for the display
+    void *fonts[NUM_FONT_PAGES];    // glyph atlas per page: BGRA premultiplied, NUM_CHARS glyphs of contiguous rows
+    void *indexed_fonts[NUM_FONT_PAGES];    // the same atlas as palette indices, 1 byte per pixel (msp-osd.c)
+} display_info_t;
+
+/* Glyph as stored in the atlas: scaled, with width and height swapped when turned by 90/270 */
+static inline int display_info_atlas_width(const display_info_t *d)
+{
+    int w = d->glyph_width ? d->glyph_width : d->font_width;
+    int h = d->glyph_height ? d->glyph_height : d->font_height;
+    return (d->rotate == 90 || d->rotate == 270) ? h : w;
+}
+
+static inline int display_info_atlas_height(const display_info_t *d)
+{
+    int w = d->glyph_width ? d->glyph_width : d->font_width;
+    int h = d->glyph_height ? d->glyph_height : d->font_height;
+    return (d->rotate == 90 || d->rotate == 270) ? w : h;
+}
\ No newline at end of file
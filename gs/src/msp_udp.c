@@ -0,0 +1,268 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "msp_udp.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include "msp-osd.h"
+#include "osd_delta.h"
+
+#define MSP_UDP_MAX_DATAGRAM    4096        // >= OSD_DELTA_MAX_PACKET
+#define MSP_UDP_BATCH_MAX       32          // datagrams parsed per wakeup, then one render
+#define MSP_UDP_SEQ_WINDOW      64          // late datagrams told apart from duplicates this far back, further: a restart
+#define MSP_UDP_REPORT_US       5000000
+
+static pthread_t udp_thread;
+static volatile bool running = false;
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct msp_udp_stats_t stats;
+
+/* Sequence numbers seen: the highest and a bitmap of the ones before it */
+struct msp_udp_seq_t {
+    bool valid;
+    uint16_t highest;
+    uint64_t window;            // bit i: highest - i received
+};
+
+static uint64_t get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+/*
+ * Whether the datagram is parsed: newer than any before it, or the first after a sender restart.
+ * Older ones are stale, the OSD already shows what came after them. gap is set when datagrams are missing
+ * before this one, a frame cut by them must not be completed with its bytes, restart when the window
+ * started over. A restarted sender counts from 0 again: a point to point link doesn't reorder by MSP_UDP_SEQ_WINDOW
+ * datagrams, so anything further back starts over. With resync any datagram not ahead does (keyframes).
+ */
+static bool msp_udp_seq_accept(struct msp_udp_seq_t *sq, uint16_t seq, bool resync, struct msp_udp_stats_t *st,
+                               bool *gap, bool *restart)
+{
+    int16_t d = (int16_t)(uint16_t)(seq - sq->highest);
+    *gap = false;
+    *restart = false;
+
+    if (!sq->valid || d <= -MSP_UDP_SEQ_WINDOW || (resync && d <= 0)) {
+        *gap = sq->valid;
+        *restart = sq->valid;
+        sq->valid = true;
+        sq->highest = seq;
+        sq->window = 1;
+        return true;
+    }
+    if (d > 0) {
+        st->lost += (uint64_t)(d - 1);
+        *gap = d > 1;
+        sq->window = d < MSP_UDP_SEQ_WINDOW ? (sq->window << d) | 1 : 1;
+        sq->highest = seq;
+        return true;
+    }
+
+    // behind the highest: a duplicate, or a late one that was counted lost
+    uint64_t bit = 1ULL << -d;
+    if (sq->window & bit) {
+        st->duplicates++;
+        return false;
+    }
+    sq->window |= bit;
+    if (st->lost)
+        st->lost--;
+    st->late++;
+    return false;
+}
+
+static int msp_udp_open_socket(const struct config_t *cfg)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) { perror("socket"); return -1; }
+
+    struct sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(cfg->osd_port);
+    if (inet_aton(cfg->ip, &addr.sin_addr) == 0) {
+        fprintf(stderr, "[ MSP UDP ] Invalid IP: %s\n", cfg->ip);
+        close(sock);
+        return -1;
+    }
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        perror("bind"); close(sock); return -1;
+    }
+
+    printf("[ MSP UDP ] Listening on %s:%d\n", cfg->ip, cfg->osd_port);
+    return sock;
+}
+
+/* Sequence numbers of the two kinds of datagram, each sender counts its own */
+struct msp_udp_input_t {
+    struct msp_udp_seq_t msp;
+    struct msp_udp_seq_t delta;
+};
+
+static void msp_udp_delta(int sock, struct msp_udp_seq_t *sq, const uint8_t *buf, size_t len, uint64_t rx_us,
+                          const struct sockaddr_in *peer, struct msp_udp_stats_t *st)
+{
+    struct osd_delta_info_t info;
+    bool gap, restart;
+    if (osd_delta_parse_header(buf, len, &info) < 0) {
+        st->delta_failed++;
+        return;
+    }
+    // a keyframe needs no base map: always applied, the window starts over from it
+    if (!msp_udp_seq_accept(sq, info.seq, info.type == OSD_DELTA_KEYFRAME, st, &gap, &restart))
+        return;
+    if (restart)
+        msp_osd_reset_delta();  // the old session's maps are no base for the new one's deltas
+
+    int seq = msp_osd_apply_delta(buf, len, rx_us);
+    if (seq < 0) {
+        st->delta_failed++;
+        return;
+    }
+    st->deltas++;
+
+    uint8_t ack[OSD_DELTA_ACK_SIZE];
+    osd_delta_encode_ack((uint16_t)seq, ack);
+    sendto(sock, ack, sizeof(ack), MSG_DONTWAIT, (const struct sockaddr *)peer, sizeof(*peer));
+}
+
+static void msp_udp_datagram(int sock, struct msp_udp_input_t *in, const uint8_t *buf, size_t len, uint64_t rx_us,
+                             const struct sockaddr_in *peer, struct msp_udp_stats_t *st)
+{
+    struct msp_udp_seq_t *sq = &in->msp;
+    st->datagrams++;
+    st->bytes += len;
+
+    if (buf[0] == OSD_DELTA_MAGIC) {
+        msp_udp_delta(sock, &in->delta, buf, len, rx_us, peer, st);
+        return;
+    }
+    if (len >= sizeof(struct msp_udp_header_t) && buf[0] == MSP_UDP_MAGIC && buf[1] == 0) {
+        struct msp_udp_header_t hdr;
+        memcpy(&hdr, buf, sizeof(hdr));
+        bool gap, restart;
+        if (!msp_udp_seq_accept(sq, ntohs(hdr.seq), false, st, &gap, &restart))
+            return;
+        if (gap)
+            msp_osd_reset_input();
+        buf += sizeof(hdr);
+        len -= sizeof(hdr);
+    }
+    st->frames += (uint64_t)msp_osd_process_buffer(buf, len, rx_us);
+}
+
+static void msp_udp_report(const struct msp_udp_stats_t *now, struct msp_udp_stats_t *last)
+{
+    struct msp_osd_latency_t latency;
+    msp_osd_take_latency(&latency);
+    if (now->datagrams == last->datagrams)
+        return;
+
+    // late datagrams take back losses counted in an earlier report
+    printf("[ MSP UDP ] %llu datagrams, %llu MSP frames, %llu OSD deltas (%llu failed), %lld lost, %llu late, %llu duplicate; "
+           "OSD update latency avg %.1f ms, max %.1f ms (%u updates)\n",
+           (unsigned long long)(now->datagrams - last->datagrams),
+           (unsigned long long)(now->frames - last->frames),
+           (unsigned long long)(now->deltas - last->deltas),
+           (unsigned long long)(now->delta_failed - last->delta_failed),
+           (long long)(now->lost - last->lost),
+           (unsigned long long)(now->late - last->late),
+           (unsigned long long)(now->duplicates - last->duplicates),
+           latency.frames ? latency.total_us / 1000.0 / latency.frames : 0.0,
+           latency.max_us / 1000.0, latency.frames);
+    *last = *now;
+}
+
+static void* msp_udp_thread(void *arg)
+{
+    struct config_t *cfg = (struct config_t *)arg;
+    printf("[ MSP UDP ] Starting MSP UDP receiver thread on %s:%d\n", cfg->ip, cfg->osd_port);
+
+    int sock = msp_udp_open_socket(cfg);
+    if (sock < 0)
+        return NULL;
+
+    uint8_t buffer[MSP_UDP_MAX_DATAGRAM];
+    struct msp_udp_input_t input = {0};
+    struct msp_udp_stats_t st = {0}, reported = {0};
+    uint64_t last_report_us = get_time_us();
+
+    while (running) {
+        struct pollfd fds[] = { { .fd = sock, .events = POLLIN } };
+        int ret = poll(fds, 1, 100);
+        if (ret < 0 && errno != EINTR) {
+            perror("poll");
+            break;
+        }
+
+        if (ret > 0 && (fds[0].revents & POLLIN)) {
+            // every datagram already queued is one batch: a burst of draw completes renders once
+            msp_osd_begin_batch();
+            for (int i = 0; i < MSP_UDP_BATCH_MAX; i++) {
+                struct sockaddr_in peer;
+                socklen_t peer_len = sizeof(peer);
+                ssize_t n = recvfrom(sock, buffer, sizeof(buffer), MSG_DONTWAIT, (struct sockaddr *)&peer, &peer_len);
+                if (n <= 0)
+                    break;
+                msp_udp_datagram(sock, &input, buffer, (size_t)n, get_time_us(), &peer, &st);
+            }
+            msp_osd_end_batch();
+
+            pthread_mutex_lock(&stats_lock);
+            stats = st;
+            pthread_mutex_unlock(&stats_lock);
+        }
+
+        uint64_t now_us = get_time_us();
+        if (now_us - last_report_us >= MSP_UDP_REPORT_US) {
+            msp_udp_report(&st, &reported);
+            last_report_us = now_us;
+        }
+    }
+
+    close(sock);
+    printf("[ MSP UDP ] Exiting MSP UDP receiver thread\n");
+    return NULL;
+}
+
+int msp_udp_start(struct config_t *cfg)
+{
+    if (running) {
+        printf("[ MSP UDP ] Already running MSP UDP receiver thread\n");
+        return -1;
+    }
+    memset(&stats, 0, sizeof(stats));
+    running = true;
+    int ret = pthread_create(&udp_thread, NULL, msp_udp_thread, cfg);
+    if (ret != 0)
+        running = false;
+    return ret;
+}
+
+void msp_udp_stop(void)
+{
+    if (!running) {
+        printf("[ MSP UDP ] MSP UDP receiver thread not running\n");
+        return;
+    }
+    running = false;
+    pthread_join(udp_thread, NULL);
+}
+
+void msp_udp_get_stats(struct msp_udp_stats_t *out)
+{
+    pthread_mutex_lock(&stats_lock);
+    *out = stats;
+    pthread_mutex_unlock(&stats_lock);
+}
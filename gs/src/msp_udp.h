@@ -0,0 +1,46 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_MSP_UDP_H
+#define VD_LINK_MSP_UDP_H
+#include <stdint.h>
+#include "common.h"
+
+#define MSP_UDP_PORT_DEFAULT    7654
+
+/*
+ * MSP DisplayPort from the drone over UDP. A datagram is MSP bytes as the FC sent them, optionally
+ * after a header with a sequence number so lost and reordered datagrams are detected.
+ * Datagrams without it (starting with '$') are parsed as they come.
+ * OSD delta packets (osd_delta.h, starting with OSD_DELTA_MAGIC) are applied to the character map
+ * and acknowledged to their sender.
+ */
+#define MSP_UDP_MAGIC           'V'
+
+struct msp_udp_header_t {
+    uint8_t magic;
+    uint8_t flags;              // 0
+    uint16_t seq;               // big endian, +1 per datagram
+} __attribute__((packed));
+
+struct msp_udp_stats_t {
+    uint64_t datagrams;
+    uint64_t bytes;
+    uint64_t frames;            // MSP frames parsed
+    uint64_t lost;              // sequence gaps not filled later
+    uint64_t late;              // arrived after a newer datagram, dropped as stale
+    uint64_t duplicates;
+    uint64_t deltas;            // OSD delta packets applied
+    uint64_t delta_failed;      // OSD delta packets without their base map, or malformed
+};
+
+/** Receive MSP on cfg->ip:cfg->osd_port and feed the MSP OSD. Call after msp_osd_init */
+int msp_udp_start(struct config_t *cfg);
+
+void msp_udp_stop(void);
+
+/** Counters since start */
+void msp_udp_get_stats(struct msp_udp_stats_t *stats);
+
+#endif //VD_LINK_MSP_UDP_H
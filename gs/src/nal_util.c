@@ -0,0 +1,332 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "nal_util.h"
+#include <string.h>
+
+int nal_start_code_len(const uint8_t *data, int size)
+{
+    if (size >= 4 && data[0] == 0 && data[1] == 0 && data[2] == 0 && data[3] == 1)
+        return 4;
+    if (size >= 3 && data[0] == 0 && data[1] == 0 && data[2] == 1)
+        return 3;
+    return 0;
+}
+
+static void nal_parse_h264(uint8_t hdr, struct nal_info_t *info)
+{
+    int type = hdr & 0x1F;
+    int ref_idc = (hdr >> 5) & 0x03;
+
+    info->type = type;
+    info->is_reference = ref_idc != 0;
+
+    switch (type) {
+    case 1:  // non-IDR slice
+    case 2:  // slice data partition A
+    case 3:  // slice data partition B
+    case 4:  // slice data partition C
+        info->kind = NAL_KIND_SLICE;
+        break;
+    case 5:
+        info->kind = NAL_KIND_KEYFRAME;
+        break;
+    case 7:
+        info->kind = NAL_KIND_SPS;
+        break;
+    case 8:
+        info->kind = NAL_KIND_PPS;
+        break;
+    default:
+        info->kind = NAL_KIND_OTHER;
+        break;
+    }
+
+    if (info->kind != NAL_KIND_SLICE)
+        info->is_reference = true; // never treat non-slice NALs as droppable
+}
+
+static void nal_parse_h265(uint8_t hdr, struct nal_info_t *info)
+{
+    int type = (hdr >> 1) & 0x3F;
+
+    info->type = type;
+    info->is_reference = true;
+
+    if (type <= 31) {
+        // VCL: 16..21 are IRAP (BLA/IDR/CRA), 22..31 reserved
+        if (type >= 16 && type <= 21) {
+            info->kind = NAL_KIND_KEYFRAME;
+            info->is_cra = type == 21;
+        } else {
+            info->is_leading = type >= 6 && type <= 9;    // RADL_N/R, RASL_N/R
+            info->is_rasl = type == 8 || type == 9;
+            info->kind = NAL_KIND_SLICE;
+            // TRAIL_N, TSA_N, STSA_N, RADL_N, RASL_N, RSV_VCL_N10/12/14: sub-layer non-reference
+            if (type <= 14 && (type & 1) == 0)
+                info->is_reference = false;
+        }
+        return;
+    }
+
+    switch (type) {
+    case 32:
+        info->kind = NAL_KIND_VPS;
+        break;
+    case 33:
+        info->kind = NAL_KIND_SPS;
+        break;
+    case 34:
+        info->kind = NAL_KIND_PPS;
+        break;
+    default:
+        info->kind = NAL_KIND_OTHER;
+        break;
+    }
+}
+
+int nal_parse(codec_type_t codec, const uint8_t *data, int size, struct nal_info_t *info)
+{
+    memset(info, 0, sizeof(*info));
+    if (!data || size <= 0)
+        return -1;
+
+    int sc = nal_start_code_len(data, size);
+    info->header_offset = sc;
+    if (sc == size) {
+        info->kind = NAL_KIND_START_CODE;
+        info->is_reference = true;
+        return 0;
+    }
+
+    switch (codec) {
+    case CODEC_H264:
+        nal_parse_h264(data[sc], info);
+        return 0;
+    case CODEC_H265:
+    case CODEC_HEVC:
+        nal_parse_h265(data[sc], info);
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+/* ---------------------- SPS parsing ------------------------- */
+
+#define NAL_SPS_MAX_RBSP 256
+
+struct bit_reader {
+    const uint8_t *data;
+    int size;       // bytes
+    int pos;        // bits
+    bool error;
+};
+
+/* Copy NAL payload without emulation prevention bytes (00 00 03 -> 00 00) */
+static int nal_to_rbsp(const uint8_t *src, int size, uint8_t *dst, int dst_size)
+{
+    int out = 0;
+    int zeros = 0;
+    for (int i = 0; i < size && out < dst_size; i++) {
+        if (zeros >= 2 && src[i] == 0x03) {
+            zeros = 0;
+            continue;
+        }
+        zeros = src[i] == 0 ? zeros + 1 : 0;
+        dst[out++] = src[i];
+    }
+    return out;
+}
+
+static uint32_t br_u(struct bit_reader *br, int n)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < n; i++) {
+        if (br->pos >= br->size * 8) {
+            br->error = true;
+            return 0;
+        }
+        v = (v << 1) | ((br->data[br->pos >> 3] >> (7 - (br->pos & 7))) & 1);
+        br->pos++;
+    }
+    return v;
+}
+
+static void br_skip(struct bit_reader *br, int n)
+{
+    br->pos += n;
+    if (br->pos > br->size * 8)
+        br->error = true;
+}
+
+static uint32_t br_ue(struct bit_reader *br)
+{
+    int zeros = 0;
+    while (!br->error && br_u(br, 1) == 0) {
+        if (++zeros > 31) {
+            br->error = true;
+            return 0;
+        }
+    }
+    if (br->error)
+        return 0;
+    return ((1u << zeros) - 1) + br_u(br, zeros);
+}
+
+static int32_t br_se(struct bit_reader *br)
+{
+    uint32_t v = br_ue(br);
+    return (v & 1) ? (int32_t)((v + 1) / 2) : -(int32_t)(v / 2);
+}
+
+static void h264_skip_scaling_list(struct bit_reader *br, int count)
+{
+    int last = 8, next = 8;
+    for (int i = 0; i < count && !br->error; i++) {
+        if (next != 0) {
+            next = (last + br_se(br) + 256) % 256;
+        }
+        last = next == 0 ? last : next;
+    }
+}
+
+static int h264_sps_resolution(struct bit_reader *br, int *width, int *height)
+{
+    int profile_idc = (int)br_u(br, 8);
+    br_skip(br, 16);        // constraint flags + level_idc
+    br_ue(br);              // seq_parameter_set_id
+
+    int chroma_format_idc = 1;
+    if (profile_idc == 100 || profile_idc == 110 || profile_idc == 122 || profile_idc == 244 ||
+        profile_idc == 44 || profile_idc == 83 || profile_idc == 86 || profile_idc == 118 ||
+        profile_idc == 128 || profile_idc == 138 || profile_idc == 139 || profile_idc == 134 ||
+        profile_idc == 135) {
+        chroma_format_idc = (int)br_ue(br);
+        if (chroma_format_idc == 3)
+            br_skip(br, 1); // separate_colour_plane_flag
+        br_ue(br);          // bit_depth_luma_minus8
+        br_ue(br);          // bit_depth_chroma_minus8
+        br_skip(br, 1);     // qpprime_y_zero_transform_bypass_flag
+        if (br_u(br, 1)) {  // seq_scaling_matrix_present_flag
+            int lists = chroma_format_idc != 3 ? 8 : 12;
+            for (int i = 0; i < lists && !br->error; i++) {
+                if (br_u(br, 1))
+                    h264_skip_scaling_list(br, i < 6 ? 16 : 64);
+            }
+        }
+    }
+
+    br_ue(br);              // log2_max_frame_num_minus4
+    uint32_t poc_type = br_ue(br);
+    if (poc_type == 0) {
+        br_ue(br);          // log2_max_pic_order_cnt_lsb_minus4
+    } else if (poc_type == 1) {
+        br_skip(br, 1);     // delta_pic_order_always_zero_flag
+        br_se(br);          // offset_for_non_ref_pic
+        br_se(br);          // offset_for_top_to_bottom_field
+        uint32_t n = br_ue(br);
+        if (n > 255)
+            return -1;
+        for (uint32_t i = 0; i < n && !br->error; i++)
+            br_se(br);
+    }
+    br_ue(br);              // max_num_ref_frames
+    br_skip(br, 1);         // gaps_in_frame_num_value_allowed_flag
+
+    uint32_t mbs_w = br_ue(br) + 1;
+    uint32_t map_units_h = br_ue(br) + 1;
+    uint32_t frame_mbs_only = br_u(br, 1);
+    if (!frame_mbs_only)
+        br_skip(br, 1);     // mb_adaptive_frame_field_flag
+    br_skip(br, 1);         // direct_8x8_inference_flag
+
+    int w = (int)mbs_w * 16;
+    int h = (int)((2 - frame_mbs_only) * map_units_h * 16);
+    if (br_u(br, 1)) {      // frame_cropping_flag
+        int crop_x = (chroma_format_idc == 1 || chroma_format_idc == 2) ? 2 : 1;
+        int crop_y = (chroma_format_idc == 1 ? 2 : 1) * (2 - (int)frame_mbs_only);
+        uint32_t left = br_ue(br), right = br_ue(br), top = br_ue(br), bottom = br_ue(br);
+        w -= crop_x * (int)(left + right);
+        h -= crop_y * (int)(top + bottom);
+    }
+
+    if (br->error || w <= 0 || h <= 0)
+        return -1;
+    *width = w;
+    *height = h;
+    return 0;
+}
+
+static int h265_sps_resolution(struct bit_reader *br, int *width, int *height)
+{
+    br_skip(br, 4);                         // sps_video_parameter_set_id
+    int max_sub_layers_minus1 = (int)br_u(br, 3);
+    br_skip(br, 1);                         // sps_temporal_id_nesting_flag
+
+    /* profile_tier_level(1, max_sub_layers_minus1) */
+    br_skip(br, 88);                        // general profile space .. general constraint flags
+    br_skip(br, 8);                         // general_level_idc
+    int sub_profile[8] = {0}, sub_level[8] = {0};
+    for (int i = 0; i < max_sub_layers_minus1; i++) {
+        sub_profile[i] = (int)br_u(br, 1);
+        sub_level[i] = (int)br_u(br, 1);
+    }
+    if (max_sub_layers_minus1 > 0) {
+        for (int i = max_sub_layers_minus1; i < 8; i++)
+            br_skip(br, 2);                 // reserved_zero_2bits
+    }
+    for (int i = 0; i < max_sub_layers_minus1; i++) {
+        if (sub_profile[i])
+            br_skip(br, 88);
+        if (sub_level[i])
+            br_skip(br, 8);
+    }
+
+    br_ue(br);                              // sps_seq_parameter_set_id
+    uint32_t chroma_format_idc = br_ue(br);
+    if (chroma_format_idc == 3)
+        br_skip(br, 1);                     // separate_colour_plane_flag
+
+    int w = (int)br_ue(br);
+    int h = (int)br_ue(br);
+    if (br_u(br, 1)) {                      // conformance_window_flag
+        int sub_w = (chroma_format_idc == 1 || chroma_format_idc == 2) ? 2 : 1;
+        int sub_h = chroma_format_idc == 1 ? 2 : 1;
+        uint32_t left = br_ue(br), right = br_ue(br), top = br_ue(br), bottom = br_ue(br);
+        w -= sub_w * (int)(left + right);
+        h -= sub_h * (int)(top + bottom);
+    }
+
+    if (br->error || w <= 0 || h <= 0)
+        return -1;
+    *width = w;
+    *height = h;
+    return 0;
+}
+
+int nal_parse_sps_resolution(codec_type_t codec, const uint8_t *data, int size, int *width, int *height)
+{
+    struct nal_info_t info;
+    if (nal_parse(codec, data, size, &info) < 0 || info.kind != NAL_KIND_SPS)
+        return -1;
+
+    /* skip the NAL header: 1 byte for H.264, 2 bytes for H.265 */
+    int hdr = codec == CODEC_H264 ? 1 : 2;
+    int offset = info.header_offset + hdr;
+    if (offset >= size)
+        return -1;
+
+    uint8_t rbsp[NAL_SPS_MAX_RBSP];
+    struct bit_reader br = {
+        .data = rbsp,
+        .size = nal_to_rbsp(data + offset, size - offset, rbsp, sizeof(rbsp)),
+        .pos = 0,
+        .error = false
+    };
+
+    if (codec == CODEC_H264)
+        return h264_sps_resolution(&br, width, height);
+    return h265_sps_resolution(&br, width, height);
+}
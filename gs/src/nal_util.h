@@ -0,0 +1,58 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_NAL_UTIL_H
+#define VD_LINK_NAL_UTIL_H
+#include <stdint.h>
+#include <stdbool.h>
+#include "common.h"
+
+typedef enum {
+    NAL_KIND_UNKNOWN = 0,
+    NAL_KIND_START_CODE,    // bare Annex-B start code chunk (RTP unpacker emits it separately for H.264)
+    NAL_KIND_VPS,
+    NAL_KIND_SPS,
+    NAL_KIND_PPS,
+    NAL_KIND_KEYFRAME,      // H.264 IDR / H.265 IRAP slice
+    NAL_KIND_SLICE,         // any other VCL slice
+    NAL_KIND_OTHER          // SEI, AUD, filler, ...
+} nal_kind_t;
+
+struct nal_info_t {
+    nal_kind_t kind;
+    int type;               // raw nal_unit_type
+    int header_offset;      // offset of the NAL header inside the buffer (after start code)
+    bool is_reference;      // false for H.264 nal_ref_idc == 0 and H.265 sub-layer non-reference slices
+    bool is_cra;            // H.265 CRA slice: its RASL pictures reference frames before it
+    bool is_rasl;           // H.265 RASL slice, undecodable when decoding starts at its CRA
+    bool is_leading;        // H.265 RADL/RASL slice, precedes the trailing pictures of its IRAP
+};
+
+/**
+ * Classify one decoder input chunk as produced by the RTP demuxer.
+ * The chunk may start with an Annex-B start code or directly with the NAL header.
+ * Returns 0 on success, -1 if the chunk is empty or the codec is unknown.
+ */
+int nal_parse(codec_type_t codec, const uint8_t *data, int size, struct nal_info_t *info);
+
+/** Length of the leading Annex-B start code (0, 3 or 4 bytes) */
+int nal_start_code_len(const uint8_t *data, int size);
+
+/**
+ * Parse the cropped picture size from an SPS NAL (with or without start code).
+ * Returns 0 on success, -1 if the SPS is truncated or uses unsupported syntax.
+ */
+int nal_parse_sps_resolution(codec_type_t codec, const uint8_t *data, int size, int *width, int *height);
+
+static inline bool nal_is_param_set(const struct nal_info_t *info)
+{
+    return info->kind == NAL_KIND_VPS || info->kind == NAL_KIND_SPS || info->kind == NAL_KIND_PPS;
+}
+
+static inline bool nal_is_vcl(const struct nal_info_t *info)
+{
+    return info->kind == NAL_KIND_KEYFRAME || info->kind == NAL_KIND_SLICE;
+}
+
+#endif //VD_LINK_NAL_UTIL_H
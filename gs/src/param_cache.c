@@ -0,0 +1,224 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "param_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#define PARAM_CACHE_MAGIC   0x53504456u    // "VDPS"
+#define PARAM_CACHE_VERSION 1
+#define PARAM_CACHE_LAST    "last"
+
+struct param_cache_header_t {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t codec;
+    uint16_t width;
+    uint16_t height;
+    uint16_t set_size[PARAM_SET_COUNT];
+} __attribute__((packed));
+
+static const uint8_t start_code[4] = {0, 0, 0, 1};
+
+int param_cache_dir(char *out, size_t out_size, bool create)
+{
+#ifdef PLATFORM_DESKTOP
+    const char *home = getenv("HOME");
+    if (!home || !home[0])
+        return -1;
+    if (create) {
+        snprintf(out, out_size, "%s/.cache", home);
+        mkdir(out, 0755);
+    }
+    snprintf(out, out_size, "%s/%s", home, PARAM_CACHE_DIR_DEFAULT);
+#else
+    snprintf(out, out_size, "%s", PARAM_CACHE_DIR_DEFAULT);
+#endif
+    if (create && mkdir(out, 0755) < 0 && errno != EEXIST) {
+        printf("[ CACHE ] Can't create %s: %s\n", out, strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+/* Keys come from the network, keep only characters that are safe in a file name */
+static void param_cache_file(char *out, size_t out_size, const char *dir, const char *key)
+{
+    char safe[PARAM_CACHE_KEY_MAX];
+    int n = 0;
+    for (; key[n] && n < PARAM_CACHE_KEY_MAX - 1; n++) {
+        char c = key[n];
+        bool ok = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '.' || c == '-';
+        safe[n] = ok ? c : '_';
+    }
+    safe[n] = '\0';
+    snprintf(out, out_size, "%s/%s.params", dir, safe);
+}
+
+static int param_cache_read(const char *path, struct stream_params_t *params)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return -1;
+
+    struct param_cache_header_t hdr;
+    int ret = -1;
+    if (fread(&hdr, sizeof(hdr), 1, f) != 1 || hdr.magic != PARAM_CACHE_MAGIC || hdr.version != PARAM_CACHE_VERSION)
+        goto out;
+
+    memset(params, 0, sizeof(*params));
+    params->codec = (codec_type_t)hdr.codec;
+    params->width = hdr.width;
+    params->height = hdr.height;
+    for (int i = 0; i < PARAM_SET_COUNT; i++) {
+        if (hdr.set_size[i] > PARAM_SET_MAX_SIZE)
+            goto out;
+        if (hdr.set_size[i] && fread(params->sets[i].data, hdr.set_size[i], 1, f) != 1)
+            goto out;
+        if (hdr.set_size[i] && memcmp(params->sets[i].data, start_code, sizeof(start_code)) != 0)
+            goto out;
+        params->sets[i].size = hdr.set_size[i];
+    }
+    ret = param_cache_complete(params) ? 0 : -1;
+out:
+    fclose(f);
+    return ret;
+}
+
+static int param_cache_write(const char *path, const void *data, size_t size)
+{
+    char tmp[320];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    FILE *f = fopen(tmp, "wb");
+    if (!f)
+        return -1;
+    bool ok = fwrite(data, size, 1, f) == 1;
+    ok = (fclose(f) == 0) && ok;
+    /* rename is atomic, a power cut never leaves a half written entry */
+    if (!ok || rename(tmp, path) < 0) {
+        remove(tmp);
+        return -1;
+    }
+    return 0;
+}
+
+int param_cache_load_last(struct stream_params_t *params, char *key, int key_size)
+{
+    char dir[256], path[320], last_key[PARAM_CACHE_KEY_MAX] = {0};
+    if (param_cache_dir(dir, sizeof(dir), false) < 0)
+        return -1;
+
+    snprintf(path, sizeof(path), "%s/%s", dir, PARAM_CACHE_LAST);
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return -1;
+    if (!fgets(last_key, sizeof(last_key), f)) {
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+    last_key[strcspn(last_key, "\r\n")] = '\0';
+    if (!last_key[0])
+        return -1;
+
+    param_cache_file(path, sizeof(path), dir, last_key);
+    if (param_cache_read(path, params) < 0) {
+        printf("[ CACHE ] Ignoring invalid cache entry %s\n", path);
+        return -1;
+    }
+    if (key)
+        snprintf(key, (size_t)key_size, "%s", last_key);
+    return 0;
+}
+
+bool param_cache_update(struct stream_params_t *params, const struct nal_info_t *info,
+                        const uint8_t *data, int size)
+{
+    int slot;
+    switch (info->kind) {
+    case NAL_KIND_VPS:
+        slot = PARAM_SET_VPS;
+        break;
+    case NAL_KIND_SPS:
+        slot = PARAM_SET_SPS;
+        break;
+    case NAL_KIND_PPS:
+        slot = PARAM_SET_PPS;
+        break;
+    default:
+        return false;
+    }
+
+    int payload = size - info->header_offset;
+    if (payload <= 0 || payload + (int)sizeof(start_code) > PARAM_SET_MAX_SIZE)
+        return false;
+
+    struct param_set_t *set = &params->sets[slot];
+    if (set->size == payload + (int)sizeof(start_code) &&
+        memcmp(set->data + sizeof(start_code), data + info->header_offset, (size_t)payload) == 0)
+        return false;
+
+    memcpy(set->data, start_code, sizeof(start_code));
+    memcpy(set->data + sizeof(start_code), data + info->header_offset, (size_t)payload);
+    set->size = payload + (int)sizeof(start_code);
+
+    if (slot == PARAM_SET_SPS)
+        nal_parse_sps_resolution(params->codec, set->data, set->size, &params->width, &params->height);
+    return true;
+}
+
+bool param_cache_complete(const struct stream_params_t *params)
+{
+    if (params->codec != CODEC_H264 && params->codec != CODEC_H265)
+        return false;
+    if (params->codec == CODEC_H265 && params->sets[PARAM_SET_VPS].size <= 0)
+        return false;
+    return params->sets[PARAM_SET_SPS].size > 0 && params->sets[PARAM_SET_PPS].size > 0 &&
+           params->width > 0 && params->height > 0;
+}
+
+int param_cache_save(const char *key, const struct stream_params_t *params)
+{
+    char dir[256], path[320];
+    if (!key || !key[0] || !param_cache_complete(params))
+        return -1;
+    if (param_cache_dir(dir, sizeof(dir), true) < 0)
+        return -1;
+
+    uint8_t buf[sizeof(struct param_cache_header_t) + PARAM_SET_COUNT * PARAM_SET_MAX_SIZE];
+    struct param_cache_header_t hdr = {
+        .magic = PARAM_CACHE_MAGIC,
+        .version = PARAM_CACHE_VERSION,
+        .codec = (uint16_t)params->codec,
+        .width = (uint16_t)params->width,
+        .height = (uint16_t)params->height,
+    };
+    size_t len = sizeof(hdr);
+    for (int i = 0; i < PARAM_SET_COUNT; i++) {
+        hdr.set_size[i] = (uint16_t)params->sets[i].size;
+        memcpy(buf + len, params->sets[i].data, (size_t)params->sets[i].size);
+        len += (size_t)params->sets[i].size;
+    }
+    memcpy(buf, &hdr, sizeof(hdr));
+
+    param_cache_file(path, sizeof(path), dir, key);
+    if (param_cache_write(path, buf, len) < 0) {
+        printf("[ CACHE ] Can't write %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    char last[PARAM_CACHE_KEY_MAX + 1];
+    int n = snprintf(last, sizeof(last), "%s\n", key);
+    snprintf(path, sizeof(path), "%s/%s", dir, PARAM_CACHE_LAST);
+    if (param_cache_write(path, last, (size_t)n) < 0)
+        return -1;
+
+    printf("[ CACHE ] Saved stream parameters for %s: %s %dx%d\n", key,
+           params->codec == CODEC_H264 ? "H264" : "H265", params->width, params->height);
+    return 0;
+}
@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_PARAM_CACHE_H
+#define VD_LINK_PARAM_CACHE_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "common.h"
+#include "nal_util.h"
+
+/*
+ * Last seen stream parameters per drone (VPS/SPS/PPS, codec and resolution), kept on disk so the
+ * next start can create the decoder and size the display before the first packet arrives.
+ * Drones are keyed by the RTP sender address, the last used drone is remembered separately.
+ */
+
+#ifdef PLATFORM_DESKTOP
+#define PARAM_CACHE_DIR_DEFAULT ".cache/vd-link"    // relative to $HOME
+#else
+#define PARAM_CACHE_DIR_DEFAULT "/var/cache/vd-link"
+#endif
+
+#define PARAM_CACHE_KEY_MAX 64
+#define PARAM_SET_MAX_SIZE  256
+
+enum {
+    PARAM_SET_VPS = 0,
+    PARAM_SET_SPS,
+    PARAM_SET_PPS,
+    PARAM_SET_COUNT
+};
+
+struct param_set_t {
+    uint8_t data[PARAM_SET_MAX_SIZE];   // always starts with a 4-byte start code
+    int     size;
+};
+
+struct stream_params_t {
+    codec_type_t codec;
+    int width;
+    int height;
+    struct param_set_t sets[PARAM_SET_COUNT];
+};
+
+/** Cache directory, also used by other on-disk caches (font atlases). Returns 0 on success */
+int param_cache_dir(char *out, size_t out_size, bool create);
+
+/**
+ * Load the parameters of the drone used last time.
+ * key receives the drone key (may be NULL). Returns 0 on success, -1 if there is no usable entry.
+ */
+int param_cache_load_last(struct stream_params_t *params, char *key, int key_size);
+
+/**
+ * Remember one parameter set NAL from the stream (with or without start code).
+ * Returns true if it differs from what was stored before.
+ */
+bool param_cache_update(struct stream_params_t *params, const struct nal_info_t *info,
+                        const uint8_t *data, int size);
+
+/** All parameter sets the codec needs are present */
+bool param_cache_complete(const struct stream_params_t *params);
+
+/** Write the entry for this drone and mark it as last used. Returns 0 on success */
+int param_cache_save(const char *key, const struct stream_params_t *params);
+
+#endif //VD_LINK_PARAM_CACHE_H
@@ -0,0 +1,298 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "rtp_dump.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <arpa/inet.h>
+
+#define RTP_DUMP_MAGIC          "#!rtpplay1.0 "
+#define RTP_DUMP_PACKET_MAX     2048
+#define RTP_CAPTURE_SLOTS       2048        // ~4 MB, seconds of video at typical link rates
+#define RTP_CAPTURE_IDLE_US     5000
+
+/* rtpdump fixed headers, all fields big endian */
+struct rtp_dump_file_hdr_t {
+    uint32_t start_sec;
+    uint32_t start_usec;
+    uint32_t source;
+    uint16_t port;
+    uint16_t padding;
+} __attribute__((packed));
+
+struct rtp_dump_packet_hdr_t {
+    uint16_t length;        // header + datagram
+    uint16_t plen;          // RTP length, 0 for RTCP
+    uint32_t offset_ms;     // since start
+} __attribute__((packed));
+
+struct rtp_capture_slot_t {
+    uint64_t arrival_us;
+    struct sockaddr_in peer;
+    uint16_t size;
+    uint8_t data[RTP_DUMP_PACKET_MAX];
+};
+
+/* single producer (receive thread), single consumer (writer thread) ring */
+struct rtp_capture_t {
+    FILE *file;
+    char path[256];
+    pthread_t thread;
+    atomic_bool stop;
+    atomic_uint head;           // next slot to write, owned by the writer thread
+    atomic_uint tail;           // next slot to fill, owned by the receive thread
+    atomic_uint dropped;
+    uint64_t start_us;
+    uint32_t written;
+    bool header_done;
+    struct rtp_capture_slot_t slots[RTP_CAPTURE_SLOTS];
+};
+
+struct rtp_replay_t {
+    FILE *file;
+    double speed;
+    struct in_addr source;
+    uint64_t start_us;          // wall clock of the first packet
+    uint32_t first_offset_ms;
+    bool started;
+    bool pending;               // header read, waiting until the packet is due
+    struct rtp_dump_packet_hdr_t next;
+    uint32_t packets;
+};
+
+static uint64_t rtp_dump_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+static bool rtp_capture_write_header(struct rtp_capture_t *cap, const struct rtp_capture_slot_t *slot)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    char addr[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &slot->peer.sin_addr, addr, sizeof(addr));
+    fprintf(cap->file, RTP_DUMP_MAGIC "%s/%u\n", addr, ntohs(slot->peer.sin_port));
+
+    struct rtp_dump_file_hdr_t hdr = {
+        .start_sec = htonl((uint32_t)now.tv_sec),
+        .start_usec = htonl((uint32_t)(now.tv_nsec / 1000)),
+        .source = slot->peer.sin_addr.s_addr,
+        .port = slot->peer.sin_port,
+    };
+    cap->start_us = slot->arrival_us;
+    cap->header_done = true;
+    return fwrite(&hdr, sizeof(hdr), 1, cap->file) == 1;
+}
+
+static bool rtp_capture_write_slot(struct rtp_capture_t *cap, const struct rtp_capture_slot_t *slot)
+{
+    if (!cap->header_done && !rtp_capture_write_header(cap, slot))
+        return false;
+
+    struct rtp_dump_packet_hdr_t hdr = {
+        .length = htons((uint16_t)(sizeof(hdr) + slot->size)),
+        .plen = htons(slot->size),
+        .offset_ms = htonl((uint32_t)((slot->arrival_us - cap->start_us) / 1000)),
+    };
+    if (fwrite(&hdr, sizeof(hdr), 1, cap->file) != 1 || fwrite(slot->data, slot->size, 1, cap->file) != 1)
+        return false;
+    cap->written++;
+    return true;
+}
+
+static void *rtp_capture_thread(void *arg)
+{
+    struct rtp_capture_t *cap = arg;
+
+    while (1) {
+        unsigned head = atomic_load_explicit(&cap->head, memory_order_relaxed);
+        unsigned tail = atomic_load_explicit(&cap->tail, memory_order_acquire);
+
+        if (head == tail) {
+            if (atomic_load(&cap->stop))
+                break;
+            fflush(cap->file);
+            usleep(RTP_CAPTURE_IDLE_US);
+            continue;
+        }
+
+        for (; head != tail; head++) {
+            if (!rtp_capture_write_slot(cap, &cap->slots[head % RTP_CAPTURE_SLOTS])) {
+                printf("[ RTP ] Capture write to %s failed: %s\n", cap->path, strerror(errno));
+                atomic_store(&cap->stop, true);
+                atomic_store_explicit(&cap->head, tail, memory_order_release);
+                return NULL;
+            }
+        }
+        atomic_store_explicit(&cap->head, head, memory_order_release);
+    }
+    return NULL;
+}
+
+struct rtp_capture_t *rtp_capture_start(const char *path)
+{
+    struct rtp_capture_t *cap = calloc(1, sizeof(*cap));
+    if (!cap)
+        return NULL;
+
+    snprintf(cap->path, sizeof(cap->path), "%s", path);
+    cap->file = fopen(path, "wb");
+    if (!cap->file) {
+        printf("[ RTP ] Can't open capture file %s: %s\n", path, strerror(errno));
+        free(cap);
+        return NULL;
+    }
+    if (pthread_create(&cap->thread, NULL, rtp_capture_thread, cap) != 0) {
+        printf("[ RTP ] Failed to create capture thread\n");
+        fclose(cap->file);
+        free(cap);
+        return NULL;
+    }
+    printf("[ RTP ] Capturing RTP to %s\n", path);
+    return cap;
+}
+
+void rtp_capture_packet(struct rtp_capture_t *cap, const void *data, int size, const struct sockaddr_in *peer)
+{
+    if (!cap || size <= 0 || atomic_load_explicit(&cap->stop, memory_order_relaxed))
+        return;
+
+    unsigned tail = atomic_load_explicit(&cap->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&cap->head, memory_order_acquire);
+    if (tail - head >= RTP_CAPTURE_SLOTS || size > RTP_DUMP_PACKET_MAX) {
+        atomic_fetch_add_explicit(&cap->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    struct rtp_capture_slot_t *slot = &cap->slots[tail % RTP_CAPTURE_SLOTS];
+    slot->arrival_us = rtp_dump_time_us();
+    slot->peer = *peer;
+    slot->size = (uint16_t)size;
+    memcpy(slot->data, data, (size_t)size);
+    atomic_store_explicit(&cap->tail, tail + 1, memory_order_release);
+}
+
+void rtp_capture_stop(struct rtp_capture_t *cap)
+{
+    if (!cap)
+        return;
+
+    atomic_store(&cap->stop, true);
+    pthread_join(cap->thread, NULL);
+    fclose(cap->file);
+    printf("[ RTP ] Capture %s closed: %u packets written, %u dropped\n",
+           cap->path, cap->written, atomic_load(&cap->dropped));
+    free(cap);
+}
+
+struct rtp_replay_t *rtp_replay_open(const char *path, double speed)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        printf("[ RTP ] Can't open replay file %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+
+    char line[128];
+    struct rtp_dump_file_hdr_t hdr;
+    if (!fgets(line, sizeof(line), f) || strncmp(line, RTP_DUMP_MAGIC, strlen(RTP_DUMP_MAGIC)) != 0 ||
+        fread(&hdr, sizeof(hdr), 1, f) != 1) {
+        printf("[ RTP ] %s is not an rtpdump file\n", path);
+        fclose(f);
+        return NULL;
+    }
+
+    struct rtp_replay_t *rp = calloc(1, sizeof(*rp));
+    if (!rp) {
+        fclose(f);
+        return NULL;
+    }
+    rp->file = f;
+    rp->speed = speed > 0 ? speed : 0;
+    rp->source.s_addr = hdr.source;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    if (rp->speed > 0)
+        printf("[ RTP ] Replaying %s (%s) at %.2gx\n", path, line + strlen(RTP_DUMP_MAGIC), rp->speed);
+    else
+        printf("[ RTP ] Replaying %s (%s) as fast as possible\n", path, line + strlen(RTP_DUMP_MAGIC));
+    return rp;
+}
+
+int rtp_replay_read(struct rtp_replay_t *rp, void *buf, int size)
+{
+    while (!rp->pending) {
+        if (fread(&rp->next, sizeof(rp->next), 1, rp->file) != 1)
+            goto eof;
+        rp->next.length = ntohs(rp->next.length);
+        rp->next.plen = ntohs(rp->next.plen);
+        rp->next.offset_ms = ntohl(rp->next.offset_ms);
+        if (rp->next.length < sizeof(rp->next))
+            goto eof;
+        /* RTCP entries (plen 0) carry nothing for the decoder */
+        if (rp->next.plen == 0) {
+            if (fseek(rp->file, rp->next.length - (long)sizeof(rp->next), SEEK_CUR) != 0)
+                goto eof;
+            continue;
+        }
+        rp->pending = true;
+    }
+
+    if (rp->speed > 0) {
+        uint64_t now = rtp_dump_time_us();
+        if (!rp->started) {
+            rp->start_us = now;
+            rp->first_offset_ms = rp->next.offset_ms;
+            rp->started = true;
+        }
+        uint64_t due = rp->start_us +
+                       (uint64_t)((double)(rp->next.offset_ms - rp->first_offset_ms) * 1000.0 / rp->speed);
+        if (due > now) {
+            uint64_t wait = due - now;
+            usleep((useconds_t)(wait > 100000 ? 100000 : wait));
+            if (due > rtp_dump_time_us())
+                return 0;
+        }
+    }
+
+    int len = rp->next.length - (int)sizeof(rp->next);
+    rp->pending = false;
+    if (len > size) {
+        printf("[ RTP ] Replay packet of %d bytes does not fit, skipping\n", len);
+        if (fseek(rp->file, len, SEEK_CUR) != 0)
+            goto eof;
+        return 0;
+    }
+    if (len > 0 && fread(buf, (size_t)len, 1, rp->file) != 1)
+        goto eof;
+    rp->packets++;
+    return len;
+
+eof:
+    rp->pending = false;
+    return -1;
+}
+
+struct in_addr rtp_replay_source(const struct rtp_replay_t *rp)
+{
+    return rp->source;
+}
+
+void rtp_replay_close(struct rtp_replay_t *rp)
+{
+    if (!rp)
+        return;
+    printf("[ RTP ] Replay finished, %u packets\n", rp->packets);
+    fclose(rp->file);
+    free(rp);
+}
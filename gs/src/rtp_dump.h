@@ -0,0 +1,49 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_RTP_DUMP_H
+#define VD_LINK_RTP_DUMP_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <netinet/in.h>
+
+/*
+ * rtpdump files (https://wiki.wireshark.org/rtpdump), compatible with rtpplay/Wireshark and
+ * librtp test/rtp-dump.c: "#!rtpplay1.0 addr/port\n", 16-byte file header, then per packet an
+ * 8-byte header (length, RTP length, ms since start) followed by the datagram.
+ */
+
+struct rtp_capture_t;
+struct rtp_replay_t;
+
+/** Start capture into path, datagrams are written by a background thread */
+struct rtp_capture_t *rtp_capture_start(const char *path);
+
+/**
+ * Queue one received datagram, called from the receive thread.
+ * Never blocks: if the writer can't keep up the datagram is counted as dropped.
+ */
+void rtp_capture_packet(struct rtp_capture_t *cap, const void *data, int size, const struct sockaddr_in *peer);
+
+/** Flush pending datagrams, close the file and print statistics */
+void rtp_capture_stop(struct rtp_capture_t *cap);
+
+/**
+ * Open a capture for replay.
+ * speed: 1.0 original pacing, N for N times faster, 0 as fast as possible.
+ */
+struct rtp_replay_t *rtp_replay_open(const char *path, double speed);
+
+/**
+ * Read the next datagram when it is due.
+ * Returns its size, 0 if it is not due yet (slept up to 100 ms, call again), -1 at end of file.
+ */
+int rtp_replay_read(struct rtp_replay_t *rp, void *buf, int size);
+
+/** Sender address recorded in the file header */
+struct in_addr rtp_replay_source(const struct rtp_replay_t *rp);
+
+void rtp_replay_close(struct rtp_replay_t *rp);
+
+#endif //VD_LINK_RTP_DUMP_H
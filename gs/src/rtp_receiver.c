@@ -13,8 +13,15 @@
 #include <unistd.h>
 #include <poll.h>
 #include <pthread.h>
+#include <string.h>
+#include <time.h>
 #include "rtp-demuxer.h"
 #include "rtp-profile.h"
+#include "nal_util.h"
+#include "param_cache.h"
+#include "bench.h"
+#include "rtp_dump.h"
+#include "trace.h"
 
 #ifdef PLATFORM_ROCKCHIP
 #include "decoder.h"
@@ -27,6 +34,22 @@
 
 static pthread_t rtp_thread;
 static volatile bool running = false;
+static volatile bool input_done = false;
+
+static struct stream_params_t stream_params;
+static char drone_key[PARAM_CACHE_KEY_MAX];
+
+/* time to first frame */
+static uint64_t start_us = 0;
+static volatile uint64_t first_packet_us = 0;
+static bool cache_used = false;
+
+static uint64_t get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
 
 static const char* codec_type_name(codec_type_t codec)
 {
@@ -40,56 +63,96 @@ static const char* codec_type_name(codec_type_t codec)
     }
 }
 
-static codec_type_t detect_rtp_codec(const uint8_t* payload, int payload_len)
+/*
+ * Codec detection from RTP payload headers.
+ * Parameter sets identify the codec: H.264 SPS/PPS headers (0x67/0x68) are invalid H.265 headers and
+ * H.265 VPS/SPS/PPS carry a nuh_temporal_id_plus1 byte. Without them, the codec with fewer invalid
+ * headers wins once enough packets were seen.
+ */
+#define CODEC_PROBE_MIN_PACKETS 30
+#define CODEC_PROBE_MAX_PACKETS 300
+
+struct codec_probe_t {
+    int packets;
+    int h264_invalid;
+    int h265_invalid;
+    codec_type_t result;
+};
+
+static bool h264_header_valid(const uint8_t *p, int len)
+{
+    if (len < 1 || (p[0] & 0x80))
+        return false;
+    int type = p[0] & 0x1F;
+    return type >= 1 && type <= 29;     // 1..23 NAL units, 24..29 STAP/MTAP/FU
+}
+
+static bool h264_is_param_set(const uint8_t *p, int len)
 {
-    if (!payload || payload_len < 1)
-        return CODEC_UNKNOWN;
-
-    if (payload_len < 64)
-        return CODEC_UNKNOWN;
-
-    uint8_t nalu_hdr = payload[0];
-
-    // H.265
-    uint8_t h265_type = (nalu_hdr >> 1) & 0x3F;
-    printf("[ RTP DEMUXER ] NALU header: 0x%02X, H.265 type: %d\n", nalu_hdr, h265_type);
-    if ((h265_type >= 0 && h265_type <= 31) || (h265_type >= 32 && h265_type <= 34) || h265_type == 39)
-        return CODEC_H265;
-    if ((h265_type == 48 || h265_type == 49) && payload_len >= 3) {
-        uint8_t fu_h265_type = (payload[2] >> 1) & 0x3F;
-        if ((fu_h265_type >= 0 && fu_h265_type <= 31) || (fu_h265_type >= 32 && fu_h265_type <= 34) ||
-            fu_h265_type == 39)
-            return CODEC_H265;
-    }
+    int type = p[0] & 0x1F;
+    if (type == 24 && len > 3)          // STAP-A: first aggregated NAL
+        type = p[3] & 0x1F;
+    return type == 7 || type == 8;
+}
 
-    // H.264
-    uint8_t h264_type = nalu_hdr & 0x1F;
-    printf("[ RTP DEMUXER ] NALU header: 0x%02X, H.264 type: %d\n", nalu_hdr, h264_type);
-    if ((h264_type >= 1 && h264_type <= 23) || h264_type == 5)
-        return CODEC_H264;
-    if (h264_type == 28 || h264_type == 29) {
-        if (payload_len < 2)
-            return CODEC_UNKNOWN;
-        uint8_t fu_type = payload[1] & 0x1F;
-        if ((fu_type >= 1 && fu_type <= 23) || fu_type == 5)
-            return CODEC_H264;
-    }
+static bool h265_header_valid(const uint8_t *p, int len)
+{
+    if (len < 2 || (p[0] & 0x80))
+        return false;
+    int layer_id = ((p[0] & 0x01) << 5) | (p[1] >> 3);
+    int tid = p[1] & 0x07;
+    int type = (p[0] >> 1) & 0x3F;
+    if (layer_id != 0 || tid == 0)
+        return false;
+    return type <= 9 || (type >= 16 && type <= 21) || (type >= 32 && type <= 40) || type == 48 || type == 49;
+}
 
-    return CODEC_UNKNOWN;
+static bool h265_is_param_set(const uint8_t *p, int len)
+{
+    int type = (p[0] >> 1) & 0x3F;
+    if (type == 48 && len > 4)          // AP: first aggregated NAL
+        type = (p[4] >> 1) & 0x3F;
+    return type >= 32 && type <= 34;
 }
 
+static codec_type_t codec_probe_input(struct codec_probe_t *probe, const uint8_t *payload, int len)
+{
+    if (probe->result != CODEC_UNKNOWN || !payload || len < 1)
+        return probe->result;
+
+    bool h264_ok = h264_header_valid(payload, len);
+    bool h265_ok = h265_header_valid(payload, len);
+    probe->packets++;
+    probe->h264_invalid += !h264_ok;
+    probe->h265_invalid += !h265_ok;
+
+    if (h265_ok && h265_is_param_set(payload, len)) {
+        probe->result = CODEC_H265;
+    } else if (h264_ok && h264_is_param_set(payload, len)) {
+        probe->result = CODEC_H264;
+    } else if (probe->packets >= CODEC_PROBE_MIN_PACKETS) {
+        if (probe->h265_invalid >= 3 && probe->h265_invalid > 3 * probe->h264_invalid)
+            probe->result = CODEC_H264;
+        else if (probe->h264_invalid >= 3 && probe->h264_invalid > 3 * probe->h265_invalid)
+            probe->result = CODEC_H265;
+        else if (probe->packets >= CODEC_PROBE_MAX_PACKETS)
+            probe->result = probe->h264_invalid < probe->h265_invalid ? CODEC_H264 : CODEC_H265;
+    }
+
+    if (probe->result != CODEC_UNKNOWN) {
+        printf("[ RTP DEMUXER ] Detected codec: %s after %d packets (invalid headers: H.264 %d, H.265 %d)\n",
+               codec_type_name(probe->result), probe->packets, probe->h264_invalid, probe->h265_invalid);
+    }
+    return probe->result;
+}
 
 // callback for codec detection, called until the codec is found
 static int detect_codec_cb(void* param, const void* packet, int bytes, uint32_t timestamp, int flags)
 {
-    codec_type_t* codec_ptr = (codec_type_t*)param;
-    codec_type_t codec = detect_rtp_codec(packet, bytes);
-    if (codec != CODEC_UNKNOWN) {
-        *codec_ptr = codec;
-        printf("[ RTP DEMUXER ] Detected codec: %s\n", codec_type_name(codec));
-        return 1; // Stop demuxing after detection
-    }
-    return 0; // Continue demuxing
+    (void)timestamp;
+    (void)flags;
+    struct codec_probe_t *probe = (struct codec_probe_t *)param;
+    return codec_probe_input(probe, packet, bytes) != CODEC_UNKNOWN; // Stop demuxing after detection
 }
 
 // Main callback for packet processing after codec is known
@@ -116,6 +179,14 @@ static int main_rtp_cb(void* param, const void* packet, int bytes, uint32_t time
     }
 #endif
 
+    /* remember parameter sets of this drone for the next start */
+    struct nal_info_t nal;
+    if (nal_parse(cfg->codec, packet, bytes, &nal) == 0 && nal_is_param_set(&nal)) {
+        if (param_cache_update(&stream_params, &nal, packet, bytes) && param_cache_complete(&stream_params)) {
+            param_cache_save(drone_key, &stream_params);
+        }
+    }
+
     decoder_put_frame(cfg, (void*)packet, bytes);
 
     return 0;
@@ -138,19 +209,52 @@ void encoder_hw_init(struct config_t *ctx)
     decoder_start(ctx);
 }
 
-static void* rtp_receiver_thread(void *arg)
+// Create the decoder for ctx->codec and the demuxer feeding it
+static struct rtp_demuxer_t *rtp_start_decoding(struct config_t *ctx, const struct stream_params_t *cached)
 {
-    if (!arg) {
-        fprintf(stderr, "[ RTP ] Invalid context provided to RTP receiver thread\n");
+    const char *codec_name = NULL;
+    if (ctx->codec == CODEC_H264) {
+        codec_name = "H264";
+    } else if (ctx->codec == CODEC_H265) {
+        codec_name = "H265";
+    } else {
+        fprintf(stderr, "[ RTP ] Unsupported codec detected: %s\n", codec_type_name(ctx->codec));
         return NULL;
     }
+    ctx->pt = RTP_PAYLOAD_DYNAMIC;
 
-    struct config_t *ctx = (struct config_t *)arg;
+    // HW encoder initialization (replace with your code)
+    encoder_hw_init(ctx);
 
-    printf("[ RTP ] Starting RTP receiver thread on %s:%d\n", ctx->ip, ctx->port);
+    if (cached) {
+        /* size decoder/display buffers and feed the parameter sets before the first packet */
+        decoder_prepare(cached->width, cached->height);
+        for (int i = 0; i < PARAM_SET_COUNT; i++) {
+            if (cached->sets[i].size > 0)
+                decoder_put_frame(ctx, (void *)cached->sets[i].data, cached->sets[i].size);
+        }
+        stream_params = *cached;
+    } else {
+        memset(&stream_params, 0, sizeof(stream_params));
+        stream_params.codec = ctx->codec;
+    }
 
+    // Create main demuxer for packet processing
+    struct rtp_demuxer_t *demuxer = rtp_demuxer_create(
+            10, 90000, ctx->pt,
+            codec_name,
+            main_rtp_cb, ctx
+    );
+    if (!demuxer) {
+        fprintf(stderr, "[ RTP ] Failed to create main RTP demuxer\n");
+    }
+    return demuxer;
+}
+
+static int rtp_open_socket(const struct config_t *ctx)
+{
     int sock = socket(AF_INET, SOCK_DGRAM, 0);
-    if (sock < 0) { perror("socket"); return NULL; }
+    if (sock < 0) { perror("socket"); return -1; }
 
     struct sockaddr_in addr = {0};
     addr.sin_family = AF_INET;
@@ -158,98 +262,172 @@ static void* rtp_receiver_thread(void *arg)
     if (inet_aton(ctx->ip, &addr.sin_addr) == 0) {
         fprintf(stderr, "[ RTP ] Invalid IP: %s\n", ctx->ip);
         close(sock);
-        return NULL;
+        return -1;
     }
     if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
-        perror("bind"); close(sock); return NULL;
+        perror("bind"); close(sock); return -1;
     }
 
     printf("[ RTP ] Listening on %s:%d\n", ctx->ip, ctx->port);
+    return sock;
+}
 
-    // RTP demuxer for detection
-    uint8_t buffer[1600];
-    struct pollfd fds[] = { { .fd = sock, .events = POLLIN } };
-    codec_type_t detected_codec = CODEC_UNKNOWN;
-    struct rtp_demuxer_t* demuxer = rtp_demuxer_create(
-            100, 90000, ctx->pt, NULL, detect_codec_cb, &detected_codec
-    );
-    if (!demuxer) {
-        fprintf(stderr, "[ RTP ] Failed to create RTP demuxer for detection\n");
-        close(sock);
-        return NULL;
+/* Next datagram from the socket or the replay file: size, 0 if none yet, -1 when the input ended */
+static int rtp_read_packet(int sock, struct rtp_replay_t *replay, uint8_t *buffer, int size,
+                           struct sockaddr_in *peer)
+{
+    if (replay) {
+        int n = rtp_replay_read(replay, buffer, size);
+        peer->sin_addr = rtp_replay_source(replay);
+        return n;
     }
 
-    // Wait until codec is detected (single-thread, blocking)
-    while (running && detected_codec == CODEC_UNKNOWN) {
-        int ret = poll(fds, 1, 5000);
-        if (ret < 0) { if (errno == EINTR) continue; perror("poll"); break; }
-        if (ret == 0) continue;
-        if (fds[0].revents & POLLIN) {
-            struct sockaddr_in peer; socklen_t len = sizeof(peer);
-            ssize_t n = recvfrom(sock, buffer, sizeof(buffer), 0, (struct sockaddr*)&peer, &len);
-            if (n > 0) rtp_demuxer_input(demuxer, buffer, (int)n);
-        }
+    struct pollfd fds[] = { { .fd = sock, .events = POLLIN } };
+    int ret = poll(fds, 1, 1000);
+    if (ret < 0) {
+        if (errno == EINTR)
+            return 0;
+        perror("poll");
+        return -1;
     }
-    rtp_demuxer_destroy(&demuxer);
+    if (ret == 0 || !(fds[0].revents & POLLIN))
+        return 0;
 
-    if (detected_codec == CODEC_UNKNOWN) {
-        fprintf(stderr, "[ RTP ] Failed to detect codec from RTP stream!\n");
-        if (sock > 0) {
-            close(sock);
-        }
-        rtp_receiver_stop();
+    socklen_t len = sizeof(*peer);
+    ssize_t n = recvfrom(sock, buffer, (size_t)size, 0, (struct sockaddr*)peer, &len);
+    return n > 0 ? (int)n : 0;
+}
+
+static void* rtp_receiver_thread(void *arg)
+{
+    if (!arg) {
+        fprintf(stderr, "[ RTP ] Invalid context provided to RTP receiver thread\n");
         return NULL;
     }
 
-    ctx->codec = detected_codec;
-    ctx->pt = RTP_PAYLOAD_DYNAMIC;
-
-    // HW encoder initialization (replace with your code)
-    encoder_hw_init(ctx);
-    char *codec_name = NULL;
-    if (ctx->codec == CODEC_H264) {
-        codec_name = "H264";
-    } else if (ctx->codec == CODEC_H265) {
-        codec_name = "H265";
+    struct config_t *ctx = (struct config_t *)arg;
+    bench_thread_register("rtp");
+    TRACE_THREAD("rtp");
+
+    int sock = -1;
+    struct rtp_replay_t *replay = NULL;
+    if (ctx->replay_file) {
+        printf("[ RTP ] Starting RTP receiver thread on %s\n", ctx->replay_file);
+        replay = rtp_replay_open(ctx->replay_file, ctx->replay_speed);
+        if (!replay) {
+            input_done = true;
+            return NULL;
+        }
     } else {
-        fprintf(stderr, "[ RTP ] Unsupported codec detected: %s\n", codec_type_name(ctx->codec));
-        close(sock);
-        return NULL;
+        printf("[ RTP ] Starting RTP receiver thread on %s:%d\n", ctx->ip, ctx->port);
+        sock = rtp_open_socket(ctx);
+        if (sock < 0)
+            return NULL;
     }
 
+    struct rtp_capture_t *capture = ctx->capture_file ? rtp_capture_start(ctx->capture_file) : NULL;
 
-    // Create main demuxer for packet processing
-    demuxer = rtp_demuxer_create(
-            10, 90000, ctx->pt,
-            codec_name,
-            main_rtp_cb, ctx
+    // RTP demuxer for detection, also verifies the cached codec
+    uint8_t buffer[1600];
+    struct codec_probe_t probe = {0};
+    struct rtp_demuxer_t* probe_demuxer = rtp_demuxer_create(
+            100, 90000, ctx->pt, NULL, detect_codec_cb, &probe
     );
-    if (!demuxer) {
-        fprintf(stderr, "[ RTP ] Failed to create main RTP demuxer\n");
-        close(sock);
-        return NULL;
+    if (!probe_demuxer) {
+        fprintf(stderr, "[ RTP ] Failed to create RTP demuxer for detection\n");
+        goto out;
+    }
+
+    // Start decoding right away with the parameters of the drone used last time.
+    // Replays always start cold so runs do not depend on the cache contents.
+    struct rtp_demuxer_t* demuxer = NULL;
+    struct stream_params_t cached;
+    cache_used = false;
+    drone_key[0] = '\0';
+    if (!replay && param_cache_load_last(&cached, drone_key, sizeof(drone_key)) == 0) {
+        printf("[ RTP ] Using cached stream parameters of %s: %s %dx%d\n",
+               drone_key, codec_type_name(cached.codec), cached.width, cached.height);
+        ctx->codec = cached.codec;
+        demuxer = rtp_start_decoding(ctx, &cached);
+        cache_used = demuxer != NULL;
     }
 
     // packet reception loop
     while (running) {
-        int ret = poll(fds, 1, 1000);
-        if (ret < 0) { if (errno == EINTR) continue; perror("poll"); break; }
-        if (ret == 0) continue;
-        if (fds[0].revents & POLLIN) {
-            struct sockaddr_in peer; socklen_t len = sizeof(peer);
-            ssize_t n = recvfrom(sock, buffer, sizeof(buffer), 0, (struct sockaddr*)&peer, &len);
-            if (n > 0) rtp_demuxer_input(demuxer, buffer, (int)n);
+        struct sockaddr_in peer = {0};
+        int n = rtp_read_packet(sock, replay, buffer, sizeof(buffer), &peer);
+        if (n < 0)
+            break;
+        if (n == 0)
+            continue;
+        TRACE_INSTANT(TRACE_RTP_RECV, n);
+        rtp_capture_packet(capture, buffer, n, &peer);
+        bench_count_packet(n);
+
+        if (!first_packet_us) {
+            first_packet_us = get_time_us();
+            const char *peer_ip = inet_ntoa(peer.sin_addr);
+            if (strcmp(peer_ip, drone_key) != 0) {
+                /* another drone: its parameter sets will be stored under its own key */
+                snprintf(drone_key, sizeof(drone_key), "%s", replay ? "" : peer_ip);
+                for (int i = 0; i < PARAM_SET_COUNT; i++)
+                    stream_params.sets[i].size = 0;
+            }
+        }
+
+        if (probe_demuxer) {
+            rtp_demuxer_input(probe_demuxer, buffer, n);
+            if (probe.result != CODEC_UNKNOWN) {
+                rtp_demuxer_destroy(&probe_demuxer);
+                if (demuxer && probe.result != ctx->codec) {
+                    printf("[ RTP ] Stream is %s, cached parameters were %s: restarting decoder\n",
+                           codec_type_name(probe.result), codec_type_name(ctx->codec));
+                    rtp_demuxer_destroy(&demuxer);
+                    decoder_stop();
+                    cache_used = false;
+                }
+                if (!demuxer) {
+                    ctx->codec = probe.result;
+                    demuxer = rtp_start_decoding(ctx, NULL);
+                    if (!demuxer)
+                        break;
+                }
+            }
+        }
+
+        if (demuxer) {
+            TRACE_BEGIN(t_unpack);
+            rtp_demuxer_input(demuxer, buffer, n);
+            TRACE_END(TRACE_RTP_UNPACK, t_unpack, n);
         }
     }
 
-    rtp_demuxer_destroy(&demuxer);
-    close(sock);
+    if (probe_demuxer)
+        rtp_demuxer_destroy(&probe_demuxer);
+    if (demuxer)
+        rtp_demuxer_destroy(&demuxer);
+out:
+    rtp_capture_stop(capture);
+    rtp_replay_close(replay);
+    if (sock >= 0)
+        close(sock);
+    input_done = true;
+    bench_thread_exit("rtp");
 
     printf("[ RTP ] Exiting RTP receiver thread\n");
 
     return NULL;
 }
 
+void rtp_receiver_first_frame(void)
+{
+    uint64_t now = get_time_us();
+    printf("[ RTP ] Time to first frame: %.1f ms after start, %.1f ms after first packet (cached parameters: %s)\n",
+           (now - start_us) / 1000.0,
+           first_packet_us ? (now - first_packet_us) / 1000.0 : 0.0,
+           cache_used ? "yes" : "no");
+}
+
 int rtp_receiver_start(struct config_t *cfg)
 {
     if (running) {
@@ -257,9 +435,17 @@ int rtp_receiver_start(struct config_t *cfg)
         return -1;
     }
     running = true;
+    input_done = false;
+    start_us = get_time_us();
+    first_packet_us = 0;
     return pthread_create(&rtp_thread, NULL, rtp_receiver_thread, cfg);
 }
 
+bool rtp_receiver_input_done(void)
+{
+    return input_done;
+}
+
 void rtp_receiver_stop(void)
 {
     if (!running) {
@@ -9,4 +9,19 @@
 int rtp_receiver_start(struct config_t *cfg);
 void rtp_receiver_stop(void);
 
+/** The replay file ended (or could not be opened), no more packets will arrive */
+bool rtp_receiver_input_done(void);
+
+/**
+ * Input is a replay without pacing: decoders apply backpressure instead of dropping,
+ * so every run decodes the same frames.
+ */
+static inline bool rtp_receiver_unpaced(const struct config_t *cfg)
+{
+    return cfg->replay_file && cfg->replay_speed <= 0;
+}
+
+/** Called by the decoder once the first frame is shown, reports time to first frame */
+void rtp_receiver_first_frame(void);
+
 #endif //VRX_RTP_RECEIVER_H
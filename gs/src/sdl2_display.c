@@ -6,6 +6,7 @@
 
 #include "sdl2_display.h"
 #include "sdl2_lvgl_input.h"
+#include "trace.h"
 #include <SDL2/SDL.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -17,6 +18,9 @@
 #define INITIAL_WIDTH   1280
 #define INITIAL_HEIGHT  720
 
+/* Damaged OSD regions kept for the next texture upload, more upload the whole overlay */
+#define OSD_MAX_DAMAGE  32
+
 typedef struct {
     SDL_mutex   *lock;
     uint8_t     *y_plane;
@@ -50,6 +54,9 @@ typedef struct {
 
     SDL_mutex    *osd_lock;
     bool          osd_dirty;
+    struct osd_rect_t osd_damage[OSD_MAX_DAMAGE];
+    int           osd_damage_count;
+    bool          osd_damage_full;
 
     volatile bool      quit;
 
@@ -326,6 +333,7 @@ int sdl2_display_init(struct config_t *cfg)
     }
 
     g_sdl.osd_dirty   = true; /* force first render */
+    g_sdl.osd_damage_full = true;
     g_sdl.quit        = false;
     g_sdl.osd_done_cb = NULL;
     g_sdl.fullscreen  = false;
@@ -468,6 +476,12 @@ int sdl2_push_new_video_frame(const uint8_t *y, const uint8_t *u, const uint8_t
  * Can be called from ANY thread (e.g. OSD/overlay thread).
  */
 int sdl2_push_new_osd_frame(const void *src_addr, int width, int height)
+{
+    return sdl2_push_new_osd_frame_damage(src_addr, width, height, NULL, 0);
+}
+
+int sdl2_push_new_osd_frame_damage(const void *src_addr, int width, int height,
+                                   const struct osd_rect_t *damage, int count)
 {
     if (!g_sdl.overlay_buffer || !g_sdl.osd_lock || g_sdl.quit)
         return -1;
@@ -487,10 +501,33 @@ int sdl2_push_new_osd_frame(const void *src_addr, int width, int height)
     if (copy_h > g_sdl.overlay_buf_h)
         copy_h = g_sdl.overlay_buf_h;
 
-    for (int y = 0; y < copy_h; ++y) {
-        memcpy(dst + y * g_sdl.overlay_buf_w,
-               src + y * width,
-               (size_t)copy_w * 4);
+    struct osd_rect_t full = { 0, 0, copy_w, copy_h };
+    if (!damage) {
+        damage = &full;
+        count = 1;
+        g_sdl.osd_damage_full = true;
+    }
+    for (int i = 0; i < count; ++i) {
+        struct osd_rect_t r = damage[i];
+        if (r.x < 0) { r.w += r.x; r.x = 0; }
+        if (r.y < 0) { r.h += r.y; r.y = 0; }
+        if (r.x + r.w > copy_w)
+            r.w = copy_w - r.x;
+        if (r.y + r.h > copy_h)
+            r.h = copy_h - r.y;
+        if (r.w <= 0 || r.h <= 0)
+            continue;
+
+        for (int y = r.y; y < r.y + r.h; ++y) {
+            memcpy(dst + y * g_sdl.overlay_buf_w + r.x,
+                   src + y * width + r.x,
+                   (size_t)r.w * 4);
+        }
+        /* remembered until the main thread uploads them */
+        if (g_sdl.osd_damage_count < OSD_MAX_DAMAGE)
+            g_sdl.osd_damage[g_sdl.osd_damage_count++] = r;
+        else
+            g_sdl.osd_damage_full = true;
     }
 
     g_sdl.osd_dirty = true;
@@ -535,6 +572,7 @@ int sdl2_display_poll(void)
         return -1;
 
     SDL_GetWindowSize(g_sdl.window, &g_sdl.win_w, &g_sdl.win_h);
+    TRACE_BEGIN(t_present);
 
     /* Update video texture from latest YUV frame (or keep last) */
     SDL_LockMutex(g_video.lock);
@@ -558,13 +596,19 @@ int sdl2_display_poll(void)
     }
     SDL_UnlockMutex(g_video.lock);
 
-    /* Upload overlay buffer to overlay texture if dirty */
+    /* Upload overlay buffer to overlay texture if dirty, only the damaged regions when known */
+    struct osd_rect_t damage[OSD_MAX_DAMAGE];
     SDL_LockMutex(g_sdl.osd_lock);
     bool osd_dirty = g_sdl.osd_dirty;
+    bool damage_full = g_sdl.osd_damage_full;
+    int damage_count = g_sdl.osd_damage_count;
+    memcpy(damage, g_sdl.osd_damage, (size_t)damage_count * sizeof(damage[0]));
     g_sdl.osd_dirty = false;
+    g_sdl.osd_damage_full = false;
+    g_sdl.osd_damage_count = 0;
     SDL_UnlockMutex(g_sdl.osd_lock);
 
-    if (g_sdl.overlay_tex && g_sdl.overlay_buffer && osd_dirty) {
+    if (g_sdl.overlay_tex && g_sdl.overlay_buffer && osd_dirty && damage_full) {
         void *tex_pixels;
         int tex_pitch;
         if (SDL_LockTexture(g_sdl.overlay_tex, NULL, &tex_pixels, &tex_pitch) == 0) {
@@ -579,6 +623,16 @@ int sdl2_display_poll(void)
             }
             SDL_UnlockTexture(g_sdl.overlay_tex);
         }
+    } else if (g_sdl.overlay_tex && g_sdl.overlay_buffer && osd_dirty) {
+        for (int i = 0; i < damage_count; ++i) {
+            struct osd_rect_t *r = &damage[i];
+            if (r->x + r->w > g_sdl.overlay_tex_w || r->y + r->h > g_sdl.overlay_tex_h)
+                continue;
+            SDL_Rect rect = { r->x, r->y, r->w, r->h };
+            SDL_UpdateTexture(g_sdl.overlay_tex, &rect,
+                              g_sdl.overlay_buffer + r->y * g_sdl.overlay_buf_w + r->x,
+                              g_sdl.overlay_buf_w * 4);
+        }
     }
 
     int logical_w = g_sdl.overlay_tex_w;
@@ -609,6 +663,7 @@ int sdl2_display_poll(void)
     }
 
     SDL_RenderPresent(g_sdl.renderer);
+    TRACE_END(TRACE_SDL_PRESENT, t_present, 0);
 
     if (g_sdl.osd_done_cb) {
         g_sdl.osd_done_cb();
@@ -35,6 +35,13 @@ void sdl2_set_osd_frame_done_callback(drm_osd_frame_done_cb_t cb);
  */
 int sdl2_push_new_osd_frame(const void *src_addr, int width, int height);
 
+/**
+ * The same, only the count damage rects of src_addr changed since the previous frame: just they are
+ * copied and uploaded to the overlay texture. damage NULL is the whole frame.
+ */
+int sdl2_push_new_osd_frame_damage(const void *src_addr, int width, int height,
+                                   const struct osd_rect_t *damage, int count);
+
 /**
  * Process SDL events and render a frame if needed.
  * Must be called regularly from the main thread (e.g. in main loop).
@@ -0,0 +1,230 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "trace.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#define TRACE_RING_MASK         (TRACE_RING_EVENTS - 1)
+
+/*
+ * A slot is a seqlock of its own: the writer clears seq, fills the slot and sets seq to its
+ * sequence number + 1. The dump takes a slot only when seq is that number before and after copying
+ * it, so a slot overwritten meanwhile is left out instead of torn.
+ */
+struct trace_event_t {
+    atomic_uint seq;
+    uint32_t arg;
+    uint64_t begin;
+    uint64_t end;
+    uint32_t point;
+};
+
+struct trace_ring_t {
+    atomic_uint head;           // events recorded, only the owner writes it
+    int tid;
+    char name[32];
+    struct trace_event_t events[TRACE_RING_EVENTS];
+};
+
+static const struct {
+    const char *name;
+    const char *cat;
+    const char *arg;            // NULL: no argument
+} trace_points[TRACE_POINT_COUNT] = {
+    [TRACE_RTP_RECV]    = { "rtp_recv",     "rtp",     "bytes" },
+    [TRACE_RTP_UNPACK]  = { "rtp_unpack",   "rtp",     "bytes" },
+    [TRACE_DECODER_PUT] = { "decoder_put",  "decoder", "bytes" },
+    [TRACE_DECODER_GET] = { "decoder_get",  "decoder", "latency_ms" },
+    [TRACE_VIDEO_PUSH]  = { "video_push",   "display", NULL },
+    [TRACE_DRM_COMMIT]  = { "drm_commit",   "display", NULL },
+    [TRACE_DRM_FLIP]    = { "drm_flip",     "display", "vblank" },
+    [TRACE_SDL_PRESENT] = { "sdl_present",  "display", NULL },
+    [TRACE_OSD_RENDER]  = { "osd_render",   "osd",     NULL },
+    [TRACE_LVGL_PASS]   = { "lvgl_pass",    "ui",      "next_ms" },
+    [TRACE_LVGL_FLUSH]  = { "lvgl_flush",   "ui",      NULL },
+};
+
+static _Atomic(struct trace_ring_t *) rings[TRACE_MAX_THREADS];
+static atomic_int ring_count = 0;
+static atomic_uint threads_dropped = 0;
+static atomic_int dump_requested = 0;
+static __thread struct trace_ring_t *self = NULL;
+static __thread int self_failed = 0;
+
+static struct trace_ring_t *trace_ring_self(void)
+{
+    if (self || self_failed)
+        return self;
+
+    struct trace_ring_t *ring = calloc(1, sizeof(*ring));
+    int idx = ring ? atomic_fetch_add(&ring_count, 1) : TRACE_MAX_THREADS;
+    if (idx >= TRACE_MAX_THREADS) {
+        // Threads past the limit record nothing
+        free(ring);
+        self_failed = 1;
+        atomic_fetch_add(&threads_dropped, 1);
+        return NULL;
+    }
+    ring->tid = (int)syscall(SYS_gettid);
+    snprintf(ring->name, sizeof(ring->name), "thread %d", ring->tid);
+    // Published before the dump may see ring_count cover it
+    atomic_store_explicit(&rings[idx], ring, memory_order_release);
+    self = ring;
+    return ring;
+}
+
+void trace_record(trace_point_t point, uint64_t begin, uint64_t end, uint32_t arg)
+{
+    struct trace_ring_t *ring = trace_ring_self();
+    if (!ring)
+        return;
+
+    unsigned int h = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    struct trace_event_t *ev = &ring->events[h & TRACE_RING_MASK];
+
+    atomic_store_explicit(&ev->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    ev->begin = begin;
+    ev->end = end;
+    ev->arg = arg;
+    ev->point = point;
+    atomic_store_explicit(&ev->seq, h + 1, memory_order_release);
+    atomic_store_explicit(&ring->head, h + 1, memory_order_release);
+}
+
+void trace_thread_name(const char *name)
+{
+    struct trace_ring_t *ring = trace_ring_self();
+    if (ring)
+        snprintf(ring->name, sizeof(ring->name), "%s", name);
+}
+
+void trace_request_dump(void)
+{
+    atomic_store(&dump_requested, 1);
+}
+
+void trace_poll(void)
+{
+    if (!atomic_exchange(&dump_requested, 0))
+        return;
+
+    char path[128];
+    snprintf(path, sizeof(path), TRACE_DUMP_DIR "/vd-link-trace-%ld.json", (long)time(NULL));
+    int n = trace_dump(path);
+    if (n < 0)
+        printf("[ TRACE ] Can't write %s\n", path);
+    else
+        printf("[ TRACE ] Wrote %d events to %s\n", n, path);
+}
+
+static uint64_t trace_ticks_per_sec(void)
+{
+#if defined(__aarch64__)
+    uint64_t freq;
+    __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(freq));
+    return freq ? freq : 1000000000ULL;
+#else
+    return 1000000000ULL;
+#endif
+}
+
+static double trace_ticks_to_us(uint64_t ticks, uint64_t freq)
+{
+    // Whole seconds apart so large counter values keep their precision
+    return (double)(ticks / freq) * 1e6 + (double)(ticks % freq) * 1e6 / (double)freq;
+}
+
+/* Events of the ring still intact, oldest first */
+static unsigned int trace_ring_snapshot(struct trace_ring_t *ring, struct trace_event_t *out)
+{
+    unsigned int head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    unsigned int first = head > TRACE_RING_EVENTS ? head - TRACE_RING_EVENTS : 0;
+    unsigned int n = 0;
+
+    for (unsigned int i = first; i != head; i++) {
+        struct trace_event_t *ev = &ring->events[i & TRACE_RING_MASK];
+        unsigned int seq = atomic_load_explicit(&ev->seq, memory_order_acquire);
+        if (seq != i + 1)
+            continue;
+        out[n].begin = ev->begin;
+        out[n].end = ev->end;
+        out[n].arg = ev->arg;
+        out[n].point = ev->point;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&ev->seq, memory_order_relaxed) != seq || out[n].point >= TRACE_POINT_COUNT)
+            continue;
+        n++;
+    }
+    return n;
+}
+
+int trace_dump(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f)
+        return -1;
+
+    struct trace_event_t *snap = malloc(sizeof(*snap) * TRACE_RING_EVENTS);
+    if (!snap) {
+        fclose(f);
+        return -1;
+    }
+
+    uint64_t freq = trace_ticks_per_sec();
+    int pid = (int)getpid();
+    int threads = atomic_load(&ring_count);
+    if (threads > TRACE_MAX_THREADS)
+        threads = TRACE_MAX_THREADS;
+    int written = 0;
+    const char *sep = ",\n";   // after the process name
+
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"vd-link\"}}",
+            pid, pid);
+
+    for (int t = 0; t < threads; t++) {
+        struct trace_ring_t *ring = atomic_load_explicit(&rings[t], memory_order_acquire);
+        if (!ring)
+            continue;   // claimed, not published yet
+
+        char name[sizeof(ring->name)];
+        memcpy(name, ring->name, sizeof(name));
+        name[sizeof(name) - 1] = '\0';
+        fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                sep, pid, ring->tid, name);
+
+        unsigned int n = trace_ring_snapshot(ring, snap);
+        for (unsigned int i = 0; i < n; i++) {
+            const struct trace_event_t *ev = &snap[i];
+            double ts = trace_ticks_to_us(ev->begin, freq);
+
+            fprintf(f, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,",
+                    sep, trace_points[ev->point].name, trace_points[ev->point].cat, pid, ring->tid, ts);
+            if (ev->end > ev->begin)
+                fprintf(f, "\"ph\":\"X\",\"dur\":%.3f", trace_ticks_to_us(ev->end, freq) - ts);
+            else
+                fprintf(f, "\"ph\":\"i\",\"s\":\"t\"");
+            if (trace_points[ev->point].arg)
+                fprintf(f, ",\"args\":{\"%s\":%u}", trace_points[ev->point].arg, ev->arg);
+            fprintf(f, "}");
+        }
+        written += (int)n;
+    }
+
+    fprintf(f, "\n]}\n");
+    free(snap);
+
+    if (atomic_load(&threads_dropped))
+        printf("[ TRACE ] %u threads past %d were not traced\n", atomic_load(&threads_dropped), TRACE_MAX_THREADS);
+
+    if (fclose(f) != 0)
+        return -1;
+    return written;
+}
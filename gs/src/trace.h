@@ -0,0 +1,82 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_TRACE_H
+#define VD_LINK_TRACE_H
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * Pipeline trace points, built in with -DENABLE_TRACE=ON and gone without it (the macro arguments
+ * are not evaluated then). Each thread records into its own ring of the last TRACE_RING_EVENTS
+ * events without locking; SIGUSR1 or a long press on the LVGL perf monitor writes all rings as a
+ * Chrome trace (chrome://tracing, ui.perfetto.dev) to TRACE_DUMP_DIR.
+ * Timestamps are the generic timer counter on aarch64, CLOCK_MONOTONIC elsewhere.
+ */
+#define TRACE_RING_EVENTS       (1u << 14)      // per thread, a power of 2
+#define TRACE_MAX_THREADS       32
+#define TRACE_DUMP_DIR          "/tmp"
+
+typedef enum {
+    TRACE_RTP_RECV = 0,         // RTP packet read, arg: bytes
+    TRACE_RTP_UNPACK,           // depacketised into NAL units and fed on, arg: bytes
+    TRACE_DECODER_PUT,          // NAL unit into the decoder, arg: bytes
+    TRACE_DECODER_GET,          // decoded frame out, arg: ms since its input
+    TRACE_VIDEO_PUSH,           // decoded frame to the display
+    TRACE_DRM_COMMIT,           // atomic commit of the planes
+    TRACE_DRM_FLIP,             // commit to its page flip event, arg: vblank sequence
+    TRACE_SDL_PRESENT,          // textures updated and presented
+    TRACE_OSD_RENDER,           // MSP OSD character map drawn
+    TRACE_LVGL_PASS,            // lv_timer_handler(), arg: ms to its next timer
+    TRACE_LVGL_FLUSH,           // LVGL frame composed and pushed to the display
+    TRACE_POINT_COUNT
+} trace_point_t;
+
+#ifdef ENABLE_TRACE
+
+static inline uint64_t trace_now(void)
+{
+#if defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* Span from begin to end, trace_now() values; end == begin is an instant */
+void trace_record(trace_point_t point, uint64_t begin, uint64_t end, uint32_t arg);
+
+/* Name of the calling thread in the trace */
+void trace_thread_name(const char *name);
+
+/* Ask for a dump on the next trace_poll(). Async-signal-safe */
+void trace_request_dump(void);
+
+/* Write the dump asked for, if any. From a thread that may block on file I/O (main) */
+void trace_poll(void);
+
+/* All rings as Chrome trace JSON to path. Recording goes on meanwhile. Returns events written or -1 */
+int trace_dump(const char *path);
+
+#define TRACE_THREAD(name)              trace_thread_name(name)
+#define TRACE_POLL()                    trace_poll()
+#define TRACE_BEGIN(var)                uint64_t var = trace_now()
+#define TRACE_END(point, var, arg)      trace_record((point), (var), trace_now(), (uint32_t)(arg))
+#define TRACE_INSTANT(point, arg)       do { uint64_t t_ = trace_now(); trace_record((point), t_, t_, (uint32_t)(arg)); } while (0)
+
+#else
+
+#define TRACE_THREAD(name)              do { } while (0)
+#define TRACE_POLL()                    do { } while (0)
+#define TRACE_BEGIN(var)                do { } while (0)
+#define TRACE_END(point, var, arg)      do { } while (0)
+#define TRACE_INSTANT(point, arg)       do { } while (0)
+
+#endif // ENABLE_TRACE
+
+#endif //VD_LINK_TRACE_H
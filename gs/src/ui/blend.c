@@ -0,0 +1,458 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "blend.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BLEND_X86 1
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#define BLEND_ALPHA_MASK    0xFF000000u
+
+/* round(v / 255) for v <= 255 * 255, the same as (v + 127) / 255 without the division */
+static inline uint32_t div255(uint32_t v)
+{
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+static inline uint32_t blend_px_premul(uint32_t s, uint32_t d)
+{
+    uint32_t inv_sa = 255 - (s >> 24);
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t c = ((s >> shift) & 0xFF) + div255(((d >> shift) & 0xFF) * inv_sa);
+        out |= (c > 255 ? 255 : c) << shift;    // src color above its alpha, not premultiplied after all
+    }
+    return out;
+}
+
+static inline uint32_t blend_px_straight(uint32_t s, uint32_t d)
+{
+    uint32_t sa = s >> 24;
+    uint32_t inv_sa = 255 - sa;
+    uint32_t out = (sa + div255((d >> 24) * inv_sa)) << 24;
+    for (int shift = 0; shift < 24; shift += 8)
+        out |= div255(((s >> shift) & 0xFF) * sa + ((d >> shift) & 0xFF) * inv_sa) << shift;
+    return out;
+}
+
+static inline uint32_t blend_px(uint32_t s, uint32_t d, bool straight)
+{
+    uint32_t sa = s >> 24;
+    if (sa == 0)
+        return d;
+    if (sa == 255)
+        return s;
+    return straight ? blend_px_straight(s, d) : blend_px_premul(s, d);
+}
+
+/* Reference: one pixel at a time, rounding by division */
+static void blend_premul_scalar(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        uint32_t s = src[i];
+        uint32_t sa = s >> 24;
+        if (sa == 0)
+            continue;   // fully transparent src, keep dst
+        if (sa == 255) {
+            dst[i] = s;
+            continue;
+        }
+
+        uint32_t d = dst[i];
+        uint32_t inv_sa = 255 - sa;
+        uint32_t out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            uint32_t c = ((s >> shift) & 0xFF) + (((d >> shift) & 0xFF) * inv_sa + 127) / 255;
+            out |= (c > 255 ? 255 : c) << shift;
+        }
+        dst[i] = out;
+    }
+}
+
+static void blend_straight_scalar(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        uint32_t s = src[i];
+        uint32_t sa = s >> 24;
+        if (sa == 0)
+            continue;
+        if (sa == 255) {
+            dst[i] = s;
+            continue;
+        }
+
+        uint32_t d = dst[i];
+        uint32_t inv_sa = 255 - sa;
+        uint32_t out = (sa + ((d >> 24) * inv_sa + 127) / 255) << 24;
+        for (int shift = 0; shift < 24; shift += 8)
+            out |= ((((s >> shift) & 0xFF) * sa + ((d >> shift) & 0xFF) * inv_sa + 127) / 255) << shift;
+        dst[i] = out;
+    }
+}
+
+/* Portable: transparent and opaque spans of 16 pixels are found with two words of OR/AND */
+#define BLEND_GENERIC_SPAN  16
+
+static inline void blend_generic(const uint32_t *src, uint32_t *dst, size_t count, bool straight)
+{
+    size_t i = 0;
+    for (; i + BLEND_GENERIC_SPAN <= count; i += BLEND_GENERIC_SPAN) {
+        uint32_t any = 0, all = BLEND_ALPHA_MASK;
+        for (int k = 0; k < BLEND_GENERIC_SPAN; k++) {
+            any |= src[i + k];
+            all &= src[i + k];
+        }
+        if (!(any & BLEND_ALPHA_MASK))
+            continue;
+        if ((all & BLEND_ALPHA_MASK) == BLEND_ALPHA_MASK) {
+            memcpy(dst + i, src + i, BLEND_GENERIC_SPAN * sizeof(uint32_t));
+            continue;
+        }
+        for (int k = 0; k < BLEND_GENERIC_SPAN; k++)
+            dst[i + k] = blend_px(src[i + k], dst[i + k], straight);
+    }
+    for (; i < count; i++)
+        dst[i] = blend_px(src[i], dst[i], straight);
+}
+
+static void blend_premul_generic(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    blend_generic(src, dst, count, false);
+}
+
+static void blend_straight_generic(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    blend_generic(src, dst, count, true);
+}
+
+#ifdef BLEND_X86
+/*
+ * x86: pixels are widened to 16 bits per channel, so a vector of 4 (SSE2) or 8 (AVX2) pixels is
+ * multiplied as two halves. Spans of 16 / 32 pixels are checked for transparent or opaque first.
+ */
+#define BLEND_SSE2_SPAN     16
+#define BLEND_AVX2_SPAN     32
+
+static bool blend_cpu_sse2(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+static bool blend_cpu_avx2(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+__attribute__((target("sse2")))
+static inline __m128i div255_epu16_sse2(__m128i v)
+{
+    v = _mm_add_epi16(v, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(v, _mm_srli_epi16(v, 8)), 8);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i blend4_sse2(__m128i s, __m128i d, bool straight)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a = _mm_srli_epi32(s, 24);
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 8));
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 16));     // alpha in every byte of its pixel
+    __m128i inv = _mm_xor_si128(a, _mm_set1_epi8(-1));
+
+    __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(inv, zero));
+    __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(inv, zero));
+    if (straight) {
+        // src * alpha, the alpha channel itself * 255
+        __m128i mul = _mm_or_si128(a, _mm_set1_epi32((int)BLEND_ALPHA_MASK));
+        lo = _mm_add_epi16(lo, _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(mul, zero)));
+        hi = _mm_add_epi16(hi, _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(mul, zero)));
+        return _mm_packus_epi16(div255_epu16_sse2(lo), div255_epu16_sse2(hi));
+    }
+    __m128i out = _mm_adds_epu8(s, _mm_packus_epi16(div255_epu16_sse2(lo), div255_epu16_sse2(hi)));
+    __m128i clear = _mm_cmpeq_epi32(a, zero);       // transparent src keeps dst whatever its color
+    return _mm_or_si128(_mm_and_si128(clear, d), _mm_andnot_si128(clear, out));
+}
+
+__attribute__((target("sse2")))
+static inline void blend_sse2(const uint32_t *src, uint32_t *dst, size_t count, bool straight)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32((int)BLEND_ALPHA_MASK);
+    size_t i = 0;
+    for (; i + BLEND_SSE2_SPAN <= count; i += BLEND_SSE2_SPAN) {
+        __m128i s[4];
+        for (int k = 0; k < 4; k++)
+            s[k] = _mm_loadu_si128((const __m128i *)(src + i + k * 4));
+        __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(s[0], s[1]), _mm_or_si128(s[2], s[3])), amask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) == 0xFFFF)
+            continue;
+        __m128i all = _mm_and_si128(_mm_and_si128(_mm_and_si128(s[0], s[1]), _mm_and_si128(s[2], s[3])), amask);
+        bool opaque = _mm_movemask_epi8(_mm_cmpeq_epi32(all, amask)) == 0xFFFF;
+        for (int k = 0; k < 4; k++) {
+            __m128i *d = (__m128i *)(dst + i + k * 4);
+            _mm_storeu_si128(d, opaque ? s[k] : blend4_sse2(s[k], _mm_loadu_si128(d), straight));
+        }
+    }
+    for (; i + 4 <= count; i += 4) {
+        __m128i *d = (__m128i *)(dst + i);
+        _mm_storeu_si128(d, blend4_sse2(_mm_loadu_si128((const __m128i *)(src + i)), _mm_loadu_si128(d), straight));
+    }
+    for (; i < count; i++)
+        dst[i] = blend_px(src[i], dst[i], straight);
+}
+
+__attribute__((target("sse2")))
+static void blend_premul_sse2(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    blend_sse2(src, dst, count, false);
+}
+
+__attribute__((target("sse2")))
+static void blend_straight_sse2(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    blend_sse2(src, dst, count, true);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i div255_epu16_avx2(__m256i v)
+{
+    v = _mm256_add_epi16(v, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(v, _mm256_srli_epi16(v, 8)), 8);
+}
+
+/* unpack and pack work within 128-bit lanes, so the halves come back in order */
+__attribute__((target("avx2")))
+static inline __m256i blend8_avx2(__m256i s, __m256i d, bool straight)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i a = _mm256_srli_epi32(s, 24);
+    a = _mm256_or_si256(a, _mm256_slli_epi32(a, 8));
+    a = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+    __m256i inv = _mm256_xor_si256(a, _mm256_set1_epi8(-1));
+
+    __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(inv, zero));
+    __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(inv, zero));
+    if (straight) {
+        __m256i mul = _mm256_or_si256(a, _mm256_set1_epi32((int)BLEND_ALPHA_MASK));
+        lo = _mm256_add_epi16(lo, _mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(mul, zero)));
+        hi = _mm256_add_epi16(hi, _mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(mul, zero)));
+        return _mm256_packus_epi16(div255_epu16_avx2(lo), div255_epu16_avx2(hi));
+    }
+    __m256i out = _mm256_adds_epu8(s, _mm256_packus_epi16(div255_epu16_avx2(lo), div255_epu16_avx2(hi)));
+    __m256i clear = _mm256_cmpeq_epi32(a, zero);
+    return _mm256_blendv_epi8(out, d, clear);
+}
+
+__attribute__((target("avx2")))
+static inline void blend_avx2(const uint32_t *src, uint32_t *dst, size_t count, bool straight)
+{
+    const __m256i amask = _mm256_set1_epi32((int)BLEND_ALPHA_MASK);
+    size_t i = 0;
+    for (; i + BLEND_AVX2_SPAN <= count; i += BLEND_AVX2_SPAN) {
+        __m256i s[4];
+        for (int k = 0; k < 4; k++)
+            s[k] = _mm256_loadu_si256((const __m256i *)(src + i + k * 8));
+        __m256i any = _mm256_and_si256(_mm256_or_si256(_mm256_or_si256(s[0], s[1]), _mm256_or_si256(s[2], s[3])), amask);
+        if (_mm256_testz_si256(any, any))
+            continue;
+        __m256i all = _mm256_and_si256(_mm256_and_si256(_mm256_and_si256(s[0], s[1]), _mm256_and_si256(s[2], s[3])), amask);
+        bool opaque = _mm256_movemask_epi8(_mm256_cmpeq_epi32(all, amask)) == -1;
+        for (int k = 0; k < 4; k++) {
+            __m256i *d = (__m256i *)(dst + i + k * 8);
+            _mm256_storeu_si256(d, opaque ? s[k] : blend8_avx2(s[k], _mm256_loadu_si256(d), straight));
+        }
+    }
+    for (; i + 8 <= count; i += 8) {
+        __m256i *d = (__m256i *)(dst + i);
+        _mm256_storeu_si256(d, blend8_avx2(_mm256_loadu_si256((const __m256i *)(src + i)), _mm256_loadu_si256(d), straight));
+    }
+    for (; i < count; i++)
+        dst[i] = blend_px(src[i], dst[i], straight);
+}
+
+__attribute__((target("avx2")))
+static void blend_premul_avx2(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    blend_avx2(src, dst, count, false);
+}
+
+__attribute__((target("avx2")))
+static void blend_straight_avx2(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    blend_avx2(src, dst, count, true);
+}
+#endif
+
+#if defined(__ARM_NEON)
+/*
+ * NEON: vld4 splits 16 pixels into a register per channel, so alpha is checked for the whole span
+ * at once and each channel is multiplied without shuffles. Always there on AArch64.
+ */
+#define BLEND_NEON_SPAN     16
+
+static inline uint8_t neon_max_u8(uint8x16_t v)
+{
+#if defined(__aarch64__)
+    return vmaxvq_u8(v);
+#else
+    uint8x8_t m = vpmax_u8(vget_low_u8(v), vget_high_u8(v));
+    m = vpmax_u8(m, m);
+    m = vpmax_u8(m, m);
+    m = vpmax_u8(m, m);
+    return vget_lane_u8(m, 0);
+#endif
+}
+
+static inline uint8_t neon_min_u8(uint8x16_t v)
+{
+#if defined(__aarch64__)
+    return vminvq_u8(v);
+#else
+    uint8x8_t m = vpmin_u8(vget_low_u8(v), vget_high_u8(v));
+    m = vpmin_u8(m, m);
+    m = vpmin_u8(m, m);
+    m = vpmin_u8(m, m);
+    return vget_lane_u8(m, 0);
+#endif
+}
+
+/* (v + 128 + ((v + 128) >> 8)) >> 8, narrowed */
+static inline uint8x8_t div255_u16_neon(uint16x8_t v)
+{
+    return vraddhn_u16(v, vrshrq_n_u16(v, 8));
+}
+
+static inline uint8x16_t mul255_neon(uint8x16_t x, uint8x16_t m)
+{
+    return vcombine_u8(div255_u16_neon(vmull_u8(vget_low_u8(x), vget_low_u8(m))),
+                       div255_u16_neon(vmull_u8(vget_high_u8(x), vget_high_u8(m))));
+}
+
+static inline uint8x16_t lerp255_neon(uint8x16_t s, uint8x16_t d, uint8x16_t a, uint8x16_t inv)
+{
+    uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(s), vget_low_u8(a)), vget_low_u8(d), vget_low_u8(inv));
+    uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(s), vget_high_u8(a)), vget_high_u8(d), vget_high_u8(inv));
+    return vcombine_u8(div255_u16_neon(lo), div255_u16_neon(hi));
+}
+
+static inline void blend_neon(const uint32_t *src, uint32_t *dst, size_t count, bool straight)
+{
+    size_t i = 0;
+    for (; i + BLEND_NEON_SPAN <= count; i += BLEND_NEON_SPAN) {
+        uint8x16x4_t s = vld4q_u8((const uint8_t *)(src + i));
+        uint8x16_t a = s.val[3];
+        if (neon_max_u8(a) == 0)
+            continue;
+        if (neon_min_u8(a) == 255) {
+            vst4q_u8((uint8_t *)(dst + i), s);
+            continue;
+        }
+
+        uint8x16x4_t d = vld4q_u8((const uint8_t *)(dst + i));
+        uint8x16_t inv = vmvnq_u8(a);
+        uint8x16x4_t out;
+        if (straight) {
+            for (int c = 0; c < 3; c++)
+                out.val[c] = lerp255_neon(s.val[c], d.val[c], a, inv);
+            out.val[3] = vqaddq_u8(a, mul255_neon(d.val[3], inv));
+        } else {
+            uint8x16_t clear = vceqq_u8(a, vdupq_n_u8(0));
+            for (int c = 0; c < 4; c++)
+                out.val[c] = vbslq_u8(clear, d.val[c], vqaddq_u8(s.val[c], mul255_neon(d.val[c], inv)));
+        }
+        vst4q_u8((uint8_t *)(dst + i), out);
+    }
+    for (; i < count; i++)
+        dst[i] = blend_px(src[i], dst[i], straight);
+}
+
+static void blend_premul_neon(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    blend_neon(src, dst, count, false);
+}
+
+static void blend_straight_neon(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    blend_neon(src, dst, count, true);
+}
+#endif
+
+/* Slowest first, blend_init takes the last one the CPU runs */
+static const struct blend_impl_t g_impls[] = {
+    { "scalar",  NULL, blend_premul_scalar,  blend_straight_scalar },
+    { "generic", NULL, blend_premul_generic, blend_straight_generic },
+#ifdef BLEND_X86
+    { "sse2",    blend_cpu_sse2, blend_premul_sse2, blend_straight_sse2 },
+    { "avx2",    blend_cpu_avx2, blend_premul_avx2, blend_straight_avx2 },
+#endif
+#if defined(__ARM_NEON)
+    { "neon",    NULL, blend_premul_neon,    blend_straight_neon },
+#endif
+};
+
+#define BLEND_IMPL_COUNT    ((int)(sizeof(g_impls) / sizeof(g_impls[0])))
+
+static const struct blend_impl_t *g_impl = &g_impls[1];
+
+void blend_init(void)
+{
+    for (int i = 0; i < BLEND_IMPL_COUNT; i++) {
+        if (!g_impls[i].supported || g_impls[i].supported())
+            g_impl = &g_impls[i];
+    }
+    printf("[ UI ] Blend: %s\n", g_impl->name);
+}
+
+const struct blend_impl_t *blend_impl(void)
+{
+    return g_impl;
+}
+
+const struct blend_impl_t *blend_impls(int *count)
+{
+    *count = BLEND_IMPL_COUNT;
+    return g_impls;
+}
+
+void blend_src_over_premul(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    g_impl->premul(src, dst, count);
+}
+
+void blend_src_over_straight(const uint32_t *src, uint32_t *dst, size_t count)
+{
+    g_impl->straight(src, dst, count);
+}
+
+void blend_indexed_src_over(const uint8_t *src, const uint32_t *palette, uint32_t *dst, size_t count)
+{
+    size_t i = 0;
+    while (i < count) {
+        // 8 transparent indexes at a time
+        uint64_t span;
+        if (i + sizeof(span) <= count) {
+            memcpy(&span, src + i, sizeof(span));
+            if (!span) {
+                i += sizeof(span);
+                continue;
+            }
+        }
+        size_t end = i + sizeof(span) < count ? i + sizeof(span) : count;
+        for (; i < end; i++) {
+            if (src[i])
+                dst[i] = blend_px(palette[src[i]], dst[i], false);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_BLEND_H
+#define VD_LINK_BLEND_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * SRC_OVER of 32-bit pixels with alpha in the top byte (BGRA/RGBA in memory, the channel order
+ * doesn't matter). dst and the result are premultiplied.
+ *  premul   - src is premultiplied: out = src + dst * (1 - src_alpha)
+ *  straight - src color is not:     out = src * src_alpha + dst * (1 - src_alpha)
+ * Channels are rounded to nearest, every implementation gives the same bytes as the scalar one.
+ * Spans of fully transparent src are skipped, fully opaque ones copied.
+ */
+typedef void (*blend_fn_t)(const uint32_t *src, uint32_t *dst, size_t count);
+
+struct blend_impl_t {
+    const char *name;
+    bool (*supported)(void);    // CPU check, NULL if the build target always has it
+    blend_fn_t premul;
+    blend_fn_t straight;
+};
+
+/** Select the fastest implementation the CPU runs. Without it the baseline of the build target is used */
+void blend_init(void);
+
+/* The selected implementation */
+const struct blend_impl_t *blend_impl(void);
+
+/* All implementations built in, the scalar reference first, whether the CPU runs them or not */
+const struct blend_impl_t *blend_impls(int *count);
+
+void blend_src_over_premul(const uint32_t *src, uint32_t *dst, size_t count);
+void blend_src_over_straight(const uint32_t *src, uint32_t *dst, size_t count);
+
+/**
+ * 8-bit indexed src with a premultiplied palette, index 0 transparent: the palette lookup is fused
+ * into the blend, src is read at 1 byte per pixel
+ */
+void blend_indexed_src_over(const uint8_t *src, const uint32_t *palette, uint32_t *dst, size_t count);
+
+#endif //VD_LINK_BLEND_H
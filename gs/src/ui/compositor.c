@@ -0,0 +1,170 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "compositor.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blend.h"
+
+#define COMP_MAX_TILES_X    64      // a tile row is one 64-bit mask
+
+static uint32_t *frame = NULL;
+static int frame_width, frame_height;
+static int tiles_x, tiles_y;
+static uint64_t *dirty[COMP_LAYER_COUNT];  // per tile row, bit per tile column
+static struct comp_stats_t stats;
+
+int comp_init(int width, int height)
+{
+    comp_deinit();
+    if (width <= 0 || height <= 0 || (width + COMP_TILE_SIZE - 1) / COMP_TILE_SIZE > COMP_MAX_TILES_X) {
+        printf("[ COMP ] Unsupported frame size %dx%d\n", width, height);
+        return -1;
+    }
+    frame_width = width;
+    frame_height = height;
+    tiles_x = (width + COMP_TILE_SIZE - 1) / COMP_TILE_SIZE;
+    tiles_y = (height + COMP_TILE_SIZE - 1) / COMP_TILE_SIZE;
+
+    frame = calloc((size_t)width * height, sizeof(uint32_t));
+    bool failed = frame == NULL;
+    for (int l = 0; l < COMP_LAYER_COUNT; l++) {
+        dirty[l] = calloc((size_t)tiles_y, sizeof(uint64_t));
+        failed |= dirty[l] == NULL;
+    }
+    if (failed) {
+        printf("[ COMP ] Failed to allocate the %dx%d frame\n", width, height);
+        comp_deinit();
+        return -1;
+    }
+    memset(&stats, 0, sizeof(stats));
+    comp_damage_all();
+    printf("[ COMP ] %dx%d frame, %dx%d tiles of %d px\n", width, height, tiles_x, tiles_y, COMP_TILE_SIZE);
+    return 0;
+}
+
+void comp_deinit(void)
+{
+    free(frame);
+    frame = NULL;
+    for (int l = 0; l < COMP_LAYER_COUNT; l++) {
+        free(dirty[l]);
+        dirty[l] = NULL;
+    }
+}
+
+void comp_damage(comp_layer_t layer, const struct osd_rect_t *rect)
+{
+    if (!frame || layer < 0 || layer >= COMP_LAYER_COUNT)
+        return;
+    int x0 = rect->x < 0 ? 0 : rect->x;
+    int y0 = rect->y < 0 ? 0 : rect->y;
+    int x1 = rect->x + rect->w > frame_width ? frame_width : rect->x + rect->w;
+    int y1 = rect->y + rect->h > frame_height ? frame_height : rect->y + rect->h;
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    int tx0 = x0 / COMP_TILE_SIZE, tx1 = (x1 - 1) / COMP_TILE_SIZE;
+    uint64_t cols = (tx1 - tx0 + 1 == 64 ? ~0ULL : ((1ULL << (tx1 - tx0 + 1)) - 1)) << tx0;
+    for (int ty = y0 / COMP_TILE_SIZE; ty <= (y1 - 1) / COMP_TILE_SIZE; ty++) {
+        stats.layer_tiles[layer] += __builtin_popcountll(cols & ~dirty[layer][ty]);
+        dirty[layer][ty] |= cols;
+    }
+}
+
+void comp_damage_all(void)
+{
+    struct osd_rect_t all = { 0, 0, frame_width, frame_height };
+    comp_damage(COMP_LAYER_UI, &all);
+}
+
+/* The UI layer, the OSD blended over it */
+static void compose_rect(const struct comp_layers_t *layers, const struct osd_rect_t *r)
+{
+    for (int y = r->y; y < r->y + r->h; y++) {
+        size_t at = (size_t)y * frame_width + r->x;
+        if (layers->ui)
+            memcpy(frame + at, layers->ui + at, (size_t)r->w * sizeof(uint32_t));
+        else
+            memset(frame + at, 0, (size_t)r->w * sizeof(uint32_t));
+        if (layers->osd)
+            blend_src_over_premul(layers->osd + at, frame + at, (size_t)r->w);
+        else if (layers->osd_indexed)
+            blend_indexed_src_over(layers->osd_indexed + at, layers->palette, frame + at, (size_t)r->w);
+    }
+}
+
+int comp_compose(const struct comp_layers_t *layers, struct osd_rect_t *damage, int max)
+{
+    if (!frame)
+        return 0;
+    stats.frames++;
+
+    struct osd_rect_t rects[COMP_MAX_DAMAGE];
+    int n = 0;
+    bool overflow = false;
+    int bx0 = frame_width, by0 = frame_height, bx1 = 0, by1 = 0;
+    for (int ty = 0; ty < tiles_y; ty++) {
+        uint64_t row = 0;
+        for (int l = 0; l < COMP_LAYER_COUNT; l++) {
+            row |= dirty[l][ty];
+            dirty[l][ty] = 0;
+        }
+        while (row) {
+            // a run of dirty tiles is composed and reported as one rect
+            int tx = __builtin_ctzll(row);
+            uint64_t rest = row >> tx;
+            int len = rest == ~0ULL ? 64 : __builtin_ctzll(~rest);
+            row &= len == 64 ? 0 : ~(((1ULL << len) - 1) << tx);
+            stats.tiles += len;
+
+            struct osd_rect_t r = { tx * COMP_TILE_SIZE, ty * COMP_TILE_SIZE, len * COMP_TILE_SIZE, COMP_TILE_SIZE };
+            if (r.x + r.w > frame_width)
+                r.w = frame_width - r.x;
+            if (r.y + r.h > frame_height)
+                r.h = frame_height - r.y;
+            compose_rect(layers, &r);
+
+            if (r.x < bx0) bx0 = r.x;
+            if (r.y < by0) by0 = r.y;
+            if (r.x + r.w > bx1) bx1 = r.x + r.w;
+            if (r.y + r.h > by1) by1 = r.y + r.h;
+
+            // the same columns right above grow down instead
+            int i = 0;
+            while (i < n && !(rects[i].x == r.x && rects[i].w == r.w && rects[i].y + rects[i].h == r.y))
+                i++;
+            if (i < n)
+                rects[i].h += r.h;
+            else if (n < COMP_MAX_DAMAGE)
+                rects[n++] = r;
+            else
+                overflow = true;
+        }
+    }
+
+    if (n == 0) {
+        stats.idle_frames++;
+        return 0;
+    }
+    if (overflow || n > max) {
+        if (max <= 0)
+            return 0;
+        damage[0] = (struct osd_rect_t){ bx0, by0, bx1 - bx0, by1 - by0 };
+        return 1;
+    }
+    memcpy(damage, rects, (size_t)n * sizeof(rects[0]));
+    return n;
+}
+
+const uint32_t *comp_frame(void)
+{
+    return frame;
+}
+
+void comp_get_stats(struct comp_stats_t *out)
+{
+    *out = stats;
+}
@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_COMPOSITOR_H
+#define VD_LINK_COMPOSITOR_H
+#include <stdint.h>
+#include "common.h"
+
+/*
+ * Tile compositor of the frame sent to the display: the MSP OSD over the LVGL layer.
+ * Each layer reports the regions it changed; they are rounded out to COMP_TILE_SIZE tiles, only those
+ * tiles are composed and the display backend gets them back as a damage list to upload.
+ * A HUD that doesn't change costs nothing per frame. All calls from the thread that flushes LVGL.
+ */
+#define COMP_TILE_SIZE      64
+#define COMP_MAX_DAMAGE     32      // damage rects per frame, more are reported as one bounding rect
+
+typedef enum {
+    COMP_LAYER_UI = 0,              // LVGL
+    COMP_LAYER_OSD,                 // MSP OSD
+    COMP_LAYER_COUNT
+} comp_layer_t;
+
+/* Layer pixels, all frame size. The OSD is BGRA premultiplied or indexed, or missing */
+struct comp_layers_t {
+    const uint32_t *ui;
+    const uint32_t *osd;
+    const uint8_t *osd_indexed;
+    const uint32_t *palette;        // of osd_indexed
+};
+
+struct comp_stats_t {
+    uint64_t frames;                // compose calls
+    uint64_t idle_frames;           // with nothing to compose
+    uint64_t tiles;                 // composed
+    uint64_t layer_tiles[COMP_LAYER_COUNT];  // reported dirty per layer, before merging
+};
+
+/** Allocate the composed frame, width x height, every tile dirty. Returns 0, -1 when out of memory */
+int comp_init(int width, int height);
+
+void comp_deinit(void);
+
+/** rect of layer changed, clipped to the frame */
+void comp_damage(comp_layer_t layer, const struct osd_rect_t *rect);
+
+/* Everything changed, e.g. a layer appeared or went away */
+void comp_damage_all(void);
+
+/**
+ * Compose the dirty tiles from layers and clear them. The composed regions, merged into rects on the
+ * tile grid, go to damage (at most max). Returns their number, 0 if the frame didn't change.
+ */
+int comp_compose(const struct comp_layers_t *layers, struct osd_rect_t *damage, int max);
+
+/* The composed frame, BGRA premultiplied, width * height pixels */
+const uint32_t *comp_frame(void);
+
+void comp_get_stats(struct comp_stats_t *stats);
+
+#endif //VD_LINK_COMPOSITOR_H
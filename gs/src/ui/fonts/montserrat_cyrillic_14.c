@@ -1,1754 +0,0 @@
-/*******************************************************************************
- * Size: 14 px
- * Bpp: 4
- * Opts: --bpp 4 --size 14 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_14.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_14
-#define MONTSERRAT_CYRILLIC_14 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_14
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xa2, 0x92, 0x91, 0x91, 0x81, 0x80, 0x20, 0x0,
-    0xb4,
-
-    /* U+0022 "\"" */
-    0xa0, 0xa9, 0x9, 0x90, 0x93, 0x3,
-
-    /* U+0023 "#" */
-    0x0, 0x9, 0x0, 0x17, 0x0, 0x0, 0x9, 0x0,
-    0x35, 0x0, 0x18, 0x8c, 0x88, 0xb9, 0x81, 0x0,
-    0x26, 0x0, 0x81, 0x0, 0x0, 0x44, 0x0, 0x90,
-    0x0, 0x0, 0x62, 0x0, 0x90, 0x0, 0x48, 0xc8,
-    0x88, 0xc8, 0x60, 0x0, 0x90, 0x0, 0x80, 0x0,
-    0x0, 0x90, 0x2, 0x60, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x80, 0x0,
-    0x1, 0x9a, 0xd9, 0x91, 0xb, 0x10, 0x80, 0x11,
-    0xb, 0x0, 0x80, 0x0, 0x9, 0x60, 0x80, 0x0,
-    0x0, 0x49, 0xd8, 0x20, 0x0, 0x0, 0x81, 0x96,
-    0x0, 0x0, 0x80, 0xb, 0x16, 0x0, 0x80, 0x39,
-    0x5, 0xa9, 0xd9, 0x80, 0x0, 0x0, 0x80, 0x0,
-    0x0, 0x0, 0x40, 0x0,
-
-    /* U+0025 "%" */
-    0x7, 0x67, 0x30, 0x0, 0x81, 0x3, 0x50, 0x8,
-    0x0, 0x54, 0x0, 0x52, 0x0, 0x80, 0x27, 0x0,
-    0x2, 0x70, 0x8, 0x8, 0x0, 0x0, 0x4, 0x77,
-    0x17, 0x15, 0x77, 0x0, 0x0, 0x5, 0x44, 0x50,
-    0x17, 0x0, 0x2, 0x70, 0x70, 0x0, 0x80, 0x0,
-    0x80, 0x6, 0x20, 0x8, 0x0, 0x71, 0x0, 0x7,
-    0x67, 0x20,
-
-    /* U+0026 "&" */
-    0x0, 0x59, 0x89, 0x10, 0x0, 0x0, 0xa0, 0x3,
-    0x60, 0x0, 0x0, 0xb0, 0x7, 0x30, 0x0, 0x0,
-    0x58, 0x84, 0x0, 0x0, 0x0, 0x89, 0x70, 0x0,
-    0x0, 0xa, 0x10, 0x67, 0x4, 0x40, 0x37, 0x0,
-    0x6, 0x79, 0x0, 0x1a, 0x0, 0x0, 0xba, 0x0,
-    0x4, 0xa9, 0x99, 0x46, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x40,
-
-    /* U+0027 "'" */
-    0xa9, 0x93,
-
-    /* U+0028 "(" */
-    0x2, 0x80, 0x92, 0xa, 0x2, 0x80, 0x56, 0x6,
-    0x40, 0x64, 0x6, 0x40, 0x56, 0x2, 0x80, 0xa,
-    0x0, 0x92, 0x2, 0x80,
-
-    /* U+0029 ")" */
-    0x19, 0x0, 0x91, 0x4, 0x60, 0xa, 0x0, 0xb0,
-    0xb, 0x0, 0xb0, 0xb, 0x0, 0xb0, 0xa, 0x4,
-    0x60, 0x91, 0x19, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x80, 0x4, 0x79, 0x66, 0x6, 0xe9, 0x4,
-    0x37, 0x26, 0x0, 0x50, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x11, 0x0, 0x0, 0x54, 0x0, 0x0, 0x54,
-    0x0, 0x89, 0xbb, 0x98, 0x0, 0x54, 0x0, 0x0,
-    0x54, 0x0, 0x0, 0x11, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x1e, 0x9, 0x17,
-
-    /* U+002D "-" */
-    0x19, 0x99, 0x40,
-
-    /* U+002E "." */
-    0x0, 0x1d,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x5, 0x0, 0x0, 0x18, 0x0, 0x0,
-    0x73, 0x0, 0x0, 0xa0, 0x0, 0x2, 0x70, 0x0,
-    0x8, 0x10, 0x0, 0xa, 0x0, 0x0, 0x45, 0x0,
-    0x0, 0x90, 0x0, 0x1, 0x90, 0x0, 0x6, 0x40,
-    0x0, 0xa, 0x0, 0x0, 0x28, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x5a, 0xaa, 0x70, 0x0, 0x58, 0x0, 0x5,
-    0x90, 0xb, 0x0, 0x0, 0xa, 0x12, 0x90, 0x0,
-    0x0, 0x55, 0x37, 0x0, 0x0, 0x4, 0x62, 0x90,
-    0x0, 0x0, 0x55, 0xb, 0x0, 0x0, 0xa, 0x10,
-    0x58, 0x0, 0x5, 0x90, 0x0, 0x5a, 0xaa, 0x70,
-    0x0,
-
-    /* U+0031 "1" */
-    0x8a, 0xc3, 0x0, 0x73, 0x0, 0x73, 0x0, 0x73,
-    0x0, 0x73, 0x0, 0x73, 0x0, 0x73, 0x0, 0x73,
-    0x0, 0x73,
-
-    /* U+0032 "2" */
-    0x18, 0xaa, 0xa9, 0x10, 0x42, 0x0, 0x3, 0xa0,
-    0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x3, 0x80,
-    0x0, 0x0, 0x1a, 0x0, 0x0, 0x2, 0xa1, 0x0,
-    0x0, 0x3a, 0x0, 0x0, 0x5, 0x90, 0x0, 0x0,
-    0x4e, 0x99, 0x99, 0x93,
-
-    /* U+0033 "3" */
-    0x4a, 0xaa, 0xad, 0x80, 0x0, 0x0, 0x49, 0x0,
-    0x0, 0x4, 0x80, 0x0, 0x0, 0x1c, 0x96, 0x0,
-    0x0, 0x0, 0x5, 0x90, 0x0, 0x0, 0x0, 0xb0,
-    0x0, 0x0, 0x0, 0xb0, 0x72, 0x0, 0x3, 0xa0,
-    0x18, 0xaa, 0xa9, 0x10,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x7, 0x40, 0x0, 0x0, 0x5, 0x70,
-    0x0, 0x0, 0x3, 0x90, 0x0, 0x0, 0x1, 0xa0,
-    0x0, 0x0, 0x0, 0xa1, 0x0, 0xb0, 0x0, 0xa2,
-    0x0, 0xb, 0x0, 0x4b, 0x99, 0x99, 0xe9, 0x90,
-    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0xb0,
-    0x0,
-
-    /* U+0035 "5" */
-    0x8, 0xaa, 0xaa, 0x70, 0xa, 0x0, 0x0, 0x0,
-    0xa, 0x0, 0x0, 0x0, 0xb, 0x99, 0xa6, 0x0,
-    0x0, 0x0, 0x4, 0xb0, 0x0, 0x0, 0x0, 0x92,
-    0x0, 0x0, 0x0, 0x83, 0x53, 0x0, 0x1, 0xb0,
-    0x7, 0xaa, 0xaa, 0x20,
-
-    /* U+0036 "6" */
-    0x0, 0x4a, 0x99, 0x92, 0x5, 0x80, 0x0, 0x0,
-    0xb, 0x0, 0x0, 0x0, 0x28, 0x29, 0x9a, 0x50,
-    0x3a, 0x80, 0x0, 0x77, 0x2f, 0x0, 0x0, 0xb,
-    0xd, 0x0, 0x0, 0xb, 0x7, 0x70, 0x0, 0x49,
-    0x0, 0x69, 0x99, 0x80,
-
-    /* U+0037 "7" */
-    0x8b, 0xaa, 0xaa, 0xc7, 0x82, 0x0, 0x0, 0xb1,
-    0x20, 0x0, 0x4, 0x80, 0x0, 0x0, 0xb, 0x10,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0xb1, 0x0,
-    0x0, 0x4, 0x80, 0x0, 0x0, 0xb, 0x10, 0x0,
-    0x0, 0x48, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x1, 0x99, 0x9a, 0x80, 0x0, 0xa2, 0x0, 0x4,
-    0x80, 0xb, 0x0, 0x0, 0xb, 0x0, 0x94, 0x0,
-    0x6, 0x70, 0x1, 0xda, 0x8b, 0xb0, 0x0, 0xb2,
-    0x0, 0x3, 0xb0, 0x47, 0x0, 0x0, 0x9, 0x11,
-    0xb0, 0x0, 0x1, 0xb0, 0x3, 0xa9, 0x99, 0x92,
-    0x0,
-
-    /* U+0039 "9" */
-    0x6, 0xa9, 0x99, 0x10, 0x48, 0x0, 0x0, 0xa0,
-    0x83, 0x0, 0x0, 0x75, 0x3a, 0x0, 0x2, 0xa9,
-    0x3, 0x99, 0x86, 0x1a, 0x0, 0x0, 0x0, 0x29,
-    0x0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x4, 0xa0,
-    0x8, 0x99, 0xa8, 0x0,
-
-    /* U+003A ":" */
-    0x1d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-
-    /* U+003B ";" */
-    0x1d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x9,
-    0x17,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x1, 0x0, 0x5, 0x97, 0x28, 0x84,
-    0x0, 0xc6, 0x0, 0x0, 0x3, 0x98, 0x30, 0x0,
-    0x0, 0x69,
-
-    /* U+003D "=" */
-    0x88, 0x88, 0x88, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x89, 0x99, 0x98,
-
-    /* U+003E ">" */
-    0x10, 0x0, 0x0, 0x79, 0x50, 0x0, 0x0, 0x49,
-    0x82, 0x0, 0x0, 0x7c, 0x3, 0x98, 0x30, 0x96,
-    0x0, 0x0,
-
-    /* U+003F "?" */
-    0x19, 0x99, 0xa9, 0x5, 0x10, 0x0, 0x49, 0x0,
-    0x0, 0x0, 0xb0, 0x0, 0x0, 0x84, 0x0, 0x0,
-    0x94, 0x0, 0x0, 0x65, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x30, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x1, 0x78, 0x88, 0x88, 0x50, 0x0, 0x0,
-    0x49, 0x10, 0x0, 0x0, 0x39, 0x0, 0x2, 0x80,
-    0x18, 0x87, 0x82, 0xa1, 0x90, 0x9, 0x0, 0xa1,
-    0x0, 0x7, 0xa0, 0x54, 0x18, 0x4, 0x60, 0x0,
-    0x1, 0xb0, 0x8, 0x35, 0x6, 0x40, 0x0, 0x0,
-    0xb0, 0x8, 0x35, 0x4, 0x60, 0x0, 0x1, 0xb0,
-    0x8, 0x18, 0x0, 0xa1, 0x0, 0x8, 0xa0, 0x36,
-    0x9, 0x0, 0x19, 0x98, 0x92, 0x89, 0x80, 0x2,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0x10, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x78,
-    0x88, 0x98, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0xa8, 0x0, 0x0, 0x0, 0x2, 0x8a,
-    0x10, 0x0, 0x0, 0xa, 0x13, 0x80, 0x0, 0x0,
-    0x28, 0x0, 0xa1, 0x0, 0x0, 0xa1, 0x0, 0x38,
-    0x0, 0x3, 0x90, 0x0, 0xa, 0x10, 0xa, 0xa9,
-    0x99, 0x9a, 0x80, 0x39, 0x0, 0x0, 0x0, 0xa1,
-    0xa1, 0x0, 0x0, 0x0, 0x38,
-
-    /* U+0042 "B" */
-    0x4c, 0x99, 0x99, 0xa3, 0x4, 0x60, 0x0, 0x0,
-    0xc0, 0x46, 0x0, 0x0, 0x9, 0x24, 0x60, 0x0,
-    0x2, 0xb0, 0x4c, 0x99, 0x9a, 0xd4, 0x4, 0x60,
-    0x0, 0x0, 0x85, 0x46, 0x0, 0x0, 0x1, 0xa4,
-    0x60, 0x0, 0x0, 0x57, 0x4c, 0x99, 0x99, 0x98,
-    0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x18, 0xaa, 0xaa, 0x50, 0x1, 0xb3, 0x0,
-    0x0, 0x61, 0xb, 0x20, 0x0, 0x0, 0x0, 0x1a,
-    0x0, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0xb, 0x20,
-    0x0, 0x0, 0x0, 0x1, 0xb3, 0x0, 0x0, 0x61,
-    0x0, 0x18, 0xaa, 0xaa, 0x50,
-
-    /* U+0044 "D" */
-    0x4c, 0xaa, 0xaa, 0xa4, 0x0, 0x46, 0x0, 0x0,
-    0x7, 0x80, 0x46, 0x0, 0x0, 0x0, 0x84, 0x46,
-    0x0, 0x0, 0x0, 0x1a, 0x46, 0x0, 0x0, 0x0,
-    0xb, 0x46, 0x0, 0x0, 0x0, 0x1a, 0x46, 0x0,
-    0x0, 0x0, 0x84, 0x46, 0x0, 0x0, 0x7, 0x90,
-    0x4c, 0x99, 0x99, 0xa4, 0x0,
-
-    /* U+0045 "E" */
-    0x4c, 0xaa, 0xaa, 0xa2, 0x46, 0x0, 0x0, 0x0,
-    0x46, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x4c, 0x99, 0x99, 0x60, 0x46, 0x0, 0x0, 0x0,
-    0x46, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x4c, 0x99, 0x99, 0x94,
-
-    /* U+0046 "F" */
-    0x4c, 0xaa, 0xaa, 0xa2, 0x46, 0x0, 0x0, 0x0,
-    0x46, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x4c, 0xaa, 0xaa, 0x60, 0x46, 0x0, 0x0, 0x0,
-    0x46, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x46, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x8, 0xaa, 0xaa, 0x60, 0x1, 0xb3, 0x0,
-    0x0, 0x52, 0xb, 0x20, 0x0, 0x0, 0x0, 0x1a,
-    0x0, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x22, 0x1a, 0x0, 0x0, 0x0, 0x46, 0xb, 0x20,
-    0x0, 0x0, 0x46, 0x1, 0xb3, 0x0, 0x0, 0x76,
-    0x0, 0x18, 0xaa, 0xaa, 0x60,
-
-    /* U+0048 "H" */
-    0x46, 0x0, 0x0, 0x0, 0xb4, 0x60, 0x0, 0x0,
-    0xb, 0x46, 0x0, 0x0, 0x0, 0xb4, 0x60, 0x0,
-    0x0, 0xb, 0x4c, 0x99, 0x99, 0x99, 0xb4, 0x60,
-    0x0, 0x0, 0xb, 0x46, 0x0, 0x0, 0x0, 0xb4,
-    0x60, 0x0, 0x0, 0xb, 0x46, 0x0, 0x0, 0x0,
-    0xb0,
-
-    /* U+0049 "I" */
-    0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
-    0x46,
-
-    /* U+004A "J" */
-    0x0, 0xaa, 0xac, 0x40, 0x0, 0x0, 0x74, 0x0,
-    0x0, 0x7, 0x40, 0x0, 0x0, 0x74, 0x0, 0x0,
-    0x7, 0x40, 0x0, 0x0, 0x74, 0x0, 0x0, 0x7,
-    0x30, 0x60, 0x0, 0xb1, 0x4, 0xa9, 0xa5, 0x0,
-
-    /* U+004B "K" */
-    0x46, 0x0, 0x0, 0x1a, 0x14, 0x60, 0x0, 0x2a,
-    0x0, 0x46, 0x0, 0x3a, 0x0, 0x4, 0x60, 0x3a,
-    0x0, 0x0, 0x46, 0x4c, 0x70, 0x0, 0x4, 0xb9,
-    0x7, 0x60, 0x0, 0x4a, 0x0, 0x8, 0x50, 0x4,
-    0x60, 0x0, 0x9, 0x40, 0x46, 0x0, 0x0, 0x9,
-    0x40,
-
-    /* U+004C "L" */
-    0x46, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x46, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x46, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x46, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x4c, 0x99, 0x99, 0x90,
-
-    /* U+004D "M" */
-    0x4a, 0x0, 0x0, 0x0, 0x3, 0xa4, 0xd4, 0x0,
-    0x0, 0x0, 0xba, 0x46, 0xa0, 0x0, 0x0, 0x74,
-    0xa4, 0x63, 0x80, 0x0, 0x28, 0xa, 0x46, 0x8,
-    0x20, 0xa, 0x0, 0xa4, 0x60, 0xa, 0x6, 0x50,
-    0xa, 0x46, 0x0, 0x57, 0x90, 0x0, 0xa4, 0x60,
-    0x0, 0x91, 0x0, 0xa, 0x46, 0x0, 0x0, 0x0,
-    0x0, 0xa0,
-
-    /* U+004E "N" */
-    0x4b, 0x0, 0x0, 0x0, 0xb4, 0xb9, 0x0, 0x0,
-    0xb, 0x46, 0x77, 0x0, 0x0, 0xb4, 0x60, 0x94,
-    0x0, 0xb, 0x46, 0x0, 0xa3, 0x0, 0xb4, 0x60,
-    0x1, 0xb1, 0xb, 0x46, 0x0, 0x2, 0xb1, 0xb4,
-    0x60, 0x0, 0x3, 0xbb, 0x46, 0x0, 0x0, 0x5,
-    0xa0,
-
-    /* U+004F "O" */
-    0x0, 0x8, 0xaa, 0xaa, 0x60, 0x0, 0x1b, 0x30,
-    0x0, 0x6, 0xa0, 0xa, 0x20, 0x0, 0x0, 0x6,
-    0x71, 0xa0, 0x0, 0x0, 0x0, 0xb, 0x37, 0x0,
-    0x0, 0x0, 0x0, 0xb1, 0xa0, 0x0, 0x0, 0x0,
-    0xb, 0xa, 0x20, 0x0, 0x0, 0x6, 0x70, 0x1b,
-    0x30, 0x0, 0x6, 0xa0, 0x0, 0x8, 0xaa, 0xaa,
-    0x60, 0x0,
-
-    /* U+0050 "P" */
-    0x4c, 0xaa, 0xaa, 0x81, 0x4, 0x60, 0x0, 0x3,
-    0xb0, 0x46, 0x0, 0x0, 0x9, 0x24, 0x60, 0x0,
-    0x0, 0xa1, 0x46, 0x0, 0x0, 0x59, 0x4, 0xc9,
-    0x99, 0x95, 0x0, 0x46, 0x0, 0x0, 0x0, 0x4,
-    0x60, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x8, 0xaa, 0xaa, 0x60, 0x0, 0x1, 0xb3,
-    0x0, 0x0, 0x6a, 0x0, 0xa, 0x20, 0x0, 0x0,
-    0x6, 0x70, 0x1a, 0x0, 0x0, 0x0, 0x0, 0xb0,
-    0x37, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x1a, 0x0,
-    0x0, 0x0, 0x0, 0xb0, 0xa, 0x20, 0x0, 0x0,
-    0x6, 0x70, 0x1, 0xb3, 0x0, 0x0, 0x6a, 0x0,
-    0x0, 0x8, 0xaa, 0xaa, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x96, 0x0, 0x42, 0x0, 0x0, 0x0, 0x5,
-    0x99, 0x60,
-
-    /* U+0052 "R" */
-    0x4c, 0xaa, 0xaa, 0x81, 0x4, 0x60, 0x0, 0x3,
-    0xb0, 0x46, 0x0, 0x0, 0x9, 0x24, 0x60, 0x0,
-    0x0, 0xa1, 0x46, 0x0, 0x0, 0x59, 0x4, 0xc9,
-    0x99, 0xd5, 0x0, 0x46, 0x0, 0x4, 0x80, 0x4,
-    0x60, 0x0, 0x8, 0x40, 0x46, 0x0, 0x0, 0xb,
-    0x10,
-
-    /* U+0053 "S" */
-    0x1, 0x9a, 0x99, 0x91, 0xb, 0x10, 0x0, 0x11,
-    0xb, 0x0, 0x0, 0x0, 0x9, 0x60, 0x0, 0x0,
-    0x0, 0x49, 0x98, 0x20, 0x0, 0x0, 0x1, 0x96,
-    0x0, 0x0, 0x0, 0xb, 0x16, 0x0, 0x0, 0x39,
-    0x5, 0xa9, 0x99, 0x80,
-
-    /* U+0054 "T" */
-    0x9a, 0xac, 0xba, 0xa8, 0x0, 0x6, 0x40, 0x0,
-    0x0, 0x6, 0x40, 0x0, 0x0, 0x6, 0x40, 0x0,
-    0x0, 0x6, 0x40, 0x0, 0x0, 0x6, 0x40, 0x0,
-    0x0, 0x6, 0x40, 0x0, 0x0, 0x6, 0x40, 0x0,
-    0x0, 0x6, 0x40, 0x0,
-
-    /* U+0055 "U" */
-    0x65, 0x0, 0x0, 0x3, 0x76, 0x50, 0x0, 0x0,
-    0x37, 0x65, 0x0, 0x0, 0x3, 0x76, 0x50, 0x0,
-    0x0, 0x37, 0x65, 0x0, 0x0, 0x3, 0x75, 0x50,
-    0x0, 0x0, 0x47, 0x39, 0x0, 0x0, 0x7, 0x40,
-    0xb3, 0x0, 0x2, 0xb0, 0x0, 0x8a, 0xaa, 0x91,
-    0x0,
-
-    /* U+0056 "V" */
-    0xa2, 0x0, 0x0, 0x0, 0x74, 0x39, 0x0, 0x0,
-    0x0, 0xb0, 0xb, 0x10, 0x0, 0x6, 0x50, 0x3,
-    0x90, 0x0, 0xb, 0x0, 0x0, 0xb1, 0x0, 0x65,
-    0x0, 0x0, 0x48, 0x0, 0xb0, 0x0, 0x0, 0xb,
-    0x15, 0x60, 0x0, 0x0, 0x4, 0x8b, 0x0, 0x0,
-    0x0, 0x0, 0xc6, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x48, 0x0, 0x0, 0xd, 0x30, 0x0, 0x1, 0x90,
-    0xb0, 0x0, 0x3, 0x99, 0x0, 0x0, 0x74, 0x8,
-    0x30, 0x0, 0x91, 0xa0, 0x0, 0xb, 0x0, 0x29,
-    0x0, 0xa, 0x5, 0x50, 0x3, 0x80, 0x0, 0xb0,
-    0x5, 0x50, 0xa, 0x0, 0x92, 0x0, 0x6, 0x50,
-    0xa0, 0x0, 0x91, 0xb, 0x0, 0x0, 0x1a, 0x19,
-    0x0, 0x3, 0x74, 0x60, 0x0, 0x0, 0xa9, 0x30,
-    0x0, 0xa, 0xa1, 0x0, 0x0, 0x4, 0xd0, 0x0,
-    0x0, 0x7a, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x2b, 0x0, 0x0, 0xa, 0x10, 0x49, 0x0, 0x8,
-    0x30, 0x0, 0x76, 0x6, 0x60, 0x0, 0x0, 0xa7,
-    0x90, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x0,
-    0xb2, 0xb0, 0x0, 0x0, 0xa2, 0x3, 0xa0, 0x0,
-    0x85, 0x0, 0x5, 0x70, 0x58, 0x0, 0x0, 0x8,
-    0x40,
-
-    /* U+0059 "Y" */
-    0x93, 0x0, 0x0, 0x6, 0x50, 0xb0, 0x0, 0x1,
-    0xa0, 0x4, 0x80, 0x0, 0xa1, 0x0, 0x9, 0x30,
-    0x65, 0x0, 0x0, 0xb, 0x29, 0x0, 0x0, 0x0,
-    0x4d, 0x10, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x0,
-
-    /* U+005A "Z" */
-    0x2a, 0xaa, 0xaa, 0xae, 0x40, 0x0, 0x0, 0x5,
-    0x80, 0x0, 0x0, 0x3, 0xa0, 0x0, 0x0, 0x2,
-    0xb0, 0x0, 0x0, 0x1, 0xb1, 0x0, 0x0, 0x0,
-    0xb2, 0x0, 0x0, 0x0, 0x94, 0x0, 0x0, 0x0,
-    0x76, 0x0, 0x0, 0x0, 0x3e, 0x99, 0x99, 0x99,
-    0x50,
-
-    /* U+005B "[" */
-    0x4b, 0x84, 0x60, 0x46, 0x4, 0x60, 0x46, 0x4,
-    0x60, 0x46, 0x4, 0x60, 0x46, 0x4, 0x60, 0x46,
-    0x4, 0x60, 0x4b, 0x80,
-
-    /* U+005C "\\" */
-    0x32, 0x0, 0x0, 0x18, 0x0, 0x0, 0xa, 0x0,
-    0x0, 0x5, 0x40, 0x0, 0x0, 0x90, 0x0, 0x0,
-    0x91, 0x0, 0x0, 0x46, 0x0, 0x0, 0xa, 0x0,
-    0x0, 0x8, 0x20, 0x0, 0x2, 0x80, 0x0, 0x0,
-    0xa0, 0x0, 0x0, 0x63, 0x0, 0x0, 0x19,
-
-    /* U+005D "]" */
-    0x69, 0x90, 0x29, 0x2, 0x90, 0x29, 0x2, 0x90,
-    0x29, 0x2, 0x90, 0x29, 0x2, 0x90, 0x29, 0x2,
-    0x90, 0x29, 0x69, 0x90,
-
-    /* U+005E "^" */
-    0x0, 0x33, 0x0, 0x0, 0xaa, 0x0, 0x3, 0x77,
-    0x30, 0x9, 0x1, 0x90, 0x18, 0x0, 0x81, 0x71,
-    0x0, 0x17,
-
-    /* U+005F "_" */
-    0x77, 0x77, 0x77, 0x70,
-
-    /* U+0060 "`" */
-    0x42, 0x0, 0x75,
-
-    /* U+0061 "a" */
-    0x5, 0x99, 0x9a, 0x10, 0x40, 0x0, 0x39, 0x0,
-    0x0, 0x0, 0xb0, 0x38, 0x88, 0x8b, 0x1b, 0x0,
-    0x0, 0xb1, 0xa0, 0x0, 0x4c, 0x6, 0x98, 0x85,
-    0xa0,
-
-    /* U+0062 "b" */
-    0x83, 0x0, 0x0, 0x0, 0x83, 0x0, 0x0, 0x0,
-    0x83, 0x0, 0x0, 0x0, 0x83, 0x89, 0x9a, 0x30,
-    0x8b, 0x10, 0x0, 0xa3, 0x85, 0x0, 0x0, 0x1a,
-    0x83, 0x0, 0x0, 0xb, 0x85, 0x0, 0x0, 0x1a,
-    0x8b, 0x10, 0x0, 0xa2, 0x83, 0x89, 0x9a, 0x30,
-
-    /* U+0063 "c" */
-    0x0, 0x8a, 0x9a, 0x50, 0xa, 0x30, 0x0, 0x50,
-    0x29, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-    0x29, 0x0, 0x0, 0x0, 0xa, 0x30, 0x0, 0x50,
-    0x0, 0x89, 0x9a, 0x50,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0x0, 0xb, 0x0, 0x89, 0x99, 0x4b,
-    0xa, 0x30, 0x0, 0x7d, 0x29, 0x0, 0x0, 0xd,
-    0x46, 0x0, 0x0, 0xb, 0x29, 0x0, 0x0, 0xd,
-    0xa, 0x30, 0x0, 0x7d, 0x0, 0x89, 0x99, 0x4b,
-
-    /* U+0065 "e" */
-    0x0, 0x89, 0x9a, 0x30, 0xa, 0x20, 0x0, 0xa1,
-    0x28, 0x0, 0x0, 0x28, 0x4a, 0x77, 0x77, 0x77,
-    0x28, 0x0, 0x0, 0x0, 0x9, 0x30, 0x0, 0x30,
-    0x0, 0x8a, 0x9a, 0x70,
-
-    /* U+0066 "f" */
-    0x0, 0x99, 0x90, 0x5, 0x60, 0x0, 0x6, 0x50,
-    0x0, 0x6b, 0xb9, 0x50, 0x6, 0x50, 0x0, 0x6,
-    0x50, 0x0, 0x6, 0x50, 0x0, 0x6, 0x50, 0x0,
-    0x6, 0x50, 0x0, 0x6, 0x50, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x89, 0x88, 0x49, 0x10, 0xa3, 0x0, 0x5,
-    0xd1, 0x29, 0x0, 0x0, 0xc, 0x14, 0x60, 0x0,
-    0x0, 0xa1, 0x29, 0x0, 0x0, 0xd, 0x10, 0xa3,
-    0x0, 0x6, 0xd1, 0x0, 0x8a, 0x99, 0x4a, 0x0,
-    0x0, 0x0, 0x0, 0xb0, 0x5, 0x10, 0x0, 0x39,
-    0x0, 0x29, 0xa9, 0xa9, 0x0,
-
-    /* U+0068 "h" */
-    0x83, 0x0, 0x0, 0x0, 0x83, 0x0, 0x0, 0x0,
-    0x83, 0x0, 0x0, 0x0, 0x84, 0x99, 0xaa, 0x10,
-    0x8a, 0x0, 0x2, 0xa0, 0x84, 0x0, 0x0, 0xb0,
-    0x83, 0x0, 0x0, 0xa0, 0x83, 0x0, 0x0, 0xa0,
-    0x83, 0x0, 0x0, 0xa0, 0x83, 0x0, 0x0, 0xa0,
-
-    /* U+0069 "i" */
-    0x94, 0x0, 0x0, 0x83, 0x83, 0x83, 0x83, 0x83,
-    0x83, 0x83,
-
-    /* U+006A "j" */
-    0x0, 0x8, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x74, 0x0, 0x7, 0x40, 0x0, 0x74, 0x0,
-    0x7, 0x40, 0x0, 0x74, 0x0, 0x7, 0x40, 0x0,
-    0x74, 0x0, 0x7, 0x40, 0x0, 0x82, 0x19, 0x99,
-    0x0,
-
-    /* U+006B "k" */
-    0x83, 0x0, 0x0, 0x0, 0x83, 0x0, 0x0, 0x0,
-    0x83, 0x0, 0x0, 0x0, 0x83, 0x0, 0x9, 0x40,
-    0x83, 0x1, 0xa2, 0x0, 0x83, 0x2b, 0x10, 0x0,
-    0x86, 0xaa, 0x30, 0x0, 0x8a, 0x0, 0xb1, 0x0,
-    0x83, 0x0, 0x2b, 0x0, 0x83, 0x0, 0x3, 0x90,
-
-    /* U+006C "l" */
-    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-    0x83, 0x83,
-
-    /* U+006D "m" */
-    0x84, 0x88, 0x99, 0x5, 0x98, 0xa6, 0x8, 0xa0,
-    0x0, 0x4c, 0x60, 0x0, 0x93, 0x84, 0x0, 0x0,
-    0xd0, 0x0, 0x4, 0x78, 0x30, 0x0, 0xb, 0x0,
-    0x0, 0x38, 0x83, 0x0, 0x0, 0xb0, 0x0, 0x3,
-    0x88, 0x30, 0x0, 0xb, 0x0, 0x0, 0x38, 0x83,
-    0x0, 0x0, 0xb0, 0x0, 0x3, 0x80,
-
-    /* U+006E "n" */
-    0x84, 0x88, 0x9a, 0x10, 0x8a, 0x0, 0x1, 0xa0,
-    0x84, 0x0, 0x0, 0xb0, 0x83, 0x0, 0x0, 0xa0,
-    0x83, 0x0, 0x0, 0xa0, 0x83, 0x0, 0x0, 0xa0,
-    0x83, 0x0, 0x0, 0xa0,
-
-    /* U+006F "o" */
-    0x0, 0x89, 0x9a, 0x50, 0xa, 0x30, 0x0, 0x76,
-    0x29, 0x0, 0x0, 0xb, 0x46, 0x0, 0x0, 0xb,
-    0x29, 0x0, 0x0, 0xb, 0xa, 0x30, 0x0, 0x75,
-    0x0, 0x89, 0x9a, 0x50,
-
-    /* U+0070 "p" */
-    0x83, 0x89, 0x9a, 0x30, 0x8b, 0x10, 0x0, 0xa2,
-    0x85, 0x0, 0x0, 0x1a, 0x83, 0x0, 0x0, 0xb,
-    0x85, 0x0, 0x0, 0x1a, 0x8b, 0x10, 0x0, 0xa2,
-    0x83, 0x89, 0x9a, 0x30, 0x83, 0x0, 0x0, 0x0,
-    0x83, 0x0, 0x0, 0x0, 0x83, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x89, 0x99, 0x4b, 0xa, 0x30, 0x0, 0x7d,
-    0x29, 0x0, 0x0, 0xd, 0x46, 0x0, 0x0, 0xb,
-    0x29, 0x0, 0x0, 0xd, 0xa, 0x30, 0x0, 0x7d,
-    0x0, 0x89, 0x99, 0x4b, 0x0, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb,
-
-    /* U+0072 "r" */
-    0x84, 0x98, 0x8a, 0x0, 0x84, 0x0, 0x83, 0x0,
-    0x83, 0x0, 0x83, 0x0, 0x83, 0x0,
-
-    /* U+0073 "s" */
-    0x7, 0x99, 0x97, 0x4, 0x70, 0x0, 0x0, 0x3a,
-    0x0, 0x0, 0x0, 0x49, 0x98, 0x20, 0x0, 0x0,
-    0x1b, 0x12, 0x0, 0x0, 0x92, 0x3a, 0x99, 0x96,
-    0x0,
-
-    /* U+0074 "t" */
-    0x3, 0x20, 0x0, 0x6, 0x50, 0x0, 0x6b, 0xb9,
-    0x50, 0x6, 0x50, 0x0, 0x6, 0x50, 0x0, 0x6,
-    0x50, 0x0, 0x6, 0x50, 0x0, 0x5, 0x60, 0x0,
-    0x0, 0xa9, 0x90,
-
-    /* U+0075 "u" */
-    0x91, 0x0, 0x0, 0xb9, 0x10, 0x0, 0xb, 0x91,
-    0x0, 0x0, 0xb9, 0x10, 0x0, 0xb, 0x92, 0x0,
-    0x0, 0xc4, 0x80, 0x0, 0x6c, 0x7, 0xa9, 0x95,
-    0xa0,
-
-    /* U+0076 "v" */
-    0xa1, 0x0, 0x0, 0x92, 0x47, 0x0, 0x1, 0x90,
-    0xb, 0x0, 0x8, 0x20, 0x5, 0x60, 0xa, 0x0,
-    0x0, 0xb0, 0x73, 0x0, 0x0, 0x65, 0xa0, 0x0,
-    0x0, 0xd, 0x40, 0x0,
-
-    /* U+0077 "w" */
-    0x90, 0x0, 0x7, 0x80, 0x0, 0xa, 0x46, 0x0,
-    0xa, 0xa0, 0x0, 0x45, 0xa, 0x0, 0x46, 0x55,
-    0x0, 0x90, 0x7, 0x20, 0x90, 0xa, 0x1, 0x80,
-    0x1, 0x81, 0x80, 0x8, 0x27, 0x20, 0x0, 0x97,
-    0x20, 0x1, 0x8a, 0x0, 0x0, 0x4b, 0x0, 0x0,
-    0xa5, 0x0,
-
-    /* U+0078 "x" */
-    0x2a, 0x0, 0x6, 0x50, 0x57, 0x3, 0x80, 0x0,
-    0x76, 0xa0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x93,
-    0xa1, 0x0, 0x75, 0x2, 0xa0, 0x48, 0x0, 0x4,
-    0x80,
-
-    /* U+0079 "y" */
-    0xa, 0x10, 0x0, 0x9, 0x20, 0x37, 0x0, 0x1,
-    0x90, 0x0, 0xa0, 0x0, 0x73, 0x0, 0x4, 0x60,
-    0xa, 0x0, 0x0, 0xb, 0x6, 0x40, 0x0, 0x0,
-    0x55, 0xa0, 0x0, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0x4, 0x70, 0x0,
-    0x2, 0xa9, 0x90, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x29, 0x99, 0x9e, 0x30, 0x0, 0x5, 0x70, 0x0,
-    0x2, 0xa0, 0x0, 0x1, 0xb0, 0x0, 0x0, 0xa2,
-    0x0, 0x0, 0x84, 0x0, 0x0, 0x4d, 0x99, 0x99,
-    0x30,
-
-    /* U+007B "{" */
-    0x0, 0x89, 0x10, 0xb, 0x0, 0x0, 0xb0, 0x0,
-    0xb, 0x0, 0x0, 0xb0, 0x0, 0xa, 0x0, 0x1b,
-    0x70, 0x0, 0xa, 0x0, 0x0, 0xb0, 0x0, 0xb,
-    0x0, 0x0, 0xb0, 0x0, 0xb, 0x0, 0x0, 0x89,
-    0x10,
-
-    /* U+007C "|" */
-    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
-    0x45, 0x45, 0x45, 0x45, 0x45,
-
-    /* U+007D "}" */
-    0x6b, 0x20, 0x3, 0x70, 0x3, 0x80, 0x3, 0x80,
-    0x3, 0x80, 0x2, 0x80, 0x0, 0xd5, 0x2, 0x80,
-    0x3, 0x80, 0x3, 0x80, 0x3, 0x80, 0x3, 0x70,
-    0x6b, 0x20,
-
-    /* U+007E "~" */
-    0x6, 0x88, 0x10, 0x60, 0x6, 0x1, 0x88, 0x50,
-
-    /* U+00AB "«" */
-    0x0, 0x92, 0x46, 0x7, 0x42, 0x80, 0x1a, 0xa,
-    0x0, 0x7, 0x42, 0x80, 0x0, 0x92, 0x46,
-
-    /* U+00BB "»" */
-    0x19, 0x9, 0x10, 0x3, 0x70, 0x90, 0x0, 0x91,
-    0x46, 0x3, 0x70, 0x90, 0x19, 0x9, 0x10,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x51, 0x0, 0x0, 0x0, 0x8, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0xaa, 0xaa, 0xa3,
-    0x37, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x0, 0x3c, 0x99, 0x99, 0x60,
-    0x37, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x0, 0x3c, 0x99, 0x99, 0x95,
-
-    /* U+0401 "Ё" */
-    0x0, 0x83, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0xaa, 0xaa, 0xa3, 0x37, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x3c, 0x99, 0x99, 0x60, 0x37, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x3c, 0x99, 0x99, 0x95,
-
-    /* U+0402 "Ђ" */
-    0x8a, 0xac, 0xca, 0xaa, 0x10, 0x0, 0x0, 0x56,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x56, 0x14, 0x64, 0x0, 0x0, 0x5,
-    0xc7, 0x43, 0x5b, 0x20, 0x0, 0x56, 0x0, 0x0,
-    0x1a, 0x0, 0x5, 0x60, 0x0, 0x0, 0xb0, 0x0,
-    0x56, 0x0, 0x0, 0x39, 0x0, 0x5, 0x60, 0x49,
-    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x33, 0x0, 0x0, 0x66, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xca, 0xaa, 0xa8, 0x37, 0x0,
-    0x0, 0x3, 0x70, 0x0, 0x0, 0x37, 0x0, 0x0,
-    0x3, 0x70, 0x0, 0x0, 0x37, 0x0, 0x0, 0x3,
-    0x70, 0x0, 0x0, 0x37, 0x0, 0x0, 0x3, 0x70,
-    0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x8, 0xaa, 0xaa, 0x50, 0x1, 0xb4, 0x0,
-    0x0, 0x61, 0xa, 0x30, 0x0, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x99, 0x99, 0x80,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0xa, 0x30,
-    0x0, 0x0, 0x0, 0x1, 0xb4, 0x0, 0x0, 0x61,
-    0x0, 0x8, 0xaa, 0xaa, 0x50,
-
-    /* U+0405 "Ѕ" */
-    0x1, 0x9a, 0x99, 0x92, 0xa, 0x20, 0x0, 0x1,
-    0xb, 0x0, 0x0, 0x0, 0x8, 0x70, 0x0, 0x0,
-    0x0, 0x49, 0x98, 0x30, 0x0, 0x0, 0x1, 0x87,
-    0x0, 0x0, 0x0, 0xb, 0x6, 0x0, 0x0, 0x2a,
-    0x4, 0xa9, 0x99, 0x91,
-
-    /* U+0406 "І" */
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37,
-
-    /* U+0407 "Ї" */
-    0x83, 0x2a, 0x0, 0x0, 0x4, 0x60, 0x4, 0x60,
-    0x4, 0x60, 0x4, 0x60, 0x4, 0x60, 0x4, 0x60,
-    0x4, 0x60, 0x4, 0x60, 0x4, 0x60,
-
-    /* U+0408 "Ј" */
-    0x7, 0xaa, 0xa9, 0x0, 0x0, 0x19, 0x0, 0x0,
-    0x19, 0x0, 0x0, 0x19, 0x0, 0x0, 0x19, 0x0,
-    0x0, 0x19, 0x0, 0x0, 0x29, 0x51, 0x0, 0x66,
-    0x19, 0x9a, 0x90,
-
-    /* U+0409 "Љ" */
-    0x0, 0x4c, 0xaa, 0xaa, 0xd4, 0x0, 0x0, 0x0,
-    0x0, 0x45, 0x0, 0x0, 0x94, 0x0, 0x0, 0x0,
-    0x0, 0x55, 0x0, 0x0, 0x94, 0x0, 0x0, 0x0,
-    0x0, 0x64, 0x0, 0x0, 0x9a, 0x99, 0x99, 0x50,
-    0x0, 0x63, 0x0, 0x0, 0x94, 0x0, 0x0, 0x67,
-    0x0, 0x82, 0x0, 0x0, 0x94, 0x0, 0x0, 0xb,
-    0x0, 0xa0, 0x0, 0x0, 0x94, 0x0, 0x0, 0xb,
-    0x1, 0xa0, 0x0, 0x0, 0x94, 0x0, 0x0, 0x59,
-    0x8b, 0x20, 0x0, 0x0, 0x9b, 0xaa, 0xaa, 0x80,
-
-    /* U+040A "Њ" */
-    0x37, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0,
-    0x3c, 0x99, 0x99, 0x9b, 0xc9, 0x99, 0xa6, 0x0,
-    0x37, 0x0, 0x0, 0x4, 0x80, 0x0, 0x6, 0x90,
-    0x37, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0xc0,
-    0x37, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0xb0,
-    0x37, 0x0, 0x0, 0x4, 0x80, 0x0, 0x3, 0xa0,
-    0x37, 0x0, 0x0, 0x4, 0xc9, 0x99, 0x98, 0x0,
-
-    /* U+040B "Ћ" */
-    0x9a, 0xac, 0xca, 0xaa, 0x0, 0x0, 0x0, 0x65,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x68, 0x89, 0x9a, 0x40, 0x0, 0x6,
-    0x91, 0x0, 0xa, 0x40, 0x0, 0x65, 0x0, 0x0,
-    0x1a, 0x0, 0x6, 0x50, 0x0, 0x0, 0xb0, 0x0,
-    0x65, 0x0, 0x0, 0xb, 0x0, 0x6, 0x50, 0x0,
-    0x0, 0xb0,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x25, 0x0, 0x0, 0x0, 0x57, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x70, 0x0,
-    0x2, 0xa0, 0x37, 0x0, 0x1, 0xa1, 0x3, 0x70,
-    0x0, 0xa2, 0x0, 0x37, 0x0, 0x83, 0x0, 0x3,
-    0xc9, 0xaa, 0x0, 0x0, 0x37, 0x0, 0x85, 0x0,
-    0x3, 0x70, 0x0, 0x93, 0x0, 0x37, 0x0, 0x0,
-    0xa2, 0x3, 0x70, 0x0, 0x0, 0xb1,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x29, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x70, 0x0,
-    0x0, 0x4c, 0x37, 0x0, 0x0, 0x2a, 0xb3, 0x70,
-    0x0, 0x1b, 0x1b, 0x37, 0x0, 0xb, 0x20, 0xb3,
-    0x70, 0x9, 0x30, 0xb, 0x37, 0x7, 0x50, 0x0,
-    0xb3, 0x75, 0x80, 0x0, 0xb, 0x3b, 0xa0, 0x0,
-    0x0, 0xb3, 0xc0, 0x0, 0x0, 0xb,
-
-    /* U+040E "Ў" */
-    0x0, 0x72, 0x1, 0x90, 0x0, 0x0, 0x6, 0x67,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66,
-    0x0, 0x0, 0x0, 0xb0, 0xb, 0x0, 0x0, 0x6,
-    0x40, 0x4, 0x70, 0x0, 0x1a, 0x0, 0x0, 0xa1,
-    0x0, 0x92, 0x0, 0x0, 0x29, 0x3, 0x70, 0x0,
-    0x0, 0x9, 0x2a, 0x0, 0x0, 0x0, 0x1, 0xd4,
-    0x0, 0x0, 0x0, 0x2, 0xa0, 0x0, 0x0, 0x5,
-    0x9a, 0x10, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x37, 0x0, 0x0, 0x3, 0x83, 0x70, 0x0, 0x0,
-    0x38, 0x37, 0x0, 0x0, 0x3, 0x83, 0x70, 0x0,
-    0x0, 0x38, 0x37, 0x0, 0x0, 0x3, 0x83, 0x70,
-    0x0, 0x0, 0x38, 0x37, 0x0, 0x0, 0x3, 0x83,
-    0x70, 0x0, 0x0, 0x38, 0x3c, 0x99, 0x99, 0x9b,
-    0x80, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0xb0,
-    0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x7b, 0x0, 0x0, 0x0, 0x0, 0xa8,
-    0x30, 0x0, 0x0, 0x7, 0x41, 0xa0, 0x0, 0x0,
-    0xb, 0x0, 0x83, 0x0, 0x0, 0x74, 0x0, 0x1b,
-    0x0, 0x0, 0xb0, 0x0, 0x8, 0x40, 0x7, 0xb9,
-    0x99, 0x99, 0xb0, 0xb, 0x0, 0x0, 0x0, 0x84,
-    0x74, 0x0, 0x0, 0x0, 0x1b,
-
-    /* U+0411 "Б" */
-    0x3c, 0x99, 0x99, 0x97, 0x3, 0x70, 0x0, 0x0,
-    0x0, 0x37, 0x0, 0x0, 0x0, 0x3, 0xc8, 0x88,
-    0x98, 0x10, 0x37, 0x0, 0x0, 0x2b, 0x3, 0x70,
-    0x0, 0x0, 0x73, 0x37, 0x0, 0x0, 0x7, 0x43,
-    0x70, 0x0, 0x1, 0xb0, 0x3c, 0x99, 0x99, 0xa2,
-    0x0,
-
-    /* U+0412 "В" */
-    0x3c, 0x99, 0x99, 0xa2, 0x3, 0x70, 0x0, 0x1,
-    0xb0, 0x37, 0x0, 0x0, 0xb, 0x3, 0x70, 0x0,
-    0x3, 0x90, 0x3c, 0x88, 0x8a, 0xc2, 0x3, 0x70,
-    0x0, 0x0, 0x92, 0x37, 0x0, 0x0, 0x4, 0x73,
-    0x70, 0x0, 0x0, 0x84, 0x3c, 0x99, 0x99, 0xa6,
-    0x0,
-
-    /* U+0413 "Г" */
-    0x3c, 0xaa, 0xaa, 0x83, 0x70, 0x0, 0x0, 0x37,
-    0x0, 0x0, 0x3, 0x70, 0x0, 0x0, 0x37, 0x0,
-    0x0, 0x3, 0x70, 0x0, 0x0, 0x37, 0x0, 0x0,
-    0x3, 0x70, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x6b, 0xaa, 0xaa, 0xd0, 0x0, 0x7, 0x30,
-    0x0, 0xb, 0x0, 0x0, 0x72, 0x0, 0x0, 0xb0,
-    0x0, 0x8, 0x20, 0x0, 0xb, 0x0, 0x0, 0x91,
-    0x0, 0x0, 0xb0, 0x0, 0xa, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0xa0, 0x0, 0x0, 0xb0, 0x0, 0x37,
-    0x0, 0x0, 0xb, 0x0, 0x8e, 0xa9, 0x99, 0x99,
-    0xe9, 0x4b, 0x0, 0x0, 0x0, 0x0, 0x37, 0xb0,
-    0x0, 0x0, 0x0, 0x3, 0x70,
-
-    /* U+0415 "Е" */
-    0x3c, 0xaa, 0xaa, 0xa3, 0x37, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x3c, 0x99, 0x99, 0x60, 0x37, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x3c, 0x99, 0x99, 0x95,
-
-    /* U+0416 "Ж" */
-    0x1b, 0x0, 0x0, 0x65, 0x0, 0x0, 0xb0, 0x4,
-    0x80, 0x0, 0x65, 0x0, 0x9, 0x30, 0x0, 0x83,
-    0x0, 0x65, 0x0, 0x47, 0x0, 0x0, 0xa, 0x10,
-    0x65, 0x1, 0xa0, 0x0, 0x0, 0x5, 0xc9, 0xcb,
-    0x9c, 0x40, 0x0, 0x0, 0x1b, 0x0, 0x65, 0x1,
-    0xb0, 0x0, 0x0, 0xa2, 0x0, 0x65, 0x0, 0x39,
-    0x0, 0x7, 0x60, 0x0, 0x65, 0x0, 0x7, 0x60,
-    0x49, 0x0, 0x0, 0x65, 0x0, 0x0, 0xa3,
-
-    /* U+0417 "З" */
-    0x18, 0x99, 0x9a, 0x30, 0x11, 0x0, 0x0, 0xb1,
-    0x0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x1, 0xb1,
-    0x0, 0x99, 0xae, 0x50, 0x0, 0x0, 0x0, 0x75,
-    0x0, 0x0, 0x0, 0xb, 0x50, 0x0, 0x0, 0x67,
-    0x29, 0x99, 0x9a, 0x70,
-
-    /* U+0418 "И" */
-    0x37, 0x0, 0x0, 0x4, 0xc3, 0x70, 0x0, 0x2,
-    0xab, 0x37, 0x0, 0x1, 0xb1, 0xb3, 0x70, 0x0,
-    0xb2, 0xb, 0x37, 0x0, 0x93, 0x0, 0xb3, 0x70,
-    0x75, 0x0, 0xb, 0x37, 0x58, 0x0, 0x0, 0xb3,
-    0xba, 0x0, 0x0, 0xb, 0x3c, 0x0, 0x0, 0x0,
-    0xb0,
-
-    /* U+0419 "Й" */
-    0x0, 0x31, 0x0, 0x40, 0x0, 0x0, 0x76, 0x73,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x70, 0x0,
-    0x0, 0x4c, 0x37, 0x0, 0x0, 0x2a, 0xb3, 0x70,
-    0x0, 0x1b, 0x1b, 0x37, 0x0, 0xb, 0x20, 0xb3,
-    0x70, 0x9, 0x30, 0xb, 0x37, 0x7, 0x50, 0x0,
-    0xb3, 0x75, 0x80, 0x0, 0xb, 0x3b, 0xa0, 0x0,
-    0x0, 0xb3, 0xc0, 0x0, 0x0, 0xb,
-
-    /* U+041A "К" */
-    0x37, 0x0, 0x0, 0x2a, 0x3, 0x70, 0x0, 0x1a,
-    0x10, 0x37, 0x0, 0xa, 0x20, 0x3, 0x70, 0x8,
-    0x30, 0x0, 0x3c, 0x9a, 0xa0, 0x0, 0x3, 0x70,
-    0x8, 0x50, 0x0, 0x37, 0x0, 0x9, 0x30, 0x3,
-    0x70, 0x0, 0xa, 0x20, 0x37, 0x0, 0x0, 0xb,
-    0x10,
-
-    /* U+041B "Л" */
-    0x0, 0x4c, 0xaa, 0xaa, 0xd2, 0x0, 0x45, 0x0,
-    0x0, 0x82, 0x0, 0x55, 0x0, 0x0, 0x82, 0x0,
-    0x64, 0x0, 0x0, 0x82, 0x0, 0x63, 0x0, 0x0,
-    0x82, 0x0, 0x82, 0x0, 0x0, 0x82, 0x0, 0xa0,
-    0x0, 0x0, 0x82, 0x1, 0xa0, 0x0, 0x0, 0x82,
-    0x8b, 0x20, 0x0, 0x0, 0x82,
-
-    /* U+041C "М" */
-    0x3a, 0x0, 0x0, 0x0, 0x3, 0xb3, 0xd5, 0x0,
-    0x0, 0x0, 0xab, 0x37, 0xa0, 0x0, 0x0, 0x74,
-    0xb3, 0x73, 0x80, 0x0, 0x19, 0xb, 0x37, 0x8,
-    0x30, 0x9, 0x10, 0xb3, 0x70, 0xa, 0x5, 0x60,
-    0xb, 0x37, 0x0, 0x48, 0xa0, 0x0, 0xb3, 0x70,
-    0x0, 0x82, 0x0, 0xb, 0x37, 0x0, 0x0, 0x0,
-    0x0, 0xb0,
-
-    /* U+041D "Н" */
-    0x37, 0x0, 0x0, 0x0, 0xb3, 0x70, 0x0, 0x0,
-    0xb, 0x37, 0x0, 0x0, 0x0, 0xb3, 0x70, 0x0,
-    0x0, 0xb, 0x3c, 0x99, 0x99, 0x99, 0xb3, 0x70,
-    0x0, 0x0, 0xb, 0x37, 0x0, 0x0, 0x0, 0xb3,
-    0x70, 0x0, 0x0, 0xb, 0x37, 0x0, 0x0, 0x0,
-    0xb0,
-
-    /* U+041E "О" */
-    0x0, 0x7, 0xaa, 0xaa, 0x60, 0x0, 0x1, 0xb4,
-    0x0, 0x0, 0x5b, 0x0, 0x9, 0x30, 0x0, 0x0,
-    0x4, 0x80, 0xb, 0x0, 0x0, 0x0, 0x0, 0xc0,
-    0x19, 0x0, 0x0, 0x0, 0x0, 0xa0, 0xb, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x9, 0x30, 0x0, 0x0,
-    0x4, 0x80, 0x1, 0xb4, 0x0, 0x0, 0x5b, 0x0,
-    0x0, 0x7, 0xaa, 0xaa, 0x70, 0x0,
-
-    /* U+041F "П" */
-    0x3c, 0xaa, 0xaa, 0xaa, 0xc3, 0x70, 0x0, 0x0,
-    0xb, 0x37, 0x0, 0x0, 0x0, 0xb3, 0x70, 0x0,
-    0x0, 0xb, 0x37, 0x0, 0x0, 0x0, 0xb3, 0x70,
-    0x0, 0x0, 0xb, 0x37, 0x0, 0x0, 0x0, 0xb3,
-    0x70, 0x0, 0x0, 0xb, 0x37, 0x0, 0x0, 0x0,
-    0xb0,
-
-    /* U+0420 "Р" */
-    0x3c, 0xaa, 0xaa, 0x91, 0x3, 0x70, 0x0, 0x2,
-    0xb0, 0x37, 0x0, 0x0, 0x8, 0x23, 0x70, 0x0,
-    0x0, 0x92, 0x37, 0x0, 0x0, 0x5a, 0x3, 0xc9,
-    0x99, 0x96, 0x0, 0x37, 0x0, 0x0, 0x0, 0x3,
-    0x70, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x7, 0xaa, 0xaa, 0x60, 0x1, 0xb4, 0x0,
-    0x0, 0x42, 0x9, 0x30, 0x0, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0x9, 0x30,
-    0x0, 0x0, 0x0, 0x1, 0xb4, 0x0, 0x0, 0x52,
-    0x0, 0x7, 0xaa, 0xaa, 0x60,
-
-    /* U+0422 "Т" */
-    0x8a, 0xac, 0xca, 0xa9, 0x0, 0x5, 0x60, 0x0,
-    0x0, 0x5, 0x60, 0x0, 0x0, 0x5, 0x60, 0x0,
-    0x0, 0x5, 0x60, 0x0, 0x0, 0x5, 0x60, 0x0,
-    0x0, 0x5, 0x60, 0x0, 0x0, 0x5, 0x60, 0x0,
-    0x0, 0x5, 0x60, 0x0,
-
-    /* U+0423 "У" */
-    0x66, 0x0, 0x0, 0x0, 0xb0, 0xb, 0x0, 0x0,
-    0x6, 0x40, 0x4, 0x70, 0x0, 0x1a, 0x0, 0x0,
-    0xa1, 0x0, 0x92, 0x0, 0x0, 0x29, 0x3, 0x70,
-    0x0, 0x0, 0x9, 0x2a, 0x0, 0x0, 0x0, 0x1,
-    0xd4, 0x0, 0x0, 0x0, 0x2, 0xa0, 0x0, 0x0,
-    0x5, 0x9a, 0x10, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x6, 0x99, 0xe9, 0x84, 0x0, 0x3, 0xa4,
-    0x0, 0xb0, 0x5, 0xa1, 0xb, 0x0, 0x0, 0xb0,
-    0x0, 0x29, 0x38, 0x0, 0x0, 0xb0, 0x0, 0xb,
-    0x38, 0x0, 0x0, 0xb0, 0x0, 0xb, 0xb, 0x0,
-    0x0, 0xb0, 0x0, 0x29, 0x3, 0xb4, 0x0, 0xb0,
-    0x5, 0xa1, 0x0, 0x6, 0x99, 0xe9, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0xb0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x1b, 0x0, 0x0, 0x1b, 0x0, 0x39, 0x0, 0xb,
-    0x20, 0x0, 0x76, 0x8, 0x40, 0x0, 0x0, 0xa8,
-    0x80, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x0,
-    0xb3, 0xb0, 0x0, 0x0, 0xa3, 0x5, 0x90, 0x0,
-    0x76, 0x0, 0x8, 0x50, 0x49, 0x0, 0x0, 0xa,
-    0x20,
-
-    /* U+0426 "Ц" */
-    0x37, 0x0, 0x0, 0x3, 0x80, 0x3, 0x70, 0x0,
-    0x0, 0x38, 0x0, 0x37, 0x0, 0x0, 0x3, 0x80,
-    0x3, 0x70, 0x0, 0x0, 0x38, 0x0, 0x37, 0x0,
-    0x0, 0x3, 0x80, 0x3, 0x70, 0x0, 0x0, 0x38,
-    0x0, 0x37, 0x0, 0x0, 0x3, 0x80, 0x3, 0x70,
-    0x0, 0x0, 0x38, 0x0, 0x3c, 0x99, 0x99, 0x9b,
-    0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x10,
-
-    /* U+0427 "Ч" */
-    0x46, 0x0, 0x0, 0x8, 0x34, 0x60, 0x0, 0x0,
-    0x83, 0x46, 0x0, 0x0, 0x8, 0x33, 0x80, 0x0,
-    0x0, 0x83, 0xb, 0x30, 0x0, 0x2b, 0x30, 0x18,
-    0x99, 0x97, 0x93, 0x0, 0x0, 0x0, 0x8, 0x30,
-    0x0, 0x0, 0x0, 0x83, 0x0, 0x0, 0x0, 0x8,
-    0x30,
-
-    /* U+0428 "Ш" */
-    0x37, 0x0, 0x0, 0xb0, 0x0, 0x2, 0x83, 0x70,
-    0x0, 0xb, 0x0, 0x0, 0x28, 0x37, 0x0, 0x0,
-    0xb0, 0x0, 0x2, 0x83, 0x70, 0x0, 0xb, 0x0,
-    0x0, 0x28, 0x37, 0x0, 0x0, 0xb0, 0x0, 0x2,
-    0x83, 0x70, 0x0, 0xb, 0x0, 0x0, 0x28, 0x37,
-    0x0, 0x0, 0xb0, 0x0, 0x2, 0x83, 0x70, 0x0,
-    0xb, 0x0, 0x0, 0x28, 0x3c, 0x99, 0x99, 0xe9,
-    0x99, 0x9b, 0x80,
-
-    /* U+0429 "Щ" */
-    0x37, 0x0, 0x0, 0xb0, 0x0, 0x2, 0x80, 0x3,
-    0x70, 0x0, 0xb, 0x0, 0x0, 0x28, 0x0, 0x37,
-    0x0, 0x0, 0xb0, 0x0, 0x2, 0x80, 0x3, 0x70,
-    0x0, 0xb, 0x0, 0x0, 0x28, 0x0, 0x37, 0x0,
-    0x0, 0xb0, 0x0, 0x2, 0x80, 0x3, 0x70, 0x0,
-    0xb, 0x0, 0x0, 0x28, 0x0, 0x37, 0x0, 0x0,
-    0xb0, 0x0, 0x2, 0x80, 0x3, 0x70, 0x0, 0xb,
-    0x0, 0x0, 0x28, 0x0, 0x3c, 0x99, 0x99, 0xe9,
-    0x99, 0x9b, 0xd9, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0x10,
-
-    /* U+042A "Ъ" */
-    0x8a, 0xad, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x99, 0x99, 0x40, 0x0, 0xb,
-    0x0, 0x0, 0x9, 0x40, 0x0, 0xb0, 0x0, 0x0,
-    0x1a, 0x0, 0xb, 0x0, 0x0, 0x0, 0xa0, 0x0,
-    0xb0, 0x0, 0x0, 0x75, 0x0, 0xb, 0x99, 0x99,
-    0x96, 0x0,
-
-    /* U+042B "Ы" */
-    0x37, 0x0, 0x0, 0x0, 0x0, 0xb3, 0x70, 0x0,
-    0x0, 0x0, 0xb, 0x37, 0x0, 0x0, 0x0, 0x0,
-    0xb3, 0xc9, 0x99, 0x97, 0x0, 0xb, 0x37, 0x0,
-    0x0, 0x3b, 0x0, 0xb3, 0x70, 0x0, 0x0, 0x92,
-    0xb, 0x37, 0x0, 0x0, 0x8, 0x20, 0xb3, 0x70,
-    0x0, 0x1, 0xb0, 0xb, 0x3c, 0x99, 0x99, 0x92,
-    0x0, 0xb0,
-
-    /* U+042C "Ь" */
-    0x37, 0x0, 0x0, 0x0, 0x3, 0x70, 0x0, 0x0,
-    0x0, 0x37, 0x0, 0x0, 0x0, 0x3, 0xc9, 0x99,
-    0x97, 0x0, 0x37, 0x0, 0x0, 0x3b, 0x3, 0x70,
-    0x0, 0x0, 0x92, 0x37, 0x0, 0x0, 0x8, 0x23,
-    0x70, 0x0, 0x1, 0xb0, 0x3c, 0x99, 0x99, 0x92,
-    0x0,
-
-    /* U+042D "Э" */
-    0x6, 0xaa, 0xaa, 0x70, 0x2, 0x50, 0x0, 0x5,
-    0xb0, 0x0, 0x0, 0x0, 0x5, 0x80, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x9, 0x99, 0x99, 0xd0, 0x0,
-    0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x5, 0x82,
-    0x50, 0x0, 0x5, 0xb0, 0x6, 0xaa, 0xaa, 0x70,
-    0x0,
-
-    /* U+042E "Ю" */
-    0x37, 0x0, 0x2, 0x9a, 0xaa, 0x92, 0x0, 0x37,
-    0x0, 0x3b, 0x20, 0x0, 0x2b, 0x30, 0x37, 0x0,
-    0xc1, 0x0, 0x0, 0x1, 0xb0, 0x37, 0x3, 0x80,
-    0x0, 0x0, 0x0, 0x83, 0x3c, 0xac, 0x60, 0x0,
-    0x0, 0x0, 0x65, 0x37, 0x3, 0x80, 0x0, 0x0,
-    0x0, 0x83, 0x37, 0x0, 0xc1, 0x0, 0x0, 0x1,
-    0xb0, 0x37, 0x0, 0x3b, 0x20, 0x0, 0x2b, 0x30,
-    0x37, 0x0, 0x2, 0x9a, 0xaa, 0x92, 0x0,
-
-    /* U+042F "Я" */
-    0x8, 0xaa, 0xaa, 0xb7, 0x95, 0x0, 0x0, 0x37,
-    0xc0, 0x0, 0x0, 0x37, 0xc0, 0x0, 0x0, 0x37,
-    0x87, 0x0, 0x0, 0x37, 0x5, 0xd9, 0x99, 0xb7,
-    0x4, 0x70, 0x0, 0x37, 0x1a, 0x0, 0x0, 0x37,
-    0x92, 0x0, 0x0, 0x37,
-
-    /* U+0430 "а" */
-    0x5, 0xa9, 0x99, 0x10, 0x40, 0x0, 0x38, 0x0,
-    0x0, 0x0, 0xb0, 0x38, 0x88, 0x8b, 0x1b, 0x0,
-    0x0, 0xb1, 0x90, 0x0, 0x4b, 0x6, 0x98, 0x85,
-    0xa0,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x1, 0x50, 0x0, 0x49, 0xa8, 0x40,
-    0x9, 0x60, 0x0, 0x0, 0x55, 0x0, 0x0, 0x0,
-    0xa2, 0x99, 0xa9, 0x10, 0xb9, 0x0, 0x2, 0xb0,
-    0xf1, 0x0, 0x0, 0x74, 0xd0, 0x0, 0x0, 0x56,
-    0xa1, 0x0, 0x0, 0x74, 0x3a, 0x0, 0x2, 0xb0,
-    0x4, 0xa9, 0x99, 0x10,
-
-    /* U+0432 "в" */
-    0x7a, 0x88, 0x97, 0x7, 0x30, 0x0, 0x92, 0x73,
-    0x0, 0xa, 0x17, 0x98, 0x8b, 0x70, 0x73, 0x0,
-    0x6, 0x47, 0x30, 0x0, 0x56, 0x7a, 0x88, 0x99,
-    0x0,
-
-    /* U+0433 "г" */
-    0x7b, 0x99, 0x94, 0x73, 0x0, 0x0, 0x73, 0x0,
-    0x0, 0x73, 0x0, 0x0, 0x73, 0x0, 0x0, 0x73,
-    0x0, 0x0, 0x73, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0xd9, 0x99, 0xc3, 0x0, 0xa, 0x0, 0x7,
-    0x30, 0x0, 0x90, 0x0, 0x73, 0x0, 0x18, 0x0,
-    0x7, 0x30, 0x3, 0x60, 0x0, 0x73, 0x0, 0x82,
-    0x0, 0x7, 0x30, 0x8e, 0x99, 0x99, 0xca, 0x3a,
-    0x0, 0x0, 0x0, 0x46, 0x50, 0x0, 0x0, 0x2,
-    0x30,
-
-    /* U+0435 "е" */
-    0x0, 0x89, 0x9a, 0x40, 0x9, 0x30, 0x0, 0x92,
-    0x19, 0x0, 0x0, 0x19, 0x3b, 0x77, 0x77, 0x78,
-    0x1a, 0x0, 0x0, 0x0, 0x9, 0x40, 0x0, 0x31,
-    0x0, 0x7a, 0x99, 0x80,
-
-    /* U+0436 "ж" */
-    0x29, 0x0, 0xb, 0x0, 0x5, 0x60, 0x65, 0x0,
-    0xb0, 0x2, 0xa0, 0x0, 0x92, 0xb, 0x0, 0xa1,
-    0x0, 0x2, 0xc9, 0xe9, 0xa7, 0x0, 0x0, 0xb1,
-    0xb, 0x0, 0xa2, 0x0, 0x84, 0x0, 0xb0, 0x1,
-    0xb0, 0x58, 0x0, 0xb, 0x0, 0x3, 0x90,
-
-    /* U+0437 "з" */
-    0x19, 0x99, 0xa6, 0x0, 0x0, 0x0, 0xa2, 0x0,
-    0x0, 0xa, 0x10, 0x6, 0x8c, 0x60, 0x0, 0x0,
-    0x8, 0x41, 0x0, 0x0, 0x74, 0x29, 0x99, 0x97,
-    0x0,
-
-    /* U+0438 "и" */
-    0x73, 0x0, 0x1, 0xe0, 0x73, 0x0, 0x1a, 0xb0,
-    0x73, 0x0, 0xa2, 0xa0, 0x73, 0x9, 0x30, 0xa0,
-    0x73, 0x75, 0x0, 0xa0, 0x79, 0x60, 0x0, 0xa0,
-    0x79, 0x0, 0x0, 0xa0,
-
-    /* U+0439 "й" */
-    0x1, 0x30, 0x4, 0x0, 0x0, 0x67, 0x72, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x73, 0x0, 0x1, 0xe0,
-    0x73, 0x0, 0x1a, 0xb0, 0x73, 0x0, 0xa2, 0xa0,
-    0x73, 0x9, 0x30, 0xa0, 0x73, 0x75, 0x0, 0xa0,
-    0x79, 0x60, 0x0, 0xa0, 0x79, 0x0, 0x0, 0xa0,
-
-    /* U+043A "к" */
-    0x73, 0x0, 0x9, 0x27, 0x30, 0x8, 0x30, 0x73,
-    0x6, 0x50, 0x7, 0xa9, 0xc0, 0x0, 0x73, 0x5,
-    0x80, 0x7, 0x30, 0x7, 0x60, 0x73, 0x0, 0x8,
-    0x40,
-
-    /* U+043B "л" */
-    0x0, 0xd9, 0x99, 0xc3, 0x0, 0xa0, 0x0, 0x73,
-    0x0, 0x90, 0x0, 0x73, 0x1, 0x80, 0x0, 0x73,
-    0x3, 0x60, 0x0, 0x73, 0x7, 0x30, 0x0, 0x73,
-    0x99, 0x0, 0x0, 0x73,
-
-    /* U+043C "м" */
-    0x78, 0x0, 0x0, 0x8, 0x77, 0xb2, 0x0, 0x2,
-    0xb7, 0x73, 0xa0, 0x0, 0xa3, 0x77, 0x25, 0x60,
-    0x64, 0x37, 0x72, 0x9, 0x29, 0x3, 0x77, 0x20,
-    0x1d, 0x10, 0x37, 0x72, 0x0, 0x0, 0x3, 0x70,
-
-    /* U+043D "н" */
-    0x73, 0x0, 0x0, 0xb7, 0x30, 0x0, 0xb, 0x73,
-    0x0, 0x0, 0xb7, 0xa9, 0x99, 0x9c, 0x73, 0x0,
-    0x0, 0xb7, 0x30, 0x0, 0xb, 0x73, 0x0, 0x0,
-    0xb0,
-
-    /* U+043E "о" */
-    0x0, 0x7a, 0x9a, 0x60, 0x0, 0x94, 0x0, 0x6,
-    0x70, 0x1a, 0x0, 0x0, 0xb, 0x3, 0x70, 0x0,
-    0x0, 0xa1, 0x1a, 0x0, 0x0, 0xb, 0x0, 0x94,
-    0x0, 0x6, 0x70, 0x0, 0x7a, 0x9a, 0x60, 0x0,
-
-    /* U+043F "п" */
-    0x7b, 0x99, 0x99, 0xd7, 0x30, 0x0, 0xb, 0x73,
-    0x0, 0x0, 0xb7, 0x30, 0x0, 0xb, 0x73, 0x0,
-    0x0, 0xb7, 0x30, 0x0, 0xb, 0x73, 0x0, 0x0,
-    0xb0,
-
-    /* U+0440 "р" */
-    0x73, 0x89, 0x9a, 0x40, 0x7b, 0x20, 0x0, 0xa3,
-    0x76, 0x0, 0x0, 0x1a, 0x74, 0x0, 0x0, 0xb,
-    0x76, 0x0, 0x0, 0x1a, 0x7b, 0x20, 0x0, 0xa3,
-    0x74, 0x89, 0x9a, 0x40, 0x73, 0x0, 0x0, 0x0,
-    0x73, 0x0, 0x0, 0x0, 0x73, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x7a, 0x9a, 0x60, 0x9, 0x40, 0x0, 0x50,
-    0x1a, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x1a, 0x0, 0x0, 0x0, 0x9, 0x40, 0x0, 0x50,
-    0x0, 0x7a, 0x9a, 0x60,
-
-    /* U+0442 "т" */
-    0x9, 0x9a, 0xd9, 0x93, 0x0, 0x2, 0x80, 0x0,
-    0x0, 0x2, 0x80, 0x0, 0x0, 0x2, 0x80, 0x0,
-    0x0, 0x2, 0x80, 0x0, 0x0, 0x2, 0x80, 0x0,
-    0x0, 0x2, 0x80, 0x0,
-
-    /* U+0443 "у" */
-    0x9, 0x20, 0x0, 0x7, 0x30, 0x29, 0x0, 0x0,
-    0xa0, 0x0, 0x91, 0x0, 0x65, 0x0, 0x3, 0x80,
-    0xa, 0x0, 0x0, 0xa, 0x14, 0x60, 0x0, 0x0,
-    0x37, 0xa0, 0x0, 0x0, 0x0, 0xb7, 0x0, 0x0,
-    0x0, 0xa, 0x10, 0x0, 0x0, 0x2, 0x80, 0x0,
-    0x1, 0xa9, 0x90, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
-    0x69, 0x9e, 0x9a, 0x40, 0x9, 0x50, 0xb, 0x0,
-    0x85, 0x29, 0x0, 0xb, 0x0, 0xb, 0x47, 0x0,
-    0xb, 0x0, 0xb, 0x2a, 0x0, 0xb, 0x0, 0xb,
-    0x9, 0x50, 0xb, 0x0, 0x85, 0x0, 0x6a, 0x9e,
-    0x99, 0x40, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0,
-    0x0,
-
-    /* U+0445 "х" */
-    0x39, 0x0, 0x7, 0x50, 0x57, 0x4, 0x70, 0x0,
-    0x86, 0xa0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0xa3,
-    0xb0, 0x0, 0x84, 0x2, 0xa0, 0x57, 0x0, 0x5,
-    0x80,
-
-    /* U+0446 "ц" */
-    0x73, 0x0, 0x0, 0xb0, 0x73, 0x0, 0x0, 0xb0,
-    0x73, 0x0, 0x0, 0xb0, 0x73, 0x0, 0x0, 0xb0,
-    0x73, 0x0, 0x0, 0xb0, 0x73, 0x0, 0x0, 0xb0,
-    0x7a, 0x99, 0x99, 0xe8, 0x0, 0x0, 0x0, 0xa,
-    0x0, 0x0, 0x0, 0x5,
-
-    /* U+0447 "ч" */
-    0x46, 0x0, 0x0, 0xb4, 0x60, 0x0, 0xb, 0x46,
-    0x0, 0x0, 0xb1, 0xb0, 0x0, 0x2b, 0x3, 0x99,
-    0x86, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
-    0xb0,
-
-    /* U+0448 "ш" */
-    0x73, 0x0, 0xb, 0x0, 0x5, 0x57, 0x30, 0x0,
-    0xb0, 0x0, 0x55, 0x73, 0x0, 0xb, 0x0, 0x5,
-    0x57, 0x30, 0x0, 0xb0, 0x0, 0x55, 0x73, 0x0,
-    0xb, 0x0, 0x5, 0x57, 0x30, 0x0, 0xb0, 0x0,
-    0x55, 0x7a, 0x99, 0x9e, 0x99, 0x9b, 0x50,
-
-    /* U+0449 "щ" */
-    0x73, 0x0, 0xb, 0x0, 0x5, 0x50, 0x73, 0x0,
-    0xb, 0x0, 0x5, 0x50, 0x73, 0x0, 0xb, 0x0,
-    0x5, 0x50, 0x73, 0x0, 0xb, 0x0, 0x5, 0x50,
-    0x73, 0x0, 0xb, 0x0, 0x5, 0x50, 0x73, 0x0,
-    0xb, 0x0, 0x5, 0x50, 0x7a, 0x99, 0x9e, 0x99,
-    0x9c, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x13,
-
-    /* U+044A "ъ" */
-    0x9, 0x9d, 0x0, 0x0, 0x0, 0x0, 0xa0, 0x0,
-    0x0, 0x0, 0xa, 0x88, 0x88, 0x10, 0x0, 0xa0,
-    0x0, 0x2a, 0x0, 0xa, 0x0, 0x0, 0xb0, 0x0,
-    0xa0, 0x0, 0xb, 0x0, 0xa, 0x88, 0x89, 0x20,
-
-    /* U+044B "ы" */
-    0x73, 0x0, 0x0, 0x7, 0x37, 0x30, 0x0, 0x0,
-    0x73, 0x79, 0x88, 0x82, 0x7, 0x37, 0x30, 0x0,
-    0xb0, 0x73, 0x73, 0x0, 0x8, 0x27, 0x37, 0x30,
-    0x0, 0xb0, 0x73, 0x7a, 0x88, 0x94, 0x7, 0x30,
-
-    /* U+044C "ь" */
-    0x73, 0x0, 0x0, 0x7, 0x30, 0x0, 0x0, 0x79,
-    0x88, 0x82, 0x7, 0x30, 0x0, 0xb0, 0x73, 0x0,
-    0x8, 0x37, 0x30, 0x0, 0xa1, 0x7a, 0x88, 0x95,
-    0x0,
-
-    /* U+044D "э" */
-    0x19, 0x99, 0x96, 0x0, 0x11, 0x0, 0x4, 0x80,
-    0x0, 0x0, 0x0, 0x91, 0x0, 0x48, 0x88, 0xb2,
-    0x0, 0x0, 0x0, 0xa1, 0x11, 0x0, 0x5, 0x80,
-    0x19, 0x99, 0x96, 0x0,
-
-    /* U+044E "ю" */
-    0x73, 0x0, 0x5a, 0x99, 0x80, 0x7, 0x30, 0x58,
-    0x0, 0x4, 0x90, 0x73, 0xb, 0x0, 0x0, 0xa,
-    0x17, 0xa9, 0xc0, 0x0, 0x0, 0x83, 0x73, 0xb,
-    0x0, 0x0, 0xa, 0x17, 0x30, 0x58, 0x0, 0x4,
-    0x90, 0x73, 0x0, 0x5a, 0x99, 0x80, 0x0,
-
-    /* U+044F "я" */
-    0x3, 0xa9, 0x99, 0xc0, 0xb0, 0x0, 0xa, 0xa,
-    0x0, 0x0, 0xa0, 0xb1, 0x0, 0xa, 0x1, 0xa9,
-    0x88, 0xc0, 0x1a, 0x0, 0xa, 0xa, 0x20, 0x0,
-    0xa0,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x43, 0x0, 0x0, 0x0, 0x6, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x89, 0x9a, 0x40,
-    0x9, 0x30, 0x0, 0x92, 0x19, 0x0, 0x0, 0x19,
-    0x3b, 0x77, 0x77, 0x78, 0x1a, 0x0, 0x0, 0x0,
-    0x9, 0x40, 0x0, 0x31, 0x0, 0x7a, 0x99, 0x80,
-
-    /* U+0451 "ё" */
-    0x0, 0x57, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x89, 0x9a, 0x40, 0x9, 0x30, 0x0, 0x92,
-    0x19, 0x0, 0x0, 0x19, 0x3b, 0x77, 0x77, 0x78,
-    0x1a, 0x0, 0x0, 0x0, 0x9, 0x40, 0x0, 0x31,
-    0x0, 0x7a, 0x99, 0x80,
-
-    /* U+0452 "ђ" */
-    0x0, 0x73, 0x0, 0x0, 0x0, 0x8, 0xb9, 0x88,
-    0x60, 0x0, 0x0, 0x73, 0x0, 0x0, 0x0, 0x0,
-    0x74, 0x99, 0x9a, 0x10, 0x0, 0x7b, 0x0, 0x2,
-    0xb0, 0x0, 0x75, 0x0, 0x0, 0xb0, 0x0, 0x73,
-    0x0, 0x0, 0xa1, 0x0, 0x73, 0x0, 0x0, 0xa1,
-    0x0, 0x73, 0x0, 0x0, 0xa1, 0x0, 0x73, 0x0,
-    0x0, 0xa1, 0x0, 0x0, 0x0, 0x0, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x3, 0x9a,
-    0x70,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x1, 0x60, 0x0, 0x38, 0x10, 0x0, 0x0,
-    0x0, 0x7b, 0x99, 0x94, 0x73, 0x0, 0x0, 0x73,
-    0x0, 0x0, 0x73, 0x0, 0x0, 0x73, 0x0, 0x0,
-    0x73, 0x0, 0x0, 0x73, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x79, 0x99, 0x91, 0x9, 0x40, 0x0, 0x11,
-    0x19, 0x0, 0x0, 0x0, 0x4b, 0x88, 0x84, 0x0,
-    0x19, 0x0, 0x0, 0x0, 0x9, 0x40, 0x0, 0x11,
-    0x0, 0x79, 0x89, 0x81,
-
-    /* U+0455 "ѕ" */
-    0x4, 0xa9, 0x99, 0x10, 0xb0, 0x0, 0x0, 0xb,
-    0x20, 0x0, 0x0, 0x28, 0x99, 0x50, 0x0, 0x0,
-    0x7, 0x60, 0x20, 0x0, 0x47, 0x9, 0x99, 0x99,
-    0x0,
-
-    /* U+0456 "і" */
-    0x95, 0x0, 0x0, 0x73, 0x73, 0x73, 0x73, 0x73,
-    0x73, 0x73,
-
-    /* U+0457 "ї" */
-    0x65, 0x91, 0x0, 0x0, 0x8, 0x30, 0x8, 0x30,
-    0x8, 0x30, 0x8, 0x30, 0x8, 0x30, 0x8, 0x30,
-    0x8, 0x30,
-
-    /* U+0458 "ј" */
-    0x0, 0x8, 0x50, 0x0, 0x0, 0x0, 0x7, 0x30,
-    0x0, 0x73, 0x0, 0x7, 0x30, 0x0, 0x73, 0x0,
-    0x7, 0x30, 0x0, 0x73, 0x0, 0x7, 0x30, 0x0,
-    0x73, 0x0, 0x9, 0x21, 0x99, 0x80,
-
-    /* U+0459 "љ" */
-    0x0, 0xd9, 0x99, 0xc4, 0x0, 0x0, 0x0, 0xa,
-    0x0, 0x8, 0x40, 0x0, 0x0, 0x0, 0x90, 0x0,
-    0x8a, 0x88, 0x83, 0x0, 0x18, 0x0, 0x8, 0x40,
-    0x0, 0xb0, 0x3, 0x60, 0x0, 0x84, 0x0, 0x7,
-    0x30, 0x73, 0x0, 0x8, 0x40, 0x0, 0xb1, 0x99,
-    0x0, 0x0, 0x8b, 0x99, 0xa5, 0x0,
-
-    /* U+045A "њ" */
-    0x73, 0x0, 0x0, 0xb0, 0x0, 0x0, 0x73, 0x0,
-    0x0, 0xb0, 0x0, 0x0, 0x73, 0x0, 0x0, 0xb0,
-    0x0, 0x0, 0x7a, 0x99, 0x99, 0xe9, 0x99, 0x80,
-    0x73, 0x0, 0x0, 0xb0, 0x0, 0x49, 0x73, 0x0,
-    0x0, 0xb0, 0x0, 0x29, 0x73, 0x0, 0x0, 0xd8,
-    0x88, 0x91,
-
-    /* U+045B "ћ" */
-    0x0, 0x73, 0x0, 0x0, 0x0, 0x37, 0xb9, 0x77,
-    0x60, 0x0, 0x0, 0x73, 0x0, 0x0, 0x0, 0x0,
-    0x74, 0x99, 0x9a, 0x10, 0x0, 0x7b, 0x0, 0x1,
-    0xb0, 0x0, 0x75, 0x0, 0x0, 0xb0, 0x0, 0x73,
-    0x0, 0x0, 0xa1, 0x0, 0x73, 0x0, 0x0, 0xa1,
-    0x0, 0x73, 0x0, 0x0, 0xa1, 0x0, 0x73, 0x0,
-    0x0, 0xa1,
-
-    /* U+045C "ќ" */
-    0x0, 0x1, 0x60, 0x0, 0x3, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x30, 0x0, 0x92, 0x73, 0x0,
-    0x83, 0x7, 0x30, 0x65, 0x0, 0x7a, 0x9c, 0x0,
-    0x7, 0x30, 0x58, 0x0, 0x73, 0x0, 0x76, 0x7,
-    0x30, 0x0, 0x84,
-
-    /* U+045D "ѝ" */
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x29, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x73, 0x0, 0x1, 0xe0,
-    0x73, 0x0, 0x1a, 0xb0, 0x73, 0x0, 0xa2, 0xa0,
-    0x73, 0x9, 0x30, 0xa0, 0x73, 0x75, 0x0, 0xa0,
-    0x79, 0x60, 0x0, 0xa0, 0x79, 0x0, 0x0, 0xa0,
-
-    /* U+045E "ў" */
-    0x0, 0x21, 0x0, 0x40, 0x0, 0x2, 0x60, 0x36,
-    0x0, 0x0, 0x5, 0x77, 0x0, 0x0, 0x92, 0x0,
-    0x0, 0x73, 0x2, 0x90, 0x0, 0xa, 0x0, 0x9,
-    0x10, 0x6, 0x50, 0x0, 0x38, 0x0, 0xa0, 0x0,
-    0x0, 0xa1, 0x46, 0x0, 0x0, 0x3, 0x7a, 0x0,
-    0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0x0, 0xa1,
-    0x0, 0x0, 0x0, 0x28, 0x0, 0x0, 0x1a, 0x99,
-    0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x73, 0x0, 0x5, 0x67, 0x30, 0x0, 0x56, 0x73,
-    0x0, 0x5, 0x67, 0x30, 0x0, 0x56, 0x73, 0x0,
-    0x5, 0x67, 0x30, 0x0, 0x56, 0x7a, 0x99, 0x9b,
-    0x60, 0x0, 0xa0, 0x0, 0x0, 0x5, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x50, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0xb3, 0xca, 0xaa, 0xa8, 0x37, 0x0,
-    0x0, 0x3, 0x70, 0x0, 0x0, 0x37, 0x0, 0x0,
-    0x3, 0x70, 0x0, 0x0, 0x37, 0x0, 0x0, 0x3,
-    0x70, 0x0, 0x0, 0x37, 0x0, 0x0, 0x3, 0x70,
-    0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x40, 0x0, 0x0, 0x91, 0x7a, 0x99,
-    0x90, 0x73, 0x0, 0x0, 0x73, 0x0, 0x0, 0x73,
-    0x0, 0x0, 0x73, 0x0, 0x0, 0x73, 0x0, 0x0,
-    0x73, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0x88, 0x88, 0x88, 0x80,
-
-    /* U+2014 "—" */
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-
-    /* U+2018 "‘" */
-    0x8, 0x9, 0x2d, 0x1,
-
-    /* U+2019 "’" */
-    0x1e, 0x9, 0x7, 0x0,
-
-    /* U+201A "‚" */
-    0x0, 0x1e, 0x9, 0x17,
-
-    /* U+201C "“" */
-    0x8, 0x7, 0x0, 0x90, 0x90, 0x2d, 0xf, 0x0,
-    0x10, 0x10,
-
-    /* U+201D "”" */
-    0x1e, 0xe, 0x10, 0x90, 0x90, 0x7, 0x8, 0x0,
-    0x0, 0x0,
-
-    /* U+2026 "…" */
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x3, 0xb0, 0x59,
-
-    /* U+20B4 "₴" */
-    0x1, 0x8a, 0x99, 0xa2, 0x0, 0x0, 0x10, 0x0,
-    0x1b, 0x0, 0x0, 0x0, 0x0, 0xa, 0x10, 0x37,
-    0x77, 0x77, 0x7a, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x39, 0x97, 0x77, 0x77, 0x70, 0xa, 0x10,
-    0x0, 0x0, 0x0, 0x8, 0x40, 0x0, 0x3, 0x20,
-    0x0, 0x89, 0x99, 0x96, 0x0,
-
-    /* U+2116 "№" */
-    0x1a, 0x0, 0x0, 0x0, 0x90, 0x7, 0x78, 0x21,
-    0xe8, 0x0, 0x0, 0xb, 0x6, 0x20, 0x9, 0x1a,
-    0x95, 0x0, 0x0, 0xb0, 0x80, 0x0, 0x81, 0xa0,
-    0xb2, 0x0, 0xb, 0x4, 0x60, 0x18, 0x1a, 0x1,
-    0xb0, 0x0, 0xb0, 0x3, 0x76, 0x1, 0xa0, 0x3,
-    0xa0, 0xb, 0x0, 0x22, 0x21, 0x1a, 0x0, 0x7,
-    0x70, 0xb0, 0x16, 0x66, 0x41, 0xa0, 0x0, 0xa,
-    0x4b, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0xb,
-    0xc0, 0x0, 0x0, 0x1, 0xa0, 0x0, 0x0, 0x2d,
-    0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 58, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 56, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9, .adv_w = 80, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 15, .adv_w = 155, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 60, .adv_w = 136, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 112, .adv_w = 183, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 162, .adv_w = 147, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 212, .adv_w = 43, .box_w = 1, .box_h = 4, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 214, .adv_w = 72, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 234, .adv_w = 72, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 254, .adv_w = 84, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 267, .adv_w = 127, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 288, .adv_w = 45, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 292, .adv_w = 85, .box_w = 5, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 295, .adv_w = 45, .box_w = 2, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 297, .adv_w = 72, .box_w = 6, .box_h = 13, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 336, .adv_w = 147, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 377, .adv_w = 79, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 395, .adv_w = 126, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 431, .adv_w = 125, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 467, .adv_w = 146, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 508, .adv_w = 125, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 544, .adv_w = 135, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 580, .adv_w = 130, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 616, .adv_w = 142, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 657, .adv_w = 135, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 693, .adv_w = 45, .box_w = 2, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 700, .adv_w = 45, .box_w = 2, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 709, .adv_w = 127, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 727, .adv_w = 127, .box_w = 6, .box_h = 4, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 739, .adv_w = 127, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 757, .adv_w = 126, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 789, .adv_w = 231, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 873, .adv_w = 158, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 918, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 959, .adv_w = 158, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1004, .adv_w = 185, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1049, .adv_w = 150, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1085, .adv_w = 141, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1121, .adv_w = 173, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1166, .adv_w = 182, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1207, .adv_w = 66, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1216, .adv_w = 110, .box_w = 7, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1248, .adv_w = 157, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1289, .adv_w = 131, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1325, .adv_w = 214, .box_w = 11, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1375, .adv_w = 182, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1416, .adv_w = 188, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1466, .adv_w = 160, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1507, .adv_w = 188, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1573, .adv_w = 161, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1614, .adv_w = 136, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1650, .adv_w = 126, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1686, .adv_w = 178, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1727, .adv_w = 154, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1772, .adv_w = 246, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1840, .adv_w = 144, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1881, .adv_w = 140, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1922, .adv_w = 145, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1963, .adv_w = 69, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1983, .adv_w = 72, .box_w = 6, .box_h = 13, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 2022, .adv_w = 69, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2042, .adv_w = 128, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 2060, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2064, .adv_w = 134, .box_w = 3, .box_h = 2, .ofs_x = 2, .ofs_y = 8},
-    {.bitmap_index = 2067, .adv_w = 131, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2092, .adv_w = 151, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2132, .adv_w = 124, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2160, .adv_w = 151, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2200, .adv_w = 134, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2228, .adv_w = 73, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2258, .adv_w = 153, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2303, .adv_w = 151, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2343, .adv_w = 58, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2353, .adv_w = 60, .box_w = 5, .box_h = 13, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 2386, .adv_w = 131, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2426, .adv_w = 58, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2436, .adv_w = 238, .box_w = 13, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2482, .adv_w = 151, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2510, .adv_w = 139, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2538, .adv_w = 151, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 2578, .adv_w = 151, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2618, .adv_w = 88, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2632, .adv_w = 107, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2657, .adv_w = 89, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2684, .adv_w = 150, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2709, .adv_w = 118, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2737, .adv_w = 193, .box_w = 12, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2779, .adv_w = 116, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2804, .adv_w = 118, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 2849, .adv_w = 113, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2874, .adv_w = 72, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2907, .adv_w = 65, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 2920, .adv_w = 72, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2946, .adv_w = 127, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 2954, .adv_w = 102, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 2969, .adv_w = 102, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 2984, .adv_w = 146, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3032, .adv_w = 146, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3076, .adv_w = 183, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3131, .adv_w = 127, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3173, .adv_w = 158, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3218, .adv_w = 139, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3254, .adv_w = 68, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3263, .adv_w = 66, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3285, .adv_w = 116, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3312, .adv_w = 266, .box_w = 16, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3384, .adv_w = 266, .box_w = 16, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3456, .adv_w = 185, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3506, .adv_w = 156, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3560, .adv_w = 185, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3614, .adv_w = 150, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3674, .adv_w = 180, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3724, .adv_w = 164, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3769, .adv_w = 162, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3810, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3851, .adv_w = 127, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3883, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3944, .adv_w = 146, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3980, .adv_w = 223, .box_w = 14, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4043, .adv_w = 137, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4079, .adv_w = 185, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4120, .adv_w = 185, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4174, .adv_w = 156, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4215, .adv_w = 175, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4260, .adv_w = 216, .box_w = 11, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4310, .adv_w = 184, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4351, .adv_w = 191, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4405, .adv_w = 185, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4446, .adv_w = 158, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4487, .adv_w = 160, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4532, .adv_w = 129, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4568, .adv_w = 150, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4613, .adv_w = 204, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4667, .adv_w = 142, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4708, .adv_w = 185, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4769, .adv_w = 160, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4810, .adv_w = 245, .box_w = 13, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4869, .adv_w = 250, .box_w = 15, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4952, .adv_w = 182, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5002, .adv_w = 216, .box_w = 11, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5052, .adv_w = 159, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5093, .adv_w = 158, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5134, .adv_w = 243, .box_w = 14, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5197, .adv_w = 164, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5233, .adv_w = 129, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5258, .adv_w = 147, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5302, .adv_w = 135, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5327, .adv_w = 104, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5348, .adv_w = 143, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5389, .adv_w = 136, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5417, .adv_w = 181, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5456, .adv_w = 118, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5481, .adv_w = 153, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5509, .adv_w = 153, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5549, .adv_w = 127, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5574, .adv_w = 140, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5602, .adv_w = 176, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5634, .adv_w = 150, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5659, .adv_w = 142, .box_w = 9, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5691, .adv_w = 151, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5716, .adv_w = 153, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 5756, .adv_w = 125, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5784, .adv_w = 102, .box_w = 8, .box_h = 7, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5812, .adv_w = 122, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 5857, .adv_w = 172, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5922, .adv_w = 115, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5947, .adv_w = 152, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 5983, .adv_w = 132, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6008, .adv_w = 206, .box_w = 11, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6047, .adv_w = 206, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 6101, .adv_w = 136, .box_w = 9, .box_h = 7, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6133, .adv_w = 172, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6165, .adv_w = 124, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6190, .adv_w = 127, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6218, .adv_w = 192, .box_w = 11, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6257, .adv_w = 135, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6282, .adv_w = 139, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6322, .adv_w = 136, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6358, .adv_w = 149, .box_w = 10, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 6423, .adv_w = 104, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6453, .adv_w = 127, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6481, .adv_w = 116, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6506, .adv_w = 59, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6516, .adv_w = 58, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6534, .adv_w = 60, .box_w = 5, .box_h = 12, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 6564, .adv_w = 204, .box_w = 13, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6610, .adv_w = 210, .box_w = 12, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6652, .adv_w = 149, .box_w = 10, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6702, .adv_w = 127, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6737, .adv_w = 153, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6777, .adv_w = 122, .box_w = 9, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 6836, .adv_w = 142, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 6868, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6910, .adv_w = 97, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6937, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 6941, .adv_w = 224, .box_w = 14, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 6948, .adv_w = 45, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 6952, .adv_w = 45, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 6956, .adv_w = 45, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6960, .adv_w = 79, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 6970, .adv_w = 79, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 6980, .adv_w = 136, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6988, .adv_w = 185, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7033, .adv_w = 268, .box_w = 15, .box_h = 10, .ofs_x = 1, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_14;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_14 = {
-#else
-lv_font_t montserrat_cyrillic_14 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 15,          /*The maximum line height required by the font*/
-    .base_line = 3,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -1,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_14,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_14*/
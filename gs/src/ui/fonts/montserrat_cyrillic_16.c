@@ -1,2138 +0,0 @@
-/*******************************************************************************
- * Size: 16 px
- * Bpp: 4
- * Opts: --bpp 4 --size 16 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_16.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_16
-#define MONTSERRAT_CYRILLIC_16 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_16
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x77, 0x67, 0x66, 0x66, 0x56, 0x55, 0x55, 0x45,
-    0x22, 0x0, 0x22, 0x89,
-
-    /* U+0022 "\"" */
-    0xb0, 0x38, 0xb0, 0x37, 0xa0, 0x27, 0xa0, 0x27,
-    0x30, 0x12,
-
-    /* U+0023 "#" */
-    0x0, 0x3, 0x60, 0x1, 0x80, 0x0, 0x0, 0x54,
-    0x0, 0x37, 0x0, 0x0, 0x7, 0x20, 0x5, 0x50,
-    0x0, 0xaa, 0xeb, 0xaa, 0xdb, 0xa5, 0x0, 0xa,
-    0x0, 0x8, 0x10, 0x0, 0x0, 0xa0, 0x0, 0xa0,
-    0x0, 0x0, 0xa, 0x0, 0xa, 0x0, 0x0, 0x0,
-    0x90, 0x0, 0xa0, 0x0, 0x5a, 0xbd, 0xaa, 0xae,
-    0xaa, 0x0, 0x4, 0x50, 0x1, 0x80, 0x0, 0x0,
-    0x64, 0x0, 0x36, 0x0, 0x0, 0x8, 0x20, 0x5,
-    0x40, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x63, 0x0, 0x0, 0x0, 0x6, 0x30,
-    0x0, 0x0, 0x5c, 0xdd, 0xc7, 0x0, 0x6a, 0x16,
-    0x30, 0x53, 0xc, 0x0, 0x63, 0x0, 0x0, 0xd0,
-    0x6, 0x30, 0x0, 0x8, 0x80, 0x63, 0x0, 0x0,
-    0x8, 0xdb, 0x60, 0x0, 0x0, 0x0, 0x8a, 0xd8,
-    0x0, 0x0, 0x6, 0x30, 0x89, 0x0, 0x0, 0x63,
-    0x0, 0xd0, 0x0, 0x6, 0x30, 0xc, 0xc, 0x50,
-    0x63, 0xa, 0x60, 0x18, 0xcd, 0xdc, 0x60, 0x0,
-    0x0, 0x63, 0x0, 0x0, 0x0, 0x6, 0x30, 0x0,
-
-    /* U+0025 "%" */
-    0x3, 0x98, 0x70, 0x0, 0x4, 0x60, 0x0, 0xa0,
-    0x5, 0x40, 0x0, 0xa0, 0x0, 0x36, 0x0, 0x9,
-    0x0, 0x82, 0x0, 0x4, 0x50, 0x0, 0x90, 0x37,
-    0x0, 0x0, 0x27, 0x0, 0x18, 0xa, 0x0, 0x0,
-    0x0, 0xa1, 0x8, 0x37, 0x34, 0x99, 0x20, 0x1,
-    0x99, 0x52, 0x82, 0x90, 0xa, 0x0, 0x0, 0x0,
-    0xa0, 0x72, 0x0, 0x63, 0x0, 0x0, 0x64, 0x9,
-    0x0, 0x4, 0x50, 0x0, 0x19, 0x0, 0x81, 0x0,
-    0x54, 0x0, 0x9, 0x10, 0x3, 0x60, 0x9, 0x0,
-    0x4, 0x60, 0x0, 0x6, 0x89, 0x40,
-
-    /* U+0026 "&" */
-    0x0, 0xa, 0xaa, 0x80, 0x0, 0x0, 0x8, 0x40,
-    0x8, 0x40, 0x0, 0x0, 0xb0, 0x0, 0x55, 0x0,
-    0x0, 0x8, 0x50, 0xb, 0x10, 0x0, 0x0, 0x1c,
-    0x4b, 0x30, 0x0, 0x0, 0x0, 0xae, 0x20, 0x0,
-    0x0, 0x1, 0xb4, 0x4b, 0x0, 0x1, 0x0, 0xb2,
-    0x0, 0x59, 0x3, 0x70, 0x1a, 0x0, 0x0, 0x78,
-    0x92, 0x1, 0xb0, 0x0, 0x0, 0x9c, 0x0, 0xb,
-    0x50, 0x0, 0x3c, 0xb4, 0x0, 0x8, 0xbb, 0xb9,
-    0x10, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0xbb, 0xaa, 0x30,
-
-    /* U+0028 "(" */
-    0x0, 0xa2, 0x1, 0xa0, 0x7, 0x50, 0xb, 0x10,
-    0xc, 0x0, 0xb, 0x0, 0x2a, 0x0, 0x39, 0x0,
-    0x39, 0x0, 0x2a, 0x0, 0xb, 0x0, 0xc, 0x0,
-    0xb, 0x10, 0x7, 0x50, 0x1, 0xa0, 0x0, 0xa2,
-
-    /* U+0029 ")" */
-    0xb, 0x0, 0x8, 0x30, 0x3, 0x90, 0x0, 0xc0,
-    0x0, 0xb1, 0x0, 0x93, 0x0, 0x74, 0x0, 0x75,
-    0x0, 0x75, 0x0, 0x74, 0x0, 0x93, 0x0, 0xb1,
-    0x0, 0xc0, 0x3, 0x90, 0x8, 0x30, 0xb, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x44, 0x0, 0x54, 0x44, 0x45, 0x7, 0xbb,
-    0x70, 0x6, 0xcc, 0x60, 0x54, 0x44, 0x45, 0x0,
-    0x44, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x1, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0xb, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x9b, 0xbf,
-    0xbb, 0xb0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0x90, 0x0,
-
-    /* U+002C "," */
-    0x5, 0x0, 0xe3, 0xa, 0x0, 0xa0, 0x4, 0x0,
-
-    /* U+002D "-" */
-    0xc, 0xcc, 0xc1,
-
-    /* U+002E "." */
-    0x5, 0x0, 0xe2,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x4, 0x70, 0x0, 0x0, 0x92, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x4, 0x70, 0x0, 0x0,
-    0x92, 0x0, 0x0, 0xb, 0x0, 0x0, 0x3, 0x80,
-    0x0, 0x0, 0x92, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x3, 0x80, 0x0, 0x0, 0x92, 0x0, 0x0, 0xb,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x83, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x9, 0xcc, 0xc4, 0x0, 0x0, 0xb5, 0x0,
-    0x1b, 0x50, 0x6, 0x70, 0x0, 0x0, 0xc0, 0xc,
-    0x10, 0x0, 0x0, 0x85, 0xc, 0x0, 0x0, 0x0,
-    0x48, 0x1b, 0x0, 0x0, 0x0, 0x39, 0x1b, 0x0,
-    0x0, 0x0, 0x39, 0xc, 0x0, 0x0, 0x0, 0x48,
-    0xc, 0x10, 0x0, 0x0, 0x85, 0x6, 0x70, 0x0,
-    0x0, 0xc0, 0x0, 0xb5, 0x0, 0x1b, 0x50, 0x0,
-    0x9, 0xcc, 0xc4, 0x0,
-
-    /* U+0031 "1" */
-    0xac, 0xdb, 0x0, 0x2b, 0x0, 0x2b, 0x0, 0x2b,
-    0x0, 0x2b, 0x0, 0x2b, 0x0, 0x2b, 0x0, 0x2b,
-    0x0, 0x2b, 0x0, 0x2b, 0x0, 0x2b, 0x0, 0x2b,
-
-    /* U+0032 "2" */
-    0x5, 0xbc, 0xcc, 0x60, 0x6, 0xa1, 0x0, 0x1b,
-    0x50, 0x0, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x0,
-    0x1, 0xc0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0,
-    0x0, 0xc, 0x10, 0x0, 0x0, 0xb, 0x40, 0x0,
-    0x0, 0xa, 0x50, 0x0, 0x0, 0x9, 0x60, 0x0,
-    0x0, 0x8, 0x70, 0x0, 0x0, 0x8, 0x80, 0x0,
-    0x0, 0x4, 0xfc, 0xcc, 0xcc, 0xc4,
-
-    /* U+0033 "3" */
-    0x4c, 0xcc, 0xcc, 0xe9, 0x0, 0x0, 0x0, 0x1c,
-    0x10, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x6,
-    0x80, 0x0, 0x0, 0x3, 0xb0, 0x0, 0x0, 0x0,
-    0x9c, 0xb4, 0x0, 0x0, 0x0, 0x1, 0xa6, 0x0,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xc,
-    0x11, 0x0, 0x0, 0x0, 0xd0, 0x88, 0x10, 0x0,
-    0x98, 0x0, 0x6c, 0xcc, 0xc7, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x0,
-    0x59, 0x0, 0x0, 0x0, 0x0, 0x2c, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x20, 0x0, 0x0, 0x0, 0x8,
-    0x50, 0x0, 0x0, 0x0, 0x4, 0xa0, 0x0, 0xb0,
-    0x0, 0x1, 0xc0, 0x0, 0xc, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0xc0, 0x0, 0x4d, 0xcc, 0xcc, 0xcf,
-    0xcc, 0x20, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0,
-
-    /* U+0035 "5" */
-    0x4, 0xec, 0xcc, 0xc8, 0x0, 0x66, 0x0, 0x0,
-    0x0, 0x7, 0x40, 0x0, 0x0, 0x0, 0x92, 0x0,
-    0x0, 0x0, 0xb, 0x10, 0x0, 0x0, 0x0, 0xbc,
-    0xcc, 0xb6, 0x0, 0x0, 0x0, 0x2, 0x99, 0x0,
-    0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x9,
-    0x40, 0x0, 0x0, 0x0, 0xb2, 0x5a, 0x20, 0x0,
-    0x6a, 0x0, 0x4b, 0xcc, 0xd8, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x7, 0xcc, 0xcc, 0x20, 0x0, 0xa7, 0x0,
-    0x1, 0x0, 0x6, 0x80, 0x0, 0x0, 0x0, 0xc,
-    0x10, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0x7, 0xbc, 0xb5, 0x0, 0x1b, 0x95,
-    0x0, 0x1a, 0x60, 0xf, 0x60, 0x0, 0x0, 0xd0,
-    0xd, 0x20, 0x0, 0x0, 0xb1, 0x7, 0x50, 0x0,
-    0x0, 0xd0, 0x0, 0xb3, 0x0, 0x9, 0x80, 0x0,
-    0x19, 0xcc, 0xc7, 0x0,
-
-    /* U+0037 "7" */
-    0x7d, 0xcc, 0xcc, 0xce, 0x87, 0x50, 0x0, 0x0,
-    0xa3, 0x75, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0,
-    0x8, 0x50, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0x0, 0x58, 0x0, 0x0, 0x0, 0xc, 0x10, 0x0,
-    0x0, 0x3, 0xa0, 0x0, 0x0, 0x0, 0xa3, 0x0,
-    0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x8, 0x60,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x5c, 0xcc, 0xc6, 0x0, 0x5, 0xa0, 0x0,
-    0x9, 0x70, 0xb, 0x10, 0x0, 0x0, 0xc0, 0xb,
-    0x10, 0x0, 0x0, 0xc0, 0x4, 0xb1, 0x0, 0xa,
-    0x60, 0x0, 0x8f, 0xcc, 0xf9, 0x0, 0x7, 0x91,
-    0x0, 0x8, 0x90, 0xc, 0x0, 0x0, 0x0, 0xb2,
-    0x2a, 0x0, 0x0, 0x0, 0x84, 0x1c, 0x0, 0x0,
-    0x0, 0xb2, 0x9, 0x80, 0x0, 0x7, 0xa0, 0x0,
-    0x6c, 0xcc, 0xc7, 0x0,
-
-    /* U+0039 "9" */
-    0x1, 0xac, 0xcb, 0x60, 0x0, 0xc4, 0x0, 0x7,
-    0x80, 0x58, 0x0, 0x0, 0xb, 0x27, 0x50, 0x0,
-    0x0, 0x87, 0x49, 0x0, 0x0, 0xb, 0xa0, 0xc6,
-    0x0, 0x19, 0x6b, 0x0, 0x8c, 0xca, 0x31, 0xb0,
-    0x0, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x6,
-    0x60, 0x0, 0x0, 0x0, 0xc1, 0x1, 0x0, 0x2,
-    0xc5, 0x0, 0x6c, 0xcc, 0xb3, 0x0,
-
-    /* U+003A ":" */
-    0xe, 0x20, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x50, 0xe, 0x20,
-
-    /* U+003B ";" */
-    0xe, 0x20, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x50, 0xe, 0x30, 0xa0, 0xa,
-    0x0, 0x40,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x20, 0x0, 0x4, 0xb9, 0x0,
-    0x6b, 0x71, 0x7, 0xb5, 0x0, 0x0, 0x8b, 0x40,
-    0x0, 0x0, 0x7, 0xb7, 0x10, 0x0, 0x0, 0x5b,
-    0x90, 0x0, 0x0, 0x2,
-
-    /* U+003D "=" */
-    0x9b, 0xbb, 0xbb, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9b, 0xbb,
-    0xbb, 0xb0,
-
-    /* U+003E ">" */
-    0x20, 0x0, 0x0, 0x8, 0xb5, 0x0, 0x0, 0x0,
-    0x7b, 0x71, 0x0, 0x0, 0x4, 0xa9, 0x0, 0x0,
-    0x4a, 0x90, 0x6, 0xb7, 0x10, 0x7b, 0x50, 0x0,
-    0x2, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x6, 0xcc, 0xcc, 0x50, 0x78, 0x0, 0x1, 0xc5,
-    0x0, 0x0, 0x0, 0x3a, 0x0, 0x0, 0x0, 0x3a,
-    0x0, 0x0, 0x0, 0x94, 0x0, 0x0, 0x8, 0x80,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0x1, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x40, 0x0, 0x0, 0x4, 0xd0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x18, 0xaa, 0xaa, 0xa5, 0x0, 0x0,
-    0x0, 0x6, 0xa2, 0x0, 0x0, 0x5, 0xa1, 0x0,
-    0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x1b, 0x10,
-    0x2, 0xa0, 0x1, 0x9a, 0xaa, 0x28, 0x32, 0x90,
-    0x9, 0x20, 0xb, 0x20, 0x0, 0x9a, 0x30, 0x82,
-    0xa, 0x0, 0x74, 0x0, 0x0, 0xe, 0x30, 0x36,
-    0x9, 0x0, 0xb0, 0x0, 0x0, 0x9, 0x30, 0x9,
-    0x18, 0x0, 0xc0, 0x0, 0x0, 0x8, 0x30, 0x9,
-    0x9, 0x0, 0xc0, 0x0, 0x0, 0x9, 0x30, 0x9,
-    0xa, 0x0, 0x75, 0x0, 0x0, 0xe, 0x30, 0x27,
-    0x9, 0x20, 0xc, 0x30, 0x0, 0x99, 0x50, 0x82,
-    0x2, 0xa0, 0x1, 0xab, 0xba, 0x21, 0xcb, 0x60,
-    0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xa2, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xaa, 0xaa, 0x92, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x69, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0xb2,
-    0x0, 0x0, 0x0, 0x4, 0x90, 0x48, 0x0, 0x0,
-    0x0, 0xb, 0x20, 0xc, 0x0, 0x0, 0x0, 0x2b,
-    0x0, 0x7, 0x60, 0x0, 0x0, 0x84, 0x0, 0x1,
-    0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x94, 0x0,
-    0x6, 0xdb, 0xbb, 0xbb, 0xcb, 0x0, 0xc, 0x0,
-    0x0, 0x0, 0xb, 0x20, 0x49, 0x0, 0x0, 0x0,
-    0x5, 0x80, 0xb2, 0x0, 0x0, 0x0, 0x0, 0xd0,
-
-    /* U+0042 "B" */
-    0xf, 0xcc, 0xcc, 0xcb, 0x30, 0x0, 0xc0, 0x0,
-    0x0, 0x2d, 0x20, 0xc, 0x0, 0x0, 0x0, 0x67,
-    0x0, 0xc0, 0x0, 0x0, 0x7, 0x60, 0xc, 0x0,
-    0x0, 0x4, 0xc1, 0x0, 0xfc, 0xcc, 0xcd, 0xf5,
-    0x0, 0xc, 0x0, 0x0, 0x1, 0xa6, 0x0, 0xc0,
-    0x0, 0x0, 0x0, 0xd0, 0xc, 0x0, 0x0, 0x0,
-    0xc, 0x10, 0xc0, 0x0, 0x0, 0x0, 0xd0, 0xc,
-    0x0, 0x0, 0x0, 0x88, 0x0, 0xfc, 0xcc, 0xcc,
-    0xc7, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x1, 0x9c, 0xcc, 0xb4, 0x0, 0x4, 0xd4,
-    0x0, 0x2, 0xa6, 0x2, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0xa4, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0x40, 0x0, 0x2a, 0x60, 0x0, 0x29, 0xcc,
-    0xcb, 0x40,
-
-    /* U+0044 "D" */
-    0xf, 0xcc, 0xcc, 0xca, 0x30, 0x0, 0xc, 0x0,
-    0x0, 0x3, 0xb7, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0xa, 0x50, 0xc, 0x0, 0x0, 0x0, 0x1, 0xd0,
-    0xc, 0x0, 0x0, 0x0, 0x0, 0xa2, 0xc, 0x0,
-    0x0, 0x0, 0x0, 0x85, 0xc, 0x0, 0x0, 0x0,
-    0x0, 0x85, 0xc, 0x0, 0x0, 0x0, 0x0, 0xa2,
-    0xc, 0x0, 0x0, 0x0, 0x1, 0xd0, 0xc, 0x0,
-    0x0, 0x0, 0xa, 0x50, 0xc, 0x0, 0x0, 0x3,
-    0xb7, 0x0, 0xf, 0xcc, 0xcc, 0xca, 0x30, 0x0,
-
-    /* U+0045 "E" */
-    0xf, 0xcc, 0xcc, 0xcc, 0x50, 0xc0, 0x0, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xcc, 0xcc, 0x90, 0xc, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0xcc, 0xcc, 0xc8,
-
-    /* U+0046 "F" */
-    0xf, 0xcc, 0xcc, 0xcc, 0x50, 0xc0, 0x0, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xcc, 0xcc, 0xc9, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x1, 0x9d, 0xcc, 0xb5, 0x0, 0x4, 0xd5,
-    0x0, 0x1, 0x98, 0x2, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0xa4, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0xb0, 0xd0,
-    0x0, 0x0, 0x0, 0xb, 0xa, 0x40, 0x0, 0x0,
-    0x0, 0xb0, 0x2d, 0x10, 0x0, 0x0, 0xb, 0x0,
-    0x4d, 0x50, 0x0, 0x19, 0x90, 0x0, 0x19, 0xdc,
-    0xcb, 0x50,
-
-    /* U+0048 "H" */
-    0xc, 0x0, 0x0, 0x0, 0xc, 0x10, 0xc0, 0x0,
-    0x0, 0x0, 0xc1, 0xc, 0x0, 0x0, 0x0, 0xc,
-    0x10, 0xc0, 0x0, 0x0, 0x0, 0xc1, 0xc, 0x0,
-    0x0, 0x0, 0xc, 0x10, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xf1, 0xc, 0x0, 0x0, 0x0, 0xc, 0x10, 0xc0,
-    0x0, 0x0, 0x0, 0xc1, 0xc, 0x0, 0x0, 0x0,
-    0xc, 0x10, 0xc0, 0x0, 0x0, 0x0, 0xc1, 0xc,
-    0x0, 0x0, 0x0, 0xc, 0x10, 0xc0, 0x0, 0x0,
-    0x0, 0xc1,
-
-    /* U+0049 "I" */
-    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
-    0xc, 0xc, 0xc, 0xc,
-
-    /* U+004A "J" */
-    0x0, 0xbc, 0xcc, 0xf0, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0xd0,
-    0x10, 0x0, 0xd, 0xb, 0x30, 0x6, 0x90, 0x1a,
-    0xcc, 0xa0,
-
-    /* U+004B "K" */
-    0xc, 0x0, 0x0, 0x0, 0xa5, 0x0, 0xc0, 0x0,
-    0x0, 0x96, 0x0, 0xc, 0x0, 0x0, 0x88, 0x0,
-    0x0, 0xc0, 0x0, 0x69, 0x0, 0x0, 0xc, 0x0,
-    0x5a, 0x0, 0x0, 0x0, 0xc0, 0x4f, 0x10, 0x0,
-    0x0, 0xc, 0x3c, 0x7a, 0x0, 0x0, 0x0, 0xdc,
-    0x10, 0x97, 0x0, 0x0, 0xf, 0x20, 0x0, 0xb4,
-    0x0, 0x0, 0xc0, 0x0, 0x1, 0xc2, 0x0, 0xc,
-    0x0, 0x0, 0x2, 0xc0, 0x0, 0xc0, 0x0, 0x0,
-    0x5, 0xa0,
-
-    /* U+004C "L" */
-    0xc, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0,
-    0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0x0, 0xc0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0xcc, 0xcc, 0xc2,
-
-    /* U+004D "M" */
-    0xe, 0x0, 0x0, 0x0, 0x0, 0x9, 0x50, 0xf7,
-    0x0, 0x0, 0x0, 0x2, 0xf5, 0xc, 0xc1, 0x0,
-    0x0, 0x0, 0xa9, 0x50, 0xc4, 0x80, 0x0, 0x0,
-    0x39, 0x75, 0xc, 0xb, 0x10, 0x0, 0xb, 0x17,
-    0x50, 0xc0, 0x39, 0x0, 0x4, 0x70, 0x75, 0xc,
-    0x0, 0xa2, 0x0, 0xb0, 0x7, 0x50, 0xc0, 0x2,
-    0xa0, 0x66, 0x0, 0x75, 0xc, 0x0, 0x9, 0x4b,
-    0x0, 0x7, 0x50, 0xc0, 0x0, 0x1e, 0x50, 0x0,
-    0x75, 0xc, 0x0, 0x0, 0x40, 0x0, 0x7, 0x50,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x75,
-
-    /* U+004E "N" */
-    0xe, 0x10, 0x0, 0x0, 0xc, 0x10, 0xfb, 0x0,
-    0x0, 0x0, 0xc1, 0xc, 0x87, 0x0, 0x0, 0xc,
-    0x10, 0xc0, 0xc3, 0x0, 0x0, 0xc1, 0xc, 0x2,
-    0xd0, 0x0, 0xc, 0x10, 0xc0, 0x5, 0xa0, 0x0,
-    0xc1, 0xc, 0x0, 0x9, 0x60, 0xc, 0x10, 0xc0,
-    0x0, 0xc, 0x20, 0xc1, 0xc, 0x0, 0x0, 0x3c,
-    0xc, 0x10, 0xc0, 0x0, 0x0, 0x69, 0xc1, 0xc,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0xc0, 0x0, 0x0,
-    0x1, 0xe1,
-
-    /* U+004F "O" */
-    0x0, 0x1, 0x9c, 0xcc, 0xb4, 0x0, 0x0, 0x4,
-    0xc4, 0x0, 0x2, 0xa9, 0x0, 0x2, 0xd1, 0x0,
-    0x0, 0x0, 0x87, 0x0, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0xd1, 0xd, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0x51, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x1b,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x80, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x85, 0xa, 0x40, 0x0, 0x0,
-    0x0, 0xd, 0x10, 0x2d, 0x10, 0x0, 0x0, 0x8,
-    0x70, 0x0, 0x4c, 0x40, 0x0, 0x2a, 0x90, 0x0,
-    0x0, 0x19, 0xcc, 0xcb, 0x40, 0x0,
-
-    /* U+0050 "P" */
-    0xf, 0xcc, 0xcc, 0xc7, 0x0, 0xc, 0x0, 0x0,
-    0x7, 0xa0, 0xc, 0x0, 0x0, 0x0, 0xa3, 0xc,
-    0x0, 0x0, 0x0, 0x67, 0xc, 0x0, 0x0, 0x0,
-    0x67, 0xc, 0x0, 0x0, 0x0, 0xb3, 0xc, 0x0,
-    0x0, 0x19, 0x90, 0xf, 0xcc, 0xcc, 0xb5, 0x0,
-    0xc, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x1, 0x9c, 0xcc, 0xb4, 0x0, 0x0, 0x0,
-    0x4c, 0x40, 0x0, 0x2a, 0x90, 0x0, 0x2, 0xd1,
-    0x0, 0x0, 0x0, 0x87, 0x0, 0xa, 0x40, 0x0,
-    0x0, 0x0, 0xd, 0x10, 0xd, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0x50, 0x1b, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x80, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x80, 0xd, 0x0, 0x0, 0x0, 0x0, 0x8, 0x50,
-    0xa, 0x40, 0x0, 0x0, 0x0, 0xd, 0x10, 0x2,
-    0xd1, 0x0, 0x0, 0x0, 0x87, 0x0, 0x0, 0x4c,
-    0x40, 0x0, 0x2a, 0x90, 0x0, 0x0, 0x1, 0x9c,
-    0xcd, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0x80, 0x1, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xca, 0x30,
-
-    /* U+0052 "R" */
-    0xf, 0xcc, 0xcc, 0xc7, 0x0, 0xc, 0x0, 0x0,
-    0x7, 0xb0, 0xc, 0x0, 0x0, 0x0, 0xa3, 0xc,
-    0x0, 0x0, 0x0, 0x67, 0xc, 0x0, 0x0, 0x0,
-    0x67, 0xc, 0x0, 0x0, 0x0, 0xb3, 0xc, 0x0,
-    0x0, 0x19, 0x80, 0xf, 0xcc, 0xcc, 0xf5, 0x0,
-    0xc, 0x0, 0x0, 0x86, 0x0, 0xc, 0x0, 0x0,
-    0xc, 0x10, 0xc, 0x0, 0x0, 0x3, 0xa0, 0xc,
-    0x0, 0x0, 0x0, 0x95,
-
-    /* U+0053 "S" */
-    0x0, 0x5c, 0xcc, 0xc7, 0x0, 0x6a, 0x10, 0x0,
-    0x53, 0xc, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0x0, 0x8, 0x80, 0x0, 0x0, 0x0, 0x8,
-    0xd8, 0x40, 0x0, 0x0, 0x0, 0x48, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x89, 0x0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xc, 0xc, 0x50, 0x0,
-    0xa, 0x60, 0x18, 0xcc, 0xcc, 0x60,
-
-    /* U+0054 "T" */
-    0xbc, 0xcc, 0xfc, 0xcc, 0xb0, 0x0, 0xd, 0x0,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x2a, 0x0, 0x0, 0x0, 0xd, 0x2a, 0x0, 0x0,
-    0x0, 0xd, 0x2a, 0x0, 0x0, 0x0, 0xd, 0x2a,
-    0x0, 0x0, 0x0, 0xd, 0x2a, 0x0, 0x0, 0x0,
-    0xd, 0x2a, 0x0, 0x0, 0x0, 0xd, 0x2a, 0x0,
-    0x0, 0x0, 0xd, 0x1b, 0x0, 0x0, 0x0, 0xc,
-    0xd, 0x0, 0x0, 0x0, 0x2a, 0xb, 0x30, 0x0,
-    0x0, 0x85, 0x2, 0xd3, 0x0, 0x6, 0xc0, 0x0,
-    0x2a, 0xdc, 0xd8, 0x0,
-
-    /* U+0056 "V" */
-    0xb3, 0x0, 0x0, 0x0, 0x2, 0xa4, 0x90, 0x0,
-    0x0, 0x0, 0x94, 0xd, 0x10, 0x0, 0x0, 0xc,
-    0x0, 0x77, 0x0, 0x0, 0x6, 0x70, 0x1, 0xd0,
-    0x0, 0x0, 0xc1, 0x0, 0x9, 0x40, 0x0, 0x39,
-    0x0, 0x0, 0x3b, 0x0, 0xa, 0x30, 0x0, 0x0,
-    0xc1, 0x1, 0xc0, 0x0, 0x0, 0x5, 0x80, 0x75,
-    0x0, 0x0, 0x0, 0xd, 0xd, 0x0, 0x0, 0x0,
-    0x0, 0x8b, 0x80, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x3a, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x0,
-    0xb0, 0xd0, 0x0, 0x0, 0x1c, 0xa0, 0x0, 0x0,
-    0x57, 0x9, 0x40, 0x0, 0x6, 0x6c, 0x0, 0x0,
-    0xa, 0x20, 0x39, 0x0, 0x0, 0xb1, 0x75, 0x0,
-    0x0, 0xc0, 0x0, 0xd0, 0x0, 0x1b, 0x2, 0xa0,
-    0x0, 0x48, 0x0, 0x9, 0x30, 0x5, 0x60, 0xc,
-    0x0, 0x9, 0x30, 0x0, 0x48, 0x0, 0xb1, 0x0,
-    0x84, 0x0, 0xc0, 0x0, 0x0, 0xd0, 0xb, 0x0,
-    0x2, 0x90, 0x48, 0x0, 0x0, 0xa, 0x25, 0x70,
-    0x0, 0xc, 0x9, 0x30, 0x0, 0x0, 0x58, 0xa1,
-    0x0, 0x0, 0x84, 0xd0, 0x0, 0x0, 0x0, 0xdc,
-    0x0, 0x0, 0x3, 0xc9, 0x0, 0x0, 0x0, 0xb,
-    0x70, 0x0, 0x0, 0xe, 0x40, 0x0,
-
-    /* U+0058 "X" */
-    0x1c, 0x0, 0x0, 0x0, 0xa4, 0x5, 0x90, 0x0,
-    0x5, 0x90, 0x0, 0xa4, 0x0, 0x1c, 0x0, 0x0,
-    0x1c, 0x10, 0xa3, 0x0, 0x0, 0x4, 0xb6, 0x80,
-    0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x20, 0x0, 0x0, 0x8, 0x63, 0xc0, 0x0,
-    0x0, 0x4b, 0x0, 0x78, 0x0, 0x1, 0xc1, 0x0,
-    0xb, 0x30, 0xa, 0x50, 0x0, 0x2, 0xc0, 0x5a,
-    0x0, 0x0, 0x0, 0x69,
-
-    /* U+0059 "Y" */
-    0xa4, 0x0, 0x0, 0x0, 0x3a, 0x1c, 0x0, 0x0,
-    0x0, 0xb1, 0x7, 0x60, 0x0, 0x5, 0x70, 0x0,
-    0xc0, 0x0, 0xc, 0x0, 0x0, 0x58, 0x0, 0x85,
-    0x0, 0x0, 0xb, 0x21, 0xb0, 0x0, 0x0, 0x3,
-    0xba, 0x30, 0x0, 0x0, 0x0, 0xaa, 0x0, 0x0,
-    0x0, 0x0, 0x66, 0x0, 0x0, 0x0, 0x0, 0x66,
-    0x0, 0x0, 0x0, 0x0, 0x66, 0x0, 0x0, 0x0,
-    0x0, 0x66, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x1c, 0xcc, 0xcc, 0xcc, 0xe8, 0x0, 0x0, 0x0,
-    0x1, 0xc1, 0x0, 0x0, 0x0, 0xb, 0x30, 0x0,
-    0x0, 0x0, 0x87, 0x0, 0x0, 0x0, 0x3, 0xb0,
-    0x0, 0x0, 0x0, 0x1d, 0x10, 0x0, 0x0, 0x0,
-    0xa5, 0x0, 0x0, 0x0, 0x6, 0x90, 0x0, 0x0,
-    0x0, 0x2c, 0x0, 0x0, 0x0, 0x0, 0xc2, 0x0,
-    0x0, 0x0, 0x9, 0x60, 0x0, 0x0, 0x0, 0x3f,
-    0xcc, 0xcc, 0xcc, 0xc9,
-
-    /* U+005B "[" */
-    0xe, 0xb6, 0xc, 0x0, 0xc, 0x0, 0xc, 0x0,
-    0xc, 0x0, 0xc, 0x0, 0xc, 0x0, 0xc, 0x0,
-    0xc, 0x0, 0xc, 0x0, 0xc, 0x0, 0xc, 0x0,
-    0xc, 0x0, 0xc, 0x0, 0xc, 0x0, 0xe, 0xb6,
-
-    /* U+005C "\\" */
-    0x55, 0x0, 0x0, 0x1, 0xa0, 0x0, 0x0, 0xa,
-    0x0, 0x0, 0x0, 0x65, 0x0, 0x0, 0x1, 0xa0,
-    0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x65, 0x0,
-    0x0, 0x1, 0xa0, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x0, 0x65, 0x0, 0x0, 0x1, 0xa0, 0x0, 0x0,
-    0xb, 0x0, 0x0, 0x0, 0x65, 0x0, 0x0, 0x1,
-    0xa0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x65,
-
-    /* U+005D "]" */
-    0x7b, 0xe0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0,
-    0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0,
-    0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc7, 0xbe,
-
-    /* U+005E "^" */
-    0x0, 0xf, 0x20, 0x0, 0x6, 0x88, 0x0, 0x0,
-    0xb0, 0xb0, 0x0, 0x28, 0x6, 0x40, 0x9, 0x20,
-    0xa, 0x0, 0xa0, 0x0, 0x91, 0x55, 0x0, 0x3,
-    0x80,
-
-    /* U+005F "_" */
-    0x99, 0x99, 0x99, 0x99,
-
-    /* U+0060 "`" */
-    0x2b, 0x20, 0x1, 0xa3,
-
-    /* U+0061 "a" */
-    0x1, 0x9c, 0xcc, 0x70, 0x8, 0x40, 0x0, 0xa5,
-    0x0, 0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x1b,
-    0x1, 0x9a, 0xaa, 0xbb, 0xc, 0x30, 0x0, 0x1b,
-    0xc, 0x0, 0x0, 0x2b, 0xc, 0x10, 0x0, 0x9b,
-    0x2, 0xba, 0x99, 0x2b,
-
-    /* U+0062 "b" */
-    0x48, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0x3b, 0xcc, 0xa2,
-    0x0, 0x4a, 0xa1, 0x0, 0x3d, 0x10, 0x4e, 0x0,
-    0x0, 0x4, 0x90, 0x49, 0x0, 0x0, 0x0, 0xd0,
-    0x48, 0x0, 0x0, 0x0, 0xc0, 0x49, 0x0, 0x0,
-    0x0, 0xd0, 0x4e, 0x0, 0x0, 0x4, 0x90, 0x49,
-    0xa1, 0x0, 0x3d, 0x10, 0x47, 0x3b, 0xcc, 0xa2,
-    0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x3b, 0xcc, 0xb2, 0x0, 0x3c, 0x20, 0x2,
-    0xc0, 0xc, 0x10, 0x0, 0x0, 0x1, 0xb0, 0x0,
-    0x0, 0x0, 0x39, 0x0, 0x0, 0x0, 0x1, 0xb0,
-    0x0, 0x0, 0x0, 0xc, 0x10, 0x0, 0x0, 0x0,
-    0x3c, 0x20, 0x2, 0xb0, 0x0, 0x3b, 0xcc, 0xb2,
-    0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0xb2, 0x0, 0x0, 0x0, 0x0, 0xb2, 0x0,
-    0x0, 0x0, 0x0, 0xb2, 0x0, 0x3b, 0xcc, 0xa1,
-    0xb2, 0x3, 0xc2, 0x0, 0x2b, 0xb2, 0xc, 0x10,
-    0x0, 0x2, 0xf2, 0x1b, 0x0, 0x0, 0x0, 0xc2,
-    0x39, 0x0, 0x0, 0x0, 0xb2, 0x1b, 0x0, 0x0,
-    0x0, 0xc2, 0xc, 0x10, 0x0, 0x2, 0xf2, 0x3,
-    0xc2, 0x0, 0x2b, 0xb2, 0x0, 0x3b, 0xcc, 0xa1,
-    0xa2,
-
-    /* U+0065 "e" */
-    0x0, 0x4b, 0xcc, 0x90, 0x0, 0x4b, 0x10, 0x5,
-    0xb0, 0xc, 0x10, 0x0, 0x7, 0x52, 0xa0, 0x0,
-    0x0, 0x1a, 0x3d, 0xaa, 0xaa, 0xaa, 0x91, 0xa0,
-    0x0, 0x0, 0x0, 0xc, 0x10, 0x0, 0x0, 0x0,
-    0x3c, 0x20, 0x1, 0x91, 0x0, 0x3b, 0xcc, 0xb4,
-    0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x5c, 0xb8, 0x0, 0xc0, 0x0, 0x2, 0xa0,
-    0x0, 0x2, 0xa0, 0x0, 0x8c, 0xeb, 0xb3, 0x2,
-    0xa0, 0x0, 0x2, 0xa0, 0x0, 0x2, 0xa0, 0x0,
-    0x2, 0xa0, 0x0, 0x2, 0xa0, 0x0, 0x2, 0xa0,
-    0x0, 0x2, 0xa0, 0x0, 0x2, 0xa0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x3b, 0xbb, 0xa2, 0x83, 0x3, 0xb1, 0x0,
-    0x1a, 0xa3, 0xc, 0x10, 0x0, 0x1, 0xf3, 0x1b,
-    0x0, 0x0, 0x0, 0xa3, 0x39, 0x0, 0x0, 0x0,
-    0x93, 0x1b, 0x0, 0x0, 0x0, 0xb3, 0xc, 0x20,
-    0x0, 0x1, 0xf3, 0x3, 0xc2, 0x0, 0x2b, 0xa3,
-    0x0, 0x3b, 0xcc, 0xa2, 0x92, 0x0, 0x0, 0x0,
-    0x0, 0xc0, 0x5, 0x50, 0x0, 0x7, 0x80, 0x0,
-    0x7c, 0xcc, 0xc7, 0x0,
-
-    /* U+0068 "h" */
-    0x48, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0,
-    0x0, 0x48, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0,
-    0x0, 0x0, 0x48, 0x4b, 0xcd, 0x90, 0x4, 0xb9,
-    0x0, 0x7, 0x90, 0x4d, 0x0, 0x0, 0xd, 0x4,
-    0x90, 0x0, 0x0, 0xa2, 0x48, 0x0, 0x0, 0xa,
-    0x24, 0x80, 0x0, 0x0, 0xa2, 0x48, 0x0, 0x0,
-    0xa, 0x24, 0x80, 0x0, 0x0, 0xa2, 0x48, 0x0,
-    0x0, 0xa, 0x20,
-
-    /* U+0069 "i" */
-    0x7a, 0x23, 0x0, 0x0, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48,
-
-    /* U+006A "j" */
-    0x0, 0x5, 0xb0, 0x0, 0x13, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x90, 0x0, 0x39, 0x0,
-    0x3, 0x90, 0x0, 0x39, 0x0, 0x3, 0x90, 0x0,
-    0x39, 0x0, 0x3, 0x90, 0x0, 0x39, 0x0, 0x3,
-    0x90, 0x0, 0x39, 0x0, 0x7, 0x63, 0xcc, 0xa0,
-
-    /* U+006B "k" */
-    0x48, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0,
-    0x0, 0x48, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0xa6, 0x4, 0x80,
-    0x0, 0xa6, 0x0, 0x48, 0x0, 0xa6, 0x0, 0x4,
-    0x80, 0xb8, 0x0, 0x0, 0x48, 0xb7, 0xc0, 0x0,
-    0x4, 0xf5, 0x5, 0xa0, 0x0, 0x48, 0x0, 0xa,
-    0x60, 0x4, 0x80, 0x0, 0xc, 0x20, 0x48, 0x0,
-    0x0, 0x2c, 0x0,
-
-    /* U+006C "l" */
-    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48,
-
-    /* U+006D "m" */
-    0x47, 0x5b, 0xbc, 0x70, 0x1a, 0xbb, 0xb2, 0x4,
-    0xb7, 0x0, 0x9, 0x7b, 0x20, 0x2, 0xc0, 0x4d,
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x9, 0x44, 0x80,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0x66, 0x48, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x6, 0x64, 0x80, 0x0,
-    0x0, 0xc0, 0x0, 0x0, 0x66, 0x48, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x6, 0x64, 0x80, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x66, 0x48, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0x6, 0x60,
-
-    /* U+006E "n" */
-    0x47, 0x4b, 0xbc, 0x90, 0x4, 0xb8, 0x0, 0x6,
-    0x90, 0x4d, 0x0, 0x0, 0xc, 0x4, 0x80, 0x0,
-    0x0, 0xa2, 0x48, 0x0, 0x0, 0xa, 0x24, 0x80,
-    0x0, 0x0, 0xa2, 0x48, 0x0, 0x0, 0xa, 0x24,
-    0x80, 0x0, 0x0, 0xa2, 0x48, 0x0, 0x0, 0xa,
-    0x20,
-
-    /* U+006F "o" */
-    0x0, 0x3b, 0xcc, 0xb2, 0x0, 0x3, 0xc2, 0x0,
-    0x2c, 0x20, 0xc, 0x10, 0x0, 0x2, 0xb0, 0x1b,
-    0x0, 0x0, 0x0, 0xc0, 0x39, 0x0, 0x0, 0x0,
-    0xb2, 0x1b, 0x0, 0x0, 0x0, 0xc0, 0xc, 0x10,
-    0x0, 0x2, 0xb0, 0x3, 0xc2, 0x0, 0x2c, 0x20,
-    0x0, 0x3b, 0xcc, 0xb2, 0x0,
-
-    /* U+0070 "p" */
-    0x47, 0x3b, 0xcc, 0xa2, 0x0, 0x49, 0xa1, 0x0,
-    0x3d, 0x10, 0x4e, 0x0, 0x0, 0x4, 0x90, 0x49,
-    0x0, 0x0, 0x0, 0xd0, 0x48, 0x0, 0x0, 0x0,
-    0xc0, 0x49, 0x0, 0x0, 0x0, 0xd0, 0x4e, 0x0,
-    0x0, 0x4, 0x90, 0x4a, 0xa1, 0x0, 0x3d, 0x10,
-    0x48, 0x3b, 0xcc, 0xa2, 0x0, 0x48, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x3b, 0xcc, 0xa1, 0xa2, 0x3, 0xc2, 0x0,
-    0x2b, 0xb2, 0xc, 0x10, 0x0, 0x2, 0xf2, 0x1b,
-    0x0, 0x0, 0x0, 0xc2, 0x39, 0x0, 0x0, 0x0,
-    0xb2, 0x1b, 0x0, 0x0, 0x0, 0xc2, 0xc, 0x10,
-    0x0, 0x2, 0xf2, 0x3, 0xc2, 0x0, 0x2b, 0xb2,
-    0x0, 0x3b, 0xcc, 0xa1, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0xb2, 0x0, 0x0, 0x0, 0x0, 0xb2, 0x0,
-    0x0, 0x0, 0x0, 0xb2,
-
-    /* U+0072 "r" */
-    0x47, 0x5b, 0x74, 0xb8, 0x0, 0x4d, 0x0, 0x4,
-    0x90, 0x0, 0x48, 0x0, 0x4, 0x80, 0x0, 0x48,
-    0x0, 0x4, 0x80, 0x0, 0x48, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x3, 0xbc, 0xcb, 0x40, 0x1c, 0x10, 0x1, 0x40,
-    0x39, 0x0, 0x0, 0x0, 0xd, 0x40, 0x0, 0x0,
-    0x2, 0x9c, 0xb7, 0x0, 0x0, 0x0, 0x16, 0xc0,
-    0x0, 0x0, 0x0, 0xb1, 0x45, 0x0, 0x2, 0xd0,
-    0x8, 0xcc, 0xcb, 0x20,
-
-    /* U+0074 "t" */
-    0x2, 0xa0, 0x0, 0x2, 0xa0, 0x0, 0x8c, 0xeb,
-    0xb3, 0x2, 0xa0, 0x0, 0x2, 0xa0, 0x0, 0x2,
-    0xa0, 0x0, 0x2, 0xa0, 0x0, 0x2, 0xa0, 0x0,
-    0x2, 0xa0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x5c,
-    0xb8,
-
-    /* U+0075 "u" */
-    0x66, 0x0, 0x0, 0xc, 0x6, 0x60, 0x0, 0x0,
-    0xc0, 0x66, 0x0, 0x0, 0xc, 0x6, 0x60, 0x0,
-    0x0, 0xc0, 0x66, 0x0, 0x0, 0xc, 0x6, 0x60,
-    0x0, 0x0, 0xd0, 0x49, 0x0, 0x0, 0x2f, 0x0,
-    0xc4, 0x0, 0x1a, 0xd0, 0x1, 0xbc, 0xcb, 0x2c,
-    0x0,
-
-    /* U+0076 "v" */
-    0xb1, 0x0, 0x0, 0xa, 0x35, 0x80, 0x0, 0x1,
-    0xb0, 0xc, 0x0, 0x0, 0x75, 0x0, 0x75, 0x0,
-    0xc, 0x0, 0x1, 0xb0, 0x4, 0x80, 0x0, 0xa,
-    0x20, 0xb1, 0x0, 0x0, 0x39, 0x2a, 0x0, 0x0,
-    0x0, 0xc9, 0x40, 0x0, 0x0, 0x6, 0xd0, 0x0,
-    0x0,
-
-    /* U+0077 "w" */
-    0xa1, 0x0, 0x0, 0x96, 0x0, 0x0, 0x47, 0x57,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0xa1, 0xb, 0x0,
-    0x5, 0x69, 0x20, 0x0, 0xb0, 0x9, 0x20, 0xa,
-    0x14, 0x70, 0x5, 0x60, 0x4, 0x70, 0x1a, 0x0,
-    0xb0, 0xa, 0x10, 0x0, 0xb0, 0x65, 0x0, 0x83,
-    0x1a, 0x0, 0x0, 0x82, 0xb0, 0x0, 0x28, 0x65,
-    0x0, 0x0, 0x3a, 0x90, 0x0, 0xb, 0xb0, 0x0,
-    0x0, 0xd, 0x30, 0x0, 0x7, 0xa0, 0x0,
-
-    /* U+0078 "x" */
-    0x2c, 0x0, 0x0, 0x86, 0x5, 0x80, 0x4, 0xa0,
-    0x0, 0xa4, 0x1c, 0x0, 0x0, 0xc, 0xb3, 0x0,
-    0x0, 0x8, 0xc0, 0x0, 0x0, 0x2b, 0x86, 0x0,
-    0x0, 0xc2, 0xb, 0x20, 0x8, 0x50, 0x1, 0xc0,
-    0x4a, 0x0, 0x0, 0x59,
-
-    /* U+0079 "y" */
-    0xb, 0x10, 0x0, 0x0, 0xa3, 0x5, 0x80, 0x0,
-    0x1, 0xb0, 0x0, 0xc0, 0x0, 0x7, 0x50, 0x0,
-    0x75, 0x0, 0xc, 0x0, 0x0, 0x1c, 0x0, 0x57,
-    0x0, 0x0, 0x9, 0x30, 0xb1, 0x0, 0x0, 0x3,
-    0xa3, 0x90, 0x0, 0x0, 0x0, 0xbb, 0x20, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x84,
-    0x0, 0x0, 0x11, 0x2, 0xc0, 0x0, 0x0, 0x2c,
-    0xcb, 0x20, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x2b, 0xbb, 0xbb, 0xf3, 0x0, 0x0, 0x5, 0x90,
-    0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0xb2, 0x0,
-    0x0, 0x7, 0x60, 0x0, 0x0, 0x3b, 0x0, 0x0,
-    0x0, 0xc1, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0,
-    0x3f, 0xbb, 0xbb, 0xb4,
-
-    /* U+007B "{" */
-    0x0, 0x3c, 0x80, 0xb, 0x20, 0x0, 0xb1, 0x0,
-    0xb, 0x10, 0x0, 0xb1, 0x0, 0xb, 0x10, 0x0,
-    0xc0, 0x0, 0xcc, 0x0, 0x0, 0xc0, 0x0, 0xb,
-    0x10, 0x0, 0xb1, 0x0, 0xb, 0x10, 0x0, 0xb1,
-    0x0, 0xb, 0x10, 0x0, 0xa3, 0x0, 0x3, 0xc8,
-
-    /* U+007C "|" */
-    0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb,
-    0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb,
-
-    /* U+007D "}" */
-    0x7c, 0x50, 0x0, 0x1c, 0x0, 0x0, 0xc0, 0x0,
-    0xc, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0,
-    0xd0, 0x0, 0xa, 0xc1, 0x0, 0xc0, 0x0, 0xc,
-    0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0xc0,
-    0x0, 0xc, 0x0, 0x1, 0xc0, 0x7, 0xc4, 0x0,
-
-    /* U+007E "~" */
-    0x2b, 0xa1, 0x0, 0x70, 0x91, 0x1b, 0x20, 0xa0,
-    0x70, 0x1, 0xab, 0x30,
-
-    /* U+00AB "«" */
-    0x0, 0x5, 0x1, 0x30, 0x7, 0x50, 0xb1, 0x3,
-    0x90, 0x84, 0x0, 0xb0, 0x39, 0x0, 0x9, 0x21,
-    0xb0, 0x0, 0xb, 0x4, 0x80, 0x0, 0x39, 0x8,
-    0x40,
-
-    /* U+00BB "»" */
-    0x13, 0x3, 0x10, 0x0, 0xa2, 0x1a, 0x0, 0x1,
-    0xb0, 0x57, 0x0, 0x4, 0x80, 0x93, 0x0, 0x84,
-    0xb, 0x0, 0x48, 0x9, 0x30, 0x1a, 0x5, 0x70,
-    0x0,
-
-    /* U+0400 "Ѐ" */
-    0x3, 0xb2, 0x0, 0x0, 0x0, 0x1a, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0xcc, 0xcc, 0xc6,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xfc, 0xcc, 0xcc, 0xa0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xfc, 0xcc, 0xcc, 0xc9,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x5a, 0x0,
-    0x0, 0x10, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0xcc, 0xcc, 0xc6, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xfc, 0xcc, 0xcc, 0xa0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xfc, 0xcc, 0xcc, 0xc9,
-
-    /* U+0402 "Ђ" */
-    0xac, 0xcc, 0xfc, 0xcc, 0xc4, 0x0, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc0, 0x1, 0x21, 0x0,
-    0x0, 0x0, 0xc, 0x9c, 0xb9, 0xbc, 0x30, 0x0,
-    0x0, 0xc4, 0x0, 0x0, 0x3d, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0x0, 0x94, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x7, 0x50, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0x94, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0xc, 0x0, 0x6b, 0xca, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x1, 0xb4, 0x0, 0x2, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xcc, 0xcc, 0xcb, 0xd0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x19, 0xdc, 0xcb, 0x30, 0x3, 0xd4, 0x0,
-    0x2, 0xb6, 0x1d, 0x20, 0x0, 0x0, 0x1, 0x86,
-    0x0, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0xbb,
-    0xbb, 0xa0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x86, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x20, 0x0,
-    0x0, 0x0, 0x3, 0xd4, 0x0, 0x1, 0x96, 0x0,
-    0x19, 0xdc, 0xcb, 0x40,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x4b, 0xcc, 0xc8, 0x10, 0x4, 0xb1, 0x0,
-    0x5, 0x40, 0xb, 0x20, 0x0, 0x0, 0x0, 0xc,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0xc, 0x60, 0x0, 0x8, 0x80, 0x0,
-    0x7c, 0xcc, 0xc6, 0x0,
-
-    /* U+0406 "І" */
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-
-    /* U+0407 "Ї" */
-    0x0, 0x0, 0x8, 0x70, 0xb3, 0x10, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0,
-    0xc0, 0x0, 0xc, 0x0, 0x0, 0xc0, 0x0, 0xc,
-    0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x0, 0xc0,
-    0x0, 0xc, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0,
-
-    /* U+0408 "Ј" */
-    0x6, 0xcc, 0xce, 0x60, 0x0, 0x0, 0x66, 0x0,
-    0x0, 0x6, 0x60, 0x0, 0x0, 0x66, 0x0, 0x0,
-    0x6, 0x60, 0x0, 0x0, 0x66, 0x0, 0x0, 0x6,
-    0x60, 0x0, 0x0, 0x66, 0x0, 0x0, 0x6, 0x60,
-    0x0, 0x0, 0x84, 0x68, 0x0, 0x1d, 0x0, 0x6c,
-    0xcc, 0x30,
-
-    /* U+0409 "Љ" */
-    0x0, 0xd, 0xcc, 0xcc, 0xce, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0x7, 0xdb, 0xbb, 0xbb, 0x50, 0x0,
-    0x0, 0xb0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x1a,
-    0x70, 0x0, 0x1a, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0xd, 0x0, 0x3, 0x90, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0xa2, 0x0, 0x57, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0x0, 0xa, 0x20, 0x9, 0x40,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0xd0, 0x1,
-    0xd0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x1, 0xa8,
-    0xa, 0xd4, 0x0, 0x0, 0x0, 0x7e, 0xdd, 0xdd,
-    0xc6, 0x0,
-
-    /* U+040A "Њ" */
-    0xd0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xcc, 0xcc, 0xcc, 0xcf, 0xcc,
-    0xcc, 0xc8, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x7b, 0xd, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xb3, 0xd0, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x8, 0x4d, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0xa2, 0xd0, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x6b, 0xd, 0x0, 0x0,
-    0x0, 0xf, 0xbb, 0xbb, 0xc8, 0x0,
-
-    /* U+040B "Ћ" */
-    0xbc, 0xcc, 0xfc, 0xcc, 0xc2, 0x0, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x49, 0xcc, 0xc7, 0x0, 0x0,
-    0x0, 0xe8, 0x30, 0x1, 0x8a, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0xc2, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0x8, 0x40, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x84, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x8, 0x40,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0x84,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0xa6, 0x0, 0x0, 0x1, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0xb2, 0xd0, 0x0, 0x0, 0x94, 0xd, 0x0,
-    0x0, 0x67, 0x0, 0xd0, 0x0, 0x3a, 0x0, 0xd,
-    0x0, 0x1b, 0x10, 0x0, 0xfc, 0xce, 0x50, 0x0,
-    0xd, 0x0, 0x2d, 0x0, 0x0, 0xd0, 0x0, 0x59,
-    0x0, 0xd, 0x0, 0x0, 0xa4, 0x0, 0xd0, 0x0,
-    0x1, 0xc1, 0xd, 0x0, 0x0, 0x4, 0xb0, 0xd0,
-    0x0, 0x0, 0x8, 0x60,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x2, 0xa1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0xd3, 0xd0, 0x0, 0x0, 0x9,
-    0xe3, 0xd0, 0x0, 0x0, 0x5a, 0xa3, 0xd0, 0x0,
-    0x2, 0xc0, 0xa3, 0xd0, 0x0, 0xc, 0x30, 0xa3,
-    0xd0, 0x0, 0x87, 0x0, 0xa3, 0xd0, 0x4, 0xb0,
-    0x0, 0xa3, 0xd0, 0x1c, 0x10, 0x0, 0xa3, 0xd0,
-    0xb4, 0x0, 0x0, 0xa3, 0xd6, 0x80, 0x0, 0x0,
-    0xa3, 0xec, 0x0, 0x0, 0x0, 0xa3, 0xf2, 0x0,
-    0x0, 0x0, 0xa3,
-
-    /* U+040E "Ў" */
-    0x0, 0x29, 0x0, 0x29, 0x0, 0x0, 0x0, 0x48,
-    0x88, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x80, 0x0, 0x0, 0x0, 0x93, 0xc, 0x10,
-    0x0, 0x0, 0x2b, 0x0, 0x67, 0x0, 0x0, 0x9,
-    0x30, 0x0, 0xc0, 0x0, 0x2, 0xb0, 0x0, 0x6,
-    0x70, 0x0, 0x93, 0x0, 0x0, 0xc, 0x0, 0x2a,
-    0x0, 0x0, 0x0, 0x67, 0x9, 0x20, 0x0, 0x0,
-    0x0, 0xc2, 0xa0, 0x0, 0x0, 0x0, 0x6, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0x20, 0x0, 0x0, 0x5, 0xcc, 0x40,
-    0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0xd0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0xdf, 0xcc, 0xcc, 0xcc, 0xcd, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0x0, 0xc0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x3a, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x93, 0x75,
-    0x0, 0x0, 0x0, 0x1, 0xc0, 0x1b, 0x0, 0x0,
-    0x0, 0x7, 0x50, 0xa, 0x30, 0x0, 0x0, 0xc,
-    0x0, 0x3, 0xa0, 0x0, 0x0, 0x58, 0x0, 0x0,
-    0xc1, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x57, 0x0,
-    0x3, 0xeb, 0xbb, 0xbb, 0xbd, 0x0, 0xa, 0x30,
-    0x0, 0x0, 0x8, 0x50, 0x1c, 0x0, 0x0, 0x0,
-    0x1, 0xc0, 0x76, 0x0, 0x0, 0x0, 0x0, 0xa3,
-
-    /* U+0411 "Б" */
-    0xfc, 0xcc, 0xcc, 0xcc, 0xd, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xbb,
-    0xbb, 0xb9, 0x20, 0xd0, 0x0, 0x0, 0x4d, 0x1d,
-    0x0, 0x0, 0x0, 0x58, 0xd0, 0x0, 0x0, 0x3,
-    0xad, 0x0, 0x0, 0x0, 0x58, 0xd0, 0x0, 0x0,
-    0x2d, 0x2f, 0xbb, 0xbb, 0xba, 0x20,
-
-    /* U+0412 "В" */
-    0xfb, 0xbb, 0xbc, 0xa2, 0xd, 0x0, 0x0, 0x3,
-    0xd0, 0xd0, 0x0, 0x0, 0xa, 0x3d, 0x0, 0x0,
-    0x0, 0xa2, 0xd0, 0x0, 0x0, 0x5a, 0xf, 0xbb,
-    0xbb, 0xdd, 0x20, 0xd0, 0x0, 0x0, 0x2b, 0x3d,
-    0x0, 0x0, 0x0, 0x2a, 0xd0, 0x0, 0x0, 0x0,
-    0xcd, 0x0, 0x0, 0x0, 0x2b, 0xd0, 0x0, 0x0,
-    0x1b, 0x5f, 0xbb, 0xbb, 0xbc, 0x50,
-
-    /* U+0413 "Г" */
-    0xfc, 0xcc, 0xcc, 0xbd, 0x0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0xf, 0xcc, 0xcc, 0xce, 0x40, 0x0, 0x1b,
-    0x0, 0x0, 0x9, 0x40, 0x0, 0x1a, 0x0, 0x0,
-    0x9, 0x40, 0x0, 0x2a, 0x0, 0x0, 0x9, 0x40,
-    0x0, 0x29, 0x0, 0x0, 0x9, 0x40, 0x0, 0x38,
-    0x0, 0x0, 0x9, 0x40, 0x0, 0x47, 0x0, 0x0,
-    0x9, 0x40, 0x0, 0x65, 0x0, 0x0, 0x9, 0x40,
-    0x0, 0x83, 0x0, 0x0, 0x9, 0x40, 0x0, 0xb0,
-    0x0, 0x0, 0x9, 0x40, 0x3, 0x90, 0x0, 0x0,
-    0x9, 0x40, 0xaf, 0xdc, 0xcc, 0xcc, 0xce, 0xdc,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x6,
-
-    /* U+0415 "Е" */
-    0xfc, 0xcc, 0xcc, 0xc6, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xfc, 0xcc, 0xcc, 0xa0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0xfc, 0xcc, 0xcc, 0xc9,
-
-    /* U+0416 "Ж" */
-    0xc, 0x10, 0x0, 0x7, 0x60, 0x0, 0x1, 0xc0,
-    0x4, 0xa0, 0x0, 0x7, 0x60, 0x0, 0xb, 0x30,
-    0x0, 0x95, 0x0, 0x7, 0x60, 0x0, 0x67, 0x0,
-    0x0, 0xc, 0x10, 0x7, 0x60, 0x2, 0xb0, 0x0,
-    0x0, 0x3, 0xa0, 0x7, 0x60, 0xb, 0x20, 0x0,
-    0x0, 0x0, 0xbd, 0xce, 0xec, 0xda, 0x0, 0x0,
-    0x0, 0x3, 0xb0, 0x7, 0x60, 0xc, 0x20, 0x0,
-    0x0, 0xc, 0x20, 0x7, 0x60, 0x3, 0xb0, 0x0,
-    0x0, 0x78, 0x0, 0x7, 0x60, 0x0, 0x95, 0x0,
-    0x1, 0xd0, 0x0, 0x7, 0x60, 0x0, 0x1d, 0x10,
-    0xa, 0x50, 0x0, 0x7, 0x60, 0x0, 0x6, 0x90,
-    0x4b, 0x0, 0x0, 0x7, 0x60, 0x0, 0x0, 0xc3,
-
-    /* U+0417 "З" */
-    0x6, 0xbc, 0xcc, 0x91, 0x2, 0x71, 0x0, 0x4,
-    0xc0, 0x0, 0x0, 0x0, 0x9, 0x40, 0x0, 0x0,
-    0x0, 0x84, 0x0, 0x0, 0x0, 0x4c, 0x0, 0x8,
-    0xcc, 0xde, 0x20, 0x0, 0x0, 0x0, 0x3c, 0x20,
-    0x0, 0x0, 0x0, 0x3a, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0x3a, 0xa7, 0x10, 0x0,
-    0x2c, 0x30, 0x6b, 0xcc, 0xca, 0x30,
-
-    /* U+0418 "И" */
-    0xd0, 0x0, 0x0, 0x0, 0xd3, 0xd0, 0x0, 0x0,
-    0x9, 0xe3, 0xd0, 0x0, 0x0, 0x5a, 0xa3, 0xd0,
-    0x0, 0x2, 0xc0, 0xa3, 0xd0, 0x0, 0xc, 0x30,
-    0xa3, 0xd0, 0x0, 0x87, 0x0, 0xa3, 0xd0, 0x4,
-    0xb0, 0x0, 0xa3, 0xd0, 0x1c, 0x10, 0x0, 0xa3,
-    0xd0, 0xb4, 0x0, 0x0, 0xa3, 0xd6, 0x80, 0x0,
-    0x0, 0xa3, 0xec, 0x0, 0x0, 0x0, 0xa3, 0xf2,
-    0x0, 0x0, 0x0, 0xa3,
-
-    /* U+0419 "Й" */
-    0x0, 0xa1, 0x0, 0xb0, 0x0, 0x0, 0x28, 0x88,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0xd3, 0xd0, 0x0, 0x0, 0x9,
-    0xe3, 0xd0, 0x0, 0x0, 0x5a, 0xa3, 0xd0, 0x0,
-    0x2, 0xc0, 0xa3, 0xd0, 0x0, 0xc, 0x30, 0xa3,
-    0xd0, 0x0, 0x87, 0x0, 0xa3, 0xd0, 0x4, 0xb0,
-    0x0, 0xa3, 0xd0, 0x1c, 0x10, 0x0, 0xa3, 0xd0,
-    0xb4, 0x0, 0x0, 0xa3, 0xd6, 0x80, 0x0, 0x0,
-    0xa3, 0xec, 0x0, 0x0, 0x0, 0xa3, 0xf2, 0x0,
-    0x0, 0x0, 0xa3,
-
-    /* U+041A "К" */
-    0xd0, 0x0, 0x0, 0xb, 0x2d, 0x0, 0x0, 0x9,
-    0x40, 0xd0, 0x0, 0x6, 0x70, 0xd, 0x0, 0x3,
-    0xa0, 0x0, 0xd0, 0x1, 0xb1, 0x0, 0xf, 0xcc,
-    0xe5, 0x0, 0x0, 0xd0, 0x2, 0xd0, 0x0, 0xd,
-    0x0, 0x5, 0x90, 0x0, 0xd0, 0x0, 0xa, 0x40,
-    0xd, 0x0, 0x0, 0x1c, 0x10, 0xd0, 0x0, 0x0,
-    0x4b, 0xd, 0x0, 0x0, 0x0, 0x86,
-
-    /* U+041B "Л" */
-    0x0, 0xd, 0xcc, 0xcc, 0xcd, 0x70, 0x0, 0xc0,
-    0x0, 0x0, 0x57, 0x0, 0xc, 0x0, 0x0, 0x5,
-    0x70, 0x0, 0xc0, 0x0, 0x0, 0x57, 0x0, 0xc,
-    0x0, 0x0, 0x5, 0x70, 0x0, 0xb0, 0x0, 0x0,
-    0x57, 0x0, 0x1a, 0x0, 0x0, 0x5, 0x70, 0x3,
-    0x90, 0x0, 0x0, 0x57, 0x0, 0x57, 0x0, 0x0,
-    0x5, 0x70, 0x9, 0x40, 0x0, 0x0, 0x57, 0x1,
-    0xd0, 0x0, 0x0, 0x5, 0x7a, 0xd4, 0x0, 0x0,
-    0x0, 0x57,
-
-    /* U+041C "М" */
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x86, 0xf8, 0x0,
-    0x0, 0x0, 0x1, 0xf6, 0xcb, 0x10, 0x0, 0x0,
-    0x9, 0x96, 0xc3, 0x90, 0x0, 0x0, 0x2a, 0x66,
-    0xc0, 0xa2, 0x0, 0x0, 0xa1, 0x66, 0xc0, 0x2a,
-    0x0, 0x3, 0x80, 0x66, 0xc0, 0x9, 0x30, 0xb,
-    0x10, 0x66, 0xc0, 0x1, 0xb0, 0x57, 0x0, 0x66,
-    0xc0, 0x0, 0x85, 0xb0, 0x0, 0x66, 0xc0, 0x0,
-    0x1e, 0x60, 0x0, 0x66, 0xc0, 0x0, 0x3, 0x0,
-    0x0, 0x66, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x66,
-
-    /* U+041D "Н" */
-    0xd0, 0x0, 0x0, 0x0, 0xb2, 0xd0, 0x0, 0x0,
-    0x0, 0xb2, 0xd0, 0x0, 0x0, 0x0, 0xb2, 0xd0,
-    0x0, 0x0, 0x0, 0xb2, 0xd0, 0x0, 0x0, 0x0,
-    0xb2, 0xfc, 0xcc, 0xcc, 0xcc, 0xf2, 0xd0, 0x0,
-    0x0, 0x0, 0xb2, 0xd0, 0x0, 0x0, 0x0, 0xb2,
-    0xd0, 0x0, 0x0, 0x0, 0xb2, 0xd0, 0x0, 0x0,
-    0x0, 0xb2, 0xd0, 0x0, 0x0, 0x0, 0xb2, 0xd0,
-    0x0, 0x0, 0x0, 0xb2,
-
-    /* U+041E "О" */
-    0x0, 0x1, 0x8c, 0xcc, 0xc5, 0x0, 0x0, 0x3,
-    0xd5, 0x0, 0x1, 0x8b, 0x0, 0x1, 0xd2, 0x0,
-    0x0, 0x0, 0x69, 0x0, 0x86, 0x0, 0x0, 0x0,
-    0x0, 0xc2, 0xd, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x70, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xd,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x90, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x67, 0x8, 0x60, 0x0, 0x0,
-    0x0, 0xc, 0x20, 0x1d, 0x20, 0x0, 0x0, 0x6,
-    0x90, 0x0, 0x3d, 0x50, 0x0, 0x18, 0xb0, 0x0,
-    0x0, 0x18, 0xcc, 0xcb, 0x50, 0x0,
-
-    /* U+041F "П" */
-    0xfc, 0xcc, 0xcc, 0xcc, 0xe3, 0xd0, 0x0, 0x0,
-    0x0, 0x93, 0xd0, 0x0, 0x0, 0x0, 0x93, 0xd0,
-    0x0, 0x0, 0x0, 0x93, 0xd0, 0x0, 0x0, 0x0,
-    0x93, 0xd0, 0x0, 0x0, 0x0, 0x93, 0xd0, 0x0,
-    0x0, 0x0, 0x93, 0xd0, 0x0, 0x0, 0x0, 0x93,
-    0xd0, 0x0, 0x0, 0x0, 0x93, 0xd0, 0x0, 0x0,
-    0x0, 0x93, 0xd0, 0x0, 0x0, 0x0, 0x93, 0xd0,
-    0x0, 0x0, 0x0, 0x93,
-
-    /* U+0420 "Р" */
-    0xfc, 0xcc, 0xcc, 0x70, 0xd, 0x0, 0x0, 0x6,
-    0xb0, 0xd0, 0x0, 0x0, 0x9, 0x4d, 0x0, 0x0,
-    0x0, 0x58, 0xd0, 0x0, 0x0, 0x5, 0x8d, 0x0,
-    0x0, 0x0, 0xa4, 0xd0, 0x0, 0x1, 0x8a, 0xf,
-    0xcc, 0xcc, 0xb6, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x18, 0xcc, 0xcb, 0x50, 0x3, 0xd5, 0x0,
-    0x1, 0x98, 0x1d, 0x20, 0x0, 0x0, 0x0, 0x86,
-    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x86, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x20, 0x0,
-    0x0, 0x0, 0x3, 0xd5, 0x0, 0x1, 0x98, 0x0,
-    0x18, 0xcc, 0xcb, 0x50,
-
-    /* U+0422 "Т" */
-    0xac, 0xcc, 0xfc, 0xcc, 0xc0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x58, 0x0, 0x0, 0x0, 0x9, 0x30, 0xc1, 0x0,
-    0x0, 0x2, 0xb0, 0x6, 0x70, 0x0, 0x0, 0x93,
-    0x0, 0xc, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x67,
-    0x0, 0x9, 0x30, 0x0, 0x0, 0xc0, 0x2, 0xa0,
-    0x0, 0x0, 0x6, 0x70, 0x92, 0x0, 0x0, 0x0,
-    0xc, 0x2a, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0xc2, 0x0, 0x0, 0x0, 0x5c, 0xc4, 0x0,
-    0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x1, 0x7b, 0xce, 0xb9, 0x40, 0x0, 0x0,
-    0x6c, 0x40, 0x2a, 0x1, 0x7b, 0x10, 0x4, 0xb0,
-    0x0, 0x2a, 0x0, 0x3, 0xc0, 0xc, 0x10, 0x0,
-    0x2a, 0x0, 0x0, 0x85, 0xc, 0x0, 0x0, 0x2a,
-    0x0, 0x0, 0x39, 0x2a, 0x0, 0x0, 0x2a, 0x0,
-    0x0, 0x2a, 0xc, 0x0, 0x0, 0x2a, 0x0, 0x0,
-    0x39, 0xc, 0x10, 0x0, 0x2a, 0x0, 0x0, 0x85,
-    0x4, 0xb0, 0x0, 0x2a, 0x0, 0x3, 0xc0, 0x0,
-    0x6c, 0x50, 0x2a, 0x2, 0x7c, 0x10, 0x0, 0x1,
-    0x7b, 0xce, 0xba, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2a, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x1d, 0x10, 0x0, 0x0, 0xc2, 0x4, 0xb0, 0x0,
-    0x8, 0x60, 0x0, 0xa5, 0x0, 0x3b, 0x0, 0x0,
-    0x1d, 0x10, 0xc2, 0x0, 0x0, 0x4, 0xb9, 0x60,
-    0x0, 0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x10, 0x0, 0x0, 0x9, 0x64, 0xb0, 0x0,
-    0x0, 0x3b, 0x0, 0x96, 0x0, 0x0, 0xc1, 0x0,
-    0xd, 0x10, 0x9, 0x60, 0x0, 0x4, 0xb0, 0x3b,
-    0x0, 0x0, 0x0, 0x96,
-
-    /* U+0426 "Ц" */
-    0xd0, 0x0, 0x0, 0x0, 0xd0, 0xd, 0x0, 0x0,
-    0x0, 0xd, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xd0,
-    0xd, 0x0, 0x0, 0x0, 0xd, 0x0, 0xd0, 0x0,
-    0x0, 0x0, 0xd0, 0xd, 0x0, 0x0, 0x0, 0xd,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0xd0, 0xd, 0x0,
-    0x0, 0x0, 0xd, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0xd, 0x0, 0x0, 0x0, 0xd, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0xd0, 0xf, 0xcc, 0xcc, 0xcc,
-    0xcf, 0xc8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xa0,
-
-    /* U+0427 "Ч" */
-    0x39, 0x0, 0x0, 0x0, 0x66, 0x39, 0x0, 0x0,
-    0x0, 0x66, 0x39, 0x0, 0x0, 0x0, 0x66, 0x39,
-    0x0, 0x0, 0x0, 0x66, 0x2a, 0x0, 0x0, 0x0,
-    0x66, 0xd, 0x0, 0x0, 0x0, 0x66, 0x7, 0xb2,
-    0x0, 0x16, 0xd6, 0x0, 0x5b, 0xcc, 0xb6, 0x76,
-    0x0, 0x0, 0x0, 0x0, 0x66, 0x0, 0x0, 0x0,
-    0x0, 0x66, 0x0, 0x0, 0x0, 0x0, 0x66, 0x0,
-    0x0, 0x0, 0x0, 0x66,
-
-    /* U+0428 "Ш" */
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0xd0,
-    0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0xd0, 0x0,
-    0x0, 0xa2, 0x0, 0x0, 0x57, 0xd0, 0x0, 0x0,
-    0xa2, 0x0, 0x0, 0x57, 0xd0, 0x0, 0x0, 0xa2,
-    0x0, 0x0, 0x57, 0xd0, 0x0, 0x0, 0xa2, 0x0,
-    0x0, 0x57, 0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0,
-    0x57, 0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0xd0,
-    0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0xd0, 0x0,
-    0x0, 0xa2, 0x0, 0x0, 0x57, 0xfc, 0xcc, 0xcc,
-    0xed, 0xcc, 0xcc, 0xd7,
-
-    /* U+0429 "Щ" */
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xd0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x57, 0x0,
-    0xfc, 0xcc, 0xcc, 0xed, 0xcc, 0xcc, 0xde, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x84,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x84,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x42,
-
-    /* U+042A "Ъ" */
-    0xac, 0xcd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xeb, 0xbb, 0xbb, 0x50,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0x19, 0x80, 0x0,
-    0x4, 0x80, 0x0, 0x0, 0xd, 0x0, 0x0, 0x48,
-    0x0, 0x0, 0x0, 0x93, 0x0, 0x4, 0x80, 0x0,
-    0x0, 0x9, 0x30, 0x0, 0x48, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x88, 0x0,
-    0x0, 0x4e, 0xbb, 0xbb, 0xc7, 0x0,
-
-    /* U+042B "Ы" */
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x67, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x67, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x67, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x67,
-    0xfb, 0xbb, 0xbb, 0x80, 0x0, 0x67, 0xd0, 0x0,
-    0x0, 0x6c, 0x0, 0x67, 0xd0, 0x0, 0x0, 0x8,
-    0x50, 0x67, 0xd0, 0x0, 0x0, 0x5, 0x80, 0x67,
-    0xd0, 0x0, 0x0, 0x4, 0x80, 0x67, 0xd0, 0x0,
-    0x0, 0x8, 0x50, 0x67, 0xd0, 0x0, 0x0, 0x5c,
-    0x0, 0x67, 0xfb, 0xbb, 0xbc, 0x91, 0x0, 0x67,
-
-    /* U+042C "Ь" */
-    0xd0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0xbb, 0xbb, 0x80, 0xd, 0x0,
-    0x0, 0x6, 0xc0, 0xd0, 0x0, 0x0, 0x8, 0x5d,
-    0x0, 0x0, 0x0, 0x58, 0xd0, 0x0, 0x0, 0x4,
-    0x8d, 0x0, 0x0, 0x0, 0x85, 0xd0, 0x0, 0x0,
-    0x5c, 0xf, 0xbb, 0xbb, 0xc9, 0x10,
-
-    /* U+042D "Э" */
-    0x2, 0x9c, 0xcd, 0xb3, 0x0, 0x2, 0xc3, 0x0,
-    0x2, 0xb7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb4,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x10, 0x0, 0x7b, 0xbb, 0xbb,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x9, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0x0, 0x10, 0x0, 0x0, 0xb, 0x40, 0x2d,
-    0x40, 0x0, 0x2b, 0x70, 0x0, 0x19, 0xcc, 0xdb,
-    0x30, 0x0,
-
-    /* U+042E "Ю" */
-    0xd0, 0x0, 0x0, 0x7c, 0xcc, 0xb4, 0x0, 0xd,
-    0x0, 0x1, 0xc7, 0x0, 0x2, 0xa8, 0x0, 0xd0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xa6, 0xd, 0x0,
-    0x3b, 0x0, 0x0, 0x0, 0x1, 0xd0, 0xd0, 0x8,
-    0x50, 0x0, 0x0, 0x0, 0xa, 0x3f, 0xdd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x75, 0xd0, 0xa, 0x20,
-    0x0, 0x0, 0x0, 0x7, 0x5d, 0x0, 0x85, 0x0,
-    0x0, 0x0, 0x0, 0xa3, 0xd0, 0x3, 0xb0, 0x0,
-    0x0, 0x0, 0x1d, 0xd, 0x0, 0xb, 0x50, 0x0,
-    0x0, 0xa, 0x60, 0xd0, 0x0, 0x1c, 0x70, 0x0,
-    0x2a, 0x80, 0xd, 0x0, 0x0, 0x7, 0xcc, 0xcb,
-    0x40, 0x0,
-
-    /* U+042F "Я" */
-    0x2, 0xac, 0xcc, 0xcd, 0xb2, 0xd4, 0x0, 0x0,
-    0x2b, 0x94, 0x0, 0x0, 0x2, 0xbc, 0x0, 0x0,
-    0x0, 0x2b, 0xc0, 0x0, 0x0, 0x2, 0xb9, 0x50,
-    0x0, 0x0, 0x2b, 0x1d, 0x40, 0x0, 0x2, 0xb0,
-    0x1a, 0xec, 0xcc, 0xdb, 0x0, 0xb2, 0x0, 0x2,
-    0xb0, 0x58, 0x0, 0x0, 0x2b, 0xc, 0x0, 0x0,
-    0x2, 0xb8, 0x50, 0x0, 0x0, 0x2b,
-
-    /* U+0430 "а" */
-    0x1, 0x9c, 0xcc, 0x60, 0x8, 0x40, 0x0, 0xb5,
-    0x0, 0x0, 0x0, 0x3a, 0x0, 0x0, 0x0, 0x1b,
-    0x1, 0x9a, 0xaa, 0xbb, 0xc, 0x30, 0x0, 0x1b,
-    0xc, 0x0, 0x0, 0x2b, 0xc, 0x10, 0x0, 0xab,
-    0x2, 0xba, 0x99, 0x3b,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x27, 0xbc,
-    0x81, 0x0, 0xaa, 0x50, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0x0, 0x39, 0x0, 0x0, 0x0, 0x8, 0x36,
-    0xcc, 0xc8, 0x0, 0xb7, 0x70, 0x0, 0x7a, 0xc,
-    0x90, 0x0, 0x0, 0xa3, 0xd5, 0x0, 0x0, 0x5,
-    0x8b, 0x30, 0x0, 0x0, 0x39, 0x85, 0x0, 0x0,
-    0x5, 0x73, 0xb0, 0x0, 0x0, 0xb3, 0xa, 0x80,
-    0x0, 0x79, 0x0, 0x8, 0xcb, 0xc7, 0x0,
-
-    /* U+0432 "в" */
-    0x4d, 0xbb, 0xbb, 0x40, 0x48, 0x0, 0x0, 0xc1,
-    0x48, 0x0, 0x0, 0x93, 0x48, 0x0, 0x1, 0xb0,
-    0x4d, 0xaa, 0xbe, 0x40, 0x48, 0x0, 0x0, 0xa3,
-    0x48, 0x0, 0x0, 0x47, 0x48, 0x0, 0x0, 0x95,
-    0x4d, 0xbb, 0xbb, 0x80,
-
-    /* U+0433 "г" */
-    0x4e, 0xcc, 0xcc, 0x54, 0x80, 0x0, 0x0, 0x48,
-    0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x48, 0x0,
-    0x0, 0x4, 0x80, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0x4, 0x80, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0xac, 0xcc, 0xce, 0x30, 0x0, 0xb0, 0x0,
-    0x9, 0x30, 0x0, 0xb0, 0x0, 0x9, 0x30, 0x0,
-    0xc0, 0x0, 0x9, 0x30, 0x0, 0xc0, 0x0, 0x9,
-    0x30, 0x0, 0xc0, 0x0, 0x9, 0x30, 0x1, 0xa0,
-    0x0, 0x9, 0x30, 0x7, 0x50, 0x0, 0x9, 0x30,
-    0xaf, 0xbb, 0xbb, 0xbe, 0xc6, 0xc0, 0x0, 0x0,
-    0x0, 0x29, 0xc0, 0x0, 0x0, 0x0, 0x29,
-
-    /* U+0435 "е" */
-    0x0, 0x3b, 0xcc, 0xa1, 0x0, 0x3c, 0x20, 0x4,
-    0xc0, 0xb, 0x20, 0x0, 0x6, 0x70, 0xb0, 0x0,
-    0x0, 0xb, 0x1e, 0xaa, 0xaa, 0xaa, 0xa0, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0x20, 0x0, 0x0, 0x0,
-    0x2c, 0x30, 0x0, 0x92, 0x0, 0x2a, 0xcc, 0xc5,
-    0x0,
-
-    /* U+0436 "ж" */
-    0x2b, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x10, 0x76,
-    0x0, 0xc, 0x0, 0x8, 0x50, 0x0, 0xb1, 0x0,
-    0xc0, 0x2, 0xa0, 0x0, 0x2, 0xb0, 0xc, 0x0,
-    0xb1, 0x0, 0x0, 0xb, 0xcb, 0xfb, 0xca, 0x0,
-    0x0, 0x4, 0xa0, 0xc, 0x0, 0xb3, 0x0, 0x1,
-    0xc1, 0x0, 0xc0, 0x2, 0xc0, 0x0, 0xa5, 0x0,
-    0xc, 0x0, 0x6, 0x80, 0x5a, 0x0, 0x0, 0xc0,
-    0x0, 0xb, 0x30,
-
-    /* U+0437 "з" */
-    0x7, 0xcc, 0xca, 0x20, 0x5, 0x0, 0x4, 0xd0,
-    0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x3, 0xb0,
-    0x0, 0x5a, 0xbd, 0x20, 0x0, 0x0, 0x1, 0xb1,
-    0x0, 0x0, 0x0, 0x85, 0x44, 0x0, 0x2, 0xd1,
-    0x7, 0xcb, 0xcb, 0x30,
-
-    /* U+0438 "и" */
-    0x48, 0x0, 0x0, 0xd, 0x34, 0x80, 0x0, 0xa,
-    0xd3, 0x48, 0x0, 0x7, 0x79, 0x34, 0x80, 0x3,
-    0xa0, 0x93, 0x48, 0x1, 0xc1, 0x9, 0x34, 0x80,
-    0xb3, 0x0, 0x93, 0x48, 0x86, 0x0, 0x9, 0x34,
-    0xd9, 0x0, 0x0, 0x93, 0x4c, 0x0, 0x0, 0x9,
-    0x30,
-
-    /* U+0439 "й" */
-    0x0, 0x40, 0x0, 0x40, 0x0, 0x9, 0x20, 0x37,
-    0x0, 0x0, 0x8, 0x98, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0xd, 0x34, 0x80,
-    0x0, 0xa, 0xd3, 0x48, 0x0, 0x7, 0x79, 0x34,
-    0x80, 0x3, 0xa0, 0x93, 0x48, 0x1, 0xc1, 0x9,
-    0x34, 0x80, 0xb3, 0x0, 0x93, 0x48, 0x86, 0x0,
-    0x9, 0x34, 0xd9, 0x0, 0x0, 0x93, 0x4c, 0x0,
-    0x0, 0x9, 0x30,
-
-    /* U+043A "к" */
-    0x48, 0x0, 0x0, 0xa3, 0x48, 0x0, 0x6, 0x70,
-    0x48, 0x0, 0x3a, 0x0, 0x48, 0x1, 0xb0, 0x0,
-    0x4e, 0xbd, 0x60, 0x0, 0x48, 0x1, 0xc2, 0x0,
-    0x48, 0x0, 0x2c, 0x0, 0x48, 0x0, 0x5, 0xa0,
-    0x48, 0x0, 0x0, 0x87,
-
-    /* U+043B "л" */
-    0x0, 0x9c, 0xcc, 0xce, 0x40, 0xa, 0x10, 0x0,
-    0x84, 0x0, 0xb0, 0x0, 0x8, 0x40, 0xb, 0x0,
-    0x0, 0x84, 0x0, 0xb0, 0x0, 0x8, 0x40, 0xb,
-    0x0, 0x0, 0x84, 0x1, 0xa0, 0x0, 0x8, 0x40,
-    0x76, 0x0, 0x0, 0x84, 0xab, 0x0, 0x0, 0x8,
-    0x40,
-
-    /* U+043C "м" */
-    0x4c, 0x0, 0x0, 0x0, 0x3c, 0x4e, 0x50, 0x0,
-    0x0, 0xbc, 0x48, 0xc0, 0x0, 0x5, 0x7b, 0x47,
-    0x57, 0x0, 0xb, 0xb, 0x47, 0xb, 0x10, 0x65,
-    0xb, 0x47, 0x3, 0x91, 0xb0, 0xb, 0x47, 0x0,
-    0xaa, 0x30, 0xb, 0x47, 0x0, 0x29, 0x0, 0xb,
-    0x47, 0x0, 0x0, 0x0, 0xb,
-
-    /* U+043D "н" */
-    0x48, 0x0, 0x0, 0xc, 0x48, 0x0, 0x0, 0xc,
-    0x48, 0x0, 0x0, 0xc, 0x48, 0x0, 0x0, 0xc,
-    0x4e, 0xcc, 0xcc, 0xcf, 0x48, 0x0, 0x0, 0xc,
-    0x48, 0x0, 0x0, 0xc, 0x48, 0x0, 0x0, 0xc,
-    0x48, 0x0, 0x0, 0xc,
-
-    /* U+043E "о" */
-    0x0, 0x2b, 0xcc, 0xb3, 0x0, 0x2, 0xc3, 0x0,
-    0x2c, 0x30, 0xb, 0x30, 0x0, 0x1, 0xc0, 0xc,
-    0x0, 0x0, 0x0, 0xb2, 0x1b, 0x0, 0x0, 0x0,
-    0x93, 0xc, 0x0, 0x0, 0x0, 0xb2, 0xb, 0x30,
-    0x0, 0x1, 0xc0, 0x2, 0xc2, 0x0, 0x2c, 0x40,
-    0x0, 0x2b, 0xcc, 0xb3, 0x0,
-
-    /* U+043F "п" */
-    0x4e, 0xcc, 0xcc, 0xcf, 0x4, 0x80, 0x0, 0x0,
-    0xc0, 0x48, 0x0, 0x0, 0xc, 0x4, 0x80, 0x0,
-    0x0, 0xc0, 0x48, 0x0, 0x0, 0xc, 0x4, 0x80,
-    0x0, 0x0, 0xc0, 0x48, 0x0, 0x0, 0xc, 0x4,
-    0x80, 0x0, 0x0, 0xc0, 0x48, 0x0, 0x0, 0xc,
-    0x0,
-
-    /* U+0440 "р" */
-    0x48, 0x2b, 0xcc, 0xb2, 0x0, 0x4a, 0xb1, 0x0,
-    0x3d, 0x20, 0x4f, 0x10, 0x0, 0x3, 0xa0, 0x4a,
-    0x0, 0x0, 0x0, 0xc0, 0x48, 0x0, 0x0, 0x0,
-    0xb0, 0x4a, 0x0, 0x0, 0x0, 0xc0, 0x4f, 0x10,
-    0x0, 0x3, 0xa0, 0x4a, 0xa1, 0x0, 0x3c, 0x20,
-    0x48, 0x2b, 0xcc, 0xb2, 0x0, 0x48, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x2b, 0xcc, 0xb3, 0x0, 0x2c, 0x30, 0x1,
-    0xb1, 0xb, 0x30, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0,
-    0x2c, 0x20, 0x1, 0xb1, 0x0, 0x2b, 0xcc, 0xb3,
-    0x0,
-
-    /* U+0442 "т" */
-    0xc, 0xcc, 0xfc, 0xcc, 0x30, 0x0, 0xc, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0,
-
-    /* U+0443 "у" */
-    0x9, 0x30, 0x0, 0x0, 0x75, 0x3, 0xa0, 0x0,
-    0x0, 0xc0, 0x0, 0xc1, 0x0, 0x5, 0x70, 0x0,
-    0x57, 0x0, 0xb, 0x0, 0x0, 0xc, 0x0, 0x39,
-    0x0, 0x0, 0x7, 0x50, 0xa2, 0x0, 0x0, 0x1,
-    0xb1, 0xb0, 0x0, 0x0, 0x0, 0xab, 0x40, 0x0,
-    0x0, 0x0, 0x4d, 0x0, 0x0, 0x0, 0x0, 0x66,
-    0x0, 0x0, 0x2, 0x1, 0xc0, 0x0, 0x0, 0x1b,
-    0xcc, 0x30, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0,
-    0x0, 0x19, 0xcd, 0xec, 0xa3, 0x0, 0x2, 0xd5,
-    0x4, 0x80, 0x2b, 0x50, 0xb, 0x20, 0x4, 0x80,
-    0x0, 0xc1, 0x1c, 0x0, 0x4, 0x80, 0x0, 0x75,
-    0x2a, 0x0, 0x4, 0x80, 0x0, 0x56, 0x1c, 0x0,
-    0x4, 0x80, 0x0, 0x75, 0xb, 0x30, 0x4, 0x80,
-    0x0, 0xc1, 0x2, 0xd4, 0x4, 0x80, 0x2b, 0x50,
-    0x0, 0x19, 0xcd, 0xec, 0xa3, 0x0, 0x0, 0x0,
-    0x4, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x2b, 0x0, 0x0, 0x95, 0x6, 0x70, 0x4, 0x90,
-    0x0, 0xa3, 0x1c, 0x0, 0x0, 0x1c, 0xb3, 0x0,
-    0x0, 0x9, 0xc0, 0x0, 0x0, 0x3b, 0x86, 0x0,
-    0x0, 0xc1, 0xc, 0x20, 0x9, 0x40, 0x2, 0xc0,
-    0x59, 0x0, 0x0, 0x68,
-
-    /* U+0446 "ц" */
-    0x48, 0x0, 0x0, 0xc, 0x0, 0x48, 0x0, 0x0,
-    0xc, 0x0, 0x48, 0x0, 0x0, 0xc, 0x0, 0x48,
-    0x0, 0x0, 0xc, 0x0, 0x48, 0x0, 0x0, 0xc,
-    0x0, 0x48, 0x0, 0x0, 0xc, 0x0, 0x48, 0x0,
-    0x0, 0xc, 0x0, 0x48, 0x0, 0x0, 0xc, 0x0,
-    0x4e, 0xcc, 0xcc, 0xcf, 0xc3, 0x0, 0x0, 0x0,
-    0x0, 0x84, 0x0, 0x0, 0x0, 0x0, 0x84,
-
-    /* U+0447 "ч" */
-    0x39, 0x0, 0x0, 0x1b, 0x39, 0x0, 0x0, 0x1b,
-    0x39, 0x0, 0x0, 0x1b, 0x2a, 0x0, 0x0, 0x1b,
-    0xc, 0x40, 0x1, 0x7b, 0x1, 0x9b, 0xba, 0x6b,
-    0x0, 0x0, 0x0, 0x1b, 0x0, 0x0, 0x0, 0x1b,
-    0x0, 0x0, 0x0, 0x1b,
-
-    /* U+0448 "ш" */
-    0x48, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x48, 0x0,
-    0x0, 0xc0, 0x0, 0xc, 0x48, 0x0, 0x0, 0xc0,
-    0x0, 0xc, 0x48, 0x0, 0x0, 0xc0, 0x0, 0xc,
-    0x48, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x48, 0x0,
-    0x0, 0xc0, 0x0, 0xc, 0x48, 0x0, 0x0, 0xc0,
-    0x0, 0xc, 0x48, 0x0, 0x0, 0xc0, 0x0, 0xc,
-    0x4e, 0xcc, 0xcc, 0xfc, 0xcc, 0xce,
-
-    /* U+0449 "щ" */
-    0x48, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x48,
-    0x0, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x48, 0x0,
-    0x0, 0xc0, 0x0, 0xc, 0x0, 0x48, 0x0, 0x0,
-    0xc0, 0x0, 0xc, 0x0, 0x48, 0x0, 0x0, 0xc0,
-    0x0, 0xc, 0x0, 0x48, 0x0, 0x0, 0xc0, 0x0,
-    0xc, 0x0, 0x48, 0x0, 0x0, 0xc0, 0x0, 0xc,
-    0x0, 0x48, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0,
-    0x4e, 0xcc, 0xcc, 0xfc, 0xcc, 0xcf, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x84,
-
-    /* U+044A "ъ" */
-    0xc, 0xcd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x57,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0xaa, 0xa8, 0x0, 0x0, 0x5,
-    0x70, 0x0, 0x5b, 0x0, 0x0, 0x57, 0x0, 0x0,
-    0xc0, 0x0, 0x5, 0x70, 0x0, 0xc, 0x0, 0x0,
-    0x57, 0x0, 0x3, 0xc0, 0x0, 0x5, 0xdb, 0xbb,
-    0xa1, 0x0,
-
-    /* U+044B "ы" */
-    0x48, 0x0, 0x0, 0x0, 0x48, 0x48, 0x0, 0x0,
-    0x0, 0x48, 0x48, 0x0, 0x0, 0x0, 0x48, 0x4d,
-    0xaa, 0xa9, 0x10, 0x48, 0x48, 0x0, 0x3, 0xc0,
-    0x48, 0x48, 0x0, 0x0, 0xa2, 0x48, 0x48, 0x0,
-    0x0, 0xa2, 0x48, 0x48, 0x0, 0x2, 0xc0, 0x48,
-    0x4d, 0xbb, 0xbb, 0x20, 0x48,
-
-    /* U+044C "ь" */
-    0x48, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0,
-    0x48, 0x0, 0x0, 0x0, 0x4d, 0xaa, 0xa9, 0x10,
-    0x48, 0x0, 0x3, 0xc0, 0x48, 0x0, 0x0, 0xa3,
-    0x48, 0x0, 0x0, 0x93, 0x48, 0x0, 0x2, 0xd0,
-    0x4d, 0xbb, 0xbb, 0x20,
-
-    /* U+044D "э" */
-    0x6, 0xbb, 0xba, 0x20, 0x2, 0x70, 0x0, 0x2c,
-    0x30, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0,
-    0x0, 0xa2, 0x0, 0x2a, 0xaa, 0xad, 0x30, 0x0,
-    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x1c, 0x2,
-    0x60, 0x0, 0x2c, 0x30, 0x6, 0xcb, 0xba, 0x20,
-    0x0,
-
-    /* U+044E "ю" */
-    0x48, 0x0, 0x5, 0xcc, 0xc9, 0x0, 0x48, 0x0,
-    0x5a, 0x10, 0x5, 0xc0, 0x48, 0x0, 0xc0, 0x0,
-    0x0, 0x76, 0x48, 0x4, 0x80, 0x0, 0x0, 0x1b,
-    0x4e, 0xce, 0x70, 0x0, 0x0, 0xc, 0x48, 0x4,
-    0x80, 0x0, 0x0, 0x1b, 0x48, 0x0, 0xc0, 0x0,
-    0x0, 0x76, 0x48, 0x0, 0x6a, 0x0, 0x4, 0xc0,
-    0x48, 0x0, 0x5, 0xcc, 0xc9, 0x10,
-
-    /* U+044F "я" */
-    0x8, 0xcc, 0xcc, 0xd9, 0x60, 0x0, 0xb, 0xd0,
-    0x0, 0x0, 0xbc, 0x0, 0x0, 0xb, 0x87, 0x0,
-    0x0, 0xb0, 0x6e, 0xaa, 0xad, 0x5, 0x80, 0x0,
-    0xb1, 0xc0, 0x0, 0xb, 0xa3, 0x0, 0x0, 0xb0,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x26, 0x0, 0x0, 0x0, 0x0, 0x69, 0x0,
-    0x0, 0x0, 0x0, 0x34, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xcc, 0xa1, 0x0, 0x3c,
-    0x20, 0x4, 0xc0, 0xb, 0x20, 0x0, 0x6, 0x70,
-    0xb0, 0x0, 0x0, 0xb, 0x1e, 0xaa, 0xaa, 0xaa,
-    0xa0, 0xc0, 0x0, 0x0, 0x0, 0xb, 0x20, 0x0,
-    0x0, 0x0, 0x2c, 0x30, 0x0, 0x92, 0x0, 0x2a,
-    0xcc, 0xc5, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0xe, 0x3, 0xb0, 0x0, 0x0, 0x20, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbc,
-    0xca, 0x10, 0x3, 0xc2, 0x0, 0x4c, 0x0, 0xb2,
-    0x0, 0x0, 0x67, 0xb, 0x0, 0x0, 0x0, 0xb1,
-    0xea, 0xaa, 0xaa, 0xaa, 0xc, 0x0, 0x0, 0x0,
-    0x0, 0xb2, 0x0, 0x0, 0x0, 0x2, 0xc3, 0x0,
-    0x9, 0x20, 0x2, 0xac, 0xcc, 0x50,
-
-    /* U+0452 "ђ" */
-    0x0, 0x48, 0x0, 0x0, 0x0, 0x0, 0xab, 0xda,
-    0xaa, 0x60, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x80, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0x4b, 0xcd, 0x90, 0x0, 0x4, 0xb9, 0x0, 0x6,
-    0xa0, 0x0, 0x4d, 0x0, 0x0, 0xc, 0x10, 0x4,
-    0x90, 0x0, 0x0, 0x93, 0x0, 0x48, 0x0, 0x0,
-    0x9, 0x30, 0x4, 0x80, 0x0, 0x0, 0x93, 0x0,
-    0x48, 0x0, 0x0, 0x9, 0x30, 0x4, 0x80, 0x0,
-    0x0, 0x93, 0x0, 0x48, 0x0, 0x0, 0x9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x10, 0x0, 0x0, 0x7, 0xbc, 0x60,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x26, 0x0, 0x0, 0x3a, 0x10, 0x0,
-    0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xcc,
-    0xcc, 0x54, 0x80, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0x4, 0x80, 0x0, 0x0, 0x48, 0x0, 0x0, 0x4,
-    0x80, 0x0, 0x0, 0x48, 0x0, 0x0, 0x4, 0x80,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x2a, 0xcb, 0xb7, 0x0, 0x2c, 0x30, 0x0,
-    0x53, 0xb, 0x20, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x0, 0x0, 0x2e, 0xaa, 0xaa, 0x30, 0x0, 0xb0,
-    0x0, 0x0, 0x0, 0xb, 0x20, 0x0, 0x0, 0x0,
-    0x2c, 0x20, 0x0, 0x54, 0x0, 0x2a, 0xbb, 0xb7,
-    0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x9c, 0xcc, 0x70, 0xa, 0x50, 0x0, 0x50,
-    0xc, 0x0, 0x0, 0x0, 0x9, 0x80, 0x0, 0x0,
-    0x0, 0x7b, 0xc9, 0x30, 0x0, 0x0, 0x3, 0xc3,
-    0x0, 0x0, 0x0, 0x57, 0x8, 0x10, 0x0, 0xa4,
-    0x5, 0xbc, 0xcc, 0x60,
-
-    /* U+0456 "і" */
-    0x0, 0x7b, 0x12, 0x0, 0x48, 0x48, 0x48, 0x48,
-    0x48, 0x48, 0x48, 0x48, 0x48,
-
-    /* U+0457 "ї" */
-    0x58, 0x58, 0x1, 0x1, 0x0, 0x0, 0x4, 0x80,
-    0x4, 0x80, 0x4, 0x80, 0x4, 0x80, 0x4, 0x80,
-    0x4, 0x80, 0x4, 0x80, 0x4, 0x80, 0x4, 0x80,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0,
-    0x4, 0x80, 0x0, 0x48, 0x0, 0x4, 0x80, 0x0,
-    0x48, 0x0, 0x4, 0x80, 0x0, 0x48, 0x0, 0x4,
-    0x80, 0x0, 0x48, 0x0, 0x4, 0x80, 0x0, 0x76,
-    0x3c, 0xca, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x9c, 0xcc, 0xce, 0x40, 0x0, 0x0, 0x0,
-    0xa1, 0x0, 0x9, 0x40, 0x0, 0x0, 0x0, 0xb0,
-    0x0, 0x9, 0x40, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x9, 0xba, 0xaa, 0x70, 0x0, 0xb0, 0x0, 0x9,
-    0x40, 0x0, 0x59, 0x0, 0xb0, 0x0, 0x9, 0x40,
-    0x0, 0xd, 0x1, 0xa0, 0x0, 0x9, 0x40, 0x0,
-    0xd, 0x7, 0x60, 0x0, 0x9, 0x40, 0x0, 0x6a,
-    0xab, 0x0, 0x0, 0x9, 0xdc, 0xcc, 0x91,
-
-    /* U+045A "њ" */
-    0x48, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x48,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x48, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x0, 0x4e, 0xcc, 0xcc, 0xcf,
-    0xcc, 0xcc, 0x60, 0x48, 0x0, 0x0, 0xc, 0x0,
-    0x1, 0xb4, 0x48, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x57, 0x48, 0x0, 0x0, 0xc, 0x0, 0x0, 0xa4,
-    0x48, 0x0, 0x0, 0xe, 0xaa, 0xab, 0x60,
-
-    /* U+045B "ћ" */
-    0x0, 0x24, 0x0, 0x0, 0x0, 0x0, 0x4, 0x80,
-    0x0, 0x0, 0x0, 0x49, 0xac, 0x99, 0x96, 0x0,
-    0x0, 0x4, 0x80, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0x4b, 0xcd, 0x90, 0x0, 0x4, 0xb9, 0x0, 0x6,
-    0xa0, 0x0, 0x4d, 0x0, 0x0, 0xc, 0x10, 0x4,
-    0x90, 0x0, 0x0, 0x93, 0x0, 0x48, 0x0, 0x0,
-    0x9, 0x30, 0x4, 0x80, 0x0, 0x0, 0x93, 0x0,
-    0x48, 0x0, 0x0, 0x9, 0x30, 0x4, 0x80, 0x0,
-    0x0, 0x93, 0x0, 0x48, 0x0, 0x0, 0x9, 0x30,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x26, 0x0, 0x0, 0x3, 0xb1, 0x0,
-    0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0x0, 0x0, 0xa3, 0x48, 0x0, 0x6, 0x70,
-    0x48, 0x0, 0x3a, 0x0, 0x48, 0x1, 0xb0, 0x0,
-    0x4e, 0xbd, 0x60, 0x0, 0x48, 0x1, 0xc2, 0x0,
-    0x48, 0x0, 0x2c, 0x0, 0x48, 0x0, 0x5, 0xa0,
-    0x48, 0x0, 0x0, 0x87,
-
-    /* U+045D "ѝ" */
-    0x0, 0x53, 0x0, 0x0, 0x0, 0x1, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0xd, 0x34, 0x80,
-    0x0, 0xa, 0xd3, 0x48, 0x0, 0x7, 0x79, 0x34,
-    0x80, 0x3, 0xa0, 0x93, 0x48, 0x1, 0xc1, 0x9,
-    0x34, 0x80, 0xb3, 0x0, 0x93, 0x48, 0x86, 0x0,
-    0x9, 0x34, 0xd9, 0x0, 0x0, 0x93, 0x4c, 0x0,
-    0x0, 0x9, 0x30,
-
-    /* U+045E "ў" */
-    0x0, 0x18, 0x0, 0x45, 0x0, 0x0, 0xa, 0x0,
-    0xa1, 0x0, 0x0, 0x2, 0x99, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0x30, 0x0, 0x0,
-    0x75, 0x3, 0xa0, 0x0, 0x0, 0xc0, 0x0, 0xc1,
-    0x0, 0x5, 0x70, 0x0, 0x57, 0x0, 0xb, 0x0,
-    0x0, 0xc, 0x0, 0x39, 0x0, 0x0, 0x7, 0x50,
-    0xa2, 0x0, 0x0, 0x1, 0xb1, 0xb0, 0x0, 0x0,
-    0x0, 0xab, 0x40, 0x0, 0x0, 0x0, 0x4d, 0x0,
-    0x0, 0x0, 0x0, 0x66, 0x0, 0x0, 0x2, 0x1,
-    0xc0, 0x0, 0x0, 0x1b, 0xcc, 0x30, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x48, 0x0, 0x0, 0x67, 0x48, 0x0, 0x0, 0x67,
-    0x48, 0x0, 0x0, 0x67, 0x48, 0x0, 0x0, 0x67,
-    0x48, 0x0, 0x0, 0x67, 0x48, 0x0, 0x0, 0x67,
-    0x48, 0x0, 0x0, 0x67, 0x48, 0x0, 0x0, 0x67,
-    0x4e, 0xcc, 0xcc, 0xd7, 0x0, 0x4, 0x70, 0x0,
-    0x0, 0x4, 0x70, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0xc, 0x0,
-    0x0, 0x0, 0xcf, 0xcc, 0xcc, 0xcb, 0xd0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0xc, 0x0, 0x0, 0xc, 0x4e, 0xcc,
-    0xcb, 0x48, 0x0, 0x0, 0x48, 0x0, 0x0, 0x48,
-    0x0, 0x0, 0x48, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0x48, 0x0, 0x0, 0x48, 0x0, 0x0, 0x48, 0x0,
-    0x0,
-
-    /* U+2013 "–" */
-    0xaa, 0xaa, 0xaa, 0xaa,
-
-    /* U+2014 "—" */
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-
-    /* U+2018 "‘" */
-    0x6, 0x20, 0x90, 0xb, 0x0, 0xf2, 0x3, 0x0,
-
-    /* U+2019 "’" */
-    0xe, 0x20, 0xb2, 0xa, 0x0, 0x80,
-
-    /* U+201A "‚" */
-    0x5, 0x0, 0xe3, 0xa, 0x0, 0xa0, 0x4, 0x0,
-
-    /* U+201C "“" */
-    0x6, 0x20, 0x90, 0x90, 0x36, 0xb, 0x7, 0x40,
-    0xf2, 0x9a, 0x3, 0x1, 0x20,
-
-    /* U+201D "”" */
-    0xe, 0x28, 0x90, 0xb2, 0x49, 0xa, 0x5, 0x50,
-    0x80, 0x71,
-
-    /* U+2026 "…" */
-    0x5, 0x0, 0x42, 0x2, 0x40, 0xe2, 0xa, 0x60,
-    0x6b,
-
-    /* U+20B4 "₴" */
-    0x0, 0x3a, 0xcc, 0xca, 0x20, 0x0, 0x6, 0x10,
-    0x0, 0x3d, 0x10, 0x0, 0x0, 0x0, 0x0, 0x75,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0x50, 0x29, 0x99,
-    0x99, 0x99, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9c,
-    0x99, 0x99, 0x99, 0x94, 0x4, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x57, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xd3, 0x0, 0x1, 0x77, 0x0, 0x2, 0xac, 0xcc,
-    0xb5, 0x0,
-
-    /* U+2116 "№" */
-    0x20, 0x0, 0x0, 0x0, 0x20, 0x0, 0x14, 0x10,
-    0xf3, 0x0, 0x0, 0x0, 0xd0, 0x5, 0x84, 0x85,
-    0xed, 0x10, 0x0, 0x0, 0xd0, 0xa, 0x0, 0xa,
-    0xd4, 0xb0, 0x0, 0x0, 0xd0, 0x9, 0x0, 0x9,
-    0xd0, 0x78, 0x0, 0x0, 0xd0, 0x9, 0x10, 0x19,
-    0xd0, 0xb, 0x50, 0x0, 0xd0, 0x1, 0x88, 0x81,
-    0xd0, 0x1, 0xc2, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x3c, 0x0, 0xd0, 0x6, 0x99, 0x96,
-    0xd0, 0x0, 0x6, 0xa0, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x96, 0xd0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 66, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 65, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12, .adv_w = 91, .box_w = 4, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 22, .adv_w = 177, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 88, .adv_w = 156, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 160, .adv_w = 209, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 238, .adv_w = 168, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 310, .adv_w = 50, .box_w = 1, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 313, .adv_w = 82, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 345, .adv_w = 82, .box_w = 4, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 377, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 398, .adv_w = 146, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 426, .adv_w = 51, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 434, .adv_w = 98, .box_w = 6, .box_h = 1, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 437, .adv_w = 51, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 440, .adv_w = 82, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 496, .adv_w = 168, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 556, .adv_w = 90, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 580, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 634, .adv_w = 143, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 688, .adv_w = 167, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 754, .adv_w = 143, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 808, .adv_w = 154, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 868, .adv_w = 149, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 922, .adv_w = 162, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 982, .adv_w = 154, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1036, .adv_w = 51, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1050, .adv_w = 51, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1068, .adv_w = 146, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1096, .adv_w = 146, .box_w = 7, .box_h = 5, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 1114, .adv_w = 146, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1142, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1190, .adv_w = 264, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1310, .adv_w = 180, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1382, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1448, .adv_w = 181, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1514, .adv_w = 211, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1586, .adv_w = 171, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1640, .adv_w = 162, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1694, .adv_w = 198, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1760, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1826, .adv_w = 76, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1838, .adv_w = 126, .box_w = 7, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1880, .adv_w = 180, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1946, .adv_w = 150, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2000, .adv_w = 245, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2078, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2144, .adv_w = 215, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2222, .adv_w = 183, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2282, .adv_w = 215, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2380, .adv_w = 184, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2440, .adv_w = 156, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2494, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2548, .adv_w = 203, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2608, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2674, .adv_w = 281, .box_w = 17, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2776, .adv_w = 164, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2836, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2896, .adv_w = 165, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2956, .adv_w = 78, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 2988, .adv_w = 82, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 3044, .adv_w = 78, .box_w = 3, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3068, .adv_w = 146, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 3093, .adv_w = 128, .box_w = 8, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3097, .adv_w = 154, .box_w = 4, .box_h = 2, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 3101, .adv_w = 149, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3137, .adv_w = 173, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3202, .adv_w = 142, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3243, .adv_w = 173, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3308, .adv_w = 153, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3349, .adv_w = 84, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3388, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3448, .adv_w = 172, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3507, .adv_w = 67, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3520, .adv_w = 68, .box_w = 5, .box_h = 16, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 3560, .adv_w = 149, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3619, .adv_w = 67, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3632, .adv_w = 272, .box_w = 15, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3700, .adv_w = 172, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3741, .adv_w = 159, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3786, .adv_w = 173, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3846, .adv_w = 173, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3906, .adv_w = 101, .box_w = 5, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3929, .adv_w = 122, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3965, .adv_w = 102, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3998, .adv_w = 171, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4039, .adv_w = 135, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4080, .adv_w = 221, .box_w = 14, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4143, .adv_w = 133, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4179, .adv_w = 135, .box_w = 10, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 4239, .adv_w = 129, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4275, .adv_w = 82, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4315, .adv_w = 74, .box_w = 2, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 4331, .adv_w = 82, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4371, .adv_w = 146, .box_w = 8, .box_h = 3, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 4383, .adv_w = 116, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 4408, .adv_w = 116, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 4433, .adv_w = 167, .box_w = 8, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4493, .adv_w = 167, .box_w = 8, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4557, .adv_w = 210, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4642, .adv_w = 145, .box_w = 7, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4695, .adv_w = 181, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4755, .adv_w = 159, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4815, .adv_w = 78, .box_w = 1, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4821, .adv_w = 76, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4861, .adv_w = 132, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4903, .adv_w = 304, .box_w = 19, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5017, .adv_w = 304, .box_w = 17, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5119, .adv_w = 211, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5197, .adv_w = 178, .box_w = 9, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5265, .adv_w = 211, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5340, .adv_w = 172, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5423, .adv_w = 206, .box_w = 9, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 5491, .adv_w = 188, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5563, .adv_w = 185, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5617, .adv_w = 192, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5671, .adv_w = 145, .box_w = 7, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5713, .adv_w = 201, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5803, .adv_w = 167, .box_w = 8, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5851, .adv_w = 255, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5947, .adv_w = 157, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6001, .adv_w = 211, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6061, .adv_w = 211, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6136, .adv_w = 178, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6190, .adv_w = 200, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6256, .adv_w = 247, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6328, .adv_w = 210, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6388, .adv_w = 218, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6466, .adv_w = 212, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6526, .adv_w = 181, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6580, .adv_w = 183, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6640, .adv_w = 147, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6700, .adv_w = 172, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6766, .adv_w = 233, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6850, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6910, .adv_w = 211, .box_w = 11, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 6993, .adv_w = 183, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7053, .adv_w = 280, .box_w = 14, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7137, .adv_w = 285, .box_w = 16, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 7257, .adv_w = 208, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7335, .adv_w = 247, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7407, .adv_w = 181, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7461, .adv_w = 180, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7527, .adv_w = 278, .box_w = 15, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7617, .adv_w = 187, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7671, .adv_w = 148, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7707, .adv_w = 168, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7770, .adv_w = 154, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7806, .adv_w = 119, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7838, .adv_w = 164, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7893, .adv_w = 156, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7934, .adv_w = 207, .box_w = 13, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7993, .adv_w = 135, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8029, .adv_w = 175, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8070, .adv_w = 175, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8129, .adv_w = 145, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8165, .adv_w = 160, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8206, .adv_w = 201, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8251, .adv_w = 172, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8287, .adv_w = 162, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8332, .adv_w = 172, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8373, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 8433, .adv_w = 143, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8474, .adv_w = 117, .box_w = 9, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8515, .adv_w = 140, .box_w = 10, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 8575, .adv_w = 197, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 8671, .adv_w = 131, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8707, .adv_w = 174, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 8762, .adv_w = 151, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8798, .adv_w = 235, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8852, .adv_w = 235, .box_w = 14, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 8929, .adv_w = 155, .box_w = 11, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8979, .adv_w = 196, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9024, .adv_w = 142, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9060, .adv_w = 145, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9101, .adv_w = 219, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9155, .adv_w = 154, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9187, .adv_w = 159, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9246, .adv_w = 156, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9300, .adv_w = 171, .box_w = 11, .box_h = 16, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 9388, .adv_w = 119, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9434, .adv_w = 145, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9475, .adv_w = 133, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9511, .adv_w = 68, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9524, .adv_w = 67, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9548, .adv_w = 68, .box_w = 5, .box_h = 17, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 9591, .adv_w = 233, .box_w = 14, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9654, .adv_w = 240, .box_w = 14, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9717, .adv_w = 171, .box_w = 11, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 9789, .adv_w = 145, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9841, .adv_w = 175, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9900, .adv_w = 140, .box_w = 10, .box_h = 16, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 9980, .adv_w = 162, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 10024, .adv_w = 146, .box_w = 7, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10077, .adv_w = 111, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10110, .adv_w = 128, .box_w = 8, .box_h = 1, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 10114, .adv_w = 256, .box_w = 16, .box_h = 1, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 10122, .adv_w = 51, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 10130, .adv_w = 51, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 10136, .adv_w = 51, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 10144, .adv_w = 90, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 10157, .adv_w = 90, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 10167, .adv_w = 156, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10176, .adv_w = 211, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10242, .adv_w = 306, .box_w = 16, .box_h = 12, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_16;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_16 = {
-#else
-lv_font_t montserrat_cyrillic_16 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 19,          /*The maximum line height required by the font*/
-    .base_line = 3,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_16,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_16*/
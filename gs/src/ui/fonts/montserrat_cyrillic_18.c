@@ -1,2420 +0,0 @@
-/*******************************************************************************
- * Size: 18 px
- * Bpp: 4
- * Opts: --bpp 4 --size 18 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_18.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_18
-#define MONTSERRAT_CYRILLIC_18 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_18
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x3c, 0x3, 0xc0, 0x3b, 0x2, 0xb0, 0x2b, 0x2,
-    0xa0, 0x2a, 0x1, 0xa0, 0x19, 0x0, 0x10, 0x0,
-    0x2, 0x70, 0x5e, 0x0,
-
-    /* U+0022 "\"" */
-    0xa2, 0xb, 0x1a, 0x20, 0xb0, 0xa2, 0xb, 0x9,
-    0x10, 0xb0, 0x81, 0xa, 0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0xb0, 0x0, 0x1a, 0x0, 0x0, 0x0,
-    0xb0, 0x0, 0x38, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x56, 0x0, 0xa, 0xcd, 0xec, 0xcc, 0xed, 0xca,
-    0x0, 0x4, 0x70, 0x0, 0x92, 0x0, 0x0, 0x6,
-    0x50, 0x0, 0xa0, 0x0, 0x0, 0x7, 0x30, 0x0,
-    0xb0, 0x0, 0x0, 0x9, 0x10, 0x0, 0xb0, 0x0,
-    0x5c, 0xcf, 0xcc, 0xcc, 0xfc, 0xc3, 0x0, 0xb,
-    0x0, 0x2, 0x80, 0x0, 0x0, 0xb, 0x0, 0x4,
-    0x70, 0x0, 0x0, 0x1a, 0x0, 0x6, 0x50, 0x0,
-    0x0, 0x38, 0x0, 0x8, 0x30, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0,
-    0x0, 0x2, 0xad, 0xfd, 0xc6, 0x0, 0x2, 0xd5,
-    0xa, 0x2, 0x85, 0x0, 0x96, 0x0, 0xa0, 0x0,
-    0x0, 0xb, 0x30, 0xa, 0x0, 0x0, 0x0, 0x87,
-    0x0, 0xa0, 0x0, 0x0, 0x1, 0xc9, 0x3a, 0x0,
-    0x0, 0x0, 0x0, 0x5a, 0xfa, 0x60, 0x0, 0x0,
-    0x0, 0xa, 0x38, 0xd3, 0x0, 0x0, 0x0, 0xa0,
-    0x3, 0xd0, 0x0, 0x0, 0xa, 0x0, 0xe, 0x0,
-    0x20, 0x0, 0xa0, 0x1, 0xe0, 0xb, 0x92, 0xa,
-    0x3, 0xc6, 0x0, 0x5, 0xbd, 0xfd, 0xb4, 0x0,
-    0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x1, 0xa9, 0xa3, 0x0, 0x0, 0x1a, 0x0, 0xa,
-    0x10, 0xb, 0x0, 0x0, 0xa1, 0x0, 0x19, 0x0,
-    0x6, 0x40, 0x6, 0x60, 0x0, 0x28, 0x0, 0x5,
-    0x50, 0x1a, 0x0, 0x0, 0x1a, 0x0, 0x7, 0x30,
-    0xa1, 0x0, 0x0, 0xa, 0x30, 0x1b, 0x6, 0x60,
-    0x0, 0x0, 0x0, 0x8a, 0x91, 0x1a, 0x4, 0xaa,
-    0x60, 0x0, 0x0, 0x0, 0xa2, 0x2a, 0x0, 0x75,
-    0x0, 0x0, 0x5, 0x60, 0x82, 0x0, 0xa, 0x0,
-    0x0, 0x1a, 0x0, 0xa0, 0x0, 0xa, 0x0, 0x0,
-    0xa2, 0x0, 0x91, 0x0, 0xa, 0x0, 0x5, 0x60,
-    0x0, 0x37, 0x0, 0x47, 0x0, 0x1a, 0x0, 0x0,
-    0x6, 0x99, 0x80,
-
-    /* U+0026 "&" */
-    0x0, 0x5, 0xcc, 0xc5, 0x0, 0x0, 0x0, 0x2c,
-    0x0, 0xc, 0x20, 0x0, 0x0, 0x67, 0x0, 0x8,
-    0x40, 0x0, 0x0, 0x58, 0x0, 0xb, 0x10, 0x0,
-    0x0, 0xd, 0x21, 0xb5, 0x0, 0x0, 0x0, 0x3,
-    0xeb, 0x30, 0x0, 0x0, 0x0, 0x2b, 0x9c, 0x0,
-    0x0, 0x0, 0x2, 0xc2, 0x6, 0xa0, 0x0, 0x70,
-    0xc, 0x20, 0x0, 0x89, 0x4, 0x80, 0xd, 0x0,
-    0x0, 0x9, 0x7a, 0x30, 0xe, 0x0, 0x0, 0x0,
-    0xcc, 0x0, 0x7, 0xb1, 0x0, 0x6, 0xcc, 0x40,
-    0x0, 0x5c, 0xcc, 0xc7, 0x1, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x22,
-
-    /* U+0027 "'" */
-    0xa2, 0xa2, 0xa2, 0x91, 0x81,
-
-    /* U+0028 "(" */
-    0x3, 0xa0, 0xa3, 0xd, 0x5, 0x80, 0x85, 0xb,
-    0x20, 0xd0, 0xd, 0x0, 0xe0, 0xe, 0x0, 0xe0,
-    0xd, 0x0, 0xb2, 0x8, 0x50, 0x58, 0x0, 0xd0,
-    0xa, 0x30, 0x3a,
-
-    /* U+0029 ")" */
-    0xc, 0x0, 0x7, 0x70, 0x1, 0xc0, 0x0, 0xc1,
-    0x0, 0x85, 0x0, 0x68, 0x0, 0x4a, 0x0, 0x2b,
-    0x0, 0x2c, 0x0, 0x2c, 0x0, 0x2b, 0x0, 0x4a,
-    0x0, 0x68, 0x0, 0x85, 0x0, 0xc1, 0x1, 0xc0,
-    0x7, 0x60, 0xc, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0xa, 0x0, 0x3, 0x20, 0x90, 0x51, 0x19,
-    0x8b, 0xa7, 0x0, 0xa, 0xf7, 0x0, 0x3b, 0x49,
-    0x6b, 0x11, 0x0, 0x90, 0x10, 0x0, 0x7, 0x0,
-    0x0,
-
-    /* U+002B "+" */
-    0x0, 0x2, 0x50, 0x0, 0x0, 0x4, 0x80, 0x0,
-    0x0, 0x4, 0x80, 0x0, 0x0, 0x4, 0x80, 0x0,
-    0x9d, 0xde, 0xed, 0xdc, 0x0, 0x4, 0x80, 0x0,
-    0x0, 0x4, 0x80, 0x0, 0x0, 0x4, 0x80, 0x0,
-    0x0, 0x1, 0x30, 0x0,
-
-    /* U+002C "," */
-    0x73, 0xd8, 0x74, 0xa0, 0x50,
-
-    /* U+002D "-" */
-    0xcd, 0xdd, 0xa0,
-
-    /* U+002E "." */
-    0x73, 0xc6,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0xa3, 0x0, 0x0, 0x0, 0xc0,
-    0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0xa, 0x30,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x48, 0x0,
-    0x0, 0x0, 0x93, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x4, 0x80, 0x0, 0x0, 0x9, 0x30, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0x0, 0x93, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
-    0x4, 0x90, 0x0, 0x0, 0x9, 0x30, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x0, 0x39, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x4, 0xce, 0xeb, 0x30, 0x0, 0x6, 0xc3,
-    0x0, 0x4d, 0x40, 0x2, 0xd1, 0x0, 0x0, 0x2d,
-    0x0, 0x86, 0x0, 0x0, 0x0, 0x96, 0xd, 0x10,
-    0x0, 0x0, 0x4, 0xa0, 0xe0, 0x0, 0x0, 0x0,
-    0x1c, 0xe, 0x0, 0x0, 0x0, 0x1, 0xd0, 0xe0,
-    0x0, 0x0, 0x0, 0x1c, 0xd, 0x10, 0x0, 0x0,
-    0x4, 0xa0, 0x86, 0x0, 0x0, 0x0, 0x96, 0x2,
-    0xd1, 0x0, 0x0, 0x2d, 0x0, 0x6, 0xc3, 0x0,
-    0x4d, 0x40, 0x0, 0x4, 0xce, 0xeb, 0x30, 0x0,
-
-    /* U+0031 "1" */
-    0xbe, 0xef, 0x20, 0x0, 0xc2, 0x0, 0xc, 0x20,
-    0x0, 0xc2, 0x0, 0xc, 0x20, 0x0, 0xc2, 0x0,
-    0xc, 0x20, 0x0, 0xc2, 0x0, 0xc, 0x20, 0x0,
-    0xc2, 0x0, 0xc, 0x20, 0x0, 0xc2, 0x0, 0xc,
-    0x20,
-
-    /* U+0032 "2" */
-    0x2, 0xad, 0xee, 0xb3, 0x0, 0x4d, 0x50, 0x0,
-    0x4e, 0x30, 0x11, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0x88, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x0,
-    0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x7, 0xa0,
-    0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x7,
-    0xb0, 0x0, 0x0, 0x0, 0x3f, 0xee, 0xee, 0xee,
-    0xe5,
-
-    /* U+0033 "3" */
-    0x4e, 0xee, 0xee, 0xef, 0x90, 0x0, 0x0, 0x0,
-    0x3c, 0x10, 0x0, 0x0, 0x1, 0xd2, 0x0, 0x0,
-    0x0, 0xc, 0x30, 0x0, 0x0, 0x0, 0xb5, 0x0,
-    0x0, 0x0, 0x4, 0xed, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0x40, 0x0, 0x0, 0x0, 0x3, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xe0, 0x30, 0x0, 0x0, 0x3, 0xd0, 0x6d,
-    0x50, 0x0, 0x4d, 0x40, 0x3, 0xae, 0xee, 0xb4,
-    0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x7, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0x20, 0x0, 0xc0, 0x0, 0x0, 0xb4, 0x0, 0x0,
-    0xd0, 0x0, 0x9, 0x60, 0x0, 0x0, 0xd0, 0x0,
-    0x2e, 0xdd, 0xdd, 0xdd, 0xfd, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
-
-    /* U+0035 "5" */
-    0x1, 0xfe, 0xee, 0xee, 0x90, 0x3, 0xb0, 0x0,
-    0x0, 0x0, 0x4, 0x90, 0x0, 0x0, 0x0, 0x6,
-    0x70, 0x0, 0x0, 0x0, 0x8, 0x50, 0x0, 0x0,
-    0x0, 0x9, 0xee, 0xed, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0x70, 0x0, 0x0, 0x0, 0x1, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0xa4, 0x21, 0x0, 0x0, 0x0, 0xe1, 0x3d,
-    0x61, 0x0, 0x2b, 0x70, 0x1, 0x8d, 0xee, 0xc5,
-    0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x2, 0xad, 0xdd, 0xb2, 0x0, 0x4, 0xd4,
-    0x0, 0x2, 0x10, 0x1, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x86, 0x0, 0x0, 0x0, 0x0, 0xc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xe0, 0x3a, 0xdd, 0xb4,
-    0x0, 0xe, 0x4b, 0x20, 0x3, 0xd6, 0x0, 0xfb,
-    0x0, 0x0, 0x1, 0xe0, 0xd, 0x70, 0x0, 0x0,
-    0xb, 0x30, 0x97, 0x0, 0x0, 0x0, 0xb3, 0x3,
-    0xc0, 0x0, 0x0, 0x1e, 0x0, 0x8, 0xa1, 0x0,
-    0x2c, 0x60, 0x0, 0x5, 0xcd, 0xdc, 0x50, 0x0,
-
-    /* U+0037 "7" */
-    0x6f, 0xee, 0xee, 0xee, 0xf9, 0x68, 0x0, 0x0,
-    0x0, 0xb4, 0x68, 0x0, 0x0, 0x2, 0xd0, 0x22,
-    0x0, 0x0, 0x9, 0x60, 0x0, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0xd1, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x0, 0xc, 0x30, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x0, 0xa5, 0x0, 0x0, 0x0,
-    0x2, 0xd0, 0x0, 0x0, 0x0, 0x8, 0x70, 0x0,
-    0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x19, 0xdd, 0xdb, 0x40, 0x0, 0x1d, 0x60,
-    0x0, 0x3d, 0x50, 0x7, 0x80, 0x0, 0x0, 0x2d,
-    0x0, 0x94, 0x0, 0x0, 0x0, 0xe0, 0x7, 0x70,
-    0x0, 0x0, 0x1d, 0x0, 0x1d, 0x50, 0x0, 0x2c,
-    0x50, 0x0, 0x3e, 0xed, 0xdf, 0x80, 0x0, 0x5c,
-    0x30, 0x0, 0x19, 0xa0, 0xe, 0x10, 0x0, 0x0,
-    0xb, 0x40, 0xd0, 0x0, 0x0, 0x0, 0x76, 0xe,
-    0x10, 0x0, 0x0, 0xb, 0x40, 0x6c, 0x30, 0x0,
-    0x19, 0xb0, 0x0, 0x4b, 0xdd, 0xdc, 0x70, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x6d, 0xdd, 0xb4, 0x0, 0x9, 0xa1, 0x0,
-    0x2c, 0x50, 0x2d, 0x0, 0x0, 0x1, 0xe1, 0x58,
-    0x0, 0x0, 0x0, 0xa7, 0x59, 0x0, 0x0, 0x0,
-    0xaa, 0x2d, 0x0, 0x0, 0x1, 0xcc, 0x8, 0xb2,
-    0x0, 0x3c, 0x3d, 0x0, 0x5b, 0xdc, 0x92, 0x1c,
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0x0, 0x0, 0x0,
-    0x0, 0x95, 0x0, 0x0, 0x0, 0x2, 0xd0, 0x2,
-    0x10, 0x0, 0x5d, 0x30, 0x4, 0xcd, 0xdd, 0x91,
-    0x0,
-
-    /* U+003A ":" */
-    0xc6, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x73, 0xc6,
-
-    /* U+003B ";" */
-    0xc6, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x73, 0xd8, 0x74, 0xa0, 0x50,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x5, 0xca,
-    0x0, 0x17, 0xc8, 0x10, 0x2a, 0xc5, 0x0, 0x0,
-    0xab, 0x10, 0x0, 0x0, 0x5, 0xba, 0x30, 0x0,
-    0x0, 0x2, 0x9c, 0x60, 0x0, 0x0, 0x1, 0x7c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x8c, 0xcc, 0xcc, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8c, 0xcc, 0xcc, 0xcc,
-
-    /* U+003E ">" */
-    0x20, 0x0, 0x0, 0x0, 0x7c, 0x71, 0x0, 0x0,
-    0x0, 0x6c, 0x92, 0x0, 0x0, 0x0, 0x4a, 0xb4,
-    0x0, 0x0, 0x0, 0x8e, 0x0, 0x2, 0x8c, 0x60,
-    0x4, 0xbb, 0x40, 0x0, 0x99, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x3, 0xad, 0xde, 0xb3, 0x5, 0xc3, 0x0, 0x4,
-    0xe2, 0x10, 0x0, 0x0, 0x7, 0x90, 0x0, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0x9, 0x60, 0x0,
-    0x0, 0x5, 0xb0, 0x0, 0x0, 0x6, 0xb0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x96, 0x0,
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0x20, 0x0, 0x0, 0x0,
-    0xc6, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x3, 0x9b, 0xbb, 0xbb, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x9a, 0x30, 0x0, 0x0, 0x4b,
-    0x60, 0x0, 0x0, 0xb, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x88, 0x0, 0x0, 0x95, 0x0, 0x2a, 0xcb,
-    0xb4, 0x1c, 0x9, 0x40, 0x2, 0xa0, 0x3, 0xc2,
-    0x0, 0x8, 0x6c, 0x0, 0xb0, 0x9, 0x30, 0xc,
-    0x20, 0x0, 0x0, 0xac, 0x0, 0x83, 0xc, 0x0,
-    0x2a, 0x0, 0x0, 0x0, 0x4c, 0x0, 0x47, 0xc,
-    0x0, 0x57, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x29,
-    0xb, 0x0, 0x58, 0x0, 0x0, 0x0, 0x1c, 0x0,
-    0x19, 0xc, 0x0, 0x2b, 0x0, 0x0, 0x0, 0x4c,
-    0x0, 0x28, 0xc, 0x0, 0xc, 0x20, 0x0, 0x0,
-    0xac, 0x0, 0x65, 0x8, 0x30, 0x3, 0xd3, 0x0,
-    0x19, 0x5d, 0x0, 0xb0, 0x2, 0xa0, 0x0, 0x2a,
-    0xcc, 0xb4, 0x7, 0xdc, 0x30, 0x0, 0x95, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9a, 0x30, 0x0, 0x1, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x9b, 0xbb, 0xca, 0x40, 0x0,
-    0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc9, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3a,
-    0xd, 0x0, 0x0, 0x0, 0x0, 0xa, 0x30, 0x95,
-    0x0, 0x0, 0x0, 0x2, 0xc0, 0x2, 0xc0, 0x0,
-    0x0, 0x0, 0x85, 0x0, 0xb, 0x40, 0x0, 0x0,
-    0xd, 0x0, 0x0, 0x3b, 0x0, 0x0, 0x7, 0x70,
-    0x0, 0x0, 0xc2, 0x0, 0x0, 0xed, 0xdd, 0xdd,
-    0xde, 0x90, 0x0, 0x59, 0x0, 0x0, 0x0, 0xd,
-    0x10, 0xc, 0x20, 0x0, 0x0, 0x0, 0x77, 0x3,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xd0, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x50,
-
-    /* U+0042 "B" */
-    0xcd, 0xdd, 0xdd, 0xdb, 0x30, 0xc, 0x10, 0x0,
-    0x0, 0x4d, 0x30, 0xc1, 0x0, 0x0, 0x0, 0x5a,
-    0xc, 0x10, 0x0, 0x0, 0x2, 0xc0, 0xc1, 0x0,
-    0x0, 0x0, 0x59, 0xc, 0x10, 0x0, 0x0, 0x5d,
-    0x10, 0xce, 0xdd, 0xdd, 0xff, 0x60, 0xc, 0x10,
-    0x0, 0x0, 0x18, 0xb0, 0xc1, 0x0, 0x0, 0x0,
-    0xa, 0x4c, 0x10, 0x0, 0x0, 0x0, 0x77, 0xc1,
-    0x0, 0x0, 0x0, 0xa, 0x5c, 0x10, 0x0, 0x0,
-    0x7, 0xd0, 0xcd, 0xdd, 0xdd, 0xdd, 0x81, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x4b, 0xee, 0xeb, 0x50, 0x0, 0xa,
-    0xb4, 0x0, 0x3, 0xaa, 0x0, 0xb8, 0x0, 0x0,
-    0x0, 0x2, 0x5, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0x0, 0x2, 0x0, 0xb, 0xb4, 0x0, 0x3, 0xba,
-    0x0, 0x0, 0x5b, 0xee, 0xeb, 0x50,
-
-    /* U+0044 "D" */
-    0xce, 0xee, 0xee, 0xda, 0x30, 0x0, 0xc1, 0x0,
-    0x0, 0x4, 0xc9, 0x0, 0xc1, 0x0, 0x0, 0x0,
-    0x9, 0x90, 0xc1, 0x0, 0x0, 0x0, 0x0, 0xd3,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x59, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x59, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0xd3, 0xc1, 0x0, 0x0, 0x0,
-    0x9, 0x90, 0xc1, 0x0, 0x0, 0x4, 0xc9, 0x0,
-    0xce, 0xee, 0xee, 0xea, 0x40, 0x0,
-
-    /* U+0045 "E" */
-    0xce, 0xee, 0xee, 0xee, 0x8c, 0x10, 0x0, 0x0,
-    0x0, 0xc1, 0x0, 0x0, 0x0, 0xc, 0x10, 0x0,
-    0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0xc, 0x10,
-    0x0, 0x0, 0x0, 0xce, 0xdd, 0xdd, 0xdb, 0xc,
-    0x10, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0,
-    0xc, 0x10, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0,
-    0x0, 0xc, 0x10, 0x0, 0x0, 0x0, 0xce, 0xee,
-    0xee, 0xee, 0xc0,
-
-    /* U+0046 "F" */
-    0xce, 0xee, 0xee, 0xee, 0x8c, 0x10, 0x0, 0x0,
-    0x0, 0xc1, 0x0, 0x0, 0x0, 0xc, 0x10, 0x0,
-    0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0xc, 0x10,
-    0x0, 0x0, 0x0, 0xce, 0xee, 0xee, 0xeb, 0xc,
-    0x10, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0,
-    0xc, 0x10, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0,
-    0x0, 0xc, 0x10, 0x0, 0x0, 0x0, 0xc1, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x4b, 0xee, 0xeb, 0x60, 0x0, 0x0,
-    0xab, 0x40, 0x0, 0x29, 0xb0, 0x0, 0xa8, 0x0,
-    0x0, 0x0, 0x2, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xc1, 0xb, 0x40, 0x0, 0x0,
-    0x0, 0xc, 0x10, 0x5b, 0x0, 0x0, 0x0, 0x0,
-    0xc1, 0x0, 0xb8, 0x0, 0x0, 0x0, 0xc, 0x10,
-    0x0, 0xbb, 0x40, 0x0, 0x29, 0xc0, 0x0, 0x0,
-    0x4b, 0xee, 0xeb, 0x60, 0x0,
-
-    /* U+0048 "H" */
-    0xc1, 0x0, 0x0, 0x0, 0x7, 0x7c, 0x10, 0x0,
-    0x0, 0x0, 0x77, 0xc1, 0x0, 0x0, 0x0, 0x7,
-    0x7c, 0x10, 0x0, 0x0, 0x0, 0x77, 0xc1, 0x0,
-    0x0, 0x0, 0x7, 0x7c, 0x10, 0x0, 0x0, 0x0,
-    0x77, 0xce, 0xdd, 0xdd, 0xdd, 0xde, 0x7c, 0x10,
-    0x0, 0x0, 0x0, 0x77, 0xc1, 0x0, 0x0, 0x0,
-    0x7, 0x7c, 0x10, 0x0, 0x0, 0x0, 0x77, 0xc1,
-    0x0, 0x0, 0x0, 0x7, 0x7c, 0x10, 0x0, 0x0,
-    0x0, 0x77, 0xc1, 0x0, 0x0, 0x0, 0x7, 0x70,
-
-    /* U+0049 "I" */
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-    0xc1, 0xc1, 0xc1, 0xc1, 0xc1,
-
-    /* U+004A "J" */
-    0x0, 0xbe, 0xee, 0xec, 0x0, 0x0, 0x0, 0x2c,
-    0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x2c,
-    0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x2c,
-    0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x2c,
-    0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x3b,
-    0x3, 0x0, 0x0, 0x69, 0xb, 0x70, 0x2, 0xd3,
-    0x0, 0x8d, 0xed, 0x50,
-
-    /* U+004B "K" */
-    0xc1, 0x0, 0x0, 0x0, 0x79, 0xc, 0x10, 0x0,
-    0x0, 0x6a, 0x0, 0xc1, 0x0, 0x0, 0x5b, 0x0,
-    0xc, 0x10, 0x0, 0x5c, 0x0, 0x0, 0xc1, 0x0,
-    0x4c, 0x10, 0x0, 0xc, 0x10, 0x3d, 0x10, 0x0,
-    0x0, 0xc1, 0x3d, 0xe2, 0x0, 0x0, 0xc, 0x4d,
-    0x24, 0xd0, 0x0, 0x0, 0xce, 0x30, 0x7, 0xb0,
-    0x0, 0xc, 0x40, 0x0, 0x9, 0x80, 0x0, 0xc1,
-    0x0, 0x0, 0xb, 0x60, 0xc, 0x10, 0x0, 0x0,
-    0x1d, 0x30, 0xc1, 0x0, 0x0, 0x0, 0x2d, 0x20,
-
-    /* U+004C "L" */
-    0xc1, 0x0, 0x0, 0x0, 0xc, 0x10, 0x0, 0x0,
-    0x0, 0xc1, 0x0, 0x0, 0x0, 0xc, 0x10, 0x0,
-    0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0xc, 0x10,
-    0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0xc,
-    0x10, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0,
-    0xc, 0x10, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0,
-    0x0, 0xc, 0x10, 0x0, 0x0, 0x0, 0xce, 0xee,
-    0xee, 0xee, 0x50,
-
-    /* U+004D "M" */
-    0xc3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0xcc,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0xca, 0x50,
-    0x0, 0x0, 0x0, 0x2b, 0xe0, 0xc2, 0xd0, 0x0,
-    0x0, 0x0, 0xb3, 0xe0, 0xc1, 0x77, 0x0, 0x0,
-    0x4, 0x90, 0xe0, 0xc1, 0xd, 0x10, 0x0, 0xc,
-    0x10, 0xe0, 0xc1, 0x5, 0x90, 0x0, 0x67, 0x0,
-    0xe0, 0xc1, 0x0, 0xb3, 0x0, 0xc0, 0x0, 0xe0,
-    0xc1, 0x0, 0x3b, 0x8, 0x60, 0x0, 0xe0, 0xc1,
-    0x0, 0xa, 0x6c, 0x0, 0x0, 0xe0, 0xc1, 0x0,
-    0x1, 0xf4, 0x0, 0x0, 0xe0, 0xc1, 0x0, 0x0,
-    0x20, 0x0, 0x0, 0xe0, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe0,
-
-    /* U+004E "N" */
-    0xc5, 0x0, 0x0, 0x0, 0x7, 0x7c, 0xe2, 0x0,
-    0x0, 0x0, 0x77, 0xc6, 0xd0, 0x0, 0x0, 0x7,
-    0x7c, 0x18, 0xa0, 0x0, 0x0, 0x77, 0xc1, 0xc,
-    0x60, 0x0, 0x7, 0x7c, 0x10, 0x1d, 0x20, 0x0,
-    0x77, 0xc1, 0x0, 0x4d, 0x0, 0x7, 0x7c, 0x10,
-    0x0, 0x7a, 0x0, 0x77, 0xc1, 0x0, 0x0, 0xb6,
-    0x7, 0x7c, 0x10, 0x0, 0x1, 0xd3, 0x77, 0xc1,
-    0x0, 0x0, 0x3, 0xd8, 0x7c, 0x10, 0x0, 0x0,
-    0x7, 0xf7, 0xc1, 0x0, 0x0, 0x0, 0xa, 0x70,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x4b, 0xee, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0xab, 0x40, 0x0, 0x3b, 0xb1, 0x0, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x4b,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x60, 0xb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe0, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x10, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe0, 0xb, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x60, 0x0, 0xb8, 0x0, 0x0, 0x0,
-    0x7, 0xc0, 0x0, 0x0, 0xab, 0x40, 0x0, 0x3b,
-    0xb1, 0x0, 0x0, 0x0, 0x4b, 0xee, 0xeb, 0x50,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xce, 0xee, 0xee, 0xc6, 0x0, 0xc1, 0x0, 0x0,
-    0x29, 0xb0, 0xc1, 0x0, 0x0, 0x0, 0xa6, 0xc1,
-    0x0, 0x0, 0x0, 0x4b, 0xc1, 0x0, 0x0, 0x0,
-    0x2c, 0xc1, 0x0, 0x0, 0x0, 0x4b, 0xc1, 0x0,
-    0x0, 0x0, 0xb5, 0xc1, 0x0, 0x0, 0x3a, 0xa0,
-    0xce, 0xee, 0xee, 0xb5, 0x0, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0xc1, 0x0, 0x0, 0x0, 0x0, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x4b, 0xee, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0xab, 0x40, 0x0, 0x3b, 0xb1, 0x0, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x4b,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x60, 0xb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe0, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x10, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe0, 0xb, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x60, 0x0, 0xb8, 0x0, 0x0, 0x0,
-    0x7, 0xc0, 0x0, 0x0, 0xab, 0x40, 0x0, 0x3b,
-    0xb1, 0x0, 0x0, 0x0, 0x4b, 0xee, 0xeb, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x20, 0x0,
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x4d, 0x40, 0x1b,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xdc, 0x50,
-
-    /* U+0052 "R" */
-    0xce, 0xee, 0xee, 0xc6, 0x0, 0xc1, 0x0, 0x0,
-    0x29, 0xb0, 0xc1, 0x0, 0x0, 0x0, 0xa6, 0xc1,
-    0x0, 0x0, 0x0, 0x4b, 0xc1, 0x0, 0x0, 0x0,
-    0x2c, 0xc1, 0x0, 0x0, 0x0, 0x4b, 0xc1, 0x0,
-    0x0, 0x0, 0xb5, 0xc1, 0x0, 0x0, 0x2a, 0xa0,
-    0xce, 0xdd, 0xdd, 0xf5, 0x0, 0xc1, 0x0, 0x0,
-    0x97, 0x0, 0xc1, 0x0, 0x0, 0xc, 0x30, 0xc1,
-    0x0, 0x0, 0x2, 0xd0, 0xc1, 0x0, 0x0, 0x0,
-    0x6a,
-
-    /* U+0053 "S" */
-    0x0, 0x2a, 0xdd, 0xdc, 0x60, 0x0, 0x2d, 0x50,
-    0x0, 0x28, 0x50, 0x9, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x8, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xa6, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x8d, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x2,
-    0x0, 0x0, 0x0, 0x1e, 0x0, 0xb9, 0x20, 0x0,
-    0x3c, 0x60, 0x0, 0x5b, 0xdd, 0xdb, 0x40, 0x0,
-
-    /* U+0054 "T" */
-    0xce, 0xee, 0xef, 0xee, 0xee, 0x0, 0x0, 0x6,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x68, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x68, 0x0, 0x0, 0x0, 0x0, 0x6, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x68, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x80, 0x0, 0x0, 0x0, 0x0, 0x68, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x68, 0x0, 0x0, 0x0, 0x0, 0x6, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x68, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xe0, 0x0, 0x0, 0x0, 0xb, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0xb3, 0xe0, 0x0, 0x0, 0x0, 0xb,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0xb3, 0xe0, 0x0,
-    0x0, 0x0, 0xb, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0xb3, 0xe0, 0x0, 0x0, 0x0, 0xb, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0xb2, 0xd1, 0x0, 0x0, 0x0,
-    0xd, 0x1a, 0x40, 0x0, 0x0, 0x0, 0xe0, 0x4c,
-    0x0, 0x0, 0x0, 0x79, 0x0, 0x9b, 0x20, 0x1,
-    0x8d, 0x10, 0x0, 0x6c, 0xee, 0xd8, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0xa5, 0x0, 0x0, 0x0, 0x0, 0xd, 0x13, 0xc0,
-    0x0, 0x0, 0x0, 0x5, 0x90, 0xc, 0x30, 0x0,
-    0x0, 0x0, 0xc3, 0x0, 0x69, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0xe1, 0x0, 0x0, 0xa, 0x50,
-    0x0, 0x8, 0x70, 0x0, 0x1, 0xd0, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x87, 0x0, 0x0, 0x0, 0xa5,
-    0x0, 0xd, 0x10, 0x0, 0x0, 0x3, 0xc0, 0x6,
-    0x90, 0x0, 0x0, 0x0, 0xc, 0x30, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x5a, 0x3b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xec, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xd0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x1d, 0x0, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0,
-    0x0, 0xd0, 0xc, 0x20, 0x0, 0x0, 0x1d, 0xd0,
-    0x0, 0x0, 0x5, 0x80, 0x7, 0x80, 0x0, 0x0,
-    0x68, 0xb2, 0x0, 0x0, 0xa, 0x30, 0x2, 0xd0,
-    0x0, 0x0, 0xb2, 0x68, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0xc2, 0x0, 0x1, 0xd0, 0x1d, 0x0, 0x0,
-    0x59, 0x0, 0x0, 0x77, 0x0, 0x6, 0x70, 0xb,
-    0x30, 0x0, 0xa3, 0x0, 0x0, 0x2d, 0x0, 0xb,
-    0x20, 0x5, 0x80, 0x0, 0xd0, 0x0, 0x0, 0xd,
-    0x20, 0x1c, 0x0, 0x0, 0xd0, 0x5, 0x90, 0x0,
-    0x0, 0x7, 0x70, 0x67, 0x0, 0x0, 0xb3, 0xa,
-    0x40, 0x0, 0x0, 0x2, 0xc0, 0xb2, 0x0, 0x0,
-    0x58, 0xe, 0x0, 0x0, 0x0, 0x0, 0xd3, 0xc0,
-    0x0, 0x0, 0xd, 0x59, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x70, 0x0, 0x0, 0xb, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x20, 0x0, 0x0, 0x5, 0xe0,
-    0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x1d, 0x20, 0x0, 0x0, 0x8, 0x70, 0x3, 0xd0,
-    0x0, 0x0, 0x4b, 0x0, 0x0, 0x89, 0x0, 0x1,
-    0xd1, 0x0, 0x0, 0xc, 0x40, 0xb, 0x50, 0x0,
-    0x0, 0x2, 0xd1, 0x69, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xa6, 0xd3, 0x0, 0x0,
-    0x0, 0x6, 0xa0, 0x3d, 0x0, 0x0, 0x0, 0x2d,
-    0x10, 0x7, 0xa0, 0x0, 0x0, 0xc4, 0x0, 0x0,
-    0xb5, 0x0, 0x8, 0x80, 0x0, 0x0, 0x1d, 0x20,
-    0x4c, 0x0, 0x0, 0x0, 0x4, 0xc0,
-
-    /* U+0059 "Y" */
-    0x96, 0x0, 0x0, 0x0, 0x2, 0xc0, 0x1d, 0x10,
-    0x0, 0x0, 0xa, 0x40, 0x6, 0x90, 0x0, 0x0,
-    0x4a, 0x0, 0x0, 0xc2, 0x0, 0x0, 0xc1, 0x0,
-    0x0, 0x3c, 0x0, 0x7, 0x70, 0x0, 0x0, 0xa,
-    0x50, 0x1d, 0x0, 0x0, 0x0, 0x1, 0xd0, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x7b, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x10, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xe, 0xee, 0xee, 0xee, 0xef, 0xc0, 0x0, 0x0,
-    0x0, 0x1, 0xd3, 0x0, 0x0, 0x0, 0x0, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x20,
-    0x0, 0x0, 0x0, 0xb, 0x60, 0x0, 0x0, 0x0,
-    0x8, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xd0, 0x0,
-    0x0, 0x0, 0x1, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x89, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xee, 0xee, 0xee, 0xee, 0xe0,
-
-    /* U+005B "[" */
-    0xcd, 0xd1, 0xc1, 0x0, 0xc1, 0x0, 0xc1, 0x0,
-    0xc1, 0x0, 0xc1, 0x0, 0xc1, 0x0, 0xc1, 0x0,
-    0xc1, 0x0, 0xc1, 0x0, 0xc1, 0x0, 0xc1, 0x0,
-    0xc1, 0x0, 0xc1, 0x0, 0xc1, 0x0, 0xc1, 0x0,
-    0xc1, 0x0, 0xcd, 0xd1,
-
-    /* U+005C "\\" */
-    0x66, 0x0, 0x0, 0x0, 0x1b, 0x0, 0x0, 0x0,
-    0xc, 0x10, 0x0, 0x0, 0x7, 0x60, 0x0, 0x0,
-    0x1, 0xb0, 0x0, 0x0, 0x0, 0xc1, 0x0, 0x0,
-    0x0, 0x76, 0x0, 0x0, 0x0, 0x1b, 0x0, 0x0,
-    0x0, 0xc, 0x10, 0x0, 0x0, 0x7, 0x50, 0x0,
-    0x0, 0x2, 0xb0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0x75, 0x0, 0x0, 0x0, 0x2a, 0x0,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x7, 0x50,
-    0x0, 0x0, 0x2, 0xa0, 0x0, 0x0, 0x0, 0xc0,
-
-    /* U+005D "]" */
-    0x7d, 0xe5, 0x0, 0x95, 0x0, 0x95, 0x0, 0x95,
-    0x0, 0x95, 0x0, 0x95, 0x0, 0x95, 0x0, 0x95,
-    0x0, 0x95, 0x0, 0x95, 0x0, 0x95, 0x0, 0x95,
-    0x0, 0x95, 0x0, 0x95, 0x0, 0x95, 0x0, 0x95,
-    0x0, 0x95, 0x7d, 0xe5,
-
-    /* U+005E "^" */
-    0x0, 0x7, 0xb0, 0x0, 0x0, 0xc, 0xa2, 0x0,
-    0x0, 0x38, 0x48, 0x0, 0x0, 0x92, 0xc, 0x0,
-    0x0, 0xb0, 0x8, 0x40, 0x6, 0x50, 0x1, 0xa0,
-    0xb, 0x0, 0x0, 0xb1, 0x29, 0x0, 0x0, 0x57,
-
-    /* U+005F "_" */
-    0xbb, 0xbb, 0xbb, 0xbb, 0xb0,
-
-    /* U+0060 "`" */
-    0x17, 0x10, 0x0, 0x4c, 0x10, 0x0, 0x3b, 0x10,
-
-    /* U+0061 "a" */
-    0x6, 0xcd, 0xdc, 0x40, 0x68, 0x10, 0x2, 0xd2,
-    0x0, 0x0, 0x0, 0x68, 0x0, 0x0, 0x0, 0x3a,
-    0x6, 0xbb, 0xbb, 0xcb, 0x89, 0x0, 0x0, 0x3b,
-    0xe0, 0x0, 0x0, 0x3b, 0xe0, 0x0, 0x0, 0x7b,
-    0x88, 0x0, 0x4, 0xbb, 0x8, 0xcb, 0xb7, 0x2b,
-
-    /* U+0062 "b" */
-    0x1d, 0x0, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x7,
-    0xdd, 0xd9, 0x10, 0x1, 0xd9, 0x70, 0x0, 0x6d,
-    0x10, 0x1f, 0x80, 0x0, 0x0, 0x5b, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0xd1, 0x1d, 0x0, 0x0, 0x0,
-    0xa, 0x31, 0xd0, 0x0, 0x0, 0x0, 0xa3, 0x1f,
-    0x0, 0x0, 0x0, 0xd, 0x11, 0xf8, 0x0, 0x0,
-    0x5, 0xb0, 0x1c, 0x97, 0x0, 0x6, 0xd1, 0x1,
-    0xc0, 0x7d, 0xdd, 0x91, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x8, 0xdd, 0xd9, 0x10, 0x0, 0xc8, 0x0,
-    0x5, 0xd0, 0x8, 0x80, 0x0, 0x0, 0x10, 0xe,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x80, 0x0, 0x0, 0x10,
-    0x0, 0xc8, 0x0, 0x5, 0xd0, 0x0, 0x8, 0xdd,
-    0xd9, 0x10,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xa4, 0x0, 0x8,
-    0xdd, 0xd8, 0xa, 0x40, 0xc, 0x70, 0x0, 0x6b,
-    0xa4, 0x8, 0x80, 0x0, 0x0, 0x5f, 0x40, 0xe0,
-    0x0, 0x0, 0x0, 0xd4, 0x1d, 0x0, 0x0, 0x0,
-    0xb, 0x41, 0xd0, 0x0, 0x0, 0x0, 0xb4, 0xe,
-    0x0, 0x0, 0x0, 0xd, 0x40, 0x88, 0x0, 0x0,
-    0x5, 0xf4, 0x0, 0xc7, 0x0, 0x6, 0xba, 0x40,
-    0x0, 0x8d, 0xdd, 0x80, 0xa4,
-
-    /* U+0065 "e" */
-    0x0, 0x19, 0xdd, 0xd7, 0x0, 0x0, 0xc6, 0x0,
-    0x8, 0xb0, 0x9, 0x60, 0x0, 0x0, 0x96, 0xd,
-    0x0, 0x0, 0x0, 0x2b, 0x1f, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x1c, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x80, 0x0, 0x0, 0x10,
-    0x0, 0xc8, 0x10, 0x4, 0xd1, 0x0, 0x7, 0xdd,
-    0xda, 0x20,
-
-    /* U+0066 "f" */
-    0x0, 0x1b, 0xdd, 0x40, 0xa, 0x50, 0x1, 0x0,
-    0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x8d, 0xfd,
-    0xdc, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe,
-    0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe, 0x0,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x8, 0xdc, 0xc9, 0x18, 0x60, 0xc, 0x60,
-    0x0, 0x3b, 0x86, 0x8, 0x70, 0x0, 0x0, 0x3f,
-    0x60, 0xe0, 0x0, 0x0, 0x0, 0xb6, 0x1d, 0x0,
-    0x0, 0x0, 0x8, 0x61, 0xd0, 0x0, 0x0, 0x0,
-    0x86, 0xe, 0x10, 0x0, 0x0, 0xc, 0x60, 0x88,
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0xc8, 0x0, 0x5,
-    0xb9, 0x60, 0x0, 0x8d, 0xdd, 0x80, 0x85, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x4, 0xd4, 0x0, 0x2, 0xb7, 0x0,
-    0x2, 0x9d, 0xde, 0xc5, 0x0,
-
-    /* U+0068 "h" */
-    0x1d, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x8, 0xdd, 0xd8,
-    0x0, 0x1d, 0xb5, 0x0, 0x1a, 0x90, 0x1f, 0x50,
-    0x0, 0x0, 0xe1, 0x1f, 0x0, 0x0, 0x0, 0xa4,
-    0x1d, 0x0, 0x0, 0x0, 0x95, 0x1d, 0x0, 0x0,
-    0x0, 0x95, 0x1d, 0x0, 0x0, 0x0, 0x95, 0x1d,
-    0x0, 0x0, 0x0, 0x95, 0x1d, 0x0, 0x0, 0x0,
-    0x95, 0x1d, 0x0, 0x0, 0x0, 0x95,
-
-    /* U+0069 "i" */
-    0x4e, 0x1, 0x70, 0x0, 0x0, 0x0, 0x1d, 0x1,
-    0xd0, 0x1d, 0x1, 0xd0, 0x1d, 0x1, 0xd0, 0x1d,
-    0x1, 0xd0, 0x1d, 0x1, 0xd0,
-
-    /* U+006A "j" */
-    0x0, 0x2, 0xe1, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe0,
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0xe0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xd0,
-    0x10, 0x6, 0xa0, 0x4d, 0xdb, 0x10,
-
-    /* U+006B "k" */
-    0x1d, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0xa,
-    0x70, 0x1d, 0x0, 0x0, 0xb7, 0x0, 0x1d, 0x0,
-    0xb, 0x70, 0x0, 0x1d, 0x0, 0xb7, 0x0, 0x0,
-    0x1d, 0xc, 0xe4, 0x0, 0x0, 0x1d, 0xc6, 0x2d,
-    0x10, 0x0, 0x1f, 0x50, 0x6, 0xc0, 0x0, 0x1d,
-    0x0, 0x0, 0xa8, 0x0, 0x1d, 0x0, 0x0, 0xd,
-    0x40, 0x1d, 0x0, 0x0, 0x2, 0xd1,
-
-    /* U+006C "l" */
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
-
-    /* U+006D "m" */
-    0x1c, 0x19, 0xcc, 0xd6, 0x0, 0x7c, 0xcd, 0x80,
-    0x1, 0xcb, 0x30, 0x1, 0xb6, 0xa6, 0x0, 0x8,
-    0xa0, 0x1f, 0x40, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0xd, 0x21, 0xe0, 0x0, 0x0, 0xd, 0x30, 0x0,
-    0x0, 0x95, 0x1d, 0x0, 0x0, 0x0, 0xd1, 0x0,
-    0x0, 0x8, 0x51, 0xd0, 0x0, 0x0, 0xd, 0x10,
-    0x0, 0x0, 0x85, 0x1d, 0x0, 0x0, 0x0, 0xd1,
-    0x0, 0x0, 0x8, 0x51, 0xd0, 0x0, 0x0, 0xd,
-    0x10, 0x0, 0x0, 0x85, 0x1d, 0x0, 0x0, 0x0,
-    0xd1, 0x0, 0x0, 0x8, 0x51, 0xd0, 0x0, 0x0,
-    0xd, 0x10, 0x0, 0x0, 0x85,
-
-    /* U+006E "n" */
-    0x1c, 0x8, 0xcc, 0xd8, 0x0, 0x1c, 0xb4, 0x0,
-    0x9, 0x90, 0x1f, 0x40, 0x0, 0x0, 0xe1, 0x1f,
-    0x0, 0x0, 0x0, 0xa4, 0x1d, 0x0, 0x0, 0x0,
-    0x95, 0x1d, 0x0, 0x0, 0x0, 0x95, 0x1d, 0x0,
-    0x0, 0x0, 0x95, 0x1d, 0x0, 0x0, 0x0, 0x95,
-    0x1d, 0x0, 0x0, 0x0, 0x95, 0x1d, 0x0, 0x0,
-    0x0, 0x95,
-
-    /* U+006F "o" */
-    0x0, 0x8, 0xdd, 0xd9, 0x10, 0x0, 0xc, 0x70,
-    0x0, 0x6d, 0x10, 0x8, 0x80, 0x0, 0x0, 0x5b,
-    0x0, 0xe0, 0x0, 0x0, 0x0, 0xd1, 0x1d, 0x0,
-    0x0, 0x0, 0xa, 0x41, 0xd0, 0x0, 0x0, 0x0,
-    0xa4, 0xe, 0x0, 0x0, 0x0, 0xd, 0x10, 0x88,
-    0x0, 0x0, 0x5, 0xb0, 0x0, 0xc7, 0x0, 0x6,
-    0xd1, 0x0, 0x0, 0x8d, 0xdd, 0x91, 0x0,
-
-    /* U+0070 "p" */
-    0x1c, 0x7, 0xdd, 0xd9, 0x10, 0x1, 0xc9, 0x70,
-    0x0, 0x6d, 0x10, 0x1f, 0x80, 0x0, 0x0, 0x5b,
-    0x1, 0xf0, 0x0, 0x0, 0x0, 0xd1, 0x1d, 0x0,
-    0x0, 0x0, 0xa, 0x31, 0xd0, 0x0, 0x0, 0x0,
-    0xa3, 0x1f, 0x0, 0x0, 0x0, 0xd, 0x11, 0xf8,
-    0x0, 0x0, 0x5, 0xb0, 0x1d, 0x97, 0x0, 0x6,
-    0xd1, 0x1, 0xd0, 0x7d, 0xdd, 0x91, 0x0, 0x1d,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xd0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x8, 0xdd, 0xd8, 0xa, 0x40, 0xc, 0x70,
-    0x0, 0x6b, 0xa4, 0x8, 0x80, 0x0, 0x0, 0x5f,
-    0x40, 0xe0, 0x0, 0x0, 0x0, 0xd4, 0x1d, 0x0,
-    0x0, 0x0, 0xb, 0x41, 0xd0, 0x0, 0x0, 0x0,
-    0xb4, 0xe, 0x0, 0x0, 0x0, 0xd, 0x40, 0x88,
-    0x0, 0x0, 0x5, 0xf4, 0x0, 0xc7, 0x0, 0x6,
-    0xba, 0x40, 0x0, 0x8d, 0xdd, 0x80, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xa4, 0x0, 0x0, 0x0, 0x0, 0xa, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xa4,
-
-    /* U+0072 "r" */
-    0x1c, 0x19, 0xd4, 0x1c, 0xb3, 0x0, 0x1f, 0x50,
-    0x0, 0x1f, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x1d,
-    0x0, 0x0, 0x1d, 0x0, 0x0, 0x1d, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x1d, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x1, 0xad, 0xdd, 0xa2, 0xc, 0x50, 0x0, 0x44,
-    0x1c, 0x0, 0x0, 0x0, 0xe, 0x10, 0x0, 0x0,
-    0x5, 0xe9, 0x62, 0x0, 0x0, 0x4, 0x7b, 0xd3,
-    0x0, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x0, 0xe,
-    0x4a, 0x20, 0x0, 0x7a, 0x6, 0xcd, 0xdd, 0x80,
-
-    /* U+0074 "t" */
-    0x0, 0xe0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x8d,
-    0xfd, 0xdc, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0,
-    0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x10, 0x2,
-    0xcd, 0xc4,
-
-    /* U+0075 "u" */
-    0x3b, 0x0, 0x0, 0x0, 0xc2, 0x3b, 0x0, 0x0,
-    0x0, 0xc2, 0x3b, 0x0, 0x0, 0x0, 0xc2, 0x3b,
-    0x0, 0x0, 0x0, 0xc2, 0x3b, 0x0, 0x0, 0x0,
-    0xc2, 0x3b, 0x0, 0x0, 0x0, 0xc2, 0x2c, 0x0,
-    0x0, 0x0, 0xe2, 0xe, 0x10, 0x0, 0x4, 0xf2,
-    0x7, 0xb1, 0x0, 0x4b, 0xc2, 0x0, 0x6d, 0xdd,
-    0x91, 0xb2,
-
-    /* U+0076 "v" */
-    0xb3, 0x0, 0x0, 0x0, 0xa3, 0x5a, 0x0, 0x0,
-    0x1, 0xc0, 0xd, 0x10, 0x0, 0x8, 0x60, 0x7,
-    0x70, 0x0, 0xd, 0x0, 0x1, 0xd0, 0x0, 0x58,
-    0x0, 0x0, 0xa4, 0x0, 0xc2, 0x0, 0x0, 0x3b,
-    0x3, 0xb0, 0x0, 0x0, 0xc, 0x2a, 0x40, 0x0,
-    0x0, 0x5, 0xac, 0x0, 0x0, 0x0, 0x0, 0xe6,
-    0x0, 0x0,
-
-    /* U+0077 "w" */
-    0xa3, 0x0, 0x0, 0xc, 0x50, 0x0, 0x0, 0xa2,
-    0x49, 0x0, 0x0, 0x2d, 0xb0, 0x0, 0x0, 0xc0,
-    0xd, 0x0, 0x0, 0x85, 0xc1, 0x0, 0x6, 0x70,
-    0x9, 0x40, 0x0, 0xc0, 0x76, 0x0, 0xb, 0x10,
-    0x3, 0x90, 0x3, 0x90, 0x1b, 0x0, 0x1b, 0x0,
-    0x0, 0xc0, 0x9, 0x30, 0xb, 0x10, 0x75, 0x0,
-    0x0, 0x75, 0xc, 0x0, 0x5, 0x70, 0xc0, 0x0,
-    0x0, 0x2a, 0x57, 0x0, 0x0, 0xc2, 0xa0, 0x0,
-    0x0, 0xc, 0xb2, 0x0, 0x0, 0xab, 0x40, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x4e, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x1d, 0x10, 0x0, 0xa, 0x50, 0x4b, 0x0, 0x6,
-    0x90, 0x0, 0x97, 0x2, 0xc0, 0x0, 0x0, 0xc3,
-    0xc2, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
-    0x5d, 0xa0, 0x0, 0x0, 0x2d, 0x1a, 0x60, 0x0,
-    0xc, 0x40, 0xd, 0x20, 0x8, 0x80, 0x0, 0x3c,
-    0x3, 0xc0, 0x0, 0x0, 0x79,
-
-    /* U+0079 "y" */
-    0xb, 0x30, 0x0, 0x0, 0xa, 0x30, 0x4a, 0x0,
-    0x0, 0x1, 0xc0, 0x0, 0xd1, 0x0, 0x0, 0x86,
-    0x0, 0x7, 0x80, 0x0, 0xd, 0x0, 0x0, 0x1d,
-    0x0, 0x5, 0x90, 0x0, 0x0, 0x95, 0x0, 0xb2,
-    0x0, 0x0, 0x2, 0xc0, 0x2b, 0x0, 0x0, 0x0,
-    0xb, 0x39, 0x40, 0x0, 0x0, 0x0, 0x4a, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x10, 0x0, 0x0, 0x0, 0x4, 0xa0,
-    0x0, 0x0, 0x23, 0x1, 0xd2, 0x0, 0x0, 0x2,
-    0xbd, 0xd4, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x1d, 0xdd, 0xdd, 0xdf, 0x10, 0x0, 0x0, 0x8,
-    0x80, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x1,
-    0xd2, 0x0, 0x0, 0x0, 0xa5, 0x0, 0x0, 0x0,
-    0x69, 0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0,
-    0xc, 0x30, 0x0, 0x0, 0x9, 0x60, 0x0, 0x0,
-    0x2, 0xfd, 0xdd, 0xdd, 0xd3,
-
-    /* U+007B "{" */
-    0x0, 0xad, 0x40, 0x5a, 0x0, 0x6, 0x70, 0x0,
-    0x77, 0x0, 0x7, 0x70, 0x0, 0x77, 0x0, 0x7,
-    0x70, 0x0, 0x77, 0x0, 0x8, 0x60, 0xb, 0xf1,
-    0x0, 0x8, 0x60, 0x0, 0x77, 0x0, 0x7, 0x70,
-    0x0, 0x77, 0x0, 0x7, 0x70, 0x0, 0x77, 0x0,
-    0x5, 0xa0, 0x0, 0xb, 0xd4,
-
-    /* U+007C "|" */
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
-    0xc0, 0xc0,
-
-    /* U+007D "}" */
-    0x7d, 0x70, 0x0, 0xd, 0x10, 0x0, 0xa3, 0x0,
-    0xa, 0x30, 0x0, 0xa3, 0x0, 0xa, 0x30, 0x0,
-    0xa3, 0x0, 0xa, 0x30, 0x0, 0xa5, 0x0, 0x4,
-    0xf8, 0x0, 0xa5, 0x0, 0xa, 0x30, 0x0, 0xa3,
-    0x0, 0xa, 0x30, 0x0, 0xa3, 0x0, 0xa, 0x30,
-    0x0, 0xd2, 0x7, 0xd8, 0x0,
-
-    /* U+007E "~" */
-    0x1a, 0xc7, 0x0, 0x8, 0x9, 0x30, 0x7a, 0x1,
-    0xb0, 0x90, 0x0, 0x5c, 0xb2, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x10, 0xb1,
-    0x0, 0x94, 0x9, 0x40, 0x5, 0x90, 0x59, 0x0,
-    0xd, 0x10, 0xd1, 0x0, 0x4, 0xa0, 0x4a, 0x0,
-    0x0, 0x85, 0x8, 0x50, 0x0, 0xb, 0x20, 0xb2,
-
-    /* U+00BB "»" */
-    0x1, 0x0, 0x10, 0x0, 0xb, 0x20, 0xb2, 0x0,
-    0x2, 0xb0, 0x2b, 0x0, 0x0, 0x58, 0x5, 0x80,
-    0x0, 0xd, 0x10, 0xd1, 0x0, 0x67, 0x6, 0x70,
-    0x3, 0xa0, 0x2a, 0x0, 0xc, 0x10, 0xb1, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x72, 0x0, 0x0, 0x0, 0x2, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0xee, 0xee, 0xee, 0x9b, 0x30,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0xb, 0x30, 0x0, 0x0, 0x0, 0xbe, 0xdd, 0xdd,
-    0xdc, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0,
-    0xbe, 0xee, 0xee, 0xee, 0xd0,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x70, 0x89,
-    0x0, 0x0, 0x11, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0xee, 0xee, 0xee, 0x9b, 0x30,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0xb, 0x30, 0x0, 0x0, 0x0, 0xbe, 0xdd, 0xdd,
-    0xdc, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0,
-    0xbe, 0xee, 0xee, 0xee, 0xd0,
-
-    /* U+0402 "Ђ" */
-    0xbe, 0xee, 0xef, 0xee, 0xee, 0x70, 0x0, 0x0,
-    0x0, 0x4a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0x27, 0xac,
-    0xb7, 0x10, 0x0, 0x0, 0x4f, 0xa5, 0x20, 0x27,
-    0xd1, 0x0, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x69,
-    0x0, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0x4a, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x4a, 0x0, 0x0, 0x0, 0x3b, 0x0, 0x0, 0x4a,
-    0x0, 0x0, 0x2, 0xd3, 0x0, 0x0, 0x4a, 0x0,
-    0x8d, 0xdc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x6, 0x30, 0x0, 0x0, 0xa, 0x60,
-    0x0, 0x0, 0x5, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0xee, 0xee, 0xee, 0xb, 0x30,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0,
-    0xb3, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x4, 0xbe, 0xee, 0xb4, 0x0, 0xa, 0xc4,
-    0x0, 0x3, 0xa9, 0x9, 0xa0, 0x0, 0x0, 0x0,
-    0x23, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x96, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0xdd, 0xdd, 0xdc, 0x0, 0xc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x96, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0x90, 0x0, 0x0, 0x0, 0x30, 0xa, 0xc3, 0x0,
-    0x3, 0xb9, 0x0, 0x4, 0xbe, 0xee, 0xa4, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x1, 0x9d, 0xdd, 0xc7, 0x0, 0x1d, 0x60, 0x0,
-    0x17, 0x60, 0x77, 0x0, 0x0, 0x0, 0x0, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x69, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xdb, 0x60, 0x0, 0x0, 0x0, 0x2, 0x7d, 0x40,
-    0x0, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xc2, 0x20, 0x0, 0x0, 0x0, 0xe0, 0xaa,
-    0x30, 0x0, 0x2b, 0x70, 0x4, 0xbd, 0xdd, 0xc5,
-    0x0,
-
-    /* U+0406 "І" */
-    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
-    0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
-
-    /* U+0407 "Ї" */
-    0x0, 0x0, 0x7, 0xa0, 0x5c, 0x11, 0x0, 0x20,
-    0x0, 0x0, 0x0, 0xc1, 0x0, 0xc, 0x10, 0x0,
-    0xc1, 0x0, 0xc, 0x10, 0x0, 0xc1, 0x0, 0xc,
-    0x10, 0x0, 0xc1, 0x0, 0xc, 0x10, 0x0, 0xc1,
-    0x0, 0xc, 0x10, 0x0, 0xc1, 0x0, 0xc, 0x10,
-    0x0, 0xc1, 0x0,
-
-    /* U+0408 "Ј" */
-    0x5, 0xee, 0xee, 0xf3, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb2,
-    0x11, 0x0, 0x0, 0xe0, 0x4c, 0x20, 0x8, 0xa0,
-    0x4, 0xce, 0xe9, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x7, 0xee, 0xee, 0xee, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x85, 0x0, 0x0, 0x4,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x40,
-    0x0, 0x0, 0x4d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x94, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x30, 0x0, 0x0, 0x4f,
-    0xdd, 0xdd, 0xdb, 0x50, 0x0, 0x0, 0xa3, 0x0,
-    0x0, 0x4, 0xd0, 0x0, 0x0, 0x2b, 0x90, 0x0,
-    0xb, 0x20, 0x0, 0x0, 0x4d, 0x0, 0x0, 0x0,
-    0xd, 0x20, 0x0, 0xc1, 0x0, 0x0, 0x4, 0xd0,
-    0x0, 0x0, 0x0, 0x86, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0x4d, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0,
-    0xd0, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0, 0x0,
-    0x96, 0x0, 0x59, 0x0, 0x0, 0x0, 0x4d, 0x0,
-    0x0, 0x0, 0xe, 0x20, 0x1d, 0x30, 0x0, 0x0,
-    0x4, 0xd0, 0x0, 0x0, 0x3c, 0x80, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfc, 0x50,
-    0x0,
-
-    /* U+040A "Њ" */
-    0xb3, 0x0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xc,
-    0x40, 0x0, 0x0, 0x0, 0xb, 0x30, 0x0, 0x0,
-    0x0, 0xc4, 0x0, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0xc, 0x40, 0x0, 0x0, 0x0, 0xb,
-    0xee, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xee, 0xd8,
-    0x0, 0xb3, 0x0, 0x0, 0x0, 0xc, 0x40, 0x0,
-    0x2, 0x9d, 0xb, 0x30, 0x0, 0x0, 0x0, 0xc4,
-    0x0, 0x0, 0x0, 0xb6, 0xb3, 0x0, 0x0, 0x0,
-    0xc, 0x40, 0x0, 0x0, 0x6, 0x9b, 0x30, 0x0,
-    0x0, 0x0, 0xc4, 0x0, 0x0, 0x0, 0x69, 0xb3,
-    0x0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x0, 0xa,
-    0x5b, 0x30, 0x0, 0x0, 0x0, 0xc4, 0x0, 0x0,
-    0x8, 0xc0, 0xb3, 0x0, 0x0, 0x0, 0xc, 0xdd,
-    0xdd, 0xdd, 0x80, 0x0,
-
-    /* U+040B "Ћ" */
-    0xce, 0xee, 0xef, 0xee, 0xee, 0x50, 0x0, 0x0,
-    0x0, 0x59, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x59, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0x5a, 0xde,
-    0xd9, 0x10, 0x0, 0x0, 0x5f, 0x93, 0x0, 0x17,
-    0xe1, 0x0, 0x0, 0x59, 0x0, 0x0, 0x0, 0x89,
-    0x0, 0x0, 0x59, 0x0, 0x0, 0x0, 0x2c, 0x0,
-    0x0, 0x59, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0,
-    0x59, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x59,
-    0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x59, 0x0,
-    0x0, 0x0, 0x1d,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x4, 0x50, 0x0, 0x0, 0x0, 0x8,
-    0x90, 0x0, 0x0, 0x0, 0x3, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0xa6, 0xb, 0x30, 0x0, 0x0, 0x5a,
-    0x0, 0xb3, 0x0, 0x0, 0x2c, 0x0, 0xb, 0x30,
-    0x0, 0xc, 0x20, 0x0, 0xb3, 0x0, 0x9, 0x60,
-    0x0, 0xb, 0x30, 0x5, 0xa0, 0x0, 0x0, 0xbe,
-    0xee, 0xf2, 0x0, 0x0, 0xb, 0x30, 0x5, 0xc0,
-    0x0, 0x0, 0xb3, 0x0, 0x8, 0x90, 0x0, 0xb,
-    0x30, 0x0, 0xb, 0x50, 0x0, 0xb3, 0x0, 0x0,
-    0x1d, 0x20, 0xb, 0x30, 0x0, 0x0, 0x3d, 0x10,
-    0xb3, 0x0, 0x0, 0x0, 0x6b, 0x0,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2b,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x6, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0x9, 0x9b, 0x30, 0x0, 0x0, 0x5,
-    0xf9, 0xb3, 0x0, 0x0, 0x2, 0xd6, 0x9b, 0x30,
-    0x0, 0x0, 0xc3, 0x59, 0xb3, 0x0, 0x0, 0x97,
-    0x5, 0x9b, 0x30, 0x0, 0x5b, 0x0, 0x59, 0xb3,
-    0x0, 0x2d, 0x10, 0x5, 0x9b, 0x30, 0xd, 0x30,
-    0x0, 0x59, 0xb3, 0xa, 0x70, 0x0, 0x5, 0x9b,
-    0x36, 0xb0, 0x0, 0x0, 0x59, 0xb5, 0xd1, 0x0,
-    0x0, 0x5, 0x9b, 0xe3, 0x0, 0x0, 0x0, 0x59,
-    0xb7, 0x0, 0x0, 0x0, 0x5, 0x90,
-
-    /* U+040E "Ў" */
-    0x0, 0xc, 0x0, 0x2, 0x90, 0x0, 0x0, 0x8,
-    0x60, 0x9, 0x40, 0x0, 0x0, 0x0, 0x79, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x0, 0x68, 0xc, 0x20,
-    0x0, 0x0, 0x0, 0xd1, 0x5, 0xa0, 0x0, 0x0,
-    0x7, 0x70, 0x0, 0xc2, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x76, 0x0, 0x0, 0xc,
-    0x20, 0x1, 0xc0, 0x0, 0x0, 0x5, 0xa0, 0x8,
-    0x50, 0x0, 0x0, 0x0, 0xd2, 0x1c, 0x0, 0x0,
-    0x0, 0x0, 0x5a, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0,
-    0x3, 0xde, 0x90, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0xb3, 0x0, 0x0, 0x0, 0xb, 0x3b, 0x30, 0x0,
-    0x0, 0x0, 0xb3, 0xb3, 0x0, 0x0, 0x0, 0xb,
-    0x3b, 0x30, 0x0, 0x0, 0x0, 0xb3, 0xb3, 0x0,
-    0x0, 0x0, 0xb, 0x3b, 0x30, 0x0, 0x0, 0x0,
-    0xb3, 0xb3, 0x0, 0x0, 0x0, 0xb, 0x3b, 0x30,
-    0x0, 0x0, 0x0, 0xb3, 0xb3, 0x0, 0x0, 0x0,
-    0xb, 0x3b, 0x30, 0x0, 0x0, 0x0, 0xb3, 0xb3,
-    0x0, 0x0, 0x0, 0xb, 0x3b, 0x30, 0x0, 0x0,
-    0x0, 0xb3, 0xbe, 0xee, 0xee, 0xee, 0xef, 0x30,
-    0x0, 0x3, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3b,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xb0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x89, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc, 0x20, 0x0, 0x0, 0x0, 0x6, 0x70, 0x59,
-    0x0, 0x0, 0x0, 0x0, 0xd1, 0x0, 0xd1, 0x0,
-    0x0, 0x0, 0x49, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0xc, 0x20, 0x0, 0xd, 0x0, 0x0, 0x3, 0xb0,
-    0x0, 0x0, 0x86, 0x0, 0x0, 0xae, 0xdd, 0xdd,
-    0xdd, 0xd0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0xa,
-    0x40, 0x8, 0x60, 0x0, 0x0, 0x0, 0x3b, 0x0,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xc3, 0x68, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xa0,
-
-    /* U+0411 "Б" */
-    0xbe, 0xdd, 0xdd, 0xdd, 0xd3, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0xcc, 0xcc, 0xc9, 0x20, 0xb3, 0x0,
-    0x0, 0x5, 0xe3, 0xb3, 0x0, 0x0, 0x0, 0x4b,
-    0xb3, 0x0, 0x0, 0x0, 0xe, 0xb3, 0x0, 0x0,
-    0x0, 0xe, 0xb3, 0x0, 0x0, 0x0, 0x4b, 0xb3,
-    0x0, 0x0, 0x4, 0xd3, 0xbd, 0xdd, 0xdd, 0xda,
-    0x20,
-
-    /* U+0412 "В" */
-    0xbd, 0xdd, 0xdd, 0xd9, 0x10, 0xb, 0x30, 0x0,
-    0x0, 0x5e, 0x10, 0xb3, 0x0, 0x0, 0x0, 0x96,
-    0xb, 0x30, 0x0, 0x0, 0x6, 0x80, 0xb3, 0x0,
-    0x0, 0x0, 0x95, 0xb, 0x30, 0x0, 0x0, 0x6b,
-    0x0, 0xbd, 0xcc, 0xcc, 0xed, 0x30, 0xb, 0x30,
-    0x0, 0x0, 0x2a, 0x70, 0xb3, 0x0, 0x0, 0x0,
-    0xe, 0xb, 0x30, 0x0, 0x0, 0x0, 0xc2, 0xb3,
-    0x0, 0x0, 0x0, 0xe, 0x1b, 0x30, 0x0, 0x0,
-    0x19, 0x90, 0xbd, 0xdd, 0xdd, 0xdc, 0x70, 0x0,
-
-    /* U+0413 "Г" */
-    0xbe, 0xee, 0xee, 0xee, 0xb, 0x30, 0x0, 0x0,
-    0x0, 0xb3, 0x0, 0x0, 0x0, 0xb, 0x30, 0x0,
-    0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb, 0x30,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0xa, 0xee, 0xee, 0xee, 0xe8, 0x0, 0x0,
-    0xb, 0x20, 0x0, 0x0, 0x68, 0x0, 0x0, 0xb,
-    0x10, 0x0, 0x0, 0x68, 0x0, 0x0, 0xc, 0x10,
-    0x0, 0x0, 0x68, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x0, 0x68, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x68, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x68,
-    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x68, 0x0,
-    0x0, 0x1b, 0x0, 0x0, 0x0, 0x68, 0x0, 0x0,
-    0x49, 0x0, 0x0, 0x0, 0x68, 0x0, 0x0, 0x85,
-    0x0, 0x0, 0x0, 0x68, 0x0, 0x2, 0xc0, 0x0,
-    0x0, 0x0, 0x68, 0x0, 0xbf, 0xee, 0xee, 0xee,
-    0xee, 0xff, 0xe6, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x67, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x67, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67,
-
-    /* U+0415 "Е" */
-    0xbe, 0xee, 0xee, 0xee, 0x9b, 0x30, 0x0, 0x0,
-    0x0, 0xb3, 0x0, 0x0, 0x0, 0xb, 0x30, 0x0,
-    0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb, 0x30,
-    0x0, 0x0, 0x0, 0xbe, 0xdd, 0xdd, 0xdc, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xbe, 0xee,
-    0xee, 0xee, 0xd0,
-
-    /* U+0416 "Ж" */
-    0xd, 0x30, 0x0, 0x0, 0x76, 0x0, 0x0, 0x4,
-    0xb0, 0x3, 0xc0, 0x0, 0x0, 0x76, 0x0, 0x0,
-    0xd, 0x20, 0x0, 0x87, 0x0, 0x0, 0x76, 0x0,
-    0x0, 0x87, 0x0, 0x0, 0xd, 0x20, 0x0, 0x76,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x4, 0xb0, 0x0,
-    0x76, 0x0, 0xc, 0x30, 0x0, 0x0, 0x0, 0x95,
-    0x0, 0x76, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xee, 0xff, 0xee, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x76, 0x0, 0x6b, 0x0, 0x0,
-    0x0, 0x7, 0xa0, 0x0, 0x76, 0x0, 0xb, 0x50,
-    0x0, 0x0, 0x2e, 0x10, 0x0, 0x76, 0x0, 0x1,
-    0xe1, 0x0, 0x0, 0xc4, 0x0, 0x0, 0x76, 0x0,
-    0x0, 0x5b, 0x0, 0x7, 0x90, 0x0, 0x0, 0x76,
-    0x0, 0x0, 0xa, 0x60, 0x3d, 0x0, 0x0, 0x0,
-    0x76, 0x0, 0x0, 0x1, 0xd2,
-
-    /* U+0417 "З" */
-    0x3, 0xad, 0xee, 0xd8, 0x10, 0x19, 0x30, 0x0,
-    0x17, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x5d, 0xdd, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x6, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0x6a, 0x8c,
-    0x40, 0x0, 0x6, 0xd1, 0x3, 0xad, 0xdd, 0xd9,
-    0x10,
-
-    /* U+0418 "И" */
-    0xb3, 0x0, 0x0, 0x0, 0x9, 0x9b, 0x30, 0x0,
-    0x0, 0x5, 0xf9, 0xb3, 0x0, 0x0, 0x2, 0xd6,
-    0x9b, 0x30, 0x0, 0x0, 0xc3, 0x59, 0xb3, 0x0,
-    0x0, 0x97, 0x5, 0x9b, 0x30, 0x0, 0x5b, 0x0,
-    0x59, 0xb3, 0x0, 0x2d, 0x10, 0x5, 0x9b, 0x30,
-    0xd, 0x30, 0x0, 0x59, 0xb3, 0xa, 0x70, 0x0,
-    0x5, 0x9b, 0x36, 0xb0, 0x0, 0x0, 0x59, 0xb5,
-    0xd1, 0x0, 0x0, 0x5, 0x9b, 0xe3, 0x0, 0x0,
-    0x0, 0x59, 0xb7, 0x0, 0x0, 0x0, 0x5, 0x90,
-
-    /* U+0419 "Й" */
-    0x0, 0x32, 0x0, 0x4, 0x10, 0x0, 0x2, 0xb0,
-    0x1, 0xc0, 0x0, 0x0, 0x4, 0x99, 0x92, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0x9, 0x9b, 0x30, 0x0, 0x0, 0x5,
-    0xf9, 0xb3, 0x0, 0x0, 0x2, 0xd6, 0x9b, 0x30,
-    0x0, 0x0, 0xc3, 0x59, 0xb3, 0x0, 0x0, 0x97,
-    0x5, 0x9b, 0x30, 0x0, 0x5b, 0x0, 0x59, 0xb3,
-    0x0, 0x2d, 0x10, 0x5, 0x9b, 0x30, 0xd, 0x30,
-    0x0, 0x59, 0xb3, 0xa, 0x70, 0x0, 0x5, 0x9b,
-    0x36, 0xb0, 0x0, 0x0, 0x59, 0xb5, 0xd1, 0x0,
-    0x0, 0x5, 0x9b, 0xe3, 0x0, 0x0, 0x0, 0x59,
-    0xb7, 0x0, 0x0, 0x0, 0x5, 0x90,
-
-    /* U+041A "К" */
-    0xb3, 0x0, 0x0, 0x0, 0xa6, 0xb, 0x30, 0x0,
-    0x0, 0x5a, 0x0, 0xb3, 0x0, 0x0, 0x2c, 0x0,
-    0xb, 0x30, 0x0, 0xc, 0x20, 0x0, 0xb3, 0x0,
-    0x9, 0x60, 0x0, 0xb, 0x30, 0x5, 0xa0, 0x0,
-    0x0, 0xbe, 0xee, 0xf2, 0x0, 0x0, 0xb, 0x30,
-    0x5, 0xc0, 0x0, 0x0, 0xb3, 0x0, 0x8, 0x90,
-    0x0, 0xb, 0x30, 0x0, 0xb, 0x50, 0x0, 0xb3,
-    0x0, 0x0, 0x1d, 0x20, 0xb, 0x30, 0x0, 0x0,
-    0x3d, 0x10, 0xb3, 0x0, 0x0, 0x0, 0x6b, 0x0,
-
-    /* U+041B "Л" */
-    0x0, 0x7, 0xee, 0xee, 0xee, 0xec, 0x0, 0x8,
-    0x50, 0x0, 0x0, 0x2c, 0x0, 0x8, 0x40, 0x0,
-    0x0, 0x2c, 0x0, 0x9, 0x40, 0x0, 0x0, 0x2c,
-    0x0, 0x9, 0x30, 0x0, 0x0, 0x2c, 0x0, 0xa,
-    0x30, 0x0, 0x0, 0x2c, 0x0, 0xb, 0x20, 0x0,
-    0x0, 0x2c, 0x0, 0xc, 0x10, 0x0, 0x0, 0x2c,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0x2c, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0x2c, 0x0, 0x59, 0x0, 0x0,
-    0x0, 0x2c, 0x1, 0xd3, 0x0, 0x0, 0x0, 0x2c,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x2c,
-
-    /* U+041C "М" */
-    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe1, 0xbd,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0xba, 0x70,
-    0x0, 0x0, 0x0, 0x1c, 0xd1, 0xb3, 0xd1, 0x0,
-    0x0, 0x0, 0xa4, 0xd1, 0xb2, 0x69, 0x0, 0x0,
-    0x3, 0xb0, 0xd1, 0xb2, 0xc, 0x20, 0x0, 0xb,
-    0x20, 0xd1, 0xb2, 0x4, 0xb0, 0x0, 0x59, 0x0,
-    0xd1, 0xb2, 0x0, 0xb4, 0x0, 0xc1, 0x0, 0xd1,
-    0xb2, 0x0, 0x2c, 0x7, 0x70, 0x0, 0xd1, 0xb2,
-    0x0, 0x9, 0x7c, 0x0, 0x0, 0xd1, 0xb2, 0x0,
-    0x1, 0xe5, 0x0, 0x0, 0xd1, 0xb2, 0x0, 0x0,
-    0x20, 0x0, 0x0, 0xd1, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd1,
-
-    /* U+041D "Н" */
-    0xb3, 0x0, 0x0, 0x0, 0x6, 0x8b, 0x30, 0x0,
-    0x0, 0x0, 0x68, 0xb3, 0x0, 0x0, 0x0, 0x6,
-    0x8b, 0x30, 0x0, 0x0, 0x0, 0x68, 0xb3, 0x0,
-    0x0, 0x0, 0x6, 0x8b, 0x30, 0x0, 0x0, 0x0,
-    0x68, 0xbe, 0xdd, 0xdd, 0xdd, 0xde, 0x8b, 0x30,
-    0x0, 0x0, 0x0, 0x68, 0xb3, 0x0, 0x0, 0x0,
-    0x6, 0x8b, 0x30, 0x0, 0x0, 0x0, 0x68, 0xb3,
-    0x0, 0x0, 0x0, 0x6, 0x8b, 0x30, 0x0, 0x0,
-    0x0, 0x68, 0xb3, 0x0, 0x0, 0x0, 0x6, 0x80,
-
-    /* U+041E "О" */
-    0x0, 0x3, 0xae, 0xee, 0xc6, 0x0, 0x0, 0x0,
-    0x9c, 0x40, 0x0, 0x2a, 0xc1, 0x0, 0x8, 0xa0,
-    0x0, 0x0, 0x0, 0x5d, 0x0, 0x3d, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0x80, 0x96, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xe0, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc2, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb3, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc2,
-    0x96, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0x3d,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x80, 0x9, 0xa0,
-    0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x9c, 0x40,
-    0x0, 0x29, 0xd1, 0x0, 0x0, 0x3, 0xae, 0xee,
-    0xc6, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0xbe, 0xee, 0xee, 0xee, 0xee, 0xab, 0x30, 0x0,
-    0x0, 0x0, 0x4a, 0xb3, 0x0, 0x0, 0x0, 0x4,
-    0xab, 0x30, 0x0, 0x0, 0x0, 0x4a, 0xb3, 0x0,
-    0x0, 0x0, 0x4, 0xab, 0x30, 0x0, 0x0, 0x0,
-    0x4a, 0xb3, 0x0, 0x0, 0x0, 0x4, 0xab, 0x30,
-    0x0, 0x0, 0x0, 0x4a, 0xb3, 0x0, 0x0, 0x0,
-    0x4, 0xab, 0x30, 0x0, 0x0, 0x0, 0x4a, 0xb3,
-    0x0, 0x0, 0x0, 0x4, 0xab, 0x30, 0x0, 0x0,
-    0x0, 0x4a, 0xb3, 0x0, 0x0, 0x0, 0x4, 0xa0,
-
-    /* U+0420 "Р" */
-    0xbe, 0xee, 0xee, 0xc7, 0x0, 0xb3, 0x0, 0x0,
-    0x19, 0xc0, 0xb3, 0x0, 0x0, 0x0, 0x97, 0xb3,
-    0x0, 0x0, 0x0, 0x3c, 0xb3, 0x0, 0x0, 0x0,
-    0x1d, 0xb3, 0x0, 0x0, 0x0, 0x3c, 0xb3, 0x0,
-    0x0, 0x0, 0xa6, 0xb3, 0x0, 0x0, 0x2a, 0xb0,
-    0xbe, 0xee, 0xed, 0xb6, 0x0, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x3, 0xae, 0xee, 0xc6, 0x0, 0x0, 0x9c,
-    0x50, 0x0, 0x29, 0xc0, 0x8, 0xa0, 0x0, 0x0,
-    0x0, 0x20, 0x3d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xa0, 0x0, 0x0,
-    0x0, 0x20, 0x0, 0x9c, 0x50, 0x0, 0x29, 0xc0,
-    0x0, 0x3, 0xae, 0xee, 0xc6, 0x0,
-
-    /* U+0422 "Т" */
-    0xbe, 0xee, 0xef, 0xee, 0xee, 0x20, 0x0, 0x4,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0x0, 0x0, 0x0, 0x0, 0x4, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x4a, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x4a, 0x0, 0x0, 0x0, 0x0, 0x4, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x5b, 0x0, 0x0, 0x0, 0x0, 0x68, 0xc, 0x20,
-    0x0, 0x0, 0x0, 0xd1, 0x5, 0xa0, 0x0, 0x0,
-    0x7, 0x70, 0x0, 0xc2, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x76, 0x0, 0x0, 0xc,
-    0x20, 0x1, 0xc0, 0x0, 0x0, 0x5, 0xa0, 0x8,
-    0x50, 0x0, 0x0, 0x0, 0xd2, 0x1c, 0x0, 0x0,
-    0x0, 0x0, 0x5a, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0,
-    0x3, 0xde, 0x90, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x49, 0xcd, 0xfc, 0xa6, 0x10, 0x0,
-    0x0, 0x1c, 0xa4, 0x4, 0xa0, 0x27, 0xd5, 0x0,
-    0x1, 0xd4, 0x0, 0x4, 0xa0, 0x0, 0x1c, 0x40,
-    0x8, 0x70, 0x0, 0x4, 0xa0, 0x0, 0x2, 0xd0,
-    0xd, 0x10, 0x0, 0x4, 0xa0, 0x0, 0x0, 0xb3,
-    0xe, 0x0, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x85,
-    0xe, 0x0, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x85,
-    0xd, 0x10, 0x0, 0x4, 0xa0, 0x0, 0x0, 0xb3,
-    0x8, 0x70, 0x0, 0x4, 0xa0, 0x0, 0x2, 0xd0,
-    0x1, 0xd4, 0x0, 0x4, 0xa0, 0x0, 0x1c, 0x40,
-    0x0, 0x1c, 0xa4, 0x4, 0xa0, 0x27, 0xd5, 0x0,
-    0x0, 0x0, 0x49, 0xcd, 0xfc, 0xa6, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0xd, 0x30, 0x0, 0x0, 0xd, 0x40, 0x2d, 0x0,
-    0x0, 0x8, 0x90, 0x0, 0x79, 0x0, 0x4, 0xd0,
-    0x0, 0x0, 0xc5, 0x0, 0xd3, 0x0, 0x0, 0x2,
-    0xd1, 0xa7, 0x0, 0x0, 0x0, 0x6, 0xdc, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x70, 0x0, 0x0, 0x0,
-    0xb, 0x7e, 0x20, 0x0, 0x0, 0x6, 0xb0, 0x4c,
-    0x0, 0x0, 0x2, 0xd1, 0x0, 0x98, 0x0, 0x0,
-    0xc4, 0x0, 0x0, 0xd3, 0x0, 0x79, 0x0, 0x0,
-    0x3, 0xd0, 0x3d, 0x0, 0x0, 0x0, 0x8, 0x90,
-
-    /* U+0426 "Ц" */
-    0xb3, 0x0, 0x0, 0x0, 0xb, 0x30, 0xb, 0x30,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0xb3, 0x0, 0x0,
-    0x0, 0xb, 0x30, 0xb, 0x30, 0x0, 0x0, 0x0,
-    0xb3, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb, 0x30,
-    0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb, 0x30, 0xb, 0x30, 0x0,
-    0x0, 0x0, 0xb3, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0xb, 0x30, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0xb3, 0x0, 0x0, 0x0, 0xb, 0x30, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0xbe, 0xee,
-    0xee, 0xee, 0xef, 0xee, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x94,
-
-    /* U+0427 "Ч" */
-    0x1d, 0x0, 0x0, 0x0, 0x5, 0x91, 0xd0, 0x0,
-    0x0, 0x0, 0x59, 0x1d, 0x0, 0x0, 0x0, 0x5,
-    0x91, 0xd0, 0x0, 0x0, 0x0, 0x59, 0x1d, 0x0,
-    0x0, 0x0, 0x5, 0x90, 0xd3, 0x0, 0x0, 0x0,
-    0x59, 0x4, 0xe5, 0x0, 0x2, 0x7d, 0x90, 0x3,
-    0xad, 0xdd, 0xa6, 0x69, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x90, 0x0, 0x0, 0x0, 0x0, 0x59, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x59, 0x0, 0x0, 0x0, 0x0, 0x5, 0x90,
-
-    /* U+0428 "Ш" */
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0xbe, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf6,
-
-    /* U+0429 "Щ" */
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0x0, 0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0,
-    0x86, 0x0, 0xb3, 0x0, 0x0, 0xa, 0x40, 0x0,
-    0x0, 0x86, 0x0, 0xb3, 0x0, 0x0, 0xa, 0x40,
-    0x0, 0x0, 0x86, 0x0, 0xb3, 0x0, 0x0, 0xa,
-    0x40, 0x0, 0x0, 0x86, 0x0, 0xb3, 0x0, 0x0,
-    0xa, 0x40, 0x0, 0x0, 0x86, 0x0, 0xb3, 0x0,
-    0x0, 0xa, 0x40, 0x0, 0x0, 0x86, 0x0, 0xb3,
-    0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86, 0x0,
-    0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x86,
-    0x0, 0xb3, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0,
-    0x86, 0x0, 0xb3, 0x0, 0x0, 0xa, 0x40, 0x0,
-    0x0, 0x86, 0x0, 0xb3, 0x0, 0x0, 0xa, 0x40,
-    0x0, 0x0, 0x86, 0x0, 0xbe, 0xee, 0xee, 0xef,
-    0xee, 0xee, 0xee, 0xff, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x76, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x76, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x76,
-
-    /* U+042A "Ъ" */
-    0xbe, 0xee, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xdd,
-    0xdd, 0xc8, 0x0, 0x0, 0x0, 0xd1, 0x0, 0x0,
-    0x18, 0xd0, 0x0, 0x0, 0xd1, 0x0, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0xd1, 0x0, 0x0, 0x0, 0x3b,
-    0x0, 0x0, 0xd1, 0x0, 0x0, 0x0, 0x2c, 0x0,
-    0x0, 0xd1, 0x0, 0x0, 0x0, 0x3b, 0x0, 0x0,
-    0xd1, 0x0, 0x0, 0x0, 0x96, 0x0, 0x0, 0xd1,
-    0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0xdd, 0xdd,
-    0xdd, 0xd8, 0x0,
-
-    /* U+042B "Ы" */
-    0xb3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc2, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc2, 0xb3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc2, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc2, 0xbd, 0xdd, 0xdd, 0xc8,
-    0x10, 0x0, 0xc2, 0xb3, 0x0, 0x0, 0x17, 0xd1,
-    0x0, 0xc2, 0xb3, 0x0, 0x0, 0x0, 0x88, 0x0,
-    0xc2, 0xb3, 0x0, 0x0, 0x0, 0x2c, 0x0, 0xc2,
-    0xb3, 0x0, 0x0, 0x0, 0x1d, 0x0, 0xc2, 0xb3,
-    0x0, 0x0, 0x0, 0x2c, 0x0, 0xc2, 0xb3, 0x0,
-    0x0, 0x0, 0x88, 0x0, 0xc2, 0xb3, 0x0, 0x0,
-    0x6, 0xd1, 0x0, 0xc2, 0xbd, 0xdd, 0xdd, 0xd9,
-    0x10, 0x0, 0xc2,
-
-    /* U+042C "Ь" */
-    0xb3, 0x0, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0xbd, 0xdd, 0xdd, 0xc8,
-    0x10, 0xb3, 0x0, 0x0, 0x17, 0xd1, 0xb3, 0x0,
-    0x0, 0x0, 0x88, 0xb3, 0x0, 0x0, 0x0, 0x2c,
-    0xb3, 0x0, 0x0, 0x0, 0x1d, 0xb3, 0x0, 0x0,
-    0x0, 0x2c, 0xb3, 0x0, 0x0, 0x0, 0x88, 0xb3,
-    0x0, 0x0, 0x6, 0xd1, 0xbd, 0xdd, 0xdd, 0xd9,
-    0x10,
-
-    /* U+042D "Э" */
-    0x0, 0x6c, 0xee, 0xe9, 0x20, 0x0, 0x1c, 0x82,
-    0x0, 0x6, 0xe6, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x1d, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x77, 0x0, 0x2, 0xdd, 0xdd,
-    0xdd, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xd0, 0x2, 0x0, 0x0, 0x0,
-    0x1d, 0x40, 0x1d, 0x82, 0x0, 0x6, 0xe6, 0x0,
-    0x0, 0x7c, 0xee, 0xe9, 0x20, 0x0,
-
-    /* U+042E "Ю" */
-    0xb3, 0x0, 0x0, 0x6, 0xce, 0xed, 0x81, 0x0,
-    0xb, 0x30, 0x0, 0x1c, 0xa2, 0x0, 0x16, 0xe4,
-    0x0, 0xb3, 0x0, 0xb, 0x70, 0x0, 0x0, 0x2,
-    0xd3, 0xb, 0x30, 0x5, 0xb0, 0x0, 0x0, 0x0,
-    0x4, 0xc0, 0xb3, 0x0, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x2b, 0x30, 0xe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x95, 0xbe, 0xee, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0x6b, 0x30, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x95, 0xb3, 0x0, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x2b, 0x30, 0x5, 0xb0,
-    0x0, 0x0, 0x0, 0x4, 0xc0, 0xb3, 0x0, 0xb,
-    0x70, 0x0, 0x0, 0x2, 0xd3, 0xb, 0x30, 0x0,
-    0x1c, 0xa2, 0x0, 0x16, 0xe4, 0x0, 0xb3, 0x0,
-    0x0, 0x6, 0xce, 0xed, 0x91, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x6c, 0xee, 0xee, 0xee, 0xa, 0xa2, 0x0,
-    0x0, 0xe, 0x4b, 0x0, 0x0, 0x0, 0xe, 0x95,
-    0x0, 0x0, 0x0, 0xe, 0xa4, 0x0, 0x0, 0x0,
-    0xe, 0x95, 0x0, 0x0, 0x0, 0xe, 0x4b, 0x0,
-    0x0, 0x0, 0xe, 0xa, 0xa2, 0x0, 0x0, 0xe,
-    0x0, 0x6f, 0xdd, 0xdd, 0xde, 0x0, 0x5a, 0x0,
-    0x0, 0xe, 0x1, 0xd1, 0x0, 0x0, 0xe, 0xa,
-    0x50, 0x0, 0x0, 0xe, 0x5a, 0x0, 0x0, 0x0,
-    0xe,
-
-    /* U+0430 "а" */
-    0x6, 0xcd, 0xdc, 0x40, 0x78, 0x10, 0x2, 0xd2,
-    0x0, 0x0, 0x0, 0x68, 0x0, 0x0, 0x0, 0x3a,
-    0x7, 0xbb, 0xbb, 0xca, 0x89, 0x0, 0x0, 0x3a,
-    0xe0, 0x0, 0x0, 0x3a, 0xe0, 0x0, 0x0, 0x8a,
-    0x98, 0x0, 0x5, 0xba, 0x8, 0xcb, 0xb7, 0x3a,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x37, 0xb3, 0x0, 0x4, 0xae,
-    0xb7, 0x30, 0x0, 0x9b, 0x30, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x0, 0x58, 0x19, 0xdd, 0xd6, 0x0, 0x85, 0xc4,
-    0x0, 0x1b, 0x90, 0xac, 0x20, 0x0, 0x0, 0xc4,
-    0xab, 0x0, 0x0, 0x0, 0x59, 0xa8, 0x0, 0x0,
-    0x0, 0x2c, 0x88, 0x0, 0x0, 0x0, 0x2c, 0x4b,
-    0x0, 0x0, 0x0, 0x59, 0xd, 0x30, 0x0, 0x0,
-    0xc3, 0x4, 0xe4, 0x0, 0x1a, 0x80, 0x0, 0x4c,
-    0xdd, 0xc5, 0x0,
-
-    /* U+0432 "в" */
-    0x1f, 0xcc, 0xcc, 0xc4, 0x1, 0xd0, 0x0, 0x2,
-    0xe1, 0x1d, 0x0, 0x0, 0xa, 0x31, 0xd0, 0x0,
-    0x3, 0xc0, 0x1f, 0xcc, 0xcd, 0xe3, 0x1, 0xd0,
-    0x0, 0x1, 0xc2, 0x1d, 0x0, 0x0, 0x6, 0x81,
-    0xd0, 0x0, 0x0, 0x68, 0x1d, 0x0, 0x0, 0x1c,
-    0x41, 0xfc, 0xcc, 0xcc, 0x50,
-
-    /* U+0433 "г" */
-    0x1f, 0xdd, 0xdd, 0xd5, 0x1d, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x5e, 0xdd, 0xdd, 0xf4, 0x0, 0x6, 0x70,
-    0x0, 0xa, 0x40, 0x0, 0x76, 0x0, 0x0, 0xa4,
-    0x0, 0x7, 0x50, 0x0, 0xa, 0x40, 0x0, 0x84,
-    0x0, 0x0, 0xa4, 0x0, 0xa, 0x30, 0x0, 0xa,
-    0x40, 0x0, 0xc1, 0x0, 0x0, 0xa4, 0x0, 0xd,
-    0x0, 0x0, 0xa, 0x40, 0x5, 0x80, 0x0, 0x0,
-    0xa4, 0xb, 0xfd, 0xdd, 0xdd, 0xdf, 0xda, 0xd0,
-    0x0, 0x0, 0x0, 0x1, 0xcd, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0x60, 0x0, 0x0, 0x0, 0x0, 0x60,
-
-    /* U+0435 "е" */
-    0x0, 0x8, 0xdd, 0xd8, 0x0, 0x0, 0xc7, 0x0,
-    0x6, 0xc0, 0x7, 0x80, 0x0, 0x0, 0x78, 0xd,
-    0x10, 0x0, 0x0, 0xd, 0xf, 0xbb, 0xbb, 0xbb,
-    0xbc, 0xe, 0x0, 0x0, 0x0, 0x0, 0xc, 0x10,
-    0x0, 0x0, 0x0, 0x6, 0x90, 0x0, 0x0, 0x10,
-    0x0, 0xb9, 0x10, 0x3, 0xd2, 0x0, 0x7, 0xdd,
-    0xdb, 0x30,
-
-    /* U+0436 "ж" */
-    0x1c, 0x10, 0x0, 0x3b, 0x0, 0x0, 0x78, 0x0,
-    0x4b, 0x0, 0x3, 0xb0, 0x0, 0x3c, 0x0, 0x0,
-    0x87, 0x0, 0x3b, 0x0, 0xc, 0x10, 0x0, 0x0,
-    0xc3, 0x3, 0xb0, 0xa, 0x50, 0x0, 0x0, 0x4,
-    0xfd, 0xdf, 0xdd, 0xd0, 0x0, 0x0, 0x0, 0xc4,
-    0x3, 0xb0, 0xb, 0x40, 0x0, 0x0, 0x6a, 0x0,
-    0x3b, 0x0, 0x2d, 0x0, 0x0, 0x1e, 0x10, 0x3,
-    0xb0, 0x0, 0x89, 0x0, 0xa, 0x60, 0x0, 0x3b,
-    0x0, 0x0, 0xd3, 0x5, 0xc0, 0x0, 0x3, 0xb0,
-    0x0, 0x4, 0xc0,
-
-    /* U+0437 "з" */
-    0x5, 0xbd, 0xdd, 0x80, 0x0, 0x61, 0x0, 0x8,
-    0xb0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
-    0x7, 0x90, 0x0, 0x2b, 0xbe, 0xb0, 0x0, 0x0,
-    0x0, 0x5, 0xc0, 0x0, 0x0, 0x0, 0xb, 0x30,
-    0x0, 0x0, 0x0, 0xc2, 0x4a, 0x20, 0x0, 0x8b,
-    0x0, 0x4b, 0xdd, 0xd8, 0x0,
-
-    /* U+0438 "и" */
-    0x1d, 0x0, 0x0, 0x0, 0xd5, 0x1d, 0x0, 0x0,
-    0xa, 0xe5, 0x1d, 0x0, 0x0, 0x6a, 0x95, 0x1d,
-    0x0, 0x3, 0xc0, 0x95, 0x1d, 0x0, 0x1d, 0x20,
-    0x95, 0x1d, 0x0, 0xc4, 0x0, 0x95, 0x1d, 0x9,
-    0x70, 0x0, 0x95, 0x1d, 0x5b, 0x0, 0x0, 0x95,
-    0x1e, 0xd1, 0x0, 0x0, 0x95, 0x1f, 0x20, 0x0,
-    0x0, 0x95,
-
-    /* U+0439 "й" */
-    0x0, 0x64, 0x0, 0x19, 0x0, 0x0, 0x1b, 0x0,
-    0x84, 0x0, 0x0, 0x4, 0xaa, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0xd5, 0x1d, 0x0, 0x0, 0xa, 0xe5, 0x1d, 0x0,
-    0x0, 0x6a, 0x95, 0x1d, 0x0, 0x3, 0xc0, 0x95,
-    0x1d, 0x0, 0x1d, 0x20, 0x95, 0x1d, 0x0, 0xc4,
-    0x0, 0x95, 0x1d, 0x9, 0x70, 0x0, 0x95, 0x1d,
-    0x5b, 0x0, 0x0, 0x95, 0x1e, 0xd1, 0x0, 0x0,
-    0x95, 0x1f, 0x20, 0x0, 0x0, 0x95,
-
-    /* U+043A "к" */
-    0x1d, 0x0, 0x0, 0xb, 0x41, 0xd0, 0x0, 0x9,
-    0x60, 0x1d, 0x0, 0x7, 0x80, 0x1, 0xd0, 0x5,
-    0xa0, 0x0, 0x1f, 0xdd, 0xf1, 0x0, 0x1, 0xd0,
-    0x7, 0xa0, 0x0, 0x1d, 0x0, 0xb, 0x50, 0x1,
-    0xd0, 0x0, 0x1d, 0x20, 0x1d, 0x0, 0x0, 0x3c,
-    0x1, 0xd0, 0x0, 0x0, 0x79,
-
-    /* U+043B "л" */
-    0x0, 0x5e, 0xdd, 0xdd, 0xf4, 0x0, 0x57, 0x0,
-    0x0, 0x94, 0x0, 0x66, 0x0, 0x0, 0x94, 0x0,
-    0x75, 0x0, 0x0, 0x94, 0x0, 0x84, 0x0, 0x0,
-    0x94, 0x0, 0x93, 0x0, 0x0, 0x94, 0x0, 0xb1,
-    0x0, 0x0, 0x94, 0x0, 0xd0, 0x0, 0x0, 0x94,
-    0x5, 0x90, 0x0, 0x0, 0x94, 0xbd, 0x10, 0x0,
-    0x0, 0x94,
-
-    /* U+043C "м" */
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0xe2, 0x1e, 0xa0,
-    0x0, 0x0, 0x8, 0xf2, 0x1c, 0xa3, 0x0, 0x0,
-    0x1b, 0xa2, 0x1c, 0x2c, 0x0, 0x0, 0xa3, 0xa2,
-    0x1c, 0x8, 0x50, 0x3, 0xa0, 0xa2, 0x1c, 0x0,
-    0xc0, 0xb, 0x10, 0xa2, 0x1c, 0x0, 0x67, 0x58,
-    0x0, 0xa2, 0x1c, 0x0, 0xc, 0xc0, 0x0, 0xa2,
-    0x1c, 0x0, 0x4, 0x50, 0x0, 0xa2, 0x1c, 0x0,
-    0x0, 0x0, 0x0, 0xa2,
-
-    /* U+043D "н" */
-    0x1d, 0x0, 0x0, 0x0, 0xc1, 0x1d, 0x0, 0x0,
-    0x0, 0xc1, 0x1d, 0x0, 0x0, 0x0, 0xc1, 0x1d,
-    0x0, 0x0, 0x0, 0xc1, 0x1d, 0x0, 0x0, 0x0,
-    0xc1, 0x1f, 0xdd, 0xdd, 0xdd, 0xf1, 0x1d, 0x0,
-    0x0, 0x0, 0xc1, 0x1d, 0x0, 0x0, 0x0, 0xc1,
-    0x1d, 0x0, 0x0, 0x0, 0xc1, 0x1d, 0x0, 0x0,
-    0x0, 0xc1,
-
-    /* U+043E "о" */
-    0x0, 0x7, 0xdd, 0xda, 0x20, 0x0, 0xb, 0x91,
-    0x0, 0x5d, 0x20, 0x6, 0x90, 0x0, 0x0, 0x3c,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0xc3, 0xe, 0x0,
-    0x0, 0x0, 0x9, 0x50, 0xe0, 0x0, 0x0, 0x0,
-    0x95, 0xd, 0x20, 0x0, 0x0, 0xc, 0x30, 0x69,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0xb9, 0x10, 0x5,
-    0xd2, 0x0, 0x0, 0x7d, 0xdd, 0xa2, 0x0,
-
-    /* U+043F "п" */
-    0x1f, 0xdd, 0xdd, 0xdd, 0xf2, 0x1d, 0x0, 0x0,
-    0x0, 0xc2, 0x1d, 0x0, 0x0, 0x0, 0xc2, 0x1d,
-    0x0, 0x0, 0x0, 0xc2, 0x1d, 0x0, 0x0, 0x0,
-    0xc2, 0x1d, 0x0, 0x0, 0x0, 0xc2, 0x1d, 0x0,
-    0x0, 0x0, 0xc2, 0x1d, 0x0, 0x0, 0x0, 0xc2,
-    0x1d, 0x0, 0x0, 0x0, 0xc2, 0x1d, 0x0, 0x0,
-    0x0, 0xc2,
-
-    /* U+0440 "р" */
-    0xd, 0x6, 0xdd, 0xea, 0x10, 0x0, 0xd9, 0x80,
-    0x0, 0x5d, 0x20, 0xf, 0x80, 0x0, 0x0, 0x4c,
-    0x0, 0xf1, 0x0, 0x0, 0x0, 0xd2, 0xe, 0x0,
-    0x0, 0x0, 0x9, 0x40, 0xe0, 0x0, 0x0, 0x0,
-    0x94, 0xf, 0x10, 0x0, 0x0, 0xd, 0x20, 0xf8,
-    0x0, 0x0, 0x4, 0xc0, 0xd, 0x98, 0x0, 0x5,
-    0xd2, 0x0, 0xd0, 0x6d, 0xde, 0xa2, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x7, 0xdd, 0xda, 0x20, 0x0, 0xb9, 0x10,
-    0x4, 0xd1, 0x6, 0x90, 0x0, 0x0, 0x10, 0xd,
-    0x20, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0xd, 0x20,
-    0x0, 0x0, 0x0, 0x6, 0x90, 0x0, 0x0, 0x10,
-    0x0, 0xb9, 0x10, 0x4, 0xd1, 0x0, 0x7, 0xdd,
-    0xda, 0x20,
-
-    /* U+0442 "т" */
-    0xd, 0xdd, 0xef, 0xdd, 0xd3, 0x0, 0x0, 0x58,
-    0x0, 0x0, 0x0, 0x0, 0x58, 0x0, 0x0, 0x0,
-    0x0, 0x58, 0x0, 0x0, 0x0, 0x0, 0x58, 0x0,
-    0x0, 0x0, 0x0, 0x58, 0x0, 0x0, 0x0, 0x0,
-    0x58, 0x0, 0x0, 0x0, 0x0, 0x58, 0x0, 0x0,
-    0x0, 0x0, 0x58, 0x0, 0x0, 0x0, 0x0, 0x58,
-    0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x9, 0x50, 0x0, 0x0, 0x8, 0x60, 0x2c, 0x0,
-    0x0, 0x0, 0xd0, 0x0, 0xb3, 0x0, 0x0, 0x58,
-    0x0, 0x4, 0xa0, 0x0, 0xc, 0x20, 0x0, 0xd,
-    0x10, 0x3, 0xb0, 0x0, 0x0, 0x77, 0x0, 0x94,
-    0x0, 0x0, 0x1, 0xd0, 0xd, 0x0, 0x0, 0x0,
-    0x9, 0x56, 0x70, 0x0, 0x0, 0x0, 0x2c, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0x2, 0xc0,
-    0x0, 0x0, 0x14, 0x0, 0xb4, 0x0, 0x0, 0x1,
-    0xad, 0xd6, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x50,
-    0x0, 0x0, 0x0, 0x5, 0xbd, 0xfe, 0xda, 0x30,
-    0x0, 0xa, 0xb3, 0x8, 0x50, 0x4c, 0x70, 0x7,
-    0x90, 0x0, 0x85, 0x0, 0xc, 0x40, 0xd1, 0x0,
-    0x8, 0x50, 0x0, 0x4a, 0xe, 0x0, 0x0, 0x85,
-    0x0, 0x1, 0xd0, 0xe0, 0x0, 0x8, 0x50, 0x0,
-    0x1d, 0xd, 0x10, 0x0, 0x85, 0x0, 0x4, 0xa0,
-    0x7a, 0x0, 0x8, 0x50, 0x0, 0xc4, 0x0, 0xab,
-    0x30, 0x85, 0x4, 0xc7, 0x0, 0x0, 0x5b, 0xef,
-    0xed, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x85, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0x50, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x2d, 0x10, 0x0, 0xb, 0x40, 0x5a, 0x0, 0x7,
-    0x80, 0x0, 0x96, 0x3, 0xc0, 0x0, 0x0, 0xc3,
-    0xc2, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x6d, 0x90, 0x0, 0x0, 0x2d, 0xb, 0x50, 0x0,
-    0xc, 0x30, 0x1d, 0x20, 0x8, 0x70, 0x0, 0x4c,
-    0x4, 0xb0, 0x0, 0x0, 0x88,
-
-    /* U+0446 "ц" */
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x1, 0xd0, 0x0,
-    0x0, 0xe, 0x0, 0x1d, 0x0, 0x0, 0x0, 0xe0,
-    0x1, 0xd0, 0x0, 0x0, 0xe, 0x0, 0x1d, 0x0,
-    0x0, 0x0, 0xe0, 0x1, 0xd0, 0x0, 0x0, 0xe,
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0xe0, 0x1, 0xd0,
-    0x0, 0x0, 0xe, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0xe0, 0x1, 0xfd, 0xdd, 0xdd, 0xdf, 0xd7, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x58, 0x0, 0x0, 0x0, 0x0, 0x2, 0x40,
-
-    /* U+0447 "ч" */
-    0x1c, 0x0, 0x0, 0x3, 0xb1, 0xc0, 0x0, 0x0,
-    0x3b, 0x1c, 0x0, 0x0, 0x3, 0xb1, 0xc0, 0x0,
-    0x0, 0x3b, 0xe, 0x0, 0x0, 0x3, 0xb0, 0x9a,
-    0x10, 0x3, 0xab, 0x0, 0x7c, 0xdc, 0x96, 0xb0,
-    0x0, 0x0, 0x0, 0x3b, 0x0, 0x0, 0x0, 0x3,
-    0xb0, 0x0, 0x0, 0x0, 0x3b,
-
-    /* U+0448 "ш" */
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x1d,
-    0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x1d, 0x0,
-    0x0, 0x2b, 0x0, 0x0, 0x59, 0x1d, 0x0, 0x0,
-    0x2b, 0x0, 0x0, 0x59, 0x1d, 0x0, 0x0, 0x2b,
-    0x0, 0x0, 0x59, 0x1d, 0x0, 0x0, 0x2b, 0x0,
-    0x0, 0x59, 0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0,
-    0x59, 0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x1f,
-    0xdd, 0xdd, 0xef, 0xdd, 0xdd, 0xe9,
-
-    /* U+0449 "щ" */
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1d, 0x0, 0x0, 0x2b, 0x0, 0x0, 0x59, 0x0,
-    0x1f, 0xdd, 0xdd, 0xef, 0xdd, 0xdd, 0xef, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd1,
-
-    /* U+044A "ъ" */
-    0xd, 0xdd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0xbb, 0xb9, 0x10, 0x0, 0x0,
-    0xe0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0xc2, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xc2,
-    0x0, 0x0, 0xe0, 0x0, 0x4, 0xd0, 0x0, 0x0,
-    0xfc, 0xcc, 0xca, 0x10,
-
-    /* U+044B "ы" */
-    0x1d, 0x0, 0x0, 0x0, 0x0, 0xd1, 0xd0, 0x0,
-    0x0, 0x0, 0xd, 0x1d, 0x0, 0x0, 0x0, 0x0,
-    0xd1, 0xd0, 0x0, 0x0, 0x0, 0xd, 0x1f, 0xbb,
-    0xbb, 0x81, 0x0, 0xd1, 0xd0, 0x0, 0x5, 0xd0,
-    0xd, 0x1d, 0x0, 0x0, 0xb, 0x20, 0xd1, 0xd0,
-    0x0, 0x0, 0xb2, 0xd, 0x1d, 0x0, 0x0, 0x4d,
-    0x0, 0xd1, 0xfc, 0xcc, 0xca, 0x10, 0xd,
-
-    /* U+044C "ь" */
-    0x1d, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x0, 0x0,
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x1, 0xd0, 0x0,
-    0x0, 0x0, 0x1f, 0xbb, 0xbc, 0x91, 0x1, 0xd0,
-    0x0, 0x5, 0xd0, 0x1d, 0x0, 0x0, 0xb, 0x31,
-    0xd0, 0x0, 0x0, 0xb3, 0x1d, 0x0, 0x0, 0x4d,
-    0x1, 0xfc, 0xcc, 0xca, 0x20,
-
-    /* U+044D "э" */
-    0x4, 0xbc, 0xcc, 0x80, 0x0, 0x19, 0x10, 0x0,
-    0x6c, 0x10, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xd1, 0x0, 0xa, 0xcc, 0xcc,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0xa3, 0x0, 0x0,
-    0x0, 0x0, 0xd1, 0x0, 0x0, 0x0, 0x5, 0xa0,
-    0x2c, 0x20, 0x0, 0x6c, 0x10, 0x3, 0xbd, 0xcd,
-    0x80, 0x0,
-
-    /* U+044E "ю" */
-    0x1d, 0x0, 0x0, 0x5c, 0xdd, 0xa2, 0x0, 0x1d,
-    0x0, 0x8, 0xb1, 0x0, 0x4d, 0x30, 0x1d, 0x0,
-    0x3c, 0x0, 0x0, 0x3, 0xd0, 0x1d, 0x0, 0x95,
-    0x0, 0x0, 0x0, 0xb3, 0x1f, 0xee, 0xf2, 0x0,
-    0x0, 0x0, 0x86, 0x1d, 0x0, 0xc2, 0x0, 0x0,
-    0x0, 0x86, 0x1d, 0x0, 0x95, 0x0, 0x0, 0x0,
-    0xb3, 0x1d, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xd0,
-    0x1d, 0x0, 0x8, 0xb1, 0x0, 0x4d, 0x30, 0x1d,
-    0x0, 0x0, 0x5c, 0xdd, 0xa2, 0x0,
-
-    /* U+044F "я" */
-    0x4, 0xcd, 0xdd, 0xde, 0x4c, 0x20, 0x0, 0xd,
-    0xb4, 0x0, 0x0, 0xd, 0xc1, 0x0, 0x0, 0xd,
-    0xa3, 0x0, 0x0, 0xd, 0x4c, 0x20, 0x0, 0xd,
-    0x3, 0xdc, 0xbb, 0xbe, 0x1, 0xc1, 0x0, 0xd,
-    0xb, 0x30, 0x0, 0xd, 0x77, 0x0, 0x0, 0xd,
-
-    /* U+0450 "ѐ" */
-    0x0, 0xb, 0x80, 0x0, 0x0, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xdd, 0xd8,
-    0x0, 0x0, 0xc7, 0x0, 0x6, 0xc0, 0x7, 0x80,
-    0x0, 0x0, 0x78, 0xd, 0x10, 0x0, 0x0, 0xd,
-    0xf, 0xbb, 0xbb, 0xbb, 0xbc, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x10, 0x0, 0x0, 0x0, 0x6,
-    0x90, 0x0, 0x0, 0x10, 0x0, 0xb9, 0x10, 0x3,
-    0xd2, 0x0, 0x7, 0xdd, 0xdb, 0x30,
-
-    /* U+0451 "ё" */
-    0x0, 0x9, 0x70, 0x89, 0x0, 0x0, 0x2, 0x20,
-    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xdd, 0xd8, 0x0, 0x0, 0xc7, 0x0, 0x6,
-    0xc0, 0x7, 0x80, 0x0, 0x0, 0x78, 0xd, 0x10,
-    0x0, 0x0, 0xd, 0xf, 0xbb, 0xbb, 0xbb, 0xbc,
-    0xe, 0x0, 0x0, 0x0, 0x0, 0xc, 0x10, 0x0,
-    0x0, 0x0, 0x6, 0x90, 0x0, 0x0, 0x10, 0x0,
-    0xb9, 0x10, 0x3, 0xd2, 0x0, 0x7, 0xdd, 0xdb,
-    0x30,
-
-    /* U+0452 "ђ" */
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xcf, 0xbb, 0xbb,
-    0x50, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0x8, 0xdd, 0xd8, 0x0, 0x0, 0x1d,
-    0xa5, 0x0, 0xa, 0x90, 0x0, 0x1f, 0x60, 0x0,
-    0x0, 0xd1, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x95,
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x86, 0x0, 0x1d,
-    0x0, 0x0, 0x0, 0x86, 0x0, 0x1d, 0x0, 0x0,
-    0x0, 0x86, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x86,
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x86, 0x0, 0x1d,
-    0x0, 0x0, 0x0, 0x86, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0, 0x95,
-    0x0, 0x0, 0x0, 0x2, 0x0, 0xd2, 0x0, 0x0,
-    0x0, 0xb, 0xdd, 0x60,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0xb, 0x60, 0x0, 0x0, 0xb5, 0x0,
-    0x0, 0x4, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xdd, 0xdd, 0xd5, 0x1d, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x6, 0xcd, 0xdc, 0x50, 0x0, 0xa9, 0x10,
-    0x1, 0xa5, 0x6, 0x90, 0x0, 0x0, 0x0, 0xd,
-    0x10, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xcc, 0xcc, 0xc1, 0x0, 0xd, 0x10,
-    0x0, 0x0, 0x0, 0x6, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xa9, 0x10, 0x0, 0x74, 0x0, 0x6, 0xcc,
-    0xcc, 0x60,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x6d, 0xdd, 0xc5, 0x0, 0x6b, 0x0, 0x1,
-    0x70, 0xb, 0x30, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x1, 0xcb, 0x74, 0x0, 0x0, 0x0,
-    0x26, 0x9d, 0x80, 0x0, 0x0, 0x0, 0xc, 0x40,
-    0x0, 0x0, 0x0, 0x86, 0xb, 0x50, 0x0, 0x2d,
-    0x20, 0x29, 0xdd, 0xdb, 0x30,
-
-    /* U+0456 "і" */
-    0x3e, 0x1, 0x70, 0x0, 0x0, 0x0, 0x1d, 0x1,
-    0xd0, 0x1d, 0x1, 0xd0, 0x1d, 0x1, 0xd0, 0x1d,
-    0x1, 0xd0, 0x1d, 0x1, 0xd0,
-
-    /* U+0457 "ї" */
-    0x4c, 0x1e, 0x0, 0x30, 0x40, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x1, 0xd0, 0x0, 0x1d, 0x0, 0x1,
-    0xd0, 0x0, 0x1d, 0x0, 0x1, 0xd0, 0x0, 0x1d,
-    0x0, 0x1, 0xd0, 0x0, 0x1d, 0x0, 0x1, 0xd0,
-    0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x1, 0x70, 0x0, 0x3, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0xd0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0xd0, 0x0, 0x1, 0xd0,
-    0x10, 0x6, 0x90, 0x5c, 0xdb, 0x10,
-
-    /* U+0459 "љ" */
-    0x0, 0x5e, 0xdd, 0xdd, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x57, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x66, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x75, 0x0, 0x0, 0xbd, 0xbb, 0xba, 0x30,
-    0x0, 0x84, 0x0, 0x0, 0xb5, 0x0, 0x2, 0xd3,
-    0x0, 0x93, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x5a,
-    0x0, 0xb1, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x3b,
-    0x0, 0xd0, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x5a,
-    0x5, 0x90, 0x0, 0x0, 0xb5, 0x0, 0x3, 0xd3,
-    0xbd, 0x10, 0x0, 0x0, 0xbe, 0xee, 0xec, 0x40,
-
-    /* U+045A "њ" */
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xda, 0x20,
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x5, 0xd0,
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xb4,
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0xa3,
-    0x1d, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x3, 0xd0,
-    0x1d, 0x0, 0x0, 0x0, 0xfb, 0xbb, 0xca, 0x20,
-
-    /* U+045B "ћ" */
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xbf,
-    0xaa, 0xaa, 0x50, 0x0, 0x0, 0x1d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0x8, 0xdd, 0xd8, 0x0, 0x0, 0x1d,
-    0xa5, 0x0, 0x9, 0xa0, 0x0, 0x1f, 0x60, 0x0,
-    0x0, 0xd2, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x95,
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x86, 0x0, 0x1d,
-    0x0, 0x0, 0x0, 0x86, 0x0, 0x1d, 0x0, 0x0,
-    0x0, 0x86, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x86,
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x86, 0x0, 0x1d,
-    0x0, 0x0, 0x0, 0x86,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0xb, 0x50,
-    0x0, 0x0, 0x4, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0x0, 0x0, 0xb, 0x41, 0xd0,
-    0x0, 0x9, 0x60, 0x1d, 0x0, 0x7, 0x80, 0x1,
-    0xd0, 0x5, 0xa0, 0x0, 0x1f, 0xdd, 0xf1, 0x0,
-    0x1, 0xd0, 0x7, 0xa0, 0x0, 0x1d, 0x0, 0xb,
-    0x50, 0x1, 0xd0, 0x0, 0x1d, 0x20, 0x1d, 0x0,
-    0x0, 0x3c, 0x1, 0xd0, 0x0, 0x0, 0x79,
-
-    /* U+045D "ѝ" */
-    0x0, 0x3d, 0x30, 0x0, 0x0, 0x0, 0x2, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0,
-    0xd5, 0x1d, 0x0, 0x0, 0xa, 0xe5, 0x1d, 0x0,
-    0x0, 0x6a, 0x95, 0x1d, 0x0, 0x3, 0xc0, 0x95,
-    0x1d, 0x0, 0x1d, 0x20, 0x95, 0x1d, 0x0, 0xc4,
-    0x0, 0x95, 0x1d, 0x9, 0x70, 0x0, 0x95, 0x1d,
-    0x5b, 0x0, 0x0, 0x95, 0x1e, 0xd1, 0x0, 0x0,
-    0x95, 0x1f, 0x20, 0x0, 0x0, 0x95,
-
-    /* U+045E "ў" */
-    0x0, 0x5, 0x0, 0x4, 0x10, 0x0, 0x0, 0xa3,
-    0x1, 0xb0, 0x0, 0x0, 0x1, 0x9a, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x50,
-    0x0, 0x0, 0x8, 0x60, 0x2c, 0x0, 0x0, 0x0,
-    0xd0, 0x0, 0xb3, 0x0, 0x0, 0x58, 0x0, 0x4,
-    0xa0, 0x0, 0xc, 0x20, 0x0, 0xd, 0x10, 0x3,
-    0xb0, 0x0, 0x0, 0x77, 0x0, 0x94, 0x0, 0x0,
-    0x1, 0xd0, 0xd, 0x0, 0x0, 0x0, 0x9, 0x56,
-    0x70, 0x0, 0x0, 0x0, 0x2c, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0,
-    0x14, 0x0, 0xb4, 0x0, 0x0, 0x1, 0xad, 0xd6,
-    0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x1d, 0x0, 0x0, 0x6, 0x71, 0xd0, 0x0, 0x0,
-    0x67, 0x1d, 0x0, 0x0, 0x6, 0x71, 0xd0, 0x0,
-    0x0, 0x67, 0x1d, 0x0, 0x0, 0x6, 0x71, 0xd0,
-    0x0, 0x0, 0x67, 0x1d, 0x0, 0x0, 0x6, 0x71,
-    0xd0, 0x0, 0x0, 0x67, 0x1d, 0x0, 0x0, 0x6,
-    0x71, 0xfd, 0xdd, 0xdd, 0xe7, 0x0, 0x0, 0xb2,
-    0x0, 0x0, 0x0, 0xb, 0x20, 0x0, 0x0, 0x0,
-    0x51, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0xd, 0x10, 0x0, 0x0, 0x0,
-    0xd1, 0x0, 0x0, 0x0, 0xd, 0x1b, 0xee, 0xee,
-    0xee, 0xe0, 0xb3, 0x0, 0x0, 0x0, 0xb, 0x30,
-    0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0, 0xb,
-    0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0, 0x0,
-    0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3, 0x0,
-    0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0xb3,
-    0x0, 0x0, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0xd, 0x1f,
-    0xdd, 0xdd, 0xb1, 0xd0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0x1, 0xd0, 0x0, 0x0, 0x1d, 0x0, 0x0,
-    0x1, 0xd0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x1,
-    0xd0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x1, 0xd0,
-    0x0, 0x0,
-
-    /* U+2013 "–" */
-    0xbb, 0xbb, 0xbb, 0xbb, 0xb0,
-
-    /* U+2014 "—" */
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb,
-
-    /* U+2018 "‘" */
-    0x36, 0x83, 0xd3, 0xd6,
-
-    /* U+2019 "’" */
-    0xc6, 0x96, 0x92, 0xa0, 0x10,
-
-    /* U+201A "‚" */
-    0x73, 0xd8, 0x74, 0xa0, 0x50,
-
-    /* U+201C "“" */
-    0x36, 0x7, 0x28, 0x30, 0xb0, 0xd3, 0x1e, 0x1d,
-    0x61, 0xe2,
-
-    /* U+201D "”" */
-    0xc6, 0x1e, 0x39, 0x60, 0xd2, 0x92, 0xb, 0xa,
-    0x1, 0x90, 0x10, 0x0, 0x0,
-
-    /* U+2026 "…" */
-    0x73, 0x1, 0x80, 0x3, 0x7c, 0x60, 0x2e, 0x20,
-    0x6c,
-
-    /* U+20B4 "₴" */
-    0x0, 0x6, 0xcd, 0xdd, 0xa3, 0x0, 0x0, 0x46,
-    0x10, 0x0, 0x4d, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x90,
-    0x1a, 0xaa, 0xaa, 0xaa, 0xac, 0xb8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xbc, 0xaa, 0xaa, 0xaa, 0xa8,
-    0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd1, 0x0, 0x0,
-    0x0, 0x30, 0x0, 0x5c, 0x30, 0x0, 0x3a, 0xa0,
-    0x0, 0x4, 0xbd, 0xdd, 0xb4, 0x0,
-
-    /* U+2116 "№" */
-    0x81, 0x0, 0x0, 0x0, 0x7, 0x10, 0x2, 0x89,
-    0x81, 0xe, 0xb0, 0x0, 0x0, 0x0, 0xc2, 0x3,
-    0xa1, 0x2, 0xb1, 0xea, 0x70, 0x0, 0x0, 0xc,
-    0x20, 0xa1, 0x0, 0x3, 0x7e, 0xd, 0x30, 0x0,
-    0x0, 0xc2, 0xa, 0x0, 0x0, 0x28, 0xe0, 0x2d,
-    0x10, 0x0, 0xc, 0x20, 0x67, 0x0, 0x9, 0x3e,
-    0x0, 0x6b, 0x0, 0x0, 0xc2, 0x0, 0x7a, 0x9a,
-    0x50, 0xe0, 0x0, 0x98, 0x0, 0xc, 0x20, 0x0,
-    0x0, 0x0, 0xe, 0x0, 0x0, 0xc4, 0x0, 0xc2,
-    0x2, 0x55, 0x55, 0x51, 0xe0, 0x0, 0x2, 0xd2,
-    0xc, 0x20, 0x25, 0x55, 0x55, 0x1e, 0x0, 0x0,
-    0x5, 0xc0, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xe0,
-    0x0, 0x0, 0x8, 0x9c, 0x20, 0x0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0x0, 0x1e, 0x20,
-    0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 74, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 73, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20, .adv_w = 103, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 33, .adv_w = 199, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 111, .adv_w = 175, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 210, .adv_w = 235, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 301, .adv_w = 189, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 385, .adv_w = 56, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 390, .adv_w = 92, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 417, .adv_w = 93, .box_w = 4, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 453, .adv_w = 108, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 478, .adv_w = 164, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 514, .adv_w = 58, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 519, .adv_w = 110, .box_w = 5, .box_h = 1, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 522, .adv_w = 58, .box_w = 2, .box_h = 2, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 524, .adv_w = 92, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 596, .adv_w = 190, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 668, .adv_w = 102, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 701, .adv_w = 162, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 766, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 831, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 909, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 974, .adv_w = 173, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1046, .adv_w = 167, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1111, .adv_w = 182, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1183, .adv_w = 173, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1248, .adv_w = 58, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1258, .adv_w = 58, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1271, .adv_w = 164, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1307, .adv_w = 164, .box_w = 8, .box_h = 5, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 1327, .adv_w = 164, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1363, .adv_w = 162, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1422, .adv_w = 298, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1575, .adv_w = 203, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1660, .adv_w = 217, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1732, .adv_w = 203, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1810, .adv_w = 238, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1888, .adv_w = 193, .box_w = 9, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1947, .adv_w = 182, .box_w = 9, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2006, .adv_w = 223, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2091, .adv_w = 234, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2163, .adv_w = 85, .box_w = 2, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2176, .adv_w = 141, .box_w = 8, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2228, .adv_w = 202, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2300, .adv_w = 168, .box_w = 9, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2359, .adv_w = 275, .box_w = 14, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2450, .adv_w = 234, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2522, .adv_w = 241, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2620, .adv_w = 206, .box_w = 10, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2685, .adv_w = 241, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2805, .adv_w = 207, .box_w = 10, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2870, .adv_w = 175, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2942, .adv_w = 162, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3014, .adv_w = 228, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3086, .adv_w = 198, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3171, .adv_w = 316, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3301, .adv_w = 185, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3379, .adv_w = 180, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3457, .adv_w = 186, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3529, .adv_w = 88, .box_w = 4, .box_h = 18, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 3565, .adv_w = 92, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 3637, .adv_w = 88, .box_w = 4, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 3673, .adv_w = 164, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 3705, .adv_w = 144, .box_w = 9, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3710, .adv_w = 173, .box_w = 5, .box_h = 3, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 3718, .adv_w = 168, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3758, .adv_w = 194, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3835, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3885, .adv_w = 194, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3962, .adv_w = 172, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4012, .adv_w = 94, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4061, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4138, .adv_w = 194, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4208, .adv_w = 75, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4229, .adv_w = 77, .box_w = 6, .box_h = 18, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 4283, .adv_w = 168, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4353, .adv_w = 75, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4367, .adv_w = 306, .box_w = 17, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4452, .adv_w = 194, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4502, .adv_w = 179, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4557, .adv_w = 194, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4634, .adv_w = 194, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4711, .adv_w = 113, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4741, .adv_w = 138, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4781, .adv_w = 115, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4823, .adv_w = 193, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4873, .adv_w = 152, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4923, .adv_w = 248, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5003, .adv_w = 149, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5048, .adv_w = 152, .box_w = 11, .box_h = 14, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 5125, .adv_w = 145, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5170, .adv_w = 92, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5215, .adv_w = 84, .box_w = 2, .box_h = 18, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 5233, .adv_w = 92, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5278, .adv_w = 164, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 5292, .adv_w = 131, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 5324, .adv_w = 131, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 5356, .adv_w = 188, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5433, .adv_w = 188, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5510, .adv_w = 236, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5608, .adv_w = 164, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5685, .adv_w = 203, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5757, .adv_w = 179, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5822, .adv_w = 87, .box_w = 2, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5835, .adv_w = 85, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5878, .adv_w = 149, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5930, .adv_w = 342, .box_w = 21, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6067, .adv_w = 342, .box_w = 19, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6191, .adv_w = 238, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6282, .adv_w = 200, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6376, .adv_w = 238, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6470, .adv_w = 193, .box_w = 12, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6572, .adv_w = 232, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 6660, .adv_w = 211, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6745, .adv_w = 208, .box_w = 10, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6810, .adv_w = 216, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6882, .adv_w = 164, .box_w = 9, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6941, .adv_w = 226, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 7053, .adv_w = 188, .box_w = 9, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7112, .adv_w = 287, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7229, .adv_w = 176, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7294, .adv_w = 238, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7366, .adv_w = 238, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7460, .adv_w = 200, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7532, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7610, .adv_w = 278, .box_w = 14, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7701, .adv_w = 237, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7773, .adv_w = 246, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7864, .adv_w = 238, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7936, .adv_w = 203, .box_w = 10, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8001, .adv_w = 206, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8079, .adv_w = 166, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8151, .adv_w = 193, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8229, .adv_w = 262, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8333, .adv_w = 183, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8405, .adv_w = 237, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 8509, .adv_w = 205, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8581, .adv_w = 315, .box_w = 16, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8685, .adv_w = 321, .box_w = 18, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 8829, .adv_w = 234, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8920, .adv_w = 278, .box_w = 14, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9011, .adv_w = 204, .box_w = 10, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9076, .adv_w = 203, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9154, .adv_w = 313, .box_w = 17, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9265, .adv_w = 211, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9330, .adv_w = 166, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9370, .adv_w = 189, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9445, .adv_w = 173, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9490, .adv_w = 134, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9530, .adv_w = 184, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 9602, .adv_w = 175, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9652, .adv_w = 232, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9727, .adv_w = 151, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9772, .adv_w = 196, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9822, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9892, .adv_w = 164, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9937, .adv_w = 180, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9987, .adv_w = 226, .box_w = 12, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10047, .adv_w = 193, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10097, .adv_w = 182, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10152, .adv_w = 194, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10202, .adv_w = 197, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 10279, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10329, .adv_w = 131, .box_w = 10, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 10379, .adv_w = 157, .box_w = 11, .box_h = 14, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 10456, .adv_w = 221, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 10573, .adv_w = 148, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10618, .adv_w = 196, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 10690, .adv_w = 170, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10735, .adv_w = 264, .box_w = 14, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10805, .adv_w = 264, .box_w = 16, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 10901, .adv_w = 174, .box_w = 12, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 10961, .adv_w = 221, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11016, .adv_w = 159, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11061, .adv_w = 164, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11111, .adv_w = 247, .box_w = 14, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11181, .adv_w = 173, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11221, .adv_w = 179, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11291, .adv_w = 175, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11356, .adv_w = 192, .box_w = 12, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 11464, .adv_w = 134, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11520, .adv_w = 164, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11570, .adv_w = 150, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11615, .adv_w = 76, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11636, .adv_w = 75, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11669, .adv_w = 77, .box_w = 6, .box_h = 18, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 11723, .adv_w = 262, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11803, .adv_w = 270, .box_w = 16, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11883, .adv_w = 192, .box_w = 12, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 11967, .adv_w = 164, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12030, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12100, .adv_w = 157, .box_w = 11, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 12199, .adv_w = 183, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 12258, .adv_w = 164, .box_w = 9, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12330, .adv_w = 125, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12372, .adv_w = 144, .box_w = 9, .box_h = 1, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 12377, .adv_w = 288, .box_w = 18, .box_h = 1, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 12386, .adv_w = 58, .box_w = 2, .box_h = 4, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 12390, .adv_w = 58, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 12395, .adv_w = 58, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 12400, .adv_w = 102, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 12410, .adv_w = 102, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 12423, .adv_w = 175, .box_w = 9, .box_h = 2, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12432, .adv_w = 238, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12510, .adv_w = 344, .box_w = 19, .box_h = 13, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_18;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_18 = {
-#else
-lv_font_t montserrat_cyrillic_18 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 21,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_18,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_18*/
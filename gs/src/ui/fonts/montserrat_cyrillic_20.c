@@ -1,2797 +0,0 @@
-/*******************************************************************************
- * Size: 20 px
- * Bpp: 4
- * Opts: --bpp 4 --size 20 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_20.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_20
-#define MONTSERRAT_CYRILLIC_20 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_20
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xf, 0x10, 0xf1, 0xf, 0x0, 0xf0, 0xf, 0x0,
-    0xf0, 0xe, 0x0, 0xe0, 0xd, 0x0, 0xc0, 0x8,
-    0x0, 0x0, 0x0, 0x1, 0xa1, 0x2f, 0x30,
-
-    /* U+0022 "\"" */
-    0x86, 0x4, 0xa7, 0x60, 0x49, 0x75, 0x3, 0x97,
-    0x50, 0x39, 0x75, 0x3, 0x92, 0x10, 0x13,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x48, 0x0, 0x1, 0xb0, 0x0, 0x0,
-    0x0, 0x66, 0x0, 0x3, 0x90, 0x0, 0x0, 0x0,
-    0x84, 0x0, 0x5, 0x70, 0x0, 0x0, 0x0, 0xa2,
-    0x0, 0x7, 0x50, 0x0, 0x9, 0xdd, 0xfd, 0xdd,
-    0xdf, 0xdd, 0xd2, 0x0, 0x0, 0xc0, 0x0, 0xa,
-    0x20, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xc, 0x0,
-    0x0, 0x0, 0x1, 0xb0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0x3, 0x90, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0x5, 0x70, 0x0, 0x2a, 0x0, 0x0, 0x4d, 0xde,
-    0xed, 0xdd, 0xef, 0xdd, 0x70, 0x0, 0x8, 0x40,
-    0x0, 0x57, 0x0, 0x0, 0x0, 0xa, 0x20, 0x0,
-    0x75, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x93,
-    0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0xb1, 0x0,
-    0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x14, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0,
-    0x0, 0x6, 0xcf, 0xfe, 0xa4, 0x0, 0xa, 0xb3,
-    0x38, 0x5, 0xc6, 0x4, 0xc0, 0x3, 0x80, 0x0,
-    0x0, 0x87, 0x0, 0x38, 0x0, 0x0, 0x8, 0x70,
-    0x3, 0x80, 0x0, 0x0, 0x4e, 0x10, 0x38, 0x0,
-    0x0, 0x0, 0x8e, 0x86, 0x80, 0x0, 0x0, 0x0,
-    0x28, 0xde, 0xa5, 0x0, 0x0, 0x0, 0x3, 0x96,
-    0xcd, 0x20, 0x0, 0x0, 0x38, 0x0, 0x8c, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0xf1, 0x0, 0x0, 0x38,
-    0x0, 0xe, 0x17, 0x10, 0x3, 0x80, 0x3, 0xd0,
-    0x6e, 0x72, 0x38, 0x16, 0xe4, 0x0, 0x28, 0xdf,
-    0xfe, 0xa2, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x14, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x8a, 0xa8, 0x0, 0x0, 0x0, 0xb1, 0x0,
-    0x7, 0x50, 0x5, 0x70, 0x0, 0x7, 0x60, 0x0,
-    0xc, 0x0, 0x0, 0xc0, 0x0, 0x1b, 0x0, 0x0,
-    0x1a, 0x0, 0x0, 0xb0, 0x0, 0xb2, 0x0, 0x0,
-    0xb, 0x0, 0x0, 0xb0, 0x5, 0x80, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0xc0, 0x1c, 0x0, 0x0, 0x0,
-    0x6, 0x80, 0x8, 0x60, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x6b, 0xb6, 0x4, 0x90, 0x3a, 0xb9, 0x10,
-    0x0, 0x0, 0x0, 0xc, 0x1, 0xc1, 0x3, 0xb0,
-    0x0, 0x0, 0x0, 0x85, 0x8, 0x40, 0x0, 0x93,
-    0x0, 0x0, 0x3, 0xa0, 0xb, 0x10, 0x0, 0x56,
-    0x0, 0x0, 0xb, 0x10, 0xb, 0x0, 0x0, 0x56,
-    0x0, 0x0, 0x76, 0x0, 0x8, 0x30, 0x0, 0x84,
-    0x0, 0x2, 0xb0, 0x0, 0x2, 0xa0, 0x1, 0xb0,
-    0x0, 0xb, 0x20, 0x0, 0x0, 0x4a, 0xaa, 0x20,
-
-    /* U+0026 "&" */
-    0x0, 0x1a, 0xdd, 0xc3, 0x0, 0x0, 0x0, 0xc6,
-    0x0, 0x3d, 0x0, 0x0, 0x1, 0xd0, 0x0, 0xb,
-    0x30, 0x0, 0x1, 0xd0, 0x0, 0xc, 0x20, 0x0,
-    0x0, 0xd3, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x3d,
-    0x18, 0xb1, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x9b, 0x8b, 0x0, 0x0, 0x0,
-    0xb, 0x80, 0x9, 0xa0, 0x0, 0x60, 0x79, 0x0,
-    0x0, 0xa9, 0x1, 0xc0, 0xd1, 0x0, 0x0, 0xb,
-    0x76, 0x80, 0xf0, 0x0, 0x0, 0x0, 0xce, 0x20,
-    0xb5, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x2e, 0x60,
-    0x0, 0x3b, 0x92, 0xd3, 0x2, 0x9e, 0xee, 0xb4,
-    0x0, 0x28,
-
-    /* U+0027 "'" */
-    0x86, 0x76, 0x75, 0x75, 0x75, 0x21,
-
-    /* U+0028 "(" */
-    0x0, 0xc3, 0x4, 0xb0, 0xa, 0x50, 0xe, 0x0,
-    0x3b, 0x0, 0x68, 0x0, 0x96, 0x0, 0xa4, 0x0,
-    0xb3, 0x0, 0xc3, 0x0, 0xb3, 0x0, 0xa4, 0x0,
-    0x96, 0x0, 0x68, 0x0, 0x3b, 0x0, 0xe, 0x0,
-    0xa, 0x50, 0x3, 0xb0, 0x0, 0xc3,
-
-    /* U+0029 ")" */
-    0xc, 0x30, 0x0, 0x4a, 0x0, 0x0, 0xe1, 0x0,
-    0x9, 0x60, 0x0, 0x5a, 0x0, 0x1, 0xd0, 0x0,
-    0xf, 0x0, 0x0, 0xe1, 0x0, 0xd, 0x20, 0x0,
-    0xc3, 0x0, 0xd, 0x20, 0x0, 0xe1, 0x0, 0xf,
-    0x0, 0x1, 0xd0, 0x0, 0x5a, 0x0, 0x9, 0x60,
-    0x0, 0xd1, 0x0, 0x4a, 0x0, 0xc, 0x20, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x9, 0x10, 0x0, 0x22, 0x9, 0x10, 0x40,
-    0x2b, 0x79, 0x4b, 0x70, 0x0, 0x6f, 0xd1, 0x0,
-    0x6, 0xcc, 0xaa, 0x20, 0x47, 0x9, 0x13, 0x90,
-    0x0, 0x9, 0x10, 0x0, 0x0, 0x3, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x20,
-    0x0, 0x0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0xc,
-    0x20, 0x0, 0x0, 0x0, 0xc2, 0x0, 0x8, 0xee,
-    0xef, 0xee, 0xed, 0x0, 0x0, 0xc2, 0x0, 0x0,
-    0x0, 0xc, 0x20, 0x0, 0x0, 0x0, 0xc2, 0x0,
-    0x0, 0x0, 0xb, 0x20, 0x0,
-
-    /* U+002C "," */
-    0x77, 0xac, 0x48, 0x84, 0xb0,
-
-    /* U+002D "-" */
-    0xbf, 0xff, 0xf5,
-
-    /* U+002E "." */
-    0x77, 0xaa,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x3,
-    0xb0, 0x0, 0x0, 0x0, 0x86, 0x0, 0x0, 0x0,
-    0xd, 0x10, 0x0, 0x0, 0x3, 0xb0, 0x0, 0x0,
-    0x0, 0x85, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0x3, 0xb0, 0x0, 0x0, 0x0, 0x95, 0x0,
-    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x3, 0xa0,
-    0x0, 0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x0,
-    0x95, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x4, 0xa0, 0x0, 0x0, 0x0, 0x94, 0x0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0x4, 0xa0, 0x0,
-    0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x8, 0xdf, 0xe9, 0x10, 0x0, 0x1, 0xd9,
-    0x20, 0x18, 0xe2, 0x0, 0xa, 0x80, 0x0, 0x0,
-    0x5d, 0x0, 0x3e, 0x0, 0x0, 0x0, 0xb, 0x50,
-    0x88, 0x0, 0x0, 0x0, 0x5, 0xa0, 0xb4, 0x0,
-    0x0, 0x0, 0x1, 0xe0, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xf0,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xb4, 0x0,
-    0x0, 0x0, 0x1, 0xe0, 0x88, 0x0, 0x0, 0x0,
-    0x5, 0xa0, 0x3e, 0x0, 0x0, 0x0, 0xb, 0x50,
-    0xa, 0x80, 0x0, 0x0, 0x5d, 0x0, 0x1, 0xd9,
-    0x20, 0x18, 0xe2, 0x0, 0x0, 0x8, 0xdf, 0xe9,
-    0x10, 0x0,
-
-    /* U+0031 "1" */
-    0xcf, 0xff, 0xa0, 0x0, 0x6a, 0x0, 0x6, 0xa0,
-    0x0, 0x6a, 0x0, 0x6, 0xa0, 0x0, 0x6a, 0x0,
-    0x6, 0xa0, 0x0, 0x6a, 0x0, 0x6, 0xa0, 0x0,
-    0x6a, 0x0, 0x6, 0xa0, 0x0, 0x6a, 0x0, 0x6,
-    0xa0, 0x0, 0x6a, 0x0, 0x6, 0xa0,
-
-    /* U+0032 "2" */
-    0x0, 0x7c, 0xff, 0xe9, 0x10, 0x2, 0xd9, 0x30,
-    0x2, 0x9d, 0x10, 0x25, 0x0, 0x0, 0x0, 0xa8,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0x80, 0x0, 0x0, 0x0, 0x2, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0x60,
-
-    /* U+0033 "3" */
-    0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0x10, 0x0, 0x0, 0x0, 0xc, 0x60,
-    0x0, 0x0, 0x0, 0x7, 0xb0, 0x0, 0x0, 0x0,
-    0x2, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x7b, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfd, 0x92, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x41, 0x0, 0x0, 0x0, 0x5c, 0x5,
-    0xe8, 0x30, 0x1, 0x7e, 0x30, 0x1, 0x8d, 0xff,
-    0xea, 0x20, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x19, 0x0, 0x0, 0x2, 0xd1,
-    0x0, 0x2, 0xd0, 0x0, 0x0, 0xd4, 0x0, 0x0,
-    0x2d, 0x0, 0x0, 0x98, 0x0, 0x0, 0x2, 0xd0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x2, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xdf, 0xff, 0xff, 0xf9, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x2c, 0x0, 0x0, 0x0, 0x0, 0x4, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x69, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xd9, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0x8e, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xd3, 0x36, 0x0, 0x0, 0x0, 0x4e, 0x1,
-    0xdb, 0x40, 0x1, 0x6e, 0x40, 0x0, 0x6b, 0xef,
-    0xea, 0x30, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x5, 0xce, 0xfe, 0xb2, 0x0, 0xb, 0xb3,
-    0x0, 0x5, 0x20, 0x9, 0x90, 0x0, 0x0, 0x0,
-    0x2, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x88, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xd2, 0x7, 0xde, 0xea, 0x30, 0xe, 0x2c,
-    0x71, 0x0, 0x5e, 0x50, 0xdb, 0x50, 0x0, 0x0,
-    0x3e, 0xc, 0xd0, 0x0, 0x0, 0x0, 0xc4, 0x9b,
-    0x0, 0x0, 0x0, 0xa, 0x54, 0xd0, 0x0, 0x0,
-    0x0, 0xc4, 0xc, 0x50, 0x0, 0x0, 0x3e, 0x0,
-    0x2d, 0x71, 0x0, 0x5e, 0x40, 0x0, 0x19, 0xde,
-    0xeb, 0x30, 0x0,
-
-    /* U+0037 "7" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xb0, 0x0,
-    0x0, 0x0, 0xb6, 0x5b, 0x0, 0x0, 0x0, 0x2e,
-    0x4, 0x90, 0x0, 0x0, 0x8, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x0,
-    0x0, 0x3, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x5c, 0xee, 0xea, 0x20, 0x0, 0x8c, 0x30,
-    0x1, 0x6e, 0x30, 0x3e, 0x0, 0x0, 0x0, 0x5d,
-    0x7, 0x90, 0x0, 0x0, 0x0, 0xf1, 0x79, 0x0,
-    0x0, 0x0, 0xf, 0x13, 0xe0, 0x0, 0x0, 0x4,
-    0xd0, 0x9, 0xc2, 0x0, 0x5, 0xe3, 0x0, 0xb,
-    0xff, 0xff, 0xf6, 0x0, 0x1d, 0x81, 0x0, 0x3,
-    0xc9, 0xa, 0x70, 0x0, 0x0, 0x0, 0xc5, 0xf1,
-    0x0, 0x0, 0x0, 0x7, 0x9e, 0x10, 0x0, 0x0,
-    0x0, 0x79, 0xa7, 0x0, 0x0, 0x0, 0xd, 0x41,
-    0xe9, 0x20, 0x0, 0x4c, 0xa0, 0x1, 0x8d, 0xee,
-    0xeb, 0x50, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x3a, 0xee, 0xd9, 0x10, 0x0, 0x4e, 0x50,
-    0x0, 0x6d, 0x20, 0xe, 0x40, 0x0, 0x0, 0x4d,
-    0x3, 0xd0, 0x0, 0x0, 0x0, 0xc4, 0x5b, 0x0,
-    0x0, 0x0, 0xa, 0x93, 0xd0, 0x0, 0x0, 0x0,
-    0xdc, 0xe, 0x40, 0x0, 0x0, 0x4a, 0xe0, 0x4e,
-    0x60, 0x1, 0x7c, 0x2e, 0x0, 0x3a, 0xee, 0xd7,
-    0x1, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x15, 0x10, 0x3, 0xbb, 0x0, 0x2, 0xae, 0xfe,
-    0xc6, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0xaa, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x77, 0xaa,
-
-    /* U+003B ";" */
-    0xaa, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x77, 0xac, 0x48, 0x84, 0xb0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x6,
-    0xda, 0x0, 0x2, 0x8d, 0x82, 0x0, 0x4b, 0xc6,
-    0x0, 0x0, 0x8d, 0x30, 0x0, 0x0, 0x2, 0xad,
-    0x71, 0x0, 0x0, 0x0, 0x17, 0xd9, 0x20, 0x0,
-    0x0, 0x0, 0x5c, 0xc5, 0x0, 0x0, 0x0, 0x3,
-    0x90,
-
-    /* U+003D "=" */
-    0x7e, 0xee, 0xee, 0xee, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xee,
-    0xee, 0xee, 0xed,
-
-    /* U+003E ">" */
-    0x20, 0x0, 0x0, 0x0, 0x5, 0xd8, 0x20, 0x0,
-    0x0, 0x0, 0x6c, 0xb4, 0x0, 0x0, 0x0, 0x3,
-    0xad, 0x70, 0x0, 0x0, 0x0, 0x19, 0xe0, 0x0,
-    0x0, 0x4b, 0xc5, 0x0, 0x17, 0xda, 0x30, 0x2,
-    0x9d, 0x71, 0x0, 0x0, 0x65, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x1, 0x8d, 0xff, 0xd8, 0x10, 0x3e, 0x82, 0x0,
-    0x2a, 0xd0, 0x44, 0x0, 0x0, 0x0, 0xc7, 0x0,
-    0x0, 0x0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x0,
-    0x88, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x0, 0x0,
-    0x0, 0xb, 0x80, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x9, 0xa0, 0x0, 0x0, 0x0, 0xf,
-    0x10, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x39, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0x10, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x4, 0x9c, 0xcc, 0xcc, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xa3, 0x0, 0x0, 0x5,
-    0xb9, 0x0, 0x0, 0x0, 0x3d, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0x10, 0x0, 0x1d, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0x0, 0xb, 0x40,
-    0x0, 0x3b, 0xdc, 0xc5, 0xa, 0x40, 0x86, 0x2,
-    0xb0, 0x0, 0x5c, 0x20, 0x0, 0x78, 0xa4, 0x0,
-    0xc0, 0x85, 0x0, 0x2d, 0x10, 0x0, 0x0, 0x7e,
-    0x40, 0x9, 0x2b, 0x10, 0x8, 0x60, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x66, 0xd0, 0x0, 0xc2, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x4, 0x8d, 0x0, 0xd,
-    0x10, 0x0, 0x0, 0x0, 0xa4, 0x0, 0x38, 0xd0,
-    0x0, 0xc2, 0x0, 0x0, 0x0, 0xb, 0x40, 0x4,
-    0x8b, 0x10, 0x8, 0x70, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x66, 0x85, 0x0, 0x2e, 0x10, 0x0, 0x0,
-    0x8d, 0x40, 0xa, 0x22, 0xb0, 0x0, 0x6d, 0x40,
-    0x1, 0x99, 0x88, 0x3, 0xb0, 0xb, 0x40, 0x0,
-    0x3b, 0xed, 0xc6, 0x1, 0xcd, 0xb1, 0x0, 0x1d,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2b, 0x93, 0x0, 0x0, 0x17,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xdd,
-    0xdb, 0x60, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xed, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x86, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x10, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6a, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x2e,
-    0x0, 0x0, 0x0, 0x4, 0xc0, 0x0, 0xb, 0x50,
-    0x0, 0x0, 0xa, 0x60, 0x0, 0x4, 0xc0, 0x0,
-    0x0, 0x2e, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0,
-    0x88, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0xee,
-    0xee, 0xee, 0xee, 0xef, 0x10, 0x6, 0xb0, 0x0,
-    0x0, 0x0, 0x9, 0x70, 0xd, 0x40, 0x0, 0x0,
-    0x0, 0x2, 0xe0, 0x4d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb5, 0xb6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4c,
-
-    /* U+0042 "B" */
-    0x9f, 0xee, 0xee, 0xee, 0xa3, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x6e, 0x50, 0x97, 0x0, 0x0, 0x0,
-    0x4, 0xd0, 0x97, 0x0, 0x0, 0x0, 0x0, 0xf1,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x97, 0x0,
-    0x0, 0x0, 0x5, 0xc0, 0x97, 0x0, 0x0, 0x1,
-    0x6d, 0x20, 0x9f, 0xee, 0xee, 0xef, 0xf7, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0x28, 0xd1, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x88, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0x97, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x89, 0x97, 0x0,
-    0x0, 0x0, 0x28, 0xe1, 0x9f, 0xee, 0xee, 0xee,
-    0xd8, 0x10,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x6c, 0xff, 0xeb, 0x50, 0x0, 0x3,
-    0xeb, 0x40, 0x1, 0x5c, 0xb0, 0x2, 0xe5, 0x0,
-    0x0, 0x0, 0x7, 0x10, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe5,
-    0x0, 0x0, 0x0, 0x7, 0x10, 0x3, 0xeb, 0x40,
-    0x1, 0x5c, 0xb0, 0x0, 0x0, 0x7c, 0xff, 0xeb,
-    0x40, 0x0,
-
-    /* U+0044 "D" */
-    0x9f, 0xff, 0xff, 0xfd, 0x93, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x1, 0x6d, 0x90, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0xab, 0x0, 0x97, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x60, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x97, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd3, 0x97, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa5, 0x97, 0x0, 0x0, 0x0, 0x0, 0x0, 0x96,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x97, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x60, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0xab, 0x0, 0x97, 0x0, 0x0, 0x2, 0x6e,
-    0x90, 0x0, 0x9f, 0xff, 0xff, 0xfd, 0x93, 0x0,
-    0x0,
-
-    /* U+0045 "E" */
-    0x9f, 0xff, 0xff, 0xff, 0xfc, 0x9, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x70, 0x0, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0x70, 0x0, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0x10,
-
-    /* U+0046 "F" */
-    0x9f, 0xff, 0xff, 0xff, 0xfc, 0x97, 0x0, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xd0, 0x97, 0x0, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x6c, 0xef, 0xeb, 0x60, 0x0, 0x3,
-    0xdb, 0x41, 0x1, 0x4b, 0xc1, 0x2, 0xe5, 0x0,
-    0x0, 0x0, 0x6, 0x20, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x32, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0x6a, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x96, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x9, 0x60,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x96, 0x2, 0xe5,
-    0x0, 0x0, 0x0, 0xa, 0x60, 0x3, 0xeb, 0x40,
-    0x1, 0x4b, 0xd2, 0x0, 0x0, 0x6c, 0xef, 0xeb,
-    0x60, 0x0,
-
-    /* U+0048 "H" */
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0x97, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0x97, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x3d,
-
-    /* U+0049 "I" */
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-    0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
-
-    /* U+004A "J" */
-    0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x88, 0x0, 0x0, 0x0, 0x8, 0x80, 0x0, 0x0,
-    0x0, 0x88, 0x0, 0x0, 0x0, 0x8, 0x80, 0x0,
-    0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0x8, 0x80,
-    0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0x8,
-    0x80, 0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0,
-    0x8, 0x70, 0x0, 0x0, 0x0, 0x97, 0x8, 0x0,
-    0x0, 0xd, 0x30, 0x8c, 0x30, 0x19, 0xc0, 0x0,
-    0x6d, 0xfe, 0xa1, 0x0,
-
-    /* U+004B "K" */
-    0x97, 0x0, 0x0, 0x0, 0x4, 0xd1, 0x97, 0x0,
-    0x0, 0x0, 0x3e, 0x20, 0x97, 0x0, 0x0, 0x2,
-    0xe3, 0x0, 0x97, 0x0, 0x0, 0x1d, 0x40, 0x0,
-    0x97, 0x0, 0x1, 0xd6, 0x0, 0x0, 0x97, 0x0,
-    0xc, 0x70, 0x0, 0x0, 0x97, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x97, 0x9, 0xec, 0x0, 0x0, 0x0,
-    0x97, 0x8c, 0xb, 0xa0, 0x0, 0x0, 0x9d, 0xd1,
-    0x0, 0xd6, 0x0, 0x0, 0x9d, 0x10, 0x0, 0x2e,
-    0x40, 0x0, 0x97, 0x0, 0x0, 0x4, 0xe1, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x9, 0xa0, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0xc7,
-
-    /* U+004C "L" */
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xf8,
-
-    /* U+004D "M" */
-    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xa9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xea, 0x9d,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x8d, 0xa9, 0x7d,
-    0x30, 0x0, 0x0, 0x0, 0x1d, 0x6a, 0x97, 0x5b,
-    0x0, 0x0, 0x0, 0x9, 0x65, 0xa9, 0x70, 0xc4,
-    0x0, 0x0, 0x2, 0xd0, 0x5a, 0x97, 0x3, 0xc0,
-    0x0, 0x0, 0xb5, 0x5, 0xa9, 0x70, 0xa, 0x50,
-    0x0, 0x3c, 0x0, 0x5a, 0x97, 0x0, 0x2d, 0x0,
-    0xc, 0x30, 0x5, 0xa9, 0x70, 0x0, 0x97, 0x4,
-    0xb0, 0x0, 0x5a, 0x97, 0x0, 0x1, 0xe1, 0xd2,
-    0x0, 0x5, 0xa9, 0x70, 0x0, 0x8, 0xd9, 0x0,
-    0x0, 0x5a, 0x97, 0x0, 0x0, 0xe, 0x10, 0x0,
-    0x5, 0xb9, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5b, 0x97, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xb0,
-
-    /* U+004E "N" */
-    0x9a, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x9f, 0x60,
-    0x0, 0x0, 0x0, 0x3d, 0x9a, 0xe2, 0x0, 0x0,
-    0x0, 0x3d, 0x97, 0x6d, 0x0, 0x0, 0x0, 0x3d,
-    0x97, 0xb, 0x90, 0x0, 0x0, 0x3d, 0x97, 0x1,
-    0xe5, 0x0, 0x0, 0x3d, 0x97, 0x0, 0x3e, 0x10,
-    0x0, 0x3d, 0x97, 0x0, 0x7, 0xc0, 0x0, 0x3d,
-    0x97, 0x0, 0x0, 0xc8, 0x0, 0x3d, 0x97, 0x0,
-    0x0, 0x1e, 0x40, 0x3d, 0x97, 0x0, 0x0, 0x4,
-    0xe1, 0x3d, 0x97, 0x0, 0x0, 0x0, 0x9b, 0x3d,
-    0x97, 0x0, 0x0, 0x0, 0xc, 0x9d, 0x97, 0x0,
-    0x0, 0x0, 0x2, 0xfd, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x5d,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x6c, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x3, 0xeb, 0x40, 0x1, 0x5c, 0xb1, 0x0, 0x2,
-    0xe5, 0x0, 0x0, 0x0, 0x8, 0xd0, 0x0, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x90, 0x5c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x1a, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa6, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x9e, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6a, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x9a, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa6, 0x5c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x10, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x90, 0x2, 0xe5, 0x0, 0x0, 0x0, 0x8,
-    0xd0, 0x0, 0x3, 0xeb, 0x40, 0x1, 0x5c, 0xb1,
-    0x0, 0x0, 0x0, 0x6c, 0xff, 0xeb, 0x50, 0x0,
-    0x0,
-
-    /* U+0050 "P" */
-    0x9f, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x97, 0x0,
-    0x0, 0x4, 0xbb, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0xa, 0x80, 0x97, 0x0, 0x0, 0x0, 0x2, 0xe0,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0x97, 0x0, 0x0, 0x0,
-    0x2, 0xe0, 0x97, 0x0, 0x0, 0x0, 0xb, 0x70,
-    0x97, 0x0, 0x0, 0x4, 0xbb, 0x0, 0x9f, 0xff,
-    0xff, 0xeb, 0x50, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x6c, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0x3e, 0xb4, 0x0, 0x15, 0xcb, 0x10, 0x0,
-    0x2, 0xe5, 0x0, 0x0, 0x0, 0x8, 0xd0, 0x0,
-    0xd, 0x60, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
-    0x5c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x60,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x90,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xa0,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x90,
-    0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x60,
-    0x5c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0xd, 0x60, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
-    0x2, 0xe5, 0x0, 0x0, 0x0, 0x8, 0xd0, 0x0,
-    0x0, 0x3e, 0xb4, 0x0, 0x15, 0xcb, 0x10, 0x0,
-    0x0, 0x0, 0x6c, 0xff, 0xfb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xe3, 0x0, 0x0, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x60, 0x6, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xad, 0xea, 0x10,
-
-    /* U+0052 "R" */
-    0x9f, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x97, 0x0,
-    0x0, 0x4, 0xbb, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0xa, 0x80, 0x97, 0x0, 0x0, 0x0, 0x2, 0xe0,
-    0x97, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0x97, 0x0, 0x0, 0x0,
-    0x2, 0xe0, 0x97, 0x0, 0x0, 0x0, 0xb, 0x70,
-    0x97, 0x0, 0x0, 0x4, 0xba, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x97, 0x0, 0x0, 0xc,
-    0x50, 0x0, 0x97, 0x0, 0x0, 0x2, 0xe1, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0xc, 0x50, 0x97, 0x0, 0x0, 0x0,
-    0x3, 0xe1,
-
-    /* U+0053 "S" */
-    0x0, 0x6c, 0xef, 0xea, 0x40, 0x0, 0xab, 0x30,
-    0x0, 0x5c, 0x60, 0x4c, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x70, 0x0, 0x0, 0x0, 0x0, 0x87, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xe8, 0x30, 0x0, 0x0, 0x0, 0x2,
-    0x8d, 0xea, 0x50, 0x0, 0x0, 0x0, 0x1, 0x6c,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xe1, 0x71, 0x0, 0x0, 0x0, 0x3d, 0x6,
-    0xe7, 0x20, 0x1, 0x6e, 0x40, 0x2, 0x8d, 0xff,
-    0xea, 0x20, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0xe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe, 0x20,
-    0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xb5, 0x0, 0x0, 0x0, 0x0, 0x78, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0xb5, 0x0, 0x0, 0x0, 0x0, 0x78, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0xa5, 0x0, 0x0, 0x0, 0x0, 0x78, 0xa6, 0x0,
-    0x0, 0x0, 0x0, 0x88, 0x88, 0x0, 0x0, 0x0,
-    0x0, 0xa6, 0x4d, 0x0, 0x0, 0x0, 0x0, 0xf1,
-    0xc, 0x60, 0x0, 0x0, 0x9, 0xa0, 0x2, 0xe9,
-    0x20, 0x3, 0xad, 0x10, 0x0, 0x18, 0xdf, 0xfd,
-    0x70, 0x0,
-
-    /* U+0056 "V" */
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6, 0x4d,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0xd, 0x40,
-    0x0, 0x0, 0x0, 0x7, 0x90, 0x6, 0xb0, 0x0,
-    0x0, 0x0, 0xe, 0x20, 0x0, 0xf1, 0x0, 0x0,
-    0x0, 0x5c, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0,
-    0xb5, 0x0, 0x0, 0x2e, 0x0, 0x0, 0x2, 0xe0,
-    0x0, 0x0, 0xc, 0x50, 0x0, 0x9, 0x80, 0x0,
-    0x0, 0x5, 0xc0, 0x0, 0xe, 0x10, 0x0, 0x0,
-    0x0, 0xe3, 0x0, 0x6a, 0x0, 0x0, 0x0, 0x0,
-    0x89, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x13, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x7a,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xee, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0,
-    0x0,
-
-    /* U+0057 "W" */
-    0x1f, 0x0, 0x0, 0x0, 0x0, 0xaa, 0x0, 0x0,
-    0x0, 0x0, 0xe0, 0xb, 0x50, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x6, 0xa0,
-    0x0, 0x0, 0x4, 0xab, 0x40, 0x0, 0x0, 0xa,
-    0x50, 0x1, 0xf0, 0x0, 0x0, 0x9, 0x56, 0xa0,
-    0x0, 0x0, 0xe, 0x10, 0x0, 0xc4, 0x0, 0x0,
-    0xe, 0x11, 0xe0, 0x0, 0x0, 0x4b, 0x0, 0x0,
-    0x79, 0x0, 0x0, 0x4b, 0x0, 0xb4, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x2e, 0x0, 0x0, 0x96, 0x0,
-    0x69, 0x0, 0x0, 0xe1, 0x0, 0x0, 0xd, 0x30,
-    0x0, 0xe1, 0x0, 0x1e, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x8, 0x90, 0x3, 0xb0, 0x0, 0xc, 0x30,
-    0x8, 0x70, 0x0, 0x0, 0x2, 0xe0, 0x9, 0x60,
-    0x0, 0x6, 0x90, 0xd, 0x20, 0x0, 0x0, 0x0,
-    0xd3, 0xe, 0x10, 0x0, 0x1, 0xe0, 0x2d, 0x0,
-    0x0, 0x0, 0x0, 0x88, 0x3c, 0x0, 0x0, 0x0,
-    0xc3, 0x88, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x87,
-    0x0, 0x0, 0x0, 0x78, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe2, 0x0, 0x0, 0x0, 0x2e, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0,
-    0x0, 0xd, 0x90, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0xd, 0x50, 0x0, 0x0, 0x0, 0x7b, 0x0, 0x3e,
-    0x10, 0x0, 0x0, 0x2e, 0x10, 0x0, 0x7b, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0xc6, 0x0, 0x8,
-    0x90, 0x0, 0x0, 0x2, 0xe2, 0x3, 0xd0, 0x0,
-    0x0, 0x0, 0x6, 0xc0, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x6d,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x60, 0x99, 0x0,
-    0x0, 0x0, 0x7, 0xb0, 0x0, 0xd4, 0x0, 0x0,
-    0x3, 0xe1, 0x0, 0x3, 0xe1, 0x0, 0x0, 0xd5,
-    0x0, 0x0, 0x8, 0xa0, 0x0, 0x8a, 0x0, 0x0,
-    0x0, 0xc, 0x60, 0x4d, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0x20,
-
-    /* U+0059 "Y" */
-    0x98, 0x0, 0x0, 0x0, 0x0, 0xe, 0x21, 0xe1,
-    0x0, 0x0, 0x0, 0x8, 0x80, 0x7, 0xa0, 0x0,
-    0x0, 0x2, 0xe0, 0x0, 0xd, 0x30, 0x0, 0x0,
-    0xa6, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0xb5, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x2, 0xe0, 0x6, 0xa0, 0x0, 0x0, 0x0, 0x9,
-    0x80, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xc0, 0x0,
-    0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30,
-
-    /* U+005B "[" */
-    0x9f, 0xe9, 0x97, 0x0, 0x97, 0x0, 0x97, 0x0,
-    0x97, 0x0, 0x97, 0x0, 0x97, 0x0, 0x97, 0x0,
-    0x97, 0x0, 0x97, 0x0, 0x97, 0x0, 0x97, 0x0,
-    0x97, 0x0, 0x97, 0x0, 0x97, 0x0, 0x97, 0x0,
-    0x97, 0x0, 0x97, 0x0, 0x9f, 0xe9,
-
-    /* U+005C "\\" */
-    0x42, 0x0, 0x0, 0x0, 0x59, 0x0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0,
-    0x4, 0x90, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0x0, 0xa4, 0x0, 0x0, 0x0, 0x4a, 0x0, 0x0,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0x9, 0x40, 0x0,
-    0x0, 0x4, 0xa0, 0x0, 0x0, 0x0, 0xd0, 0x0,
-    0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x4a, 0x0,
-    0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 0x9, 0x50,
-    0x0, 0x0, 0x3, 0xa0, 0x0, 0x0, 0x0, 0xd0,
-    0x0, 0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x3b,
-
-    /* U+005D "]" */
-    0x7e, 0xfb, 0x0, 0x5b, 0x0, 0x5b, 0x0, 0x5b,
-    0x0, 0x5b, 0x0, 0x5b, 0x0, 0x5b, 0x0, 0x5b,
-    0x0, 0x5b, 0x0, 0x5b, 0x0, 0x5b, 0x0, 0x5b,
-    0x0, 0x5b, 0x0, 0x5b, 0x0, 0x5b, 0x0, 0x5b,
-    0x0, 0x5b, 0x0, 0x5b, 0x7e, 0xfb,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x62, 0x0, 0x0, 0x0, 0x2e, 0x90,
-    0x0, 0x0, 0x8, 0x5d, 0x0, 0x0, 0x0, 0xd0,
-    0x76, 0x0, 0x0, 0x57, 0x1, 0xc0, 0x0, 0xc,
-    0x10, 0xa, 0x30, 0x2, 0xa0, 0x0, 0x49, 0x0,
-    0x94, 0x0, 0x0, 0xd0, 0xc, 0x0, 0x0, 0x7,
-    0x60,
-
-    /* U+005F "_" */
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-
-    /* U+0060 "`" */
-    0x6, 0x50, 0x0, 0x1, 0xb7, 0x0, 0x0, 0x8,
-    0x90,
-
-    /* U+0061 "a" */
-    0x3, 0xae, 0xee, 0xa2, 0x4, 0xd5, 0x0, 0x7,
-    0xe1, 0x1, 0x0, 0x0, 0xa, 0x70, 0x0, 0x0,
-    0x0, 0x6a, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x5b,
-    0xdd, 0xdd, 0xea, 0x5c, 0x20, 0x0, 0x5, 0xab,
-    0x40, 0x0, 0x0, 0x5a, 0xc4, 0x0, 0x0, 0xa,
-    0xa6, 0xc1, 0x0, 0x8, 0xaa, 0x6, 0xcc, 0xcb,
-    0x54, 0xa0,
-
-    /* U+0062 "b" */
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0xe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe2, 0x2a,
-    0xef, 0xe8, 0x10, 0xe, 0x5d, 0x50, 0x1, 0x8e,
-    0x20, 0xed, 0x20, 0x0, 0x0, 0x7c, 0xe, 0x70,
-    0x0, 0x0, 0x0, 0xd3, 0xe3, 0x0, 0x0, 0x0,
-    0x9, 0x6e, 0x10, 0x0, 0x0, 0x0, 0x78, 0xe3,
-    0x0, 0x0, 0x0, 0x9, 0x6e, 0x70, 0x0, 0x0,
-    0x0, 0xd3, 0xed, 0x20, 0x0, 0x0, 0x7c, 0xe,
-    0x4d, 0x50, 0x1, 0x8e, 0x20, 0xe1, 0x2a, 0xef,
-    0xe8, 0x10, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x4, 0xbe, 0xfd, 0x80, 0x0, 0x7, 0xd5,
-    0x0, 0x29, 0xc0, 0x3, 0xe1, 0x0, 0x0, 0x5,
-    0x0, 0xb6, 0x0, 0x0, 0x0, 0x0, 0xe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe1, 0x0, 0x0,
-    0x5, 0x0, 0x7, 0xd5, 0x0, 0x29, 0xc0, 0x0,
-    0x3, 0xbe, 0xfd, 0x80, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x96, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x96, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x96, 0x0, 0x0, 0x0, 0x0, 0x0, 0x96,
-    0x0, 0x4, 0xbe, 0xfc, 0x60, 0x96, 0x0, 0x7d,
-    0x40, 0x2, 0xaa, 0x96, 0x4, 0xe1, 0x0, 0x0,
-    0x9, 0xe6, 0xb, 0x60, 0x0, 0x0, 0x0, 0xf6,
-    0xe, 0x10, 0x0, 0x0, 0x0, 0xb6, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0x96, 0xe, 0x10, 0x0, 0x0,
-    0x0, 0xb6, 0xb, 0x60, 0x0, 0x0, 0x0, 0xf6,
-    0x3, 0xe1, 0x0, 0x0, 0x9, 0xe6, 0x0, 0x7d,
-    0x40, 0x2, 0xaa, 0x96, 0x0, 0x4, 0xbe, 0xfd,
-    0x60, 0x96,
-
-    /* U+0065 "e" */
-    0x0, 0x5, 0xce, 0xec, 0x40, 0x0, 0x8, 0xc3,
-    0x0, 0x3d, 0x70, 0x4, 0xc0, 0x0, 0x0, 0x1d,
-    0x30, 0xb4, 0x0, 0x0, 0x0, 0x6a, 0xe, 0x0,
-    0x0, 0x0, 0x1, 0xd0, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xcd, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb5,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xd1, 0x0, 0x0,
-    0x2, 0x0, 0x7, 0xd5, 0x0, 0x16, 0xd1, 0x0,
-    0x3, 0xbe, 0xfe, 0x91, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x8, 0xee, 0xb1, 0x0, 0x6c, 0x10, 0x20,
-    0x0, 0xa5, 0x0, 0x0, 0x0, 0xb4, 0x0, 0x0,
-    0x8e, 0xff, 0xee, 0x90, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x4, 0xbe, 0xdc, 0x70, 0x78, 0x0, 0x7d,
-    0x30, 0x0, 0x7b, 0x78, 0x3, 0xd1, 0x0, 0x0,
-    0x6, 0xe8, 0xb, 0x50, 0x0, 0x0, 0x0, 0xd8,
-    0xf, 0x10, 0x0, 0x0, 0x0, 0x88, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0x88, 0xe, 0x10, 0x0, 0x0,
-    0x0, 0x98, 0xa, 0x60, 0x0, 0x0, 0x0, 0xd8,
-    0x3, 0xe1, 0x0, 0x0, 0x7, 0xe8, 0x0, 0x7e,
-    0x50, 0x2, 0x9b, 0x88, 0x0, 0x4, 0xbf, 0xfd,
-    0x60, 0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5,
-    0x0, 0x10, 0x0, 0x0, 0x1, 0xe1, 0x1, 0xd8,
-    0x30, 0x0, 0x4d, 0x60, 0x0, 0x17, 0xce, 0xfe,
-    0xb4, 0x0,
-
-    /* U+0068 "h" */
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0xe2, 0x3b, 0xef, 0xd7,
-    0x0, 0xe6, 0xc3, 0x0, 0x3c, 0x90, 0xec, 0x0,
-    0x0, 0x1, 0xf1, 0xe6, 0x0, 0x0, 0x0, 0xa5,
-    0xe2, 0x0, 0x0, 0x0, 0x87, 0xe2, 0x0, 0x0,
-    0x0, 0x87, 0xe2, 0x0, 0x0, 0x0, 0x87, 0xe2,
-    0x0, 0x0, 0x0, 0x87, 0xe2, 0x0, 0x0, 0x0,
-    0x87, 0xe2, 0x0, 0x0, 0x0, 0x87, 0xe2, 0x0,
-    0x0, 0x0, 0x87,
-
-    /* U+0069 "i" */
-    0x1e, 0x40, 0x92, 0x0, 0x0, 0x0, 0xe, 0x20,
-    0xe2, 0xe, 0x20, 0xe2, 0xe, 0x20, 0xe2, 0xe,
-    0x20, 0xe2, 0xe, 0x20, 0xe2, 0xe, 0x20,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0xe6, 0x0, 0x0, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc3, 0x0,
-    0x0, 0xc3, 0x0, 0x0, 0xc3, 0x0, 0x0, 0xc3,
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0xc3, 0x0, 0x0,
-    0xc3, 0x0, 0x0, 0xc3, 0x0, 0x0, 0xc3, 0x0,
-    0x0, 0xc3, 0x0, 0x0, 0xc3, 0x0, 0x0, 0xc3,
-    0x0, 0x0, 0xd2, 0x30, 0x5, 0xd0, 0x6d, 0xec,
-    0x30,
-
-    /* U+006B "k" */
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0xe2, 0x0, 0x0, 0xb,
-    0x90, 0xe2, 0x0, 0x0, 0xb9, 0x0, 0xe2, 0x0,
-    0xb, 0x80, 0x0, 0xe2, 0x0, 0xc8, 0x0, 0x0,
-    0xe2, 0x1c, 0xd0, 0x0, 0x0, 0xe3, 0xd7, 0xd6,
-    0x0, 0x0, 0xee, 0x60, 0x2e, 0x20, 0x0, 0xe6,
-    0x0, 0x5, 0xd0, 0x0, 0xe2, 0x0, 0x0, 0x9a,
-    0x0, 0xe2, 0x0, 0x0, 0xd, 0x60, 0xe2, 0x0,
-    0x0, 0x2, 0xe2,
-
-    /* U+006C "l" */
-    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
-    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
-
-    /* U+006D "m" */
-    0xe1, 0x4b, 0xde, 0xc5, 0x0, 0x4b, 0xde, 0xc5,
-    0x0, 0xe6, 0xb2, 0x0, 0x3d, 0x56, 0xb2, 0x0,
-    0x2d, 0x60, 0xec, 0x0, 0x0, 0x3, 0xec, 0x0,
-    0x0, 0x2, 0xe0, 0xe5, 0x0, 0x0, 0x0, 0xe6,
-    0x0, 0x0, 0x0, 0xd3, 0xe2, 0x0, 0x0, 0x0,
-    0xc3, 0x0, 0x0, 0x0, 0xb4, 0xe2, 0x0, 0x0,
-    0x0, 0xc3, 0x0, 0x0, 0x0, 0xb4, 0xe2, 0x0,
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0xb4, 0xe2,
-    0x0, 0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0xb4,
-    0xe2, 0x0, 0x0, 0x0, 0xc3, 0x0, 0x0, 0x0,
-    0xb4, 0xe2, 0x0, 0x0, 0x0, 0xc3, 0x0, 0x0,
-    0x0, 0xb4, 0xe2, 0x0, 0x0, 0x0, 0xc3, 0x0,
-    0x0, 0x0, 0xb4,
-
-    /* U+006E "n" */
-    0xe1, 0x3b, 0xde, 0xd7, 0x0, 0xe6, 0xb2, 0x0,
-    0x2c, 0x90, 0xec, 0x0, 0x0, 0x1, 0xe1, 0xe5,
-    0x0, 0x0, 0x0, 0xa5, 0xe2, 0x0, 0x0, 0x0,
-    0x87, 0xe2, 0x0, 0x0, 0x0, 0x87, 0xe2, 0x0,
-    0x0, 0x0, 0x87, 0xe2, 0x0, 0x0, 0x0, 0x87,
-    0xe2, 0x0, 0x0, 0x0, 0x87, 0xe2, 0x0, 0x0,
-    0x0, 0x87, 0xe2, 0x0, 0x0, 0x0, 0x87,
-
-    /* U+006F "o" */
-    0x0, 0x4, 0xbe, 0xfd, 0x70, 0x0, 0x0, 0x7d,
-    0x40, 0x2, 0x9c, 0x10, 0x3, 0xe1, 0x0, 0x0,
-    0x8, 0xa0, 0xb, 0x60, 0x0, 0x0, 0x0, 0xe1,
-    0xe, 0x10, 0x0, 0x0, 0x0, 0xb5, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0x96, 0xe, 0x10, 0x0, 0x0,
-    0x0, 0xb5, 0xb, 0x60, 0x0, 0x0, 0x0, 0xe1,
-    0x3, 0xe1, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x7d,
-    0x40, 0x2, 0x9c, 0x10, 0x0, 0x4, 0xbe, 0xfd,
-    0x70, 0x0,
-
-    /* U+0070 "p" */
-    0xe1, 0x2a, 0xef, 0xe8, 0x10, 0xe, 0x4d, 0x50,
-    0x1, 0x8e, 0x20, 0xed, 0x20, 0x0, 0x0, 0x7c,
-    0xe, 0x70, 0x0, 0x0, 0x0, 0xd3, 0xe3, 0x0,
-    0x0, 0x0, 0x9, 0x6e, 0x10, 0x0, 0x0, 0x0,
-    0x78, 0xe3, 0x0, 0x0, 0x0, 0x9, 0x6e, 0x70,
-    0x0, 0x0, 0x0, 0xd3, 0xed, 0x20, 0x0, 0x0,
-    0x7c, 0xe, 0x5d, 0x50, 0x1, 0x8e, 0x20, 0xe2,
-    0x2a, 0xef, 0xe8, 0x10, 0xe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x4, 0xbe, 0xfd, 0x60, 0x96, 0x0, 0x7d,
-    0x40, 0x2, 0xaa, 0x96, 0x3, 0xe1, 0x0, 0x0,
-    0x9, 0xe6, 0xb, 0x60, 0x0, 0x0, 0x0, 0xf6,
-    0xe, 0x10, 0x0, 0x0, 0x0, 0xb6, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0x96, 0xe, 0x10, 0x0, 0x0,
-    0x0, 0xb6, 0xb, 0x60, 0x0, 0x0, 0x0, 0xf6,
-    0x3, 0xe1, 0x0, 0x0, 0x9, 0xe6, 0x0, 0x7d,
-    0x40, 0x2, 0xaa, 0x96, 0x0, 0x4, 0xbe, 0xfc,
-    0x60, 0x96, 0x0, 0x0, 0x0, 0x0, 0x0, 0x96,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x96, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x96, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x96,
-
-    /* U+0072 "r" */
-    0xe1, 0x4c, 0xe0, 0xe7, 0xb2, 0x0, 0xec, 0x0,
-    0x0, 0xe6, 0x0, 0x0, 0xe2, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0xe2, 0x0, 0x0, 0xe2, 0x0, 0x0,
-    0xe2, 0x0, 0x0, 0xe2, 0x0, 0x0, 0xe2, 0x0,
-    0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x7d, 0xee, 0xc7, 0x0, 0x9a, 0x10, 0x2,
-    0x84, 0xf, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0x0, 0x9, 0xc4, 0x0, 0x0, 0x0, 0x5,
-    0xbe, 0xd9, 0x30, 0x0, 0x0, 0x2, 0x6e, 0x60,
-    0x0, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x0, 0x3,
-    0xd3, 0xd5, 0x10, 0x2, 0xc6, 0x3, 0xae, 0xee,
-    0xc5, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x52, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x8e, 0xff, 0xee, 0x90,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0xa6, 0x0, 0x0,
-    0x0, 0x6c, 0x10, 0x30, 0x0, 0x8, 0xee, 0xb1,
-
-    /* U+0075 "u" */
-    0xf0, 0x0, 0x0, 0x0, 0xb4, 0xf0, 0x0, 0x0,
-    0x0, 0xb4, 0xf0, 0x0, 0x0, 0x0, 0xb4, 0xf0,
-    0x0, 0x0, 0x0, 0xb4, 0xf0, 0x0, 0x0, 0x0,
-    0xb4, 0xf0, 0x0, 0x0, 0x0, 0xb4, 0xf0, 0x0,
-    0x0, 0x0, 0xc4, 0xe2, 0x0, 0x0, 0x0, 0xf4,
-    0xa8, 0x0, 0x0, 0x7, 0xf4, 0x2e, 0x70, 0x1,
-    0x7b, 0xb4, 0x2, 0xae, 0xfd, 0x70, 0xb4,
-
-    /* U+0076 "v" */
-    0xb5, 0x0, 0x0, 0x0, 0xb, 0x44, 0xc0, 0x0,
-    0x0, 0x2, 0xd0, 0xd, 0x20, 0x0, 0x0, 0x96,
-    0x0, 0x79, 0x0, 0x0, 0xe, 0x0, 0x0, 0xe1,
-    0x0, 0x6, 0x90, 0x0, 0x9, 0x70, 0x0, 0xd2,
-    0x0, 0x0, 0x2d, 0x0, 0x4b, 0x0, 0x0, 0x0,
-    0xb4, 0xb, 0x40, 0x0, 0x0, 0x4, 0xb2, 0xd0,
-    0x0, 0x0, 0x0, 0xd, 0xb6, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x95, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x1,
-    0xd0, 0x4a, 0x0, 0x0, 0x5, 0xe9, 0x0, 0x0,
-    0x6, 0x80, 0xd, 0x10, 0x0, 0xb, 0x4e, 0x0,
-    0x0, 0xc, 0x20, 0x8, 0x60, 0x0, 0x1d, 0xa,
-    0x50, 0x0, 0x2c, 0x0, 0x2, 0xb0, 0x0, 0x67,
-    0x4, 0xa0, 0x0, 0x76, 0x0, 0x0, 0xd1, 0x0,
-    0xc1, 0x0, 0xd1, 0x0, 0xd1, 0x0, 0x0, 0x77,
-    0x2, 0xc0, 0x0, 0x86, 0x3, 0xb0, 0x0, 0x0,
-    0x1c, 0x8, 0x60, 0x0, 0x2c, 0x9, 0x50, 0x0,
-    0x0, 0xb, 0x2d, 0x0, 0x0, 0xc, 0x2d, 0x0,
-    0x0, 0x0, 0x6, 0xca, 0x0, 0x0, 0x6, 0xc9,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x1,
-    0xf4, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x1d, 0x30, 0x0, 0x0, 0xc4, 0x3, 0xd0, 0x0,
-    0x8, 0x80, 0x0, 0x7a, 0x0, 0x4c, 0x0, 0x0,
-    0xb, 0x61, 0xd2, 0x0, 0x0, 0x1, 0xec, 0x50,
-    0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x4,
-    0xd8, 0x90, 0x0, 0x0, 0x1e, 0x20, 0xc5, 0x0,
-    0x0, 0xb6, 0x0, 0x2e, 0x20, 0x7, 0xb0, 0x0,
-    0x5, 0xc0, 0x3d, 0x10, 0x0, 0x0, 0x99,
-
-    /* U+0079 "y" */
-    0xb, 0x50, 0x0, 0x0, 0x0, 0xb4, 0x4, 0xc0,
-    0x0, 0x0, 0x2, 0xd0, 0x0, 0xd3, 0x0, 0x0,
-    0x9, 0x60, 0x0, 0x69, 0x0, 0x0, 0x1e, 0x0,
-    0x0, 0xe, 0x10, 0x0, 0x78, 0x0, 0x0, 0x8,
-    0x70, 0x0, 0xd2, 0x0, 0x0, 0x2, 0xe0, 0x4,
-    0xa0, 0x0, 0x0, 0x0, 0xb5, 0xb, 0x30, 0x0,
-    0x0, 0x0, 0x4c, 0x2c, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x6, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x10, 0x0, 0x0, 0x35, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x2b, 0xee, 0x80, 0x0,
-    0x0, 0x0,
-
-    /* U+007A "z" */
-    0xe, 0xee, 0xee, 0xee, 0xf0, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0x6b, 0x0, 0x0,
-    0x0, 0x2, 0xe1, 0x0, 0x0, 0x0, 0xd, 0x40,
-    0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x5,
-    0xc0, 0x0, 0x0, 0x0, 0x2e, 0x20, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0,
-    0x0, 0x0, 0x1f, 0xee, 0xee, 0xee, 0xe2,
-
-    /* U+007B "{" */
-    0x0, 0x6e, 0xd0, 0xf, 0x20, 0x2, 0xd0, 0x0,
-    0x2d, 0x0, 0x2, 0xd0, 0x0, 0x2d, 0x0, 0x2,
-    0xd0, 0x0, 0x2d, 0x0, 0x4, 0xc0, 0xa, 0xf6,
-    0x0, 0x4, 0xc0, 0x0, 0x2d, 0x0, 0x2, 0xd0,
-    0x0, 0x2d, 0x0, 0x2, 0xd0, 0x0, 0x2d, 0x0,
-    0x2, 0xd0, 0x0, 0xf, 0x20, 0x0, 0x6e, 0xd0,
-
-    /* U+007C "|" */
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-    0x96, 0x96, 0x96,
-
-    /* U+007D "}" */
-    0x7e, 0xa0, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x69,
-    0x0, 0x0, 0x69, 0x0, 0x0, 0x69, 0x0, 0x0,
-    0x69, 0x0, 0x0, 0x69, 0x0, 0x0, 0x69, 0x0,
-    0x0, 0x5b, 0x0, 0x0, 0x1e, 0xe2, 0x0, 0x5b,
-    0x0, 0x0, 0x69, 0x0, 0x0, 0x69, 0x0, 0x0,
-    0x69, 0x0, 0x0, 0x69, 0x0, 0x0, 0x69, 0x0,
-    0x0, 0x69, 0x0, 0x0, 0xb6, 0x0, 0x7e, 0xa0,
-    0x0,
-
-    /* U+007E "~" */
-    0x8, 0xdb, 0x30, 0x0, 0xa0, 0x68, 0x2, 0xc5,
-    0x2, 0xb0, 0x91, 0x0, 0x19, 0xdc, 0x20,
-
-    /* U+00AB "«" */
-    0x0, 0x48, 0x1, 0xb0, 0x1, 0xc1, 0xa, 0x50,
-    0xb, 0x40, 0x69, 0x0, 0x78, 0x2, 0xc0, 0x0,
-    0xa6, 0x4, 0xb0, 0x0, 0xc, 0x20, 0x87, 0x0,
-    0x2, 0xc0, 0xc, 0x30, 0x0, 0x69, 0x2, 0xc0,
-
-    /* U+00BB "»" */
-    0xa, 0x10, 0x75, 0x0, 0x0, 0x3b, 0x0, 0xc2,
-    0x0, 0x0, 0x78, 0x2, 0xc0, 0x0, 0x0, 0xb4,
-    0x6, 0x90, 0x0, 0x9, 0x60, 0x4b, 0x0, 0x5,
-    0xa0, 0x1d, 0x10, 0x2, 0xc0, 0xb, 0x40, 0x0,
-    0xc2, 0x7, 0x80, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9a,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xfd, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x7, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0x20,
-
-    /* U+0401 "Ё" */
-    0x0, 0x2e, 0x10, 0xa8, 0x0, 0x0, 0x0, 0x60,
-    0x4, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x7, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xf0, 0x7, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xf2,
-
-    /* U+0402 "Ђ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x56, 0xad, 0xee, 0xb4, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x41, 0x1, 0x6e, 0x70,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0xb5,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x1, 0xe2,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x0, 0x2c, 0x80,
-    0x0, 0x0, 0xb, 0x40, 0x9, 0xee, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x73, 0x0, 0x0, 0x0, 0xb,
-    0x80, 0x0, 0x0, 0x1, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf2, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x7c, 0xff, 0xea, 0x40, 0x0, 0x2,
-    0xdb, 0x40, 0x1, 0x5c, 0xb0, 0x1, 0xe6, 0x0,
-    0x0, 0x0, 0x7, 0x10, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0xee,
-    0xee, 0xec, 0x0, 0x0, 0xa6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe6,
-    0x0, 0x0, 0x0, 0x8, 0x10, 0x2, 0xdb, 0x40,
-    0x1, 0x5d, 0xa0, 0x0, 0x0, 0x7c, 0xff, 0xea,
-    0x40, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x5b, 0xef, 0xeb, 0x50, 0x0, 0x8c, 0x40,
-    0x0, 0x4b, 0x80, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0x90, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x8c, 0xeb, 0x50, 0x0, 0x0, 0x0, 0x1, 0x5b,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xc3, 0x71, 0x0, 0x0, 0x0, 0x2e, 0x5,
-    0xe8, 0x20, 0x0, 0x5d, 0x50, 0x1, 0x8c, 0xff,
-    0xea, 0x30, 0x0,
-
-    /* U+0406 "І" */
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-
-    /* U+0407 "Ї" */
-    0x6c, 0x0, 0xe4, 0x25, 0x0, 0x61, 0x0, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x97, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x97, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x97, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x97, 0x0,
-
-    /* U+0408 "Ј" */
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x1f,
-    0x35, 0x0, 0x0, 0x5b, 0x2e, 0x71, 0x4, 0xe4,
-    0x1, 0xae, 0xfd, 0x50,
-
-    /* U+0409 "Љ" */
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0x0, 0x0,
-    0x0, 0xf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xc0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0xf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xb0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4b, 0x0, 0x0, 0x0, 0xf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xa0,
-    0x0, 0x0, 0x0, 0xfe, 0xee, 0xee, 0xeb, 0x60,
-    0x0, 0x0, 0x59, 0x0, 0x0, 0x0, 0xf, 0x30,
-    0x0, 0x0, 0x3b, 0xb0, 0x0, 0x6, 0x80, 0x0,
-    0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0xc, 0x60,
-    0x0, 0x87, 0x0, 0x0, 0x0, 0xf, 0x30, 0x0,
-    0x0, 0x0, 0x6a, 0x0, 0xa, 0x50, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xc0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xf, 0x30, 0x0, 0x0,
-    0x0, 0x6a, 0x0, 0x2e, 0x0, 0x0, 0x0, 0x0,
-    0xf3, 0x0, 0x0, 0x0, 0xd, 0x50, 0x2c, 0x70,
-    0x0, 0x0, 0x0, 0xf, 0x30, 0x0, 0x1, 0x5d,
-    0xb0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xec, 0x60, 0x0,
-
-    /* U+040A "Њ" */
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x8a, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x8,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x8a,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0x0, 0x8, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x81, 0x7, 0x80, 0x0, 0x0, 0x0, 0x8, 0xa0,
-    0x0, 0x0, 0x3a, 0xd1, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x8a, 0x0, 0x0, 0x0, 0xa, 0x97, 0x80,
-    0x0, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x0, 0x0,
-    0x4d, 0x78, 0x0, 0x0, 0x0, 0x0, 0x8a, 0x0,
-    0x0, 0x0, 0x2, 0xe7, 0x80, 0x0, 0x0, 0x0,
-    0x8, 0xa0, 0x0, 0x0, 0x0, 0x4c, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0xa,
-    0x77, 0x80, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x0,
-    0x0, 0x2a, 0xc0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xee, 0xee, 0xed, 0x70, 0x0,
-
-    /* U+040B "Ћ" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x46, 0xbe, 0xfe, 0xb3, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x41, 0x1, 0x6f, 0x50,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x4, 0xe0,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0xd4,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0xa5,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0xa5,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0xa5,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0xa5,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x0, 0xa5,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x55, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x78, 0x0,
-    0x0, 0x0, 0x2e, 0x10, 0x78, 0x0, 0x0, 0x0,
-    0xd4, 0x0, 0x78, 0x0, 0x0, 0x9, 0x80, 0x0,
-    0x78, 0x0, 0x0, 0x4c, 0x0, 0x0, 0x78, 0x0,
-    0x1, 0xd2, 0x0, 0x0, 0x78, 0x0, 0xb, 0x50,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0xb, 0x80, 0x0, 0x0, 0x78, 0x0,
-    0x1, 0xe4, 0x0, 0x0, 0x78, 0x0, 0x0, 0x3e,
-    0x10, 0x0, 0x78, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0xa8, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0xd, 0x50, 0x78, 0x0, 0x0, 0x0,
-    0x2, 0xe2,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x4, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x78, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x78, 0x0, 0x0, 0x0,
-    0xb, 0x8f, 0x78, 0x0, 0x0, 0x0, 0x7c, 0xf,
-    0x78, 0x0, 0x0, 0x3, 0xe1, 0xf, 0x78, 0x0,
-    0x0, 0xd, 0x50, 0xf, 0x78, 0x0, 0x0, 0xa9,
-    0x0, 0xf, 0x78, 0x0, 0x5, 0xd0, 0x0, 0xf,
-    0x78, 0x0, 0x2e, 0x20, 0x0, 0xf, 0x78, 0x0,
-    0xc6, 0x0, 0x0, 0xf, 0x78, 0x8, 0xa0, 0x0,
-    0x0, 0xf, 0x78, 0x4e, 0x10, 0x0, 0x0, 0xf,
-    0x7a, 0xe4, 0x0, 0x0, 0x0, 0xf, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0xf,
-
-    /* U+040E "Ў" */
-    0x0, 0x4, 0x20, 0x0, 0x14, 0x0, 0x0, 0x0,
-    0x4, 0xb0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x0,
-    0x5a, 0xaa, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xd0, 0xc, 0x50, 0x0, 0x0, 0x0,
-    0xb, 0x50, 0x4, 0xd0, 0x0, 0x0, 0x0, 0x3d,
-    0x0, 0x0, 0xc5, 0x0, 0x0, 0x0, 0xb5, 0x0,
-    0x0, 0x4d, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0xc, 0x50, 0x0, 0xb, 0x40, 0x0, 0x0, 0x4,
-    0xd0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0xb5,
-    0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x5b, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x4e, 0x20, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xc3, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x79, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x79, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x79, 0x78, 0x0, 0x0, 0x0, 0x0, 0x79,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x79, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x79, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x79, 0x78, 0x0, 0x0, 0x0, 0x0, 0x79,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x79, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x79, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x79, 0x78, 0x0, 0x0, 0x0, 0x0, 0x79,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x79, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x79, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0x40,
-    0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x6f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xc2, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb5, 0xb, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0x80, 0x0, 0xd3, 0x0, 0x0, 0x0, 0x0, 0xe1,
-    0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x6a, 0x0,
-    0x0, 0xe, 0x10, 0x0, 0x0, 0xd, 0x30, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0,
-    0x2, 0xe0, 0x0, 0x0, 0xbe, 0xee, 0xee, 0xee,
-    0xef, 0x50, 0x0, 0x2e, 0x0, 0x0, 0x0, 0x0,
-    0x4c, 0x0, 0x8, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xd3, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xa0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0x10,
-
-    /* U+0411 "Б" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xee, 0xee, 0xed, 0xa4, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x5d, 0x70, 0x78, 0x0,
-    0x0, 0x0, 0x1, 0xf1, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0xc4, 0x78, 0x0, 0x0, 0x0, 0x0, 0xc4,
-    0x78, 0x0, 0x0, 0x0, 0x2, 0xe0, 0x78, 0x0,
-    0x0, 0x0, 0x5d, 0x60, 0x7f, 0xee, 0xee, 0xee,
-    0xa3, 0x0,
-
-    /* U+0412 "В" */
-    0x7f, 0xee, 0xee, 0xed, 0x91, 0x0, 0x78, 0x0,
-    0x0, 0x1, 0x7e, 0x20, 0x78, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x78, 0x0, 0x0, 0x0, 0x4, 0xc0,
-    0x78, 0x0, 0x0, 0x0, 0x4, 0xc0, 0x78, 0x0,
-    0x0, 0x0, 0x9, 0x70, 0x78, 0x0, 0x0, 0x1,
-    0x8b, 0x0, 0x7f, 0xee, 0xee, 0xef, 0xd4, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x3b, 0x90, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0xd4, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x88, 0x78, 0x0, 0x0, 0x0, 0x0, 0x88,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0xd4, 0x78, 0x0,
-    0x0, 0x0, 0x2b, 0xb0, 0x7f, 0xee, 0xee, 0xee,
-    0xc7, 0x0,
-
-    /* U+0413 "Г" */
-    0x7f, 0xff, 0xff, 0xff, 0xf2, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0x3d, 0x0, 0x0,
-    0x5, 0x90, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0,
-    0x69, 0x0, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x6,
-    0x80, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x77,
-    0x0, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x7, 0x70,
-    0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x86, 0x0,
-    0x0, 0x0, 0x3d, 0x0, 0x0, 0xa, 0x50, 0x0,
-    0x0, 0x3, 0xd0, 0x0, 0x0, 0xb3, 0x0, 0x0,
-    0x0, 0x3d, 0x0, 0x0, 0xe, 0x10, 0x0, 0x0,
-    0x3, 0xd0, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x0,
-    0x3d, 0x0, 0x0, 0x69, 0x0, 0x0, 0x0, 0x3,
-    0xd0, 0x0, 0x2d, 0x20, 0x0, 0x0, 0x0, 0x3d,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70,
-
-    /* U+0415 "Е" */
-    0x7f, 0xff, 0xff, 0xff, 0xfd, 0x7, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0x20,
-
-    /* U+0416 "Ж" */
-    0xc, 0x60, 0x0, 0x0, 0x8, 0x70, 0x0, 0x0,
-    0x7, 0xa0, 0x2, 0xe1, 0x0, 0x0, 0x8, 0x70,
-    0x0, 0x0, 0x1e, 0x10, 0x0, 0x89, 0x0, 0x0,
-    0x8, 0x70, 0x0, 0x0, 0xb6, 0x0, 0x0, 0xd,
-    0x30, 0x0, 0x8, 0x70, 0x0, 0x5, 0xc0, 0x0,
-    0x0, 0x4, 0xd0, 0x0, 0x8, 0x70, 0x0, 0xd,
-    0x30, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x8, 0x70,
-    0x0, 0x89, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x10,
-    0x8, 0x70, 0x2, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x10, 0x8, 0x70, 0x2, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x8, 0x70,
-    0x0, 0x7c, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0,
-    0x8, 0x70, 0x0, 0xc, 0x60, 0x0, 0x0, 0x2e,
-    0x10, 0x0, 0x8, 0x70, 0x0, 0x2, 0xe1, 0x0,
-    0x0, 0xc6, 0x0, 0x0, 0x8, 0x70, 0x0, 0x0,
-    0x7b, 0x0, 0x7, 0xb0, 0x0, 0x0, 0x8, 0x70,
-    0x0, 0x0, 0xc, 0x60, 0x2e, 0x20, 0x0, 0x0,
-    0x8, 0x70, 0x0, 0x0, 0x3, 0xe1,
-
-    /* U+0417 "З" */
-    0x1, 0x7c, 0xef, 0xeb, 0x40, 0x0, 0x1e, 0x93,
-    0x0, 0x15, 0xe7, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xa, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x20, 0x0, 0x0, 0x0, 0x3,
-    0xb8, 0x0, 0x0, 0x1e, 0xee, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x7d, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x40, 0x0, 0x0, 0x0, 0x7, 0xb0, 0x7d, 0x72,
-    0x0, 0x2, 0x8e, 0x20, 0x2, 0x8c, 0xff, 0xfc,
-    0x81, 0x0,
-
-    /* U+0418 "И" */
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x78, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x78, 0x0, 0x0, 0x0,
-    0xb, 0x8f, 0x78, 0x0, 0x0, 0x0, 0x7c, 0xf,
-    0x78, 0x0, 0x0, 0x3, 0xe1, 0xf, 0x78, 0x0,
-    0x0, 0xd, 0x50, 0xf, 0x78, 0x0, 0x0, 0xa9,
-    0x0, 0xf, 0x78, 0x0, 0x5, 0xd0, 0x0, 0xf,
-    0x78, 0x0, 0x2e, 0x20, 0x0, 0xf, 0x78, 0x0,
-    0xc6, 0x0, 0x0, 0xf, 0x78, 0x8, 0xa0, 0x0,
-    0x0, 0xf, 0x78, 0x4e, 0x10, 0x0, 0x0, 0xf,
-    0x7a, 0xe4, 0x0, 0x0, 0x0, 0xf, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0xf,
-
-    /* U+0419 "Й" */
-    0x0, 0x6, 0x0, 0x0, 0x42, 0x0, 0x0, 0xa,
-    0x60, 0x2, 0xc1, 0x0, 0x0, 0x0, 0x7a, 0xaa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x78, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x78, 0x0, 0x0, 0x0,
-    0xb, 0x8f, 0x78, 0x0, 0x0, 0x0, 0x7c, 0xf,
-    0x78, 0x0, 0x0, 0x3, 0xe1, 0xf, 0x78, 0x0,
-    0x0, 0xd, 0x50, 0xf, 0x78, 0x0, 0x0, 0xa9,
-    0x0, 0xf, 0x78, 0x0, 0x5, 0xd0, 0x0, 0xf,
-    0x78, 0x0, 0x2e, 0x20, 0x0, 0xf, 0x78, 0x0,
-    0xc6, 0x0, 0x0, 0xf, 0x78, 0x8, 0xa0, 0x0,
-    0x0, 0xf, 0x78, 0x4e, 0x10, 0x0, 0x0, 0xf,
-    0x7a, 0xe4, 0x0, 0x0, 0x0, 0xf, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0xf,
-
-    /* U+041A "К" */
-    0x78, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x78, 0x0,
-    0x0, 0x0, 0x2e, 0x10, 0x78, 0x0, 0x0, 0x0,
-    0xd4, 0x0, 0x78, 0x0, 0x0, 0x9, 0x80, 0x0,
-    0x78, 0x0, 0x0, 0x4c, 0x0, 0x0, 0x78, 0x0,
-    0x1, 0xd2, 0x0, 0x0, 0x78, 0x0, 0xb, 0x50,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0xb, 0x80, 0x0, 0x0, 0x78, 0x0,
-    0x1, 0xe4, 0x0, 0x0, 0x78, 0x0, 0x0, 0x3e,
-    0x10, 0x0, 0x78, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0xa8, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0xd, 0x50, 0x78, 0x0, 0x0, 0x0,
-    0x2, 0xe2,
-
-    /* U+041B "Л" */
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x2, 0xd0, 0x0, 0x0, 0x0, 0xe1, 0x0, 0x2,
-    0xc0, 0x0, 0x0, 0x0, 0xe1, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0xe1, 0x0, 0x3, 0xb0, 0x0,
-    0x0, 0x0, 0xe1, 0x0, 0x4, 0xb0, 0x0, 0x0,
-    0x0, 0xe1, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x0,
-    0xe1, 0x0, 0x5, 0x90, 0x0, 0x0, 0x0, 0xe1,
-    0x0, 0x6, 0x80, 0x0, 0x0, 0x0, 0xe1, 0x0,
-    0x8, 0x70, 0x0, 0x0, 0x0, 0xe1, 0x0, 0xa,
-    0x50, 0x0, 0x0, 0x0, 0xe1, 0x0, 0xd, 0x20,
-    0x0, 0x0, 0x0, 0xe1, 0x0, 0x2e, 0x0, 0x0,
-    0x0, 0x0, 0xe1, 0x2, 0xc7, 0x0, 0x0, 0x0,
-    0x0, 0xe1, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xe1,
-
-    /* U+041C "М" */
-    0x7a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xb7,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x7d,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xb7, 0x8c,
-    0x40, 0x0, 0x0, 0x0, 0xd, 0x5b, 0x78, 0x3c,
-    0x0, 0x0, 0x0, 0x8, 0x74, 0xc7, 0x80, 0xb5,
-    0x0, 0x0, 0x1, 0xd0, 0x4c, 0x78, 0x2, 0xd0,
-    0x0, 0x0, 0x96, 0x4, 0xc7, 0x80, 0x9, 0x60,
-    0x0, 0x2d, 0x0, 0x4c, 0x78, 0x0, 0x1e, 0x0,
-    0xa, 0x40, 0x4, 0xc7, 0x80, 0x0, 0x88, 0x3,
-    0xc0, 0x0, 0x4c, 0x78, 0x0, 0x0, 0xe1, 0xc3,
-    0x0, 0x4, 0xc7, 0x80, 0x0, 0x7, 0xdb, 0x0,
-    0x0, 0x4c, 0x78, 0x0, 0x0, 0xd, 0x20, 0x0,
-    0x3, 0xc7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xc0,
-
-    /* U+041D "Н" */
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x78, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x78, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x1e,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x5b, 0xef, 0xeb, 0x60, 0x0, 0x0,
-    0x2, 0xcc, 0x51, 0x1, 0x4b, 0xd2, 0x0, 0x1,
-    0xe7, 0x0, 0x0, 0x0, 0x6, 0xe1, 0x0, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x38, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x88, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xbc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xb8, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x88, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x30, 0xb8, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xb0, 0x1, 0xe7, 0x0, 0x0, 0x0, 0x6,
-    0xe1, 0x0, 0x2, 0xcc, 0x51, 0x1, 0x4b, 0xd2,
-    0x0, 0x0, 0x0, 0x5b, 0xef, 0xeb, 0x60, 0x0,
-    0x0,
-
-    /* U+041F "П" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x78, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x7, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf0, 0x78, 0x0, 0x0, 0x0, 0x0, 0xf, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x7, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x0,
-
-    /* U+0420 "Р" */
-    0x7f, 0xff, 0xff, 0xec, 0x60, 0x0, 0x78, 0x0,
-    0x0, 0x3, 0xac, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x9, 0x90, 0x78, 0x0, 0x0, 0x0, 0x1, 0xf0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0xe2, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0xe2, 0x78, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x78, 0x0, 0x0, 0x0, 0x9, 0x90,
-    0x78, 0x0, 0x0, 0x3, 0xbb, 0x0, 0x7f, 0xff,
-    0xff, 0xeb, 0x60, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x5b, 0xef, 0xeb, 0x60, 0x0, 0x2,
-    0xcc, 0x51, 0x0, 0x4b, 0xd1, 0x1, 0xe7, 0x0,
-    0x0, 0x0, 0x6, 0x20, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe7,
-    0x0, 0x0, 0x0, 0x6, 0x20, 0x2, 0xcc, 0x51,
-    0x0, 0x4b, 0xc1, 0x0, 0x0, 0x5b, 0xef, 0xeb,
-    0x60, 0x0,
-
-    /* U+0422 "Т" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0x40,
-    0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x4d, 0x0, 0x0, 0x0, 0x0, 0x3, 0xd0, 0xc,
-    0x50, 0x0, 0x0, 0x0, 0xb, 0x50, 0x4, 0xd0,
-    0x0, 0x0, 0x0, 0x3d, 0x0, 0x0, 0xc5, 0x0,
-    0x0, 0x0, 0xb5, 0x0, 0x0, 0x4d, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0xc, 0x50, 0x0, 0xb,
-    0x40, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x0, 0xb5, 0x0, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x5b, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x4e, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xc3, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x6, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xbd, 0xff, 0xdb, 0x72, 0x0,
-    0x0, 0x0, 0x7e, 0x83, 0x6, 0x90, 0x27, 0xd9,
-    0x0, 0x0, 0x8c, 0x10, 0x0, 0x69, 0x0, 0x0,
-    0xab, 0x0, 0x3e, 0x0, 0x0, 0x6, 0x90, 0x0,
-    0x0, 0xb6, 0xa, 0x60, 0x0, 0x0, 0x69, 0x0,
-    0x0, 0x3, 0xc0, 0xd2, 0x0, 0x0, 0x6, 0x90,
-    0x0, 0x0, 0xf, 0xe, 0x10, 0x0, 0x0, 0x69,
-    0x0, 0x0, 0x0, 0xe1, 0xd2, 0x0, 0x0, 0x6,
-    0x90, 0x0, 0x0, 0xf, 0xa, 0x60, 0x0, 0x0,
-    0x69, 0x0, 0x0, 0x3, 0xc0, 0x3e, 0x0, 0x0,
-    0x6, 0x90, 0x0, 0x0, 0xb6, 0x0, 0x8c, 0x10,
-    0x0, 0x69, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x7e,
-    0x83, 0x6, 0x90, 0x27, 0xd9, 0x0, 0x0, 0x0,
-    0x17, 0xbd, 0xff, 0xdb, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x90, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0xc, 0x60, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x2e,
-    0x20, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x2e, 0x20, 0x0, 0x0, 0xc6, 0x0, 0xc,
-    0x70, 0x0, 0x0, 0x2, 0xe2, 0x7, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xc2, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x60, 0xc7, 0x0,
-    0x0, 0x0, 0x7, 0xb0, 0x2, 0xe2, 0x0, 0x0,
-    0x2, 0xe2, 0x0, 0x6, 0xc0, 0x0, 0x0, 0xc6,
-    0x0, 0x0, 0xb, 0x70, 0x0, 0x7b, 0x0, 0x0,
-    0x0, 0x2e, 0x20, 0x2e, 0x10, 0x0, 0x0, 0x0,
-    0x6c, 0x0,
-
-    /* U+0426 "Ц" */
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x79, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x79, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x79, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x79, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x79, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x79,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x79, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x79, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x79, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x79, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x79, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16,
-
-    /* U+0427 "Ч" */
-    0xf0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xf0, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xf0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x4b, 0xd3, 0x0, 0x0, 0x0, 0x4, 0xb8, 0xb0,
-    0x0, 0x0, 0x0, 0x5b, 0xc, 0xb3, 0x0, 0x15,
-    0xaf, 0xb0, 0x7, 0xce, 0xed, 0xa5, 0x5b, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x4b, 0x0, 0x0, 0x0, 0x0, 0x4, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xb0,
-
-    /* U+0428 "Ш" */
-    0x78, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0xb5, 0x78, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0x0, 0xb5, 0x78, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0xb5, 0x78, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0xb5, 0x78, 0x0, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0xb5, 0x78, 0x0, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0xb5, 0x78, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0xb5, 0x78,
-    0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0xb5,
-    0x78, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0xb5, 0x78, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0x0, 0xb5, 0x78, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0xb5, 0x78, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0xb5, 0x78, 0x0, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0xb5, 0x78, 0x0, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0xb5, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+0429 "Щ" */
-    0x78, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0xb5, 0x0, 0x78, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0xb5, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0xb5, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0xb5, 0x0, 0x78, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0xb5, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0xb5, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0xb5, 0x0, 0x78, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0xb5, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x97, 0x0, 0x0, 0x0, 0xb5, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0xb5, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0,
-    0xb5, 0x0, 0x78, 0x0, 0x0, 0x0, 0x97, 0x0,
-    0x0, 0x0, 0xb5, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x69,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x69, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x69, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x34,
-
-    /* U+042A "Ъ" */
-    0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xee, 0xee, 0xed, 0xa3, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x1, 0x6e, 0x50,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0xd3,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0xb4,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0xd3,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x6e, 0x40,
-    0x0, 0x0, 0x5f, 0xee, 0xee, 0xee, 0xa2, 0x0,
-
-    /* U+042B "Ы" */
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc7,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc7, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xc7, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0x7f, 0xee, 0xee,
-    0xed, 0x92, 0x0, 0x3, 0xc7, 0x80, 0x0, 0x0,
-    0x17, 0xe3, 0x0, 0x3c, 0x78, 0x0, 0x0, 0x0,
-    0x5, 0xd0, 0x3, 0xc7, 0x80, 0x0, 0x0, 0x0,
-    0xf, 0x10, 0x3c, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0xd3, 0x3, 0xc7, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0x10, 0x3c, 0x78, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x3, 0xc7, 0x80, 0x0, 0x0, 0x17, 0xe3, 0x0,
-    0x3c, 0x7f, 0xee, 0xee, 0xed, 0x92, 0x0, 0x3,
-    0xc0,
-
-    /* U+042C "Ь" */
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xee, 0xee, 0xed,
-    0x92, 0x0, 0x78, 0x0, 0x0, 0x1, 0x7e, 0x30,
-    0x78, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0xd3, 0x78, 0x0, 0x0, 0x0, 0x0, 0xf1,
-    0x78, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x78, 0x0,
-    0x0, 0x1, 0x7e, 0x30, 0x7f, 0xee, 0xee, 0xed,
-    0x92, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x39, 0xdf, 0xfd, 0x71, 0x0, 0x0, 0x8d,
-    0x62, 0x0, 0x3a, 0xe3, 0x0, 0x8, 0x0, 0x0,
-    0x0, 0x5, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xb0, 0x0, 0xb,
-    0xee, 0xee, 0xee, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x79, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x7, 0x0,
-    0x0, 0x0, 0x5, 0xe3, 0x0, 0x9d, 0x61, 0x0,
-    0x3a, 0xe3, 0x0, 0x0, 0x3a, 0xdf, 0xfd, 0x71,
-    0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x78, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0xad, 0x61, 0x1,
-    0x5d, 0xb0, 0x0, 0x78, 0x0, 0x0, 0xab, 0x0,
-    0x0, 0x0, 0x9, 0xc0, 0x7, 0x80, 0x0, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x70, 0x78, 0x0,
-    0xc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x7,
-    0x80, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd3, 0x78, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x67, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x97, 0x78, 0x0, 0x4c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x67, 0x80, 0x1,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x78,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x7, 0x80, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x70, 0x78, 0x0, 0x0, 0xab, 0x0, 0x0,
-    0x0, 0x9, 0xc0, 0x7, 0x80, 0x0, 0x0, 0xad,
-    0x61, 0x1, 0x5d, 0xb0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x29, 0xef, 0xff, 0xff, 0xf2, 0x4, 0xe7,
-    0x10, 0x0, 0x0, 0xe2, 0xe, 0x30, 0x0, 0x0,
-    0x0, 0xe2, 0x5b, 0x0, 0x0, 0x0, 0x0, 0xe2,
-    0x88, 0x0, 0x0, 0x0, 0x0, 0xe2, 0x88, 0x0,
-    0x0, 0x0, 0x0, 0xe2, 0x6b, 0x0, 0x0, 0x0,
-    0x0, 0xe2, 0x1e, 0x30, 0x0, 0x0, 0x0, 0xe2,
-    0x5, 0xe6, 0x10, 0x0, 0x0, 0xe2, 0x0, 0x2b,
-    0xfe, 0xee, 0xee, 0xf2, 0x0, 0xc, 0x40, 0x0,
-    0x0, 0xe2, 0x0, 0x6b, 0x0, 0x0, 0x0, 0xe2,
-    0x1, 0xe2, 0x0, 0x0, 0x0, 0xe2, 0xa, 0x70,
-    0x0, 0x0, 0x0, 0xe2, 0x3d, 0x0, 0x0, 0x0,
-    0x0, 0xe2,
-
-    /* U+0430 "а" */
-    0x3, 0xae, 0xee, 0xa2, 0x4, 0xd5, 0x0, 0x7,
-    0xe1, 0x0, 0x0, 0x0, 0xa, 0x60, 0x0, 0x0,
-    0x0, 0x69, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x5b,
-    0xdd, 0xdd, 0xea, 0x6c, 0x20, 0x0, 0x5, 0xac,
-    0x30, 0x0, 0x0, 0x5a, 0xc3, 0x0, 0x0, 0xb,
-    0xa6, 0xc1, 0x0, 0x9, 0xaa, 0x6, 0xcc, 0xcb,
-    0x55, 0xa0,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x20, 0x0, 0x0,
-    0x27, 0xbe, 0xd4, 0x0, 0x4, 0xdd, 0x84, 0x10,
-    0x0, 0x8, 0xc3, 0x0, 0x0, 0x0, 0x4, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x2c, 0x4, 0xce, 0xfc, 0x50, 0x6, 0x97,
-    0xa2, 0x0, 0x4d, 0x80, 0x8a, 0xa0, 0x0, 0x0,
-    0x1d, 0x48, 0xf2, 0x0, 0x0, 0x0, 0x6b, 0x8d,
-    0x0, 0x0, 0x0, 0x1, 0xe6, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0x4d, 0x0, 0x0, 0x0, 0x1, 0xe0,
-    0xf2, 0x0, 0x0, 0x0, 0x6a, 0x8, 0xb0, 0x0,
-    0x0, 0x1e, 0x30, 0xc, 0xb2, 0x0, 0x4d, 0x70,
-    0x0, 0x8, 0xde, 0xeb, 0x40, 0x0,
-
-    /* U+0432 "в" */
-    0xde, 0xdd, 0xde, 0xa2, 0xd, 0x20, 0x0, 0x6,
-    0xe0, 0xd2, 0x0, 0x0, 0xc, 0x3d, 0x20, 0x0,
-    0x0, 0xc3, 0xd2, 0x0, 0x0, 0x7b, 0xd, 0xdd,
-    0xdd, 0xed, 0x20, 0xd2, 0x0, 0x0, 0x3d, 0x2d,
-    0x20, 0x0, 0x0, 0x69, 0xd2, 0x0, 0x0, 0x6,
-    0x9d, 0x20, 0x0, 0x2, 0xd4, 0xde, 0xdd, 0xde,
-    0xc5, 0x0,
-
-    /* U+0433 "г" */
-    0xdf, 0xff, 0xff, 0xf4, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x1d,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x2c, 0x0, 0x0,
-    0xb, 0x40, 0x0, 0x2b, 0x0, 0x0, 0xb, 0x40,
-    0x0, 0x3b, 0x0, 0x0, 0xb, 0x40, 0x0, 0x4a,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x68, 0x0, 0x0,
-    0xb, 0x40, 0x0, 0x96, 0x0, 0x0, 0xb, 0x40,
-    0x0, 0xc2, 0x0, 0x0, 0xb, 0x40, 0x5, 0xb0,
-    0x0, 0x0, 0xb, 0x40, 0xbf, 0xfe, 0xee, 0xee,
-    0xef, 0xfe, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc2, 0x0, 0x0, 0x0, 0x0, 0xf, 0x61, 0x0,
-    0x0, 0x0, 0x0, 0x7,
-
-    /* U+0435 "е" */
-    0x0, 0x4b, 0xee, 0xc5, 0x0, 0x0, 0x6d, 0x40,
-    0x2, 0xc9, 0x0, 0x2e, 0x10, 0x0, 0x0, 0xc5,
-    0x9, 0x60, 0x0, 0x0, 0x4, 0xc0, 0xd2, 0x0,
-    0x0, 0x0, 0xe, 0xe, 0xdc, 0xcc, 0xcc, 0xcc,
-    0xe0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x9, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0x20, 0x0, 0x0,
-    0x10, 0x0, 0x5e, 0x60, 0x0, 0x5d, 0x20, 0x0,
-    0x2a, 0xef, 0xea, 0x20, 0x0,
-
-    /* U+0436 "ж" */
-    0xd, 0x30, 0x0, 0x7, 0x90, 0x0, 0x1, 0xe2,
-    0x4, 0xc0, 0x0, 0x7, 0x90, 0x0, 0xa, 0x60,
-    0x0, 0x97, 0x0, 0x7, 0x90, 0x0, 0x5b, 0x0,
-    0x0, 0xd, 0x20, 0x7, 0x90, 0x1, 0xd2, 0x0,
-    0x0, 0x4, 0xc0, 0x7, 0x90, 0xa, 0x60, 0x0,
-    0x0, 0x0, 0xde, 0xef, 0xfe, 0xef, 0x0, 0x0,
-    0x0, 0x7, 0xb0, 0x7, 0x90, 0x9, 0x90, 0x0,
-    0x0, 0x2e, 0x10, 0x7, 0x90, 0x0, 0xd4, 0x0,
-    0x0, 0xd5, 0x0, 0x7, 0x90, 0x0, 0x3e, 0x10,
-    0x8, 0xa0, 0x0, 0x7, 0x90, 0x0, 0x8, 0xa0,
-    0x3e, 0x10, 0x0, 0x7, 0x90, 0x0, 0x0, 0xd5,
-
-    /* U+0437 "з" */
-    0x3, 0x9e, 0xff, 0xb4, 0x0, 0x9, 0x61, 0x0,
-    0x4e, 0x60, 0x0, 0x0, 0x0, 0x4, 0xd0, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x2c,
-    0x40, 0x0, 0xb, 0xcd, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x19, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x2c, 0x50, 0x0,
-    0x3c, 0x90, 0x2, 0x9d, 0xee, 0xc5, 0x0,
-
-    /* U+0438 "и" */
-    0xd2, 0x0, 0x0, 0x0, 0xc7, 0xd2, 0x0, 0x0,
-    0x9, 0xf7, 0xd2, 0x0, 0x0, 0x6c, 0x87, 0xd2,
-    0x0, 0x3, 0xd1, 0x87, 0xd2, 0x0, 0x1d, 0x30,
-    0x87, 0xd2, 0x0, 0xc6, 0x0, 0x87, 0xd2, 0x9,
-    0x90, 0x0, 0x87, 0xd2, 0x5c, 0x0, 0x0, 0x87,
-    0xd5, 0xe1, 0x0, 0x0, 0x87, 0xde, 0x40, 0x0,
-    0x0, 0x87, 0xd7, 0x0, 0x0, 0x0, 0x87,
-
-    /* U+0439 "й" */
-    0x0, 0xb0, 0x0, 0x39, 0x0, 0x0, 0xa5, 0x0,
-    0xb3, 0x0, 0x0, 0x9, 0xbb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xc7, 0xd2, 0x0, 0x0, 0x9, 0xf7, 0xd2, 0x0,
-    0x0, 0x6c, 0x87, 0xd2, 0x0, 0x3, 0xd1, 0x87,
-    0xd2, 0x0, 0x1d, 0x30, 0x87, 0xd2, 0x0, 0xc6,
-    0x0, 0x87, 0xd2, 0x9, 0x90, 0x0, 0x87, 0xd2,
-    0x5c, 0x0, 0x0, 0x87, 0xd5, 0xe1, 0x0, 0x0,
-    0x87, 0xde, 0x40, 0x0, 0x0, 0x87, 0xd7, 0x0,
-    0x0, 0x0, 0x87,
-
-    /* U+043A "к" */
-    0xd2, 0x0, 0x0, 0xb, 0x50, 0xd2, 0x0, 0x0,
-    0x88, 0x0, 0xd2, 0x0, 0x5, 0xb0, 0x0, 0xd2,
-    0x0, 0x2d, 0x10, 0x0, 0xd2, 0x0, 0xc3, 0x0,
-    0x0, 0xde, 0xef, 0xb0, 0x0, 0x0, 0xd2, 0x0,
-    0xc6, 0x0, 0x0, 0xd2, 0x0, 0x1e, 0x30, 0x0,
-    0xd2, 0x0, 0x3, 0xe1, 0x0, 0xd2, 0x0, 0x0,
-    0x5c, 0x0, 0xd2, 0x0, 0x0, 0x8, 0xa0,
-
-    /* U+043B "л" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x50, 0x1, 0xd0,
-    0x0, 0x0, 0xb5, 0x0, 0x2c, 0x0, 0x0, 0xb,
-    0x50, 0x2, 0xc0, 0x0, 0x0, 0xb5, 0x0, 0x3b,
-    0x0, 0x0, 0xb, 0x50, 0x4, 0x90, 0x0, 0x0,
-    0xb5, 0x0, 0x68, 0x0, 0x0, 0xb, 0x50, 0x8,
-    0x60, 0x0, 0x0, 0xb5, 0x0, 0xc2, 0x0, 0x0,
-    0xb, 0x50, 0x4d, 0x0, 0x0, 0x0, 0xb5, 0xce,
-    0x30, 0x0, 0x0, 0xb, 0x50,
-
-    /* U+043C "м" */
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0xb8, 0xde, 0x10,
-    0x0, 0x0, 0x4, 0xf8, 0xd8, 0x80, 0x0, 0x0,
-    0xc, 0x98, 0xd1, 0xd2, 0x0, 0x0, 0x69, 0x68,
-    0xd1, 0x5b, 0x0, 0x0, 0xd1, 0x68, 0xd1, 0xb,
-    0x40, 0x8, 0x60, 0x68, 0xd1, 0x2, 0xc0, 0x2c,
-    0x0, 0x68, 0xd1, 0x0, 0x96, 0xa4, 0x0, 0x68,
-    0xd1, 0x0, 0x1e, 0xa0, 0x0, 0x68, 0xd1, 0x0,
-    0x5, 0x20, 0x0, 0x68, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x68,
-
-    /* U+043D "н" */
-    0xd2, 0x0, 0x0, 0x0, 0xc3, 0xd2, 0x0, 0x0,
-    0x0, 0xc3, 0xd2, 0x0, 0x0, 0x0, 0xc3, 0xd2,
-    0x0, 0x0, 0x0, 0xc3, 0xd2, 0x0, 0x0, 0x0,
-    0xc3, 0xde, 0xee, 0xee, 0xee, 0xf3, 0xd2, 0x0,
-    0x0, 0x0, 0xc3, 0xd2, 0x0, 0x0, 0x0, 0xc3,
-    0xd2, 0x0, 0x0, 0x0, 0xc3, 0xd2, 0x0, 0x0,
-    0x0, 0xc3, 0xd2, 0x0, 0x0, 0x0, 0xc3,
-
-    /* U+043E "о" */
-    0x0, 0x3a, 0xef, 0xd8, 0x10, 0x0, 0x5e, 0x50,
-    0x1, 0x8d, 0x10, 0x2e, 0x20, 0x0, 0x0, 0x7c,
-    0x9, 0x80, 0x0, 0x0, 0x0, 0xd3, 0xd3, 0x0,
-    0x0, 0x0, 0x9, 0x7e, 0x20, 0x0, 0x0, 0x0,
-    0x78, 0xd3, 0x0, 0x0, 0x0, 0x9, 0x79, 0x80,
-    0x0, 0x0, 0x0, 0xd3, 0x2e, 0x20, 0x0, 0x0,
-    0x7c, 0x0, 0x5e, 0x50, 0x1, 0x8d, 0x10, 0x0,
-    0x3a, 0xef, 0xd8, 0x10, 0x0,
-
-    /* U+043F "п" */
-    0xdf, 0xff, 0xff, 0xff, 0xf4, 0xd2, 0x0, 0x0,
-    0x0, 0xb4, 0xd2, 0x0, 0x0, 0x0, 0xb4, 0xd2,
-    0x0, 0x0, 0x0, 0xb4, 0xd2, 0x0, 0x0, 0x0,
-    0xb4, 0xd2, 0x0, 0x0, 0x0, 0xb4, 0xd2, 0x0,
-    0x0, 0x0, 0xb4, 0xd2, 0x0, 0x0, 0x0, 0xb4,
-    0xd2, 0x0, 0x0, 0x0, 0xb4, 0xd2, 0x0, 0x0,
-    0x0, 0xb4, 0xd2, 0x0, 0x0, 0x0, 0xb4,
-
-    /* U+0440 "р" */
-    0xd2, 0x19, 0xef, 0xe9, 0x10, 0xd, 0x4d, 0x50,
-    0x1, 0x8e, 0x20, 0xdd, 0x20, 0x0, 0x0, 0x6d,
-    0xd, 0x80, 0x0, 0x0, 0x0, 0xc4, 0xd4, 0x0,
-    0x0, 0x0, 0x8, 0x7d, 0x20, 0x0, 0x0, 0x0,
-    0x69, 0xd4, 0x0, 0x0, 0x0, 0x8, 0x7d, 0x80,
-    0x0, 0x0, 0x0, 0xc4, 0xde, 0x20, 0x0, 0x0,
-    0x6d, 0xd, 0x5d, 0x50, 0x1, 0x8e, 0x20, 0xd3,
-    0x19, 0xef, 0xe9, 0x10, 0xd, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xd3, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x3a, 0xef, 0xe9, 0x10, 0x5, 0xe5, 0x0,
-    0x18, 0xd1, 0x2e, 0x20, 0x0, 0x0, 0x40, 0x98,
-    0x0, 0x0, 0x0, 0x0, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0x20, 0x0, 0x0, 0x40, 0x5, 0xe5, 0x0,
-    0x18, 0xd1, 0x0, 0x3a, 0xef, 0xe9, 0x10,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x10, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x9, 0x70, 0x0, 0x0, 0x0, 0x97, 0x2, 0xe0,
-    0x0, 0x0, 0x0, 0xe0, 0x0, 0xb5, 0x0, 0x0,
-    0x6, 0x90, 0x0, 0x4c, 0x0, 0x0, 0xd, 0x20,
-    0x0, 0xd, 0x30, 0x0, 0x4b, 0x0, 0x0, 0x6,
-    0xa0, 0x0, 0xb4, 0x0, 0x0, 0x0, 0xe1, 0x2,
-    0xd0, 0x0, 0x0, 0x0, 0x88, 0x9, 0x60, 0x0,
-    0x0, 0x0, 0x1e, 0x1e, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xc8, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x30, 0x0, 0x0, 0x17, 0x0,
-    0x8a, 0x0, 0x0, 0x0, 0x1a, 0xee, 0xa0, 0x0,
-    0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xce, 0xff, 0xda,
-    0x30, 0x0, 0x4, 0xe8, 0x20, 0xd2, 0x16, 0xd9,
-    0x0, 0x2e, 0x20, 0x0, 0xd2, 0x0, 0xb, 0x70,
-    0x97, 0x0, 0x0, 0xd2, 0x0, 0x1, 0xe0, 0xd2,
-    0x0, 0x0, 0xd2, 0x0, 0x0, 0xc3, 0xe1, 0x0,
-    0x0, 0xd2, 0x0, 0x0, 0xb4, 0xd2, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0xd3, 0x97, 0x0, 0x0, 0xd2,
-    0x0, 0x2, 0xe0, 0x2e, 0x30, 0x0, 0xd2, 0x0,
-    0xc, 0x70, 0x4, 0xe8, 0x30, 0xd2, 0x16, 0xd9,
-    0x0, 0x0, 0x18, 0xdf, 0xff, 0xd9, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x1e, 0x20, 0x0, 0x0, 0xd3, 0x4, 0xd0, 0x0,
-    0x9, 0x70, 0x0, 0x89, 0x0, 0x5b, 0x0, 0x0,
-    0xc, 0x52, 0xd1, 0x0, 0x0, 0x2, 0xed, 0x40,
-    0x0, 0x0, 0x0, 0xae, 0x0, 0x0, 0x0, 0x5,
-    0xc9, 0x80, 0x0, 0x0, 0x1e, 0x20, 0xd4, 0x0,
-    0x0, 0xc5, 0x0, 0x2e, 0x10, 0x8, 0xa0, 0x0,
-    0x6, 0xc0, 0x3d, 0x0, 0x0, 0x0, 0xa8,
-
-    /* U+0446 "ц" */
-    0xd2, 0x0, 0x0, 0x0, 0xe1, 0xd, 0x20, 0x0,
-    0x0, 0xe, 0x10, 0xd2, 0x0, 0x0, 0x0, 0xe1,
-    0xd, 0x20, 0x0, 0x0, 0xe, 0x10, 0xd2, 0x0,
-    0x0, 0x0, 0xe1, 0xd, 0x20, 0x0, 0x0, 0xe,
-    0x10, 0xd2, 0x0, 0x0, 0x0, 0xe1, 0xd, 0x20,
-    0x0, 0x0, 0xe, 0x10, 0xd2, 0x0, 0x0, 0x0,
-    0xe1, 0xd, 0x20, 0x0, 0x0, 0xe, 0x10, 0xde,
-    0xee, 0xee, 0xee, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0x0, 0x0, 0x0, 0x0, 0x2, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x16,
-
-    /* U+0447 "ч" */
-    0xf0, 0x0, 0x0, 0x5, 0xaf, 0x0, 0x0, 0x0,
-    0x5a, 0xf0, 0x0, 0x0, 0x5, 0xaf, 0x0, 0x0,
-    0x0, 0x5a, 0xe3, 0x0, 0x0, 0x5, 0xa7, 0xd3,
-    0x0, 0x15, 0xca, 0x5, 0xce, 0xdc, 0x77, 0xa0,
-    0x0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x0,
-    0x5, 0xa0,
-
-    /* U+0448 "ш" */
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x3d,
-    0x20, 0x0, 0x4, 0xb0, 0x0, 0x0, 0xc3, 0xd2,
-    0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x3d, 0x20,
-    0x0, 0x4, 0xb0, 0x0, 0x0, 0xc3, 0xd2, 0x0,
-    0x0, 0x4b, 0x0, 0x0, 0xc, 0x3d, 0x20, 0x0,
-    0x4, 0xb0, 0x0, 0x0, 0xc3, 0xd2, 0x0, 0x0,
-    0x4b, 0x0, 0x0, 0xc, 0x3d, 0x20, 0x0, 0x4,
-    0xb0, 0x0, 0x0, 0xc3, 0xd2, 0x0, 0x0, 0x4b,
-    0x0, 0x0, 0xc, 0x3d, 0x20, 0x0, 0x4, 0xb0,
-    0x0, 0x0, 0xc3, 0xdf, 0xee, 0xee, 0xff, 0xee,
-    0xee, 0xef, 0x30,
-
-    /* U+0449 "щ" */
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xd2, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x30,
-    0xdf, 0xee, 0xee, 0xff, 0xee, 0xee, 0xef, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0xdd, 0xdc, 0x80,
-    0x0, 0x0, 0xb, 0x50, 0x0, 0x18, 0xc0, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0xd, 0x30, 0x0, 0xb,
-    0x50, 0x0, 0x0, 0xa5, 0x0, 0x0, 0xb5, 0x0,
-    0x0, 0xd, 0x30, 0x0, 0xb, 0x50, 0x0, 0x8,
-    0xc0, 0x0, 0x0, 0xbe, 0xdd, 0xdd, 0x91, 0x0,
-
-    /* U+044B "ы" */
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0xd3, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0xd3, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0xd3, 0xd2, 0x0, 0x0, 0x0, 0x0, 0xd3,
-    0xdd, 0xcc, 0xcc, 0x70, 0x0, 0xd3, 0xd2, 0x0,
-    0x1, 0x9b, 0x0, 0xd3, 0xd2, 0x0, 0x0, 0xe,
-    0x20, 0xd3, 0xd2, 0x0, 0x0, 0xc, 0x40, 0xd3,
-    0xd2, 0x0, 0x0, 0xe, 0x20, 0xd3, 0xd2, 0x0,
-    0x1, 0x9b, 0x0, 0xd3, 0xdd, 0xdd, 0xdd, 0x80,
-    0x0, 0xd3,
-
-    /* U+044C "ь" */
-    0xd2, 0x0, 0x0, 0x0, 0xd, 0x20, 0x0, 0x0,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0xd, 0x20, 0x0,
-    0x0, 0x0, 0xdd, 0xcc, 0xcc, 0x70, 0xd, 0x20,
-    0x0, 0x19, 0xb0, 0xd2, 0x0, 0x0, 0xd, 0x3d,
-    0x20, 0x0, 0x0, 0xb4, 0xd2, 0x0, 0x0, 0xe,
-    0x2d, 0x20, 0x0, 0x9, 0xb0, 0xdd, 0xdd, 0xdd,
-    0x80, 0x0,
-
-    /* U+044D "э" */
-    0x1, 0x9d, 0xde, 0xc5, 0x0, 0x1, 0xd5, 0x0,
-    0x3, 0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb7,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x30, 0x0, 0x7d, 0xdd, 0xdd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0,
-    0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xb7, 0x1, 0xd6, 0x0, 0x3, 0xc9, 0x0, 0x2,
-    0x9d, 0xee, 0xc5, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0xd2, 0x0, 0x0, 0x6c, 0xfe, 0xb4, 0x0, 0xd2,
-    0x0, 0xa, 0xb3, 0x0, 0x4d, 0x70, 0xd2, 0x0,
-    0x7b, 0x0, 0x0, 0x1, 0xd3, 0xd2, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0x5b, 0xd2, 0x1, 0xe0, 0x0,
-    0x0, 0x0, 0x1e, 0xdf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0xd2, 0x1, 0xe0, 0x0, 0x0, 0x0,
-    0x1e, 0xd2, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x6b,
-    0xd2, 0x0, 0x6b, 0x0, 0x0, 0x1, 0xd3, 0xd2,
-    0x0, 0xa, 0xb2, 0x0, 0x4d, 0x70, 0xd2, 0x0,
-    0x0, 0x6c, 0xee, 0xb4, 0x0,
-
-    /* U+044F "я" */
-    0x2, 0xae, 0xee, 0xef, 0xd2, 0xe6, 0x0, 0x0,
-    0x1d, 0x88, 0x0, 0x0, 0x1, 0xda, 0x50, 0x0,
-    0x0, 0x1d, 0x87, 0x0, 0x0, 0x1, 0xd2, 0xe5,
-    0x0, 0x0, 0x1d, 0x2, 0x9f, 0xcc, 0xcd, 0xd0,
-    0x8, 0x90, 0x0, 0x1d, 0x2, 0xd0, 0x0, 0x1,
-    0xd0, 0xc4, 0x0, 0x0, 0x1d, 0x6a, 0x0, 0x0,
-    0x1, 0xd0,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xbe, 0xec, 0x50,
-    0x0, 0x6, 0xd4, 0x0, 0x2c, 0x90, 0x2, 0xe1,
-    0x0, 0x0, 0xc, 0x50, 0x96, 0x0, 0x0, 0x0,
-    0x4c, 0xd, 0x20, 0x0, 0x0, 0x0, 0xe0, 0xed,
-    0xcc, 0xcc, 0xcc, 0xce, 0xd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xe2, 0x0, 0x0, 0x1, 0x0, 0x5, 0xe6, 0x0,
-    0x5, 0xd2, 0x0, 0x2, 0xae, 0xfe, 0xa2, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x3e, 0x0, 0xc6, 0x0, 0x0, 0x1, 0x60,
-    0x5, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xee, 0xc5, 0x0, 0x0, 0x6d, 0x40, 0x2, 0xc9,
-    0x0, 0x2e, 0x10, 0x0, 0x0, 0xc5, 0x9, 0x60,
-    0x0, 0x0, 0x4, 0xc0, 0xd2, 0x0, 0x0, 0x0,
-    0xe, 0xe, 0xdc, 0xcc, 0xcc, 0xcc, 0xe0, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0x20, 0x0, 0x0, 0x10, 0x0,
-    0x5e, 0x60, 0x0, 0x5d, 0x20, 0x0, 0x2a, 0xef,
-    0xea, 0x20, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xcf, 0xdc,
-    0xcc, 0xc3, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd2, 0x3b, 0xef, 0xd7, 0x0, 0x0,
-    0xd, 0x6c, 0x30, 0x2, 0xc9, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x0, 0xe2, 0x0, 0xd, 0x60, 0x0,
-    0x0, 0x9, 0x60, 0x0, 0xd3, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0xd, 0x20, 0x0, 0x0, 0x7, 0x80,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0x78, 0x0, 0xd,
-    0x20, 0x0, 0x0, 0x7, 0x80, 0x0, 0xd2, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0xd, 0x20, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x87, 0x0, 0x0, 0x0,
-    0x1, 0x20, 0x1e, 0x30, 0x0, 0x0, 0x0, 0x2c,
-    0xee, 0x60,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x3d, 0x40, 0x0, 0x4, 0xc2, 0x0,
-    0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xf4, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x2a, 0xee, 0xeb, 0x40, 0x4, 0xe6, 0x0,
-    0x3, 0xb6, 0x2e, 0x20, 0x0, 0x0, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0xed, 0xdd, 0xdd, 0xb0, 0x0, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x96, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0x20, 0x0, 0x0, 0x0, 0x4, 0xd5, 0x0,
-    0x3, 0xb5, 0x0, 0x2a, 0xee, 0xdb, 0x40,
-
-    /* U+0455 "ѕ" */
-    0x3, 0xbe, 0xee, 0xa3, 0x2, 0xe4, 0x0, 0x5,
-    0x90, 0x88, 0x0, 0x0, 0x0, 0x8, 0x80, 0x0,
-    0x0, 0x0, 0x2e, 0x72, 0x0, 0x0, 0x0, 0x29,
-    0xde, 0xb6, 0x0, 0x0, 0x0, 0x4, 0xac, 0x0,
-    0x0, 0x0, 0x0, 0xc4, 0x0, 0x0, 0x0, 0xb,
-    0x4b, 0x92, 0x0, 0x6, 0xd0, 0x17, 0xce, 0xee,
-    0x91, 0x0,
-
-    /* U+0456 "і" */
-    0x1e, 0x50, 0x92, 0x0, 0x0, 0x0, 0xd, 0x20,
-    0xd2, 0xd, 0x20, 0xd2, 0xd, 0x20, 0xd2, 0xd,
-    0x20, 0xd2, 0xd, 0x20, 0xd2, 0xd, 0x20,
-
-    /* U+0457 "ї" */
-    0x3e, 0xb, 0x70, 0x60, 0x42, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe2, 0x0, 0xe, 0x20, 0x0,
-    0xe2, 0x0, 0xe, 0x20, 0x0, 0xe2, 0x0, 0xe,
-    0x20, 0x0, 0xe2, 0x0, 0xe, 0x20, 0x0, 0xe2,
-    0x0, 0xe, 0x20, 0x0, 0xe2, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x93, 0x0, 0x0, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd3, 0x0, 0x0, 0xd3, 0x0, 0x0, 0xd3,
-    0x0, 0x0, 0xd3, 0x0, 0x0, 0xd3, 0x0, 0x0,
-    0xd3, 0x0, 0x0, 0xd3, 0x0, 0x0, 0xd3, 0x0,
-    0x0, 0xd3, 0x0, 0x0, 0xd3, 0x0, 0x0, 0xd3,
-    0x0, 0x0, 0xd3, 0x0, 0x0, 0xe2, 0x30, 0x5,
-    0xd0, 0x6d, 0xec, 0x20,
-
-    /* U+0459 "љ" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0x0, 0x0, 0xc, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0xc, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0xc,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x3b, 0x0, 0x0,
-    0xc, 0xec, 0xcc, 0xc9, 0x10, 0x0, 0x49, 0x0,
-    0x0, 0xc, 0x60, 0x0, 0x6, 0xd0, 0x0, 0x68,
-    0x0, 0x0, 0xc, 0x60, 0x0, 0x0, 0xa6, 0x0,
-    0x86, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0, 0x87,
-    0x0, 0xc2, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0,
-    0xb5, 0x4, 0xd0, 0x0, 0x0, 0xc, 0x60, 0x0,
-    0x18, 0xe0, 0xce, 0x30, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xe9, 0x10,
-
-    /* U+045A "њ" */
-    0xd2, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0xd, 0x20, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x0, 0xd, 0x20, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xee, 0xee, 0xee, 0xef, 0xee,
-    0xee, 0xd8, 0x0, 0xd2, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x2, 0xab, 0xd, 0x20, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xf0, 0xd2, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0xf, 0xd, 0x20, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x9, 0xa0, 0xd2, 0x0, 0x0,
-    0x0, 0xfd, 0xdd, 0xdd, 0x80, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xbf, 0xcb,
-    0xbb, 0xb4, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd2, 0x3b, 0xef, 0xd7, 0x0, 0x0,
-    0xd, 0x6c, 0x30, 0x3, 0xc9, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x1, 0xe2, 0x0, 0xd, 0x60, 0x0,
-    0x0, 0x9, 0x60, 0x0, 0xd3, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0xd, 0x20, 0x0, 0x0, 0x7, 0x80,
-    0x0, 0xd2, 0x0, 0x0, 0x0, 0x78, 0x0, 0xd,
-    0x20, 0x0, 0x0, 0x7, 0x80, 0x0, 0xd2, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0xd, 0x20, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0xd2, 0x0, 0x0, 0x0, 0x78,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x2d, 0x50, 0x0, 0x0, 0x4, 0xc2,
-    0x0, 0x0, 0x0, 0x7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0xb,
-    0x50, 0xd2, 0x0, 0x0, 0x88, 0x0, 0xd2, 0x0,
-    0x5, 0xb0, 0x0, 0xd2, 0x0, 0x2d, 0x10, 0x0,
-    0xd2, 0x0, 0xc3, 0x0, 0x0, 0xde, 0xef, 0xb0,
-    0x0, 0x0, 0xd2, 0x0, 0xc6, 0x0, 0x0, 0xd2,
-    0x0, 0x1e, 0x30, 0x0, 0xd2, 0x0, 0x3, 0xe1,
-    0x0, 0xd2, 0x0, 0x0, 0x5c, 0x0, 0xd2, 0x0,
-    0x0, 0x8, 0xa0,
-
-    /* U+045D "ѝ" */
-    0x0, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x6, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-    0xc7, 0xd2, 0x0, 0x0, 0x9, 0xf7, 0xd2, 0x0,
-    0x0, 0x6c, 0x87, 0xd2, 0x0, 0x3, 0xd1, 0x87,
-    0xd2, 0x0, 0x1d, 0x30, 0x87, 0xd2, 0x0, 0xc6,
-    0x0, 0x87, 0xd2, 0x9, 0x90, 0x0, 0x87, 0xd2,
-    0x5c, 0x0, 0x0, 0x87, 0xd5, 0xe1, 0x0, 0x0,
-    0x87, 0xde, 0x40, 0x0, 0x0, 0x87, 0xd7, 0x0,
-    0x0, 0x0, 0x87,
-
-    /* U+045E "ў" */
-    0x0, 0x5, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6,
-    0x80, 0x4, 0xb0, 0x0, 0x0, 0x0, 0x7b, 0xb9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x70,
-    0x0, 0x0, 0x0, 0x97, 0x2, 0xe0, 0x0, 0x0,
-    0x0, 0xe0, 0x0, 0xb5, 0x0, 0x0, 0x6, 0x90,
-    0x0, 0x4c, 0x0, 0x0, 0xd, 0x20, 0x0, 0xd,
-    0x30, 0x0, 0x4b, 0x0, 0x0, 0x6, 0xa0, 0x0,
-    0xb4, 0x0, 0x0, 0x0, 0xe1, 0x2, 0xd0, 0x0,
-    0x0, 0x0, 0x88, 0x9, 0x60, 0x0, 0x0, 0x0,
-    0x1e, 0x1e, 0x0, 0x0, 0x0, 0x0, 0xa, 0xc8,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x30, 0x0, 0x0, 0x17, 0x0, 0x8a, 0x0,
-    0x0, 0x0, 0x1a, 0xee, 0xa0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0xd2, 0x0, 0x0, 0x7, 0x8d, 0x20, 0x0, 0x0,
-    0x78, 0xd2, 0x0, 0x0, 0x7, 0x8d, 0x20, 0x0,
-    0x0, 0x78, 0xd2, 0x0, 0x0, 0x7, 0x8d, 0x20,
-    0x0, 0x0, 0x78, 0xd2, 0x0, 0x0, 0x7, 0x8d,
-    0x20, 0x0, 0x0, 0x78, 0xd2, 0x0, 0x0, 0x7,
-    0x8d, 0x20, 0x0, 0x0, 0x78, 0xde, 0xee, 0xee,
-    0xef, 0x80, 0x0, 0x2d, 0x0, 0x0, 0x0, 0x2,
-    0xd0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0xc3, 0x0, 0x0, 0x0, 0x0, 0xc3, 0x7f,
-    0xff, 0xff, 0xff, 0xf2, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x3, 0xb0, 0x0, 0x0, 0x3b, 0xdf,
-    0xff, 0xff, 0xad, 0x20, 0x0, 0x0, 0xd2, 0x0,
-    0x0, 0xd, 0x20, 0x0, 0x0, 0xd2, 0x0, 0x0,
-    0xd, 0x20, 0x0, 0x0, 0xd2, 0x0, 0x0, 0xd,
-    0x20, 0x0, 0x0, 0xd2, 0x0, 0x0, 0xd, 0x20,
-    0x0, 0x0, 0xd2, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-
-    /* U+2014 "—" */
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc,
-
-    /* U+2018 "‘" */
-    0xa, 0x48, 0x84, 0xca, 0x77,
-
-    /* U+2019 "’" */
-    0xaa, 0x8b, 0x57, 0x93, 0x80,
-
-    /* U+201A "‚" */
-    0x77, 0xac, 0x48, 0x84, 0xb0,
-
-    /* U+201C "“" */
-    0xa, 0x0, 0xb4, 0x80, 0x39, 0x84, 0x7, 0x5c,
-    0xa0, 0xbb, 0x77, 0x6, 0x70,
-
-    /* U+201D "”" */
-    0xaa, 0x9, 0xb8, 0xb0, 0x7c, 0x57, 0x4, 0x89,
-    0x30, 0x84, 0x80, 0x8, 0x0,
-
-    /* U+2026 "…" */
-    0x77, 0x0, 0x68, 0x0, 0x5a, 0xa, 0xa0, 0x9,
-    0xc0, 0x7, 0xd0,
-
-    /* U+20B4 "₴" */
-    0x0, 0x28, 0xdf, 0xfd, 0x81, 0x0, 0x0, 0xe,
-    0x82, 0x0, 0x18, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0xab,
-    0xbb, 0xbb, 0xbb, 0xbd, 0xcb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xab, 0xdb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0x30, 0x7b, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xb0,
-    0x0, 0x0, 0x0, 0x72, 0x0, 0xb, 0xb3, 0x0,
-    0x15, 0xcb, 0x0, 0x0, 0x6, 0xcf, 0xfe, 0xa4,
-    0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x3,
-    0xd0, 0x0, 0x9a, 0x9b, 0x60, 0xcf, 0x40, 0x0,
-    0x0, 0x0, 0x3d, 0x0, 0x95, 0x0, 0x9, 0x4c,
-    0x7e, 0x20, 0x0, 0x0, 0x3, 0xd0, 0xc, 0x0,
-    0x0, 0x2a, 0xc3, 0x6d, 0x0, 0x0, 0x0, 0x3d,
-    0x0, 0xc0, 0x0, 0x1, 0xac, 0x30, 0x9a, 0x0,
-    0x0, 0x3, 0xd0, 0xa, 0x30, 0x0, 0x86, 0xc3,
-    0x0, 0xc7, 0x0, 0x0, 0x3d, 0x0, 0x1b, 0x97,
-    0xa8, 0xc, 0x30, 0x1, 0xe4, 0x0, 0x3, 0xd0,
-    0x0, 0x2, 0x31, 0x0, 0xc3, 0x0, 0x3, 0xe2,
-    0x0, 0x3d, 0x0, 0x0, 0x0, 0x0, 0xc, 0x30,
-    0x0, 0x6, 0xd0, 0x3, 0xd0, 0x7, 0xbb, 0xbb,
-    0xb3, 0xc3, 0x0, 0x0, 0x9, 0xa0, 0x3d, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0, 0xc,
-    0x73, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xc3, 0x0,
-    0x0, 0x0, 0x1e, 0x7d, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x30, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 82, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 81, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23, .adv_w = 114, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 38, .adv_w = 221, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 143, .adv_w = 195, .box_w = 11, .box_h = 21, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 259, .adv_w = 261, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 379, .adv_w = 210, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 469, .adv_w = 62, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 475, .adv_w = 103, .box_w = 4, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 513, .adv_w = 103, .box_w = 5, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 561, .adv_w = 120, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 593, .adv_w = 182, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 638, .adv_w = 64, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 643, .adv_w = 122, .box_w = 6, .box_h = 1, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 646, .adv_w = 64, .box_w = 2, .box_h = 2, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 648, .adv_w = 102, .box_w = 9, .box_h = 20, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 738, .adv_w = 211, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 828, .adv_w = 113, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 866, .adv_w = 180, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 949, .adv_w = 179, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1032, .adv_w = 209, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1130, .adv_w = 179, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1213, .adv_w = 193, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1296, .adv_w = 186, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1379, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1462, .adv_w = 193, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1545, .adv_w = 64, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1556, .adv_w = 64, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1570, .adv_w = 182, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1611, .adv_w = 182, .box_w = 9, .box_h = 6, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 1638, .adv_w = 182, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1679, .adv_w = 180, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1754, .adv_w = 331, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1935, .adv_w = 226, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2040, .adv_w = 241, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2130, .adv_w = 226, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2228, .adv_w = 264, .box_w = 14, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2333, .adv_w = 214, .box_w = 11, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2416, .adv_w = 202, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2491, .adv_w = 247, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2589, .adv_w = 260, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2679, .adv_w = 94, .box_w = 2, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2694, .adv_w = 157, .box_w = 9, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2762, .adv_w = 225, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2852, .adv_w = 187, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2927, .adv_w = 306, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3040, .adv_w = 260, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3130, .adv_w = 268, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3243, .adv_w = 229, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3333, .adv_w = 268, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3477, .adv_w = 230, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3567, .adv_w = 195, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3650, .adv_w = 180, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3740, .adv_w = 254, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3830, .adv_w = 220, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3935, .adv_w = 351, .box_w = 22, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4100, .adv_w = 205, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4198, .adv_w = 200, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4296, .adv_w = 207, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4394, .adv_w = 98, .box_w = 4, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 4432, .adv_w = 102, .box_w = 8, .box_h = 20, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 4512, .adv_w = 98, .box_w = 4, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4550, .adv_w = 182, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 4591, .adv_w = 160, .box_w = 10, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4596, .adv_w = 192, .box_w = 6, .box_h = 3, .ofs_x = 2, .ofs_y = 13},
-    {.bitmap_index = 4605, .adv_w = 187, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4655, .adv_w = 216, .box_w = 11, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4738, .adv_w = 178, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4799, .adv_w = 216, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4889, .adv_w = 191, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4950, .adv_w = 105, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5010, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5100, .adv_w = 215, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5175, .adv_w = 84, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5198, .adv_w = 85, .box_w = 6, .box_h = 19, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 5255, .adv_w = 187, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5330, .adv_w = 84, .box_w = 2, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5345, .adv_w = 340, .box_w = 18, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5444, .adv_w = 215, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5499, .adv_w = 198, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5565, .adv_w = 216, .box_w = 11, .box_h = 15, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 5648, .adv_w = 216, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5738, .adv_w = 126, .box_w = 6, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5771, .adv_w = 153, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5821, .adv_w = 127, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5877, .adv_w = 214, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5932, .adv_w = 169, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5993, .adv_w = 276, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6092, .adv_w = 166, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6147, .adv_w = 169, .box_w = 12, .box_h = 15, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 6237, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6292, .adv_w = 102, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 6340, .adv_w = 93, .box_w = 2, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 6359, .adv_w = 102, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 6416, .adv_w = 182, .box_w = 10, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 6431, .adv_w = 146, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 6463, .adv_w = 146, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 6499, .adv_w = 209, .box_w = 11, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6604, .adv_w = 209, .box_w = 11, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6703, .adv_w = 262, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6831, .adv_w = 182, .box_w = 10, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6926, .adv_w = 226, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7024, .adv_w = 198, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7107, .adv_w = 97, .box_w = 2, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7122, .adv_w = 94, .box_w = 6, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7176, .adv_w = 165, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7236, .adv_w = 380, .box_w = 23, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7409, .adv_w = 380, .box_w = 21, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7567, .adv_w = 264, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7687, .adv_w = 222, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7801, .adv_w = 264, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7915, .adv_w = 215, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8048, .adv_w = 258, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 8162, .adv_w = 235, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8275, .adv_w = 231, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8365, .adv_w = 240, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8455, .adv_w = 182, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8530, .adv_w = 252, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 8673, .adv_w = 209, .box_w = 11, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8756, .adv_w = 319, .box_w = 20, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8906, .adv_w = 196, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8996, .adv_w = 264, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9086, .adv_w = 264, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9200, .adv_w = 222, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9290, .adv_w = 250, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9395, .adv_w = 308, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9508, .adv_w = 263, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9598, .adv_w = 273, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9711, .adv_w = 265, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9809, .adv_w = 226, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9899, .adv_w = 228, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9997, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10087, .adv_w = 215, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10192, .adv_w = 291, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10320, .adv_w = 203, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10418, .adv_w = 264, .box_w = 14, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 10551, .adv_w = 228, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10634, .adv_w = 350, .box_w = 18, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10769, .adv_w = 356, .box_w = 20, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 10959, .adv_w = 260, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11079, .adv_w = 309, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11192, .adv_w = 227, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11282, .adv_w = 226, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11380, .adv_w = 348, .box_w = 19, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11523, .adv_w = 234, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11613, .adv_w = 185, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11663, .adv_w = 210, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11757, .adv_w = 193, .box_w = 9, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11807, .adv_w = 148, .box_w = 8, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11851, .adv_w = 204, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 11935, .adv_w = 195, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11996, .adv_w = 258, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12084, .adv_w = 168, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12139, .adv_w = 218, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12194, .adv_w = 218, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12269, .adv_w = 182, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12324, .adv_w = 200, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12385, .adv_w = 251, .box_w = 12, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12451, .adv_w = 214, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12506, .adv_w = 202, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12567, .adv_w = 215, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12622, .adv_w = 219, .box_w = 11, .box_h = 15, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 12705, .adv_w = 178, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12760, .adv_w = 146, .box_w = 11, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 12821, .adv_w = 175, .box_w = 12, .box_h = 15, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 12911, .adv_w = 246, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 13051, .adv_w = 164, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13106, .adv_w = 217, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 13183, .adv_w = 189, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13233, .adv_w = 294, .box_w = 15, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13316, .adv_w = 294, .box_w = 16, .box_h = 14, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 13428, .adv_w = 194, .box_w = 13, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 13500, .adv_w = 245, .box_w = 12, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13566, .adv_w = 177, .box_w = 9, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13616, .adv_w = 182, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13677, .adv_w = 274, .box_w = 14, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13754, .adv_w = 192, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13804, .adv_w = 198, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13892, .adv_w = 195, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13975, .adv_w = 213, .box_w = 13, .box_h = 20, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 14105, .adv_w = 148, .box_w = 8, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14165, .adv_w = 182, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14220, .adv_w = 166, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14270, .adv_w = 85, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14293, .adv_w = 84, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14331, .adv_w = 85, .box_w = 6, .box_h = 20, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 14391, .adv_w = 292, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14490, .adv_w = 300, .box_w = 17, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14584, .adv_w = 213, .box_w = 13, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 14688, .adv_w = 182, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14763, .adv_w = 218, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14838, .adv_w = 175, .box_w = 12, .box_h = 20, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 14958, .adv_w = 203, .box_w = 9, .box_h = 14, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 15021, .adv_w = 182, .box_w = 10, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15111, .adv_w = 139, .box_w = 7, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15157, .adv_w = 160, .box_w = 10, .box_h = 1, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 15162, .adv_w = 320, .box_w = 20, .box_h = 1, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 15172, .adv_w = 64, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 15177, .adv_w = 64, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 15182, .adv_w = 64, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 15187, .adv_w = 113, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 15200, .adv_w = 113, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 15213, .adv_w = 195, .box_w = 11, .box_h = 2, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15224, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15322, .adv_w = 383, .box_w = 21, .box_h = 15, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_20;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_20 = {
-#else
-lv_font_t montserrat_cyrillic_20 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 23,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_20,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_20*/
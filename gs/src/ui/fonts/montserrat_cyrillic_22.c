@@ -1,3092 +0,0 @@
-/*******************************************************************************
- * Size: 22 px
- * Bpp: 4
- * Opts: --bpp 4 --size 22 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_22.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_22
-#define MONTSERRAT_CYRILLIC_22 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_22
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xd, 0x60, 0xd6, 0xc, 0x50, 0xc5, 0xc, 0x50,
-    0xc4, 0xb, 0x40, 0xb4, 0xb, 0x30, 0xa3, 0xa,
-    0x30, 0x31, 0x0, 0x0, 0x0, 0xc, 0x60, 0xe8,
-
-    /* U+0022 "\"" */
-    0x5a, 0x0, 0xc3, 0x59, 0x0, 0xc2, 0x59, 0x0,
-    0xc2, 0x59, 0x0, 0xc2, 0x49, 0x0, 0xb2, 0x47,
-    0x0, 0xa1,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0xd, 0x10, 0x0, 0x1c, 0x0, 0x0,
-    0x0, 0x0, 0xe0, 0x0, 0x3, 0xa0, 0x0, 0x0,
-    0x0, 0x1d, 0x0, 0x0, 0x58, 0x0, 0x0, 0x0,
-    0x2, 0xb0, 0x0, 0x7, 0x60, 0x0, 0x9, 0xee,
-    0xff, 0xee, 0xee, 0xff, 0xee, 0x60, 0x0, 0x6,
-    0x70, 0x0, 0xb, 0x30, 0x0, 0x0, 0x0, 0x85,
-    0x0, 0x0, 0xd1, 0x0, 0x0, 0x0, 0xa, 0x30,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0xc2, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x2b, 0x0, 0x0, 0x0, 0x0, 0xd0, 0x0, 0x4,
-    0x90, 0x0, 0x4, 0xee, 0xef, 0xee, 0xee, 0xff,
-    0xee, 0xb0, 0x0, 0x3, 0xa0, 0x0, 0x8, 0x50,
-    0x0, 0x0, 0x0, 0x58, 0x0, 0x0, 0xa3, 0x0,
-    0x0, 0x0, 0x7, 0x60, 0x0, 0xc, 0x10, 0x0,
-    0x0, 0x0, 0x94, 0x0, 0x0, 0xd0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0xa, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x20, 0x0, 0x0, 0x0, 0x0, 0xa, 0x20,
-    0x0, 0x0, 0x0, 0x3a, 0xef, 0xfd, 0x93, 0x0,
-    0x5, 0xf7, 0x2a, 0x33, 0x7e, 0x60, 0x1f, 0x30,
-    0xa, 0x20, 0x0, 0x10, 0x6c, 0x0, 0xa, 0x20,
-    0x0, 0x0, 0x6b, 0x0, 0xa, 0x20, 0x0, 0x0,
-    0x4e, 0x10, 0xa, 0x20, 0x0, 0x0, 0xb, 0xd4,
-    0xa, 0x20, 0x0, 0x0, 0x0, 0x7e, 0xee, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0xcf, 0xb4, 0x0,
-    0x0, 0x0, 0xa, 0x21, 0x7f, 0x60, 0x0, 0x0,
-    0xa, 0x20, 0x3, 0xf1, 0x0, 0x0, 0xa, 0x20,
-    0x0, 0xe4, 0x0, 0x0, 0xa, 0x20, 0x0, 0xe3,
-    0x94, 0x0, 0xa, 0x20, 0x6, 0xd0, 0x3e, 0xb5,
-    0x1a, 0x33, 0x9e, 0x30, 0x0, 0x6b, 0xef, 0xfd,
-    0x91, 0x0, 0x0, 0x0, 0xa, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x10, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x5b, 0xbb, 0x30, 0x0, 0x0, 0x9, 0x60,
-    0x0, 0x4b, 0x0, 0x1c, 0x10, 0x0, 0x3, 0xb0,
-    0x0, 0xb, 0x20, 0x0, 0x57, 0x0, 0x0, 0xc2,
-    0x0, 0x0, 0xd0, 0x0, 0x1, 0xb0, 0x0, 0x86,
-    0x0, 0x0, 0xd, 0x0, 0x0, 0x1c, 0x0, 0x3b,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x2, 0xb0, 0xc,
-    0x20, 0x0, 0x0, 0xa, 0x30, 0x0, 0x67, 0x8,
-    0x70, 0x0, 0x0, 0x0, 0x3c, 0x10, 0x3c, 0x2,
-    0xc0, 0x2a, 0xcb, 0x30, 0x0, 0x3b, 0xca, 0x20,
-    0xc2, 0x1c, 0x30, 0x2c, 0x20, 0x0, 0x0, 0x0,
-    0x77, 0x7, 0x60, 0x0, 0x3a, 0x0, 0x0, 0x0,
-    0x2c, 0x0, 0xb1, 0x0, 0x0, 0xd0, 0x0, 0x0,
-    0xc, 0x20, 0xc, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0xb1, 0x0, 0x0, 0xd0, 0x0,
-    0x2, 0xc0, 0x0, 0x8, 0x50, 0x0, 0x2b, 0x0,
-    0x0, 0xb3, 0x0, 0x0, 0x1c, 0x10, 0xb, 0x30,
-    0x0, 0x68, 0x0, 0x0, 0x0, 0x3b, 0xbb, 0x50,
-
-    /* U+0026 "&" */
-    0x0, 0x5, 0xde, 0xea, 0x10, 0x0, 0x0, 0x0,
-    0x5d, 0x20, 0x7, 0xc0, 0x0, 0x0, 0x0, 0xc4,
-    0x0, 0x0, 0xe1, 0x0, 0x0, 0x0, 0xd3, 0x0,
-    0x0, 0xd1, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x5,
-    0xc0, 0x0, 0x0, 0x0, 0x3e, 0x20, 0x6d, 0x20,
-    0x0, 0x0, 0x0, 0x6, 0xdc, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xed, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xc8, 0x9, 0xb0, 0x0, 0x0, 0x0, 0xd,
-    0x50, 0x0, 0xba, 0x0, 0xc, 0x10, 0x89, 0x0,
-    0x0, 0xc, 0x90, 0x1e, 0x0, 0xc4, 0x0, 0x0,
-    0x0, 0xd7, 0x78, 0x0, 0xd4, 0x0, 0x0, 0x0,
-    0x1d, 0xf1, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x1c,
-    0xf5, 0x0, 0xc, 0xb3, 0x0, 0x16, 0xd7, 0x2e,
-    0x40, 0x0, 0x7c, 0xff, 0xea, 0x30, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-
-    /* U+0027 "'" */
-    0x5a, 0x59, 0x59, 0x59, 0x49, 0x47,
-
-    /* U+0028 "(" */
-    0x0, 0x4c, 0x0, 0xc, 0x40, 0x3, 0xd0, 0x0,
-    0x88, 0x0, 0xd, 0x30, 0x0, 0xf0, 0x0, 0x3d,
-    0x0, 0x5, 0xb0, 0x0, 0x79, 0x0, 0x8, 0x90,
-    0x0, 0x88, 0x0, 0x8, 0x90, 0x0, 0x79, 0x0,
-    0x5, 0xb0, 0x0, 0x3d, 0x0, 0x0, 0xf0, 0x0,
-    0xd, 0x30, 0x0, 0x88, 0x0, 0x3, 0xd0, 0x0,
-    0xc, 0x40, 0x0, 0x4c, 0x0,
-
-    /* U+0029 ")" */
-    0xa5, 0x0, 0x3d, 0x0, 0xc, 0x40, 0x7, 0xa0,
-    0x2, 0xe0, 0x0, 0xf2, 0x0, 0xc5, 0x0, 0xa7,
-    0x0, 0x98, 0x0, 0x89, 0x0, 0x79, 0x0, 0x89,
-    0x0, 0x98, 0x0, 0xa7, 0x0, 0xc5, 0x0, 0xf2,
-    0x2, 0xe0, 0x7, 0x90, 0xc, 0x40, 0x3d, 0x0,
-    0xa5, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x4, 0x80, 0x0, 0x11, 0x4, 0x80, 0x1,
-    0x3d, 0x64, 0x74, 0xc6, 0x0, 0x8e, 0xea, 0x20,
-    0x0, 0x7e, 0xe9, 0x10, 0x3c, 0x74, 0x74, 0xd5,
-    0x11, 0x4, 0x80, 0x2, 0x0, 0x4, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x3b,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x7c, 0x8, 0xf1, 0x2c, 0x5, 0x80, 0x93, 0x0,
-
-    /* U+002D "-" */
-    0x9e, 0xee, 0xee, 0x1, 0x11, 0x11, 0x10,
-
-    /* U+002E "." */
-    0x7d, 0x8, 0xe0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x2, 0x50, 0x0, 0x0, 0x0,
-    0x96, 0x0, 0x0, 0x0, 0xe, 0x10, 0x0, 0x0,
-    0x4, 0xc0, 0x0, 0x0, 0x0, 0x96, 0x0, 0x0,
-    0x0, 0xe, 0x10, 0x0, 0x0, 0x4, 0xb0, 0x0,
-    0x0, 0x0, 0x96, 0x0, 0x0, 0x0, 0xe, 0x10,
-    0x0, 0x0, 0x4, 0xb0, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x0, 0x0, 0xe, 0x10, 0x0, 0x0, 0x4,
-    0xb0, 0x0, 0x0, 0x0, 0xa6, 0x0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x0, 0x4, 0xb0, 0x0, 0x0,
-    0x0, 0xa5, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x5, 0xa0, 0x0, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x5, 0xa0,
-    0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x4, 0xbe, 0xfd, 0x80, 0x0, 0x0, 0x7,
-    0xe7, 0x21, 0x4b, 0xd1, 0x0, 0x5, 0xe2, 0x0,
-    0x0, 0x9, 0xc0, 0x0, 0xe5, 0x0, 0x0, 0x0,
-    0xd, 0x50, 0x4d, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0x1, 0xf0, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x2c, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xe3, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x3b, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xf2, 0x89, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x4,
-    0xd0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0xe, 0x50,
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x5e, 0x20, 0x0,
-    0x0, 0x9c, 0x0, 0x0, 0x7e, 0x62, 0x14, 0xbd,
-    0x10, 0x0, 0x0, 0x4b, 0xef, 0xd8, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xcf, 0xff, 0xf1, 0x1, 0x11, 0xf1, 0x0, 0x0,
-    0xf1, 0x0, 0x0, 0xf1, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0xf1, 0x0, 0x0, 0xf1, 0x0, 0x0, 0xf1,
-    0x0, 0x0, 0xf1, 0x0, 0x0, 0xf1, 0x0, 0x0,
-    0xf1, 0x0, 0x0, 0xf1, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0xf1, 0x0, 0x0, 0xf1, 0x0, 0x0, 0xf1,
-
-    /* U+0032 "2" */
-    0x0, 0x5b, 0xef, 0xfc, 0x60, 0x0, 0xb, 0xd6,
-    0x21, 0x25, 0xdb, 0x0, 0x39, 0x0, 0x0, 0x0,
-    0x1e, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x8c, 0x10, 0x0, 0x0, 0x0, 0x8, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x8d, 0x10, 0x0, 0x0,
-    0x0, 0x7, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0x10, 0x0, 0x0, 0x0, 0x6, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0033 "3" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1, 0x11,
-    0x11, 0x11, 0x5e, 0x10, 0x0, 0x0, 0x0, 0x1,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0xb, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xbd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf0, 0x76, 0x0,
-    0x0, 0x0, 0xa, 0xa0, 0x2d, 0xc6, 0x21, 0x15,
-    0xcd, 0x10, 0x0, 0x6b, 0xef, 0xfc, 0x70, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe4,
-    0x0, 0x2, 0x80, 0x0, 0x0, 0x0, 0xc7, 0x0,
-    0x0, 0x4d, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0,
-    0x4, 0xd0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x4d, 0x0, 0x0, 0xf, 0xfe, 0xee, 0xee, 0xef,
-    0xfe, 0xee, 0x0, 0x11, 0x11, 0x11, 0x11, 0x5d,
-    0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0x90, 0x0, 0xb6,
-    0x11, 0x11, 0x11, 0x0, 0x0, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0xee, 0xdb, 0x71, 0x0,
-    0x0, 0x11, 0x12, 0x36, 0xbe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x28, 0x0,
-    0x0, 0x0, 0x6, 0xe0, 0x1b, 0xd7, 0x31, 0x13,
-    0x9f, 0x40, 0x0, 0x4a, 0xdf, 0xfd, 0x92, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x2, 0x9d, 0xff, 0xea, 0x20, 0x0, 0x5e,
-    0x83, 0x10, 0x26, 0x20, 0x4, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb6, 0x3, 0xbe, 0xfe,
-    0xa2, 0x0, 0xc5, 0x6d, 0x51, 0x2, 0x8f, 0x40,
-    0xc8, 0xc0, 0x0, 0x0, 0x6, 0xe0, 0xbf, 0x40,
-    0x0, 0x0, 0x0, 0xd5, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0xa7, 0x5f, 0x0, 0x0, 0x0, 0x0, 0xa7,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0xd4, 0x7, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0xad, 0x51, 0x2,
-    0x8e, 0x30, 0x0, 0x5, 0xbe, 0xfe, 0x91, 0x0,
-
-    /* U+0037 "7" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x4d, 0x11,
-    0x11, 0x11, 0x11, 0xb8, 0x4d, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0x4d, 0x0, 0x0, 0x0, 0x9, 0xa0,
-    0x1, 0x0, 0x0, 0x0, 0xf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x29, 0xef, 0xfd, 0x92, 0x0, 0x5, 0xf7,
-    0x20, 0x3, 0x8f, 0x40, 0xf, 0x40, 0x0, 0x0,
-    0x6, 0xe0, 0x4d, 0x0, 0x0, 0x0, 0x0, 0xf2,
-    0x4d, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x1f, 0x30,
-    0x0, 0x0, 0x4, 0xe0, 0x5, 0xe6, 0x10, 0x1,
-    0x7e, 0x40, 0x0, 0x6f, 0xff, 0xff, 0xf5, 0x0,
-    0x9, 0xd5, 0x0, 0x1, 0x5d, 0x70, 0x6d, 0x0,
-    0x0, 0x0, 0x1, 0xe4, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x7a, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x8a, 0x6d, 0x10,
-    0x0, 0x0, 0x2, 0xe4, 0x9, 0xe6, 0x20, 0x2,
-    0x7e, 0x80, 0x0, 0x4a, 0xef, 0xfd, 0xa3, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x18, 0xdf, 0xfc, 0x70, 0x0, 0x0, 0x2e,
-    0x93, 0x0, 0x3a, 0xc1, 0x0, 0xc, 0x80, 0x0,
-    0x0, 0x7, 0xb0, 0x2, 0xf0, 0x0, 0x0, 0x0,
-    0xe, 0x30, 0x4d, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x2, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0xd,
-    0x60, 0x0, 0x0, 0x6, 0xbf, 0x0, 0x3f, 0x81,
-    0x0, 0x18, 0xc2, 0xf0, 0x0, 0x2a, 0xff, 0xee,
-    0x80, 0x1f, 0x0, 0x0, 0x0, 0x10, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xd7, 0x0, 0x0, 0x93, 0x0, 0x27, 0xe8,
-    0x0, 0x0, 0x19, 0xdf, 0xfe, 0xa3, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x8e, 0x7, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0x8, 0xe0,
-
-    /* U+003B ";" */
-    0x8e, 0x7, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x8, 0xf1, 0x2c, 0x5, 0x80, 0x93, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
-    0x17, 0xdb, 0x0, 0x0, 0x29, 0xe9, 0x20, 0x0,
-    0x5c, 0xd6, 0x0, 0x0, 0x4e, 0xa4, 0x0, 0x0,
-    0x0, 0x4e, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xe8, 0x20,
-    0x0, 0x0, 0x0, 0x17, 0xea, 0x0, 0x0, 0x0,
-    0x0, 0x4,
-
-    /* U+003D "=" */
-    0x6f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+003E ">" */
-    0x21, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x39, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x17,
-    0xda, 0x0, 0x0, 0x0, 0x6, 0xdb, 0x0, 0x0,
-    0x29, 0xe9, 0x20, 0x0, 0x5c, 0xd7, 0x0, 0x0,
-    0x4e, 0xb4, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x6b, 0xef, 0xfc, 0x60, 0x1, 0xcc, 0x51,
-    0x1, 0x5e, 0xb0, 0x48, 0x0, 0x0, 0x0, 0x1e,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0, 0x0,
-    0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0, 0xab,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x10, 0x0, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0x0, 0x0, 0x42,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x5a, 0xde, 0xee, 0xd9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xd9, 0x40, 0x0,
-    0x1, 0x5a, 0xc3, 0x0, 0x0, 0x0, 0xa, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xc6, 0x0, 0x0,
-    0x9, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc5, 0x0, 0x5, 0xc0, 0x0, 0x5, 0xce, 0xed,
-    0x70, 0x3d, 0x1, 0xd1, 0x0, 0xd2, 0x0, 0x9,
-    0xc3, 0x0, 0x17, 0xb3, 0xd0, 0x6, 0x90, 0x4b,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x4, 0xcd, 0x0,
-    0xd, 0x8, 0x60, 0x0, 0xe3, 0x0, 0x0, 0x0,
-    0xb, 0xd0, 0x0, 0xa3, 0xb3, 0x0, 0x3d, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0x0, 0x7, 0x6c, 0x20,
-    0x5, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xd0, 0x0,
-    0x57, 0xc2, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0x0, 0x5, 0x8b, 0x30, 0x2, 0xe0, 0x0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x66, 0x86, 0x0,
-    0xe, 0x30, 0x0, 0x0, 0x0, 0xbd, 0x0, 0x9,
-    0x43, 0xb0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x6b,
-    0xd0, 0x0, 0xd0, 0xd, 0x20, 0x0, 0x9d, 0x40,
-    0x1, 0x8b, 0x1f, 0x30, 0x88, 0x0, 0x5c, 0x0,
-    0x0, 0x5c, 0xff, 0xd7, 0x0, 0x5e, 0xe9, 0x0,
-    0x0, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9b, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-    0x94, 0x0, 0x0, 0x15, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xee, 0xec, 0x82, 0x0,
-    0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe3, 0xb6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xc0, 0x4d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x50, 0xd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x6, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xb7, 0x0, 0x0, 0xe3, 0x0, 0x0,
-    0x0, 0x2, 0xf1, 0x0, 0x0, 0x8a, 0x0, 0x0,
-    0x0, 0x9, 0x90, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x1f, 0x20, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x7b, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x5, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0,
-    0xc, 0x60, 0x0, 0x0, 0x0, 0x0, 0xe, 0x40,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xb0,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf3,
-
-    /* U+0042 "B" */
-    0x5f, 0xff, 0xff, 0xff, 0xeb, 0x40, 0x0, 0x5d,
-    0x0, 0x0, 0x0, 0x27, 0xe8, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x20, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x60, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x50, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x10, 0x5d, 0x0, 0x0, 0x0, 0x26, 0xe5,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x5d, 0x0, 0x0, 0x0, 0x3, 0x9e, 0x20, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe3, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf2, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xd0, 0x5d, 0x0, 0x0, 0x0, 0x3, 0x9e,
-    0x30, 0x5f, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xa5, 0x0, 0x0,
-    0x8, 0xf9, 0x42, 0x13, 0x7d, 0xc1, 0x0, 0xbd,
-    0x20, 0x0, 0x0, 0x0, 0x85, 0x7, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbc, 0x20, 0x0, 0x0,
-    0x0, 0x85, 0x0, 0x9, 0xf9, 0x41, 0x12, 0x6d,
-    0xc1, 0x0, 0x0, 0x29, 0xdf, 0xfe, 0xa5, 0x0,
-
-    /* U+0044 "D" */
-    0x5f, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0, 0x5,
-    0xd1, 0x11, 0x11, 0x14, 0x8e, 0xb1, 0x0, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xd1, 0x5, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xb0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x45, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9a, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xd5, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf5, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xa5, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf4, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xab, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0x10, 0x5d, 0x0, 0x0, 0x1, 0x38, 0xeb, 0x10,
-    0x5, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x5d, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xee, 0xee, 0xee, 0xee, 0x0,
-    0x5d, 0x11, 0x11, 0x11, 0x11, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+0046 "F" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xd1, 0x11,
-    0x11, 0x11, 0x11, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xee, 0xee, 0xee,
-    0xee, 0x5, 0xd1, 0x11, 0x11, 0x11, 0x10, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x8, 0xf9, 0x42, 0x12, 0x6c, 0xd2, 0x0, 0xbd,
-    0x20, 0x0, 0x0, 0x0, 0x67, 0x7, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xa7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0x1f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0x8, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0x0, 0xbd, 0x20, 0x0, 0x0,
-    0x0, 0x8c, 0x0, 0x9, 0xf9, 0x41, 0x12, 0x5c,
-    0xe3, 0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb6, 0x0,
-
-    /* U+0048 "H" */
-    0x5d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe3, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe3, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe3, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe3, 0x5f, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf3,
-    0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0xe3, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe3, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe3, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe3, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe3, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe3,
-
-    /* U+0049 "I" */
-    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
-    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
-
-    /* U+004A "J" */
-    0x0, 0x8f, 0xff, 0xff, 0xf4, 0x0, 0x1, 0x11,
-    0x11, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0xf2, 0xb, 0x20, 0x0, 0x5, 0xe0, 0x6, 0xe6,
-    0x11, 0x5e, 0x60, 0x0, 0x4b, 0xff, 0xd5, 0x0,
-
-    /* U+004B "K" */
-    0x5d, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x50, 0x5d,
-    0x0, 0x0, 0x0, 0x1, 0xd6, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x1d, 0x70, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0xc8, 0x0, 0x0, 0x5d, 0x0, 0x0, 0xc,
-    0x90, 0x0, 0x0, 0x5d, 0x0, 0x0, 0xba, 0x0,
-    0x0, 0x0, 0x5d, 0x0, 0xa, 0xb0, 0x0, 0x0,
-    0x0, 0x5d, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0,
-    0x5d, 0x8, 0xd8, 0xe1, 0x0, 0x0, 0x0, 0x5d,
-    0x7d, 0x10, 0x9c, 0x0, 0x0, 0x0, 0x5f, 0xe2,
-    0x0, 0xb, 0xa0, 0x0, 0x0, 0x5f, 0x20, 0x0,
-    0x1, 0xd8, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0,
-    0x2e, 0x50, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x3,
-    0xf3, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0x10, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc0,
-
-    /* U+004C "L" */
-    0x5d, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfa,
-
-    /* U+004D "M" */
-    0x5d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x55, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf5, 0x5e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x55, 0xc9, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x89, 0xc5, 0x5c, 0x1e, 0x20, 0x0, 0x0, 0x0,
-    0x1e, 0x1c, 0x55, 0xc0, 0x7b, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0xc5, 0x5c, 0x0, 0xd4, 0x0, 0x0,
-    0x3, 0xd0, 0xc, 0x55, 0xc0, 0x5, 0xc0, 0x0,
-    0x0, 0xc5, 0x0, 0xc5, 0x5c, 0x0, 0xc, 0x50,
-    0x0, 0x5c, 0x0, 0xc, 0x55, 0xc0, 0x0, 0x3e,
-    0x0, 0xd, 0x30, 0x0, 0xc5, 0x5c, 0x0, 0x0,
-    0xa7, 0x6, 0xa0, 0x0, 0xc, 0x55, 0xc0, 0x0,
-    0x2, 0xe2, 0xe2, 0x0, 0x0, 0xc5, 0x5c, 0x0,
-    0x0, 0x8, 0xe8, 0x0, 0x0, 0xc, 0x55, 0xc0,
-    0x0, 0x0, 0xc, 0x10, 0x0, 0x0, 0xc5, 0x5c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x55,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc5,
-
-    /* U+004E "N" */
-    0x5e, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x5d, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0x5d, 0x2f, 0x40,
-    0x0, 0x0, 0x0, 0xe3, 0x5d, 0x6, 0xe1, 0x0,
-    0x0, 0x0, 0xe3, 0x5d, 0x0, 0xac, 0x0, 0x0,
-    0x0, 0xe3, 0x5d, 0x0, 0xd, 0x80, 0x0, 0x0,
-    0xe3, 0x5d, 0x0, 0x2, 0xf4, 0x0, 0x0, 0xe3,
-    0x5d, 0x0, 0x0, 0x5e, 0x10, 0x0, 0xe3, 0x5d,
-    0x0, 0x0, 0x9, 0xc0, 0x0, 0xe3, 0x5d, 0x0,
-    0x0, 0x0, 0xd8, 0x0, 0xe3, 0x5d, 0x0, 0x0,
-    0x0, 0x2f, 0x40, 0xe3, 0x5d, 0x0, 0x0, 0x0,
-    0x5, 0xe1, 0xe3, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x9c, 0xe3, 0x5d, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf3,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x94, 0x11, 0x37, 0xdd, 0x20,
-    0x0, 0x0, 0xbd, 0x20, 0x0, 0x0, 0x0, 0x8e,
-    0x30, 0x0, 0x7d, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x1f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc7, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xd0, 0xa7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x1c, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf3, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x3a, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0x1, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x7, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0xb,
-    0xc2, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0,
-    0x8, 0xf9, 0x41, 0x12, 0x6d, 0xd2, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xff, 0xeb, 0x50, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x5f, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0x5, 0xd1,
-    0x11, 0x11, 0x26, 0xdb, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0xc9, 0x5, 0xd0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0x5d, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x55, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb6, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x55, 0xd0, 0x0,
-    0x0, 0x0, 0x1, 0xf1, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0xaa, 0x5, 0xd0, 0x0, 0x0, 0x4, 0xcc,
-    0x10, 0x5f, 0xee, 0xee, 0xef, 0xc7, 0x0, 0x5,
-    0xd1, 0x11, 0x11, 0x0, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x94, 0x11, 0x37, 0xdd, 0x20,
-    0x0, 0x0, 0xbd, 0x20, 0x0, 0x0, 0x0, 0x8e,
-    0x30, 0x0, 0x7d, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x1f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc7, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xd0, 0xa7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x1c, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf3, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x3a, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0x1, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x7, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0xb,
-    0xc2, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0,
-    0x8, 0xf9, 0x41, 0x12, 0x6d, 0xd2, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xff, 0xfb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x5e, 0x81, 0x3,
-    0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xef,
-    0xd6, 0x0,
-
-    /* U+0052 "R" */
-    0x5f, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0x5, 0xd1,
-    0x11, 0x11, 0x26, 0xdb, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0xc9, 0x5, 0xd0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0x5d, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x55, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb6, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x55, 0xd0, 0x0,
-    0x0, 0x0, 0x1, 0xf1, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0xaa, 0x5, 0xd0, 0x0, 0x0, 0x4, 0xcc,
-    0x10, 0x5f, 0xee, 0xee, 0xef, 0xf6, 0x0, 0x5,
-    0xd1, 0x11, 0x11, 0x1d, 0x50, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x3e, 0x20, 0x5, 0xd0, 0x0, 0x0,
-    0x0, 0x7c, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x1, 0xe4,
-
-    /* U+0053 "S" */
-    0x0, 0x3a, 0xef, 0xfd, 0x93, 0x0, 0x5, 0xf7,
-    0x20, 0x3, 0x7e, 0x60, 0x1f, 0x30, 0x0, 0x0,
-    0x0, 0x10, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xe9, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x37, 0xbf, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x94, 0x0,
-    0x0, 0x0, 0x6, 0xd0, 0x3e, 0xb5, 0x10, 0x3,
-    0x9e, 0x30, 0x0, 0x6b, 0xef, 0xfd, 0x91, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x11,
-    0x11, 0x6c, 0x11, 0x11, 0x10, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x7a, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe7, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x7a, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe7, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x7a, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xe7, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x7a,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe7, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x7a, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe7, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x5, 0xc3,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x8a, 0xe, 0x50,
-    0x0, 0x0, 0x0, 0xd, 0x50, 0x6e, 0x10, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x8e, 0x72, 0x11, 0x5b,
-    0xd2, 0x0, 0x0, 0x4a, 0xef, 0xfc, 0x70, 0x0,
-
-    /* U+0056 "V" */
-    0xa9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc3,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd5, 0xc,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x70, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x2, 0xf1, 0x0, 0x8, 0xb0,
-    0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0xf, 0x30, 0x0, 0x0, 0xa9, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0xd5, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x4e, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0xb,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x2, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x9a, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x3f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xf, 0x30, 0x0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0xa, 0x80, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x5, 0xc0,
-    0x4, 0xe0, 0x0, 0x0, 0x0, 0x4c, 0x97, 0x0,
-    0x0, 0x0, 0xa, 0x70, 0x0, 0xf3, 0x0, 0x0,
-    0x0, 0x97, 0x4d, 0x0, 0x0, 0x0, 0xf, 0x20,
-    0x0, 0xa8, 0x0, 0x0, 0x0, 0xe2, 0xe, 0x20,
-    0x0, 0x0, 0x4d, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x4, 0xc0, 0x9, 0x70, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0xf, 0x20, 0x0, 0x9, 0x70, 0x4, 0xd0,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0xe, 0x20, 0x0, 0xe2, 0x0, 0x4, 0xd0, 0x0,
-    0x0, 0x5, 0xd0, 0x0, 0x4c, 0x0, 0x0, 0xa7,
-    0x0, 0x9, 0x80, 0x0, 0x0, 0x0, 0xf2, 0x0,
-    0x97, 0x0, 0x0, 0x4c, 0x0, 0xe, 0x20, 0x0,
-    0x0, 0x0, 0xb7, 0x0, 0xe2, 0x0, 0x0, 0xe,
-    0x20, 0x4d, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x4,
-    0xc0, 0x0, 0x0, 0xa, 0x70, 0x98, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x29, 0x70, 0x0, 0x0, 0x4,
-    0xc0, 0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0x7e,
-    0x20, 0x0, 0x0, 0x0, 0xe6, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0xc, 0x80, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x2,
-    0xf4, 0x0, 0x0, 0x0, 0x2e, 0x30, 0x0, 0x5e,
-    0x10, 0x0, 0x0, 0xc7, 0x0, 0x0, 0xa, 0xa0,
-    0x0, 0x8, 0xb0, 0x0, 0x0, 0x1, 0xe6, 0x0,
-    0x3e, 0x10, 0x0, 0x0, 0x0, 0x4f, 0x20, 0xd5,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xca, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x65, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x9a, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x5, 0xe1,
-    0x0, 0xd, 0x60, 0x0, 0x0, 0x1e, 0x40, 0x0,
-    0x3, 0xf2, 0x0, 0x0, 0xc8, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0, 0xb,
-    0x90, 0x3f, 0x20, 0x0, 0x0, 0x0, 0x1, 0xe4,
-
-    /* U+0059 "Y" */
-    0x9a, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x1e,
-    0x30, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x6, 0xc0,
-    0x0, 0x0, 0x0, 0x1e, 0x20, 0x0, 0xc6, 0x0,
-    0x0, 0x0, 0x99, 0x0, 0x0, 0x3e, 0x10, 0x0,
-    0x3, 0xe1, 0x0, 0x0, 0xa, 0x90, 0x0, 0xc,
-    0x60, 0x0, 0x0, 0x1, 0xf3, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x0, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x58, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xee, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x11,
-    0x11, 0x11, 0x11, 0x1b, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xab, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xba, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+005B "[" */
-    0x5f, 0xff, 0x35, 0xc0, 0x0, 0x5c, 0x0, 0x5,
-    0xc0, 0x0, 0x5c, 0x0, 0x5, 0xc0, 0x0, 0x5c,
-    0x0, 0x5, 0xc0, 0x0, 0x5c, 0x0, 0x5, 0xc0,
-    0x0, 0x5c, 0x0, 0x5, 0xc0, 0x0, 0x5c, 0x0,
-    0x5, 0xc0, 0x0, 0x5c, 0x0, 0x5, 0xc0, 0x0,
-    0x5c, 0x0, 0x5, 0xc0, 0x0, 0x5c, 0x0, 0x5,
-    0xc0, 0x0, 0x5f, 0xff, 0x30,
-
-    /* U+005C "\\" */
-    0x52, 0x0, 0x0, 0x0, 0x6, 0x90, 0x0, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0xb4, 0x0,
-    0x0, 0x0, 0x5, 0xa0, 0x0, 0x0, 0x0, 0xe,
-    0x0, 0x0, 0x0, 0x0, 0xb4, 0x0, 0x0, 0x0,
-    0x5, 0xa0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x5, 0xa0,
-    0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0,
-    0xa5, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0x0, 0x5, 0xb0, 0x0, 0x0, 0x0, 0xe,
-    0x0, 0x0, 0x0, 0x0, 0xa5, 0x0, 0x0, 0x0,
-    0x5, 0xb0, 0x0, 0x0, 0x0, 0xe, 0x10, 0x0,
-    0x0, 0x0, 0xa6,
-
-    /* U+005D "]" */
-    0x7f, 0xff, 0x0, 0x0, 0xf0, 0x0, 0xf, 0x0,
-    0x0, 0xf0, 0x0, 0xf, 0x0, 0x0, 0xf0, 0x0,
-    0xf, 0x0, 0x0, 0xf0, 0x0, 0xf, 0x0, 0x0,
-    0xf0, 0x0, 0xf, 0x0, 0x0, 0xf0, 0x0, 0xf,
-    0x0, 0x0, 0xf0, 0x0, 0xf, 0x0, 0x0, 0xf0,
-    0x0, 0xf, 0x0, 0x0, 0xf0, 0x0, 0xf, 0x0,
-    0x0, 0xf0, 0x7f, 0xff, 0x0,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x27, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xd5, 0x90, 0x0, 0x0,
-    0x6, 0x80, 0xe0, 0x0, 0x0, 0xd, 0x20, 0x96,
-    0x0, 0x0, 0x3b, 0x0, 0x2c, 0x0, 0x0, 0x95,
-    0x0, 0xc, 0x20, 0x0, 0xd0, 0x0, 0x6, 0x90,
-    0x6, 0x80, 0x0, 0x0, 0xe0, 0xc, 0x20, 0x0,
-    0x0, 0x96,
-
-    /* U+005F "_" */
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd0,
-
-    /* U+0060 "`" */
-    0x37, 0x10, 0x0, 0x6d, 0x20, 0x0, 0x2c, 0x40,
-
-    /* U+0061 "a" */
-    0x1, 0x7c, 0xff, 0xd8, 0x0, 0x2e, 0x93, 0x0,
-    0x3c, 0xc0, 0x2, 0x0, 0x0, 0x0, 0xd5, 0x0,
-    0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0x0,
-    0x79, 0x2, 0x9d, 0xde, 0xee, 0xfa, 0x2e, 0x60,
-    0x0, 0x0, 0x7a, 0x89, 0x0, 0x0, 0x0, 0x7a,
-    0xb6, 0x0, 0x0, 0x0, 0x9a, 0x89, 0x0, 0x0,
-    0x2, 0xfa, 0x2e, 0x60, 0x0, 0x4c, 0x8a, 0x2,
-    0xae, 0xdd, 0x91, 0x7a,
-
-    /* U+0062 "b" */
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x5,
-    0xcf, 0xfd, 0x70, 0x0, 0xa7, 0x9c, 0x41, 0x14,
-    0xbd, 0x10, 0xad, 0xa0, 0x0, 0x0, 0x9, 0xc0,
-    0xae, 0x0, 0x0, 0x0, 0x0, 0xd4, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0x89, 0xa7, 0x0, 0x0, 0x0,
-    0x0, 0x5b, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xa9, 0x0, 0x0, 0x0, 0x0, 0x89, 0xae, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0xac, 0xa0, 0x0, 0x0,
-    0x9, 0xc0, 0xa6, 0x9c, 0x41, 0x14, 0xbd, 0x10,
-    0xa6, 0x5, 0xcf, 0xfd, 0x70, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x18, 0xdf, 0xfc, 0x60, 0x0, 0x2e, 0xa3,
-    0x1, 0x5d, 0xa0, 0xd, 0x70, 0x0, 0x0, 0x8,
-    0x7, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xe3, 0x0, 0x0, 0x0, 0x0, 0xc, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x80, 0x2,
-    0xea, 0x30, 0x15, 0xda, 0x0, 0x1, 0x8d, 0xff,
-    0xc6, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x98, 0x0, 0x18,
-    0xdf, 0xfb, 0x40, 0x98, 0x2, 0xea, 0x30, 0x15,
-    0xd7, 0x98, 0xe, 0x70, 0x0, 0x0, 0xc, 0xc8,
-    0x7c, 0x0, 0x0, 0x0, 0x2, 0xf8, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x98,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0xc8, 0x7c, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0xe, 0x70, 0x0, 0x0,
-    0xc, 0xc8, 0x2, 0xea, 0x30, 0x15, 0xd7, 0x88,
-    0x0, 0x18, 0xdf, 0xfb, 0x40, 0x88,
-
-    /* U+0065 "e" */
-    0x0, 0x19, 0xef, 0xea, 0x30, 0x0, 0x3, 0xe8,
-    0x20, 0x16, 0xe6, 0x0, 0xe, 0x50, 0x0, 0x0,
-    0x2e, 0x30, 0x7a, 0x0, 0x0, 0x0, 0x6, 0xb0,
-    0xc5, 0x0, 0x0, 0x0, 0x1, 0xf0, 0xee, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xe0, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7b, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x70,
-    0x0, 0x0, 0x7, 0x10, 0x2, 0xea, 0x41, 0x14,
-    0xbc, 0x10, 0x0, 0x8, 0xdf, 0xfc, 0x70, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x3, 0xcf, 0xe8, 0x0, 0x1, 0xe5, 0x1,
-    0x50, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x7, 0xa0,
-    0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x7a, 0x0, 0x0, 0x0,
-    0x7, 0xa0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0,
-    0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x7a, 0x0,
-    0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x7a,
-    0x0, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x0,
-    0x7a, 0x0, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0,
-    0x0, 0x7a, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x18, 0xdf, 0xeb, 0x50, 0x6a, 0x2, 0xe9,
-    0x20, 0x3, 0xb9, 0x6a, 0xd, 0x60, 0x0, 0x0,
-    0x9, 0xca, 0x7b, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x9a, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x7a, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x7a, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x9a,
-    0x7c, 0x0, 0x0, 0x0, 0x1, 0xea, 0xd, 0x70,
-    0x0, 0x0, 0xa, 0xca, 0x2, 0xea, 0x30, 0x14,
-    0xc9, 0x6a, 0x0, 0x18, 0xdf, 0xfb, 0x40, 0x79,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa6, 0x2, 0x0,
-    0x0, 0x0, 0x2, 0xe1, 0xc, 0xb6, 0x20, 0x2,
-    0x7e, 0x60, 0x0, 0x4a, 0xdf, 0xfe, 0xa3, 0x0,
-
-    /* U+0068 "h" */
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0xa, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x70, 0x7d, 0xff, 0xc5,
-    0x0, 0xa7, 0xc9, 0x30, 0x16, 0xe7, 0xa, 0xe6,
-    0x0, 0x0, 0x3, 0xf2, 0xad, 0x0, 0x0, 0x0,
-    0xb, 0x7a, 0x80, 0x0, 0x0, 0x0, 0x89, 0xa7,
-    0x0, 0x0, 0x0, 0x8, 0x9a, 0x70, 0x0, 0x0,
-    0x0, 0x89, 0xa7, 0x0, 0x0, 0x0, 0x8, 0x9a,
-    0x70, 0x0, 0x0, 0x0, 0x89, 0xa7, 0x0, 0x0,
-    0x0, 0x8, 0x9a, 0x70, 0x0, 0x0, 0x0, 0x89,
-    0xa7, 0x0, 0x0, 0x0, 0x8, 0x90,
-
-    /* U+0069 "i" */
-    0xd, 0x90, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa7, 0xa, 0x70, 0xa7, 0xa, 0x70, 0xa7, 0xa,
-    0x70, 0xa7, 0xa, 0x70, 0xa7, 0xa, 0x70, 0xa7,
-    0xa, 0x70,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0xbb, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x98, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x98, 0x0, 0x0, 0x98, 0x0, 0x0, 0x98, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x98, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0xa7, 0x51, 0x4, 0xf2, 0x7e, 0xfd, 0x50,
-
-    /* U+006B "k" */
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0xa, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x70, 0x0, 0x0, 0xb,
-    0xa0, 0xa7, 0x0, 0x0, 0xb, 0xa0, 0xa, 0x70,
-    0x0, 0x1c, 0xa0, 0x0, 0xa7, 0x0, 0x1c, 0x90,
-    0x0, 0xa, 0x70, 0x1d, 0x90, 0x0, 0x0, 0xa7,
-    0x2d, 0xdb, 0x0, 0x0, 0xa, 0x9e, 0x70, 0xd8,
-    0x0, 0x0, 0xaf, 0x60, 0x2, 0xf4, 0x0, 0xa,
-    0x80, 0x0, 0x5, 0xe1, 0x0, 0xa7, 0x0, 0x0,
-    0x9, 0xc0, 0xa, 0x70, 0x0, 0x0, 0xc, 0x80,
-    0xa7, 0x0, 0x0, 0x0, 0x2e, 0x40,
-
-    /* U+006C "l" */
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7,
-
-    /* U+006D "m" */
-    0xa6, 0x8, 0xde, 0xeb, 0x30, 0x1, 0x9e, 0xee,
-    0xa2, 0x0, 0xa7, 0xc7, 0x10, 0x6, 0xf4, 0x2d,
-    0x60, 0x1, 0x7e, 0x20, 0xae, 0x50, 0x0, 0x0,
-    0x6d, 0xc3, 0x0, 0x0, 0x8, 0xb0, 0xac, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x1, 0xf0,
-    0xa8, 0x0, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0,
-    0x0, 0xe2, 0xa7, 0x0, 0x0, 0x0, 0xc, 0x50,
-    0x0, 0x0, 0x0, 0xe3, 0xa7, 0x0, 0x0, 0x0,
-    0xc, 0x50, 0x0, 0x0, 0x0, 0xe3, 0xa7, 0x0,
-    0x0, 0x0, 0xc, 0x50, 0x0, 0x0, 0x0, 0xe3,
-    0xa7, 0x0, 0x0, 0x0, 0xc, 0x50, 0x0, 0x0,
-    0x0, 0xe3, 0xa7, 0x0, 0x0, 0x0, 0xc, 0x50,
-    0x0, 0x0, 0x0, 0xe3, 0xa7, 0x0, 0x0, 0x0,
-    0xc, 0x50, 0x0, 0x0, 0x0, 0xe3, 0xa7, 0x0,
-    0x0, 0x0, 0xc, 0x50, 0x0, 0x0, 0x0, 0xe3,
-
-    /* U+006E "n" */
-    0xa6, 0x7, 0xdf, 0xfc, 0x50, 0xa, 0x6c, 0x81,
-    0x0, 0x4d, 0x70, 0xae, 0x50, 0x0, 0x0, 0x2f,
-    0x2a, 0xc0, 0x0, 0x0, 0x0, 0xb7, 0xa8, 0x0,
-    0x0, 0x0, 0x8, 0x9a, 0x70, 0x0, 0x0, 0x0,
-    0x89, 0xa7, 0x0, 0x0, 0x0, 0x8, 0x9a, 0x70,
-    0x0, 0x0, 0x0, 0x89, 0xa7, 0x0, 0x0, 0x0,
-    0x8, 0x9a, 0x70, 0x0, 0x0, 0x0, 0x89, 0xa7,
-    0x0, 0x0, 0x0, 0x8, 0x9a, 0x70, 0x0, 0x0,
-    0x0, 0x89,
-
-    /* U+006F "o" */
-    0x0, 0x18, 0xdf, 0xfc, 0x50, 0x0, 0x2, 0xea,
-    0x30, 0x15, 0xda, 0x0, 0xd, 0x70, 0x0, 0x0,
-    0xc, 0x80, 0x7c, 0x0, 0x0, 0x0, 0x2, 0xf1,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0xc6, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x98, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0xc6, 0x0, 0x0, 0x0, 0x0, 0xc6,
-    0x7c, 0x0, 0x0, 0x0, 0x2, 0xf1, 0xd, 0x70,
-    0x0, 0x0, 0xc, 0x80, 0x2, 0xea, 0x30, 0x15,
-    0xda, 0x0, 0x0, 0x18, 0xdf, 0xfc, 0x50, 0x0,
-
-    /* U+0070 "p" */
-    0xa6, 0x5, 0xcf, 0xfd, 0x70, 0x0, 0xa6, 0x9c,
-    0x41, 0x14, 0xbd, 0x10, 0xac, 0xa0, 0x0, 0x0,
-    0x9, 0xc0, 0xae, 0x0, 0x0, 0x0, 0x0, 0xd4,
-    0xa9, 0x0, 0x0, 0x0, 0x0, 0x89, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0x5b, 0xa7, 0x0, 0x0, 0x0,
-    0x0, 0x5b, 0xa9, 0x0, 0x0, 0x0, 0x0, 0x89,
-    0xae, 0x0, 0x0, 0x0, 0x0, 0xe4, 0xad, 0xa0,
-    0x0, 0x0, 0x9, 0xc0, 0xa7, 0x9c, 0x41, 0x14,
-    0xbd, 0x10, 0xa7, 0x5, 0xcf, 0xfd, 0x70, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x18, 0xdf, 0xfb, 0x40, 0x88, 0x2, 0xea,
-    0x30, 0x15, 0xd7, 0x88, 0xe, 0x70, 0x0, 0x0,
-    0xc, 0xc8, 0x7c, 0x0, 0x0, 0x0, 0x2, 0xf8,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0xc8, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x98, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0xc6, 0x0, 0x0, 0x0, 0x0, 0xc8,
-    0x7c, 0x0, 0x0, 0x0, 0x2, 0xf8, 0xe, 0x70,
-    0x0, 0x0, 0xc, 0xc8, 0x2, 0xea, 0x30, 0x15,
-    0xd7, 0x98, 0x0, 0x18, 0xdf, 0xfb, 0x40, 0x98,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x98,
-
-    /* U+0072 "r" */
-    0xa6, 0x8, 0xdc, 0xa7, 0xc7, 0x10, 0xae, 0x50,
-    0x0, 0xac, 0x0, 0x0, 0xa8, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0xa7, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0xa7, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x4b, 0xff, 0xeb, 0x50, 0x5, 0xe5, 0x10,
-    0x25, 0xd2, 0xd, 0x50, 0x0, 0x0, 0x0, 0xe,
-    0x30, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xa7, 0x40, 0x0, 0x0, 0x2,
-    0x69, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xd7,
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0x2, 0x0, 0x0,
-    0x0, 0x7a, 0x2f, 0x93, 0x0, 0x16, 0xe3, 0x2,
-    0x8d, 0xff, 0xea, 0x20,
-
-    /* U+0074 "t" */
-    0x0, 0x35, 0x0, 0x0, 0x0, 0x7, 0xa0, 0x0,
-    0x0, 0x0, 0x7a, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x7,
-    0xa0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x0,
-    0x7, 0xa0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0,
-    0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x7a, 0x0,
-    0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x1, 0x50, 0x0,
-    0x4, 0xdf, 0xe8, 0x0,
-
-    /* U+0075 "u" */
-    0xc4, 0x0, 0x0, 0x0, 0xb, 0x6c, 0x40, 0x0,
-    0x0, 0x0, 0xb6, 0xc4, 0x0, 0x0, 0x0, 0xb,
-    0x6c, 0x40, 0x0, 0x0, 0x0, 0xb6, 0xc4, 0x0,
-    0x0, 0x0, 0xb, 0x6c, 0x40, 0x0, 0x0, 0x0,
-    0xb6, 0xc4, 0x0, 0x0, 0x0, 0xb, 0x6c, 0x50,
-    0x0, 0x0, 0x0, 0xd6, 0xa8, 0x0, 0x0, 0x0,
-    0x1f, 0x65, 0xe1, 0x0, 0x0, 0xa, 0xe6, 0xb,
-    0xd4, 0x10, 0x4b, 0x8a, 0x60, 0x7, 0xdf, 0xfc,
-    0x50, 0xa6,
-
-    /* U+0076 "v" */
-    0xb7, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x4d, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0xd, 0x40, 0x0, 0x0,
-    0xa, 0x70, 0x6, 0xb0, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0xf2, 0x0, 0x0, 0x89, 0x0, 0x0, 0x99,
-    0x0, 0x0, 0xe2, 0x0, 0x0, 0x2f, 0x0, 0x5,
-    0xb0, 0x0, 0x0, 0xb, 0x60, 0xc, 0x40, 0x0,
-    0x0, 0x4, 0xd0, 0x3d, 0x0, 0x0, 0x0, 0x0,
-    0xd4, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x97, 0x0, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x0,
-    0x7, 0x93, 0xd0, 0x0, 0x0, 0x8, 0xe8, 0x0,
-    0x0, 0x0, 0xc3, 0xd, 0x20, 0x0, 0x0, 0xe5,
-    0xe0, 0x0, 0x0, 0x2d, 0x0, 0x88, 0x0, 0x0,
-    0x4c, 0xc, 0x30, 0x0, 0x8, 0x70, 0x2, 0xe0,
-    0x0, 0xa, 0x60, 0x69, 0x0, 0x0, 0xe1, 0x0,
-    0xc, 0x30, 0x0, 0xe0, 0x1, 0xe0, 0x0, 0x4c,
-    0x0, 0x0, 0x69, 0x0, 0x5a, 0x0, 0xb, 0x50,
-    0x9, 0x60, 0x0, 0x1, 0xe0, 0xb, 0x40, 0x0,
-    0x5b, 0x0, 0xe0, 0x0, 0x0, 0xb, 0x41, 0xe0,
-    0x0, 0x0, 0xe1, 0x5a, 0x0, 0x0, 0x0, 0x5a,
-    0x78, 0x0, 0x0, 0x9, 0x6b, 0x40, 0x0, 0x0,
-    0x0, 0xed, 0x20, 0x0, 0x0, 0x3d, 0xe0, 0x0,
-    0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0xd9,
-    0x0, 0x0,
-
-    /* U+0078 "x" */
-    0xd, 0x50, 0x0, 0x0, 0x1e, 0x40, 0x2e, 0x20,
-    0x0, 0xb, 0x80, 0x0, 0x6d, 0x0, 0x7, 0xc0,
-    0x0, 0x0, 0xa9, 0x3, 0xe1, 0x0, 0x0, 0x0,
-    0xd6, 0xd4, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xc0, 0x0, 0x0, 0x0,
-    0x3e, 0x2a, 0x90, 0x0, 0x0, 0xd, 0x50, 0xd,
-    0x50, 0x0, 0xa, 0x90, 0x0, 0x3e, 0x20, 0x6,
-    0xd0, 0x0, 0x0, 0x7c, 0x2, 0xe2, 0x0, 0x0,
-    0x0, 0xb9,
-
-    /* U+0079 "y" */
-    0xb, 0x70, 0x0, 0x0, 0x0, 0xc, 0x50, 0x4d,
-    0x0, 0x0, 0x0, 0x3, 0xd0, 0x0, 0xd5, 0x0,
-    0x0, 0x0, 0xb6, 0x0, 0x6, 0xb0, 0x0, 0x0,
-    0x2e, 0x0, 0x0, 0xe, 0x20, 0x0, 0x9, 0x80,
-    0x0, 0x0, 0x89, 0x0, 0x1, 0xf1, 0x0, 0x0,
-    0x1, 0xf1, 0x0, 0x7a, 0x0, 0x0, 0x0, 0xa,
-    0x70, 0xe, 0x30, 0x0, 0x0, 0x0, 0x3e, 0x5,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xc5, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa8,
-    0x0, 0x0, 0x0, 0x47, 0x10, 0x8d, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xfb, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x70, 0x0, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x0, 0x5, 0xe1, 0x0, 0x0, 0x0,
-    0x2, 0xe3, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0x10, 0x0, 0x0, 0x0, 0x1e, 0x40, 0x0,
-    0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xf1,
-
-    /* U+007B "{" */
-    0x0, 0x2b, 0xf8, 0x0, 0xaa, 0x0, 0x0, 0xd4,
-    0x0, 0x0, 0xe3, 0x0, 0x0, 0xe3, 0x0, 0x0,
-    0xe3, 0x0, 0x0, 0xe3, 0x0, 0x0, 0xe3, 0x0,
-    0x0, 0xe3, 0x0, 0x1, 0xf2, 0x0, 0x9f, 0xb0,
-    0x0, 0x1, 0xf2, 0x0, 0x0, 0xe3, 0x0, 0x0,
-    0xe3, 0x0, 0x0, 0xe3, 0x0, 0x0, 0xe3, 0x0,
-    0x0, 0xe3, 0x0, 0x0, 0xe3, 0x0, 0x0, 0xd4,
-    0x0, 0x0, 0xaa, 0x0, 0x0, 0x1b, 0xf8,
-
-    /* U+007C "|" */
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-
-    /* U+007D "}" */
-    0x7f, 0xc2, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x2f, 0x0, 0x0, 0x2f, 0x0, 0x0,
-    0x2f, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x2f, 0x0,
-    0x0, 0x2f, 0x0, 0x0, 0x1f, 0x20, 0x0, 0xa,
-    0xfa, 0x0, 0x1f, 0x20, 0x0, 0x2f, 0x0, 0x0,
-    0x2f, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x2f, 0x0,
-    0x0, 0x2f, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x9b, 0x0, 0x7f, 0xc2, 0x0,
-
-    /* U+007E "~" */
-    0x6, 0xee, 0x90, 0x0, 0xb, 0x4, 0xc1, 0x8,
-    0xd3, 0x4, 0xb0, 0x74, 0x0, 0x4, 0xce, 0xb1,
-    0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x7, 0x20, 0x17, 0x0, 0x6, 0xa0, 0xb,
-    0x50, 0x3, 0xd1, 0x7, 0x90, 0x0, 0xd3, 0x3,
-    0xd0, 0x0, 0x98, 0x0, 0xe3, 0x0, 0x4, 0xc0,
-    0x9, 0x80, 0x0, 0x8, 0x90, 0xc, 0x40, 0x0,
-    0xb, 0x50, 0x2d, 0x10, 0x0, 0x1d, 0x20, 0x5b,
-    0x0,
-
-    /* U+00BB "»" */
-    0x7, 0x10, 0x17, 0x0, 0x0, 0x5b, 0x0, 0xa6,
-    0x0, 0x0, 0x97, 0x0, 0xd3, 0x0, 0x0, 0xc4,
-    0x3, 0xd0, 0x0, 0x2, 0xe0, 0x7, 0x90, 0x0,
-    0x89, 0x0, 0xc4, 0x0, 0x4c, 0x0, 0x98, 0x0,
-    0x1d, 0x20, 0x5b, 0x0, 0xb, 0x50, 0x1d, 0x10,
-    0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x1b, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3e, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xee, 0xee, 0xee, 0xee, 0x10,
-    0x3e, 0x11, 0x11, 0x11, 0x11, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+0401 "Ё" */
-    0x0, 0x5, 0x60, 0x7, 0x40, 0x0, 0x0, 0x9,
-    0xa0, 0xd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3e, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xee, 0xee, 0xee, 0xee, 0x10,
-    0x3e, 0x11, 0x11, 0x11, 0x11, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+0402 "Ђ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x11, 0x11, 0x4e, 0x11, 0x11, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x4,
-    0x78, 0x85, 0x10, 0x0, 0x0, 0x0, 0x3f, 0xaf,
-    0xb8, 0x78, 0xcf, 0x60, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x7b, 0x0, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xe0, 0x0,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x10, 0x2, 0xad, 0x10,
-    0x0, 0x0, 0x3e, 0x0, 0xa, 0xff, 0xe9, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x7d, 0x30, 0x0, 0x0, 0x0,
-    0xaa, 0x0, 0x0, 0x0, 0x0, 0x45, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x43, 0xe1, 0x11, 0x11, 0x11,
-    0x10, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x29, 0xdf, 0xfd, 0xa4, 0x0, 0x0,
-    0x8, 0xf9, 0x41, 0x13, 0x7e, 0xb1, 0x0, 0x9d,
-    0x20, 0x0, 0x0, 0x0, 0xa6, 0x5, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7b,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x20, 0x0, 0x0,
-    0x0, 0x74, 0x0, 0x8, 0xf9, 0x41, 0x13, 0x6d,
-    0xc1, 0x0, 0x0, 0x29, 0xdf, 0xfd, 0xa5, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x29, 0xdf, 0xfe, 0xa4, 0x0, 0x4, 0xf9,
-    0x31, 0x2, 0x7d, 0x80, 0xe, 0x50, 0x0, 0x0,
-    0x0, 0x10, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xea, 0x61, 0x0, 0x0,
-    0x0, 0x0, 0x27, 0xbf, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x76, 0x0,
-    0x0, 0x0, 0x4, 0xf1, 0x2d, 0xc6, 0x20, 0x2,
-    0x8f, 0x50, 0x0, 0x5a, 0xef, 0xfd, 0x92, 0x0,
-
-    /* U+0406 "І" */
-    0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
-    0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
-
-    /* U+0407 "Ї" */
-    0x28, 0x0, 0x47, 0x4e, 0x10, 0x7c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x5d, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0x5d, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x5d,
-    0x0, 0x0, 0x5d, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x5d, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0x5d, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x5d,
-    0x0, 0x0, 0x5d, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0xff, 0xff, 0xff, 0xc0, 0x1, 0x11, 0x11,
-    0x5c, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0,
-    0x0, 0x5c, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x0,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x5, 0xc0,
-    0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x5,
-    0xc0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0x5, 0xc0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0,
-    0x0, 0x7, 0xb3, 0x90, 0x0, 0x0, 0xc7, 0xc,
-    0xb3, 0x12, 0xae, 0x10, 0x8, 0xdf, 0xea, 0x20,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb5,
-    0x11, 0x11, 0x11, 0x1c, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc4, 0x0, 0x0, 0x0,
-    0xc, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc3, 0x0, 0x0, 0x0, 0xc, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x0,
-    0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd2, 0x0, 0x0, 0x0, 0xc,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe2, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xec, 0x60, 0x0, 0x0, 0x0, 0xe1, 0x0, 0x0,
-    0x0, 0xc, 0x80, 0x0, 0x0, 0x15, 0xcc, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xc, 0x80,
-    0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x0,
-    0x4, 0xe0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x0,
-    0xc, 0x80, 0x0, 0x0, 0x0, 0x2, 0xf0, 0x0,
-    0x5, 0xb0, 0x0, 0x0, 0x0, 0xc, 0x80, 0x0,
-    0x0, 0x0, 0x2, 0xf0, 0x0, 0x9, 0x80, 0x0,
-    0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0x6,
-    0xd0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0xc,
-    0x80, 0x0, 0x0, 0x0, 0x1d, 0x70, 0x12, 0xbc,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x81, 0x11, 0x11,
-    0x37, 0xeb, 0x0, 0xbf, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+040A "Њ" */
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xee, 0xee, 0xee,
-    0xee, 0xef, 0xfe, 0xee, 0xee, 0xec, 0x81, 0x0,
-    0x3e, 0x11, 0x11, 0x11, 0x11, 0x15, 0xf1, 0x11,
-    0x11, 0x25, 0xbe, 0x20, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x9, 0xc0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xf1, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf2,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xf1, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x9, 0xb0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x3, 0xae, 0x20, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0,
-
-    /* U+040B "Ћ" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x11, 0x11, 0x6d, 0x11, 0x11, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xc1, 0x6a,
-    0xde, 0xda, 0x40, 0x0, 0x0, 0x0, 0x5f, 0xfa,
-    0x63, 0x13, 0x7f, 0x90, 0x0, 0x0, 0x5, 0xe1,
-    0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x5c,
-    0x0, 0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x5,
-    0xc0, 0x0, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0,
-    0x5c, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x5, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x5, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x3e,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x4e, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x20, 0x0, 0x0, 0x0, 0x0, 0x26,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0x13, 0xe0, 0x0, 0x0, 0x0, 0x1e, 0x30, 0x3e,
-    0x0, 0x0, 0x0, 0xc, 0x60, 0x3, 0xe0, 0x0,
-    0x0, 0x9, 0xa0, 0x0, 0x3e, 0x0, 0x0, 0x5,
-    0xd0, 0x0, 0x3, 0xe0, 0x0, 0x2, 0xe2, 0x0,
-    0x0, 0x3e, 0x0, 0x1, 0xd4, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x3e, 0x22,
-    0x24, 0xf3, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x6,
-    0xe1, 0x0, 0x0, 0x3e, 0x0, 0x0, 0xa, 0xb0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0xd, 0x70, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x6d, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xd6,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0xac, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x27, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xe6, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0xc6, 0x3e, 0x0, 0x0, 0x0, 0x3, 0xf2, 0xc6,
-    0x3e, 0x0, 0x0, 0x0, 0x1e, 0x50, 0xc6, 0x3e,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0xc6, 0x3e, 0x0,
-    0x0, 0x7, 0xd0, 0x0, 0xc6, 0x3e, 0x0, 0x0,
-    0x3f, 0x20, 0x0, 0xc6, 0x3e, 0x0, 0x1, 0xe6,
-    0x0, 0x0, 0xc6, 0x3e, 0x0, 0xb, 0xa0, 0x0,
-    0x0, 0xc6, 0x3e, 0x0, 0x7d, 0x0, 0x0, 0x0,
-    0xc6, 0x3e, 0x3, 0xf2, 0x0, 0x0, 0x0, 0xc6,
-    0x3e, 0x1e, 0x60, 0x0, 0x0, 0x0, 0xc6, 0x3e,
-    0xba, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x3f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xc6, 0x3f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xc6,
-
-    /* U+040E "Ў" */
-    0x0, 0x2, 0xc0, 0x0, 0x6, 0x80, 0x0, 0x0,
-    0x0, 0xb, 0x60, 0x2, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xbb, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0x20, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xa0, 0x3, 0xf1, 0x0,
-    0x0, 0x0, 0x1, 0xe2, 0x0, 0xb, 0x80, 0x0,
-    0x0, 0x0, 0x89, 0x0, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0x1e, 0x10, 0x0, 0x0, 0xa8, 0x0, 0x0,
-    0x9, 0x80, 0x0, 0x0, 0x2, 0xf1, 0x0, 0x1,
-    0xe1, 0x0, 0x0, 0x0, 0xa, 0x80, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x10, 0x2e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa8, 0xa, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xe3, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x21, 0x3c, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf3, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x60,
-    0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0xb, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xd4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x98, 0x6b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf1, 0xf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xa0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x30, 0x2, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0xa8, 0x0, 0x0,
-    0x0, 0x0, 0xd5, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x4, 0xe0, 0x0, 0x0, 0xc, 0x60, 0x0,
-    0x0, 0xb, 0x70, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x1, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20,
-    0x7, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x90,
-    0xe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf1,
-    0x5d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb7,
-
-    /* U+0411 "Б" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfe, 0xa4, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x16, 0xe9, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x1,
-    0xf3, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x9, 0x83,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x79, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x83, 0xe0, 0x0, 0x0,
-    0x0, 0x2, 0xf3, 0x3e, 0x0, 0x0, 0x0, 0x27,
-    0xe7, 0x3, 0xff, 0xff, 0xff, 0xfd, 0xa3, 0x0,
-
-    /* U+0412 "В" */
-    0x3f, 0xff, 0xff, 0xff, 0xd9, 0x20, 0x3, 0xe0,
-    0x0, 0x0, 0x2, 0x8f, 0x40, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xf1, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x3e,
-    0x0, 0x0, 0x0, 0x28, 0xd2, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x4, 0xbb, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xb7, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x5, 0xc3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xc8, 0x3e, 0x0, 0x0, 0x0, 0x4,
-    0xbc, 0x3, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x0,
-
-    /* U+0413 "Г" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0x43, 0xe1, 0x11,
-    0x11, 0x11, 0x10, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xf, 0x21, 0x11, 0x11, 0x11, 0xf1,
-    0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0, 0xf,
-    0x10, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x0,
-    0xf1, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0x10, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
-    0x0, 0xf1, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0x10, 0x0, 0x0, 0x2d, 0x0, 0x0,
-    0x0, 0x0, 0xf1, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x5b, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x7, 0x90,
-    0x0, 0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x96,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0xd,
-    0x20, 0x0, 0x0, 0x0, 0xf, 0x10, 0x0, 0x3,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x3,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0x7c, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x97, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x76, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x43,
-
-    /* U+0415 "Е" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3e, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xee, 0xee, 0xee, 0xee, 0x10,
-    0x3e, 0x11, 0x11, 0x11, 0x11, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+0416 "Ж" */
-    0xa, 0x90, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0xb, 0x80, 0x1, 0xe4, 0x0, 0x0, 0x0,
-    0x98, 0x0, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x4e,
-    0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x1, 0xe3,
-    0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x98, 0x0,
-    0x0, 0xb, 0x80, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0,
-    0x0, 0x4e, 0x0, 0x0, 0x98, 0x0, 0x1, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0x90, 0x0, 0x98,
-    0x0, 0xb, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xc2, 0x22, 0xa9, 0x22, 0x2d,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0,
-    0x98, 0x0, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x98, 0x0, 0x0, 0x9c, 0x0,
-    0x0, 0x0, 0x8, 0xd0, 0x0, 0x0, 0x98, 0x0,
-    0x0, 0xe, 0x60, 0x0, 0x0, 0x2f, 0x30, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0,
-    0xc8, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0,
-    0xab, 0x0, 0x7, 0xd0, 0x0, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x0, 0x1e, 0x50, 0x2f, 0x40, 0x0,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x5, 0xe1,
-
-    /* U+0417 "З" */
-    0x0, 0x5a, 0xdf, 0xfd, 0xa3, 0x0, 0x0, 0xdb,
-    0x62, 0x11, 0x38, 0xf6, 0x0, 0x2, 0x0, 0x0,
-    0x0, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0x5d, 0x70, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x4b, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x8, 0x40, 0x0, 0x0,
-    0x0, 0xb, 0x90, 0x4e, 0xb5, 0x20, 0x1, 0x5c,
-    0xc0, 0x0, 0x6, 0xbe, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+0418 "И" */
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe6, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0xc6, 0x3e, 0x0, 0x0,
-    0x0, 0x3, 0xf2, 0xc6, 0x3e, 0x0, 0x0, 0x0,
-    0x1e, 0x50, 0xc6, 0x3e, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0xc6, 0x3e, 0x0, 0x0, 0x7, 0xd0, 0x0,
-    0xc6, 0x3e, 0x0, 0x0, 0x3f, 0x20, 0x0, 0xc6,
-    0x3e, 0x0, 0x1, 0xe6, 0x0, 0x0, 0xc6, 0x3e,
-    0x0, 0xb, 0xa0, 0x0, 0x0, 0xc6, 0x3e, 0x0,
-    0x7d, 0x0, 0x0, 0x0, 0xc6, 0x3e, 0x3, 0xf2,
-    0x0, 0x0, 0x0, 0xc6, 0x3e, 0x1e, 0x60, 0x0,
-    0x0, 0x0, 0xc6, 0x3e, 0xba, 0x0, 0x0, 0x0,
-    0x0, 0xc6, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xc6, 0x3f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc6,
-
-    /* U+0419 "Й" */
-    0x0, 0x5, 0x90, 0x0, 0x9, 0x50, 0x0, 0x0,
-    0x0, 0xd4, 0x0, 0x4d, 0x10, 0x0, 0x0, 0x0,
-    0x19, 0xbb, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xe6, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0xc6, 0x3e, 0x0, 0x0, 0x0, 0x3, 0xf2, 0xc6,
-    0x3e, 0x0, 0x0, 0x0, 0x1e, 0x50, 0xc6, 0x3e,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0xc6, 0x3e, 0x0,
-    0x0, 0x7, 0xd0, 0x0, 0xc6, 0x3e, 0x0, 0x0,
-    0x3f, 0x20, 0x0, 0xc6, 0x3e, 0x0, 0x1, 0xe6,
-    0x0, 0x0, 0xc6, 0x3e, 0x0, 0xb, 0xa0, 0x0,
-    0x0, 0xc6, 0x3e, 0x0, 0x7d, 0x0, 0x0, 0x0,
-    0xc6, 0x3e, 0x3, 0xf2, 0x0, 0x0, 0x0, 0xc6,
-    0x3e, 0x1e, 0x60, 0x0, 0x0, 0x0, 0xc6, 0x3e,
-    0xba, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x3f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xc6, 0x3f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xc6,
-
-    /* U+041A "К" */
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x13, 0xe0,
-    0x0, 0x0, 0x0, 0x1e, 0x30, 0x3e, 0x0, 0x0,
-    0x0, 0xc, 0x60, 0x3, 0xe0, 0x0, 0x0, 0x9,
-    0xa0, 0x0, 0x3e, 0x0, 0x0, 0x5, 0xd0, 0x0,
-    0x3, 0xe0, 0x0, 0x2, 0xe2, 0x0, 0x0, 0x3e,
-    0x0, 0x1, 0xd4, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x3e, 0x22, 0x24, 0xf3,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x6, 0xe1, 0x0,
-    0x0, 0x3e, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0xd, 0x70, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x2f, 0x30, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x6d, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0xaa, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xd6,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xb, 0x51, 0x11, 0x11, 0x11, 0xb6, 0x0,
-    0x0, 0xc4, 0x0, 0x0, 0x0, 0xb, 0x60, 0x0,
-    0xc, 0x30, 0x0, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0xd3, 0x0, 0x0, 0x0, 0xb, 0x60, 0x0, 0xd,
-    0x20, 0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0xb, 0x60, 0x0, 0xe, 0x10,
-    0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0xb, 0x60, 0x0, 0x1f, 0x0, 0x0,
-    0x0, 0x0, 0xb6, 0x0, 0x3, 0xd0, 0x0, 0x0,
-    0x0, 0xb, 0x60, 0x0, 0x5b, 0x0, 0x0, 0x0,
-    0x0, 0xb6, 0x0, 0x9, 0x80, 0x0, 0x0, 0x0,
-    0xb, 0x60, 0x0, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0xb6, 0x12, 0xbc, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x6b, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0xb6,
-
-    /* U+041C "М" */
-    0x3e, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x63, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x3e, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x63, 0xe7, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x7a, 0xb6, 0x3e, 0xe, 0x30, 0x0, 0x0, 0x0,
-    0x1e, 0x2b, 0x63, 0xe0, 0x5c, 0x0, 0x0, 0x0,
-    0x9, 0x80, 0xa6, 0x3e, 0x0, 0xc5, 0x0, 0x0,
-    0x2, 0xe1, 0xa, 0x63, 0xe0, 0x4, 0xd0, 0x0,
-    0x0, 0xa6, 0x0, 0xa6, 0x3e, 0x0, 0xb, 0x70,
-    0x0, 0x3d, 0x0, 0xa, 0x63, 0xe0, 0x0, 0x2e,
-    0x10, 0xc, 0x50, 0x0, 0xa6, 0x3e, 0x0, 0x0,
-    0x99, 0x5, 0xc0, 0x0, 0xa, 0x63, 0xe0, 0x0,
-    0x1, 0xe2, 0xd3, 0x0, 0x0, 0xa6, 0x3e, 0x0,
-    0x0, 0x7, 0xea, 0x0, 0x0, 0xa, 0x63, 0xe0,
-    0x0, 0x0, 0xc, 0x10, 0x0, 0x0, 0xa7, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x73,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7,
-
-    /* U+041D "Н" */
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd5, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd5, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd5, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd5, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd5, 0x3f, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf5,
-    0x3e, 0x11, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd5, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd5, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd5, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd5, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd5, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd5,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x18, 0xcf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa5, 0x21, 0x26, 0xce, 0x40,
-    0x0, 0x0, 0x8e, 0x30, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0x5e, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x10, 0xe, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaa, 0x4, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf0, 0x8a, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x39, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc5, 0x98, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x58, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0x4e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x5, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf2, 0x0, 0x8,
-    0xe3, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0x7, 0xfa, 0x41, 0x12, 0x6c, 0xe4, 0x0, 0x0,
-    0x0, 0x1, 0x8c, 0xff, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3e,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0xb7, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa7, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa7, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa7, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa7, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa7, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa7, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa7, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa7, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7,
-
-    /* U+0420 "Р" */
-    0x3f, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0x3, 0xe1,
-    0x11, 0x11, 0x26, 0xcc, 0x10, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0x3e, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x63, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x63, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xf3, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x9b, 0x3, 0xe0, 0x0, 0x0, 0x3, 0xbd,
-    0x10, 0x3f, 0xee, 0xee, 0xef, 0xd7, 0x0, 0x3,
-    0xe1, 0x11, 0x11, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x18, 0xcf, 0xfe, 0xb6, 0x0, 0x0,
-    0x6, 0xfa, 0x52, 0x12, 0x6c, 0xd3, 0x0, 0x8e,
-    0x30, 0x0, 0x0, 0x0, 0x68, 0x5, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7a,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8e, 0x30, 0x0, 0x0,
-    0x0, 0x68, 0x0, 0x7, 0xfa, 0x52, 0x12, 0x5c,
-    0xd3, 0x0, 0x0, 0x18, 0xcf, 0xfe, 0xb6, 0x0,
-
-    /* U+0422 "Т" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x11,
-    0x11, 0x4e, 0x11, 0x11, 0x10, 0x0, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x20,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x3,
-    0xf1, 0x0, 0x0, 0x0, 0x1, 0xe2, 0x0, 0xb,
-    0x80, 0x0, 0x0, 0x0, 0x89, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x1e, 0x10, 0x0, 0x0, 0xa8,
-    0x0, 0x0, 0x9, 0x80, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x1, 0xe1, 0x0, 0x0, 0x0, 0xa, 0x80,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x10,
-    0x2e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa8, 0xa,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0xe3, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x21, 0x3c, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x44, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0xce, 0xff, 0xec,
-    0x93, 0x0, 0x0, 0x0, 0x2c, 0xd7, 0x30, 0x88,
-    0x3, 0x7d, 0xc2, 0x0, 0x3, 0xe7, 0x0, 0x0,
-    0x88, 0x0, 0x0, 0x6e, 0x30, 0xe, 0x60, 0x0,
-    0x0, 0x88, 0x0, 0x0, 0x6, 0xe0, 0x6c, 0x0,
-    0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0xc6, 0xa7,
-    0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0x7a,
-    0xc4, 0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0,
-    0x5c, 0xc5, 0x0, 0x0, 0x0, 0x88, 0x0, 0x0,
-    0x0, 0x5c, 0xa7, 0x0, 0x0, 0x0, 0x88, 0x0,
-    0x0, 0x0, 0x7a, 0x6c, 0x0, 0x0, 0x0, 0x88,
-    0x0, 0x0, 0x0, 0xc6, 0xe, 0x60, 0x0, 0x0,
-    0x88, 0x0, 0x0, 0x6, 0xe0, 0x3, 0xe7, 0x0,
-    0x0, 0x88, 0x0, 0x0, 0x7e, 0x30, 0x0, 0x2c,
-    0xd7, 0x31, 0x88, 0x13, 0x7d, 0xc2, 0x0, 0x0,
-    0x0, 0x39, 0xce, 0xff, 0xec, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0xa, 0xa0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x1,
-    0xe5, 0x0, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x4e,
-    0x10, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x7d, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x23, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xcd, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x67, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xab, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x5, 0xe1,
-    0x0, 0x2f, 0x40, 0x0, 0x0, 0x1e, 0x50, 0x0,
-    0x6, 0xe1, 0x0, 0x0, 0xba, 0x0, 0x0, 0x0,
-    0xba, 0x0, 0x6, 0xe0, 0x0, 0x0, 0x0, 0x1e,
-    0x50, 0x2f, 0x40, 0x0, 0x0, 0x0, 0x5, 0xe1,
-
-    /* U+0426 "Ц" */
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6,
-
-    /* U+0427 "Ч" */
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xc7, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x6e, 0x10, 0x0, 0x0, 0x0, 0x3e,
-    0xb, 0xd5, 0x0, 0x1, 0x5a, 0xfe, 0x0, 0x7d,
-    0xff, 0xff, 0xb6, 0x4e, 0x0, 0x0, 0x1, 0x10,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-
-    /* U+0428 "Ш" */
-    0x3e, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0xd4, 0x3e, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0xd4, 0x3e, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0xd4, 0x3e, 0x0,
-    0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0xd4,
-    0x3e, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0xd4, 0x3e, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0xd4, 0x3e, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0xd4, 0x3e, 0x0,
-    0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0xd4,
-    0x3e, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0xd4, 0x3e, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0xd4, 0x3e, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0xd4, 0x3e, 0x0,
-    0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0xd4,
-    0x3e, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0xd4, 0x3e, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0xd4, 0x3e, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0xd4, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+0429 "Щ" */
-    0x3e, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0xd4, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x8,
-    0x90, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0xd4,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0,
-    0x0, 0x0, 0xd4, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0,
-    0xd4, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0xd4, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0xd4, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0xd4, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x8,
-    0x90, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0xd4,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0,
-    0x0, 0x0, 0xd4, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0,
-    0xd4, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x25,
-
-    /* U+042A "Ъ" */
-    0xcf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x11, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xeb, 0x50, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x1, 0x6d, 0xa0, 0x0, 0x0, 0xe, 0x40,
-    0x0, 0x0, 0x0, 0x1e, 0x50, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x7b, 0x0, 0x0, 0xe,
-    0x40, 0x0, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x4d, 0x0, 0x0,
-    0xe, 0x40, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x0, 0x1, 0xe4, 0x0,
-    0x0, 0xe, 0x40, 0x0, 0x0, 0x16, 0xe8, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xfe, 0xa4, 0x0,
-
-    /* U+042B "Ы" */
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0x73, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa7, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x73, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa7, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x73, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x3f, 0xff, 0xff, 0xff, 0xd9,
-    0x20, 0x0, 0xa, 0x73, 0xe0, 0x0, 0x0, 0x2,
-    0x8f, 0x50, 0x0, 0xa7, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0xa, 0x73, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xd5, 0x0, 0xa7, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x70, 0xa, 0x73, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xa7, 0x0, 0xa7, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x50, 0xa, 0x73, 0xe0,
-    0x0, 0x0, 0x0, 0x6, 0xe0, 0x0, 0xa7, 0x3e,
-    0x0, 0x0, 0x0, 0x39, 0xe4, 0x0, 0xa, 0x73,
-    0xff, 0xff, 0xff, 0xfd, 0x81, 0x0, 0x0, 0xa7,
-
-    /* U+042C "Ь" */
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xd9, 0x20, 0x3, 0xe0, 0x0,
-    0x0, 0x2, 0x8f, 0x50, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x13, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xd5, 0x3e, 0x0, 0x0, 0x0, 0x0, 0xa, 0x73,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x53, 0xe0, 0x0, 0x0,
-    0x0, 0x6, 0xe0, 0x3e, 0x0, 0x0, 0x0, 0x39,
-    0xe4, 0x3, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x18, 0xce, 0xfe, 0xb6, 0x0, 0x0, 0x0,
-    0x6f, 0xa5, 0x21, 0x26, 0xdd, 0x20, 0x0, 0x9,
-    0x20, 0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xd0, 0x0, 0xc4, 0x0, 0x0, 0x0, 0x8, 0xf3,
-    0x0, 0x5, 0xfa, 0x52, 0x12, 0x6d, 0xd3, 0x0,
-    0x0, 0x1, 0x7c, 0xef, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x3e, 0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xd8,
-    0x20, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x9, 0xf8,
-    0x31, 0x14, 0xaf, 0x70, 0x0, 0x3e, 0x0, 0x0,
-    0xa, 0xd2, 0x0, 0x0, 0x0, 0x3e, 0x80, 0x3,
-    0xe0, 0x0, 0x6, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x40, 0x3e, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x3e,
-    0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x53, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa7, 0x3e, 0x22, 0x2b, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x73, 0xe0,
-    0x0, 0x89, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc5, 0x3e, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x23, 0xe0, 0x0, 0xe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x3e, 0x0,
-    0x0, 0x7e, 0x10, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x3, 0xe0, 0x0, 0x0, 0xbc, 0x10, 0x0, 0x0,
-    0x3, 0xe8, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x9f,
-    0x83, 0x11, 0x49, 0xf7, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0x0, 0x39, 0xdf, 0xfd, 0x82, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x6, 0xbe, 0xff, 0xff, 0xff, 0x50, 0xc,
-    0xd6, 0x21, 0x11, 0x11, 0xd5, 0x9, 0xb0, 0x0,
-    0x0, 0x0, 0xc, 0x51, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xc5, 0x4d, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x56, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x5d,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x52, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xc5, 0xb, 0xa0, 0x0, 0x0,
-    0x0, 0xc, 0x50, 0x1d, 0xb4, 0x0, 0x0, 0x0,
-    0xc5, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x5d, 0x0, 0x0, 0x0, 0xc5, 0x0, 0x1e,
-    0x30, 0x0, 0x0, 0xc, 0x50, 0xb, 0x70, 0x0,
-    0x0, 0x0, 0xc5, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0xc, 0x51, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xc5,
-
-    /* U+0430 "а" */
-    0x1, 0x7c, 0xff, 0xd8, 0x0, 0x2e, 0x93, 0x0,
-    0x3c, 0xc0, 0x2, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x0,
-    0x89, 0x2, 0xad, 0xee, 0xee, 0xf9, 0x2e, 0x60,
-    0x0, 0x0, 0x89, 0x99, 0x0, 0x0, 0x0, 0x89,
-    0xb6, 0x0, 0x0, 0x0, 0x99, 0x99, 0x0, 0x0,
-    0x2, 0xf9, 0x2e, 0x60, 0x0, 0x4c, 0x89, 0x2,
-    0xae, 0xdd, 0x91, 0x79,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x26, 0xa7, 0x0, 0x0,
-    0x0, 0x5a, 0xee, 0xb7, 0x20, 0x0, 0x4, 0xec,
-    0x73, 0x0, 0x0, 0x0, 0x6, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x11, 0x8d, 0xfe, 0xb4, 0x0, 0x3, 0xd2, 0xd8,
-    0x20, 0x27, 0xf7, 0x0, 0x5b, 0xc4, 0x0, 0x0,
-    0x2, 0xf4, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x1f, 0x15,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf2, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0xf3, 0x0, 0x0,
-    0x0, 0x1, 0xf0, 0xa, 0x90, 0x0, 0x0, 0x0,
-    0x7b, 0x0, 0x2f, 0x40, 0x0, 0x0, 0x2f, 0x30,
-    0x0, 0x6f, 0x81, 0x1, 0x6e, 0x60, 0x0, 0x0,
-    0x3b, 0xef, 0xea, 0x30, 0x0,
-
-    /* U+0432 "в" */
-    0xaf, 0xff, 0xff, 0xe9, 0x10, 0xa7, 0x0, 0x0,
-    0x19, 0xe0, 0xa7, 0x0, 0x0, 0x0, 0xe4, 0xa7,
-    0x0, 0x0, 0x0, 0xe3, 0xa7, 0x0, 0x0, 0x19,
-    0xb0, 0xae, 0xee, 0xee, 0xfc, 0x10, 0xa7, 0x0,
-    0x0, 0x5, 0xd1, 0xa7, 0x0, 0x0, 0x0, 0x98,
-    0xa7, 0x0, 0x0, 0x0, 0x6b, 0xa7, 0x0, 0x0,
-    0x0, 0x99, 0xa7, 0x0, 0x0, 0x6, 0xf3, 0xaf,
-    0xff, 0xff, 0xeb, 0x30,
-
-    /* U+0433 "г" */
-    0xaf, 0xff, 0xff, 0xff, 0x3a, 0x70, 0x0, 0x0,
-    0x0, 0xa7, 0x0, 0x0, 0x0, 0xa, 0x70, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0xa, 0x70,
-    0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0xa,
-    0x70, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0x0, 0xa, 0x70, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xc, 0x40, 0x0, 0x0, 0xc5, 0x0, 0x0, 0xd,
-    0x20, 0x0, 0x0, 0xc5, 0x0, 0x0, 0xe, 0x20,
-    0x0, 0x0, 0xc5, 0x0, 0x0, 0xe, 0x10, 0x0,
-    0x0, 0xc5, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0xc5, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0xc5,
-    0x0, 0x0, 0x3d, 0x0, 0x0, 0x0, 0xc5, 0x0,
-    0x0, 0x6a, 0x0, 0x0, 0x0, 0xc5, 0x0, 0x0,
-    0xa6, 0x0, 0x0, 0x0, 0xc5, 0x0, 0x4, 0xd0,
-    0x0, 0x0, 0x0, 0xc5, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd2, 0xc4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd2, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd2,
-
-    /* U+0435 "е" */
-    0x0, 0x18, 0xdf, 0xeb, 0x40, 0x0, 0x2, 0xe9,
-    0x30, 0x15, 0xe8, 0x0, 0xd, 0x70, 0x0, 0x0,
-    0x1d, 0x50, 0x5c, 0x0, 0x0, 0x0, 0x4, 0xd0,
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0xf1, 0xce, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xe2, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x90,
-    0x0, 0x0, 0x6, 0x20, 0x1, 0xcb, 0x41, 0x3,
-    0xad, 0x20, 0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
-
-    /* U+0436 "ж" */
-    0xc, 0x60, 0x0, 0x0, 0xb6, 0x0, 0x0, 0xa,
-    0x90, 0x2, 0xe2, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0x5d, 0x0, 0x0, 0x5c, 0x0, 0x0, 0xb6, 0x0,
-    0x2, 0xe2, 0x0, 0x0, 0xa, 0x80, 0x0, 0xb6,
-    0x0, 0xc, 0x60, 0x0, 0x0, 0x0, 0xd4, 0x0,
-    0xb6, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xe5, 0x0, 0xb6, 0x0, 0x9b, 0x0, 0x0, 0x0,
-    0x9, 0xb0, 0x0, 0xb6, 0x0, 0xe, 0x50, 0x0,
-    0x0, 0x4f, 0x10, 0x0, 0xb6, 0x0, 0x4, 0xe1,
-    0x0, 0x0, 0xd6, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0xaa, 0x0, 0x8, 0xc0, 0x0, 0x0, 0xb6, 0x0,
-    0x0, 0x1e, 0x40, 0x3f, 0x20, 0x0, 0x0, 0xb6,
-    0x0, 0x0, 0x5, 0xe0,
-
-    /* U+0437 "з" */
-    0x1, 0x7c, 0xff, 0xe9, 0x20, 0x0, 0x98, 0x31,
-    0x2, 0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0,
-    0x0, 0x5, 0xd2, 0x0, 0x0, 0x8d, 0xdf, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x10, 0x20, 0x0, 0x0, 0x6, 0xd0, 0x2e,
-    0x93, 0x0, 0x17, 0xf4, 0x0, 0x17, 0xcf, 0xfe,
-    0x92, 0x0,
-
-    /* U+0438 "и" */
-    0xa7, 0x0, 0x0, 0x0, 0xb, 0xaa, 0x70, 0x0,
-    0x0, 0x8, 0xfa, 0xa7, 0x0, 0x0, 0x5, 0xd8,
-    0xaa, 0x70, 0x0, 0x2, 0xe2, 0x7a, 0xa7, 0x0,
-    0x1, 0xd5, 0x7, 0xaa, 0x70, 0x0, 0xb8, 0x0,
-    0x7a, 0xa7, 0x0, 0x8b, 0x0, 0x7, 0xaa, 0x70,
-    0x5d, 0x10, 0x0, 0x7a, 0xa7, 0x2e, 0x20, 0x0,
-    0x7, 0xaa, 0x8d, 0x50, 0x0, 0x0, 0x7a, 0xaf,
-    0x80, 0x0, 0x0, 0x7, 0xaa, 0xb0, 0x0, 0x0,
-    0x0, 0x7a,
-
-    /* U+0439 "й" */
-    0x0, 0x51, 0x0, 0x2, 0x40, 0x0, 0x6, 0xa0,
-    0x1, 0xb4, 0x0, 0x0, 0x6, 0xbc, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0,
-    0xba, 0xa7, 0x0, 0x0, 0x0, 0x8f, 0xaa, 0x70,
-    0x0, 0x0, 0x5d, 0x8a, 0xa7, 0x0, 0x0, 0x2e,
-    0x27, 0xaa, 0x70, 0x0, 0x1d, 0x50, 0x7a, 0xa7,
-    0x0, 0xb, 0x80, 0x7, 0xaa, 0x70, 0x8, 0xb0,
-    0x0, 0x7a, 0xa7, 0x5, 0xd1, 0x0, 0x7, 0xaa,
-    0x72, 0xe2, 0x0, 0x0, 0x7a, 0xa8, 0xd5, 0x0,
-    0x0, 0x7, 0xaa, 0xf8, 0x0, 0x0, 0x0, 0x7a,
-    0xab, 0x0, 0x0, 0x0, 0x7, 0xa0,
-
-    /* U+043A "к" */
-    0xa7, 0x0, 0x0, 0x0, 0xc6, 0xa, 0x70, 0x0,
-    0x0, 0xa8, 0x0, 0xa7, 0x0, 0x0, 0x8a, 0x0,
-    0xa, 0x70, 0x0, 0x6c, 0x0, 0x0, 0xa7, 0x0,
-    0x4d, 0x10, 0x0, 0xa, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xa7, 0x0, 0x5e, 0x10, 0x0, 0xa, 0x70,
-    0x0, 0x9b, 0x0, 0x0, 0xa7, 0x0, 0x0, 0xc8,
-    0x0, 0xa, 0x70, 0x0, 0x2, 0xe4, 0x0, 0xa7,
-    0x0, 0x0, 0x4, 0xe1, 0xa, 0x70, 0x0, 0x0,
-    0x8, 0xc0,
-
-    /* U+043B "л" */
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf5, 0x0, 0xc,
-    0x40, 0x0, 0x0, 0xc5, 0x0, 0xd, 0x30, 0x0,
-    0x0, 0xc5, 0x0, 0xd, 0x20, 0x0, 0x0, 0xc5,
-    0x0, 0xe, 0x10, 0x0, 0x0, 0xc5, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xc5, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x2d, 0x0, 0x0, 0x0, 0xc5,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0xc5, 0x0, 0x97,
-    0x0, 0x0, 0x0, 0xc5, 0x14, 0xf1, 0x0, 0x0,
-    0x0, 0xc5, 0xce, 0x60, 0x0, 0x0, 0x0, 0xc5,
-
-    /* U+043C "м" */
-    0xab, 0x0, 0x0, 0x0, 0x0, 0x6, 0xea, 0xf5,
-    0x0, 0x0, 0x0, 0x1, 0xee, 0xaa, 0xd0, 0x0,
-    0x0, 0x0, 0x99, 0xea, 0x6a, 0x70, 0x0, 0x0,
-    0x2d, 0x2e, 0xa6, 0x1e, 0x10, 0x0, 0xb, 0x52,
-    0xea, 0x60, 0x89, 0x0, 0x4, 0xb0, 0x2e, 0xa6,
-    0x0, 0xe3, 0x0, 0xd2, 0x2, 0xea, 0x60, 0x5,
-    0xb0, 0x79, 0x0, 0x2e, 0xa6, 0x0, 0xc, 0x6d,
-    0x10, 0x2, 0xea, 0x60, 0x0, 0x3f, 0x60, 0x0,
-    0x2e, 0xa6, 0x0, 0x0, 0x50, 0x0, 0x2, 0xea,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x2e,
-
-    /* U+043D "н" */
-    0xa7, 0x0, 0x0, 0x0, 0xb, 0x5a, 0x70, 0x0,
-    0x0, 0x0, 0xb5, 0xa7, 0x0, 0x0, 0x0, 0xb,
-    0x5a, 0x70, 0x0, 0x0, 0x0, 0xb5, 0xa7, 0x0,
-    0x0, 0x0, 0xb, 0x5a, 0x70, 0x0, 0x0, 0x0,
-    0xb5, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x70,
-    0x0, 0x0, 0x0, 0xb5, 0xa7, 0x0, 0x0, 0x0,
-    0xb, 0x5a, 0x70, 0x0, 0x0, 0x0, 0xb5, 0xa7,
-    0x0, 0x0, 0x0, 0xb, 0x5a, 0x70, 0x0, 0x0,
-    0x0, 0xb5,
-
-    /* U+043E "о" */
-    0x0, 0x7, 0xdf, 0xfc, 0x60, 0x0, 0x1, 0xdb,
-    0x41, 0x14, 0xcc, 0x10, 0xc, 0x90, 0x0, 0x0,
-    0xa, 0xa0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0xe3,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0x98, 0xc5, 0x0,
-    0x0, 0x0, 0x0, 0x7a, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x7a, 0xa8, 0x0, 0x0, 0x0, 0x0, 0x98,
-    0x4e, 0x0, 0x0, 0x0, 0x0, 0xe3, 0xc, 0x90,
-    0x0, 0x0, 0xa, 0xa0, 0x1, 0xdb, 0x41, 0x14,
-    0xcc, 0x10, 0x0, 0x7, 0xdf, 0xfc, 0x60, 0x0,
-
-    /* U+043F "п" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x70, 0x0,
-    0x0, 0x0, 0xb6, 0xa7, 0x0, 0x0, 0x0, 0xb,
-    0x6a, 0x70, 0x0, 0x0, 0x0, 0xb6, 0xa7, 0x0,
-    0x0, 0x0, 0xb, 0x6a, 0x70, 0x0, 0x0, 0x0,
-    0xb6, 0xa7, 0x0, 0x0, 0x0, 0xb, 0x6a, 0x70,
-    0x0, 0x0, 0x0, 0xb6, 0xa7, 0x0, 0x0, 0x0,
-    0xb, 0x6a, 0x70, 0x0, 0x0, 0x0, 0xb6, 0xa7,
-    0x0, 0x0, 0x0, 0xb, 0x6a, 0x70, 0x0, 0x0,
-    0x0, 0xb6,
-
-    /* U+0440 "р" */
-    0x97, 0x4, 0xbf, 0xfd, 0x81, 0x0, 0x97, 0x8c,
-    0x51, 0x3, 0xae, 0x20, 0x9c, 0xb0, 0x0, 0x0,
-    0x8, 0xd0, 0x9f, 0x10, 0x0, 0x0, 0x0, 0xd6,
-    0x9a, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x98, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0x98, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0x9a, 0x0, 0x0, 0x0, 0x0, 0x7a,
-    0x9f, 0x10, 0x0, 0x0, 0x0, 0xd6, 0x9d, 0xb0,
-    0x0, 0x0, 0x8, 0xd0, 0x98, 0x8c, 0x51, 0x3,
-    0xae, 0x20, 0x98, 0x4, 0xbf, 0xfd, 0x81, 0x0,
-    0x98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x98, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x7, 0xcf, 0xfd, 0x70, 0x0, 0x1d, 0xb4,
-    0x11, 0x4c, 0xc0, 0xc, 0x90, 0x0, 0x0, 0x8,
-    0x15, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x0, 0x0, 0x0, 0xa, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x81, 0x1,
-    0xdb, 0x41, 0x14, 0xbc, 0x0, 0x0, 0x7c, 0xff,
-    0xd7, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x8, 0x90, 0x0, 0x0, 0x0, 0x9, 0x70, 0x2f,
-    0x10, 0x0, 0x0, 0x1, 0xe1, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x89, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0xe, 0x20, 0x0, 0xc, 0x50, 0x0, 0x6, 0xb0,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0xd4, 0x0, 0x0,
-    0x0, 0xe3, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x7,
-    0xa0, 0xb, 0x50, 0x0, 0x0, 0x0, 0x1f, 0x12,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x98, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xee, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8a,
-    0x0, 0x0, 0x0, 0x29, 0x10, 0x5e, 0x20, 0x0,
-    0x0, 0x0, 0x9e, 0xfc, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xad,
-    0xff, 0xfd, 0x93, 0x0, 0x0, 0x1b, 0xd7, 0x32,
-    0xf1, 0x37, 0xea, 0x0, 0xc, 0xa0, 0x0, 0x1f,
-    0x0, 0x0, 0xba, 0x5, 0xd0, 0x0, 0x1, 0xf0,
-    0x0, 0x1, 0xe3, 0xa7, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0x9, 0x8c, 0x40, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x6a, 0xc4, 0x0, 0x0, 0x1f, 0x0, 0x0,
-    0x6, 0xaa, 0x70, 0x0, 0x1, 0xf0, 0x0, 0x0,
-    0x98, 0x5d, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x1e,
-    0x30, 0xca, 0x0, 0x1, 0xf0, 0x0, 0x1b, 0xa0,
-    0x1, 0xcd, 0x62, 0x2f, 0x13, 0x7e, 0xa0, 0x0,
-    0x0, 0x4a, 0xdf, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x1d, 0x50, 0x0, 0x0, 0x1e, 0x30, 0x3e, 0x10,
-    0x0, 0xc, 0x70, 0x0, 0x7c, 0x0, 0x8, 0xb0,
-    0x0, 0x0, 0xb8, 0x4, 0xe1, 0x0, 0x0, 0x1,
-    0xe5, 0xe3, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0xc0, 0x0, 0x0, 0x0,
-    0x4e, 0x1b, 0x80, 0x0, 0x0, 0x1e, 0x40, 0x1e,
-    0x40, 0x0, 0xb, 0x80, 0x0, 0x4e, 0x10, 0x7,
-    0xc0, 0x0, 0x0, 0x8b, 0x3, 0xe1, 0x0, 0x0,
-    0x0, 0xc8,
-
-    /* U+0446 "ц" */
-    0xa7, 0x0, 0x0, 0x0, 0xe, 0x30, 0xa, 0x70,
-    0x0, 0x0, 0x0, 0xe3, 0x0, 0xa7, 0x0, 0x0,
-    0x0, 0xe, 0x30, 0xa, 0x70, 0x0, 0x0, 0x0,
-    0xe3, 0x0, 0xa7, 0x0, 0x0, 0x0, 0xe, 0x30,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0xe3, 0x0, 0xa7,
-    0x0, 0x0, 0x0, 0xe, 0x30, 0xa, 0x70, 0x0,
-    0x0, 0x0, 0xe3, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xe, 0x30, 0xa, 0x70, 0x0, 0x0, 0x0, 0xe3,
-    0x0, 0xa7, 0x0, 0x0, 0x0, 0xe, 0x30, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x10,
-
-    /* U+0447 "ч" */
-    0xe3, 0x0, 0x0, 0x0, 0x7a, 0xe3, 0x0, 0x0,
-    0x0, 0x7a, 0xe3, 0x0, 0x0, 0x0, 0x7a, 0xe3,
-    0x0, 0x0, 0x0, 0x7a, 0xe3, 0x0, 0x0, 0x0,
-    0x7a, 0xb8, 0x0, 0x0, 0x0, 0x7a, 0x3f, 0x71,
-    0x0, 0x38, 0xea, 0x2, 0xae, 0xfe, 0xb6, 0x8a,
-    0x0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x0,
-    0x0, 0x7a, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x0,
-    0x0, 0x0, 0x0, 0x7a,
-
-    /* U+0448 "ш" */
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+0449 "щ" */
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0x0, 0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0,
-    0x4d, 0x0, 0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0,
-    0x0, 0x4d, 0x0, 0xa7, 0x0, 0x0, 0x7, 0xa0,
-    0x0, 0x0, 0x4d, 0x0, 0xa7, 0x0, 0x0, 0x7,
-    0xa0, 0x0, 0x0, 0x4d, 0x0, 0xa7, 0x0, 0x0,
-    0x7, 0xa0, 0x0, 0x0, 0x4d, 0x0, 0xa7, 0x0,
-    0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d, 0x0, 0xa7,
-    0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d, 0x0,
-    0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x4d,
-    0x0, 0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0,
-    0x4d, 0x0, 0xa7, 0x0, 0x0, 0x7, 0xa0, 0x0,
-    0x0, 0x4d, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xee,
-    0xee, 0xd7, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0,
-    0x2b, 0xc0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x5c, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0x5c, 0x0, 0x0, 0x2b, 0xb0, 0x0, 0x0, 0x5f,
-    0xee, 0xee, 0xd7, 0x0,
-
-    /* U+044B "ы" */
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x9, 0x8a, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x98, 0xa7, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0x8a, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0xae, 0xdd, 0xde, 0xb6, 0x0, 0x9,
-    0x8a, 0x70, 0x0, 0x3, 0xd8, 0x0, 0x98, 0xa7,
-    0x0, 0x0, 0x2, 0xf1, 0x9, 0x8a, 0x70, 0x0,
-    0x0, 0xd, 0x40, 0x98, 0xa7, 0x0, 0x0, 0x0,
-    0xd3, 0x9, 0x8a, 0x70, 0x0, 0x0, 0x2f, 0x10,
-    0x98, 0xa7, 0x0, 0x0, 0x4d, 0x70, 0x9, 0x8a,
-    0xfe, 0xee, 0xec, 0x50, 0x0, 0x98,
-
-    /* U+044C "ь" */
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0xdd, 0xde, 0xc6,
-    0x0, 0xa7, 0x0, 0x0, 0x3c, 0x90, 0xa7, 0x0,
-    0x0, 0x1, 0xf2, 0xa7, 0x0, 0x0, 0x0, 0xc5,
-    0xa7, 0x0, 0x0, 0x0, 0xd5, 0xa7, 0x0, 0x0,
-    0x1, 0xf1, 0xa7, 0x0, 0x0, 0x3d, 0x90, 0xaf,
-    0xee, 0xee, 0xc6, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x7c, 0xff, 0xe9, 0x20, 0x0, 0xd, 0x93,
-    0x0, 0x17, 0xe6, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x2e, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe2, 0x0, 0x2,
-    0xee, 0xee, 0xee, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x3, 0x0,
-    0x0, 0x0, 0x2e, 0x40, 0xd, 0xa3, 0x0, 0x17,
-    0xe6, 0x0, 0x0, 0x6c, 0xff, 0xe9, 0x20, 0x0,
-
-    /* U+044E "ю" */
-    0xa7, 0x0, 0x0, 0x6, 0xcf, 0xfc, 0x60, 0x0,
-    0xa7, 0x0, 0x0, 0xcc, 0x41, 0x14, 0xcb, 0x0,
-    0xa7, 0x0, 0xa, 0xa0, 0x0, 0x0, 0xb, 0x90,
-    0xa7, 0x0, 0x2f, 0x10, 0x0, 0x0, 0x1, 0xf2,
-    0xa7, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x0, 0xb6,
-    0xaf, 0xee, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x89,
-    0xa8, 0x11, 0xa8, 0x0, 0x0, 0x0, 0x0, 0x89,
-    0xa7, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x0, 0xb6,
-    0xa7, 0x0, 0x2f, 0x10, 0x0, 0x0, 0x1, 0xf2,
-    0xa7, 0x0, 0xa, 0xa0, 0x0, 0x0, 0xb, 0x90,
-    0xa7, 0x0, 0x0, 0xcc, 0x40, 0x4, 0xcc, 0x0,
-    0xa7, 0x0, 0x0, 0x6, 0xcf, 0xfc, 0x60, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x6c, 0xff, 0xff, 0xfd, 0xb, 0xc4, 0x0,
-    0x0, 0x2d, 0x4e, 0x0, 0x0, 0x0, 0x2d, 0x89,
-    0x0, 0x0, 0x0, 0x2d, 0x89, 0x0, 0x0, 0x0,
-    0x2d, 0x4d, 0x0, 0x0, 0x0, 0x2d, 0xb, 0xa2,
-    0x0, 0x0, 0x2d, 0x0, 0x6e, 0xed, 0xdd, 0xed,
-    0x0, 0x2e, 0x10, 0x0, 0x2d, 0x0, 0xd5, 0x0,
-    0x0, 0x2d, 0x8, 0xa0, 0x0, 0x0, 0x2d, 0x4e,
-    0x0, 0x0, 0x0, 0x2d,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x27, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xdf, 0xeb, 0x40, 0x0, 0x2, 0xe9, 0x30, 0x15,
-    0xe8, 0x0, 0xd, 0x70, 0x0, 0x0, 0x1d, 0x50,
-    0x5c, 0x0, 0x0, 0x0, 0x4, 0xd0, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0xce, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xe2, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x90, 0x0, 0x0,
-    0x6, 0x20, 0x1, 0xcb, 0x41, 0x3, 0xad, 0x20,
-    0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0xd, 0x70, 0x1e, 0x40, 0x0, 0x0, 0x7,
-    0x30, 0x8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xdf, 0xeb, 0x40, 0x0, 0x2, 0xe9,
-    0x30, 0x15, 0xe8, 0x0, 0xd, 0x70, 0x0, 0x0,
-    0x1d, 0x50, 0x5c, 0x0, 0x0, 0x0, 0x4, 0xd0,
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0xf1, 0xce, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xe2, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x90,
-    0x0, 0x0, 0x6, 0x20, 0x1, 0xcb, 0x41, 0x3,
-    0xad, 0x20, 0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x5, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xdf, 0xed,
-    0xdd, 0xdd, 0x10, 0x0, 0x0, 0xa, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x70, 0x6c, 0xff, 0xc6,
-    0x0, 0x0, 0xa, 0x7b, 0xa3, 0x1, 0x5e, 0x90,
-    0x0, 0xa, 0xe7, 0x0, 0x0, 0x2, 0xf3, 0x0,
-    0xa, 0xd0, 0x0, 0x0, 0x0, 0xa8, 0x0, 0xa,
-    0x90, 0x0, 0x0, 0x0, 0x7a, 0x0, 0xa, 0x70,
-    0x0, 0x0, 0x0, 0x6a, 0x0, 0xa, 0x70, 0x0,
-    0x0, 0x0, 0x6a, 0x0, 0xa, 0x70, 0x0, 0x0,
-    0x0, 0x6a, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0,
-    0x6a, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0, 0x6a,
-    0x0, 0xa, 0x70, 0x0, 0x0, 0x0, 0x6a, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0x6a, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6a, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x89, 0x0, 0x0, 0x0, 0x0,
-    0x32, 0x3, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xfe, 0x60,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x1, 0x73, 0x0, 0x0, 0x2, 0xd6,
-    0x0, 0x0, 0x5, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xf3, 0xa7, 0x0, 0x0, 0x0, 0xa,
-    0x70, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0x0, 0xa, 0x70, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x6, 0xcf, 0xfe, 0xa2, 0x0, 0x1c, 0xb4,
-    0x0, 0x16, 0xe5, 0xb, 0x90, 0x0, 0x0, 0x1,
-    0x24, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa6, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0xee, 0xee, 0xe9, 0x0, 0xa, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcb, 0x30, 0x1, 0x5d, 0x60, 0x0, 0x6c, 0xff,
-    0xea, 0x30,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x8d, 0xff, 0xd8, 0x10, 0xd, 0xa2, 0x0,
-    0x39, 0x90, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x0,
-    0x0, 0x6, 0xec, 0x95, 0x20, 0x0, 0x0, 0x4,
-    0x7b, 0xec, 0x30, 0x0, 0x0, 0x0, 0x7, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0x20, 0x0, 0x0,
-    0x0, 0xf2, 0x9d, 0x62, 0x0, 0x3b, 0xb0, 0x5,
-    0xbe, 0xff, 0xc7, 0x0,
-
-    /* U+0456 "і" */
-    0xa8, 0xca, 0x0, 0x0, 0x0, 0xa7, 0xa7, 0xa7,
-    0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
-    0xa7,
-
-    /* U+0457 "ї" */
-    0x2e, 0x26, 0xd0, 0x8, 0x12, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0xa7, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0xa7, 0x0, 0x0, 0xa7, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0xa7, 0x0, 0x0, 0xa7, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0xca, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x98, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x98, 0x0, 0x0, 0x98, 0x0, 0x0, 0x98, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x98, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x97, 0x0, 0x0,
-    0xb6, 0x51, 0x5, 0xf1, 0x8e, 0xfd, 0x40,
-
-    /* U+0459 "љ" */
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x0, 0xc7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x30, 0x0,
-    0x0, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x20, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x10, 0x0, 0x0, 0xce, 0xdd, 0xdd,
-    0xb5, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xc7,
-    0x0, 0x0, 0x3d, 0x80, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0xc7, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x2d,
-    0x0, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0, 0xe3,
-    0x0, 0x5a, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x97, 0x0, 0x0, 0x0, 0xc7,
-    0x0, 0x0, 0x4, 0xf0, 0x14, 0xf1, 0x0, 0x0,
-    0x0, 0xc8, 0x0, 0x2, 0x6e, 0x70, 0xce, 0x60,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xc5, 0x0,
-
-    /* U+045A "њ" */
-    0xa7, 0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0,
-    0x0, 0xa7, 0x0, 0x0, 0x0, 0xf, 0x20, 0x0,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0xf, 0x20,
-    0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0xf,
-    0x20, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xf, 0x20, 0x0, 0x0, 0x0, 0xaf, 0xee, 0xee,
-    0xee, 0xef, 0xee, 0xee, 0xda, 0x40, 0xa8, 0x11,
-    0x11, 0x11, 0x1f, 0x31, 0x11, 0x27, 0xf5, 0xa7,
-    0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x6c,
-    0xa7, 0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0,
-    0x3e, 0xa7, 0x0, 0x0, 0x0, 0xf, 0x20, 0x0,
-    0x0, 0x6c, 0xa7, 0x0, 0x0, 0x0, 0xf, 0x20,
-    0x0, 0x4, 0xe4, 0xa7, 0x0, 0x0, 0x0, 0xf,
-    0xee, 0xee, 0xeb, 0x30,
-
-    /* U+045B "ћ" */
-    0x0, 0xa, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0x0, 0x0, 0x0, 0x0, 0x8c, 0xcf,
-    0xec, 0xcc, 0xcc, 0x20, 0x0, 0x0, 0xa, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x70, 0x6c, 0xff,
-    0xc6, 0x0, 0x0, 0xa, 0x7b, 0xa3, 0x1, 0x5e,
-    0x80, 0x0, 0xa, 0xe7, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0xa8, 0x0,
-    0xa, 0x90, 0x0, 0x0, 0x0, 0x7a, 0x0, 0xa,
-    0x70, 0x0, 0x0, 0x0, 0x6a, 0x0, 0xa, 0x70,
-    0x0, 0x0, 0x0, 0x6a, 0x0, 0xa, 0x70, 0x0,
-    0x0, 0x0, 0x6a, 0x0, 0xa, 0x70, 0x0, 0x0,
-    0x0, 0x6a, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0,
-    0x6a, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0, 0x6a,
-    0x0, 0xa, 0x70, 0x0, 0x0, 0x0, 0x6a,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x1, 0x73, 0x0, 0x0, 0x0, 0x2,
-    0xd7, 0x0, 0x0, 0x0, 0x4, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x70, 0x0, 0x0, 0xc,
-    0x60, 0xa7, 0x0, 0x0, 0xa, 0x80, 0xa, 0x70,
-    0x0, 0x8, 0xa0, 0x0, 0xa7, 0x0, 0x6, 0xc0,
-    0x0, 0xa, 0x70, 0x4, 0xd1, 0x0, 0x0, 0xaf,
-    0xff, 0xf5, 0x0, 0x0, 0xa, 0x70, 0x5, 0xe1,
-    0x0, 0x0, 0xa7, 0x0, 0x9, 0xb0, 0x0, 0xa,
-    0x70, 0x0, 0xc, 0x80, 0x0, 0xa7, 0x0, 0x0,
-    0x2e, 0x40, 0xa, 0x70, 0x0, 0x0, 0x4e, 0x10,
-    0xa7, 0x0, 0x0, 0x0, 0x8c, 0x0,
-
-    /* U+045D "ѝ" */
-    0x0, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x4c, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0,
-    0xba, 0xa7, 0x0, 0x0, 0x0, 0x8f, 0xaa, 0x70,
-    0x0, 0x0, 0x5d, 0x8a, 0xa7, 0x0, 0x0, 0x2e,
-    0x27, 0xaa, 0x70, 0x0, 0x1d, 0x50, 0x7a, 0xa7,
-    0x0, 0xb, 0x80, 0x7, 0xaa, 0x70, 0x8, 0xb0,
-    0x0, 0x7a, 0xa7, 0x5, 0xd1, 0x0, 0x7, 0xaa,
-    0x72, 0xe2, 0x0, 0x0, 0x7a, 0xa8, 0xd5, 0x0,
-    0x0, 0x7, 0xaa, 0xf8, 0x0, 0x0, 0x0, 0x7a,
-    0xab, 0x0, 0x0, 0x0, 0x7, 0xa0,
-
-    /* U+045E "ў" */
-    0x0, 0x6, 0x70, 0x0, 0x1b, 0x0, 0x0, 0x0,
-    0x1d, 0x20, 0xa, 0x60, 0x0, 0x0, 0x0, 0x2a,
-    0xcb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x89, 0x0, 0x0, 0x0, 0x0, 0x97, 0x2,
-    0xf1, 0x0, 0x0, 0x0, 0x1e, 0x10, 0xa, 0x70,
-    0x0, 0x0, 0x8, 0x90, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0xe2, 0x0, 0x0, 0xc5, 0x0, 0x0, 0x6b,
-    0x0, 0x0, 0x5, 0xc0, 0x0, 0xd, 0x40, 0x0,
-    0x0, 0xe, 0x30, 0x4, 0xc0, 0x0, 0x0, 0x0,
-    0x7a, 0x0, 0xb5, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0x2e, 0x0, 0x0, 0x0, 0x0, 0x9, 0x89, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xa0, 0x0, 0x0, 0x2, 0x91, 0x5, 0xe2, 0x0,
-    0x0, 0x0, 0x9, 0xef, 0xc3, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+045F "џ" */
-    0xa7, 0x0, 0x0, 0x0, 0x89, 0xa7, 0x0, 0x0,
-    0x0, 0x89, 0xa7, 0x0, 0x0, 0x0, 0x89, 0xa7,
-    0x0, 0x0, 0x0, 0x89, 0xa7, 0x0, 0x0, 0x0,
-    0x89, 0xa7, 0x0, 0x0, 0x0, 0x89, 0xa7, 0x0,
-    0x0, 0x0, 0x89, 0xa7, 0x0, 0x0, 0x0, 0x89,
-    0xa7, 0x0, 0x0, 0x0, 0x89, 0xa7, 0x0, 0x0,
-    0x0, 0x89, 0xa7, 0x0, 0x0, 0x0, 0x89, 0xaf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x88, 0x0,
-    0x0, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0x0,
-    0x88, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xc4, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xc4, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x43, 0xe1, 0x11, 0x11, 0x11,
-    0x10, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x34, 0x0, 0x0, 0x0, 0x79,
-    0x0, 0x0, 0x0, 0x79, 0xaf, 0xff, 0xff, 0xf9,
-    0xa7, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd0,
-
-    /* U+2014 "—" */
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd,
-
-    /* U+2018 "‘" */
-    0xc, 0x1, 0xc0, 0x68, 0xa, 0xd0, 0x8e, 0x0,
-
-    /* U+2019 "’" */
-    0x8e, 0x7, 0xf0, 0x2c, 0x6, 0x70, 0x92, 0x0,
-
-    /* U+201A "‚" */
-    0x7c, 0x8, 0xf1, 0x2c, 0x5, 0x80, 0x93, 0x0,
-
-    /* U+201C "“" */
-    0xc, 0x0, 0x75, 0x1c, 0x0, 0xb2, 0x68, 0x0,
-    0xd0, 0xad, 0x4, 0xf4, 0x8e, 0x3, 0xf4,
-
-    /* U+201D "”" */
-    0x8e, 0x3, 0xf5, 0x7f, 0x2, 0xf6, 0x2c, 0x0,
-    0xc2, 0x67, 0x0, 0xd0, 0x92, 0x3, 0x80,
-
-    /* U+2026 "…" */
-    0x7d, 0x0, 0x1d, 0x60, 0x7, 0xd0, 0x8e, 0x0,
-    0x1e, 0x70, 0x8, 0xe0,
-
-    /* U+20B4 "₴" */
-    0x0, 0x4, 0xae, 0xff, 0xd9, 0x10, 0x0, 0x0,
-    0x8d, 0x62, 0x1, 0x39, 0xe3, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x5e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x10, 0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0xed,
-    0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xc9, 0x2, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0,
-    0x5, 0x70, 0x0, 0x5f, 0x82, 0x0, 0x26, 0xcd,
-    0x20, 0x0, 0x2, 0x9d, 0xff, 0xea, 0x50, 0x0,
-
-    /* U+2116 "№" */
-    0x15, 0x0, 0x0, 0x0, 0x0, 0x0, 0x61, 0x0,
-    0x1, 0x67, 0x50, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xe3, 0x0, 0x4c, 0x64, 0x6c, 0x20,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x0,
-    0xd1, 0x0, 0x2, 0xc0, 0x3e, 0x6e, 0x10, 0x0,
-    0x0, 0x0, 0xe3, 0x3, 0xa0, 0x0, 0x0, 0xc0,
-    0x3e, 0xa, 0xc0, 0x0, 0x0, 0x0, 0xe3, 0x3,
-    0xa0, 0x0, 0x0, 0xc0, 0x3e, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0xe3, 0x0, 0xd1, 0x0, 0x3, 0xb0,
-    0x3e, 0x0, 0x2e, 0x50, 0x0, 0x0, 0xe3, 0x0,
-    0x3c, 0x64, 0x7c, 0x20, 0x3e, 0x0, 0x4, 0xf2,
-    0x0, 0x0, 0xe3, 0x0, 0x0, 0x57, 0x50, 0x0,
-    0x3e, 0x0, 0x0, 0x8d, 0x0, 0x0, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0xb,
-    0xa0, 0x0, 0xe3, 0x0, 0x68, 0x88, 0x88, 0x50,
-    0x3e, 0x0, 0x0, 0x1, 0xe6, 0x0, 0xe3, 0x0,
-    0x34, 0x44, 0x44, 0x30, 0x3e, 0x0, 0x0, 0x0,
-    0x3f, 0x30, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x6, 0xe1, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0xab, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 90, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 89, .box_w = 3, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24, .adv_w = 126, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 42, .adv_w = 243, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 162, .adv_w = 214, .box_w = 12, .box_h = 22, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 294, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 430, .adv_w = 231, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 549, .adv_w = 68, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 555, .adv_w = 113, .box_w = 5, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 608, .adv_w = 113, .box_w = 4, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 650, .adv_w = 132, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 686, .adv_w = 200, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 736, .adv_w = 70, .box_w = 3, .box_h = 5, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 744, .adv_w = 134, .box_w = 7, .box_h = 2, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 751, .adv_w = 70, .box_w = 3, .box_h = 2, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 754, .adv_w = 113, .box_w = 9, .box_h = 22, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 853, .adv_w = 232, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 957, .adv_w = 124, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1005, .adv_w = 198, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1101, .adv_w = 196, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1197, .adv_w = 230, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1317, .adv_w = 196, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1413, .adv_w = 212, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1509, .adv_w = 205, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1605, .adv_w = 222, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1701, .adv_w = 212, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1805, .adv_w = 70, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1823, .adv_w = 70, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1846, .adv_w = 200, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1896, .adv_w = 200, .box_w = 10, .box_h = 6, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 1926, .adv_w = 200, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1976, .adv_w = 198, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2064, .adv_w = 364, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2274, .adv_w = 248, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2402, .adv_w = 265, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2514, .adv_w = 249, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2626, .adv_w = 291, .box_w = 15, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2746, .adv_w = 235, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2842, .adv_w = 222, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2930, .adv_w = 272, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3042, .adv_w = 287, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3154, .adv_w = 104, .box_w = 2, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3170, .adv_w = 173, .box_w = 10, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 3250, .adv_w = 247, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3362, .adv_w = 206, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3450, .adv_w = 337, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3586, .adv_w = 287, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3698, .adv_w = 295, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3834, .adv_w = 252, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3938, .adv_w = 295, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 4100, .adv_w = 253, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4204, .adv_w = 214, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4300, .adv_w = 198, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4404, .adv_w = 279, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4508, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4628, .adv_w = 386, .box_w = 24, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4820, .adv_w = 226, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4932, .adv_w = 220, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5044, .adv_w = 227, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5148, .adv_w = 108, .box_w = 5, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 5201, .adv_w = 113, .box_w = 9, .box_h = 22, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 5300, .adv_w = 108, .box_w = 5, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5353, .adv_w = 201, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 5403, .adv_w = 176, .box_w = 11, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5409, .adv_w = 211, .box_w = 5, .box_h = 3, .ofs_x = 3, .ofs_y = 14},
-    {.bitmap_index = 5417, .adv_w = 205, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5477, .adv_w = 238, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5579, .adv_w = 195, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5645, .adv_w = 238, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5747, .adv_w = 210, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5819, .adv_w = 115, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5896, .adv_w = 240, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5992, .adv_w = 237, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6086, .adv_w = 92, .box_w = 3, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6112, .adv_w = 94, .box_w = 6, .box_h = 21, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 6175, .adv_w = 205, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6269, .adv_w = 92, .box_w = 2, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6286, .adv_w = 375, .box_w = 20, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6406, .adv_w = 237, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6472, .adv_w = 218, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6544, .adv_w = 238, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 6640, .adv_w = 238, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 6736, .adv_w = 139, .box_w = 6, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6772, .adv_w = 168, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6832, .adv_w = 140, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6900, .adv_w = 235, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6966, .adv_w = 186, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7038, .adv_w = 303, .box_w = 19, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7152, .adv_w = 183, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7218, .adv_w = 186, .box_w = 13, .box_h = 16, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 7322, .adv_w = 177, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7388, .adv_w = 113, .box_w = 6, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 7451, .adv_w = 102, .box_w = 2, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 7472, .adv_w = 113, .box_w = 6, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 7535, .adv_w = 200, .box_w = 11, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 7552, .adv_w = 160, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 7593, .adv_w = 160, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 7634, .adv_w = 230, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7754, .adv_w = 230, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7874, .adv_w = 288, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8019, .adv_w = 200, .box_w = 11, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8129, .adv_w = 249, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8241, .adv_w = 218, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8337, .adv_w = 107, .box_w = 2, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8353, .adv_w = 104, .box_w = 6, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8413, .adv_w = 182, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8485, .adv_w = 417, .box_w = 26, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8693, .adv_w = 418, .box_w = 24, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8885, .adv_w = 291, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9021, .adv_w = 245, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9151, .adv_w = 290, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9291, .adv_w = 236, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9441, .adv_w = 283, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 9571, .adv_w = 258, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9699, .adv_w = 254, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9803, .adv_w = 264, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9907, .adv_w = 200, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9995, .adv_w = 277, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 10165, .adv_w = 230, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10261, .adv_w = 351, .box_w = 22, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10437, .adv_w = 215, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10541, .adv_w = 290, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10653, .adv_w = 290, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10793, .adv_w = 245, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10897, .adv_w = 275, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11017, .adv_w = 339, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11153, .adv_w = 289, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11265, .adv_w = 300, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11401, .adv_w = 291, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11513, .adv_w = 249, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11617, .adv_w = 251, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11729, .adv_w = 202, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11833, .adv_w = 236, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11953, .adv_w = 320, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 12115, .adv_w = 224, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12227, .adv_w = 290, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 12387, .adv_w = 251, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12483, .adv_w = 385, .box_w = 20, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12643, .adv_w = 392, .box_w = 22, .box_h = 20, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 12863, .adv_w = 287, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12999, .adv_w = 340, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13135, .adv_w = 249, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13239, .adv_w = 248, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13359, .adv_w = 383, .box_w = 21, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13527, .adv_w = 258, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13631, .adv_w = 203, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13691, .adv_w = 231, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13808, .adv_w = 212, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13868, .adv_w = 163, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13922, .adv_w = 225, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 14027, .adv_w = 214, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14099, .adv_w = 284, .box_w = 18, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14207, .adv_w = 185, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14273, .adv_w = 240, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14339, .adv_w = 240, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14433, .adv_w = 200, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14499, .adv_w = 220, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14571, .adv_w = 276, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14649, .adv_w = 236, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14715, .adv_w = 222, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14787, .adv_w = 237, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14853, .adv_w = 241, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 14949, .adv_w = 196, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15015, .adv_w = 161, .box_w = 12, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 15087, .adv_w = 192, .box_w = 13, .box_h = 16, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 15191, .adv_w = 270, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 15356, .adv_w = 181, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15422, .adv_w = 239, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 15520, .adv_w = 208, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15580, .adv_w = 323, .box_w = 16, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15676, .adv_w = 323, .box_w = 18, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 15811, .adv_w = 213, .box_w = 14, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 15895, .adv_w = 270, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15973, .adv_w = 195, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16033, .adv_w = 200, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16105, .adv_w = 301, .box_w = 16, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16201, .adv_w = 212, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16261, .adv_w = 218, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16363, .adv_w = 214, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16459, .adv_w = 235, .box_w = 14, .box_h = 22, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 16613, .adv_w = 163, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16690, .adv_w = 200, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16756, .adv_w = 183, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16816, .adv_w = 93, .box_w = 2, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16833, .adv_w = 92, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16881, .adv_w = 94, .box_w = 6, .box_h = 21, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 16944, .adv_w = 321, .box_w = 20, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17064, .adv_w = 330, .box_w = 18, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17172, .adv_w = 235, .box_w = 14, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 17291, .adv_w = 200, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17385, .adv_w = 240, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17479, .adv_w = 192, .box_w = 13, .box_h = 21, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 17616, .adv_w = 223, .box_w = 10, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 17691, .adv_w = 201, .box_w = 11, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17801, .adv_w = 153, .box_w = 8, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17861, .adv_w = 176, .box_w = 11, .box_h = 1, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 17867, .adv_w = 352, .box_w = 22, .box_h = 1, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 17878, .adv_w = 70, .box_w = 3, .box_h = 5, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 17886, .adv_w = 70, .box_w = 3, .box_h = 5, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 17894, .adv_w = 70, .box_w = 3, .box_h = 5, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 17902, .adv_w = 124, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 17917, .adv_w = 124, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 17932, .adv_w = 214, .box_w = 12, .box_h = 2, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17944, .adv_w = 291, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18056, .adv_w = 421, .box_w = 24, .box_h = 16, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_22;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_22 = {
-#else
-lv_font_t montserrat_cyrillic_22 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 24,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_22,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_22*/
@@ -1,3485 +0,0 @@
-/*******************************************************************************
- * Size: 24 px
- * Bpp: 4
- * Opts: --bpp 4 --size 24 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_24.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_24
-#define MONTSERRAT_CYRILLIC_24 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_24
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xab, 0xa, 0xb0, 0x9a, 0x9, 0xa0, 0x9a, 0x9,
-    0x90, 0x89, 0x8, 0x90, 0x88, 0x7, 0x80, 0x78,
-    0x7, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xd0,
-    0xbc, 0x0,
-
-    /* U+0022 "\"" */
-    0x3d, 0x0, 0x5c, 0x3d, 0x0, 0x5b, 0x2d, 0x0,
-    0x4b, 0x2d, 0x0, 0x4b, 0x2c, 0x0, 0x4b, 0x2c,
-    0x0, 0x4a, 0x4, 0x0, 0x14,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x5, 0xa0, 0x0, 0x1, 0xd0, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x3, 0xb0, 0x0,
-    0x0, 0x0, 0x9, 0x60, 0x0, 0x5, 0x90, 0x0,
-    0x0, 0x0, 0xb, 0x40, 0x0, 0x7, 0x70, 0x0,
-    0x0, 0x0, 0xd, 0x20, 0x0, 0x9, 0x50, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1e, 0x0, 0x0, 0xd, 0x10, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0x5a, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x0, 0x96, 0x0, 0x0, 0x5a, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xd2, 0x0, 0x0, 0x96, 0x0, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0xd2, 0x0, 0x0,
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0x0, 0x4, 0xa0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xcf, 0xff, 0xc8, 0x20,
-    0x0, 0x2e, 0xc6, 0x4d, 0x25, 0xaf, 0x70, 0xd,
-    0xa0, 0x1, 0xd0, 0x0, 0x12, 0x3, 0xf1, 0x0,
-    0x1d, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x1, 0xd0,
-    0x0, 0x0, 0x3, 0xf1, 0x0, 0x1d, 0x0, 0x0,
-    0x0, 0xc, 0xc1, 0x1, 0xd0, 0x0, 0x0, 0x0,
-    0x1b, 0xf9, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x9d, 0xfc, 0x82, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0x5a, 0xfb, 0x10, 0x0, 0x0, 0x1, 0xd0, 0x1,
-    0xcc, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x1, 0xf4,
-    0x0, 0x0, 0x1, 0xd0, 0x0, 0xd, 0x60, 0x0,
-    0x0, 0x1d, 0x0, 0x0, 0xf4, 0x99, 0x10, 0x1,
-    0xd0, 0x0, 0x9d, 0x1, 0xbf, 0x95, 0x3d, 0x26,
-    0xce, 0x30, 0x0, 0x39, 0xdf, 0xfe, 0xc7, 0x10,
-    0x0, 0x0, 0x0, 0x1d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x3, 0xbb, 0xc8, 0x0, 0x0, 0x0, 0x5, 0xb0,
-    0x0, 0x2d, 0x20, 0x6, 0xa0, 0x0, 0x0, 0x1d,
-    0x10, 0x0, 0x95, 0x0, 0x0, 0xc2, 0x0, 0x0,
-    0xa6, 0x0, 0x0, 0xd1, 0x0, 0x0, 0x86, 0x0,
-    0x5, 0xb0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x77,
-    0x0, 0x1d, 0x10, 0x0, 0x0, 0xd1, 0x0, 0x0,
-    0x86, 0x0, 0xa5, 0x0, 0x0, 0x0, 0x96, 0x0,
-    0x0, 0xd2, 0x5, 0xa0, 0x0, 0x0, 0x0, 0x1d,
-    0x40, 0x9, 0x90, 0x1d, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xad, 0xc7, 0x0, 0xb5, 0x2, 0xad, 0xd7,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xa0, 0x1d, 0x40,
-    0x9, 0xa0, 0x0, 0x0, 0x0, 0x1d, 0x10, 0x87,
-    0x0, 0x0, 0xc2, 0x0, 0x0, 0x0, 0xb4, 0x0,
-    0xc2, 0x0, 0x0, 0x87, 0x0, 0x0, 0x6, 0x90,
-    0x0, 0xe0, 0x0, 0x0, 0x68, 0x0, 0x0, 0x2d,
-    0x0, 0x0, 0xd1, 0x0, 0x0, 0x77, 0x0, 0x0,
-    0xc4, 0x0, 0x0, 0x96, 0x0, 0x0, 0xb3, 0x0,
-    0x7, 0x90, 0x0, 0x0, 0x1d, 0x20, 0x6, 0xb0,
-    0x0, 0x2d, 0x0, 0x0, 0x0, 0x2, 0xbb, 0xc9,
-    0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x1, 0xae, 0xfe, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xe8, 0x10, 0x2b, 0xa0, 0x0, 0x0, 0x0,
-    0x7b, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x9,
-    0x80, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0, 0x7b,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0x2, 0xf3,
-    0x0, 0x4e, 0x30, 0x0, 0x0, 0x0, 0x7, 0xe2,
-    0x9d, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xab, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x50, 0xb, 0xb0,
-    0x0, 0x4, 0x10, 0x1e, 0x40, 0x0, 0xc, 0x90,
-    0x0, 0xd3, 0x8, 0xa0, 0x0, 0x0, 0x1d, 0x80,
-    0x2e, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x1e, 0x79,
-    0x90, 0xa, 0x80, 0x0, 0x0, 0x0, 0x2e, 0xf1,
-    0x0, 0x5f, 0x20, 0x0, 0x0, 0x3, 0xef, 0x50,
-    0x0, 0x8e, 0x72, 0x1, 0x49, 0xe5, 0x4f, 0x40,
-    0x0, 0x4a, 0xef, 0xfc, 0x81, 0x0, 0x5f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x50,
-
-    /* U+0027 "'" */
-    0x3d, 0x3d, 0x2d, 0x2d, 0x2c, 0x2c, 0x4,
-
-    /* U+0028 "(" */
-    0x0, 0xd, 0x40, 0x5, 0xc0, 0x0, 0xc6, 0x0,
-    0x2f, 0x0, 0x6, 0xb0, 0x0, 0xa7, 0x0, 0xe,
-    0x40, 0x0, 0xf2, 0x0, 0x2f, 0x0, 0x3, 0xe0,
-    0x0, 0x4e, 0x0, 0x4, 0xd0, 0x0, 0x4e, 0x0,
-    0x3, 0xe0, 0x0, 0x2f, 0x0, 0x0, 0xf2, 0x0,
-    0xe, 0x40, 0x0, 0xa7, 0x0, 0x6, 0xb0, 0x0,
-    0x1f, 0x0, 0x0, 0xc6, 0x0, 0x5, 0xc0, 0x0,
-    0xd, 0x40,
-
-    /* U+0029 ")" */
-    0x98, 0x0, 0x1, 0xf1, 0x0, 0xa, 0x70, 0x0,
-    0x5d, 0x0, 0x0, 0xf2, 0x0, 0xc, 0x60, 0x0,
-    0x99, 0x0, 0x6, 0xc0, 0x0, 0x4e, 0x0, 0x3,
-    0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f,
-    0x0, 0x3, 0xf0, 0x0, 0x4e, 0x0, 0x6, 0xc0,
-    0x0, 0x99, 0x0, 0xc, 0x60, 0x0, 0xf2, 0x0,
-    0x5d, 0x0, 0xa, 0x70, 0x1, 0xf1, 0x0, 0x98,
-    0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0xd, 0x0,
-    0x0, 0x3d, 0x50, 0xd0, 0x5d, 0x30, 0x2b, 0xbe,
-    0xbb, 0x20, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x6d,
-    0x7d, 0x7d, 0x60, 0x3a, 0x10, 0xd0, 0x1a, 0x30,
-    0x0, 0xd, 0x0, 0x0, 0x0, 0x0, 0x90, 0x0,
-    0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x4, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0xb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x60, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x2, 0x22, 0x2c, 0x72, 0x22, 0x10, 0x0,
-    0x0, 0xb6, 0x0, 0x0, 0x0, 0x0, 0xb, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x30, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x7, 0xf4, 0x6f, 0x50, 0xe1, 0x2c, 0x6,
-    0x80, 0x42, 0x0,
-
-    /* U+002D "-" */
-    0x8f, 0xff, 0xff, 0xa1, 0x22, 0x22, 0x21,
-
-    /* U+002E "." */
-    0x0, 0x7, 0xf4, 0x6f, 0x30,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x53, 0x0, 0x0, 0x0,
-    0x0, 0xe2, 0x0, 0x0, 0x0, 0x4, 0xc0, 0x0,
-    0x0, 0x0, 0xa, 0x70, 0x0, 0x0, 0x0, 0xf,
-    0x10, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0, 0x0,
-    0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0, 0xa,
-    0x60, 0x0, 0x0, 0x0, 0xf, 0x10, 0x0, 0x0,
-    0x0, 0x5c, 0x0, 0x0, 0x0, 0x0, 0xa6, 0x0,
-    0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0, 0x5,
-    0xc0, 0x0, 0x0, 0x0, 0xa, 0x60, 0x0, 0x0,
-    0x0, 0xf, 0x10, 0x0, 0x0, 0x0, 0x5b, 0x0,
-    0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x0, 0x0,
-    0xf1, 0x0, 0x0, 0x0, 0x5, 0xb0, 0x0, 0x0,
-    0x0, 0xb, 0x60, 0x0, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x1, 0x8d, 0xff, 0xc6, 0x0, 0x0, 0x0,
-    0x2e, 0xc5, 0x23, 0x6d, 0xc1, 0x0, 0x1, 0xe9,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x9, 0xc0, 0x0,
-    0x0, 0x0, 0x1e, 0x60, 0x1f, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xd0, 0x5e, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0x8b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe5, 0xa9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc7, 0xa9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x8b, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe5, 0x5e, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf2, 0x1f, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xd0, 0x9, 0xc0, 0x0, 0x0, 0x0,
-    0x1e, 0x60, 0x1, 0xe9, 0x0, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0x2e, 0xc5, 0x23, 0x6d, 0xc1, 0x0,
-    0x0, 0x1, 0x8d, 0xff, 0xc6, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xcf, 0xff, 0xf8, 0x12, 0x22, 0xb8, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0xb8, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0xb8, 0x0, 0x0, 0xb8,
-    0x0, 0x0, 0xb8, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0xb8, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0xb8, 0x0, 0x0, 0xb8,
-    0x0, 0x0, 0xb8,
-
-    /* U+0032 "2" */
-    0x0, 0x39, 0xdf, 0xfe, 0xb4, 0x0, 0x0, 0x8f,
-    0xa5, 0x32, 0x49, 0xf8, 0x0, 0x3d, 0x20, 0x0,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x52, 0x22, 0x22, 0x22, 0x21,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-
-    /* U+0033 "3" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x22,
-    0x22, 0x22, 0x22, 0x9e, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xda, 0x40, 0x0, 0x0, 0x0, 0x2, 0x24,
-    0x8e, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xe0, 0x7b, 0x10, 0x0, 0x0, 0x2,
-    0xe7, 0x1, 0xaf, 0xa5, 0x32, 0x48, 0xfa, 0x0,
-    0x0, 0x39, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xd7, 0x0,
-    0x0, 0x6d, 0x0, 0x0, 0x0, 0xba, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x0, 0x5e, 0x10, 0x0, 0x0, 0x6,
-    0xd0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x22, 0x22, 0x22, 0x22, 0x27, 0xd2,
-    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x8,
-    0xb2, 0x22, 0x22, 0x22, 0x10, 0x0, 0xa8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfe, 0xda, 0x50, 0x0, 0x0, 0x22, 0x22, 0x35,
-    0x8e, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf2, 0x2d, 0x30, 0x0, 0x0, 0x0,
-    0xbb, 0x0, 0x7f, 0xb6, 0x32, 0x36, 0xdd, 0x10,
-    0x0, 0x18, 0xce, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x5b, 0xef, 0xfd, 0x92, 0x0, 0x1,
-    0xce, 0x73, 0x12, 0x49, 0x40, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x90, 0x7,
-    0xce, 0xed, 0x81, 0x0, 0xa8, 0x2d, 0xa4, 0x22,
-    0x5b, 0xe3, 0xa, 0x9d, 0x40, 0x0, 0x0, 0x7,
-    0xe1, 0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0x66,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x1f, 0x40,
-    0x0, 0x0, 0x0, 0x9, 0x90, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0xd6, 0x2, 0xf4, 0x0, 0x0, 0x0,
-    0x8e, 0x10, 0x4, 0xf9, 0x41, 0x14, 0xbe, 0x30,
-    0x0, 0x1, 0x8d, 0xff, 0xd8, 0x10, 0x0,
-
-    /* U+0037 "7" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xf2,
-    0x22, 0x22, 0x22, 0x22, 0xc9, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x23, 0xf0, 0x0, 0x0, 0x0,
-    0x9, 0xb0, 0x16, 0x0, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x17, 0xcf, 0xff, 0xd8, 0x10, 0x0, 0x2e,
-    0xc5, 0x21, 0x25, 0xbf, 0x40, 0xd, 0xa0, 0x0,
-    0x0, 0x0, 0x7e, 0x1, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xf4, 0x2f, 0x10, 0x0, 0x0, 0x0, 0xe,
-    0x40, 0xd7, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x3,
-    0xe9, 0x30, 0x0, 0x28, 0xe5, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xf4, 0x0, 0x4, 0xe9, 0x30, 0x0,
-    0x28, 0xf7, 0x2, 0xf5, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0x9b, 0x0, 0x0, 0x0, 0x0, 0x8, 0xbc,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xe8, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x9b, 0x1f, 0x70, 0x0, 0x0, 0x0,
-    0x4f, 0x30, 0x4f, 0xb5, 0x21, 0x25, 0xaf, 0x60,
-    0x0, 0x18, 0xcf, 0xff, 0xd8, 0x20, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x5, 0xbe, 0xfe, 0xb5, 0x0, 0x0, 0x0,
-    0xbe, 0x62, 0x12, 0x6e, 0xa0, 0x0, 0x8, 0xd1,
-    0x0, 0x0, 0x1, 0xc9, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x0, 0x2f, 0x20, 0x2f, 0x10, 0x0, 0x0,
-    0x0, 0xd, 0x90, 0x2f, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0xa, 0xc0, 0x0, 0x0, 0x0, 0xb8, 0xf1,
-    0x1, 0xdc, 0x40, 0x0, 0x4c, 0x91, 0xf1, 0x0,
-    0x8, 0xef, 0xff, 0xc5, 0x2, 0xf1, 0x0, 0x0,
-    0x1, 0x20, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5,
-    0x0, 0x0, 0xa6, 0x32, 0x25, 0xbf, 0x50, 0x0,
-    0x0, 0x7c, 0xef, 0xfc, 0x81, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x6f, 0x37, 0xf4, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf4, 0x6f, 0x30,
-
-    /* U+003B ";" */
-    0x6f, 0x37, 0xf4, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf4, 0x6f, 0x50, 0xe1, 0x2c, 0x6, 0x80,
-    0x42, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
-    0x0, 0x18, 0xec, 0x0, 0x0, 0x3, 0xaf, 0xa3,
-    0x0, 0x0, 0x6d, 0xd7, 0x10, 0x0, 0x19, 0xeb,
-    0x40, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xae, 0x92, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0xec, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0xe8, 0x10, 0x0, 0x0, 0x0, 0x3, 0x9e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x3e, 0xee, 0xee, 0xee, 0xee, 0xd0, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xee, 0xee, 0xee, 0xee, 0xd0, 0x11,
-    0x11, 0x11, 0x11, 0x11,
-
-    /* U+003E ">" */
-    0x13, 0x0, 0x0, 0x0, 0x0, 0x2, 0xec, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xe8, 0x10, 0x0,
-    0x0, 0x0, 0x2, 0x9f, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdd, 0x60, 0x0, 0x0, 0x0, 0x2,
-    0xce, 0x0, 0x0, 0x0, 0x4b, 0xe8, 0x20, 0x0,
-    0x17, 0xec, 0x60, 0x0, 0x3, 0xaf, 0xa3, 0x0,
-    0x0, 0x4, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x3a, 0xdf, 0xfe, 0xa3, 0x0, 0xa, 0xf8,
-    0x42, 0x24, 0x9f, 0x70, 0x5c, 0x10, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x20,
-    0x0, 0x0, 0x0, 0x8, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x6, 0xad, 0xff, 0xed, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x94,
-    0x10, 0x0, 0x15, 0xae, 0x70, 0x0, 0x0, 0x0,
-    0x2, 0xd9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xc1, 0x0, 0x0, 0x1, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xd1, 0x0, 0x0, 0xc7,
-    0x0, 0x0, 0x6c, 0xfe, 0xd8, 0x0, 0xc5, 0x7,
-    0xa0, 0x0, 0x6b, 0x0, 0x0, 0xbc, 0x40, 0x1,
-    0x7d, 0x2c, 0x50, 0xc, 0x40, 0xd, 0x30, 0x0,
-    0xaa, 0x0, 0x0, 0x0, 0x3c, 0xc5, 0x0, 0x4b,
-    0x3, 0xd0, 0x0, 0x3e, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0x50, 0x0, 0xe1, 0x78, 0x0, 0x9, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xf5, 0x0, 0xa, 0x49,
-    0x60, 0x0, 0xc5, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x50, 0x0, 0x86, 0xa5, 0x0, 0xd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xc5, 0x0, 0x7, 0x7a, 0x50,
-    0x0, 0xc6, 0x0, 0x0, 0x0, 0x0, 0xd, 0x50,
-    0x0, 0x87, 0x96, 0x0, 0x9, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xf5, 0x0, 0x9, 0x57, 0x90, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0xc2, 0x3d, 0x0, 0x0, 0xac, 0x0, 0x0, 0x0,
-    0x4c, 0xc6, 0x0, 0x2d, 0x0, 0xd3, 0x0, 0x0,
-    0xbd, 0x51, 0x2, 0x8d, 0x28, 0xc1, 0x2c, 0x50,
-    0x6, 0xb0, 0x0, 0x0, 0x6c, 0xff, 0xd8, 0x10,
-    0xa, 0xfe, 0x60, 0x0, 0xc, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x91, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xe9, 0x51, 0x0, 0x3, 0x7d, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xfe,
-    0xc8, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x1f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x70, 0x9a, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x2, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x20, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0,
-    0x0, 0xc7, 0x0, 0x0, 0x0, 0x1, 0xf4, 0x0,
-    0x0, 0x5, 0xe0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0xe, 0x50,
-    0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xd8,
-    0x22, 0x22, 0x22, 0x22, 0x29, 0xc0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x30, 0xb,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaa, 0x3,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf2,
-    0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x90,
-
-    /* U+0042 "B" */
-    0x1f, 0xff, 0xff, 0xff, 0xfe, 0xa4, 0x0, 0x1,
-    0xf3, 0x11, 0x11, 0x11, 0x38, 0xf8, 0x0, 0x1f,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x1, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8b, 0x1, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x90, 0x1f, 0x20, 0x0,
-    0x0, 0x0, 0x2, 0xf3, 0x1, 0xf2, 0x0, 0x0,
-    0x0, 0x16, 0xe7, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x10, 0x1, 0xf4, 0x22, 0x22, 0x22,
-    0x25, 0xae, 0x40, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x21, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc7, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x91, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x31, 0xf3, 0x11, 0x11, 0x11, 0x24, 0x9f, 0x70,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xea, 0x50, 0x0,
-    0x0, 0x3, 0xde, 0x95, 0x32, 0x48, 0xed, 0x20,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x8, 0xb0,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x8, 0xb0,
-    0x0, 0x3, 0xde, 0x95, 0x32, 0x48, 0xed, 0x20,
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xea, 0x50, 0x0,
-
-    /* U+0044 "D" */
-    0x1f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
-    0x1, 0xf4, 0x22, 0x22, 0x23, 0x59, 0xfb, 0x20,
-    0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x1, 0xae,
-    0x30, 0x1, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0x10, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc9, 0x1, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x41, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc7, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x71, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc7, 0x1f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x41, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc9, 0x1, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x10, 0x1f,
-    0x20, 0x0, 0x0, 0x0, 0x1, 0xae, 0x30, 0x1,
-    0xf4, 0x22, 0x22, 0x23, 0x59, 0xfb, 0x20, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
-    0x0,
-
-    /* U+0045 "E" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xf4,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x1f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x1, 0xf4, 0x22, 0x22, 0x22, 0x22,
-    0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf4, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-
-    /* U+0046 "F" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xf4,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x1f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x1, 0xf4, 0x22, 0x22, 0x22, 0x22,
-    0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x3, 0xde, 0x95, 0x32, 0x47, 0xde, 0x40,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x6, 0xd0,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70,
-    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x7, 0xf1,
-    0x0, 0x3, 0xde, 0x95, 0x32, 0x47, 0xde, 0x50,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0048 "H" */
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0x91,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99, 0x1f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0x91, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x99, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0x91, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x99, 0x1f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x91, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x99, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x91, 0xf4, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0xa9, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0x91, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x99, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x91, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x99, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0x91, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0x90,
-
-    /* U+0049 "I" */
-    0x1f, 0x21, 0xf2, 0x1f, 0x21, 0xf2, 0x1f, 0x21,
-    0xf2, 0x1f, 0x21, 0xf2, 0x1f, 0x21, 0xf2, 0x1f,
-    0x21, 0xf2, 0x1f, 0x21, 0xf2, 0x1f, 0x21, 0xf2,
-    0x1f, 0x20,
-
-    /* U+004A "J" */
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x0, 0x2, 0x22,
-    0x22, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xd, 0x50,
-    0x0, 0x0, 0xd9, 0x4, 0xfa, 0x42, 0x4b, 0xe1,
-    0x0, 0x29, 0xef, 0xea, 0x20,
-
-    /* U+004B "K" */
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xca, 0x1,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xca, 0x0, 0x1f,
-    0x20, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x1, 0xf2,
-    0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0xac, 0x0, 0x0, 0x1, 0xf2, 0x0,
-    0x0, 0xad, 0x10, 0x0, 0x0, 0x1f, 0x20, 0x0,
-    0x9d, 0x10, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x9e,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x8e, 0xf6,
-    0x0, 0x0, 0x0, 0x1, 0xf2, 0x7e, 0x25, 0xf4,
-    0x0, 0x0, 0x0, 0x1f, 0x9e, 0x20, 0x7, 0xf2,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x9, 0xd1,
-    0x0, 0x0, 0x1f, 0x40, 0x0, 0x0, 0xb, 0xc0,
-    0x0, 0x1, 0xf2, 0x0, 0x0, 0x0, 0x1d, 0xa0,
-    0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x1e, 0x70,
-    0x1, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x30,
-
-    /* U+004C "L" */
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x42, 0x22, 0x22, 0x22, 0x21,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+004D "M" */
-    0x1f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x1f, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xef, 0x1, 0xf6, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xe6, 0xf0, 0x1f, 0x2b,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x99, 0x3f, 0x1,
-    0xf2, 0x2f, 0x20, 0x0, 0x0, 0x0, 0x2f, 0x13,
-    0xf0, 0x1f, 0x20, 0x9a, 0x0, 0x0, 0x0, 0xb,
-    0x70, 0x3f, 0x1, 0xf2, 0x1, 0xe4, 0x0, 0x0,
-    0x4, 0xe0, 0x3, 0xf0, 0x1f, 0x20, 0x6, 0xd0,
-    0x0, 0x0, 0xd5, 0x0, 0x3f, 0x1, 0xf2, 0x0,
-    0xd, 0x60, 0x0, 0x7c, 0x0, 0x3, 0xf0, 0x1f,
-    0x20, 0x0, 0x4e, 0x0, 0x1e, 0x30, 0x0, 0x3f,
-    0x1, 0xf2, 0x0, 0x0, 0xb8, 0x9, 0x90, 0x0,
-    0x3, 0xf0, 0x1f, 0x20, 0x0, 0x2, 0xf5, 0xf1,
-    0x0, 0x0, 0x3f, 0x1, 0xf2, 0x0, 0x0, 0x9,
-    0xf7, 0x0, 0x0, 0x3, 0xf0, 0x1f, 0x20, 0x0,
-    0x0, 0x1a, 0x0, 0x0, 0x0, 0x3f, 0x1, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x0,
-
-    /* U+004E "N" */
-    0x1f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0x91,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x99, 0x1f,
-    0xcd, 0x0, 0x0, 0x0, 0x0, 0x9, 0x91, 0xf3,
-    0xda, 0x0, 0x0, 0x0, 0x0, 0x99, 0x1f, 0x22,
-    0xf7, 0x0, 0x0, 0x0, 0x9, 0x91, 0xf2, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x99, 0x1f, 0x20, 0x8,
-    0xe1, 0x0, 0x0, 0x9, 0x91, 0xf2, 0x0, 0xc,
-    0xc0, 0x0, 0x0, 0x99, 0x1f, 0x20, 0x0, 0x1e,
-    0x80, 0x0, 0x9, 0x91, 0xf2, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x99, 0x1f, 0x20, 0x0, 0x0, 0x7f,
-    0x20, 0x9, 0x91, 0xf2, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x99, 0x1f, 0x20, 0x0, 0x0, 0x0, 0xda,
-    0x9, 0x91, 0xf2, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x99, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x91, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0x90,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x50, 0x0,
-    0x0, 0x0, 0x3, 0xde, 0x95, 0x32, 0x48, 0xed,
-    0x40, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x30, 0xb, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xd0, 0x2f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x99,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8b, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x2f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf4, 0xb, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xd0, 0x2, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0,
-    0x3, 0xde, 0x94, 0x22, 0x48, 0xed, 0x40, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x50, 0x0,
-    0x0,
-
-    /* U+0050 "P" */
-    0x1f, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0, 0x1f,
-    0x42, 0x22, 0x22, 0x47, 0xec, 0x10, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0xb, 0xd0, 0x1f, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0xf5, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xa9, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8b, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9a, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe6,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xe0, 0x1f,
-    0x20, 0x0, 0x0, 0x15, 0xce, 0x30, 0x1f, 0xff,
-    0xff, 0xff, 0xfd, 0x81, 0x0, 0x1f, 0x42, 0x22,
-    0x22, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xe9, 0x53, 0x24, 0x8e,
-    0xd4, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x2f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf3, 0x0, 0xb, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xd0, 0x2,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x40, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x9, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xb0, 0xa8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x9, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x7d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x40, 0xb, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x2f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf3, 0x0, 0x0, 0x4f, 0x90,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0,
-    0x3d, 0xe9, 0x42, 0x24, 0x8e, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfb, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x81, 0x0, 0x6e, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2a, 0xff, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x1f, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0, 0x1f,
-    0x42, 0x22, 0x22, 0x47, 0xec, 0x10, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0xb, 0xd0, 0x1f, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0xf5, 0x1f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8b, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9a, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe6,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xd0, 0x1f,
-    0x20, 0x0, 0x0, 0x15, 0xce, 0x20, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x1f, 0x42, 0x22,
-    0x21, 0x3f, 0x40, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x7, 0xe0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0xc9, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x2f,
-    0x40, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x6, 0xe1,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xba,
-
-    /* U+0053 "S" */
-    0x0, 0x7, 0xce, 0xff, 0xc8, 0x20, 0x0, 0x2e,
-    0xc6, 0x31, 0x25, 0xaf, 0x70, 0xd, 0xa0, 0x0,
-    0x0, 0x0, 0x12, 0x3, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xf9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9d, 0xfc,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x1, 0x5a, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x99, 0x10, 0x0, 0x0, 0x0,
-    0x9d, 0x1, 0xbf, 0x95, 0x21, 0x26, 0xce, 0x30,
-    0x0, 0x39, 0xdf, 0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x22,
-    0x22, 0x22, 0xe7, 0x22, 0x22, 0x20, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x43,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x3f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x43, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x3f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x43, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x43, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x43, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x31, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x80, 0x1, 0xea, 0x0, 0x0, 0x0, 0x9, 0xe1,
-    0x0, 0x2, 0xdd, 0x73, 0x23, 0x6d, 0xe2, 0x0,
-    0x0, 0x0, 0x7c, 0xff, 0xfc, 0x70, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0xab, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x23, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xb0, 0xc, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf3, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x50, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0,
-    0x5, 0xe0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0,
-    0x0, 0xc7, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0x2, 0xf3, 0x0,
-    0x0, 0xa, 0x90, 0x0, 0x0, 0x0, 0xa, 0xa0,
-    0x0, 0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc8, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf0, 0x7, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x60, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0x5e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0057 "W" */
-    0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf3, 0x8, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x5, 0xe0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x3,
-    0xe9, 0xa0, 0x0, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0xd6, 0x0, 0x0, 0x0, 0x9, 0x93, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0x30, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0xe, 0x40, 0xd5, 0x0, 0x0, 0x0, 0x5e,
-    0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x4e, 0x0,
-    0x8a, 0x0, 0x0, 0x0, 0xa8, 0x0, 0x0, 0xd,
-    0x60, 0x0, 0x0, 0x99, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0,
-    0xe3, 0x0, 0xd, 0x50, 0x0, 0x5, 0xe0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x4, 0xd0, 0x0, 0x8,
-    0xb0, 0x0, 0xa, 0x80, 0x0, 0x0, 0x0, 0xd6,
-    0x0, 0xa, 0x80, 0x0, 0x2, 0xf1, 0x0, 0xf,
-    0x30, 0x0, 0x0, 0x0, 0x8c, 0x0, 0xf, 0x30,
-    0x0, 0x0, 0xd6, 0x0, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x10, 0x5d, 0x0, 0x0, 0x0, 0x7b,
-    0x0, 0xa8, 0x0, 0x0, 0x0, 0x0, 0xd, 0x60,
-    0xa8, 0x0, 0x0, 0x0, 0x2f, 0x10, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xc0, 0xf2, 0x0, 0x0,
-    0x0, 0xc, 0x65, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0xd0, 0x0, 0x0, 0x0, 0x7, 0xbb,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x20,
-    0x1e, 0x70, 0x0, 0x0, 0x0, 0x1e, 0x50, 0x0,
-    0x4f, 0x30, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x8d, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x0, 0x0,
-    0xca, 0x0, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x1,
-    0xe6, 0x1, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf2, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x8e,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xa0, 0x5f,
-    0x20, 0x0, 0x0, 0x0, 0x7, 0xd1, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0xd9,
-    0x0, 0x0, 0x1, 0xd7, 0x0, 0x0, 0x2, 0xf5,
-    0x0, 0x0, 0xab, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x0, 0x6e, 0x10, 0x0, 0x0, 0x0, 0xa, 0xc0,
-    0x2f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xd, 0x80,
-
-    /* U+0059 "Y" */
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xe0, 0x5,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x2f,
-    0x30, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x0, 0x8c,
-    0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x0, 0xe6,
-    0x0, 0x5, 0xe0, 0x0, 0x0, 0x0, 0x5, 0xe1,
-    0x0, 0xe5, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x6f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x12,
-    0x22, 0x22, 0x22, 0x22, 0x2a, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xda, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x42, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-
-    /* U+005B "[" */
-    0x1f, 0xff, 0xc1, 0xf2, 0x10, 0x1f, 0x20, 0x1,
-    0xf2, 0x0, 0x1f, 0x20, 0x1, 0xf2, 0x0, 0x1f,
-    0x20, 0x1, 0xf2, 0x0, 0x1f, 0x20, 0x1, 0xf2,
-    0x0, 0x1f, 0x20, 0x1, 0xf2, 0x0, 0x1f, 0x20,
-    0x1, 0xf2, 0x0, 0x1f, 0x20, 0x1, 0xf2, 0x0,
-    0x1f, 0x20, 0x1, 0xf2, 0x0, 0x1f, 0x20, 0x1,
-    0xf2, 0x0, 0x1f, 0x20, 0x1, 0xf2, 0x10, 0x1f,
-    0xff, 0xc0,
-
-    /* U+005C "\\" */
-    0x53, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x50, 0x0, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xc5,
-    0x0, 0x0, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0xc, 0x50,
-    0x0, 0x0, 0x0, 0x6, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xc5, 0x0,
-    0x0, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x0, 0x0, 0x0, 0x0, 0xb, 0x50, 0x0,
-    0x0, 0x0, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0xb, 0x60, 0x0, 0x0,
-    0x0, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xf1,
-
-    /* U+005D "]" */
-    0x7f, 0xff, 0x60, 0x11, 0xc6, 0x0, 0xc, 0x60,
-    0x0, 0xc6, 0x0, 0xc, 0x60, 0x0, 0xc6, 0x0,
-    0xc, 0x60, 0x0, 0xc6, 0x0, 0xc, 0x60, 0x0,
-    0xc6, 0x0, 0xc, 0x60, 0x0, 0xc6, 0x0, 0xc,
-    0x60, 0x0, 0xc6, 0x0, 0xc, 0x60, 0x0, 0xc6,
-    0x0, 0xc, 0x60, 0x0, 0xc6, 0x0, 0xc, 0x60,
-    0x0, 0xc6, 0x0, 0xc, 0x60, 0x11, 0xc6, 0x7f,
-    0xff, 0x60,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0x4, 0xbe,
-    0x0, 0x0, 0x0, 0xb, 0x49, 0x60, 0x0, 0x0,
-    0x2d, 0x2, 0xd0, 0x0, 0x0, 0x87, 0x0, 0xc4,
-    0x0, 0x0, 0xe1, 0x0, 0x5a, 0x0, 0x6, 0xa0,
-    0x0, 0xe, 0x10, 0xc, 0x30, 0x0, 0x8, 0x80,
-    0x3c, 0x0, 0x0, 0x2, 0xe0, 0xa6, 0x0, 0x0,
-    0x0, 0xb5,
-
-    /* U+005F "_" */
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-
-    /* U+0060 "`" */
-    0x1c, 0xb0, 0x0, 0x0, 0x9c, 0x10, 0x0, 0x6,
-    0xd2,
-
-    /* U+0061 "a" */
-    0x0, 0x4a, 0xef, 0xfc, 0x60, 0x0, 0xbe, 0x73,
-    0x12, 0x7f, 0x90, 0x8, 0x0, 0x0, 0x0, 0x3f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x99, 0x1, 0x8d, 0xef, 0xff, 0xff, 0x90, 0xda,
-    0x20, 0x0, 0x0, 0x99, 0x6d, 0x0, 0x0, 0x0,
-    0x9, 0x99, 0xa0, 0x0, 0x0, 0x0, 0xb9, 0x6d,
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0xda, 0x20, 0x1,
-    0x7c, 0x99, 0x1, 0x8d, 0xfe, 0xd7, 0x9, 0x90,
-
-    /* U+0062 "b" */
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x1, 0x8d, 0xff, 0xc6,
-    0x0, 0x0, 0x7c, 0x2e, 0xa4, 0x22, 0x6d, 0xd1,
-    0x0, 0x7c, 0xd4, 0x0, 0x0, 0x0, 0xbc, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0xe, 0x60, 0x7f,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x7b, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x7f, 0x10, 0x0, 0x0, 0x0,
-    0x8, 0xc0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0xe,
-    0x60, 0x7c, 0xd4, 0x0, 0x0, 0x0, 0xbc, 0x0,
-    0x7b, 0x2e, 0xa4, 0x22, 0x6d, 0xd1, 0x0, 0x7b,
-    0x1, 0x8d, 0xff, 0xc6, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x4, 0xbe, 0xfe, 0xb4, 0x0, 0x0, 0xaf,
-    0x83, 0x13, 0x8f, 0x80, 0x9, 0xd1, 0x0, 0x0,
-    0x2, 0xc1, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xd1, 0x0, 0x0,
-    0x2, 0xc1, 0x0, 0xaf, 0x83, 0x13, 0x8f, 0x80,
-    0x0, 0x4, 0xbe, 0xfe, 0xb4, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xb0, 0x0, 0x5b, 0xef, 0xe9, 0x20, 0x8b, 0x0,
-    0xae, 0x73, 0x23, 0x8e, 0x58, 0xb0, 0x9d, 0x10,
-    0x0, 0x0, 0x2e, 0xab, 0x3f, 0x30, 0x0, 0x0,
-    0x0, 0x4f, 0xb9, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x9, 0xbd,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x8b, 0xc7, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xb8, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xdb, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x9d, 0x10, 0x0, 0x0, 0x2e, 0xab,
-    0x0, 0xae, 0x73, 0x23, 0x8e, 0x58, 0xb0, 0x0,
-    0x5b, 0xef, 0xe9, 0x20, 0x8b,
-
-    /* U+0065 "e" */
-    0x0, 0x5, 0xcf, 0xfd, 0x81, 0x0, 0x0, 0xb,
-    0xd6, 0x21, 0x4b, 0xe2, 0x0, 0xa, 0xc0, 0x0,
-    0x0, 0x8, 0xe0, 0x3, 0xf1, 0x0, 0x0, 0x0,
-    0xc, 0x80, 0x9a, 0x0, 0x0, 0x0, 0x0, 0x4d,
-    0xc, 0x60, 0x0, 0x0, 0x0, 0x1, 0xf1, 0xdf,
-    0xee, 0xee, 0xee, 0xee, 0xef, 0x2c, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xd2, 0x0, 0x0, 0x0, 0x81, 0x0,
-    0x9, 0xf8, 0x32, 0x26, 0xdc, 0x0, 0x0, 0x4,
-    0xae, 0xff, 0xb6, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x1, 0x9e, 0xfc, 0x40, 0x0, 0xbc, 0x31,
-    0x44, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf0, 0x1, 0x4f, 0x11, 0x11, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x4, 0xbe, 0xfe, 0xa3, 0x5, 0xd0, 0xa,
-    0xe6, 0x10, 0x16, 0xd6, 0x5d, 0x9, 0xc1, 0x0,
-    0x0, 0x0, 0xc9, 0xd3, 0xf2, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x8b, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xdc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xdc, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0x8c, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xd2, 0xf3, 0x0, 0x0, 0x0, 0x2,
-    0xfd, 0x9, 0xe2, 0x0, 0x0, 0x1, 0xda, 0xd0,
-    0xa, 0xf8, 0x31, 0x37, 0xe6, 0x6d, 0x0, 0x4,
-    0xbe, 0xfe, 0xa2, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x70, 0x73, 0x0, 0x0, 0x0, 0x6, 0xf1,
-    0x6, 0xfb, 0x63, 0x12, 0x4a, 0xf4, 0x0, 0x1,
-    0x7c, 0xef, 0xfd, 0x92, 0x0,
-
-    /* U+0068 "h" */
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x2,
-    0xae, 0xff, 0xb4, 0x0, 0x7c, 0x5e, 0x73, 0x13,
-    0x8f, 0x70, 0x7d, 0xd1, 0x0, 0x0, 0x5, 0xf2,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0xc8, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x8a, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x7b, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x7c,
-
-    /* U+0069 "i" */
-    0xae, 0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x7c, 0x7, 0xc0, 0x7c, 0x7, 0xc0, 0x7c,
-    0x7, 0xc0, 0x7c, 0x7, 0xc0, 0x7c, 0x7, 0xc0,
-    0x7c, 0x7, 0xc0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x8, 0xe1, 0x0, 0x0, 0x8, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x0, 0x8, 0xb0, 0x8, 0x31, 0x5f, 0x50,
-    0x8, 0xef, 0xd6, 0x0,
-
-    /* U+006B "k" */
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0xb, 0xb0, 0x7c, 0x0, 0x0, 0x0,
-    0xcb, 0x0, 0x7c, 0x0, 0x0, 0x1c, 0xb0, 0x0,
-    0x7c, 0x0, 0x1, 0xda, 0x0, 0x0, 0x7c, 0x0,
-    0x2d, 0xa0, 0x0, 0x0, 0x7c, 0x2, 0xef, 0x20,
-    0x0, 0x0, 0x7c, 0x2e, 0x8a, 0xd0, 0x0, 0x0,
-    0x7e, 0xe7, 0x0, 0xda, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x2f, 0x60, 0x0, 0x7c, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x7c, 0x0,
-    0x0, 0x0, 0x1, 0xe7,
-
-    /* U+006C "l" */
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-    0x7c, 0x7c,
-
-    /* U+006D "m" */
-    0x7b, 0x3, 0xae, 0xfe, 0xa2, 0x0, 0x6, 0xcf,
-    0xfd, 0x80, 0x0, 0x7b, 0x6d, 0x51, 0x2, 0x9f,
-    0x30, 0xcb, 0x40, 0x4, 0xcc, 0x0, 0x7d, 0xd1,
-    0x0, 0x0, 0x8, 0xd9, 0x90, 0x0, 0x0, 0xd,
-    0x80, 0x7f, 0x40, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xe0, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0xd9, 0x0, 0x0, 0x0, 0x2, 0xf1, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0x7c, 0x0, 0x0, 0x0, 0x0, 0xc7,
-    0x0, 0x0, 0x0, 0x1, 0xf2, 0x7c, 0x0, 0x0,
-    0x0, 0x0, 0xc7, 0x0, 0x0, 0x0, 0x1, 0xf2,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0,
-    0x0, 0x1, 0xf2, 0x7c, 0x0, 0x0, 0x0, 0x0,
-    0xc7, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0, 0x1,
-    0xf2, 0x7c, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0,
-    0x0, 0x0, 0x1, 0xf2, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0xc7, 0x0, 0x0, 0x0, 0x1, 0xf2,
-
-    /* U+006E "n" */
-    0x7b, 0x2, 0xae, 0xff, 0xb4, 0x0, 0x7b, 0x5d,
-    0x61, 0x1, 0x7f, 0x70, 0x7d, 0xd1, 0x0, 0x0,
-    0x4, 0xf2, 0x7f, 0x40, 0x0, 0x0, 0x0, 0xc8,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x8a, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x7b, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x7c,
-
-    /* U+006F "o" */
-    0x0, 0x4, 0xbe, 0xfe, 0xa3, 0x0, 0x0, 0xa,
-    0xe7, 0x32, 0x38, 0xf8, 0x0, 0x9, 0xd1, 0x0,
-    0x0, 0x2, 0xe7, 0x2, 0xf3, 0x0, 0x0, 0x0,
-    0x4, 0xf1, 0x8b, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x6c, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9a, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xbc, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x9a, 0x8b, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x62, 0xf3, 0x0, 0x0, 0x0, 0x4,
-    0xf1, 0x9, 0xd1, 0x0, 0x0, 0x2, 0xe7, 0x0,
-    0xa, 0xe7, 0x32, 0x38, 0xf8, 0x0, 0x0, 0x4,
-    0xbe, 0xfe, 0xa3, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x7b, 0x1, 0x8d, 0xff, 0xc6, 0x0, 0x0, 0x7b,
-    0x2e, 0xa4, 0x22, 0x6d, 0xd1, 0x0, 0x7c, 0xd4,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x7f, 0x80, 0x0,
-    0x0, 0x0, 0xe, 0x60, 0x7f, 0x10, 0x0, 0x0,
-    0x0, 0x7, 0xc0, 0x7c, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf0, 0x7b, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0,
-    0x7f, 0x10, 0x0, 0x0, 0x0, 0x8, 0xc0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0xe, 0x60, 0x7c, 0xd4,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x7c, 0x2e, 0xa4,
-    0x22, 0x6d, 0xd1, 0x0, 0x7c, 0x1, 0x8d, 0xff,
-    0xc6, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x5, 0xbe, 0xfe, 0x92, 0x8, 0xb0, 0xa,
-    0xe7, 0x32, 0x38, 0xe5, 0x8b, 0x9, 0xd1, 0x0,
-    0x0, 0x2, 0xea, 0xb3, 0xf3, 0x0, 0x0, 0x0,
-    0x4, 0xfb, 0x8b, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xbc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9b, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xbc, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x9b, 0x8b, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xb3, 0xf3, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x9, 0xd1, 0x0, 0x0, 0x2, 0xea, 0xb0,
-    0xa, 0xe7, 0x32, 0x38, 0xe5, 0x8b, 0x0, 0x5,
-    0xbe, 0xfe, 0x92, 0x8, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8b,
-
-    /* U+0072 "r" */
-    0x7b, 0x3, 0xbe, 0x77, 0xb6, 0xd6, 0x20, 0x7d,
-    0xd1, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x7, 0xc0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x7, 0xc0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x19, 0xef, 0xfd, 0x92, 0x0, 0x2e, 0x93,
-    0x12, 0x49, 0xe0, 0xa, 0xa0, 0x0, 0x0, 0x1,
-    0x0, 0xd6, 0x0, 0x0, 0x0, 0x0, 0xb, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb5, 0x10, 0x0,
-    0x0, 0x0, 0x28, 0xdf, 0xea, 0x50, 0x0, 0x0,
-    0x0, 0x3, 0x7e, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x5,
-    0x0, 0x0, 0x0, 0xc, 0x71, 0xed, 0x63, 0x11,
-    0x4b, 0xd1, 0x0, 0x6b, 0xef, 0xfd, 0x80, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xf0, 0x1, 0x4f, 0x11, 0x11, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x0,
-    0xb, 0xc3, 0x15, 0x50, 0x0, 0x1a, 0xff, 0xc4,
-
-    /* U+0075 "u" */
-    0x99, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x99, 0x0,
-    0x0, 0x0, 0x0, 0xb8, 0x99, 0x0, 0x0, 0x0,
-    0x0, 0xb8, 0x99, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0x99, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x99, 0x0,
-    0x0, 0x0, 0x0, 0xb8, 0x99, 0x0, 0x0, 0x0,
-    0x0, 0xb8, 0x99, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0x8a, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x5e, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xe, 0x70, 0x0, 0x0,
-    0x1d, 0xd8, 0x5, 0xfa, 0x41, 0x26, 0xe6, 0xa8,
-    0x0, 0x3a, 0xef, 0xeb, 0x30, 0xa8,
-
-    /* U+0076 "v" */
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0xd, 0x64, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xe0, 0xd, 0x60, 0x0,
-    0x0, 0x0, 0xb8, 0x0, 0x6d, 0x0, 0x0, 0x0,
-    0x2f, 0x10, 0x0, 0xe4, 0x0, 0x0, 0x9, 0xa0,
-    0x0, 0x8, 0xb0, 0x0, 0x0, 0xf3, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x7c, 0x0, 0x0, 0x0, 0xa8,
-    0x0, 0xd, 0x50, 0x0, 0x0, 0x3, 0xf0, 0x4,
-    0xe0, 0x0, 0x0, 0x0, 0xc, 0x60, 0xb7, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0x2f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xed, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x99, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x0, 0x0,
-    0x0, 0xd, 0x43, 0xe0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x3, 0xe0, 0xd, 0x40, 0x0,
-    0x0, 0x1f, 0x6c, 0x0, 0x0, 0x0, 0x98, 0x0,
-    0x7a, 0x0, 0x0, 0x7, 0xa0, 0xf2, 0x0, 0x0,
-    0xe, 0x20, 0x2, 0xf0, 0x0, 0x0, 0xd4, 0x9,
-    0x80, 0x0, 0x4, 0xd0, 0x0, 0xc, 0x50, 0x0,
-    0x3e, 0x0, 0x3e, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0x6b, 0x0, 0x9, 0x80, 0x0, 0xd4, 0x0, 0xf,
-    0x10, 0x0, 0x0, 0xf1, 0x0, 0xe2, 0x0, 0x7,
-    0xa0, 0x6, 0xb0, 0x0, 0x0, 0xa, 0x70, 0x4c,
-    0x0, 0x0, 0x2f, 0x0, 0xc5, 0x0, 0x0, 0x0,
-    0x4c, 0xa, 0x60, 0x0, 0x0, 0xc5, 0x1f, 0x0,
-    0x0, 0x0, 0x0, 0xe3, 0xf1, 0x0, 0x0, 0x6,
-    0xb7, 0x90, 0x0, 0x0, 0x0, 0x9, 0xda, 0x0,
-    0x0, 0x0, 0xf, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x40, 0x0, 0x0, 0x0, 0xae, 0x0, 0x0,
-    0x0,
-
-    /* U+0078 "x" */
-    0xc, 0x90, 0x0, 0x0, 0x2, 0xf3, 0x2, 0xe4,
-    0x0, 0x0, 0xd, 0x70, 0x0, 0x5e, 0x10, 0x0,
-    0x9b, 0x0, 0x0, 0x9, 0xc0, 0x5, 0xe1, 0x0,
-    0x0, 0x0, 0xc8, 0x2e, 0x30, 0x0, 0x0, 0x0,
-    0x2f, 0xe7, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xac, 0x0, 0x0,
-    0x0, 0x2, 0xf4, 0xc, 0x80, 0x0, 0x0, 0xd,
-    0x80, 0x2, 0xf4, 0x0, 0x0, 0x9c, 0x0, 0x0,
-    0x5e, 0x10, 0x5, 0xe1, 0x0, 0x0, 0x9, 0xc0,
-    0x2f, 0x40, 0x0, 0x0, 0x0, 0xd8,
-
-    /* U+0079 "y" */
-    0xb, 0x80, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x4,
-    0xf0, 0x0, 0x0, 0x0, 0x4, 0xe0, 0x0, 0xd6,
-    0x0, 0x0, 0x0, 0xb, 0x80, 0x0, 0x6d, 0x0,
-    0x0, 0x0, 0x2f, 0x10, 0x0, 0xe, 0x40, 0x0,
-    0x0, 0x8a, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0,
-    0xe3, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0x0, 0xa9, 0x0, 0xd, 0x50, 0x0,
-    0x0, 0x0, 0x3f, 0x10, 0x4e, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x70, 0xb7, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xe2, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x0, 0x0,
-    0x6a, 0x31, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x1a,
-    0xef, 0xc4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xdf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x11, 0x11,
-    0x11, 0x2e, 0x60, 0x0, 0x0, 0x0, 0xb, 0xa0,
-    0x0, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x0, 0x0,
-    0x3, 0xf2, 0x0, 0x0, 0x0, 0x1, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0xba, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x30, 0x0,
-    0x0, 0x0, 0x1e, 0x60, 0x0, 0x0, 0x0, 0xb,
-    0xa0, 0x0, 0x0, 0x0, 0x7, 0xe1, 0x11, 0x11,
-    0x11, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0x0,
-
-    /* U+007B "{" */
-    0x0, 0x7, 0xef, 0x20, 0x5, 0xf4, 0x10, 0x0,
-    0x8a, 0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x99,
-    0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x99, 0x0,
-    0x0, 0x9, 0x90, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x9, 0x90, 0x0, 0x0, 0xc8, 0x0, 0x7, 0xfe,
-    0x10, 0x0, 0x12, 0xd7, 0x0, 0x0, 0x9, 0x90,
-    0x0, 0x0, 0x99, 0x0, 0x0, 0x9, 0x90, 0x0,
-    0x0, 0x99, 0x0, 0x0, 0x9, 0x90, 0x0, 0x0,
-    0x99, 0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x9a,
-    0x0, 0x0, 0x5, 0xf4, 0x10, 0x0, 0x7, 0xef,
-    0x20,
-
-    /* U+007C "|" */
-    0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x1f, 0x11,
-    0xf1, 0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x1f,
-    0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1,
-    0x1f, 0x11, 0xf1, 0x1f, 0x11, 0xf1, 0x1f, 0x11,
-    0xf1, 0x1f, 0x10,
-
-    /* U+007D "}" */
-    0x7f, 0xd4, 0x0, 0x0, 0x18, 0xf0, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0xe4, 0x0, 0x0, 0xe,
-    0x40, 0x0, 0x0, 0xe4, 0x0, 0x0, 0xe, 0x40,
-    0x0, 0x0, 0xe4, 0x0, 0x0, 0xe, 0x40, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0xd, 0x70, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0xc, 0x92, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0xe, 0x40, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0xe, 0x40, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0xe, 0x40, 0x0, 0x0, 0xe4, 0x0, 0x0, 0xf,
-    0x40, 0x0, 0x18, 0xf1, 0x0, 0x7f, 0xd4, 0x0,
-    0x0,
-
-    /* U+007E "~" */
-    0x2, 0xcf, 0xb1, 0x0, 0x0, 0xc0, 0xd, 0x40,
-    0x6d, 0x10, 0x0, 0xd0, 0x3a, 0x0, 0x5, 0xd2,
-    0x9, 0x80, 0x67, 0x0, 0x0, 0x5d, 0xfa, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x1, 0x30, 0x1, 0x30, 0x0, 0xc6, 0x0,
-    0xc6, 0x0, 0x8a, 0x0, 0x8a, 0x0, 0x5d, 0x0,
-    0x5d, 0x0, 0x2e, 0x20, 0x2e, 0x20, 0x8, 0xb0,
-    0x8, 0xb0, 0x0, 0xd, 0x50, 0xd, 0x50, 0x0,
-    0x2e, 0x20, 0x2e, 0x20, 0x0, 0x5c, 0x0, 0x5c,
-    0x0, 0x0, 0x99, 0x0, 0x99,
-
-    /* U+00BB "»" */
-    0x3, 0x10, 0x3, 0x10, 0x0, 0x7, 0xb0, 0x7,
-    0xb0, 0x0, 0x0, 0xb7, 0x0, 0xb7, 0x0, 0x0,
-    0x1d, 0x30, 0x1d, 0x30, 0x0, 0x3, 0xe1, 0x3,
-    0xe1, 0x0, 0x0, 0xc7, 0x0, 0xb7, 0x0, 0x6,
-    0xc0, 0x6, 0xc0, 0x0, 0x2e, 0x10, 0x2e, 0x10,
-    0x0, 0xd4, 0x0, 0xd4, 0x0, 0xa, 0x80, 0xa,
-    0x80, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xf5, 0x22, 0x22, 0x22,
-    0x22, 0x20, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0xf5, 0x22, 0x22, 0x22,
-    0x22, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf5, 0x22, 0x22, 0x22, 0x22, 0x21, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0401 "Ё" */
-    0x0, 0x2f, 0x40, 0x1e, 0x60, 0x0, 0x0, 0x1b,
-    0x30, 0xb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf5, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xf5, 0x22,
-    0x22, 0x22, 0x22, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf5, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0402 "Ђ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x1, 0x22, 0x22, 0x2b, 0x92, 0x22, 0x22,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x1, 0x22,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x85, 0xae,
-    0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xc7, 0x30, 0x0, 0x29, 0xf5, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x0,
-    0x0, 0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x60, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0xb, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xe5, 0x0, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x10, 0x0,
-    0x0, 0xb, 0x80, 0x0, 0x21, 0x2, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0xb8, 0x0, 0xc, 0xff, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x10, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x28, 0x30, 0x0, 0x0, 0x0,
-    0x3e, 0x70, 0x0, 0x0, 0x0, 0x4e, 0x40, 0x0,
-    0x0, 0x0, 0x7, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xf5, 0x22, 0x22, 0x22, 0x22, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0x2d, 0xf9, 0x42, 0x34, 0x8e, 0xc2, 0x0,
-    0x3f, 0xa1, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x1e,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x6, 0xe2, 0x22, 0x22, 0x22,
-    0x21, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xa1, 0x0, 0x0, 0x0, 0x9,
-    0xb0, 0x0, 0x2d, 0xf9, 0x42, 0x34, 0x8e, 0xc2,
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xda, 0x40, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x6, 0xce, 0xff, 0xd9, 0x30, 0x0, 0x1d,
-    0xd7, 0x31, 0x25, 0x9f, 0x90, 0xa, 0xc0, 0x0,
-    0x0, 0x0, 0x13, 0x0, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x51, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c, 0xfd,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd6, 0x6b, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0x10, 0xaf, 0xa5, 0x21, 0x25, 0xbf, 0x40,
-    0x0, 0x28, 0xcf, 0xff, 0xd8, 0x10, 0x0,
-
-    /* U+0406 "І" */
-    0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4,
-    0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4,
-    0xf4,
-
-    /* U+0407 "Ї" */
-    0x4f, 0x30, 0x2e, 0x52, 0xb1, 0x1, 0xb3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x20, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x1, 0xf2, 0x0, 0x0, 0x1f, 0x20, 0x0,
-    0x1, 0xf2, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x1,
-    0xf2, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x1, 0xf2,
-    0x0, 0x0, 0x1f, 0x20, 0x0, 0x1, 0xf2, 0x0,
-    0x0, 0x1f, 0x20, 0x0, 0x1, 0xf2, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x1f,
-    0x20, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0xdf, 0xff, 0xff, 0xf9, 0x0, 0x12, 0x22,
-    0x22, 0xa9, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x0,
-    0xa9, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0, 0x0,
-    0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0,
-    0x0, 0xa9, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x0,
-    0xa9, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x3d, 0x10,
-    0x0, 0x3, 0xf2, 0xa, 0xe7, 0x32, 0x6e, 0x90,
-    0x0, 0x5c, 0xff, 0xd7, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0x22, 0x22, 0x22, 0x22, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x0,
-    0x0, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7b, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7a, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8a, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0xda,
-    0x50, 0x0, 0x0, 0x0, 0x89, 0x0, 0x0, 0x0,
-    0x0, 0x8c, 0x22, 0x22, 0x22, 0x38, 0xeb, 0x0,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x90, 0x0, 0x0,
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x5,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf0, 0x0, 0xc, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0x90, 0x24, 0xaf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x8c, 0x33, 0x33, 0x33, 0x59, 0xfb, 0x0,
-    0xaf, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xea, 0x50, 0x0,
-
-    /* U+040A "Њ" */
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x81, 0x0, 0xf5, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0xf7, 0x22, 0x22, 0x23, 0x6d, 0xe3,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0x0, 0xa, 0xe0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xc7, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x1, 0xf4, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xad, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x61, 0x11, 0x11, 0x25, 0xcd, 0x20,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x1, 0x22, 0x22, 0x2d, 0x82, 0x22, 0x22,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x62, 0x7b,
-    0xef, 0xec, 0x70, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0xfa, 0x63, 0x23, 0x7d, 0xe2, 0x0, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x0,
-    0x0, 0x0, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x30, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x70, 0x0, 0x0, 0xd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x0, 0xd, 0x60, 0x0, 0x0, 0x0, 0x0, 0xc7,
-    0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x70,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x7, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x50, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xc0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x4e, 0x10, 0x0, 0xf4,
-    0x0, 0x0, 0x1, 0xe4, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0xc, 0x80, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x8c, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x4, 0xe1,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xf5, 0x22, 0x27, 0xf2, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0xf4,
-    0x0, 0x0, 0x1, 0xe7, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x5, 0xf2, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0x10, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xb0,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x4, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x37, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xbc,
-    0xf4, 0x0, 0x0, 0x0, 0x1, 0xe7, 0x7c, 0xf4,
-    0x0, 0x0, 0x0, 0xb, 0xb0, 0x7c, 0xf4, 0x0,
-    0x0, 0x0, 0x8d, 0x10, 0x7c, 0xf4, 0x0, 0x0,
-    0x4, 0xf3, 0x0, 0x7c, 0xf4, 0x0, 0x0, 0x2e,
-    0x60, 0x0, 0x7c, 0xf4, 0x0, 0x0, 0xca, 0x0,
-    0x0, 0x7c, 0xf4, 0x0, 0x9, 0xd0, 0x0, 0x0,
-    0x7c, 0xf4, 0x0, 0x5f, 0x20, 0x0, 0x0, 0x7c,
-    0xf4, 0x2, 0xf5, 0x0, 0x0, 0x0, 0x7c, 0xf4,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0x7c, 0xf4, 0xac,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0xfb, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7c,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0x87, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x20, 0x4, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbc, 0xc9, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc7,
-    0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe0,
-    0x2, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0x60,
-    0x0, 0xab, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x2f, 0x30, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x9, 0xb0, 0x0, 0x0, 0x7, 0xc0, 0x0,
-    0x0, 0x1, 0xf3, 0x0, 0x0, 0xe, 0x30, 0x0,
-    0x0, 0x0, 0x9b, 0x0, 0x0, 0x8a, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x30, 0x1, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf3, 0x1e, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0x98, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x32, 0x28, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe4, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe4, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0xf5, 0x22, 0x22, 0x22, 0x22, 0x22, 0xe4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x4b, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x4,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd6,
-    0x0, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xe0, 0x0, 0x5e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x70, 0x0, 0xe, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0x7, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0,
-    0x2f, 0x30, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x8c, 0x22, 0x22,
-    0x22, 0x22, 0x24, 0xf1, 0x0, 0x0, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc8, 0x0, 0x6, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, 0xd,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x70,
-    0x5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xe0,
-
-    /* U+0411 "Б" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x51,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0xee,
-    0xee, 0xed, 0x93, 0x0, 0xf5, 0x11, 0x11, 0x12,
-    0x49, 0xf9, 0xf, 0x40, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x8b, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x5f, 0x41, 0x11, 0x11, 0x13, 0x8f, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xda, 0x30, 0x0,
-
-    /* U+0412 "В" */
-    0xff, 0xff, 0xff, 0xff, 0xd9, 0x20, 0x0, 0xf4,
-    0x11, 0x11, 0x11, 0x4a, 0xf5, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x40, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x60, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x40, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x28, 0xe3, 0x0,
-    0xff, 0xee, 0xee, 0xef, 0xfe, 0x50, 0x0, 0xf5,
-    0x11, 0x11, 0x11, 0x25, 0xcc, 0x10, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xb0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf2, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xd0, 0xf4, 0x11, 0x11, 0x11, 0x25, 0xbe, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x81, 0x0,
-
-    /* U+0413 "Г" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x52, 0x22,
-    0x22, 0x22, 0x20, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x99, 0x22, 0x22, 0x22, 0x22,
-    0xd6, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0x0, 0x0, 0xd6, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0,
-    0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x0, 0xd6,
-    0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xd6, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xd6, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0xa, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x1f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xd6, 0x0, 0x14,
-    0xca, 0x22, 0x22, 0x22, 0x22, 0x22, 0xe7, 0x22,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f,
-
-    /* U+0415 "Е" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf5, 0x22,
-    0x22, 0x22, 0x22, 0x20, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xf5, 0x22,
-    0x22, 0x22, 0x22, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf5, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0416 "Ж" */
-    0x9, 0xc0, 0x0, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x0, 0xd, 0x70, 0x0, 0xd7, 0x0, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0x0, 0x8c, 0x0,
-    0x0, 0x4f, 0x20, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x3, 0xf2, 0x0, 0x0, 0x9, 0xb0, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0xd, 0x70, 0x0,
-    0x0, 0x0, 0xe5, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x10,
-    0x0, 0xa, 0x80, 0x0, 0x2, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xa0, 0x0, 0xa, 0x80, 0x0,
-    0xc, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe4,
-    0x0, 0xa, 0x80, 0x0, 0x6d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x22, 0x2b, 0xa2, 0x22, 0x8e, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0xa, 0x80, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x10,
-    0x0, 0xa, 0x80, 0x0, 0x2, 0xf6, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0xd, 0x90, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0xa, 0xc0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x1, 0xe7, 0x0, 0x4, 0xf3, 0x0, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0x0, 0x4f, 0x30,
-    0x1e, 0x70, 0x0, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x0, 0x8, 0xd0,
-
-    /* U+0417 "З" */
-    0x0, 0x38, 0xcf, 0xff, 0xc9, 0x20, 0x0, 0xb,
-    0xe8, 0x53, 0x22, 0x5b, 0xf6, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x15, 0xd7,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x1, 0x22, 0x22, 0x48, 0xea, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf0, 0xa9, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0x70, 0x2c, 0xe9, 0x52, 0x12, 0x48, 0xf9, 0x0,
-    0x0, 0x49, 0xdf, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+0418 "И" */
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfc, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xbc, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0xe7, 0x7c, 0xf4, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x7c, 0xf4, 0x0, 0x0, 0x0, 0x8d,
-    0x10, 0x7c, 0xf4, 0x0, 0x0, 0x4, 0xf3, 0x0,
-    0x7c, 0xf4, 0x0, 0x0, 0x2e, 0x60, 0x0, 0x7c,
-    0xf4, 0x0, 0x0, 0xca, 0x0, 0x0, 0x7c, 0xf4,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x7c, 0xf4, 0x0,
-    0x5f, 0x20, 0x0, 0x0, 0x7c, 0xf4, 0x2, 0xf5,
-    0x0, 0x0, 0x0, 0x7c, 0xf4, 0xd, 0x90, 0x0,
-    0x0, 0x0, 0x7c, 0xf4, 0xac, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0xfb, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-
-    /* U+0419 "Й" */
-    0x0, 0x6, 0x10, 0x0, 0x3, 0x40, 0x0, 0x0,
-    0x9, 0xa1, 0x0, 0x3d, 0x30, 0x0, 0x0, 0x0,
-    0x6b, 0xcc, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xbc,
-    0xf4, 0x0, 0x0, 0x0, 0x1, 0xe7, 0x7c, 0xf4,
-    0x0, 0x0, 0x0, 0xb, 0xb0, 0x7c, 0xf4, 0x0,
-    0x0, 0x0, 0x8d, 0x10, 0x7c, 0xf4, 0x0, 0x0,
-    0x4, 0xf3, 0x0, 0x7c, 0xf4, 0x0, 0x0, 0x2e,
-    0x60, 0x0, 0x7c, 0xf4, 0x0, 0x0, 0xca, 0x0,
-    0x0, 0x7c, 0xf4, 0x0, 0x9, 0xd0, 0x0, 0x0,
-    0x7c, 0xf4, 0x0, 0x5f, 0x20, 0x0, 0x0, 0x7c,
-    0xf4, 0x2, 0xf5, 0x0, 0x0, 0x0, 0x7c, 0xf4,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0x7c, 0xf4, 0xac,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0xfb, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7c,
-
-    /* U+041A "К" */
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x50, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xc9, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x8, 0xc0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x4e, 0x10, 0x0, 0xf4, 0x0, 0x0, 0x1,
-    0xe4, 0x0, 0x0, 0xf4, 0x0, 0x0, 0xc, 0x80,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x4, 0xe1, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xf5,
-    0x22, 0x27, 0xf2, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x1,
-    0xe7, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8d, 0x10,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb0,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x5d, 0x22, 0x22, 0x22, 0x22, 0x9b,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x7b, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x89, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0x24, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0xaf, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-
-    /* U+041C "М" */
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xf1, 0xf6, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe6, 0xf1, 0xf3, 0xaa, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xb1, 0xf1, 0xf3, 0x1f, 0x30,
-    0x0, 0x0, 0x0, 0x1f, 0x21, 0xf1, 0xf3, 0x7,
-    0xc0, 0x0, 0x0, 0x0, 0xa9, 0x1, 0xf1, 0xf3,
-    0x0, 0xe5, 0x0, 0x0, 0x3, 0xe1, 0x1, 0xf1,
-    0xf3, 0x0, 0x5e, 0x0, 0x0, 0xc, 0x60, 0x1,
-    0xf1, 0xf3, 0x0, 0xc, 0x70, 0x0, 0x5d, 0x0,
-    0x1, 0xf1, 0xf3, 0x0, 0x3, 0xf1, 0x0, 0xe4,
-    0x0, 0x1, 0xf1, 0xf3, 0x0, 0x0, 0x9a, 0x7,
-    0xb0, 0x0, 0x1, 0xf1, 0xf3, 0x0, 0x0, 0x1f,
-    0x5f, 0x20, 0x0, 0x1, 0xf1, 0xf3, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x1, 0xf1, 0xf3, 0x0,
-    0x0, 0x0, 0xa1, 0x0, 0x0, 0x1, 0xf1, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf1,
-
-    /* U+041D "Н" */
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8b, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8b, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8b, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8b, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf5,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x9b, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8b, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8b, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8b, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8b, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0x95, 0x32, 0x47, 0xde,
-    0x50, 0x0, 0x0, 0x2e, 0xb1, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x0, 0x1, 0xda, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x50, 0x8, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xe0, 0xf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x4f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8b, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe7, 0x8, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xe0, 0x1, 0xda, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x50, 0x0, 0x2e,
-    0xb1, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x1, 0xbf, 0x95, 0x32, 0x47, 0xde, 0x50, 0x0,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0,
-
-    /* U+041F "П" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf5,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x7d, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6d, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6d, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-
-    /* U+0420 "Р" */
-    0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0xf, 0x52,
-    0x22, 0x22, 0x37, 0xdd, 0x20, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xae, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xe7, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xbf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xd8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x1f, 0x40, 0x0, 0x0, 0x14, 0xbe,
-    0x40, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0xf,
-    0x52, 0x22, 0x22, 0x10, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x1, 0xbf, 0xa5, 0x32, 0x47, 0xde, 0x40,
-    0x0, 0x2e, 0xb1, 0x0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xb1, 0x0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x1, 0xbf, 0xa5, 0x32, 0x47, 0xde, 0x40,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0422 "Т" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x12,
-    0x22, 0x22, 0xc9, 0x22, 0x22, 0x21, 0x0, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc7,
-    0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe0,
-    0x2, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0x60,
-    0x0, 0xab, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x2f, 0x30, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0x9, 0xb0, 0x0, 0x0, 0x7, 0xc0, 0x0,
-    0x0, 0x1, 0xf3, 0x0, 0x0, 0xe, 0x30, 0x0,
-    0x0, 0x0, 0x9b, 0x0, 0x0, 0x8a, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x30, 0x1, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb0, 0x8, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf3, 0x1e, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0x98, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x32, 0x28, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x9c,
-    0xdf, 0xfd, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x6,
-    0xed, 0x84, 0x2b, 0x93, 0x58, 0xed, 0x40, 0x0,
-    0x0, 0xae, 0x40, 0x0, 0xb, 0x80, 0x0, 0x6,
-    0xf7, 0x0, 0x8, 0xe1, 0x0, 0x0, 0xb, 0x80,
-    0x0, 0x0, 0x3f, 0x50, 0x1f, 0x40, 0x0, 0x0,
-    0xb, 0x80, 0x0, 0x0, 0x7, 0xe0, 0x6d, 0x0,
-    0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x0, 0xf3,
-    0xa9, 0x0, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0,
-    0x0, 0xc7, 0xb8, 0x0, 0x0, 0x0, 0xb, 0x80,
-    0x0, 0x0, 0x0, 0xb8, 0xa8, 0x0, 0x0, 0x0,
-    0xb, 0x80, 0x0, 0x0, 0x0, 0xc7, 0x7c, 0x0,
-    0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x0, 0xe4,
-    0x2f, 0x20, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0,
-    0x5, 0xf0, 0xa, 0xc0, 0x0, 0x0, 0xb, 0x80,
-    0x0, 0x0, 0x1e, 0x70, 0x0, 0xcc, 0x20, 0x0,
-    0xb, 0x80, 0x0, 0x3, 0xda, 0x0, 0x0, 0x9,
-    0xfa, 0x52, 0xb, 0x80, 0x25, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x28, 0xcf, 0xff, 0xff, 0xeb, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x40, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xac, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x3f, 0x40, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x0,
-    0x7e, 0x10, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0,
-    0xbb, 0x0, 0x8, 0xe1, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x9f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x8e,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0xe1, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x2, 0xf6,
-    0x0, 0x0, 0x0, 0xd9, 0x0, 0x0, 0x6, 0xf2,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0xa, 0xc0,
-    0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x1e, 0x80,
-    0x1e, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x40,
-
-    /* U+0426 "Ц" */
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0x40,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x40, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x40, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x40, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe4, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x40, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x40, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x40, 0x0, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0xf,
-    0x52, 0x22, 0x22, 0x22, 0x22, 0x2f, 0x62, 0x20,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x0,
-
-    /* U+0427 "Ч" */
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf1, 0xc6,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf1, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf1, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf1, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf1, 0xc6, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0xb7, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf1, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf1,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x4, 0xf1, 0x6,
-    0xf9, 0x30, 0x0, 0x37, 0xcf, 0xf1, 0x0, 0x3b,
-    0xff, 0xff, 0xea, 0x63, 0xf1, 0x0, 0x0, 0x1,
-    0x21, 0x0, 0x2, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf1,
-
-    /* U+0428 "Ш" */
-    0xf4, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0,
-    0x0, 0xf, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x0, 0x0, 0xf3, 0xf4, 0x0, 0x0,
-    0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0xf, 0x3f,
-    0x40, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0,
-    0x0, 0xf3, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xb0,
-    0x0, 0x0, 0x0, 0xf, 0x3f, 0x40, 0x0, 0x0,
-    0x0, 0x8b, 0x0, 0x0, 0x0, 0x0, 0xf3, 0xf4,
-    0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0,
-    0xf, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x8b, 0x0,
-    0x0, 0x0, 0x0, 0xf3, 0xf4, 0x0, 0x0, 0x0,
-    0x8, 0xb0, 0x0, 0x0, 0x0, 0xf, 0x3f, 0x40,
-    0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0,
-    0xf3, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0,
-    0x0, 0x0, 0xf, 0x3f, 0x40, 0x0, 0x0, 0x0,
-    0x8b, 0x0, 0x0, 0x0, 0x0, 0xf3, 0xf4, 0x0,
-    0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0xf,
-    0x3f, 0x40, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0,
-    0x0, 0x0, 0xf3, 0xf4, 0x0, 0x0, 0x0, 0x8,
-    0xb0, 0x0, 0x0, 0x0, 0xf, 0x3f, 0x52, 0x22,
-    0x22, 0x22, 0x9c, 0x22, 0x22, 0x22, 0x22, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30,
-
-    /* U+0429 "Щ" */
-    0xf4, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0,
-    0x0, 0xf, 0x30, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0x8b, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0xf4,
-    0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0,
-    0xf, 0x30, 0xf, 0x40, 0x0, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0xf,
-    0x30, 0xf, 0x40, 0x0, 0x0, 0x0, 0x8b, 0x0,
-    0x0, 0x0, 0x0, 0xf3, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0xf, 0x30,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0,
-    0x0, 0x0, 0xf3, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x8, 0xb0, 0x0, 0x0, 0x0, 0xf, 0x30, 0xf,
-    0x40, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x8,
-    0xb0, 0x0, 0x0, 0x0, 0xf, 0x30, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0,
-    0xf3, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xb0,
-    0x0, 0x0, 0x0, 0xf, 0x30, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x0, 0xf3,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0,
-    0x0, 0x0, 0xf, 0x30, 0xf, 0x52, 0x22, 0x22,
-    0x22, 0x9c, 0x22, 0x22, 0x22, 0x22, 0xf5, 0x22,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xe0,
-
-    /* U+042A "Ъ" */
-    0xcf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x22, 0x22, 0x7d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xed,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x22, 0x22,
-    0x22, 0x37, 0xec, 0x10, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf2, 0x0,
-    0x0, 0x6, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x50, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x50, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x6,
-    0xd0, 0x0, 0x0, 0x0, 0x1, 0xda, 0x0, 0x0,
-    0x0, 0x6d, 0x11, 0x11, 0x11, 0x37, 0xec, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfe, 0xb5,
-    0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf2, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf2, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf2, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf2, 0xff, 0xff,
-    0xff, 0xfe, 0xc8, 0x20, 0x0, 0x1, 0xf2, 0xf5,
-    0x22, 0x22, 0x22, 0x5b, 0xf5, 0x0, 0x1, 0xf2,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x1,
-    0xf2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0x90,
-    0x1, 0xf2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x1, 0xf2, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x1, 0xf2, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xc0, 0x1, 0xf2, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x80, 0x1, 0xf2, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0x1, 0xf2, 0xf4,
-    0x11, 0x11, 0x11, 0x4a, 0xf4, 0x0, 0x1, 0xf2,
-    0xff, 0xff, 0xff, 0xff, 0xc8, 0x10, 0x0, 0x1,
-    0xf2,
-
-    /* U+042C "Ь" */
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfe, 0xc8, 0x20, 0xf, 0x52, 0x22,
-    0x22, 0x25, 0xbf, 0x50, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x2f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xc9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc8, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x2f, 0x41, 0x11, 0x11, 0x14, 0xaf, 0x40,
-    0xff, 0xff, 0xff, 0xff, 0xc8, 0x10, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x5, 0xad, 0xff, 0xea, 0x40, 0x0, 0x0,
-    0x4, 0xed, 0x74, 0x22, 0x49, 0xfc, 0x20, 0x0,
-    0xa, 0x50, 0x0, 0x0, 0x0, 0x1b, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf2,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x1, 0x22, 0x22, 0x22, 0x22, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x70,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0xd, 0xa1, 0x0, 0x0, 0x0, 0x1b, 0xe2, 0x0,
-    0x2, 0xce, 0x95, 0x32, 0x49, 0xfc, 0x20, 0x0,
-    0x0, 0x4, 0xad, 0xff, 0xea, 0x40, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0xf4, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff, 0xeb,
-    0x60, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x8f,
-    0xb6, 0x32, 0x48, 0xed, 0x30, 0x0, 0xf4, 0x0,
-    0x0, 0xb, 0xe3, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0xf4, 0x0, 0x0, 0x8e, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x10, 0xf4, 0x0, 0x2, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0xf4,
-    0x0, 0x8, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf1, 0xf4, 0x0, 0xc, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe5, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc7,
-    0xf6, 0x22, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb8, 0xf4, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc7, 0xf4, 0x0,
-    0xc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe5, 0xf4, 0x0, 0x8, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf1, 0xf4, 0x0, 0x2, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0xf4,
-    0x0, 0x0, 0x8e, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x10, 0xf4, 0x0, 0x0, 0xb, 0xe3, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x8f, 0xb6, 0x32, 0x48, 0xed, 0x30, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff, 0xeb,
-    0x60, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x3, 0x9d, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x8f, 0xa5, 0x22, 0x22, 0x22, 0xb8, 0x6, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xb8, 0xe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xb8, 0x2f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xb8, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb8, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0x8, 0xd1, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0xbd, 0x61, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x6,
-    0xdf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xc9,
-    0x12, 0x22, 0x22, 0xb8, 0x0, 0x6, 0xe0, 0x0,
-    0x0, 0x0, 0xb8, 0x0, 0x1e, 0x40, 0x0, 0x0,
-    0x0, 0xb8, 0x0, 0xaa, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0x4, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb8,
-
-    /* U+0430 "а" */
-    0x0, 0x4a, 0xef, 0xfc, 0x50, 0x0, 0xbe, 0x73,
-    0x12, 0x7f, 0x80, 0x8, 0x0, 0x0, 0x0, 0x4f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xa9, 0x1, 0x8d, 0xef, 0xff, 0xff, 0x91, 0xea,
-    0x20, 0x0, 0x0, 0xa9, 0x7d, 0x0, 0x0, 0x0,
-    0xa, 0x99, 0x90, 0x0, 0x0, 0x0, 0xc9, 0x7d,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0xda, 0x20, 0x1,
-    0x8c, 0x99, 0x1, 0x8d, 0xfe, 0xd7, 0x9, 0x90,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0x59, 0xdf, 0xa0, 0x0, 0x0,
-    0x7, 0xdf, 0xd9, 0x51, 0x0, 0x0, 0x3, 0xec,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x60, 0x3a, 0xef, 0xd9, 0x20, 0x0,
-    0xf, 0x27, 0xe7, 0x32, 0x4a, 0xf6, 0x0, 0x2f,
-    0x5c, 0x10, 0x0, 0x0, 0x6f, 0x40, 0x3f, 0xd1,
-    0x0, 0x0, 0x0, 0x9, 0xc0, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0x2, 0xf2, 0x3f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xe5, 0x1f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xd6, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xe5, 0xb, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x5, 0xf2, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0,
-    0xcc, 0x10, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x1d,
-    0xe6, 0x21, 0x39, 0xf5, 0x0, 0x0, 0x0, 0x7d,
-    0xff, 0xd9, 0x20, 0x0,
-
-    /* U+0432 "в" */
-    0x6f, 0xff, 0xff, 0xfd, 0x70, 0x6, 0xc0, 0x0,
-    0x1, 0x4d, 0xb0, 0x6c, 0x0, 0x0, 0x0, 0x1f,
-    0x36, 0xc0, 0x0, 0x0, 0x0, 0xe5, 0x6c, 0x0,
-    0x0, 0x0, 0x1f, 0x26, 0xc0, 0x0, 0x0, 0x4c,
-    0x80, 0x6f, 0xff, 0xff, 0xff, 0xa1, 0x6, 0xc0,
-    0x0, 0x0, 0x17, 0xe2, 0x6c, 0x0, 0x0, 0x0,
-    0x9, 0x96, 0xc0, 0x0, 0x0, 0x0, 0x7c, 0x6c,
-    0x0, 0x0, 0x0, 0xa, 0xa6, 0xc0, 0x0, 0x0,
-    0x28, 0xf3, 0x6f, 0xff, 0xff, 0xfe, 0xa3, 0x0,
-
-    /* U+0433 "г" */
-    0x6f, 0xff, 0xff, 0xff, 0xf2, 0x6d, 0x22, 0x22,
-    0x22, 0x20, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x8a, 0x22, 0x22, 0x22, 0xd5, 0x0, 0x0,
-    0x8, 0x90, 0x0, 0x0, 0xd, 0x50, 0x0, 0x0,
-    0x98, 0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0xa,
-    0x70, 0x0, 0x0, 0xd, 0x50, 0x0, 0x0, 0xb6,
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0xc, 0x50,
-    0x0, 0x0, 0xd, 0x50, 0x0, 0x0, 0xd4, 0x0,
-    0x0, 0x0, 0xd5, 0x0, 0x0, 0xf, 0x20, 0x0,
-    0x0, 0xd, 0x50, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0xd5, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0,
-    0xd, 0x50, 0x0, 0x4e, 0x31, 0x11, 0x11, 0x11,
-    0xd6, 0x10, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x6c, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc6, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x6c, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6,
-
-    /* U+0435 "е" */
-    0x0, 0x4, 0xbe, 0xfe, 0x91, 0x0, 0x0, 0x9,
-    0xe7, 0x21, 0x4a, 0xf4, 0x0, 0x7, 0xd1, 0x0,
-    0x0, 0x6, 0xf2, 0x1, 0xf3, 0x0, 0x0, 0x0,
-    0x9, 0xa0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x9, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe3, 0xaf,
-    0xee, 0xee, 0xee, 0xee, 0xef, 0x49, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xe3, 0x0, 0x0, 0x0, 0x72, 0x0,
-    0x8, 0xf9, 0x42, 0x25, 0xcd, 0x10, 0x0, 0x3,
-    0xae, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+0436 "ж" */
-    0xc, 0x80, 0x0, 0x0, 0xe, 0x40, 0x0, 0x0,
-    0x3f, 0x20, 0x2f, 0x30, 0x0, 0x0, 0xe4, 0x0,
-    0x0, 0xc, 0x70, 0x0, 0x7d, 0x0, 0x0, 0xe,
-    0x40, 0x0, 0x7, 0xc0, 0x0, 0x0, 0xc7, 0x0,
-    0x0, 0xe4, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2,
-    0xf2, 0x0, 0xe, 0x40, 0x0, 0xc8, 0x0, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0xe4, 0x0, 0x7d, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x9, 0xd2, 0x22, 0xf5,
-    0x22, 0x8d, 0x0, 0x0, 0x0, 0x4, 0xf3, 0x0,
-    0xe, 0x40, 0x0, 0xca, 0x0, 0x0, 0x1, 0xe7,
-    0x0, 0x0, 0xe4, 0x0, 0x2, 0xf5, 0x0, 0x0,
-    0xbb, 0x0, 0x0, 0xe, 0x40, 0x0, 0x5, 0xf1,
-    0x0, 0x6e, 0x10, 0x0, 0x0, 0xe4, 0x0, 0x0,
-    0xa, 0xc0, 0x2f, 0x50, 0x0, 0x0, 0xe, 0x40,
-    0x0, 0x0, 0x1e, 0x70,
-
-    /* U+0437 "з" */
-    0x0, 0x5b, 0xef, 0xfc, 0x60, 0x0, 0x8, 0xd7,
-    0x32, 0x36, 0xdc, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0xe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0, 0x0,
-    0x0, 0x2, 0xab, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x4, 0x0, 0x0, 0x0,
-    0xa, 0xc0, 0x1d, 0xb6, 0x21, 0x14, 0xbe, 0x20,
-    0x0, 0x5b, 0xef, 0xfc, 0x71, 0x0,
-
-    /* U+0438 "и" */
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xac, 0x6c, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x6c, 0x0, 0x0, 0x0,
-    0x4f, 0x9c, 0x6c, 0x0, 0x0, 0x2, 0xf5, 0x6c,
-    0x6c, 0x0, 0x0, 0x1d, 0x70, 0x6c, 0x6c, 0x0,
-    0x0, 0xba, 0x0, 0x6c, 0x6c, 0x0, 0x8, 0xd0,
-    0x0, 0x6c, 0x6c, 0x0, 0x5e, 0x20, 0x0, 0x6c,
-    0x6c, 0x2, 0xf4, 0x0, 0x0, 0x6c, 0x6c, 0x1d,
-    0x70, 0x0, 0x0, 0x6c, 0x6c, 0xba, 0x0, 0x0,
-    0x0, 0x6c, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x6c,
-    0x6e, 0x10, 0x0, 0x0, 0x0, 0x6c,
-
-    /* U+0439 "й" */
-    0x0, 0x3b, 0x0, 0x0, 0x77, 0x0, 0x0, 0xc,
-    0x60, 0x4, 0xe2, 0x0, 0x0, 0x1, 0x9d, 0xdb,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0x6c, 0x0, 0x0, 0x0,
-    0x7, 0xfc, 0x6c, 0x0, 0x0, 0x0, 0x4f, 0x9c,
-    0x6c, 0x0, 0x0, 0x2, 0xf5, 0x6c, 0x6c, 0x0,
-    0x0, 0x1d, 0x70, 0x6c, 0x6c, 0x0, 0x0, 0xba,
-    0x0, 0x6c, 0x6c, 0x0, 0x8, 0xd0, 0x0, 0x6c,
-    0x6c, 0x0, 0x5e, 0x20, 0x0, 0x6c, 0x6c, 0x2,
-    0xf4, 0x0, 0x0, 0x6c, 0x6c, 0x1d, 0x70, 0x0,
-    0x0, 0x6c, 0x6c, 0xba, 0x0, 0x0, 0x0, 0x6c,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0x6c, 0x6e, 0x10,
-    0x0, 0x0, 0x0, 0x6c,
-
-    /* U+043A "к" */
-    0x6c, 0x0, 0x0, 0x0, 0xc, 0x70, 0x6c, 0x0,
-    0x0, 0x0, 0x9b, 0x0, 0x6c, 0x0, 0x0, 0x6,
-    0xd1, 0x0, 0x6c, 0x0, 0x0, 0x3e, 0x20, 0x0,
-    0x6c, 0x0, 0x1, 0xd5, 0x0, 0x0, 0x6c, 0x0,
-    0xb, 0x80, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x6d, 0x22, 0x2c, 0xa0, 0x0, 0x0,
-    0x6c, 0x0, 0x1, 0xe8, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x6c, 0x0, 0x0, 0x4,
-    0xf3, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x7e, 0x10,
-    0x6c, 0x0, 0x0, 0x0, 0x9, 0xc0,
-
-    /* U+043B "л" */
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x7b, 0x22, 0x22, 0x22, 0xd6, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0xd, 0x60, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x9, 0x70, 0x0, 0x0, 0xd,
-    0x60, 0x0, 0xa6, 0x0, 0x0, 0x0, 0xd6, 0x0,
-    0xc, 0x50, 0x0, 0x0, 0xd, 0x60, 0x0, 0xd3,
-    0x0, 0x0, 0x0, 0xd6, 0x0, 0xf, 0x20, 0x0,
-    0x0, 0xd, 0x60, 0x2, 0xf0, 0x0, 0x0, 0x0,
-    0xd6, 0x0, 0x7b, 0x0, 0x0, 0x0, 0xd, 0x62,
-    0x5f, 0x40, 0x0, 0x0, 0x0, 0xd6, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0xd, 0x60,
-
-    /* U+043C "м" */
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x36,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x6c,
-    0xe3, 0x0, 0x0, 0x0, 0x5, 0xde, 0x36, 0xb7,
-    0xc0, 0x0, 0x0, 0x0, 0xd4, 0xe3, 0x6b, 0xd,
-    0x50, 0x0, 0x0, 0x7a, 0xe, 0x36, 0xb0, 0x4e,
-    0x0, 0x0, 0x1e, 0x10, 0xe3, 0x6b, 0x0, 0xb8,
-    0x0, 0xa, 0x80, 0xe, 0x36, 0xb0, 0x2, 0xf2,
-    0x3, 0xd0, 0x0, 0xe3, 0x6b, 0x0, 0x8, 0xa0,
-    0xc5, 0x0, 0xe, 0x36, 0xb0, 0x0, 0xe, 0x9b,
-    0x0, 0x0, 0xe3, 0x6b, 0x0, 0x0, 0x5f, 0x20,
-    0x0, 0xe, 0x36, 0xb0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0xe3, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x30,
-
-    /* U+043D "н" */
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xb7, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xb7, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xb7,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xb7, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x6d, 0x22, 0x22, 0x22, 0x22, 0xc7,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xb7, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xb7, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xb7,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xb7,
-
-    /* U+043E "о" */
-    0x0, 0x3, 0xae, 0xfe, 0xb4, 0x0, 0x0, 0x8,
-    0xf8, 0x32, 0x37, 0xea, 0x0, 0x6, 0xe2, 0x0,
-    0x0, 0x1, 0xd9, 0x1, 0xf5, 0x0, 0x0, 0x0,
-    0x2, 0xf3, 0x6d, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x99, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xa8,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xd9, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x6d, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x91, 0xf5, 0x0, 0x0, 0x0, 0x2,
-    0xf3, 0x6, 0xe2, 0x0, 0x0, 0x1, 0xd9, 0x0,
-    0x8, 0xf8, 0x32, 0x37, 0xea, 0x0, 0x0, 0x3,
-    0xae, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x6d, 0x22,
-    0x22, 0x22, 0x22, 0xb8, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xa8, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xa8,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xa8, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xa8, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xa8,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xa8, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xa8, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xa8,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xa8,
-
-    /* U+0440 "р" */
-    0x6c, 0x0, 0x8d, 0xff, 0xc7, 0x0, 0x0, 0x6c,
-    0x2d, 0xa4, 0x22, 0x6d, 0xd2, 0x0, 0x6c, 0xd5,
-    0x0, 0x0, 0x0, 0xad, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0xd, 0x70, 0x6f, 0x10, 0x0, 0x0,
-    0x0, 0x6, 0xd0, 0x6e, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf1, 0x6e, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0,
-    0x6f, 0x20, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x6f,
-    0x90, 0x0, 0x0, 0x0, 0xd, 0x70, 0x6d, 0xd5,
-    0x0, 0x0, 0x0, 0xad, 0x0, 0x6d, 0x2d, 0xa4,
-    0x22, 0x6d, 0xd2, 0x0, 0x6d, 0x0, 0x8d, 0xff,
-    0xc7, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x3, 0xae, 0xff, 0xb5, 0x0, 0x0, 0x8f,
-    0x83, 0x22, 0x7e, 0xa0, 0x7, 0xe3, 0x0, 0x0,
-    0x1, 0xc2, 0x1f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xe3, 0x0, 0x0,
-    0x1, 0xc2, 0x0, 0x8f, 0x83, 0x23, 0x7e, 0xa0,
-    0x0, 0x3, 0xae, 0xff, 0xb5, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2, 0x22,
-    0x24, 0xf3, 0x22, 0x21, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf1, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x8, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x1,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0xe, 0x40, 0x0, 0xc, 0x70, 0x0,
-    0x0, 0x5d, 0x0, 0x0, 0x5, 0xe0, 0x0, 0x0,
-    0xc6, 0x0, 0x0, 0x0, 0xd5, 0x0, 0x3, 0xe0,
-    0x0, 0x0, 0x0, 0x7c, 0x0, 0xa, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0x30, 0x1f, 0x10, 0x0, 0x0,
-    0x0, 0x8, 0xa0, 0x8a, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf2, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0x0,
-    0x3c, 0x31, 0x5e, 0x60, 0x0, 0x0, 0x0, 0x8,
-    0xef, 0xd6, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xfd,
-    0x93, 0x0, 0x0, 0x0, 0x6f, 0xb6, 0x37, 0xd2,
-    0x59, 0xfb, 0x10, 0x0, 0x7f, 0x40, 0x0, 0x6c,
-    0x0, 0x1, 0xbc, 0x0, 0x1f, 0x40, 0x0, 0x6,
-    0xc0, 0x0, 0x0, 0xd7, 0x7, 0xc0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x6, 0xe0, 0xa8, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x2f, 0x1b, 0x70, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x1, 0xf2, 0xa8, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x2f, 0x17, 0xd0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x6, 0xd0, 0x1f,
-    0x50, 0x0, 0x6, 0xc0, 0x0, 0x0, 0xd7, 0x0,
-    0x7f, 0x40, 0x0, 0x6c, 0x0, 0x1, 0xcc, 0x0,
-    0x0, 0x6f, 0xc6, 0x37, 0xd2, 0x59, 0xfa, 0x10,
-    0x0, 0x0, 0x17, 0xce, 0xff, 0xfc, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0xd, 0x70, 0x0, 0x0, 0x3, 0xf2, 0x2, 0xf3,
-    0x0, 0x0, 0x1d, 0x60, 0x0, 0x6e, 0x10, 0x0,
-    0xaa, 0x0, 0x0, 0xa, 0xb0, 0x6, 0xd0, 0x0,
-    0x0, 0x0, 0xd7, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0x3f, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xab, 0x0, 0x0,
-    0x0, 0x3, 0xf3, 0xd, 0x70, 0x0, 0x0, 0xd,
-    0x70, 0x3, 0xf3, 0x0, 0x0, 0xab, 0x0, 0x0,
-    0x6e, 0x10, 0x6, 0xe1, 0x0, 0x0, 0xa, 0xb0,
-    0x2f, 0x30, 0x0, 0x0, 0x1, 0xd7,
-
-    /* U+0446 "ц" */
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0xe4, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xe4, 0x0, 0x6d, 0x11, 0x11,
-    0x11, 0x11, 0xe5, 0x10, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6,
-
-    /* U+0447 "ч" */
-    0xc6, 0x0, 0x0, 0x0, 0x9, 0x9c, 0x60, 0x0,
-    0x0, 0x0, 0x99, 0xc6, 0x0, 0x0, 0x0, 0x9,
-    0x9c, 0x60, 0x0, 0x0, 0x0, 0x99, 0xc7, 0x0,
-    0x0, 0x0, 0x9, 0x99, 0xc0, 0x0, 0x0, 0x0,
-    0x99, 0x2f, 0xa2, 0x0, 0x4, 0x8f, 0x90, 0x2a,
-    0xff, 0xff, 0xb6, 0xa9, 0x0, 0x0, 0x11, 0x0,
-    0x9, 0x90, 0x0, 0x0, 0x0, 0x0, 0x99, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x99, 0x0, 0x0, 0x0, 0x0, 0x9, 0x90,
-
-    /* U+0448 "ш" */
-    0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x0,
-    0xc7, 0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0,
-    0x0, 0xc7, 0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0, 0xc7, 0x6c, 0x0, 0x0, 0x0, 0x9a,
-    0x0, 0x0, 0x0, 0xc7, 0x6c, 0x0, 0x0, 0x0,
-    0x9a, 0x0, 0x0, 0x0, 0xc7, 0x6c, 0x0, 0x0,
-    0x0, 0x9a, 0x0, 0x0, 0x0, 0xc7, 0x6c, 0x0,
-    0x0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0xc7, 0x6c,
-    0x0, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0xc7,
-    0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x0,
-    0xc7, 0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0,
-    0x0, 0xc7, 0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0, 0xc7, 0x6d, 0x11, 0x11, 0x11, 0x9b,
-    0x11, 0x11, 0x11, 0xc7, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0449 "щ" */
-    0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x0,
-    0xc7, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0, 0xc7, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x9a, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0xc7, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x0,
-    0xc7, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0, 0xc7, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x9a, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0xc7, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x0,
-    0xc7, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0, 0xc7, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x9a, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x6d, 0x11,
-    0x11, 0x11, 0x9b, 0x11, 0x11, 0x11, 0xc8, 0x10,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x22, 0x22, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xd8, 0x0, 0x0, 0x0, 0xf,
-    0x30, 0x0, 0x3, 0xcd, 0x0, 0x0, 0x0, 0xf3,
-    0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0xf, 0x30,
-    0x0, 0x0, 0xa, 0x90, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0xa9, 0x0, 0x0, 0xf, 0x30, 0x0,
-    0x0, 0xe, 0x50, 0x0, 0x0, 0xf3, 0x0, 0x0,
-    0x4c, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0x70, 0x0,
-
-    /* U+044B "ы" */
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x6c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6d, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0x6f, 0xff, 0xff, 0xeb, 0x50,
-    0x0, 0x6d, 0x6c, 0x0, 0x0, 0x15, 0xe8, 0x0,
-    0x6d, 0x6c, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x6d,
-    0x6c, 0x0, 0x0, 0x0, 0xe, 0x40, 0x6d, 0x6c,
-    0x0, 0x0, 0x0, 0xf, 0x40, 0x6d, 0x6c, 0x0,
-    0x0, 0x0, 0x4f, 0x10, 0x6d, 0x6c, 0x0, 0x0,
-    0x16, 0xf7, 0x0, 0x6d, 0x6f, 0xff, 0xff, 0xeb,
-    0x40, 0x0, 0x6d,
-
-    /* U+044C "ь" */
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0xc6,
-    0x0, 0x6c, 0x0, 0x0, 0x15, 0xe9, 0x6, 0xc0,
-    0x0, 0x0, 0x2, 0xf2, 0x6c, 0x0, 0x0, 0x0,
-    0xe, 0x56, 0xc0, 0x0, 0x0, 0x0, 0xe5, 0x6c,
-    0x0, 0x0, 0x0, 0x3f, 0x16, 0xc0, 0x0, 0x1,
-    0x6e, 0x80, 0x6f, 0xff, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x4a, 0xef, 0xfc, 0x70, 0x0, 0x0, 0xad,
-    0x62, 0x1, 0x4b, 0xe2, 0x0, 0x5, 0x0, 0x0,
-    0x0, 0x7, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd4, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa0, 0x4, 0x0, 0x0, 0x0, 0x7, 0xe1, 0x0,
-    0xbd, 0x62, 0x11, 0x5c, 0xe2, 0x0, 0x0, 0x4a,
-    0xef, 0xfc, 0x70, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0x6c, 0x0, 0x0, 0x0, 0x7c, 0xff, 0xd8, 0x10,
-    0x0, 0x6c, 0x0, 0x0, 0x1d, 0xd6, 0x22, 0x5b,
-    0xe3, 0x0, 0x6c, 0x0, 0x0, 0xda, 0x0, 0x0,
-    0x0, 0x8e, 0x10, 0x6c, 0x0, 0x6, 0xe0, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x6c, 0x0, 0xc, 0x70,
-    0x0, 0x0, 0x0, 0x4, 0xe0, 0x6c, 0x0, 0xf,
-    0x30, 0x0, 0x0, 0x0, 0x1, 0xf2, 0x6f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x6d,
-    0x22, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x1, 0xf2,
-    0x6c, 0x0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x4,
-    0xe0, 0x6c, 0x0, 0x6, 0xe0, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x6c, 0x0, 0x0, 0xda, 0x0, 0x0,
-    0x0, 0x8e, 0x10, 0x6c, 0x0, 0x0, 0x1d, 0xc5,
-    0x21, 0x4b, 0xe3, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x7c, 0xff, 0xd8, 0x10, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x3a, 0xef, 0xff, 0xff, 0xd0, 0x6f, 0x83,
-    0x11, 0x11, 0x5d, 0x1f, 0x50, 0x0, 0x0, 0x4,
-    0xd5, 0xe0, 0x0, 0x0, 0x0, 0x4d, 0x6c, 0x0,
-    0x0, 0x0, 0x4, 0xd5, 0xe0, 0x0, 0x0, 0x0,
-    0x4d, 0x1f, 0x30, 0x0, 0x0, 0x4, 0xd0, 0x7e,
-    0x61, 0x0, 0x0, 0x4d, 0x0, 0x4c, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0xc7, 0x0, 0x0, 0x4d, 0x0,
-    0x9b, 0x0, 0x0, 0x4, 0xd0, 0x5e, 0x10, 0x0,
-    0x0, 0x4d, 0x2e, 0x30, 0x0, 0x0, 0x4, 0xd0,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x1b, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xef, 0xe9, 0x10, 0x0, 0x0,
-    0x9e, 0x72, 0x14, 0xaf, 0x40, 0x0, 0x7d, 0x10,
-    0x0, 0x0, 0x6f, 0x20, 0x1f, 0x30, 0x0, 0x0,
-    0x0, 0x9a, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x2,
-    0xf0, 0x99, 0x0, 0x0, 0x0, 0x0, 0xe, 0x3a,
-    0xfe, 0xee, 0xee, 0xee, 0xee, 0xf4, 0x99, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0x30, 0x0, 0x0, 0x7, 0x20,
-    0x0, 0x8f, 0x94, 0x22, 0x5c, 0xd1, 0x0, 0x0,
-    0x3a, 0xef, 0xfc, 0x70, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x7, 0xe0, 0x5, 0xe2, 0x0, 0x0, 0x0,
-    0x4a, 0x0, 0x3b, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xbe, 0xfe, 0x91, 0x0,
-    0x0, 0x9, 0xe7, 0x21, 0x4a, 0xf4, 0x0, 0x7,
-    0xd1, 0x0, 0x0, 0x6, 0xf2, 0x1, 0xf3, 0x0,
-    0x0, 0x0, 0x9, 0xa0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x9, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xe3, 0xaf, 0xee, 0xee, 0xee, 0xee, 0xef, 0x49,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xe3, 0x0, 0x0, 0x0,
-    0x72, 0x0, 0x8, 0xf9, 0x42, 0x25, 0xcd, 0x10,
-    0x0, 0x3, 0xae, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x2, 0x9e, 0xff, 0xb4, 0x0, 0x0, 0x6, 0xc4,
-    0xe8, 0x32, 0x38, 0xf7, 0x0, 0x0, 0x6d, 0xd2,
-    0x0, 0x0, 0x4, 0xf3, 0x0, 0x6, 0xf5, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x6f, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x0, 0x6, 0xd0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x6,
-    0xd0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x82, 0x15, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xef, 0xd6, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x9d, 0x20, 0x0, 0x0, 0xb,
-    0xb1, 0x0, 0x0, 0x1, 0xc8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xf2, 0x6d, 0x22,
-    0x22, 0x22, 0x20, 0x6c, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x2, 0x9d, 0xff, 0xd9, 0x20, 0x0, 0x7f,
-    0x93, 0x11, 0x38, 0xe5, 0x6, 0xe3, 0x0, 0x0,
-    0x0, 0x22, 0x1f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xe2, 0x0, 0x0,
-    0x0, 0x23, 0x0, 0x7f, 0x83, 0x1, 0x39, 0xf5,
-    0x0, 0x2, 0x9d, 0xff, 0xd9, 0x20,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x5b, 0xff, 0xeb, 0x60, 0x0, 0x8e, 0x62,
-    0x12, 0x6c, 0x80, 0x1f, 0x30, 0x0, 0x0, 0x0,
-    0x4, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x83, 0x0, 0x0,
-    0x0, 0x0, 0x5a, 0xef, 0xc8, 0x20, 0x0, 0x0,
-    0x0, 0x15, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x32,
-    0x0, 0x0, 0x0, 0x4f, 0x7, 0xfa, 0x42, 0x12,
-    0x6e, 0x70, 0x3, 0x9d, 0xff, 0xeb, 0x40, 0x0,
-
-    /* U+0456 "і" */
-    0x0, 0x9, 0xe1, 0x9e, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x6, 0xc0, 0x6c, 0x6, 0xc0, 0x6c,
-    0x6, 0xc0, 0x6c, 0x6, 0xc0, 0x6c, 0x6, 0xc0,
-    0x6c, 0x6, 0xc0, 0x6c, 0x0,
-
-    /* U+0457 "ї" */
-    0x1e, 0x51, 0xe5, 0xb, 0x30, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x7c, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x8, 0xe1, 0x0, 0x0, 0x9, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0x9, 0xa0, 0x8, 0x21, 0x5f, 0x40,
-    0x9, 0xef, 0xd5, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7b, 0x22, 0x22, 0x22,
-    0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x90,
-    0x0, 0x0, 0xd, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x98, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x70, 0x0, 0x0, 0xd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xda, 0x20, 0x0,
-    0xc, 0x50, 0x0, 0x0, 0xd, 0x80, 0x0, 0x2,
-    0x8f, 0x30, 0x0, 0xd3, 0x0, 0x0, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x8c, 0x0, 0xf, 0x20, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0x4, 0xf0, 0x2,
-    0xf0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x4f, 0x0, 0x7b, 0x0, 0x0, 0x0, 0xd, 0x80,
-    0x0, 0x0, 0xa, 0xb2, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0xd9, 0x22, 0x22, 0x5b, 0xf3, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd, 0x92,
-    0x0,
-
-    /* U+045A "њ" */
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0x10, 0x6d, 0x22, 0x22, 0x22,
-    0x22, 0xf5, 0x22, 0x22, 0x5c, 0xe1, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0xd8,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x8b, 0x6c, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x0, 0x0, 0x8a, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0xd6, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x3b, 0xc0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xd8, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x3, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xdd,
-    0xef, 0xdd, 0xdd, 0xdd, 0x0, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x29, 0xef, 0xfb, 0x40, 0x0, 0x0, 0x6c, 0x4e,
-    0x83, 0x23, 0x8f, 0x70, 0x0, 0x6, 0xed, 0x20,
-    0x0, 0x0, 0x4f, 0x30, 0x0, 0x6f, 0x50, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x6, 0xf0, 0x0, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x6d, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-    0x6, 0xd0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x6,
-    0xd0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x6, 0xd0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x0, 0x6, 0xd0,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x9e, 0x30, 0x0, 0x0, 0x0,
-    0xa, 0xb1, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0xc, 0x70, 0x6c, 0x0, 0x0, 0x0,
-    0x9b, 0x0, 0x6c, 0x0, 0x0, 0x6, 0xd1, 0x0,
-    0x6c, 0x0, 0x0, 0x3e, 0x20, 0x0, 0x6c, 0x0,
-    0x1, 0xd5, 0x0, 0x0, 0x6c, 0x0, 0xb, 0x80,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x6d, 0x22, 0x2c, 0xa0, 0x0, 0x0, 0x6c, 0x0,
-    0x1, 0xe8, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x6c, 0x0, 0x0, 0x4, 0xf3, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x7e, 0x10, 0x6c, 0x0,
-    0x0, 0x0, 0x9, 0xc0,
-
-    /* U+045D "ѝ" */
-    0x0, 0x2d, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xac, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0x6c, 0x0, 0x0, 0x0,
-    0x7, 0xfc, 0x6c, 0x0, 0x0, 0x0, 0x4f, 0x9c,
-    0x6c, 0x0, 0x0, 0x2, 0xf5, 0x6c, 0x6c, 0x0,
-    0x0, 0x1d, 0x70, 0x6c, 0x6c, 0x0, 0x0, 0xba,
-    0x0, 0x6c, 0x6c, 0x0, 0x8, 0xd0, 0x0, 0x6c,
-    0x6c, 0x0, 0x5e, 0x20, 0x0, 0x6c, 0x6c, 0x2,
-    0xf4, 0x0, 0x0, 0x6c, 0x6c, 0x1d, 0x70, 0x0,
-    0x0, 0x6c, 0x6c, 0xba, 0x0, 0x0, 0x0, 0x6c,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0x6c, 0x6e, 0x10,
-    0x0, 0x0, 0x0, 0x6c,
-
-    /* U+045E "ў" */
-    0x0, 0x2, 0xc0, 0x0, 0x6, 0x80, 0x0, 0x0,
-    0x0, 0xc7, 0x0, 0x3e, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xdd, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xa9, 0x1, 0xf3, 0x0, 0x0, 0x0, 0x1,
-    0xf2, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x8, 0xb0,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0xe, 0x40, 0x0,
-    0xc, 0x70, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x5,
-    0xe0, 0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0xd5,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0xa, 0x80, 0x0, 0x0, 0x0, 0xf, 0x30, 0x1f,
-    0x10, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x8a, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf2, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1,
-    0x0, 0x0, 0x0, 0x3c, 0x31, 0x5e, 0x60, 0x0,
-    0x0, 0x0, 0x8, 0xef, 0xd6, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+045F "џ" */
-    0x6c, 0x0, 0x0, 0x0, 0x8, 0xa6, 0xc0, 0x0,
-    0x0, 0x0, 0x8a, 0x6c, 0x0, 0x0, 0x0, 0x8,
-    0xa6, 0xc0, 0x0, 0x0, 0x0, 0x8a, 0x6c, 0x0,
-    0x0, 0x0, 0x8, 0xa6, 0xc0, 0x0, 0x0, 0x0,
-    0x8a, 0x6c, 0x0, 0x0, 0x0, 0x8, 0xa6, 0xc0,
-    0x0, 0x0, 0x0, 0x8a, 0x6c, 0x0, 0x0, 0x0,
-    0x8, 0xa6, 0xc0, 0x0, 0x0, 0x0, 0x8a, 0x6c,
-    0x0, 0x0, 0x0, 0x8, 0xa6, 0xd1, 0x11, 0x11,
-    0x11, 0x9a, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xc6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x6f, 0x52, 0x22, 0x22, 0x22,
-    0x20, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x5, 0x30, 0x0, 0x0, 0x0,
-    0xb7, 0x0, 0x0, 0x0, 0xb, 0x76, 0xff, 0xff,
-    0xff, 0xf7, 0x6d, 0x22, 0x22, 0x22, 0x6, 0xc0,
-    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x6,
-    0xc0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x6c,
-    0x0, 0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-
-    /* U+2014 "—" */
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee,
-
-    /* U+2018 "‘" */
-    0x9, 0x40, 0xd1, 0x1e, 0x5, 0xb0, 0x9f, 0x46,
-    0xf3,
-
-    /* U+2019 "’" */
-    0x6f, 0x37, 0xf5, 0xe, 0x12, 0xd0, 0x58, 0x5,
-    0x30,
-
-    /* U+201A "‚" */
-    0x0, 0x7, 0xf4, 0x6f, 0x50, 0xe1, 0x2c, 0x6,
-    0x80, 0x42, 0x0,
-
-    /* U+201C "“" */
-    0x9, 0x40, 0xd, 0x0, 0xd1, 0x2, 0xc0, 0x1e,
-    0x0, 0x69, 0x5, 0xb0, 0xa, 0x60, 0x9f, 0x40,
-    0xee, 0x6, 0xf3, 0xb, 0xd0,
-
-    /* U+201D "”" */
-    0x6f, 0x30, 0xbd, 0x7, 0xf5, 0xc, 0xf0, 0xe,
-    0x10, 0x4c, 0x2, 0xd0, 0x7, 0x70, 0x58, 0x0,
-    0xb3, 0x5, 0x30, 0x8, 0x0,
-
-    /* U+2026 "…" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x8f, 0x30, 0x9, 0xf2, 0x6f, 0x30, 0x7,
-    0xf2, 0x0, 0x8e, 0x10,
-
-    /* U+20B4 "₴" */
-    0x0, 0x1, 0x7b, 0xef, 0xfd, 0x92, 0x0, 0x0,
-    0x0, 0x2f, 0xa6, 0x31, 0x24, 0x9f, 0x60, 0x0,
-    0x0, 0x2, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5, 0x0,
-    0x6d, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xed, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd2,
-    0x0, 0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x7e, 0x10, 0x0, 0x0, 0x0, 0x8d, 0x0,
-    0x0, 0xa, 0xe8, 0x32, 0x24, 0x8e, 0xc2, 0x0,
-    0x0, 0x0, 0x4a, 0xef, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x1c, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa, 0x50,
-    0x0, 0x19, 0xcc, 0xb4, 0x0, 0x1f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x60, 0x1, 0xd5, 0x0,
-    0x2c, 0x60, 0x1f, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x60, 0x9, 0x60, 0x0, 0x1, 0xe0, 0x1f,
-    0x4e, 0x80, 0x0, 0x0, 0x0, 0xd, 0x60, 0xc,
-    0x20, 0x0, 0x0, 0xb3, 0x1f, 0x24, 0xf4, 0x0,
-    0x0, 0x0, 0xd, 0x60, 0xc, 0x20, 0x0, 0x0,
-    0xc2, 0x1f, 0x20, 0x7e, 0x10, 0x0, 0x0, 0xd,
-    0x60, 0x7, 0x80, 0x0, 0x2, 0xd0, 0x1f, 0x20,
-    0xb, 0xc0, 0x0, 0x0, 0xd, 0x60, 0x0, 0xb9,
-    0x32, 0x6d, 0x30, 0x1f, 0x20, 0x1, 0xd9, 0x0,
-    0x0, 0xd, 0x60, 0x0, 0x5, 0xaa, 0x81, 0x0,
-    0x1f, 0x20, 0x0, 0x3f, 0x50, 0x0, 0xd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x0,
-    0x6, 0xf2, 0x0, 0xd, 0x60, 0x0, 0x11, 0x11,
-    0x11, 0x10, 0x1f, 0x20, 0x0, 0x0, 0xad, 0x0,
-    0xd, 0x60, 0x4, 0xcc, 0xcc, 0xcc, 0x90, 0x1f,
-    0x20, 0x0, 0x0, 0xd, 0xa0, 0xd, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x2, 0xf6, 0xd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x20, 0x0, 0x0, 0x0, 0x5f, 0x3d,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20,
-    0x0, 0x0, 0x0, 0x8, 0xee, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 99, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 97, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26, .adv_w = 137, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 47, .adv_w = 265, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 183, .adv_w = 234, .box_w = 13, .box_h = 24, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 339, .adv_w = 314, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 492, .adv_w = 252, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 627, .adv_w = 74, .box_w = 2, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 634, .adv_w = 123, .box_w = 5, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 692, .adv_w = 124, .box_w = 5, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 750, .adv_w = 144, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 791, .adv_w = 218, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 852, .adv_w = 77, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 863, .adv_w = 146, .box_w = 7, .box_h = 2, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 870, .adv_w = 77, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 875, .adv_w = 123, .box_w = 10, .box_h = 24, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 995, .adv_w = 253, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1114, .adv_w = 136, .box_w = 6, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1165, .adv_w = 216, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1276, .adv_w = 214, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1387, .adv_w = 251, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1515, .adv_w = 214, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1626, .adv_w = 231, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1737, .adv_w = 223, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1848, .adv_w = 243, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1959, .adv_w = 231, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2078, .adv_w = 77, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2098, .adv_w = 77, .box_w = 3, .box_h = 17, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2124, .adv_w = 218, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 2185, .adv_w = 218, .box_w = 11, .box_h = 8, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 2229, .adv_w = 218, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 2290, .adv_w = 216, .box_w = 12, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2392, .adv_w = 397, .box_w = 23, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2645, .adv_w = 271, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2790, .adv_w = 289, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2918, .adv_w = 271, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3054, .adv_w = 317, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3199, .adv_w = 257, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3310, .adv_w = 242, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3421, .adv_w = 297, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3557, .adv_w = 313, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3685, .adv_w = 113, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3711, .adv_w = 189, .box_w = 10, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 3796, .adv_w = 270, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3924, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4026, .adv_w = 367, .box_w = 19, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4188, .adv_w = 313, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4316, .adv_w = 322, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4469, .adv_w = 275, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4588, .adv_w = 322, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4788, .adv_w = 276, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4907, .adv_w = 234, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5018, .adv_w = 216, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5137, .adv_w = 305, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5265, .adv_w = 264, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5410, .adv_w = 422, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5631, .adv_w = 247, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5759, .adv_w = 240, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5887, .adv_w = 248, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6006, .adv_w = 118, .box_w = 5, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 6064, .adv_w = 123, .box_w = 10, .box_h = 24, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 6184, .adv_w = 118, .box_w = 5, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 6242, .adv_w = 219, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 6292, .adv_w = 192, .box_w = 12, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6298, .adv_w = 230, .box_w = 6, .box_h = 3, .ofs_x = 3, .ofs_y = 15},
-    {.bitmap_index = 6307, .adv_w = 224, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6379, .adv_w = 259, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6505, .adv_w = 213, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6583, .adv_w = 259, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6700, .adv_w = 229, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6785, .adv_w = 126, .box_w = 9, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6866, .adv_w = 262, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 6983, .adv_w = 258, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7091, .adv_w = 100, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7118, .adv_w = 102, .box_w = 8, .box_h = 23, .ofs_x = -3, .ofs_y = -5},
-    {.bitmap_index = 7210, .adv_w = 224, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7318, .adv_w = 100, .box_w = 2, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7336, .adv_w = 409, .box_w = 22, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7479, .adv_w = 258, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7557, .adv_w = 238, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7642, .adv_w = 259, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 7768, .adv_w = 259, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 7885, .adv_w = 151, .box_w = 7, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7931, .adv_w = 184, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8003, .adv_w = 153, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8075, .adv_w = 257, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8153, .adv_w = 203, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8238, .adv_w = 331, .box_w = 21, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8375, .adv_w = 199, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8453, .adv_w = 203, .box_w = 14, .box_h = 18, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 8579, .adv_w = 193, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8651, .adv_w = 123, .box_w = 7, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 8732, .adv_w = 112, .box_w = 3, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8767, .adv_w = 123, .box_w = 7, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8848, .adv_w = 218, .box_w = 12, .box_h = 4, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 8872, .adv_w = 175, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 8917, .adv_w = 175, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 8967, .adv_w = 251, .box_w = 12, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9099, .adv_w = 251, .box_w = 12, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9225, .adv_w = 314, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9396, .adv_w = 218, .box_w = 11, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9517, .adv_w = 271, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9645, .adv_w = 238, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9756, .adv_w = 116, .box_w = 2, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9773, .adv_w = 113, .box_w = 7, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9847, .adv_w = 198, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9932, .adv_w = 455, .box_w = 28, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10170, .adv_w = 456, .box_w = 25, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10383, .adv_w = 317, .box_w = 19, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10545, .adv_w = 267, .box_w = 14, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10699, .adv_w = 317, .box_w = 14, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10853, .adv_w = 258, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11029, .adv_w = 309, .box_w = 14, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 11176, .adv_w = 281, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11329, .adv_w = 278, .box_w = 13, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11440, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11559, .adv_w = 218, .box_w = 11, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11653, .adv_w = 302, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 11842, .adv_w = 251, .box_w = 12, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11944, .adv_w = 382, .box_w = 24, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12148, .adv_w = 235, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12267, .adv_w = 317, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12386, .adv_w = 317, .box_w = 14, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12540, .adv_w = 267, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12659, .adv_w = 300, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12795, .adv_w = 370, .box_w = 18, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12948, .adv_w = 316, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13067, .adv_w = 328, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13220, .adv_w = 318, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13339, .adv_w = 271, .box_w = 13, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13450, .adv_w = 274, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13586, .adv_w = 221, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13705, .adv_w = 258, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13841, .adv_w = 349, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 14031, .adv_w = 244, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14159, .adv_w = 316, .box_w = 17, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 14338, .adv_w = 274, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14457, .adv_w = 420, .box_w = 21, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14636, .adv_w = 428, .box_w = 23, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 14878, .adv_w = 313, .box_w = 19, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15040, .adv_w = 371, .box_w = 18, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15193, .adv_w = 272, .box_w = 13, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15304, .adv_w = 271, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15440, .adv_w = 417, .box_w = 22, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15627, .adv_w = 281, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15746, .adv_w = 222, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15818, .adv_w = 252, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15958, .adv_w = 231, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16030, .adv_w = 178, .box_w = 10, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16095, .adv_w = 245, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 16215, .adv_w = 234, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16300, .adv_w = 310, .box_w = 19, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16424, .adv_w = 202, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16502, .adv_w = 262, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16580, .adv_w = 262, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16688, .adv_w = 218, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16766, .adv_w = 240, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16851, .adv_w = 301, .box_w = 15, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16949, .adv_w = 257, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17027, .adv_w = 243, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17112, .adv_w = 258, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17190, .adv_w = 263, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 17316, .adv_w = 214, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17394, .adv_w = 175, .box_w = 12, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 17472, .adv_w = 210, .box_w = 14, .box_h = 18, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 17598, .adv_w = 295, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 17794, .adv_w = 197, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17872, .adv_w = 261, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 17984, .adv_w = 227, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18056, .adv_w = 353, .box_w = 18, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18173, .adv_w = 353, .box_w = 20, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 18333, .adv_w = 232, .box_w = 15, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 18431, .adv_w = 294, .box_w = 14, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18522, .adv_w = 212, .box_w = 11, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18594, .adv_w = 218, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18679, .adv_w = 329, .box_w = 18, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18796, .adv_w = 231, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18868, .adv_w = 238, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18985, .adv_w = 234, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19096, .adv_w = 256, .box_w = 15, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 19269, .adv_w = 178, .box_w = 10, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19359, .adv_w = 218, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19437, .adv_w = 200, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19509, .adv_w = 102, .box_w = 3, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19538, .adv_w = 100, .box_w = 6, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19589, .adv_w = 102, .box_w = 8, .box_h = 23, .ofs_x = -3, .ofs_y = -5},
-    {.bitmap_index = 19681, .adv_w = 350, .box_w = 21, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19818, .adv_w = 360, .box_w = 20, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19948, .adv_w = 256, .box_w = 15, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 20091, .adv_w = 218, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20199, .adv_w = 262, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20307, .adv_w = 210, .box_w = 14, .box_h = 23, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 20468, .adv_w = 243, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 20556, .adv_w = 219, .box_w = 11, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 20672, .adv_w = 167, .box_w = 9, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20744, .adv_w = 192, .box_w = 12, .box_h = 1, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 20750, .adv_w = 384, .box_w = 24, .box_h = 1, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 20762, .adv_w = 77, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 20771, .adv_w = 77, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 20780, .adv_w = 77, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 20791, .adv_w = 136, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 20812, .adv_w = 136, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 20833, .adv_w = 234, .box_w = 13, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20853, .adv_w = 317, .box_w = 16, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20989, .adv_w = 459, .box_w = 26, .box_h = 17, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_24;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_24 = {
-#else
-lv_font_t montserrat_cyrillic_24 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 27,          /*The maximum line height required by the font*/
-    .base_line = 5,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_24,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_24*/
@@ -1,3985 +0,0 @@
-/*******************************************************************************
- * Size: 26 px
- * Bpp: 4
- * Opts: --bpp 4 --size 26 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_26.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_26
-#define MONTSERRAT_CYRILLIC_26 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_26
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x7f, 0x7, 0xf0, 0x6f, 0x6, 0xf0, 0x6f, 0x6,
-    0xe0, 0x5e, 0x5, 0xe0, 0x5d, 0x4, 0xd0, 0x4d,
-    0x4, 0xc0, 0x3c, 0x1, 0x60, 0x0, 0x0, 0x0,
-    0x2, 0xa, 0xf4, 0x8e, 0x20,
-
-    /* U+0022 "\"" */
-    0x1f, 0x10, 0xd, 0x50, 0xf1, 0x0, 0xd4, 0xf,
-    0x10, 0xd, 0x40, 0xf1, 0x0, 0xd4, 0xf, 0x0,
-    0xc, 0x40, 0xf0, 0x0, 0xc4, 0xd, 0x0, 0xa,
-    0x30,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xe3, 0x0, 0x0, 0x1e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x3d,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0,
-    0x5b, 0x0, 0x0, 0x0, 0x0, 0x3, 0xd0, 0x0,
-    0x0, 0x79, 0x0, 0x0, 0x0, 0x0, 0x5, 0xb0,
-    0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x90, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x22, 0x2c, 0x72, 0x22, 0x22, 0xf3, 0x22, 0x20,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x10, 0x0, 0x2, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x4,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x0, 0x0,
-    0x6, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0x0,
-    0x0, 0x8, 0x80, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x2, 0x22,
-    0x99, 0x22, 0x22, 0x2c, 0x62, 0x22, 0x0, 0x0,
-    0x0, 0xa6, 0x0, 0x0, 0xe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xc4, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe2, 0x0, 0x0, 0x1e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3d,
-    0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x77, 0x0, 0x0, 0x0, 0x0, 0x3, 0xad,
-    0xff, 0xeb, 0x71, 0x0, 0x0, 0x9f, 0xa5, 0x99,
-    0x48, 0xdf, 0x60, 0x7, 0xf3, 0x0, 0x77, 0x0,
-    0x4, 0x40, 0xe, 0x70, 0x0, 0x77, 0x0, 0x0,
-    0x0, 0x2f, 0x20, 0x0, 0x77, 0x0, 0x0, 0x0,
-    0x2f, 0x30, 0x0, 0x77, 0x0, 0x0, 0x0, 0xf,
-    0x80, 0x0, 0x77, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0x0, 0x77, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe9,
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b, 0xff,
-    0xc7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x8e,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x4, 0xf4,
-    0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0xe7, 0x0,
-    0x0, 0x0, 0x77, 0x0, 0x0, 0xd7, 0x22, 0x0,
-    0x0, 0x77, 0x0, 0x2, 0xf4, 0x7e, 0x60, 0x0,
-    0x77, 0x0, 0x1c, 0xc0, 0x6, 0xfe, 0x85, 0x99,
-    0x58, 0xec, 0x10, 0x0, 0x6, 0xbe, 0xff, 0xeb,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x9d, 0xcb, 0x30, 0x0, 0x0, 0x0, 0x1e,
-    0x10, 0x0, 0xc, 0x60, 0x2, 0xd3, 0x0, 0x0,
-    0x0, 0xb6, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x4b,
-    0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0xa5, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0x1e, 0x20, 0x0, 0x0,
-    0xc2, 0x0, 0x0, 0xc, 0x20, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0xd, 0x20, 0x5,
-    0xc0, 0x0, 0x0, 0x0, 0xa5, 0x0, 0x0, 0xf,
-    0x0, 0x1e, 0x20, 0x0, 0x0, 0x0, 0x5b, 0x0,
-    0x0, 0x5b, 0x0, 0xa7, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x4, 0xe2, 0x4, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8d, 0xeb, 0x20, 0xd, 0x30,
-    0x19, 0xee, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x98, 0x0, 0xd7, 0x0, 0x6e, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xd0, 0x7, 0x90, 0x0, 0x7, 0x90,
-    0x0, 0x0, 0x0, 0xd, 0x30, 0xc, 0x30, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x0, 0x89, 0x0, 0xf,
-    0x10, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3, 0xd0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0xd, 0x40, 0x0, 0xd, 0x20, 0x0, 0x1, 0xe0,
-    0x0, 0x0, 0x89, 0x0, 0x0, 0x8, 0x80, 0x0,
-    0x6, 0x90, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x1,
-    0xd4, 0x0, 0x3d, 0x10, 0x0, 0xc, 0x40, 0x0,
-    0x0, 0x0, 0x1a, 0xdc, 0xb2, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x5c, 0xff, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xe5, 0x11, 0x5e, 0x60, 0x0, 0x0,
-    0x0, 0x1f, 0x30, 0x0, 0x5, 0xd0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x4, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0xd, 0x70, 0x0, 0x0,
-    0x0, 0x7, 0xe2, 0x2, 0xda, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xad, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xe6, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcc, 0x10, 0x1d, 0xa0, 0x0, 0x2, 0x10,
-    0xb, 0xb0, 0x0, 0x1, 0xe9, 0x0, 0xa, 0x70,
-    0x4f, 0x10, 0x0, 0x0, 0x2e, 0x80, 0xe, 0x30,
-    0x9b, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x4e, 0x0,
-    0x9a, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe7, 0x0,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x1e, 0x90, 0x0, 0x0, 0x0, 0x8e, 0x8f, 0x40,
-    0x4, 0xec, 0x52, 0x23, 0x7d, 0xd2, 0x7, 0xf3,
-    0x0, 0x18, 0xcf, 0xfe, 0xb6, 0x0, 0x0, 0x86,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x1f, 0x10, 0xf1, 0xf, 0x10, 0xf1, 0xf, 0x0,
-    0xf0, 0xd, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x6, 0xd0, 0x0, 0xe, 0x50, 0x0, 0x5e,
-    0x0, 0x0, 0xb8, 0x0, 0x0, 0xf3, 0x0, 0x4,
-    0xf0, 0x0, 0x8, 0xb0, 0x0, 0xb, 0x90, 0x0,
-    0xd, 0x60, 0x0, 0xf, 0x50, 0x0, 0xf, 0x40,
-    0x0, 0x1f, 0x30, 0x0, 0x1f, 0x30, 0x0, 0x1f,
-    0x30, 0x0, 0xf, 0x40, 0x0, 0xf, 0x50, 0x0,
-    0xd, 0x60, 0x0, 0xb, 0x90, 0x0, 0x8, 0xc0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0xf3, 0x0, 0x0,
-    0xb8, 0x0, 0x0, 0x5e, 0x0, 0x0, 0xe, 0x50,
-    0x0, 0x6, 0xd0,
-
-    /* U+0029 ")" */
-    0x7b, 0x0, 0x0, 0xf4, 0x0, 0x9, 0xb0, 0x0,
-    0x3f, 0x10, 0x0, 0xe6, 0x0, 0x9, 0xa0, 0x0,
-    0x6d, 0x0, 0x3, 0xf0, 0x0, 0x1f, 0x30, 0x0,
-    0xf4, 0x0, 0xe, 0x60, 0x0, 0xd6, 0x0, 0xd,
-    0x70, 0x0, 0xd6, 0x0, 0xe, 0x60, 0x0, 0xf4,
-    0x0, 0x1f, 0x30, 0x3, 0xf0, 0x0, 0x6d, 0x0,
-    0xa, 0xa0, 0x0, 0xe5, 0x0, 0x3f, 0x10, 0x9,
-    0xb0, 0x0, 0xf4, 0x0, 0x7b, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x0, 0x95,
-    0x0, 0x0, 0x2d, 0x30, 0x95, 0x6, 0xd0, 0x4,
-    0xda, 0xb8, 0xcb, 0x20, 0x0, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x7e, 0xdc, 0xd5, 0x0, 0x2d, 0xa1,
-    0x94, 0x3c, 0xb0, 0x3, 0x0, 0x95, 0x0, 0x30,
-    0x0, 0x0, 0x95, 0x0, 0x0, 0x0, 0x0, 0x32,
-    0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x2, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x2, 0x22, 0x25, 0xf2,
-    0x22, 0x22, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x3, 0x5, 0xf9, 0x4f, 0x90, 0xc5, 0xf, 0x4,
-    0xb0, 0x34, 0x0,
-
-    /* U+002D "-" */
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf4,
-    0x13, 0x33, 0x33, 0x30,
-
-    /* U+002E "." */
-    0x3, 0x6, 0xf9, 0x4f, 0x60,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd5,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x70, 0x0, 0x0, 0x0, 0x1, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x70, 0x0, 0x0, 0x0, 0x1, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x3a, 0xef, 0xeb, 0x40, 0x0, 0x0,
-    0x0, 0x8f, 0xa5, 0x45, 0xaf, 0xa0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x3e, 0xa0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x3f, 0x40, 0xa, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xac, 0x0, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf2, 0x4f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x67, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0x8c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xa8, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0x8c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc8, 0x4f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf2, 0xa, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x3f, 0x40,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x3e, 0x90, 0x0,
-    0x0, 0x8f, 0xb6, 0x45, 0xaf, 0xa0, 0x0, 0x0,
-    0x0, 0x3a, 0xef, 0xeb, 0x40, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xcf, 0xff, 0xff, 0x23, 0x33, 0x7f, 0x0, 0x0,
-    0x5f, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x5f, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x5f, 0x0, 0x0, 0x5f, 0x0, 0x0,
-    0x5f, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x5f, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x5f, 0x0, 0x0, 0x5f, 0x0, 0x0,
-    0x5f,
-
-    /* U+0032 "2" */
-    0x0, 0x6, 0xbe, 0xff, 0xd9, 0x20, 0x0, 0x5,
-    0xee, 0x85, 0x44, 0x7d, 0xf4, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0xaf, 0x10, 0x3, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xda, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0x33, 0x33, 0x33, 0x33, 0x32, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0033 "3" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x3,
-    0x33, 0x33, 0x33, 0x33, 0xae, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfe, 0xd9, 0x20, 0x0, 0x0,
-    0x0, 0x1, 0x23, 0x6b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf0, 0x13, 0x0, 0x0, 0x0, 0x0, 0xb, 0xc0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x7,
-    0xfe, 0x85, 0x44, 0x7c, 0xf6, 0x0, 0x0, 0x17,
-    0xbe, 0xff, 0xd9, 0x20, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf2, 0x0, 0x0, 0x6a, 0x0, 0x0,
-    0x0, 0x2f, 0x60, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x0, 0xda, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x5f, 0x20, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x23, 0x33, 0x33, 0x33, 0x33, 0x9d, 0x33, 0x31,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x4f, 0x33, 0x33, 0x33, 0x33, 0x10, 0x0, 0x6d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x33, 0x33, 0x34, 0x7b, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf5, 0x4, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-    0x2f, 0x91, 0x0, 0x0, 0x0, 0x3e, 0x90, 0x4,
-    0xdf, 0xa6, 0x44, 0x6a, 0xfa, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xeb, 0x40, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x17, 0xcf, 0xff, 0xd9, 0x20, 0x0,
-    0x5, 0xfd, 0x74, 0x34, 0x6c, 0x60, 0x0, 0x6f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8c, 0x0, 0x3a, 0xef, 0xfc, 0x70, 0x0, 0x8c,
-    0x9, 0xe8, 0x42, 0x37, 0xde, 0x30, 0x8c, 0x7c,
-    0x10, 0x0, 0x0, 0xa, 0xe1, 0x7e, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0xe7, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xab, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x8c, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xab, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x1, 0xf6,
-    0x0, 0xac, 0x10, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0xa, 0xe8, 0x43, 0x37, 0xdd, 0x20, 0x0, 0x0,
-    0x4b, 0xef, 0xfc, 0x70, 0x0,
-
-    /* U+0037 "7" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0x63, 0x33, 0x33, 0x33, 0x33, 0xdb, 0x1f, 0x30,
-    0x0, 0x0, 0x0, 0x2, 0xf4, 0x1f, 0x30, 0x0,
-    0x0, 0x0, 0x9, 0xd0, 0x1e, 0x20, 0x0, 0x0,
-    0x0, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xda, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x2, 0x9d, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x7, 0xfb, 0x53, 0x24, 0x8e, 0xc1, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x0, 0x1d, 0xb0, 0x0, 0xca,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x30, 0xf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x60, 0xd, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x6f, 0x20, 0x0,
-    0x0, 0x0, 0xbc, 0x0, 0x0, 0x9f, 0x72, 0x0,
-    0x15, 0xcd, 0x20, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x3, 0xec, 0x51, 0x0, 0x3,
-    0x9f, 0x70, 0x1, 0xe9, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x60, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0xa, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf1, 0xab, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x16, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9, 0xd0,
-    0xd, 0xb1, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x2d, 0xe8, 0x43, 0x24, 0x7c, 0xf6, 0x0, 0x0,
-    0x5, 0xbe, 0xff, 0xec, 0x81, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x2, 0x9d, 0xff, 0xd9, 0x20, 0x0, 0x0,
-    0x6, 0xfb, 0x53, 0x35, 0xaf, 0x60, 0x0, 0x3,
-    0xf6, 0x0, 0x0, 0x0, 0x4f, 0x50, 0x0, 0xca,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x2, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xc0, 0x1f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0xd9, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xf1, 0x6, 0xf4, 0x0, 0x0,
-    0x0, 0x2e, 0x5f, 0x30, 0x9, 0xf8, 0x20, 0x2,
-    0x7e, 0x61, 0xf3, 0x0, 0x5, 0xcf, 0xff, 0xfb,
-    0x30, 0x2f, 0x20, 0x0, 0x0, 0x2, 0x20, 0x0,
-    0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xbe, 0x10, 0x0,
-    0xb, 0xa5, 0x33, 0x59, 0xfc, 0x20, 0x0, 0x0,
-    0x4a, 0xdf, 0xfe, 0xb5, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x4f, 0x76, 0xf9, 0x3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0x6f, 0x94, 0xf6,
-
-    /* U+003B ";" */
-    0x4f, 0x76, 0xf9, 0x3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0x5f, 0x94, 0xf9, 0xc, 0x50, 0xf0,
-    0x4b, 0x3, 0x40,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xec, 0x0, 0x0, 0x0, 0x4b,
-    0xfa, 0x30, 0x0, 0x1, 0x7d, 0xd7, 0x10, 0x0,
-    0x3, 0xaf, 0xb4, 0x0, 0x0, 0x0, 0x1f, 0xb2,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xde, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xaf, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x8e, 0xd7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5a,
-
-    /* U+003D "=" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x2, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22,
-
-    /* U+003E ">" */
-    0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xd7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xec, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xce, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0xe7, 0x0, 0x0, 0x3, 0x9f, 0xc5, 0x0,
-    0x0, 0x6, 0xcf, 0x92, 0x0, 0x0, 0x8, 0xed,
-    0x60, 0x0, 0x0, 0x0, 0x1a, 0x30, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x17, 0xce, 0xff, 0xd8, 0x10, 0x0, 0x6f,
-    0xc7, 0x43, 0x47, 0xdf, 0x40, 0x4f, 0x50, 0x0,
-    0x0, 0x0, 0xbe, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x1, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xab, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x1, 0x6b, 0xdf, 0xff, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xfa, 0x52, 0x0, 0x2, 0x5a, 0xe9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9e, 0x30, 0x0, 0x0, 0x0, 0x6e,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0x40, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x20, 0x0, 0xd,
-    0x50, 0x0, 0x0, 0x6c, 0xff, 0xd8, 0x10, 0x5d,
-    0x0, 0x6c, 0x0, 0x6, 0xc0, 0x0, 0x1, 0xdc,
-    0x51, 0x2, 0x7e, 0x45, 0xd0, 0x0, 0xd4, 0x0,
-    0xd5, 0x0, 0x0, 0xd9, 0x0, 0x0, 0x0, 0x2d,
-    0x7d, 0x0, 0x6, 0xb0, 0x2f, 0x0, 0x0, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0xf,
-    0x5, 0xb0, 0x0, 0xe, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0x0, 0x0, 0xd3, 0x79, 0x0, 0x2,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xd0, 0x0,
-    0xa, 0x58, 0x80, 0x0, 0x4e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0x0, 0x0, 0x96, 0x88, 0x0,
-    0x4, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0,
-    0x0, 0x9, 0x67, 0x90, 0x0, 0x2f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0xa5, 0x5b,
-    0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xd0, 0x0, 0xc, 0x32, 0xf0, 0x0, 0x8, 0xd0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x1, 0xf0,
-    0xd, 0x50, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x3,
-    0xe7, 0xe0, 0x0, 0x7a, 0x0, 0x6c, 0x0, 0x0,
-    0x1d, 0xd6, 0x21, 0x39, 0xe4, 0x1f, 0x81, 0x6e,
-    0x20, 0x0, 0xd6, 0x0, 0x0, 0x6, 0xcf, 0xfd,
-    0x91, 0x0, 0x4d, 0xfc, 0x30, 0x0, 0x3, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xa5,
-    0x21, 0x1, 0x37, 0xc8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xbd, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xc7,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf5, 0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7d, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x70, 0x2, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0xb, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc9, 0x0, 0x0,
-    0x4f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x20,
-    0x0, 0x0, 0xd9, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xb0, 0x0, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x0,
-    0x2, 0xf4, 0x0, 0x0, 0x0, 0xe, 0x70, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x8e,
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x1, 0xf5, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xe9, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x5f, 0x30, 0x0, 0x5f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x80, 0xac, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0,
-
-    /* U+0042 "B" */
-    0xdf, 0xff, 0xff, 0xff, 0xfd, 0xa3, 0x0, 0xd,
-    0x92, 0x22, 0x22, 0x23, 0x5a, 0xf9, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xd0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0xd, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0xd8, 0x0, 0x0, 0x0,
-    0x2, 0x7f, 0x80, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x91, 0x0, 0xd9, 0x22, 0x22, 0x22, 0x23,
-    0x6b, 0xf6, 0xd, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xcd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x6d,
-    0x92, 0x22, 0x22, 0x22, 0x36, 0xbf, 0x80, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x1, 0x6b, 0xef, 0xfd, 0xa5, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x95, 0x44, 0x6a, 0xfd,
-    0x30, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0x10, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0x10, 0x0, 0x6, 0xfe, 0x96, 0x44, 0x6a, 0xfd,
-    0x20, 0x0, 0x0, 0x1, 0x6b, 0xef, 0xfd, 0xa4,
-    0x0, 0x0,
-
-    /* U+0044 "D" */
-    0xdf, 0xff, 0xff, 0xff, 0xfc, 0x93, 0x0, 0x0,
-    0x0, 0xd9, 0x33, 0x33, 0x33, 0x47, 0xcf, 0xb2,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xce, 0x30, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xe2, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcc, 0x0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x40, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xd0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf0, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xd0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xa0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x40, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xce, 0x30,
-    0x0, 0xd9, 0x33, 0x33, 0x33, 0x47, 0xbf, 0xb2,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x93,
-    0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x93,
-    0x33, 0x33, 0x33, 0x33, 0x31, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0xd9, 0x33, 0x33, 0x33, 0x33, 0x30, 0xd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x93,
-    0x33, 0x33, 0x33, 0x33, 0x32, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0,
-
-    /* U+0046 "F" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x93,
-    0x33, 0x33, 0x33, 0x33, 0x31, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xd,
-    0x93, 0x33, 0x33, 0x33, 0x33, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0x6, 0xee, 0x96, 0x44, 0x69, 0xee,
-    0x50, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x53, 0x8d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x76, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x2f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x70, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x70,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7,
-    0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x60, 0x0, 0x6, 0xef, 0x96, 0x44, 0x69, 0xee,
-    0x50, 0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe, 0xa6,
-    0x0, 0x0,
-
-    /* U+0048 "H" */
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd9, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x37, 0xfd, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf0,
-
-    /* U+0049 "I" */
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-    0xd8, 0xd8, 0xd8,
-
-    /* U+004A "J" */
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xc0, 0x1, 0x33,
-    0x33, 0x33, 0xac, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x9, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa0, 0x40, 0x0, 0x0, 0x0, 0xe8,
-    0xd, 0xb0, 0x0, 0x0, 0x6f, 0x20, 0x2d, 0xd7,
-    0x44, 0x9f, 0x80, 0x0, 0x7, 0xdf, 0xfc, 0x50,
-    0x0,
-
-    /* U+004B "K" */
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x10,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe2, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x2e, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x1, 0xee, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x1d, 0xb0, 0xbe, 0x10, 0x0, 0x0, 0x0,
-    0xd8, 0xcc, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0xdf, 0xd1, 0x0, 0x1, 0xea, 0x0, 0x0, 0x0,
-    0xdd, 0x10, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd1, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x90,
-
-    /* U+004C "L" */
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff,
-
-    /* U+004D "M" */
-    0xd9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xad, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0xdf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xad, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0xaa, 0xd7, 0x9c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x6a, 0xad,
-    0x71, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7, 0xd0,
-    0xaa, 0xd7, 0x7, 0xd0, 0x0, 0x0, 0x0, 0x1,
-    0xf4, 0xa, 0xad, 0x70, 0xe, 0x70, 0x0, 0x0,
-    0x0, 0x9b, 0x0, 0xaa, 0xd7, 0x0, 0x5e, 0x10,
-    0x0, 0x0, 0x2f, 0x20, 0xa, 0xad, 0x70, 0x0,
-    0xc9, 0x0, 0x0, 0xb, 0x90, 0x0, 0xaa, 0xd7,
-    0x0, 0x3, 0xf2, 0x0, 0x4, 0xf1, 0x0, 0xa,
-    0xad, 0x70, 0x0, 0xa, 0xa0, 0x0, 0xc7, 0x0,
-    0x0, 0xaa, 0xd7, 0x0, 0x0, 0x2f, 0x30, 0x5e,
-    0x0, 0x0, 0xa, 0xad, 0x70, 0x0, 0x0, 0x9c,
-    0xe, 0x60, 0x0, 0x0, 0xaa, 0xd7, 0x0, 0x0,
-    0x1, 0xeb, 0xd0, 0x0, 0x0, 0xa, 0xad, 0x70,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x9b,
-    0xd7, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x9, 0xbd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9b, 0xd7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xb0,
-
-    /* U+004E "N" */
-    0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xde,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x8b,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd8, 0x1e,
-    0xa0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x80, 0x4f,
-    0x60, 0x0, 0x0, 0x0, 0x5f, 0xd8, 0x0, 0x8f,
-    0x30, 0x0, 0x0, 0x5, 0xfd, 0x80, 0x0, 0xbd,
-    0x0, 0x0, 0x0, 0x5f, 0xd8, 0x0, 0x1, 0xea,
-    0x0, 0x0, 0x5, 0xfd, 0x80, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x5f, 0xd8, 0x0, 0x0, 0x7, 0xf3,
-    0x0, 0x5, 0xfd, 0x80, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0x5f, 0xd8, 0x0, 0x0, 0x0, 0x1e, 0xa0,
-    0x5, 0xfd, 0x80, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0x5f, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x35,
-    0xfd, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x6f,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xee, 0xfd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe9, 0x54, 0x46,
-    0xaf, 0xd4, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0,
-    0x0, 0x0, 0x1, 0x9f, 0x60, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x10, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x80, 0x2f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xe0, 0x6f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf2,
-    0x8d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf4, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf5, 0x8d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0x5f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf2,
-    0x2f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xe0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x80, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0x60, 0x0, 0x0, 0x0, 0x6e, 0xe9, 0x64, 0x46,
-    0xaf, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xfd, 0xa5, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xdf, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0, 0xd,
-    0x93, 0x33, 0x33, 0x46, 0xaf, 0xa0, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xb0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x50, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xab, 0xd, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9c, 0xd, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x70, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xd0, 0xd, 0x80, 0x0, 0x0, 0x2, 0x7e,
-    0xd2, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x70,
-    0x0, 0xd, 0x93, 0x33, 0x33, 0x20, 0x0, 0x0,
-    0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x95, 0x44,
-    0x6a, 0xfd, 0x40, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0x60, 0x0, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x10, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x2f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xe0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x8d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0x8, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x50, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf4, 0x5, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x2f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x50, 0x0,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0x60, 0x0, 0x0, 0x0, 0x6, 0xee, 0x96, 0x44,
-    0x6a, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6b, 0xef, 0xff, 0xa5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x0, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x30, 0x4, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xff, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20,
-    0x0, 0x0,
-
-    /* U+0052 "R" */
-    0xdf, 0xff, 0xff, 0xff, 0xda, 0x40, 0x0, 0xd,
-    0x93, 0x33, 0x33, 0x46, 0xaf, 0xb0, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xc0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xac, 0xd, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9c, 0xd, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x70, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xd0, 0xd, 0x80, 0x0, 0x0, 0x2, 0x7e,
-    0xd1, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xd, 0x93, 0x33, 0x33, 0x24, 0xf4, 0x0,
-    0x0, 0xd8, 0x0, 0x0, 0x0, 0x7, 0xe1, 0x0,
-    0xd, 0x80, 0x0, 0x0, 0x0, 0xb, 0xb0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x70, 0xd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x30, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x10,
-
-    /* U+0053 "S" */
-    0x0, 0x3, 0xad, 0xff, 0xeb, 0x71, 0x0, 0x0,
-    0x9f, 0xa5, 0x33, 0x48, 0xdf, 0x60, 0x7, 0xf3,
-    0x0, 0x0, 0x0, 0x4, 0x40, 0xe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xe9, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x6b, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x8e, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd7, 0x22, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x7e, 0x60, 0x0, 0x0, 0x0, 0x1c, 0xc0, 0x6,
-    0xfe, 0x85, 0x33, 0x58, 0xec, 0x10, 0x0, 0x6,
-    0xbe, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83,
-    0x33, 0x33, 0x37, 0xf3, 0x33, 0x33, 0x32, 0x0,
-    0x0, 0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x8b, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf5, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x11, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa0,
-    0x6, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xe1, 0x0,
-    0x6, 0xfd, 0x75, 0x45, 0x9f, 0xd2, 0x0, 0x0,
-    0x2, 0x8d, 0xff, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0xad, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd7, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf1, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xa0, 0x5, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x30, 0x0, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0x1f,
-    0x60, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0,
-    0xa, 0xc0, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x0, 0x0, 0xca, 0x0, 0x0, 0x0, 0xba,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x2,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x0,
-    0x9, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x0, 0x1f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf5, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x35, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xab, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x57, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x2f, 0x30, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9b,
-    0x0, 0xd9, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0xe, 0x60, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0xd, 0x70, 0xd7, 0x0, 0x0,
-    0x0, 0x4, 0xf1, 0x0, 0x2f, 0x30, 0x0, 0x0,
-    0x2, 0xf1, 0x8, 0xc0, 0x0, 0x0, 0x0, 0x9b,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0xe, 0x60, 0x0, 0x8,
-    0xd0, 0x0, 0x0, 0xd, 0x70, 0x0, 0xd6, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x2f, 0x20, 0x0,
-    0x2, 0xf1, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x9c,
-    0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0xe, 0x60, 0x0, 0x0,
-    0x8, 0xd0, 0x0, 0xd, 0x70, 0x0, 0x0, 0xe6,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0x20,
-    0x2, 0xf1, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0xe7, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0x3f, 0x10, 0xd, 0x70, 0x0, 0x0,
-    0x0, 0x8, 0xc0, 0xd, 0x70, 0x0, 0x0, 0x0,
-    0xe6, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x22, 0xf1, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe7, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x1d, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xcd, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xe9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0,
-
-    /* U+0058 "X" */
-    0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x0, 0xd, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd9,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x1e,
-    0x70, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0xb,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x6,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x60, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xa0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xe1, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0,
-    0x1, 0xe8, 0x0, 0x0, 0x0, 0xd, 0xa0, 0x0,
-    0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x20, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x0,
-
-    /* U+0059 "Y" */
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x1, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x30, 0x6, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xa0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0xe7, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
-    0x8d, 0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0,
-    0x2f, 0x40, 0x0, 0x0, 0x0, 0x7, 0xe1, 0x0,
-    0xa, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x4, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x30, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf7, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-
-    /* U+005B "[" */
-    0xdf, 0xff, 0x5d, 0x82, 0x20, 0xd7, 0x0, 0xd,
-    0x70, 0x0, 0xd7, 0x0, 0xd, 0x70, 0x0, 0xd7,
-    0x0, 0xd, 0x70, 0x0, 0xd7, 0x0, 0xd, 0x70,
-    0x0, 0xd7, 0x0, 0xd, 0x70, 0x0, 0xd7, 0x0,
-    0xd, 0x70, 0x0, 0xd7, 0x0, 0xd, 0x70, 0x0,
-    0xd7, 0x0, 0xd, 0x70, 0x0, 0xd7, 0x0, 0xd,
-    0x70, 0x0, 0xd7, 0x0, 0xd, 0x70, 0x0, 0xd7,
-    0x0, 0xd, 0x82, 0x20, 0xdf, 0xff, 0x50,
-
-    /* U+005C "\\" */
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x30, 0x0, 0x0, 0x0, 0xa,
-    0x80, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x40, 0x0, 0x0, 0x0, 0x9, 0x90,
-    0x0, 0x0, 0x0, 0x4, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x50, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x60, 0x0, 0x0, 0x0, 0x7, 0xb0, 0x0, 0x0,
-    0x0, 0x2, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xc6,
-    0x0, 0x0, 0x0, 0x0, 0x7c,
-
-    /* U+005D "]" */
-    0x6f, 0xff, 0xc0, 0x22, 0x9c, 0x0, 0x8, 0xc0,
-    0x0, 0x8c, 0x0, 0x8, 0xc0, 0x0, 0x8c, 0x0,
-    0x8, 0xc0, 0x0, 0x8c, 0x0, 0x8, 0xc0, 0x0,
-    0x8c, 0x0, 0x8, 0xc0, 0x0, 0x8c, 0x0, 0x8,
-    0xc0, 0x0, 0x8c, 0x0, 0x8, 0xc0, 0x0, 0x8c,
-    0x0, 0x8, 0xc0, 0x0, 0x8c, 0x0, 0x8, 0xc0,
-    0x0, 0x8c, 0x0, 0x8, 0xc0, 0x0, 0x8c, 0x0,
-    0x8, 0xc1, 0x22, 0x9c, 0x6f, 0xff, 0xc0,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0xc,
-    0xba, 0x0, 0x0, 0x0, 0x2, 0xe1, 0xe1, 0x0,
-    0x0, 0x0, 0x97, 0xa, 0x70, 0x0, 0x0, 0xe,
-    0x10, 0x3d, 0x0, 0x0, 0x6, 0xa0, 0x0, 0xd4,
-    0x0, 0x0, 0xd4, 0x0, 0x7, 0xa0, 0x0, 0x3d,
-    0x0, 0x0, 0x1f, 0x10, 0xa, 0x70, 0x0, 0x0,
-    0xa7, 0x1, 0xf1, 0x0, 0x0, 0x3, 0xe0, 0x7a,
-    0x0, 0x0, 0x0, 0xd, 0x40,
-
-    /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0060 "`" */
-    0x8, 0xf5, 0x0, 0x0, 0x4, 0xe7, 0x0, 0x0,
-    0x1, 0xba, 0x0,
-
-    /* U+0061 "a" */
-    0x0, 0x28, 0xcf, 0xfe, 0xa3, 0x0, 0x8, 0xfb,
-    0x63, 0x35, 0xaf, 0x60, 0x9, 0x30, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0x4a, 0xde, 0xee,
-    0xee, 0xf9, 0x8, 0xe7, 0x31, 0x11, 0x11, 0xc9,
-    0x2f, 0x40, 0x0, 0x0, 0x0, 0xb9, 0x6e, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x6e, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x2f, 0x40, 0x0, 0x0, 0xb, 0xe9,
-    0x8, 0xe6, 0x10, 0x15, 0xc7, 0xb9, 0x0, 0x5b,
-    0xff, 0xeb, 0x40, 0xb9,
-
-    /* U+0062 "b" */
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x10, 0x3a,
-    0xef, 0xeb, 0x50, 0x0, 0x4, 0xf1, 0x8f, 0x84,
-    0x34, 0x8f, 0xc1, 0x0, 0x4f, 0x8d, 0x10, 0x0,
-    0x0, 0x1d, 0xc0, 0x4, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x1f, 0x70, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf2, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x44, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x4f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x24, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x4,
-    0xf7, 0xd1, 0x0, 0x0, 0x2, 0xdc, 0x0, 0x4f,
-    0x8, 0xf9, 0x43, 0x49, 0xfc, 0x10, 0x4, 0xf0,
-    0x3, 0xae, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x1, 0x8d, 0xff, 0xd9, 0x20, 0x0, 0x4,
-    0xfc, 0x63, 0x35, 0xbf, 0x60, 0x4, 0xf8, 0x0,
-    0x0, 0x0, 0x5f, 0x10, 0xd9, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x90, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x6, 0xf1, 0x0, 0x4e,
-    0xd7, 0x43, 0x6b, 0xf6, 0x0, 0x0, 0x18, 0xdf,
-    0xfd, 0x92, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7d, 0x0, 0x1, 0x8d, 0xff, 0xd7, 0x10,
-    0x7d, 0x0, 0x5f, 0xc6, 0x33, 0x6b, 0xe3, 0x7d,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x6e, 0x9d, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x5f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xad, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xad, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xed,
-    0xd, 0xa0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x6e, 0x8d, 0x0, 0x5f,
-    0xc6, 0x33, 0x6c, 0xe3, 0x7d, 0x0, 0x1, 0x8d,
-    0xff, 0xd8, 0x10, 0x7d,
-
-    /* U+0065 "e" */
-    0x0, 0x2, 0x9d, 0xff, 0xc7, 0x0, 0x0, 0x0,
-    0x6f, 0xb5, 0x33, 0x7d, 0xd2, 0x0, 0x4, 0xf5,
-    0x0, 0x0, 0x0, 0xae, 0x10, 0xe, 0x70, 0x0,
-    0x0, 0x0, 0xd, 0x80, 0x5e, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xe0, 0x9a, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x0, 0x2d, 0x20, 0x0, 0x4e, 0xd7, 0x43,
-    0x59, 0xf9, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xea,
-    0x30, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x5d, 0xfe, 0xa2, 0x0, 0x5, 0xf7,
-    0x23, 0x92, 0x0, 0xc, 0x90, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xa0, 0x12, 0x2f, 0x62, 0x22, 0x10,
-    0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0xf,
-    0x50, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0,
-    0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x2, 0x9d, 0xff, 0xd9, 0x20, 0x4f, 0x0,
-    0x6f, 0xa4, 0x11, 0x38, 0xe5, 0x4f, 0x5, 0xf5,
-    0x0, 0x0, 0x0, 0x2d, 0x8f, 0x1f, 0x70, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x6e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xaa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x1f,
-    0x60, 0x0, 0x0, 0x0, 0x2, 0xff, 0x7, 0xf4,
-    0x0, 0x0, 0x0, 0x1d, 0xbf, 0x0, 0x9f, 0x93,
-    0x0, 0x27, 0xe8, 0x5f, 0x0, 0x4, 0xbf, 0xff,
-    0xfb, 0x40, 0x5f, 0x0, 0x0, 0x0, 0x22, 0x0,
-    0x0, 0x6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7,
-    0x9, 0xb2, 0x0, 0x0, 0x0, 0xa, 0xe1, 0x2,
-    0xcf, 0xa6, 0x33, 0x47, 0xde, 0x30, 0x0, 0x4,
-    0x9d, 0xff, 0xfc, 0x81, 0x0,
-
-    /* U+0068 "h" */
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x10, 0x6c, 0xff, 0xea, 0x30, 0x4, 0xf1, 0xbd,
-    0x63, 0x35, 0xbf, 0x60, 0x4f, 0xb9, 0x0, 0x0,
-    0x0, 0x8f, 0x24, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xd8, 0x4f, 0x60, 0x0, 0x0, 0x0, 0x8, 0xc4,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x4f, 0x10,
-    0x0, 0x0, 0x0, 0x6, 0xe4, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0x4f, 0x10, 0x0, 0x0, 0x0,
-    0x6, 0xe4, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0x6, 0xe4, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0x4f, 0x10, 0x0,
-    0x0, 0x0, 0x6, 0xe4, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x6e,
-
-    /* U+0069 "i" */
-    0x6f, 0x48, 0xf5, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x14, 0xf1, 0x4f, 0x14, 0xf1, 0x4f,
-    0x14, 0xf1, 0x4f, 0x14, 0xf1, 0x4f, 0x14, 0xf1,
-    0x4f, 0x14, 0xf1, 0x4f, 0x14, 0xf1,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x6, 0xf0, 0xa, 0x42, 0x5e, 0x80,
-    0x9, 0xef, 0xe8, 0x0,
-
-    /* U+006B "k" */
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0xbc, 0x14, 0xf1, 0x0,
-    0x0, 0x1, 0xcc, 0x10, 0x4f, 0x10, 0x0, 0x1,
-    0xdc, 0x0, 0x4, 0xf1, 0x0, 0x1, 0xdb, 0x0,
-    0x0, 0x4f, 0x10, 0x2, 0xeb, 0x0, 0x0, 0x4,
-    0xf1, 0x3, 0xec, 0x0, 0x0, 0x0, 0x4f, 0x13,
-    0xfc, 0xf3, 0x0, 0x0, 0x4, 0xf5, 0xf8, 0xa,
-    0xe1, 0x0, 0x0, 0x4f, 0xf7, 0x0, 0xd, 0xb0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x5f, 0x40, 0x4, 0xf1,
-    0x0, 0x0, 0x0, 0x9e, 0x10, 0x4f, 0x10, 0x0,
-    0x0, 0x0, 0xcc, 0x4, 0xf1, 0x0, 0x0, 0x0,
-    0x1, 0xe9,
-
-    /* U+006C "l" */
-    0x4f, 0x14, 0xf1, 0x4f, 0x14, 0xf1, 0x4f, 0x14,
-    0xf1, 0x4f, 0x14, 0xf1, 0x4f, 0x14, 0xf1, 0x4f,
-    0x14, 0xf1, 0x4f, 0x14, 0xf1, 0x4f, 0x14, 0xf1,
-    0x4f, 0x14, 0xf1, 0x4f, 0x14, 0xf1,
-
-    /* U+006D "m" */
-    0x4f, 0x0, 0x6c, 0xff, 0xe9, 0x10, 0x0, 0x3a,
-    0xef, 0xfb, 0x50, 0x0, 0x4f, 0x1c, 0xb4, 0x11,
-    0x4c, 0xe3, 0x7, 0xe7, 0x21, 0x27, 0xf9, 0x0,
-    0x4f, 0xb7, 0x0, 0x0, 0x0, 0xbd, 0x6d, 0x10,
-    0x0, 0x0, 0x3f, 0x40, 0x4f, 0xc0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0xa, 0xb0,
-    0x4f, 0x50, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0,
-    0x0, 0x0, 0x5, 0xf0, 0x4f, 0x20, 0x0, 0x0,
-    0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xf0,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x3, 0xf1, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x3, 0xf1, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x3, 0xf1, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x3, 0xf1, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x3, 0xf1,
-
-    /* U+006E "n" */
-    0x4f, 0x0, 0x6c, 0xff, 0xea, 0x30, 0x4, 0xf0,
-    0xcc, 0x52, 0x13, 0x9f, 0x60, 0x4f, 0xa8, 0x0,
-    0x0, 0x0, 0x6f, 0x24, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xd8, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x8,
-    0xc4, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0x6, 0xe4, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0x6, 0xe4, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0x4f, 0x10, 0x0, 0x0, 0x0, 0x6, 0xe4,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x4f, 0x10,
-    0x0, 0x0, 0x0, 0x6, 0xe4, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x6e,
-
-    /* U+006F "o" */
-    0x0, 0x1, 0x8d, 0xff, 0xd9, 0x20, 0x0, 0x0,
-    0x4f, 0xc6, 0x33, 0x6b, 0xf6, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x0, 0x6f, 0x50, 0xd, 0x90, 0x0,
-    0x0, 0x0, 0x7, 0xf1, 0x5f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xe7, 0x9c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xab, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8d, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d,
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xab, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xd, 0xa0,
-    0x0, 0x0, 0x0, 0x7, 0xf1, 0x3, 0xf8, 0x0,
-    0x0, 0x0, 0x6f, 0x50, 0x0, 0x4f, 0xc6, 0x33,
-    0x6c, 0xf6, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xd9,
-    0x20, 0x0,
-
-    /* U+0070 "p" */
-    0x4f, 0x0, 0x3a, 0xef, 0xeb, 0x50, 0x0, 0x4,
-    0xf0, 0x8f, 0x84, 0x34, 0x8f, 0xc1, 0x0, 0x4f,
-    0x7d, 0x10, 0x0, 0x0, 0x1d, 0xc0, 0x4, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x8e, 0x4, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf2, 0x4f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x44, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x4f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x24, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xe0, 0x4f, 0xe1, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x4, 0xf8, 0xd1, 0x0, 0x0, 0x2,
-    0xdc, 0x0, 0x4f, 0x18, 0xf9, 0x43, 0x49, 0xfc,
-    0x10, 0x4, 0xf1, 0x3, 0xae, 0xfe, 0xb5, 0x0,
-    0x0, 0x4f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x1, 0x8d, 0xff, 0xd8, 0x10, 0x7d, 0x0,
-    0x5f, 0xc6, 0x33, 0x6b, 0xe3, 0x7d, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x6e, 0x8d, 0xe, 0x90, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0x5f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xed, 0x9c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xad, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8d, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d,
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x5f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xed, 0xd, 0xa0,
-    0x0, 0x0, 0x0, 0x8, 0xfd, 0x4, 0xf8, 0x0,
-    0x0, 0x0, 0x6e, 0x9d, 0x0, 0x5f, 0xc6, 0x33,
-    0x6c, 0xe3, 0x7d, 0x0, 0x1, 0x8d, 0xff, 0xd7,
-    0x10, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d,
-
-    /* U+0072 "r" */
-    0x4f, 0x0, 0x7c, 0xf2, 0x4f, 0x1d, 0xb5, 0x30,
-    0x4f, 0xa7, 0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x4f, 0x50, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x7, 0xcf, 0xfe, 0xb7, 0x10, 0x0, 0xcd,
-    0x63, 0x24, 0x7d, 0xd0, 0x7, 0xe1, 0x0, 0x0,
-    0x0, 0x20, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xfc, 0x85,
-    0x10, 0x0, 0x0, 0x0, 0x47, 0xae, 0xfb, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc8, 0x8, 0x10, 0x0, 0x0, 0x2, 0xf4,
-    0x1c, 0xfa, 0x53, 0x24, 0x7e, 0xa0, 0x0, 0x4a,
-    0xdf, 0xfe, 0xb5, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xa0, 0x12, 0x2f, 0x62, 0x22,
-    0x10, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0xf,
-    0x50, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0,
-    0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0xc,
-    0x90, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x23, 0x93,
-    0x0, 0x0, 0x6d, 0xfe, 0xa1,
-
-    /* U+0075 "u" */
-    0x6e, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa6, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xaa, 0x6e, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xa6, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xaa, 0x6e, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa6, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xaa, 0x6e,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa6, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xaa, 0x6e, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xa4, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0xae, 0x20, 0x0, 0x0, 0x3e, 0xba, 0x1, 0xcf,
-    0x84, 0x35, 0xaf, 0x49, 0xa0, 0x0, 0x7c, 0xff,
-    0xe9, 0x20, 0x9a,
-
-    /* U+0076 "v" */
-    0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0x5, 0xf0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0xc, 0x80, 0x6, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0xe6, 0x0, 0x0,
-    0x0, 0xab, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x1,
-    0xf3, 0x0, 0x0, 0x1f, 0x40, 0x0, 0x8, 0xc0,
-    0x0, 0x0, 0xa, 0xb0, 0x0, 0xe, 0x50, 0x0,
-    0x0, 0x3, 0xf2, 0x0, 0x6e, 0x0, 0x0, 0x0,
-    0x0, 0xc8, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x4, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x6b, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x8b, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x2, 0xf1, 0x0, 0x0, 0x0,
-    0xe, 0xf5, 0x0, 0x0, 0x0, 0x9, 0x90, 0xd,
-    0x60, 0x0, 0x0, 0x4, 0xe9, 0xb0, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x7c, 0x0, 0x0, 0x0, 0xa9,
-    0x2f, 0x10, 0x0, 0x0, 0x5d, 0x0, 0x1, 0xf2,
-    0x0, 0x0, 0xf, 0x30, 0xc7, 0x0, 0x0, 0xb,
-    0x80, 0x0, 0xb, 0x80, 0x0, 0x6, 0xd0, 0x6,
-    0xd0, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0xc7, 0x0, 0x1f, 0x20, 0x0, 0x6c, 0x0,
-    0x0, 0x0, 0xf3, 0x0, 0x2f, 0x10, 0x0, 0xa8,
-    0x0, 0xc, 0x60, 0x0, 0x0, 0x9, 0x90, 0x7,
-    0xb0, 0x0, 0x4, 0xe0, 0x2, 0xf0, 0x0, 0x0,
-    0x0, 0x4e, 0x0, 0xd5, 0x0, 0x0, 0xe, 0x40,
-    0x8a, 0x0, 0x0, 0x0, 0x0, 0xd4, 0x3e, 0x0,
-    0x0, 0x0, 0x8a, 0xe, 0x40, 0x0, 0x0, 0x0,
-    0x8, 0xa9, 0x80, 0x0, 0x0, 0x2, 0xf5, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0xc, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x0,
-
-    /* U+0078 "x" */
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x4f, 0x30, 0x1e,
-    0x70, 0x0, 0x0, 0x1e, 0x60, 0x0, 0x3f, 0x30,
-    0x0, 0xc, 0xa0, 0x0, 0x0, 0x7e, 0x10, 0x8,
-    0xd0, 0x0, 0x0, 0x0, 0xbb, 0x4, 0xf3, 0x0,
-    0x0, 0x0, 0x1, 0xe9, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x3b,
-    0xc0, 0x0, 0x0, 0x0, 0x2e, 0x70, 0x1e, 0x80,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0x3f, 0x40, 0x0,
-    0x8, 0xe1, 0x0, 0x0, 0x7e, 0x10, 0x4, 0xf3,
-    0x0, 0x0, 0x0, 0xbc, 0x1, 0xe7, 0x0, 0x0,
-    0x0, 0x1, 0xe8,
-
-    /* U+0079 "y" */
-    0xb, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x70,
-    0x4f, 0x20, 0x0, 0x0, 0x0, 0x5, 0xf0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0xc8, 0x0, 0x5,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0xe,
-    0x60, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x7d,
-    0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x1, 0xf4,
-    0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0xe, 0x50, 0x0, 0x0, 0x0, 0x2f, 0x20,
-    0x6, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1, 0x4e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x7b, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x7,
-    0xc4, 0x36, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xef, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x22, 0x22,
-    0x22, 0x25, 0xf5, 0x0, 0x0, 0x0, 0x1, 0xd9,
-    0x0, 0x0, 0x0, 0x0, 0xac, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0xa, 0xc0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xd9, 0x0, 0x0, 0x0, 0x0, 0xac, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x42, 0x22, 0x22, 0x22, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+007B "{" */
-    0x0, 0x3, 0xcf, 0xb0, 0x0, 0xeb, 0x31, 0x0,
-    0x4f, 0x10, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x5f, 0x0,
-    0x0, 0x5, 0xf0, 0x0, 0x0, 0x5f, 0x0, 0x0,
-    0x5, 0xf0, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x8,
-    0xe0, 0x0, 0x6f, 0xf5, 0x0, 0x1, 0x2a, 0xd0,
-    0x0, 0x0, 0x5f, 0x0, 0x0, 0x5, 0xf0, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0,
-    0x5f, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x4f, 0x10,
-    0x0, 0x0, 0xeb, 0x31, 0x0, 0x3, 0xcf, 0xb0,
-
-    /* U+007C "|" */
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
-    0xd6,
-
-    /* U+007D "}" */
-    0x6f, 0xd7, 0x0, 0x0, 0x27, 0xf4, 0x0, 0x0,
-    0xc, 0x90, 0x0, 0x0, 0xaa, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0x0, 0xaa, 0x0, 0x0, 0xa, 0xa0,
-    0x0, 0x0, 0xaa, 0x0, 0x0, 0xa, 0xa0, 0x0,
-    0x0, 0xaa, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0,
-    0x8d, 0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x7e,
-    0x31, 0x0, 0xa, 0xa0, 0x0, 0x0, 0xaa, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0x0, 0xaa, 0x0, 0x0,
-    0xa, 0xa0, 0x0, 0x0, 0xaa, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0x0, 0xaa, 0x0, 0x0, 0xc, 0x90,
-    0x1, 0x27, 0xf4, 0x0, 0x6f, 0xd6, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x9e, 0xd5, 0x0, 0x0, 0xd, 0x10, 0xaa,
-    0x24, 0xe7, 0x0, 0x1, 0xe0, 0x1e, 0x0, 0x1,
-    0xd9, 0x0, 0xa8, 0x4, 0xa0, 0x0, 0x1, 0xbf,
-    0xfb, 0x0, 0x1, 0x0, 0x0, 0x0, 0x11, 0x0,
-    0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x3, 0xe2, 0x0, 0xc6, 0x0, 0x1e, 0x50,
-    0x9, 0xa0, 0x0, 0xb9, 0x0, 0x5d, 0x10, 0x7,
-    0xc0, 0x2, 0xe3, 0x0, 0x3e, 0x20, 0xd, 0x60,
-    0x0, 0x4e, 0x20, 0xd, 0x60, 0x0, 0x7, 0xc0,
-    0x2, 0xe3, 0x0, 0x0, 0xb9, 0x0, 0x6d, 0x0,
-    0x0, 0x1e, 0x50, 0xa, 0xa0, 0x0, 0x3, 0xe2,
-    0x0, 0xd6,
-
-    /* U+00BB "»" */
-    0x9a, 0x0, 0x3e, 0x10, 0x0, 0xc, 0x70, 0x7,
-    0xc0, 0x0, 0x2, 0xe3, 0x0, 0xb8, 0x0, 0x0,
-    0x5e, 0x10, 0x1e, 0x40, 0x0, 0x9, 0xb0, 0x3,
-    0xe2, 0x0, 0x8, 0xb0, 0x3, 0xe2, 0x0, 0x4e,
-    0x10, 0x1e, 0x50, 0x2, 0xe3, 0x0, 0xb8, 0x0,
-    0xc, 0x70, 0x7, 0xc0, 0x0, 0x9b, 0x0, 0x3e,
-    0x10, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x28, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbb,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x1b, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xb, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd,
-
-    /* U+0401 "Ё" */
-    0x0, 0x8, 0xc0, 0x2, 0xd5, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7b, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x31, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0xbb, 0x33, 0x33, 0x33, 0x33,
-    0x30, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x32, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-
-    /* U+0402 "Ђ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x2, 0x33, 0x33, 0x35, 0xf5, 0x33,
-    0x33, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x13,
-    0x55, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x58, 0xdf, 0xfe, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xb6, 0x20, 0x0, 0x17, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xd0, 0x0, 0x0,
-    0x0, 0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf1, 0x0, 0x0, 0x0, 0x2f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x0,
-    0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xa, 0xc0,
-    0x0, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x0, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xf2, 0x0,
-    0x4, 0x32, 0x39, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0xcf, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x3, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xbb, 0x33, 0x33, 0x33,
-    0x33, 0x32, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x1, 0x7c, 0xef, 0xfd, 0x94, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x95, 0x44, 0x6a, 0xfd,
-    0x30, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x1,
-    0xaf, 0x10, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x4f, 0x32, 0x22,
-    0x22, 0x22, 0x22, 0x0, 0x0, 0x2, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0x10, 0x0, 0x6, 0xee, 0x95, 0x44, 0x7b, 0xfc,
-    0x20, 0x0, 0x0, 0x1, 0x7c, 0xef, 0xfd, 0x94,
-    0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x2, 0x9d, 0xff, 0xec, 0x82, 0x0, 0x0,
-    0x7f, 0xb6, 0x33, 0x47, 0xcf, 0x80, 0x5, 0xf5,
-    0x0, 0x0, 0x0, 0x3, 0x60, 0xc, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xfa, 0x51, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6b, 0xff, 0xc8, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x8d, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x5,
-    0xee, 0x95, 0x33, 0x48, 0xee, 0x20, 0x0, 0x5,
-    0xad, 0xff, 0xeb, 0x70, 0x0,
-
-    /* U+0406 "І" */
-    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
-    0xb9, 0xb9, 0xb9,
-
-    /* U+0407 "Ї" */
-    0x2d, 0x40, 0x9, 0xb0, 0x3f, 0x50, 0xa, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x0, 0xd, 0x80, 0x0,
-    0x0, 0xd, 0x80, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0x60, 0x2, 0x33,
-    0x33, 0x33, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0xe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xe, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x50, 0x40, 0x0, 0x0, 0x3, 0xf2,
-    0x2f, 0x60, 0x0, 0x0, 0xbd, 0x0, 0x6f, 0xb5,
-    0x35, 0xcf, 0x30, 0x0, 0x2a, 0xef, 0xea, 0x20,
-    0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x73, 0x33, 0x33, 0x33, 0x38, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x30, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x30,
-    0x0, 0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x20, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0,
-    0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x10, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0,
-    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x22, 0x22, 0x23, 0x59, 0xfc, 0x10, 0x0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xb0, 0x0, 0x0,
-    0x4e, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x6d,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x8b, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc9, 0x0, 0x0, 0xa9, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc9, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x35,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5,
-    0x55, 0x55, 0x55, 0x7c, 0xfa, 0x0, 0xaf, 0xd5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0x40, 0x0,
-
-    /* U+040A "Њ" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8,
-    0x10, 0xb, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0xcc, 0x33, 0x33, 0x33, 0x48, 0xef, 0x40, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x1b, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xbb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9c, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xab, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf6,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xbd, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0x22, 0x22, 0x22,
-    0x37, 0xed, 0x20, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0,
-    0x0,
-
-    /* U+040B "Ћ" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x33, 0x33, 0x33, 0x7f, 0x43, 0x33,
-    0x33, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x3, 0x8c, 0xef, 0xfd,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xdf, 0xb7,
-    0x43, 0x47, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x4f,
-    0x60, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0x0, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0x0, 0x0, 0x0, 0x4f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x0, 0x4f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x1, 0x75, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xda, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xa0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xd0, 0xb, 0x90, 0x0, 0x0,
-    0x0, 0x4, 0xf3, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x1, 0xe6, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0xcb, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x7e,
-    0x10, 0x0, 0xb, 0x90, 0x0, 0x0, 0x3f, 0x30,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x1e, 0x70, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0xa, 0xb0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xb, 0xb3, 0x33, 0x3c, 0xc0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x1e, 0x90, 0x0, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x3f, 0x60, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0xae, 0x10, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x2, 0xe8, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf4, 0xb, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xd9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe3, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x42, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x9e, 0x10, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x2e, 0x80, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x8, 0xe1, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x1, 0xe8, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x8e, 0x20, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x44, 0x0, 0x0, 0x4, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0xc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x91, 0x1, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d, 0xdc,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x9, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x40, 0x1,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf3,
-    0x0, 0x0, 0x1f, 0x50, 0x0, 0x0, 0x0, 0xa,
-    0xb0, 0x0, 0x0, 0x8, 0xd0, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0,
-    0x0, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x8d, 0x0,
-    0x0, 0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x60, 0x0, 0xa, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xd0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe6, 0x0, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x3, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x6b, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35,
-    0x47, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xfd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xab,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaa, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xab, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaa, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xab, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaa, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xab, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaa, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xab, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xab, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaa, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xab, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaa, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xab, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaa,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xab,
-    0xb3, 0x33, 0x33, 0x33, 0x33, 0x33, 0xba, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x2, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x80, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaa, 0xa, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x30, 0x3f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xc0, 0x0, 0xc9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf5, 0x0, 0x5, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0xd, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0x70,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xc9, 0x0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x2f,
-    0x40, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xbb, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x8d, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x2d, 0x90, 0x0, 0xe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x10,
-    0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe7, 0x0, 0xd9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xe0, 0x4f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x50,
-
-    /* U+0411 "Б" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xb,
-    0xb3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xfd, 0xa4, 0x0, 0xb, 0xa2, 0x22, 0x22, 0x23,
-    0x5a, 0xfa, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf9, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x3b, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x3b, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0xb,
-    0xa2, 0x22, 0x22, 0x23, 0x5a, 0xf9, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+0412 "В" */
-    0xbf, 0xff, 0xff, 0xff, 0xfd, 0x82, 0x0, 0xb,
-    0xa2, 0x22, 0x22, 0x23, 0x6c, 0xf5, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x70, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xba, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xa0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe7, 0xb, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x10, 0xb9, 0x0, 0x0, 0x0,
-    0x3, 0x9e, 0x40, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x50, 0x0, 0xba, 0x22, 0x22, 0x22, 0x23,
-    0x6c, 0xd2, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xe0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x6b, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc9, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x9b, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x1b,
-    0xa2, 0x22, 0x22, 0x22, 0x36, 0xcf, 0x40, 0xbf,
-    0xff, 0xff, 0xff, 0xfe, 0xc8, 0x10, 0x0,
-
-    /* U+0413 "Г" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbb, 0x33,
-    0x33, 0x33, 0x33, 0x32, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x3f, 0x43, 0x33, 0x33,
-    0x33, 0x3b, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0,
-    0x0, 0x0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0x0, 0x0, 0x5e, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x5d, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0,
-    0x6d, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0,
-    0xa8, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0,
-    0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x8,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0,
-    0x0, 0x1e, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0x24, 0xcd, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x3b, 0xb3, 0x31, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc7,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc7, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc7, 0xb8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x54, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x63,
-
-    /* U+0415 "Е" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xb3,
-    0x33, 0x33, 0x33, 0x33, 0x31, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0xbb, 0x33, 0x33, 0x33, 0x33, 0x30, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb3,
-    0x33, 0x33, 0x33, 0x33, 0x32, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0,
-
-    /* U+0416 "Ж" */
-    0x7, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0xda, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0xbb, 0x0, 0x0, 0x3f, 0x40, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x5, 0xf2, 0x0, 0x0,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x1e, 0x70, 0x0, 0x0, 0x0, 0xe8, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xb0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0xd,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0x10, 0x0, 0xb9, 0x0,
-    0x2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x43, 0x33,
-    0xca, 0x33, 0x35, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0xd, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x3,
-    0xf5, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x7f, 0x20, 0x0, 0x0, 0xd, 0xa0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0,
-    0x0, 0x9e, 0x10, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x30, 0x1e, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-
-    /* U+0417 "З" */
-    0x0, 0x6, 0xad, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x7f, 0xe9, 0x64, 0x45, 0x9f, 0xc1, 0x0, 0x9,
-    0x50, 0x0, 0x0, 0x0, 0x2d, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x9e, 0x30, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x22, 0x22, 0x35,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf1,
-    0xab, 0x20, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x1,
-    0xaf, 0xc7, 0x53, 0x34, 0x6b, 0xf9, 0x0, 0x0,
-    0x28, 0xbe, 0xff, 0xec, 0x92, 0x0, 0x0,
-
-    /* U+0418 "И" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe3, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x42, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x9e, 0x10, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x2e, 0x80, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x8, 0xe1, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x1, 0xe8, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x8e, 0x20, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-
-    /* U+0419 "Й" */
-    0x0, 0x2, 0x50, 0x0, 0x0, 0x35, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0x0, 0xba, 0x10, 0x7, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xcd, 0xd9, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe3, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x42, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x9e, 0x10, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0x2e, 0x80, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x8, 0xe1, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x1, 0xe8, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xb9, 0x8e, 0x20, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-
-    /* U+041A "К" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x30, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x1e, 0x60, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x7, 0xe1, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0xb, 0x90, 0x0, 0x1,
-    0xe7, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0xab,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xbb, 0x33, 0x33, 0xcc, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x1, 0xe9, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x6, 0xf3, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0xa, 0xe1, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0xd, 0xb0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x80, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x20,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0x73, 0x33, 0x33, 0x33,
-    0x37, 0xf0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0xf, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0xf, 0x30,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x1f,
-    0x20, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0,
-    0x1f, 0x10, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0x4, 0xf0,
-    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x6d, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x8b, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf0, 0x35, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf0, 0xaf, 0xd5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0,
-
-    /* U+041C "М" */
-    0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xcb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0xbf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xcb, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x9c, 0xb9, 0x7d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x78, 0xcb,
-    0x90, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe0,
-    0x8c, 0xb9, 0x5, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xe6, 0x8, 0xcb, 0x90, 0xc, 0x80, 0x0, 0x0,
-    0x0, 0x7d, 0x0, 0x8c, 0xb9, 0x0, 0x3f, 0x20,
-    0x0, 0x0, 0x1f, 0x40, 0x8, 0xcb, 0x90, 0x0,
-    0xba, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x8c, 0xb9,
-    0x0, 0x2, 0xf3, 0x0, 0x2, 0xf2, 0x0, 0x8,
-    0xcb, 0x90, 0x0, 0x9, 0xc0, 0x0, 0xb9, 0x0,
-    0x0, 0x8c, 0xb9, 0x0, 0x0, 0x1f, 0x50, 0x3f,
-    0x10, 0x0, 0x8, 0xcb, 0x90, 0x0, 0x0, 0x7d,
-    0xc, 0x70, 0x0, 0x0, 0x8c, 0xb9, 0x0, 0x0,
-    0x0, 0xeb, 0xe0, 0x0, 0x0, 0x8, 0xcb, 0x90,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x8c,
-    0xb9, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x8, 0xcb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8c, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xc0,
-
-    /* U+041D "Н" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbb, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfa, 0x64, 0x45,
-    0x9e, 0xe6, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x10,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x30, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0xe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x3f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5,
-    0x5f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe7, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd8, 0x5f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe7, 0x3f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5,
-    0xe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf1, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0,
-    0x0, 0x7, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x8f,
-    0x90, 0x0, 0x0, 0x0, 0x4d, 0xfa, 0x64, 0x46,
-    0x9e, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xdf, 0xfe, 0xb6, 0x0, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xbb, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-
-    /* U+0420 "Р" */
-    0xbf, 0xff, 0xff, 0xff, 0xda, 0x40, 0x0, 0xb,
-    0xb3, 0x33, 0x33, 0x46, 0xaf, 0xb1, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xc0, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x70, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8d, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x2b, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf1, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x90, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xe1, 0xb, 0x90, 0x0, 0x0, 0x2, 0x6d,
-    0xe3, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0x80,
-    0x0, 0xb, 0xb3, 0x33, 0x33, 0x21, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xa6, 0x44, 0x59, 0xee,
-    0x50, 0x0, 0x7, 0xf9, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0x40, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30,
-    0x0, 0x7, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x4, 0xdf, 0xa6, 0x44, 0x69, 0xee,
-    0x40, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xb6,
-    0x0, 0x0,
-
-    /* U+0422 "Т" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
-    0x33, 0x33, 0x36, 0xf5, 0x33, 0x33, 0x32, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x2f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xc0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x40, 0x1, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9c, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf3, 0x0, 0x0, 0x1f, 0x50, 0x0,
-    0x0, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x8, 0xd0,
-    0x0, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0xaa, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x60, 0x0, 0xa, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x3,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x6b, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x35, 0x47, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xfd, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x7b, 0xde, 0xff, 0xec, 0x95, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0xc8, 0x53, 0xd8, 0x35,
-    0x9e, 0xf8, 0x0, 0x0, 0x0, 0x4f, 0xb2, 0x0,
-    0x0, 0xd7, 0x0, 0x0, 0x5e, 0xc1, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x1,
-    0xdc, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0xd7,
-    0x0, 0x0, 0x0, 0x1f, 0x70, 0x3f, 0x20, 0x0,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x8, 0xd0,
-    0x7d, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x9b, 0x0, 0x0, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0x1, 0xf3, 0x9b, 0x0,
-    0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x1,
-    0xf3, 0x7d, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0,
-    0x0, 0x0, 0x3, 0xf1, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0xd7, 0x0, 0x0, 0x0, 0x7, 0xe0, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0xe, 0x80, 0x5, 0xf5, 0x0, 0x0, 0x0, 0xd7,
-    0x0, 0x0, 0x0, 0xae, 0x10, 0x0, 0x7f, 0x80,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0x2c, 0xe3, 0x0,
-    0x0, 0x4, 0xee, 0x95, 0x20, 0xd7, 0x2, 0x6b,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xae, 0xff,
-    0xff, 0xff, 0xc8, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xd8, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x7, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe1,
-    0x0, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x1, 0xe9, 0x0,
-    0x0, 0x7, 0xf2, 0x0, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0x0, 0xcc, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf3, 0xb, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbd, 0x7f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xbe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf6, 0x1e, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xb0, 0x4, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x8e, 0x10, 0x0, 0x9e, 0x10, 0x0,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0xd, 0xb0, 0x0,
-    0x0, 0xd, 0xa0, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x9e, 0x10, 0x0, 0x0, 0x0, 0x8f, 0x20,
-    0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc0,
-    0x1e, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-
-    /* U+0426 "Ц" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xa0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xa0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xa0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xa0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xa0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa0,
-    0x0, 0xbb, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3b,
-    0xb3, 0x32, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54,
-
-    /* U+0427 "Ч" */
-    0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x4b,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0xba,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x4b, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0xba, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x4b, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf4, 0xba, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x49, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf4, 0x5f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x40, 0xdc, 0x10, 0x0, 0x0,
-    0x0, 0x5, 0xf4, 0x3, 0xee, 0x62, 0x0, 0x25,
-    0x9e, 0xff, 0x40, 0x1, 0x9e, 0xff, 0xff, 0xea,
-    0x51, 0xf4, 0x0, 0x0, 0x1, 0x32, 0x10, 0x0,
-    0x1f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x40,
-
-    /* U+0428 "Ш" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x2b, 0x90, 0x0, 0x0, 0x0,
-    0x7, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xf2, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x2b, 0x90, 0x0, 0x0, 0x0, 0x7,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xf2, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x2b, 0x90, 0x0, 0x0, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xf2, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x2b, 0x90, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xf2, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x2b,
-    0x90, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0,
-    0x0, 0x3, 0xf2, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x2b, 0x90,
-    0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xf2, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x2b, 0x90, 0x0,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xf2, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x2b, 0x90, 0x0, 0x0,
-    0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xf2,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x2b, 0xb3, 0x33, 0x33, 0x33,
-    0x39, 0xe3, 0x33, 0x33, 0x33, 0x35, 0xf2, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20,
-
-    /* U+0429 "Щ" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x20, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x20, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x20,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x20, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x20, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x20, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x20, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x20,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x20, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x20, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0xbb, 0x33, 0x33,
-    0x33, 0x33, 0x9e, 0x33, 0x33, 0x33, 0x33, 0x5f,
-    0x53, 0x30, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x80,
-
-    /* U+042A "Ъ" */
-    0xbf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x23, 0x33, 0x33, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x22, 0x22, 0x23, 0x47,
-    0xde, 0x40, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe1, 0x0, 0x0, 0x0, 0xf7, 0x22, 0x22,
-    0x22, 0x47, 0xed, 0x20, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+042B "Ы" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xdb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xdb, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xdb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd9,
-    0x20, 0x0, 0x0, 0x7d, 0xba, 0x22, 0x22, 0x22,
-    0x46, 0xcf, 0x70, 0x0, 0x7, 0xdb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x7d, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x7,
-    0xdb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf0,
-    0x0, 0x7d, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x20, 0x7, 0xdb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf2, 0x0, 0x7d, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x0, 0x7, 0xdb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x7d,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0,
-    0x7, 0xdb, 0xa2, 0x22, 0x22, 0x23, 0x6c, 0xf5,
-    0x0, 0x0, 0x7d, 0xbf, 0xff, 0xff, 0xff, 0xec,
-    0x81, 0x0, 0x0, 0x7, 0xd0,
-
-    /* U+042C "Ь" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xd9, 0x20, 0x0, 0xba, 0x22, 0x22, 0x22,
-    0x46, 0xcf, 0x70, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbc, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x2b, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf2, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0xb,
-    0xa2, 0x22, 0x22, 0x23, 0x6c, 0xf5, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xec, 0x81, 0x0, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x28, 0xce, 0xff, 0xd9, 0x20, 0x0, 0x0,
-    0x9, 0xfd, 0x85, 0x44, 0x7c, 0xf9, 0x0, 0x0,
-    0xbe, 0x40, 0x0, 0x0, 0x0, 0x4e, 0xd1, 0x0,
-    0x31, 0x0, 0x0, 0x0, 0x0, 0x1, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x12, 0x22, 0x22, 0x22, 0x22, 0xc9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0xec, 0x0,
-    0xbd, 0x30, 0x0, 0x0, 0x0, 0x5e, 0xd1, 0x0,
-    0x1a, 0xfc, 0x85, 0x45, 0x7d, 0xf9, 0x0, 0x0,
-    0x0, 0x28, 0xce, 0xff, 0xd9, 0x20, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xc8, 0x20, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x6, 0xfe, 0x85, 0x44, 0x7d, 0xf9, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x5e, 0xc0, 0x0, 0xb9, 0x0, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xeb, 0x0,
-    0xb9, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0xb9, 0x0, 0x0, 0x9e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd0,
-    0xb9, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf2, 0xb9, 0x0, 0x2, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0xb9, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc9,
-    0xbb, 0x33, 0x37, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0xb9, 0x0, 0x2, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0xb9, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf2, 0xb9, 0x0, 0x0, 0x9e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd0,
-    0xb9, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0xb9, 0x0, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xeb, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x5e, 0xc0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x6, 0xfe, 0x95, 0x45, 0x8d, 0xf9, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff,
-    0xc8, 0x20, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x5b, 0xef, 0xff, 0xff, 0xff, 0xc0,
-    0x1, 0xcf, 0x95, 0x43, 0x33, 0x33, 0xac, 0x0,
-    0xdc, 0x20, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x7f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x9c, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xc0, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9c, 0x1f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xc1, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9c, 0xe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xc0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9c, 0x2, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xc0, 0x4, 0xfb, 0x41, 0x0, 0x0,
-    0x0, 0x9c, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x5, 0xf3, 0x22, 0x22, 0x22,
-    0xac, 0x0, 0x1, 0xe6, 0x0, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0x0, 0x6e, 0x10, 0x0, 0x0, 0x0, 0x9, 0xc0,
-    0x2f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9c, 0xc,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xc0,
-
-    /* U+0430 "а" */
-    0x0, 0x28, 0xdf, 0xfe, 0xa3, 0x0, 0x8, 0xfb,
-    0x63, 0x35, 0xbf, 0x50, 0x9, 0x30, 0x0, 0x0,
-    0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0x0, 0x4a, 0xde, 0xee,
-    0xee, 0xf8, 0x9, 0xe6, 0x31, 0x11, 0x11, 0xc8,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0xc8, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0xc8, 0x7d, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x3f, 0x30, 0x0, 0x0, 0xc, 0xe8,
-    0x8, 0xe6, 0x10, 0x15, 0xd7, 0xb8, 0x0, 0x5b,
-    0xff, 0xea, 0x30, 0xb8,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9a, 0x0,
-    0x0, 0x0, 0x1, 0x6a, 0xef, 0xeb, 0x60, 0x0,
-    0x0, 0x2b, 0xfe, 0x96, 0x20, 0x0, 0x0, 0x0,
-    0x5f, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x1, 0x8d,
-    0xff, 0xd9, 0x20, 0x0, 0xe, 0x53, 0xeb, 0x53,
-    0x36, 0xcf, 0x70, 0x0, 0xf5, 0xe4, 0x0, 0x0,
-    0x0, 0x6f, 0x50, 0x1f, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf5, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x80, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x80, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x7, 0xf5, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0,
-    0x8, 0xfb, 0x52, 0x36, 0xcf, 0x50, 0x0, 0x0,
-    0x3, 0xae, 0xff, 0xc8, 0x10, 0x0,
-
-    /* U+0432 "в" */
-    0x3f, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x3f, 0x21,
-    0x11, 0x12, 0x6e, 0xb0, 0x3f, 0x10, 0x0, 0x0,
-    0x3, 0xf3, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xf5,
-    0x3f, 0x10, 0x0, 0x0, 0x2, 0xf2, 0x3f, 0x10,
-    0x0, 0x0, 0x4d, 0x80, 0x3f, 0xee, 0xee, 0xef,
-    0xf9, 0x0, 0x3f, 0x21, 0x11, 0x12, 0x4b, 0xd1,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0xc8, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x8c, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0x8c, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xd9,
-    0x3f, 0x21, 0x11, 0x12, 0x5c, 0xe1, 0x3f, 0xff,
-    0xff, 0xff, 0xd9, 0x10,
-
-    /* U+0433 "г" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0x13, 0xf4, 0x33,
-    0x33, 0x33, 0x30, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x3, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xf1, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x3, 0xf3, 0x33, 0x33, 0x33, 0xe6, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0x4, 0xe0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0x6, 0xd0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0xa, 0x90, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0xd, 0x60, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0xf, 0x30, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x0, 0x6e, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0x15, 0xe7, 0x22, 0x22, 0x22, 0x22, 0xe7, 0x21,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9,
-    0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9,
-    0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54,
-
-    /* U+0435 "е" */
-    0x0, 0x1, 0x8d, 0xff, 0xd8, 0x10, 0x0, 0x0,
-    0x4e, 0xc5, 0x33, 0x6c, 0xe3, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0x0, 0x8f, 0x20, 0xc, 0xa0, 0x0,
-    0x0, 0x0, 0xb, 0xb0, 0x2f, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x6d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe5, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x8b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xea, 0x0,
-    0x0, 0x0, 0x1c, 0x40, 0x0, 0x2d, 0xe8, 0x43,
-    0x48, 0xfb, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xeb,
-    0x50, 0x0,
-
-    /* U+0436 "ж" */
-    0xa, 0xb0, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x0,
-    0x0, 0xba, 0x0, 0x1e, 0x70, 0x0, 0x0, 0x2f,
-    0x20, 0x0, 0x0, 0x7e, 0x10, 0x0, 0x4f, 0x30,
-    0x0, 0x2, 0xf2, 0x0, 0x0, 0x3f, 0x30, 0x0,
-    0x0, 0x8d, 0x0, 0x0, 0x2f, 0x20, 0x0, 0xd,
-    0x80, 0x0, 0x0, 0x0, 0xc9, 0x0, 0x2, 0xf2,
-    0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x0, 0x2f, 0x20, 0x4, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf8, 0x22, 0x5f, 0x42,
-    0x28, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0,
-    0x2, 0xf2, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x6f, 0x20, 0x0, 0x2f, 0x20, 0x0, 0x2f, 0x60,
-    0x0, 0x0, 0x2f, 0x70, 0x0, 0x2, 0xf2, 0x0,
-    0x0, 0x7f, 0x10, 0x0, 0xc, 0xc0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0xcb, 0x0, 0x7, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf6,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x2f, 0x20, 0x0,
-    0x0, 0x7, 0xf2,
-
-    /* U+0437 "з" */
-    0x0, 0x39, 0xdf, 0xfe, 0xa4, 0x0, 0x6, 0xfa,
-    0x53, 0x35, 0x9f, 0xa0, 0x1, 0x0, 0x0, 0x0,
-    0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0xa0, 0x0, 0x0, 0xee, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x11, 0x12, 0x5c, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0x9, 0x10, 0x0, 0x0, 0x3, 0xf7,
-    0xa, 0xf9, 0x53, 0x24, 0x9f, 0xa0, 0x0, 0x39,
-    0xdf, 0xfe, 0xa4, 0x0,
-
-    /* U+0438 "и" */
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x9, 0xe3, 0xf1,
-    0x0, 0x0, 0x0, 0x6, 0xfe, 0x3f, 0x10, 0x0,
-    0x0, 0x4, 0xfa, 0xe3, 0xf1, 0x0, 0x0, 0x2,
-    0xe7, 0x6e, 0x3f, 0x10, 0x0, 0x0, 0xda, 0x6,
-    0xe3, 0xf1, 0x0, 0x0, 0xac, 0x0, 0x6e, 0x3f,
-    0x10, 0x0, 0x7e, 0x10, 0x6, 0xe3, 0xf1, 0x0,
-    0x4f, 0x30, 0x0, 0x6e, 0x3f, 0x10, 0x2f, 0x60,
-    0x0, 0x6, 0xe3, 0xf1, 0x1d, 0x90, 0x0, 0x0,
-    0x6e, 0x3f, 0x1b, 0xc0, 0x0, 0x0, 0x6, 0xe3,
-    0xfa, 0xe1, 0x0, 0x0, 0x0, 0x6e, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x6, 0xe3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x6e,
-
-    /* U+0439 "й" */
-    0x0, 0x6, 0x0, 0x0, 0x4, 0x30, 0x0, 0x0,
-    0xb5, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x4, 0xe4,
-    0x0, 0x7d, 0x0, 0x0, 0x0, 0x4, 0xbe, 0xe9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0x9, 0xe3, 0xf1, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x3f, 0x10, 0x0, 0x0,
-    0x4, 0xfa, 0xe3, 0xf1, 0x0, 0x0, 0x2, 0xe7,
-    0x6e, 0x3f, 0x10, 0x0, 0x0, 0xda, 0x6, 0xe3,
-    0xf1, 0x0, 0x0, 0xac, 0x0, 0x6e, 0x3f, 0x10,
-    0x0, 0x7e, 0x10, 0x6, 0xe3, 0xf1, 0x0, 0x4f,
-    0x30, 0x0, 0x6e, 0x3f, 0x10, 0x2f, 0x60, 0x0,
-    0x6, 0xe3, 0xf1, 0x1d, 0x90, 0x0, 0x0, 0x6e,
-    0x3f, 0x1b, 0xc0, 0x0, 0x0, 0x6, 0xe3, 0xfa,
-    0xe1, 0x0, 0x0, 0x0, 0x6e, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x6, 0xe3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x6e,
-
-    /* U+043A "к" */
-    0x3f, 0x10, 0x0, 0x0, 0x1, 0xd8, 0x3, 0xf1,
-    0x0, 0x0, 0x0, 0xba, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0x9c, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x6e,
-    0x10, 0x0, 0x3f, 0x10, 0x0, 0x4f, 0x20, 0x0,
-    0x3, 0xf1, 0x0, 0x2e, 0x40, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x3, 0xf4, 0x22,
-    0x6f, 0x40, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x8e,
-    0x10, 0x0, 0x3, 0xf1, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0x1, 0xe9, 0x0, 0x3,
-    0xf1, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x6, 0xf3, 0x3, 0xf1, 0x0, 0x0,
-    0x0, 0x9, 0xe1,
-
-    /* U+043B "л" */
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x2, 0xf3, 0x33, 0x33, 0x33, 0xe6, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x4, 0xe0,
-    0x0, 0x0, 0x0, 0xe6, 0x0, 0x5, 0xe0, 0x0,
-    0x0, 0x0, 0xe6, 0x0, 0x6, 0xd0, 0x0, 0x0,
-    0x0, 0xe6, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x8, 0xa0, 0x0, 0x0, 0x0, 0xe6,
-    0x0, 0x9, 0x80, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0xc, 0x60, 0x0, 0x0, 0x0, 0xe6, 0x0, 0xf,
-    0x30, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x5e, 0x0,
-    0x0, 0x0, 0x0, 0xe6, 0x36, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0xe6, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xe6,
-
-    /* U+043C "м" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0x3f, 0xc8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc9,
-    0x3f, 0x3f, 0x20, 0x0, 0x0, 0x0, 0xa9, 0xa9,
-    0x3f, 0xa, 0xb0, 0x0, 0x0, 0x3, 0xe1, 0xa9,
-    0x3f, 0x1, 0xf4, 0x0, 0x0, 0xd, 0x60, 0xa9,
-    0x3f, 0x0, 0x7d, 0x0, 0x0, 0x6d, 0x0, 0xa9,
-    0x3f, 0x0, 0xd, 0x60, 0x1, 0xe3, 0x0, 0xa9,
-    0x3f, 0x0, 0x4, 0xe1, 0x9, 0xa0, 0x0, 0xa9,
-    0x3f, 0x0, 0x0, 0xb9, 0x2f, 0x10, 0x0, 0xa9,
-    0x3f, 0x0, 0x0, 0x2f, 0xd7, 0x0, 0x0, 0xa9,
-    0x3f, 0x0, 0x0, 0x8, 0xd0, 0x0, 0x0, 0xa9,
-    0x3f, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0xa9,
-    0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9,
-
-    /* U+043D "н" */
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0xb, 0x93, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x3f, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0x93, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xb,
-    0x93, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xf4, 0x22,
-    0x22, 0x22, 0x22, 0xb9, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0x93, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xb, 0x93,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0xb, 0x93, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xb9,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x7c, 0xff, 0xea, 0x30, 0x0, 0x0,
-    0x3e, 0xd7, 0x33, 0x5a, 0xf8, 0x0, 0x2, 0xea,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0xb, 0xc0, 0x0,
-    0x0, 0x0, 0x5, 0xf2, 0x2f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xc9, 0x6e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7d, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x2f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xc9, 0xb, 0xc0,
-    0x0, 0x0, 0x0, 0x5, 0xf2, 0x2, 0xea, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x3e, 0xd7, 0x43,
-    0x5a, 0xf8, 0x0, 0x0, 0x0, 0x7c, 0xff, 0xea,
-    0x30, 0x0,
-
-    /* U+043F "п" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xf4,
-    0x33, 0x33, 0x33, 0x33, 0xba, 0x3f, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xa3, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xaa, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xa,
-    0xa3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaa, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xa3, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xaa, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0xa, 0xa3, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xaa, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xa, 0xa3,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xaa, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xa3, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xaa,
-
-    /* U+0440 "р" */
-    0x2f, 0x10, 0x3a, 0xef, 0xfc, 0x60, 0x0, 0x2,
-    0xf1, 0x7f, 0x94, 0x34, 0x8e, 0xd1, 0x0, 0x2f,
-    0x7d, 0x20, 0x0, 0x0, 0x1c, 0xd0, 0x2, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x1e, 0x80, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x2, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf3, 0x2f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x52, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf5, 0x2f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x32, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x1, 0xe8, 0x2, 0xf8, 0xd2, 0x0, 0x0, 0x1,
-    0xcd, 0x0, 0x2f, 0x27, 0xf9, 0x43, 0x48, 0xfd,
-    0x10, 0x2, 0xf2, 0x3, 0xae, 0xff, 0xc6, 0x0,
-    0x0, 0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x7c, 0xff, 0xea, 0x30, 0x0, 0x3,
-    0xed, 0x74, 0x35, 0xaf, 0x80, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x3f, 0x30, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x2e, 0xa0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x3e,
-    0xe7, 0x43, 0x5a, 0xf8, 0x0, 0x0, 0x7, 0xcf,
-    0xfe, 0xa3, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x33,
-    0x33, 0x3c, 0xa3, 0x33, 0x32, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x90, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x7, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xa0,
-    0x1f, 0x50, 0x0, 0x0, 0x0, 0x2, 0xf3, 0x0,
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0, 0x2,
-    0xf3, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0, 0xb,
-    0xa0, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0xd8,
-    0x0, 0x0, 0x5e, 0x0, 0x0, 0x0, 0x6, 0xe0,
-    0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0xe, 0x60,
-    0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8d, 0x0,
-    0xaa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0x1f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xa, 0xb8, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xe7, 0x0, 0x0, 0x0, 0x4,
-    0xd6, 0x34, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdf, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xdf, 0xff, 0xec, 0x93, 0x0, 0x0, 0x0,
-    0x2c, 0xfa, 0x64, 0xbb, 0x46, 0xbf, 0xb1, 0x0,
-    0x2, 0xeb, 0x10, 0x0, 0xa9, 0x0, 0x2, 0xce,
-    0x10, 0xc, 0xc0, 0x0, 0x0, 0xa9, 0x0, 0x0,
-    0xc, 0xb0, 0x3f, 0x20, 0x0, 0x0, 0xa9, 0x0,
-    0x0, 0x3, 0xf2, 0x7d, 0x0, 0x0, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0xe6, 0x9b, 0x0, 0x0, 0x0,
-    0xa9, 0x0, 0x0, 0x0, 0xb8, 0x9b, 0x0, 0x0,
-    0x0, 0xa9, 0x0, 0x0, 0x0, 0xb8, 0x7d, 0x0,
-    0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0xe6, 0x3f,
-    0x30, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x3, 0xf2,
-    0xc, 0xc0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0xd,
-    0xb0, 0x2, 0xec, 0x20, 0x0, 0xa9, 0x0, 0x2,
-    0xcd, 0x10, 0x0, 0x2c, 0xfb, 0x64, 0xcb, 0x47,
-    0xbf, 0xb1, 0x0, 0x0, 0x0, 0x49, 0xdf, 0xff,
-    0xec, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0445 "х" */
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x5f, 0x20, 0x2e,
-    0x60, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x5f, 0x30,
-    0x0, 0xd, 0x90, 0x0, 0x0, 0x8d, 0x0, 0x9,
-    0xd0, 0x0, 0x0, 0x0, 0xca, 0x5, 0xf2, 0x0,
-    0x0, 0x0, 0x1, 0xe8, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x2c,
-    0xb0, 0x0, 0x0, 0x0, 0x2f, 0x50, 0x1e, 0x70,
-    0x0, 0x0, 0xd, 0x90, 0x0, 0x4f, 0x30, 0x0,
-    0xa, 0xd0, 0x0, 0x0, 0x8e, 0x10, 0x5, 0xf2,
-    0x0, 0x0, 0x0, 0xcb, 0x2, 0xf6, 0x0, 0x0,
-    0x0, 0x2, 0xe7,
-
-    /* U+0446 "ц" */
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0xe, 0x60, 0x3,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0xe, 0x60, 0x3, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0xe, 0x60, 0x3, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xe6, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0x0, 0xe, 0x60, 0x3, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xe6, 0x0, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0xe, 0x60, 0x3, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xe6, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0xe, 0x60, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x3f, 0x42, 0x22, 0x22, 0x22, 0x2e,
-    0x82, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9a,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x45,
-
-    /* U+0447 "ч" */
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0xb9, 0xab, 0x0,
-    0x0, 0x0, 0x0, 0xb9, 0x6f, 0x20, 0x0, 0x0,
-    0x0, 0xb9, 0xc, 0xe6, 0x10, 0x2, 0x6c, 0xf9,
-    0x0, 0x8e, 0xff, 0xfe, 0xa5, 0xc9, 0x0, 0x0,
-    0x12, 0x10, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb9,
-
-    /* U+0448 "ш" */
-    0x3f, 0x10, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x3, 0xf1, 0x3f, 0x10, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x3, 0xf1, 0x3f, 0x10, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x3, 0xf1, 0x3f, 0x10,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x3, 0xf1,
-    0x3f, 0x10, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x3, 0xf1, 0x3f, 0x10, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x3, 0xf1, 0x3f, 0x10, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x3, 0xf1, 0x3f, 0x10,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x3, 0xf1,
-    0x3f, 0x10, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x3, 0xf1, 0x3f, 0x10, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x3, 0xf1, 0x3f, 0x10, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x3, 0xf1, 0x3f, 0x10,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x3, 0xf1,
-    0x3f, 0x42, 0x22, 0x22, 0x2b, 0xb2, 0x22, 0x22,
-    0x25, 0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1,
-
-    /* U+0449 "щ" */
-    0x3f, 0x10, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x3, 0xf1, 0x0, 0x3f, 0x10, 0x0, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x3, 0xf1,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x3f, 0x10, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x3,
-    0xf1, 0x0, 0x3f, 0x10, 0x0, 0x0, 0xb, 0x90,
-    0x0, 0x0, 0x3, 0xf1, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x3, 0xf1, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x3, 0xf1, 0x0, 0x3f, 0x10, 0x0, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x3, 0xf1,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0xb, 0x90, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x3f, 0x42, 0x22, 0x22,
-    0x2b, 0xb2, 0x22, 0x22, 0x26, 0xf3, 0x20, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf3,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x33, 0x3b, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfe, 0xee, 0xee, 0xb6, 0x0,
-    0x0, 0x0, 0xb, 0xa1, 0x11, 0x13, 0x7e, 0xb0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x2, 0xf6,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0xaa,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x9c,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0xba,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x2, 0xf5,
-    0x0, 0x0, 0xb, 0xa1, 0x11, 0x12, 0x6e, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0xc6, 0x0,
-
-    /* U+044B "ы" */
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x3f, 0xee, 0xee, 0xec, 0x92, 0x0, 0x2, 0xf2,
-    0x3f, 0x31, 0x11, 0x24, 0xaf, 0x50, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x8, 0xe0, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x1, 0xf4, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0xf5, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x1, 0xf3, 0x2, 0xf2,
-    0x3f, 0x10, 0x0, 0x0, 0x9, 0xe0, 0x2, 0xf2,
-    0x3f, 0x21, 0x11, 0x14, 0xaf, 0x40, 0x2, 0xf2,
-    0x3f, 0xff, 0xff, 0xfd, 0x92, 0x0, 0x2, 0xf2,
-
-    /* U+044C "ь" */
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xee,
-    0xee, 0xed, 0x93, 0x0, 0x3f, 0x31, 0x11, 0x14,
-    0x9f, 0x60, 0x3f, 0x10, 0x0, 0x0, 0x7, 0xf1,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0xf5, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0xe6, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0xf5, 0x3f, 0x10, 0x0, 0x0, 0x7, 0xf0,
-    0x3f, 0x21, 0x11, 0x13, 0x9f, 0x50, 0x3f, 0xff,
-    0xff, 0xfe, 0xa3, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x29, 0xdf, 0xfe, 0xa4, 0x0, 0x0, 0x8,
-    0xf9, 0x42, 0x23, 0x8e, 0xb1, 0x0, 0x6, 0x20,
-    0x0, 0x0, 0x1, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x0, 0x7e, 0xee, 0xee, 0xee,
-    0xf5, 0x0, 0x0, 0x1, 0x11, 0x11, 0x11, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0x70, 0x8, 0x30, 0x0,
-    0x0, 0x2, 0xdc, 0x0, 0x7, 0xfa, 0x53, 0x24,
-    0x9f, 0xb0, 0x0, 0x0, 0x28, 0xdf, 0xfe, 0xa4,
-    0x0, 0x0,
-
-    /* U+044E "ю" */
-    0x3f, 0x10, 0x0, 0x0, 0x7, 0xcf, 0xfd, 0x92,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x2e, 0xd7, 0x33,
-    0x5b, 0xf6, 0x0, 0x3f, 0x10, 0x0, 0x1e, 0xa0,
-    0x0, 0x0, 0x5, 0xf5, 0x3, 0xf1, 0x0, 0xa,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x3f, 0x10,
-    0x1, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0x63,
-    0xf2, 0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaa, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xc3, 0xf4, 0x33, 0x8d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8c, 0x3f, 0x10, 0x4, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa3, 0xf1, 0x0,
-    0x1f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x3f,
-    0x10, 0x0, 0xad, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0x3, 0xf1, 0x0, 0x1, 0xea, 0x0, 0x0, 0x0,
-    0x5f, 0x50, 0x3f, 0x10, 0x0, 0x2, 0xdd, 0x73,
-    0x35, 0xbf, 0x60, 0x3, 0xf1, 0x0, 0x0, 0x0,
-    0x7c, 0xff, 0xd9, 0x20, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x18, 0xdf, 0xff, 0xff, 0xfd, 0x3, 0xec,
-    0x63, 0x22, 0x22, 0x7d, 0xd, 0xa0, 0x0, 0x0,
-    0x0, 0x6d, 0x2f, 0x20, 0x0, 0x0, 0x0, 0x6d,
-    0x4f, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x6d, 0xe, 0x80, 0x0, 0x0,
-    0x0, 0x6d, 0x4, 0xf9, 0x30, 0x0, 0x0, 0x6d,
-    0x0, 0x29, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x4,
-    0xf2, 0x0, 0x0, 0x6d, 0x0, 0x1e, 0x60, 0x0,
-    0x0, 0x6d, 0x0, 0xab, 0x0, 0x0, 0x0, 0x6d,
-    0x5, 0xf2, 0x0, 0x0, 0x0, 0x6d, 0x1e, 0x60,
-    0x0, 0x0, 0x0, 0x6d,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x5, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xad, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xd8, 0x10,
-    0x0, 0x0, 0x4e, 0xc5, 0x33, 0x6c, 0xe3, 0x0,
-    0x3, 0xf7, 0x0, 0x0, 0x0, 0x8f, 0x20, 0xc,
-    0xa0, 0x0, 0x0, 0x0, 0xb, 0xb0, 0x2f, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0xf1, 0x6d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe5, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x8b, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xea, 0x0, 0x0, 0x0, 0x1c, 0x40, 0x0, 0x2d,
-    0xe8, 0x43, 0x48, 0xfb, 0x0, 0x0, 0x0, 0x6c,
-    0xff, 0xeb, 0x50, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x1, 0xe7, 0x0, 0x9e, 0x0, 0x0, 0x0,
-    0x1, 0xd6, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xd8,
-    0x10, 0x0, 0x0, 0x4e, 0xc5, 0x33, 0x6c, 0xe3,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x8f, 0x20,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0xb, 0xb0, 0x2f,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x6d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe5, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x8b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xea, 0x0, 0x0, 0x0, 0x1c, 0x40, 0x0,
-    0x2d, 0xe8, 0x43, 0x48, 0xfb, 0x0, 0x0, 0x0,
-    0x6c, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x5, 0xbe, 0xfe, 0xb4, 0x0,
-    0x0, 0x3, 0xf1, 0xad, 0x73, 0x35, 0xaf, 0x70,
-    0x0, 0x3, 0xfa, 0xa0, 0x0, 0x0, 0x6, 0xf3,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xca,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x93, 0x27, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xae, 0xfd, 0x60,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x4, 0x82, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x6, 0xe4, 0x0,
-    0x0, 0x0, 0x6, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x13, 0xf4,
-    0x33, 0x33, 0x33, 0x30, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xf1, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x6b, 0xef, 0xfc, 0x71, 0x0, 0x2,
-    0xde, 0x73, 0x23, 0x5a, 0xf5, 0x1, 0xea, 0x0,
-    0x0, 0x0, 0x3, 0x30, 0xbb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xee, 0xee, 0xee, 0xe3, 0x0, 0x9, 0xa1, 0x11,
-    0x11, 0x11, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xa0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x2d,
-    0xe7, 0x32, 0x36, 0xce, 0x30, 0x0, 0x6, 0xbe,
-    0xfe, 0xc7, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x29, 0xdf, 0xfd, 0xa4, 0x0, 0x4, 0xfa,
-    0x43, 0x35, 0x9f, 0x60, 0xe, 0x80, 0x0, 0x0,
-    0x1, 0x10, 0x2f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xea, 0x73,
-    0x0, 0x0, 0x0, 0x1, 0x58, 0xcf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf1, 0x36, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x4e, 0xd8, 0x43, 0x35, 0xaf, 0x40, 0x1, 0x6b,
-    0xef, 0xfd, 0x92, 0x0,
-
-    /* U+0456 "і" */
-    0x1, 0x7, 0xf6, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x13, 0xf1, 0x3f, 0x13, 0xf1, 0x3f,
-    0x13, 0xf1, 0x3f, 0x13, 0xf1, 0x3f, 0x13, 0xf1,
-    0x3f, 0x13, 0xf1, 0x3f, 0x13, 0xf1,
-
-    /* U+0457 "ї" */
-    0xd, 0x80, 0xbb, 0xc, 0x70, 0x9a, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x4f, 0x10, 0x0, 0x4f, 0x10,
-    0x0, 0x4f, 0x10, 0x0, 0x4f, 0x10, 0x0, 0x4f,
-    0x10, 0x0, 0x4f, 0x10, 0x0, 0x4f, 0x10, 0x0,
-    0x4f, 0x10, 0x0, 0x4f, 0x10, 0x0, 0x4f, 0x10,
-    0x0, 0x4f, 0x10, 0x0, 0x4f, 0x10, 0x0, 0x4f,
-    0x10,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x3, 0xf1,
-    0x0, 0x0, 0x7, 0xe0, 0x1a, 0x42, 0x6f, 0x70,
-    0x19, 0xef, 0xe7, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x33, 0x33,
-    0x33, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xe0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0xf,
-    0xfe, 0xee, 0xed, 0xb5, 0x0, 0x0, 0x7, 0xc0,
-    0x0, 0x0, 0x0, 0xf8, 0x11, 0x11, 0x37, 0xeb,
-    0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x2, 0xf6, 0x0, 0x9, 0x80, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xa, 0xa0,
-    0x0, 0xc6, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0,
-    0x0, 0x0, 0x9b, 0x0, 0xf, 0x30, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0xb, 0xa0, 0x5,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x4, 0xf5, 0x36, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0x33, 0x33, 0x59, 0xfa, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0xb5,
-    0x0,
-
-    /* U+045A "њ" */
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0x0, 0x3f, 0x42, 0x22,
-    0x22, 0x22, 0x2f, 0x72, 0x22, 0x24, 0x8f, 0xb0,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x3, 0xf4, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0xd8, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0,
-    0xd7, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0x3, 0xf3, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x2, 0x6e, 0x90, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0xb5, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbe, 0xee, 0xfe, 0xee, 0xee, 0xec, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf1, 0x5, 0xbe, 0xfe, 0xb3, 0x0,
-    0x0, 0x3, 0xf2, 0xad, 0x73, 0x35, 0xaf, 0x70,
-    0x0, 0x3, 0xfa, 0xa0, 0x0, 0x0, 0x7, 0xf3,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x4, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x1, 0xd8, 0x3, 0xf1, 0x0,
-    0x0, 0x0, 0xba, 0x0, 0x3f, 0x10, 0x0, 0x0,
-    0x9c, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x6e, 0x10,
-    0x0, 0x3f, 0x10, 0x0, 0x4f, 0x20, 0x0, 0x3,
-    0xf1, 0x0, 0x2e, 0x40, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x3, 0xf4, 0x22, 0x6f,
-    0x40, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x8e, 0x10,
-    0x0, 0x3, 0xf1, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x3f, 0x10, 0x0, 0x1, 0xe9, 0x0, 0x3, 0xf1,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0x6, 0xf3, 0x3, 0xf1, 0x0, 0x0, 0x0,
-    0x9, 0xe1,
-
-    /* U+045D "ѝ" */
-    0x0, 0x6, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0x9, 0xe3, 0xf1, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x3f, 0x10, 0x0, 0x0,
-    0x4, 0xfa, 0xe3, 0xf1, 0x0, 0x0, 0x2, 0xe7,
-    0x6e, 0x3f, 0x10, 0x0, 0x0, 0xda, 0x6, 0xe3,
-    0xf1, 0x0, 0x0, 0xac, 0x0, 0x6e, 0x3f, 0x10,
-    0x0, 0x7e, 0x10, 0x6, 0xe3, 0xf1, 0x0, 0x4f,
-    0x30, 0x0, 0x6e, 0x3f, 0x10, 0x2f, 0x60, 0x0,
-    0x6, 0xe3, 0xf1, 0x1d, 0x90, 0x0, 0x0, 0x6e,
-    0x3f, 0x1b, 0xc0, 0x0, 0x0, 0x6, 0xe3, 0xfa,
-    0xe1, 0x0, 0x0, 0x0, 0x6e, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x6, 0xe3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x6e,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x43, 0x0, 0x0,
-    0x0, 0xd, 0x30, 0x0, 0xc, 0x40, 0x0, 0x0,
-    0x0, 0x5d, 0x30, 0x19, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0xed, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xa0, 0x1f, 0x50, 0x0,
-    0x0, 0x0, 0x2, 0xf3, 0x0, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0x9b, 0x0, 0x2, 0xf3, 0x0, 0x0,
-    0x0, 0xf, 0x40, 0x0, 0xb, 0xa0, 0x0, 0x0,
-    0x7, 0xd0, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x5e,
-    0x0, 0x0, 0x0, 0x6, 0xe0, 0x0, 0xc, 0x80,
-    0x0, 0x0, 0x0, 0xe, 0x60, 0x3, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x8d, 0x0, 0xaa, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf4, 0x1f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xb8, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xe7, 0x0, 0x0, 0x0, 0x4, 0xd6, 0x34, 0xdc,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xe9, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x9b, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x9b, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0x9b, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x9b,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x9b, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x9b, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0x9b, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x9b,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x9b, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x9b, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0x9b, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x9b,
-    0x3f, 0x42, 0x22, 0x22, 0x22, 0xab, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x5, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x70, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x54, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb8,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbb, 0x33,
-    0x33, 0x33, 0x33, 0x32, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0xe5, 0x0, 0x0, 0x0, 0x0, 0xe5, 0x3f,
-    0xff, 0xff, 0xff, 0xf5, 0x3f, 0x43, 0x33, 0x33,
-    0x30, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+2014 "—" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+2018 "‘" */
-    0x6, 0x90, 0xa5, 0xe, 0x23, 0xf0, 0x7f, 0x94,
-    0xf6,
-
-    /* U+2019 "’" */
-    0x4f, 0x75, 0xfa, 0xc, 0x60, 0xf1, 0x3c, 0x4,
-    0x60,
-
-    /* U+201A "‚" */
-    0x3, 0x5, 0xf9, 0x4f, 0x90, 0xc5, 0xf, 0x4,
-    0xb0, 0x34, 0x0,
-
-    /* U+201C "“" */
-    0x6, 0x90, 0x6, 0x80, 0xa5, 0x0, 0xb5, 0xe,
-    0x20, 0xf, 0x13, 0xf0, 0x3, 0xe0, 0x7f, 0x90,
-    0x7f, 0x84, 0xf6, 0x4, 0xf6,
-
-    /* U+201D "”" */
-    0x4f, 0x70, 0x4f, 0x65, 0xfa, 0x6, 0xfa, 0xc,
-    0x60, 0xc, 0x60, 0xf1, 0x0, 0xf1, 0x3c, 0x0,
-    0x3c, 0x4, 0x60, 0x5, 0x60,
-
-    /* U+2026 "…" */
-    0x3, 0x0, 0x0, 0x21, 0x0, 0x1, 0x30, 0x6f,
-    0x90, 0x1, 0xfe, 0x0, 0xb, 0xf4, 0x4f, 0x60,
-    0x0, 0xdb, 0x0, 0x9, 0xe2,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x39, 0xcf, 0xff, 0xd8, 0x20, 0x0,
-    0x0, 0x0, 0xaf, 0xb6, 0x43, 0x36, 0xcf, 0x50,
-    0x0, 0x0, 0x5, 0x10, 0x0, 0x0, 0x0, 0x6f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0x90, 0x3, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xfe, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xee, 0xff,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0x0, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x0, 0x0, 0x4e, 0xd7, 0x43, 0x35, 0x9e, 0xd4,
-    0x0, 0x0, 0x0, 0x17, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x30,
-    0x0, 0x0, 0x14, 0x41, 0x0, 0xe, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0x0, 0x0, 0x9d,
-    0x99, 0xd9, 0x0, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xe0, 0x0, 0x9a, 0x0, 0x0, 0xa9,
-    0xe, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0xe1, 0xe6, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x6, 0xe0, 0x3, 0xc0,
-    0x0, 0x0, 0xc, 0x3e, 0x60, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0x0, 0x2d, 0x0, 0x0, 0x0,
-    0xd2, 0xe6, 0x1, 0xea, 0x0, 0x0, 0x0, 0x6,
-    0xe0, 0x0, 0xe3, 0x0, 0x0, 0x3e, 0xe, 0x60,
-    0x3, 0xf7, 0x0, 0x0, 0x0, 0x6e, 0x0, 0x4,
-    0xe5, 0x0, 0x5e, 0x40, 0xe6, 0x0, 0x6, 0xf4,
-    0x0, 0x0, 0x6, 0xe0, 0x0, 0x3, 0xad, 0xda,
-    0x30, 0xe, 0x60, 0x0, 0xa, 0xe1, 0x0, 0x0,
-    0x6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6,
-    0x0, 0x0, 0xc, 0xc0, 0x0, 0x6, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x60, 0x0, 0x0,
-    0x2e, 0x90, 0x0, 0x6e, 0x0, 0x8, 0xbb, 0xbb,
-    0xbb, 0x80, 0xe6, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x6, 0xe0, 0x0, 0x34, 0x44, 0x44, 0x43, 0xe,
-    0x60, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x6e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0x16, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 107, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 105, .box_w = 3, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29, .adv_w = 149, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 54, .adv_w = 287, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 225, .adv_w = 253, .box_w = 14, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 400, .adv_w = 340, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 590, .adv_w = 272, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 750, .adv_w = 81, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 761, .adv_w = 134, .box_w = 6, .box_h = 25, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 836, .adv_w = 134, .box_w = 5, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 899, .adv_w = 156, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 949, .adv_w = 237, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1021, .adv_w = 83, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1032, .adv_w = 158, .box_w = 8, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 1044, .adv_w = 83, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1049, .adv_w = 133, .box_w = 11, .box_h = 25, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 1187, .adv_w = 274, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1330, .adv_w = 147, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1387, .adv_w = 234, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1520, .adv_w = 232, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1653, .adv_w = 272, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1805, .adv_w = 232, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1938, .adv_w = 250, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2071, .adv_w = 242, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2204, .adv_w = 263, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2347, .adv_w = 250, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2490, .adv_w = 83, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2511, .adv_w = 83, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2538, .adv_w = 237, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 2604, .adv_w = 237, .box_w = 12, .box_h = 8, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2652, .adv_w = 237, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 2718, .adv_w = 234, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2842, .adv_w = 430, .box_w = 25, .box_h = 24, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3142, .adv_w = 293, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3323, .adv_w = 313, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3466, .adv_w = 294, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3628, .adv_w = 344, .box_w = 18, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3799, .adv_w = 278, .box_w = 13, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3923, .adv_w = 262, .box_w = 13, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4047, .adv_w = 322, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4209, .adv_w = 339, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4352, .adv_w = 123, .box_w = 2, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4371, .adv_w = 204, .box_w = 11, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 4476, .adv_w = 292, .box_w = 16, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4628, .adv_w = 243, .box_w = 12, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4742, .adv_w = 398, .box_w = 19, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4923, .adv_w = 339, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5066, .adv_w = 349, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5256, .adv_w = 297, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5399, .adv_w = 349, .box_w = 21, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5641, .adv_w = 300, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5784, .adv_w = 253, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5917, .adv_w = 234, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6060, .adv_w = 330, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6203, .adv_w = 286, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6374, .adv_w = 457, .box_w = 27, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6631, .adv_w = 267, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6793, .adv_w = 260, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6955, .adv_w = 269, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7098, .adv_w = 127, .box_w = 5, .box_h = 25, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 7161, .adv_w = 133, .box_w = 10, .box_h = 25, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 7286, .adv_w = 127, .box_w = 5, .box_h = 25, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 7349, .adv_w = 237, .box_w = 11, .box_h = 11, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 7410, .adv_w = 208, .box_w = 13, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7417, .adv_w = 250, .box_w = 7, .box_h = 3, .ofs_x = 3, .ofs_y = 16},
-    {.bitmap_index = 7428, .adv_w = 243, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7512, .adv_w = 281, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7662, .adv_w = 231, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7753, .adv_w = 281, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7893, .adv_w = 248, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7991, .adv_w = 136, .box_w = 10, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8091, .adv_w = 284, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 8224, .adv_w = 280, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8354, .adv_w = 109, .box_w = 3, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8384, .adv_w = 111, .box_w = 8, .box_h = 25, .ofs_x = -3, .ofs_y = -5},
-    {.bitmap_index = 8484, .adv_w = 243, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8614, .adv_w = 109, .box_w = 3, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8644, .adv_w = 443, .box_w = 24, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8812, .adv_w = 280, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8903, .adv_w = 258, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9001, .adv_w = 281, .box_w = 15, .box_h = 19, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 9144, .adv_w = 281, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 9277, .adv_w = 164, .box_w = 8, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9333, .adv_w = 199, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9417, .adv_w = 166, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9502, .adv_w = 278, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9593, .adv_w = 220, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9691, .adv_w = 359, .box_w = 23, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9852, .adv_w = 216, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9943, .adv_w = 220, .box_w = 15, .box_h = 19, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 10086, .adv_w = 209, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10163, .adv_w = 133, .box_w = 7, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 10251, .adv_w = 121, .box_w = 2, .box_h = 25, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 10276, .adv_w = 133, .box_w = 7, .box_h = 25, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 10364, .adv_w = 237, .box_w = 13, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 10397, .adv_w = 189, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 10447, .adv_w = 189, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 10497, .adv_w = 272, .box_w = 13, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10653, .adv_w = 272, .box_w = 13, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10803, .adv_w = 341, .box_w = 21, .box_h = 20, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11013, .adv_w = 236, .box_w = 12, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11157, .adv_w = 294, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11319, .adv_w = 258, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11452, .adv_w = 126, .box_w = 2, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11471, .adv_w = 123, .box_w = 8, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11563, .adv_w = 215, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11668, .adv_w = 493, .box_w = 30, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11953, .adv_w = 494, .box_w = 27, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12210, .adv_w = 344, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12400, .adv_w = 289, .box_w = 15, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12580, .adv_w = 343, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12772, .adv_w = 279, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12988, .adv_w = 335, .box_w = 15, .box_h = 24, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 13168, .adv_w = 305, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13349, .adv_w = 301, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13492, .adv_w = 312, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13635, .adv_w = 236, .box_w = 12, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13749, .adv_w = 327, .box_w = 20, .box_h = 24, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 13989, .adv_w = 272, .box_w = 13, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14113, .adv_w = 414, .box_w = 26, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14360, .adv_w = 255, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14503, .adv_w = 343, .box_w = 16, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14655, .adv_w = 343, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14847, .adv_w = 289, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14990, .adv_w = 325, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15161, .adv_w = 401, .box_w = 19, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15342, .adv_w = 342, .box_w = 16, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15494, .adv_w = 355, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15684, .adv_w = 344, .box_w = 16, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15836, .adv_w = 294, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15979, .adv_w = 297, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16141, .adv_w = 239, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16284, .adv_w = 279, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16455, .adv_w = 378, .box_w = 22, .box_h = 21, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 16686, .adv_w = 264, .box_w = 16, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16838, .adv_w = 343, .box_w = 18, .box_h = 24, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 17054, .adv_w = 297, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17197, .adv_w = 455, .box_w = 23, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17416, .adv_w = 463, .box_w = 26, .box_h = 24, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 17728, .adv_w = 339, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17918, .adv_w = 402, .box_w = 19, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18099, .adv_w = 295, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18242, .adv_w = 293, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18394, .adv_w = 452, .box_w = 24, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18622, .adv_w = 305, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18765, .adv_w = 240, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18849, .adv_w = 273, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18999, .adv_w = 250, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19083, .adv_w = 193, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19160, .adv_w = 266, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 19304, .adv_w = 253, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19402, .adv_w = 336, .box_w = 21, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19549, .adv_w = 219, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19633, .adv_w = 284, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19724, .adv_w = 284, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19854, .adv_w = 236, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19945, .adv_w = 260, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20043, .adv_w = 326, .box_w = 16, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20155, .adv_w = 279, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20246, .adv_w = 263, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20344, .adv_w = 280, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20435, .adv_w = 285, .box_w = 15, .box_h = 19, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 20578, .adv_w = 232, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20669, .adv_w = 190, .box_w = 13, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 20760, .adv_w = 227, .box_w = 15, .box_h = 19, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 20903, .adv_w = 319, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 21128, .adv_w = 213, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21219, .adv_w = 282, .box_w = 15, .box_h = 18, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 21354, .adv_w = 246, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21438, .adv_w = 382, .box_w = 20, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21578, .adv_w = 382, .box_w = 22, .box_h = 17, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 21765, .adv_w = 252, .box_w = 16, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 21877, .adv_w = 319, .box_w = 16, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21989, .adv_w = 230, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22073, .adv_w = 236, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22171, .adv_w = 356, .box_w = 19, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22304, .adv_w = 250, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22388, .adv_w = 258, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22528, .adv_w = 253, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22661, .adv_w = 277, .box_w = 16, .box_h = 25, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 22861, .adv_w = 193, .box_w = 11, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22971, .adv_w = 236, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23062, .adv_w = 216, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23146, .adv_w = 110, .box_w = 3, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23176, .adv_w = 109, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23233, .adv_w = 111, .box_w = 8, .box_h = 25, .ofs_x = -3, .ofs_y = -5},
-    {.bitmap_index = 23333, .adv_w = 379, .box_w = 23, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23494, .adv_w = 390, .box_w = 22, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23648, .adv_w = 277, .box_w = 16, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 23808, .adv_w = 236, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23938, .adv_w = 284, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24068, .adv_w = 227, .box_w = 15, .box_h = 25, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 24256, .adv_w = 264, .box_w = 12, .box_h = 18, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 24364, .adv_w = 237, .box_w = 12, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 24502, .adv_w = 181, .box_w = 10, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24587, .adv_w = 208, .box_w = 13, .box_h = 1, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 24594, .adv_w = 416, .box_w = 26, .box_h = 1, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 24607, .adv_w = 83, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 24616, .adv_w = 83, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 24625, .adv_w = 83, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 24636, .adv_w = 147, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 24657, .adv_w = 147, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 24678, .adv_w = 253, .box_w = 14, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24699, .adv_w = 344, .box_w = 17, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24861, .adv_w = 498, .box_w = 27, .box_h = 19, .ofs_x = 3, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_26;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_26 = {
-#else
-lv_font_t montserrat_cyrillic_26 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 29,          /*The maximum line height required by the font*/
-    .base_line = 5,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -3,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_26,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_26*/
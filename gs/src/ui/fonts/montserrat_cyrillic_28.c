@@ -1,4409 +0,0 @@
-/*******************************************************************************
- * Size: 28 px
- * Bpp: 4
- * Opts: --bpp 4 --size 28 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_28.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_28
-#define MONTSERRAT_CYRILLIC_28 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_28
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x4f, 0x54, 0xf5, 0x3f, 0x43, 0xf4, 0x3f, 0x42,
-    0xf3, 0x2f, 0x32, 0xf3, 0x1f, 0x21, 0xf2, 0x1f,
-    0x20, 0xf1, 0xf, 0x10, 0xf1, 0x2, 0x0, 0x0,
-    0x0, 0x0, 0x40, 0x8f, 0x95, 0xf6,
-
-    /* U+0022 "\"" */
-    0xe5, 0x0, 0x6e, 0xe5, 0x0, 0x5d, 0xe5, 0x0,
-    0x5d, 0xd4, 0x0, 0x5d, 0xd4, 0x0, 0x5d, 0xd4,
-    0x0, 0x4c, 0xd4, 0x0, 0x4c, 0x41, 0x0, 0x14,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x2, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x0,
-    0x0, 0x5, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x60, 0x0, 0x0, 0x7a, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x9, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0xb6, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x2, 0x22, 0x6e, 0x22, 0x22,
-    0x22, 0xf4, 0x22, 0x21, 0x0, 0x0, 0x5, 0xc0,
-    0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7a, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0x80, 0x0, 0x0, 0x5c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb6, 0x0, 0x0, 0x7, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x40, 0x0, 0x0,
-    0x99, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x2, 0x22, 0x4f,
-    0x32, 0x22, 0x22, 0xd6, 0x22, 0x21, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0xe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0x0, 0x0, 0x0, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x2f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x99, 0x0, 0x0,
-    0x4, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x70,
-    0x0, 0x0, 0x6b, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7c, 0xef, 0xfd, 0xa6, 0x0, 0x0, 0x4, 0xee,
-    0x96, 0xf6, 0x6a, 0xfe, 0x60, 0x3, 0xfa, 0x0,
-    0xe, 0x20, 0x0, 0x77, 0x0, 0xbd, 0x0, 0x0,
-    0xe2, 0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0xe,
-    0x20, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0xe, 0x20,
-    0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb4, 0xe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xf8, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6f, 0xef, 0xe8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xe2, 0x28, 0xee, 0x40,
-    0x0, 0x0, 0x0, 0xe, 0x20, 0x1, 0xcf, 0x10,
-    0x0, 0x0, 0x0, 0xe2, 0x0, 0x1, 0xf7, 0x0,
-    0x0, 0x0, 0xe, 0x20, 0x0, 0xd, 0x90, 0x0,
-    0x0, 0x0, 0xe2, 0x0, 0x0, 0xe8, 0x15, 0x0,
-    0x0, 0xe, 0x20, 0x0, 0x3f, 0x44, 0xfa, 0x20,
-    0x0, 0xe2, 0x0, 0x3e, 0xc0, 0x3, 0xdf, 0xc7,
-    0x5f, 0x67, 0xbf, 0xb1, 0x0, 0x0, 0x49, 0xdf,
-    0xff, 0xda, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x71, 0x0,
-    0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x6d, 0xdd, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xc6, 0x0, 0x0, 0x8b, 0x10, 0x9, 0xa0, 0x0,
-    0x0, 0x0, 0x7b, 0x0, 0x0, 0x2e, 0x10, 0x0,
-    0xc, 0x40, 0x0, 0x0, 0x2e, 0x10, 0x0, 0x7,
-    0x90, 0x0, 0x0, 0x6a, 0x0, 0x0, 0xc, 0x60,
-    0x0, 0x0, 0xa6, 0x0, 0x0, 0x3, 0xd0, 0x0,
-    0x7, 0xb0, 0x0, 0x0, 0xb, 0x50, 0x0, 0x0,
-    0x2e, 0x0, 0x2, 0xe1, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x0, 0x3, 0xd0, 0x0, 0xc6, 0x0, 0x0,
-    0x0, 0x7, 0x90, 0x0, 0x0, 0x7a, 0x0, 0x7b,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x10, 0x0, 0xd,
-    0x40, 0x2e, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0x30, 0x2b, 0xa0, 0xc, 0x60, 0x8, 0xef, 0xc5,
-    0x0, 0x0, 0x6d, 0xfd, 0x70, 0x8, 0xb0, 0xc,
-    0x91, 0x4, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xe1, 0x6, 0xb0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xd5, 0x0, 0xc5, 0x0, 0x0, 0xb,
-    0x50, 0x0, 0x0, 0x0, 0x8b, 0x0, 0xf, 0x10,
-    0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0x3e, 0x10,
-    0x0, 0xf0, 0x0, 0x0, 0x7, 0x90, 0x0, 0x0,
-    0xd, 0x50, 0x0, 0xf, 0x10, 0x0, 0x0, 0x88,
-    0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0xc4, 0x0,
-    0x0, 0xb, 0x50, 0x0, 0x3, 0xe1, 0x0, 0x0,
-    0x6, 0xa0, 0x0, 0x2, 0xe1, 0x0, 0x0, 0xd5,
-    0x0, 0x0, 0x0, 0xc, 0x70, 0x2, 0xd6, 0x0,
-    0x0, 0x8a, 0x0, 0x0, 0x0, 0x0, 0x8, 0xdd,
-    0xc5, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x29, 0xef, 0xeb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xeb, 0x42, 0x39, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x9b,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0,
-    0x5e, 0x0, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x6d, 0x0, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf3, 0x0, 0x1c, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x15, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfe, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xd3, 0x1e, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xea, 0x0, 0x2, 0xea,
-    0x0, 0x0, 0x56, 0x0, 0xc, 0xb0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0xa9, 0x0, 0x4f, 0x10, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0xf4, 0x0, 0x8d, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x76, 0xe0, 0x0, 0x8e,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x70, 0x0,
-    0x4f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50,
-    0x0, 0xc, 0xd2, 0x0, 0x0, 0x0, 0x1b, 0xe8,
-    0xf4, 0x0, 0x1, 0xcf, 0x95, 0x33, 0x59, 0xfb,
-    0x10, 0x8f, 0x30, 0x0, 0x5, 0xbe, 0xff, 0xda,
-    0x40, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x10,
-
-    /* U+0027 "'" */
-    0xe5, 0xe5, 0xe5, 0xd4, 0xd4, 0xd4, 0xd4, 0x41,
-
-    /* U+0028 "(" */
-    0x0, 0xe, 0x60, 0x7, 0xe0, 0x0, 0xe7, 0x0,
-    0x4f, 0x10, 0xa, 0xb0, 0x0, 0xe7, 0x0, 0x2f,
-    0x30, 0x5, 0xf0, 0x0, 0x7d, 0x0, 0xa, 0xb0,
-    0x0, 0xba, 0x0, 0xc, 0x90, 0x0, 0xd8, 0x0,
-    0xd, 0x80, 0x0, 0xd8, 0x0, 0xc, 0x90, 0x0,
-    0xba, 0x0, 0xa, 0xb0, 0x0, 0x7d, 0x0, 0x5,
-    0xf0, 0x0, 0x2f, 0x30, 0x0, 0xe7, 0x0, 0x9,
-    0xb0, 0x0, 0x4f, 0x10, 0x0, 0xe7, 0x0, 0x7,
-    0xe0, 0x0, 0xe, 0x60,
-
-    /* U+0029 ")" */
-    0x6e, 0x0, 0x0, 0xe7, 0x0, 0x7, 0xe0, 0x0,
-    0x1f, 0x40, 0x0, 0xb9, 0x0, 0x7, 0xe0, 0x0,
-    0x3f, 0x20, 0x0, 0xf5, 0x0, 0xd, 0x80, 0x0,
-    0xba, 0x0, 0xa, 0xb0, 0x0, 0x9d, 0x0, 0x8,
-    0xd0, 0x0, 0x8d, 0x0, 0x8, 0xd0, 0x0, 0x9d,
-    0x0, 0xa, 0xb0, 0x0, 0xba, 0x0, 0xd, 0x80,
-    0x0, 0xf5, 0x0, 0x3f, 0x20, 0x7, 0xe0, 0x0,
-    0xb9, 0x0, 0x1f, 0x40, 0x7, 0xd0, 0x0, 0xe7,
-    0x0, 0x6e, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x3b, 0x0, 0x0, 0x0, 0x0, 0x3b,
-    0x0, 0x0, 0x1b, 0x20, 0x3b, 0x0, 0x78, 0x7,
-    0xe9, 0x4b, 0x4d, 0xb2, 0x0, 0x19, 0xff, 0xd4,
-    0x0, 0x0, 0x8, 0xff, 0xc3, 0x0, 0x6, 0xea,
-    0x5b, 0x5e, 0xa2, 0x1c, 0x30, 0x3b, 0x0, 0x89,
-    0x0, 0x0, 0x3b, 0x0, 0x0, 0x0, 0x0, 0x3b,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x3, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x90, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x33, 0x33, 0x3b, 0xa3, 0x33, 0x33,
-    0x0, 0x0, 0xa, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x60, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x4, 0x24, 0xfe, 0x2e, 0xe0, 0x99, 0xc, 0x50,
-    0xf1, 0x4c, 0x0,
-
-    /* U+002D "-" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x13, 0x33, 0x33, 0x33,
-
-    /* U+002E "." */
-    0x5, 0x24, 0xfe, 0x2e, 0xa0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0,
-    0x0, 0x1, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x7, 0xcf, 0xfe, 0xa3, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0x96, 0x57, 0xcf, 0x80, 0x0,
-    0x0, 0x3f, 0xb1, 0x0, 0x0, 0x6, 0xf9, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0x6, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x1f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x4f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0x4f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0x1f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x6, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x3f, 0xb1, 0x0, 0x0, 0x6, 0xf9, 0x0,
-    0x0, 0x3, 0xef, 0x96, 0x57, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x7, 0xcf, 0xfe, 0xa3, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xcf, 0xff, 0xff, 0x73, 0x55, 0x55, 0xf7, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0xf7, 0x0, 0x0,
-    0xf, 0x70, 0x0, 0x0, 0xf7, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0xf7, 0x0, 0x0, 0xf, 0x70,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0xf, 0x70, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0,
-    0xf7, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0xf7,
-
-    /* U+0032 "2" */
-    0x0, 0x4, 0xad, 0xff, 0xec, 0x60, 0x0, 0x0,
-    0x2c, 0xfc, 0x86, 0x56, 0xaf, 0xd2, 0x0, 0x2f,
-    0xc2, 0x0, 0x0, 0x0, 0x2d, 0xd0, 0x0, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfb, 0x55, 0x55, 0x55, 0x55, 0x55, 0x30, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0033 "3" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x45, 0x55, 0x55, 0x55, 0x55, 0xce, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xc8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x33, 0x48,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x6,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x5,
-    0xef, 0xb7, 0x65, 0x69, 0xef, 0x50, 0x0, 0x0,
-    0x5a, 0xdf, 0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe9, 0x0,
-    0x0, 0x8, 0xa0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0xae, 0x10,
-    0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x4f, 0x60,
-    0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x3b, 0xd3, 0x33, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xac, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x1, 0xf7, 0x55, 0x55, 0x55, 0x55, 0x20, 0x0,
-    0x3f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xab, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x3, 0x33, 0x33, 0x46,
-    0x9e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x9, 0x10, 0x0, 0x0, 0x0, 0x0, 0xae, 0x1,
-    0xed, 0x40, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x1,
-    0xaf, 0xd9, 0x65, 0x68, 0xdf, 0x70, 0x0, 0x0,
-    0x28, 0xce, 0xff, 0xd9, 0x20, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xec, 0x81, 0x0,
-    0x0, 0x1b, 0xfb, 0x75, 0x45, 0x8d, 0x70, 0x0,
-    0x1e, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x17, 0xcf,
-    0xff, 0xc6, 0x0, 0x7, 0xf0, 0x3e, 0xc7, 0x43,
-    0x59, 0xfd, 0x20, 0x7f, 0x2e, 0x60, 0x0, 0x0,
-    0x2, 0xdd, 0x6, 0xfb, 0x80, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xc1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xe0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x2e, 0xc0, 0x0,
-    0x5, 0xfd, 0x74, 0x45, 0x9f, 0xc1, 0x0, 0x0,
-    0x1, 0x8c, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+0037 "7" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xf, 0x95, 0x55, 0x55, 0x55, 0x55, 0x5d, 0xc0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x50,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0,
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x7b, 0xef, 0xfd, 0xa4, 0x0, 0x0,
-    0x0, 0x3e, 0xe9, 0x54, 0x46, 0xaf, 0xb1, 0x0,
-    0x2, 0xfb, 0x10, 0x0, 0x0, 0x3, 0xec, 0x0,
-    0x9, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40,
-    0xd, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x80,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0x80,
-    0xa, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x50,
-    0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0x7f, 0x93, 0x0, 0x0, 0x5c, 0xe3, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x8f, 0xa5, 0x33, 0x33, 0x7d, 0xe5, 0x0,
-    0xa, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x50,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x9f, 0xd8, 0x54, 0x46, 0x9e, 0xe4, 0x0,
-    0x0, 0x2, 0x8c, 0xef, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x7c, 0xff, 0xfc, 0x71, 0x0, 0x0,
-    0x0, 0x3e, 0xe8, 0x54, 0x57, 0xde, 0x40, 0x0,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x60,
-    0x1f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xe, 0xb0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xf2,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x4, 0xe5, 0xf4,
-    0x0, 0x7f, 0xb5, 0x10, 0x14, 0xaf, 0x51, 0xf4,
-    0x0, 0x3, 0xbf, 0xff, 0xff, 0xa2, 0x2, 0xf4,
-    0x0, 0x0, 0x0, 0x23, 0x20, 0x0, 0x3, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xc0, 0x0,
-    0x0, 0x9d, 0x85, 0x45, 0x8d, 0xfa, 0x0, 0x0,
-    0x0, 0x29, 0xdf, 0xff, 0xd9, 0x30, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x2e, 0xa4, 0xfe, 0x5, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x24, 0xfe, 0x2e, 0xa0,
-
-    /* U+003B ";" */
-    0x2e, 0xa4, 0xfe, 0x5, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x24, 0xfe, 0x2e, 0xe0, 0x99,
-    0xc, 0x50, 0xf1, 0x4c, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0,
-    0x0, 0x0, 0x29, 0xfd, 0x0, 0x0, 0x0, 0x5c,
-    0xfb, 0x40, 0x0, 0x1, 0x8e, 0xe8, 0x20, 0x0,
-    0x4, 0xbf, 0xc5, 0x0, 0x0, 0x0, 0xdf, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0xee, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xbf, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x8f, 0xe7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3a, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
-
-    /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x23, 0x33,
-    0x33, 0x33, 0x33, 0x32, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x23, 0x33, 0x33, 0x33, 0x33, 0x32,
-
-    /* U+003E ">" */
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x8e, 0xe7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xfa, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x39, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xed, 0x0, 0x0, 0x0, 0x5b, 0xfb, 0x40,
-    0x0, 0x1, 0x8e, 0xe8, 0x20, 0x0, 0x4, 0xbf,
-    0xc5, 0x0, 0x0, 0x0, 0xdf, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x5, 0xae, 0xff, 0xeb, 0x60, 0x0, 0x3,
-    0xdf, 0xa6, 0x44, 0x6a, 0xfd, 0x20, 0x4f, 0xa1,
-    0x0, 0x0, 0x0, 0x3e, 0xd0, 0x6, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbd, 0xff, 0xfd,
-    0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xa6, 0x31, 0x11, 0x36, 0xaf, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xe9, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcb, 0x0, 0x0, 0x0, 0xa,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbb, 0x0, 0x0, 0x6, 0xe1, 0x0, 0x0,
-    0x7, 0xcf, 0xfd, 0x92, 0x0, 0xe6, 0x0, 0xd7,
-    0x0, 0x0, 0xe5, 0x0, 0x0, 0x3e, 0xc5, 0x21,
-    0x37, 0xe6, 0xe, 0x60, 0x3, 0xf1, 0x0, 0x6d,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x1, 0xc6,
-    0xe6, 0x0, 0xb, 0x70, 0xc, 0x60, 0x0, 0xc,
-    0xa0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x60, 0x0,
-    0x5d, 0x1, 0xf1, 0x0, 0x4, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0xf1, 0x4e,
-    0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x60, 0x0, 0xd, 0x46, 0xc0, 0x0, 0xb,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xc5, 0x6b, 0x0, 0x0, 0xc8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x60, 0x0, 0xb, 0x66,
-    0xb0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0xb5, 0x5c, 0x0, 0x0,
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0xd, 0x43, 0xe0, 0x0, 0x4, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0xf1,
-    0xf, 0x20, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x2, 0xee, 0x60, 0x0, 0x4d, 0x0, 0xc7, 0x0,
-    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x2, 0xd6, 0xd8,
-    0x0, 0xb, 0x70, 0x6, 0xd0, 0x0, 0x0, 0x3e,
-    0xd7, 0x32, 0x49, 0xf7, 0x8, 0xf5, 0x39, 0xd0,
-    0x0, 0xe, 0x50, 0x0, 0x0, 0x7, 0xcf, 0xfd,
-    0x92, 0x0, 0x9, 0xef, 0xa1, 0x0, 0x0, 0x5e,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xad, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x81, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b,
-    0xfa, 0x63, 0x21, 0x25, 0x8e, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef,
-    0xff, 0xd9, 0x50, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe7, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x4f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x80, 0xd, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x20, 0x6,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xca,
-    0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x1f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0,
-    0x0, 0x0, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x1,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0x43, 0x33,
-    0x33, 0x33, 0x33, 0x37, 0xf2, 0x0, 0x0, 0xda,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x10, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x70, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xe0, 0xae, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5,
-
-    /* U+0042 "B" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x40, 0x0,
-    0x9, 0xe4, 0x44, 0x44, 0x44, 0x46, 0xbf, 0xb0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xa0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x20, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf5, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x40, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf1, 0x9, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xda, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x1, 0x38, 0xeb, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x10, 0x0, 0x9e, 0x33, 0x33,
-    0x33, 0x33, 0x47, 0xbf, 0x80, 0x9, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x59,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x19, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x80, 0x9e, 0x44, 0x44, 0x44, 0x44, 0x57, 0xcf,
-    0x90, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9,
-    0x30, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x1a, 0xfe, 0x97, 0x56, 0x8b,
-    0xfd, 0x40, 0x0, 0x3, 0xee, 0x50, 0x0, 0x0,
-    0x0, 0x2a, 0xf5, 0x0, 0x3f, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x61, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x61, 0x0, 0x3, 0xee, 0x50, 0x0, 0x0, 0x0,
-    0x2a, 0xf5, 0x0, 0x0, 0x1a, 0xfe, 0x96, 0x56,
-    0x8b, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x28, 0xce,
-    0xff, 0xda, 0x50, 0x0,
-
-    /* U+0044 "D" */
-    0x9f, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x30, 0x0,
-    0x0, 0x9, 0xe5, 0x55, 0x55, 0x55, 0x69, 0xdf,
-    0xc3, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0xf6, 0x0, 0x9, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x9,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xa0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x19, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf5, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x79, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x99, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x59, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf1, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xea, 0x9, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xcf, 0x60, 0x0, 0x9e, 0x55, 0x55, 0x55, 0x56,
-    0x9d, 0xfc, 0x30, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x93, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9e,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x9e, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x10, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x54, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+0046 "F" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9e,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x9e, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x10, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xea, 0x60,
-    0x0, 0x0, 0x0, 0x1a, 0xfe, 0xa7, 0x55, 0x7b,
-    0xfe, 0x60, 0x0, 0x3, 0xee, 0x60, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x3f, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x43, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8b, 0x5f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9c, 0x2f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9c, 0xd, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x7, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0x0, 0x3f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9c, 0x0, 0x3, 0xee, 0x60, 0x0, 0x0, 0x0,
-    0x18, 0xf9, 0x0, 0x0, 0x1a, 0xfe, 0xa7, 0x55,
-    0x7b, 0xff, 0x70, 0x0, 0x0, 0x0, 0x28, 0xce,
-    0xff, 0xda, 0x60, 0x0,
-
-    /* U+0048 "H" */
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x69, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x69, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x69, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x69, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x69, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x9e, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x4f, 0x69, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x69, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x69,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x69, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x69, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6,
-
-    /* U+0049 "I" */
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-    0x9d, 0x9d, 0x9d, 0x9d,
-
-    /* U+004A "J" */
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x5,
-    0x55, 0x55, 0x55, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x6, 0x20, 0x0, 0x0, 0x5, 0xf3, 0xc, 0xd2,
-    0x0, 0x0, 0x1d, 0xc0, 0x1, 0xcf, 0xa6, 0x57,
-    0xef, 0x30, 0x0, 0x6, 0xcf, 0xfe, 0x92, 0x0,
-
-    /* U+004B "K" */
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x9, 0xd0, 0x0, 0x0, 0x3, 0xf9,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x2, 0xea,
-    0x0, 0x0, 0x0, 0x9, 0xd0, 0x0, 0x2, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x2, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xd0, 0x1, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x1, 0xdd,
-    0x8f, 0x60, 0x0, 0x0, 0x0, 0x9, 0xd1, 0xcd,
-    0x10, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9e, 0xcd,
-    0x10, 0x0, 0xbe, 0x20, 0x0, 0x0, 0x9, 0xfe,
-    0x20, 0x0, 0x1, 0xdd, 0x10, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x2, 0xeb, 0x0, 0x0, 0x9,
-    0xd0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe1,
-
-    /* U+004C "L" */
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x50, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2,
-
-    /* U+004D "M" */
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x59, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x59,
-    0xdd, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xda, 0xf5, 0x9d, 0x4f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0x2f, 0x59, 0xd0, 0xbb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x61, 0xf5, 0x9d,
-    0x2, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xd0,
-    0x1f, 0x59, 0xd0, 0x9, 0xd0, 0x0, 0x0, 0x0,
-    0x2, 0xf4, 0x1, 0xf5, 0x9d, 0x0, 0x1f, 0x70,
-    0x0, 0x0, 0x0, 0xab, 0x0, 0x1f, 0x59, 0xd0,
-    0x0, 0x7e, 0x10, 0x0, 0x0, 0x3f, 0x20, 0x1,
-    0xf5, 0x9d, 0x0, 0x0, 0xd9, 0x0, 0x0, 0xc,
-    0x90, 0x0, 0x1f, 0x59, 0xd0, 0x0, 0x4, 0xf2,
-    0x0, 0x5, 0xf1, 0x0, 0x1, 0xf5, 0x9d, 0x0,
-    0x0, 0xb, 0xb0, 0x0, 0xe7, 0x0, 0x0, 0x1f,
-    0x59, 0xd0, 0x0, 0x0, 0x2f, 0x40, 0x7d, 0x0,
-    0x0, 0x1, 0xf5, 0x9d, 0x0, 0x0, 0x0, 0x9d,
-    0x1f, 0x50, 0x0, 0x0, 0x1f, 0x59, 0xd0, 0x0,
-    0x0, 0x1, 0xfe, 0xc0, 0x0, 0x0, 0x1, 0xf5,
-    0x9d, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0,
-    0x0, 0xf, 0x59, 0xd0, 0x0, 0x0, 0x0, 0x4,
-    0x0, 0x0, 0x0, 0x0, 0xf5, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x59,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf5,
-
-    /* U+004E "N" */
-    0x9e, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x69, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x69, 0xd7, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x9d, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x69, 0xd0, 0x1e, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x9d, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0xf, 0x69, 0xd0, 0x0, 0x6f, 0x60,
-    0x0, 0x0, 0x0, 0xf6, 0x9d, 0x0, 0x0, 0xaf,
-    0x20, 0x0, 0x0, 0xf, 0x69, 0xd0, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0xf6, 0x9d, 0x0, 0x0,
-    0x2, 0xfa, 0x0, 0x0, 0xf, 0x69, 0xd0, 0x0,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0xf6, 0x9d, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x0, 0xf, 0x69, 0xd0,
-    0x0, 0x0, 0x0, 0xc, 0xe1, 0x0, 0xf6, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xb0, 0xf, 0x69,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0xf6,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x5f,
-    0x69, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf6, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x69, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf6,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xe9, 0x65,
-    0x68, 0xcf, 0xe5, 0x0, 0x0, 0x0, 0x3, 0xee,
-    0x50, 0x0, 0x0, 0x0, 0x2a, 0xf9, 0x0, 0x0,
-    0x2, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf9, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf5, 0x0, 0x7f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0xd,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x52, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xda, 0x5f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd6, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xe5, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x2f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xa0, 0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x7, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x50,
-    0x0, 0x2f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x90, 0x0, 0x0, 0x3e, 0xe5, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x1a,
-    0xfe, 0x96, 0x56, 0x8c, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa5, 0x0,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x9f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
-    0x9e, 0x55, 0x55, 0x55, 0x58, 0xcf, 0xc1, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x3, 0xde, 0x10,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf1,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x9d, 0x11, 0x11, 0x11, 0x14, 0x8e, 0xe4, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x10, 0x0,
-    0x9e, 0x44, 0x44, 0x43, 0x31, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xfe, 0x96,
-    0x56, 0x8c, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3,
-    0xee, 0x50, 0x0, 0x0, 0x0, 0x2a, 0xf9, 0x0,
-    0x0, 0x0, 0x2f, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0, 0x7,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbe, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x2f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0,
-    0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xd0, 0x6f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xe0, 0x6f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xe0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0x2f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0xd,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x7, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x0, 0x2f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x90, 0x0, 0x0, 0x3, 0xee, 0x50, 0x0,
-    0x0, 0x0, 0x2a, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xfe, 0x96, 0x56, 0x8c, 0xfe, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xfa,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x23, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb4, 0x10,
-    0x28, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xaf, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x10, 0x0,
-
-    /* U+0052 "R" */
-    0x9f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
-    0x9e, 0x55, 0x55, 0x55, 0x58, 0xcf, 0xc1, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x3, 0xde, 0x10,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf1,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x9d, 0x0, 0x0, 0x0, 0x13, 0x7e, 0xe3, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x10, 0x0,
-    0x9e, 0x33, 0x33, 0x33, 0x37, 0xf3, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x90,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4,
-
-    /* U+0053 "S" */
-    0x0, 0x1, 0x7c, 0xef, 0xfd, 0xa6, 0x0, 0x0,
-    0x4, 0xee, 0x96, 0x45, 0x6a, 0xfe, 0x60, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x77, 0x0, 0xbd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xb7,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xef,
-    0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
-    0xee, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x15, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x44,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x3e, 0xc0, 0x3,
-    0xdf, 0xc7, 0x54, 0x57, 0xbf, 0xb1, 0x0, 0x0,
-    0x49, 0xdf, 0xff, 0xda, 0x40, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x45, 0x55, 0x55, 0x5e, 0xb5, 0x55, 0x55, 0x53,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd9,
-    0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0xa, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x1, 0xde, 0x30, 0x0, 0x0, 0x2, 0xcf, 0x20,
-    0x0, 0x1c, 0xfc, 0x76, 0x57, 0xbf, 0xd3, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xd0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x60, 0xb, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x4, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf1, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xa0, 0x0, 0x0, 0xf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x8,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0x2, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
-    0x9, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x1f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0x7f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x5,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x10, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x3f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xe0, 0xad, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x76, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf2, 0x1f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xbe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9c, 0x0, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xe2, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x70, 0x6, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xc8, 0xc, 0x90, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x0, 0x1f, 0x70, 0x0, 0x0, 0x0, 0x2f, 0x30,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0x7, 0xd0, 0x1, 0xf4,
-    0x0, 0x0, 0x0, 0xe, 0x70, 0x0, 0x6, 0xf1,
-    0x0, 0x0, 0x0, 0xd8, 0x0, 0xc, 0xa0, 0x0,
-    0x0, 0x4, 0xf2, 0x0, 0x0, 0x1f, 0x70, 0x0,
-    0x0, 0x2f, 0x30, 0x0, 0x6f, 0x0, 0x0, 0x0,
-    0x9c, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x8,
-    0xd0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0xe, 0x70,
-    0x0, 0x0, 0x6, 0xf1, 0x0, 0x0, 0xd8, 0x0,
-    0x0, 0xc, 0xa0, 0x0, 0x4, 0xf2, 0x0, 0x0,
-    0x0, 0x1f, 0x60, 0x0, 0x3f, 0x20, 0x0, 0x0,
-    0x6f, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x8, 0xd0, 0x0, 0x0, 0x1, 0xf5,
-    0x0, 0xe, 0x70, 0x0, 0x0, 0x0, 0x6, 0xf1,
-    0x0, 0xe8, 0x0, 0x0, 0x0, 0xb, 0xa0, 0x4,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x60, 0x3f,
-    0x20, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x9c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbc, 0x9, 0xd0, 0x0,
-    0x0, 0x0, 0x1, 0xf5, 0xe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf1, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xa4, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xaf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xad, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x8, 0xe1, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0x0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0xae, 0x10,
-    0x0, 0x1, 0xe9, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x33, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xed, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x68,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xea,
-    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xe1, 0x0, 0x1e, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x30, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x0, 0x0, 0x9e, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xe1,
-
-    /* U+0059 "Y" */
-    0x9e, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf1, 0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x70, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xad, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0x0, 0x2f, 0x60, 0x0,
-    0x0, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x8, 0xe1,
-    0x0, 0x0, 0x0, 0x6f, 0x10, 0x0, 0x0, 0x0,
-    0xe9, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0xa, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xc0, 0x0, 0x3f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0xda, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x16, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x9f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xb5, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1,
-
-    /* U+005B "[" */
-    0x9f, 0xff, 0xe9, 0xd3, 0x33, 0x9d, 0x0, 0x9,
-    0xd0, 0x0, 0x9d, 0x0, 0x9, 0xd0, 0x0, 0x9d,
-    0x0, 0x9, 0xd0, 0x0, 0x9d, 0x0, 0x9, 0xd0,
-    0x0, 0x9d, 0x0, 0x9, 0xd0, 0x0, 0x9d, 0x0,
-    0x9, 0xd0, 0x0, 0x9d, 0x0, 0x9, 0xd0, 0x0,
-    0x9d, 0x0, 0x9, 0xd0, 0x0, 0x9d, 0x0, 0x9,
-    0xd0, 0x0, 0x9d, 0x0, 0x9, 0xd0, 0x0, 0x9d,
-    0x0, 0x9, 0xd0, 0x0, 0x9d, 0x0, 0x9, 0xd3,
-    0x33, 0x9f, 0xff, 0xe0,
-
-    /* U+005C "\\" */
-    0xc8, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x6, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xaa, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9b,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x8c, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x70,
-
-    /* U+005D "]" */
-    0x5f, 0xff, 0xf2, 0x13, 0x36, 0xf2, 0x0, 0x4,
-    0xf2, 0x0, 0x4, 0xf2, 0x0, 0x4, 0xf2, 0x0,
-    0x4, 0xf2, 0x0, 0x4, 0xf2, 0x0, 0x4, 0xf2,
-    0x0, 0x4, 0xf2, 0x0, 0x4, 0xf2, 0x0, 0x4,
-    0xf2, 0x0, 0x4, 0xf2, 0x0, 0x4, 0xf2, 0x0,
-    0x4, 0xf2, 0x0, 0x4, 0xf2, 0x0, 0x4, 0xf2,
-    0x0, 0x4, 0xf2, 0x0, 0x4, 0xf2, 0x0, 0x4,
-    0xf2, 0x0, 0x4, 0xf2, 0x0, 0x4, 0xf2, 0x0,
-    0x4, 0xf2, 0x0, 0x4, 0xf2, 0x0, 0x4, 0xf2,
-    0x0, 0x4, 0xf2, 0x13, 0x36, 0xf2, 0x5f, 0xff,
-    0xf2,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x5, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7a, 0xa7,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0x4d, 0x0, 0x0,
-    0x0, 0x5, 0xd0, 0xd, 0x40, 0x0, 0x0, 0xb,
-    0x60, 0x7, 0xb0, 0x0, 0x0, 0x2f, 0x0, 0x1,
-    0xf2, 0x0, 0x0, 0x99, 0x0, 0x0, 0x99, 0x0,
-    0x0, 0xf2, 0x0, 0x0, 0x3f, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0xc, 0x60, 0xd, 0x50, 0x0, 0x0,
-    0x6, 0xd0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0xe4,
-
-    /* U+005F "_" */
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-
-    /* U+0060 "`" */
-    0x48, 0x30, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x3, 0xe7,
-
-    /* U+0061 "a" */
-    0x0, 0x5, 0xae, 0xff, 0xd9, 0x10, 0x0, 0x3d,
-    0xfa, 0x64, 0x58, 0xee, 0x30, 0xb, 0xa1, 0x0,
-    0x0, 0x1, 0xdd, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x3, 0x9d,
-    0xef, 0xff, 0xff, 0xf8, 0x6, 0xfa, 0x42, 0x22,
-    0x22, 0x2e, 0x81, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xe8, 0x4f, 0x10, 0x0, 0x0, 0x0, 0xe, 0x84,
-    0xf1, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x1f, 0x80,
-    0x0, 0x0, 0x2, 0xde, 0x80, 0x5f, 0xa3, 0x11,
-    0x38, 0xe4, 0xd8, 0x0, 0x3a, 0xef, 0xfd, 0x92,
-    0xd, 0x80,
-
-    /* U+0062 "b" */
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x6, 0xcf, 0xfe, 0xa4, 0x0, 0x0,
-    0xf, 0x62, 0xde, 0x85, 0x56, 0xbf, 0xb1, 0x0,
-    0xf, 0x7e, 0x90, 0x0, 0x0, 0x3, 0xec, 0x0,
-    0xf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0xf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0xf, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0xf, 0x6e, 0x90, 0x0, 0x0, 0x3, 0xec, 0x0,
-    0xf, 0x52, 0xde, 0x85, 0x46, 0xbf, 0xb1, 0x0,
-    0xf, 0x50, 0x6, 0xcf, 0xfe, 0xa4, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x4a, 0xef, 0xfc, 0x81, 0x0, 0x0,
-    0x1b, 0xfb, 0x65, 0x58, 0xee, 0x40, 0x0, 0xde,
-    0x30, 0x0, 0x0, 0xa, 0xf1, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x40, 0x1f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x30, 0x0, 0xce, 0x30, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0x1b, 0xfb, 0x64, 0x58,
-    0xee, 0x40, 0x0, 0x0, 0x4a, 0xef, 0xfc, 0x81,
-    0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x5b,
-    0xef, 0xeb, 0x60, 0x7, 0xf0, 0x1, 0xcf, 0xb6,
-    0x55, 0x9e, 0xc1, 0x7f, 0x0, 0xde, 0x30, 0x0,
-    0x0, 0xa, 0xd7, 0xf0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0xb, 0xef, 0x1f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf6, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf6, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0xb, 0xef, 0x0,
-    0xde, 0x30, 0x0, 0x0, 0xa, 0xd7, 0xf0, 0x1,
-    0xcf, 0xa6, 0x45, 0x8e, 0xd1, 0x6f, 0x0, 0x0,
-    0x5b, 0xef, 0xfc, 0x60, 0x6, 0xf0,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x6b, 0xff, 0xea, 0x30, 0x0, 0x0,
-    0x2, 0xdf, 0x95, 0x46, 0xbf, 0x90, 0x0, 0x1,
-    0xec, 0x10, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0xad,
-    0x10, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x1f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xac, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf1, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x49, 0xfe, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xf5, 0x8d, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x30, 0x0, 0x0, 0x4,
-    0xe2, 0x0, 0x1, 0xbf, 0xb6, 0x44, 0x7c, 0xf8,
-    0x0, 0x0, 0x0, 0x4a, 0xef, 0xfd, 0x93, 0x0,
-    0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x2a, 0xef, 0xd7, 0x0, 0x0, 0x1e,
-    0xc5, 0x46, 0xb0, 0x0, 0x8, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0xba, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf4, 0x1, 0x33,
-    0xcb, 0x33, 0x33, 0x10, 0x0, 0xc, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xca, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xca, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xca, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xca,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xca, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xa0, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x4b, 0xef, 0xfc, 0x60, 0x3, 0xf2,
-    0x0, 0x1b, 0xf9, 0x43, 0x36, 0xcd, 0x23, 0xf2,
-    0x0, 0xdd, 0x20, 0x0, 0x0, 0x6, 0xe5, 0xf2,
-    0x9, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xf2,
-    0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x8d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xa, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2,
-    0x1, 0xec, 0x10, 0x0, 0x0, 0x5, 0xf7, 0xf2,
-    0x0, 0x3e, 0xe7, 0x21, 0x14, 0xaf, 0x44, 0xf1,
-    0x0, 0x1, 0x8e, 0xff, 0xff, 0xa2, 0x4, 0xf1,
-    0x0, 0x0, 0x0, 0x23, 0x20, 0x0, 0x6, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xc0,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70,
-    0x6, 0xe5, 0x0, 0x0, 0x0, 0x1, 0xcd, 0x0,
-    0x0, 0x9f, 0xe9, 0x64, 0x46, 0x9f, 0xd2, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x19,
-    0xdf, 0xfd, 0x92, 0x0, 0x0, 0xf6, 0x5f, 0xc7,
-    0x55, 0x8e, 0xf5, 0x0, 0xf, 0x9e, 0x50, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xe, 0x90, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x0,
-
-    /* U+0069 "i" */
-    0x3f, 0x86, 0xfb, 0x4, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf,
-    0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6,
-    0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf, 0x60,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x2, 0xea, 0x0, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x4, 0xf3, 0x3c, 0x53, 0x6e, 0xb0,
-    0x19, 0xef, 0xe9, 0x0,
-
-    /* U+006B "k" */
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0xc, 0xd2, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x1c, 0xd1, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x1d, 0xd1, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x2e,
-    0xc1, 0x0, 0x0, 0xf, 0x60, 0x0, 0x2e, 0xc0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x3e, 0xb0, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x5f, 0x97, 0xf5, 0x0, 0x0,
-    0x0, 0xf, 0xbf, 0x80, 0xa, 0xf2, 0x0, 0x0,
-    0x0, 0xff, 0x70, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x10, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x1, 0xeb, 0x0,
-
-    /* U+006C "l" */
-    0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf, 0x60,
-    0xf6, 0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf,
-    0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6,
-    0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf, 0x60,
-
-    /* U+006D "m" */
-    0xf, 0x50, 0x29, 0xdf, 0xfd, 0x80, 0x0, 0x1,
-    0x8d, 0xff, 0xe9, 0x20, 0x0, 0xf5, 0x5f, 0x94,
-    0x23, 0x7e, 0xe2, 0x4, 0xeb, 0x53, 0x35, 0xcf,
-    0x40, 0xf, 0x9e, 0x30, 0x0, 0x0, 0x1d, 0xc2,
-    0xf6, 0x0, 0x0, 0x0, 0xaf, 0x10, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x4f, 0xe9, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0x9, 0xd0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf0,
-
-    /* U+006E "n" */
-    0xf, 0x50, 0x29, 0xdf, 0xfd, 0x92, 0x0, 0x0,
-    0xf5, 0x5f, 0xa5, 0x33, 0x6c, 0xf5, 0x0, 0xf,
-    0x8e, 0x30, 0x0, 0x0, 0x9, 0xf2, 0x0, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xe, 0x90, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf0, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf0, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x0,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x4b, 0xef, 0xfc, 0x71, 0x0, 0x0,
-    0x1, 0xbf, 0xb6, 0x55, 0x9e, 0xe4, 0x0, 0x0,
-    0xde, 0x30, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x1f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x66, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbb, 0x8d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xe9, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x8d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xe6, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbb, 0x1f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x60, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x0, 0xde, 0x30, 0x0, 0x0, 0xa,
-    0xf4, 0x0, 0x1, 0xbf, 0xa6, 0x45, 0x8e, 0xe4,
-    0x0, 0x0, 0x0, 0x4b, 0xef, 0xfc, 0x71, 0x0,
-    0x0,
-
-    /* U+0070 "p" */
-    0xf, 0x50, 0x6, 0xcf, 0xfe, 0xa4, 0x0, 0x0,
-    0xf, 0x52, 0xde, 0x85, 0x56, 0xbf, 0xb1, 0x0,
-    0xf, 0x6e, 0x90, 0x0, 0x0, 0x3, 0xec, 0x0,
-    0xf, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0xf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0xf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0xf, 0x7e, 0x90, 0x0, 0x0, 0x3, 0xec, 0x0,
-    0xf, 0x62, 0xde, 0x85, 0x46, 0xbf, 0xb1, 0x0,
-    0xf, 0x60, 0x6, 0xcf, 0xfe, 0xa4, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x5b, 0xef, 0xeb, 0x60, 0x6, 0xf0,
-    0x1, 0xcf, 0xb6, 0x55, 0x9e, 0xc1, 0x6f, 0x0,
-    0xde, 0x30, 0x0, 0x0, 0xa, 0xd7, 0xf0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xb, 0xef, 0x1f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x8d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf9, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf6, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x1f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0xb, 0xef, 0x0, 0xde, 0x30, 0x0, 0x0, 0xa,
-    0xd7, 0xf0, 0x1, 0xcf, 0xa6, 0x45, 0x8e, 0xc1,
-    0x7f, 0x0, 0x0, 0x5b, 0xef, 0xeb, 0x60, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-
-    /* U+0072 "r" */
-    0xf, 0x50, 0x3a, 0xed, 0xf, 0x56, 0xf9, 0x53,
-    0xf, 0x9e, 0x20, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x4, 0xae, 0xff, 0xda, 0x40, 0x0, 0x9,
-    0xfa, 0x54, 0x46, 0xaf, 0xa0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x23, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb6, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xef, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0x9e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0xb, 0x50,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x9f, 0xd8, 0x54,
-    0x46, 0xbf, 0x60, 0x0, 0x28, 0xce, 0xff, 0xd9,
-    0x20, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xca,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0x40, 0x13, 0x3c,
-    0xb3, 0x33, 0x31, 0x0, 0x0, 0xca, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xca, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xca, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x53, 0x6c, 0x0, 0x0, 0x2,
-    0xbf, 0xfd, 0x70,
-
-    /* U+0075 "u" */
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xac, 0x3f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xac, 0x3f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xac, 0x3f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0x3f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xac, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xac, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xac, 0x2f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xcc, 0xf, 0x70,
-    0x0, 0x0, 0x0, 0x1, 0xfc, 0xb, 0xd0, 0x0,
-    0x0, 0x0, 0x9, 0xfc, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x7e, 0xac, 0x0, 0x7f, 0xd7, 0x44, 0x7d,
-    0xe2, 0x9c, 0x0, 0x3, 0xae, 0xff, 0xd7, 0x0,
-    0x9c,
-
-    /* U+0076 "v" */
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x74,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf1, 0xd,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x8, 0xe0,
-    0x0, 0x0, 0x2, 0xf4, 0x0, 0x0, 0x1f, 0x60,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0x7, 0xe0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x20, 0x5f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xd8, 0xc, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xec, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0,
-
-    /* U+0077 "w" */
-    0x8c, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xaa, 0x2f, 0x20, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf4,
-    0xc, 0x80, 0x0, 0x0, 0x0, 0x7d, 0xb9, 0x0,
-    0x0, 0x0, 0x5, 0xe0, 0x6, 0xe0, 0x0, 0x0,
-    0x0, 0xd7, 0x5f, 0x0, 0x0, 0x0, 0xb, 0x90,
-    0x1, 0xf4, 0x0, 0x0, 0x3, 0xf1, 0xf, 0x50,
-    0x0, 0x0, 0x1f, 0x30, 0x0, 0xb9, 0x0, 0x0,
-    0x9, 0xb0, 0x9, 0xb0, 0x0, 0x0, 0x7d, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0xe, 0x50, 0x3, 0xf1,
-    0x0, 0x0, 0xd7, 0x0, 0x0, 0xe, 0x50, 0x0,
-    0x5f, 0x0, 0x0, 0xd7, 0x0, 0x3, 0xf1, 0x0,
-    0x0, 0x9, 0xb0, 0x0, 0xb9, 0x0, 0x0, 0x7d,
-    0x0, 0x9, 0xb0, 0x0, 0x0, 0x3, 0xf1, 0x1,
-    0xf3, 0x0, 0x0, 0x1f, 0x30, 0xe, 0x50, 0x0,
-    0x0, 0x0, 0xd7, 0x6, 0xd0, 0x0, 0x0, 0xb,
-    0x90, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xc,
-    0x70, 0x0, 0x0, 0x5, 0xe0, 0xa9, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x5f, 0x10, 0x0, 0x0, 0x0,
-    0xe6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0xa, 0xd0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0xda, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0xda, 0x0, 0x0, 0x6, 0xf3,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0xad, 0x10,
-    0x6f, 0x20, 0x0, 0x0, 0x0, 0xd, 0xb3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0xdb, 0x0, 0x0, 0x0, 0x1,
-    0xe9, 0x0, 0x2f, 0x70, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x7f, 0x20, 0x0,
-    0x0, 0x9e, 0x10, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x1e, 0x90, 0x0, 0x0, 0x0, 0x2,
-    0xf8,
-
-    /* U+0079 "y" */
-    0xb, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7,
-    0x4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf1,
-    0x0, 0xca, 0x0, 0x0, 0x0, 0x0, 0xc, 0x90,
-    0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x3f, 0x30,
-    0x0, 0xe, 0x80, 0x0, 0x0, 0x0, 0xac, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x1, 0xf5, 0x0,
-    0x0, 0x1, 0xf6, 0x0, 0x0, 0x8, 0xd0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0xe, 0x70, 0x0,
-    0x0, 0x0, 0x2f, 0x40, 0x0, 0x6f, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xc0, 0x0, 0xc9, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf3, 0x3, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xca, 0xa, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x3f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x20, 0x0, 0x0, 0x0,
-    0x11, 0x0, 0x1, 0xe9, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0x74, 0x6d, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xdf, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x23, 0x33,
-    0x33, 0x33, 0x38, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x73,
-    0x33, 0x33, 0x33, 0x33, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xfd,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x9e, 0xf5, 0x0, 0x9, 0xf7, 0x31,
-    0x0, 0xe, 0x80, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x4f, 0xfa, 0x0, 0x0,
-    0x3, 0x8f, 0x20, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf, 0x80, 0x0, 0x0, 0x9, 0xf7, 0x31,
-    0x0, 0x0, 0x9e, 0xf5,
-
-    /* U+007C "|" */
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
-    0x9b, 0x9b, 0x9b,
-
-    /* U+007D "}" */
-    0x5f, 0xe9, 0x0, 0x0, 0x13, 0x7f, 0x90, 0x0,
-    0x0, 0x9, 0xe0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x3, 0xf8, 0x30, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x9, 0xe0, 0x0, 0x13, 0x7f, 0x90, 0x0,
-    0x5f, 0xe9, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x7e, 0xfa, 0x10, 0x0, 0x0, 0xe1, 0x7,
-    0xd4, 0x39, 0xe3, 0x0, 0x2, 0xe0, 0xe, 0x30,
-    0x0, 0x7f, 0x60, 0x2c, 0x70, 0x2e, 0x0, 0x0,
-    0x4, 0xef, 0xfa, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x2, 0x10, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x77, 0x0, 0xa, 0x40, 0x0, 0x5e,
-    0x10, 0xa, 0xb0, 0x0, 0x2f, 0x40, 0x6, 0xe1,
-    0x0, 0xd, 0x80, 0x3, 0xf3, 0x0, 0x9, 0xc0,
-    0x1, 0xe7, 0x0, 0x4, 0xf2, 0x0, 0xac, 0x0,
-    0x0, 0xd, 0x80, 0x3, 0xf3, 0x0, 0x0, 0x2f,
-    0x40, 0x7, 0xe1, 0x0, 0x0, 0x5e, 0x10, 0xa,
-    0xb0, 0x0, 0x0, 0x9c, 0x0, 0xd, 0x70, 0x0,
-    0x0, 0xc8, 0x0, 0x2f, 0x40,
-
-    /* U+00BB "»" */
-    0x68, 0x0, 0x9, 0x40, 0x0, 0x1, 0xe6, 0x0,
-    0x4e, 0x20, 0x0, 0x3, 0xf3, 0x0, 0x8c, 0x0,
-    0x0, 0x7, 0xd0, 0x0, 0xc9, 0x0, 0x0, 0xb,
-    0xa0, 0x1, 0xe5, 0x0, 0x0, 0x1f, 0x50, 0x5,
-    0xf1, 0x0, 0x7, 0xd1, 0x0, 0xc9, 0x0, 0x3,
-    0xf3, 0x0, 0x8d, 0x0, 0x1, 0xe6, 0x0, 0x4e,
-    0x20, 0x0, 0xba, 0x0, 0x1e, 0x50, 0x0, 0x7d,
-    0x0, 0xc, 0x80, 0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x7f, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x53, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x7, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x31, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x50, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x5, 0xf5, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x7f, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x53, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x7, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x31, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x50, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0,
-
-    /* U+0402 "Ђ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x35, 0x55, 0x55, 0x5c, 0xd5,
-    0x55, 0x55, 0x55, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x27, 0xbd, 0xee,
-    0xda, 0x40, 0x0, 0x0, 0x0, 0x0, 0xa, 0xed,
-    0xfd, 0x96, 0x55, 0x8c, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf7, 0x10, 0x0, 0x0, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf3, 0x0, 0x0, 0x0, 0xa,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd9, 0x0, 0x0, 0x0, 0xa, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc9, 0x0, 0x0, 0x0,
-    0xa, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xb0, 0x0, 0x0,
-    0x0, 0xa, 0xc0, 0x0, 0x5, 0x43, 0x48, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0xe,
-    0xff, 0xfc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x1, 0xce, 0x30, 0x0, 0x0,
-    0x0, 0x2, 0xdb, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x74, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x37, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x29, 0xdf, 0xff, 0xd9, 0x50,
-    0x0, 0x0, 0x0, 0x1a, 0xfe, 0x96, 0x56, 0x8b,
-    0xfd, 0x40, 0x0, 0x2, 0xee, 0x60, 0x0, 0x0,
-    0x0, 0x19, 0xf5, 0x0, 0x1e, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x40, 0x0, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x2f, 0x63, 0x33, 0x33, 0x33, 0x33,
-    0x20, 0x0, 0x0, 0x1f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x92, 0x0, 0x2, 0xee, 0x60, 0x0, 0x0, 0x0,
-    0x3c, 0xf4, 0x0, 0x0, 0x1a, 0xfe, 0x96, 0x56,
-    0x8d, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x29, 0xdf,
-    0xff, 0xd9, 0x40, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x6b, 0xef, 0xfe, 0xb7, 0x10, 0x0,
-    0x3, 0xef, 0xa6, 0x44, 0x69, 0xef, 0x80, 0x1,
-    0xec, 0x10, 0x0, 0x0, 0x0, 0x68, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff, 0xc8,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xdf,
-    0xe9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x72,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x2c, 0xd0, 0x2,
-    0xbf, 0xd8, 0x54, 0x56, 0xaf, 0xd2, 0x0, 0x0,
-    0x38, 0xce, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+0406 "І" */
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-    0x7f, 0x7f, 0x7f, 0x7f,
-
-    /* U+0407 "Ї" */
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x4, 0xf6,
-    0x2e, 0x70, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0x9, 0xd0, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x25,
-    0x55, 0x55, 0x57, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-    0x8, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x1f, 0xa0,
-    0x0, 0x0, 0x3f, 0x80, 0x3, 0xee, 0x85, 0x59,
-    0xfc, 0x0, 0x0, 0x18, 0xdf, 0xfd, 0x70, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xd5, 0x55, 0x55, 0x55, 0x55,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0,
-    0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x83, 0x33, 0x33, 0x34, 0x6a, 0xfc, 0x10,
-    0x0, 0x0, 0xd, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xc0,
-    0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0x0, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9,
-    0x0, 0x0, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x46, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xa6, 0x66, 0x66, 0x67, 0x9e, 0xfa, 0x0,
-    0xaf, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+040A "Њ" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x8f, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd9, 0x20, 0x0, 0x7f,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xaf, 0x44,
-    0x44, 0x44, 0x45, 0x9f, 0xf5, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0x30, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xa0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xd0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xce, 0x10, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x43, 0x33,
-    0x33, 0x35, 0x9f, 0xd2, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x45, 0x55, 0x55, 0x5d, 0xc5,
-    0x55, 0x55, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xa0, 0x49, 0xdf, 0xff,
-    0xea, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xee,
-    0xfb, 0x75, 0x44, 0x7d, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe6, 0x10, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0xc,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5, 0x0,
-    0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0xc, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0,
-    0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe8, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe8,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd1,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x20,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x80, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x9, 0xe1, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x7f, 0x11, 0x11, 0x2e, 0x90, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x44, 0x44, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x4e, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xe9, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x97, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf9, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x5d, 0x97, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0xd9, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0xd, 0x97, 0xf0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0xd9, 0x7f, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0xd, 0x97, 0xf0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0xd9, 0x7f,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0xd, 0x97,
-    0xf0, 0x0, 0x0, 0xae, 0x10, 0x0, 0x0, 0xd9,
-    0x7f, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0xd,
-    0x97, 0xf0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0,
-    0xd9, 0x7f, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0x0,
-    0xd, 0x97, 0xf0, 0xb, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xd9, 0x7f, 0x7, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x97, 0xf4, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd9, 0x7f, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x97, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd9, 0x7f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x2f, 0x10, 0x0, 0x0, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xac, 0x30, 0x2, 0x9e,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xee,
-    0xd8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf2, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd9, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x10, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x70, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0,
-    0x7, 0xf1, 0x0, 0x0, 0x0, 0x1, 0xe6, 0x0,
-    0x0, 0x0, 0xe, 0x80, 0x0, 0x0, 0x0, 0x8d,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x10, 0x0, 0x0,
-    0x1f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf1, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x90, 0x0, 0x9b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0x2f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xda, 0xa, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x85, 0x6d, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xa2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x7f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x9f, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xea,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf6, 0xe, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xe0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x0,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x8e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xda, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0xa, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0,
-    0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x40,
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0xad, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x20, 0x0,
-    0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x90, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xf, 0x93, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0xf8, 0x0, 0x0, 0x7f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x0,
-    0x0, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x60, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0xc, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x3f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-
-    /* U+0411 "Б" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x7f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0x7f, 0x33, 0x33, 0x33, 0x33, 0x6a, 0xfd, 0x20,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xd0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf5,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd9,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xb0,
-    0x7f, 0x33, 0x33, 0x33, 0x34, 0x6b, 0xfb, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x40, 0x0,
-
-    /* U+0412 "В" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x20, 0x0,
-    0x7f, 0x33, 0x33, 0x33, 0x34, 0x7d, 0xf7, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x7f, 0x0, 0x0, 0x0, 0x1, 0x39, 0xf5, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x7f, 0x33, 0x33, 0x33, 0x33, 0x47, 0xdd, 0x30,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd9,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x7f, 0x33, 0x33, 0x33, 0x33, 0x58, 0xef, 0x50,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x71, 0x0,
-
-    /* U+0413 "Г" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xf5,
-    0x55, 0x55, 0x55, 0x55, 0x53, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xda, 0x55, 0x55,
-    0x55, 0x55, 0x5a, 0xf0, 0x0, 0x0, 0x0, 0xd,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0xe, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x6e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0xf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x4, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0xc9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x36, 0xbf, 0x65,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0xaf, 0x55, 0x4b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xba,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x55, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x70,
-
-    /* U+0415 "Е" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7,
-    0xf5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x30, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x7f, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x10, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0416 "Ж" */
-    0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0xbd,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x1e, 0x90, 0x0,
-    0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0xb,
-    0xd0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x6f, 0x30, 0x0,
-    0x0, 0x0, 0xad, 0x0, 0x0, 0x0, 0xc, 0xa0,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0x90, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4,
-    0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x91, 0x11, 0x1c, 0xa1,
-    0x11, 0x1b, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xc4, 0x44, 0x4d, 0xb4, 0x44, 0x4d, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0xc, 0xa0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0xc, 0xa0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xc0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xa0,
-    0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-
-    /* U+0417 "З" */
-    0x0, 0x4, 0x9c, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-    0x5, 0xef, 0xc8, 0x65, 0x57, 0xcf, 0xb1, 0x0,
-    0x9, 0x81, 0x0, 0x0, 0x0, 0x4, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x5c, 0xe3, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x33, 0x33, 0x34, 0x7c, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x7, 0xff, 0xa7, 0x54, 0x46, 0x9e, 0xf6, 0x0,
-    0x0, 0x6, 0xad, 0xff, 0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+0418 "И" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0x97, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x97, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0xd9, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0xd, 0x97, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0xd9, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0xd, 0x97, 0xf0, 0x0, 0x0, 0x0,
-    0x6f, 0x50, 0x0, 0xd9, 0x7f, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0xd, 0x97, 0xf0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0xd9, 0x7f, 0x0, 0x0,
-    0xa, 0xe1, 0x0, 0x0, 0xd, 0x97, 0xf0, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0xd9, 0x7f, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0xd, 0x97, 0xf0,
-    0x1, 0xeb, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x7f,
-    0x0, 0xbe, 0x10, 0x0, 0x0, 0x0, 0xd, 0x97,
-    0xf0, 0x7f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xd9,
-    0x7f, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x97, 0xfe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd9, 0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x97, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd9,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0xd5, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x0, 0x9, 0xa0, 0x0, 0x0, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0x91, 0x1, 0x9e, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x19, 0xde, 0xd9, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xe9, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x97, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf9, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x5d, 0x97, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0xd9, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0xd, 0x97, 0xf0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0xd9, 0x7f, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0xd, 0x97, 0xf0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0xd9, 0x7f,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0xd, 0x97,
-    0xf0, 0x0, 0x0, 0xae, 0x10, 0x0, 0x0, 0xd9,
-    0x7f, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0xd,
-    0x97, 0xf0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0,
-    0xd9, 0x7f, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0x0,
-    0xd, 0x97, 0xf0, 0xb, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xd9, 0x7f, 0x7, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x97, 0xf4, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd9, 0x7f, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x97, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd9, 0x7f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x90,
-
-    /* U+041A "К" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd1,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x20,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x80, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x9, 0xe1, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x7f, 0x11, 0x11, 0x2e, 0x90, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x44, 0x44, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x9d, 0x55, 0x55, 0x55,
-    0x55, 0x56, 0xf5, 0x0, 0x0, 0x9, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x50, 0x0, 0x0, 0xab,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf5, 0x0, 0x0,
-    0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x50,
-    0x0, 0x0, 0xba, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf5, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x50, 0x0, 0x0, 0xc9, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0xc, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x50, 0x0, 0x0,
-    0xd7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5, 0x0,
-    0x0, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x50, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf5, 0x0, 0x0, 0x1f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x50, 0x0, 0x3, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x50, 0x0,
-    0x9, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5,
-    0x0, 0x0, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x50, 0x0, 0x8f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf5, 0x46, 0xaf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x5a, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf5,
-
-    /* U+041C "М" */
-    0x7f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x77, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf7, 0x7f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x77,
-    0xeb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xba, 0xf7, 0x7e, 0x2f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x2f, 0x77, 0xe0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x80, 0xf7, 0x7e,
-    0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6, 0xe0,
-    0xf, 0x77, 0xe0, 0x7, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xe6, 0x0, 0xf7, 0x7e, 0x0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x8d, 0x0, 0xf, 0x77, 0xe0,
-    0x0, 0x5f, 0x20, 0x0, 0x0, 0x2f, 0x40, 0x0,
-    0xf7, 0x7e, 0x0, 0x0, 0xcb, 0x0, 0x0, 0xa,
-    0xb0, 0x0, 0xf, 0x77, 0xe0, 0x0, 0x3, 0xf4,
-    0x0, 0x3, 0xf2, 0x0, 0x0, 0xf7, 0x7e, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0xc9, 0x0, 0x0, 0xf,
-    0x77, 0xe0, 0x0, 0x0, 0x1f, 0x60, 0x6e, 0x10,
-    0x0, 0x0, 0xf7, 0x7e, 0x0, 0x0, 0x0, 0x7e,
-    0x1e, 0x70, 0x0, 0x0, 0xf, 0x77, 0xe0, 0x0,
-    0x0, 0x0, 0xee, 0xd0, 0x0, 0x0, 0x0, 0xf7,
-    0x7e, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0x77, 0xe0, 0x0, 0x0, 0x0, 0x4,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x7e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x77,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7,
-
-    /* U+041D "Н" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x77, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x77, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x77, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x77, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x77, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x3f, 0x77, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x77, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x77,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x77, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x77, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xeb, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xa7,
-    0x55, 0x7b, 0xff, 0x70, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x18, 0xfc, 0x0,
-    0x0, 0x0, 0x1d, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0xae, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0xa, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0xf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd0,
-    0x2f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x3f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x3f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x2f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0xf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd0, 0xa,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0xae, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0,
-    0x0, 0x1d, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x1, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0x18, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xa7, 0x55, 0x7b, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xeb,
-    0x61, 0x0, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa7, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0xda, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xa7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xca, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xa7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xca, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xa7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xca, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xa7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xca, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xa7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xa7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xca,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xa7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xca, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xa7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xca,
-
-    /* U+0420 "Р" */
-    0x7f, 0xff, 0xff, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-    0x7f, 0x55, 0x55, 0x55, 0x57, 0xbf, 0xc2, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x2, 0xce, 0x20,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xb0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf6,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40,
-    0x7f, 0x11, 0x11, 0x11, 0x13, 0x7d, 0xf5, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0,
-    0x7f, 0x44, 0x44, 0x43, 0x31, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xeb, 0x60,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xa7, 0x55, 0x7a,
-    0xff, 0x60, 0x0, 0x1, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x8, 0xf9, 0x0, 0x1d, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x43, 0x0, 0xaf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x43, 0x0, 0x1, 0xdf, 0x70, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x0, 0x0, 0x8, 0xff, 0xa7, 0x55,
-    0x7a, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0422 "Т" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x35, 0x55, 0x55, 0x5c, 0xd5, 0x55, 0x55, 0x54,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x20, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x90, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf1, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x0, 0x7f, 0x10, 0x0, 0x0, 0x0, 0x1e, 0x60,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x8,
-    0xd0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x0, 0x0,
-    0x1, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90,
-    0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x10, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd9, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf2, 0x2, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa0, 0xaa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x5f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xe8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0x56, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0xce, 0xff, 0xfe, 0xda, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xb7, 0x53,
-    0xf8, 0x46, 0x9d, 0xfa, 0x20, 0x0, 0x0, 0x1c,
-    0xf7, 0x10, 0x0, 0xf, 0x60, 0x0, 0x4, 0xcf,
-    0x50, 0x0, 0xc, 0xe2, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x7, 0xf2, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0xe8, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x1, 0xf6, 0x4f, 0x20, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0xb, 0xb6,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x7, 0xe7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0x4f, 0x20, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0xa, 0xb0, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x9, 0xe1, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x1e, 0xd1, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0x60,
-    0x0, 0x2e, 0xe5, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x1, 0x9f, 0x70, 0x0, 0x0, 0x19, 0xfd, 0x85,
-    0x20, 0xf7, 0x13, 0x6a, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x2, 0x7c, 0xff, 0xff, 0xff, 0xfd, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
-    0xf8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0xbe, 0x10, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0x0,
-    0x1e, 0xb0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0,
-    0x0, 0xae, 0x10, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0x0, 0xce, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x38, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x6b,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xeb,
-    0x1, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xe1, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x8f, 0x30, 0x0, 0x0, 0x0, 0x7,
-    0xf4, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x10, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xa0,
-
-    /* U+0426 "Ц" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x7f, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x9f, 0x55, 0x50, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf2,
-
-    /* U+0427 "Ч" */
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x17, 0xf7,
-    0x0, 0xbf, 0xb5, 0x21, 0x13, 0x6b, 0xfe, 0xf7,
-    0x0, 0x6, 0xdf, 0xff, 0xff, 0xea, 0x40, 0xf7,
-    0x0, 0x0, 0x1, 0x33, 0x31, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-
-    /* U+0428 "Ш" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x17, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x17, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf1, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x17, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf1, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x17,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x17, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf1, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x17, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x17, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x17, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x17, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x7f, 0x55, 0x55, 0x55, 0x55, 0x59, 0xf5,
-    0x55, 0x55, 0x55, 0x55, 0x9f, 0x17, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1,
-
-    /* U+0429 "Щ" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x10, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x10, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x10, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x10, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x7f, 0x55, 0x55, 0x55,
-    0x55, 0x59, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x9f,
-    0x55, 0x51, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x81,
-
-    /* U+042A "Ъ" */
-    0xbf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x35, 0x55, 0x55, 0xaf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x33, 0x33, 0x33, 0x34,
-    0x7d, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xe0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0,
-    0x0, 0x7f, 0x33, 0x33, 0x33, 0x35, 0x8e, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+042B "Ы" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x87, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe8, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x87,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x87, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x87, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x92,
-    0x0, 0x0, 0x0, 0xe8, 0x7f, 0x33, 0x33, 0x33,
-    0x34, 0x7d, 0xf8, 0x0, 0x0, 0xe, 0x87, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x0,
-    0xe8, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xe0, 0x0, 0xe, 0x87, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x40, 0x0, 0xe8, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0xe,
-    0x87, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0xe8, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0xe, 0x87, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0xe8,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0xe, 0x87, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0xe8, 0x7f, 0x33, 0x33,
-    0x33, 0x35, 0x8e, 0xf5, 0x0, 0x0, 0xe, 0x87,
-    0xff, 0xff, 0xff, 0xff, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0xe8,
-
-    /* U+042C "Ь" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x20, 0x0,
-    0x7f, 0x33, 0x33, 0x33, 0x34, 0x7d, 0xf8, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40,
-    0x7f, 0x33, 0x33, 0x33, 0x35, 0x8e, 0xf5, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x6, 0xad, 0xff, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x6f, 0xfb, 0x76, 0x57, 0xaf, 0xf8, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x3, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xda, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3,
-    0x33, 0x33, 0x33, 0x33, 0x3a, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x45, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0,
-    0x9, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x0, 0x6, 0xef, 0xb7, 0x65, 0x7a, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xc7, 0x10,
-    0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xef,
-    0xfe, 0xa5, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xfb, 0x75, 0x57, 0xbf, 0xe5,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x8, 0xfa,
-    0x20, 0x0, 0x0, 0x2, 0xbf, 0x80, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x7f, 0x0, 0x0, 0x3,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x7f, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x7f, 0x0,
-    0x0, 0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf1, 0x7f, 0x0, 0x0, 0x6f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5,
-    0x7f, 0x11, 0x11, 0x9e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe8, 0x7f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd9, 0x7f, 0x44, 0x44, 0xbc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x7f,
-    0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x7f, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf5, 0x7f, 0x0, 0x0, 0x1f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x7f, 0x0,
-    0x0, 0xb, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xa0, 0x7f, 0x0, 0x0, 0x3, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x7f, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf7, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0x20, 0x0, 0x0, 0x2, 0xbf,
-    0x80, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xfb, 0x75, 0x57, 0xbf, 0xe5, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe,
-    0xa5, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x1, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7, 0xfe, 0x96, 0x55, 0x55, 0x55, 0xaf, 0x7,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfc, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x5f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0xce, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x1, 0xcf, 0x83, 0x10, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xda, 0x23, 0x33, 0x33, 0x39,
-    0xf0, 0x0, 0xad, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-
-    /* U+0430 "а" */
-    0x0, 0x5, 0xae, 0xff, 0xd8, 0x10, 0x0, 0x3d,
-    0xfa, 0x64, 0x58, 0xee, 0x20, 0xc, 0xa1, 0x0,
-    0x0, 0x1, 0xdd, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x3, 0x9d,
-    0xef, 0xff, 0xff, 0xf8, 0x6, 0xf9, 0x42, 0x22,
-    0x22, 0x2e, 0x81, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xe8, 0x5f, 0x10, 0x0, 0x0, 0x0, 0xe, 0x85,
-    0xf1, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x1f, 0x80,
-    0x0, 0x0, 0x2, 0xde, 0x80, 0x6f, 0xa3, 0x11,
-    0x38, 0xe4, 0xd8, 0x0, 0x3a, 0xef, 0xfd, 0x92,
-    0xd, 0x80,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x6a, 0xdf, 0xf0, 0x0,
-    0x0, 0x4, 0xae, 0xff, 0xb8, 0x40, 0x0, 0x0,
-    0x2c, 0xfc, 0x73, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x4b, 0xef,
-    0xfd, 0x92, 0x0, 0xb, 0xa0, 0xaf, 0x95, 0x44,
-    0x8e, 0xf6, 0x0, 0xd7, 0xac, 0x10, 0x0, 0x0,
-    0x9, 0xf5, 0xe, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x6e, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xca, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xcb, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0x7f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa2,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5, 0xa,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x1e,
-    0xd2, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x3e,
-    0xf9, 0x53, 0x48, 0xee, 0x40, 0x0, 0x0, 0x7,
-    0xcf, 0xfe, 0xc7, 0x0, 0x0,
-
-    /* U+0432 "в" */
-    0xff, 0xff, 0xff, 0xfe, 0xb4, 0x0, 0xf7, 0x22,
-    0x22, 0x35, 0xaf, 0x80, 0xf6, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xf5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xf5, 0xf6, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0xf6, 0x0, 0x0, 0x1,
-    0x7e, 0x50, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xf7, 0x22, 0x22, 0x23, 0x5c, 0xd1, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xd9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8d,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xda, 0xf7, 0x22,
-    0x22, 0x23, 0x7d, 0xe1, 0xff, 0xff, 0xff, 0xff,
-    0xc8, 0x10,
-
-    /* U+0433 "г" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x94, 0x44,
-    0x44, 0x44, 0x40, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xe, 0x84, 0x44, 0x44, 0x44, 0xf6,
-    0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x1f, 0x30, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x5, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0xa, 0xb0,
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x4f,
-    0x20, 0x0, 0x0, 0x0, 0xf, 0x60, 0x2, 0x5e,
-    0xa3, 0x33, 0x33, 0x33, 0x33, 0xf8, 0x32, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0xba, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xcb, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8c, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x60,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x4b, 0xef, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0xbf, 0xa5, 0x45, 0xaf, 0xb0, 0x0, 0x0,
-    0xcd, 0x20, 0x0, 0x0, 0x2d, 0xc0, 0x0, 0x7f,
-    0x20, 0x0, 0x0, 0x0, 0x2f, 0x70, 0xe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0x3, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf3, 0x6f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x67, 0xfe, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xf8, 0x6f, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x3, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x2,
-    0xd5, 0x0, 0x0, 0x9f, 0xc7, 0x54, 0x6b, 0xfa,
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe, 0xa4, 0x0,
-    0x0,
-
-    /* U+0436 "ж" */
-    0xa, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x1, 0xe9, 0x0, 0x0, 0x0,
-    0x6f, 0x0, 0x0, 0x0, 0x1e, 0x90, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x6f, 0x0,
-    0x0, 0x4, 0xf3, 0x0, 0x0, 0x1, 0xe9, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x1e, 0x80, 0x0, 0x0,
-    0x0, 0x4f, 0x30, 0x0, 0x6f, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xd0, 0x0, 0x6f,
-    0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe3, 0x33, 0x8f, 0x33, 0x37,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x6f, 0x0, 0x0, 0xae, 0x10, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x6f, 0x0, 0x0, 0xe, 0xb0,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x6f, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x0, 0x8f, 0x30, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0x1e, 0xa0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x0, 0x2, 0xfa,
-
-    /* U+0437 "з" */
-    0x0, 0x17, 0xce, 0xff, 0xc8, 0x10, 0x0, 0x4f,
-    0xd8, 0x54, 0x58, 0xef, 0x40, 0x1, 0x50, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xe5, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x12, 0x22,
-    0x37, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x9, 0x30,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x8f, 0xc7, 0x43,
-    0x46, 0xcf, 0x80, 0x0, 0x27, 0xce, 0xff, 0xd9,
-    0x20, 0x0,
-
-    /* U+0438 "и" */
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0xf6, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0xf1, 0xf6, 0x0, 0x0,
-    0x0, 0x1e, 0xa5, 0xf1, 0xf6, 0x0, 0x0, 0x0,
-    0xcc, 0x5, 0xf1, 0xf6, 0x0, 0x0, 0xa, 0xe1,
-    0x5, 0xf1, 0xf6, 0x0, 0x0, 0x7f, 0x30, 0x5,
-    0xf1, 0xf6, 0x0, 0x4, 0xf5, 0x0, 0x5, 0xf1,
-    0xf6, 0x0, 0x2f, 0x80, 0x0, 0x5, 0xf1, 0xf6,
-    0x1, 0xdb, 0x0, 0x0, 0x5, 0xf1, 0xf6, 0xb,
-    0xd1, 0x0, 0x0, 0x5, 0xf1, 0xf6, 0x8f, 0x20,
-    0x0, 0x0, 0x5, 0xf1, 0xfc, 0xf4, 0x0, 0x0,
-    0x0, 0x5, 0xf1, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x5, 0xf1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1,
-
-    /* U+0439 "й" */
-    0x0, 0x34, 0x0, 0x0, 0x5, 0x30, 0x0, 0x0,
-    0x5c, 0x0, 0x0, 0xd, 0x50, 0x0, 0x0, 0xc,
-    0xa2, 0x2, 0xac, 0x0, 0x0, 0x0, 0x0, 0x8e,
-    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0xf6, 0x0, 0x0, 0x0, 0x3, 0xfc, 0xf1, 0xf6,
-    0x0, 0x0, 0x0, 0x1e, 0xa5, 0xf1, 0xf6, 0x0,
-    0x0, 0x0, 0xcc, 0x5, 0xf1, 0xf6, 0x0, 0x0,
-    0xa, 0xe1, 0x5, 0xf1, 0xf6, 0x0, 0x0, 0x7f,
-    0x30, 0x5, 0xf1, 0xf6, 0x0, 0x4, 0xf5, 0x0,
-    0x5, 0xf1, 0xf6, 0x0, 0x2f, 0x80, 0x0, 0x5,
-    0xf1, 0xf6, 0x1, 0xdb, 0x0, 0x0, 0x5, 0xf1,
-    0xf6, 0xb, 0xd1, 0x0, 0x0, 0x5, 0xf1, 0xf6,
-    0x8f, 0x20, 0x0, 0x0, 0x5, 0xf1, 0xfc, 0xf4,
-    0x0, 0x0, 0x0, 0x5, 0xf1, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf1,
-
-    /* U+043A "к" */
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xda, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0xac, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x7e, 0x10, 0xf, 0x60, 0x0, 0x0, 0x4f,
-    0x40, 0x0, 0xf6, 0x0, 0x0, 0x2e, 0x70, 0x0,
-    0xf, 0x60, 0x0, 0xd, 0xa0, 0x0, 0x0, 0xf6,
-    0x0, 0xa, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xf8, 0x33, 0x3b, 0xe1,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x1d, 0xc0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x2e, 0xa0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x3f, 0x80, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x5f, 0x50, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x7f, 0x30, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xae, 0x20,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0xd, 0x94, 0x44, 0x44, 0x44, 0xf7, 0x0,
-    0x0, 0xe5, 0x0, 0x0, 0x0, 0xf, 0x70, 0x0,
-    0xf, 0x50, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0x1f,
-    0x30, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x2, 0xf2,
-    0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0x3f, 0x10,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0x70, 0x0, 0x6d, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x0,
-    0xf, 0x74, 0x6e, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0xbf, 0xb1, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x70,
-
-    /* U+043C "м" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0xfd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xde,
-    0xf6, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x6e,
-    0xf5, 0x6e, 0x10, 0x0, 0x0, 0x1, 0xe5, 0x5e,
-    0xf5, 0xd, 0x90, 0x0, 0x0, 0x9, 0xc0, 0x5e,
-    0xf5, 0x3, 0xf3, 0x0, 0x0, 0x2f, 0x20, 0x5e,
-    0xf5, 0x0, 0xac, 0x0, 0x0, 0xb9, 0x0, 0x5e,
-    0xf5, 0x0, 0x1f, 0x50, 0x5, 0xe1, 0x0, 0x5e,
-    0xf5, 0x0, 0x7, 0xe0, 0xe, 0x60, 0x0, 0x5e,
-    0xf5, 0x0, 0x0, 0xd8, 0x8c, 0x0, 0x0, 0x5e,
-    0xf5, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x5e,
-    0xf5, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x5e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
-
-    /* U+043D "н" */
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xab, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xab, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xab, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xf8, 0x33, 0x33, 0x33,
-    0x33, 0x3b, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xab, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xab, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xab, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xb0,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x3a, 0xef, 0xfd, 0x81, 0x0, 0x0,
-    0x0, 0x9, 0xfc, 0x75, 0x58, 0xef, 0x60, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x8, 0xf6, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x20,
-    0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90,
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x20,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x8, 0xf6, 0x0,
-    0x0, 0x9, 0xfc, 0x64, 0x58, 0xdf, 0x60, 0x0,
-    0x0, 0x0, 0x3a, 0xef, 0xfd, 0x81, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x94,
-    0x44, 0x44, 0x44, 0x44, 0xbc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x9c, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9c, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xcf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x9c, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x9c, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9, 0xcf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9c, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xcf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x9c, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xc0,
-
-    /* U+0440 "р" */
-    0xf6, 0x0, 0x6b, 0xef, 0xeb, 0x50, 0x0, 0xf,
-    0x61, 0xce, 0x95, 0x56, 0xbf, 0xc1, 0x0, 0xf7,
-    0xda, 0x0, 0x0, 0x0, 0x3e, 0xd0, 0xf, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x8f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc9, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x8f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf6, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x1f, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0xf8, 0xda, 0x0, 0x0, 0x0, 0x3d,
-    0xd0, 0xf, 0x71, 0xce, 0x85, 0x46, 0xaf, 0xc1,
-    0x0, 0xf7, 0x0, 0x6c, 0xff, 0xeb, 0x50, 0x0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x3a, 0xdf, 0xfd, 0x92, 0x0, 0x0,
-    0x9, 0xfc, 0x75, 0x58, 0xdf, 0x60, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x8, 0xf3, 0x6, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x40, 0xe, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x30, 0x0, 0xbf, 0x40, 0x0,
-    0x0, 0x7, 0xf3, 0x0, 0x9, 0xfc, 0x74, 0x57,
-    0xdf, 0x60, 0x0, 0x0, 0x39, 0xdf, 0xfd, 0x92,
-    0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x4,
-    0x44, 0x44, 0x8f, 0x54, 0x44, 0x43, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0,
-    0x0,
-
-    /* U+0443 "у" */
-    0x7, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x0, 0x9e, 0x0, 0x0, 0x0, 0x0, 0x9, 0xd0,
-    0x0, 0x2f, 0x50, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x6e, 0x0,
-    0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0xca, 0x0, 0x0, 0x4, 0xf1, 0x0,
-    0x0, 0x0, 0x5f, 0x10, 0x0, 0xb, 0xa0, 0x0,
-    0x0, 0x0, 0xe, 0x80, 0x0, 0x2f, 0x30, 0x0,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf6, 0x0, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x6, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x5d, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0,
-    0x2, 0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x84, 0x5b, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe, 0xc8,
-    0x30, 0x0, 0x0, 0x0, 0x7f, 0xfa, 0x75, 0xfa,
-    0x69, 0xdf, 0xb2, 0x0, 0x0, 0xaf, 0x70, 0x0,
-    0xf, 0x60, 0x0, 0x3d, 0xe3, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0xc, 0xe0, 0xf,
-    0x90, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x1f,
-    0x74, 0xf2, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0xac, 0x7f, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x7, 0xe8, 0xe0, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x6f, 0x7f, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x7, 0xe4, 0xf3,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0xab,
-    0xf, 0x90, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x2f, 0x60, 0x7f, 0x40, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xc, 0xd0, 0x0, 0xaf, 0x80, 0x0, 0xf,
-    0x60, 0x0, 0x3d, 0xe2, 0x0, 0x0, 0x7f, 0xfa,
-    0x75, 0xf9, 0x68, 0xdf, 0xb2, 0x0, 0x0, 0x0,
-    0x16, 0xbe, 0xff, 0xfe, 0xc8, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0445 "х" */
-    0xb, 0xd0, 0x0, 0x0, 0x0, 0x8, 0xe2, 0x1,
-    0xe9, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x3f,
-    0x50, 0x0, 0x1, 0xe8, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0xbd, 0x0,
-    0x8e, 0x10, 0x0, 0x0, 0x0, 0x1e, 0x94, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xeb, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x41, 0xda, 0x0, 0x0, 0x0, 0x2,
-    0xe8, 0x0, 0x3f, 0x60, 0x0, 0x0, 0xc, 0xc0,
-    0x0, 0x7, 0xf3, 0x0, 0x0, 0x9e, 0x10, 0x0,
-    0x0, 0xad, 0x10, 0x5, 0xf4, 0x0, 0x0, 0x0,
-    0x1d, 0xa0, 0x2e, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xf7,
-
-    /* U+0446 "ц" */
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x80, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x80, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xe8, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x80, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x80, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xe8, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x80, 0xf, 0x94, 0x44, 0x44, 0x44, 0x44, 0xea,
-    0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x70,
-
-    /* U+0447 "ч" */
-    0x9c, 0x0, 0x0, 0x0, 0x0, 0xe, 0x89, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xe8, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x89, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0x9c, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x89, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x82, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x8, 0xfa, 0x30, 0x1,
-    0x59, 0xff, 0x80, 0x5, 0xdf, 0xff, 0xfd, 0x93,
-    0xe8, 0x0, 0x0, 0x12, 0x20, 0x0, 0xe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x80,
-
-    /* U+0448 "ш" */
-    0xf6, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0,
-    0x0, 0xbb, 0xf6, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0xbb, 0xf6, 0x0, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0xbb, 0xf6, 0x0,
-    0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0, 0xbb,
-    0xf6, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0,
-    0x0, 0xbb, 0xf6, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0xbb, 0xf6, 0x0, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0xbb, 0xf6, 0x0,
-    0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0, 0xbb,
-    0xf6, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0,
-    0x0, 0xbb, 0xf6, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0xbb, 0xf6, 0x0, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0xbb, 0xf6, 0x0,
-    0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0, 0xbb,
-    0xf6, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0,
-    0x0, 0xbb, 0xf9, 0x44, 0x44, 0x44, 0x4d, 0xa4,
-    0x44, 0x44, 0x44, 0xcb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0449 "щ" */
-    0xf6, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0,
-    0x0, 0xbb, 0x0, 0xf6, 0x0, 0x0, 0x0, 0xd,
-    0x90, 0x0, 0x0, 0x0, 0xbb, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0, 0xbb,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0,
-    0x0, 0x0, 0xbb, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0xbb, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0,
-    0xbb, 0x0, 0xf6, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0xbb, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0xd, 0x90, 0x0, 0x0, 0x0, 0xbb, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0,
-    0x0, 0xbb, 0x0, 0xf6, 0x0, 0x0, 0x0, 0xd,
-    0x90, 0x0, 0x0, 0x0, 0xbb, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x0, 0xbb,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0,
-    0x0, 0x0, 0xbb, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0xbb, 0x0, 0xf9,
-    0x44, 0x44, 0x44, 0x4d, 0xa4, 0x44, 0x44, 0x44,
-    0xcc, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x37,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x44, 0x44, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xfe, 0xb5, 0x0, 0x0, 0x0, 0x5, 0xf2, 0x22,
-    0x22, 0x49, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x5, 0xf0,
-    0x0, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x5f,
-    0x0, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x5,
-    0xf0, 0x0, 0x0, 0x0, 0x9, 0xe0, 0x0, 0x0,
-    0x5f, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x5, 0xf0, 0x0, 0x0, 0x0, 0x4f, 0x50, 0x0,
-    0x0, 0x5f, 0x22, 0x22, 0x24, 0x9f, 0x90, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xeb, 0x40, 0x0,
-
-    /* U+044B "ы" */
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xff, 0xff, 0xff, 0xec, 0x81, 0x0, 0x0, 0xf7,
-    0xf8, 0x22, 0x22, 0x36, 0xde, 0x30, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xf5, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0x1, 0xf5, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0, 0xf7,
-    0xf6, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0xf7,
-    0xf8, 0x22, 0x22, 0x37, 0xde, 0x20, 0x0, 0xf7,
-    0xff, 0xff, 0xff, 0xfc, 0x71, 0x0, 0x0, 0xf7,
-
-    /* U+044C "ь" */
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xed, 0x82, 0x0, 0xf8, 0x22, 0x22, 0x36,
-    0xcf, 0x40, 0xf6, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0xf6, 0x0, 0x0, 0x0, 0x3, 0xf4, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0xf6, 0x0, 0x0, 0x0, 0xc, 0xd0, 0xf8, 0x22,
-    0x22, 0x36, 0xde, 0x30, 0xff, 0xff, 0xff, 0xfc,
-    0x81, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x6b, 0xef, 0xfd, 0x82, 0x0, 0x0, 0x4e,
-    0xd8, 0x43, 0x47, 0xcf, 0x70, 0x0, 0xa7, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf5, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x22, 0x22, 0x22, 0x22, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x40, 0x86, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x0, 0x5e, 0xd8, 0x43, 0x47, 0xcf,
-    0x70, 0x0, 0x1, 0x7b, 0xef, 0xfd, 0x82, 0x0,
-    0x0,
-
-    /* U+044E "ю" */
-    0xf6, 0x0, 0x0, 0x0, 0x7, 0xcf, 0xfe, 0xa4,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x3, 0xee, 0x95,
-    0x56, 0xbf, 0xa0, 0x0, 0xf6, 0x0, 0x0, 0x3f,
-    0xa1, 0x0, 0x0, 0x4, 0xfb, 0x0, 0xf6, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0xf6, 0x0, 0x5, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xd0, 0xf6, 0x0, 0xa, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf2, 0xf7, 0x11, 0x1d, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf5, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0xf9, 0x44, 0x4d, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf5, 0xf6, 0x0, 0xa, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf2, 0xf6, 0x0, 0x5, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xd0, 0xf6, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0xf6, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x4,
-    0xeb, 0x0, 0xf6, 0x0, 0x0, 0x3, 0xee, 0x85,
-    0x46, 0xbf, 0xa0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x7, 0xcf, 0xfe, 0xa4, 0x0, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x5, 0xbe, 0xff, 0xff, 0xff, 0xc0, 0xb,
-    0xfa, 0x64, 0x44, 0x44, 0x9c, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x7, 0xc0, 0xe8, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0x1f, 0x40, 0x0, 0x0, 0x0, 0x7,
-    0xc2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x7, 0xc0, 0xad, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x1, 0xec, 0x40, 0x0,
-    0x0, 0x7, 0xc0, 0x1, 0x8e, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xda, 0x22, 0x22, 0x28, 0xc0,
-    0x0, 0xad, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x6f,
-    0x20, 0x0, 0x0, 0x7, 0xc0, 0x2f, 0x60, 0x0,
-    0x0, 0x0, 0x7c, 0xd, 0xa0, 0x0, 0x0, 0x0,
-    0x7, 0xc0,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x4, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xad, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xef, 0xeb, 0x50, 0x0, 0x0, 0x0, 0xbf, 0xa5,
-    0x45, 0xaf, 0xb0, 0x0, 0x0, 0xcd, 0x20, 0x0,
-    0x0, 0x2d, 0xc0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0xe, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf3, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x67, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xf8, 0x6f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x0, 0x2, 0xd5, 0x0, 0x0,
-    0x9f, 0xc7, 0x54, 0x6b, 0xfa, 0x0, 0x0, 0x0,
-    0x39, 0xdf, 0xfe, 0xa4, 0x0, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0xae, 0x0, 0xd, 0xb0, 0x0, 0x0,
-    0x0, 0xb, 0xe0, 0x0, 0xdc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xbe, 0xfe, 0xb5, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x54, 0x5a, 0xfb, 0x0, 0x0, 0xc, 0xd2, 0x0,
-    0x0, 0x2, 0xdc, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0x0, 0x2, 0xf7, 0x0, 0xe8, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xe0, 0x3f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x36, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe6, 0x7f, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xef, 0x86, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x0, 0x2d, 0x50, 0x0,
-    0x9, 0xfc, 0x75, 0x46, 0xbf, 0xa0, 0x0, 0x0,
-    0x3, 0x9d, 0xff, 0xea, 0x40, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x2, 0x22, 0xf7, 0x22,
-    0x22, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x1, 0x8d, 0xff, 0xe9, 0x20, 0x0, 0x0,
-    0x0, 0xf6, 0x4e, 0xc7, 0x55, 0x7d, 0xf5, 0x0,
-    0x0, 0x0, 0xf8, 0xe5, 0x0, 0x0, 0x0, 0xaf,
-    0x20, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xe0, 0x0, 0x0, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf2, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf2, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf2, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf2, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99, 0x44,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xff, 0xd5, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x6, 0x71, 0x0, 0x0, 0x0,
-    0x1c, 0xc2, 0x0, 0x0, 0x0, 0x4e, 0x80, 0x0,
-    0x0, 0x0, 0x17, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x94,
-    0x44, 0x44, 0x44, 0x40, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x8, 0xfc, 0x64, 0x35, 0x8e, 0xe4, 0x0, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0x87, 0x6, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x7e, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x40, 0x0,
-    0x0, 0x0, 0x88, 0x0, 0x8, 0xfb, 0x63, 0x34,
-    0x8e, 0xe3, 0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb6,
-    0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x7, 0xce, 0xff, 0xc8, 0x20, 0x0, 0x1d,
-    0xe8, 0x54, 0x58, 0xdf, 0x40, 0xa, 0xe1, 0x0,
-    0x0, 0x0, 0x50, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xee, 0x94, 0x10, 0x0, 0x0, 0x0, 0x1, 0x7c,
-    0xff, 0xea, 0x50, 0x0, 0x0, 0x0, 0x0, 0x36,
-    0xaf, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf0, 0x3b, 0x20,
-    0x0, 0x0, 0x0, 0xdb, 0x2, 0xdf, 0xb7, 0x44,
-    0x57, 0xee, 0x20, 0x0, 0x4a, 0xdf, 0xfe, 0xc7,
-    0x0, 0x0,
-
-    /* U+0456 "і" */
-    0x3e, 0x95, 0xfc, 0x4, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf,
-    0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6,
-    0xf, 0x60, 0xf6, 0xf, 0x60, 0xf6, 0xf, 0x60,
-
-    /* U+0457 "ї" */
-    0xd, 0xb0, 0x5f, 0x30, 0xdb, 0x6, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0xf6, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x4, 0xfd,
-    0x0, 0x0, 0x2, 0xe9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x5, 0xf2, 0x3b, 0x53, 0x6f, 0xa0,
-    0x1a, 0xef, 0xe8, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x94,
-    0x44, 0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe5, 0x0, 0x0, 0x0, 0xf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x50, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x30, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xed, 0x92, 0x0, 0x0, 0x2, 0xf2, 0x0, 0x0,
-    0x0, 0xf, 0x92, 0x22, 0x23, 0x5c, 0xf4, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0xa, 0xe0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x2f,
-    0x50, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0xf, 0x70, 0x0, 0xd7, 0x0, 0x0, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x1, 0xce, 0x4, 0x6e, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x55, 0x55, 0x58, 0xee, 0x30, 0xbf,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xd8, 0x10, 0x0,
-
-    /* U+045A "њ" */
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x30,
-    0xf, 0x83, 0x33, 0x33, 0x33, 0x33, 0xf9, 0x33,
-    0x33, 0x46, 0xdf, 0x60, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0xbf, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x1f, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0x0, 0xbd, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xf8, 0x11, 0x11, 0x25, 0xce,
-    0x30, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xd8, 0x10, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x1, 0x8d, 0xff, 0xe9, 0x20, 0x0, 0x0,
-    0x0, 0xf6, 0x4e, 0xc7, 0x55, 0x7d, 0xf5, 0x0,
-    0x0, 0x0, 0xf9, 0xe5, 0x0, 0x0, 0x0, 0xaf,
-    0x20, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xd, 0xa0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf0, 0x0, 0x0, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf2, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf2, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf2, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf2, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf2,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x6, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x17, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xda, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0xac, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x7e, 0x10, 0xf, 0x60, 0x0, 0x0, 0x4f, 0x40,
-    0x0, 0xf6, 0x0, 0x0, 0x2e, 0x70, 0x0, 0xf,
-    0x60, 0x0, 0xd, 0xa0, 0x0, 0x0, 0xf6, 0x0,
-    0xa, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0xf8, 0x33, 0x3b, 0xe1, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x1d, 0xc0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x2e, 0xa0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x5f, 0x50, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x7f, 0x30, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x20,
-
-    /* U+045D "ѝ" */
-    0x0, 0x38, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0xf6, 0x0, 0x0, 0x0, 0x3, 0xfc, 0xf1, 0xf6,
-    0x0, 0x0, 0x0, 0x1e, 0xa5, 0xf1, 0xf6, 0x0,
-    0x0, 0x0, 0xcc, 0x5, 0xf1, 0xf6, 0x0, 0x0,
-    0xa, 0xe1, 0x5, 0xf1, 0xf6, 0x0, 0x0, 0x7f,
-    0x30, 0x5, 0xf1, 0xf6, 0x0, 0x4, 0xf5, 0x0,
-    0x5, 0xf1, 0xf6, 0x0, 0x2f, 0x80, 0x0, 0x5,
-    0xf1, 0xf6, 0x1, 0xdb, 0x0, 0x0, 0x5, 0xf1,
-    0xf6, 0xb, 0xd1, 0x0, 0x0, 0x5, 0xf1, 0xf6,
-    0x8f, 0x20, 0x0, 0x0, 0x5, 0xf1, 0xfc, 0xf4,
-    0x0, 0x0, 0x0, 0x5, 0xf1, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf1,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x52, 0x0, 0x0, 0x7, 0x10, 0x0,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x0, 0x2e, 0x71, 0x3, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xae, 0xfd, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf4,
-    0x0, 0x9e, 0x0, 0x0, 0x0, 0x0, 0x9, 0xd0,
-    0x0, 0x2f, 0x50, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x6e, 0x0,
-    0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0xca, 0x0, 0x0, 0x4, 0xf1, 0x0,
-    0x0, 0x0, 0x5f, 0x10, 0x0, 0xb, 0xa0, 0x0,
-    0x0, 0x0, 0xe, 0x80, 0x0, 0x2f, 0x30, 0x0,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf6, 0x0, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0x6, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x5d, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0,
-    0x2, 0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x84, 0x5b, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xac, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xac, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xac, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xac,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xac, 0xf9, 0x44,
-    0x44, 0x44, 0x44, 0xbc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xc, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x90, 0x0, 0x0, 0x0, 0x0, 0x6, 0x40,
-    0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xba, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xba, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa7, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x53, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0,
-    0x2, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xf9, 0x44, 0x44, 0x44,
-    0x40, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+2013 "–" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-
-    /* U+2014 "—" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22,
-
-    /* U+2018 "‘" */
-    0x2, 0xd0, 0x7a, 0xb, 0x60, 0xf3, 0x4f, 0xa4,
-    0xfe, 0x5, 0x20,
-
-    /* U+2019 "’" */
-    0x2e, 0xa4, 0xff, 0xa, 0xb0, 0xb7, 0xf, 0x22,
-    0xe0, 0x24, 0x0,
-
-    /* U+201A "‚" */
-    0x4, 0x24, 0xfe, 0x2e, 0xe0, 0x99, 0xc, 0x50,
-    0xf1, 0x4c, 0x0,
-
-    /* U+201C "“" */
-    0x2, 0xd0, 0x0, 0xe2, 0x7, 0xa0, 0x2, 0xe0,
-    0xb, 0x60, 0x7, 0xb0, 0xf, 0x30, 0xb, 0x70,
-    0x4f, 0xa0, 0xf, 0xe1, 0x4f, 0xe0, 0xf, 0xf2,
-    0x5, 0x20, 0x3, 0x40,
-
-    /* U+201D "”" */
-    0x2e, 0xa0, 0xc, 0xe1, 0x4f, 0xf0, 0xf, 0xf3,
-    0xa, 0xb0, 0x5, 0xf0, 0xb, 0x70, 0x7, 0xb0,
-    0xf, 0x20, 0xa, 0x70, 0x2e, 0x0, 0xe, 0x20,
-    0x24, 0x0, 0x6, 0x0,
-
-    /* U+2026 "…" */
-    0x5, 0x20, 0x0, 0x6, 0x10, 0x0, 0x25, 0x4,
-    0xfe, 0x0, 0x9, 0xfa, 0x0, 0xd, 0xf6, 0x2e,
-    0xa0, 0x0, 0x5f, 0x60, 0x0, 0x9e, 0x30,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfc, 0x92, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xfa, 0x75, 0x45, 0x8d,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0x60, 0x0, 0x0,
-    0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdd, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xe, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x40, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x19, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0xd8, 0x54,
-    0x57, 0xbf, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x29,
-    0xdf, 0xff, 0xda, 0x40, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x48, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0x40, 0x0, 0x2, 0x8a, 0xb8, 0x20, 0x8, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0,
-    0x6, 0xe8, 0x44, 0x7e, 0x70, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x70, 0x3, 0xe2,
-    0x0, 0x0, 0x1d, 0x58, 0xea, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0x6b, 0x8e, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x70, 0xc, 0x50, 0x0, 0x0, 0x3,
-    0xe8, 0xe0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0xb6, 0x0, 0x0, 0x0, 0x4c, 0x8e,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0xf, 0x70,
-    0x6, 0xc0, 0x0, 0x0, 0xa, 0x88, 0xe0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0xf7, 0x0, 0xb,
-    0xb2, 0x0, 0x19, 0xd0, 0x8e, 0x0, 0x0, 0xbe,
-    0x10, 0x0, 0x0, 0xf, 0x70, 0x0, 0x7, 0xee,
-    0xde, 0x80, 0x8, 0xe0, 0x0, 0x1, 0xec, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x11, 0x0,
-    0x0, 0x8e, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xe0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0xf7,
-    0x0, 0x4, 0x44, 0x44, 0x44, 0x41, 0x8e, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x0, 0xf, 0x70, 0x2,
-    0xcc, 0xcc, 0xcc, 0xcc, 0x38, 0xe0, 0x0, 0x0,
-    0x0, 0xc, 0xe1, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xb0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 115, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 113, .box_w = 3, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30, .adv_w = 160, .box_w = 6, .box_h = 8, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 54, .adv_w = 309, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 244, .adv_w = 273, .box_w = 15, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 454, .adv_w = 366, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 664, .adv_w = 293, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 853, .adv_w = 87, .box_w = 2, .box_h = 8, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 861, .adv_w = 144, .box_w = 5, .box_h = 27, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 929, .adv_w = 144, .box_w = 5, .box_h = 27, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 997, .adv_w = 168, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 1052, .adv_w = 255, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 1130, .adv_w = 90, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1141, .adv_w = 171, .box_w = 8, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 1153, .adv_w = 90, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1158, .adv_w = 143, .box_w = 11, .box_h = 27, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 1307, .adv_w = 295, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1467, .adv_w = 158, .box_w = 7, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1537, .adv_w = 252, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1687, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1837, .adv_w = 293, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2007, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2157, .adv_w = 270, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2307, .adv_w = 260, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2467, .adv_w = 283, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2627, .adv_w = 270, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2787, .adv_w = 90, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2810, .adv_w = 90, .box_w = 3, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2839, .adv_w = 255, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 2911, .adv_w = 255, .box_w = 12, .box_h = 8, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 2959, .adv_w = 255, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3031, .adv_w = 252, .box_w = 14, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3171, .adv_w = 463, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 3522, .adv_w = 316, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3722, .adv_w = 337, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3892, .adv_w = 316, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4072, .adv_w = 370, .box_w = 19, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4262, .adv_w = 300, .box_w = 14, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4402, .adv_w = 283, .box_w = 14, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4542, .adv_w = 346, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4722, .adv_w = 365, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4892, .adv_w = 132, .box_w = 2, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4912, .adv_w = 220, .box_w = 12, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5032, .adv_w = 315, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5202, .adv_w = 262, .box_w = 14, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5342, .adv_w = 428, .box_w = 21, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5552, .adv_w = 365, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5722, .adv_w = 375, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5932, .adv_w = 320, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6092, .adv_w = 375, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 6356, .adv_w = 323, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6516, .adv_w = 273, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6666, .adv_w = 252, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6826, .adv_w = 355, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6986, .adv_w = 308, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7186, .adv_w = 492, .box_w = 29, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7476, .adv_w = 288, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7656, .adv_w = 280, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7836, .adv_w = 289, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8006, .adv_w = 137, .box_w = 5, .box_h = 27, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 8074, .adv_w = 143, .box_w = 11, .box_h = 27, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 8223, .adv_w = 137, .box_w = 6, .box_h = 27, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 8304, .adv_w = 255, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 8376, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8390, .adv_w = 269, .box_w = 6, .box_h = 4, .ofs_x = 4, .ofs_y = 17},
-    {.bitmap_index = 8402, .adv_w = 261, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8500, .adv_w = 302, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8668, .adv_w = 249, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8773, .adv_w = 302, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8931, .adv_w = 267, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9044, .adv_w = 147, .box_w = 11, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9160, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 9328, .adv_w = 302, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9486, .adv_w = 117, .box_w = 3, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9518, .adv_w = 119, .box_w = 8, .box_h = 27, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 9626, .adv_w = 261, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9784, .adv_w = 117, .box_w = 3, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9816, .adv_w = 477, .box_w = 25, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10004, .adv_w = 302, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10117, .adv_w = 278, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10230, .adv_w = 302, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 10398, .adv_w = 302, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 10556, .adv_w = 177, .box_w = 8, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10616, .adv_w = 214, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10714, .adv_w = 178, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10813, .adv_w = 300, .box_w = 14, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10918, .adv_w = 237, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11031, .adv_w = 386, .box_w = 24, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11211, .adv_w = 233, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11316, .adv_w = 237, .box_w = 16, .box_h = 21, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 11484, .adv_w = 225, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11574, .adv_w = 143, .box_w = 8, .box_h = 27, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 11682, .adv_w = 130, .box_w = 2, .box_h = 27, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 11709, .adv_w = 143, .box_w = 8, .box_h = 27, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 11817, .adv_w = 255, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 11852, .adv_w = 204, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 11913, .adv_w = 204, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 11974, .adv_w = 293, .box_w = 15, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12162, .adv_w = 293, .box_w = 15, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12350, .adv_w = 367, .box_w = 22, .box_h = 21, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12581, .adv_w = 254, .box_w = 13, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12744, .adv_w = 316, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12924, .adv_w = 278, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13074, .adv_w = 136, .box_w = 2, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13094, .adv_w = 132, .box_w = 8, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13194, .adv_w = 231, .box_w = 12, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13314, .adv_w = 531, .box_w = 32, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13634, .adv_w = 532, .box_w = 30, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13934, .adv_w = 370, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14154, .adv_w = 311, .box_w = 16, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14354, .adv_w = 370, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14567, .adv_w = 301, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14805, .adv_w = 361, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 15018, .adv_w = 328, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15218, .adv_w = 324, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15378, .adv_w = 336, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15538, .adv_w = 254, .box_w = 13, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15668, .adv_w = 352, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 15931, .adv_w = 293, .box_w = 15, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16081, .adv_w = 446, .box_w = 28, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16361, .adv_w = 274, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16521, .adv_w = 370, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16691, .adv_w = 370, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16904, .adv_w = 311, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17064, .adv_w = 350, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17254, .adv_w = 432, .box_w = 21, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17464, .adv_w = 368, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17634, .adv_w = 382, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17854, .adv_w = 371, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18024, .adv_w = 316, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18184, .adv_w = 320, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18364, .adv_w = 258, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18524, .adv_w = 301, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18714, .adv_w = 407, .box_w = 23, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 18967, .adv_w = 284, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19147, .adv_w = 369, .box_w = 20, .box_h = 25, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 19397, .adv_w = 319, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19557, .adv_w = 490, .box_w = 25, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 19807, .adv_w = 499, .box_w = 28, .box_h = 25, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 20157, .adv_w = 365, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20377, .adv_w = 433, .box_w = 21, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 20587, .adv_w = 317, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 20747, .adv_w = 316, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20917, .adv_w = 487, .box_w = 26, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 21177, .adv_w = 328, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21327, .adv_w = 258, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21425, .adv_w = 294, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21590, .adv_w = 270, .box_w = 12, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 21680, .adv_w = 208, .box_w = 11, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 21763, .adv_w = 286, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 21925, .adv_w = 273, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22038, .adv_w = 362, .box_w = 22, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22203, .adv_w = 236, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22301, .adv_w = 306, .box_w = 14, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 22406, .adv_w = 306, .box_w = 14, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 22553, .adv_w = 254, .box_w = 13, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 22651, .adv_w = 280, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22764, .adv_w = 351, .box_w = 16, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 22884, .adv_w = 300, .box_w = 13, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 22982, .adv_w = 283, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23102, .adv_w = 301, .box_w = 13, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 23200, .adv_w = 306, .box_w = 15, .box_h = 21, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 23358, .adv_w = 250, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23463, .adv_w = 204, .box_w = 14, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 23568, .adv_w = 245, .box_w = 16, .box_h = 21, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 23736, .adv_w = 344, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 23993, .adv_w = 230, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24098, .adv_w = 304, .box_w = 15, .box_h = 19, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 24241, .adv_w = 265, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24339, .adv_w = 411, .box_w = 20, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 24489, .adv_w = 411, .box_w = 22, .box_h = 19, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 24698, .adv_w = 271, .box_w = 17, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 24826, .adv_w = 343, .box_w = 16, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 24946, .adv_w = 248, .box_w = 12, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25036, .adv_w = 254, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25141, .adv_w = 383, .box_w = 20, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25291, .adv_w = 269, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25389, .adv_w = 278, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25547, .adv_w = 273, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25697, .adv_w = 299, .box_w = 18, .box_h = 27, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 25940, .adv_w = 208, .box_w = 11, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 26056, .adv_w = 254, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26161, .adv_w = 233, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26259, .adv_w = 119, .box_w = 3, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26291, .adv_w = 117, .box_w = 7, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26361, .adv_w = 119, .box_w = 8, .box_h = 27, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 26469, .adv_w = 408, .box_w = 25, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26657, .adv_w = 420, .box_w = 23, .box_h = 15, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 26830, .adv_w = 299, .box_w = 18, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 27019, .adv_w = 254, .box_w = 13, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 27156, .adv_w = 306, .box_w = 14, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 27303, .adv_w = 245, .box_w = 16, .box_h = 27, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 27519, .adv_w = 284, .box_w = 12, .box_h = 19, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 27633, .adv_w = 255, .box_w = 13, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 27789, .adv_w = 195, .box_w = 10, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 27879, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 27893, .adv_w = 448, .box_w = 28, .box_h = 2, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 27921, .adv_w = 90, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 27932, .adv_w = 90, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 27943, .adv_w = 90, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 27954, .adv_w = 158, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 27982, .adv_w = 158, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 28010, .adv_w = 273, .box_w = 15, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 28033, .adv_w = 370, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 28223, .adv_w = 536, .box_w = 29, .box_h = 20, .ofs_x = 3, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_28;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_28 = {
-#else
-lv_font_t montserrat_cyrillic_28 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 31,          /*The maximum line height required by the font*/
-    .base_line = 6,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -3,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_28,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_28*/
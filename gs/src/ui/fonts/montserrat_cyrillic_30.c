@@ -1,4862 +0,0 @@
-/*******************************************************************************
- * Size: 30 px
- * Bpp: 4
- * Opts: --bpp 4 --size 30 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_30.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_30
-#define MONTSERRAT_CYRILLIC_30 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_30
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x1f, 0xa0, 0x1f, 0x90, 0xf, 0x90, 0xf, 0x90,
-    0xf, 0x80, 0xf, 0x80, 0xf, 0x80, 0xf, 0x70,
-    0xe, 0x70, 0xe, 0x70, 0xe, 0x60, 0xd, 0x60,
-    0xd, 0x60, 0xd, 0x50, 0xa, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x30, 0x6f, 0xf0,
-    0x2e, 0xb0,
-
-    /* U+0022 "\"" */
-    0xc9, 0x0, 0xe, 0x7c, 0x90, 0x0, 0xe6, 0xb8,
-    0x0, 0xe, 0x6b, 0x80, 0x0, 0xd6, 0xb8, 0x0,
-    0xd, 0x6b, 0x80, 0x0, 0xd6, 0xa8, 0x0, 0xd,
-    0x59, 0x60, 0x0, 0xb4,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xe, 0x50, 0x0, 0x0, 0x2f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0x30, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x10, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x7b, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x99,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0,
-    0x0, 0xb7, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x33,
-    0x33, 0xd8, 0x33, 0x33, 0x33, 0xf5, 0x33, 0x32,
-    0x0, 0x0, 0x0, 0xe5, 0x0, 0x0, 0x1, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf0, 0x0, 0x0, 0x7, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x9, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0,
-    0xb, 0x70, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0x33,
-    0x3d, 0x83, 0x33, 0x33, 0x3f, 0x63, 0x33, 0x20,
-    0x0, 0x0, 0xe, 0x50, 0x0, 0x0, 0x1f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x30, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x10,
-    0x0, 0x0, 0x5e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 0x9a, 0x0,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xff, 0xd9, 0x50, 0x0,
-    0x0, 0x1c, 0xfd, 0x8a, 0xd6, 0x9c, 0xfe, 0x50,
-    0x0, 0xde, 0x40, 0x5, 0xc0, 0x0, 0x2a, 0x90,
-    0x7, 0xf3, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xa9, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xcf, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xd8, 0xcf, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x2, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0xea,
-    0x1a, 0x10, 0x0, 0x5, 0xc0, 0x0, 0x6, 0xf4,
-    0x2e, 0xe6, 0x0, 0x5, 0xc0, 0x0, 0x6f, 0xb0,
-    0x1, 0xaf, 0xfb, 0x89, 0xe7, 0x9e, 0xfa, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xfe, 0xc9, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x4b, 0xee, 0xb3, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xb0, 0x0, 0x0, 0x5e, 0x40, 0x4, 0xe4,
-    0x0, 0x0, 0x0, 0x4, 0xe1, 0x0, 0x0, 0xe,
-    0x30, 0x0, 0x4, 0xe0, 0x0, 0x0, 0x0, 0xe5,
-    0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0xc, 0x50,
-    0x0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0x98, 0x0,
-    0x0, 0x0, 0x98, 0x0, 0x0, 0x4e, 0x10, 0x0,
-    0x0, 0xa, 0x70, 0x0, 0x0, 0x8, 0x90, 0x0,
-    0x1e, 0x50, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0,
-    0x0, 0x98, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0,
-    0x6, 0xc0, 0x0, 0x0, 0xc, 0x60, 0x5, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x30, 0x0, 0x4,
-    0xf1, 0x1, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0x40, 0x4, 0xe6, 0x0, 0xb9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xd5, 0x0,
-    0x6d, 0x0, 0x7, 0xce, 0xd7, 0x0, 0x0, 0x0,
-    0x1, 0x10, 0x0, 0x2e, 0x30, 0xb, 0xc4, 0x24,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x80,
-    0x6, 0xd0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xd0, 0x0, 0xd5, 0x0, 0x0, 0x5,
-    0xd0, 0x0, 0x0, 0x0, 0x2, 0xf3, 0x0, 0xf,
-    0x20, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x0,
-    0xc7, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0xf2,
-    0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0xf, 0x10,
-    0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x3f, 0x20,
-    0x0, 0x0, 0xd4, 0x0, 0x0, 0x4, 0xe0, 0x0,
-    0x0, 0xd, 0x70, 0x0, 0x0, 0x7, 0xb0, 0x0,
-    0x0, 0xb8, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0,
-    0x0, 0xc, 0x91, 0x1, 0x9c, 0x0, 0x0, 0x3,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xde, 0xe8,
-    0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x6, 0xcf, 0xfe, 0x91, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0x43, 0x5c, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x0, 0x0, 0xac, 0x0,
-    0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xb0, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0xad, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe2, 0x3, 0xdd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xd9,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xce, 0x7e, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xea, 0x10, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x6, 0xe0, 0x0, 0xda, 0x0, 0x0, 0x0,
-    0x4f, 0x90, 0x0, 0xaa, 0x0, 0x4f, 0x30, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0xf, 0x50, 0x6, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x77, 0xe0, 0x0,
-    0x5f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x50, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0,
-    0x4, 0xec, 0x9f, 0x40, 0x0, 0x8, 0xfd, 0x85,
-    0x45, 0x8d, 0xf9, 0x0, 0xaf, 0x30, 0x0, 0x2,
-    0x9d, 0xff, 0xfc, 0x82, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x60,
-
-    /* U+0027 "'" */
-    0xc9, 0xc9, 0xb8, 0xb8, 0xb8, 0xb8, 0xa8, 0x96,
-
-    /* U+0028 "(" */
-    0x0, 0x8, 0xe0, 0x0, 0x1f, 0x60, 0x0, 0x8e,
-    0x0, 0x0, 0xe8, 0x0, 0x4, 0xf3, 0x0, 0x8,
-    0xe0, 0x0, 0xd, 0xa0, 0x0, 0xf, 0x60, 0x0,
-    0x3f, 0x40, 0x0, 0x5f, 0x10, 0x0, 0x7f, 0x0,
-    0x0, 0x8e, 0x0, 0x0, 0x9d, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0xad, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0x8e, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x3f, 0x40, 0x0, 0xf, 0x60, 0x0, 0xc,
-    0xa0, 0x0, 0x8, 0xe0, 0x0, 0x3, 0xf3, 0x0,
-    0x0, 0xe8, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x1f,
-    0x60, 0x0, 0x7, 0xe0,
-
-    /* U+0029 ")" */
-    0x4f, 0x20, 0x0, 0xc, 0xa0, 0x0, 0x5, 0xf2,
-    0x0, 0x0, 0xe8, 0x0, 0x0, 0x9e, 0x0, 0x0,
-    0x4f, 0x30, 0x0, 0xf, 0x70, 0x0, 0xc, 0xa0,
-    0x0, 0x9, 0xd0, 0x0, 0x7, 0xf0, 0x0, 0x5,
-    0xf1, 0x0, 0x4, 0xf3, 0x0, 0x3, 0xf4, 0x0,
-    0x3, 0xf4, 0x0, 0x3, 0xf4, 0x0, 0x3, 0xf4,
-    0x0, 0x4, 0xf3, 0x0, 0x5, 0xf1, 0x0, 0x7,
-    0xf0, 0x0, 0x9, 0xd0, 0x0, 0xc, 0xa0, 0x0,
-    0xf, 0x70, 0x0, 0x4f, 0x20, 0x0, 0x9e, 0x0,
-    0x0, 0xe8, 0x0, 0x5, 0xf2, 0x0, 0xc, 0xa0,
-    0x0, 0x4f, 0x20, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0xe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe2, 0x0, 0x0, 0x9, 0x20, 0xe, 0x20, 0x8,
-    0x20, 0x9f, 0x80, 0xe2, 0x5e, 0xb2, 0x0, 0x2b,
-    0xdf, 0xdd, 0x50, 0x0, 0x0, 0x1c, 0xff, 0x30,
-    0x0, 0x0, 0x6e, 0xaf, 0x9f, 0x91, 0x1, 0xdc,
-    0x30, 0xe2, 0x2a, 0xe4, 0x5, 0x0, 0xe, 0x20,
-    0x4, 0x10, 0x0, 0x0, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x10, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x1, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0,
-    0x0, 0x11, 0x11, 0x3f, 0x41, 0x11, 0x10, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x44, 0x44,
-    0x5f, 0x64, 0x44, 0x43, 0x0, 0x0, 0x2, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xc2, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x6, 0x60, 0x3f, 0xf3, 0x1d, 0xf2, 0x6, 0xd0,
-    0xa, 0x80, 0xe, 0x40, 0x2f, 0x0,
-
-    /* U+002D "-" */
-    0x1, 0x11, 0x11, 0x11, 0x2, 0xff, 0xff, 0xff,
-    0xf9, 0x4, 0x44, 0x44, 0x44, 0x20,
-
-    /* U+002E "." */
-    0x7, 0x70, 0x3f, 0xf3, 0x1d, 0xd1,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x74, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xba, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x8d, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x3, 0xae, 0xff, 0xd9, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xe9, 0x77, 0xaf, 0xf7,
-    0x0, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x90, 0x1f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf1, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf1, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf1, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x1f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xd0, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x90, 0x8,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x1,
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xe9, 0x77,
-    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae,
-    0xff, 0xd8, 0x20, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xbf, 0xff, 0xff, 0xf4, 0x66, 0x66, 0xcf, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x9, 0xf0, 0x0,
-    0x0, 0x9f, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x9, 0xf0,
-
-    /* U+0032 "2" */
-    0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa4, 0x0, 0x0,
-    0x1, 0xaf, 0xea, 0x86, 0x79, 0xdf, 0xb1, 0x0,
-    0x1d, 0xf6, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-
-    /* U+0033 "3" */
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x5, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xc7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x34, 0x46, 0xaf, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x3a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x4f, 0xd5, 0x0, 0x0, 0x0, 0x4, 0xee, 0x10,
-    0x2, 0xcf, 0xea, 0x87, 0x79, 0xdf, 0xd2, 0x0,
-    0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0,
-    0xb, 0xe1, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xc0,
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x3, 0xfa, 0x11, 0x11, 0x11,
-    0x11, 0x1b, 0xc1, 0x11, 0x10, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x4c, 0xd4, 0x44, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0xd, 0xc6, 0x66, 0x66, 0x66, 0x66, 0x20,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xfe, 0xc7, 0x10, 0x0,
-    0x0, 0x34, 0x44, 0x44, 0x68, 0xbf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4,
-    0x9, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0,
-    0xd, 0xf8, 0x10, 0x0, 0x0, 0x1, 0xbf, 0x50,
-    0x0, 0x8f, 0xfc, 0x97, 0x78, 0xbf, 0xf6, 0x0,
-    0x0, 0x1, 0x6b, 0xef, 0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x1, 0x6b, 0xef, 0xfe, 0xc7, 0x10,
-    0x0, 0x0, 0x6, 0xff, 0xb7, 0x66, 0x79, 0xe8,
-    0x0, 0x0, 0x9, 0xf9, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x40, 0x4, 0xae,
-    0xff, 0xfb, 0x50, 0x0, 0x4, 0xf3, 0xa, 0xfa,
-    0x64, 0x46, 0xbf, 0xc1, 0x0, 0x5f, 0x3a, 0xd2,
-    0x0, 0x0, 0x0, 0x4f, 0xc0, 0x5, 0xf8, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x60, 0x3f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x1, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-    0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x1e, 0xe4, 0x0, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x1c, 0xfc, 0x75, 0x58, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x5, 0xae, 0xff, 0xea,
-    0x40, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xfb, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xe0,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x0,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x63, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x4a, 0xdf, 0xff, 0xd9, 0x40, 0x0,
-    0x0, 0x1, 0xcf, 0xc8, 0x55, 0x68, 0xdf, 0xb1,
-    0x0, 0x0, 0xde, 0x40, 0x0, 0x0, 0x0, 0x5f,
-    0xc0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0xa, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xa0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0x10, 0x0, 0x4f, 0xd6, 0x20,
-    0x0, 0x26, 0xde, 0x30, 0x0, 0x0, 0x2d, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x4e, 0xe8,
-    0x44, 0x44, 0x59, 0xee, 0x40, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0x40, 0xe, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x4, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x7f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x66,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x4f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x30, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xd0, 0x3, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x3d,
-    0xf3, 0x0, 0x3, 0xef, 0xc8, 0x65, 0x68, 0xcf,
-    0xd3, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xda,
-    0x50, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x4a, 0xef, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc7, 0x55, 0x7b, 0xfc, 0x20,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x2, 0xce,
-    0x10, 0x0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xa0, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xcf, 0x40, 0x1e, 0xd1, 0x0,
-    0x0, 0x0, 0x8, 0xe3, 0xf6, 0x0, 0x3e, 0xf8,
-    0x31, 0x12, 0x6d, 0xe2, 0x2f, 0x60, 0x0, 0x19,
-    0xef, 0xff, 0xfe, 0x81, 0x2, 0xf5, 0x0, 0x0,
-    0x0, 0x23, 0x32, 0x0, 0x0, 0x3f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x19, 0xf9,
-    0x0, 0x0, 0x7, 0xfb, 0x86, 0x67, 0xbf, 0xf7,
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xeb, 0x71,
-    0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x1d, 0xd1, 0x3f, 0xf3, 0x7, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x70, 0x3f, 0xf3, 0x1d, 0xd1,
-
-    /* U+003B ";" */
-    0x1d, 0xd1, 0x3f, 0xf3, 0x7, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x60, 0x3f, 0xf3, 0x1d, 0xf2,
-    0x6, 0xd0, 0xa, 0x80, 0xe, 0x40, 0x2f, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3a, 0xfd, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xb5, 0x0, 0x0, 0x2, 0x9f, 0xe8,
-    0x20, 0x0, 0x0, 0x5c, 0xfc, 0x50, 0x0, 0x0,
-    0x7, 0xef, 0x92, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xd7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xf9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xce, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x20,
-
-    /* U+003D "=" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33,
-
-    /* U+003E ">" */
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xd6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xfc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xe8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xe0, 0x0, 0x0,
-    0x0, 0x17, 0xdf, 0xa3, 0x0, 0x0, 0x3, 0xaf,
-    0xe7, 0x10, 0x0, 0x0, 0x6d, 0xfb, 0x40, 0x0,
-    0x0, 0x39, 0xfe, 0x82, 0x0, 0x0, 0x0, 0xd,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x3, 0x9c, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-    0x1b, 0xfd, 0x96, 0x56, 0x8d, 0xfb, 0x0, 0x2e,
-    0xd4, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x1, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xd1, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xef, 0xff,
-    0xeb, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xfb, 0x74, 0x32, 0x34, 0x6a,
-    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xce, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0,
-    0x0, 0x1, 0xe9, 0x0, 0x0, 0x1, 0x8d, 0xff,
-    0xea, 0x30, 0x7, 0xe0, 0x6, 0xf2, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x5, 0xfd, 0x63, 0x24, 0x8e,
-    0x90, 0x7e, 0x0, 0xa, 0xb0, 0x0, 0x2f, 0x40,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x1b, 0xa7,
-    0xe0, 0x0, 0x1f, 0x30, 0x8, 0xc0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xc, 0xce, 0x0,
-    0x0, 0xa9, 0x0, 0xd7, 0x0, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x5,
-    0xe0, 0x1f, 0x30, 0x0, 0xf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x1f, 0x13,
-    0xf0, 0x0, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xe0, 0x0, 0x0, 0xe3, 0x4e, 0x0,
-    0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x0, 0x0, 0xd, 0x55, 0xe0, 0x0, 0x4,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0xd5, 0x4e, 0x0, 0x0, 0x2f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0, 0x0,
-    0xe, 0x43, 0xf0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0xf2,
-    0xf, 0x30, 0x0, 0x9, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x0, 0x0, 0x3f, 0x0, 0xd7,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x1,
-    0xdb, 0xe0, 0x0, 0x8, 0xb0, 0x8, 0xd0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x2, 0xc9, 0x5f,
-    0x10, 0x1, 0xe4, 0x0, 0x1f, 0x40, 0x0, 0x0,
-    0x5f, 0xe8, 0x54, 0x5a, 0xf9, 0x1, 0xec, 0x55,
-    0xda, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x18,
-    0xdf, 0xfe, 0xa3, 0x0, 0x3, 0xcf, 0xe8, 0x0,
-    0x0, 0x1, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xce,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xfb,
-    0x75, 0x33, 0x35, 0x8d, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xef,
-    0xff, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xb0, 0x9e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x2,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbd, 0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0x0, 0x4f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0xe, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0,
-    0x7f, 0x20, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0xea, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x6f, 0x41, 0x11, 0x11, 0x11, 0x11,
-    0x2f, 0x80, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x5, 0xf6,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0xf7, 0x0,
-    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x0, 0x3f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x60, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x2,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf4, 0x9f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xc0,
-
-    /* U+0042 "B" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0,
-    0x0, 0x5f, 0x75, 0x55, 0x55, 0x55, 0x68, 0xdf,
-    0xb1, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x40, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x90, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x90, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xec,
-    0x0, 0x5f, 0x41, 0x11, 0x11, 0x11, 0x24, 0x9f,
-    0xb1, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x5f, 0x64, 0x44, 0x44, 0x44,
-    0x45, 0x7b, 0xfb, 0x10, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xd0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xea, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4e, 0xd0, 0x5f, 0x75, 0x55, 0x55, 0x55,
-    0x56, 0x8d, 0xfc, 0x10, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0x40, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x5, 0x9d, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xea, 0x76,
-    0x79, 0xdf, 0xe5, 0x0, 0x0, 0x0, 0xaf, 0xc4,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0x90, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x60,
-    0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x70, 0x0, 0x0, 0xaf, 0xc4,
-    0x0, 0x0, 0x0, 0x3, 0xbf, 0x80, 0x0, 0x0,
-    0x5, 0xef, 0xea, 0x87, 0x79, 0xdf, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x9d, 0xff, 0xfd, 0xa5,
-    0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x66, 0x66, 0x66, 0x68,
-    0xae, 0xfc, 0x30, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0x80, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf6, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xb0, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x5, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf1, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x15, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xb0, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0x80, 0x0, 0x5,
-    0xf8, 0x66, 0x66, 0x66, 0x68, 0xae, 0xfc, 0x30,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xec,
-    0x83, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x5f, 0x86, 0x66, 0x66, 0x66, 0x66, 0x66, 0x40,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x41, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x5f, 0x64, 0x44, 0x44, 0x44, 0x44, 0x41, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x86, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+0046 "F" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5,
-    0xf8, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf4, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x5, 0xf6, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x10, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa6,
-    0x10, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xea, 0x76,
-    0x79, 0xcf, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0xc4,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0xc0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x80,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x60, 0x4f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf2, 0xe, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf2, 0x9, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf2, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf2, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0xaf, 0xc4,
-    0x0, 0x0, 0x0, 0x2, 0x9f, 0xc0, 0x0, 0x0,
-    0x5, 0xdf, 0xea, 0x87, 0x79, 0xcf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa6,
-    0x10, 0x0,
-
-    /* U+0048 "H" */
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x5f, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0xcc, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x5f, 0x64, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0xdc, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcc,
-
-    /* U+0049 "I" */
-    0x5f, 0x35, 0xf3, 0x5f, 0x35, 0xf3, 0x5f, 0x35,
-    0xf3, 0x5f, 0x35, 0xf3, 0x5f, 0x35, 0xf3, 0x5f,
-    0x35, 0xf3, 0x5f, 0x35, 0xf3, 0x5f, 0x35, 0xf3,
-    0x5f, 0x35, 0xf3, 0x5f, 0x35, 0xf3, 0x5f, 0x30,
-
-    /* U+004A "J" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x66, 0x66, 0x66, 0x69, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10, 0x94,
-    0x0, 0x0, 0x0, 0xc, 0xd0, 0xa, 0xf6, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0xa, 0xfd, 0x86, 0x7c,
-    0xfa, 0x0, 0x0, 0x4, 0xae, 0xff, 0xc6, 0x0,
-    0x0,
-
-    /* U+004B "K" */
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xa0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x2, 0xeb, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x2e, 0xc0, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x2, 0xec, 0x0, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x2e, 0xc1, 0x0, 0x0, 0x0, 0x5f,
-    0x30, 0x0, 0x1, 0xed, 0x10, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x1d, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x30, 0x1, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x1d, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x31, 0xce, 0x26, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x3c, 0xe2, 0x0,
-    0x8f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0xee, 0x30,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0xf3,
-    0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0xd, 0xe2, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x1, 0xed, 0x10,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x80, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf5,
-
-    /* U+004C "L" */
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-
-    /* U+004D "M" */
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x5, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x5f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x5, 0xfc, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0xf0, 0x5f, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0x8f, 0x5, 0xf2, 0x7f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x18, 0xf0, 0x5f, 0x20, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x8f,
-    0x5, 0xf2, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xd0, 0x8, 0xf0, 0x5f, 0x20, 0xb, 0xd0,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x8f, 0x5,
-    0xf2, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0xcb,
-    0x0, 0x8, 0xf0, 0x5f, 0x20, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x5f, 0x20, 0x0, 0x8f, 0x5, 0xf2,
-    0x0, 0x0, 0xe9, 0x0, 0x0, 0xd, 0x90, 0x0,
-    0x8, 0xf0, 0x5f, 0x20, 0x0, 0x5, 0xf3, 0x0,
-    0x7, 0xe1, 0x0, 0x0, 0x8f, 0x5, 0xf2, 0x0,
-    0x0, 0xc, 0xc0, 0x1, 0xf6, 0x0, 0x0, 0x8,
-    0xf0, 0x5f, 0x20, 0x0, 0x0, 0x3f, 0x50, 0xad,
-    0x0, 0x0, 0x0, 0x8f, 0x5, 0xf2, 0x0, 0x0,
-    0x0, 0xae, 0x4f, 0x40, 0x0, 0x0, 0x8, 0xf0,
-    0x5f, 0x20, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x7f, 0x5, 0xf2, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x5f,
-    0x20, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x5, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x5f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0,
-
-    /* U+004E "N" */
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcc, 0x5f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcc, 0x5f, 0x7f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcc, 0x5f, 0x37, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f, 0x30, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f, 0x30,
-    0xd, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x5f,
-    0x30, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0x5f, 0x30, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0xcc, 0x5f, 0x30, 0x0, 0x8, 0xf6, 0x0, 0x0,
-    0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0, 0xbf, 0x30,
-    0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0, 0x1e,
-    0xe1, 0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0xcc, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x6f, 0x80, 0x0, 0xcc, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0xcc, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0xcc,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xd0,
-    0xcc, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0xcc, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfc, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdc,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xfe,
-    0xa7, 0x67, 0x9d, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc4, 0x0, 0x0, 0x0, 0x3, 0xbf,
-    0xb1, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x8f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xa0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf1, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x44,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x74, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x40, 0xea, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x2f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0xaf, 0xc4, 0x0, 0x0, 0x0, 0x3, 0xbf,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xfe, 0xa8,
-    0x77, 0x9d, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa5, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x5f, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x30, 0x0,
-    0x5, 0xf8, 0x66, 0x66, 0x66, 0x7a, 0xef, 0xb1,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xe1, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xb0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x35, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x85, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf5, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0x30, 0x5f, 0x41,
-    0x11, 0x11, 0x12, 0x49, 0xfe, 0x40, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd8, 0x10, 0x0, 0x5f,
-    0x64, 0x44, 0x44, 0x43, 0x10, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf,
-    0xea, 0x76, 0x79, 0xdf, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc4, 0x0, 0x0, 0x0, 0x3,
-    0xbf, 0xb1, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0xe, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x4f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x70, 0x4f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0xe, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x10,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0,
-    0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc4, 0x0, 0x0, 0x0, 0x3,
-    0xbf, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf,
-    0xea, 0x87, 0x79, 0xdf, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfe, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xee, 0x20, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xe3,
-    0x0, 0x0, 0x3, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0x93, 0x13, 0x8f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x32, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x30, 0x0,
-    0x5, 0xf8, 0x66, 0x66, 0x66, 0x7a, 0xef, 0xb1,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xe1, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xb0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x35, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x85, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf4, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0x30, 0x5f, 0x41,
-    0x11, 0x11, 0x12, 0x49, 0xfe, 0x40, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x5f,
-    0x64, 0x44, 0x44, 0x43, 0x8f, 0x30, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xce, 0x10, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x1, 0xeb, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x4a, 0xdf, 0xff, 0xd9, 0x50, 0x0,
-    0x0, 0x1c, 0xfd, 0x86, 0x56, 0x9c, 0xfe, 0x50,
-    0x0, 0xde, 0x40, 0x0, 0x0, 0x0, 0x2a, 0x90,
-    0x7, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xa6, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xcf, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0xcf, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x1a, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf4,
-    0x2e, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x1, 0xaf, 0xfb, 0x86, 0x67, 0x9e, 0xfa, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xfe, 0xc9, 0x30, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc5, 0x66, 0x66, 0x66, 0x9f, 0x86, 0x66, 0x66,
-    0x65, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf5, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf5, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf5, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf5,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf5, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf5, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf5, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf4, 0x7f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf3, 0x4f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0xb, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x10, 0x0, 0x7f, 0xb2, 0x0, 0x0, 0x0,
-    0x3d, 0xf4, 0x0, 0x0, 0x6, 0xff, 0xc8, 0x77,
-    0x9c, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x9f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x32, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xc0, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbd, 0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0x0, 0x5, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xe0, 0x0, 0x0,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x1, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0x0, 0x0, 0xb, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0xae, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xec, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf3, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x94,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3, 0xe,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x2f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x4, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0xbc, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0xe, 0xa0,
-    0x0, 0x0, 0x0, 0x2, 0xf5, 0x5, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0xf, 0x70, 0x0,
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0xd, 0xa0, 0x0, 0xad, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0xe, 0xa0, 0x0,
-    0x0, 0x2, 0xf4, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0xad, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x8e, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x5,
-    0xf2, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x3,
-    0xf4, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x9e,
-    0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0xe, 0x80,
-    0x0, 0x0, 0x0, 0x9e, 0x0, 0x5, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xb0, 0x4, 0xf3, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0x0, 0xbd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x90, 0x1f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf6, 0xe, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8e, 0x6, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xb4, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x7, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xeb, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x10, 0x0, 0x1e, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x30, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x10, 0x0, 0xb, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xec, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xb0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe1,
-    0x0, 0xce, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf3, 0x0, 0x1, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xeb, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0xce, 0x10, 0x0, 0x0, 0x0,
-    0xc, 0xe1, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xc0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x1e, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-
-    /* U+0059 "Y" */
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x40, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xa0, 0x5, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0xb, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x0, 0x0,
-    0x0, 0x7f, 0x30, 0x0, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x1e,
-    0x90, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0,
-    0x9, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xa0, 0x0, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x40, 0x7f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcd, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xd6, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x62, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+005B "[" */
-    0x5f, 0xff, 0xf7, 0x5f, 0x64, 0x42, 0x5f, 0x20,
-    0x0, 0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f,
-    0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0,
-    0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f, 0x20,
-    0x0, 0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f,
-    0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0,
-    0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f, 0x20,
-    0x0, 0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f,
-    0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0,
-    0x5f, 0x20, 0x0, 0x5f, 0x20, 0x0, 0x5f, 0x65,
-    0x52, 0x5f, 0xff, 0xf7,
-
-    /* U+005C "\\" */
-    0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0xab, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xba,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xab, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-
-    /* U+005D "]" */
-    0x5f, 0xff, 0xf8, 0x14, 0x44, 0xf8, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0xf8, 0x15, 0x55,
-    0xf8, 0x5f, 0xff, 0xf8,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x1, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x5, 0xd0, 0xb7,
-    0x0, 0x0, 0x0, 0x0, 0xc7, 0x5, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0x10, 0xe, 0x50, 0x0, 0x0,
-    0x9, 0xa0, 0x0, 0x8b, 0x0, 0x0, 0x0, 0xf3,
-    0x0, 0x2, 0xf2, 0x0, 0x0, 0x6d, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0xd, 0x60, 0x0, 0x0, 0x4f,
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0xe6, 0x0,
-    0xa9, 0x0, 0x0, 0x0, 0x8, 0xc0, 0x1f, 0x30,
-    0x0, 0x0, 0x0, 0x1f, 0x30,
-
-    /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-
-    /* U+0060 "`" */
-    0x28, 0x60, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x2c, 0xc1, 0x0, 0x0, 0x9, 0xe3,
-
-    /* U+0061 "a" */
-    0x0, 0x3, 0x9c, 0xff, 0xec, 0x60, 0x0, 0x1,
-    0xbf, 0xd8, 0x65, 0x7b, 0xfd, 0x10, 0x9, 0xd4,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0x17, 0xce, 0xff, 0xff, 0xff, 0xf7,
-    0x2, 0xed, 0x73, 0x22, 0x22, 0x23, 0xf7, 0xc,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x2f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x3f, 0x40, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x1f, 0x70, 0x0, 0x0,
-    0x0, 0xa, 0xf7, 0xb, 0xe1, 0x0, 0x0, 0x0,
-    0x8b, 0xf7, 0x1, 0xde, 0x73, 0x23, 0x6c, 0xc1,
-    0xf7, 0x0, 0x7, 0xcf, 0xfe, 0xb6, 0x0, 0xf7,
-
-    /* U+0062 "b" */
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x29, 0xdf, 0xfe, 0xa3, 0x0, 0x0,
-    0xdb, 0x7, 0xfd, 0x86, 0x69, 0xdf, 0xa0, 0x0,
-    0xdb, 0x7f, 0x50, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0xdd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0xdd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0xda, 0x7f, 0x50, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0xda, 0x7, 0xfd, 0x86, 0x69, 0xdf, 0xa0, 0x0,
-    0xda, 0x0, 0x29, 0xdf, 0xfe, 0xa3, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x18, 0xcf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x6f, 0xfa, 0x76, 0x7b, 0xfd, 0x20, 0x0,
-    0x7f, 0xa1, 0x0, 0x0, 0x2, 0xde, 0x10, 0x4f,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0x70, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0x0, 0x7, 0xfa, 0x10, 0x0, 0x0, 0x2d,
-    0xe1, 0x0, 0x6, 0xff, 0xa7, 0x67, 0xbf, 0xd2,
-    0x0, 0x0, 0x1, 0x8c, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf1, 0x0, 0x0, 0x28, 0xdf, 0xfe,
-    0xa4, 0x0, 0x6f, 0x10, 0x0, 0x7f, 0xfa, 0x76,
-    0x7c, 0xfa, 0x6, 0xf1, 0x0, 0x8f, 0x91, 0x0,
-    0x0, 0x3, 0xdb, 0x6f, 0x10, 0x4f, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xdd, 0xf1, 0xd, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x13, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x6f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x18, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf1, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x16,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1,
-    0x3f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x10, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf1, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xdf, 0x10, 0x8, 0xf9, 0x10, 0x0, 0x0, 0x3d,
-    0xb6, 0xf1, 0x0, 0x7, 0xff, 0xa7, 0x67, 0xcf,
-    0xa0, 0x6f, 0x10, 0x0, 0x2, 0x8d, 0xff, 0xea,
-    0x40, 0x6, 0xf1,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x29, 0xdf, 0xfd, 0x92, 0x0, 0x0,
-    0x0, 0x8, 0xfd, 0x85, 0x68, 0xdf, 0x80, 0x0,
-    0x0, 0x9f, 0x70, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0xd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xc0,
-    0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2,
-    0x6f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf5,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x8f, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0,
-    0x0, 0x7f, 0xa1, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x6, 0xff, 0xa7, 0x67, 0xaf, 0xf5, 0x0,
-    0x0, 0x0, 0x17, 0xcf, 0xff, 0xc7, 0x10, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x7, 0xdf, 0xfb, 0x40, 0x0, 0xa,
-    0xf9, 0x55, 0x9a, 0x0, 0x3, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x2, 0x55,
-    0xaf, 0x55, 0x55, 0x40, 0x0, 0x8, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb5, 0x0, 0x2f,
-    0x40, 0x0, 0x8f, 0xd8, 0x54, 0x58, 0xec, 0x22,
-    0xf4, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x9e,
-    0x4f, 0x40, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x8d, 0xf4, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x44, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf4, 0x7f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x48, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0x7f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x45, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x7f, 0x7f, 0x40, 0x1,
-    0xbf, 0xb5, 0x21, 0x26, 0xcf, 0x53, 0xf4, 0x0,
-    0x0, 0x6d, 0xff, 0xff, 0xf9, 0x20, 0x3f, 0x40,
-    0x0, 0x0, 0x1, 0x34, 0x20, 0x0, 0x4, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xd0, 0x0, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x4f, 0xc4, 0x0, 0x0, 0x0, 0x4,
-    0xed, 0x0, 0x0, 0x4d, 0xfd, 0x96, 0x56, 0x8c,
-    0xfc, 0x10, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfd,
-    0xa5, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x4b,
-    0xef, 0xfd, 0x81, 0x0, 0xd, 0xb0, 0xbf, 0xb7,
-    0x67, 0xaf, 0xf4, 0x0, 0xdb, 0xbc, 0x20, 0x0,
-    0x0, 0x2d, 0xf1, 0xd, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xae, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf1, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x2d, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x3d, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x3d,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x3d, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x3d, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3,
-
-    /* U+0069 "i" */
-    0x1d, 0xd0, 0x3f, 0xf1, 0x5, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xb0, 0xd, 0xb0,
-    0xd, 0xb0, 0xd, 0xb0, 0xd, 0xb0, 0xd, 0xb0,
-    0xd, 0xb0, 0xd, 0xb0, 0xd, 0xb0, 0xd, 0xb0,
-    0xd, 0xb0, 0xd, 0xb0, 0xd, 0xb0, 0xd, 0xb0,
-    0xd, 0xb0, 0xd, 0xb0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0xce, 0x10, 0x0, 0x0, 0x1f,
-    0xf3, 0x0, 0x0, 0x0, 0x45, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0,
-    0xad, 0x0, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x0,
-    0x0, 0xad, 0x0, 0x0, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0x0, 0xad, 0x0, 0x0, 0x0, 0xa, 0xd0,
-    0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0, 0xa,
-    0xd0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
-    0xa, 0xd0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0xcc,
-    0x0, 0x0, 0x0, 0x2f, 0x70, 0x6c, 0x65, 0x7e,
-    0xe1, 0x1, 0xae, 0xfe, 0xa1, 0x0,
-
-    /* U+006B "k" */
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xe3, 0xd, 0xb0, 0x0, 0x0,
-    0x0, 0x1d, 0xe2, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x1d, 0xe2, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x2e,
-    0xd1, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x3e, 0xd1,
-    0x0, 0x0, 0xd, 0xb0, 0x0, 0x4f, 0xc1, 0x0,
-    0x0, 0x0, 0xdb, 0x0, 0x4f, 0xf1, 0x0, 0x0,
-    0x0, 0xd, 0xb0, 0x5f, 0xbf, 0xa0, 0x0, 0x0,
-    0x0, 0xdb, 0x6f, 0x90, 0x7f, 0x70, 0x0, 0x0,
-    0xd, 0xff, 0x80, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0xde, 0x10, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0xd, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xd0,
-
-    /* U+006C "l" */
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-    0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-
-    /* U+006D "m" */
-    0xda, 0x0, 0x5b, 0xef, 0xfc, 0x60, 0x0, 0x0,
-    0x5b, 0xef, 0xfc, 0x70, 0x0, 0xda, 0x1c, 0xe8,
-    0x54, 0x5a, 0xfd, 0x10, 0x1c, 0xf9, 0x54, 0x59,
-    0xfd, 0x20, 0xda, 0xca, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0xdc, 0x10, 0x0, 0x0, 0x2e, 0xd0, 0xdf,
-    0xc0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xd0, 0x0,
-    0x0, 0x0, 0x4, 0xf5, 0xdf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xea, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9e, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9e, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-
-    /* U+006E "n" */
-    0xda, 0x0, 0x5b, 0xef, 0xfd, 0x81, 0x0, 0xd,
-    0xa0, 0xbf, 0x95, 0x45, 0x8e, 0xf4, 0x0, 0xda,
-    0xcb, 0x10, 0x0, 0x0, 0x1c, 0xf1, 0xd, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0xd, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf1, 0xdc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x2d, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x3d, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x3d, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x3d, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x3d, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x18, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfa, 0x76, 0x7b, 0xfd, 0x20,
-    0x0, 0x0, 0x7f, 0x91, 0x0, 0x0, 0x3, 0xdf,
-    0x20, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xdd, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xc0, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x8, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf1, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x16, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x2f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0xcd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x60, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xd0, 0x0, 0x7,
-    0xf9, 0x10, 0x0, 0x0, 0x3d, 0xe2, 0x0, 0x0,
-    0x6, 0xff, 0xa7, 0x67, 0xbf, 0xd2, 0x0, 0x0,
-    0x0, 0x1, 0x8d, 0xff, 0xeb, 0x50, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0xda, 0x0, 0x29, 0xdf, 0xfe, 0xa3, 0x0, 0x0,
-    0xda, 0x7, 0xfd, 0x86, 0x69, 0xdf, 0xa0, 0x0,
-    0xda, 0x7f, 0x50, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0xdd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0xda, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0xdd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0xdb, 0x7f, 0x50, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0xdb, 0x7, 0xfd, 0x86, 0x69, 0xdf, 0xa0, 0x0,
-    0xdb, 0x0, 0x29, 0xdf, 0xfe, 0xa3, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xa4, 0x0, 0x6f,
-    0x10, 0x0, 0x7f, 0xfa, 0x76, 0x7c, 0xfa, 0x6,
-    0xf1, 0x0, 0x8f, 0x91, 0x0, 0x0, 0x3, 0xdb,
-    0x6f, 0x10, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xdd, 0xf1, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x13, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x18, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf1, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x16, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x3f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xdf, 0x10, 0x8,
-    0xf9, 0x10, 0x0, 0x0, 0x3d, 0xb6, 0xf1, 0x0,
-    0x7, 0xff, 0xa7, 0x67, 0xcf, 0xa0, 0x6f, 0x10,
-    0x0, 0x2, 0x8d, 0xff, 0xea, 0x40, 0x6, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf1,
-
-    /* U+0072 "r" */
-    0xda, 0x0, 0x6b, 0xe9, 0xda, 0x1d, 0xe9, 0x63,
-    0xda, 0xca, 0x0, 0x0, 0xde, 0xc0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x2, 0x8d, 0xff, 0xec, 0x82, 0x0, 0x0,
-    0x5f, 0xd8, 0x65, 0x69, 0xef, 0x70, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x6, 0x30, 0x7, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0xc9, 0x63, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0x9c, 0xff, 0xe7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xaf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0xd, 0x91, 0x0, 0x0, 0x0,
-    0x1d, 0xd0, 0x7, 0xff, 0xb7, 0x65, 0x69, 0xfe,
-    0x20, 0x0, 0x16, 0xbe, 0xff, 0xec, 0x70, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x4, 0x70, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0x2, 0x55, 0xaf, 0x55, 0x55,
-    0x40, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x95, 0x5a,
-    0xb0, 0x0, 0x0, 0x8d, 0xff, 0xb3,
-
-    /* U+0075 "u" */
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9e, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xe9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0xbd, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x6f, 0x50, 0x0, 0x0,
-    0x0, 0xc, 0xee, 0xd, 0xe4, 0x0, 0x0, 0x1,
-    0xbc, 0x9e, 0x2, 0xdf, 0xb7, 0x67, 0xaf, 0xc1,
-    0x8e, 0x0, 0x7, 0xce, 0xff, 0xb6, 0x0, 0x8e,
-
-    /* U+0076 "v" */
-    0xbe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1,
-    0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0xea, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x7f, 0x10, 0x0, 0x0, 0x3, 0xf5, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0x9, 0xe0, 0x0, 0x0, 0x1f, 0x60, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0xbd, 0x0, 0x0, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x6, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xb0, 0xd, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf2, 0x4f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe9, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x8e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x2f, 0x40, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x6, 0xf0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0xa,
-    0xce, 0x80, 0x0, 0x0, 0x0, 0xb, 0xa0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0x68, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0x40, 0x1, 0xf6, 0x0, 0x0,
-    0x0, 0x6f, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x7e,
-    0x0, 0x0, 0xab, 0x0, 0x0, 0x0, 0xca, 0x0,
-    0xca, 0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x2, 0xf4, 0x0, 0x6f, 0x0, 0x0,
-    0x3, 0xf2, 0x0, 0x0, 0xe, 0x70, 0x0, 0x8,
-    0xd0, 0x0, 0x1f, 0x60, 0x0, 0x9, 0xc0, 0x0,
-    0x0, 0x8, 0xd0, 0x0, 0xe, 0x70, 0x0, 0xa,
-    0xc0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x2, 0xf3,
-    0x0, 0x4f, 0x10, 0x0, 0x4, 0xf2, 0x0, 0x5f,
-    0x10, 0x0, 0x0, 0x0, 0xd9, 0x0, 0xab, 0x0,
-    0x0, 0x0, 0xe8, 0x0, 0xba, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x8d,
-    0x1, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x46,
-    0xe0, 0x0, 0x0, 0x0, 0x2f, 0x47, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xac, 0x90, 0x0, 0x0,
-    0x0, 0xc, 0xad, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0xc, 0xc0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xcd, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xeb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x5b,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x1e,
-    0xb0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x8f,
-    0x30, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0xbe,
-    0x10, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xeb,
-    0x1, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-
-    /* U+0079 "y" */
-    0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x80, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf1, 0x0, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xda, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-    0x3, 0xf4, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0xad, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0,
-    0x0, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x2f, 0x70,
-    0x0, 0x8, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf5, 0x0, 0x6f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0xd, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x34, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xda, 0xbc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0x20, 0x0, 0xb, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x85, 0x6c, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8d, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x55,
-    0x55, 0x55, 0x55, 0x5c, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa5, 0x55, 0x55, 0x55,
-    0x55, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x5c, 0xfe, 0x0, 0x4, 0xfc, 0x54,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x1, 0x3f, 0x90, 0x0, 0x2f, 0xfe, 0x10, 0x0,
-    0x4, 0x6f, 0x70, 0x0, 0x0, 0xc, 0xb0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x9, 0xf1, 0x0,
-    0x0, 0x3, 0xfc, 0x64, 0x0, 0x0, 0x4c, 0xfe,
-
-    /* U+007C "|" */
-    0x5f, 0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x15,
-    0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f,
-    0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x15, 0xf1,
-    0x5f, 0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x15,
-    0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f,
-    0x15, 0xf1,
-
-    /* U+007D "}" */
-    0x5f, 0xea, 0x20, 0x0, 0x14, 0x7e, 0xe0, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x2, 0xf5, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x1, 0xf6, 0x0,
-    0x0, 0x0, 0xfb, 0x10, 0x0, 0x0, 0x5f, 0xfb,
-    0x0, 0x0, 0xdd, 0x42, 0x0, 0x1, 0xf6, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x2, 0xf5, 0x0, 0x0, 0x6, 0xf3, 0x0,
-    0x15, 0x7f, 0xd0, 0x0, 0x5f, 0xea, 0x10, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x5d, 0xfd, 0x60, 0x0, 0x0, 0xf, 0x10,
-    0x4f, 0x63, 0x6e, 0xb0, 0x0, 0x4, 0xe0, 0xc,
-    0x60, 0x0, 0x1d, 0xd3, 0x3, 0xd7, 0x0, 0xf1,
-    0x0, 0x0, 0x9, 0xff, 0xf9, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x1, 0x31, 0x0, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x16, 0x10, 0x1, 0x61, 0x0, 0x0,
-    0xbb, 0x0, 0xb, 0xc0, 0x0, 0x7, 0xe1, 0x0,
-    0x7e, 0x10, 0x0, 0x4f, 0x40, 0x4, 0xf4, 0x0,
-    0x1, 0xe7, 0x0, 0x1e, 0x80, 0x0, 0xc, 0xb0,
-    0x0, 0xcb, 0x0, 0x0, 0x3f, 0x50, 0x3, 0xf5,
-    0x0, 0x0, 0x7, 0xe1, 0x0, 0x7e, 0x10, 0x0,
-    0x0, 0xbc, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x1e,
-    0x80, 0x1, 0xe8, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x6e, 0x20, 0x6, 0xf2,
-
-    /* U+00BB "»" */
-    0x45, 0x0, 0x4, 0x50, 0x0, 0x0, 0x2f, 0x50,
-    0x2, 0xf6, 0x0, 0x0, 0x5, 0xf2, 0x0, 0x5f,
-    0x20, 0x0, 0x0, 0x9d, 0x0, 0x9, 0xd0, 0x0,
-    0x0, 0xc, 0xa0, 0x0, 0xca, 0x0, 0x0, 0x2,
-    0xe6, 0x0, 0x1e, 0x70, 0x0, 0x0, 0xad, 0x0,
-    0xa, 0xd0, 0x0, 0x5, 0xf2, 0x0, 0x5f, 0x20,
-    0x0, 0x2f, 0x50, 0x2, 0xf6, 0x0, 0x0, 0xd9,
-    0x0, 0xd, 0x90, 0x0, 0xa, 0xc0, 0x0, 0xac,
-    0x0, 0x0, 0x6e, 0x20, 0x6, 0xf2, 0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x3, 0x85, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x3f, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x50,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x61, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0x84, 0x44, 0x44, 0x44, 0x44, 0x42, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x9e, 0x20, 0x7, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x20, 0x9, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x3f, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x50,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x61, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0x84, 0x44, 0x44, 0x44, 0x44, 0x42, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+0402 "Ђ" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x46, 0x66, 0x66, 0x67,
-    0xfa, 0x66, 0x66, 0x66, 0x63, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x14, 0x78,
-    0x87, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x7c, 0xff, 0xec, 0xce, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe8, 0x40, 0x0,
-    0x0, 0x3a, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf2, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x65, 0x45, 0x8e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0xef,
-    0xff, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0x96, 0x66, 0x66, 0x66, 0x66, 0x65,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xfd, 0x97, 0x67,
-    0xad, 0xfd, 0x50, 0x0, 0x0, 0x9f, 0xd4, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0x80, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf9, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xfa, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x77, 0x0, 0x0, 0x9f, 0xd4, 0x0,
-    0x0, 0x0, 0x3, 0xcf, 0x70, 0x0, 0x0, 0x5e,
-    0xfe, 0x97, 0x78, 0xae, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x5, 0xad, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x39, 0xdf, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0xa, 0xfe, 0x96, 0x56, 0x8c, 0xff, 0x70,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x18, 0xb0,
-    0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xb6, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0xbf, 0xfe, 0xa6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x37, 0xbf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0xa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x1d, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x4e, 0xd0,
-    0x0, 0x8f, 0xfc, 0x86, 0x66, 0x9d, 0xfc, 0x10,
-    0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda, 0x40, 0x0,
-
-    /* U+0406 "І" */
-    0x3f, 0x53, 0xf5, 0x3f, 0x53, 0xf5, 0x3f, 0x53,
-    0xf5, 0x3f, 0x53, 0xf5, 0x3f, 0x53, 0xf5, 0x3f,
-    0x53, 0xf5, 0x3f, 0x53, 0xf5, 0x3f, 0x53, 0xf5,
-    0x3f, 0x53, 0xf5, 0x3f, 0x53, 0xf5, 0x3f, 0x50,
-
-    /* U+0407 "Ї" */
-    0x1e, 0xa0, 0x0, 0xcd, 0x2, 0xfc, 0x0, 0xe,
-    0xe0, 0x1, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x5, 0xf3,
-    0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x5f,
-    0x30, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x16,
-    0x66, 0x66, 0x66, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbd, 0xb, 0x20,
-    0x0, 0x0, 0x1, 0xf9, 0xd, 0xe3, 0x0, 0x0,
-    0xb, 0xf3, 0x1, 0xcf, 0xb7, 0x68, 0xef, 0x70,
-    0x0, 0x6, 0xcf, 0xfe, 0xb4, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x96, 0x66, 0x66,
-    0x66, 0x66, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x33, 0x33,
-    0x33, 0x34, 0x7c, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xed, 0x0, 0x0,
-    0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0xca, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0xe,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10, 0x0,
-    0x1, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x6f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xec, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x50, 0x0, 0x6, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xb0, 0x5, 0x8b, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe8, 0x88,
-    0x88, 0x88, 0x9c, 0xff, 0x90, 0x0, 0x9f, 0xe9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+040A "Њ" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15,
-    0xf8, 0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x30, 0x0,
-    0x3f, 0x84, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47,
-    0xfa, 0x44, 0x44, 0x44, 0x46, 0xaf, 0xf8, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0x60,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf5,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xc0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0x30,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0x55, 0x55, 0x55, 0x57, 0xbf, 0xe3, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x56, 0x66, 0x66, 0x69,
-    0xf9, 0x66, 0x66, 0x66, 0x62, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x15, 0xad, 0xff,
-    0xff, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0xff, 0xc8, 0x64, 0x58, 0xcf, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x71, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x70,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x85, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xb0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xbd,
-    0x10, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x8,
-    0xf3, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x4f, 0x60, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x1, 0xea, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x3f,
-    0x61, 0x11, 0x16, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x84, 0x44, 0x48, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0xc,
-    0xe2, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x10, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xb0,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x7, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x9f, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe1, 0x9f, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x30, 0x9f, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0x9f, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0x9f, 0x3f, 0x50,
-    0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0x9f, 0x3f,
-    0x50, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x9f,
-    0x3f, 0x50, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x9f, 0x3f, 0x50, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x0, 0x9f, 0x3f, 0x50, 0x0, 0x2f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x3f, 0x50, 0x0, 0xde, 0x10,
-    0x0, 0x0, 0x0, 0x9f, 0x3f, 0x50, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x3f, 0x50, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x3f, 0x53,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x3f,
-    0x6e, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x3f, 0xee, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0xd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0,
-    0x3f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdb,
-    0x30, 0x5, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xdf, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x7f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcc, 0x0, 0x0, 0xe, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x6,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xa0, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x20, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0xe9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x0, 0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf4, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x8e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xc0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf5, 0x2f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcd, 0xab, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0x66, 0xaf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf6, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf6, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x3f, 0x96, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x68, 0xf6, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xad, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xad, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xaa, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x23, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf4, 0x0, 0x4f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x6, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0x11, 0x11, 0x11, 0x11, 0x11, 0xae,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xb4,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x4c, 0xe0, 0x0,
-    0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x4, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0xb, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3,
-
-    /* U+0411 "Б" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3, 0xf9, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x40, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xeb, 0x60, 0x0, 0x3f, 0x73, 0x33,
-    0x33, 0x33, 0x47, 0xbf, 0xd2, 0x3, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xe1, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x83, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfc, 0x3, 0xf8, 0x55, 0x55, 0x55, 0x56, 0x8d,
-    0xfb, 0x10, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xec,
-    0x93, 0x0, 0x0,
-
-    /* U+0412 "В" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0x3f, 0x85, 0x55, 0x55, 0x55, 0x69, 0xef,
-    0x70, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf6, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x20, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x25, 0xbf,
-    0x60, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x3f, 0x73, 0x33, 0x33, 0x33,
-    0x45, 0x8d, 0xf6, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x70, 0x3f, 0x85, 0x55, 0x55, 0x55,
-    0x56, 0x9e, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xc8, 0x20, 0x0,
-
-    /* U+0413 "Г" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0x96, 0x66, 0x66, 0x66, 0x66, 0x65, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x0,
-    0x8, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x30, 0x0, 0x0, 0x0, 0xb, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xca, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x30, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x1,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x30,
-    0x0, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x30, 0x0,
-    0x0, 0x0, 0xca, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf3, 0x0, 0x0, 0x0, 0x2f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0,
-    0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf3, 0x0, 0x4, 0x7b, 0xf9, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x9f, 0x86, 0x63, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7b, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0xbc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x7b, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x7b,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf7,
-
-    /* U+0415 "Е" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x3f, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x50,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x61, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0x84, 0x44, 0x44, 0x44, 0x44, 0x42, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+0416 "Ж" */
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x1e,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0xaf, 0x10,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0, 0x0,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0xc, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0x10, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xa0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf5, 0x11, 0x11, 0xdb, 0x11,
-    0x11, 0x7f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x44, 0x44, 0xdc, 0x44, 0x44, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0xc, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x10,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x10, 0xc, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xb0,
-
-    /* U+0417 "З" */
-    0x0, 0x2, 0x7b, 0xef, 0xfe, 0xc9, 0x30, 0x0,
-    0x0, 0x3c, 0xfe, 0xa8, 0x66, 0x7a, 0xef, 0xa0,
-    0x0, 0x8, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x1, 0x11,
-    0x11, 0x26, 0xdd, 0x20, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x24,
-    0x44, 0x44, 0x59, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x46, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x7f, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0xf4, 0x0, 0x4d, 0xfe, 0xa7, 0x66, 0x68, 0xcf,
-    0xd3, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xff, 0xda,
-    0x50, 0x0, 0x0,
-
-    /* U+0418 "И" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfb, 0x9f, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe1, 0x9f, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x30, 0x9f, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x9f, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x9f,
-    0x3f, 0x50, 0x0, 0x0, 0x1, 0xed, 0x0, 0x0,
-    0x9f, 0x3f, 0x50, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x9f, 0x3f, 0x50, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x9f, 0x3f, 0x50, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x9f, 0x3f, 0x50, 0x0, 0x2f,
-    0xb0, 0x0, 0x0, 0x0, 0x9f, 0x3f, 0x50, 0x0,
-    0xde, 0x10, 0x0, 0x0, 0x0, 0x9f, 0x3f, 0x50,
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x3f,
-    0x50, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x3f, 0x53, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x3f, 0x6e, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x3f, 0xee, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x3f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0x27, 0x0, 0x0, 0x0, 0x27, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x0, 0x9c,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xe5, 0x0, 0x28,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xef,
-    0xea, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x9f, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe1, 0x9f, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x30, 0x9f, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0x9f, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0x9f, 0x3f, 0x50,
-    0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0x9f, 0x3f,
-    0x50, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x9f,
-    0x3f, 0x50, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x9f, 0x3f, 0x50, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x0, 0x9f, 0x3f, 0x50, 0x0, 0x2f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x3f, 0x50, 0x0, 0xde, 0x10,
-    0x0, 0x0, 0x0, 0x9f, 0x3f, 0x50, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x3f, 0x50, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x3f, 0x53,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x3f,
-    0x6e, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x3f, 0xee, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f,
-
-    /* U+041A "К" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x40, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xb0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0x10, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x8, 0xf3, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x1, 0xea, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0x61, 0x11, 0x16, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x84, 0x44, 0x48, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0xc, 0xe2, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x50, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdd, 0x10, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xb0,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x2, 0xf9, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0xfa, 0x0, 0x0, 0x3, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0x4, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x5, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0xe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x1f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0x6f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0x0, 0x0, 0xcd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x58, 0xbf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x9f, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea,
-
-    /* U+041C "М" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x13, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x13, 0xfc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0xf1, 0x3f, 0x5d,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0x6f, 0x13, 0xf4, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x36, 0xf1, 0x3f, 0x40, 0xbd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90, 0x6f,
-    0x23, 0xf4, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf1, 0x6, 0xf2, 0x3f, 0x40, 0x9, 0xe1,
-    0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x6f, 0x23,
-    0xf4, 0x0, 0x1e, 0x90, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x6, 0xf2, 0x3f, 0x40, 0x0, 0x6f, 0x20,
-    0x0, 0x0, 0x3f, 0x40, 0x0, 0x6f, 0x23, 0xf4,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0xc, 0xb0, 0x0,
-    0x6, 0xf2, 0x3f, 0x40, 0x0, 0x4, 0xf4, 0x0,
-    0x6, 0xf2, 0x0, 0x0, 0x6f, 0x23, 0xf4, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0xe8, 0x0, 0x0, 0x6,
-    0xf2, 0x3f, 0x40, 0x0, 0x0, 0x2f, 0x70, 0x8e,
-    0x0, 0x0, 0x0, 0x6f, 0x23, 0xf4, 0x0, 0x0,
-    0x0, 0x8f, 0x3f, 0x60, 0x0, 0x0, 0x6, 0xf2,
-    0x3f, 0x40, 0x0, 0x0, 0x0, 0xef, 0xc0, 0x0,
-    0x0, 0x0, 0x5f, 0x23, 0xf4, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x5, 0xf2, 0x3f,
-    0x40, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x23, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf2, 0x3f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x20,
-
-    /* U+041D "Н" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xae, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xae, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xae, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xae, 0x3f, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0xbe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0x84, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0xce, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xae, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xae, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xae, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xae, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xae,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xfe,
-    0xa8, 0x67, 0x9c, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xd5, 0x0, 0x0, 0x0, 0x2, 0x9f,
-    0xd2, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xe2, 0x0, 0x0, 0x4f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xd0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x6, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf4, 0xf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x81,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xea, 0x2f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb1, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0xf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0xbe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x0, 0xe, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xd0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xe2, 0x0, 0x0,
-    0x0, 0x7f, 0xd5, 0x0, 0x0, 0x0, 0x2, 0x9f,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xfe, 0xb8,
-    0x77, 0x9c, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb6, 0x10, 0x0,
-    0x0, 0x0,
-
-    /* U+041F "П" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x13, 0xf9, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x6b, 0xf1, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x13, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x13,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf1, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x13, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf1, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x13, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x13, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf1, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x13, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf1, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x13, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x13, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf1, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x13, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10,
-
-    /* U+0420 "Р" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x40, 0x0,
-    0x3, 0xf9, 0x66, 0x66, 0x66, 0x79, 0xdf, 0xc2,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0xe2, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xd0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x53, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf9, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xb3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xa3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x13, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x3f, 0x61,
-    0x11, 0x11, 0x12, 0x48, 0xef, 0x50, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x3f,
-    0x84, 0x44, 0x44, 0x43, 0x10, 0x0, 0x0, 0x3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb6,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xfa, 0x87,
-    0x78, 0xcf, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xe6,
-    0x0, 0x0, 0x0, 0x1, 0x8f, 0xc0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x90,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x90, 0x0, 0x0, 0x7f, 0xe6,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0xb0, 0x0, 0x0,
-    0x3, 0xcf, 0xfb, 0x87, 0x79, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb6,
-    0x10, 0x0,
-
-    /* U+0422 "Т" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x66, 0x66, 0x66, 0x8f, 0xa6, 0x66, 0x66,
-    0x66, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xd0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x7f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x6, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xa0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x7, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0xe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-    0x0, 0x0, 0x8e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x40, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xc0, 0x9, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x2f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcd, 0xab, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0x66, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2b, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x6a, 0xdf, 0xff, 0xff, 0xeb, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xb7, 0x55,
-    0xf8, 0x56, 0x9e, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0x6f, 0xd5, 0x0, 0x0, 0x1f, 0x60, 0x0, 0x3,
-    0xbf, 0xa0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0x1, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x0, 0x1f, 0x60, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xf4, 0x3f, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x85, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xda, 0x5f, 0x20,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xa4, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x1f,
-    0x70, 0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0xcd, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xf6, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x0, 0x1f, 0x60, 0x0, 0x0, 0x3, 0xec,
-    0x0, 0x0, 0x9, 0xfb, 0x30, 0x0, 0x1, 0xf6,
-    0x0, 0x0, 0x18, 0xfc, 0x10, 0x0, 0x0, 0x5,
-    0xdf, 0xc8, 0x42, 0x2f, 0x62, 0x36, 0xaf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xdf, 0xff,
-    0xff, 0xff, 0xeb, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x4f, 0x82, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0xd, 0xe1, 0x0, 0x0,
-    0x0, 0x1, 0xed, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x20, 0x0, 0x2f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xec, 0x0, 0xc, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x8,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0xbf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe1,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0xec, 0x0, 0x0, 0x0, 0xd, 0xe1,
-    0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x2f, 0xb0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x0, 0x2f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0xc, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xed, 0x0,
-
-    /* U+0426 "Ц" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x60, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x60, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x3, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x60, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf6, 0x0, 0x3, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x3,
-    0xf9, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x8f,
-    0xa6, 0x65, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc,
-
-    /* U+0427 "Ч" */
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x98, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe9, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x98, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe9, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x98, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe9, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x97, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe9, 0x5f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0x90, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe9, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7f, 0x90, 0x9, 0xfe,
-    0x73, 0x21, 0x24, 0x8c, 0xfe, 0xf9, 0x0, 0x4,
-    0xbf, 0xff, 0xff, 0xfd, 0x94, 0xe, 0x90, 0x0,
-    0x0, 0x2, 0x44, 0x31, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x90,
-
-    /* U+0428 "Ш" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x3, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x3, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x3, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x3, 0xf9, 0x66, 0x66, 0x66, 0x66, 0x6a, 0xf8,
-    0x66, 0x66, 0x66, 0x66, 0x6b, 0xf0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0,
-
-    /* U+0429 "Щ" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x3f, 0x96, 0x66,
-    0x66, 0x66, 0x66, 0xaf, 0x86, 0x66, 0x66, 0x66,
-    0x66, 0xbf, 0x66, 0x62, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf6,
-
-    /* U+042A "Ъ" */
-    0xbf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x66, 0x66, 0x66, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x33, 0x33, 0x33, 0x45,
-    0x7c, 0xfc, 0x10, 0x0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x55,
-    0x55, 0x55, 0x56, 0x9e, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x83,
-    0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x33, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x33, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x33, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x33, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x94, 0x0, 0x0, 0x0, 0x5f, 0x33,
-    0xf7, 0x33, 0x33, 0x33, 0x45, 0x8d, 0xfa, 0x0,
-    0x0, 0x5, 0xf3, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x5f, 0x33, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0,
-    0x5, 0xf3, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x90, 0x0, 0x5f, 0x33, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x5,
-    0xf3, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x5f, 0x33, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x5, 0xf3,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x5f, 0x33, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x5, 0xf3, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x5f, 0x33, 0xf8, 0x55, 0x55, 0x55, 0x56,
-    0xae, 0xf7, 0x0, 0x0, 0x5, 0xf3, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xeb, 0x71, 0x0, 0x0, 0x0,
-    0x5f, 0x30,
-
-    /* U+042C "Ь" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x94, 0x0, 0x3, 0xf7, 0x33, 0x33,
-    0x33, 0x45, 0x8d, 0xfa, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x3, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x93, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x83, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x3, 0xf8, 0x55, 0x55, 0x55, 0x56, 0xae,
-    0xf7, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xeb,
-    0x71, 0x0, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x4, 0x9c, 0xef, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0xfd, 0xa7, 0x77, 0x9d, 0xfe,
-    0x60, 0x0, 0x0, 0x7f, 0xb3, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xb0, 0x0, 0x2, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x9f, 0x10, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x2, 0x44, 0x44, 0x44, 0x44, 0x44, 0x8f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x6, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xb0, 0x0, 0x5f, 0xe6, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xb0, 0x0, 0x0, 0x2b, 0xff, 0xb8,
-    0x77, 0x9d, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0x8c, 0xef, 0xfe, 0xb6, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4, 0xad,
-    0xff, 0xec, 0x82, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xe9, 0x77, 0x8b,
-    0xff, 0xb2, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x8f, 0xd4, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x40, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf3, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xee, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x3f, 0x50, 0x0, 0x4,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x3f, 0x50, 0x0, 0x9, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4,
-    0x3f, 0x62, 0x22, 0x2d, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x3f, 0x85, 0x55, 0x5f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0x3f, 0x50, 0x0, 0xf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x3f, 0x50, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x3f, 0x50,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf4, 0x3f, 0x50, 0x0, 0x4,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x3f, 0x50, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x3f, 0x50, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xee, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xf3, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x8f, 0xd4, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x40, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xea, 0x77, 0x8b, 0xff, 0xb2, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad,
-    0xff, 0xec, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x3, 0xdf, 0xd9, 0x76, 0x66, 0x66, 0x6a,
-    0xf3, 0x3, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0xed, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x3a, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x3c, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0xbd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x38, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0xaf,
-    0xc6, 0x31, 0x11, 0x11, 0x11, 0x6f, 0x30, 0x0,
-    0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x5f, 0x53, 0x44, 0x44, 0x44, 0x8f, 0x30,
-    0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x30, 0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x30, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x7f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x30,
-
-    /* U+0430 "а" */
-    0x0, 0x3, 0x9d, 0xff, 0xec, 0x60, 0x0, 0x1,
-    0xbf, 0xd8, 0x65, 0x7b, 0xfc, 0x10, 0x9, 0xd4,
-    0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0x18, 0xce, 0xff, 0xff, 0xff, 0xf7,
-    0x2, 0xed, 0x63, 0x22, 0x22, 0x23, 0xf7, 0xd,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x2f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x4f, 0x40, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0xc, 0xe1, 0x0, 0x0, 0x0,
-    0x8b, 0xf7, 0x2, 0xde, 0x73, 0x23, 0x6d, 0xc1,
-    0xf7, 0x0, 0x7, 0xcf, 0xfe, 0xb6, 0x0, 0xf7,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xd0,
-    0x0, 0x0, 0x0, 0x2, 0x6a, 0xef, 0xfd, 0xa1,
-    0x0, 0x0, 0x6, 0xdf, 0xfc, 0x95, 0x10, 0x0,
-    0x0, 0x2, 0xdf, 0xa5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x4f, 0x20, 0x18, 0xdf, 0xff, 0xd8, 0x10, 0x0,
-    0x8e, 0x4, 0xed, 0x85, 0x45, 0x9f, 0xf5, 0x0,
-    0xac, 0x3f, 0x70, 0x0, 0x0, 0x1, 0xcf, 0x50,
-    0xcb, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0xc, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xd0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x2, 0xdf, 0x30,
-    0x0, 0x9, 0xfe, 0x96, 0x56, 0xaf, 0xd3, 0x0,
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+0432 "в" */
-    0xcf, 0xff, 0xff, 0xff, 0xda, 0x30, 0xc, 0xc4,
-    0x44, 0x44, 0x47, 0xcf, 0x70, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x2c, 0xb0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x5c, 0xb0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0xcb,
-    0x0, 0x0, 0x0, 0x39, 0xe4, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0xcc, 0x33, 0x33, 0x33,
-    0x48, 0xeb, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xa, 0xdc,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xdc, 0xb0, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0xcc, 0x44, 0x44, 0x44, 0x59,
-    0xfc, 0xc, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0,
-
-    /* U+0433 "г" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd5, 0x55,
-    0x55, 0x55, 0x55, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x9d, 0x55, 0x55, 0x55, 0x56,
-    0xf7, 0x0, 0x0, 0x0, 0xab, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xba, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0,
-    0x0, 0xe7, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0xb, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x37, 0xed,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0xfa, 0x54, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xbb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x18, 0xdf, 0xfe, 0xa4, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0x96, 0x57, 0xcf, 0xa0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x5f, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
-    0x0, 0x4f, 0xc2, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x4, 0xef, 0xb7, 0x66, 0x9e, 0xf7, 0x0,
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xd8, 0x20, 0x0,
-
-    /* U+0436 "ж" */
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0x0, 0xd, 0xb0, 0x0, 0xcc, 0x0, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0x9e, 0x10,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x6, 0xf4, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x1e, 0x90, 0x0,
-    0x0, 0x0, 0xae, 0x10, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0,
-    0x0, 0xa, 0xd0, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x11, 0x1b, 0xd1, 0x11,
-    0x3f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x44, 0x4b, 0xe4, 0x44,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0xa, 0xd0, 0x0, 0xa, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0xa, 0xd0, 0x0,
-    0x1, 0xec, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x1e, 0xc0, 0x0, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0xaf, 0x20, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x1e, 0xc0, 0x0, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-
-    /* U+0437 "з" */
-    0x0, 0x5, 0xae, 0xff, 0xeb, 0x60, 0x0, 0x2,
-    0xef, 0xb8, 0x66, 0x8b, 0xfd, 0x20, 0x0, 0x71,
-    0x0, 0x0, 0x0, 0x3e, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xae,
-    0x30, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x12, 0x22, 0x36, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xda, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf8, 0xd, 0x81, 0x0, 0x0, 0x0,
-    0x2d, 0xf1, 0x5, 0xef, 0xa7, 0x55, 0x6a, 0xfd,
-    0x30, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0438 "и" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x3c,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xdf, 0x3c, 0xb0,
-    0x0, 0x0, 0x0, 0x1e, 0xc4, 0xf3, 0xcb, 0x0,
-    0x0, 0x0, 0xc, 0xe1, 0x4f, 0x3c, 0xb0, 0x0,
-    0x0, 0x9, 0xf3, 0x4, 0xf3, 0xcb, 0x0, 0x0,
-    0x6, 0xf5, 0x0, 0x4f, 0x3c, 0xb0, 0x0, 0x4,
-    0xf8, 0x0, 0x4, 0xf3, 0xcb, 0x0, 0x2, 0xeb,
-    0x0, 0x0, 0x4f, 0x3c, 0xb0, 0x0, 0xdd, 0x0,
-    0x0, 0x4, 0xf3, 0xcb, 0x0, 0xbe, 0x20, 0x0,
-    0x0, 0x4f, 0x3c, 0xb0, 0x8f, 0x40, 0x0, 0x0,
-    0x4, 0xf3, 0xcb, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x4f, 0x3c, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x4,
-    0xf3, 0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x3c, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-
-    /* U+0439 "й" */
-    0x0, 0xf, 0x10, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0x0, 0xd6, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x0,
-    0x4, 0xf6, 0x0, 0x3d, 0xa0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x3c, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf3, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xdf, 0x3c, 0xb0, 0x0, 0x0, 0x0,
-    0x1e, 0xc4, 0xf3, 0xcb, 0x0, 0x0, 0x0, 0xc,
-    0xe1, 0x4f, 0x3c, 0xb0, 0x0, 0x0, 0x9, 0xf3,
-    0x4, 0xf3, 0xcb, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x4f, 0x3c, 0xb0, 0x0, 0x4, 0xf8, 0x0, 0x4,
-    0xf3, 0xcb, 0x0, 0x2, 0xeb, 0x0, 0x0, 0x4f,
-    0x3c, 0xb0, 0x0, 0xdd, 0x0, 0x0, 0x4, 0xf3,
-    0xcb, 0x0, 0xbe, 0x20, 0x0, 0x0, 0x4f, 0x3c,
-    0xb0, 0x8f, 0x40, 0x0, 0x0, 0x4, 0xf3, 0xcb,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x4f, 0x3c, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x4, 0xf3, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x3c, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf3,
-
-    /* U+043A "к" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0x0, 0xcb, 0x0,
-    0x0, 0x0, 0xa, 0xe1, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x8f, 0x20, 0x0, 0xcb, 0x0, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x3f, 0x60,
-    0x0, 0x0, 0xcc, 0x11, 0x12, 0xe8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xcc, 0x44, 0x46, 0xf9, 0x0, 0x0, 0x0, 0xcb,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0xcb, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0xce, 0x10, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x1e, 0xc0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x3,
-    0xf9, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x60, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x9e, 0x55, 0x55, 0x55, 0x55, 0xf7,
-    0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0xab, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0xba, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0xc9, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0xe7, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0xa, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x57, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0xbf, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-
-    /* U+043C "м" */
-    0xce, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf4, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf4, 0xce, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9e, 0xf4, 0xca, 0xcc, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0xf4, 0xca, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0xb, 0xb1, 0xf4, 0xca, 0x9, 0xe0,
-    0x0, 0x0, 0x0, 0x5f, 0x21, 0xf4, 0xca, 0x1,
-    0xe8, 0x0, 0x0, 0x0, 0xe8, 0x1, 0xf4, 0xca,
-    0x0, 0x6f, 0x20, 0x0, 0x8, 0xe0, 0x1, 0xf4,
-    0xca, 0x0, 0xc, 0xb0, 0x0, 0x2f, 0x50, 0x1,
-    0xf4, 0xca, 0x0, 0x3, 0xf4, 0x0, 0xbb, 0x0,
-    0x1, 0xf4, 0xca, 0x0, 0x0, 0xad, 0x4, 0xf2,
-    0x0, 0x1, 0xf4, 0xca, 0x0, 0x0, 0x1f, 0x7d,
-    0x80, 0x0, 0x1, 0xf4, 0xca, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x1, 0xf4, 0xca, 0x0, 0x0,
-    0x0, 0xd5, 0x0, 0x0, 0x1, 0xf4, 0xca, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4, 0xca,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf4,
-
-    /* U+043D "н" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xad, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xad, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xad, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xad, 0xcc, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0xad, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xcc, 0x44, 0x44, 0x44, 0x44, 0x44, 0xbd, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xad, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xad, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xad, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xad, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xad, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x17, 0xcf, 0xfe, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xfa, 0x76, 0x7b, 0xfe, 0x40,
-    0x0, 0x0, 0x5f, 0xb1, 0x0, 0x0, 0x2, 0xbf,
-    0x40, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x35, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x43, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0xf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0xaf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x5,
-    0xfb, 0x10, 0x0, 0x0, 0x2b, 0xf4, 0x0, 0x0,
-    0x4, 0xef, 0xa7, 0x67, 0xbf, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0xff, 0xfc, 0x70, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xcd,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0xbe, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9e, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9e, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9e, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9e, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-
-    /* U+0440 "р" */
-    0xbb, 0x0, 0x18, 0xdf, 0xfe, 0xa4, 0x0, 0x0,
-    0xbb, 0x6, 0xfd, 0x96, 0x68, 0xdf, 0xb1, 0x0,
-    0xbb, 0x6f, 0x60, 0x0, 0x0, 0x5, 0xfd, 0x10,
-    0xbd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0xbe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0xbe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0xbe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0xbc, 0x6f, 0x60, 0x0, 0x0, 0x5, 0xfd, 0x10,
-    0xbc, 0x6, 0xfd, 0x96, 0x68, 0xdf, 0xb1, 0x0,
-    0xbc, 0x0, 0x18, 0xdf, 0xfe, 0xa4, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x7, 0xce, 0xff, 0xc7, 0x10, 0x0,
-    0x0, 0x4e, 0xfb, 0x76, 0x7a, 0xfe, 0x40, 0x0,
-    0x5f, 0xb2, 0x0, 0x0, 0x1, 0xbf, 0x30, 0x2f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x70, 0xa, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0x0, 0x4, 0xfb, 0x20, 0x0, 0x0, 0x1b,
-    0xf3, 0x0, 0x4, 0xef, 0xb7, 0x67, 0xaf, 0xe4,
-    0x0, 0x0, 0x0, 0x6c, 0xef, 0xfc, 0x71, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x55, 0x55, 0x55, 0xfc, 0x55, 0x55, 0x54, 0x0,
-    0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x7, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xc0, 0xf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf5, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xad, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x70, 0x0, 0xa, 0xe0, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0xe8, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0,
-    0x0, 0x6f, 0x10, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0xd, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xa0,
-    0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x20, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe8, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x71, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xad, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xda, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x40, 0x0, 0x7, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa6, 0x5a, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xc5, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xfe,
-    0xc8, 0x30, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xea,
-    0x88, 0xf8, 0x8a, 0xef, 0xc2, 0x0, 0x0, 0x4,
-    0xfd, 0x50, 0x0, 0x3f, 0x30, 0x0, 0x5d, 0xf4,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x3, 0xf3, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0xbe, 0x10, 0x0, 0x0,
-    0x3f, 0x30, 0x0, 0x0, 0x1e, 0xb0, 0x1f, 0x80,
-    0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x7f,
-    0x14, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0x30, 0x0,
-    0x0, 0x3, 0xf4, 0x6f, 0x10, 0x0, 0x0, 0x3,
-    0xf3, 0x0, 0x0, 0x0, 0x1f, 0x66, 0xf1, 0x0,
-    0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x1, 0xf6,
-    0x4f, 0x40, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0,
-    0x0, 0x3f, 0x41, 0xf8, 0x0, 0x0, 0x0, 0x3f,
-    0x30, 0x0, 0x0, 0x8, 0xf1, 0xb, 0xf1, 0x0,
-    0x0, 0x3, 0xf3, 0x0, 0x0, 0x1, 0xeb, 0x0,
-    0x2f, 0xc1, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x4f, 0xe5, 0x0, 0x3, 0xf3,
-    0x0, 0x5, 0xef, 0x40, 0x0, 0x0, 0x3c, 0xfe,
-    0xa8, 0x8f, 0x88, 0xae, 0xfc, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0x8c, 0xef, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0445 "х" */
-    0xa, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xae, 0x10,
-    0x1d, 0xc0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x0,
-    0xae, 0x10, 0xa, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x4d,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0xc, 0xe1, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0xcd,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x1, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-
-    /* U+0446 "ц" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0,
-    0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xa0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xea, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xea, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xa0, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xea, 0x0, 0xc, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xa0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0xc, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0xcd,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0xec, 0x55, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3,
-
-    /* U+0447 "ч" */
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x6, 0xfd, 0x62, 0x11, 0x37, 0xbf, 0xf7, 0x0,
-    0x3b, 0xff, 0xff, 0xfc, 0x82, 0xf7, 0x0, 0x0,
-    0x3, 0x32, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
-
-    /* U+0448 "ш" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xf4, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xf4, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xf4, 0xcd, 0x55, 0x55, 0x55, 0x55, 0xfb,
-    0x55, 0x55, 0x55, 0x57, 0xf4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+0449 "щ" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0xcd, 0x55, 0x55, 0x55, 0x55, 0xfb, 0x55, 0x55,
-    0x55, 0x57, 0xf8, 0x54, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x55, 0x55, 0x5f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0xf, 0x93, 0x33,
-    0x33, 0x5a, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xf7,
-    0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0xf, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0xf9, 0x33, 0x33, 0x36, 0xaf, 0xa0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xea, 0x40, 0x0,
-
-    /* U+044B "ы" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xcc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xcc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbc, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xcc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbc, 0xcf, 0xff, 0xff, 0xfe, 0xc8,
-    0x10, 0x0, 0xb, 0xcc, 0xc2, 0x22, 0x23, 0x48,
-    0xee, 0x30, 0x0, 0xbc, 0xcb, 0x0, 0x0, 0x0,
-    0x1, 0xdd, 0x0, 0xb, 0xcc, 0xb0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0xbc, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x50, 0xb, 0xcc, 0xb0, 0x0,
-    0x0, 0x0, 0x2, 0xf5, 0x0, 0xbc, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x20, 0xb, 0xcc, 0xb0,
-    0x0, 0x0, 0x0, 0x2e, 0xc0, 0x0, 0xbc, 0xcc,
-    0x33, 0x33, 0x35, 0x9f, 0xd1, 0x0, 0xb, 0xcc,
-    0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x0, 0xbc,
-
-    /* U+044C "ь" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xc8, 0x10, 0xc, 0xc2, 0x22,
-    0x22, 0x47, 0xef, 0x40, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x7c,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xf7, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x4c, 0xb0, 0x0, 0x0,
-    0x0, 0x1e, 0xd0, 0xcc, 0x33, 0x33, 0x35, 0x9f,
-    0xe2, 0xc, 0xff, 0xff, 0xff, 0xec, 0x70, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x4a, 0xdf, 0xfe, 0xb6, 0x0, 0x0, 0x2,
-    0xdf, 0xa7, 0x54, 0x6a, 0xfe, 0x40, 0x0, 0x9a,
-    0x10, 0x0, 0x0, 0x1, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x50, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x23, 0x33,
-    0x33, 0x33, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0xa, 0xc2, 0x0, 0x0, 0x0, 0x2b, 0xf4,
-    0x0, 0x2c, 0xfb, 0x75, 0x56, 0xaf, 0xe3, 0x0,
-    0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0xcb, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xeb,
-    0x50, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x5, 0xef,
-    0xa7, 0x67, 0xbf, 0xc2, 0x0, 0xcb, 0x0, 0x0,
-    0x5, 0xfb, 0x10, 0x0, 0x0, 0x3d, 0xe2, 0xc,
-    0xb0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xc0, 0xcb, 0x0, 0x0, 0x9f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x4c, 0xb0, 0x0, 0xf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0xcc,
-    0x11, 0x14, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xec, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xcd, 0x44, 0x47, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0xb0,
-    0x0, 0x2f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xad, 0xcb, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xac, 0xb0, 0x0, 0x9, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0xcb, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xec,
-    0xc, 0xb0, 0x0, 0x0, 0x5f, 0xb1, 0x0, 0x0,
-    0x3, 0xde, 0x10, 0xcb, 0x0, 0x0, 0x0, 0x4e,
-    0xfa, 0x65, 0x7b, 0xfc, 0x20, 0xc, 0xb0, 0x0,
-    0x0, 0x0, 0x17, 0xcf, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x2, 0x9d, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x8f, 0xd8, 0x65, 0x55, 0x55, 0xbc, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9c, 0xc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x9c, 0xf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x9c, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x9c, 0xd, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x9c, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0x0, 0xcf, 0x72, 0x0, 0x0, 0x0, 0x9c, 0x0,
-    0x7, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x6f, 0x42, 0x22, 0x22, 0xac, 0x0, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0x9c, 0x0, 0xc, 0xd0, 0x0,
-    0x0, 0x0, 0x9c, 0x0, 0x6f, 0x30, 0x0, 0x0,
-    0x0, 0x9c, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9c, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9c,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x1, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x74, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xdf, 0xfe, 0xa4, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0x96, 0x57, 0xcf, 0xa0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x5f, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
-    0x0, 0x4f, 0xc2, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x4, 0xef, 0xb7, 0x66, 0x9e, 0xf7, 0x0,
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xd8, 0x20, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0x4f, 0x60, 0x2, 0xe9, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x80, 0x3, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xdf, 0xfe, 0xa4, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0x96, 0x57, 0xcf, 0xa0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x5f, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
-    0x0, 0x4f, 0xc2, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x4, 0xef, 0xb7, 0x66, 0x9e, 0xf7, 0x0,
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xd8, 0x20, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0x65, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x2, 0x22,
-    0xcc, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x4, 0xae,
-    0xff, 0xd9, 0x20, 0x0, 0x0, 0x0, 0xcb, 0xa,
-    0xfb, 0x76, 0x6a, 0xff, 0x50, 0x0, 0x0, 0xc,
-    0xba, 0xd2, 0x0, 0x0, 0x1, 0xcf, 0x20, 0x0,
-    0x0, 0xce, 0xe1, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0xc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x40, 0x0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x40, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x40, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x40,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd8, 0x55,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xfc, 0x50, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x1c, 0xc2, 0x0,
-    0x0, 0x0, 0x5, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd5,
-    0x55, 0x55, 0x55, 0x55, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x3d, 0xfb, 0x75, 0x57, 0xaf, 0xd3, 0x0,
-    0x4f, 0xc2, 0x0, 0x0, 0x0, 0x19, 0x90, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x6f, 0x33, 0x33, 0x33,
-    0x33, 0x20, 0x0, 0x4, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x4, 0xfb, 0x10, 0x0, 0x0, 0x2,
-    0xcb, 0x0, 0x3, 0xdf, 0xa6, 0x45, 0x7b, 0xfc,
-    0x20, 0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa4, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x4, 0xae, 0xff, 0xeb, 0x61, 0x0, 0x0,
-    0x9f, 0xc7, 0x55, 0x7a, 0xff, 0x30, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x18, 0x0, 0xc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfd, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0xff, 0xb8, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x37, 0xad, 0xff, 0xc4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xe0, 0x2e, 0x60, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x1a, 0xfe, 0xa7, 0x55, 0x7b, 0xfb,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xea, 0x50, 0x0,
-
-    /* U+0456 "і" */
-    0xd, 0xd0, 0x2f, 0xf2, 0x5, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0xc, 0xb0,
-    0xc, 0xb0, 0xc, 0xb0, 0xc, 0xb0, 0xc, 0xb0,
-    0xc, 0xb0, 0xc, 0xb0, 0xc, 0xb0, 0xc, 0xb0,
-    0xc, 0xb0, 0xc, 0xb0, 0xc, 0xb0, 0xc, 0xb0,
-    0xc, 0xb0, 0xc, 0xb0,
-
-    /* U+0457 "ї" */
-    0xbd, 0x1, 0xe9, 0xde, 0x2, 0xfb, 0x1, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0xdb, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0xdb, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0xdb, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0xdb, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0xdb, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0xdd, 0x10, 0x0, 0x0, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x45, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0,
-    0xbc, 0x0, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0,
-    0x0, 0xbc, 0x0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0xb, 0xc0,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0xb,
-    0xc0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0,
-    0xb, 0xc0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0xbc, 0x0,
-    0x0, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x3f, 0x60, 0x7c, 0x65, 0x7e,
-    0xd0, 0x2, 0xae, 0xfe, 0x91, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xe5, 0x55, 0x55, 0x55, 0x5f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x0, 0xf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xba, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x90, 0x0,
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfe, 0xb7, 0x0, 0x0, 0x0,
-    0xe, 0x70, 0x0, 0x0, 0x0, 0xf, 0x92, 0x22,
-    0x23, 0x48, 0xfd, 0x10, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x2,
-    0xeb, 0x0, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x0,
-    0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x6f, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x6f, 0x90, 0x57, 0xee, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x66, 0x66, 0x68,
-    0xdf, 0xc0, 0xb, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+045A "њ" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcc, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0xf9, 0x11, 0x11, 0x10, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x92, 0x0, 0xcc, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0xfa, 0x44, 0x44, 0x45, 0x9f, 0xf3,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x90,
-    0x0, 0x0, 0x0, 0x2e, 0xc0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x1c, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x90, 0x0, 0x0, 0x0, 0x5, 0xf2, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x90, 0x0, 0x0, 0x0, 0x2e, 0xa0, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x33, 0x33,
-    0x34, 0x9f, 0xc1, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0x65, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xee, 0xef, 0xfe,
-    0xee, 0xee, 0xee, 0x80, 0x0, 0x0, 0x11, 0x11,
-    0xcc, 0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x4, 0xae,
-    0xff, 0xd9, 0x20, 0x0, 0x0, 0x0, 0xcb, 0xa,
-    0xfb, 0x76, 0x6a, 0xff, 0x50, 0x0, 0x0, 0xc,
-    0xba, 0xd2, 0x0, 0x0, 0x1, 0xcf, 0x20, 0x0,
-    0x0, 0xcf, 0xe1, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0xc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x40, 0x0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x40, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf4, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x40, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x40,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x40,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x57,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xa0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0xa, 0xe1, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0x8f, 0x20, 0x0, 0xcb, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x3f, 0x60, 0x0, 0x0, 0xcc, 0x11, 0x12, 0xe8,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xcc, 0x44, 0x46, 0xf9, 0x0, 0x0,
-    0x0, 0xcb, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0xcb, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0xce, 0x10, 0x0, 0xcb, 0x0,
-    0x0, 0x0, 0x1e, 0xc0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x3, 0xf9, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x60, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3,
-
-    /* U+045D "ѝ" */
-    0x0, 0x1b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xda, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x3c, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf3, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xdf, 0x3c, 0xb0, 0x0, 0x0, 0x0,
-    0x1e, 0xc4, 0xf3, 0xcb, 0x0, 0x0, 0x0, 0xc,
-    0xe1, 0x4f, 0x3c, 0xb0, 0x0, 0x0, 0x9, 0xf3,
-    0x4, 0xf3, 0xcb, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x4f, 0x3c, 0xb0, 0x0, 0x4, 0xf8, 0x0, 0x4,
-    0xf3, 0xcb, 0x0, 0x2, 0xeb, 0x0, 0x0, 0x4f,
-    0x3c, 0xb0, 0x0, 0xdd, 0x0, 0x0, 0x4, 0xf3,
-    0xcb, 0x0, 0xbe, 0x20, 0x0, 0x0, 0x4f, 0x3c,
-    0xb0, 0x8f, 0x40, 0x0, 0x0, 0x4, 0xf3, 0xcb,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x4f, 0x3c, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x4, 0xf3, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x3c, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf3,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x7a, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x3, 0xe1, 0x0, 0x0, 0x8b, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xc2, 0x0, 0x7f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xc0, 0xf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf5, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xad, 0x0, 0x2, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x70, 0x0, 0xa, 0xe0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0,
-    0xcc, 0x0, 0x0, 0x0, 0x6f, 0x10, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0xd, 0xa0, 0x0, 0x0,
-    0x0, 0xd, 0xa0, 0x0, 0x4, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x20, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x0, 0x2f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x9, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x71, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x7,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa6, 0x5a,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xb, 0xdc, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xbd, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xdc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xdc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xbd, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xdc, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xbd, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xdc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xbd, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xb, 0xdc,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xbd, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xdc, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xbd, 0xcd, 0x55, 0x55, 0x55, 0x55,
-    0x5c, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x40,
-    0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0x96, 0x66, 0x66, 0x66, 0x66,
-    0x65, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcd, 0x55,
-    0x55, 0x55, 0x55, 0xc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+2013 "–" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-
-    /* U+2014 "—" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-
-    /* U+2018 "‘" */
-    0x0, 0xf2, 0x3, 0xe0, 0x8, 0xb0, 0xc, 0x70,
-    0x1f, 0x90, 0x3f, 0xf2, 0x1d, 0xd0,
-
-    /* U+2019 "’" */
-    0x1d, 0xd1, 0x3f, 0xf3, 0x8, 0xf0, 0x7, 0xc0,
-    0xb, 0x80, 0xe, 0x30, 0x2f, 0x0, 0x0, 0x0,
-
-    /* U+201A "‚" */
-    0x6, 0x60, 0x3f, 0xf3, 0x1d, 0xf2, 0x6, 0xd0,
-    0xa, 0x80, 0xe, 0x40, 0x2f, 0x0,
-
-    /* U+201C "“" */
-    0x0, 0xf2, 0x0, 0x5b, 0x3, 0xe0, 0x0, 0xa8,
-    0x8, 0xb0, 0x0, 0xe4, 0xc, 0x70, 0x3, 0xf1,
-    0x1f, 0x90, 0x7, 0xf2, 0x3f, 0xf2, 0xa, 0xfc,
-    0x1d, 0xd0, 0x5, 0xf7,
-
-    /* U+201D "”" */
-    0x1d, 0xd1, 0x5, 0xf8, 0x3f, 0xf3, 0x9, 0xfd,
-    0x8, 0xf0, 0x1, 0xda, 0x7, 0xc0, 0x0, 0xe5,
-    0xb, 0x80, 0x1, 0xf1, 0xe, 0x30, 0x5, 0xd0,
-    0x2f, 0x0, 0x8, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2026 "…" */
-    0x7, 0x70, 0x0, 0x5, 0x80, 0x0, 0x4, 0x81,
-    0x3f, 0xf3, 0x0, 0x1f, 0xf5, 0x0, 0xe, 0xf8,
-    0x1d, 0xd1, 0x0, 0xc, 0xe2, 0x0, 0x9, 0xf4,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x27, 0xbe, 0xff, 0xec, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xea, 0x76, 0x66, 0x9e,
-    0xfa, 0x0, 0x0, 0x0, 0x9, 0x30, 0x0, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x30, 0xc, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xff, 0xfe, 0xe7, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x9, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0x0, 0x0, 0x2f, 0xd3, 0x0, 0x0,
-    0x0, 0x1, 0x8f, 0xb0, 0x0, 0x0, 0x3d, 0xfc,
-    0x86, 0x66, 0x8c, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x5, 0xad, 0xff, 0xfd, 0x95, 0x0, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x7,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x90, 0x0, 0x1, 0x9f, 0xee, 0xe8, 0x0, 0x7f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9,
-    0x0, 0x1, 0xe9, 0x10, 0x2, 0xbc, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90,
-    0x0, 0xaa, 0x0, 0x0, 0x0, 0xc8, 0x7f, 0x6f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0xf, 0x20, 0x0, 0x0, 0x5, 0xd7, 0xf1, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xe, 0x90, 0x2,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0x7f, 0x10, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0xf,
-    0x10, 0x0, 0x0, 0x4, 0xe7, 0xf1, 0x1, 0xed,
-    0x10, 0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0xc7,
-    0x0, 0x0, 0x0, 0xa9, 0x7f, 0x10, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x8e, 0x17, 0xf1, 0x0, 0x7, 0xf7,
-    0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x3, 0xde,
-    0xab, 0xeb, 0x20, 0x7f, 0x10, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0x25,
-    0x52, 0x0, 0x7, 0xf1, 0x0, 0x0, 0xd, 0xe1,
-    0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x10, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0xe, 0x90, 0x0, 0x7e, 0xee, 0xee, 0xee,
-    0xe5, 0x7f, 0x10, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0xe9, 0x0, 0x2, 0x33, 0x33, 0x33, 0x33,
-    0x17, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30,
-    0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x10, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10,
-    0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0xe9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 123, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 121, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 42, .adv_w = 171, .box_w = 7, .box_h = 8, .ofs_x = 2, .ofs_y = 13},
-    {.bitmap_index = 70, .adv_w = 331, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 280, .adv_w = 292, .box_w = 16, .box_h = 29, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 512, .adv_w = 392, .box_w = 23, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 754, .adv_w = 314, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 963, .adv_w = 93, .box_w = 2, .box_h = 8, .ofs_x = 2, .ofs_y = 13},
-    {.bitmap_index = 971, .adv_w = 154, .box_w = 6, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 1055, .adv_w = 155, .box_w = 6, .box_h = 28, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 1139, .adv_w = 180, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 11},
-    {.bitmap_index = 1200, .adv_w = 273, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 1285, .adv_w = 96, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1299, .adv_w = 183, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 1313, .adv_w = 96, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1319, .adv_w = 154, .box_w = 12, .box_h = 29, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 1493, .adv_w = 316, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1682, .adv_w = 169, .box_w = 7, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1756, .adv_w = 270, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1924, .adv_w = 268, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2092, .adv_w = 314, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2292, .adv_w = 268, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2460, .adv_w = 289, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2639, .adv_w = 279, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2807, .adv_w = 303, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2986, .adv_w = 289, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3165, .adv_w = 96, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3197, .adv_w = 96, .box_w = 4, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3237, .adv_w = 273, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3322, .adv_w = 273, .box_w = 13, .box_h = 10, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 3387, .adv_w = 273, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3472, .adv_w = 270, .box_w = 15, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3630, .adv_w = 496, .box_w = 29, .box_h = 27, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 4022, .adv_w = 338, .box_w = 21, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4243, .adv_w = 361, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4432, .adv_w = 339, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4642, .adv_w = 396, .box_w = 21, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4863, .adv_w = 321, .box_w = 16, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5031, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5189, .adv_w = 371, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5399, .adv_w = 391, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5588, .adv_w = 142, .box_w = 3, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5620, .adv_w = 236, .box_w = 13, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5757, .adv_w = 337, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5946, .adv_w = 281, .box_w = 15, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6104, .adv_w = 459, .box_w = 23, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6346, .adv_w = 391, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6535, .adv_w = 402, .box_w = 23, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6777, .adv_w = 343, .box_w = 17, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6956, .adv_w = 402, .box_w = 24, .box_h = 26, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 7268, .adv_w = 346, .box_w = 17, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7447, .adv_w = 292, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7615, .adv_w = 270, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7794, .adv_w = 381, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7983, .adv_w = 330, .box_w = 21, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8204, .adv_w = 527, .box_w = 31, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8530, .adv_w = 308, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8730, .adv_w = 300, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8930, .adv_w = 310, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9119, .adv_w = 147, .box_w = 6, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 9203, .adv_w = 154, .box_w = 12, .box_h = 29, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 9377, .adv_w = 147, .box_w = 6, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 9461, .adv_w = 274, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 9546, .adv_w = 240, .box_w = 15, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9561, .adv_w = 288, .box_w = 7, .box_h = 4, .ofs_x = 4, .ofs_y = 18},
-    {.bitmap_index = 9575, .adv_w = 280, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9687, .adv_w = 324, .box_w = 16, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9863, .adv_w = 266, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9983, .adv_w = 324, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10170, .adv_w = 287, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10298, .adv_w = 157, .box_w = 11, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10419, .adv_w = 327, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 10606, .adv_w = 323, .box_w = 15, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10771, .adv_w = 125, .box_w = 4, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10815, .adv_w = 128, .box_w = 9, .box_h = 28, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 10941, .adv_w = 280, .box_w = 15, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11106, .adv_w = 125, .box_w = 2, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11128, .adv_w = 511, .box_w = 26, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11336, .adv_w = 323, .box_w = 15, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11456, .adv_w = 298, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11592, .adv_w = 324, .box_w = 16, .box_h = 22, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 11768, .adv_w = 324, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 11955, .adv_w = 189, .box_w = 8, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12019, .adv_w = 229, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12131, .adv_w = 191, .box_w = 11, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12241, .adv_w = 321, .box_w = 14, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12353, .adv_w = 253, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12481, .adv_w = 414, .box_w = 26, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12689, .adv_w = 249, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12809, .adv_w = 253, .box_w = 17, .box_h = 22, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 12996, .adv_w = 241, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13100, .adv_w = 154, .box_w = 8, .box_h = 28, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 13212, .adv_w = 140, .box_w = 3, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 13254, .adv_w = 154, .box_w = 8, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 13366, .adv_w = 273, .box_w = 15, .box_h = 5, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 13404, .adv_w = 218, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 13476, .adv_w = 218, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 13548, .adv_w = 313, .box_w = 16, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13764, .adv_w = 313, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13972, .adv_w = 393, .box_w = 24, .box_h = 22, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 14236, .adv_w = 273, .box_w = 14, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14425, .adv_w = 339, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14625, .adv_w = 298, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14793, .adv_w = 145, .box_w = 3, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14825, .adv_w = 142, .box_w = 9, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14942, .adv_w = 248, .box_w = 12, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15068, .adv_w = 569, .box_w = 35, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15436, .adv_w = 570, .box_w = 32, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15772, .adv_w = 396, .box_w = 24, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16024, .adv_w = 334, .box_w = 18, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16267, .adv_w = 396, .box_w = 18, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16510, .adv_w = 322, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16780, .adv_w = 386, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 17014, .adv_w = 352, .box_w = 22, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17245, .adv_w = 347, .box_w = 17, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17424, .adv_w = 360, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17613, .adv_w = 273, .box_w = 14, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17760, .adv_w = 377, .box_w = 23, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 18059, .adv_w = 313, .box_w = 16, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18227, .adv_w = 478, .box_w = 30, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18542, .adv_w = 294, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18721, .adv_w = 396, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18910, .adv_w = 396, .box_w = 18, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 19153, .adv_w = 334, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 19342, .adv_w = 375, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19552, .adv_w = 463, .box_w = 23, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 19794, .adv_w = 395, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 19983, .adv_w = 409, .box_w = 23, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20225, .adv_w = 397, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 20425, .adv_w = 339, .box_w = 17, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 20604, .adv_w = 343, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20814, .adv_w = 276, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20993, .adv_w = 322, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21203, .adv_w = 436, .box_w = 25, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 21503, .adv_w = 305, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21703, .adv_w = 396, .box_w = 21, .box_h = 26, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 21976, .adv_w = 342, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22155, .adv_w = 525, .box_w = 27, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 22439, .adv_w = 535, .box_w = 30, .box_h = 26, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 22829, .adv_w = 391, .box_w = 23, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23071, .adv_w = 464, .box_w = 23, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 23313, .adv_w = 340, .box_w = 17, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 23492, .adv_w = 338, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23692, .adv_w = 522, .box_w = 28, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 23986, .adv_w = 351, .box_w = 17, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24165, .adv_w = 277, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24277, .adv_w = 315, .box_w = 16, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24461, .adv_w = 289, .box_w = 13, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 24565, .adv_w = 223, .box_w = 11, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 24653, .adv_w = 307, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 24833, .adv_w = 292, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24961, .adv_w = 387, .box_w = 24, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25153, .adv_w = 252, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25265, .adv_w = 327, .box_w = 15, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25385, .adv_w = 327, .box_w = 15, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25550, .adv_w = 273, .box_w = 14, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25662, .adv_w = 300, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25790, .adv_w = 376, .box_w = 18, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25934, .adv_w = 322, .box_w = 14, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 26046, .adv_w = 303, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26182, .adv_w = 323, .box_w = 14, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 26294, .adv_w = 328, .box_w = 16, .box_h = 22, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 26470, .adv_w = 267, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26590, .adv_w = 219, .box_w = 15, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 26710, .adv_w = 262, .box_w = 17, .box_h = 22, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 26897, .adv_w = 369, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 27202, .adv_w = 246, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27322, .adv_w = 326, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 27492, .adv_w = 284, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 27604, .adv_w = 441, .box_w = 22, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 27780, .adv_w = 441, .box_w = 24, .box_h = 20, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 28020, .adv_w = 290, .box_w = 19, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 28172, .adv_w = 368, .box_w = 17, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 28308, .adv_w = 265, .box_w = 13, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 28412, .adv_w = 273, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 28532, .adv_w = 411, .box_w = 21, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 28700, .adv_w = 288, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 28812, .adv_w = 298, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 28988, .adv_w = 292, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 29156, .adv_w = 320, .box_w = 19, .box_h = 29, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 29432, .adv_w = 223, .box_w = 11, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29553, .adv_w = 273, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 29673, .adv_w = 250, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 29785, .adv_w = 127, .box_w = 4, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29829, .adv_w = 125, .box_w = 6, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 29892, .adv_w = 128, .box_w = 9, .box_h = 28, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 30018, .adv_w = 437, .box_w = 27, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 30234, .adv_w = 450, .box_w = 25, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30434, .adv_w = 320, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 30653, .adv_w = 273, .box_w = 14, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30807, .adv_w = 327, .box_w = 15, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30972, .adv_w = 262, .box_w = 17, .box_h = 28, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 31210, .adv_w = 304, .box_w = 13, .box_h = 20, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 31340, .adv_w = 274, .box_w = 14, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 31522, .adv_w = 209, .box_w = 11, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 31627, .adv_w = 240, .box_w = 15, .box_h = 2, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 31642, .adv_w = 480, .box_w = 30, .box_h = 2, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 31672, .adv_w = 96, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 31686, .adv_w = 96, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 31702, .adv_w = 96, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 31716, .adv_w = 169, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 31744, .adv_w = 169, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 31776, .adv_w = 292, .box_w = 16, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 31800, .adv_w = 396, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32000, .adv_w = 574, .box_w = 31, .box_h = 22, .ofs_x = 3, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_30;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_30 = {
-#else
-lv_font_t montserrat_cyrillic_30 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 33,          /*The maximum line height required by the font*/
-    .base_line = 6,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -3,
-    .underline_thickness = 2,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_30,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_30*/
@@ -1,5461 +0,0 @@
-/*******************************************************************************
- * Size: 32 px
- * Bpp: 4
- * Opts: --bpp 4 --size 32 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_32.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_32
-#define MONTSERRAT_CYRILLIC_32 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_32
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xe, 0xf0, 0xd, 0xe0, 0xd, 0xe0, 0xd, 0xe0,
-    0xc, 0xd0, 0xc, 0xd0, 0xc, 0xd0, 0xb, 0xc0,
-    0xb, 0xc0, 0xb, 0xc0, 0xb, 0xc0, 0xa, 0xb0,
-    0xa, 0xb0, 0xa, 0xb0, 0x9, 0xa0, 0x9, 0xa0,
-    0x3, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0x80, 0x3f, 0xf5, 0x1d, 0xd1,
-
-    /* U+0022 "\"" */
-    0x9d, 0x0, 0x7, 0xf0, 0x9d, 0x0, 0x6, 0xf0,
-    0x9c, 0x0, 0x6, 0xf0, 0x9c, 0x0, 0x6, 0xf0,
-    0x8c, 0x0, 0x6, 0xf0, 0x8c, 0x0, 0x5, 0xf0,
-    0x8b, 0x0, 0x5, 0xe0, 0x8b, 0x0, 0x5, 0xe0,
-    0x23, 0x0, 0x1, 0x40,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0x2f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0,
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xba, 0x0, 0x0, 0x0, 0x5e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x80, 0x0, 0x0, 0x7, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x0,
-    0x0, 0x9a, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x40, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0xd7, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3, 0x33, 0x38, 0xe3,
-    0x33, 0x33, 0x34, 0xf6, 0x33, 0x33, 0x0, 0x0,
-    0x0, 0x8c, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x5,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc8, 0x0,
-    0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x60, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x0,
-    0x0, 0xc, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x33, 0x33, 0x8e, 0x33, 0x33, 0x33, 0x4f, 0x63,
-    0x33, 0x30, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0,
-    0x2, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9b,
-    0x0, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x6, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
-    0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x50,
-    0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf3, 0x0, 0x0, 0x0, 0xc8, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x63, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xec,
-    0x83, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x9e, 0xb9,
-    0xbf, 0xfc, 0x30, 0x0, 0x8f, 0xb2, 0x0, 0xc7,
-    0x0, 0x6, 0xdb, 0x0, 0x2f, 0xb0, 0x0, 0xc,
-    0x70, 0x0, 0x0, 0x10, 0x8, 0xf2, 0x0, 0x0,
-    0xc7, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0xc, 0x70, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x50, 0xc, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xfa, 0xd7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xff, 0xfd, 0x94, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcb, 0xbf, 0xfd, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x16, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0, 0x1,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0,
-    0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xc7, 0x0,
-    0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0xc, 0x70,
-    0x0, 0x0, 0xdd, 0x1, 0x0, 0x0, 0x0, 0xc7,
-    0x0, 0x0, 0x1f, 0xa2, 0xe5, 0x0, 0x0, 0xc,
-    0x70, 0x0, 0x9, 0xf3, 0xb, 0xfc, 0x40, 0x0,
-    0xc7, 0x0, 0x1a, 0xf9, 0x0, 0x6, 0xef, 0xea,
-    0x8d, 0xb9, 0xcf, 0xf8, 0x0, 0x0, 0x0, 0x49,
-    0xce, 0xff, 0xec, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x63, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x19, 0xef, 0xd7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x20, 0x0, 0x1, 0xe8, 0x10, 0x2b,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xe6, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0x0, 0xc7, 0x0, 0x0, 0x0,
-    0xa, 0xb0, 0x0, 0x0, 0x2f, 0x10, 0x0, 0x0,
-    0x4e, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x1,
-    0xe6, 0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0,
-    0xe, 0x40, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x0,
-    0x8a, 0x0, 0x0, 0x0, 0xe, 0x40, 0x0, 0x4f,
-    0x20, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0xf, 0x30, 0x1, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x10, 0x0, 0x0, 0x4f, 0x0, 0xa, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x0,
-    0xc9, 0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x10, 0x2b, 0xd0, 0x1, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xfa,
-    0x10, 0xa, 0xc0, 0x0, 0x5c, 0xee, 0xa2, 0x0,
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x4f, 0x20, 0x9,
-    0xe6, 0x23, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe6, 0x0, 0x5e, 0x10, 0x0, 0x8, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0xc7,
-    0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x20, 0x0, 0xf2, 0x0, 0x0, 0x0, 0xa9,
-    0x0, 0x0, 0x0, 0x0, 0xe6, 0x0, 0x2, 0xf0,
-    0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x0, 0x8a,
-    0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0xf2,
-    0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0xe7,
-    0x0, 0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0xe5,
-    0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x6d,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x0, 0x4f, 0x20,
-    0x0, 0x0, 0x0, 0xa, 0xc3, 0x0, 0x7f, 0x30,
-    0x0, 0x0, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0xfe, 0xa2, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x2, 0x9d, 0xff, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd7, 0x45, 0x8f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0xac, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x0,
-    0xd9, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xe1, 0x1b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xf5, 0x0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x20, 0x0, 0x6, 0xf9,
-    0x0, 0x0, 0x4e, 0x10, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x7f, 0x80, 0x0, 0x7e, 0x0, 0x1f, 0x90,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0xda, 0x0,
-    0x4f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x63,
-    0xf4, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfd, 0xd0, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0xd, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0xf4, 0x0,
-    0x3, 0xfd, 0x20, 0x0, 0x0, 0x1, 0x9f, 0xa0,
-    0xcf, 0x30, 0x0, 0x4e, 0xfb, 0x76, 0x67, 0xbf,
-    0xf6, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x6b, 0xef,
-    0xfe, 0xb6, 0x10, 0x0, 0x1, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x9d, 0x9d, 0x9c, 0x9c, 0x8c, 0x8c, 0x8b, 0x8b,
-    0x23,
-
-    /* U+0028 "(" */
-    0x0, 0x1, 0xf7, 0x0, 0x9, 0xe0, 0x0, 0x1f,
-    0x70, 0x0, 0x7f, 0x10, 0x0, 0xdb, 0x0, 0x2,
-    0xf6, 0x0, 0x6, 0xf2, 0x0, 0xa, 0xe0, 0x0,
-    0xd, 0xb0, 0x0, 0xf, 0x80, 0x0, 0x2f, 0x60,
-    0x0, 0x4f, 0x50, 0x0, 0x5f, 0x30, 0x0, 0x6f,
-    0x30, 0x0, 0x6f, 0x20, 0x0, 0x6f, 0x20, 0x0,
-    0x6f, 0x30, 0x0, 0x5f, 0x30, 0x0, 0x4f, 0x50,
-    0x0, 0x2f, 0x60, 0x0, 0xf, 0x80, 0x0, 0xd,
-    0xb0, 0x0, 0xa, 0xe0, 0x0, 0x6, 0xf2, 0x0,
-    0x2, 0xf6, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x7f,
-    0x10, 0x0, 0x1f, 0x70, 0x0, 0x9, 0xe0, 0x0,
-    0x1, 0xf7,
-
-    /* U+0029 ")" */
-    0x3f, 0x50, 0x0, 0xa, 0xd0, 0x0, 0x3, 0xf5,
-    0x0, 0x0, 0xcc, 0x0, 0x0, 0x7f, 0x10, 0x0,
-    0x2f, 0x60, 0x0, 0xd, 0xb0, 0x0, 0xa, 0xe0,
-    0x0, 0x6, 0xf2, 0x0, 0x4, 0xf4, 0x0, 0x2,
-    0xf7, 0x0, 0x0, 0xf8, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0xea, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0xea, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0xf8, 0x0, 0x2, 0xf7, 0x0, 0x4, 0xf4, 0x0,
-    0x6, 0xf2, 0x0, 0xa, 0xe0, 0x0, 0xd, 0xb0,
-    0x0, 0x2f, 0x60, 0x0, 0x7f, 0x10, 0x0, 0xcb,
-    0x0, 0x3, 0xf5, 0x0, 0xa, 0xd0, 0x0, 0x3f,
-    0x50, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x80, 0x0, 0x0, 0x7, 0x10, 0x9, 0x80,
-    0x1, 0x70, 0x1c, 0xe6, 0x9, 0x80, 0x6e, 0xc1,
-    0x0, 0x5d, 0xdb, 0xbd, 0xe5, 0x0, 0x0, 0x0,
-    0x9f, 0xf9, 0x0, 0x0, 0x0, 0x7, 0xfe, 0xef,
-    0x80, 0x0, 0x5, 0xed, 0x39, 0x83, 0xde, 0x50,
-    0xd, 0x60, 0x9, 0x80, 0x6, 0xd0, 0x0, 0x0,
-    0x9, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x30, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x11, 0x11, 0x11, 0xad, 0x11, 0x11,
-    0x11, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x34, 0x44, 0x44, 0xbe, 0x44, 0x44, 0x44, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x0, 0x0,
-    0x0,
-
-    /* U+002C "," */
-    0x7, 0xa1, 0x1f, 0xf8, 0xc, 0xf6, 0x3, 0xf2,
-    0x7, 0xd0, 0xa, 0x90, 0xe, 0x40, 0x8, 0x0,
-
-    /* U+002D "-" */
-    0x2, 0x22, 0x22, 0x22, 0x20, 0xf, 0xff, 0xff,
-    0xff, 0xf3, 0x5, 0x55, 0x55, 0x55, 0x51,
-
-    /* U+002E "." */
-    0x7, 0xa1, 0x1f, 0xf8, 0xb, 0xe3,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x6c, 0xef, 0xfc, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xd9, 0x89, 0xdf,
-    0xe4, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x40, 0x0,
-    0x0, 0x3d, 0xf5, 0x0, 0x0, 0x2, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x1c, 0xf2, 0x0, 0x0, 0xbf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x30, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xd0, 0xf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x12, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x43, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf4, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x42, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf3, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x10, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xd0,
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x30, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x2, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x4,
-    0xfd, 0x40, 0x0, 0x0, 0x3d, 0xf5, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xd9, 0x89, 0xdf, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0xef, 0xfc, 0x70,
-    0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xbf, 0xff, 0xff, 0xf6, 0x57, 0x77, 0x79, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x3, 0xf6,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xc8, 0x20, 0x0,
-    0x0, 0x6, 0xef, 0xea, 0x98, 0x9c, 0xff, 0x70,
-    0x0, 0xa, 0xfc, 0x30, 0x0, 0x0, 0x2, 0xcf,
-    0x70, 0x1, 0xc8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x75, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0,
-
-    /* U+0033 "3" */
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x57, 0x77, 0x77, 0x77, 0x77, 0x78, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xea, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x44, 0x68, 0xdf, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xed, 0x4, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x60, 0x2d, 0xfa, 0x30, 0x0, 0x0, 0x1,
-    0x9f, 0xc0, 0x0, 0x9, 0xff, 0xea, 0x88, 0x9c,
-    0xff, 0xa0, 0x0, 0x0, 0x1, 0x6b, 0xdf, 0xff,
-    0xc9, 0x30, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-    0x8, 0x70, 0x0, 0x0, 0x0, 0x1, 0xdd, 0x10,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0,
-    0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x2f, 0xc2, 0x22, 0x22,
-    0x22, 0x22, 0x2d, 0xc2, 0x22, 0x20, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5e, 0xd5,
-    0x55, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0xaf, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x30, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x22,
-    0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xeb, 0x60, 0x0, 0x0, 0x3, 0x55,
-    0x55, 0x56, 0x7a, 0xef, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x9, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x5e, 0xf2, 0x0, 0x5, 0xdf, 0xfb, 0x98, 0x8a,
-    0xef, 0xd3, 0x0, 0x0, 0x0, 0x49, 0xcf, 0xff,
-    0xda, 0x50, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xeb, 0x71,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xb8, 0x78, 0x9d,
-    0xf9, 0x0, 0x0, 0x2, 0xef, 0x81, 0x0, 0x0,
-    0x0, 0x32, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x1, 0x10, 0x0,
-    0x0, 0x0, 0x3f, 0x60, 0x1, 0x8d, 0xff, 0xff,
-    0xb5, 0x0, 0x0, 0x3f, 0x60, 0x6f, 0xe8, 0x54,
-    0x58, 0xdf, 0xc1, 0x0, 0x3f, 0x66, 0xf7, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0x0, 0x2f, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0xf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0xd,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf3, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xd0, 0x0, 0x4f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0x7, 0xf9, 0x10,
-    0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x6f,
-    0xfa, 0x87, 0x7a, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0x7c, 0xef, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2e, 0xd7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7e,
-    0xf0, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0xc, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xeb, 0x71, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xc8, 0x77, 0x8b, 0xff,
-    0x70, 0x0, 0x0, 0x4f, 0xd3, 0x0, 0x0, 0x0,
-    0x2b, 0xf8, 0x0, 0x0, 0xee, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x20, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x8, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x8, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x6,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0,
-    0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x0, 0x0, 0xa, 0xfb, 0x51, 0x0, 0x14,
-    0xaf, 0xc1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x3c, 0xfb, 0x64,
-    0x44, 0x46, 0xaf, 0xe4, 0x0, 0x3, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0x60, 0xd, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf5, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xe0, 0x2, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0x40, 0x0, 0x2b, 0xfe,
-    0xa8, 0x76, 0x7a, 0xef, 0xd3, 0x0, 0x0, 0x0,
-    0x39, 0xce, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x1, 0x7c, 0xff, 0xfd, 0x92, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xb8, 0x67, 0xae, 0xf9, 0x0,
-    0x0, 0x7, 0xfb, 0x10, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0xe, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf2, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x45, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xe9, 0xf6, 0xc, 0xf6, 0x0,
-    0x0, 0x0, 0x2, 0xdb, 0x2f, 0x70, 0x1c, 0xfc,
-    0x63, 0x12, 0x49, 0xfb, 0x12, 0xf7, 0x0, 0x6,
-    0xdf, 0xff, 0xff, 0xd6, 0x0, 0x2f, 0x70, 0x0,
-    0x0, 0x13, 0x43, 0x10, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xf3, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x5e,
-    0xf5, 0x0, 0x0, 0x5f, 0xea, 0x87, 0x8a, 0xef,
-    0xd3, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xda,
-    0x40, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0xb, 0xe3, 0x1f, 0xf8, 0x7, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xa1, 0x1f, 0xf8,
-    0xb, 0xe3,
-
-    /* U+003B ";" */
-    0xb, 0xe3, 0x1f, 0xf8, 0x7, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xa1, 0x1f, 0xf8,
-    0xc, 0xf6, 0x3, 0xf2, 0x7, 0xd0, 0xa, 0x90,
-    0xe, 0x40, 0x8, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0xfd, 0x0, 0x0,
-    0x0, 0x1, 0x7d, 0xfc, 0x50, 0x0, 0x0, 0x3,
-    0xaf, 0xf9, 0x20, 0x0, 0x0, 0x6, 0xdf, 0xc6,
-    0x0, 0x0, 0x0, 0x29, 0xff, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0xfd, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x39, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003D "=" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x34, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x43, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x34,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
-
-    /* U+003E ">" */
-    0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e,
-    0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xfe, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
-    0xef, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9e, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xcf, 0xd7, 0x10, 0x0,
-    0x0, 0x28, 0xef, 0xb4, 0x0, 0x0, 0x0, 0x5b,
-    0xfe, 0x81, 0x0, 0x0, 0x0, 0x6e, 0xfb, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xa8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x10, 0x0,
-    0x0, 0x8f, 0xfc, 0x97, 0x79, 0xcf, 0xf6, 0x0,
-    0xb, 0xf9, 0x10, 0x0, 0x0, 0x3, 0xdf, 0x60,
-    0x2e, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xde, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xee, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x52, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbe, 0xff,
-    0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xc8, 0x64, 0x34,
-    0x57, 0xbf, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xe7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xde, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xa0, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0x80, 0x0, 0x0, 0x2f, 0x70,
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xea, 0x40, 0x0,
-    0xf7, 0x0, 0x4f, 0x30, 0x0, 0xa, 0xd0, 0x0,
-    0x0, 0x7, 0xfd, 0x74, 0x35, 0x8e, 0xb1, 0xf,
-    0x70, 0x0, 0xab, 0x0, 0x2, 0xf5, 0x0, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0x0, 0xa, 0xd1, 0xf7,
-    0x0, 0x2, 0xf3, 0x0, 0x7e, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xaf, 0x70,
-    0x0, 0xc, 0x90, 0xc, 0x90, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf7, 0x0,
-    0x0, 0x7d, 0x0, 0xf5, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x3, 0xf1, 0x2f, 0x30, 0x0, 0x9, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0,
-    0x1f, 0x33, 0xf1, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0,
-    0xf4, 0x3f, 0x10, 0x0, 0xc, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0xf,
-    0x43, 0xf1, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0xf4,
-    0x1f, 0x30, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x1f, 0x20,
-    0xf5, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x70, 0x0, 0x3, 0xf0, 0xc,
-    0x90, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf7, 0x0, 0x0, 0x7d, 0x0, 0x7e,
-    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x9f, 0x70, 0x0, 0xc, 0x80, 0x1, 0xf5,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x2c,
-    0xd0, 0xdb, 0x0, 0x5, 0xf1, 0x0, 0xa, 0xd0,
-    0x0, 0x0, 0x7, 0xfe, 0x96, 0x56, 0xaf, 0xb1,
-    0x7, 0xfa, 0x58, 0xf6, 0x0, 0x0, 0x1f, 0x70,
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xea, 0x40, 0x0,
-    0x7, 0xef, 0xd5, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xe7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x25, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
-    0xc8, 0x64, 0x44, 0x69, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0xce, 0xff, 0xfd, 0xa7, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xe7, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x8f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf3, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x5, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xe, 0xc4, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x46, 0xf7, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0xb, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf4, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20,
-
-    /* U+0042 "B" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x30,
-    0x0, 0x0, 0x1f, 0xb6, 0x66, 0x66, 0x66, 0x68,
-    0xae, 0xfb, 0x10, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xec, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xd0, 0x0, 0x1f, 0x91, 0x11, 0x11,
-    0x11, 0x12, 0x5a, 0xfc, 0x10, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x1f, 0xa4, 0x44, 0x44, 0x44, 0x45, 0x68, 0xcf,
-    0xc2, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xee, 0x10, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf1, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xee, 0x10, 0x1f, 0xb6, 0x66, 0x66, 0x66, 0x67,
-    0x8a, 0xef, 0xc2, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xd9,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xeb,
-    0x98, 0x9b, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x2d,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x4c, 0xf9, 0x0,
-    0x0, 0x3e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xe1, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xe1, 0x0, 0x0, 0x3d, 0xfb, 0x40, 0x0,
-    0x0, 0x0, 0x4c, 0xf9, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xeb, 0x98, 0x9b, 0xef, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xd9, 0x50,
-    0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x30,
-    0x0, 0x0, 0x0, 0x1f, 0xc7, 0x77, 0x77, 0x77,
-    0x89, 0xcf, 0xfc, 0x30, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xf8, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xaf, 0xa0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xa0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf5, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf5, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xa0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xaf, 0xa0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7e, 0xf8, 0x0, 0x0, 0x1f,
-    0xc7, 0x77, 0x77, 0x77, 0x89, 0xcf, 0xfc, 0x30,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xc8, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1, 0xfc, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x60, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x92, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1f, 0xa5,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x20, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x72, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50,
-
-    /* U+0046 "F" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xc7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x1f, 0xb5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x20,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x6a, 0xdf, 0xff, 0xda,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xeb,
-    0x98, 0x9b, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x2d,
-    0xfc, 0x40, 0x0, 0x0, 0x0, 0x3a, 0xfc, 0x10,
-    0x0, 0x2e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xe3, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x62, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x71, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x70, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x1e, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70,
-    0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x2d, 0xfb, 0x40, 0x0,
-    0x0, 0x0, 0x3a, 0xfd, 0x20, 0x0, 0x0, 0x8,
-    0xff, 0xeb, 0x98, 0x8b, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda, 0x61,
-    0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0x92, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x28, 0xf2, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x1f, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x5a, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-
-    /* U+0049 "I" */
-    0x1f, 0x81, 0xf8, 0x1f, 0x81, 0xf8, 0x1f, 0x81,
-    0xf8, 0x1f, 0x81, 0xf8, 0x1f, 0x81, 0xf8, 0x1f,
-    0x81, 0xf8, 0x1f, 0x81, 0xf8, 0x1f, 0x81, 0xf8,
-    0x1f, 0x81, 0xf8, 0x1f, 0x81, 0xf8, 0x1f, 0x81,
-    0xf8, 0x1f, 0x80,
-
-    /* U+004A "J" */
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x67, 0x77, 0x77, 0x77, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xc0, 0xca, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x7, 0xfa, 0x10, 0x0, 0x3, 0xee,
-    0x10, 0x7, 0xff, 0xa8, 0x8b, 0xff, 0x40, 0x0,
-    0x2, 0x9d, 0xff, 0xd9, 0x20, 0x0,
-
-    /* U+004B "K" */
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xde, 0x20, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xe2, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x7, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x5, 0xfe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x5f, 0xb0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x84, 0xfc, 0x0, 0x1d, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xcf, 0xc0, 0x0,
-    0x2, 0xee, 0x20, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x10, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0x1f, 0xd1, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xe2, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xed, 0x10, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0,
-
-    /* U+004C "L" */
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+004D "M" */
-    0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x1f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfa, 0x1f, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xfa,
-    0x1f, 0x8d, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf6, 0xfa, 0x1f, 0x84, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xd0, 0xfa,
-    0x1f, 0x80, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x40, 0xfa, 0x1f, 0x80, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0xfa,
-    0x1f, 0x80, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x0, 0xea, 0x1f, 0x80, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0xea,
-    0x1f, 0x80, 0x0, 0x7f, 0x30, 0x0, 0x0, 0x0,
-    0x9e, 0x10, 0x0, 0xea, 0x1f, 0x80, 0x0, 0xd,
-    0xc0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0xea,
-    0x1f, 0x80, 0x0, 0x5, 0xf5, 0x0, 0x0, 0xb,
-    0xd0, 0x0, 0x0, 0xea, 0x1f, 0x80, 0x0, 0x0,
-    0xce, 0x0, 0x0, 0x4f, 0x50, 0x0, 0x0, 0xea,
-    0x1f, 0x80, 0x0, 0x0, 0x3f, 0x70, 0x0, 0xdc,
-    0x0, 0x0, 0x0, 0xea, 0x1f, 0x80, 0x0, 0x0,
-    0xa, 0xf1, 0x6, 0xf3, 0x0, 0x0, 0x0, 0xea,
-    0x1f, 0x80, 0x0, 0x0, 0x1, 0xf9, 0xe, 0xa0,
-    0x0, 0x0, 0x0, 0xea, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x8f, 0xaf, 0x10, 0x0, 0x0, 0x0, 0xea,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x6, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb,
-
-    /* U+004E "N" */
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x1f, 0xaf,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x1f, 0x85, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0x80, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80,
-    0x1, 0xee, 0x10, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x1f, 0x80, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0x80, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x0, 0x7, 0xf2, 0x1f, 0x80,
-    0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x7, 0xf2,
-    0x1f, 0x80, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0x90, 0x0, 0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x7, 0xf2, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0x20, 0x7, 0xf2,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x7, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x67, 0xf2, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0xf2,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf2, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x6a, 0xdf, 0xff, 0xd9,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xeb, 0x98, 0x9b, 0xff, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xfb, 0x40, 0x0, 0x0,
-    0x0, 0x5d, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x2e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x10, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x60, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xe0, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0xd,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60,
-    0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0xa, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7,
-    0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x3e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x2d, 0xfb, 0x30, 0x0,
-    0x0, 0x0, 0x5c, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xeb, 0x88, 0x9b, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6a,
-    0xdf, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0x1f, 0xc7, 0x77, 0x77, 0x78, 0x9b, 0xff,
-    0xa1, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x20, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf5, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xce, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xec, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0x50, 0x1f, 0x92, 0x22,
-    0x22, 0x22, 0x36, 0xaf, 0xf5, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd8, 0x10, 0x0, 0x1f,
-    0xb5, 0x55, 0x55, 0x54, 0x31, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x6a, 0xdf, 0xff, 0xd9,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xfe, 0xb9, 0x89, 0xbf, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfb, 0x40, 0x0,
-    0x0, 0x0, 0x5d, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x1e, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xce, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x70, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x5c, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0xb8, 0x89,
-    0xbf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x6a, 0xdf, 0xff, 0xea, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xee,
-    0x40, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfa, 0x41, 0x26,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xff, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x24, 0x31, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x1, 0xfc, 0x77, 0x77, 0x77, 0x89, 0xbf,
-    0xfb, 0x10, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x20, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x1, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x10, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0x40, 0x1, 0xf9, 0x22, 0x22, 0x22,
-    0x23, 0x6a, 0xfe, 0x40, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x1, 0xfa,
-    0x55, 0x55, 0x55, 0x43, 0xbf, 0x20, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x1, 0xed, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xd0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x40, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x10,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0x97, 0x79, 0xbf, 0xfc,
-    0x30, 0x0, 0x8f, 0xb2, 0x0, 0x0, 0x0, 0x6,
-    0xdb, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xfa, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5b, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x37, 0xbf, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa2, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0xb, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0x1a, 0xf9, 0x0, 0x6, 0xef, 0xea, 0x87, 0x79,
-    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xec, 0x71, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x67, 0x77, 0x77, 0x77, 0xee, 0x77, 0x77,
-    0x77, 0x76, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x4f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x4f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xa4, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x4f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xa4, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x4f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xa4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x4f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xa4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x3f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x91, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x3, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x10, 0x0, 0x1d,
-    0xf9, 0x10, 0x0, 0x0, 0x5, 0xef, 0x40, 0x0,
-    0x0, 0xa, 0xff, 0xc9, 0x88, 0xae, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa5,
-    0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x2f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0xb, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0x6f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x0, 0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x76, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xdd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xb3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0xb, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x5f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x10, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x6, 0xf3, 0x0, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xb0, 0x0, 0x3, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xbd, 0x0, 0xa, 0xe0, 0x0, 0x0,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0xe, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0xf9, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0x0, 0xbd, 0x0, 0x0, 0xa, 0xe0,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x5f,
-    0x40, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x0,
-    0xf9, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0xcd, 0x0, 0x0, 0x0,
-    0xa, 0xe0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x1f, 0x70, 0x0, 0x0,
-    0x0, 0x5f, 0x40, 0x0, 0x9f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x10, 0x6, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xf9, 0x0, 0xe, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xe0, 0x3, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xc0, 0x1f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x40, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x17, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0xe, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0xcc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xe4, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xdf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x6, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0x0, 0x1e, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x4,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0,
-    0x0, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0xce,
-    0x10, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd,
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x1, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0xb, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x8f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xbf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x1e,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xa0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x10, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x1e, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8,
-
-    /* U+0059 "Y" */
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x5, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0xcf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0,
-    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf2, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0xe, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xd0, 0xb, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x5f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x32, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x74, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80,
-
-    /* U+005B "[" */
-    0x1f, 0xff, 0xff, 0x11, 0xfb, 0x66, 0x60, 0x1f,
-    0x80, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x1, 0xf8, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x1f, 0xb6, 0x66, 0x1, 0xff, 0xff,
-    0xf1,
-
-    /* U+005C "\\" */
-    0x7, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xc0,
-
-    /* U+005D "]" */
-    0x4f, 0xff, 0xfe, 0x16, 0x66, 0xde, 0x0, 0x0,
-    0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0xbe, 0x0, 0x0, 0xbe, 0x16, 0x66, 0xde, 0x4f,
-    0xff, 0xfe,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xa6, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x30,
-    0xe8, 0x0, 0x0, 0x0, 0x0, 0xac, 0x0, 0x8e,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x2f, 0x50,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0xb, 0xb0, 0x0,
-    0x0, 0xd, 0x80, 0x0, 0x4, 0xf2, 0x0, 0x0,
-    0x4f, 0x20, 0x0, 0x0, 0xd8, 0x0, 0x0, 0xbb,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x1, 0xf4, 0x0,
-    0x0, 0x0, 0x1f, 0x50, 0x8, 0xd0, 0x0, 0x0,
-    0x0, 0xa, 0xc0, 0xe, 0x70, 0x0, 0x0, 0x0,
-    0x3, 0xf3,
-
-    /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-
-    /* U+0060 "`" */
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0,
-    0x0, 0x4, 0xeb, 0x0, 0x0, 0x0, 0x1c, 0xc1,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x6b, 0xef, 0xfe, 0xa4, 0x0, 0x0,
-    0x6, 0xff, 0xc8, 0x77, 0x9e, 0xfa, 0x0, 0x7,
-    0xfa, 0x20, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x15,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x6, 0xbe, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x1c, 0xf9, 0x53, 0x33,
-    0x33, 0x35, 0xf7, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x1b, 0xaf,
-    0x70, 0xb, 0xfb, 0x53, 0x35, 0x9f, 0xa1, 0xf7,
-    0x0, 0x5, 0xbe, 0xff, 0xda, 0x40, 0x1f, 0x70,
-
-    /* U+0062 "b" */
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x5, 0xbe, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x9f, 0x1, 0xcf, 0xc8, 0x78, 0xbf, 0xf9, 0x0,
-    0x0, 0x9f, 0x1e, 0xd3, 0x0, 0x0, 0x1, 0x9f,
-    0xc0, 0x0, 0x9f, 0xbc, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x0, 0x9f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x9f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0x9e, 0xbc, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x0, 0x9e, 0x1e, 0xd3,
-    0x0, 0x0, 0x1, 0x9f, 0xc0, 0x0, 0x9e, 0x1,
-    0xcf, 0xc8, 0x78, 0xbf, 0xf9, 0x0, 0x0, 0x9e,
-    0x0, 0x5, 0xbe, 0xff, 0xd9, 0x30, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xea, 0x40, 0x0,
-    0x0, 0x2, 0xcf, 0xe9, 0x77, 0x9e, 0xfb, 0x10,
-    0x0, 0x3f, 0xe5, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x1, 0xee, 0x20, 0x0, 0x0, 0x0, 0x3, 0xb1,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x20, 0x0, 0x0, 0x0, 0x3, 0xb1,
-    0x0, 0x2e, 0xe5, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x0, 0x2, 0xcf, 0xe9, 0x77, 0x9e, 0xfb, 0x10,
-    0x0, 0x0, 0x4, 0xae, 0xff, 0xea, 0x40, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x5, 0xbe, 0xff, 0xd9, 0x20, 0x5, 0xf3,
-    0x0, 0x2, 0xdf, 0xd9, 0x77, 0xae, 0xf7, 0x5,
-    0xf3, 0x0, 0x3f, 0xe5, 0x0, 0x0, 0x0, 0x7f,
-    0x95, 0xf3, 0x1, 0xee, 0x20, 0x0, 0x0, 0x0,
-    0x4, 0xfb, 0xf3, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x6f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x6f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf3, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x1, 0xee, 0x20, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0xf3, 0x0, 0x3f, 0xe5,
-    0x0, 0x0, 0x0, 0x7f, 0x95, 0xf3, 0x0, 0x2,
-    0xdf, 0xd9, 0x77, 0xae, 0xf8, 0x5, 0xf3, 0x0,
-    0x0, 0x5, 0xbe, 0xff, 0xd9, 0x20, 0x5, 0xf3,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xfc, 0x87, 0x8b, 0xfe, 0x40,
-    0x0, 0x0, 0x4f, 0xd3, 0x0, 0x0, 0x2, 0xcf,
-    0x50, 0x0, 0x1e, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x10, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x46, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf7, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x86, 0xf5, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x31, 0x3f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0,
-    0x2e, 0xe6, 0x0, 0x0, 0x0, 0x2b, 0xf3, 0x0,
-    0x0, 0x2c, 0xfe, 0xa7, 0x78, 0xcf, 0xe4, 0x0,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
-    0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x3, 0xbf, 0xfe, 0x91, 0x0, 0x0,
-    0x4f, 0xd8, 0x68, 0xe6, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x26, 0x69, 0xf9, 0x66, 0x66, 0x30, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x30, 0x1,
-    0xf7, 0x0, 0x3, 0xdf, 0xc7, 0x55, 0x7b, 0xfa,
-    0x11, 0xf7, 0x0, 0x4f, 0xd3, 0x0, 0x0, 0x0,
-    0x2c, 0xd2, 0xf7, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbc, 0xf7, 0xa, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf7, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x4f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x6f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf7, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0xc, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf7, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0xf7, 0x0, 0x7f, 0xb1,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0xf7, 0x0, 0x7,
-    0xff, 0x94, 0x22, 0x48, 0xee, 0x32, 0xf7, 0x0,
-    0x0, 0x2a, 0xff, 0xff, 0xfe, 0x81, 0x2, 0xf6,
-    0x0, 0x0, 0x0, 0x3, 0x44, 0x20, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0x1, 0xef, 0x81, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x1a, 0xff,
-    0xc9, 0x77, 0x8a, 0xef, 0xb1, 0x0, 0x0, 0x0,
-    0x17, 0xbe, 0xff, 0xfd, 0x94, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x17, 0xcf, 0xff, 0xc7, 0x10, 0x0,
-    0x9f, 0x4, 0xef, 0xa8, 0x78, 0xcf, 0xe3, 0x0,
-    0x9f, 0x4f, 0x80, 0x0, 0x0, 0x4, 0xee, 0x10,
-    0x9f, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-    0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x9f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-
-    /* U+0069 "i" */
-    0xb, 0xf3, 0x1f, 0xf7, 0x5, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x9, 0xf0, 0x9, 0xf0, 0x9, 0xf0, 0x9, 0xf0,
-    0x9, 0xf0, 0x9, 0xf0, 0x9, 0xf0, 0x9, 0xf0,
-    0x9, 0xf0, 0x9, 0xf0, 0x9, 0xf0, 0x9, 0xf0,
-    0x9, 0xf0, 0x9, 0xf0, 0x9, 0xf0, 0x9, 0xf0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0xe,
-    0xf9, 0x0, 0x0, 0x0, 0x49, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0, 0x7f,
-    0x20, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0,
-    0x7f, 0x20, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0x0, 0x7f, 0x20, 0x0, 0x0, 0x7, 0xf2, 0x0,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x7,
-    0xf2, 0x0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-    0x7, 0xf2, 0x0, 0x0, 0x0, 0x7f, 0x20, 0x0,
-    0x0, 0x7, 0xf2, 0x0, 0x0, 0x0, 0x7f, 0x20,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0, 0x7f,
-    0x20, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0,
-    0x9f, 0x1, 0x0, 0x0, 0x2f, 0xb0, 0x9d, 0x86,
-    0x8e, 0xf3, 0x2, 0xae, 0xfe, 0xb2, 0x0,
-
-    /* U+006B "k" */
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x40,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf3, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x2, 0xde, 0x30, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x2e, 0xe2, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x3, 0xee, 0x20, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x4f, 0xd1, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x5, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x6f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x9f, 0x7, 0xfa, 0x4f, 0xc0, 0x0, 0x0, 0x0,
-    0x9f, 0x8f, 0x90, 0x6, 0xf9, 0x0, 0x0, 0x0,
-    0x9f, 0xf8, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x10, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xe1,
-
-    /* U+006C "l" */
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
-
-    /* U+006D "m" */
-    0x9e, 0x0, 0x18, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-    0x2, 0x9d, 0xff, 0xea, 0x40, 0x0, 0x9e, 0x5,
-    0xfd, 0x85, 0x57, 0xcf, 0xb1, 0x0, 0x8f, 0xc7,
-    0x55, 0x7d, 0xfa, 0x0, 0x9e, 0x5f, 0x60, 0x0,
-    0x0, 0x7, 0xfb, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x8f, 0x90, 0x9f, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x9f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcd, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcd, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd,
-
-    /* U+006E "n" */
-    0x9e, 0x0, 0x17, 0xcf, 0xff, 0xc7, 0x10, 0x0,
-    0x9e, 0x5, 0xfd, 0x86, 0x56, 0xaf, 0xe3, 0x0,
-    0x9e, 0x4f, 0x70, 0x0, 0x0, 0x2, 0xee, 0x10,
-    0x9f, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x9f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xd9, 0x77, 0xae, 0xfb,
-    0x10, 0x0, 0x0, 0x3e, 0xe5, 0x0, 0x0, 0x0,
-    0x6f, 0xd1, 0x0, 0x0, 0xee, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf1, 0xe, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xc0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0xee, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x3e,
-    0xe5, 0x0, 0x0, 0x0, 0x6f, 0xd1, 0x0, 0x0,
-    0x2, 0xcf, 0xd9, 0x77, 0xae, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xda, 0x40, 0x0,
-    0x0,
-
-    /* U+0070 "p" */
-    0x9e, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x30, 0x0,
-    0x0, 0x9e, 0x1, 0xcf, 0xc8, 0x78, 0xbf, 0xf9,
-    0x0, 0x0, 0x9e, 0x1e, 0xd3, 0x0, 0x0, 0x1,
-    0x9f, 0xc0, 0x0, 0x9e, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0x9f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xd0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x9f, 0xbc, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x9f, 0x1e,
-    0xd3, 0x0, 0x0, 0x1, 0x9f, 0xc0, 0x0, 0x9f,
-    0x1, 0xcf, 0xc8, 0x78, 0xbf, 0xf9, 0x0, 0x0,
-    0x9f, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x30, 0x0,
-    0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x20, 0x5,
-    0xf3, 0x0, 0x2, 0xdf, 0xd9, 0x77, 0xae, 0xf8,
-    0x5, 0xf3, 0x0, 0x3f, 0xe5, 0x0, 0x0, 0x0,
-    0x7f, 0x95, 0xf3, 0x1, 0xee, 0x20, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0xf3, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x1, 0xee, 0x20,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0xf3, 0x0, 0x3f,
-    0xe5, 0x0, 0x0, 0x0, 0x7f, 0x95, 0xf3, 0x0,
-    0x2, 0xdf, 0xd9, 0x77, 0xae, 0xf7, 0x5, 0xf3,
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x20, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf3,
-
-    /* U+0072 "r" */
-    0x9e, 0x0, 0x29, 0xdf, 0x49, 0xe0, 0x6f, 0xd9,
-    0x72, 0x9e, 0x5f, 0x60, 0x0, 0x9, 0xfe, 0x50,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x9, 0xf5,
-    0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa6, 0x0, 0x0,
-    0x2, 0xdf, 0xb8, 0x67, 0x9c, 0xff, 0x40, 0x0,
-    0xde, 0x30, 0x0, 0x0, 0x2, 0xa2, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb7,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff,
-    0xfd, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
-    0xae, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x30, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0xd, 0xd5, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x4d, 0xfe, 0xa8, 0x67, 0x8d, 0xfb, 0x0,
-    0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x2, 0x82, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x26, 0x69,
-    0xf9, 0x66, 0x66, 0x30, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x10,
-    0x0, 0x10, 0x0, 0x0, 0x5f, 0xe8, 0x68, 0xe7,
-    0x0, 0x0, 0x4, 0xcf, 0xfd, 0x81,
-
-    /* U+0075 "u" */
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xed, 0xf0,
-    0x8, 0xfb, 0x10, 0x0, 0x0, 0x4e, 0xb8, 0xf0,
-    0x0, 0x9f, 0xfa, 0x87, 0x8c, 0xfa, 0x8, 0xf0,
-    0x0, 0x3, 0x9d, 0xff, 0xea, 0x40, 0x8, 0xf0,
-
-    /* U+0076 "v" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x93, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf2, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x30, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x7, 0xf3, 0x0, 0x0, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x60, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf4, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xb0, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x6f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0077 "w" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf1, 0x2f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0xc, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xdc, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x50, 0x6, 0xf2, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x9, 0xe0, 0x5f,
-    0x20, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0x0, 0xe, 0x80, 0xf, 0x90, 0x0,
-    0x0, 0x4, 0xf3, 0x0, 0x0, 0x4f, 0x30, 0x0,
-    0x0, 0x5f, 0x20, 0x9, 0xe0, 0x0, 0x0, 0xa,
-    0xd0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0xbc,
-    0x0, 0x3, 0xf4, 0x0, 0x0, 0xf, 0x70, 0x0,
-    0x0, 0x8, 0xf0, 0x0, 0x1, 0xf6, 0x0, 0x0,
-    0xda, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0x2,
-    0xf5, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x10,
-    0x0, 0xbb, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0,
-    0xd, 0x90, 0x0, 0x0, 0x1f, 0x60, 0x1, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x10, 0x3f, 0x30,
-    0x0, 0x0, 0xa, 0xc0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x70, 0x9d, 0x0, 0x0, 0x0,
-    0x4, 0xf2, 0xd, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xc0, 0xe7, 0x0, 0x0, 0x0, 0x0, 0xe8,
-    0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x9d, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0xce, 0x10, 0x0, 0x0, 0x0, 0x7f, 0x50,
-    0x0, 0x1e, 0xc0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x4, 0xf9, 0x0, 0x0, 0x1e, 0xc0, 0x0,
-    0x0, 0x0, 0x7f, 0x50, 0x0, 0xbe, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xed, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xcf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf7, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xb0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x10, 0x0, 0x6f, 0x70, 0x0,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0xde, 0x10,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0,
-    0xd, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-
-    /* U+0079 "y" */
-    0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf2, 0x0, 0xce, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xa0, 0x0, 0x5f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x30, 0x0, 0xe, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x7, 0xf3,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0xb, 0xd0, 0x0, 0x0,
-    0x0, 0x8f, 0x20, 0x0, 0x0, 0x3f, 0x60, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0xae, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x8,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0xf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x50, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x34, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb7, 0x7c,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xcf,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x26,
-    0x66, 0x66, 0x66, 0x66, 0x6e, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd6, 0x66, 0x66, 0x66, 0x66, 0x64,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x1a, 0xef, 0x80, 0x0, 0xd, 0xf9,
-    0x63, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x6f,
-    0x20, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0,
-    0x7f, 0x20, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0x0, 0x7f, 0x20, 0x0, 0x0, 0x7, 0xf2, 0x0,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x7,
-    0xf2, 0x0, 0x0, 0x12, 0xdf, 0x0, 0x0, 0xf,
-    0xff, 0x40, 0x0, 0x0, 0x45, 0xed, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x7f, 0x20,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0, 0x7f,
-    0x20, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0,
-    0x7f, 0x20, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0x0, 0x7f, 0x20, 0x0, 0x0, 0x7, 0xf2, 0x0,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x6, 0xf3,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0xdf, 0x96, 0x30, 0x0, 0x1, 0xae, 0xf8,
-
-    /* U+007C "|" */
-    0x1f, 0x61, 0xf6, 0x1f, 0x61, 0xf6, 0x1f, 0x61,
-    0xf6, 0x1f, 0x61, 0xf6, 0x1f, 0x61, 0xf6, 0x1f,
-    0x61, 0xf6, 0x1f, 0x61, 0xf6, 0x1f, 0x61, 0xf6,
-    0x1f, 0x61, 0xf6, 0x1f, 0x61, 0xf6, 0x1f, 0x61,
-    0xf6, 0x1f, 0x61, 0xf6, 0x1f, 0x61, 0xf6, 0x1f,
-    0x61, 0xf6, 0x1f, 0x61, 0xf6,
-
-    /* U+007D "}" */
-    0x4f, 0xfb, 0x30, 0x0, 0x1, 0x68, 0xef, 0x20,
-    0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0xe,
-    0xb0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x10, 0x0,
-    0x0, 0x2e, 0xff, 0x40, 0x0, 0x9, 0xf7, 0x41,
-    0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0xe, 0xb0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0xe,
-    0xb0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x16, 0x8e,
-    0xf2, 0x0, 0x4, 0xff, 0xb3, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0xff, 0xb3, 0x0, 0x0, 0x1, 0xf1, 0x2f,
-    0xa4, 0x5b, 0xf6, 0x0, 0x0, 0x6d, 0xa, 0xa0,
-    0x0, 0x7, 0xfa, 0x21, 0x5f, 0x70, 0xd4, 0x0,
-    0x0, 0x4, 0xdf, 0xff, 0x80, 0x3, 0x0, 0x0,
-    0x0, 0x0, 0x23, 0x10, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x1, 0x10, 0x0, 0x2, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0xc, 0xc0, 0x0, 0x0, 0xdb,
-    0x0, 0x8, 0xe1, 0x0, 0x0, 0xae, 0x10, 0x4,
-    0xf4, 0x0, 0x0, 0x6f, 0x30, 0x2, 0xe8, 0x0,
-    0x0, 0x3f, 0x60, 0x0, 0xcc, 0x0, 0x0, 0x1e,
-    0xa0, 0x0, 0x9e, 0x10, 0x0, 0x0, 0xdb, 0x0,
-    0x8, 0xf2, 0x0, 0x0, 0x2, 0xf8, 0x0, 0xb,
-    0xd0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x1e, 0x90,
-    0x0, 0x0, 0x8, 0xe1, 0x0, 0x3f, 0x60, 0x0,
-    0x0, 0xc, 0xc0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-    0x1e, 0x80, 0x0, 0xad, 0x0,
-
-    /* U+00BB "»" */
-    0x11, 0x0, 0x0, 0x20, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0xda, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x2f,
-    0x70, 0x0, 0x0, 0xbd, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x1d, 0xa0, 0x0, 0x9e, 0x10, 0x0, 0x3,
-    0xf6, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x6f, 0x30,
-    0x2, 0xf8, 0x0, 0x0, 0x7f, 0x20, 0x2, 0xf7,
-    0x0, 0x4, 0xf5, 0x0, 0xd, 0xa0, 0x0, 0x1e,
-    0x80, 0x0, 0xad, 0x0, 0x0, 0xcc, 0x0, 0x7,
-    0xf2, 0x0, 0x8, 0xe1, 0x0, 0x3f, 0x50, 0x0,
-    0x5f, 0x30, 0x1, 0xe9, 0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x17, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xed, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xfc, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0401 "Ё" */
-    0x0, 0x2, 0xea, 0x0, 0x9, 0xe3, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0xc, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x41, 0x0, 0x1, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xfc, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0402 "Ђ" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x4, 0x77, 0x77, 0x77,
-    0x7c, 0xf8, 0x77, 0x77, 0x77, 0x75, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x47,
-    0xab, 0xba, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x6b, 0xff, 0xfd, 0xcc, 0xef, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xd7,
-    0x30, 0x0, 0x0, 0x18, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x60, 0x0, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x97, 0x66,
-    0x9e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x1e, 0xff, 0xfe, 0x92, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x16, 0xbe, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xea, 0x98,
-    0x9c, 0xff, 0xd5, 0x0, 0x0, 0x1, 0xcf, 0xc4,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0x90, 0x0, 0x1d,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xd1,
-    0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xec, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xed, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x0,
-    0x0, 0x0, 0xce, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x1e,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe1,
-    0x0, 0x1, 0xdf, 0xc4, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0x80, 0x0, 0x0, 0x8, 0xff, 0xea, 0x88,
-    0x9c, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x16,
-    0xbe, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xfc, 0x94, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xd9, 0x87, 0x8b, 0xef,
-    0xd5, 0x0, 0x0, 0x5f, 0xd3, 0x0, 0x0, 0x0,
-    0x4, 0xce, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfb, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xae, 0xff,
-    0xea, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x26, 0xaf, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xd0, 0xd, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x60, 0x8, 0xfd, 0x60, 0x0,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x4c, 0xff,
-    0xb8, 0x77, 0x8b, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x38, 0xce, 0xff, 0xec, 0x83, 0x0, 0x0,
-
-    /* U+0406 "І" */
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-    0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
-
-    /* U+0407 "Ї" */
-    0x1d, 0xd0, 0x0, 0x6f, 0x61, 0xff, 0x0, 0x9,
-    0xf8, 0x3, 0x20, 0x0, 0x4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x1, 0xf8, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x1, 0xf8, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x77, 0x77, 0x77, 0x77, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x81, 0xe7, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0xa, 0xf8, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x9, 0xfe, 0xa7, 0x8c, 0xfe, 0x20, 0x0,
-    0x3, 0xae, 0xff, 0xd8, 0x10, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe7, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x11,
-    0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x44, 0x44, 0x44, 0x45,
-    0x8d, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xef, 0x20, 0x0, 0x0,
-    0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0x0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x60, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xd0, 0x6, 0x9b, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x99,
-    0x99, 0x99, 0x99, 0xad, 0xff, 0xa1, 0x0, 0x9f,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x30,
-    0x0, 0x0,
-
-    /* U+040A "Њ" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xb2, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x2f, 0xc2, 0x22, 0x22,
-    0x22, 0x20, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xa3, 0x0, 0xf, 0xc5, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xd5, 0x55,
-    0x55, 0x55, 0x57, 0xbf, 0xf8, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xf8, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xd0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xf3, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd6, 0x66, 0x66, 0x66, 0x68,
-    0xdf, 0xe3, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xda, 0x50, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x6, 0x77, 0x77, 0x77,
-    0x7d, 0xf7, 0x77, 0x77, 0x77, 0x73, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xce, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0,
-    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x2, 0x7b, 0xef, 0xff, 0xfd, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfc, 0xff,
-    0xc8, 0x65, 0x57, 0xcf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0xc,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x85, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xec, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe1,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x40, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xc0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x10, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x1, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x22, 0x22, 0x2b, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x55, 0x55, 0x5c, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x1, 0xee,
-    0x10, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xed, 0x10,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x48, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0xf6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x4f,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x4, 0xf6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xee, 0x10, 0x4f, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x4, 0xf6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x70, 0x0, 0x4f, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x4, 0xf6,
-    0xfa, 0x0, 0x0, 0x0, 0x1e, 0xd1, 0x0, 0x0,
-    0x4f, 0x6f, 0xa0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x4, 0xf6, 0xfa, 0x0, 0x0, 0x8, 0xf6,
-    0x0, 0x0, 0x0, 0x4f, 0x6f, 0xa0, 0x0, 0x4,
-    0xfa, 0x0, 0x0, 0x0, 0x4, 0xf6, 0xfa, 0x0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x6f,
-    0xa0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0xfa, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x6f, 0xa0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0xfa, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x6f, 0xbc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x6f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x60,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x4, 0x60, 0x0, 0x0, 0x0, 0x73,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x10, 0x0,
-    0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcd, 0x40, 0x0, 0x5e, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0xfe, 0xfd, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf3, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x20, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x90, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0x10, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x2, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe1, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x80, 0xb, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x14,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xee, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x8a, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xef, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+040F "Џ" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0xfd, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x75, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0xc,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0xdc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x0, 0x0, 0x7, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x31, 0x11, 0x11, 0x11,
-    0x11, 0x1b, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x7, 0xf6, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0xce, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x6f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf2, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90,
-
-    /* U+0411 "Б" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xb6, 0x0, 0x0, 0xfb, 0x44, 0x44, 0x44, 0x44,
-    0x58, 0xcf, 0xe3, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0x20, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0x10, 0xfc, 0x66, 0x66,
-    0x66, 0x66, 0x7a, 0xef, 0xb1, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xec, 0x83, 0x0, 0x0,
-
-    /* U+0412 "В" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x7b, 0xff,
-    0x70, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1b, 0xf7, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x10, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x50, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x70, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x10, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0xfa, 0x11, 0x11, 0x11, 0x11, 0x26,
-    0xcf, 0x60, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x10, 0x0, 0xfb, 0x44, 0x44, 0x44,
-    0x44, 0x46, 0x9e, 0xf7, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x9f, 0x90, 0xfc, 0x66, 0x66,
-    0x66, 0x66, 0x68, 0xbf, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xc8, 0x20, 0x0,
-
-    /* U+0413 "Г" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x2, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x2, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0xa, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0xe, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x4f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x1, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x48, 0xcf, 0xb7, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x8f, 0xc7, 0x77,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xae, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xae, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xae, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xae, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xbe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-
-    /* U+0415 "Е" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xfc, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0416 "Ж" */
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xc0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x22, 0x22, 0x2e,
-    0xc2, 0x22, 0x24, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x65, 0x55, 0x5e,
-    0xd5, 0x55, 0x56, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0x0, 0x1, 0xee, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x59, 0xdf, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x1, 0x9f, 0xfe, 0xb9, 0x88, 0xad, 0xfe,
-    0x40, 0x0, 0x8, 0xe8, 0x20, 0x0, 0x0, 0x0,
-    0x3c, 0xf5, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0x30, 0x0, 0x0, 0x1, 0x11, 0x11, 0x24, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x14, 0x44, 0x44,
-    0x8c, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xb6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf5, 0x8b, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x5f, 0xf8, 0x20, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x40, 0x2, 0xaf, 0xfd,
-    0xa8, 0x77, 0x8b, 0xff, 0xd3, 0x0, 0x0, 0x1,
-    0x6a, 0xdf, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+0418 "И" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0xf6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x4f, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x4,
-    0xf6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xee,
-    0x10, 0x4f, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x30, 0x4, 0xf6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x70, 0x0, 0x4f, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x4, 0xf6, 0xfa,
-    0x0, 0x0, 0x0, 0x1e, 0xd1, 0x0, 0x0, 0x4f,
-    0x6f, 0xa0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x4, 0xf6, 0xfa, 0x0, 0x0, 0x8, 0xf6, 0x0,
-    0x0, 0x0, 0x4f, 0x6f, 0xa0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0xfa, 0x0, 0x1,
-    0xed, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x6f, 0xa0,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0xfa, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x6f, 0xa0, 0x5f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf6, 0xfa, 0x2f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x6f, 0xbc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x6f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x60,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0x63, 0x0, 0x0, 0x0, 0x28, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0x90, 0x0, 0x0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10, 0x0,
-    0x0, 0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd,
-    0x40, 0x2, 0xbe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0xf6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x4f,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x4, 0xf6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xee, 0x10, 0x4f, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x4, 0xf6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x70, 0x0, 0x4f, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x4, 0xf6,
-    0xfa, 0x0, 0x0, 0x0, 0x1e, 0xd1, 0x0, 0x0,
-    0x4f, 0x6f, 0xa0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x4, 0xf6, 0xfa, 0x0, 0x0, 0x8, 0xf6,
-    0x0, 0x0, 0x0, 0x4f, 0x6f, 0xa0, 0x0, 0x4,
-    0xfa, 0x0, 0x0, 0x0, 0x4, 0xf6, 0xfa, 0x0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x6f,
-    0xa0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0xfa, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x6f, 0xa0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0xfa, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x6f, 0xbc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x6f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x60,
-
-    /* U+041A "К" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xec, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe1, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xc0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x10, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x1, 0xec, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x22, 0x22, 0x2b, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x55, 0x55, 0x5c,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x1, 0xee, 0x10, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xed, 0x10, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xc, 0xe7, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0xdf, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x0, 0x0, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0,
-    0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf6, 0x9b, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x9f,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf0,
-
-    /* U+041C "М" */
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xcf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xcf, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xec, 0xfa, 0xbe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x8d, 0xcf, 0xa2, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xe0, 0xdc, 0xfa, 0x9, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0xd,
-    0xcf, 0xa0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x0, 0xdc, 0xfa, 0x0, 0x7f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0xc, 0xcf,
-    0xa0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0xcc, 0xfa, 0x0, 0x5, 0xf5, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0xc, 0xcf, 0xa0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0x1, 0xf9, 0x0,
-    0x0, 0xcc, 0xfa, 0x0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x9e, 0x10, 0x0, 0xc, 0xcf, 0xa0, 0x0,
-    0x0, 0xaf, 0x10, 0x0, 0x2f, 0x70, 0x0, 0x0,
-    0xcc, 0xfa, 0x0, 0x0, 0x1, 0xf9, 0x0, 0xb,
-    0xd0, 0x0, 0x0, 0xc, 0xcf, 0xa0, 0x0, 0x0,
-    0x8, 0xf2, 0x4, 0xf5, 0x0, 0x0, 0x0, 0xcc,
-    0xfa, 0x0, 0x0, 0x0, 0xe, 0xb0, 0xdc, 0x0,
-    0x0, 0x0, 0xc, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x5f, 0xaf, 0x30, 0x0, 0x0, 0x0, 0xcc, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0xc, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x3,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcd, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xd0,
-
-    /* U+041D "Н" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x4f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x4f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0xfb,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x7f,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xfc, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x9f, 0x4f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x4f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x4f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x40,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xdf, 0xff, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xfb, 0x98, 0x9b, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x3b, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x1d,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x30, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0x10, 0x0, 0x6,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0xa, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf1, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x30, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x30, 0xdc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0xa,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf3, 0x0, 0x6, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x10, 0x0, 0x0, 0x1d,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x1b, 0xfd, 0x50, 0x0,
-    0x0, 0x0, 0x3b, 0xfd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xef, 0xfb, 0x98, 0x8a, 0xef, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59,
-    0xdf, 0xff, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xd7, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x79, 0xf7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x70,
-
-    /* U+0420 "Р" */
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x30, 0x0,
-    0x0, 0xfd, 0x77, 0x77, 0x77, 0x89, 0xbf, 0xfc,
-    0x20, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xf3, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xee, 0x10, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xe0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x20, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xf7, 0x0, 0xfb, 0x22, 0x22,
-    0x22, 0x23, 0x5a, 0xff, 0x60, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x91, 0x0, 0x0, 0xfc,
-    0x55, 0x55, 0x55, 0x53, 0x10, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa6,
-    0x10, 0x0, 0x0, 0x0, 0x6, 0xef, 0xfc, 0x98,
-    0x9a, 0xef, 0xf8, 0x0, 0x0, 0x0, 0xbf, 0xd6,
-    0x0, 0x0, 0x0, 0x3, 0xaf, 0xc1, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe4,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe4,
-    0x0, 0x1, 0xbf, 0xd5, 0x0, 0x0, 0x0, 0x3,
-    0xaf, 0xc1, 0x0, 0x0, 0x6, 0xef, 0xfb, 0x98,
-    0x8a, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x9d, 0xff, 0xfd, 0xa6, 0x10, 0x0,
-
-    /* U+0422 "Т" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x15, 0x77, 0x77, 0x77, 0x7c, 0xf7, 0x77,
-    0x77, 0x77, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xb0, 0x7f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0,
-    0x6, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x20, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x9e, 0x10, 0x0, 0x0, 0x0, 0xc, 0xe0,
-    0x0, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xe1, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0xb, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x14, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf8, 0xcb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xee, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa9, 0x8a,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xef, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0xce, 0xff, 0xff,
-    0xfe, 0xc8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xea, 0x75, 0x7f, 0x85, 0x7a, 0xdf,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xfb, 0x40,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0x3a, 0xfd, 0x20,
-    0x0, 0x0, 0x2e, 0xe4, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x0, 0x3, 0xee, 0x20, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x2, 0xed, 0x0, 0x6, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0xce, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x1f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x23, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x53,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf5, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x30, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0xe, 0xe1,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x10, 0x0, 0x3f, 0xd2, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x1, 0xcf, 0x40,
-    0x0, 0x0, 0x4e, 0xf8, 0x10, 0x0, 0x3, 0xf5,
-    0x0, 0x0, 0x7, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x19, 0xff, 0xc8, 0x53, 0x5f, 0x62, 0x47, 0xbf,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7b,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x72, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x6f,
-    0x73, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0xd, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x4, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xee, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x10, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x1, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0xb,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x60, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-
-    /* U+0426 "Ц" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xfd,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xfd,
-    0x77, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x82,
-
-    /* U+0427 "Ч" */
-    0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdc, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdc, 0x6f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x6f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdc, 0x6f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x6f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdc, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdc, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x1, 0xef, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x5b, 0xfc, 0x0, 0x3e, 0xfc,
-    0x63, 0x22, 0x46, 0xaf, 0xfd, 0xfc, 0x0, 0x1,
-    0x8e, 0xff, 0xff, 0xff, 0xd9, 0x30, 0xdc, 0x0,
-    0x0, 0x0, 0x24, 0x54, 0x30, 0x0, 0x0, 0xdc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-
-    /* U+0428 "Ш" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xd7, 0x77, 0x77, 0x77,
-    0x77, 0x7a, 0xfa, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0429 "Щ" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0xf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0xf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0xf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0xf, 0xd7, 0x77,
-    0x77, 0x77, 0x77, 0x7a, 0xfa, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0xdf, 0x77, 0x74, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf8,
-
-    /* U+042A "Ъ" */
-    0xbf, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x77, 0x77, 0x77,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf2, 0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0x44, 0x44, 0x44, 0x45, 0x8c, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0x30, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x76, 0x66, 0x66, 0x66, 0x7a,
-    0xef, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xc9, 0x30, 0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0xfb, 0x11, 0x11, 0x11,
-    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x40, 0x0,
-    0x0, 0x0, 0xce, 0xfc, 0x44, 0x44, 0x44, 0x45,
-    0x69, 0xef, 0xb1, 0x0, 0x0, 0xc, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0,
-    0x0, 0xce, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x70, 0x0, 0xc, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0xce, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf0, 0x0, 0xc, 0xef, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0xce,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x0, 0xc, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0xce, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0xc, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf4, 0x0, 0x0, 0xce, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xf9, 0x0, 0x0,
-    0xc, 0xef, 0xc6, 0x66, 0x66, 0x66, 0x68, 0xbf,
-    0xf7, 0x0, 0x0, 0x0, 0xce, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xeb, 0x71, 0x0, 0x0, 0x0, 0xc,
-    0xe0,
-
-    /* U+042C "Ь" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa4,
-    0x0, 0x0, 0xfc, 0x44, 0x44, 0x44, 0x45, 0x69,
-    0xef, 0xb1, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xf9, 0x0, 0xfc, 0x66, 0x66,
-    0x66, 0x66, 0x8b, 0xff, 0x70, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xeb, 0x71, 0x0, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x0, 0x6a, 0xdf, 0xff, 0xd9, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xfe, 0xb9, 0x89, 0xcf,
-    0xfd, 0x40, 0x0, 0x0, 0x1d, 0xfa, 0x30, 0x0,
-    0x0, 0x1, 0x7e, 0xf8, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x80, 0x0,
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xee, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x14, 0xf7, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x47, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xee, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x5d, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x90, 0x0,
-    0x3e, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x7e, 0xf8,
-    0x0, 0x0, 0x1, 0x9f, 0xfd, 0xa8, 0x89, 0xbf,
-    0xfd, 0x40, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf,
-    0xff, 0xd9, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c,
-    0xef, 0xfd, 0xa5, 0x0, 0x0, 0x0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xc9, 0x89,
-    0xbe, 0xfe, 0x60, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf8, 0x10, 0x0, 0x0, 0x5,
-    0xdf, 0xa0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x6f, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xb0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x3f, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90,
-    0xf, 0xa0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30, 0xfa,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0xf, 0xa0, 0x0,
-    0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0xfa, 0x0, 0x0, 0xf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x6f, 0xa0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0xfd, 0x88, 0x88, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xbf,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0,
-    0x0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xbf, 0xa0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0xfa, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x6f, 0xa0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0xfa, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0xf, 0xa0,
-    0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x30, 0xfa, 0x0, 0x0,
-    0x0, 0x3f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x90, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x6f, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf8, 0x10, 0x0, 0x0, 0x5, 0xdf, 0xb0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0xc9, 0x88, 0xbe, 0xfe, 0x60, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xef,
-    0xfd, 0xa5, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x7, 0xff, 0xc9, 0x87, 0x77, 0x77,
-    0x79, 0xf6, 0x0, 0xaf, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf6, 0x6, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf6, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x4f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x8f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0xaf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf6, 0x9f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf6, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf6, 0xb, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x2, 0xee, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x3e,
-    0xfa, 0x53, 0x11, 0x11, 0x11, 0x15, 0xf6, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0xd, 0xc4, 0x44, 0x44, 0x44, 0x47,
-    0xf6, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf6, 0x0, 0x2f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x9, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-
-    /* U+0430 "а" */
-    0x0, 0x1, 0x6b, 0xef, 0xfe, 0xa4, 0x0, 0x0,
-    0x7, 0xff, 0xc8, 0x77, 0x9e, 0xf9, 0x0, 0x7,
-    0xfa, 0x20, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x15,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x6, 0xce, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x1d, 0xf9, 0x53, 0x33,
-    0x33, 0x35, 0xf6, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x60, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf6, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x1c, 0xaf,
-    0x60, 0xb, 0xfa, 0x53, 0x35, 0x9f, 0x92, 0xf6,
-    0x0, 0x5, 0xbe, 0xff, 0xda, 0x30, 0x1f, 0x60,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0xae,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x16, 0xae, 0xff,
-    0xea, 0x73, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe9,
-    0x52, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x70, 0x4, 0xbf, 0xff, 0xfd, 0x81,
-    0x0, 0x0, 0x5f, 0x31, 0xbf, 0xc7, 0x55, 0x7c,
-    0xff, 0x50, 0x0, 0x8f, 0xc, 0xd3, 0x0, 0x0,
-    0x0, 0x3d, 0xf5, 0x0, 0x9e, 0x8d, 0x10, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x10, 0xaf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0xaf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf3, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xd0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0xef, 0x20,
-    0x0, 0x0, 0x0, 0x2, 0xed, 0x0, 0x0, 0x3f,
-    0xf5, 0x0, 0x0, 0x0, 0x5e, 0xe2, 0x0, 0x0,
-    0x3, 0xef, 0xd8, 0x66, 0x8d, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xda, 0x40, 0x0,
-    0x0,
-
-    /* U+0432 "в" */
-    0x8f, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0, 0x8,
-    0xf5, 0x55, 0x55, 0x56, 0x9f, 0xf4, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf1, 0x8, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x8, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x50, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x8, 0xf1, 0x0, 0x0,
-    0x1, 0x5c, 0xd2, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xd4, 0x0, 0x8, 0xf3, 0x33, 0x33, 0x33,
-    0x59, 0xfb, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf9, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xe0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x8, 0xf5, 0x55, 0x55, 0x55, 0x7c, 0xfc, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+0433 "г" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x8f, 0x77,
-    0x77, 0x77, 0x77, 0x76, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x5f, 0x87, 0x77, 0x77,
-    0x77, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x20,
-    0x0, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0,
-    0x6f, 0x10, 0x0, 0x0, 0x0, 0x2f, 0x70, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x70, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0,
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70, 0x0,
-    0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x70, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x1,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70, 0x0,
-    0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x70, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x47, 0xef,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x7f, 0xb6, 0x61,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf2, 0xbd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf2, 0xbd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0xbd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf2,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xd8, 0x10, 0x0,
-    0x0, 0x0, 0x2c, 0xfd, 0x87, 0x7a, 0xff, 0x60,
-    0x0, 0x0, 0x2e, 0xe4, 0x0, 0x0, 0x1, 0xaf,
-    0x70, 0x0, 0xc, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x40, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x82, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb2, 0xf8, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x32, 0xf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x5, 0x10, 0x0,
-    0x1d, 0xf8, 0x0, 0x0, 0x0, 0x19, 0xf6, 0x0,
-    0x0, 0x1a, 0xff, 0xa8, 0x78, 0xbf, 0xf6, 0x0,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xec, 0x71, 0x0,
-    0x0,
-
-    /* U+0436 "ж" */
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0xc, 0xe1, 0x0, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x7f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x21,
-    0x11, 0xeb, 0x11, 0x13, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x54, 0x44, 0xfc, 0x44, 0x46, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x1, 0xed, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x0, 0x1, 0xed, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x8f,
-    0x60, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0x0, 0x0, 0x0, 0x0, 0xde, 0x10,
-    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0,
-
-    /* U+0437 "з" */
-    0x0, 0x4, 0x9d, 0xff, 0xfd, 0x94, 0x0, 0x0,
-    0x1d, 0xfd, 0xa8, 0x78, 0xae, 0xfc, 0x10, 0x0,
-    0x82, 0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x6d, 0xd2, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3, 0x33,
-    0x35, 0x8e, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x90, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0xd, 0xd5, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x2b, 0xfe, 0xa7, 0x67, 0x9e, 0xfa, 0x0,
-    0x0, 0x3, 0x8c, 0xef, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+0438 "и" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x2, 0xfe, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x1d, 0xd4, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xbf, 0x23, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x8, 0xf4, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x6f, 0x70, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x3, 0xfa, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x1e, 0xc0, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0xce, 0x10, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0xa, 0xf3, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x7f, 0x60, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x14, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0xed, 0x10, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-
-    /* U+0439 "й" */
-    0x0, 0x5, 0x40, 0x0, 0x0, 0x6, 0x20, 0x0,
-    0x0, 0x8, 0xc0, 0x0, 0x0, 0x1f, 0x30, 0x0,
-    0x0, 0x1, 0xea, 0x20, 0x4, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0x2a, 0xff, 0xfe, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x2, 0xfe, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x1d, 0xd4, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xbf, 0x23, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x8, 0xf4, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x6f, 0x70, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x3, 0xfa, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x1e, 0xc0, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0xce, 0x10, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0xa, 0xf3, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x7f, 0x60, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x14, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0xed, 0x10, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-
-    /* U+043A "к" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x1, 0xec, 0x8,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xce, 0x10, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x8, 0xf1,
-    0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x1e, 0xb0, 0x0, 0x0, 0x8f, 0x10, 0x0,
-    0xb, 0xd1, 0x0, 0x0, 0x8, 0xf2, 0x11, 0x19,
-    0xf2, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0x44, 0x4b, 0xf5,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x1d, 0xe1,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x2e, 0xd0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x4f, 0xb0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x4, 0xf9, 0x77, 0x77, 0x77, 0x78,
-    0xf8, 0x0, 0x0, 0x5f, 0x20, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x9, 0xe0, 0x0,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0xac, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0xb, 0xb0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0xd9,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x3,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x86,
-    0x8e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0xbf, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80,
-
-    /* U+043C "м" */
-    0x8f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xa8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfa, 0x8f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xa8, 0xe8, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xea, 0xda, 0x8e, 0xe,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x1d, 0xa8,
-    0xe0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x2f, 0x70,
-    0xda, 0x8e, 0x0, 0xcd, 0x0, 0x0, 0x0, 0xa,
-    0xd0, 0xd, 0xa8, 0xe0, 0x3, 0xf6, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0xda, 0x8e, 0x0, 0x9, 0xf1,
-    0x0, 0x0, 0xda, 0x0, 0xd, 0xa8, 0xe0, 0x0,
-    0x1e, 0x90, 0x0, 0x7f, 0x10, 0x0, 0xda, 0x8e,
-    0x0, 0x0, 0x6f, 0x30, 0x1f, 0x70, 0x0, 0xd,
-    0xa8, 0xe0, 0x0, 0x0, 0xcc, 0xa, 0xd0, 0x0,
-    0x0, 0xda, 0x8e, 0x0, 0x0, 0x3, 0xf9, 0xf4,
-    0x0, 0x0, 0xd, 0xa8, 0xe0, 0x0, 0x0, 0xa,
-    0xfa, 0x0, 0x0, 0x0, 0xda, 0x8e, 0x0, 0x0,
-    0x0, 0x1c, 0x10, 0x0, 0x0, 0xd, 0xa8, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda,
-    0x8e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xa0,
-
-    /* U+043D "н" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0xf2, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0xaf, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xf5, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0xbf, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x50, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xea, 0x77, 0x9d, 0xfd,
-    0x20, 0x0, 0x0, 0x1d, 0xf7, 0x0, 0x0, 0x0,
-    0x5e, 0xf3, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xee, 0x10, 0x5, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x90, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x2f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x3f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf7, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf4, 0xc, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x5, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0xbf, 0x40,
-    0x0, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x1d,
-    0xf7, 0x0, 0x0, 0x0, 0x5e, 0xf3, 0x0, 0x0,
-    0x1, 0xaf, 0xea, 0x77, 0x9d, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x3, 0xad, 0xff, 0xeb, 0x50, 0x0,
-    0x0,
-
-    /* U+043F "п" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x8f, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7c, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-
-    /* U+0440 "р" */
-    0x8f, 0x0, 0x4, 0xae, 0xff, 0xd9, 0x30, 0x0,
-    0x0, 0x8f, 0x1, 0xbf, 0xd9, 0x77, 0xaf, 0xfa,
-    0x10, 0x0, 0x8f, 0x1d, 0xd4, 0x0, 0x0, 0x0,
-    0x8f, 0xd1, 0x0, 0x8f, 0xad, 0x10, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x8f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x8f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf1, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xe0, 0x8f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x8f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x8f, 0xbd, 0x10,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x8f, 0x2d,
-    0xd4, 0x0, 0x0, 0x0, 0x8f, 0xd1, 0x0, 0x8f,
-    0x11, 0xbf, 0xd9, 0x77, 0xaf, 0xfa, 0x10, 0x0,
-    0x8f, 0x10, 0x4, 0xae, 0xff, 0xd9, 0x30, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x1, 0xaf, 0xea, 0x77, 0x9d, 0xfd, 0x20,
-    0x0, 0x1d, 0xf7, 0x0, 0x0, 0x0, 0x4e, 0xe2,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x1, 0xb2,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x1, 0xb2,
-    0x0, 0x1d, 0xf7, 0x0, 0x0, 0x0, 0x4e, 0xe2,
-    0x0, 0x1, 0xaf, 0xea, 0x77, 0x9d, 0xfd, 0x20,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7, 0x77, 0x77, 0x7b, 0xf8, 0x77, 0x77, 0x74,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcd, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x60, 0x0, 0x8f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x0, 0x1, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x1f, 0x90,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x7,
-    0xf2, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0,
-    0x0, 0xea, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf2, 0x0, 0xbd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x2f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x1a, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x77, 0xaf, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xbf, 0xfd, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5a, 0xde, 0xff, 0xfe, 0xb8,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0xa8,
-    0xcf, 0x89, 0xcf, 0xfc, 0x30, 0x0, 0x0, 0x1c,
-    0xfa, 0x30, 0x0, 0x8f, 0x10, 0x0, 0x6e, 0xf6,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x1, 0xbf, 0x50, 0x6, 0xf7, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0xd, 0xe0, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x4, 0xf6, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0xfa, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0xcc,
-    0x4f, 0x40, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0xbd, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xcc, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0xfa, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x5, 0xf5, 0x6, 0xf7, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0xcf, 0x60, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x1,
-    0xcf, 0x40, 0x0, 0x1c, 0xfb, 0x30, 0x0, 0x8f,
-    0x10, 0x0, 0x6e, 0xf6, 0x0, 0x0, 0x0, 0x8f,
-    0xfe, 0xa8, 0xcf, 0x89, 0xcf, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xfe, 0xb8,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe1,
-    0x0, 0xde, 0x10, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x2f, 0xb0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0x2f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0xcd, 0x10, 0x0,
-    0x0, 0x0, 0xc, 0xe1, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xec, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xce, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x1e, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x3, 0xf9, 0x0, 0x0,
-    0x0, 0x1, 0xed, 0x0, 0x0, 0x7f, 0x50, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x7f, 0x50, 0x0, 0x0, 0x1, 0xed, 0x0,
-    0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0x1e, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-
-    /* U+0446 "ц" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xb0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xb0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xb0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xb0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xb0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xb0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x8f,
-    0x76, 0x66, 0x66, 0x66, 0x66, 0x6f, 0xd6, 0x63,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf8,
-
-    /* U+0447 "ч" */
-    0x6f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x76,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x6f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x76, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x76, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x5f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x73, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x2e, 0xf9, 0x41, 0x12,
-    0x59, 0xef, 0xf7, 0x0, 0x19, 0xff, 0xff, 0xff,
-    0xb6, 0x3f, 0x70, 0x0, 0x0, 0x24, 0x32, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70,
-
-    /* U+0448 "ш" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0xb, 0xe8, 0xf1, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0xb, 0xe8, 0xf1, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0xb, 0xe8, 0xf1, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0xb,
-    0xe8, 0xf1, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0xb, 0xe8,
-    0xf1, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0xb, 0xe8, 0xf1,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0xb, 0xe8, 0xf1, 0x0,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xbe, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0xb, 0xe8, 0xf7, 0x66, 0x66,
-    0x66, 0x67, 0xfb, 0x66, 0x66, 0x66, 0x66, 0xde,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0,
-
-    /* U+0449 "щ" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0xb,
-    0xe0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0xb, 0xe0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0xb,
-    0xe0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0xb, 0xe0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x0, 0x8f, 0x76, 0x66, 0x66, 0x66,
-    0x7f, 0xb6, 0x66, 0x66, 0x66, 0x6d, 0xf6, 0x63,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf8,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x77, 0x77, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xeb, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x33, 0x33, 0x34, 0x6c, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0xbe, 0x44, 0x44, 0x45, 0x8d, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xd9,
-    0x30, 0x0,
-
-    /* U+044B "ы" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x18, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x18, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x18,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf1, 0x8f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x8f, 0x18, 0xf4, 0x33, 0x33, 0x36, 0xaf,
-    0xd1, 0x0, 0x8, 0xf1, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x8f, 0x18, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x20, 0x8, 0xf1, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x8f,
-    0x18, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0x8, 0xf1, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x8f, 0x18, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x10, 0x8, 0xf1, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x0, 0x8f, 0x18, 0xf5,
-    0x44, 0x44, 0x57, 0xcf, 0xa0, 0x0, 0x8, 0xf1,
-    0x8f, 0xff, 0xff, 0xff, 0xda, 0x40, 0x0, 0x0,
-    0x8f, 0x10,
-
-    /* U+044C "ь" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xec, 0x70,
-    0x0, 0x8f, 0x43, 0x33, 0x33, 0x5a, 0xfd, 0x20,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xf6, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x5f,
-    0xa0, 0x8f, 0x54, 0x44, 0x45, 0x7c, 0xfb, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xea, 0x50, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x28, 0xce, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x9, 0xfe, 0x97, 0x56, 0x9d, 0xfb, 0x10, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x5e, 0xe2, 0x0,
-    0x12, 0x0, 0x0, 0x0, 0x0, 0x2, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x13, 0x33, 0x33, 0x33, 0x35, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xed, 0x0,
-    0x9e, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xe2, 0x0,
-    0x1a, 0xfe, 0x97, 0x67, 0x9e, 0xfb, 0x10, 0x0,
-    0x0, 0x28, 0xce, 0xff, 0xd9, 0x30, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x17, 0xcf, 0xfe,
-    0xc7, 0x10, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x87, 0x8c, 0xfe, 0x50, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x7f, 0xb2, 0x0, 0x0, 0x3,
-    0xcf, 0x60, 0x8, 0xf1, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x8f, 0x10,
-    0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x8, 0xf1, 0x0, 0x4, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf2, 0x8f, 0x10, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x68, 0xf3, 0x22, 0x2b, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf8, 0x8f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x98,
-    0xf5, 0x55, 0x5c, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x8f, 0x10, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x68, 0xf1,
-    0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf2, 0x8f, 0x10, 0x0, 0xd, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x8, 0xf1, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x8f, 0x10, 0x0, 0x0, 0x7f, 0xb2, 0x0,
-    0x0, 0x2, 0xcf, 0x50, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x6f, 0xfb, 0x87, 0x8b, 0xfe, 0x50, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x17, 0xcf, 0xfe,
-    0xc7, 0x10, 0x0, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x6, 0xbe, 0xff, 0xff, 0xff, 0xfc, 0x3,
-    0xef, 0xc8, 0x76, 0x66, 0x66, 0xdc, 0x1e, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0xbc, 0x8f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xbc, 0xcd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbc, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbc, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xbc, 0x7,
-    0xfc, 0x51, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x3b,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xeb,
-    0x33, 0x33, 0x33, 0xcc, 0x0, 0xb, 0xe1, 0x0,
-    0x0, 0x0, 0xbc, 0x0, 0x7f, 0x40, 0x0, 0x0,
-    0x0, 0xbc, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xbc, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xbc,
-    0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbc,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x0, 0x68, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xef,
-    0xfd, 0x81, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xd8,
-    0x77, 0xaf, 0xf6, 0x0, 0x0, 0x2, 0xee, 0x40,
-    0x0, 0x0, 0x1a, 0xf7, 0x0, 0x0, 0xce, 0x20,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x6f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0xc, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x30, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x2f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x2f, 0x83, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x20, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x51, 0x0, 0x1, 0xdf, 0x80, 0x0, 0x0,
-    0x1, 0x9f, 0x60, 0x0, 0x1, 0xaf, 0xfa, 0x87,
-    0x8b, 0xff, 0x60, 0x0, 0x0, 0x0, 0x39, 0xdf,
-    0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x10, 0x8, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbe, 0xff,
-    0xd8, 0x10, 0x0, 0x0, 0x0, 0x2c, 0xfd, 0x87,
-    0x7a, 0xff, 0x60, 0x0, 0x0, 0x2e, 0xe4, 0x0,
-    0x0, 0x1, 0xaf, 0x70, 0x0, 0xc, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x6, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0xcd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x82, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
-    0xf8, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32,
-    0xf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x10, 0x0, 0x1d, 0xf8, 0x0, 0x0, 0x0,
-    0x19, 0xf6, 0x0, 0x0, 0x1a, 0xff, 0xa8, 0x78,
-    0xbf, 0xf6, 0x0, 0x0, 0x0, 0x3, 0x9d, 0xff,
-    0xec, 0x71, 0x0, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x3, 0x33, 0xaf, 0x33, 0x33, 0x33,
-    0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x7, 0xce, 0xff, 0xc8,
-    0x10, 0x0, 0x0, 0x0, 0x8f, 0x3, 0xef, 0xb8,
-    0x78, 0xcf, 0xf4, 0x0, 0x0, 0x0, 0x8f, 0x3f,
-    0x91, 0x0, 0x0, 0x3, 0xef, 0x20, 0x0, 0x0,
-    0x8f, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x8f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xe9, 0x67, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0xff, 0xc5, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x60, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x8f, 0x77, 0x77, 0x77, 0x77, 0x76, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xfd, 0x94, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xa7, 0x67, 0x9d, 0xfc,
-    0x20, 0x0, 0x1c, 0xf8, 0x0, 0x0, 0x0, 0x4,
-    0xdc, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x3, 0xf7, 0x33, 0x33,
-    0x33, 0x33, 0x20, 0x0, 0x0, 0x1f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0,
-    0x1c, 0xf7, 0x0, 0x0, 0x0, 0x4, 0xdc, 0x0,
-    0x0, 0x9, 0xfe, 0x96, 0x56, 0x9d, 0xfb, 0x10,
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xfd, 0x93, 0x0,
-    0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x1, 0x8c, 0xff, 0xfd, 0x94, 0x0, 0x0,
-    0x5f, 0xfa, 0x76, 0x79, 0xdf, 0xd1, 0x2, 0xfc,
-    0x10, 0x0, 0x0, 0x4, 0xa0, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfa, 0x63, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xff, 0xfc, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0x7b, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xae, 0x2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdc, 0x2f, 0xa3, 0x0, 0x0, 0x0, 0x9,
-    0xf5, 0x7, 0xff, 0xd9, 0x76, 0x79, 0xef, 0x80,
-    0x0, 0x6, 0xad, 0xff, 0xfd, 0x93, 0x0,
-
-    /* U+0456 "і" */
-    0x5, 0x81, 0xf, 0xf8, 0xb, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1,
-    0x8, 0xf1, 0x8, 0xf1, 0x8, 0xf1, 0x8, 0xf1,
-    0x8, 0xf1, 0x8, 0xf1, 0x8, 0xf1, 0x8, 0xf1,
-    0x8, 0xf1, 0x8, 0xf1, 0x8, 0xf1, 0x8, 0xf1,
-    0x8, 0xf1, 0x8, 0xf1, 0x8, 0xf1, 0x8, 0xf1,
-
-    /* U+0457 "ї" */
-    0x9e, 0x20, 0xae, 0x1c, 0xf3, 0xd, 0xf3, 0x13,
-    0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x9, 0xf0, 0x0,
-    0x0, 0x9f, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x9f, 0x0,
-    0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x48, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x8, 0xf1,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x8,
-    0xf1, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0xaf, 0x1, 0x0, 0x0, 0x2f, 0xa0, 0xad, 0x86,
-    0x8f, 0xe2, 0x2, 0xae, 0xfe, 0xa2, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x97, 0x77, 0x77, 0x77, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x20,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x10, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xfd,
-    0x93, 0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xa3, 0x33, 0x33, 0x47, 0xdf, 0x80,
-    0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0xbb, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xd9, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x8,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x0, 0x2f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x3d, 0xf3, 0x68, 0xef, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc7, 0x77, 0x77, 0x9c, 0xff, 0x50,
-    0xbf, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xec, 0x81, 0x0,
-
-    /* U+045A "њ" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x21,
-    0x11, 0x11, 0x11, 0x11, 0x1f, 0xb1, 0x11, 0x11,
-    0x10, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x0,
-    0x8f, 0x54, 0x44, 0x44, 0x44, 0x44, 0x4f, 0xc4,
-    0x44, 0x44, 0x58, 0xdf, 0xb0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xbe, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0,
-    0x0, 0xa, 0xf3, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xb4, 0x44, 0x44, 0x57, 0xdf, 0x60,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xfd, 0x92, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x22, 0x22, 0x9f, 0x32, 0x22, 0x22, 0x22, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x7, 0xce, 0xff, 0xc8, 0x10, 0x0,
-    0x0, 0x0, 0x8f, 0x13, 0xef, 0xb8, 0x78, 0xcf,
-    0xe4, 0x0, 0x0, 0x0, 0x8f, 0x4f, 0x91, 0x0,
-    0x0, 0x3, 0xef, 0x20, 0x0, 0x0, 0x8f, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf4, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x28, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xc0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0xc, 0xe1, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x1, 0xeb, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0xbd, 0x10, 0x0,
-    0x0, 0x8f, 0x21, 0x11, 0x9f, 0x20, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x8f, 0x54, 0x44, 0xbf, 0x50, 0x0, 0x0, 0x8,
-    0xf1, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x1, 0xde, 0x10, 0x0, 0x8, 0xf1,
-    0x0, 0x0, 0x2, 0xed, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x4, 0xfb, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x8, 0xf6, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4,
-
-    /* U+045D "ѝ" */
-    0x0, 0x6, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x2, 0xfe, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x1d, 0xd4, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xbf, 0x23, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x8, 0xf4, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x0, 0x6f, 0x70, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x3, 0xfa, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0x1e, 0xc0, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x0, 0xce, 0x10, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0xa, 0xf3, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x10, 0x7f, 0x60, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x14, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0xed, 0x10, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0xd,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x2b, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x4f,
-    0x60, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0x0, 0x0, 0x6, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0xdc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x4f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x20,
-    0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf1, 0xae, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x60, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xc7, 0x7a, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xbd, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xbd, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xbd, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xbd, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbd,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xbd, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xbd, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xbd, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xbd, 0x8f, 0x76, 0x66, 0x66, 0x66, 0x66, 0xdd,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x57, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x76, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xe8, 0xf7, 0x77, 0x77, 0x77,
-    0x76, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x8, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x8,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-
-    /* U+2014 "—" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-
-    /* U+2018 "‘" */
-    0x0, 0xc6, 0x1, 0xf2, 0x5, 0xe0, 0xa, 0xb0,
-    0xe, 0xc1, 0x1f, 0xf7, 0xc, 0xe3,
-
-    /* U+2019 "’" */
-    0xb, 0xe3, 0x1f, 0xf8, 0x8, 0xf5, 0x4, 0xf1,
-    0x8, 0xc0, 0xb, 0x70, 0xf, 0x30, 0x3, 0x0,
-
-    /* U+201A "‚" */
-    0x7, 0xa1, 0x1f, 0xf8, 0xc, 0xf6, 0x3, 0xf2,
-    0x7, 0xd0, 0xa, 0x90, 0xe, 0x40, 0x8, 0x0,
-
-    /* U+201C "“" */
-    0x0, 0xc6, 0x0, 0xd, 0x40, 0x1f, 0x20, 0x2,
-    0xf1, 0x5, 0xe0, 0x0, 0x7d, 0x0, 0xab, 0x0,
-    0xb, 0x90, 0xe, 0xc1, 0x0, 0xfb, 0x1, 0xff,
-    0x70, 0x3f, 0xf5, 0xc, 0xe3, 0x0, 0xde, 0x20,
-
-    /* U+201D "”" */
-    0xb, 0xe3, 0x0, 0xde, 0x21, 0xff, 0x80, 0x3f,
-    0xf6, 0x8, 0xf5, 0x0, 0x9f, 0x30, 0x4f, 0x10,
-    0x6, 0xf0, 0x8, 0xc0, 0x0, 0xaa, 0x0, 0xb7,
-    0x0, 0xd, 0x60, 0xf, 0x30, 0x1, 0xf1, 0x0,
-    0x30, 0x0, 0x3, 0x0,
-
-    /* U+2026 "…" */
-    0x7, 0xa1, 0x0, 0x2, 0xa7, 0x0, 0x0, 0x6b,
-    0x21, 0xff, 0x80, 0x0, 0x8f, 0xf1, 0x0, 0xf,
-    0xf9, 0xb, 0xe3, 0x0, 0x3, 0xeb, 0x0, 0x0,
-    0xaf, 0x40,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xcf, 0xfc, 0x97, 0x79,
-    0xcf, 0xf6, 0x0, 0x0, 0x0, 0xa, 0xd6, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0x70, 0x0, 0x0, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x12, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x12, 0x4f, 0xe3, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x20,
-    0x0, 0x7, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x3a,
-    0xfc, 0x10, 0x0, 0x0, 0x6f, 0xfc, 0x97, 0x78,
-    0xae, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x1, 0x7b,
-    0xef, 0xff, 0xc9, 0x40, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x6, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x60, 0x0, 0x0, 0x1, 0x58, 0x85, 0x0,
-    0x0, 0x1f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x7f, 0xc8, 0x8c,
-    0xf6, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0x7, 0xe3, 0x0,
-    0x0, 0x4f, 0x60, 0x1f, 0xef, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x1f, 0x40,
-    0x0, 0x0, 0x5, 0xe0, 0x1f, 0x8b, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x5e,
-    0x0, 0x0, 0x0, 0x0, 0xf4, 0x1f, 0x81, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x6c, 0x0, 0x0, 0x0, 0x0, 0xd5, 0x1f, 0x80,
-    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1,
-    0x0, 0x5e, 0x0, 0x0, 0x0, 0x0, 0xf4, 0x1f,
-    0x80, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf1, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x5, 0xf0,
-    0x1f, 0x80, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x7, 0xe3, 0x0, 0x0, 0x4f,
-    0x60, 0x1f, 0x80, 0x0, 0xc, 0xf4, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x7f, 0xb8, 0x8c,
-    0xf6, 0x0, 0x1f, 0x80, 0x0, 0x1, 0xee, 0x10,
-    0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x1, 0x68,
-    0x86, 0x10, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x4f,
-    0xc0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x8, 0xf1, 0x0,
-    0x5, 0x77, 0x77, 0x77, 0x77, 0x50, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x8, 0xf1,
-    0x0, 0x8, 0xbb, 0xbb, 0xbb, 0xbb, 0x80, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x8,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x48, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xea, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 132, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 129, .box_w = 4, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 46, .adv_w = 183, .box_w = 8, .box_h = 9, .ofs_x = 2, .ofs_y = 14},
-    {.bitmap_index = 82, .adv_w = 353, .box_w = 21, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 324, .adv_w = 312, .box_w = 17, .box_h = 31, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 588, .adv_w = 418, .box_w = 24, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 864, .adv_w = 335, .box_w = 20, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1104, .adv_w = 99, .box_w = 2, .box_h = 9, .ofs_x = 2, .ofs_y = 14},
-    {.bitmap_index = 1113, .adv_w = 164, .box_w = 6, .box_h = 30, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 1203, .adv_w = 165, .box_w = 6, .box_h = 30, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 1293, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 1365, .adv_w = 291, .box_w = 14, .box_h = 15, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 1470, .adv_w = 102, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1486, .adv_w = 195, .box_w = 10, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 1501, .adv_w = 102, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1507, .adv_w = 164, .box_w = 13, .box_h = 31, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 1709, .adv_w = 337, .box_w = 19, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1928, .adv_w = 181, .box_w = 8, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2020, .adv_w = 288, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2216, .adv_w = 286, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2412, .adv_w = 335, .box_w = 20, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2642, .adv_w = 286, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2838, .adv_w = 308, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3045, .adv_w = 297, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3241, .adv_w = 324, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3448, .adv_w = 308, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3644, .adv_w = 102, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3678, .adv_w = 102, .box_w = 4, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3722, .adv_w = 291, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3820, .adv_w = 291, .box_w = 14, .box_h = 10, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 3890, .adv_w = 291, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3988, .adv_w = 288, .box_w = 16, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4172, .adv_w = 529, .box_w = 31, .box_h = 29, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 4622, .adv_w = 361, .box_w = 23, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4887, .adv_w = 385, .box_w = 20, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5117, .adv_w = 361, .box_w = 21, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5359, .adv_w = 423, .box_w = 22, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5612, .adv_w = 343, .box_w = 17, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5808, .adv_w = 323, .box_w = 16, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5992, .adv_w = 396, .box_w = 21, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6234, .adv_w = 417, .box_w = 20, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6464, .adv_w = 151, .box_w = 3, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6499, .adv_w = 251, .box_w = 13, .box_h = 23, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6649, .adv_w = 360, .box_w = 20, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6879, .adv_w = 300, .box_w = 16, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7063, .adv_w = 489, .box_w = 24, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7339, .adv_w = 417, .box_w = 20, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7569, .adv_w = 429, .box_w = 25, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7857, .adv_w = 366, .box_w = 18, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8064, .adv_w = 429, .box_w = 26, .box_h = 28, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 8428, .adv_w = 369, .box_w = 19, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8647, .adv_w = 312, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8843, .adv_w = 288, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9050, .adv_w = 406, .box_w = 19, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9269, .adv_w = 352, .box_w = 22, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9522, .adv_w = 562, .box_w = 33, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9902, .adv_w = 329, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10132, .adv_w = 320, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10362, .adv_w = 331, .box_w = 19, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10581, .adv_w = 157, .box_w = 7, .box_h = 30, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 10686, .adv_w = 164, .box_w = 13, .box_h = 31, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 10888, .adv_w = 157, .box_w = 6, .box_h = 30, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 10978, .adv_w = 292, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 11076, .adv_w = 256, .box_w = 16, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11092, .adv_w = 307, .box_w = 8, .box_h = 4, .ofs_x = 4, .ofs_y = 20},
-    {.bitmap_index = 11108, .adv_w = 298, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11236, .adv_w = 346, .box_w = 18, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11452, .adv_w = 284, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11588, .adv_w = 346, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11804, .adv_w = 306, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11949, .adv_w = 168, .box_w = 12, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12093, .adv_w = 349, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 12300, .adv_w = 345, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12492, .adv_w = 134, .box_w = 4, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12540, .adv_w = 136, .box_w = 9, .box_h = 30, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 12675, .adv_w = 298, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12867, .adv_w = 134, .box_w = 2, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12891, .adv_w = 545, .box_w = 28, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13129, .adv_w = 345, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13265, .adv_w = 317, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13418, .adv_w = 346, .box_w = 18, .box_h = 23, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 13625, .adv_w = 346, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 13832, .adv_w = 202, .box_w = 9, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13909, .adv_w = 245, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14037, .adv_w = 204, .box_w = 12, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14163, .adv_w = 343, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14299, .adv_w = 270, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14444, .adv_w = 441, .box_w = 28, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14682, .adv_w = 266, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14818, .adv_w = 270, .box_w = 18, .box_h = 23, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 15025, .adv_w = 258, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15144, .adv_w = 164, .box_w = 9, .box_h = 30, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 15279, .adv_w = 149, .box_w = 3, .box_h = 30, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 15324, .adv_w = 164, .box_w = 9, .box_h = 30, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 15459, .adv_w = 291, .box_w = 15, .box_h = 6, .ofs_x = 2, .ofs_y = 8},
-    {.bitmap_index = 15504, .adv_w = 233, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 15589, .adv_w = 233, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 15667, .adv_w = 334, .box_w = 16, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 15899, .adv_w = 334, .box_w = 16, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 16123, .adv_w = 419, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16423, .adv_w = 291, .box_w = 14, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 16626, .adv_w = 361, .box_w = 20, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16856, .adv_w = 317, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17063, .adv_w = 155, .box_w = 2, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17086, .adv_w = 151, .box_w = 9, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17212, .adv_w = 264, .box_w = 13, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17362, .adv_w = 607, .box_w = 37, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17788, .adv_w = 608, .box_w = 33, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18168, .adv_w = 423, .box_w = 25, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18456, .adv_w = 356, .box_w = 18, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18717, .adv_w = 422, .box_w = 19, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18993, .adv_w = 344, .box_w = 21, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19298, .adv_w = 412, .box_w = 18, .box_h = 29, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 19559, .adv_w = 375, .box_w = 23, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19824, .adv_w = 370, .box_w = 18, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20031, .adv_w = 384, .box_w = 18, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20238, .adv_w = 291, .box_w = 14, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20399, .adv_w = 402, .box_w = 24, .box_h = 28, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 20735, .adv_w = 334, .box_w = 16, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20919, .adv_w = 510, .box_w = 32, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21287, .adv_w = 313, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21494, .adv_w = 422, .box_w = 19, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 21713, .adv_w = 422, .box_w = 19, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 21989, .adv_w = 356, .box_w = 18, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22196, .adv_w = 400, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22438, .adv_w = 494, .box_w = 23, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22703, .adv_w = 421, .box_w = 19, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22922, .adv_w = 437, .box_w = 25, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23210, .adv_w = 424, .box_w = 19, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 23429, .adv_w = 361, .box_w = 18, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 23636, .adv_w = 366, .box_w = 20, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23866, .adv_w = 294, .box_w = 19, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24085, .adv_w = 344, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24327, .adv_w = 465, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 24665, .adv_w = 325, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24895, .adv_w = 422, .box_w = 22, .box_h = 29, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 25214, .adv_w = 365, .box_w = 18, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25421, .adv_w = 560, .box_w = 27, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 25732, .adv_w = 570, .box_w = 31, .box_h = 28, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 26166, .adv_w = 417, .box_w = 25, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26454, .adv_w = 495, .box_w = 23, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 26719, .adv_w = 362, .box_w = 18, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 26926, .adv_w = 361, .box_w = 20, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 27156, .adv_w = 557, .box_w = 29, .box_h = 23, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 27490, .adv_w = 375, .box_w = 18, .box_h = 23, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27697, .adv_w = 295, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 27825, .adv_w = 336, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 28050, .adv_w = 308, .box_w = 15, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 28178, .adv_w = 238, .box_w = 12, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 28280, .adv_w = 327, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 28490, .adv_w = 312, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 28635, .adv_w = 413, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28856, .adv_w = 269, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28984, .adv_w = 349, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29120, .adv_w = 349, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29312, .adv_w = 291, .box_w = 15, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29440, .adv_w = 319, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29585, .adv_w = 401, .box_w = 19, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29747, .adv_w = 343, .box_w = 15, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29875, .adv_w = 324, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 30028, .adv_w = 344, .box_w = 16, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30164, .adv_w = 350, .box_w = 18, .box_h = 23, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 30371, .adv_w = 285, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 30507, .adv_w = 233, .box_w = 16, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 30643, .adv_w = 280, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 30862, .adv_w = 393, .box_w = 22, .box_h = 31, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 31203, .adv_w = 263, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31339, .adv_w = 348, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 31528, .adv_w = 303, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 31656, .adv_w = 470, .box_w = 23, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 31852, .adv_w = 470, .box_w = 26, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 32125, .adv_w = 310, .box_w = 20, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 32295, .adv_w = 392, .box_w = 19, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32457, .adv_w = 283, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32576, .adv_w = 291, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 32712, .adv_w = 438, .box_w = 23, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32908, .adv_w = 308, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 33027, .adv_w = 317, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33231, .adv_w = 312, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33427, .adv_w = 342, .box_w = 20, .box_h = 31, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 33737, .adv_w = 238, .box_w = 12, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 33881, .adv_w = 291, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34026, .adv_w = 266, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34145, .adv_w = 136, .box_w = 4, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34193, .adv_w = 134, .box_w = 7, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34274, .adv_w = 136, .box_w = 9, .box_h = 30, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 34409, .adv_w = 466, .box_w = 28, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 34647, .adv_w = 480, .box_w = 26, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 34868, .adv_w = 342, .box_w = 20, .box_h = 24, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 35108, .adv_w = 291, .box_w = 15, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35288, .adv_w = 349, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35480, .adv_w = 280, .box_w = 19, .box_h = 30, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 35765, .adv_w = 325, .box_w = 14, .box_h = 21, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 35912, .adv_w = 292, .box_w = 14, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 36108, .adv_w = 223, .box_w = 11, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36224, .adv_w = 256, .box_w = 16, .box_h = 3, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 36248, .adv_w = 512, .box_w = 32, .box_h = 3, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 36296, .adv_w = 102, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = 17},
-    {.bitmap_index = 36310, .adv_w = 102, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 16},
-    {.bitmap_index = 36326, .adv_w = 102, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 36342, .adv_w = 181, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 17},
-    {.bitmap_index = 36374, .adv_w = 181, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 16},
-    {.bitmap_index = 36410, .adv_w = 312, .box_w = 17, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36436, .adv_w = 423, .box_w = 20, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36666, .adv_w = 612, .box_w = 34, .box_h = 23, .ofs_x = 3, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_32;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_32 = {
-#else
-lv_font_t montserrat_cyrillic_32 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 35,          /*The maximum line height required by the font*/
-    .base_line = 6,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -3,
-    .underline_thickness = 2,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_32,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_32*/
@@ -1,5973 +0,0 @@
-/*******************************************************************************
- * Size: 34 px
- * Bpp: 4
- * Opts: --bpp 4 --size 34 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_34.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_34
-#define MONTSERRAT_CYRILLIC_34 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_34
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xb, 0xf4, 0xa, 0xf3, 0xa, 0xf3, 0xa, 0xf3,
-    0x9, 0xf2, 0x9, 0xf2, 0x9, 0xf2, 0x8, 0xf1,
-    0x8, 0xf1, 0x8, 0xf1, 0x7, 0xf1, 0x7, 0xf0,
-    0x7, 0xf0, 0x6, 0xf0, 0x6, 0xf0, 0x6, 0xf0,
-    0x5, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xc3, 0x1f, 0xfb, 0xb, 0xf5,
-
-    /* U+0022 "\"" */
-    0x7f, 0x10, 0x0, 0xf9, 0x7f, 0x0, 0x0, 0xf9,
-    0x7f, 0x0, 0x0, 0xe8, 0x6f, 0x0, 0x0, 0xe8,
-    0x6f, 0x0, 0x0, 0xe8, 0x6f, 0x0, 0x0, 0xe8,
-    0x6f, 0x0, 0x0, 0xe7, 0x5f, 0x0, 0x0, 0xd7,
-    0x4c, 0x0, 0x0, 0xb6,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x2,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x40,
-    0x0, 0x0, 0x4, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x20, 0x0, 0x0, 0x5, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x0, 0x0, 0x0,
-    0x7, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x0, 0x0, 0x0, 0xb, 0xa0,
-    0x0, 0x0, 0x1, 0x11, 0x11, 0xbb, 0x11, 0x11,
-    0x11, 0x1e, 0x81, 0x11, 0x10, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3, 0x44, 0x44, 0xf9, 0x44, 0x44, 0x44, 0x5f,
-    0x74, 0x44, 0x41, 0x0, 0x0, 0x1, 0xf5, 0x0,
-    0x0, 0x0, 0x3f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf3, 0x0, 0x0, 0x0, 0x5f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf0,
-    0x0, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xd0, 0x0, 0x0, 0x0, 0xba, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x0,
-    0x0, 0xd8, 0x0, 0x0, 0x0, 0x11, 0x11, 0x1d,
-    0xa1, 0x11, 0x11, 0x11, 0xf7, 0x11, 0x11, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x44, 0x44, 0x5f, 0x84, 0x44,
-    0x44, 0x46, 0xf6, 0x44, 0x44, 0x10, 0x0, 0x0,
-    0x2f, 0x30, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x7,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x0,
-    0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xab, 0x0, 0x0, 0x0,
-    0xc, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc9,
-    0x0, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad,
-    0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0, 0x3, 0xdf,
-    0xfb, 0xaf, 0x9a, 0xdf, 0xfb, 0x30, 0x0, 0x3f,
-    0xf7, 0x0, 0x2f, 0x10, 0x2, 0x8f, 0xc0, 0x0,
-    0xef, 0x30, 0x0, 0x2f, 0x10, 0x0, 0x1, 0x30,
-    0x5, 0xf8, 0x0, 0x0, 0x2f, 0x10, 0x0, 0x0,
-    0x0, 0x8, 0xf3, 0x0, 0x0, 0x2f, 0x10, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x2f, 0x10,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x2f,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x2f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc2,
-    0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xa5, 0x3f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3a, 0xff, 0xff, 0x94, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0xaf, 0xff, 0xfb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x25, 0xaf,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x10,
-    0x1, 0x9f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x10, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x10, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x10, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x10, 0x0, 0x0, 0xde, 0x3,
-    0x0, 0x0, 0x0, 0x2f, 0x10, 0x0, 0x2, 0xfa,
-    0x1f, 0xa1, 0x0, 0x0, 0x2f, 0x10, 0x0, 0xc,
-    0xf3, 0x7, 0xff, 0x92, 0x0, 0x2f, 0x10, 0x4,
-    0xdf, 0x80, 0x0, 0x3b, 0xff, 0xeb, 0xaf, 0xab,
-    0xef, 0xe6, 0x0, 0x0, 0x0, 0x27, 0xbd, 0xff,
-    0xfd, 0xb6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x7, 0xdf, 0xea, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0xbd, 0x40,
-    0x17, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb0,
-    0x0, 0x0, 0x7, 0xd1, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x0, 0x0, 0x6f, 0x10, 0x0, 0x0, 0xe,
-    0x50, 0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x7, 0xc0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0,
-    0x0, 0x6e, 0x0, 0x0, 0x0, 0x4, 0xf0, 0x0,
-    0x0, 0x7e, 0x10, 0x0, 0x0, 0x0, 0x7d, 0x0,
-    0x0, 0x0, 0x4, 0xf0, 0x0, 0x2, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0x0, 0x0, 0x0, 0x4,
-    0xf0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x7e,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0xc, 0x90, 0x2, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xd0, 0x0, 0x0, 0x5f, 0x20,
-    0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x30, 0x16, 0xf6, 0x0, 0x8e, 0x10, 0x4,
-    0xbf, 0xfc, 0x50, 0x0, 0x0, 0x19, 0xff, 0xfd,
-    0x50, 0x3, 0xf4, 0x0, 0x8f, 0x73, 0x38, 0xf8,
-    0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0xd, 0x90,
-    0x4, 0xf3, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0x0, 0xc, 0x90, 0x0,
-    0x0, 0xa, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x4, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x3f,
-    0x10, 0x0, 0x0, 0x1, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xf3, 0x0,
-    0x0, 0x3f, 0x10, 0x0, 0x0, 0x1, 0xf3, 0x0,
-    0x0, 0x0, 0xe, 0x80, 0x0, 0x0, 0x1f, 0x30,
-    0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x0, 0x9d,
-    0x0, 0x0, 0x0, 0xc, 0x80, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x0,
-    0x4, 0xf2, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x0,
-    0x1e, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x51,
-    0x15, 0xe8, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xcf, 0xfc, 0x50, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x5b, 0xef, 0xeb, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb6, 0x56,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x50, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
-    0xc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70,
-    0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe2,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xd5, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xdf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0x70, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xed, 0x30, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x6, 0x10, 0x1, 0xed, 0x10, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0x3, 0xf4, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x8f, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x70,
-    0xd, 0xb0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x64, 0xf5, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xed, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xef, 0x40, 0x0, 0x1d, 0xf7, 0x0,
-    0x0, 0x0, 0x3, 0xcf, 0x81, 0xdf, 0x30, 0x0,
-    0x1b, 0xff, 0xa8, 0x77, 0x9d, 0xfd, 0x40, 0x1,
-    0xdf, 0x30, 0x0, 0x3, 0x9d, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x1, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
-
-    /* U+0027 "'" */
-    0x7f, 0x17, 0xf0, 0x7f, 0x6, 0xf0, 0x6f, 0x6,
-    0xf0, 0x6f, 0x5, 0xf0, 0x4c, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x9f, 0x10, 0x0, 0x2f, 0x80, 0x0,
-    0xa, 0xf1, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x6f,
-    0x30, 0x0, 0xb, 0xe0, 0x0, 0x0, 0xf9, 0x0,
-    0x0, 0x4f, 0x50, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0xaf, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0xfb,
-    0x0, 0x0, 0xf, 0x90, 0x0, 0x1, 0xf8, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x2f, 0x70, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0xf9, 0x0, 0x0, 0xe, 0xb0,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0xa, 0xf0, 0x0,
-    0x0, 0x7f, 0x20, 0x0, 0x4, 0xf5, 0x0, 0x0,
-    0xf, 0x90, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x6,
-    0xf3, 0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x9f,
-    0x10, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x9, 0xf1,
-
-    /* U+0029 ")" */
-    0x2f, 0x80, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0xfa, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x7f, 0x30, 0x0, 0x4, 0xf6, 0x0,
-    0x0, 0x1f, 0x90, 0x0, 0x0, 0xec, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x9, 0xf1, 0x0,
-    0x0, 0xaf, 0x10, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0xce, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x4f, 0x60, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x9, 0xf1, 0x0, 0x2, 0xf8, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x4, 0x0, 0x3, 0xf0,
-    0x0, 0x13, 0xe, 0xe5, 0x3, 0xf0, 0x7, 0xfa,
-    0x0, 0x7f, 0xc6, 0xf5, 0xde, 0x50, 0x0, 0x1,
-    0xaf, 0xff, 0x70, 0x0, 0x0, 0x1, 0x9f, 0xfe,
-    0x60, 0x0, 0x0, 0x6e, 0xd7, 0xf6, 0xed, 0x40,
-    0xd, 0xe6, 0x3, 0xf0, 0x8, 0xfa, 0x5, 0x10,
-    0x3, 0xf0, 0x0, 0x24, 0x0, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x1a, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x12, 0x22, 0x22,
-    0x3f, 0x82, 0x22, 0x22, 0x28, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x25, 0x55, 0x55, 0x6f,
-    0xa5, 0x55, 0x55, 0x40, 0x0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x50, 0x0, 0x0,
-    0x0,
-
-    /* U+002C "," */
-    0x7, 0xd5, 0xf, 0xfc, 0x9, 0xfb, 0x0, 0xf6,
-    0x4, 0xf2, 0x7, 0xe0, 0xb, 0x90, 0xe, 0x50,
-
-    /* U+002D "-" */
-    0x78, 0x88, 0x88, 0x88, 0x7e, 0xff, 0xff, 0xff,
-    0xfd,
-
-    /* U+002E "." */
-    0x8, 0xe5, 0xf, 0xfc, 0x9, 0xf6,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xca, 0x9b,
-    0xff, 0xd3, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xa2,
-    0x0, 0x0, 0x6, 0xff, 0x40, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf2, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x40, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x6f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf2, 0x0, 0x0, 0x1, 0xcf, 0xa2, 0x0, 0x0,
-    0x6, 0xff, 0x40, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xda, 0x9b, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x39, 0xdf, 0xfe, 0xb5, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xbf, 0xff, 0xff, 0xfd, 0x69, 0x99, 0x99, 0xfd,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xed,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x49, 0xce, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x4d, 0xff, 0xda, 0x99, 0xbf, 0xfe,
-    0x40, 0x0, 0x7, 0xfe, 0x71, 0x0, 0x0, 0x0,
-    0x6e, 0xf4, 0x0, 0xd, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xa9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0033 "3" */
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x6, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x55,
-    0x7b, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x30, 0xb, 0xfe, 0x71,
-    0x0, 0x0, 0x0, 0x5e, 0xf8, 0x0, 0x0, 0x6d,
-    0xff, 0xdb, 0xaa, 0xbe, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x49, 0xce, 0xff, 0xeb, 0x71, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0,
-    0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0, 0x8,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x1, 0xde, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb4, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x8f, 0xe8, 0x88, 0x86, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xb0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x6, 0xfa, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x30, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe, 0xda,
-    0x72, 0x0, 0x0, 0x0, 0x49, 0x99, 0x99, 0x9a,
-    0xcf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0xd, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x6, 0xff, 0x93,
-    0x0, 0x0, 0x0, 0x29, 0xfd, 0x10, 0x0, 0x2b,
-    0xff, 0xeb, 0xa9, 0xad, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x27, 0xbe, 0xff, 0xfc, 0x93, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0xfe, 0xb9, 0x89,
-    0xbe, 0xfa, 0x0, 0x0, 0x0, 0x9f, 0xd5, 0x0,
-    0x0, 0x0, 0x4, 0x20, 0x0, 0x0, 0x9f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x15, 0x77, 0x74, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x1, 0xf9, 0x5, 0xfd, 0x72, 0x0, 0x14, 0xaf,
-    0xe3, 0x0, 0x1f, 0xa3, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x1, 0xfb, 0xca, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0xf, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0xdf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0xa, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x50, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf4, 0x1, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x8, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0xe,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x2e, 0xf6, 0x0, 0x0, 0x0, 0x2c, 0xf9,
-    0x0, 0x0, 0x0, 0x2c, 0xfe, 0xb8, 0x89, 0xcf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff,
-    0xec, 0x81, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xdf, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x9f, 0xf1, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0xdd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0xdd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x22, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xfe, 0xb6, 0x10,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xb9, 0x88, 0xad,
-    0xff, 0x70, 0x0, 0x0, 0x2e, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0x90, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xd0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xb0, 0x0, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x4, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x4, 0xee, 0x83, 0x10, 0x2, 0x5b, 0xf9, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x96, 0x43, 0x35,
-    0x7c, 0xfd, 0x30, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0x40, 0x8, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x10, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xa0, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0,
-    0xa, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x18, 0xfe,
-    0x30, 0x0, 0x7, 0xff, 0xea, 0x88, 0x89, 0xcf,
-    0xfb, 0x20, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff,
-    0xec, 0x83, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x5a, 0xef, 0xfe, 0xb7, 0x10, 0x0,
-    0x0, 0x0, 0x3d, 0xfe, 0xa8, 0x89, 0xcf, 0xf6,
-    0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x2,
-    0xbf, 0x90, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf6, 0x0, 0x6f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x10, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf5, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcd, 0xf7, 0x1e, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0xf8, 0x4, 0xff, 0x60, 0x0, 0x0,
-    0x2, 0xaf, 0x52, 0xf9, 0x0, 0x4e, 0xfe, 0xa8,
-    0x89, 0xcf, 0xe4, 0x2, 0xf9, 0x0, 0x0, 0x6b,
-    0xef, 0xfe, 0xb6, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x61, 0x0,
-    0x0, 0x0, 0x2a, 0xfe, 0x30, 0x0, 0x3, 0xff,
-    0xca, 0x99, 0xad, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x39, 0xce, 0xff, 0xec, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x9, 0xf6, 0xf, 0xfc, 0x8, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe5,
-    0xf, 0xfc, 0x9, 0xf6,
-
-    /* U+003B ";" */
-    0x9, 0xf6, 0xf, 0xfc, 0x8, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xd5,
-    0xf, 0xfc, 0x9, 0xfb, 0x0, 0xf6, 0x4, 0xf2,
-    0x7, 0xe0, 0xb, 0x90, 0xe, 0x50,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xef, 0xd6, 0x0, 0x0,
-    0x0, 0x4, 0xbf, 0xfa, 0x30, 0x0, 0x0, 0x1,
-    0x7d, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xf9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xc6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xff,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8e,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38,
-
-    /* U+003D "=" */
-    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x18,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x25,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x18, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x25, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x40,
-
-    /* U+003E ">" */
-    0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xef, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4b, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x8e, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xbf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xdf, 0xd6, 0x0, 0x0, 0x0, 0x3, 0xaf,
-    0xfa, 0x30, 0x0, 0x0, 0x1, 0x7d, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x3a, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xe8, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xea, 0x60, 0x0,
-    0x0, 0x5, 0xef, 0xeb, 0x98, 0x9b, 0xff, 0xe4,
-    0x0, 0x9, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x7f,
-    0xf4, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xe2, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xef,
-    0xff, 0xec, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xfc, 0x96,
-    0x54, 0x56, 0x8b, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5b, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xde, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x30, 0x0, 0x0, 0x0, 0xc, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x29, 0xdf, 0xfe, 0xb5, 0x0, 0x9, 0xf0,
-    0x0, 0xcd, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0,
-    0x0, 0x9f, 0xe8, 0x55, 0x69, 0xfd, 0x20, 0x9f,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0xad, 0x0, 0x0,
-    0x0, 0xcf, 0x70, 0x0, 0x0, 0x1, 0x9e, 0x29,
-    0xf0, 0x0, 0x8, 0xe0, 0x0, 0x1f, 0x60, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0xaf, 0x0, 0x0, 0x1f, 0x50, 0x7, 0xf0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf0, 0x0, 0x0, 0xba, 0x0, 0xbb, 0x0,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x7, 0xe0, 0xe, 0x80,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x4f, 0x10, 0xf6,
-    0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x0, 0x0, 0x2, 0xf3, 0x1f,
-    0x40, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x1f, 0x32,
-    0xf4, 0x0, 0x0, 0x4f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x1, 0xf3,
-    0x1f, 0x40, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x2f,
-    0x30, 0xf6, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x3,
-    0xf1, 0xe, 0x80, 0x0, 0x0, 0xaf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0,
-    0x6e, 0x0, 0xac, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0,
-    0xa, 0xb0, 0x6, 0xf1, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xd9, 0xf0, 0x0,
-    0x1, 0xf5, 0x0, 0x1f, 0x60, 0x0, 0x0, 0xb,
-    0xf9, 0x10, 0x0, 0x0, 0x2b, 0xe2, 0x6f, 0x50,
-    0x0, 0xad, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xa7, 0x68, 0xbf, 0xd2, 0x0, 0xef,
-    0x87, 0xcf, 0x30, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xff, 0xeb, 0x50, 0x0, 0x2,
-    0xbf, 0xfb, 0x20, 0x0, 0x0, 0x8, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8f, 0xfc, 0x97, 0x55, 0x68,
-    0xae, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xff,
-    0xdb, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf4, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0xd, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x50, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xee, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xee, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0xd, 0xe5, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xd0, 0x0,
-    0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x0, 0x0, 0xcf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x9f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-
-    /* U+0042 "B" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x40,
-    0x0, 0x0, 0xdf, 0x88, 0x88, 0x88, 0x88, 0x89,
-    0xcf, 0xfc, 0x20, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8f, 0xe2, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x10, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x30, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x30, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfc, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xf3, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x38, 0xee, 0x40, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0,
-    0xdf, 0x88, 0x88, 0x88, 0x88, 0x88, 0x9b, 0xff,
-    0xa1, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0x20, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xd0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x30, 0xdf, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x9b, 0xff, 0xd3, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xec,
-    0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
-    0xeb, 0xa9, 0xac, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x16, 0xdf,
-    0xb1, 0x0, 0x0, 0xaf, 0xc2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0xaf, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x0,
-    0x0, 0x8, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x16,
-    0xdf, 0xb0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xec,
-    0xa9, 0xad, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x27, 0xbe, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x99, 0x99, 0x99,
-    0x99, 0xbe, 0xff, 0xc4, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8f, 0xfa,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xfc, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x2d, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf3, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x3d, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf7, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xc0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xff, 0xa0, 0x0, 0x0, 0xdf, 0x99, 0x99,
-    0x99, 0x99, 0x9b, 0xef, 0xfc, 0x40, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x83,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1d, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x90, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xdf, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0xd, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x5d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0046 "F" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1d, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x90, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xd, 0xf9,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0xeb, 0xa9, 0xac, 0xff, 0xf9, 0x10, 0x0, 0x0,
-    0x7, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xe3, 0x0, 0x0, 0xaf, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0xf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0xa, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x4f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xaf, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0,
-    0x0, 0x8, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0xe3, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xfc,
-    0xa9, 0xac, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x27, 0xbe, 0xff, 0xfd, 0xa6, 0x10, 0x0,
-
-    /* U+0048 "H" */
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xdf, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x8a, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-
-    /* U+0049 "I" */
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-
-    /* U+004A "J" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x6, 0x99, 0x99, 0x99, 0x99, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x2, 0x20, 0x0,
-    0x0, 0x0, 0x5, 0xf7, 0xd, 0xd1, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0x5, 0xfd, 0x40, 0x0, 0x0,
-    0xaf, 0xa0, 0x0, 0x4e, 0xfd, 0xa9, 0xbf, 0xfb,
-    0x0, 0x0, 0x1, 0x7c, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+004B "K" */
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x6f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x5, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x5f, 0xd9, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x4, 0xfd, 0x10, 0xaf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x4f, 0xd1, 0x0,
-    0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfe,
-    0x20, 0x0, 0x1, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0xdf, 0xe2, 0x0, 0x0, 0x0, 0x2e, 0xf3, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x10, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf3,
-
-    /* U+004C "L" */
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+004D "M" */
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x5d, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf5, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x5d, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0xf5, 0xdd, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x7f, 0x5d, 0xd1,
-    0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x76, 0xf5, 0xdd, 0x6, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x6f, 0x5d,
-    0xd0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf4, 0x6, 0xf5, 0xdd, 0x0, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x5f,
-    0x5d, 0xd0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x20, 0x5, 0xf5, 0xdd, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x5f, 0x5d, 0xd0, 0x0, 0x8, 0xf3, 0x0, 0x0,
-    0x0, 0xb, 0xe1, 0x0, 0x5, 0xf5, 0xdd, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0x0, 0x5f, 0x5d, 0xd0, 0x0, 0x0, 0x6f, 0x50,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0x5, 0xf5, 0xdd,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x0, 0x5f, 0x5d, 0xd0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x5, 0xf5,
-    0xdd, 0x0, 0x0, 0x0, 0xa, 0xf1, 0x8, 0xf2,
-    0x0, 0x0, 0x0, 0x5f, 0x5d, 0xd0, 0x0, 0x0,
-    0x0, 0x2f, 0xa2, 0xf8, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xde,
-    0x10, 0x0, 0x0, 0x0, 0x5f, 0x5d, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x5, 0xf5, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x5d, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf5, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x5d,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf5,
-
-    /* U+004E "N" */
-    0xde, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xdf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xde, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0xde, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xde, 0x4, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x8f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xde, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0xde, 0x0, 0x1, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0xde, 0x0, 0x0, 0x3f, 0xe1, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x3, 0xf8,
-    0xde, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0,
-    0x3, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x20, 0x0, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd0, 0x0, 0x3, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfa, 0x0, 0x3, 0xf8,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x3, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf3, 0x3, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x13, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb3, 0xf8,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfb, 0xf8, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf8, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xfd,
-    0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xff, 0xeb, 0xa9, 0xad, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x93, 0x0,
-    0x0, 0x0, 0x16, 0xdf, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x30, 0x0, 0x0, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe2,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x4, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf6, 0xf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0xf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe2, 0x0, 0x0, 0x0, 0xaf, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xa3, 0x0, 0x0,
-    0x0, 0x16, 0xdf, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3b, 0xff, 0xeb, 0xa9, 0xad, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xbe, 0xff, 0xfd, 0x95, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x82, 0x0,
-    0x0, 0xd, 0xf9, 0x99, 0x99, 0x99, 0x9b, 0xdf,
-    0xfb, 0x10, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x29, 0xfe, 0x20, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x2d, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf3, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x3d, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x80, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe1, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x9f, 0xe2, 0x0, 0xdf, 0x99, 0x99,
-    0x99, 0x99, 0xbd, 0xff, 0xb1, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xb8, 0x20, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xfd,
-    0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xfe, 0xba, 0x9a, 0xdf, 0xfe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x93,
-    0x0, 0x0, 0x0, 0x16, 0xdf, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xe3, 0x0, 0x0, 0x0, 0x9,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe2, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0xa, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf2, 0x0, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0xf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x1, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0xaf, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfa,
-    0x30, 0x0, 0x0, 0x1, 0x6d, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xeb, 0xa9,
-    0xad, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x7b, 0xef, 0xff, 0xe9, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x60, 0x0, 0x0, 0x3, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xc6, 0x22, 0x5a, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x44, 0x30, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x82, 0x0,
-    0x0, 0xd, 0xf9, 0x99, 0x99, 0x99, 0x9b, 0xdf,
-    0xfb, 0x10, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x29, 0xfe, 0x30, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x2d, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf3, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x3d, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x80, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd1, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xe2, 0x0, 0xdf, 0x88, 0x88,
-    0x88, 0x89, 0xad, 0xff, 0xa1, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xfe, 0x20, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf2, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfe, 0xb7, 0x20,
-    0x0, 0x0, 0x3, 0xdf, 0xfb, 0x98, 0x9a, 0xdf,
-    0xfb, 0x30, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0,
-    0x2, 0x8f, 0xc0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x30, 0x5, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xa5, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xfc,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0x9d, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0xaf, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x1f, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x7, 0xff, 0x92,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0x80, 0x0, 0x3b,
-    0xff, 0xeb, 0x98, 0x9b, 0xef, 0xe6, 0x0, 0x0,
-    0x0, 0x27, 0xbd, 0xff, 0xfd, 0xb6, 0x10, 0x0,
-
-    /* U+0054 "T" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x99, 0x99, 0x99, 0x9b, 0xfc, 0x99,
-    0x99, 0x99, 0x99, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x1, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x90, 0x4, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0x0, 0x0, 0x4f, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0x30, 0x0, 0x0, 0x6f, 0xf7,
-    0x10, 0x0, 0x0, 0x17, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x4d, 0xff, 0xca, 0x9a, 0xcf, 0xfd, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd,
-    0xa5, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x10, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x0, 0x0, 0x5f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfd, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0xd, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xb0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xc2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0xc, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x5e, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x2, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x9f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x40, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xc0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xe0, 0x0, 0x9f, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0x8f, 0x20, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x9f,
-    0x10, 0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0,
-    0x6f, 0x30, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x8f, 0x20,
-    0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x60, 0x0, 0x7f, 0x30, 0x0, 0x0,
-    0x0, 0xd, 0xd0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0xc, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x30, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0xaf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60,
-    0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x35, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf4, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0xaf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xef, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x20, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xd0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0xbf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x56, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x6b, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x1,
-    0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xe1, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x7, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0,
-    0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf4, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xee, 0x10, 0x1e, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0,
-
-    /* U+0059 "Y" */
-    0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xc0, 0xe, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x50, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xa0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0,
-    0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x70, 0x0, 0x2f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0xbf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x5e, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+005B "[" */
-    0xdf, 0xff, 0xfa, 0xde, 0x77, 0x74, 0xdd, 0x0,
-    0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0xde, 0x77, 0x74, 0xdf, 0xff, 0xfa,
-
-    /* U+005C "\\" */
-    0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7,
-
-    /* U+005D "]" */
-    0x3f, 0xff, 0xff, 0x41, 0x77, 0x7b, 0xf4, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x7f, 0x40, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x7f,
-    0x40, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x7, 0xf4, 0x0, 0x0, 0x7f, 0x40, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x7,
-    0xf4, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x7f, 0x40, 0x0, 0x7, 0xf4, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x7f, 0x40, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x7f,
-    0x40, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x7, 0xf4, 0x0, 0x0, 0x7f, 0x40, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x7,
-    0xf4, 0x17, 0x77, 0xbf, 0x43, 0xff, 0xff, 0xf4,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x3d, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8d,
-    0x6, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe6, 0x1,
-    0xf5, 0x0, 0x0, 0x0, 0x5, 0xf0, 0x0, 0x9c,
-    0x0, 0x0, 0x0, 0xc, 0x90, 0x0, 0x3f, 0x30,
-    0x0, 0x0, 0x3f, 0x30, 0x0, 0xc, 0xa0, 0x0,
-    0x0, 0xac, 0x0, 0x0, 0x6, 0xf1, 0x0, 0x1,
-    0xf5, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x9d, 0x0, 0xe, 0x80, 0x0,
-    0x0, 0x0, 0x2f, 0x40, 0x4f, 0x20, 0x0, 0x0,
-    0x0, 0xc, 0xb0, 0xbb, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf2,
-
-    /* U+005F "_" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x30,
-
-    /* U+0060 "`" */
-    0x6, 0xfd, 0x20, 0x0, 0x0, 0x2, 0xde, 0x40,
-    0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0,
-    0x6f, 0x80,
-
-    /* U+0061 "a" */
-    0x0, 0x3, 0x9c, 0xff, 0xfd, 0x92, 0x0, 0x0,
-    0x3c, 0xff, 0xb9, 0x89, 0xcf, 0xf7, 0x0, 0x4f,
-    0xd5, 0x0, 0x0, 0x0, 0x3d, 0xf5, 0x0, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x0,
-    0x11, 0x11, 0x15, 0xf6, 0x0, 0x3a, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x8f, 0xd7, 0x54, 0x44,
-    0x44, 0x47, 0xf6, 0x5f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x6c, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x64, 0xfb, 0x10, 0x0, 0x0, 0x6, 0xf7, 0xf6,
-    0x6, 0xfe, 0x85, 0x45, 0x7d, 0xe4, 0x3f, 0x60,
-    0x2, 0x8d, 0xff, 0xfc, 0x71, 0x3, 0xf6,
-
-    /* U+0062 "b" */
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x17, 0xce, 0xff,
-    0xc8, 0x20, 0x0, 0x0, 0x6f, 0x40, 0x5f, 0xfc,
-    0x99, 0xad, 0xff, 0x80, 0x0, 0x6, 0xf4, 0x7f,
-    0xa2, 0x0, 0x0, 0x3, 0xbf, 0xb0, 0x0, 0x6f,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x30, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x26, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x46, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x6, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x6f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x6,
-    0xf8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9,
-    0x0, 0x6f, 0x37, 0xfa, 0x20, 0x0, 0x0, 0x3b,
-    0xfb, 0x0, 0x6, 0xf3, 0x6, 0xff, 0xc9, 0x9a,
-    0xdf, 0xf8, 0x0, 0x0, 0x6f, 0x30, 0x1, 0x7c,
-    0xff, 0xfc, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x1, 0x8c, 0xef, 0xfd, 0x92, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xda, 0x99, 0xcf, 0xf9,
-    0x0, 0x0, 0xb, 0xfb, 0x30, 0x0, 0x0, 0x1a,
-    0xfb, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xd2, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x20,
-    0x0, 0xbf, 0xb3, 0x0, 0x0, 0x1, 0xaf, 0xb0,
-    0x0, 0x0, 0x7f, 0xfd, 0xa9, 0x9c, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x17, 0xce, 0xff, 0xd9, 0x20,
-    0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x28, 0xcf, 0xfe,
-    0xc7, 0x10, 0x5, 0xf6, 0x0, 0x0, 0x8f, 0xfd,
-    0xa9, 0x9c, 0xfe, 0x50, 0x5f, 0x60, 0x0, 0xbf,
-    0xb2, 0x0, 0x0, 0x2, 0xaf, 0x65, 0xf6, 0x0,
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x8f,
-    0x60, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf6, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x60, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf6, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x65, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x63, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x60, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6, 0x4, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0xf6, 0x0, 0xb, 0xfb, 0x20, 0x0, 0x0, 0x2a,
-    0xf7, 0x4f, 0x60, 0x0, 0x8, 0xff, 0xda, 0x99,
-    0xcf, 0xf5, 0x4, 0xf6, 0x0, 0x0, 0x2, 0x8c,
-    0xff, 0xec, 0x71, 0x0, 0x4f, 0x60,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfb, 0x88, 0xae, 0xfd,
-    0x30, 0x0, 0x0, 0x1c, 0xf8, 0x10, 0x0, 0x0,
-    0x5e, 0xf4, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x10, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xa0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x5f, 0x83, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x32, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x2c, 0x10, 0x0,
-    0xa, 0xfc, 0x30, 0x0, 0x0, 0x6, 0xef, 0x20,
-    0x0, 0x0, 0x7f, 0xfd, 0xa9, 0x9b, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x1, 0x7c, 0xef, 0xfd, 0xa4,
-    0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0xc6, 0x0, 0x0,
-    0x1, 0xdf, 0xb8, 0x8b, 0xf2, 0x0, 0x0, 0x9f,
-    0x60, 0x0, 0x2, 0x0, 0x0, 0xe, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x27, 0x78, 0xfd, 0x77,
-    0x77, 0x72, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x2, 0x8c, 0xff, 0xfc, 0x82, 0x0,
-    0xf, 0x90, 0x0, 0x8, 0xff, 0xb7, 0x67, 0x9e,
-    0xf8, 0x0, 0xf9, 0x0, 0xc, 0xf9, 0x10, 0x0,
-    0x0, 0x6, 0xfa, 0xf, 0x90, 0xa, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xe8, 0xf9, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x94, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x94, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x90, 0x1e, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0xf9, 0x0, 0x4f, 0xe3,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0x4f, 0x90, 0x0,
-    0x5f, 0xfa, 0x41, 0x0, 0x38, 0xee, 0x41, 0xf9,
-    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xfa, 0x10,
-    0x1f, 0x90, 0x0, 0x0, 0x1, 0x57, 0x87, 0x51,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0,
-    0xa, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x60, 0x0, 0xbf, 0xe6, 0x10, 0x0, 0x0, 0x2,
-    0xaf, 0xb0, 0x0, 0x0, 0x5d, 0xff, 0xca, 0x88,
-    0xad, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x39, 0xdf,
-    0xfe, 0xb6, 0x0, 0x0, 0x6f, 0x40, 0xaf, 0xeb,
-    0x99, 0xbf, 0xfd, 0x20, 0x6, 0xf5, 0xbe, 0x60,
-    0x0, 0x0, 0x8, 0xfe, 0x10, 0x6f, 0xce, 0x20,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x6, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x6f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x46, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x6f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x76,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x76, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x76, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x76, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x76, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x70,
-
-    /* U+0069 "i" */
-    0x8f, 0x7e, 0xfc, 0x5b, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x6f, 0x46, 0xf4, 0x6f,
-    0x46, 0xf4, 0x6f, 0x46, 0xf4, 0x6f, 0x46, 0xf4,
-    0x6f, 0x46, 0xf4, 0x6f, 0x46, 0xf4, 0x6f, 0x46,
-    0xf4, 0x6f, 0x46, 0xf4, 0x6f, 0x40,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x3b, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x7f,
-    0x40, 0x20, 0x0, 0x1, 0xee, 0x0, 0xce, 0x97,
-    0x9f, 0xf5, 0x0, 0x3a, 0xef, 0xfb, 0x30, 0x0,
-
-    /* U+006B "k" */
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0x50, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x40, 0x6, 0xf4, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0x40, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0x3, 0xef, 0x30, 0x0, 0x6, 0xf4, 0x0,
-    0x0, 0x4, 0xfe, 0x30, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x4, 0xfe, 0x20, 0x0, 0x0, 0x6, 0xf4,
-    0x0, 0x6, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x6,
-    0xf4, 0x8, 0xfc, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x6f, 0x49, 0xfa, 0x3, 0xfd, 0x10, 0x0, 0x0,
-    0x6, 0xfd, 0xf9, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0x0, 0x6f, 0xf8, 0x0, 0x0, 0xa, 0xf8, 0x0,
-    0x0, 0x6, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x2e,
-    0xe2, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x30,
-
-    /* U+006C "l" */
-    0x6f, 0x46, 0xf4, 0x6f, 0x46, 0xf4, 0x6f, 0x46,
-    0xf4, 0x6f, 0x46, 0xf4, 0x6f, 0x46, 0xf4, 0x6f,
-    0x46, 0xf4, 0x6f, 0x46, 0xf4, 0x6f, 0x46, 0xf4,
-    0x6f, 0x46, 0xf4, 0x6f, 0x46, 0xf4, 0x6f, 0x46,
-    0xf4, 0x6f, 0x46, 0xf4, 0x6f, 0x40,
-
-    /* U+006D "m" */
-    0x6f, 0x30, 0x4, 0xae, 0xff, 0xea, 0x40, 0x0,
-    0x0, 0x7, 0xbe, 0xff, 0xd8, 0x20, 0x0, 0x6f,
-    0x31, 0xbf, 0xc8, 0x67, 0x9e, 0xfa, 0x0, 0x4,
-    0xef, 0xa7, 0x67, 0xbf, 0xf6, 0x0, 0x6f, 0x4c,
-    0xd3, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x5f, 0xa1,
-    0x0, 0x0, 0x2, 0xdf, 0x50, 0x6f, 0xcd, 0x10,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xe0, 0x6f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf5, 0x6f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x6f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xec, 0x6f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xec, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xec, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xec, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xec, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-
-    /* U+006E "n" */
-    0x6f, 0x30, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x6, 0xf3, 0xa, 0xfc, 0x86, 0x68, 0xdf, 0xd2,
-    0x0, 0x6f, 0x4c, 0xd4, 0x0, 0x0, 0x0, 0x5f,
-    0xe1, 0x6, 0xfc, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x16, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf4, 0x6f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x66, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x76, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x6f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x76, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x6f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x76, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x76,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x76, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x2, 0x8c, 0xff, 0xfc, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xda, 0x99, 0xcf,
-    0xf9, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x20, 0x0,
-    0x0, 0x2a, 0xfc, 0x0, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xc0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x13, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x65, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x40, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-    0xbf, 0xb2, 0x0, 0x0, 0x2, 0xaf, 0xc0, 0x0,
-    0x0, 0x0, 0x8f, 0xfd, 0xa9, 0x9c, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xcf, 0xff, 0xc8,
-    0x20, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x6f, 0x30, 0x1, 0x7c, 0xef, 0xfc, 0x82, 0x0,
-    0x0, 0x6, 0xf3, 0x5, 0xff, 0xc9, 0x9a, 0xdf,
-    0xf8, 0x0, 0x0, 0x6f, 0x37, 0xfa, 0x20, 0x0,
-    0x0, 0x3b, 0xfb, 0x0, 0x6, 0xf8, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x6f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x6,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf2, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x46, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x26, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x6, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x30, 0x6f, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x6, 0xf4,
-    0x7f, 0xa2, 0x0, 0x0, 0x3, 0xbf, 0xb0, 0x0,
-    0x6f, 0x40, 0x6f, 0xfc, 0x99, 0xad, 0xff, 0x80,
-    0x0, 0x6, 0xf4, 0x0, 0x17, 0xcf, 0xff, 0xc8,
-    0x20, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x2, 0x8c, 0xff, 0xec, 0x71, 0x0,
-    0x4f, 0x60, 0x0, 0x8, 0xff, 0xda, 0x99, 0xcf,
-    0xf5, 0x4, 0xf6, 0x0, 0xb, 0xfb, 0x20, 0x0,
-    0x0, 0x2a, 0xf7, 0x4f, 0x60, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0xf6, 0x4, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf6, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x63, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x65, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf6, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x60, 0x4f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x8f, 0x60, 0x0,
-    0xbf, 0xb2, 0x0, 0x0, 0x2, 0xaf, 0x65, 0xf6,
-    0x0, 0x0, 0x8f, 0xfd, 0xa9, 0x9c, 0xfe, 0x50,
-    0x5f, 0x60, 0x0, 0x0, 0x28, 0xcf, 0xfe, 0xc7,
-    0x10, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-
-    /* U+0072 "r" */
-    0x6f, 0x30, 0x5, 0xbe, 0xf6, 0xf3, 0x1c, 0xfc,
-    0x98, 0x6f, 0x4d, 0xd3, 0x0, 0x6, 0xfc, 0xd1,
-    0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xc9, 0x30, 0x0,
-    0x0, 0xa, 0xfe, 0xa8, 0x89, 0xbf, 0xfd, 0x20,
-    0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x6d, 0x10,
-    0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe6, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xef, 0xfe, 0xb7, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x7a, 0xef, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x5a, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x4, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0xd, 0xf9, 0x20, 0x0, 0x0, 0x1, 0xbf, 0x60,
-    0x2, 0xbf, 0xfd, 0xa8, 0x89, 0xbf, 0xf7, 0x0,
-    0x0, 0x2, 0x8b, 0xef, 0xfe, 0xc8, 0x20, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x2, 0x77, 0x8f, 0xd7, 0x77, 0x77, 0x20, 0x0,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x30, 0x0, 0x0, 0x1e, 0xfb, 0x88, 0xcf,
-    0x30, 0x0, 0x0, 0x19, 0xef, 0xfc, 0x50,
-
-    /* U+0075 "u" */
-    0x9f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x29, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x9f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x29, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x9f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x29, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf2, 0x9f, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x29, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x9f, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x29, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf2, 0x9f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x28, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x6f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x22, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xbf, 0x20,
-    0x2f, 0xf6, 0x0, 0x0, 0x0, 0x7f, 0x97, 0xf2,
-    0x0, 0x3e, 0xfe, 0xa9, 0x9b, 0xff, 0x80, 0x7f,
-    0x20, 0x0, 0x6, 0xbe, 0xff, 0xd9, 0x20, 0x7,
-    0xf2,
-
-    /* U+0076 "v" */
-    0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf2, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xb0, 0x5, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x40, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x7f, 0x50,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0,
-    0x8, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0x10,
-    0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x8,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0xe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xed, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x44, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xbc, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x7f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc1, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xdf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x10, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0x6, 0xf3, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xa0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xcd, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x4, 0xf4,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0x70,
-    0x2f, 0x70, 0x0, 0x0, 0x0, 0xae, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x8, 0xf1, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x6, 0xf3, 0x0,
-    0x0, 0x6, 0xf2, 0x0, 0x0, 0x7, 0xf1, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0xf, 0x90, 0x0, 0x0,
-    0xcc, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x0, 0xa,
-    0xe0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0x0, 0x0, 0xbd, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0x3, 0xf5, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x5, 0xf3, 0x0, 0x6f, 0x20, 0x0, 0x0,
-    0xd, 0xb0, 0x0, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x90, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x7f,
-    0x10, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9e,
-    0x2, 0xf5, 0x0, 0x0, 0x0, 0x1, 0xf7, 0xa,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf4, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xd0, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xae, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x10, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x1d, 0xe1, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x2f,
-    0xb0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0xd,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x26,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x7c, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x1e, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xd0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8,
-
-    /* U+0079 "y" */
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0xcf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0,
-    0x0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0xbe, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x7f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0xe, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x5,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf5, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xca, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x56, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfd, 0x88, 0xbf, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xfd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x7f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x48,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x7d, 0xff, 0x10, 0x0, 0x8f, 0xd8,
-    0x70, 0x0, 0xf, 0xe1, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x22,
-    0xaf, 0x40, 0x0, 0xe, 0xff, 0x90, 0x0, 0x0,
-    0x45, 0xdf, 0x30, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0xee, 0x10, 0x0, 0x0,
-    0x7, 0xfd, 0x87, 0x0, 0x0, 0x6, 0xdf, 0xf1,
-
-    /* U+007C "|" */
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-    0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-
-    /* U+007D "}" */
-    0x3f, 0xfc, 0x50, 0x0, 0x1, 0x78, 0xef, 0x60,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0,
-    0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0x10,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x9f,
-    0x10, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x6f, 0x92, 0x10, 0x0, 0x0, 0xbf, 0xfc,
-    0x0, 0x0, 0x4f, 0xc5, 0x40, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0,
-    0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0x10,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x9f,
-    0x10, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x17,
-    0x8e, 0xf5, 0x0, 0x3, 0xff, 0xc5, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0xaf, 0xfd, 0x50, 0x0, 0x0, 0x2, 0xf1,
-    0xb, 0xe6, 0x49, 0xf7, 0x0, 0x0, 0x4, 0xf0,
-    0x4f, 0x20, 0x0, 0x6f, 0x70, 0x0, 0xb, 0xa0,
-    0x9b, 0x0, 0x0, 0x6, 0xf9, 0x22, 0x8f, 0x30,
-    0xb7, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xf5, 0x0,
-    0x31, 0x0, 0x0, 0x0, 0x0, 0x33, 0x0, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x7, 0xc2, 0x0, 0xb, 0xa0, 0x0,
-    0x0, 0x4f, 0x60, 0x0, 0x9f, 0x20, 0x0, 0x1,
-    0xea, 0x0, 0x5, 0xf5, 0x0, 0x0, 0xc, 0xd0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0xdc, 0x0, 0x0, 0x5, 0xf6, 0x0, 0xa, 0xe2,
-    0x0, 0x0, 0xf, 0xb0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x8, 0xf3, 0x0, 0xc, 0xd0, 0x0, 0x0,
-    0x0, 0xbe, 0x10, 0x1, 0xea, 0x0, 0x0, 0x0,
-    0x1e, 0xb0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0xbe, 0x10, 0x0, 0x0, 0xa, 0xe2,
-    0x0, 0x1e, 0xb0,
-
-    /* U+00BB "»" */
-    0x3d, 0x40, 0x0, 0x8c, 0x10, 0x0, 0x0, 0x9e,
-    0x20, 0x0, 0xdb, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x5, 0xf5, 0x0, 0xa, 0xe1,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0xd, 0xc0, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x3f, 0x70, 0x0, 0x6,
-    0xf4, 0x0, 0xb, 0xe1, 0x0, 0x3, 0xf8, 0x0,
-    0x7, 0xf3, 0x0, 0x1, 0xdb, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0xbe, 0x10, 0x1, 0xea, 0x0, 0x0,
-    0x7f, 0x30, 0x0, 0xcd, 0x0, 0x0, 0x3f, 0x60,
-    0x0, 0x8f, 0x20, 0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x6, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3b, 0xf9, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x91, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0xbf, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x60, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x6b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x26, 0x0, 0x0, 0x36, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0xbe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3b, 0xf9, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x91, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0xbf, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x60, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x6b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0402 "Ђ" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x5, 0x99, 0x99,
-    0x99, 0x99, 0xfe, 0x99, 0x99, 0x99, 0x99, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0,
-    0x0, 0x13, 0x45, 0x41, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x5a, 0xef, 0xff,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0xff, 0xea, 0x74, 0x33, 0x58, 0xdf,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0,
-    0x0, 0xa8, 0x77, 0x9e, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xfe, 0xc8,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xeb,
-    0x99, 0xbd, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x6f,
-    0xfa, 0x30, 0x0, 0x0, 0x1, 0x7e, 0xfa, 0x0,
-    0x0, 0x8f, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x6f, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x0, 0x1f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x21, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xb, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x20, 0x0, 0x8, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x50, 0x0, 0x7, 0xff,
-    0xa3, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xb0, 0x0,
-    0x0, 0x2, 0xbf, 0xfe, 0xba, 0xab, 0xdf, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff,
-    0xec, 0x94, 0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x3, 0x9c, 0xef, 0xfe, 0xc8, 0x30,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xca, 0x88, 0xad,
-    0xff, 0xd4, 0x0, 0x0, 0x1e, 0xf9, 0x10, 0x0,
-    0x0, 0x1, 0x7e, 0xf0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x2, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x9f, 0xff, 0xd9, 0x51, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xff,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x49, 0xef, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x10, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0xd, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0,
-    0x5f, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x3b, 0xfb,
-    0x0, 0x0, 0x19, 0xff, 0xeb, 0x98, 0x9a, 0xdf,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff,
-    0xeb, 0x72, 0x0, 0x0,
-
-    /* U+0406 "І" */
-    0xbf, 0xb, 0xf0, 0xbf, 0xb, 0xf0, 0xbf, 0xb,
-    0xf0, 0xbf, 0xb, 0xf0, 0xbf, 0xb, 0xf0, 0xbf,
-    0xb, 0xf0, 0xbf, 0xb, 0xf0, 0xbf, 0xb, 0xf0,
-    0xbf, 0xb, 0xf0, 0xbf, 0xb, 0xf0, 0xbf, 0xb,
-    0xf0, 0xbf, 0xb, 0xf0,
-
-    /* U+0407 "Ї" */
-    0x4, 0x50, 0x0, 0x5, 0x40, 0x1f, 0xf3, 0x0,
-    0x3f, 0xf2, 0xc, 0xe1, 0x0, 0x1d, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x8, 0x99, 0x99, 0x99, 0x9a, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x3, 0x10, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0xe, 0xb0, 0x0, 0x0,
-    0x0, 0x1e, 0xf0, 0x7, 0xfc, 0x30, 0x0, 0x1,
-    0xcf, 0x70, 0x0, 0x6f, 0xfd, 0xa9, 0xbf, 0xf9,
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0xeb, 0x40, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9c, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x62,
-    0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x85, 0x55,
-    0x55, 0x55, 0x57, 0x9e, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0,
-    0xd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x70, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfa, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0xfd, 0x10, 0x6b, 0xcf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xca, 0xaa, 0xaa, 0xaa, 0xbc, 0xff, 0xfa, 0x10,
-    0x8, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0x82, 0x0, 0x0,
-
-    /* U+040A "Њ" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x71, 0x0,
-    0xb, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0xef, 0xa9, 0x99, 0x99, 0x99, 0xac, 0xff,
-    0xf7, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xf8, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf3, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x9b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xeb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xcb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x1b,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0x40, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x77, 0x77, 0x77, 0x78, 0xae,
-    0xfd, 0x30, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xa5, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x7, 0x99, 0x99,
-    0x99, 0x9a, 0xfc, 0x99, 0x99, 0x99, 0x99, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x2, 0x57, 0x99, 0x75, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x83, 0x9e, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xb7, 0x31, 0x0, 0x26, 0xdf,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x20, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xd1,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf3, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x2, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0xce, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x99, 0x99, 0x9a, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x1d, 0xf3, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd1,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x20,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf7,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xce, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xd0, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x20, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0x0, 0x0, 0x1d, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0, 0x7, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0x1, 0xee, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0xc, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x1f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb3, 0x0, 0x29, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
-    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x10, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0xdf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x4,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xa0, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x1f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf3, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0xae, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x3f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0xb,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xb9, 0xae, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+040F "Џ" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0xbf, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x9d, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xb0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0xe, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x60, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x1, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x0,
-    0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x28, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0x95,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaf, 0x50,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x3f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x20, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1,
-
-    /* U+0411 "Б" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xb, 0xf8, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x20, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x22,
-    0x22, 0x22, 0x21, 0x10, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x61, 0x0,
-    0xb, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x69, 0xef,
-    0xe4, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xf4, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x4b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x9b, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x7b, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xfe,
-    0x10, 0xbf, 0x77, 0x77, 0x77, 0x77, 0x79, 0xcf,
-    0xfb, 0x10, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xec, 0x83, 0x0, 0x0,
-
-    /* U+0412 "В" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0xbf, 0x77, 0x77, 0x77, 0x77, 0x89,
-    0xcf, 0xf9, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0xb0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0xbf, 0x22, 0x22, 0x22,
-    0x22, 0x23, 0x7c, 0xf8, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x0, 0x0,
-    0xbf, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7a, 0xef,
-    0x80, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfb, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2b, 0xfb, 0x0, 0xbf, 0x77, 0x77, 0x77,
-    0x77, 0x78, 0x9c, 0xff, 0x90, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xeb, 0x82, 0x0, 0x0,
-
-    /* U+0413 "Г" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x5a, 0xdf,
-    0xe9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0xfe, 0x99, 0x94, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0xaf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0xaf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0xaf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x58, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x83,
-
-    /* U+0415 "Е" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3b, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x91, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xbf, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x60, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x6b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0416 "Ж" */
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xee,
-    0x0, 0x6, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xd0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x1,
-    0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0,
-    0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xc0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x0,
-    0x1e, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0xec, 0x0, 0x0,
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe9, 0x99, 0x99, 0xfe, 0x99,
-    0x99, 0x9f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0xe, 0xc0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0xec,
-    0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x1, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x20, 0x0, 0x0, 0x0,
-    0xec, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0x0, 0x1e, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xd0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x30, 0x1, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfd, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x38, 0xbe, 0xff, 0xfd, 0x95, 0x0,
-    0x0, 0x0, 0x6, 0xdf, 0xfd, 0xb9, 0x9a, 0xcf,
-    0xfd, 0x40, 0x0, 0x7, 0xfc, 0x51, 0x0, 0x0,
-    0x0, 0x6, 0xef, 0x50, 0x0, 0x14, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xfa, 0x0, 0x0,
-    0x0, 0x8, 0x88, 0x88, 0x89, 0xcf, 0xf9, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x37, 0xee, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x8e, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x3,
-    0xef, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x29, 0xfe,
-    0x20, 0x0, 0x8f, 0xff, 0xca, 0x98, 0x9a, 0xdf,
-    0xfa, 0x10, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xff,
-    0xeb, 0x82, 0x0, 0x0,
-
-    /* U+0418 "И" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xd0, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x20, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0x0, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe1, 0x0, 0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x30, 0x0, 0x0, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0, 0x0, 0x1d,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0x1, 0xee, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x4, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x20, 0x3, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4c, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xd0, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x20, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0xfc, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0, 0xfc,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0x0, 0x0, 0x1d, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0, 0x7, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0x1, 0xee, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0xc, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0xbf, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc,
-
-    /* U+041A "К" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x20, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xd1, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x8,
-    0xf6, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x2, 0xec, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0xce, 0x10, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x99, 0x99, 0x9a, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x1d, 0xf3, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd1, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xb0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x20, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x6, 0xfa,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9c, 0xf4, 0x0,
-    0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0x7, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x40, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x40, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0xae, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0,
-    0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0,
-    0xd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf4, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x40, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x6b, 0xcf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x48, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf4,
-
-    /* U+041C "М" */
-    0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x7b, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x7b, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0xf7, 0xbf, 0x7f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x6f, 0x7b, 0xf0,
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x93, 0xf7, 0xbf, 0x4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe1, 0x3f, 0x7b,
-    0xf0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x3, 0xf7, 0xbf, 0x0, 0x2f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x3f,
-    0x7b, 0xf0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x3, 0xf7, 0xbf, 0x0, 0x1,
-    0xec, 0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0,
-    0x3f, 0x7b, 0xf0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0x3, 0xf7, 0xbf, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x3f, 0x7b, 0xf0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x0, 0xbe, 0x10, 0x0, 0x3, 0xf7, 0xbf,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x4f, 0x60,
-    0x0, 0x0, 0x3f, 0x7b, 0xf0, 0x0, 0x0, 0x2,
-    0xfa, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x3, 0xf7,
-    0xbf, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x6, 0xf4,
-    0x0, 0x0, 0x0, 0x3f, 0x7b, 0xf0, 0x0, 0x0,
-    0x0, 0xe, 0xc1, 0xeb, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0x7b, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x7b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x7b,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf7,
-
-    /* U+041D "Н" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xbf, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x89, 0xfa, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xfc, 0xa9, 0xac, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0xfb, 0x40, 0x0, 0x0,
-    0x0, 0x4b, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x6f,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0x60, 0x0, 0x0, 0x5f, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x40, 0x0, 0x1f,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x10, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x1,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x6f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x5a, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xcd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xdc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xaf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x96, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x90, 0x1, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x5, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf4, 0x0, 0x0, 0x6, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0xf6, 0x0, 0x0, 0x0,
-    0x5, 0xef, 0xb5, 0x0, 0x0, 0x0, 0x5, 0xcf,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0xca, 0x9a, 0xcf, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfd, 0xa6,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0xfe, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-
-    /* U+0420 "Р" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0xb, 0xf9, 0x99, 0x99, 0x99, 0x9a, 0xdf,
-    0xfc, 0x20, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xff, 0x40, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0x20, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x4b, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf6, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x6b, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x1b, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xf2, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x8f, 0xf4, 0x0, 0xbf, 0x99, 0x99,
-    0x99, 0x99, 0xad, 0xff, 0xc2, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xc8, 0x30, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfc,
-    0xa9, 0xac, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x4e,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x4b, 0xfe, 0x30,
-    0x0, 0x6f, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xea, 0x0, 0x5f, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x0, 0x1e, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x20, 0x0, 0x6, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x5, 0xef,
-    0xc5, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xd2, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xca, 0x9a, 0xcf, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff,
-    0xfd, 0xa6, 0x10, 0x0,
-
-    /* U+0422 "Т" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x69, 0x99, 0x99, 0x99, 0xaf, 0xd9,
-    0x99, 0x99, 0x99, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x10, 0x6f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0xd,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x8f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xb0, 0x0, 0xae, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xb9,
-    0xae, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0xff, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
-    0xad, 0xff, 0xff, 0xff, 0xfd, 0xa6, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xfe, 0xa8,
-    0x69, 0xf8, 0x68, 0xae, 0xff, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x92, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0x3, 0x9f, 0xf6, 0x0, 0x0, 0x0,
-    0xa, 0xfb, 0x10, 0x0, 0x0, 0x6, 0xf4, 0x0,
-    0x0, 0x0, 0x2c, 0xf8, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x2, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x70, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x2, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xc0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x9f,
-    0xb0, 0x0, 0x0, 0x0, 0xaf, 0xe6, 0x0, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x6, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0xff, 0xb7, 0x53, 0x7f,
-    0x63, 0x57, 0xbf, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x24, 0x9f, 0x73, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0425 "Х" */
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x10, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x70, 0x0, 0x0, 0x1e, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0xa, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x6,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x10, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0xc, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0,
-    0x0, 0x1e, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xd0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x70, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x1,
-    0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5,
-
-    /* U+0426 "Ц" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x10, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x10, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf1, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x10, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0xbf, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xfa, 0x99,
-    0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbe,
-
-    /* U+0427 "Ч" */
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf4, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x4f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x1, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x9f, 0xf0, 0x3, 0xef, 0xd6, 0x20,
-    0x0, 0x25, 0x9d, 0xff, 0xff, 0x0, 0x1, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xb6, 0x1c, 0xf0, 0x0,
-    0x0, 0x4, 0x78, 0x88, 0x63, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf,
-
-    /* U+0428 "Ш" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xeb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xeb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xeb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xeb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xeb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xeb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xeb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xeb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xeb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xeb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xeb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0xfc, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x9f, 0xeb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0429 "Щ" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0xbf, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x9b, 0xfc, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x9f, 0xf9, 0x99, 0x6b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x75,
-
-    /* U+042A "Ъ" */
-    0xaf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x99, 0x99,
-    0x99, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x55, 0x55, 0x55, 0x55,
-    0x68, 0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x77, 0x77,
-    0x77, 0x77, 0x8b, 0xff, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xd9, 0x40, 0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x9b, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x9b, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x9b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x9b,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0xbf, 0x22, 0x22, 0x22,
-    0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa4,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0xbf, 0x55, 0x55,
-    0x55, 0x55, 0x57, 0xbf, 0xfc, 0x10, 0x0, 0x0,
-    0x2f, 0x9b, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x19, 0xfe, 0x10, 0x0, 0x2, 0xf9, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x2f, 0x9b, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x2, 0xf9, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x2f, 0x9b, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x2, 0xf9,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x2f, 0x9b, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x2,
-    0xf9, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x2f, 0x9b, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x2, 0xf9, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x2f, 0x9b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xfa, 0x0,
-    0x0, 0x2, 0xf9, 0xbf, 0x77, 0x77, 0x77, 0x77,
-    0x8a, 0xdf, 0xf7, 0x0, 0x0, 0x0, 0x2f, 0x9b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x61, 0x0,
-    0x0, 0x0, 0x2, 0xf9,
-
-    /* U+042C "Ь" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x22, 0x22, 0x22,
-    0x22, 0x10, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xa4, 0x0, 0x0, 0xbf,
-    0x55, 0x55, 0x55, 0x55, 0x57, 0xbf, 0xfc, 0x10,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xfe, 0x10, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x4b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x6b, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf5, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x3b, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xfa,
-    0x0, 0xbf, 0x77, 0x77, 0x77, 0x77, 0x8a, 0xdf,
-    0xf7, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xdb, 0x61, 0x0, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x0, 0x49, 0xce, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xef, 0xfd, 0xb9, 0x9b,
-    0xef, 0xfb, 0x20, 0x0, 0x0, 0x1b, 0xfd, 0x61,
-    0x0, 0x0, 0x0, 0x3a, 0xff, 0x60, 0x0, 0x6,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0x80, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf9, 0x0, 0x0, 0x0, 0x12, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x3f, 0xb0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf6, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xf8, 0x0, 0x0, 0xbf, 0xe7, 0x10,
-    0x0, 0x0, 0x3, 0xaf, 0xf6, 0x0, 0x0, 0x0,
-    0x5d, 0xff, 0xdb, 0xaa, 0xbe, 0xff, 0xb2, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xbe, 0xff, 0xec, 0x82, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xfe,
-    0xb9, 0x9b, 0xef, 0xfb, 0x20, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xb3, 0x0,
-    0x0, 0x0, 0x3a, 0xff, 0x60, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x6, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0x70, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x4, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x50, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x10, 0xbf, 0x0, 0x0,
-    0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0xb, 0xf0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0xbf, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x5b, 0xf0, 0x0, 0x0, 0x7f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf8, 0xbf, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xbf, 0x99, 0x99, 0x9e, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xcb, 0xf0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0xbf, 0x0, 0x0, 0x7, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x8b, 0xf0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0xbf, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xb,
-    0xf0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0xbf,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x4f, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xf5, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xf7, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfb, 0x40, 0x0, 0x0,
-    0x3, 0xaf, 0xf6, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xeb, 0xaa, 0xbe,
-    0xff, 0xb2, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x7b, 0xef, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x3d, 0xff, 0xca, 0x99, 0x99,
-    0x99, 0x9a, 0xf9, 0x0, 0x5f, 0xf7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x2f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x91,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x97, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x97, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x4f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x91, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x1e, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x2d, 0xfc,
-    0x62, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0,
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x4, 0xfa, 0x78, 0x88, 0x88, 0x88,
-    0x9f, 0x90, 0x0, 0x1, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0xaf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x6f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf9, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x93, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9,
-
-    /* U+0430 "а" */
-    0x0, 0x0, 0x49, 0xdf, 0xff, 0xd8, 0x20, 0x0,
-    0x0, 0x4d, 0xff, 0xb9, 0x89, 0xcf, 0xf6, 0x0,
-    0x4, 0xfd, 0x50, 0x0, 0x0, 0x3, 0xdf, 0x40,
-    0x0, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x11, 0x11, 0x15, 0xf6,
-    0x0, 0x3, 0xae, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x9f, 0xd7, 0x44, 0x44, 0x44, 0x47, 0xf6,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0xf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0xf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6,
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0x6, 0xf7, 0xf6,
-    0x0, 0x6f, 0xe8, 0x54, 0x57, 0xde, 0x44, 0xf6,
-    0x0, 0x2, 0x9d, 0xff, 0xec, 0x71, 0x4, 0xf6,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x8b, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0xcf, 0xff, 0xea, 0x72, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xfd, 0xa6, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x0, 0x36, 0x88, 0x63, 0x0, 0x0, 0x0, 0xf,
-    0xa0, 0x5, 0xdf, 0xff, 0xff, 0xfd, 0x50, 0x0,
-    0x3, 0xf6, 0xa, 0xfa, 0x41, 0x0, 0x38, 0xff,
-    0x90, 0x0, 0x5f, 0x49, 0xe4, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0x80, 0x7, 0xf7, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x30, 0x7f, 0xe8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x8, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x46, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x4f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x61, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x1, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0xb, 0xfd, 0x30,
-    0x0, 0x0, 0x19, 0xfd, 0x10, 0x0, 0x0, 0x9,
-    0xff, 0xc9, 0x78, 0xbf, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xff, 0xfc, 0x82, 0x0, 0x0,
-    0x0,
-
-    /* U+0432 "в" */
-    0x5f, 0xff, 0xff, 0xff, 0xfe, 0xc7, 0x10, 0x0,
-    0x5f, 0x96, 0x66, 0x66, 0x68, 0xcf, 0xe4, 0x0,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x3, 0xef, 0x10,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x50,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0,
-    0x5f, 0x61, 0x11, 0x11, 0x13, 0x6d, 0xd2, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
-    0x5f, 0x84, 0x44, 0x44, 0x44, 0x7b, 0xf9, 0x0,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x70,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x5f, 0x96, 0x66, 0x66, 0x67, 0xae, 0xfa, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x40, 0x0,
-
-    /* U+0433 "г" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xfb,
-    0x88, 0x88, 0x88, 0x88, 0x87, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x88, 0x88,
-    0x88, 0x88, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x1, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x48, 0xef, 0x97, 0x77, 0x77, 0x77, 0x77, 0x79,
-    0xfb, 0x77, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0xaf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x5a,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf5, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x5a, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x57,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0x20,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x2, 0x8c, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x98, 0x9d, 0xfe,
-    0x50, 0x0, 0x0, 0xa, 0xfa, 0x20, 0x0, 0x0,
-    0x3d, 0xf7, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x40, 0x2, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xd0, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9, 0xf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x1f, 0xa3, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x32, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x30, 0x0,
-    0x7, 0xfd, 0x50, 0x0, 0x0, 0x4, 0xdf, 0x50,
-    0x0, 0x0, 0x5e, 0xfe, 0xb9, 0x9a, 0xef, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe, 0xb5,
-    0x0, 0x0,
-
-    /* U+0436 "ж" */
-    0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xec, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x20, 0x0, 0x1e, 0xd0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0xd, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xce, 0x10,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf8, 0x22, 0x24, 0xf9, 0x22, 0x23,
-    0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x55, 0x56,
-    0xfb, 0x55, 0x56, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x40, 0x0, 0x2, 0xf8, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x10,
-    0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0xef, 0x20,
-    0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5,
-
-    /* U+0437 "з" */
-    0x0, 0x17, 0xbe, 0xff, 0xeb, 0x71, 0x0, 0x0,
-    0xaf, 0xfd, 0xa9, 0x9a, 0xef, 0xf6, 0x0, 0xb,
-    0x71, 0x0, 0x0, 0x0, 0x4d, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x4a, 0xf9, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x2, 0x33, 0x34,
-    0x6b, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x3c, 0xf7, 0x10, 0x0, 0x0, 0x2, 0xcf, 0x90,
-    0x1a, 0xff, 0xc9, 0x77, 0x9c, 0xff, 0x70, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+0438 "и" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x85, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf8, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0x85, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0xf8, 0x5f, 0x60, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0x3f, 0x85, 0xf6, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x3, 0xf8, 0x5f, 0x60, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x3f, 0x85, 0xf6, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x3, 0xf8, 0x5f, 0x60, 0x0, 0x1,
-    0xee, 0x10, 0x0, 0x3f, 0x85, 0xf6, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x3, 0xf8, 0x5f, 0x60, 0x0,
-    0xaf, 0x50, 0x0, 0x0, 0x3f, 0x85, 0xf6, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x3, 0xf8, 0x5f, 0x60,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x3f, 0x85, 0xf6,
-    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x5f,
-    0x7d, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x85,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x85, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf8,
-
-    /* U+0439 "й" */
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0xf4, 0x0,
-    0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0x6f, 0x10,
-    0x0, 0x0, 0x0, 0x6f, 0x81, 0x1, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x21, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x85, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xf8, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x5f, 0x85, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x43, 0xf8, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x8f, 0x70, 0x3f, 0x85, 0xf6,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x3, 0xf8, 0x5f,
-    0x60, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0x85,
-    0xf6, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x3, 0xf8,
-    0x5f, 0x60, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x3f,
-    0x85, 0xf6, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x3,
-    0xf8, 0x5f, 0x60, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x3f, 0x85, 0xf6, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x5f, 0x62, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x85, 0xf7, 0xde, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x5f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x85, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x80,
-
-    /* U+043A "к" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xc0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xde, 0x10,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0x72, 0x22, 0x3e, 0xc0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x5f, 0x95, 0x55, 0x6f, 0xd1, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x1, 0xdf, 0x30, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xf, 0xd8, 0x88, 0x88, 0x88,
-    0x8a, 0xf8, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x2f, 0x70,
-    0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x2f,
-    0x60, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0,
-    0x3f, 0x50, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x2, 0xf8,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x6f, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0xae, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x1e, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8,
-    0x79, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0xaf, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf8,
-
-    /* U+043C "м" */
-    0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x5f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x5f, 0x9f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xaf,
-    0x5f, 0x3b, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf6, 0x9f, 0x5f, 0x32, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xc0, 0x9f, 0x5f, 0x30, 0x8f, 0x20,
-    0x0, 0x0, 0x0, 0x6f, 0x30, 0x9f, 0x5f, 0x30,
-    0xe, 0xc0, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x9f,
-    0x5f, 0x30, 0x5, 0xf5, 0x0, 0x0, 0x9, 0xe1,
-    0x0, 0x9f, 0x5f, 0x30, 0x0, 0xce, 0x0, 0x0,
-    0x3f, 0x60, 0x0, 0x9f, 0x5f, 0x30, 0x0, 0x2f,
-    0x80, 0x0, 0xcc, 0x0, 0x0, 0x9f, 0x5f, 0x30,
-    0x0, 0x9, 0xf2, 0x6, 0xf3, 0x0, 0x0, 0x9f,
-    0x5f, 0x30, 0x0, 0x1, 0xeb, 0x1e, 0x90, 0x0,
-    0x0, 0x9f, 0x5f, 0x30, 0x0, 0x0, 0x6f, 0xce,
-    0x10, 0x0, 0x0, 0x9f, 0x5f, 0x30, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0x0, 0x0, 0x9f, 0x5f, 0x30,
-    0x0, 0x0, 0x3, 0x90, 0x0, 0x0, 0x0, 0x9f,
-    0x5f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f,
-
-    /* U+043D "н" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x15, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x15, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf1, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x15, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf1, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x15, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf1, 0x5f, 0xb8, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0xcf, 0x15, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x15, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x15, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x15,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x15, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xea, 0x99, 0xcf,
-    0xfb, 0x10, 0x0, 0x0, 0x8, 0xfd, 0x40, 0x0,
-    0x0, 0x18, 0xfe, 0x20, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x1, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x50, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x91, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0xf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf5, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0,
-    0x8f, 0xd4, 0x0, 0x0, 0x1, 0x8f, 0xe2, 0x0,
-    0x0, 0x0, 0x5e, 0xfe, 0xa8, 0x9c, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xd9,
-    0x30, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x25, 0xfb, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8c,
-    0xf2, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x25, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf2, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x25, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x25, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf2, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x25, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf2, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x25, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x25, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x25,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x25, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf2,
-
-    /* U+0440 "р" */
-    0x4f, 0x50, 0x0, 0x6b, 0xef, 0xfd, 0x92, 0x0,
-    0x0, 0x4, 0xf5, 0x4, 0xef, 0xd9, 0x99, 0xdf,
-    0xf9, 0x0, 0x0, 0x4f, 0x55, 0xfb, 0x20, 0x0,
-    0x0, 0x2b, 0xfc, 0x10, 0x4, 0xf8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x4f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x4,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xc0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x14, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x4f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x64, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x4f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x44, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x4, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x4f, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x4, 0xf6,
-    0x5f, 0xb2, 0x0, 0x0, 0x2, 0xbf, 0xc1, 0x0,
-    0x4f, 0x60, 0x4e, 0xfd, 0x98, 0x9d, 0xff, 0x90,
-    0x0, 0x4, 0xf6, 0x0, 0x7, 0xce, 0xff, 0xd9,
-    0x20, 0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xea, 0x99, 0xbf, 0xfb,
-    0x10, 0x0, 0x8, 0xfd, 0x40, 0x0, 0x0, 0x8,
-    0xfd, 0x10, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xe4, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x40,
-    0x0, 0x8f, 0xd4, 0x0, 0x0, 0x0, 0x8f, 0xd1,
-    0x0, 0x0, 0x5e, 0xfe, 0xa9, 0x9b, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0xda, 0x40,
-    0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x88, 0x88, 0x88, 0x9f, 0xd8, 0x88, 0x88,
-    0x84, 0x0, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x0,
-    0x0,
-
-    /* U+0443 "у" */
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0xed, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x5, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0xaf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0x1, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x8,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x7f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0x2e,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe9,
-    0x8a, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xbe, 0xfe, 0xa2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xbd, 0xff, 0xff, 0xdb, 0x73, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0xff, 0xeb, 0x9e, 0xf9, 0xbe,
-    0xff, 0xc3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x82,
-    0x0, 0xc, 0xe0, 0x0, 0x28, 0xff, 0x70, 0x0,
-    0x0, 0x6f, 0xc2, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x1c, 0xf7, 0x0, 0x2, 0xfd, 0x10, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x2f, 0xa0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x1f, 0x90, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x8, 0xf2, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xf4,
-    0x2f, 0x80, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0xe, 0xd0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0x2, 0xfe, 0x10, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x6f, 0xd2, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x1c, 0xf7, 0x0,
-    0x0, 0x7, 0xff, 0x92, 0x0, 0xc, 0xe0, 0x0,
-    0x28, 0xff, 0x70, 0x0, 0x0, 0x0, 0x3c, 0xff,
-    0xeb, 0x9e, 0xf9, 0xbe, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xbd, 0xff, 0xff, 0xdb,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1, 0xed,
-    0x10, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x30, 0x0, 0x1e, 0xd0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x4f,
-    0xa0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x1e,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xee, 0x18,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x6d, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x90, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x0,
-    0xd, 0xe1, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0x6, 0xf8, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x1, 0xde, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6,
-
-    /* U+0446 "ц" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xd0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xd0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0,
-    0x5f, 0xb8, 0x88, 0x88, 0x88, 0x88, 0x88, 0xee,
-    0x88, 0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x60,
-
-    /* U+0447 "ч" */
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6,
-    0x1, 0xdf, 0xc6, 0x32, 0x24, 0x7b, 0xff, 0xf6,
-    0x0, 0x8, 0xef, 0xff, 0xff, 0xea, 0x55, 0xf6,
-    0x0, 0x0, 0x2, 0x44, 0x42, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-
-    /* U+0448 "ш" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x85, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x3, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x85, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x85, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x2, 0xf8, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x85,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x85, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x2, 0xf8, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x85, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x85, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x85, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x0, 0x0, 0x0, 0x2, 0xf8,
-    0x5f, 0xb8, 0x88, 0x88, 0x88, 0x89, 0xfb, 0x88,
-    0x88, 0x88, 0x88, 0x9f, 0x85, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8,
-
-    /* U+0449 "щ" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x5f, 0xb8, 0x88, 0x88, 0x88, 0x89, 0xfb, 0x88,
-    0x88, 0x88, 0x88, 0x9f, 0xc8, 0x82, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf5,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x88, 0x88, 0x8b, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x61, 0x11, 0x11, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xeb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x84, 0x44, 0x44, 0x57, 0xdf, 0xb0, 0x0, 0x0,
-    0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x90, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x5, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x40, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x5f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0x96, 0x66, 0x66, 0x7a,
-    0xef, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+044B "ы" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x5f, 0xff,
-    0xff, 0xff, 0xfe, 0xb6, 0x0, 0x0, 0x4, 0xf6,
-    0x5f, 0x83, 0x33, 0x33, 0x47, 0xcf, 0xc1, 0x0,
-    0x4, 0xf6, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x6,
-    0xfb, 0x0, 0x4, 0xf6, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0x4, 0xf6, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x4, 0xf6,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x4, 0xf6, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x50, 0x4, 0xf6, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x10, 0x4, 0xf6, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x4, 0xf6,
-    0x5f, 0x95, 0x55, 0x55, 0x69, 0xef, 0x90, 0x0,
-    0x4, 0xf6, 0x5f, 0xff, 0xff, 0xff, 0xfd, 0x93,
-    0x0, 0x0, 0x4, 0xf6,
-
-    /* U+044C "ь" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xeb, 0x60, 0x0, 0x5f, 0x83, 0x33, 0x33,
-    0x47, 0xbf, 0xd2, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x45, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x85, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x25, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x5f, 0x95, 0x55, 0x55, 0x69, 0xef, 0xa0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xd9, 0x40, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x16, 0xbe, 0xff, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x97, 0x78, 0xcf, 0xf7, 0x0,
-    0x0, 0x8f, 0x91, 0x0, 0x0, 0x0, 0x2a, 0xfb,
-    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x11, 0x11,
-    0x11, 0x11, 0x14, 0xf6, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x44,
-    0x44, 0x44, 0x44, 0x45, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x15,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x8,
-    0xfa, 0x20, 0x0, 0x0, 0x2, 0xbf, 0xb0, 0x0,
-    0x6, 0xff, 0xd9, 0x77, 0x9c, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x6a, 0xef, 0xfe, 0xc7, 0x10, 0x0,
-    0x0,
-
-    /* U+044E "ю" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff,
-    0xfc, 0x82, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xda, 0x99, 0xdf, 0xf8, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x9, 0xfc, 0x30,
-    0x0, 0x0, 0x2b, 0xfa, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x5f, 0x60, 0x0, 0x1, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x5, 0xf6,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0x5f, 0x60, 0x0, 0xd, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x5,
-    0xf6, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf1, 0x5f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x35, 0xfb, 0x99, 0x9a, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf3, 0x5f, 0x60, 0x0,
-    0xf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x15, 0xf6, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x5f, 0x60,
-    0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf9, 0x5, 0xf6, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x5f,
-    0x60, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x9f, 0xc3, 0x0, 0x0, 0x2, 0xbf, 0xa0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x98,
-    0x9c, 0xff, 0x80, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xcf, 0xff, 0xc8, 0x20, 0x0,
-    0x0,
-
-    /* U+044F "я" */
-    0x0, 0x3, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xa, 0xff, 0xb9, 0x88, 0x88, 0x88, 0xec, 0xa,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0xc, 0xc3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x8f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xcb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xca, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcc, 0x6f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xc0, 0xee, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xcc, 0x3, 0xef, 0x83, 0x10, 0x0,
-    0x0, 0xc, 0xc0, 0x1, 0x8e, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xaf, 0x43, 0x33, 0x33,
-    0x3d, 0xc0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0xcc, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0xc,
-    0xc0, 0x1e, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x0, 0x4e, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x8c, 0xff, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0x98, 0x9d, 0xfe, 0x50,
-    0x0, 0x0, 0xa, 0xfa, 0x20, 0x0, 0x0, 0x3d,
-    0xf7, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xd0, 0x8, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0xd, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf9, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x1f, 0xa3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x32, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x30, 0x0, 0x7,
-    0xfd, 0x50, 0x0, 0x0, 0x4, 0xdf, 0x50, 0x0,
-    0x0, 0x5e, 0xfe, 0xb9, 0x9a, 0xef, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe, 0xb5, 0x0,
-    0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0xd, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x61, 0x0, 0x2,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x8c, 0xff, 0xec, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x98, 0x9d, 0xfe, 0x50, 0x0,
-    0x0, 0xa, 0xfa, 0x20, 0x0, 0x0, 0x3d, 0xf7,
-    0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xd0, 0x8, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf9, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x1f,
-    0xa3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x30, 0x0, 0x7, 0xfd,
-    0x50, 0x0, 0x0, 0x4, 0xdf, 0x50, 0x0, 0x0,
-    0x5e, 0xfe, 0xb9, 0x9a, 0xef, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x6b, 0xef, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x3, 0x33, 0x7f, 0x83, 0x33, 0x33,
-    0x33, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x39, 0xdf,
-    0xfe, 0xb6, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50,
-    0x8f, 0xfb, 0x99, 0xae, 0xfe, 0x30, 0x0, 0x0,
-    0x5, 0xf5, 0xaf, 0x60, 0x0, 0x0, 0x7, 0xfe,
-    0x20, 0x0, 0x0, 0x5f, 0xbf, 0x30, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x5, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0,
-    0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x90, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x90, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10,
-    0x0, 0x1d, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x97, 0x9e, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x9e, 0xff, 0xc4, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x5f, 0xb8, 0x88, 0x88,
-    0x88, 0x88, 0x75, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x4e, 0xfe, 0xa8, 0x78, 0xbf,
-    0xfb, 0x10, 0x0, 0x7, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x5e, 0xc0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x91, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x3f, 0x94, 0x44, 0x44, 0x44, 0x44, 0x10,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x50, 0x0,
-    0x7, 0xfd, 0x40, 0x0, 0x0, 0x1, 0x8f, 0xc0,
-    0x0, 0x0, 0x4e, 0xfd, 0x97, 0x78, 0xbf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xc8,
-    0x20, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x0, 0x5b, 0xef, 0xfe, 0xc8, 0x20, 0x0,
-    0x2, 0xdf, 0xda, 0x88, 0x9c, 0xff, 0xb0, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x1, 0x8c, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x51,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfd,
-    0xa7, 0x30, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbe,
-    0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x6c, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xa1, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x2d, 0xf3,
-    0x4, 0xdf, 0xfc, 0x98, 0x89, 0xcf, 0xf5, 0x0,
-    0x0, 0x49, 0xce, 0xff, 0xeb, 0x71, 0x0,
-
-    /* U+0456 "і" */
-    0x7f, 0x8d, 0xfe, 0x4b, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x5f, 0x65, 0xf6, 0x5f,
-    0x65, 0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x65, 0xf6,
-    0x5f, 0x65, 0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x65,
-    0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x60,
-
-    /* U+0457 "ї" */
-    0x8f, 0x40, 0x5f, 0x7c, 0xf7, 0x8, 0xfa, 0x26,
-    0x0, 0x6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x6, 0xf4, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x6, 0xf4, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x6,
-    0xf4, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x6, 0xf4,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0x6, 0xf4, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x6f, 0x40,
-    0x0, 0x6, 0xf4, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x4, 0xb5, 0x0, 0x0, 0x0,
-    0xc, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0,
-    0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0,
-    0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x8,
-    0xf3, 0x3, 0x0, 0x0, 0x2f, 0xd0, 0xd, 0xe9,
-    0x79, 0xff, 0x40, 0x3, 0xae, 0xfe, 0xb3, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xd8, 0x88, 0x88, 0x88, 0x8a, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x71, 0x0,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x33, 0x33, 0x34, 0x6a, 0xfe, 0x40, 0x0,
-    0x0, 0x6f, 0x10, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xe1, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0xae,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x0, 0x1e, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xd0,
-    0x79, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfd, 0x99, 0x99, 0x99, 0xcf, 0xfd, 0x10, 0xaf,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-
-    /* U+045A "њ" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb8, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0xfe, 0x88, 0x88, 0x87, 0x75, 0x10, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x15, 0xcf, 0xc0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xe0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x55, 0x55, 0x55, 0x7b, 0xfd, 0x20, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xeb, 0x60, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0x2, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x2,
-    0x22, 0x27, 0xf7, 0x22, 0x22, 0x22, 0x22, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x39, 0xdf, 0xfe,
-    0xc7, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x8,
-    0xff, 0xb9, 0x9a, 0xef, 0xe3, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0xaf, 0x60, 0x0, 0x0, 0x6, 0xfe,
-    0x20, 0x0, 0x0, 0x5, 0xfc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x5, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9, 0x0,
-    0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf9,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf9,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xee, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xc0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xde, 0x10,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0x72, 0x22, 0x3e, 0xc0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x5f, 0x95, 0x55, 0x6f, 0xd1, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x1, 0xdf, 0x30, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6,
-
-    /* U+045D "ѝ" */
-    0x0, 0x2, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x85, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xf8, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x5f, 0x85, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x43, 0xf8, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x8f, 0x70, 0x3f, 0x85, 0xf6,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x3, 0xf8, 0x5f,
-    0x60, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0x85,
-    0xf6, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x3, 0xf8,
-    0x5f, 0x60, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x3f,
-    0x85, 0xf6, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x3,
-    0xf8, 0x5f, 0x60, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x3f, 0x85, 0xf6, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x5f, 0x62, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x85, 0xf7, 0xde, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x5f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x85, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x80,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x8, 0x10, 0x0, 0x0, 0x5, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x80, 0x0, 0x0,
-    0x1e, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x20, 0x4, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4c, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x70, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0xc, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x40, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xb0, 0x1, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf3, 0x8, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0xe,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0x0, 0x0, 0x2e, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe9, 0x8a, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbe,
-    0xfe, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe5,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xe5, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xe5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xe5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xce, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xe5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0x5f, 0xb8, 0x88, 0x88, 0x88, 0x88, 0x8e, 0xe5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x9b, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5f, 0xb8,
-    0x88, 0x88, 0x88, 0x87, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x30,
-
-    /* U+2014 "—" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33,
-
-    /* U+2018 "‘" */
-    0x0, 0x8b, 0x0, 0xc7, 0x1, 0xf4, 0x5, 0xf0,
-    0xa, 0xd0, 0xe, 0xf6, 0xf, 0xfc, 0x7, 0xd5,
-
-    /* U+2019 "’" */
-    0x9, 0xf6, 0xf, 0xfc, 0x7, 0xfa, 0x1, 0xf6,
-    0x4, 0xf1, 0x8, 0xd0, 0xb, 0x90, 0xd, 0x40,
-
-    /* U+201A "‚" */
-    0x7, 0xd5, 0xf, 0xfc, 0x9, 0xfb, 0x0, 0xf6,
-    0x4, 0xf2, 0x7, 0xe0, 0xb, 0x90, 0xe, 0x50,
-
-    /* U+201C "“" */
-    0x0, 0x8b, 0x0, 0x5, 0xe0, 0xc, 0x70, 0x0,
-    0x9a, 0x1, 0xf4, 0x0, 0xe, 0x70, 0x5f, 0x0,
-    0x2, 0xf4, 0xa, 0xd0, 0x0, 0x7f, 0x0, 0xef,
-    0x60, 0xb, 0xf9, 0xf, 0xfc, 0x0, 0xcf, 0xf0,
-    0x7d, 0x50, 0x5, 0xd7,
-
-    /* U+201D "”" */
-    0x9, 0xf6, 0x0, 0x6f, 0x90, 0xf, 0xfc, 0x0,
-    0xcf, 0xf0, 0x7, 0xfa, 0x0, 0x5f, 0xd0, 0x1,
-    0xf6, 0x0, 0xd, 0x90, 0x4, 0xf1, 0x0, 0x1f,
-    0x50, 0x8, 0xd0, 0x0, 0x4f, 0x10, 0xb, 0x90,
-    0x0, 0x8c, 0x0, 0xd, 0x40, 0x0, 0xa7, 0x0,
-
-    /* U+2026 "…" */
-    0x8, 0xe5, 0x0, 0x0, 0x8d, 0x50, 0x0, 0x9,
-    0xd4, 0xf, 0xfc, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0xf, 0xfb, 0x9, 0xf6, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0xa, 0xf5,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x0, 0x59, 0xdf, 0xff, 0xeb, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xc9,
-    0x89, 0xad, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x2b, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xa0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x12, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x12, 0x2d, 0xf8,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xd7, 0x0, 0x0,
-    0x2, 0xef, 0x81, 0x0, 0x0, 0x0, 0x4, 0xaf,
-    0xd3, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xca, 0x99,
-    0xac, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x39, 0xce, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0xab, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xc8, 0x0, 0x0, 0x0, 0x7c, 0xee, 0xc7,
-    0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x2, 0xed, 0x63,
-    0x36, 0xde, 0x20, 0xdf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0x0, 0xad, 0xd, 0xfe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0,
-    0x7e, 0x0, 0x0, 0x0, 0x0, 0xe6, 0xde, 0x3f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0xb, 0x90, 0x0, 0x0, 0x0, 0xa, 0xad,
-    0xe0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0xc8, 0x0, 0x0, 0x0, 0x0,
-    0x8c, 0xde, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0xa, 0xa0, 0x0, 0x0,
-    0x0, 0xa, 0xad, 0xe0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x6f, 0x10,
-    0x0, 0x0, 0x1, 0xf5, 0xde, 0x0, 0x1, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0xcc, 0x10, 0x0, 0x1, 0xcc, 0xd, 0xe0, 0x0,
-    0x3, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x1, 0xce, 0x85, 0x69, 0xec, 0x10, 0xde,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x5a, 0xcc, 0xa5, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x2e, 0xf2, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x1,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0x0, 0x1, 0xfa, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x1f,
-    0xa0, 0x0, 0x3, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x21, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfc, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 140, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 137, .box_w = 4, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 48, .adv_w = 194, .box_w = 8, .box_h = 9, .ofs_x = 2, .ofs_y = 15},
-    {.bitmap_index = 84, .adv_w = 375, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 348, .adv_w = 331, .box_w = 18, .box_h = 32, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 636, .adv_w = 444, .box_w = 26, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 948, .adv_w = 356, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1211, .adv_w = 106, .box_w = 3, .box_h = 9, .ofs_x = 2, .ofs_y = 15},
-    {.bitmap_index = 1225, .adv_w = 175, .box_w = 7, .box_h = 32, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 1337, .adv_w = 175, .box_w = 7, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 1449, .adv_w = 204, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 1527, .adv_w = 310, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 1640, .adv_w = 109, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1656, .adv_w = 207, .box_w = 9, .box_h = 2, .ofs_x = 2, .ofs_y = 8},
-    {.bitmap_index = 1665, .adv_w = 109, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1671, .adv_w = 174, .box_w = 13, .box_h = 32, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 1879, .adv_w = 358, .box_w = 20, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2119, .adv_w = 192, .box_w = 8, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2215, .adv_w = 306, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2431, .adv_w = 304, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2647, .adv_w = 356, .box_w = 21, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2899, .adv_w = 304, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3115, .adv_w = 327, .box_w = 19, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3343, .adv_w = 316, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3559, .adv_w = 344, .box_w = 19, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3787, .adv_w = 327, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4003, .adv_w = 109, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4039, .adv_w = 109, .box_w = 4, .box_h = 23, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4085, .adv_w = 310, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 4190, .adv_w = 310, .box_w = 15, .box_h = 11, .ofs_x = 2, .ofs_y = 7},
-    {.bitmap_index = 4273, .adv_w = 310, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 4378, .adv_w = 306, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4582, .adv_w = 562, .box_w = 33, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 5094, .adv_w = 384, .box_w = 24, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5382, .adv_w = 409, .box_w = 20, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 5622, .adv_w = 384, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5886, .adv_w = 449, .box_w = 23, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 6162, .adv_w = 364, .box_w = 17, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 6366, .adv_w = 343, .box_w = 17, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 6570, .adv_w = 421, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6834, .adv_w = 443, .box_w = 20, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7074, .adv_w = 160, .box_w = 2, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7098, .adv_w = 267, .box_w = 14, .box_h = 24, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7266, .adv_w = 382, .box_w = 20, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7506, .adv_w = 318, .box_w = 16, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7698, .adv_w = 520, .box_w = 25, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7998, .adv_w = 443, .box_w = 20, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8238, .adv_w = 456, .box_w = 26, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8550, .adv_w = 389, .box_w = 19, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8778, .adv_w = 456, .box_w = 27, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 9170, .adv_w = 392, .box_w = 19, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 9398, .adv_w = 331, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9614, .adv_w = 306, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9842, .adv_w = 431, .box_w = 21, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10094, .adv_w = 374, .box_w = 24, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10382, .adv_w = 597, .box_w = 35, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10802, .adv_w = 349, .box_w = 22, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11066, .adv_w = 340, .box_w = 22, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11330, .adv_w = 351, .box_w = 20, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11570, .adv_w = 166, .box_w = 6, .box_h = 32, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 11666, .adv_w = 174, .box_w = 14, .box_h = 32, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 11890, .adv_w = 166, .box_w = 7, .box_h = 32, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 12002, .adv_w = 310, .box_w = 14, .box_h = 14, .ofs_x = 3, .ofs_y = 5},
-    {.bitmap_index = 12100, .adv_w = 272, .box_w = 17, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 12126, .adv_w = 326, .box_w = 9, .box_h = 4, .ofs_x = 4, .ofs_y = 21},
-    {.bitmap_index = 12144, .adv_w = 317, .box_w = 15, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12279, .adv_w = 367, .box_w = 19, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 12517, .adv_w = 302, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12670, .adv_w = 367, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12908, .adv_w = 325, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13070, .adv_w = 178, .box_w = 13, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13233, .adv_w = 371, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 13471, .adv_w = 366, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13684, .adv_w = 142, .box_w = 3, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13722, .adv_w = 145, .box_w = 10, .box_h = 32, .ofs_x = -3, .ofs_y = -7},
-    {.bitmap_index = 13882, .adv_w = 317, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14095, .adv_w = 142, .box_w = 3, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14133, .adv_w = 579, .box_w = 30, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14403, .adv_w = 366, .box_w = 17, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14556, .adv_w = 337, .box_w = 19, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14727, .adv_w = 367, .box_w = 19, .box_h = 25, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 14965, .adv_w = 367, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 15203, .adv_w = 214, .box_w = 9, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15284, .adv_w = 260, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15428, .adv_w = 217, .box_w = 13, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15571, .adv_w = 364, .box_w = 17, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15724, .adv_w = 287, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15886, .adv_w = 469, .box_w = 29, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16147, .adv_w = 282, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16300, .adv_w = 287, .box_w = 19, .box_h = 25, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 16538, .adv_w = 274, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16673, .adv_w = 174, .box_w = 9, .box_h = 32, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 16817, .adv_w = 158, .box_w = 2, .box_h = 32, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 16849, .adv_w = 174, .box_w = 9, .box_h = 32, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 16993, .adv_w = 310, .box_w = 16, .box_h = 7, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 17049, .adv_w = 248, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 17140, .adv_w = 248, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 17225, .adv_w = 355, .box_w = 17, .box_h = 30, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17480, .adv_w = 355, .box_w = 17, .box_h = 30, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17735, .adv_w = 446, .box_w = 27, .box_h = 25, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18073, .adv_w = 309, .box_w = 15, .box_h = 30, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18298, .adv_w = 384, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18550, .adv_w = 337, .box_w = 19, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18778, .adv_w = 165, .box_w = 3, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18814, .adv_w = 160, .box_w = 10, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18964, .adv_w = 281, .box_w = 14, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19132, .adv_w = 645, .box_w = 39, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19600, .adv_w = 646, .box_w = 35, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20020, .adv_w = 449, .box_w = 27, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20344, .adv_w = 378, .box_w = 19, .box_h = 30, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20629, .adv_w = 449, .box_w = 20, .box_h = 30, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20929, .adv_w = 365, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21274, .adv_w = 438, .box_w = 20, .box_h = 30, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 21574, .adv_w = 399, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21874, .adv_w = 393, .box_w = 19, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22102, .adv_w = 408, .box_w = 20, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22342, .adv_w = 309, .box_w = 15, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22522, .adv_w = 428, .box_w = 26, .box_h = 30, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 22912, .adv_w = 355, .box_w = 17, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 23116, .adv_w = 542, .box_w = 33, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23512, .adv_w = 333, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23740, .adv_w = 449, .box_w = 20, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 23980, .adv_w = 449, .box_w = 20, .box_h = 30, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 24280, .adv_w = 378, .box_w = 19, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 24508, .adv_w = 425, .box_w = 23, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24784, .adv_w = 524, .box_w = 25, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 25084, .adv_w = 447, .box_w = 20, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 25324, .adv_w = 464, .box_w = 25, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 25624, .adv_w = 450, .box_w = 20, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 25864, .adv_w = 384, .box_w = 19, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 26092, .adv_w = 388, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26344, .adv_w = 313, .box_w = 20, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26584, .adv_w = 365, .box_w = 23, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26860, .adv_w = 494, .box_w = 29, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 27237, .adv_w = 345, .box_w = 21, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27489, .adv_w = 448, .box_w = 23, .box_h = 30, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 27834, .adv_w = 388, .box_w = 19, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 28062, .adv_w = 595, .box_w = 29, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 28410, .adv_w = 606, .box_w = 33, .box_h = 30, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 28905, .adv_w = 443, .box_w = 27, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29229, .adv_w = 526, .box_w = 25, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 29529, .adv_w = 385, .box_w = 19, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 29757, .adv_w = 384, .box_w = 21, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 30009, .adv_w = 591, .box_w = 31, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 30381, .adv_w = 398, .box_w = 19, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30609, .adv_w = 314, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 30753, .adv_w = 357, .box_w = 19, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 31010, .adv_w = 327, .box_w = 16, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 31154, .adv_w = 252, .box_w = 13, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 31271, .adv_w = 348, .box_w = 21, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 31513, .adv_w = 331, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 31675, .adv_w = 439, .box_w = 27, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31918, .adv_w = 286, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 32053, .adv_w = 371, .box_w = 17, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32206, .adv_w = 371, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32419, .adv_w = 309, .box_w = 16, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32563, .adv_w = 339, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 32725, .adv_w = 426, .box_w = 20, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32905, .adv_w = 364, .box_w = 17, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 33058, .adv_w = 344, .box_w = 19, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33229, .adv_w = 366, .box_w = 17, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 33382, .adv_w = 372, .box_w = 19, .box_h = 25, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 33620, .adv_w = 303, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33773, .adv_w = 248, .box_w = 17, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 33926, .adv_w = 297, .box_w = 20, .box_h = 25, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 34176, .adv_w = 418, .box_w = 24, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 34560, .adv_w = 279, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 34713, .adv_w = 369, .box_w = 19, .box_h = 23, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 34932, .adv_w = 322, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35076, .adv_w = 499, .box_w = 25, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35301, .adv_w = 499, .box_w = 28, .box_h = 22, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 35609, .adv_w = 329, .box_w = 21, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 35798, .adv_w = 417, .box_w = 20, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35978, .adv_w = 301, .box_w = 15, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36113, .adv_w = 309, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36266, .adv_w = 466, .box_w = 25, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36491, .adv_w = 327, .box_w = 15, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 36626, .adv_w = 337, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36851, .adv_w = 331, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37067, .adv_w = 363, .box_w = 21, .box_h = 32, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 37403, .adv_w = 252, .box_w = 13, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 37566, .adv_w = 309, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37728, .adv_w = 283, .box_w = 15, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37863, .adv_w = 144, .box_w = 3, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 37901, .adv_w = 142, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37985, .adv_w = 145, .box_w = 10, .box_h = 32, .ofs_x = -4, .ofs_y = -7},
-    {.bitmap_index = 38145, .adv_w = 496, .box_w = 30, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 38415, .adv_w = 510, .box_w = 28, .box_h = 18, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 38667, .adv_w = 363, .box_w = 22, .box_h = 26, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 38953, .adv_w = 309, .box_w = 16, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 39153, .adv_w = 371, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 39366, .adv_w = 297, .box_w = 20, .box_h = 32, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 39686, .adv_w = 345, .box_w = 15, .box_h = 23, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 39859, .adv_w = 310, .box_w = 15, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 40077, .adv_w = 237, .box_w = 12, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 40209, .adv_w = 272, .box_w = 17, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 40235, .adv_w = 544, .box_w = 34, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 40286, .adv_w = 109, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 17},
-    {.bitmap_index = 40302, .adv_w = 109, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 17},
-    {.bitmap_index = 40318, .adv_w = 109, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 40334, .adv_w = 192, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 17},
-    {.bitmap_index = 40370, .adv_w = 192, .box_w = 10, .box_h = 8, .ofs_x = 1, .ofs_y = 17},
-    {.bitmap_index = 40410, .adv_w = 331, .box_w = 18, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40437, .adv_w = 449, .box_w = 22, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 40701, .adv_w = 651, .box_w = 35, .box_h = 24, .ofs_x = 4, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_34;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_34 = {
-#else
-lv_font_t montserrat_cyrillic_34 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 37,          /*The maximum line height required by the font*/
-    .base_line = 7,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -3,
-    .underline_thickness = 2,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_34,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_34*/
@@ -1,6576 +0,0 @@
-/*******************************************************************************
- * Size: 36 px
- * Bpp: 4
- * Opts: --bpp 4 --size 36 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_36.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_36
-#define MONTSERRAT_CYRILLIC_36 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_36
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x8f, 0x90, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-    0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x5f, 0x60,
-    0x5f, 0x60, 0x5f, 0x60, 0x4f, 0x50, 0x4f, 0x50,
-    0x4f, 0x50, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x40,
-    0x2f, 0x30, 0x1a, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0x80, 0xef, 0xf0,
-    0x7f, 0x90,
-
-    /* U+0022 "\"" */
-    0x5f, 0x40, 0x0, 0x7f, 0x25, 0xf4, 0x0, 0x7,
-    0xf2, 0x4f, 0x40, 0x0, 0x7f, 0x14, 0xf4, 0x0,
-    0x7, 0xf1, 0x4f, 0x30, 0x0, 0x6f, 0x14, 0xf3,
-    0x0, 0x6, 0xf1, 0x3f, 0x30, 0x0, 0x6f, 0x3,
-    0xf3, 0x0, 0x6, 0xf0, 0x3f, 0x20, 0x0, 0x5f,
-    0x0, 0x50, 0x0, 0x1, 0x50,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0,
-    0x2f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0, 0x6f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf5, 0x0, 0x0,
-    0x0, 0xc, 0xb0, 0x0, 0x0, 0x1, 0x22, 0x22,
-    0x5f, 0x52, 0x22, 0x22, 0x22, 0xea, 0x22, 0x22,
-    0x10, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x3, 0x55, 0x55, 0xaf,
-    0x55, 0x55, 0x55, 0x56, 0xf8, 0x55, 0x55, 0x30,
-    0x0, 0x0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb, 0x0,
-    0x0, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x90, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0,
-    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x50, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0,
-    0xe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x10, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0,
-    0x12, 0x22, 0x28, 0xf2, 0x22, 0x22, 0x22, 0x3f,
-    0x62, 0x22, 0x21, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x45,
-    0x55, 0x5d, 0xc5, 0x55, 0x55, 0x55, 0x9f, 0x55,
-    0x55, 0x52, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0x0,
-    0xb, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x30, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x1, 0xf5, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef, 0xff,
-    0xda, 0x61, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xce, 0xea, 0xdf, 0xff, 0xa2, 0x0, 0x0, 0x1d,
-    0xfc, 0x40, 0x9, 0xb0, 0x0, 0x4b, 0xfd, 0x0,
-    0x0, 0xaf, 0xa0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x35, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0,
-    0x9, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0,
-    0x9, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xfd, 0x60, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xbd, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xff,
-    0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xda, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb0, 0x4, 0xbf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x4,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xb0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0xe, 0xf0, 0x5, 0x10, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x4f, 0xb0, 0xf, 0xe5, 0x0, 0x0,
-    0x9, 0xb0, 0x0, 0x2, 0xef, 0x30, 0x4, 0xef,
-    0xd6, 0x10, 0x9, 0xb0, 0x1, 0x7f, 0xf7, 0x0,
-    0x0, 0x18, 0xff, 0xfd, 0xbe, 0xeb, 0xdf, 0xfe,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xff,
-    0xda, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xb0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x4, 0xbf, 0xfd, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x8, 0xf7,
-    0x21, 0x4c, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf1, 0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0xc,
-    0xa0, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0,
-    0x0, 0xd9, 0x0, 0x0, 0x0, 0x3f, 0x30, 0x0,
-    0x0, 0x0, 0xda, 0x0, 0x0, 0x0, 0x2f, 0x30,
-    0x0, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x9e,
-    0x10, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x0, 0x0,
-    0xa, 0xa0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0,
-    0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0xab, 0x0,
-    0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf0,
-    0x0, 0x0, 0x0, 0xa, 0xb0, 0x0, 0xa, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x0, 0x0,
-    0x0, 0xd8, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe8, 0x0, 0x0, 0x0, 0x2f, 0x40,
-    0x1, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf2, 0x0, 0x0, 0xb, 0xc0, 0x0, 0xbd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xe6, 0x10,
-    0x3c, 0xe2, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xa2, 0x0,
-    0x2f, 0x70, 0x0, 0x4b, 0xff, 0xd8, 0x10, 0x0,
-    0x0, 0x0, 0x22, 0x0, 0x0, 0xc, 0xc0, 0x0,
-    0x7f, 0x94, 0x36, 0xdd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0x4f, 0x50, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x3, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x1,
-    0xf4, 0x0, 0x0, 0x0, 0xd, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x8e, 0x10, 0x0, 0x4f, 0x10, 0x0,
-    0x0, 0x0, 0xab, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x50, 0x0, 0x5, 0xf0, 0x0, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0x0, 0x0, 0xd, 0xa0, 0x0, 0x0,
-    0x4f, 0x10, 0x0, 0x0, 0x0, 0xab, 0x0, 0x0,
-    0x0, 0x9, 0xe1, 0x0, 0x0, 0x1, 0xf4, 0x0,
-    0x0, 0x0, 0xc, 0x90, 0x0, 0x0, 0x4, 0xf4,
-    0x0, 0x0, 0x0, 0xc, 0x90, 0x0, 0x0, 0x2,
-    0xf4, 0x0, 0x0, 0x1, 0xe9, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x30, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x0, 0xad, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x72, 0x14, 0xcd, 0x10, 0x0, 0x0, 0x5f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff, 0xd8,
-    0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x29, 0xdf, 0xfe, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf9,
-    0x76, 0x9e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xd1, 0x0, 0x0, 0x1c, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe1, 0x2c, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xef,
-    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xf9, 0x8f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe4, 0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc1, 0x0, 0x0, 0x9f, 0xa0,
-    0x0, 0x0, 0xd, 0x50, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0xaf, 0x90, 0x0, 0x3, 0xf5, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x8f, 0x10, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0xe, 0xb0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x66,
-    0xf5, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfc, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xef, 0x40, 0x0, 0x0, 0xaf, 0xc3,
-    0x0, 0x0, 0x0, 0x17, 0xef, 0x61, 0xef, 0x30,
-    0x0, 0x0, 0x7f, 0xfe, 0xa8, 0x89, 0xcf, 0xfc,
-    0x30, 0x2, 0xef, 0x30, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xec, 0x83, 0x0, 0x0, 0x2, 0xee, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x50,
-
-    /* U+0027 "'" */
-    0x5f, 0x45, 0xf4, 0x4f, 0x44, 0xf4, 0x4f, 0x34,
-    0xf3, 0x3f, 0x33, 0xf3, 0x3f, 0x20, 0x50,
-
-    /* U+0028 "(" */
-    0x0, 0x2, 0xf9, 0x0, 0xb, 0xf1, 0x0, 0x3f,
-    0x90, 0x0, 0x9f, 0x20, 0x0, 0xfc, 0x0, 0x5,
-    0xf6, 0x0, 0x9, 0xf1, 0x0, 0xe, 0xd0, 0x0,
-    0x1f, 0xa0, 0x0, 0x5f, 0x70, 0x0, 0x7f, 0x40,
-    0x0, 0xaf, 0x20, 0x0, 0xbf, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0xed, 0x0, 0x0, 0xfd, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0xfc, 0x0, 0x0, 0xfd, 0x0,
-    0x0, 0xed, 0x0, 0x0, 0xdf, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0xaf, 0x20, 0x0, 0x7f, 0x40, 0x0,
-    0x4f, 0x70, 0x0, 0x1f, 0xa0, 0x0, 0xe, 0xd0,
-    0x0, 0x9, 0xf1, 0x0, 0x4, 0xf6, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x2f, 0x90,
-    0x0, 0xb, 0xf1, 0x0, 0x2, 0xf9,
-
-    /* U+0029 ")" */
-    0x1e, 0xb0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0xde, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x7f, 0x50, 0x0, 0x6,
-    0xf6, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x4f, 0x80, 0x0, 0x4, 0xf7, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0xb, 0xf1, 0x0, 0x0, 0xee, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x4, 0xf7, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0xd, 0xe0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0xf, 0xb0, 0x0,
-    0x7, 0xf3, 0x0, 0x1, 0xeb, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x50, 0x0, 0x0, 0x2, 0x0, 0x0,
-    0xe5, 0x0, 0x2, 0x0, 0xed, 0x40, 0xe, 0x50,
-    0x8, 0xf6, 0x2, 0xaf, 0xa2, 0xe5, 0x6e, 0xe6,
-    0x0, 0x0, 0x3c, 0xff, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7f,
-    0xdf, 0xcf, 0xc3, 0x0, 0x5, 0xee, 0x60, 0xe5,
-    0x2b, 0xfa, 0x10, 0xd9, 0x10, 0xe, 0x50, 0x4,
-    0xd5, 0x0, 0x0, 0x0, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa4, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x39, 0x99, 0x99, 0x9d, 0xf9, 0x99, 0x99, 0x98,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x0, 0x7f, 0xa0, 0xef, 0xf1, 0x7f, 0xf0,
-    0xd, 0xa0, 0x1f, 0x60, 0x5f, 0x10, 0x8d, 0x0,
-    0xc8, 0x0,
-
-    /* U+002D "-" */
-    0x7a, 0xaa, 0xaa, 0xaa, 0xa4, 0xcf, 0xff, 0xff,
-    0xff, 0xf7,
-
-    /* U+002E "." */
-    0x0, 0x0, 0x8f, 0xb0, 0xef, 0xf1, 0x7f, 0xa0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0xda, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xdb,
-    0xbe, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf7, 0x10, 0x0, 0x2, 0xaf, 0xf3, 0x0, 0x0,
-    0x0, 0x5f, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xe2, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xb0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x5f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x5f, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe2, 0x0, 0x0,
-    0x0, 0x7f, 0xf7, 0x10, 0x0, 0x2, 0xaf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xdb, 0xbe,
-    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xbe, 0xff, 0xda, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xaf, 0xff, 0xff, 0xff, 0x57, 0xaa, 0xaa, 0xad,
-    0xf5, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x8f,
-    0x50, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0,
-    0x0, 0x8f, 0x50, 0x0, 0x0, 0x8, 0xf5, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x8,
-    0xf5, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x8f,
-    0x50,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x17, 0xbd, 0xff, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xdb, 0xbc, 0xef,
-    0xfd, 0x20, 0x0, 0x4, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x3a, 0xff, 0x20, 0x0, 0xef, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x2, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfc, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xa8, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-
-    /* U+0033 "3" */
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xac, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x86, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13,
-    0x7d, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x5,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x20, 0x8, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x29,
-    0xff, 0x50, 0x0, 0x3, 0xbf, 0xff, 0xdb, 0xbc,
-    0xef, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x27, 0xbe,
-    0xff, 0xfd, 0xa5, 0x0, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0xb, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0xf, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xb0, 0x0, 0x0, 0x8, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x4f, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf,
-    0xea, 0xaa, 0xaa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x3f, 0xda, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0x30, 0x0, 0x5, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xec, 0x95, 0x0, 0x0,
-    0x0, 0x3, 0xaa, 0xaa, 0xab, 0xbd, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x5, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x70, 0x3, 0xdf, 0xd7, 0x20, 0x0, 0x0, 0x5,
-    0xdf, 0xb0, 0x0, 0x0, 0x8e, 0xff, 0xec, 0xbb,
-    0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5, 0x9d,
-    0xef, 0xfe, 0xb7, 0x10, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x2, 0x7b, 0xef, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xfe, 0xca,
-    0xab, 0xdf, 0xfb, 0x0, 0x0, 0x0, 0x4e, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x63, 0x0, 0x0, 0x3,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x6,
-    0xbe, 0xff, 0xeb, 0x71, 0x0, 0x0, 0xf, 0xd0,
-    0x4, 0xef, 0xeb, 0x9a, 0xbf, 0xff, 0x70, 0x0,
-    0xf, 0xd0, 0x6f, 0xc3, 0x0, 0x0, 0x0, 0x5e,
-    0xf9, 0x0, 0xf, 0xd3, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x60, 0xf, 0xfb, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0xd, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0xa, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xd0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x50, 0x0, 0x0, 0xbf, 0xc4,
-    0x0, 0x0, 0x0, 0x5e, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xeb, 0x99, 0xbf, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xeb, 0x60,
-    0x0, 0x0,
-
-    /* U+0037 "7" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x4c, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaf, 0xf2, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x57, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x2, 0x7b, 0xef, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0xba, 0x9a,
-    0xcf, 0xfe, 0x60, 0x0, 0x0, 0xc, 0xfc, 0x40,
-    0x0, 0x0, 0x0, 0x6e, 0xf9, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x50,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x3, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x1, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x2e, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x2, 0xbf, 0xb5,
-    0x21, 0x11, 0x37, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xc8, 0x54, 0x34, 0x69, 0xef,
-    0xc2, 0x0, 0x0, 0x8f, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x40, 0x4, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe1, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf6, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0x4f, 0xf9, 0x20,
-    0x0, 0x0, 0x0, 0x4c, 0xfd, 0x20, 0x0, 0x2,
-    0xcf, 0xfe, 0xb9, 0x9a, 0xcf, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x3, 0x8c, 0xef, 0xff, 0xdb, 0x71,
-    0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x28, 0xcf, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfd, 0xa9, 0xac, 0xff,
-    0xd4, 0x0, 0x0, 0x1, 0xdf, 0xb2, 0x0, 0x0,
-    0x0, 0x6e, 0xf6, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xf4, 0x0, 0x4f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe0, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x70, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf2, 0xbf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x58, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf8, 0x2f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x7f,
-    0x90, 0x8f, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x92, 0xfa, 0x0, 0x9f, 0xf9, 0x41, 0x0, 0x26,
-    0xcf, 0xa0, 0x2f, 0xa0, 0x0, 0x5d, 0xff, 0xff,
-    0xff, 0xfd, 0x50, 0x2, 0xfa, 0x0, 0x0, 0x2,
-    0x68, 0x98, 0x63, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0,
-    0x0, 0x0, 0x74, 0x0, 0x0, 0x0, 0x6, 0xdf,
-    0xc1, 0x0, 0x0, 0x1f, 0xff, 0xca, 0xaa, 0xcf,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff,
-    0xfd, 0xa6, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x7f, 0xa0, 0xef, 0xf1, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0xef, 0xf1, 0x7f, 0xa0,
-
-    /* U+003B ";" */
-    0x7f, 0xa0, 0xef, 0xf1, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0xef, 0xf1, 0x7f, 0xf0, 0xd, 0xa0,
-    0x1f, 0x60, 0x5f, 0x10, 0x8d, 0x0, 0xc8, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x5, 0xbf, 0xfa, 0x40, 0x0,
-    0x0, 0x0, 0x18, 0xef, 0xd7, 0x10, 0x0, 0x0,
-    0x0, 0x4b, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x19, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xe8, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xaf, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7d, 0xfe, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xb5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xee,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-
-    /* U+003D "=" */
-    0x38, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+003E ">" */
-    0x46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xaf, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7d, 0xfe, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4a, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xe7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xef, 0xc5,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0x93, 0x0,
-    0x0, 0x0, 0x2, 0x8e, 0xfd, 0x60, 0x0, 0x0,
-    0x0, 0x5, 0xcf, 0xfa, 0x30, 0x0, 0x0, 0x0,
-    0x18, 0xef, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xfd, 0x94, 0x0,
-    0x0, 0x0, 0x3c, 0xff, 0xeb, 0xaa, 0xbe, 0xff,
-    0xc2, 0x0, 0x6, 0xff, 0x92, 0x0, 0x0, 0x0,
-    0x3b, 0xfe, 0x20, 0x2f, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x3, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xce,
-    0xff, 0xfe, 0xca, 0x62, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xda, 0x76, 0x66, 0x79, 0xcf, 0xfc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf,
-    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2b, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x3,
-    0x9d, 0xff, 0xeb, 0x60, 0x0, 0x2f, 0x80, 0x4,
-    0xf7, 0x0, 0x0, 0x0, 0xce, 0x10, 0x0, 0x0,
-    0x1a, 0xfe, 0x97, 0x67, 0xaf, 0xe4, 0x2, 0xf8,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x5f, 0x50, 0x0,
-    0x0, 0x2d, 0xf7, 0x0, 0x0, 0x0, 0x18, 0xf5,
-    0x2f, 0x80, 0x0, 0xe, 0xa0, 0x0, 0xc, 0xd0,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf5, 0xf8, 0x0, 0x0, 0x7f, 0x10, 0x2,
-    0xf6, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xef, 0x80, 0x0, 0x1, 0xf7,
-    0x0, 0x7f, 0x10, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0,
-    0xb, 0xb0, 0xb, 0xc0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x7f, 0x0, 0xda, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x5, 0xf1, 0xf, 0x80, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x3f, 0x20, 0xf7,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x3, 0xf3,
-    0xf, 0x70, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x3f, 0x20, 0xf8, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x4, 0xf1, 0xd, 0xa0, 0x0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x6f, 0x0, 0xad, 0x0, 0x0,
-    0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf8, 0x0, 0x0, 0x9, 0xd0, 0x7, 0xf1,
-    0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xdf, 0x80, 0x0, 0x0, 0xe9, 0x0,
-    0x2f, 0x60, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0xf9, 0x0, 0x0, 0x5f,
-    0x30, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x1d, 0xf9,
-    0x10, 0x0, 0x0, 0x2a, 0xf5, 0xe, 0xe1, 0x0,
-    0x1e, 0xb0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0xb8, 0x79, 0xcf, 0xe4, 0x0, 0x6f,
-    0xd8, 0x9e, 0xd1, 0x0, 0x0, 0xc, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x6d, 0xfe, 0x91, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xfd, 0x61, 0x0, 0x0, 0x0, 0x0, 0x3, 0x98,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xaf, 0xfd, 0xa8, 0x66, 0x78, 0xbe,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x9c, 0xef, 0xff,
-    0xdb, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0xa, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x4f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x20, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xa9, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x9e, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0xbf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x10, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0,
-
-    /* U+0042 "B" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x9, 0xfb, 0x99, 0x99, 0x99, 0x99,
-    0x9b, 0xdf, 0xfd, 0x30, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0x40, 0x9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf9, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x19, 0xfd, 0x10, 0x9, 0xfa, 0x99, 0x99, 0x99,
-    0x99, 0x9a, 0xdf, 0xe8, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
-    0x8d, 0xfb, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x9, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xb9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x99, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf2, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7f,
-    0xf6, 0x9, 0xfb, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0xbd, 0xff, 0xe5, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xc9, 0x50, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xc9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xdb, 0xbc, 0xef, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x30, 0x0, 0x0,
-    0x2, 0x7e, 0xfd, 0x20, 0x0, 0x0, 0x4f, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x10, 0x0, 0xe, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x20, 0x0, 0x0, 0x4f, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x30, 0x0, 0x0,
-    0x2, 0x7e, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xdb, 0xbc, 0xef, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xc9, 0x40, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x73,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xba, 0xaa, 0xaa,
-    0xaa, 0xab, 0xdf, 0xff, 0xc5, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xff, 0xb1, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xfe, 0x20, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe1, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe1, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xfe, 0x20, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xff, 0xb1, 0x0, 0x0, 0x9f, 0xba, 0xaa, 0xaa,
-    0xaa, 0xab, 0xdf, 0xff, 0xc5, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x83,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x9f, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa2, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xba, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa6, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc,
-
-    /* U+0046 "F" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x9f, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa2, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xca, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xa7, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xff,
-    0xda, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xff, 0xdb, 0xbc, 0xef, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xf9, 0x30, 0x0, 0x0,
-    0x1, 0x6c, 0xfe, 0x40, 0x0, 0x0, 0x3f, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xf1,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x30, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x61, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0xe, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x4f, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x30, 0x0, 0x0,
-    0x1, 0x6c, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xff, 0xdb, 0xbc, 0xef, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xfe,
-    0xda, 0x61, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xee, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xee, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe9, 0xfb, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xee, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe9, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xee, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xee, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-
-    /* U+0049 "I" */
-    0x9f, 0x39, 0xf3, 0x9f, 0x39, 0xf3, 0x9f, 0x39,
-    0xf3, 0x9f, 0x39, 0xf3, 0x9f, 0x39, 0xf3, 0x9f,
-    0x39, 0xf3, 0x9f, 0x39, 0xf3, 0x9f, 0x39, 0xf3,
-    0x9f, 0x39, 0xf3, 0x9f, 0x39, 0xf3, 0x9f, 0x39,
-    0xf3, 0x9f, 0x39, 0xf3, 0x9f, 0x30,
-
-    /* U+004A "J" */
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x6a, 0xaa, 0xaa, 0xaa, 0xac, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x3, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x3, 0xff, 0x81,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x2, 0xdf, 0xfc,
-    0xbb, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x5b, 0xef,
-    0xfd, 0x92, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfc, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x6, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x5, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x5, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x5, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x4, 0xfe, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x4, 0xfe, 0x27, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x34, 0xfe, 0x20, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0xfe,
-    0x20, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x30, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x9, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x1d, 0xf6, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf4, 0x0, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe2, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xd1, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-
-    /* U+004C "L" */
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xa7, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0,
-
-    /* U+004D "M" */
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf0, 0x9f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0x9, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf0, 0x9f, 0x8f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0xdf, 0x9, 0xf3, 0xbf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x1d,
-    0xf0, 0x9f, 0x32, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x80, 0xdf, 0x9, 0xf3,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0xd, 0xf0, 0x9f, 0x30, 0x1e, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0xdf, 0x9, 0xf3, 0x0, 0x6f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0xc, 0xf0, 0x9f,
-    0x30, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0xcf, 0x9, 0xf3, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0xc, 0xf0, 0x9f, 0x30, 0x0, 0xa, 0xf3, 0x0,
-    0x0, 0x0, 0xc, 0xe1, 0x0, 0x0, 0xcf, 0x9,
-    0xf3, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x6,
-    0xf6, 0x0, 0x0, 0xc, 0xf0, 0x9f, 0x30, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0xcf, 0x9, 0xf3, 0x0, 0x0, 0x0, 0xde,
-    0x10, 0x0, 0x8f, 0x30, 0x0, 0x0, 0xc, 0xf0,
-    0x9f, 0x30, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0xcf, 0x9, 0xf3, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0xb, 0xf1, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x2f, 0xb4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x80, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x0,
-
-    /* U+004E "N" */
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe9, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xee, 0x9f, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe9,
-    0xfc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x9f, 0x4c, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe9, 0xf3, 0x1e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x9f,
-    0x30, 0x4f, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe9, 0xf3, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xee, 0x9f, 0x30, 0x0, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe9, 0xf3,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x9f, 0x30, 0x0, 0x2, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0xe, 0xe9, 0xf3, 0x0, 0x0, 0x4,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0xee, 0x9f, 0x30,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0xe,
-    0xe9, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0,
-    0x0, 0x0, 0xee, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x0, 0x0, 0xe, 0xe9, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0xee,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe1,
-    0x0, 0xe, 0xe9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xb0, 0x0, 0xee, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0xe, 0xe9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x50, 0xee, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x2e, 0xe9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0xfe, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xe9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xe0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xc9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xef, 0xff, 0xdb, 0xbc, 0xef, 0xfe,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xf9, 0x30, 0x0, 0x0, 0x2, 0x8e, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0xd,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x6, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xd0, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x8f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x4f, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xf9, 0x30, 0x0, 0x0, 0x2, 0x8e, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
-    0xcb, 0xbc, 0xef, 0xfe, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xc9, 0x50, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb7, 0x20,
-    0x0, 0x0, 0x9f, 0xba, 0xaa, 0xaa, 0xaa, 0xbc,
-    0xff, 0xfb, 0x20, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xf4, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xfc, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x2, 0x59, 0xff, 0xb1, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x9f, 0xca, 0xaa, 0xaa, 0xaa, 0xa8, 0x62, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xc9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xfd, 0xbb, 0xce, 0xff,
-    0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xf9, 0x30, 0x0, 0x0, 0x2, 0x8e, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x1f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x0, 0x6, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x80, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x20, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x20, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x8f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xf9, 0x30, 0x0, 0x0, 0x2,
-    0x8e, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xfc, 0xbb, 0xce, 0xff, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x9c, 0xef, 0xff, 0xe9, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8e, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xef, 0xb5, 0x10, 0x15, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x78,
-    0x74, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb7, 0x20,
-    0x0, 0x0, 0x9f, 0xba, 0xaa, 0xaa, 0xaa, 0xbc,
-    0xff, 0xfb, 0x20, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xf4, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xfb, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x2, 0x59, 0xff, 0xa0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0,
-    0x9f, 0xba, 0xaa, 0xaa, 0xa9, 0x98, 0xfe, 0x10,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x20, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xc0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x2, 0x7b, 0xef, 0xff, 0xda, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xca, 0xaa,
-    0xdf, 0xff, 0xa2, 0x0, 0x0, 0x1d, 0xfc, 0x40,
-    0x0, 0x0, 0x0, 0x4b, 0xfd, 0x0, 0x0, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xb7, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xff, 0xb7, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6a,
-    0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0xf, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0x30, 0x4, 0xef, 0xd6, 0x10,
-    0x0, 0x0, 0x1, 0x7f, 0xf7, 0x0, 0x0, 0x18,
-    0xff, 0xfd, 0xba, 0xab, 0xdf, 0xfe, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0x9c, 0xef, 0xff, 0xda, 0x50,
-    0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x29, 0xaa, 0xaa, 0xaa, 0xaa, 0xef,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x6d, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x6d,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x6d, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x6d, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x6d, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x6d, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x6d, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x5c, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x38, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x4f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x70, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe1, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xf5, 0x0, 0x0,
-    0x1c, 0xfd, 0x61, 0x0, 0x0, 0x2, 0x9f, 0xf7,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0xbb, 0xce,
-    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7b,
-    0xef, 0xff, 0xd9, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x41, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x4,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf1, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x30, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0xd,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd1, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0057 "W" */
-    0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x7e, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xee, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x18, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf6, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x7f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x30, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x50, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x7, 0xf5, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x1,
-    0xfa, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0xcf,
-    0x10, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x2f, 0x90, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0xb, 0xf1, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0x8, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0xe, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x6f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfb, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x3, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf4, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x0, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xee, 0x20, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x60, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x30, 0x0, 0x1e,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfd, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfa, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe1, 0x1, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x3, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x1d, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe1,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x2f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x10,
-
-    /* U+0059 "Y" */
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x10, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x4,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x1f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8,
-    0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x7, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0xbf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0xe, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xca, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+005B "[" */
-    0x9f, 0xff, 0xff, 0x39, 0xfa, 0x88, 0x81, 0x9f,
-    0x30, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x9, 0xf3, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x9, 0xf3, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x9f, 0xa8, 0x88, 0x19, 0xff, 0xff, 0xf3,
-
-    /* U+005C "\\" */
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-
-    /* U+005D "]" */
-    0x2f, 0xff, 0xff, 0xa1, 0x88, 0x8a, 0xfa, 0x0,
-    0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x2f, 0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0,
-    0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x2f, 0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0,
-    0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa,
-    0x18, 0x88, 0xaf, 0xa2, 0xff, 0xff, 0xfa,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf9, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x30, 0xae, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xf5,
-    0x0, 0xc, 0xc0, 0x0, 0x0, 0x0, 0xae, 0x0,
-    0x0, 0x6f, 0x30, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0xe9, 0x0, 0x0, 0x7, 0xf1, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0xea, 0x0, 0x0, 0x0,
-    0x2f, 0x70, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0,
-    0xbd, 0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xb0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x10,
-
-    /* U+005F "_" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33,
-
-    /* U+0060 "`" */
-    0x38, 0x71, 0x0, 0x0, 0x7, 0xfd, 0x10, 0x0,
-    0x0, 0x4f, 0xe2, 0x0, 0x0, 0x2, 0xdf, 0x40,
-    0x0, 0x0, 0xa, 0xf5,
-
-    /* U+0061 "a" */
-    0x0, 0x1, 0x6b, 0xef, 0xfe, 0xb7, 0x0, 0x0,
-    0x1, 0x9f, 0xfe, 0xb9, 0x9b, 0xff, 0xe4, 0x0,
-    0x2e, 0xfb, 0x40, 0x0, 0x0, 0x7, 0xff, 0x20,
-    0xc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x17, 0xf6,
-    0x0, 0x29, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x6, 0xff, 0xa6, 0x54, 0x44, 0x44, 0x49, 0xf6,
-    0x4f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x2f, 0xe3, 0x0, 0x0, 0x0, 0x1a, 0xe8, 0xf6,
-    0x3, 0xef, 0xb7, 0x55, 0x7a, 0xfd, 0x25, 0xf6,
-    0x0, 0x7, 0xbe, 0xff, 0xeb, 0x50, 0x5, 0xf6,
-
-    /* U+0062 "b" */
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x39, 0xdf, 0xfe, 0xc7, 0x10,
-    0x0, 0x0, 0x3f, 0x90, 0x1a, 0xff, 0xca, 0xab,
-    0xff, 0xf7, 0x0, 0x0, 0x3f, 0x91, 0xdf, 0x81,
-    0x0, 0x0, 0x5, 0xef, 0xb0, 0x0, 0x3f, 0xac,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x40, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x3f, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x3f, 0x8c,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x3f, 0x81, 0xdf, 0x81, 0x0, 0x0, 0x5, 0xef,
-    0xb0, 0x0, 0x3f, 0x80, 0x1a, 0xff, 0xca, 0xab,
-    0xff, 0xf7, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x39,
-    0xdf, 0xfe, 0xc7, 0x10, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xc7, 0x10,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xda, 0xab, 0xef,
-    0xf7, 0x0, 0x0, 0x5, 0xff, 0x81, 0x0, 0x0,
-    0x5, 0xdf, 0x90, 0x0, 0x4f, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x7, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x4f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x5, 0xff, 0x81, 0x0, 0x0, 0x5, 0xdf,
-    0x90, 0x0, 0x0, 0x3d, 0xff, 0xda, 0xab, 0xef,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xdf, 0xfe,
-    0xc7, 0x10, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xa5, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x4d, 0xff, 0xca, 0xab,
-    0xff, 0xd3, 0x4, 0xf8, 0x0, 0x6, 0xff, 0x81,
-    0x0, 0x0, 0x5, 0xef, 0x44, 0xf8, 0x0, 0x4f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0xf8,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf8, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0xf8, 0x0, 0x4f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0xf8,
-    0x0, 0x6, 0xff, 0x81, 0x0, 0x0, 0x5, 0xef,
-    0x44, 0xf8, 0x0, 0x0, 0x4d, 0xff, 0xca, 0xab,
-    0xff, 0xd3, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x5a,
-    0xef, 0xfe, 0xb5, 0x0, 0x4, 0xf8,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xeb, 0x9a, 0xcf,
-    0xfa, 0x10, 0x0, 0x0, 0x7, 0xfe, 0x50, 0x0,
-    0x0, 0x2a, 0xfd, 0x10, 0x0, 0x5, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x1, 0xee,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x41, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x3f, 0x91, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x2f, 0xa3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3f,
-    0xb4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x30, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x20,
-    0x0, 0x5, 0xff, 0x92, 0x0, 0x0, 0x1, 0x8f,
-    0xe2, 0x0, 0x0, 0x3, 0xcf, 0xfd, 0xba, 0xbd,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x49, 0xdf,
-    0xff, 0xc9, 0x30, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x5b, 0xff, 0xea, 0x30, 0x0,
-    0x0, 0x8, 0xff, 0xa9, 0xae, 0xe0, 0x0, 0x0,
-    0x3f, 0xd1, 0x0, 0x0, 0x40, 0x0, 0x0, 0x9f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x29,
-    0x99, 0xef, 0x99, 0x99, 0x98, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x5b, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0xfb, 0x0, 0x0, 0x5e, 0xfe, 0xa8, 0x89,
-    0xcf, 0xf6, 0x0, 0xfb, 0x0, 0x8, 0xfe, 0x50,
-    0x0, 0x0, 0x1, 0x9f, 0x90, 0xfb, 0x0, 0x6f,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0xfb,
-    0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfb, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfb, 0x0, 0x6f, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xfb, 0x0, 0x7,
-    0xff, 0x71, 0x0, 0x0, 0x3, 0xbf, 0x91, 0xfb,
-    0x0, 0x0, 0x4e, 0xff, 0xca, 0xab, 0xef, 0xe6,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe,
-    0xb6, 0x10, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0xae, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x6f,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x5d, 0xfa, 0x0,
-    0x0, 0x2, 0xaf, 0xff, 0xca, 0xaa, 0xcf, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff,
-    0xeb, 0x71, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x6b, 0xef, 0xfe, 0xa5, 0x0,
-    0x0, 0x3f, 0x90, 0x4e, 0xfe, 0xba, 0xad, 0xff,
-    0xc2, 0x0, 0x3f, 0x94, 0xfc, 0x40, 0x0, 0x0,
-    0x2b, 0xfe, 0x10, 0x3f, 0xbf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x3f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa,
-
-    /* U+0069 "i" */
-    0x5f, 0xb0, 0xbf, 0xf2, 0x4d, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90,
-    0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90,
-    0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90,
-    0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90,
-    0x3f, 0x90, 0x3f, 0x90, 0x3f, 0x90,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x3, 0xed, 0x10, 0x0, 0x0,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xdc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x40, 0x0, 0x1, 0xdf, 0x30,
-    0xf, 0xfa, 0x9a, 0xff, 0x80, 0x0, 0x3a, 0xef,
-    0xfc, 0x50, 0x0,
-
-    /* U+006B "k" */
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x60, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xf5, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0x50, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x3e, 0xf4, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x4, 0xff, 0x40, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x5f, 0xe3, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x6, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x9, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0xaf, 0xb2, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x3f, 0xab, 0xfb, 0x0, 0x3f, 0xe2,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x90, 0x0, 0x6,
-    0xfd, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x30, 0x0, 0x3f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfc,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf5,
-
-    /* U+006C "l" */
-    0x3f, 0x93, 0xf9, 0x3f, 0x93, 0xf9, 0x3f, 0x93,
-    0xf9, 0x3f, 0x93, 0xf9, 0x3f, 0x93, 0xf9, 0x3f,
-    0x93, 0xf9, 0x3f, 0x93, 0xf9, 0x3f, 0x93, 0xf9,
-    0x3f, 0x93, 0xf9, 0x3f, 0x93, 0xf9, 0x3f, 0x93,
-    0xf9, 0x3f, 0x93, 0xf9, 0x3f, 0x93, 0xf9, 0x3f,
-    0x90,
-
-    /* U+006D "m" */
-    0x3f, 0x80, 0x1, 0x7b, 0xef, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x3f, 0x80, 0x5e, 0xfb, 0x87, 0x8c, 0xff, 0x90,
-    0x0, 0x1c, 0xfe, 0xa8, 0x8a, 0xef, 0xd3, 0x0,
-    0x3f, 0x86, 0xf9, 0x10, 0x0, 0x0, 0x2d, 0xf9,
-    0x2, 0xee, 0x50, 0x0, 0x0, 0x7, 0xfe, 0x20,
-    0x3f, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x4d, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfa,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-
-    /* U+006E "n" */
-    0x3f, 0x80, 0x0, 0x6b, 0xef, 0xfe, 0xa5, 0x0,
-    0x0, 0x3f, 0x80, 0x4e, 0xfc, 0x97, 0x8a, 0xff,
-    0xc2, 0x0, 0x3f, 0x85, 0xfa, 0x20, 0x0, 0x0,
-    0x8, 0xfe, 0x10, 0x3f, 0xaf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x90, 0x3f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x3f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xca, 0xab,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x5, 0xff, 0x81,
-    0x0, 0x0, 0x5, 0xdf, 0xa0, 0x0, 0x0, 0x4f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x40, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x4f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x5, 0xff, 0x81, 0x0, 0x0, 0x5, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xca, 0xab,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xdf, 0xfe, 0xb7, 0x10, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x3f, 0x80, 0x0, 0x39, 0xdf, 0xfe, 0xc7, 0x10,
-    0x0, 0x0, 0x3f, 0x80, 0x1a, 0xff, 0xca, 0xab,
-    0xff, 0xf7, 0x0, 0x0, 0x3f, 0x81, 0xdf, 0x81,
-    0x0, 0x0, 0x5, 0xef, 0xb0, 0x0, 0x3f, 0x9c,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x3f, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x40, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x3f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x3f, 0xac,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x3f, 0x91, 0xdf, 0x81, 0x0, 0x0, 0x5, 0xef,
-    0xb0, 0x0, 0x3f, 0x90, 0x1a, 0xff, 0xca, 0xab,
-    0xff, 0xf7, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x39,
-    0xdf, 0xfe, 0xc7, 0x10, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xb5, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x4d, 0xff, 0xca, 0xab,
-    0xff, 0xd3, 0x4, 0xf8, 0x0, 0x6, 0xff, 0x81,
-    0x0, 0x0, 0x5, 0xef, 0x44, 0xf8, 0x0, 0x4f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0xf8,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0xf8, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf8, 0x0, 0x4f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0xf8,
-    0x0, 0x6, 0xff, 0x81, 0x0, 0x0, 0x5, 0xef,
-    0x44, 0xf8, 0x0, 0x0, 0x4d, 0xff, 0xca, 0xab,
-    0xff, 0xd3, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x5a,
-    0xef, 0xfe, 0xa5, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8,
-
-    /* U+0072 "r" */
-    0x3f, 0x80, 0x1, 0x7c, 0xeb, 0x3f, 0x80, 0x6f,
-    0xfc, 0xa6, 0x3f, 0x86, 0xfa, 0x10, 0x0, 0x3f,
-    0xaf, 0x70, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x2, 0x8c, 0xef, 0xfe, 0xb7, 0x20, 0x0,
-    0x7, 0xff, 0xda, 0x9a, 0xbe, 0xff, 0xa1, 0x6,
-    0xfd, 0x30, 0x0, 0x0, 0x3, 0xae, 0x0, 0xee,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x10, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfc, 0x85,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xff,
-    0xeb, 0x61, 0x0, 0x0, 0x0, 0x0, 0x25, 0x8b,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe4, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb,
-    0xcf, 0xc5, 0x0, 0x0, 0x0, 0x5, 0xef, 0x31,
-    0x9f, 0xff, 0xca, 0x99, 0xbe, 0xfe, 0x40, 0x0,
-    0x16, 0xad, 0xff, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x29, 0x99, 0xef, 0x99, 0x99,
-    0x98, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd1,
-    0x0, 0x1, 0x40, 0x0, 0x0, 0x9, 0xff, 0xa8,
-    0xaf, 0xe0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xea,
-    0x20,
-
-    /* U+0075 "u" */
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x6f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x6f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0xf4,
-    0x0, 0xbf, 0xd4, 0x0, 0x0, 0x2, 0xbf, 0x67,
-    0xf4, 0x0, 0xa, 0xff, 0xeb, 0xaa, 0xdf, 0xf6,
-    0x7, 0xf4, 0x0, 0x0, 0x39, 0xdf, 0xff, 0xc7,
-    0x10, 0x7, 0xf4,
-
-    /* U+0076 "v" */
-    0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xa3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x5f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x50, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0,
-    0x0, 0x4f, 0x80, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x7,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0,
-    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x71,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x3f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x50, 0x0, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x5, 0xf5, 0x5, 0xf6, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0xe, 0xc0, 0x0,
-    0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x7, 0xf3, 0x0, 0x2, 0xf8, 0x0, 0x0,
-    0x2, 0xf7, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0xdc, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0xbe, 0x0, 0x0,
-    0x3f, 0x60, 0x0, 0x0, 0x6f, 0x40, 0x0, 0xe,
-    0xb0, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x4, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xf0, 0x0, 0xaf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x5f, 0x40,
-    0x0, 0x0, 0x0, 0x4f, 0x60, 0x1f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf7, 0xb, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xdc, 0x6, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xc1, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0xcd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xaf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xaf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xe1, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x40, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x0, 0x2, 0xfe, 0x10, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x2, 0xed, 0x10, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x40, 0x9f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xe7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x91,
-    0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xe2, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x10, 0x1, 0xee, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8,
-
-    /* U+0079 "y" */
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x0, 0xcf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xed, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0xee, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x20, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xee, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xaf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0,
-    0x0, 0x3e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xea, 0x9c, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xbf, 0xfe, 0x92, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf9, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x2a, 0xef, 0xb0, 0x0, 0x2f, 0xfb,
-    0x96, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0xee, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x68, 0xdf, 0x60, 0x0, 0xc, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0xee,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0xee, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0,
-    0x0, 0x2, 0xff, 0xb8, 0x60, 0x0, 0x2, 0xae,
-    0xfb,
-
-    /* U+007C "|" */
-    0x9f, 0x19, 0xf1, 0x9f, 0x19, 0xf1, 0x9f, 0x19,
-    0xf1, 0x9f, 0x19, 0xf1, 0x9f, 0x19, 0xf1, 0x9f,
-    0x19, 0xf1, 0x9f, 0x19, 0xf1, 0x9f, 0x19, 0xf1,
-    0x9f, 0x19, 0xf1, 0x9f, 0x19, 0xf1, 0x9f, 0x19,
-    0xf1, 0x9f, 0x19, 0xf1, 0x9f, 0x19, 0xf1, 0x9f,
-    0x19, 0xf1, 0x9f, 0x19, 0xf1, 0x9f, 0x19, 0xf1,
-    0x9f, 0x19, 0xf1,
-
-    /* U+007D "}" */
-    0x2f, 0xfd, 0x70, 0x0, 0x0, 0x18, 0x9e, 0xfa,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0,
-    0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0xd, 0xfa, 0x82, 0x0, 0x0, 0x6,
-    0xff, 0xf4, 0x0, 0x0, 0x2f, 0xd1, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0,
-    0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x1, 0xdf, 0x20, 0x0,
-    0x18, 0x9e, 0xfa, 0x0, 0x0, 0x2f, 0xfd, 0x70,
-    0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0, 0x8, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x3,
-    0xf1, 0x9, 0xf9, 0x57, 0xee, 0x20, 0x0, 0x0,
-    0x6f, 0x2, 0xf6, 0x0, 0x1, 0xde, 0x30, 0x0,
-    0xc, 0xa0, 0x7e, 0x0, 0x0, 0x1, 0xcf, 0x72,
-    0x3b, 0xf2, 0x9, 0xa0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe5, 0x0, 0x33, 0x0, 0x0, 0x0, 0x0,
-    0x14, 0x40, 0x0, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x0, 0x86, 0x0, 0x0, 0x86, 0x0,
-    0x0, 0xa, 0xf2, 0x0, 0xa, 0xf2, 0x0, 0x0,
-    0x6f, 0x50, 0x0, 0x6f, 0x60, 0x0, 0x3, 0xf9,
-    0x0, 0x3, 0xf9, 0x0, 0x0, 0x1e, 0xc0, 0x0,
-    0x1e, 0xd0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0xbf,
-    0x20, 0x0, 0x8, 0xf5, 0x0, 0x8, 0xf5, 0x0,
-    0x0, 0xd, 0xe1, 0x0, 0xd, 0xe1, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0xce,
-    0x10, 0x0, 0xce, 0x10, 0x0, 0x0, 0x1e, 0xc0,
-    0x0, 0x1e, 0xc0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x3, 0xf8,
-
-    /* U+00BB "»" */
-    0x28, 0x30, 0x0, 0x28, 0x30, 0x0, 0x0, 0xb,
-    0xe1, 0x0, 0xb, 0xe1, 0x0, 0x0, 0x1, 0xec,
-    0x0, 0x1, 0xec, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x6, 0xf5, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0,
-    0xaf, 0x20, 0x0, 0x0, 0xd, 0xd0, 0x0, 0xd,
-    0xd0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x4f, 0x70, 0x0,
-    0x2, 0xfb, 0x0, 0x2, 0xeb, 0x0, 0x0, 0xc,
-    0xd1, 0x0, 0xc, 0xd1, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x9f, 0x30, 0x0, 0x6, 0xf5, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x2f, 0x90,
-    0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x1, 0x78, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x7f, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xca, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xca,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x2e, 0xc0, 0x0, 0xd, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x60, 0x0, 0x6,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7f,
-    0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa4,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa8, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xca, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0402 "Ђ" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x6a, 0xaa,
-    0xaa, 0xaa, 0xad, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x48, 0xbd, 0xff, 0xec, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0xaf, 0xff, 0xeb, 0xaa, 0xbe, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x51,
-    0x0, 0x0, 0x0, 0x3b, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x1b, 0x98, 0x8a, 0xef, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x72, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x7f, 0xca, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0x17, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xec,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xfc, 0xbb, 0xcf, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0x93, 0x0, 0x0, 0x0, 0x27, 0xef,
-    0xc2, 0x0, 0x2, 0xef, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x1e, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xa8, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x87, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xaf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x72, 0x0,
-    0x2, 0xef, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xfb, 0x0, 0x0, 0x1c, 0xff, 0x93, 0x0,
-    0x0, 0x0, 0x39, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x6e, 0xff, 0xfc, 0xbb, 0xdf, 0xff, 0xd5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xeb,
-    0x83, 0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x16, 0xbd, 0xff, 0xfe, 0xb7, 0x20,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xca, 0xaa, 0xcf,
-    0xff, 0xb3, 0x0, 0x0, 0xaf, 0xe6, 0x0, 0x0,
-    0x0, 0x3, 0x9f, 0xf1, 0x0, 0x6f, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xc8, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9e, 0xff, 0xfc,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x6a, 0xef, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x39, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x33, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xc,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x2d, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xa0, 0x0, 0x6, 0xdf, 0xfe, 0xba, 0xaa,
-    0xcf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x38, 0xce,
-    0xff, 0xfd, 0xb6, 0x10, 0x0, 0x0,
-
-    /* U+0406 "І" */
-    0x7f, 0x67, 0xf6, 0x7f, 0x67, 0xf6, 0x7f, 0x67,
-    0xf6, 0x7f, 0x67, 0xf6, 0x7f, 0x67, 0xf6, 0x7f,
-    0x67, 0xf6, 0x7f, 0x67, 0xf6, 0x7f, 0x67, 0xf6,
-    0x7f, 0x67, 0xf6, 0x7f, 0x67, 0xf6, 0x7f, 0x67,
-    0xf6, 0x7f, 0x67, 0xf6, 0x7f, 0x60,
-
-    /* U+0407 "Ї" */
-    0xb, 0xe3, 0x0, 0x8, 0xf6, 0xf, 0xf6, 0x0,
-    0xd, 0xfa, 0x5, 0x80, 0x0, 0x3, 0x92, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x7a, 0xaa, 0xaa, 0xaa, 0xac, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x4, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0xee, 0x20,
-    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x4, 0xff, 0x70,
-    0x0, 0x0, 0x7f, 0xf2, 0x0, 0x4, 0xef, 0xfc,
-    0xbb, 0xef, 0xf4, 0x0, 0x0, 0x0, 0x6b, 0xef,
-    0xfd, 0x81, 0x0, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfd, 0x88, 0x88, 0x88, 0x88, 0x9b, 0xef, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x0,
-    0x0, 0x0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xb0, 0x0, 0x4, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xef, 0xd1, 0x7,
-    0xcd, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xec, 0xcc, 0xcc, 0xcc, 0xcd,
-    0xef, 0xff, 0x90, 0x0, 0x8f, 0xfc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xb7, 0x20, 0x0,
-    0x0,
-
-    /* U+040A "Њ" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xca,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xdf,
-    0xda, 0xaa, 0xaa, 0xaa, 0xaa, 0x86, 0x10, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x20, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0x37, 0xdf, 0xf4, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x20, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xa0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0x20, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7f, 0xf5, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc8,
-    0x88, 0x88, 0x88, 0x89, 0xcf, 0xfd, 0x40, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,
-    0x50, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x8a, 0xaa,
-    0xaa, 0xaa, 0xae, 0xfb, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x1, 0x59, 0xce, 0xff, 0xec, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0xbf, 0xff, 0xdb, 0xaa, 0xcf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfa, 0x51,
-    0x0, 0x0, 0x0, 0x5e, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x85, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x20, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd1, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x2, 0xed, 0x10, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xca, 0xaa,
-    0xaa, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x70, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x40, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x10, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfc, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf3, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe1, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x3, 0x87, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xec,
-    0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x4a, 0xf2, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0xa, 0xf2, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0xa, 0xf2,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50,
-    0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0xa,
-    0xf2, 0x7f, 0x60, 0x0, 0x0, 0x4, 0xfe, 0x10,
-    0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0,
-    0x1e, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f,
-    0x60, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x7f, 0x60, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0,
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x7f, 0x60, 0x3, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x7f, 0x60, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x7f, 0x68, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x7f, 0xaf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x3,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x30, 0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf7, 0x10, 0x3, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5,
-    0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfa, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x60, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0xa, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xda, 0xbe, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xfd,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x77, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf7, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x77,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x77, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x77, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x77, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf7, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x77, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x77, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf7, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x77, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x77, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf7, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x77,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x77, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x77, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xac, 0xf7, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xea, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x82, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x10, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xa0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x7,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x60, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd9, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x9b, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x80, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf7,
-
-    /* U+0411 "Б" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x7f, 0xca, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x50, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xb8, 0x88, 0x88,
-    0x88, 0x88, 0x75, 0x20, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x24, 0x9e,
-    0xfc, 0x10, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xc0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xee, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x29, 0xff, 0x30, 0x7f, 0xb8,
-    0x88, 0x88, 0x88, 0x89, 0xad, 0xff, 0xc2, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x83,
-    0x0, 0x0,
-
-    /* U+0412 "В" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x82,
-    0x0, 0x0, 0x7, 0xfb, 0x88, 0x88, 0x88, 0x88,
-    0x9a, 0xef, 0xf9, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0xfc, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf7, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0xf7, 0x0, 0x7, 0xfb, 0x88, 0x88, 0x88,
-    0x88, 0x8a, 0xdf, 0xb3, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x71, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0xaf, 0xe4, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xf3, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x27, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x57,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x17, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf,
-    0xd1, 0x7, 0xfb, 0x88, 0x88, 0x88, 0x88, 0x89,
-    0xbe, 0xff, 0xa1, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xb8, 0x20, 0x0, 0x0,
-
-    /* U+0413 "Г" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x27, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa1, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10,
-    0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x6, 0xbd,
-    0xff, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xef, 0xba, 0xaa, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xaf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xaf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xaf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf0,
-
-    /* U+0415 "Е" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x7f, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xca, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa8, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe,
-
-    /* U+0416 "Ж" */
-    0x1, 0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x20, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x1,
-    0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xfd, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0xf,
-    0xd0, 0x0, 0x0, 0x1e, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xca, 0xaa,
-    0xaa, 0xff, 0xaa, 0xaa, 0xad, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x4,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0xfd,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf3, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x80,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x16, 0xad, 0xff, 0xfe, 0xc8, 0x30,
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0xfd, 0xba, 0xac,
-    0xef, 0xfc, 0x30, 0x0, 0x5, 0xff, 0x94, 0x0,
-    0x0, 0x0, 0x3, 0xaf, 0xf4, 0x0, 0x1, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x25, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x99, 0x99, 0x99, 0xbd, 0xff,
-    0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x29, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf4, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xb0, 0x1c, 0xfe, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xfc, 0x10, 0x0, 0x6d,
-    0xff, 0xfc, 0xaa, 0xab, 0xcf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x37, 0xbd, 0xff, 0xff, 0xda, 0x61,
-    0x0, 0x0,
-
-    /* U+0418 "И" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xec, 0xf2, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x4a, 0xf2, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0xa, 0xf2, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0xa, 0xf2,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x50, 0x0, 0xa, 0xf2, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xa,
-    0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xb0,
-    0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0,
-    0x4, 0xfe, 0x10, 0x0, 0x0, 0xa, 0xf2, 0x7f,
-    0x60, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x7f, 0x60, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x7f, 0x60, 0x3, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x7f, 0x60, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x7f, 0x68, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f,
-    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0x6, 0x50, 0x0, 0x0, 0x0, 0x18,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf5, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x82, 0x0, 0x4c,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x22, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xec,
-    0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x4a, 0xf2, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0xa, 0xf2, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0xa, 0xf2,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50,
-    0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0xa,
-    0xf2, 0x7f, 0x60, 0x0, 0x0, 0x4, 0xfe, 0x10,
-    0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0, 0x0,
-    0x1e, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f,
-    0x60, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x7f, 0x60, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60, 0x0,
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x7f, 0x60, 0x3, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x7f, 0x60, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x60,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x7f, 0x68, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x7f, 0xaf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-
-    /* U+041A "К" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xf2, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x10, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x2e, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0xd, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0xaa, 0xaa, 0xad,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0xc, 0xf7, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe1, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x30, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x10, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xf,
-    0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xf9,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0xf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x4f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x7f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x8f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0xaf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x4f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x4, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x7c, 0xdf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x8f, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9,
-
-    /* U+041C "М" */
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x27, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x27, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x7f, 0x8f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xec, 0xaf, 0x27, 0xf5, 0x9f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x3a,
-    0xf2, 0x7f, 0x51, 0xed, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xa0, 0xaf, 0x27, 0xf5,
-    0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf1, 0xa, 0xf2, 0x7f, 0x50, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0xaf, 0x27, 0xf5, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0xa, 0xf2, 0x7f,
-    0x50, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x50, 0x0, 0xaf, 0x27, 0xf5, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0xa, 0xf2, 0x7f, 0x50, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0xaf, 0x27,
-    0xf5, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x50, 0x0,
-    0x0, 0x5f, 0x80, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0xaf, 0x27, 0xf5, 0x0, 0x0, 0x0, 0xbf,
-    0x20, 0x0, 0x6f, 0x60, 0x0, 0x0, 0xa, 0xf2,
-    0x7f, 0x50, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x1e,
-    0xc0, 0x0, 0x0, 0x0, 0xaf, 0x27, 0xf5, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x7f, 0x50, 0x0, 0x0, 0x0,
-    0xe, 0xd3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x27, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x7f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x27, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x27, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x7f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20,
-
-    /* U+041D "Н" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x7f, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xae, 0xf1, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xdb, 0xbc, 0xef, 0xff, 0xa2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xa4,
-    0x0, 0x0, 0x0, 0x16, 0xdf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xf9, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xf8, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf5,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x60, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x4b, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x6b,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x9f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x46, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x4, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xf8, 0x0, 0x0, 0x0, 0x1d, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xa4, 0x0, 0x0,
-    0x0, 0x16, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xcf, 0xff, 0xdb, 0xbc, 0xef, 0xff,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbe, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+041F "П" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x7f, 0xca, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xad, 0xf4, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf4,
-
-    /* U+0420 "Р" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x7f, 0xca, 0xaa, 0xaa, 0xaa, 0xbc,
-    0xef, 0xfc, 0x30, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x9f, 0xf6, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x40,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xa0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfe, 0x10, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0x48, 0xef, 0xd2, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x0, 0x0,
-    0x7f, 0xca, 0xaa, 0xaa, 0xaa, 0xa9, 0x63, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf,
-    0xff, 0xdb, 0xbc, 0xef, 0xff, 0x91, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x15,
-    0xcf, 0xe4, 0x0, 0x0, 0x1d, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xf1, 0x0, 0xd,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x24, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x24, 0x0, 0x0, 0x1d, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0xf1, 0x0, 0x0, 0x1a,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x15, 0xcf, 0xe4,
-    0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xdb, 0xbc,
-    0xef, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbe, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-
-    /* U+0422 "Т" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x56, 0xaa, 0xaa, 0xaa, 0xaa, 0xdf,
-    0xca, 0xaa, 0xaa, 0xaa, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf5, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0x0, 0x4f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xd0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfd, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x2, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x3f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0xce, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xda, 0xbe,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xcf, 0xfd, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x15, 0x9b, 0xdf, 0xff, 0xfe, 0xdb, 0x84,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a,
-    0xff, 0xfd, 0xb9, 0xcf, 0xa9, 0xbd, 0xff, 0xe8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xa4,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x16, 0xcf, 0xf7,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xb2, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x3, 0xdf, 0xa0,
-    0x0, 0x0, 0x1d, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
-    0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x2,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x8, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x8,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x2, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0x1d, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0xa, 0xfa, 0x0, 0x0, 0x2, 0xdf, 0xb2, 0x0,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x3, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xa5, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x15, 0xbf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xfd, 0xb9,
-    0xcf, 0xa9, 0xbd, 0xff, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x9b, 0xdf, 0xff,
-    0xfe, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x1, 0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x4f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xe1,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x1e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf3, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xa0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfc, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb1,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x10, 0x3f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfc, 0x0, 0x0, 0x0, 0x1e, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
-    0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x20, 0x1, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8,
-
-    /* U+0426 "Ц" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x70, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf7, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf7, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x70,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x70, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x70, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x70, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf7, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x7,
-    0xfc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xac, 0xfd, 0xaa, 0xa5, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x80,
-
-    /* U+0427 "Ч" */
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x23, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x3f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x23,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x23, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x3f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x23, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x21, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf2, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x20, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x1, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
-    0x20, 0x4, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x4,
-    0x8e, 0xff, 0xf2, 0x0, 0x3, 0xdf, 0xfe, 0xca,
-    0xab, 0xdf, 0xff, 0xc6, 0xcf, 0x20, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xec, 0x96, 0x10, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20,
-
-    /* U+0428 "Ш" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xd7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xd7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xd7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd7, 0xfc, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xab, 0xfe, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xfd, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0,
-
-    /* U+0429 "Щ" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xd0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xd0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xd0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xd0, 0x0, 0x7, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xab, 0xfe, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xff, 0xaa, 0xa8, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0,
-
-    /* U+042A "Ъ" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6a, 0xaa,
-    0xaa, 0xaa, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa8, 0x88, 0x88, 0x88, 0x89, 0xcf, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa8,
-    0x88, 0x88, 0x88, 0x9a, 0xcf, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0x50, 0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x37, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x37, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x37, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x37, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xb8, 0x20, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x7f,
-    0xb8, 0x88, 0x88, 0x88, 0x89, 0xbe, 0xff, 0xa1,
-    0x0, 0x0, 0x0, 0x9f, 0x37, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xcf, 0xd1, 0x0, 0x0,
-    0x9, 0xf3, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x9f, 0x37,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0x9, 0xf3, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0,
-    0x0, 0x9f, 0x37, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x9, 0xf3,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x9f, 0x37, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0x9, 0xf3, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x9f,
-    0x37, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x60, 0x0, 0x9, 0xf3, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1,
-    0x0, 0x0, 0x9f, 0x37, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x9,
-    0xf3, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0xfb, 0x0, 0x0, 0x0, 0x9f, 0x37, 0xfb,
-    0x88, 0x88, 0x88, 0x88, 0x9b, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x30,
-
-    /* U+042C "Ь" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0x82, 0x0, 0x0, 0x7f, 0xb8, 0x88, 0x88,
-    0x88, 0x89, 0xbe, 0xff, 0xa1, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xfd, 0x10,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xb0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfb, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf1, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0xfb, 0x0, 0x7f, 0xb8,
-    0x88, 0x88, 0x88, 0x89, 0xbf, 0xff, 0x70, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x61,
-    0x0, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x0, 0x27, 0xad, 0xff, 0xfd, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xdc,
-    0xbc, 0xdf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xa4, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xf5,
-    0x0, 0x0, 0x5, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0, 0x4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x38, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5,
-    0x0, 0x5, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf7, 0x0, 0x0, 0x7, 0xff, 0xb5,
-    0x10, 0x0, 0x0, 0x16, 0xdf, 0xf5, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xff, 0xdc, 0xbb, 0xdf, 0xff,
-    0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xad,
-    0xff, 0xfd, 0xb7, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x6a, 0xdf, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xfe, 0xcb, 0xce, 0xff, 0xe7, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0xfd, 0x61, 0x0, 0x0, 0x2, 0x8e, 0xfd, 0x30,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x30, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x4f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x1e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x7, 0xf6, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd0, 0x7f, 0x60, 0x0, 0x0,
-    0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x37, 0xf6, 0x0, 0x0,
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf7, 0x7f, 0x60, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xa7, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x7f, 0xdb,
-    0xbb, 0xbb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd7, 0xf6,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x7f,
-    0x60, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa7,
-    0xf6, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x7f, 0x60, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x37, 0xf6, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xd0, 0x7f, 0x60, 0x0, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x1e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x4f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x30, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x4e, 0xfd, 0x61, 0x0, 0x0, 0x2, 0x7e,
-    0xfd, 0x30, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0xff, 0xfd, 0xcb, 0xce, 0xff,
-    0xe7, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x1, 0x9f, 0xff, 0xcb, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xfd, 0x0, 0x1d, 0xfc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x1, 0xef, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x3f, 0xf9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x2,
-    0xcf, 0xfd, 0xa9, 0x99, 0x99, 0x99, 0x99, 0xfd,
-    0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd,
-
-    /* U+0430 "а" */
-    0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb7, 0x0, 0x0,
-    0x1, 0x9f, 0xfe, 0xb9, 0x9b, 0xff, 0xe3, 0x0,
-    0x2e, 0xfb, 0x40, 0x0, 0x0, 0x8, 0xff, 0x20,
-    0xc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x18, 0xf5,
-    0x0, 0x29, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x7, 0xff, 0x96, 0x54, 0x44, 0x44, 0x4a, 0xf5,
-    0x4f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
-    0x2f, 0xe3, 0x0, 0x0, 0x0, 0x1a, 0xe8, 0xf5,
-    0x4, 0xef, 0xb7, 0x55, 0x7a, 0xfd, 0x26, 0xf5,
-    0x0, 0x17, 0xce, 0xff, 0xea, 0x50, 0x6, 0xf5,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x7a, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x7b, 0xff, 0xff, 0xd9, 0x40, 0x0, 0x0,
-    0x0, 0x18, 0xef, 0xff, 0xc8, 0x41, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xd8, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x18,
-    0xce, 0xff, 0xd9, 0x30, 0x0, 0x0, 0xf, 0xc0,
-    0x8, 0xff, 0xda, 0xab, 0xef, 0xfb, 0x10, 0x0,
-    0x2f, 0x90, 0xbf, 0x91, 0x0, 0x0, 0x3, 0xcf,
-    0xe2, 0x0, 0x4f, 0x79, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x0, 0x5f, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x5f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x1f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0xcf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x5, 0xff, 0x91, 0x0, 0x0,
-    0x3, 0xbf, 0xc1, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xc9, 0x9a, 0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+0432 "в" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0,
-    0x1, 0xfd, 0x77, 0x77, 0x77, 0x8a, 0xef, 0xd2,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xd0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x1f, 0xb1, 0x11, 0x11,
-    0x12, 0x49, 0xfb, 0x10, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x20, 0x0, 0x1f, 0xc4, 0x44,
-    0x44, 0x44, 0x58, 0xdf, 0x90, 0x1, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x21,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xf7,
-    0x1, 0xfd, 0x77, 0x77, 0x77, 0x79, 0xcf, 0xf9,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x93,
-    0x0, 0x0,
-
-    /* U+0433 "г" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f,
-    0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xb, 0xfa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x3f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x8f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x1e, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x5a, 0xef, 0xb8, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0xaf, 0xc8, 0x84, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xf9, 0xaf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0xaf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0x58, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x84,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xfb, 0x99, 0xbf,
-    0xfc, 0x20, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0,
-    0x0, 0x18, 0xfe, 0x30, 0x0, 0x2, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf2, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0xf, 0xc1, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x1d, 0xd0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf,
-    0xd4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x30, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x40,
-    0x0, 0x3, 0xef, 0xa3, 0x0, 0x0, 0x1, 0x7e,
-    0xf4, 0x0, 0x0, 0x1, 0xaf, 0xfe, 0xba, 0xac,
-    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x38, 0xcf,
-    0xff, 0xda, 0x40, 0x0, 0x0,
-
-    /* U+0436 "ж" */
-    0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0,
-    0x1, 0xee, 0x10, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0, 0xbf,
-    0x30, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x6f,
-    0x60, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x8,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf9, 0x99, 0x9b, 0xfc, 0x99, 0x99, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x6,
-    0xf6, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x6f, 0x60,
-    0x0, 0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0x6f, 0x60, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x3f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x30, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0,
-
-    /* U+0437 "з" */
-    0x0, 0x5, 0xad, 0xff, 0xfd, 0xa5, 0x0, 0x0,
-    0x8, 0xff, 0xfc, 0xaa, 0xad, 0xff, 0xe4, 0x0,
-    0xb, 0xa4, 0x0, 0x0, 0x0, 0x17, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0x0, 0x1, 0x11, 0x13, 0x6c, 0xf6, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x14, 0x44, 0x45, 0x8e, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0xaf, 0xc5, 0x0, 0x0, 0x0, 0x18, 0xff, 0x30,
-    0x6, 0xef, 0xfc, 0xa9, 0x9c, 0xff, 0xc3, 0x0,
-    0x0, 0x5, 0x9d, 0xff, 0xfd, 0x94, 0x0, 0x0,
-
-    /* U+0438 "и" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf6, 0xfa, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x72, 0xfa, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x2, 0xfa, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x4f, 0xc0, 0x2, 0xfa, 0x1f,
-    0xb0, 0x0, 0x0, 0x2, 0xfe, 0x10, 0x2, 0xfa,
-    0x1f, 0xb0, 0x0, 0x0, 0x1d, 0xf3, 0x0, 0x2,
-    0xfa, 0x1f, 0xb0, 0x0, 0x0, 0xcf, 0x50, 0x0,
-    0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x2e,
-    0xe1, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb1,
-    0xdf, 0x30, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f,
-    0xbb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa,
-
-    /* U+0439 "й" */
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x1f, 0x40,
-    0x0, 0x0, 0x0, 0x9e, 0x10, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xd5, 0x10, 0x39,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
-    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x23, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x72, 0xfa, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x2, 0xfa, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x2, 0xfa, 0x1f, 0xb0,
-    0x0, 0x0, 0x2, 0xfe, 0x10, 0x2, 0xfa, 0x1f,
-    0xb0, 0x0, 0x0, 0x1d, 0xf3, 0x0, 0x2, 0xfa,
-    0x1f, 0xb0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x2,
-    0xfa, 0x1f, 0xb0, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x4, 0xfc, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x2e, 0xe1,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb1, 0xdf,
-    0x30, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xbb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa,
-
-    /* U+043A "к" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xed,
-    0x11, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xde,
-    0x20, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x30, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x4f,
-    0xa0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x1d,
-    0xe1, 0x0, 0x0, 0x0, 0x1f, 0xe9, 0x99, 0x9d,
-    0xf2, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x5, 0xfd, 0x10, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe1, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xa0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xaf, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xab, 0xf9, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0xce,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf9, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0xf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf9, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0xa, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x0, 0x1d, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x98, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf9, 0xaf, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x90,
-
-    /* U+043C "м" */
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf5, 0x1f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x1f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf5, 0x1f, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0xf5, 0x1f, 0x88, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xb5, 0xf5, 0x1f,
-    0x80, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x25, 0xf5, 0x1f, 0x80, 0x5f, 0x80, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x5, 0xf5, 0x1f, 0x80, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x5, 0xf5,
-    0x1f, 0x80, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x5, 0xf5, 0x1f, 0x80, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0xeb, 0x0, 0x5, 0xf5, 0x1f, 0x80,
-    0x0, 0xe, 0xd0, 0x0, 0x8, 0xf2, 0x0, 0x5,
-    0xf5, 0x1f, 0x80, 0x0, 0x5, 0xf7, 0x0, 0x2f,
-    0x80, 0x0, 0x5, 0xf5, 0x1f, 0x80, 0x0, 0x0,
-    0xbf, 0x10, 0xbe, 0x0, 0x0, 0x5, 0xf5, 0x1f,
-    0x80, 0x0, 0x0, 0x2f, 0xa5, 0xf5, 0x0, 0x0,
-    0x5, 0xf5, 0x1f, 0x80, 0x0, 0x0, 0x8, 0xfe,
-    0xc0, 0x0, 0x0, 0x5, 0xf5, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x5, 0xf5,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0,
-    0x0, 0x5, 0xf5, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf5,
-
-    /* U+043D "н" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x1f, 0xd9, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x9d, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xda, 0xab,
-    0xef, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xef, 0xa2,
-    0x0, 0x0, 0x4, 0xcf, 0xc1, 0x0, 0x0, 0x1e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x9, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x1e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0x3, 0xef, 0xa2, 0x0, 0x0, 0x4, 0xcf,
-    0xc1, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xda, 0xab,
-    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39,
-    0xdf, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x1f, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xad, 0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf4,
-
-    /* U+0440 "р" */
-    0x1f, 0xa0, 0x0, 0x29, 0xdf, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x1f, 0xa0, 0x9, 0xff, 0xda, 0xab,
-    0xef, 0xf8, 0x0, 0x0, 0x1f, 0xa0, 0xcf, 0x91,
-    0x0, 0x0, 0x4, 0xdf, 0xc0, 0x0, 0x1f, 0xab,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x0,
-    0x1f, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf9, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf3, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x1f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x1f, 0xbb,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x0,
-    0x1f, 0xb0, 0xcf, 0x91, 0x0, 0x0, 0x4, 0xdf,
-    0xc0, 0x0, 0x1f, 0xb0, 0x9, 0xff, 0xda, 0xab,
-    0xef, 0xf8, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x29,
-    0xdf, 0xfe, 0xc8, 0x20, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xff, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xdb, 0xab, 0xef,
-    0xfa, 0x0, 0x0, 0x3, 0xef, 0xa2, 0x0, 0x0,
-    0x3, 0xbf, 0xc0, 0x0, 0x2e, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x3, 0xef, 0xa2, 0x0, 0x0, 0x3, 0xbf,
-    0xc0, 0x0, 0x0, 0x1b, 0xff, 0xdb, 0xab, 0xef,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xff,
-    0xc8, 0x20, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xa, 0xaa, 0xaa, 0xaa, 0xef, 0xaa, 0xaa,
-    0xaa, 0xa4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x6, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf9, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x7f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x80, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x5,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xd0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0xa, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf3, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xbf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xee, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xc2, 0x0, 0x1, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x9b, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a,
-    0xef, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x9c, 0xef, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xff, 0xec, 0xbf, 0xeb,
-    0xcf, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xd7, 0x10, 0x1, 0xfb, 0x0, 0x3, 0x9f, 0xf9,
-    0x0, 0x0, 0x2, 0xef, 0x80, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x2c, 0xfa, 0x0, 0x0, 0xcf,
-    0x60, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x40, 0xee, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0xee, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x4f,
-    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0xcf, 0x70, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0x2, 0xef, 0x80, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x2d, 0xf9, 0x0, 0x0, 0x2, 0xdf, 0xe7,
-    0x20, 0x1, 0xfb, 0x0, 0x4, 0xaf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xec, 0xbf, 0xeb,
-    0xcf, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9c, 0xef, 0xff, 0xfd, 0xa7, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0445 "х" */
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xd0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0x1e, 0xf2, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf6, 0x0, 0x1d, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x20, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd8, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x81,
-    0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe1, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0x0, 0x1e, 0xf2, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6,
-
-    /* U+0446 "ц" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x1, 0xfe, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0xff, 0x99, 0x90, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x80,
-
-    /* U+0447 "ч" */
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x63, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf6, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x63, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf6, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x63, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf6, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x62, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf6, 0xe, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x7f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xf6, 0x0, 0xbf, 0xd6,
-    0x20, 0x1, 0x37, 0xbf, 0xff, 0x60, 0x0, 0x7e,
-    0xff, 0xff, 0xff, 0xfc, 0x67, 0xf6, 0x0, 0x0,
-    0x4, 0x68, 0x76, 0x40, 0x0, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x60,
-
-    /* U+0448 "ш" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x21, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x21, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x21, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x21, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x21, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x21, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x21,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x21, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x21, 0xfe, 0x99,
-    0x99, 0x99, 0x99, 0x9b, 0xfc, 0x99, 0x99, 0x99,
-    0x99, 0x9d, 0xf2, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20,
-
-    /* U+0449 "щ" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x20, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x20, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x20, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x20, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x1f,
-    0xe9, 0x99, 0x99, 0x99, 0x99, 0xbf, 0xc9, 0x99,
-    0x99, 0x99, 0x99, 0xef, 0xa9, 0x91, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x80,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xaa, 0xaa, 0xaf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc1, 0x11,
-    0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd4, 0x44, 0x44, 0x56,
-    0x9e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0x60, 0x0, 0x0, 0x0, 0xf, 0xe7,
-    0x77, 0x77, 0x78, 0xcf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x10,
-    0x0,
-
-    /* U+044B "ы" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x1f,
-    0xb1, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa4,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xc4, 0x44, 0x44,
-    0x46, 0x9e, 0xfa, 0x0, 0x0, 0x1f, 0xb1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x1,
-    0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf1, 0x0, 0x1f, 0xb1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x50, 0x1, 0xfb, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x1f,
-    0xb1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x60, 0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x0, 0x1f, 0xb1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x1, 0xfb,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0x50,
-    0x0, 0x1f, 0xb1, 0xfd, 0x77, 0x77, 0x77, 0x9c,
-    0xff, 0x60, 0x0, 0x1, 0xfb, 0x1f, 0xff, 0xff,
-    0xff, 0xfe, 0xc7, 0x10, 0x0, 0x0, 0x1f, 0xb0,
-
-    /* U+044C "ь" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb1, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0,
-    0x1f, 0xc4, 0x44, 0x44, 0x45, 0x9e, 0xfb, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0x70,
-    0x1f, 0xd7, 0x77, 0x77, 0x79, 0xcf, 0xf7, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x20, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x4, 0x9c, 0xef, 0xfd, 0xa5, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0xfb, 0x98, 0x8b, 0xff, 0xd4,
-    0x0, 0x0, 0x5f, 0xe6, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0x70, 0x0, 0x19, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x15,
-    0xf7, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x3, 0x44, 0x44, 0x44,
-    0x44, 0x47, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x20, 0x7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xf6, 0x0,
-    0x6f, 0xd5, 0x0, 0x0, 0x0, 0x6, 0xef, 0x70,
-    0x0, 0x4, 0xdf, 0xfc, 0x99, 0x9b, 0xff, 0xd4,
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xce,
-    0xff, 0xd9, 0x30, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xeb, 0xab, 0xdf, 0xfa,
-    0x10, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0xbf,
-    0xd4, 0x0, 0x0, 0x2, 0xaf, 0xd2, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfd, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x1f, 0xb0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x1f, 0xb0,
-    0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x1f, 0xb0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x1f, 0xea, 0xaa, 0xad, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x1f, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x1f, 0xb0, 0x0, 0x8, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x1f,
-    0xb0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x1f, 0xb0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x1f, 0xb0, 0x0, 0x0, 0xcf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x1f, 0xb0,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x1f, 0xb0, 0x0, 0x0, 0xa,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xc4, 0x0,
-    0x0, 0x2, 0xaf, 0xd2, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xea, 0x9a, 0xdf, 0xfa,
-    0x10, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0xce, 0xff, 0xd9, 0x30, 0x0, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x6f, 0xfe, 0xb9, 0x99, 0x99, 0x99, 0xfc,
-    0x7, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x1f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x1, 0xdf, 0xb6, 0x31, 0x11, 0x11, 0x11, 0xec,
-    0x0, 0x7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x3f, 0xb4, 0x44, 0x44, 0x44, 0xfc,
-    0x0, 0x0, 0xde, 0x10, 0x0, 0x0, 0x0, 0xec,
-    0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x1, 0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-    0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xec,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x0, 0x28, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xef, 0xfe, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xfb, 0x99, 0xbf, 0xfc, 0x20, 0x0, 0x0,
-    0x4, 0xff, 0x70, 0x0, 0x0, 0x18, 0xfe, 0x30,
-    0x0, 0x2, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x4,
-    0xfe, 0x10, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x4f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x70, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0xf, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x1d, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xf, 0xd4, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x30, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0x40, 0x0, 0x3, 0xef, 0xa3,
-    0x0, 0x0, 0x1, 0x7e, 0xf4, 0x0, 0x0, 0x1,
-    0xaf, 0xfe, 0xba, 0xac, 0xff, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xcf, 0xff, 0xda, 0x40, 0x0,
-    0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0x2, 0xec, 0x0, 0x0, 0xde, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x2f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x76, 0x0,
-    0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xfb, 0x99,
-    0xbf, 0xfc, 0x20, 0x0, 0x0, 0x4, 0xff, 0x70,
-    0x0, 0x0, 0x18, 0xfe, 0x30, 0x0, 0x2, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0xf, 0xc1, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x1d, 0xd0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xf, 0xd4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x30, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0x40, 0x0, 0x3, 0xef, 0xa3, 0x0, 0x0, 0x1,
-    0x7e, 0xf4, 0x0, 0x0, 0x1, 0xaf, 0xfe, 0xba,
-    0xac, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0xcf, 0xff, 0xda, 0x40, 0x0, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x11,
-    0x3f, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x4, 0x44, 0x5f, 0xc4,
-    0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x5a, 0xef, 0xfe,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x3d,
-    0xfe, 0xba, 0xac, 0xff, 0xd2, 0x0, 0x0, 0x0,
-    0x1f, 0xa3, 0xfd, 0x40, 0x0, 0x0, 0x19, 0xfe,
-    0x20, 0x0, 0x0, 0x1f, 0xbe, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x1f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0,
-    0x0, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x1f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x2e, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xea,
-    0x9a, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xae, 0xff, 0xb4, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xeb, 0x71,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0xfd, 0xa8, 0x9a,
-    0xdf, 0xf9, 0x0, 0x0, 0x2, 0xdf, 0xa2, 0x0,
-    0x0, 0x0, 0x29, 0xfd, 0x0, 0x1, 0xef, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x50, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xb1, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0xf,
-    0xc4, 0x44, 0x44, 0x44, 0x44, 0x41, 0x0, 0x0,
-    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4, 0x60,
-    0x0, 0x2, 0xdf, 0xa2, 0x0, 0x0, 0x0, 0x2a,
-    0xfc, 0x0, 0x0, 0x1, 0x9f, 0xfc, 0x98, 0x8a,
-    0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce,
-    0xff, 0xeb, 0x61, 0x0, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x0, 0x39, 0xdf, 0xff, 0xda, 0x61, 0x0,
-    0x0, 0x9, 0xff, 0xca, 0x9a, 0xcf, 0xff, 0x80,
-    0x0, 0x9f, 0xb1, 0x0, 0x0, 0x0, 0x4c, 0xb0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0xb8, 0x41, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xff, 0xff, 0xea, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x58, 0xcf, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x6, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8,
-    0xe, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x6f, 0xe1,
-    0x2, 0xaf, 0xff, 0xba, 0x99, 0xbf, 0xfd, 0x20,
-    0x0, 0x2, 0x7b, 0xef, 0xff, 0xda, 0x50, 0x0,
-
-    /* U+0456 "і" */
-    0x4f, 0xc0, 0xaf, 0xf3, 0x3d, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x1f, 0xb0, 0x1f, 0xb0, 0x1f, 0xb0, 0x1f, 0xb0,
-    0x1f, 0xb0, 0x1f, 0xb0, 0x1f, 0xb0, 0x1f, 0xb0,
-    0x1f, 0xb0, 0x1f, 0xb0, 0x1f, 0xb0, 0x1f, 0xb0,
-    0x1f, 0xb0, 0x1f, 0xb0, 0x1f, 0xb0, 0x1f, 0xb0,
-    0x1f, 0xb0, 0x1f, 0xb0,
-
-    /* U+0457 "ї" */
-    0x6f, 0x60, 0x1d, 0xd0, 0xbf, 0xb0, 0x4f, 0xf2,
-    0x28, 0x20, 0x6, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0x3f, 0x90, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x3, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x4, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x40, 0x0, 0x2, 0xef, 0x20,
-    0x1f, 0xea, 0x9a, 0xff, 0x60, 0x0, 0x4a, 0xef,
-    0xfb, 0x40, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb1, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xea, 0x40, 0x0,
-    0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc4, 0x44, 0x44, 0x46, 0x9e, 0xfa, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x90,
-    0x0, 0x0, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x1d, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60,
-    0x8b, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xea, 0xaa, 0xaa, 0xbc, 0xff, 0xf7, 0x0,
-    0xaf, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+045A "њ" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x1f,
-    0xd9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9f, 0xf9,
-    0x99, 0x99, 0x9a, 0xcf, 0xfd, 0x20, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xd0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf8, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf9, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe6,
-    0x66, 0x66, 0x67, 0xae, 0xfa, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x33, 0x33, 0x4f, 0xc3, 0x33, 0x33,
-    0x33, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x5, 0xae, 0xff, 0xeb, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x3d, 0xfe, 0xba, 0xac,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x3f,
-    0xd4, 0x0, 0x0, 0x1, 0x9f, 0xe1, 0x0, 0x0,
-    0x0, 0x1f, 0xbe, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf7, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x1f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xd1, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xe2, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x9, 0xf5, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x1, 0xde, 0x10, 0x0, 0x0, 0x1,
-    0xfe, 0x99, 0x99, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x5f, 0xd1, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x7f, 0xb0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x30, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x10, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfa, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7,
-
-    /* U+045D "ѝ" */
-    0x0, 0x0, 0x9f, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xee, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x72, 0xfa, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x2, 0xfa, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x2, 0xfa, 0x1f, 0xb0,
-    0x0, 0x0, 0x2, 0xfe, 0x10, 0x2, 0xfa, 0x1f,
-    0xb0, 0x0, 0x0, 0x1d, 0xf3, 0x0, 0x2, 0xfa,
-    0x1f, 0xb0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x2,
-    0xfa, 0x1f, 0xb0, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x4, 0xfc, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x2e, 0xe1,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb1, 0xdf,
-    0x30, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xbb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x6, 0x40, 0x0, 0x0, 0x0, 0x73,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0,
-    0x0, 0x1f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf3, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xe6, 0x10, 0x3a, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff,
-    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x23, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0xe,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x7f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x9f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xc2, 0x0,
-    0x1, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x9b, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3a, 0xef, 0xfb, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x1f, 0xe9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xef,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x27, 0xfc, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xa1, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa1, 0xfe, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44,
-
-    /* U+2014 "—" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-
-    /* U+2018 "‘" */
-    0x5, 0xf0, 0x9, 0xb0, 0xe, 0x80, 0x3f, 0x40,
-    0x7f, 0x10, 0xcf, 0xa0, 0xef, 0xf0, 0x8f, 0xa0,
-    0x0, 0x0,
-
-    /* U+2019 "’" */
-    0x7f, 0xa0, 0xef, 0xf1, 0x7f, 0xf0, 0xd, 0xa0,
-    0x1f, 0x60, 0x5f, 0x10, 0x8d, 0x0, 0xc8, 0x0,
-    0x0, 0x0,
-
-    /* U+201A "‚" */
-    0x0, 0x0, 0x7f, 0xa0, 0xef, 0xf1, 0x7f, 0xf0,
-    0xd, 0xa0, 0x1f, 0x60, 0x5f, 0x10, 0x8d, 0x0,
-    0xc8, 0x0,
-
-    /* U+201C "“" */
-    0x5, 0xf0, 0x0, 0xd, 0x70, 0x9b, 0x0, 0x1,
-    0xf3, 0xe, 0x80, 0x0, 0x6f, 0x3, 0xf4, 0x0,
-    0xa, 0xc0, 0x7f, 0x10, 0x0, 0xf9, 0xc, 0xfa,
-    0x0, 0x4f, 0xe3, 0xef, 0xf0, 0x6, 0xff, 0x88,
-    0xfa, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+201D "”" */
-    0x7f, 0xa0, 0x1, 0xde, 0x3e, 0xff, 0x10, 0x6f,
-    0xf9, 0x7f, 0xf0, 0x1, 0xdf, 0x70, 0xda, 0x0,
-    0x5, 0xf3, 0x1f, 0x60, 0x0, 0x9e, 0x5, 0xf1,
-    0x0, 0xd, 0x90, 0x8d, 0x0, 0x0, 0xf5, 0xc,
-    0x80, 0x0, 0x4f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+2026 "…" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xb0, 0x0, 0x3, 0xee, 0x20, 0x0,
-    0xb, 0xf7, 0xef, 0xf1, 0x0, 0x8, 0xff, 0x70,
-    0x0, 0x2f, 0xfd, 0x7f, 0xa0, 0x0, 0x2, 0xed,
-    0x20, 0x0, 0xa, 0xf6,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x0, 0x27, 0xbd, 0xff, 0xfe, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
-    0xca, 0xaa, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x83, 0x0, 0x0, 0x0, 0x4, 0xcf,
-    0xd1, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x33, 0x8f, 0xe5,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x50, 0x0, 0x0, 0x3f, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xed, 0x0, 0x0, 0x0, 0x7f,
-    0xf7, 0x10, 0x0, 0x0, 0x1, 0x6d, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0xdb, 0xaa, 0xbe,
-    0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x20, 0x0, 0x0, 0x0, 0x3, 0x54,
-    0x10, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x9f, 0xfd, 0xef, 0xc3, 0x0, 0xcf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x1, 0xdd, 0x40, 0x0, 0x2a, 0xf5, 0xc,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0xad, 0x10, 0x0, 0x0,
-    0x9, 0xf1, 0xcf, 0xbf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x1f, 0x50,
-    0x0, 0x0, 0x0, 0xe, 0x7c, 0xf1, 0xcf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0,
-    0x5, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xab, 0xcf,
-    0x12, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xcc, 0xf1, 0x4, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x4, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xba, 0xcf, 0x10, 0x7, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0xf, 0x70, 0x0, 0x0, 0x0, 0x2f, 0x5c, 0xf1,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x1c,
-    0xd0, 0xcf, 0x10, 0x0, 0x1d, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x8f, 0xa5,
-    0x34, 0x7e, 0xd1, 0xc, 0xf1, 0x0, 0x0, 0x2f,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
-    0x0, 0x4a, 0xef, 0xfc, 0x70, 0x0, 0xcf, 0x10,
-    0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x1f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x40, 0x0, 0x1, 0xfc,
-    0x0, 0x0, 0x7a, 0xaa, 0xaa, 0xaa, 0xaa, 0xa0,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x1f, 0xc0, 0x0, 0x7, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xf3, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 148, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 145, .box_w = 4, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 50, .adv_w = 206, .box_w = 9, .box_h = 10, .ofs_x = 2, .ofs_y = 15},
-    {.bitmap_index = 95, .adv_w = 397, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 383, .adv_w = 351, .box_w = 20, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 723, .adv_w = 471, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1061, .adv_w = 377, .box_w = 23, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1360, .adv_w = 112, .box_w = 3, .box_h = 10, .ofs_x = 2, .ofs_y = 15},
-    {.bitmap_index = 1375, .adv_w = 185, .box_w = 6, .box_h = 34, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 1477, .adv_w = 185, .box_w = 7, .box_h = 34, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 1596, .adv_w = 216, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 14},
-    {.bitmap_index = 1681, .adv_w = 328, .box_w = 16, .box_h = 16, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 1809, .adv_w = 115, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 1827, .adv_w = 219, .box_w = 10, .box_h = 2, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 1837, .adv_w = 115, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1845, .adv_w = 184, .box_w = 14, .box_h = 34, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 2083, .adv_w = 379, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2346, .adv_w = 203, .box_w = 9, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2459, .adv_w = 324, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2697, .adv_w = 321, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2935, .adv_w = 377, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3210, .adv_w = 321, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3448, .adv_w = 347, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3698, .adv_w = 335, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3936, .adv_w = 364, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4186, .adv_w = 347, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4424, .adv_w = 115, .box_w = 4, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4462, .adv_w = 115, .box_w = 4, .box_h = 24, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 4510, .adv_w = 328, .box_w = 16, .box_h = 15, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 4630, .adv_w = 328, .box_w = 16, .box_h = 10, .ofs_x = 2, .ofs_y = 8},
-    {.bitmap_index = 4710, .adv_w = 328, .box_w = 16, .box_h = 15, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 4830, .adv_w = 324, .box_w = 18, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5055, .adv_w = 595, .box_w = 35, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 5615, .adv_w = 406, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5940, .adv_w = 433, .box_w = 21, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 6203, .adv_w = 407, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6503, .adv_w = 476, .box_w = 24, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 6803, .adv_w = 385, .box_w = 18, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7028, .adv_w = 363, .box_w = 18, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7253, .adv_w = 445, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7553, .adv_w = 469, .box_w = 21, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7816, .adv_w = 170, .box_w = 3, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7854, .adv_w = 283, .box_w = 15, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8042, .adv_w = 405, .box_w = 21, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8305, .adv_w = 337, .box_w = 17, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8518, .adv_w = 551, .box_w = 27, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8856, .adv_w = 469, .box_w = 21, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 9119, .adv_w = 483, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9469, .adv_w = 412, .box_w = 20, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 9719, .adv_w = 483, .box_w = 29, .box_h = 30, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 10154, .adv_w = 415, .box_w = 20, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 10404, .adv_w = 351, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10654, .adv_w = 324, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10917, .adv_w = 457, .box_w = 21, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 11180, .adv_w = 396, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11493, .adv_w = 632, .box_w = 38, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11968, .adv_w = 370, .box_w = 23, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12256, .adv_w = 360, .box_w = 23, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12544, .adv_w = 372, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12807, .adv_w = 176, .box_w = 7, .box_h = 34, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 12926, .adv_w = 184, .box_w = 15, .box_h = 34, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 13181, .adv_w = 176, .box_w = 7, .box_h = 34, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 13300, .adv_w = 328, .box_w = 15, .box_h = 15, .ofs_x = 3, .ofs_y = 5},
-    {.bitmap_index = 13413, .adv_w = 288, .box_w = 18, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 13440, .adv_w = 346, .box_w = 8, .box_h = 5, .ofs_x = 5, .ofs_y = 22},
-    {.bitmap_index = 13460, .adv_w = 336, .box_w = 16, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13612, .adv_w = 389, .box_w = 20, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13882, .adv_w = 320, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14053, .adv_w = 389, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14323, .adv_w = 344, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14504, .adv_w = 189, .box_w = 14, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14693, .adv_w = 393, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 14953, .adv_w = 388, .box_w = 18, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15196, .adv_w = 150, .box_w = 4, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15250, .adv_w = 153, .box_w = 11, .box_h = 34, .ofs_x = -4, .ofs_y = -7},
-    {.bitmap_index = 15437, .adv_w = 336, .box_w = 18, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15680, .adv_w = 150, .box_w = 3, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15721, .adv_w = 613, .box_w = 32, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16025, .adv_w = 388, .box_w = 18, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16196, .adv_w = 357, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16386, .adv_w = 389, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 16646, .adv_w = 389, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 16906, .adv_w = 227, .box_w = 10, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17001, .adv_w = 275, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17144, .adv_w = 229, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17305, .adv_w = 385, .box_w = 18, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17476, .adv_w = 304, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17657, .adv_w = 497, .box_w = 31, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17952, .adv_w = 299, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18123, .adv_w = 304, .box_w = 20, .box_h = 26, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 18383, .adv_w = 290, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18535, .adv_w = 184, .box_w = 9, .box_h = 34, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 18688, .adv_w = 168, .box_w = 3, .box_h = 34, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 18739, .adv_w = 184, .box_w = 10, .box_h = 34, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 18909, .adv_w = 328, .box_w = 17, .box_h = 7, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 18969, .adv_w = 262, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 19067, .adv_w = 262, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 19165, .adv_w = 376, .box_w = 18, .box_h = 32, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 19453, .adv_w = 376, .box_w = 18, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 19732, .adv_w = 472, .box_w = 28, .box_h = 26, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20096, .adv_w = 327, .box_w = 17, .box_h = 32, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20368, .adv_w = 407, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20643, .adv_w = 357, .box_w = 19, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20881, .adv_w = 175, .box_w = 3, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20919, .adv_w = 170, .box_w = 10, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21074, .adv_w = 297, .box_w = 15, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21262, .adv_w = 683, .box_w = 41, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21775, .adv_w = 684, .box_w = 38, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22250, .adv_w = 476, .box_w = 28, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22600, .adv_w = 400, .box_w = 21, .box_h = 32, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22936, .adv_w = 475, .box_w = 22, .box_h = 32, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 23288, .adv_w = 386, .box_w = 24, .box_h = 32, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23672, .adv_w = 464, .box_w = 21, .box_h = 31, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 23998, .adv_w = 422, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24323, .adv_w = 416, .box_w = 20, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 24573, .adv_w = 432, .box_w = 21, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 24836, .adv_w = 327, .box_w = 17, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 25049, .adv_w = 453, .box_w = 27, .box_h = 31, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 25468, .adv_w = 376, .box_w = 18, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 25693, .adv_w = 574, .box_w = 35, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26131, .adv_w = 353, .box_w = 20, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26381, .adv_w = 475, .box_w = 22, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 26656, .adv_w = 475, .box_w = 22, .box_h = 32, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 27008, .adv_w = 400, .box_w = 21, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 27271, .adv_w = 450, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27571, .adv_w = 555, .box_w = 27, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 27909, .adv_w = 473, .box_w = 22, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 28184, .adv_w = 491, .box_w = 27, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 28522, .adv_w = 477, .box_w = 22, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 28797, .adv_w = 407, .box_w = 20, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 29047, .adv_w = 411, .box_w = 23, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29335, .adv_w = 331, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29598, .adv_w = 386, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29898, .adv_w = 524, .box_w = 30, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 30318, .adv_w = 366, .box_w = 22, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 30593, .adv_w = 475, .box_w = 25, .box_h = 31, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 30981, .adv_w = 411, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 31244, .adv_w = 630, .box_w = 31, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 31632, .adv_w = 642, .box_w = 35, .box_h = 31, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 32175, .adv_w = 469, .box_w = 28, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 32525, .adv_w = 556, .box_w = 27, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 32863, .adv_w = 408, .box_w = 20, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 33113, .adv_w = 406, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33401, .adv_w = 626, .box_w = 33, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 33814, .adv_w = 422, .box_w = 20, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34064, .adv_w = 332, .box_w = 16, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34216, .adv_w = 378, .box_w = 20, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34496, .adv_w = 347, .box_w = 17, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 34658, .adv_w = 267, .box_w = 14, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 34791, .adv_w = 368, .box_w = 22, .box_h = 24, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 35055, .adv_w = 351, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35236, .adv_w = 465, .box_w = 29, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 35512, .adv_w = 303, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35664, .adv_w = 393, .box_w = 18, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35835, .adv_w = 393, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36069, .adv_w = 327, .box_w = 17, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36231, .adv_w = 359, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36412, .adv_w = 452, .box_w = 22, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36621, .adv_w = 386, .box_w = 18, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36792, .adv_w = 364, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36982, .adv_w = 387, .box_w = 18, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 37153, .adv_w = 394, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 37413, .adv_w = 321, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37584, .adv_w = 263, .box_w = 18, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 37755, .adv_w = 314, .box_w = 21, .box_h = 26, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 38028, .adv_w = 442, .box_w = 25, .box_h = 34, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 38453, .adv_w = 295, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 38624, .adv_w = 391, .box_w = 21, .box_h = 24, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 38876, .adv_w = 340, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39038, .adv_w = 529, .box_w = 27, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 39295, .adv_w = 529, .box_w = 30, .box_h = 24, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 39655, .adv_w = 348, .box_w = 22, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 39864, .adv_w = 441, .box_w = 21, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 40064, .adv_w = 319, .box_w = 16, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 40216, .adv_w = 327, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40387, .adv_w = 493, .box_w = 26, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 40634, .adv_w = 346, .box_w = 16, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 40786, .adv_w = 357, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41043, .adv_w = 351, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41281, .adv_w = 384, .box_w = 22, .box_h = 34, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 41655, .adv_w = 267, .box_w = 14, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 41837, .adv_w = 327, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42018, .adv_w = 300, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42170, .adv_w = 153, .box_w = 4, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 42222, .adv_w = 150, .box_w = 8, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42322, .adv_w = 153, .box_w = 11, .box_h = 34, .ofs_x = -4, .ofs_y = -7},
-    {.bitmap_index = 42509, .adv_w = 525, .box_w = 32, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 42813, .adv_w = 540, .box_w = 30, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 43098, .adv_w = 384, .box_w = 23, .box_h = 27, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 43409, .adv_w = 327, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 43630, .adv_w = 393, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 43864, .adv_w = 314, .box_w = 21, .box_h = 34, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 44221, .adv_w = 365, .box_w = 16, .box_h = 24, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 44413, .adv_w = 328, .box_w = 17, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 44677, .adv_w = 251, .box_w = 13, .box_h = 23, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 44827, .adv_w = 288, .box_w = 18, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 44854, .adv_w = 576, .box_w = 36, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 44908, .adv_w = 115, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = 18},
-    {.bitmap_index = 44926, .adv_w = 115, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = 18},
-    {.bitmap_index = 44944, .adv_w = 115, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 44962, .adv_w = 203, .box_w = 9, .box_h = 9, .ofs_x = 2, .ofs_y = 18},
-    {.bitmap_index = 45003, .adv_w = 203, .box_w = 9, .box_h = 9, .ofs_x = 2, .ofs_y = 18},
-    {.bitmap_index = 45044, .adv_w = 351, .box_w = 18, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 45080, .adv_w = 476, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 45368, .adv_w = 689, .box_w = 37, .box_h = 26, .ofs_x = 4, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_36;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_36 = {
-#else
-lv_font_t montserrat_cyrillic_36 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 39,          /*The maximum line height required by the font*/
-    .base_line = 7,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -4,
-    .underline_thickness = 2,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_36,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_36*/
@@ -1,7241 +0,0 @@
-/*******************************************************************************
- * Size: 38 px
- * Bpp: 4
- * Opts: --bpp 4 --size 38 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_38.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_38
-#define MONTSERRAT_CYRILLIC_38 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_38
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x4f, 0xe0, 0x4f, 0xd0, 0x4f, 0xd0, 0x3f, 0xd0,
-    0x3f, 0xc0, 0x3f, 0xc0, 0x2f, 0xc0, 0x2f, 0xb0,
-    0x2f, 0xb0, 0x2f, 0xb0, 0x1f, 0xa0, 0x1f, 0xa0,
-    0x1f, 0xa0, 0xf, 0xa0, 0xf, 0x90, 0xf, 0x90,
-    0xf, 0x90, 0xf, 0x80, 0xf, 0x80, 0x2, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x6f, 0xe1, 0xbf, 0xf5, 0x4f, 0xc1,
-
-    /* U+0022 "\"" */
-    0x2f, 0x80, 0x0, 0xf, 0xb2, 0xf8, 0x0, 0x0,
-    0xfb, 0x2f, 0x80, 0x0, 0xf, 0xa2, 0xf8, 0x0,
-    0x0, 0xfa, 0x1f, 0x70, 0x0, 0xf, 0xa1, 0xf7,
-    0x0, 0x0, 0xfa, 0x1f, 0x70, 0x0, 0xe, 0x91,
-    0xf7, 0x0, 0x0, 0xe9, 0xf, 0x60, 0x0, 0xe,
-    0x90, 0xd5, 0x0, 0x0, 0xb7,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x2, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x6, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf2, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0xa, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xd0, 0x0, 0x0, 0x0,
-    0xd, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x5, 0x88, 0x88, 0x9f,
-    0xb8, 0x88, 0x88, 0x88, 0xaf, 0xa8, 0x88, 0x88,
-    0x0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x5f, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x30, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x10, 0x0, 0x0, 0x0,
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x0, 0x1,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x68, 0x88, 0x8a, 0xf9,
-    0x88, 0x88, 0x88, 0x8b, 0xf8, 0x88, 0x88, 0x60,
-    0x0, 0x0, 0x7, 0xf1, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x0, 0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xd0, 0x0, 0x0, 0x0, 0xc,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x70,
-    0x0, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x83, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x9d, 0xef, 0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0xff, 0xfd, 0xfd, 0xdf, 0xff, 0xe8,
-    0x10, 0x0, 0x0, 0x7f, 0xfa, 0x30, 0xf, 0x60,
-    0x3, 0x8e, 0xfe, 0x0, 0x0, 0x4f, 0xe3, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x6, 0x80, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x50, 0x0, 0x0,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x50, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xc5, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x39, 0xdf, 0xff, 0xfb, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xde, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x2, 0x8e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x8,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x87, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x7f, 0xa0, 0xd, 0xfb,
-    0x20, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x1b, 0xff, 0xb5, 0x10, 0xf, 0x60, 0x4,
-    0xbf, 0xf5, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xec,
-    0xfd, 0xdf, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbd, 0xff, 0xfe, 0xc9, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x2, 0x9e, 0xfe, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x4,
-    0xfb, 0x42, 0x49, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x60, 0x0, 0x0, 0x1, 0xf9, 0x0,
-    0x0, 0x6, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xb0, 0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0,
-    0xb, 0xc0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x5f,
-    0x10, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0,
-    0x2, 0xf4, 0x0, 0x0, 0x0, 0x1, 0xf5, 0x0,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x20, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x0, 0x0, 0x4, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x4f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x40, 0x0, 0x0,
-    0x0, 0x1f, 0x50, 0x0, 0xe, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0x0, 0x4,
-    0xf2, 0x0, 0x9, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x5f, 0x50, 0x1, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x93, 0x12, 0x8f, 0x90, 0x0, 0xae, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
-    0xfe, 0x60, 0x0, 0x4f, 0x50, 0x0, 0x3b, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x2, 0x32, 0x0,
-    0x0, 0x1e, 0xa0, 0x0, 0x6f, 0xb5, 0x35, 0xcf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xe1, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0,
-    0xb, 0xc0, 0x0, 0x0, 0x0, 0xda, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xea, 0x0, 0x1, 0xf6,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xae, 0x10, 0x0, 0x4f, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x50, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x2, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xa0,
-    0x0, 0x0, 0x6f, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x50, 0x0, 0x0, 0x0, 0xa, 0xe1, 0x0, 0x0,
-    0x4, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xf3, 0x0,
-    0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x1f,
-    0x50, 0x0, 0x0, 0x0, 0x6f, 0x0, 0x0, 0x0,
-    0x1, 0xe9, 0x0, 0x0, 0x0, 0x0, 0xbb, 0x0,
-    0x0, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0,
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x42, 0x4a, 0xf5,
-    0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xae, 0xfe, 0xa2, 0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x5, 0xbe, 0xff, 0xc8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xd9, 0x78, 0xcf, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x4, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0x0, 0x7f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x6f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0x1, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x1c, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x20, 0x4, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xd2, 0xaf, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
-    0x5a, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xa1, 0x0, 0xaf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf6, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0xa6, 0x0,
-    0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0x0, 0x1, 0xf9, 0x0, 0x6, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x5, 0xf5, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x70, 0xb, 0xf1, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xf6, 0x2f, 0xa0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xdf, 0x30, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfb, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x40, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xef, 0x6f, 0xf3, 0x0,
-    0x0, 0x5f, 0xf9, 0x10, 0x0, 0x0, 0x3, 0xbf,
-    0xe3, 0x3, 0xff, 0x30, 0x0, 0x3, 0xdf, 0xfd,
-    0xa9, 0xab, 0xef, 0xf9, 0x10, 0x0, 0x4f, 0xe2,
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x4, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x2f, 0x82, 0xf8, 0x2f, 0x82, 0xf8, 0x1f, 0x71,
-    0xf7, 0x1f, 0x71, 0xf7, 0xf, 0x60, 0xd5,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0xbf, 0x20, 0x0, 0x4f, 0x90, 0x0,
-    0xc, 0xf1, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x9f,
-    0x30, 0x0, 0xe, 0xe0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0xaf, 0x30, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0xbf, 0x20, 0x0, 0xc, 0xf2, 0x0, 0x0, 0xbf,
-    0x20, 0x0, 0xb, 0xf2, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x9, 0xf4, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x4, 0xf9, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x9f, 0x30, 0x0, 0x3, 0xfa, 0x0,
-    0x0, 0xb, 0xf1, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0xbf, 0x20,
-
-    /* U+0029 ")" */
-    0xd, 0xd0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0xaf,
-    0x20, 0x0, 0x1f, 0xc0, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x5f, 0x70, 0x0, 0xd,
-    0xd0, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x8c, 0x0, 0x0, 0x10, 0xd, 0xb2, 0x0,
-    0x8c, 0x0, 0x19, 0xf1, 0x4, 0xdf, 0x91, 0x8c,
-    0x6, 0xee, 0x60, 0x0, 0x6, 0xee, 0xde, 0xdf,
-    0x81, 0x0, 0x0, 0x0, 0xa, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfb, 0x20, 0x0,
-    0x0, 0x6e, 0xe6, 0x9c, 0x4d, 0xf9, 0x10, 0xc,
-    0xf9, 0x10, 0x8c, 0x0, 0x6e, 0xe2, 0x5, 0x20,
-    0x0, 0x8c, 0x0, 0x1, 0x70, 0x0, 0x0, 0x0,
-    0x8c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0,
-    0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x85, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x2, 0xaa, 0xaa, 0xaa, 0xaf,
-    0xea, 0xaa, 0xaa, 0xa9, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x2, 0x10, 0x7f, 0xf2, 0xcf, 0xf5, 0x5f, 0xf3,
-    0xa, 0xf0, 0xe, 0xb0, 0x1f, 0x60, 0x5f, 0x20,
-    0x9d, 0x0, 0x55, 0x0,
-
-    /* U+002D "-" */
-    0x7b, 0xbb, 0xbb, 0xbb, 0xbb, 0x1a, 0xff, 0xff,
-    0xff, 0xff, 0xf2,
-
-    /* U+002E "." */
-    0x2, 0x10, 0x8f, 0xf2, 0xcf, 0xf5, 0x5f, 0xc1,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x28, 0xcf, 0xff, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xdc,
-    0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xd6, 0x0, 0x0, 0x5, 0xdf, 0xd1, 0x0, 0x0,
-    0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xd0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x90, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0xa,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x58, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xbd, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xee, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xed, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb8, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf8, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x90, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x1, 0xdf, 0xd6,
-    0x0, 0x0, 0x5, 0xdf, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xdc, 0xdf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xcf, 0xff, 0xc8,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xaf, 0xff, 0xff, 0xff, 0xc7, 0xcc, 0xcc, 0xcc,
-    0xfc, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x2f, 0xc0,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xdc, 0xce,
-    0xff, 0xf9, 0x0, 0x0, 0x1, 0xcf, 0xf8, 0x30,
-    0x0, 0x0, 0x17, 0xef, 0xc0, 0x0, 0xd, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf9, 0x0,
-    0x4, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xec, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xca, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+0033 "3" */
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x6, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfe, 0xc9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaa, 0xac,
-    0xef, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xaf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0xb, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x4f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x10,
-    0x6, 0xff, 0xe7, 0x30, 0x0, 0x0, 0x5, 0xcf,
-    0xf4, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xdc, 0xce,
-    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x16, 0xad,
-    0xff, 0xfe, 0xc9, 0x30, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x30, 0x0, 0x0, 0x1, 0xa7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x4b, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbc, 0xfe, 0xbb, 0xbb, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xff, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0x30, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0xcc, 0xcb, 0xa9, 0x74, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13,
-    0x6a, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0x6, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0xc, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x50,
-    0x1, 0xbf, 0xfb, 0x51, 0x0, 0x0, 0x3, 0x9f,
-    0xf8, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xed, 0xcd,
-    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3, 0x8b,
-    0xef, 0xff, 0xda, 0x50, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe, 0xc9,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xdb,
-    0xbc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x9f, 0xf9,
-    0x30, 0x0, 0x0, 0x3, 0x95, 0x0, 0x0, 0xa,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0x28, 0xce, 0xff, 0xda, 0x60, 0x0, 0x0,
-    0xef, 0x0, 0x9, 0xff, 0xeb, 0xab, 0xdf, 0xfe,
-    0x50, 0x0, 0xef, 0x1, 0xdf, 0x92, 0x0, 0x0,
-    0x2, 0x8f, 0xf7, 0x0, 0xef, 0x1b, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0x50, 0xdf, 0x7f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0xbf, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf8, 0x6f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x3f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x40,
-    0x0, 0x4, 0xff, 0xa2, 0x0, 0x0, 0x1, 0x8f,
-    0xf6, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xeb, 0xbb,
-    0xdf, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x39,
-    0xcf, 0xff, 0xda, 0x50, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xbf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xf4, 0xbf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0xbf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0xae, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xec,
-    0xbb, 0xce, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x93, 0x0, 0x0, 0x0, 0x39, 0xff, 0x60,
-    0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0xa,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x7f, 0xf9, 0x53, 0x33, 0x35,
-    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
-    0x2, 0xbf, 0xfb, 0x75, 0x44, 0x57, 0xbf, 0xfb,
-    0x20, 0x0, 0x0, 0x3f, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xe3, 0x0, 0x1, 0xef, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x10,
-    0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0xd, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x50, 0x0, 0xcf, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfc, 0x0,
-    0x0, 0x1c, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x17,
-    0xef, 0xc1, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xeb,
-    0xab, 0xce, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6a, 0xdf, 0xff, 0xed, 0xa5, 0x0, 0x0,
-    0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xfd, 0xbb, 0xce,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x10,
-    0x0, 0x0, 0x3b, 0xfe, 0x20, 0x0, 0x5, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfb, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xbf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf4, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf7, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0xf9, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0xfb,
-    0x7, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x93, 0xfc, 0x0, 0x9f, 0xf7, 0x10, 0x0, 0x0,
-    0x3a, 0xfb, 0x2, 0xfc, 0x0, 0x7, 0xff, 0xfd,
-    0xba, 0xbe, 0xff, 0x80, 0x2, 0xfc, 0x0, 0x0,
-    0x16, 0xbe, 0xff, 0xeb, 0x71, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x80, 0x0,
-    0x0, 0x78, 0x20, 0x0, 0x0, 0x4, 0xaf, 0xf8,
-    0x0, 0x0, 0x0, 0xdf, 0xfe, 0xcb, 0xbc, 0xff,
-    0xfc, 0x40, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff,
-    0xfe, 0xc8, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x5f, 0xc1, 0xcf, 0xf5, 0x7f, 0xf2, 0x2, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x10, 0x8f, 0xf2, 0xcf, 0xf5, 0x5f, 0xc1,
-
-    /* U+003B ";" */
-    0x5f, 0xc1, 0xcf, 0xf5, 0x7f, 0xf2, 0x2, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x10, 0x7f, 0xf2, 0xcf, 0xf5, 0x5f, 0xf3,
-    0xa, 0xf0, 0xe, 0xb0, 0x1f, 0x60, 0x5f, 0x20,
-    0x9d, 0x0, 0x55, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff,
-    0xe8, 0x10, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xfe, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xef, 0xe8, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
-    0xef, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x9f, 0xfe, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x84, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+003E ">" */
-    0x37, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xaf, 0xfd, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xdf, 0xfa, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d,
-    0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xaf, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xef, 0xf9, 0x20, 0x0, 0x0, 0x0,
-    0x4, 0xaf, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x1,
-    0x7d, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x16, 0xad, 0xff, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xec, 0xbc, 0xdf,
-    0xff, 0x80, 0x0, 0x3, 0xef, 0xd6, 0x10, 0x0,
-    0x0, 0x17, 0xff, 0xb0, 0x2, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x70, 0x7, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x23, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xe4, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x69, 0xce,
-    0xff, 0xfe, 0xda, 0x73, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf,
-    0xfe, 0xb9, 0x77, 0x78, 0xac, 0xff, 0xd7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xd7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xbf, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xee, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xe2, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xed, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xeb,
-    0x71, 0x0, 0xb, 0xf0, 0x0, 0x3f, 0x90, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xfa,
-    0x87, 0x8b, 0xff, 0x60, 0xb, 0xf0, 0x0, 0x8,
-    0xf3, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x3f,
-    0xf7, 0x0, 0x0, 0x0, 0x18, 0xf9, 0xb, 0xf0,
-    0x0, 0x0, 0xea, 0x0, 0xc, 0xd0, 0x0, 0x0,
-    0x2, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x7b, 0xf0, 0x0, 0x0, 0x8f, 0x10, 0x2f, 0x80,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0xf0, 0x0, 0x0, 0x2f, 0x60,
-    0x6f, 0x30, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0,
-    0xd, 0xa0, 0x9f, 0x0, 0x0, 0x0, 0xbf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x9, 0xe0, 0xcc, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0x7, 0xf0, 0xdb, 0x0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x5, 0xf1,
-    0xea, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x5, 0xf2, 0xea, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf0,
-    0x0, 0x0, 0x5, 0xf2, 0xdb, 0x0, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x5, 0xf1, 0xcd, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x7, 0xf0,
-    0x9f, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0,
-    0x9, 0xd0, 0x6f, 0x30, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0,
-    0x0, 0x0, 0xd, 0xa0, 0x1f, 0x80, 0x0, 0x0,
-    0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0xf0, 0x0, 0x0, 0x2f, 0x60, 0xc, 0xe0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x7a, 0xf2, 0x0, 0x0, 0xaf, 0x0,
-    0x5, 0xf5, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x10,
-    0x0, 0x0, 0x2a, 0xf9, 0x6, 0xf9, 0x0, 0x6,
-    0xf7, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x2,
-    0xcf, 0xfc, 0x99, 0xad, 0xff, 0x60, 0x0, 0xdf,
-    0xc9, 0xcf, 0xa0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xeb, 0x71, 0x0,
-    0x0, 0x19, 0xef, 0xd6, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0xd7, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xfe, 0xb9,
-    0x87, 0x89, 0xbe, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x69, 0xce, 0xff, 0xfe, 0xb8, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x1f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x80, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x6f, 0xda, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xef, 0x30, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x3f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0xa, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50,
-
-    /* U+0042 "B" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8,
-    0x30, 0x0, 0x0, 0x5, 0xfd, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xab, 0xcf, 0xff, 0xc2, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf,
-    0xf3, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xe0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x20, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0x80, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x49, 0xff, 0x70, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x5f, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xcf, 0xff, 0xc3, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x8f, 0xf7, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xf4, 0x5, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x15, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0x60, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xff, 0xa0, 0x5,
-    0xfd, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbc, 0xef,
-    0xfe, 0x60, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xec, 0x95, 0x0, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9d, 0xef, 0xfe,
-    0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xff, 0xdc, 0xce, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf9, 0x30, 0x0, 0x0,
-    0x4, 0x9f, 0xfd, 0x20, 0x0, 0x0, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xe1,
-    0x0, 0x9, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x80, 0x0, 0x6f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x90, 0x0, 0x0, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xe1,
-    0x0, 0x0, 0x6, 0xff, 0xf9, 0x30, 0x0, 0x0,
-    0x4, 0x9f, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xff, 0xdc, 0xce, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xef, 0xfe,
-    0xc9, 0x40, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xec, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xdf, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x26, 0xcf, 0xfb, 0x10, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xe2, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x20,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x10, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x20, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xe2, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26,
-    0xcf, 0xfb, 0x10, 0x0, 0x0, 0x5f, 0xec, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xdf, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xb7, 0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x65, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc5, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0x80, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0,
-
-    /* U+0046 "F" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x65, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc5, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xc9, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe,
-    0xda, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xff, 0xff, 0xec, 0xcd, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xf9, 0x40, 0x0, 0x0,
-    0x3, 0x8e, 0xff, 0x50, 0x0, 0x0, 0x8f, 0xf8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x9, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xa0, 0x0, 0x6f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x63,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x6f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x9, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x9f, 0xf8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6,
-    0x0, 0x0, 0x6, 0xff, 0xf9, 0x40, 0x0, 0x0,
-    0x3, 0x8e, 0xff, 0x60, 0x0, 0x0, 0x0, 0x18,
-    0xff, 0xff, 0xec, 0xcd, 0xff, 0xff, 0x92, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe,
-    0xc9, 0x51, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x45, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x45,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x45, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x5f, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0x45, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x45, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x45, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x45,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-
-    /* U+0049 "I" */
-    0x5f, 0x95, 0xf9, 0x5f, 0x95, 0xf9, 0x5f, 0x95,
-    0xf9, 0x5f, 0x95, 0xf9, 0x5f, 0x95, 0xf9, 0x5f,
-    0x95, 0xf9, 0x5f, 0x95, 0xf9, 0x5f, 0x95, 0xf9,
-    0x5f, 0x95, 0xf9, 0x5f, 0x95, 0xf9, 0x5f, 0x95,
-    0xf9, 0x5f, 0x95, 0xf9, 0x5f, 0x95, 0xf9, 0x5f,
-    0x90,
-
-    /* U+004A "J" */
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x5, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x6, 0x90, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60,
-    0x1, 0xdf, 0xc4, 0x0, 0x0, 0x3c, 0xfc, 0x0,
-    0x0, 0x1a, 0xff, 0xec, 0xce, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe2, 0x5, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe2, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf4, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x1d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x1d, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x1c,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0xb, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0xb, 0xfe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0xa, 0xfb, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0xa, 0xfc,
-    0x0, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x99, 0xfc, 0x0, 0x0, 0x2e, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xe1, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xa0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x80, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0x50, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x20, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x10,
-
-    /* U+004C "L" */
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xca, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe,
-
-    /* U+004D "M" */
-    0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0x5f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfa, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x5f, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0xfa, 0x5f, 0x89,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd4, 0xfa, 0x5f, 0x81, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x44, 0xfa, 0x5f, 0x80, 0x7f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x3, 0xfa,
-    0x5f, 0x80, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x3, 0xfa, 0x5f, 0x80,
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x3, 0xfa, 0x5f, 0x80, 0x0, 0xbf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x10,
-    0x3, 0xfa, 0x5f, 0x80, 0x0, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x3, 0xfa,
-    0x5f, 0x80, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x3, 0xfa, 0x5f, 0x80,
-    0x0, 0x1, 0xee, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x40, 0x0, 0x3, 0xfa, 0x5f, 0x80, 0x0, 0x0,
-    0x6f, 0x80, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x3, 0xfa, 0x5f, 0x80, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x3, 0xfa,
-    0x5f, 0x80, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x3, 0xfa, 0x5f, 0x80,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0xde, 0x10,
-    0x0, 0x0, 0x3, 0xfa, 0x5f, 0x80, 0x0, 0x0,
-    0x0, 0x2f, 0xd0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x5f, 0x80, 0x0, 0x0, 0x0, 0x1, 0xee, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x5f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x5f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x5f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x5f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x5f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb,
-
-    /* U+004E "N" */
-    0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x45, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x45, 0xfe, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0x9b,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x45, 0xf9, 0x1d, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90, 0x3f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x45, 0xf9, 0x0, 0x6f, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0, 0x9f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x45,
-    0xf9, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf4, 0x5f, 0x90, 0x0, 0x2, 0xef,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x45, 0xf9,
-    0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x5f, 0x90, 0x0, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x45, 0xf9, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x1e, 0xf7,
-    0x0, 0x0, 0x0, 0xaf, 0x45, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0xa, 0xf4,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1,
-    0x0, 0x0, 0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0xa, 0xf4, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x50, 0xa, 0xf4, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0xaf, 0x45, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfd, 0xa, 0xf4, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0xaf,
-    0x45, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xfe, 0xf4, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x45,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf4, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe,
-    0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x19, 0xff, 0xff, 0xdc, 0xce, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xe8, 0x30, 0x0, 0x0, 0x4, 0x9f, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xf6, 0x0, 0x0,
-    0x0, 0x9, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x6f,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x1, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfd, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x5f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x9f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0xdf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfb, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x5f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x6f,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x9, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x9f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xe8, 0x30, 0x0, 0x0,
-    0x4, 0x9f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x19, 0xff, 0xff, 0xdc, 0xce, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9d, 0xef, 0xfe, 0xc9, 0x40, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x61,
-    0x0, 0x0, 0x5, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xce, 0xff, 0xfa, 0x10, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6d, 0xfe, 0x30, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x20, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x95, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc5, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x45, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xe3, 0x0,
-    0x5f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xef, 0xff,
-    0xa1, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xa6, 0x10, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe,
-    0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xfd, 0xcc, 0xef, 0xff,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xe8, 0x30, 0x0, 0x0, 0x4, 0x9f, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0,
-    0x0, 0x6, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x1,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0xdf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfb, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0xdf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x30, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf6, 0x0, 0x1, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0,
-    0x0, 0x6, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
-    0x9, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xe8, 0x30, 0x0, 0x0, 0x4, 0x9f, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0xfd, 0xcc, 0xef, 0xff, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x9d, 0xef,
-    0xff, 0xd9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x1c, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x81, 0x0,
-    0x0, 0x4d, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfc, 0xab, 0xef,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5b, 0xef, 0xfc, 0x71, 0x0,
-
-    /* U+0052 "R" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x71,
-    0x0, 0x0, 0x0, 0x5f, 0xec, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xef, 0xff, 0xa1, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6d, 0xfe, 0x30,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x90, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf2, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6d, 0xfe, 0x30, 0x0,
-    0x5f, 0xeb, 0xbb, 0xbb, 0xbb, 0xbc, 0xef, 0xff,
-    0x91, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x30, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf9, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe1,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x59, 0xde, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xdb,
-    0xbd, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x7, 0xff,
-    0xa3, 0x0, 0x0, 0x0, 0x38, 0xef, 0xe0, 0x0,
-    0x4, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x68, 0x0, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xfb, 0x73, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xff, 0xb6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x6a, 0xef, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x8,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0xdf, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x20, 0x1, 0xbf, 0xfb, 0x51,
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0x50, 0x0, 0x0,
-    0x4c, 0xff, 0xfe, 0xcb, 0xbd, 0xff, 0xfc, 0x30,
-    0x0, 0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff, 0xec,
-    0x94, 0x0, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xac, 0xcc, 0xcc, 0xcc, 0xcd,
-    0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0055 "U" */
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfb, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf7, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x4f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0,
-    0x0, 0x5, 0xff, 0xc5, 0x10, 0x0, 0x0, 0x4b,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xfe,
-    0xcc, 0xdf, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xce, 0xff, 0xec, 0x94, 0x0, 0x0,
-    0x0,
-
-    /* U+0056 "V" */
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0,
-    0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x31, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x5, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf4, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x2f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x8, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x50, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0xfd,
-    0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x10, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x60, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x5f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0xe,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x1, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x20, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x1b, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x84, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x80, 0x0, 0x6f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe1, 0x0, 0x0, 0x1, 0xef, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50, 0x0,
-    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x1,
-    0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x8f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x1e, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x6, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfe, 0x10, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x40, 0x0, 0x0, 0xa, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0,
-    0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x2, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70,
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf3,
-
-    /* U+0059 "Y" */
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
-    0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x1, 0xee,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xbc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc2, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-
-    /* U+005B "[" */
-    0x5f, 0xff, 0xff, 0xc5, 0xfd, 0xaa, 0xa7, 0x5f,
-    0x80, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x5f, 0x80,
-    0x0, 0x5, 0xf8, 0x0, 0x0, 0x5f, 0x80, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x5f, 0x80, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x5f, 0x80, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x5f,
-    0x80, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x5f, 0x80,
-    0x0, 0x5, 0xf8, 0x0, 0x0, 0x5f, 0x80, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x5f, 0x80, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x5f, 0x80, 0x0, 0x5, 0xfd, 0xaa, 0xa7, 0x5f,
-    0xff, 0xff, 0xc0,
-
-    /* U+005C "\\" */
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0,
-
-    /* U+005D "]" */
-    0x2f, 0xff, 0xff, 0xf1, 0xaa, 0xaa, 0xff, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0xef, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0xef, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0xef, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0xef, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0xe, 0xf1, 0xaa, 0xaa, 0xff, 0x2f,
-    0xff, 0xff, 0xf0,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x8, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xda, 0xe8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf3, 0x8e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xc0, 0x1f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0xb, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xe8, 0x0, 0x0, 0xda, 0x0, 0x0,
-    0x0, 0x6, 0xf2, 0x0, 0x0, 0x7f, 0x10, 0x0,
-    0x0, 0xd, 0xb0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x0, 0xae, 0x0, 0x0, 0x0, 0x3, 0xf5, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x30,
-    0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xa0,
-    0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1,
-
-    /* U+005F "_" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x40,
-
-    /* U+0060 "`" */
-    0x17, 0x84, 0x0, 0x0, 0x0, 0x3e, 0xf7, 0x0,
-    0x0, 0x0, 0x1b, 0xf9, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x10, 0x0, 0x0, 0x3, 0xed, 0x20,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x49, 0xce, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x6, 0xef, 0xfe, 0xba, 0xbe, 0xff, 0xc2,
-    0x0, 0xc, 0xfe, 0x71, 0x0, 0x0, 0x3, 0xbf,
-    0xd1, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x12,
-    0x22, 0x22, 0x22, 0x9f, 0x50, 0x0, 0x7c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x2, 0xdf, 0xd8,
-    0x65, 0x55, 0x55, 0x55, 0xbf, 0x50, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x7f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x5b, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x5a,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xdf,
-    0x50, 0xbf, 0xa1, 0x0, 0x0, 0x0, 0x5e, 0xb7,
-    0xf5, 0x0, 0xbf, 0xfa, 0x76, 0x79, 0xdf, 0x90,
-    0x7f, 0x50, 0x0, 0x49, 0xdf, 0xff, 0xd9, 0x20,
-    0x7, 0xf5,
-
-    /* U+0062 "b" */
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x5b, 0xef, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x4e, 0xff, 0xdb, 0xbd,
-    0xff, 0xf6, 0x0, 0x0, 0xfe, 0x7, 0xfe, 0x60,
-    0x0, 0x0, 0x18, 0xff, 0xa0, 0x0, 0xfe, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf9, 0x0,
-    0xff, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x50, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0xfe, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x50,
-    0xfd, 0x5f, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xf9, 0x0, 0xfd, 0x7, 0xfe, 0x61, 0x0, 0x0,
-    0x28, 0xff, 0xa0, 0x0, 0xfd, 0x0, 0x4e, 0xff,
-    0xdb, 0xbd, 0xff, 0xf6, 0x0, 0x0, 0xfd, 0x0,
-    0x0, 0x5b, 0xef, 0xfe, 0xb6, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x27, 0xce, 0xff, 0xeb, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xdb, 0xbd,
-    0xff, 0xe5, 0x0, 0x0, 0x1, 0xdf, 0xd6, 0x0,
-    0x0, 0x1, 0x8f, 0xf7, 0x0, 0x1, 0xdf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf2, 0x0, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x40,
-    0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0x20, 0x0, 0x1c, 0xfd, 0x60, 0x0, 0x0,
-    0x28, 0xff, 0x70, 0x0, 0x0, 0x8, 0xff, 0xfd,
-    0xbc, 0xef, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x1,
-    0x7c, 0xef, 0xfe, 0xa6, 0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x28,
-    0xce, 0xff, 0xd9, 0x30, 0x0, 0x3f, 0xa0, 0x0,
-    0x1, 0x9f, 0xff, 0xcb, 0xbd, 0xff, 0xb1, 0x3,
-    0xfa, 0x0, 0x2, 0xdf, 0xd5, 0x0, 0x0, 0x2,
-    0x8f, 0xe2, 0x3f, 0xa0, 0x1, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xe5, 0xfa, 0x0, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xdf,
-    0xa0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfa, 0x9, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa2, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xa0, 0x9f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xa0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfd, 0xfa, 0x0, 0x1d, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xee, 0x4f, 0xa0, 0x0,
-    0x2d, 0xfd, 0x50, 0x0, 0x0, 0x29, 0xfe, 0x33,
-    0xfa, 0x0, 0x0, 0x19, 0xff, 0xfd, 0xbc, 0xef,
-    0xfb, 0x20, 0x3f, 0xa0, 0x0, 0x0, 0x2, 0x8c,
-    0xef, 0xfd, 0x94, 0x0, 0x3, 0xfa,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xeb, 0xac,
-    0xef, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xef, 0xb3,
-    0x0, 0x0, 0x4, 0xcf, 0xc1, 0x0, 0x0, 0x1e,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0xf, 0xd1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x2f, 0xd4, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x1, 0xcf, 0xe6, 0x10, 0x0,
-    0x0, 0x5d, 0xfc, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xfd, 0xbb, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xbe, 0xff, 0xeb, 0x71, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x19, 0xdf, 0xfd, 0x81, 0x0,
-    0x0, 0x3, 0xff, 0xea, 0xad, 0xfa, 0x0, 0x0,
-    0xd, 0xf6, 0x0, 0x0, 0x42, 0x0, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x2a,
-    0xaa, 0xdf, 0xca, 0xaa, 0xaa, 0x60, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0xf, 0xe0, 0x0, 0x1, 0xaf, 0xfd, 0xa9,
-    0x9b, 0xef, 0xe4, 0x0, 0xfe, 0x0, 0x3, 0xef,
-    0xa3, 0x0, 0x0, 0x0, 0x4c, 0xf7, 0xf, 0xe0,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf6, 0xfe, 0x0, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xe0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0xb,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x1f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xe0, 0x3f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfe, 0x0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xdf, 0xe0, 0x0, 0xcf,
-    0xc2, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf3, 0xfe,
-    0x0, 0x1, 0xbf, 0xfa, 0x51, 0x0, 0x25, 0xbf,
-    0xe3, 0xf, 0xe0, 0x0, 0x0, 0x6e, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x4, 0x8a, 0xbb, 0x96, 0x10, 0x0, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x8, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0x70, 0x0, 0x2d, 0xff, 0x94,
-    0x0, 0x0, 0x0, 0x28, 0xff, 0xa0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xdc, 0xbc, 0xef, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0xce, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa4, 0x0,
-    0x0, 0xfe, 0x0, 0x9f, 0xfe, 0xcb, 0xcf, 0xff,
-    0xb1, 0x0, 0xfe, 0xc, 0xfa, 0x30, 0x0, 0x0,
-    0x4d, 0xfd, 0x10, 0xfe, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc,
-
-    /* U+0069 "i" */
-    0x2e, 0xe2, 0x8f, 0xf7, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0,
-    0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0,
-    0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0,
-    0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0,
-    0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0, 0xf, 0xe0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x5f, 0xfb, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x7, 0x10, 0x0, 0x1d, 0xf6, 0x2, 0xff, 0xca,
-    0xbf, 0xfb, 0x0, 0x4, 0xae, 0xff, 0xc6, 0x0,
-    0x0,
-
-    /* U+006B "k" */
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x80, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xf7, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0x60, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf5, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x50, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x8f, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x9, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0xaf, 0xcc, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0xb, 0xfb, 0x1, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0xff, 0xcf, 0xa0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0,
-    0x6, 0xfe, 0x10, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x50, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfd, 0x10, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf7,
-
-    /* U+006C "l" */
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
-    0xfe, 0xfe, 0xfe, 0xfe,
-
-    /* U+006D "m" */
-    0xfd, 0x0, 0x3, 0x9d, 0xff, 0xfc, 0x82, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xd9, 0x30, 0x0,
-    0xf, 0xd0, 0x1a, 0xff, 0xb9, 0x9a, 0xef, 0xf7,
-    0x0, 0x0, 0x8f, 0xfc, 0xa9, 0xad, 0xff, 0xa0,
-    0x0, 0xfd, 0x1d, 0xf7, 0x0, 0x0, 0x0, 0x5e,
-    0xf8, 0x0, 0xbf, 0xa2, 0x0, 0x0, 0x2, 0xcf,
-    0xc0, 0xf, 0xda, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf4, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x7f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x9f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xaf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xaf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xaf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa,
-
-    /* U+006E "n" */
-    0xfd, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa4, 0x0,
-    0x0, 0xfd, 0x0, 0x9f, 0xfc, 0x99, 0xad, 0xff,
-    0xb1, 0x0, 0xfd, 0xc, 0xf8, 0x10, 0x0, 0x0,
-    0x2b, 0xfd, 0x10, 0xfd, 0xae, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x90, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf1, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xcb,
-    0xbd, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xd5, 0x0, 0x0, 0x2, 0x8f, 0xf8, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf7, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xf3, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x9,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf6, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x92, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x60, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x9, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x30,
-    0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0x70, 0x0, 0x0, 0x1d, 0xfd, 0x50, 0x0,
-    0x0, 0x29, 0xff, 0x80, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfd, 0xbc, 0xef, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa5, 0x0,
-    0x0, 0x0,
-
-    /* U+0070 "p" */
-    0xfd, 0x0, 0x0, 0x5b, 0xef, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x4e, 0xff, 0xdb, 0xbd,
-    0xff, 0xf6, 0x0, 0x0, 0xfd, 0x7, 0xfe, 0x60,
-    0x0, 0x0, 0x18, 0xff, 0xa0, 0x0, 0xfd, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf9, 0x0,
-    0xfe, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x50, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0xff, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x50,
-    0xfe, 0x5f, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xf9, 0x0, 0xfe, 0x7, 0xfe, 0x61, 0x0, 0x0,
-    0x28, 0xff, 0xa0, 0x0, 0xfe, 0x0, 0x4e, 0xff,
-    0xdb, 0xbd, 0xff, 0xf6, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x5b, 0xef, 0xfe, 0xb6, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xd9, 0x30,
-    0x0, 0x3f, 0xa0, 0x0, 0x1, 0x9f, 0xff, 0xcb,
-    0xbd, 0xff, 0xb2, 0x3, 0xfa, 0x0, 0x2, 0xdf,
-    0xd5, 0x0, 0x0, 0x2, 0x8f, 0xe3, 0x3f, 0xa0,
-    0x1, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xe4, 0xfa, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xdf, 0xa0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfa, 0x9,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xa0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfa, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa2, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xa0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0xe, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xa0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xfa, 0x3, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xa0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0xfa,
-    0x0, 0x1d, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xee, 0x5f, 0xa0, 0x0, 0x2d, 0xfd, 0x50, 0x0,
-    0x0, 0x29, 0xfe, 0x23, 0xfa, 0x0, 0x0, 0x19,
-    0xff, 0xfd, 0xbc, 0xef, 0xfb, 0x10, 0x3f, 0xa0,
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0x93, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xa0,
-
-    /* U+0072 "r" */
-    0xfd, 0x0, 0x4, 0x9d, 0xf6, 0xfd, 0x1, 0xbf,
-    0xfc, 0xb4, 0xfd, 0x1d, 0xf7, 0x10, 0x0, 0xfd,
-    0xae, 0x20, 0x0, 0x0, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x6b, 0xef, 0xff, 0xd9, 0x50, 0x0,
-    0x0, 0x3e, 0xff, 0xcb, 0xab, 0xef, 0xfe, 0x70,
-    0x3, 0xff, 0x70, 0x0, 0x0, 0x1, 0x7e, 0xd0,
-    0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xd7, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xc9, 0x62, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0x9c, 0xff, 0xff, 0xd5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6b, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x5a, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0xaf, 0xf9, 0x30, 0x0, 0x0, 0x2, 0xaf, 0xd0,
-    0x7, 0xef, 0xff, 0xcb, 0xab, 0xdf, 0xfb, 0x10,
-    0x0, 0x4, 0x9c, 0xef, 0xfe, 0xc9, 0x30, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x48, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x2a, 0xaa, 0xdf, 0xca, 0xaa, 0xaa,
-    0x60, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0,
-    0x53, 0x0, 0x0, 0x4, 0xff, 0xea, 0xad, 0xfa,
-    0x0, 0x0, 0x0, 0x2a, 0xef, 0xfc, 0x70,
-
-    /* U+0075 "u" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x63, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf6, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x63, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x63,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf6, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x63, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf6, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x63, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x63, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x60, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf6, 0xd, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x60, 0x8f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6,
-    0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x8f, 0x60, 0x5, 0xff, 0xa2, 0x0, 0x0, 0x5,
-    0xef, 0x47, 0xf6, 0x0, 0x4, 0xef, 0xfe, 0xcb,
-    0xdf, 0xfd, 0x30, 0x7f, 0x60, 0x0, 0x0, 0x6b,
-    0xef, 0xfe, 0xb6, 0x0, 0x7, 0xf6,
-
-    /* U+0076 "v" */
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x8,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf6, 0x5f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xcf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x31, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xd0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0x0, 0xed, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x7, 0xf5, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x0, 0x4, 0xf7, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0x5f, 0x60, 0x0,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x10, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x4,
-    0xf7, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0,
-    0xde, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x30, 0x8, 0xf2, 0x0, 0x0, 0x0,
-    0x7, 0xf5, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf9, 0x0, 0xec, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0xd, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xe0, 0x4f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x13, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x4b, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf7, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfc, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xde, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x10, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0x30, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x1e, 0xf2,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x1e, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x38,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x9c, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x2f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe1,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x30, 0x0, 0x3, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0x10, 0x1, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8,
-
-    /* U+0079 "y" */
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf6, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xd0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf1, 0x1f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x7f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xb1, 0x0, 0x2, 0xcf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xca, 0xcf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xef, 0xeb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+007A "z" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x31, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xcf,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x8, 0xdf, 0xf4, 0x0, 0x0, 0xcf,
-    0xfb, 0xa2, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x6a, 0xcf, 0xb0, 0x0, 0x0, 0xaf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xbf,
-    0xfb, 0xa2, 0x0, 0x0, 0x7, 0xdf, 0xf4,
-
-    /* U+007C "|" */
-    0x5f, 0x65, 0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x65,
-    0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x65, 0xf6, 0x5f,
-    0x65, 0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x65, 0xf6,
-    0x5f, 0x65, 0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x65,
-    0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x65, 0xf6, 0x5f,
-    0x65, 0xf6, 0x5f, 0x65, 0xf6, 0x5f, 0x65, 0xf6,
-    0x5f, 0x65, 0xf6, 0x5f, 0x60,
-
-    /* U+007D "}" */
-    0x2f, 0xfd, 0x91, 0x0, 0x0, 0x1a, 0xbe, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x1f,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0xa8, 0x0, 0x0, 0x3,
-    0xef, 0xfc, 0x0, 0x0, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x1f,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0,
-    0x0, 0x0, 0xcf, 0x70, 0x0, 0x1a, 0xae, 0xfd,
-    0x0, 0x0, 0x2f, 0xfd, 0x91, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x4, 0x77, 0x40, 0x0, 0x0, 0x0, 0x2,
-    0x81, 0x0, 0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x5, 0xf0, 0xa, 0xf6, 0x0, 0x6f, 0xe2, 0x0,
-    0x0, 0x9, 0xd0, 0x1f, 0x70, 0x0, 0x2, 0xee,
-    0x40, 0x0, 0x3f, 0x70, 0x5f, 0x0, 0x0, 0x0,
-    0x1d, 0xfb, 0x8a, 0xfd, 0x0, 0x8d, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0xfe, 0x91, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x2, 0x41, 0x0, 0x0, 0x42, 0x0,
-    0x0, 0x1e, 0xc0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x7f, 0x60, 0x0, 0x9, 0xf5,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x5f, 0x80, 0x0,
-    0x1e, 0xd0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0xd, 0xe1, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x8f, 0x60, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0xb,
-    0xf3, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x1, 0xee,
-    0x10, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0x1, 0xec, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0xc, 0xe1, 0x0, 0x7,
-    0xf6,
-
-    /* U+00BB "»" */
-    0x14, 0x20, 0x0, 0x4, 0x30, 0x0, 0x0, 0x0,
-    0xde, 0x10, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x1, 0xed, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x1e,
-    0xd0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x4f,
-    0xa0, 0x0, 0x1d, 0xe1, 0x0, 0x0, 0x7, 0xf7,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x3, 0xfa, 0x0,
-    0x0, 0xde, 0x10, 0x0, 0x1, 0xed, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x6f,
-    0x70, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x3f, 0xa0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x1d, 0xd0, 0x0,
-    0x0, 0x2e, 0xc0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x0, 0x68, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xee, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x3f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0x60, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xeb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xa0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xc1, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x5, 0xb3, 0x0, 0x0, 0x99, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfc, 0x0, 0x6,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x2, 0xdd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x3f, 0xec,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x60,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xeb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xa0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xec,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc1,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2,
-
-    /* U+0402 "Ђ" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x6c,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x37, 0xbe, 0xff, 0xff,
-    0xfc, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x7d, 0xff, 0xfd, 0xba, 0xab, 0xdf,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x94, 0x0, 0x0, 0x0, 0x2, 0x9f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x2,
-    0xdb, 0xaa, 0xbf, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x3, 0xef,
-    0xff, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x87, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x3f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xc2, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe,
-    0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xff, 0xdc, 0xde, 0xff, 0xfd, 0x60, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xf9, 0x30, 0x0, 0x0,
-    0x15, 0xaf, 0xfc, 0x20, 0x0, 0x0, 0x6f, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xe1,
-    0x0, 0x6, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x2f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x8f, 0xda, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x80, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x7f, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xe1,
-    0x0, 0x0, 0x5, 0xef, 0xf8, 0x30, 0x0, 0x0,
-    0x15, 0xaf, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xff, 0xdc, 0xde, 0xff, 0xfd, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe,
-    0xb8, 0x30, 0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x3, 0x8c, 0xef, 0xff, 0xda, 0x61,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xdc, 0xbc,
-    0xef, 0xff, 0xa2, 0x0, 0x0, 0x4f, 0xfb, 0x40,
-    0x0, 0x0, 0x2, 0x6c, 0xff, 0x20, 0x1, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xbf, 0xff, 0xc8, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x8c, 0xff, 0xff,
-    0xc7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x15, 0x9d, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x49, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x9f, 0xd4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x50,
-    0x8, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x2, 0x9f,
-    0xf8, 0x0, 0x0, 0x3a, 0xff, 0xfe, 0xcb, 0xbc,
-    0xef, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x16, 0xad,
-    0xff, 0xfe, 0xd9, 0x50, 0x0, 0x0,
-
-    /* U+0406 "І" */
-    0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3,
-    0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f,
-    0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb,
-    0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3,
-    0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f,
-    0xb0,
-
-    /* U+0407 "Ї" */
-    0x6, 0xb3, 0x0, 0x1, 0xa9, 0x0, 0xff, 0xa0,
-    0x0, 0x6f, 0xf3, 0xa, 0xf5, 0x0, 0x2, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x6, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0xd, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xef, 0x50,
-    0x2, 0xef, 0xb3, 0x0, 0x0, 0x4d, 0xfb, 0x0,
-    0x0, 0x1b, 0xff, 0xec, 0xce, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xa5, 0x0, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xbd, 0xff, 0xfb, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xcf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
-    0x0, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x60, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xfc, 0x0,
-    0x0, 0x4, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0xff, 0xd1, 0x0, 0x7e, 0xef,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xef,
-    0xff, 0xf9, 0x0, 0x0, 0x8f, 0xfd, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa6, 0x10,
-    0x0, 0x0,
-
-    /* U+040A "Њ" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xec, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xbb, 0x97, 0x20, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x37, 0xef, 0xf6, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x40, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf6, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xc0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x9f, 0xf6, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xab, 0xef, 0xfd, 0x30, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xc9, 0x40, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x15, 0x9c, 0xef, 0xfe,
-    0xc9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x5b, 0xff, 0xff, 0xdc, 0xcd, 0xff,
-    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xb6, 0x20, 0x0, 0x0, 0x16, 0xdf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf3,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x10,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xec, 0xcc, 0xcc, 0xcf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x4, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf6, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x30, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe2, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x0, 0x78, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x93,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xdf, 0x93, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xb6, 0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe1, 0x6f, 0x93, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x6,
-    0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0x0, 0x6f, 0x93, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x6, 0xf9,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd,
-    0x0, 0x0, 0x6f, 0x93, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x6, 0xf9, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x60, 0x0,
-    0x0, 0x6f, 0x93, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0,
-    0x6f, 0x93, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xb0, 0x0,
-    0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x93, 0xfb, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x3f, 0xb0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x93,
-    0xfb, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x3f, 0xb0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x93, 0xfb,
-    0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x3f, 0xb0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x93, 0xfb, 0x5f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf9, 0x3f, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x93, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x93, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0x0, 0x6, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd5, 0x10, 0x26, 0xee, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x23, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfa, 0x4, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x20, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x10,
-    0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0xbf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x24, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x4,
-    0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0xce, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xef,
-    0xeb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+040F "Џ" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x3f, 0xec, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x58, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x1f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x60, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xfb, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x70, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0,
-
-    /* U+0411 "Б" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xeb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xb8, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xe9, 0x99, 0x99, 0x99, 0x99, 0x98,
-    0x63, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x59, 0xff,
-    0xd2, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xfd, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf3, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x90, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x10,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0xf4, 0x0, 0x3f, 0xea, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xbc, 0xff, 0xfb, 0x20, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xb7, 0x20, 0x0,
-    0x0,
-
-    /* U+0412 "В" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb7,
-    0x10, 0x0, 0x0, 0x3f, 0xea, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xbc, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xef, 0xb0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf7, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xd1, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x6c, 0xfb, 0x10, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x3f, 0xe9, 0x99, 0x99, 0x99, 0x99,
-    0x9a, 0xbe, 0xfe, 0x80, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xfd, 0x10,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xc0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4b, 0xfe, 0x20, 0x3f, 0xea, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xcf, 0xff, 0xb2, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x83, 0x0,
-    0x0,
-
-    /* U+0413 "Г" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x3f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xc2, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xce, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x6, 0xce, 0xff, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xfd, 0xcc,
-    0xc5, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x9f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x79, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf7, 0x9f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x79, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x70,
-
-    /* U+0415 "Е" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0x60, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xa0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xc1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+0416 "Ж" */
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x20, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x1e,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x2f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x1e, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfc, 0xcc, 0xcc, 0xcf, 0xfc, 0xcc, 0xcc,
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x1, 0xef, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x4f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x60, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x7f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf5, 0x0,
-    0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfe, 0x10, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x4, 0x8b, 0xef, 0xff, 0xdb, 0x71,
-    0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xfd, 0xcb,
-    0xce, 0xff, 0xf9, 0x10, 0x0, 0x4, 0xff, 0xd8,
-    0x30, 0x0, 0x0, 0x2, 0x7e, 0xfe, 0x20, 0x0,
-    0x1c, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x37, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5a, 0xaa, 0xaa, 0xab, 0xdf,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xdf, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x28,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x39, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0x90, 0x9, 0xff, 0xc6, 0x20,
-    0x0, 0x0, 0x0, 0x28, 0xff, 0xa0, 0x0, 0x3,
-    0xbf, 0xff, 0xfd, 0xbb, 0xbc, 0xff, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0x16, 0x9c, 0xef, 0xff, 0xec,
-    0x94, 0x0, 0x0, 0x0,
-
-    /* U+0418 "И" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x93, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0x93, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfd, 0xf9, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfb,
-    0x6f, 0x93, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x16, 0xf9, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x6f,
-    0x93, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0x6, 0xf9, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x6f, 0x93,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x0, 0x6, 0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x6f, 0x93, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0, 0x0,
-    0x6, 0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x6f, 0x93, 0xfb, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x6,
-    0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x6f, 0x93, 0xfb, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xb0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x93, 0xfb, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f,
-    0xb0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x93, 0xfb, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xb0,
-    0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x93, 0xfb, 0x9, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xb5, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x93, 0xfd, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x93,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0x2, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0x0, 0x0, 0x0, 0x4f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xde, 0x10, 0x0, 0x0, 0xc, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xee, 0x61,
-    0x1, 0x5d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x32,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x93,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xdf, 0x93, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xb6, 0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe1, 0x6f, 0x93, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x6,
-    0xf9, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0x0, 0x6f, 0x93, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x6, 0xf9,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd,
-    0x0, 0x0, 0x6f, 0x93, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x6, 0xf9, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x60, 0x0,
-    0x0, 0x6f, 0x93, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0,
-    0x6f, 0x93, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xb0, 0x0,
-    0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x93, 0xfb, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x3f, 0xb0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x93,
-    0xfb, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x3f, 0xb0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x93, 0xfb,
-    0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x3f, 0xb0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x93, 0xfb, 0x5f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf9, 0x3f, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x93, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x93, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-
-    /* U+041A "К" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x70, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe1,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x10, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xec, 0xcc, 0xcc, 0xcf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe2,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf7, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x50, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf2,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x9f, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xfe, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x6,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0xb, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x4, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe7, 0xee, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x8f, 0xfd, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0,
-
-    /* U+041C "М" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfd, 0x3f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfd, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
-    0x3f, 0xce, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0xfd, 0x3f, 0xb6,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe2, 0xfd, 0x3f, 0xb0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x61, 0xfd, 0x3f, 0xb0, 0x4f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x1, 0xfd,
-    0x3f, 0xb0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x1, 0xfd, 0x3f, 0xb0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x9f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20,
-    0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x1e, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x1, 0xfd,
-    0x3f, 0xb0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe1, 0x0, 0x1, 0xfd, 0x3f, 0xb0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x1, 0xfd,
-    0x3f, 0xb0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0xcf, 0x20,
-    0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x1e, 0xe0, 0x5, 0xf9, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0xd, 0xe1, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x9f,
-    0x60, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd,
-
-    /* U+041D "Н" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x73, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x73, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x73, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x73, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x73,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x73, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0x3f, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0x73, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x73, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x73, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x73, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x73, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x73, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x73,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xff,
-    0xda, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xfe, 0xdc, 0xdf, 0xff,
-    0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xfa, 0x51, 0x0, 0x0, 0x3, 0x8e, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xb2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xa0, 0x0,
-    0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x70, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf2, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x70, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x8,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x9f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x4f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfa, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x70, 0x0, 0x0,
-    0x5, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xfa, 0x51, 0x0, 0x0, 0x3, 0x8e, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xfe, 0xdc, 0xdf, 0xff, 0xf9, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xef,
-    0xff, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa3, 0xfe, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xfa, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xa3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfa, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xa3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xa3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xa3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-
-    /* U+0420 "Р" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72,
-    0x0, 0x0, 0x0, 0x3f, 0xec, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xef, 0xff, 0xb2, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x5c, 0xff, 0x50,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf4, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x5c, 0xff, 0x50, 0x0,
-    0x3f, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xef, 0xff,
-    0xb2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdb, 0x72, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xff,
-    0xda, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xed, 0xcd, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xfa, 0x51, 0x0, 0x0,
-    0x2, 0x7d, 0xff, 0x50, 0x0, 0x0, 0x5f, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xb1, 0x0, 0x2f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xb1, 0x0, 0x0, 0x5f, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x3, 0xdf, 0xfa, 0x51, 0x0, 0x0,
-    0x2, 0x7d, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xed, 0xcd, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xff,
-    0xda, 0x61, 0x0, 0x0,
-
-    /* U+0422 "Т" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0423 "У" */
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x4f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf2, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x4, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x10, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x10, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0xcf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xad,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0x4e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xdc, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbe,
-    0xfe, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x6a, 0xce, 0xff, 0xff, 0xed,
-    0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xff, 0xfd, 0xba, 0xef, 0xba, 0xce,
-    0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xf9, 0x40, 0x0, 0xa, 0xf3, 0x0, 0x2,
-    0x6c, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0x3, 0xcf, 0xe2, 0x0, 0x0, 0x8, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe2, 0x0, 0x4, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x60, 0x4f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf2, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x5e, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x59,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x4f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x4, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x8, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xe2, 0x0, 0x0, 0x8, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0x3, 0xcf, 0xe2, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0xf9, 0x41, 0x0, 0xa, 0xf3, 0x0, 0x2, 0x6c,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xff, 0xfe, 0xba, 0xef, 0xba, 0xce, 0xff, 0xfa,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x6a, 0xce, 0xff, 0xff, 0xed, 0xb8, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x58, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe1, 0x0, 0x4f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0,
-    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf9, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x4f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xe1, 0x0, 0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0xa, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x65, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0xaf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x10, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x40, 0x0, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xa0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x50, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0x10, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0,
-
-    /* U+0426 "Ц" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x3, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcf, 0xfc, 0xcc, 0xc1, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x80,
-
-    /* U+0427 "Ч" */
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x1f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x1f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x1f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x1f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x8, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x2,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x7f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xcf, 0xf5, 0x0, 0x8, 0xff,
-    0xd7, 0x30, 0x0, 0x14, 0x7b, 0xff, 0xfe, 0xf5,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc6, 0x1a, 0xf5, 0x0, 0x0, 0x0, 0x27, 0x9b,
-    0xbb, 0xa7, 0x41, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5,
-
-    /* U+0428 "Ш" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc3, 0xfe, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xec, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-
-    /* U+0429 "Щ" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfe,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xec,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xcc,
-    0xcc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0,
-
-    /* U+042A "Ъ" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0xcc, 0xcc, 0xcc, 0xcf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xb8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xbd,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xef, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xea, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xbd, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xa6, 0x10, 0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x3f, 0xea, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xbd, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0xfe,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
-    0xdf, 0xe2, 0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50, 0x0,
-    0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0xfe,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0xfe, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xfe,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xd0, 0x0, 0x0, 0xfe, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x90, 0x0, 0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x30, 0x0,
-    0x0, 0xfe, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xfa, 0x0, 0x0, 0x0, 0xfe,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xef, 0xb0, 0x0, 0x0, 0x0, 0xfe, 0x3f, 0xea,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xbd, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xa6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe,
-
-    /* U+042C "Ь" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb7, 0x20, 0x0,
-    0x0, 0x3f, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xbd,
-    0xff, 0xfa, 0x10, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xdf, 0xe2, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfc, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x50, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x30, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfa, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xef, 0xb0, 0x0, 0x3f, 0xea, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xbd, 0xff, 0xf7, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xa6, 0x0, 0x0,
-    0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x0, 0x4, 0x9c, 0xef, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff,
-    0xec, 0xcd, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xf9, 0x40, 0x0, 0x0, 0x4, 0xaf,
-    0xfd, 0x30, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xf4, 0x0, 0x0,
-    0xa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0xa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xae, 0xf5, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1, 0x0,
-    0xa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x30, 0x0, 0x3f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xf4, 0x0, 0x0,
-    0x3, 0xef, 0xe9, 0x40, 0x0, 0x0, 0x4, 0xaf,
-    0xfd, 0x30, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff,
-    0xec, 0xcd, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x9c, 0xef, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9d, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xfd, 0xcd, 0xef, 0xff, 0xb3,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0xf9, 0x40, 0x0, 0x0, 0x16,
-    0xdf, 0xf8, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xfb, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xfb, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x1, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf7,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x1f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x3f, 0xb0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x3f,
-    0xb0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x93, 0xfb, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfb, 0x3f, 0xfc, 0xcc, 0xcc, 0xdf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd3, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd3, 0xfb,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb,
-    0x3f, 0xb0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x93, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x3f, 0xb0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x1, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf7,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xfb, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0xfb, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xf9, 0x40, 0x0, 0x0,
-    0x16, 0xdf, 0xf8, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xfd,
-    0xcd, 0xef, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x9d, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x4d, 0xff, 0xfd,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xf0, 0x0, 0x7,
-    0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x1, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x8,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x8,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0x1, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x5, 0xff, 0xd7, 0x31, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x2a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x5f, 0xda, 0xab, 0xbb, 0xbb, 0xbb, 0xbf,
-    0xf0, 0x0, 0x0, 0x1, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x2, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x3, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0xd, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0,
-
-    /* U+0430 "а" */
-    0x0, 0x0, 0x59, 0xdf, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0x7, 0xef, 0xfd, 0xba, 0xbe, 0xff, 0xc1,
-    0x0, 0x1c, 0xfe, 0x71, 0x0, 0x0, 0x3, 0xcf,
-    0xd0, 0x0, 0xc8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x12,
-    0x22, 0x22, 0x22, 0xaf, 0x50, 0x0, 0x7c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x3, 0xef, 0xc8,
-    0x65, 0x55, 0x55, 0x55, 0xbf, 0x51, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x7f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x5b, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x5a,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xef,
-    0x50, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x5e, 0xa8,
-    0xf5, 0x1, 0xbf, 0xfa, 0x76, 0x79, 0xef, 0x80,
-    0x8f, 0x50, 0x0, 0x4a, 0xdf, 0xff, 0xc8, 0x20,
-    0x8, 0xf5,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x26, 0x97, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x7a, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xbf, 0xff, 0xfe, 0xb7, 0x30, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xff, 0xd9, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc6, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x4, 0xad, 0xff, 0xec,
-    0x82, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x3c, 0xff,
-    0xdb, 0xbd, 0xff, 0xfa, 0x10, 0x0, 0xf, 0xd0,
-    0x4f, 0xe7, 0x10, 0x0, 0x1, 0x6e, 0xfd, 0x20,
-    0x1, 0xfb, 0x3f, 0xb1, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfd, 0x0, 0x2f, 0xad, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x3, 0xfe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x62, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x1f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x4,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x6f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf7, 0x0, 0x0,
-    0xbf, 0xd1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0, 0x0, 0x0,
-    0x5d, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xca, 0xab, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0xce, 0xff, 0xeb, 0x71, 0x0, 0x0,
-    0x0,
-
-    /* U+0432 "в" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0xe, 0xf9, 0x99, 0x99, 0x99, 0xac, 0xff, 0xc1,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xd0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x50, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x70, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0xef, 0x22, 0x22, 0x22,
-    0x23, 0x5a, 0xfa, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x10, 0x0, 0xef, 0x55, 0x55,
-    0x55, 0x55, 0x69, 0xef, 0x70, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x3e,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0x50, 0xef, 0x99, 0x99, 0x99, 0x99, 0xbe, 0xff,
-    0x70, 0xe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8,
-    0x10, 0x0,
-
-    /* U+0433 "г" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xdb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0x8, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0xa,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x1, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x6b,
-    0xef, 0xda, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xac,
-    0xfd, 0xaa, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xca, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0xaf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xca, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0xaf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0xca, 0xbe,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x1c, 0xfc, 0x40,
-    0x0, 0x0, 0x3b, 0xfe, 0x30, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0xf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0xdf, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x1d, 0xf0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xef, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0xcf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0xaf, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0xa, 0xff, 0x82, 0x0, 0x0,
-    0x4, 0xbf, 0xe2, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xec, 0xbc, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6a, 0xdf, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+0436 "ж" */
-    0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x1,
-    0xef, 0x20, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x1, 0xee, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0xaa, 0xaa, 0xef, 0xba, 0xaa,
-    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x60, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0xcf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x5, 0xfd, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0xe, 0xf5, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0x10, 0x2, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xb0, 0xd, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf7,
-
-    /* U+0437 "з" */
-    0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb8, 0x20, 0x0,
-    0x0, 0x5d, 0xff, 0xfc, 0xbb, 0xdf, 0xff, 0xa1,
-    0x0, 0xb, 0xe8, 0x30, 0x0, 0x0, 0x5, 0xdf,
-    0xd0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xee, 0x20, 0x0, 0x0, 0x2, 0x22,
-    0x22, 0x59, 0xfd, 0x20, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x55, 0x55, 0x7b, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x58, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x8, 0xfe, 0x72, 0x0, 0x0, 0x0, 0x3b, 0xfe,
-    0x20, 0x4, 0xdf, 0xfe, 0xba, 0xab, 0xef, 0xfb,
-    0x10, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x82,
-    0x0, 0x0,
-
-    /* U+0438 "и" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfd, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfd, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xfd, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf8, 0xfd, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa1, 0xfd, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x1, 0xfd, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe1, 0x1, 0xfd, 0xef,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x20, 0x1, 0xfd,
-    0xef, 0x0, 0x0, 0x0, 0x1d, 0xf5, 0x0, 0x1,
-    0xfd, 0xef, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x1, 0xfd, 0xef, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0x1, 0xfd, 0xef, 0x0, 0x0, 0x6f, 0xc0,
-    0x0, 0x0, 0x1, 0xfd, 0xef, 0x0, 0x3, 0xfe,
-    0x10, 0x0, 0x0, 0x1, 0xfd, 0xef, 0x0, 0x2e,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xef, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xef,
-    0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0xef, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfd, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfd,
-
-    /* U+0439 "й" */
-    0x0, 0x3, 0x70, 0x0, 0x0, 0x0, 0x18, 0x20,
-    0x0, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x0, 0x5f,
-    0x20, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0,
-    0xcd, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb4, 0x11,
-    0x5d, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x33, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfd, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfd, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xfd, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf8, 0xfd, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa1, 0xfd, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x1, 0xfd, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe1, 0x1, 0xfd, 0xef,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x20, 0x1, 0xfd,
-    0xef, 0x0, 0x0, 0x0, 0x1d, 0xf5, 0x0, 0x1,
-    0xfd, 0xef, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x1, 0xfd, 0xef, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0x1, 0xfd, 0xef, 0x0, 0x0, 0x6f, 0xc0,
-    0x0, 0x0, 0x1, 0xfd, 0xef, 0x0, 0x3, 0xfe,
-    0x10, 0x0, 0x0, 0x1, 0xfd, 0xef, 0x0, 0x2e,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xef, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xef,
-    0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0xef, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfd, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfd,
-
-    /* U+043A "к" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x10, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf3, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x2e, 0xe1, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x1, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xaa, 0xaa, 0xaf, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x7, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x60, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf4, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x20,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xd1, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x90,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x5, 0xfd, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbc, 0xf9, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0xe, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0xf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x3f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x1d, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x9c, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0xaf, 0xe9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-
-    /* U+043C "м" */
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0xef, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfb, 0xef, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xfb, 0xee, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfb, 0xfb, 0xed, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0xfb, 0xed,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x71, 0xfb, 0xed, 0x2, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xed, 0x1, 0xfb, 0xed, 0x0, 0x8f,
-    0x60, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x1, 0xfb,
-    0xed, 0x0, 0xe, 0xe1, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x1, 0xfb, 0xed, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x1, 0xfb, 0xed, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x5, 0xf7, 0x0, 0x1,
-    0xfb, 0xed, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xd,
-    0xd0, 0x0, 0x1, 0xfb, 0xed, 0x0, 0x0, 0x8,
-    0xf6, 0x0, 0x8f, 0x40, 0x0, 0x1, 0xfb, 0xed,
-    0x0, 0x0, 0x0, 0xee, 0x12, 0xfa, 0x0, 0x0,
-    0x1, 0xfb, 0xed, 0x0, 0x0, 0x0, 0x5f, 0x9b,
-    0xf1, 0x0, 0x0, 0x1, 0xfb, 0xed, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x70, 0x0, 0x0, 0x1, 0xfb,
-    0xed, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0xed, 0x0, 0x0, 0x0, 0x0,
-    0x43, 0x0, 0x0, 0x0, 0x1, 0xfb, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb,
-
-    /* U+043D "н" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf5, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0xef, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xad, 0xf5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf5, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x1, 0x6b, 0xef, 0xfe, 0xb6, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xdb, 0xbd,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x71,
-    0x0, 0x0, 0x17, 0xef, 0xb0, 0x0, 0x0, 0xaf,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x0,
-    0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x60, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf6, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xcf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd,
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x5, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0xaf, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xfb, 0x0, 0x0, 0xa, 0xff, 0x71, 0x0, 0x0,
-    0x17, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xdb, 0xbd, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x6b, 0xef, 0xfe, 0xb6, 0x10, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xef, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbd, 0xf7, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf7, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf7, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7,
-
-    /* U+0440 "р" */
-    0xdf, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0xdf, 0x0, 0x3d, 0xff, 0xdb, 0xbd,
-    0xff, 0xf7, 0x0, 0x0, 0xdf, 0x5, 0xfe, 0x71,
-    0x0, 0x0, 0x17, 0xef, 0xb0, 0x0, 0xdf, 0x3f,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x0,
-    0xdf, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x70, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0xdf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xdf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0xdf, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0xdf, 0x4f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xfb, 0x0, 0xdf, 0x5, 0xfe, 0x71, 0x0, 0x0,
-    0x17, 0xff, 0xb0, 0x0, 0xdf, 0x0, 0x3d, 0xff,
-    0xdb, 0xbd, 0xff, 0xf7, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x5a, 0xef, 0xfe, 0xb7, 0x10, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xdb, 0xbd, 0xff,
-    0xf8, 0x0, 0x0, 0xa, 0xff, 0x71, 0x0, 0x0,
-    0x16, 0xef, 0xb0, 0x0, 0xaf, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xf6, 0x6, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x60, 0xe, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x60,
-    0x0, 0xaf, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xf6, 0x0, 0xa, 0xff, 0x71, 0x0, 0x0, 0x16,
-    0xef, 0xa0, 0x0, 0x0, 0x6e, 0xff, 0xdb, 0xbd,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xef,
-    0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0xbb, 0xbb, 0xbb, 0xbc, 0xfe, 0xbb,
-    0xbb, 0xbb, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xb0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0x0, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd2, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0x30, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfd, 0xbb, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9d,
-    0xff, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x84, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x26, 0xad, 0xef, 0xff, 0xed, 0xa7, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xfe, 0xcd,
-    0xfd, 0xce, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xc6, 0x10, 0x5, 0xf8, 0x0, 0x15,
-    0xbf, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xe4, 0x0,
-    0x0, 0x5, 0xf8, 0x0, 0x0, 0x3, 0xcf, 0xc0,
-    0x0, 0x7, 0xfd, 0x10, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x20, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xd0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x6f, 0x90,
-    0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x80, 0x1f, 0xf2, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xef, 0x20,
-    0x7, 0xfd, 0x10, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0xaf, 0xe4,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x3, 0xdf,
-    0xb0, 0x0, 0x0, 0x8, 0xff, 0xc6, 0x10, 0x5,
-    0xf8, 0x0, 0x15, 0xbf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x3b, 0xff, 0xfe, 0xcd, 0xfd, 0xce, 0xff,
-    0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xad, 0xef, 0xff, 0xed, 0xa7, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfd, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x20, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x2f, 0xe1,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x2f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x29,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfe, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x7e, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x3f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf2, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x20, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x2, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-
-    /* U+0446 "ц" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0xef, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xfb, 0xaa, 0x3e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x50,
-
-    /* U+0447 "ч" */
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf5, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0xf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x1, 0xdf, 0xb2, 0x0, 0x0, 0x0,
-    0x27, 0xcf, 0xf5, 0x0, 0x1c, 0xff, 0xda, 0x9a,
-    0xbe, 0xff, 0xcc, 0xf5, 0x0, 0x0, 0x4a, 0xdf,
-    0xff, 0xda, 0x61, 0x8, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf5,
-
-    /* U+0448 "ш" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xce, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xce, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xce, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xce, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xce, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xce, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xce,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xce, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xce, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0xef, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xdf, 0xda, 0xaa, 0xaa, 0xaa, 0xaa, 0xbf,
-    0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0449 "щ" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0xef, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xdf, 0xda, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xbf, 0xea, 0xa9, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbb, 0xbb, 0xbb, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xea, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x55, 0x55, 0x55, 0x7b, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0x80, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x30, 0x0, 0x0, 0x0, 0x5, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x88, 0x88, 0x88, 0xae,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xfe, 0xb6, 0x10, 0x0,
-
-    /* U+044B "ы" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0xef, 0x22, 0x22, 0x22, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xe9, 0x30, 0x0, 0x0, 0xd, 0xf0,
-    0xef, 0x55, 0x55, 0x55, 0x57, 0xbf, 0xf8, 0x0,
-    0x0, 0xd, 0xf0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0x70, 0x0, 0xd, 0xf0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0xd,
-    0xf0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0x0, 0xd, 0xf0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0x0, 0xd, 0xf0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0,
-    0xd, 0xf0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x0, 0xd, 0xf0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0xd, 0xf0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0xd, 0xf0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0xd, 0xf0, 0xef, 0x88,
-    0x88, 0x88, 0x9b, 0xff, 0xe3, 0x0, 0x0, 0xd,
-    0xf0, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0,
-    0x0, 0x0, 0xd, 0xf0,
-
-    /* U+044C "ь" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xea, 0x30, 0x0,
-    0xef, 0x55, 0x55, 0x55, 0x57, 0xbf, 0xf9, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0x80,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x40,
-    0xef, 0x88, 0x88, 0x88, 0x8b, 0xef, 0xe4, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x2, 0x8b, 0xef, 0xfe, 0xc8, 0x20, 0x0,
-    0x0, 0x0, 0x2b, 0xff, 0xeb, 0x99, 0xbe, 0xff,
-    0xa1, 0x0, 0x0, 0x4f, 0xf9, 0x20, 0x0, 0x0,
-    0x3, 0xaf, 0xe4, 0x0, 0x1, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x7f, 0x70, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0,
-    0x2c, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x30, 0x4, 0xff, 0x93, 0x0, 0x0, 0x0, 0x3b,
-    0xfe, 0x40, 0x0, 0x2, 0xaf, 0xfe, 0xba, 0xab,
-    0xef, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x27, 0xbe,
-    0xff, 0xec, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce,
-    0xff, 0xda, 0x40, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xcb, 0xbe, 0xff,
-    0xd3, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xd5, 0x0, 0x0, 0x2, 0xaf, 0xf5, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0xe, 0xf0, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x70, 0xef, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0xe, 0xf0,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0xef, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x5e, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0xef,
-    0xcc, 0xcc, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x6e, 0xf0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0xef, 0x0, 0x0, 0xb, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x2e,
-    0xf0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0xef, 0x0, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0xe, 0xf0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x30, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x1c, 0xfd, 0x50, 0x0, 0x0, 0x2a,
-    0xff, 0x50, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfc, 0xab, 0xdf, 0xfc, 0x30, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c,
-    0xef, 0xfd, 0xa4, 0x0, 0x0, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x0, 0x49, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x2, 0xcf, 0xfe, 0xcb, 0xbb, 0xbb, 0xbb,
-    0xfb, 0x2, 0xef, 0xa2, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xb0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xb6, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfb, 0x7f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xb7, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x4f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xb0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x7, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x9, 0xfe,
-    0x94, 0x22, 0x22, 0x22, 0x22, 0xfb, 0x0, 0x4,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xcf, 0x65, 0x55, 0x55, 0x55, 0xfb, 0x0,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xfb,
-    0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfb, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xb4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfb,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x0, 0x78, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0xca, 0xbe,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x1c, 0xfc, 0x40,
-    0x0, 0x0, 0x3b, 0xfe, 0x30, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0xf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0xdf, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x1d, 0xf0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xef, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0xcf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0xaf, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf8, 0x0, 0x0, 0xa, 0xff, 0x82, 0x0, 0x0,
-    0x4, 0xbf, 0xe2, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xec, 0xbc, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6a, 0xdf, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x3, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x7,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xb2,
-    0x0, 0x1, 0xa8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x8c, 0xef, 0xfd, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0xca, 0xbe, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x1c, 0xfc, 0x40, 0x0, 0x0,
-    0x3b, 0xfe, 0x30, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0xf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0xaf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0xdf, 0x21,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1d, 0xf0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xef, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x40, 0xcf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0xaf,
-    0xc2, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0xa, 0xff, 0x82, 0x0, 0x0, 0x4, 0xbf,
-    0xe2, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xec, 0xbc,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6a,
-    0xdf, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x22, 0x22, 0xef, 0x22, 0x22,
-    0x22, 0x22, 0x21, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x55, 0x55, 0xef, 0x55, 0x55, 0x55,
-    0x55, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x1, 0x7c, 0xef, 0xfd,
-    0xa5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x8,
-    0xff, 0xec, 0xbc, 0xef, 0xfc, 0x20, 0x0, 0x0,
-    0x0, 0xef, 0xa, 0xfb, 0x30, 0x0, 0x0, 0x3c,
-    0xfe, 0x10, 0x0, 0x0, 0xe, 0xf8, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x3e, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0xba,
-    0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xbe, 0xfe, 0xb4, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x78, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xda, 0x61,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xfd, 0xba, 0xac,
-    0xff, 0xf8, 0x0, 0x0, 0x9, 0xff, 0x81, 0x0,
-    0x0, 0x0, 0x4b, 0xfd, 0x0, 0x9, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x60, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xfe,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xab, 0x0, 0x0, 0x9f, 0xf7, 0x10, 0x0, 0x0,
-    0x6, 0xef, 0xa0, 0x0, 0x0, 0x5e, 0xff, 0xca,
-    0x9a, 0xcf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfd, 0xa5, 0x0, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xcb, 0xac, 0xef, 0xfe,
-    0x60, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x0, 0x27,
-    0xeb, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x10, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x62,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0xfe, 0xb8, 0x51, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x69, 0xcf, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x7b, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x7, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0xcf, 0xe8, 0x20, 0x0, 0x0, 0x3, 0xbf,
-    0xc0, 0x0, 0x8f, 0xff, 0xec, 0xba, 0xce, 0xff,
-    0xa0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe, 0xc8,
-    0x30, 0x0,
-
-    /* U+0456 "і" */
-    0x2d, 0xe3, 0x7f, 0xf9, 0x2e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0,
-    0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0,
-    0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0,
-    0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0,
-    0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0,
-
-    /* U+0457 "ї" */
-    0x5f, 0x90, 0x9, 0xf5, 0xaf, 0xe0, 0xf, 0xf9,
-    0x2a, 0x50, 0x5, 0xa2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0xf, 0xe0, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xf4, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x1d, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x71, 0x0,
-    0x2, 0xdf, 0x50, 0x3f, 0xfb, 0xac, 0xff, 0xa0,
-    0x0, 0x4b, 0xef, 0xfc, 0x50, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x22, 0x22, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfd, 0x55, 0x55, 0x55, 0x68, 0xdf, 0xf5,
-    0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x30, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xb0, 0x0, 0x0, 0xf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x1f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x3f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0,
-    0x0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x1d, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4d,
-    0xfd, 0x10, 0x9c, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xcc, 0xcc, 0xcc, 0xdf,
-    0xff, 0xc1, 0x0, 0xaf, 0xe9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x94, 0x0, 0x0,
-
-    /* U+045A "њ" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaf, 0xfa, 0xaa, 0xaa, 0xaa,
-    0x97, 0x30, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd3, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x15,
-    0xbf, 0xf4, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xd0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x3e, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf5, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x5e, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0x40, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf7,
-    0x77, 0x77, 0x78, 0x9d, 0xfe, 0x50, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x3, 0x33, 0x33, 0xef, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x1, 0x7c, 0xef,
-    0xfd, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x8f, 0xfe, 0xcb, 0xce, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xa, 0xfb, 0x30, 0x0,
-    0x0, 0x3c, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xef,
-    0x8f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x0, 0x0, 0xef, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0xef,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x78, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x10, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf3, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x2e, 0xe1, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x1, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xaa, 0xaa, 0xaf, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x7, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x60, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf4, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x20,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xd1, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x90,
-
-    /* U+045D "ѝ" */
-    0x0, 0x5, 0x87, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfd, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfd, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xfd, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf8, 0xfd, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa1, 0xfd, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x1, 0xfd, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe1, 0x1, 0xfd, 0xef,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x20, 0x1, 0xfd,
-    0xef, 0x0, 0x0, 0x0, 0x1d, 0xf5, 0x0, 0x1,
-    0xfd, 0xef, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x1, 0xfd, 0xef, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0x1, 0xfd, 0xef, 0x0, 0x0, 0x6f, 0xc0,
-    0x0, 0x0, 0x1, 0xfd, 0xef, 0x0, 0x3, 0xfe,
-    0x10, 0x0, 0x0, 0x1, 0xfd, 0xef, 0x0, 0x2e,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xef, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xef,
-    0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0xef, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfd, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfd,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x8, 0xe0, 0x0, 0x0, 0x0, 0x5f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x93, 0x11, 0x5c, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x33, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xb0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf7, 0x0, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd2, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0x30, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfd, 0xbb, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9d,
-    0xff, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+045F "џ" */
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0xef, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xff, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf3, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xec,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8e, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x40,
-
-    /* U+2014 "—" */
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44,
-
-    /* U+2018 "‘" */
-    0x1, 0xf3, 0x6, 0xf0, 0xb, 0xc0, 0xf, 0x80,
-    0x5f, 0x40, 0x9f, 0xc1, 0xcf, 0xf5, 0x7f, 0xe1,
-    0x2, 0x0,
-
-    /* U+2019 "’" */
-    0x5f, 0xd1, 0xcf, 0xf5, 0x7f, 0xf4, 0xa, 0xf0,
-    0xd, 0xb0, 0x1f, 0x70, 0x4f, 0x30, 0x8e, 0x0,
-    0x87, 0x0,
-
-    /* U+201A "‚" */
-    0x2, 0x10, 0x7f, 0xf2, 0xcf, 0xf5, 0x5f, 0xf3,
-    0xa, 0xf0, 0xe, 0xb0, 0x1f, 0x60, 0x5f, 0x20,
-    0x9d, 0x0, 0x55, 0x0,
-
-    /* U+201C "“" */
-    0x1, 0xf3, 0x0, 0x4, 0xf1, 0x6, 0xf0, 0x0,
-    0x9, 0xd0, 0xb, 0xc0, 0x0, 0xe, 0x90, 0xf,
-    0x80, 0x0, 0x3f, 0x50, 0x5f, 0x40, 0x0, 0x8f,
-    0x10, 0x9f, 0xc1, 0x0, 0xcf, 0xa0, 0xcf, 0xf5,
-    0x0, 0xff, 0xf2, 0x7f, 0xe1, 0x0, 0xaf, 0xd0,
-    0x2, 0x0, 0x0, 0x2, 0x0,
-
-    /* U+201D "”" */
-    0x5f, 0xd1, 0x0, 0x7f, 0xb0, 0xcf, 0xf5, 0x0,
-    0xff, 0xf2, 0x7f, 0xf4, 0x0, 0xaf, 0xf1, 0xa,
-    0xf0, 0x0, 0xd, 0xd0, 0xd, 0xb0, 0x0, 0xf,
-    0x90, 0x1f, 0x70, 0x0, 0x4f, 0x40, 0x4f, 0x30,
-    0x0, 0x7f, 0x0, 0x8e, 0x0, 0x0, 0xbb, 0x0,
-    0x87, 0x0, 0x0, 0xa5, 0x0,
-
-    /* U+2026 "…" */
-    0x2, 0x10, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x3, 0x8, 0xff, 0x20, 0x0, 0xb, 0xfd, 0x0,
-    0x0, 0xe, 0xfa, 0xcf, 0xf5, 0x0, 0x0, 0xff,
-    0xf2, 0x0, 0x3, 0xff, 0xf5, 0xfc, 0x10, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0xa, 0xf7,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x0, 0x3, 0x8b, 0xef, 0xff, 0xdb,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xff, 0xfd, 0xcb, 0xce, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf9, 0x40, 0x0, 0x0,
-    0x1, 0x6e, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x20, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x33, 0x4f, 0xf9,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x30, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0xf3, 0x0, 0x0, 0x0, 0x2e, 0xfd,
-    0x51, 0x0, 0x0, 0x0, 0x27, 0xdf, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xfd, 0xcb, 0xbd,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x7b, 0xdf, 0xff, 0xec, 0x94, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x19, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0x70, 0x0, 0x0, 0x0, 0x59,
-    0xbb, 0x95, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x3d, 0xfb, 0x88, 0xbf, 0xd3, 0x0,
-    0x2f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x3, 0xfb, 0x10,
-    0x0, 0x2, 0xcf, 0x20, 0x2f, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0xd, 0xc0,
-    0x2f, 0xcb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x2f, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0xf2, 0x2f, 0xc1, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x5f, 0x10, 0x0, 0x0, 0x0, 0x1, 0xf5,
-    0x2f, 0xc0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x6f, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf6, 0x2f, 0xc0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x4f, 0x30, 0x0, 0x0, 0x0, 0x3, 0xf4,
-    0x2f, 0xc0, 0x0, 0x8f, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0xf, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x2f, 0xc0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x2f, 0xc0, 0x0, 0x1, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0xaf, 0x93,
-    0x0, 0x3a, 0xf9, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x6, 0xdf, 0xff, 0xfd, 0x50, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0x33, 0x10, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x70, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x2, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x10, 0x0, 0x3f, 0xb0,
-    0x0, 0x1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xc0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x60, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfe, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 156, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 153, .box_w = 4, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 54, .adv_w = 217, .box_w = 9, .box_h = 10, .ofs_x = 2, .ofs_y = 17},
-    {.bitmap_index = 99, .adv_w = 420, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 423, .adv_w = 370, .box_w = 21, .box_h = 37, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 812, .adv_w = 497, .box_w = 29, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1204, .adv_w = 398, .box_w = 24, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1540, .adv_w = 118, .box_w = 3, .box_h = 10, .ofs_x = 2, .ofs_y = 17},
-    {.bitmap_index = 1555, .adv_w = 195, .box_w = 7, .box_h = 35, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 1678, .adv_w = 196, .box_w = 7, .box_h = 35, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 1801, .adv_w = 228, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 14},
-    {.bitmap_index = 1899, .adv_w = 346, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 2035, .adv_w = 122, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 2055, .adv_w = 232, .box_w = 11, .box_h = 2, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 2066, .adv_w = 122, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2074, .adv_w = 195, .box_w = 15, .box_h = 36, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 2344, .adv_w = 400, .box_w = 21, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2628, .adv_w = 215, .box_w = 9, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2750, .adv_w = 342, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3020, .adv_w = 339, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3290, .adv_w = 398, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3614, .adv_w = 339, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3884, .adv_w = 366, .box_w = 20, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4154, .adv_w = 353, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4424, .adv_w = 384, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4721, .adv_w = 366, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4991, .adv_w = 122, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5031, .adv_w = 122, .box_w = 4, .box_h = 26, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 5083, .adv_w = 346, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 5219, .adv_w = 346, .box_w = 17, .box_h = 10, .ofs_x = 2, .ofs_y = 8},
-    {.bitmap_index = 5304, .adv_w = 346, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 5440, .adv_w = 342, .box_w = 19, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5697, .adv_w = 628, .box_w = 36, .box_h = 34, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 6309, .adv_w = 429, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6674, .adv_w = 457, .box_w = 23, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 6985, .adv_w = 429, .box_w = 24, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7309, .adv_w = 502, .box_w = 26, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7660, .adv_w = 407, .box_w = 19, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7917, .adv_w = 384, .box_w = 19, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8174, .adv_w = 470, .box_w = 24, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8498, .adv_w = 495, .box_w = 23, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8809, .adv_w = 179, .box_w = 3, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8850, .adv_w = 299, .box_w = 16, .box_h = 27, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 9066, .adv_w = 427, .box_w = 23, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 9377, .adv_w = 356, .box_w = 18, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 9620, .adv_w = 581, .box_w = 28, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 9998, .adv_w = 495, .box_w = 23, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 10309, .adv_w = 510, .box_w = 28, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10687, .adv_w = 435, .box_w = 21, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 10971, .adv_w = 510, .box_w = 29, .box_h = 32, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11435, .adv_w = 438, .box_w = 22, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 11732, .adv_w = 370, .box_w = 21, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12016, .adv_w = 342, .box_w = 22, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12313, .adv_w = 482, .box_w = 22, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 12610, .adv_w = 418, .box_w = 26, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12961, .adv_w = 668, .box_w = 40, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13501, .adv_w = 390, .box_w = 24, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13825, .adv_w = 380, .box_w = 24, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14149, .adv_w = 393, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14460, .adv_w = 186, .box_w = 7, .box_h = 35, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 14583, .adv_w = 195, .box_w = 16, .box_h = 36, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 14871, .adv_w = 186, .box_w = 7, .box_h = 35, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 14994, .adv_w = 347, .box_w = 16, .box_h = 16, .ofs_x = 3, .ofs_y = 5},
-    {.bitmap_index = 15122, .adv_w = 304, .box_w = 19, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 15151, .adv_w = 365, .box_w = 9, .box_h = 5, .ofs_x = 5, .ofs_y = 23},
-    {.bitmap_index = 15174, .adv_w = 354, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15344, .adv_w = 410, .box_w = 20, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 15624, .adv_w = 337, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15814, .adv_w = 410, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16108, .adv_w = 363, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16308, .adv_w = 199, .box_w = 14, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16504, .adv_w = 415, .box_w = 21, .box_h = 27, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 16788, .adv_w = 409, .box_w = 18, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17040, .adv_w = 159, .box_w = 4, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17096, .adv_w = 162, .box_w = 11, .box_h = 35, .ofs_x = -4, .ofs_y = -7},
-    {.bitmap_index = 17289, .adv_w = 354, .box_w = 18, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17541, .adv_w = 159, .box_w = 2, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17569, .adv_w = 647, .box_w = 33, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17899, .adv_w = 409, .box_w = 18, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18079, .adv_w = 377, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18289, .adv_w = 410, .box_w = 20, .box_h = 27, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 18559, .adv_w = 410, .box_w = 21, .box_h = 27, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 18843, .adv_w = 240, .box_w = 10, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18943, .adv_w = 291, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19103, .adv_w = 242, .box_w = 14, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19278, .adv_w = 407, .box_w = 19, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 19468, .adv_w = 321, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19668, .adv_w = 524, .box_w = 33, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19998, .adv_w = 316, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20188, .adv_w = 321, .box_w = 22, .box_h = 27, .ofs_x = -2, .ofs_y = -7},
-    {.bitmap_index = 20485, .adv_w = 306, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20655, .adv_w = 195, .box_w = 10, .box_h = 35, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 20830, .adv_w = 177, .box_w = 3, .box_h = 35, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 20883, .adv_w = 195, .box_w = 10, .box_h = 35, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 21058, .adv_w = 346, .box_w = 18, .box_h = 6, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 21112, .adv_w = 277, .box_w = 14, .box_h = 15, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 21217, .adv_w = 277, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 21330, .adv_w = 397, .box_w = 20, .box_h = 34, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 21670, .adv_w = 397, .box_w = 20, .box_h = 33, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22000, .adv_w = 498, .box_w = 30, .box_h = 28, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 22420, .adv_w = 345, .box_w = 18, .box_h = 34, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22726, .adv_w = 429, .box_w = 24, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23050, .adv_w = 377, .box_w = 20, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23320, .adv_w = 184, .box_w = 3, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 23361, .adv_w = 179, .box_w = 11, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23543, .adv_w = 314, .box_w = 16, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23759, .adv_w = 721, .box_w = 44, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24353, .adv_w = 722, .box_w = 40, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 24893, .adv_w = 502, .box_w = 30, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25298, .adv_w = 423, .box_w = 22, .box_h = 34, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 25672, .adv_w = 502, .box_w = 23, .box_h = 34, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 26063, .adv_w = 408, .box_w = 25, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26488, .adv_w = 489, .box_w = 22, .box_h = 34, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 26862, .adv_w = 446, .box_w = 28, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27240, .adv_w = 440, .box_w = 22, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 27537, .adv_w = 456, .box_w = 22, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 27834, .adv_w = 345, .box_w = 18, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 28077, .adv_w = 478, .box_w = 29, .box_h = 33, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 28556, .adv_w = 397, .box_w = 20, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 28826, .adv_w = 606, .box_w = 36, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 29312, .adv_w = 372, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29596, .adv_w = 502, .box_w = 23, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 29907, .adv_w = 502, .box_w = 23, .box_h = 34, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 30298, .adv_w = 423, .box_w = 22, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 30595, .adv_w = 475, .box_w = 25, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 30933, .adv_w = 586, .box_w = 28, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 31311, .adv_w = 500, .box_w = 23, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 31622, .adv_w = 519, .box_w = 29, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 32014, .adv_w = 503, .box_w = 23, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 32325, .adv_w = 429, .box_w = 22, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 32622, .adv_w = 434, .box_w = 24, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 32946, .adv_w = 350, .box_w = 22, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 33243, .adv_w = 408, .box_w = 25, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 33581, .adv_w = 553, .box_w = 31, .box_h = 29, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 34031, .adv_w = 386, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34342, .adv_w = 501, .box_w = 27, .box_h = 34, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 34801, .adv_w = 434, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35098, .adv_w = 665, .box_w = 33, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 35544, .adv_w = 677, .box_w = 37, .box_h = 33, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 36155, .adv_w = 495, .box_w = 30, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36560, .adv_w = 587, .box_w = 28, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 36938, .adv_w = 430, .box_w = 22, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 37235, .adv_w = 429, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37559, .adv_w = 661, .box_w = 35, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 38032, .adv_w = 445, .box_w = 22, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 38329, .adv_w = 351, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 38499, .adv_w = 399, .box_w = 21, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 38804, .adv_w = 366, .box_w = 17, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 38974, .adv_w = 282, .box_w = 14, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 39114, .adv_w = 389, .box_w = 23, .box_h = 25, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 39402, .adv_w = 370, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 39602, .adv_w = 491, .box_w = 30, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 39902, .adv_w = 320, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40072, .adv_w = 415, .box_w = 18, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 40252, .adv_w = 415, .box_w = 18, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 40504, .adv_w = 345, .box_w = 18, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 40684, .adv_w = 379, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 40884, .adv_w = 477, .box_w = 22, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 41104, .adv_w = 407, .box_w = 18, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 41284, .adv_w = 384, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 41484, .adv_w = 409, .box_w = 18, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 41664, .adv_w = 416, .box_w = 20, .box_h = 27, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 41934, .adv_w = 339, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 42114, .adv_w = 277, .box_w = 19, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 42304, .adv_w = 332, .box_w = 22, .box_h = 27, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 42601, .adv_w = 467, .box_w = 26, .box_h = 36, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 43069, .adv_w = 312, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 43259, .adv_w = 413, .box_w = 21, .box_h = 25, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 43522, .adv_w = 359, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 43702, .adv_w = 558, .box_w = 27, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 43972, .adv_w = 558, .box_w = 30, .box_h = 25, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 44347, .adv_w = 368, .box_w = 23, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 44577, .adv_w = 466, .box_w = 22, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 44797, .adv_w = 336, .box_w = 16, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 44957, .adv_w = 345, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 45147, .adv_w = 520, .box_w = 27, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 45417, .adv_w = 365, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 45587, .adv_w = 377, .box_w = 20, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 45867, .adv_w = 370, .box_w = 20, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 46137, .adv_w = 406, .box_w = 23, .box_h = 36, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 46551, .adv_w = 282, .box_w = 14, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 46747, .adv_w = 345, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 46937, .adv_w = 316, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 47107, .adv_w = 161, .box_w = 4, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 47163, .adv_w = 159, .box_w = 8, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 47271, .adv_w = 162, .box_w = 11, .box_h = 36, .ofs_x = -4, .ofs_y = -7},
-    {.bitmap_index = 47469, .adv_w = 554, .box_w = 34, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 47809, .adv_w = 570, .box_w = 31, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48119, .adv_w = 406, .box_w = 24, .box_h = 28, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 48455, .adv_w = 345, .box_w = 18, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48707, .adv_w = 415, .box_w = 18, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48959, .adv_w = 332, .box_w = 22, .box_h = 35, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 49344, .adv_w = 385, .box_w = 17, .box_h = 25, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 49557, .adv_w = 347, .box_w = 18, .box_h = 32, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 49845, .adv_w = 264, .box_w = 13, .box_h = 24, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 50001, .adv_w = 304, .box_w = 19, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 50030, .adv_w = 608, .box_w = 38, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 50087, .adv_w = 122, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = 19},
-    {.bitmap_index = 50105, .adv_w = 122, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = 19},
-    {.bitmap_index = 50123, .adv_w = 122, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 50143, .adv_w = 215, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 19},
-    {.bitmap_index = 50188, .adv_w = 215, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 19},
-    {.bitmap_index = 50233, .adv_w = 370, .box_w = 19, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 50271, .adv_w = 502, .box_w = 25, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 50609, .adv_w = 727, .box_w = 40, .box_h = 27, .ofs_x = 4, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_38;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_38 = {
-#else
-lv_font_t montserrat_cyrillic_38 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 41,          /*The maximum line height required by the font*/
-    .base_line = 7,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -4,
-    .underline_thickness = 2,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_38,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_38*/
@@ -1,7813 +0,0 @@
-/*******************************************************************************
- * Size: 40 px
- * Bpp: 4
- * Opts: --bpp 4 --size 40 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_40.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_40
-#define MONTSERRAT_CYRILLIC_40 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_40
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x1f, 0xf3, 0x1f, 0xf2, 0x1f, 0xf2, 0xf, 0xf2,
-    0xf, 0xf1, 0xf, 0xf1, 0xf, 0xf1, 0xf, 0xf0,
-    0xf, 0xf0, 0xe, 0xf0, 0xe, 0xf0, 0xe, 0xf0,
-    0xd, 0xf0, 0xd, 0xe0, 0xd, 0xe0, 0xc, 0xe0,
-    0xc, 0xd0, 0xc, 0xd0, 0xb, 0xd0, 0x9, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x20, 0x4f, 0xf6, 0x8f, 0xfa, 0x2d, 0xe3,
-
-    /* U+0022 "\"" */
-    0xf, 0xc0, 0x0, 0x8, 0xf4, 0xf, 0xc0, 0x0,
-    0x8, 0xf4, 0xf, 0xc0, 0x0, 0x8, 0xf3, 0xf,
-    0xb0, 0x0, 0x8, 0xf3, 0xf, 0xb0, 0x0, 0x7,
-    0xf3, 0xf, 0xb0, 0x0, 0x7, 0xf3, 0xf, 0xb0,
-    0x0, 0x7, 0xf2, 0xe, 0xa0, 0x0, 0x7, 0xf2,
-    0xe, 0xa0, 0x0, 0x6, 0xf2, 0xe, 0xa0, 0x0,
-    0x6, 0xf2, 0x4, 0x30, 0x0, 0x1, 0x40,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0,
-    0x0, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x4, 0x99, 0x99,
-    0x9e, 0xf9, 0x99, 0x99, 0x99, 0x9b, 0xfb, 0x99,
-    0x99, 0x93, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x0,
-    0x0, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x7,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x0,
-    0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x30,
-    0x0, 0x0, 0x0, 0xf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x0,
-    0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0x0,
-    0x0, 0x0, 0x69, 0x99, 0x99, 0xef, 0x99, 0x99,
-    0x99, 0x99, 0xbf, 0xb9, 0x99, 0x99, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xbd, 0xff, 0xfe, 0xb8, 0x40, 0x0, 0x0, 0x0,
-    0x1, 0xaf, 0xff, 0xfe, 0xfd, 0xef, 0xff, 0xe7,
-    0x0, 0x0, 0x3, 0xef, 0xe7, 0x20, 0x7f, 0x0,
-    0x15, 0xaf, 0xfd, 0x0, 0x1, 0xef, 0xa0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x19, 0xb0, 0x0, 0x9f,
-    0xb0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf5, 0x0, 0x0, 0x7,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe3,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf8, 0x10, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb6, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
-    0xef, 0xff, 0xfa, 0x62, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x37, 0xdf, 0xff, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf4,
-    0x8c, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x2, 0x9f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x4f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0xb,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x8c, 0x10,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x9, 0xfa,
-    0xa, 0xfe, 0x70, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x8, 0xff, 0x20, 0x7, 0xff, 0xe9, 0x40, 0x7,
-    0xf0, 0x2, 0x6d, 0xff, 0x40, 0x0, 0x2, 0x9f,
-    0xff, 0xfe, 0xef, 0xdf, 0xff, 0xfb, 0x20, 0x0,
-    0x0, 0x0, 0x5, 0x9c, 0xef, 0xff, 0xeb, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x7c, 0xff, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0,
-    0x1d, 0xe7, 0x33, 0x7e, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0x0, 0xcd,
-    0x10, 0x0, 0x1, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x10, 0x0, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0,
-    0x0, 0xd, 0xb0, 0x0, 0x0, 0x0, 0x1e, 0xb0,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x0, 0x0, 0x0, 0xbe, 0x10, 0x0,
-    0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x0, 0x6,
-    0xf1, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf2,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x50, 0x0, 0x0, 0x0, 0x6, 0xf1, 0x0,
-    0x0, 0xce, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x70, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x7,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x2f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0x60, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0, 0x0,
-    0x0, 0xdd, 0x0, 0x7, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd5, 0x11, 0x5d,
-    0xf3, 0x0, 0x3f, 0x80, 0x0, 0x2a, 0xff, 0xfc,
-    0x60, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xfb, 0x20,
-    0x0, 0xdd, 0x0, 0x4, 0xfd, 0x74, 0x5a, 0xfa,
-    0x0, 0x0, 0x0, 0x1, 0x33, 0x10, 0x0, 0x8,
-    0xf3, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x5f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0xbe, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x4, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x7, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xec, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xad, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x4, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xda, 0x0, 0x0, 0x0, 0x1, 0xeb, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x0, 0xb, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xae, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
-    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xec, 0x63, 0x49, 0xf9, 0x0, 0x0, 0x0, 0xb,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xdf, 0xfb, 0x40, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xc9, 0x8a, 0xef, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe3, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
-    0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x0, 0x2, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x10, 0x7f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xdd, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xb2, 0xb, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf7, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0xde, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0x80, 0x0, 0x1, 0xfb, 0x0,
-    0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf8,
-    0x0, 0x6, 0xf6, 0x0, 0xbf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x70, 0xb, 0xf1, 0x0,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf6, 0x3f, 0xa0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xef, 0x30, 0x0,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfb, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x40, 0x0,
-    0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x6f, 0xf4, 0x0, 0x2, 0xdf, 0xd5, 0x0,
-    0x0, 0x0, 0x17, 0xef, 0xc2, 0x4, 0xff, 0x30,
-    0x0, 0x19, 0xff, 0xfd, 0xbb, 0xbe, 0xff, 0xe7,
-    0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x27, 0xbe,
-    0xff, 0xfd, 0xa5, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x30,
-
-    /* U+0027 "'" */
-    0xf, 0xc0, 0xfc, 0xf, 0xc0, 0xfb, 0xf, 0xb0,
-    0xfb, 0xf, 0xb0, 0xea, 0xe, 0xa0, 0xea, 0x4,
-    0x30,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x4f, 0xa0, 0x0, 0xd, 0xf2, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x2f,
-    0xc0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0x2f, 0xc0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0xd, 0xf1, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x8f,
-    0x70, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x6, 0xf8, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x9f,
-    0x40, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0xdf, 0x10, 0x0, 0x8, 0xf6, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0xbf, 0x20, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x3f, 0xa0,
-
-    /* U+0029 ")" */
-    0xc, 0xf2, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x3, 0xfa, 0x0, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0xcf, 0x20, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0xaa,
-    0x10, 0x3, 0xf2, 0x0, 0x1a, 0xa0, 0x7, 0xef,
-    0x70, 0x3f, 0x20, 0x8f, 0xe7, 0x0, 0x1, 0x9f,
-    0xe8, 0xf7, 0xef, 0x91, 0x0, 0x0, 0x0, 0x2a,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x1, 0x9f,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x9f,
-    0x8e, 0xf7, 0x0, 0x0, 0x5e, 0xf9, 0x13, 0xf2,
-    0x19, 0xfe, 0x50, 0xb, 0xb2, 0x0, 0x3f, 0x20,
-    0x2, 0xbb, 0x0, 0x0, 0x0, 0x3, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x1b,
-    0xbb, 0xbb, 0xbb, 0xdf, 0xcb, 0xbb, 0xbb, 0xba,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+002C "," */
-    0x4, 0x40, 0x7f, 0xf7, 0xaf, 0xfa, 0x3e, 0xf7,
-    0x8, 0xf3, 0xc, 0xe0, 0xf, 0xa0, 0x3f, 0x50,
-    0x7f, 0x10, 0x56, 0x0,
-
-    /* U+002D "-" */
-    0x6c, 0xcc, 0xcc, 0xcc, 0xcc, 0x98, 0xff, 0xff,
-    0xff, 0xff, 0xfc,
-
-    /* U+002E "." */
-    0x4, 0x40, 0x7f, 0xf7, 0xaf, 0xfa, 0x3e, 0xe3,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xfe, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfb, 0x40, 0x0, 0x3, 0x8f, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xfc, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0,
-    0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x10, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x1c, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x1b, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x8, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0xc, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0xdf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x8, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xc0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xb4, 0x0, 0x0, 0x38, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xee, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xb7, 0x10, 0x0,
-    0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xaf, 0xff, 0xff, 0xff, 0xf3, 0x8d, 0xdd, 0xdd,
-    0xdf, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0xc, 0xf3,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x3, 0x8b, 0xef, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff, 0xee,
-    0xef, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0xfc,
-    0x62, 0x0, 0x0, 0x4, 0xaf, 0xfa, 0x0, 0x0,
-    0xcf, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf7, 0x0, 0x6, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xb0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0033 "3" */
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x5d, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xde, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xdb, 0x72, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xbb, 0xce, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x7e, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x1, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x60, 0x3f, 0xfb, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xc0, 0x0, 0x3d,
-    0xff, 0xb6, 0x20, 0x0, 0x0, 0x49, 0xff, 0xd1,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xfe, 0xee, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x48, 0xce,
-    0xff, 0xfe, 0xb7, 0x10, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0,
-    0x0, 0x2, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x4f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0,
-    0x0, 0x2f, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xdf, 0xfc, 0xcc, 0xcc, 0x74, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0xc, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0x30, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xdd, 0xdd, 0xdc, 0xba, 0x73, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x24,
-    0x7c, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x8d, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0,
-    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x30, 0x8, 0xff, 0xe9, 0x41, 0x0, 0x0,
-    0x26, 0xdf, 0xf4, 0x0, 0x0, 0x2a, 0xff, 0xff,
-    0xfe, 0xef, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xfe, 0xc9, 0x30, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xec,
-    0x94, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
-    0xdc, 0xde, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x4e,
-    0xfe, 0x83, 0x0, 0x0, 0x1, 0x4b, 0x70, 0x0,
-    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x16,
-    0x9b, 0xbb, 0x96, 0x10, 0x0, 0x0, 0xbf, 0x40,
-    0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0xc, 0xf3, 0x4, 0xff, 0xb5, 0x20, 0x1, 0x38,
-    0xef, 0xe3, 0x0, 0xcf, 0x43, 0xfd, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf2, 0xc, 0xf5, 0xdd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0,
-    0xbf, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x39, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x6f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xb0, 0x8f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x1,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0xc, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0xc, 0xfe, 0x72, 0x0, 0x0, 0x4, 0xcf, 0xf5,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0xcc, 0xdf,
-    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6a,
-    0xdf, 0xff, 0xd9, 0x40, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7a, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdf, 0xf5, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf1, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x20, 0x2, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x1, 0x7b, 0xdf, 0xff, 0xeb, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xed,
-    0xcc, 0xef, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x2e,
-    0xfe, 0x72, 0x0, 0x0, 0x1, 0x5c, 0xff, 0x50,
-    0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x7, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0xc,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x10, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x30, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3,
-    0x0, 0x0, 0x2d, 0xfd, 0x50, 0x0, 0x0, 0x0,
-    0x3a, 0xff, 0x40, 0x0, 0x0, 0x0, 0x8e, 0xff,
-    0xdb, 0xab, 0xcf, 0xff, 0xa2, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x3d, 0xfe, 0x94, 0x20, 0x0,
-    0x14, 0x8d, 0xff, 0x60, 0x0, 0x4, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x0,
-    0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x7f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0xdf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd0, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x70,
-    0x8, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xfc, 0x0, 0x0, 0x9f, 0xfb, 0x51, 0x0,
-    0x0, 0x0, 0x4a, 0xff, 0xc1, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0xec, 0xcc, 0xef, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x8b, 0xef, 0xff, 0xec,
-    0x95, 0x0, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xfe, 0xb6, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xfd, 0xcc,
-    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4f, 0xfc,
-    0x50, 0x0, 0x0, 0x17, 0xef, 0xc1, 0x0, 0x0,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xc0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x7f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x49, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf7, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xa2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0xfc, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x4f,
-    0xd0, 0x1e, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0x42, 0xfd, 0x0, 0x2e, 0xff, 0x94, 0x10,
-    0x2, 0x5a, 0xff, 0x40, 0x2f, 0xd0, 0x0, 0x19,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x3, 0xfd,
-    0x0, 0x0, 0x1, 0x59, 0xbb, 0xb9, 0x61, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x5,
-    0xb5, 0x10, 0x0, 0x0, 0x27, 0xef, 0xf5, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xed, 0xcd, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x0, 0x0, 0x38, 0xce, 0xff,
-    0xfd, 0xb7, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x3e, 0xe3, 0xaf, 0xfa, 0x7f, 0xf7, 0x4, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x40, 0x7f, 0xf7, 0xaf, 0xfa,
-    0x3e, 0xe3,
-
-    /* U+003B ";" */
-    0x3e, 0xe3, 0xaf, 0xfa, 0x7f, 0xf7, 0x4, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x40, 0x7f, 0xf7, 0xaf, 0xfa,
-    0x3e, 0xf7, 0x8, 0xf3, 0xc, 0xe0, 0xf, 0xa0,
-    0x3f, 0x50, 0x7f, 0x10, 0x56, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7d, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xaf, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x39,
-    0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f,
-    0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xaf, 0xfe, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff,
-    0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xef, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xfe, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-
-    /* U+003D "=" */
-    0x1a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa9, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa9, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe,
-
-    /* U+003E ">" */
-    0x19, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xaf, 0xfe, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xb5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xdf, 0xfb, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xaf, 0xfe, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f,
-    0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff,
-    0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f, 0xff,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x4, 0x9c, 0xef, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xed, 0xcd,
-    0xff, 0xfe, 0x50, 0x0, 0x1, 0xcf, 0xfa, 0x40,
-    0x0, 0x0, 0x4, 0xbf, 0xf8, 0x0, 0x1d, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50,
-    0x9, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x9c,
-    0xef, 0xff, 0xed, 0xb8, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0xff, 0xfc, 0xa8, 0x88, 0x9b, 0xdf, 0xfe,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xfd, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5a, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xfd, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xc7,
-    0x10, 0x0, 0x4f, 0x90, 0x0, 0xaf, 0x30, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xb9, 0x89, 0xcf, 0xf8, 0x0, 0x4f, 0x90, 0x0,
-    0x1e, 0xd0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x70, 0x0, 0x0, 0x1, 0x8f, 0xc0,
-    0x4f, 0x90, 0x0, 0x5, 0xf6, 0x0, 0x6, 0xf6,
-    0x0, 0x0, 0x0, 0x5f, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xeb, 0x4f, 0x90, 0x0, 0x0, 0xdd,
-    0x0, 0xc, 0xf0, 0x0, 0x0, 0x1, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xbf, 0x90,
-    0x0, 0x0, 0x7f, 0x30, 0x1f, 0xa0, 0x0, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x90, 0x0, 0x0, 0x1f, 0x70, 0x5f,
-    0x50, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0,
-    0xd, 0xb0, 0x8f, 0x20, 0x0, 0x0, 0x5f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0xa, 0xe0, 0xaf, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x8, 0xf0,
-    0xbe, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x7, 0xf1, 0xcd, 0x0, 0x0, 0x0, 0xbf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x7, 0xf1, 0xcd, 0x0,
-    0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x7,
-    0xf1, 0xbe, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90,
-    0x0, 0x0, 0x8, 0xf0, 0xaf, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0x0, 0x0, 0xa, 0xe0, 0x8f,
-    0x20, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x90, 0x0, 0x0,
-    0xc, 0xc0, 0x5f, 0x60, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x90, 0x0, 0x0, 0x1f, 0x80, 0x1f, 0xa0, 0x0,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x9f, 0x90, 0x0, 0x0, 0x6f, 0x30,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x2f, 0xb0, 0x0,
-    0x0, 0xdd, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x92, 0x0, 0x0, 0x3, 0xaf, 0xc0,
-    0xe, 0xf4, 0x0, 0xa, 0xf4, 0x0, 0x0, 0xee,
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xdb, 0xab,
-    0xef, 0xf8, 0x0, 0x5, 0xff, 0xba, 0xef, 0x70,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0xdf, 0xfe, 0xc7, 0x10, 0x0, 0x0, 0x4c,
-    0xff, 0xb4, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xfd, 0x73, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0xff, 0xfc, 0xa9, 0x89,
-    0xac, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26,
-    0xac, 0xef, 0xff, 0xec, 0x95, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x20, 0x0, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x50, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0xc,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-
-    /* U+0042 "B" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec,
-    0x83, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xef, 0xff, 0xd3, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x5c, 0xff, 0x60, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfb, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x20, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf7, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xc0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0x9f, 0xfa, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x2f, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd,
-    0xff, 0xfc, 0x40, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9f, 0xf8, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0x70, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf6, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfa, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0x90, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9f, 0xfb, 0x0,
-    0x2f, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd,
-    0xff, 0xff, 0x70, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xc9, 0x50, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff,
-    0xec, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4c, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xfe, 0x70,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xfe, 0x84, 0x10,
-    0x0, 0x2, 0x5b, 0xff, 0xe3, 0x0, 0x0, 0x3,
-    0xef, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xaf, 0xf5, 0x0, 0x3, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x20, 0x1,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xe2, 0x0, 0x0, 0x3e, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0x40, 0x0, 0x0, 0x1b, 0xff, 0xe8, 0x41, 0x0,
-    0x0, 0x25, 0xbf, 0xfd, 0x30, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xff, 0xee, 0xff, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xbd,
-    0xff, 0xfe, 0xc8, 0x40, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xfc, 0x50,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x8d, 0xff, 0xc2, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xdf, 0xf4, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf4, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x60, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfd, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x72, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfd, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xd2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf7, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x22, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x20, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x40, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0x40,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x37, 0xdf, 0xfc, 0x20, 0x0, 0x0, 0x2f,
-    0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xff, 0xff,
-    0xc5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xa7, 0x20, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x2, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0x70, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x2f, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xca, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0x22, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-
-    /* U+0046 "F" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x2f, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd7, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x2f, 0xfd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6a, 0xdf, 0xff,
-    0xec, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xa2,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xfe, 0x94, 0x10,
-    0x0, 0x1, 0x49, 0xef, 0xf7, 0x0, 0x0, 0x3,
-    0xef, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf9, 0x0, 0x3, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0x50, 0x1,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xbb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd6, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfd, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xb,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfd, 0x0, 0x1e, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x3e, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xa0, 0x0, 0x0, 0x1a, 0xff, 0xe9, 0x41, 0x0,
-    0x0, 0x14, 0x9e, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x4, 0xbf, 0xff, 0xff, 0xee, 0xff, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xad,
-    0xff, 0xfe, 0xc9, 0x51, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x2f, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xce, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-
-    /* U+0049 "I" */
-    0x2f, 0xe2, 0xfe, 0x2f, 0xe2, 0xfe, 0x2f, 0xe2,
-    0xfe, 0x2f, 0xe2, 0xfe, 0x2f, 0xe2, 0xfe, 0x2f,
-    0xe2, 0xfe, 0x2f, 0xe2, 0xfe, 0x2f, 0xe2, 0xfe,
-    0x2f, 0xe2, 0xfe, 0x2f, 0xe2, 0xfe, 0x2f, 0xe2,
-    0xfe, 0x2f, 0xe2, 0xfe, 0x2f, 0xe2, 0xfe, 0x2f,
-    0xe2, 0xfe,
-
-    /* U+004A "J" */
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x4, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6,
-    0xa, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xf1,
-    0x0, 0xcf, 0xe7, 0x10, 0x0, 0x29, 0xff, 0x60,
-    0x0, 0x8, 0xff, 0xfe, 0xde, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x28, 0xcf, 0xff, 0xc8, 0x10, 0x0,
-
-    /* U+004B "K" */
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0x60, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf6, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0x70, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf8, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0x80, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xf9, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0xb,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0xaf, 0xd9, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0xa, 0xfd,
-    0x10, 0xaf, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x9f, 0xd1, 0x0, 0xc, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe9, 0xfd, 0x10,
-    0x0, 0x1, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x2e, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x20, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xe1, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xb0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf9, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0x60, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4,
-
-    /* U+004C "L" */
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+004D "M" */
-    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x2f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x2f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf5, 0x2f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf5, 0x2f, 0xed, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfc, 0xf5, 0x2f, 0xe5, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x7b, 0xf5, 0x2f, 0xe0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0xb,
-    0xf5, 0x2f, 0xe0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0xa, 0xf5,
-    0x2f, 0xe0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0xa, 0xf5, 0x2f,
-    0xe0, 0x1, 0xef, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0xa, 0xf5, 0x2f, 0xe0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x0, 0xa, 0xf5, 0x2f, 0xe0, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xe1, 0x0, 0xa, 0xf5, 0x2f, 0xe0, 0x0, 0x3,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0xa, 0xf5, 0x2f, 0xe0, 0x0, 0x0, 0xaf,
-    0x60, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0,
-    0xa, 0xf5, 0x2f, 0xe0, 0x0, 0x0, 0x1f, 0xe1,
-    0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0xa,
-    0xf5, 0x2f, 0xe0, 0x0, 0x0, 0x8, 0xf9, 0x0,
-    0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0xa, 0xf5,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0xa, 0xf5, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x7,
-    0xf8, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x73, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xfd, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5,
-
-    /* U+004E "N" */
-    0x2f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe7, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0xaf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x2, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x8,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x1e, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x10,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf8,
-    0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf2, 0x0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfd, 0x0, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xa0, 0x5, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0x5, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x35, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe7, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfb,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfb, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff,
-    0xec, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0xfe, 0xee, 0xff,
-    0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xaf, 0xfe, 0x84, 0x10, 0x0, 0x2, 0x6b,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfa, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x70, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3,
-    0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x9f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf3, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf4, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x1f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x90, 0xb, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x30, 0x4, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfc, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x3, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2a, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xfe, 0x84, 0x10, 0x0, 0x2,
-    0x6b, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xbf, 0xff, 0xfe, 0xee, 0xff, 0xff,
-    0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x7b, 0xdf, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xa6,
-    0x10, 0x0, 0x0, 0x2, 0xff, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xde, 0xff, 0xff, 0x91, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xef,
-    0xe4, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xe0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x70, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x22,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x22, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x50, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xe2, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x6b,
-    0xff, 0xd2, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x2f,
-    0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xca, 0x73, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff,
-    0xec, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xee, 0xef,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xfe, 0x84, 0x10, 0x0, 0x2,
-    0x6b, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0, 0xaf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x4f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xc0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x30, 0x1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x40, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x6,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x1e, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xe8, 0x41, 0x0, 0x0, 0x26, 0xbf, 0xfe, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xff, 0xfe, 0xee, 0xff, 0xff, 0xe8, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xbd, 0xff, 0xff, 0xd9, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xb3, 0x0, 0x0, 0x2a, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0xfe, 0xbc, 0xef, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xef, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xa6,
-    0x10, 0x0, 0x0, 0x2, 0xff, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xde, 0xff, 0xff, 0x91, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xef,
-    0xe4, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xe0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x70, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x22,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x22, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x50, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xe1, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x6b,
-    0xff, 0xc1, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x2f,
-    0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xfe, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xe1, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x60, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf4,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff, 0xeb, 0x84,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xdc,
-    0xde, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x3e, 0xfe,
-    0x72, 0x0, 0x0, 0x1, 0x5a, 0xff, 0xd0, 0x0,
-    0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x9b, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x81, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfb, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8e, 0xff, 0xfe, 0xa6, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7c,
-    0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xcf, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x18, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xa0, 0xaf, 0xe7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x7f,
-    0xfe, 0x94, 0x0, 0x0, 0x0, 0x26, 0xdf, 0xf4,
-    0x0, 0x0, 0x29, 0xff, 0xff, 0xed, 0xcd, 0xff,
-    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x59, 0xce,
-    0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x5b, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdf, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x4f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30,
-    0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x8f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0xc, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x51, 0x0, 0x0, 0x26, 0xdf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xfe, 0xef, 0xff,
-    0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x90, 0xa, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x4f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xc0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x50, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0,
-    0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x10, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xcc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x20, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x67, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x11, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x6f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0,
-    0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x6, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0xaf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0xbf,
-    0x40, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0,
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0xa, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x60, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0xcf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xb2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x1a, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfb, 0x0, 0x5, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x10, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x30, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x70, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0,
-    0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x40, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x3,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfb, 0x1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf7,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfe, 0x10, 0x6, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x10, 0x2, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfb, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf7,
-
-    /* U+0059 "Y" */
-    0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0xdf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xd0, 0x4, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0xa, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0,
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x20, 0x0, 0x1e, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb,
-    0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x3, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe1, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xdf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xb, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd5, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+005B "[" */
-    0x2f, 0xff, 0xff, 0xf5, 0x2f, 0xfb, 0xbb, 0xb3,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x2f, 0xfb, 0xbb, 0xb3,
-    0x2f, 0xff, 0xff, 0xf5,
-
-    /* U+005C "\\" */
-    0x18, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8,
-
-    /* U+005D "]" */
-    0x1f, 0xff, 0xff, 0xf5, 0xb, 0xbb, 0xbe, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0xa, 0xf5, 0xb, 0xbb, 0xbe, 0xf5,
-    0x1f, 0xff, 0xff, 0xf5,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x4, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xef, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf9, 0xb, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0,
-    0xed, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x7, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x0, 0xaf, 0x10, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x1, 0xfa,
-    0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x8f,
-    0x30, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0,
-    0xce, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x90,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x10,
-
-    /* U+005F "_" */
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-
-    /* U+0060 "`" */
-    0x6, 0x87, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xd2,
-    0x0, 0x0, 0x0, 0x6, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x2c, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xa0,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x27, 0xbe, 0xff, 0xfc, 0x82, 0x0,
-    0x0, 0x0, 0x2b, 0xff, 0xfe, 0xcc, 0xdf, 0xff,
-    0x90, 0x0, 0x7, 0xff, 0xc5, 0x10, 0x0, 0x1,
-    0x7f, 0xfb, 0x0, 0xb, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0x60, 0x1, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x15, 0x78, 0x88, 0x88, 0x88,
-    0x8d, 0xf5, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x4, 0xff, 0xa4, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0xe, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x9f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x9f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf5,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf5, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0xf5, 0x8, 0xfe, 0x40, 0x0, 0x0, 0x1,
-    0x9f, 0x79, 0xf5, 0x0, 0x7f, 0xfd, 0x98, 0x79,
-    0xcf, 0xe5, 0x9, 0xf5, 0x0, 0x2, 0x8c, 0xef,
-    0xfe, 0xb6, 0x10, 0x9, 0xf5,
-
-    /* U+0062 "b" */
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x9, 0xff, 0xfd,
-    0xcd, 0xff, 0xfe, 0x50, 0x0, 0x0, 0xcf, 0x31,
-    0xdf, 0xc5, 0x0, 0x0, 0x4, 0xaf, 0xfa, 0x0,
-    0x0, 0xcf, 0x4d, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xa0, 0x0, 0xcf, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0xcf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0xcf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0xcf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0,
-    0xcf, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf5, 0x0, 0xcf, 0x3c, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xa0, 0x0, 0xcf, 0x21,
-    0xdf, 0xc5, 0x0, 0x0, 0x4, 0xaf, 0xfa, 0x0,
-    0x0, 0xcf, 0x20, 0x9, 0xff, 0xfd, 0xcd, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x28,
-    0xce, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xdc,
-    0xdf, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x8f, 0xfb,
-    0x40, 0x0, 0x0, 0x4b, 0xff, 0x50, 0x0, 0x8,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x70, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x70, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x8f, 0xfb,
-    0x40, 0x0, 0x0, 0x4b, 0xff, 0x50, 0x0, 0x0,
-    0x4, 0xdf, 0xff, 0xdc, 0xdf, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0x94,
-    0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xec, 0x82,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xdc, 0xdf, 0xff, 0x90, 0x3, 0xfc, 0x0, 0x0,
-    0x9f, 0xfb, 0x40, 0x0, 0x0, 0x5c, 0xfd, 0x13,
-    0xfc, 0x0, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc3, 0xfc, 0x0, 0x5f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0xfc, 0x0,
-    0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfc, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0xa, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfc, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xa,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc,
-    0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0xfc, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd3, 0xfc, 0x0, 0x0,
-    0x9f, 0xfa, 0x40, 0x0, 0x0, 0x5c, 0xfd, 0x12,
-    0xfc, 0x0, 0x0, 0x5, 0xef, 0xff, 0xdc, 0xdf,
-    0xff, 0x90, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xec, 0x82, 0x0, 0x2, 0xfc,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0xeb, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xec,
-    0xce, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf8, 0x10, 0x0, 0x1, 0x7e, 0xfb, 0x0, 0x0,
-    0x0, 0xaf, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xfb, 0x0, 0x0, 0x6f, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf7, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x60, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0xe, 0xf3, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x3f, 0xd0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x40, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x90, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0x60, 0x0, 0x0, 0x8f,
-    0xfb, 0x50, 0x0, 0x0, 0x39, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x4d, 0xff, 0xfe, 0xcd, 0xff, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff,
-    0xfd, 0xa5, 0x0, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x6, 0xcf, 0xfe, 0xb5, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xdb, 0xcf, 0xf5, 0x0,
-    0x0, 0x9, 0xfc, 0x20, 0x0, 0x7, 0x0, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x2, 0xbb, 0xbd, 0xfe, 0xbb,
-    0xbb, 0xbb, 0x30, 0x0, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfc, 0x93,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xda, 0xaa, 0xcf, 0xfc, 0x20, 0xe, 0xf0, 0x0,
-    0x0, 0xaf, 0xf7, 0x10, 0x0, 0x0, 0x17, 0xef,
-    0x50, 0xef, 0x0, 0x0, 0xbf, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0x4e, 0xf0, 0x0, 0x7f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0xef, 0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x7f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf0, 0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x6, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xef, 0xf0,
-    0x0, 0xa, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0xf3, 0xff, 0x0, 0x0, 0xa, 0xff, 0xa4,
-    0x0, 0x0, 0x3, 0x9f, 0xf4, 0xf, 0xf0, 0x0,
-    0x0, 0x5, 0xef, 0xff, 0xdc, 0xdf, 0xff, 0xc2,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xdf,
-    0xff, 0xc9, 0x30, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0xb, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0,
-    0x6, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf5, 0x0, 0x0, 0x8, 0xff, 0xe8, 0x30,
-    0x0, 0x0, 0x4, 0xbf, 0xf7, 0x0, 0x0, 0x0,
-    0x3, 0xaf, 0xff, 0xfe, 0xdd, 0xef, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xef,
-    0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x4a,
-    0xdf, 0xff, 0xc9, 0x30, 0x0, 0xc, 0xf3, 0x3,
-    0xdf, 0xff, 0xdd, 0xef, 0xff, 0xa0, 0x0, 0xcf,
-    0x34, 0xff, 0x82, 0x0, 0x0, 0x17, 0xff, 0xc0,
-    0xc, 0xf6, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0x90, 0xcf, 0xed, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x2c, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0xcf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xbc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xec, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xec, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xec,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xec, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xec, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xec, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0,
-
-    /* U+0069 "i" */
-    0x1c, 0xf6, 0x5f, 0xfd, 0x2f, 0xf9, 0x1, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3,
-    0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3,
-    0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3,
-    0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3,
-    0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3, 0xc, 0xf3,
-    0xc, 0xf3,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x10, 0x9, 0x20, 0x0, 0x2c,
-    0xf9, 0x0, 0x5f, 0xfd, 0xbc, 0xff, 0xc0, 0x0,
-    0x4, 0xae, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf9, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0x90, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xf8, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x6, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0xb, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x31, 0xcf, 0xc1,
-    0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x5d,
-    0xfb, 0x0, 0x1e, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xa0, 0x0, 0x3, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0, 0x0, 0x6f,
-    0xf2, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x9, 0xfd, 0x10, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf8,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0,
-
-    /* U+006C "l" */
-    0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c,
-    0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf,
-    0x3c, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf3,
-    0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c,
-    0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf,
-    0x3c, 0xf3, 0xcf, 0x30,
-
-    /* U+006D "m" */
-    0xcf, 0x20, 0x0, 0x5a, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xc7, 0x10,
-    0x0, 0xc, 0xf2, 0x4, 0xef, 0xeb, 0xaa, 0xcf,
-    0xff, 0x60, 0x0, 0x4, 0xef, 0xfc, 0xaa, 0xcf,
-    0xff, 0x70, 0x0, 0xcf, 0x26, 0xfd, 0x40, 0x0,
-    0x0, 0x18, 0xff, 0x70, 0x7, 0xfe, 0x50, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0xc, 0xf6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x25, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x40, 0xcf, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfb, 0xed,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xc,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf2, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x5c, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf7, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x8c, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x9c, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x9c, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9c, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x9c, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x9c, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
-
-    /* U+006E "n" */
-    0xcf, 0x20, 0x0, 0x5a, 0xdf, 0xff, 0xc9, 0x30,
-    0x0, 0xc, 0xf2, 0x3, 0xdf, 0xfc, 0xaa, 0xbe,
-    0xff, 0xa0, 0x0, 0xcf, 0x25, 0xfd, 0x50, 0x0,
-    0x0, 0x5, 0xdf, 0xc0, 0xc, 0xf5, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0x90, 0xcf, 0xec,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x2c,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf7, 0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xbc, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfd, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xec, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xec, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xec, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xec, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xec, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xec, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff,
-    0xdc, 0xdf, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xfb, 0x40, 0x0, 0x0, 0x5c, 0xff, 0x50,
-    0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf2, 0xa, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfc, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0xa,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x20, 0x0, 0x8, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x8f, 0xfa, 0x40, 0x0, 0x0, 0x5c, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xdc, 0xdf,
-    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0xcf, 0x20, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x9, 0xff, 0xfd,
-    0xcd, 0xff, 0xfe, 0x50, 0x0, 0x0, 0xcf, 0x21,
-    0xdf, 0xc5, 0x0, 0x0, 0x4, 0xaf, 0xf9, 0x0,
-    0x0, 0xcf, 0x3c, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0x90, 0x0, 0xcf, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0xcf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x50, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0xcf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0xcf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0,
-    0xcf, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf5, 0x0, 0xcf, 0x4d, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xa0, 0x0, 0xcf, 0x31,
-    0xdf, 0xc5, 0x0, 0x0, 0x4, 0xaf, 0xfa, 0x0,
-    0x0, 0xcf, 0x30, 0x9, 0xff, 0xfd, 0xcd, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x28,
-    0xce, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xec, 0x82,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xdc, 0xdf, 0xff, 0x90, 0x2, 0xfc, 0x0, 0x0,
-    0x9f, 0xfb, 0x40, 0x0, 0x0, 0x5c, 0xfd, 0x12,
-    0xfc, 0x0, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xd3, 0xfc, 0x0, 0x5f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xfc, 0x0,
-    0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfc, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0xa, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfc, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xa,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc,
-    0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfc, 0xfc, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd3, 0xfc, 0x0, 0x0,
-    0x9f, 0xfa, 0x40, 0x0, 0x0, 0x5c, 0xfd, 0x13,
-    0xfc, 0x0, 0x0, 0x5, 0xef, 0xff, 0xdc, 0xdf,
-    0xff, 0x90, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xec, 0x82, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-
-    /* U+0072 "r" */
-    0xcf, 0x20, 0x1, 0x6b, 0xef, 0x2c, 0xf2, 0x5,
-    0xef, 0xfd, 0xc1, 0xcf, 0x27, 0xfd, 0x50, 0x0,
-    0xc, 0xf6, 0xfa, 0x0, 0x0, 0x0, 0xcf, 0xec,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x39, 0xce, 0xff, 0xeb, 0x83, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xdc, 0xce, 0xff, 0xfc,
-    0x40, 0x1, 0xdf, 0xc4, 0x0, 0x0, 0x1, 0x5b,
-    0xfb, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x20, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
-    0x96, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7c,
-    0xff, 0xff, 0xfc, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x36, 0xad, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6e, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xa5, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf4, 0x8f, 0xfc, 0x61, 0x0, 0x0, 0x0, 0x6e,
-    0xfa, 0x0, 0x4c, 0xff, 0xfe, 0xcc, 0xcd, 0xff,
-    0xf8, 0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff, 0xeb,
-    0x71, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x28, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x2b, 0xbb, 0xdf,
-    0xeb, 0xbb, 0xbb, 0xb3, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd2, 0x0, 0x1, 0x91, 0x0, 0x0, 0x1, 0xcf,
-    0xfd, 0xbc, 0xff, 0x60, 0x0, 0x0, 0x0, 0x7c,
-    0xff, 0xea, 0x40,
-
-    /* U+0075 "u" */
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x8f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x8f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf8, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x8f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x8e, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0xcf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x89, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xef, 0x80, 0xaf, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xe7, 0xf8, 0x1, 0xdf, 0xe7, 0x10, 0x0,
-    0x2, 0x9f, 0xe3, 0x6f, 0x80, 0x1, 0xaf, 0xff,
-    0xed, 0xdf, 0xff, 0xc2, 0x6, 0xf8, 0x0, 0x0,
-    0x38, 0xcf, 0xff, 0xda, 0x40, 0x0, 0x6f, 0x80,
-
-    /* U+0076 "v" */
-    0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xc3, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0xc, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x20, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x6, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x80, 0xa, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x4f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xee, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x91, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0xfc, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x3,
-    0xfa, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x0, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x6, 0xf7, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x8, 0xf5, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xd0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x2f,
-    0xb0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x30, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0xcf, 0x10, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x5,
-    0xf7, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x7,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x3,
-    0xf9, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf0, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x70, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x50, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x4, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd1, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x30, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x1,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x5, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf6, 0xa, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x9f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe1, 0x3,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x30, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x1, 0xdf,
-    0x60, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfd, 0x10, 0x1, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf7,
-
-    /* U+0079 "y" */
-    0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xe0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf4, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x30, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xcf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xd4, 0x0, 0x2, 0xbf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0xcd, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3a, 0xef, 0xfc, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfd, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xb4, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x4, 0xbe, 0xfe, 0x0, 0x0, 0x6f,
-    0xfe, 0xba, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x9, 0xf9, 0x0, 0x0, 0x5b, 0xdf, 0xe2,
-    0x0, 0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x1c, 0xf6, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x5f, 0xfe, 0xba, 0x0, 0x0, 0x3, 0xbe,
-    0xfe,
-
-    /* U+007C "|" */
-    0x2f, 0xc2, 0xfc, 0x2f, 0xc2, 0xfc, 0x2f, 0xc2,
-    0xfc, 0x2f, 0xc2, 0xfc, 0x2f, 0xc2, 0xfc, 0x2f,
-    0xc2, 0xfc, 0x2f, 0xc2, 0xfc, 0x2f, 0xc2, 0xfc,
-    0x2f, 0xc2, 0xfc, 0x2f, 0xc2, 0xfc, 0x2f, 0xc2,
-    0xfc, 0x2f, 0xc2, 0xfc, 0x2f, 0xc2, 0xfc, 0x2f,
-    0xc2, 0xfc, 0x2f, 0xc2, 0xfc, 0x2f, 0xc2, 0xfc,
-    0x2f, 0xc2, 0xfc, 0x2f, 0xc2, 0xfc, 0x2f, 0xc0,
-
-    /* U+007D "}" */
-    0x1f, 0xfe, 0xa2, 0x0, 0x0, 0x0, 0xbb, 0xef,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0xd,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfc, 0xb3, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0x50, 0x0, 0x0, 0x9f, 0xa1, 0x0, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0xd,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0xbb, 0xef, 0xf3, 0x0, 0x0, 0x1f, 0xfe,
-    0xa2, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x3, 0x89, 0x72, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0x10, 0x9, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x6, 0xf0, 0x7, 0xf9, 0x10, 0x3b, 0xfb,
-    0x0, 0x0, 0x0, 0xbd, 0x0, 0xfb, 0x0, 0x0,
-    0x8, 0xfc, 0x20, 0x0, 0x6f, 0x70, 0x3f, 0x40,
-    0x0, 0x0, 0x6, 0xff, 0xb9, 0xcf, 0xc0, 0x6,
-    0xf0, 0x0, 0x0, 0x0, 0x2, 0xae, 0xfe, 0x80,
-    0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0xbf, 0x30,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x8f, 0x70, 0x0,
-    0x1, 0xee, 0x10, 0x0, 0x4f, 0xb0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x2e, 0xd1, 0x0, 0x0, 0x8f,
-    0x70, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x4f, 0xb0,
-    0x0, 0x9, 0xf6, 0x0, 0x0, 0x2f, 0xe1, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x7,
-    0xf9, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0xd,
-    0xf2, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x2f,
-    0xd0, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x8f,
-    0x70, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0xbf,
-    0x30,
-
-    /* U+00BB "»" */
-    0x1e, 0xd1, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0,
-    0x0, 0x7f, 0x70, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0xb, 0xf4, 0x0, 0x1, 0xed, 0x10, 0x0,
-    0x0, 0x1, 0xde, 0x10, 0x0, 0x4f, 0xb0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x7, 0xf7, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0xbf, 0x40,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x7, 0xf8, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0xa, 0xf4, 0x0, 0x1, 0xee, 0x10, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0,
-    0x1e, 0xe1, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x3, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xa0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x2e, 0xd1, 0x0, 0x3, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x0, 0x9,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xb1,
-    0x0, 0x2, 0xca, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xc0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5,
-
-    /* U+0402 "Ђ" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x7,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xfe, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x1, 0x47, 0x9b, 0xbb, 0x96, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x92, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfb, 0x74, 0x21, 0x12, 0x48, 0xef, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0x0, 0x3e, 0xcb, 0xac, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xd4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xef, 0xff,
-    0xdb, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4c, 0xff, 0xff, 0xee, 0xef, 0xff, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x83, 0x0,
-    0x0, 0x2, 0x6b, 0xff, 0xd3, 0x0, 0x0, 0x1,
-    0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xbf, 0xf4, 0x0, 0x1, 0xdf, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x10, 0x0,
-    0xbf, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0x90, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xe2, 0x0, 0x0, 0x1d, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0x40, 0x0, 0x0, 0xa, 0xff, 0xe8, 0x30, 0x0,
-    0x0, 0x36, 0xbf, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xfe, 0xee, 0xff, 0xff, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xbe,
-    0xff, 0xfd, 0xb8, 0x30, 0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xdd,
-    0xde, 0xff, 0xff, 0x91, 0x0, 0x0, 0x1c, 0xff,
-    0x93, 0x0, 0x0, 0x0, 0x49, 0xef, 0xf3, 0x0,
-    0xc, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xfc, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xb7, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6b,
-    0xef, 0xff, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x26, 0xbf, 0xff, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x44, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0x6f, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x5e,
-    0xff, 0xa5, 0x10, 0x0, 0x0, 0x15, 0xcf, 0xf7,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xfd, 0xcd, 0xef,
-    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbe,
-    0xff, 0xfe, 0xc9, 0x40, 0x0, 0x0,
-
-    /* U+0406 "І" */
-    0xff, 0x1f, 0xf1, 0xff, 0x1f, 0xf1, 0xff, 0x1f,
-    0xf1, 0xff, 0x1f, 0xf1, 0xff, 0x1f, 0xf1, 0xff,
-    0x1f, 0xf1, 0xff, 0x1f, 0xf1, 0xff, 0x1f, 0xf1,
-    0xff, 0x1f, 0xf1, 0xff, 0x1f, 0xf1, 0xff, 0x1f,
-    0xf1, 0xff, 0x1f, 0xf1, 0xff, 0x1f, 0xf1, 0xff,
-    0x1f, 0xf1,
-
-    /* U+0407 "Ї" */
-    0x9f, 0x70, 0x0, 0xa, 0xf6, 0xff, 0xd0, 0x0,
-    0xf, 0xfc, 0x7d, 0x50, 0x0, 0x8, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x4, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6,
-    0xa, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xf1,
-    0x0, 0xcf, 0xe7, 0x10, 0x0, 0x29, 0xff, 0x60,
-    0x0, 0x8, 0xff, 0xfe, 0xde, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x28, 0xcf, 0xff, 0xc8, 0x10, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xce,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x70,
-    0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfd, 0x0, 0x0,
-    0x4, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x6b, 0xff, 0xd1, 0x0, 0x7f, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xfe, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed,
-    0xa6, 0x10, 0x0, 0x0,
-
-    /* U+040A "Њ" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa6,
-    0x10, 0x0, 0xf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xde, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x5b, 0xff, 0xb0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x90,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xcf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x6f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xbf, 0xf7, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff, 0xd4,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xc9, 0x40, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xa,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfe, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x3, 0x79, 0xcd, 0xdc, 0xa7, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x54, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xea, 0x63, 0x10, 0x1, 0x49, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0x10, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf3, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfa, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x1, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0xc, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xdd, 0xdd, 0xdd, 0xef, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x1e, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe2, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf7,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x40, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe2, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfd, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf7,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x3, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xef, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0x1f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x1, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x70, 0x0, 0x1, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf1, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0, 0x7,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf1, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x10, 0x1, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x10, 0x8f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x5f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x0, 0x1f, 0x90, 0x0, 0x0, 0x0,
-    0x7, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0x1, 0xde, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0x83, 0x11, 0x27, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9e, 0xff, 0xff,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x33, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf6, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xc0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-    0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0xbf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x50, 0x3f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x30, 0x0, 0x2b, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfd, 0xef, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x9d, 0xff, 0xd7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+040F "Џ" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xbf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf9, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0xef, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
-
-    /* U+0411 "Б" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0xff, 0xdc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xc9, 0x50, 0x0, 0x0, 0xff,
-    0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xbd, 0xff, 0xfe,
-    0x60, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xbf, 0xf9, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x60,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xe0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x40, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0xcf, 0xf6, 0x0, 0xff, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xce, 0xff, 0xfc, 0x30,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xb7, 0x20, 0x0, 0x0,
-
-    /* U+0412 "В" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb7,
-    0x10, 0x0, 0x0, 0xf, 0xfb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbc, 0xef, 0xff, 0x90, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xff,
-    0xd1, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xb0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x30, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x30, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x6c, 0xfd, 0x30, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xab,
-    0xdf, 0xfe, 0x80, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xd2, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xd0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0xdf, 0xf4, 0x0, 0xff, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbc, 0xef, 0xff, 0xb2, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb7, 0x30,
-    0x0, 0x0,
-
-    /* U+0413 "Г" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xd4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xde, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x7d, 0xff,
-    0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xde, 0xff, 0xdd, 0xdc, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x9f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x48, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x87,
-
-    /* U+0415 "Е" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xa0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xdc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xc0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+0416 "Ж" */
-    0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0x2, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x7f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf4,
-    0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x10, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf4, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x7f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x7f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf5, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x10, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf6,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x2, 0x7a, 0xdf, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
-    0xed, 0xde, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x2,
-    0xef, 0xfb, 0x63, 0x0, 0x0, 0x1, 0x4a, 0xff,
-    0xb0, 0x0, 0x0, 0xe, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x2, 0xcc, 0xcc, 0xcc,
-    0xcd, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x37, 0xcf, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfb,
-    0x3, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x40, 0x8f, 0xf7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xa0, 0x0,
-    0x7f, 0xff, 0xa5, 0x20, 0x0, 0x0, 0x1, 0x5b,
-    0xff, 0xa0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xfd,
-    0xdc, 0xdf, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x48, 0xbd, 0xff, 0xff, 0xdb, 0x83, 0x0,
-    0x0, 0x0,
-
-    /* U+0418 "И" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x51, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x1f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xc0, 0x1, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xe1, 0x0, 0x1f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4,
-    0x0, 0x1, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf7, 0x0, 0x0, 0x1f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x2, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x7f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x10, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x1e, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf1, 0x8, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x15, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x1e, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x51,
-    0x2, 0x7e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xbf, 0xff, 0xff, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x32,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xef, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0x1f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x1, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x70, 0x0, 0x1, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf1, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0, 0x7,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf1, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x10, 0x1, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x10, 0x8f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x5f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0,
-
-    /* U+041A "К" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf3,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x1, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xdd, 0xdd, 0xdd, 0xef, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x1e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe2, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf7, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x40, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xe2, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfd, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xf7,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x3f, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x30, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x5f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x7,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0x0, 0x0, 0x0, 0x7f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0xcf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x30, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x1e, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0x0, 0x4d, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x7f,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x37, 0xff, 0xe8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf3,
-
-    /* U+041C "М" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x7f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf7, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x7f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf7, 0xff, 0xcf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xbf,
-    0x7f, 0xf3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa8, 0xf7, 0xff,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x8f, 0x7f, 0xf0, 0x1e,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf7, 0x8, 0xf7, 0xff, 0x0, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd,
-    0x0, 0x8f, 0x8f, 0xf0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x8,
-    0xf8, 0xff, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x8f, 0x8f,
-    0xf0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x0, 0x8, 0xf8, 0xff, 0x0,
-    0x0, 0x1f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf9, 0x0, 0x0, 0x8f, 0x8f, 0xf0, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10,
-    0x0, 0x8, 0xf8, 0xff, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0,
-    0x8f, 0x8f, 0xf0, 0x0, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x8, 0xf8,
-    0xff, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0,
-    0xb, 0xf4, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0xf0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x8, 0xf8, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0x8f, 0x8f, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x10, 0x7f, 0x80, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfc,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x8f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf8, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x8f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-
-    /* U+041D "Н" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xdf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xdf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xdf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xdf, 0xdf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xdf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xdf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xdf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x5a, 0xce, 0xff,
-    0xfd, 0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xee, 0xff,
-    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xa5, 0x10, 0x0, 0x1, 0x59,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xfd, 0x10, 0x0, 0x0, 0xb, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xc0, 0x0, 0x0, 0x6f, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf7,
-    0x0, 0x0, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10,
-    0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x1f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0x7f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xe0, 0x7, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0xef, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x10, 0x0, 0x6f, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf7, 0x0, 0x0, 0xb, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xc0,
-    0x0, 0x0, 0x0, 0xcf, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xa5, 0x10, 0x0, 0x1,
-    0x49, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x9f, 0xff, 0xff, 0xee, 0xff, 0xff,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x6a, 0xce, 0xff, 0xfd, 0xa6, 0x10,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-
-    /* U+0420 "Р" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72,
-    0x0, 0x0, 0x0, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xde, 0xff, 0xff, 0xb2, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x7e, 0xff, 0x60,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf5, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x90, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf5, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x10, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xf3, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x1, 0x25, 0xaf,
-    0xfe, 0x30, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x80, 0x0, 0x0, 0xff, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdc, 0xa8, 0x40, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x59, 0xce, 0xff,
-    0xed, 0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xa2,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa5, 0x20,
-    0x0, 0x1, 0x49, 0xef, 0xf7, 0x0, 0x0, 0x0,
-    0xbf, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf9, 0x0, 0x0, 0xcf, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0x50, 0x0,
-    0xaf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xe6, 0x0, 0x0, 0x1b, 0xff,
-    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x90, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x52, 0x0,
-    0x0, 0x14, 0x9e, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x2, 0x9f, 0xff, 0xff, 0xee, 0xff, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xac,
-    0xef, 0xfe, 0xda, 0x61, 0x0, 0x0,
-
-    /* U+0422 "Т" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x97, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xde, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xd7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0423 "У" */
-    0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x2,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xc0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0xb,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0x3, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xaf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x0, 0x2, 0xbf, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xde, 0xff, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xdf,
-    0xfd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xac,
-    0xef, 0xff, 0xfe, 0xdb, 0x85, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff,
-    0xec, 0xbf, 0xfc, 0xcd, 0xff, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xfe, 0x94,
-    0x10, 0x0, 0xcf, 0x20, 0x0, 0x37, 0xcf, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe6, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x3b,
-    0xff, 0x60, 0x0, 0x0, 0x2, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x70, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x40, 0x0, 0x8f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf6, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xdf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x3d,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x19, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf4, 0x0, 0x0, 0x2e, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x2d, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x2,
-    0xbf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xe9, 0x51, 0x0, 0xc, 0xf2, 0x0, 0x3, 0x7c,
-    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x9e, 0xff, 0xfe, 0xcb, 0xff, 0xcc, 0xdf, 0xff,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x7a, 0xce, 0xff, 0xff, 0xed, 0xb8,
-    0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf7, 0x0,
-    0x0, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20, 0x0,
-    0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x1, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x10, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x6f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x6f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfe, 0x10, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x1, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf6, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0x0, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x40, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1,
-
-    /* U+0426 "Ц" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x20, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x20, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x20, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x20, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x20, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0xff,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xff, 0xdd, 0xdd, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0x50,
-
-    /* U+0427 "Ч" */
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf7, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0xef, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x1f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x6, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x9f, 0xf7, 0x0, 0x8f, 0xfd,
-    0x62, 0x0, 0x0, 0x2, 0x59, 0xef, 0xff, 0xf7,
-    0x0, 0x4, 0xdf, 0xff, 0xfd, 0xde, 0xff, 0xff,
-    0xe9, 0x49, 0xf7, 0x0, 0x0, 0x4, 0x9c, 0xef,
-    0xff, 0xda, 0x73, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf7,
-
-    /* U+0428 "Ш" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0429 "Щ" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xb0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xb0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xb0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xb0, 0x0, 0x0, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xde, 0xff, 0xdd, 0xdd, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x68, 0x10,
-
-    /* U+042A "Ъ" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x97, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x26, 0xaf, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xef, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc, 0xef, 0xff,
-    0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa6, 0x10,
-    0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x9f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0xff, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xa9,
-    0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x60, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x13, 0x7c, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x7f, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xc0, 0x0,
-    0x0, 0x7, 0xf9, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0,
-    0x7f, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x7, 0xf9,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x7f, 0x9f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x50, 0x0, 0x7, 0xf9, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x7f, 0x9f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x7, 0xf9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x7f,
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x20, 0x0, 0x7, 0xf9, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x7f, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf6,
-    0x0, 0x0, 0x7, 0xf9, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfc, 0x0, 0x0,
-    0x0, 0x7f, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x8f, 0xfc, 0x10, 0x0, 0x0, 0x7,
-    0xf9, 0xff, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcf,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-
-    /* U+042C "Ь" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xa9, 0x63, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd6, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x13, 0x7c, 0xff, 0xb0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0xfc, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x60, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xd0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x60,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xfc, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xff, 0xc1, 0x0, 0xff, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xcf, 0xff, 0xf7, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec,
-    0x95, 0x0, 0x0, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x0, 0x2, 0x7a, 0xdf, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
-    0xff, 0xee, 0xef, 0xff, 0xfd, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xfd, 0x73, 0x0, 0x0, 0x2,
-    0x7d, 0xff, 0xc2, 0x0, 0x0, 0x2, 0xdf, 0xd4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf3,
-    0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10, 0x0,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1b, 0xff, 0x30, 0x0, 0x2e, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x40, 0x0,
-    0x0, 0x1b, 0xff, 0xc7, 0x30, 0x0, 0x0, 0x27,
-    0xdf, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x5, 0xcf,
-    0xff, 0xfe, 0xee, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xad, 0xff, 0xfe,
-    0xc9, 0x40, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x9c, 0xef, 0xfe, 0xd9, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xff, 0xfe, 0xef, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xfc, 0x62, 0x0, 0x0,
-    0x15, 0xbf, 0xfe, 0x40, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xf7, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x70, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1e,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf4, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0xff, 0x10, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xe0, 0xff, 0x10, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0xff, 0x10, 0x0, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0xff, 0x10,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0xff, 0x10, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0xff, 0xee, 0xee, 0xee,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0xff, 0x10,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0xff, 0x10, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0xff, 0x10, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0xff, 0x10, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0xff, 0x10,
-    0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0xff, 0x10, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0xff, 0x10, 0x0, 0x0, 0x0, 0xaf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xf7,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0xfc, 0x62, 0x0, 0x0, 0x15, 0xbf,
-    0xfe, 0x40, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xfe, 0xef,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xff, 0xd9, 0x50, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x0, 0x17, 0xbd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x1, 0xaf, 0xff,
-    0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf3, 0x0,
-    0x3, 0xef, 0xf8, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x30, 0x2, 0xff, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0xa, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x31,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0xef,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x4, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x6, 0xff, 0xc5, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x3, 0xcf, 0xff,
-    0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xf3, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x1, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x5f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0xa, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x1, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3,
-
-    /* U+0430 "а" */
-    0x0, 0x0, 0x27, 0xbe, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0x0, 0x3b, 0xff, 0xfe, 0xcc, 0xdf, 0xff,
-    0x90, 0x0, 0x8, 0xff, 0xc5, 0x10, 0x0, 0x1,
-    0x7f, 0xfa, 0x0, 0xc, 0xd4, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x50, 0x1, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf4, 0x0, 0x0, 0x15, 0x78, 0x88, 0x88, 0x88,
-    0x8e, 0xf4, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x4, 0xff, 0xa4, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0x1f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf4, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0xaf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf4, 0x2f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfd, 0xf4, 0x8, 0xfe, 0x40, 0x0, 0x0, 0x1,
-    0xaf, 0x6a, 0xf4, 0x0, 0x8f, 0xfd, 0x98, 0x79,
-    0xcf, 0xe5, 0xa, 0xf4, 0x0, 0x2, 0x8c, 0xef,
-    0xfe, 0xb6, 0x0, 0xa, 0xf4,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x59, 0xdf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x6a, 0xef, 0xff, 0xfe,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x39, 0xef, 0xff,
-    0xfc, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xfb, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x1, 0x7b, 0xef, 0xfe,
-    0xb7, 0x10, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x7f,
-    0xff, 0xec, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0xc,
-    0xf2, 0xb, 0xfc, 0x50, 0x0, 0x0, 0x39, 0xff,
-    0xc1, 0x0, 0xe, 0xf0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xfd, 0x0, 0xf, 0xe6, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x90,
-    0xf, 0xee, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x1f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0xf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfc, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x8, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x4, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x1e,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x70, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xfb, 0x0, 0x0, 0x0, 0x6f, 0xfd,
-    0x50, 0x0, 0x0, 0x28, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x4, 0xdf, 0xff, 0xcb, 0xce, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff,
-    0xfd, 0xa5, 0x0, 0x0, 0x0,
-
-    /* U+0432 "в" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x93, 0x0,
-    0x0, 0xbf, 0xba, 0xaa, 0xaa, 0xaa, 0xbe, 0xff,
-    0xa0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xfa, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x30, 0xbf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0xbf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0xbf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0xbf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x30,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf9,
-    0x0, 0xbf, 0xa8, 0x88, 0x88, 0x89, 0xad, 0xff,
-    0x80, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x10, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x2, 0x5b, 0xf7, 0x0, 0xbf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0xbf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0xbf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0xbf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xe0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xff, 0x60, 0xbf, 0xba, 0xaa, 0xaa, 0xaa,
-    0xbd, 0xff, 0xf6, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+0433 "г" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b,
-    0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc7, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x6f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x2, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x1c, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x6b, 0xff, 0xeb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xeb, 0xba,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xfe, 0xcc,
-    0xdf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x93, 0x0, 0x0, 0x16, 0xdf, 0xe2, 0x0, 0x0,
-    0x6, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xe1, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0xaf, 0x62, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xdf, 0x1c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xcf, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x10, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x5, 0xff,
-    0xd6, 0x10, 0x0, 0x2, 0x7e, 0xfc, 0x10, 0x0,
-    0x0, 0x2, 0xbf, 0xff, 0xed, 0xde, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0,
-
-    /* U+0436 "ж" */
-    0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe1, 0x0,
-    0x0, 0x1, 0xef, 0x30, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x1, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xcb, 0xbb, 0xbf,
-    0xfc, 0xbb, 0xbb, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0xa, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0x0,
-    0x0, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x50,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-
-    /* U+0437 "з" */
-    0x0, 0x1, 0x7b, 0xdf, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x3, 0xbf, 0xff, 0xed, 0xcd, 0xff, 0xff,
-    0x70, 0x0, 0x9, 0xfb, 0x51, 0x0, 0x0, 0x3,
-    0x9f, 0xfa, 0x0, 0x2, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0xaf, 0xd2,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x88, 0x88, 0x9c,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x6d, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0x80, 0x6f, 0xfc, 0x51, 0x0, 0x0, 0x2,
-    0x8f, 0xfa, 0x0, 0x2, 0xaf, 0xff, 0xec, 0xbc,
-    0xef, 0xfe, 0x60, 0x0, 0x0, 0x1, 0x6a, 0xdf,
-    0xff, 0xda, 0x50, 0x0, 0x0,
-
-    /* U+0438 "и" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xff, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0xff, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x1f, 0xfb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x10,
-    0xff, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0xf, 0xfb, 0xf5, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x40, 0x0, 0xff, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0xf, 0xfb, 0xf5, 0x0,
-    0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0xff, 0xbf,
-    0x50, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0xf,
-    0xfb, 0xf5, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0,
-    0x0, 0xff, 0xbf, 0x50, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0xf, 0xfb, 0xf5, 0x0, 0x1e, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xbf, 0x50, 0xc,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0xf5,
-    0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xbf, 0x58, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfb, 0xfa, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xbf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfb, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-
-    /* U+0439 "й" */
-    0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0x5, 0xf3,
-    0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x83, 0x12, 0x7f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x43, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfa, 0xff, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x1f, 0xfb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x10, 0xff, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0xf, 0xfb, 0xf5,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0, 0xff,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0xf, 0xfb, 0xf5, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x0, 0x0, 0xff, 0xbf, 0x50, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0x0, 0xf, 0xfb, 0xf5, 0x0, 0x0,
-    0x5f, 0xe1, 0x0, 0x0, 0x0, 0xff, 0xbf, 0x50,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xfb,
-    0xf5, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xbf, 0x50, 0xc, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0xf5, 0xa, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xbf, 0x58, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0xfa, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xbf,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0,
-
-    /* U+043A "к" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe2, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf3, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf5, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x8, 0xfa, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x3, 0xfd, 0x10,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x2, 0xee,
-    0x20, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x1,
-    0xdf, 0x30, 0x0, 0x0, 0x0, 0xb, 0xfd, 0xbb,
-    0xbb, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x8f, 0xd1, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x1, 0xef, 0x60,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x20, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfd, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x1f, 0xfc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xce, 0xfa, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0,
-    0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x1c, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa9,
-    0xdf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x9f, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0,
-
-    /* U+043C "м" */
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0xbf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0,
-    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf0, 0xbf, 0xdf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0xf0,
-    0xbf, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x6c, 0xf0, 0xbf, 0x27, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0xc, 0xf0,
-    0xbf, 0x20, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf3, 0xc, 0xf0, 0xbf, 0x20, 0x4f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0xc, 0xf0,
-    0xbf, 0x20, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0xc, 0xf0, 0xbf, 0x20, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0xc, 0xf0,
-    0xbf, 0x20, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0xc, 0xf0, 0xbf, 0x20, 0x0, 0xd,
-    0xf2, 0x0, 0x0, 0xaf, 0x30, 0x0, 0xc, 0xf0,
-    0xbf, 0x20, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xf9,
-    0x0, 0x0, 0xc, 0xf0, 0xbf, 0x20, 0x0, 0x0,
-    0xaf, 0x40, 0xd, 0xe1, 0x0, 0x0, 0xc, 0xf0,
-    0xbf, 0x20, 0x0, 0x0, 0x2f, 0xd0, 0x7f, 0x60,
-    0x0, 0x0, 0xc, 0xf0, 0xbf, 0x20, 0x0, 0x0,
-    0x7, 0xf9, 0xfc, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0xdf, 0xf3, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0xbf, 0x20, 0x0, 0x0,
-    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x4, 0x10, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0xbf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0,
-
-    /* U+043D "н" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x7b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x7b, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x7b,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x7b, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf7, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x7b, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7b, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xce, 0xf7, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x7b, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf7, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x7b, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x7b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x7b, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x0, 0x39, 0xcf, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xfd,
-    0xcd, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xc5, 0x0, 0x0, 0x3, 0xaf, 0xf9, 0x0,
-    0x0, 0x0, 0x4f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0x90, 0x0, 0x1, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0xa,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0xcf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0xa, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0,
-    0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf5, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0x90, 0x0, 0x0, 0x5,
-    0xff, 0xc5, 0x0, 0x0, 0x3, 0xaf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xfd, 0xcd, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39,
-    0xcf, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x9b, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xce, 0xf9, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x9b, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9b,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x9b, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x9b, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x9b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x9b, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9b, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x9b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x9b, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
-
-    /* U+0440 "р" */
-    0xaf, 0x40, 0x0, 0x17, 0xbe, 0xff, 0xeb, 0x60,
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0x7, 0xff, 0xfe,
-    0xcd, 0xff, 0xfe, 0x60, 0x0, 0x0, 0xaf, 0x40,
-    0xbf, 0xd6, 0x10, 0x0, 0x3, 0xaf, 0xfb, 0x0,
-    0x0, 0xaf, 0x4b, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xb0, 0x0, 0xaf, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf7, 0x0, 0xaf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0xaf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf2, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0xaf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0xaf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0xaf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10,
-    0xaf, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf7, 0x0, 0xaf, 0x5b, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xb0, 0x0, 0xaf, 0x50,
-    0xbf, 0xd6, 0x10, 0x0, 0x3, 0x9f, 0xfb, 0x0,
-    0x0, 0xaf, 0x50, 0x8, 0xff, 0xfe, 0xcd, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x17,
-    0xbe, 0xff, 0xeb, 0x60, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xec, 0xdf,
-    0xff, 0xe6, 0x0, 0x0, 0x5, 0xff, 0xd6, 0x10,
-    0x0, 0x3, 0x9f, 0xf9, 0x0, 0x5, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xf6, 0x2, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x10,
-    0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0x10, 0x5, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xf6, 0x0, 0x5, 0xff, 0xd5, 0x10,
-    0x0, 0x3, 0x9f, 0xf9, 0x0, 0x0, 0x2, 0xbf,
-    0xff, 0xec, 0xdf, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xce, 0xff, 0xda, 0x60, 0x0, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xc, 0xcc, 0xcc, 0xcc, 0xcf, 0xfd,
-    0xcc, 0xcc, 0xcc, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x40, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x9f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0xb, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x68, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfd, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x20, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x7, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfc, 0xcf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0xd8, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbd, 0xff,
-    0xff, 0xed, 0xa7, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xfd, 0xff, 0xee, 0xff,
-    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0xa5, 0x10, 0xa, 0xf5, 0x0, 0x37, 0xcf, 0xfb,
-    0x10, 0x0, 0x0, 0x4f, 0xfb, 0x20, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x0, 0x4d, 0xfd, 0x10, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x0, 0x0, 0xb, 0xfc, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x3b, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf6, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x8d, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x8b, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0x22, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0xb, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x1d,
-    0xf6, 0x0, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x0, 0x0,
-    0x4f, 0xfb, 0x20, 0x0, 0x0, 0xaf, 0x50, 0x0,
-    0x0, 0x4d, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff,
-    0xb5, 0x20, 0xa, 0xf5, 0x0, 0x37, 0xdf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xef, 0xff, 0xfd,
-    0xff, 0xee, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x48, 0xbd, 0xff, 0xff, 0xec,
-    0xa6, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0445 "х" */
-    0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xc0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x10, 0x0, 0xc, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x2,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x80, 0x1, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf4, 0xc, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xaf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x2f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x5,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x20, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf4, 0x0, 0x0, 0xc, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x1, 0xef,
-    0x40, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe1, 0x0, 0x0, 0x4f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x2, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0xc, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf6,
-
-    /* U+0446 "ц" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x20, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x20, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x20, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0xbf, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xff, 0xcc, 0xc7, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa,
-
-    /* U+0447 "ч" */
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xf5, 0x6, 0xff, 0xc6, 0x20, 0x1,
-    0x36, 0xae, 0xff, 0xf5, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4b, 0xf5, 0x0, 0x0, 0x37,
-    0x9a, 0xa9, 0x73, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5,
-
-    /* U+0448 "ш" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x6b, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x6b, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf6, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x6b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x6b, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf6, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x6b, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x6b,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x6b, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf6, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x6b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x6b, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x6b, 0xfd, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xef, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xce, 0xf6, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60,
-
-    /* U+0449 "щ" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0xbf, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xfd,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xef, 0xdc, 0xc8,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x85,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xcc, 0xcc, 0xcd,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x88, 0x88, 0x88, 0x87, 0x41, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x0, 0x2, 0x6d, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x99, 0x99, 0x99, 0xac, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xa6, 0x0, 0x0,
-
-    /* U+044B "ы" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x5b, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x5b, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x5b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x5b, 0xfa, 0x88, 0x88, 0x88, 0x76, 0x30, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0xaf, 0x5b,
-    0xf5, 0x0, 0x0, 0x0, 0x13, 0x8e, 0xfc, 0x0,
-    0x0, 0xa, 0xf5, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xfa, 0x0, 0x0, 0xaf, 0x5b, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0xa, 0xf5, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0xaf, 0x5b, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0xa,
-    0xf5, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0xaf, 0x5b, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0xa, 0xf5,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0xaf, 0x5b, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0xa, 0xf5, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xe2, 0x0,
-    0x0, 0xaf, 0x5b, 0xfb, 0x99, 0x99, 0x99, 0xad,
-    0xff, 0xc2, 0x0, 0x0, 0xa, 0xf5, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xd9, 0x40, 0x0, 0x0, 0x0,
-    0xaf, 0x50,
-
-    /* U+044C "ь" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x88, 0x88, 0x88,
-    0x76, 0x30, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x13, 0x7e, 0xfd, 0x10, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfb, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf3, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x7b, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xab,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x4b, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xd0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x1, 0x9f,
-    0xf3, 0xb, 0xfb, 0x99, 0x99, 0x99, 0xad, 0xff,
-    0xd3, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xda,
-    0x50, 0x0, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x0, 0x6a, 0xdf, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xdb, 0xbb, 0xdf,
-    0xff, 0x70, 0x0, 0x0, 0x2d, 0xfd, 0x61, 0x0,
-    0x0, 0x1, 0x7e, 0xfc, 0x10, 0x0, 0x2e, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x9b, 0xf8, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfb, 0x0, 0x2e, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xd1, 0x0, 0x2d, 0xfd, 0x61, 0x0,
-    0x0, 0x2, 0x7e, 0xfc, 0x10, 0x0, 0x0, 0x8f,
-    0xff, 0xec, 0xbc, 0xef, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x6a, 0xdf, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0,
-
-    /* U+044E "ю" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c,
-    0xef, 0xfd, 0xa6, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xec, 0xdf,
-    0xff, 0xe5, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x2d, 0xfe, 0x71, 0x0, 0x0, 0x39, 0xff,
-    0x90, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x1, 0xef,
-    0xa1, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf9, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x50, 0xbf, 0x50,
-    0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0xbf, 0x50, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0xbf, 0x50, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0xbf, 0x50, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xbf, 0xed,
-    0xdd, 0xde, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xbf, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xbf, 0x50, 0x0, 0x5, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xbf, 0x50, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xbf, 0x50,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0xbf, 0x50, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0xbf, 0x50, 0x0, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0xbf, 0x50, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0x50, 0xbf, 0x50,
-    0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xf9, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x2e, 0xfe, 0x61, 0x0, 0x0, 0x29, 0xff,
-    0x90, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xdc, 0xce, 0xff, 0xe5, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c,
-    0xef, 0xfd, 0xa6, 0x0, 0x0, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x9, 0xff, 0xfe, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xfb, 0x0, 0xcf, 0xe6, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0xfb, 0x8, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfb, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0x3f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfb, 0x1, 0xdf, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfb, 0x0, 0x1b, 0xff, 0xc9,
-    0x88, 0x88, 0x88, 0x89, 0xfb, 0x0, 0x0, 0x3a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0x0, 0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfb, 0x6, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfb, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xee, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x77,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xdf, 0xfe, 0xc8, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xfe, 0xcc, 0xdf, 0xff, 0xa1, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x93, 0x0, 0x0, 0x16,
-    0xdf, 0xe2, 0x0, 0x0, 0x6, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xe1, 0x0, 0x2, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x7, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0xaf, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0xdf, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xcf, 0x75, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x10, 0x0, 0x4,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x5, 0xff, 0xd6, 0x10, 0x0, 0x2,
-    0x7e, 0xfc, 0x10, 0x0, 0x0, 0x2, 0xbf, 0xff,
-    0xed, 0xde, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0xce, 0xff, 0xeb, 0x71, 0x0, 0x0,
-    0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0,
-    0xc, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xd9, 0x0, 0x0, 0x4d, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xec,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
-    0xec, 0xcd, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0xf9, 0x30, 0x0, 0x1, 0x6d, 0xfe, 0x20,
-    0x0, 0x0, 0x6f, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfe, 0x10, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xa0, 0x7f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0xa, 0xf6, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2d, 0xf1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x2c, 0xf7, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x50, 0xcf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x81, 0x0, 0x0, 0x4f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0,
-    0x5f, 0xfd, 0x61, 0x0, 0x0, 0x27, 0xef, 0xc1,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0xfe, 0xdd, 0xef,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c,
-    0xef, 0xfe, 0xb7, 0x10, 0x0, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0x5, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1, 0x88,
-    0x88, 0xdf, 0xa8, 0x88, 0x88, 0x88, 0x88, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x49, 0xdf,
-    0xff, 0xd9, 0x30, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf4, 0x2, 0xcf, 0xff, 0xdc, 0xef, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x43, 0xff, 0x93,
-    0x0, 0x0, 0x16, 0xef, 0xd1, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0xed, 0x20, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xa0, 0x0, 0x0, 0x0, 0xbf, 0xee, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
-    0x0, 0xb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0xbf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x70, 0x0, 0x5,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfc, 0xbe, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xff,
-    0xeb, 0x40, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xee, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9b, 0xfd, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc7, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xfd, 0xbb,
-    0xcf, 0xff, 0xd5, 0x0, 0x0, 0x4, 0xef, 0xd6,
-    0x10, 0x0, 0x0, 0x28, 0xff, 0xa0, 0x0, 0x4f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xc0,
-    0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xdf, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x97, 0x0, 0x0, 0x0,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xb0, 0x0, 0x4, 0xef, 0xc5,
-    0x0, 0x0, 0x0, 0x27, 0xef, 0xa0, 0x0, 0x0,
-    0x1a, 0xff, 0xfc, 0xbb, 0xce, 0xff, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x27, 0xce, 0xff, 0xec, 0x94,
-    0x0, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x0, 0x49, 0xdf, 0xff, 0xeb, 0x72, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xdc, 0xce, 0xff, 0xfc,
-    0x30, 0x1, 0xef, 0xb3, 0x0, 0x0, 0x1, 0x5b,
-    0xfa, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x10, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfd,
-    0x95, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7c,
-    0xff, 0xff, 0xfc, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x37, 0xad, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7e, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x86, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf3, 0xaf, 0xfc, 0x61, 0x0, 0x0, 0x1, 0x6e,
-    0xf9, 0x0, 0x5d, 0xff, 0xfe, 0xcc, 0xce, 0xff,
-    0xf7, 0x0, 0x0, 0x3, 0x8b, 0xef, 0xff, 0xdb,
-    0x61, 0x0, 0x0,
-
-    /* U+0456 "і" */
-    0x1, 0x30, 0x1e, 0xfa, 0x4f, 0xfe, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5,
-    0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5,
-    0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5,
-    0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5,
-    0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5, 0xb, 0xf5,
-    0xb, 0xf5, 0xb, 0xf5,
-
-    /* U+0457 "ї" */
-    0x4e, 0xb0, 0x4, 0xfb, 0x9, 0xff, 0x20, 0xaf,
-    0xf1, 0x2c, 0x80, 0x3, 0xc8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x30, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0xcf, 0x30, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x19, 0x10, 0x0, 0x2d, 0xf8,
-    0x6, 0xff, 0xdb, 0xdf, 0xfb, 0x0, 0x5, 0xbe,
-    0xff, 0xc6, 0x0, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xce, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfe, 0x88, 0x88, 0x88,
-    0x87, 0x41, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x2, 0x5b, 0xff, 0x50, 0x0,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0xee, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x1f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0x0, 0x1c, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xaf, 0xf8, 0x9, 0xdf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xdd,
-    0xdd, 0xdd, 0xef, 0xff, 0xf7, 0x0, 0x9f, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xeb, 0x71, 0x0, 0x0,
-
-    /* U+045A "њ" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xb7, 0x10, 0x0, 0xbf, 0xdc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc,
-    0xcc, 0xcd, 0xff, 0xfe, 0x40, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0x30, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x3b,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0xe1, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf9, 0x99, 0x99, 0x99, 0xac, 0xff,
-    0xc1, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd9,
-    0x40, 0x0, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0x0, 0x58, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x11, 0x11, 0xbf, 0x51, 0x11, 0x11, 0x11, 0x11,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x4, 0x44, 0x44, 0xcf, 0x74, 0x44, 0x44,
-    0x44, 0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x49, 0xdf, 0xff, 0xd9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x2c,
-    0xff, 0xfd, 0xce, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x53, 0xff, 0x93, 0x0, 0x0,
-    0x16, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x6e, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xee, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xee, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe2, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x8,
-    0xfa, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x5, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x3, 0xfd, 0x10, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x2, 0xee, 0x20, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x1, 0xdf, 0x30, 0x0, 0x0,
-    0x0, 0xb, 0xfd, 0xbb, 0xbb, 0xdf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x8f, 0xd1, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x60, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x20,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfb, 0x0,
-
-    /* U+045D "ѝ" */
-    0x0, 0x2, 0xdf, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfa, 0xff, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x1f, 0xfb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x10, 0xff, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0xf, 0xfb, 0xf5,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0, 0xff,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0xf, 0xfb, 0xf5, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x0, 0x0, 0xff, 0xbf, 0x50, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0x0, 0xf, 0xfb, 0xf5, 0x0, 0x0,
-    0x5f, 0xe1, 0x0, 0x0, 0x0, 0xff, 0xbf, 0x50,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xfb,
-    0xf5, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xbf, 0x50, 0xc, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0xf5, 0xa, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xbf, 0x58, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0xfa, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xbf,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x5, 0xf2, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x70,
-    0x0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x20, 0x0, 0x0, 0x6f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xee, 0x62,
-    0x13, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x42,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x6, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0x0, 0x0, 0x4f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0,
-    0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x10, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x68, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfd, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x7, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfc, 0xcf, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8d,
-    0xff, 0xd8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+045F "џ" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0xbf, 0xdc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd4,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf6, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0xbf, 0xdc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xc5, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-
-    /* U+2014 "—" */
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55,
-
-    /* U+2018 "‘" */
-    0x0, 0xe8, 0x3, 0xf4, 0x7, 0xf1, 0xc, 0xd0,
-    0x1f, 0xa0, 0x5f, 0x90, 0x9f, 0xf6, 0xaf, 0xf9,
-    0x3e, 0xe3,
-
-    /* U+2019 "’" */
-    0x3e, 0xe3, 0xaf, 0xfa, 0x7f, 0xf9, 0x9, 0xf4,
-    0xa, 0xf0, 0xe, 0xb0, 0x2f, 0x70, 0x5f, 0x20,
-    0x8c, 0x0,
-
-    /* U+201A "‚" */
-    0x4, 0x40, 0x7f, 0xf7, 0xaf, 0xfa, 0x3e, 0xf7,
-    0x8, 0xf3, 0xc, 0xe0, 0xf, 0xa0, 0x3f, 0x50,
-    0x7f, 0x10, 0x56, 0x0,
-
-    /* U+201C "“" */
-    0x0, 0xe8, 0x0, 0x0, 0xca, 0x3, 0xf4, 0x0,
-    0x1, 0xf6, 0x7, 0xf1, 0x0, 0x5, 0xf3, 0xc,
-    0xd0, 0x0, 0xa, 0xf0, 0x1f, 0xa0, 0x0, 0xe,
-    0xc0, 0x5f, 0x90, 0x0, 0x3f, 0xa0, 0x9f, 0xf6,
-    0x0, 0x7f, 0xf8, 0xaf, 0xf9, 0x0, 0x8f, 0xfb,
-    0x3e, 0xe3, 0x0, 0x2d, 0xe4,
-
-    /* U+201D "”" */
-    0x3e, 0xe3, 0x0, 0x2d, 0xf4, 0xaf, 0xfa, 0x0,
-    0x8f, 0xfc, 0x7f, 0xf9, 0x0, 0x5f, 0xfb, 0x9,
-    0xf4, 0x0, 0x6, 0xf6, 0xa, 0xf0, 0x0, 0x8,
-    0xf2, 0xe, 0xb0, 0x0, 0xc, 0xd0, 0x2f, 0x70,
-    0x0, 0xf, 0x90, 0x5f, 0x20, 0x0, 0x3f, 0x40,
-    0x8c, 0x0, 0x0, 0x6d, 0x0,
-
-    /* U+2026 "…" */
-    0x4, 0x40, 0x0, 0x0, 0x3, 0x50, 0x0, 0x0,
-    0x2, 0x51, 0x7, 0xff, 0x70, 0x0, 0x4, 0xff,
-    0xa0, 0x0, 0x1, 0xff, 0xd0, 0xaf, 0xfa, 0x0,
-    0x0, 0x7f, 0xfd, 0x0, 0x0, 0x3f, 0xff, 0x3,
-    0xee, 0x30, 0x0, 0x1, 0xcf, 0x50, 0x0, 0x0,
-    0xaf, 0x80,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xff, 0xdb,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f,
-    0xff, 0xfe, 0xdd, 0xdf, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xd8, 0x30, 0x0, 0x0,
-    0x2, 0x7e, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x8,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0,
-    0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x15, 0xff, 0x71, 0x10, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa3, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa3, 0x44, 0xcf, 0xf6,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x42, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xc4, 0x0, 0x0, 0x4, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70,
-    0x0, 0x0, 0x6, 0xff, 0xc6, 0x10, 0x0, 0x0,
-    0x14, 0x9f, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xcf, 0xff, 0xfd, 0xcd, 0xef, 0xff, 0xe8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff,
-    0xfe, 0xc8, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x21, 0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xff, 0xfa,
-    0x20, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x2, 0xdf, 0x94, 0x23, 0x6d, 0xf6, 0x0, 0x2f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0xd, 0xe2, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x2f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0x0, 0xc,
-    0xe0, 0x2f, 0xe6, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf3, 0x2f, 0xe0,
-    0xaf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0x2f, 0xe0, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf6,
-    0x2f, 0xe0, 0x1, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0xea, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf4, 0x2f, 0xe0, 0x0,
-    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x0,
-    0xa, 0xf0, 0x2f, 0xe0, 0x0, 0x7, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x2f, 0xb0, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x2f,
-    0xe0, 0x0, 0x0, 0xaf, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x5, 0xfc, 0x40,
-    0x0, 0x29, 0xfb, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xee, 0xfe, 0x70,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x2, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x26, 0x77, 0x40, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x20, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x3d, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0x80, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x70, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x60, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x10, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xc0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfa,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x62, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 164, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 161, .box_w = 4, .box_h = 28, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 56, .adv_w = 228, .box_w = 10, .box_h = 11, .ofs_x = 2, .ofs_y = 17},
-    {.bitmap_index = 111, .adv_w = 442, .box_w = 26, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 475, .adv_w = 390, .box_w = 21, .box_h = 38, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 874, .adv_w = 523, .box_w = 30, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1294, .adv_w = 419, .box_w = 24, .box_h = 29, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 1642, .adv_w = 124, .box_w = 3, .box_h = 11, .ofs_x = 2, .ofs_y = 17},
-    {.bitmap_index = 1659, .adv_w = 205, .box_w = 7, .box_h = 37, .ofs_x = 4, .ofs_y = -8},
-    {.bitmap_index = 1789, .adv_w = 206, .box_w = 8, .box_h = 37, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 1937, .adv_w = 240, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 14},
-    {.bitmap_index = 2050, .adv_w = 364, .box_w = 18, .box_h = 17, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 2203, .adv_w = 128, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 2223, .adv_w = 244, .box_w = 11, .box_h = 2, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 2234, .adv_w = 128, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2242, .adv_w = 205, .box_w = 16, .box_h = 38, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 2546, .adv_w = 421, .box_w = 23, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2868, .adv_w = 226, .box_w = 10, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3008, .adv_w = 360, .box_w = 21, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3302, .adv_w = 357, .box_w = 21, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3596, .adv_w = 419, .box_w = 25, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3946, .adv_w = 357, .box_w = 20, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4226, .adv_w = 385, .box_w = 21, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4520, .adv_w = 372, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4814, .adv_w = 404, .box_w = 22, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5122, .adv_w = 385, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5416, .adv_w = 128, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5458, .adv_w = 128, .box_w = 4, .box_h = 27, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 5512, .adv_w = 364, .box_w = 18, .box_h = 16, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 5656, .adv_w = 364, .box_w = 18, .box_h = 11, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 5755, .adv_w = 364, .box_w = 18, .box_h = 16, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 5899, .adv_w = 360, .box_w = 20, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6179, .adv_w = 661, .box_w = 38, .box_h = 36, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 6863, .adv_w = 451, .box_w = 28, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7255, .adv_w = 481, .box_w = 24, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7591, .adv_w = 452, .box_w = 25, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7941, .adv_w = 529, .box_w = 27, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8319, .adv_w = 428, .box_w = 21, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8613, .adv_w = 404, .box_w = 20, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8893, .adv_w = 495, .box_w = 25, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9243, .adv_w = 521, .box_w = 24, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 9579, .adv_w = 189, .box_w = 3, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 9621, .adv_w = 314, .box_w = 16, .box_h = 28, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 9845, .adv_w = 450, .box_w = 24, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 10181, .adv_w = 374, .box_w = 20, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 10461, .adv_w = 612, .box_w = 30, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 10881, .adv_w = 521, .box_w = 24, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 11217, .adv_w = 536, .box_w = 30, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11637, .adv_w = 458, .box_w = 23, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 11959, .adv_w = 536, .box_w = 31, .box_h = 33, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 12471, .adv_w = 461, .box_w = 23, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 12793, .adv_w = 390, .box_w = 21, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13087, .adv_w = 360, .box_w = 23, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13409, .adv_w = 508, .box_w = 24, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 13745, .adv_w = 440, .box_w = 28, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14137, .adv_w = 703, .box_w = 42, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14725, .adv_w = 411, .box_w = 25, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15075, .adv_w = 400, .box_w = 25, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15425, .adv_w = 413, .box_w = 24, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15761, .adv_w = 196, .box_w = 8, .box_h = 37, .ofs_x = 4, .ofs_y = -8},
-    {.bitmap_index = 15909, .adv_w = 205, .box_w = 16, .box_h = 38, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 16213, .adv_w = 196, .box_w = 8, .box_h = 37, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 16361, .adv_w = 365, .box_w = 17, .box_h = 17, .ofs_x = 3, .ofs_y = 6},
-    {.bitmap_index = 16506, .adv_w = 320, .box_w = 20, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 16536, .adv_w = 384, .box_w = 10, .box_h = 5, .ofs_x = 5, .ofs_y = 24},
-    {.bitmap_index = 16561, .adv_w = 373, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16750, .adv_w = 432, .box_w = 22, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17069, .adv_w = 355, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17279, .adv_w = 432, .box_w = 22, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17598, .adv_w = 382, .box_w = 21, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17819, .adv_w = 210, .box_w = 15, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18037, .adv_w = 436, .box_w = 23, .box_h = 29, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 18371, .adv_w = 431, .box_w = 19, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18647, .adv_w = 167, .box_w = 4, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18705, .adv_w = 170, .box_w = 12, .box_h = 37, .ofs_x = -4, .ofs_y = -8},
-    {.bitmap_index = 18927, .adv_w = 373, .box_w = 20, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 19217, .adv_w = 167, .box_w = 3, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 19261, .adv_w = 681, .box_w = 35, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 19629, .adv_w = 431, .box_w = 19, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 19829, .adv_w = 397, .box_w = 22, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20060, .adv_w = 432, .box_w = 22, .box_h = 29, .ofs_x = 4, .ofs_y = -8},
-    {.bitmap_index = 20379, .adv_w = 432, .box_w = 22, .box_h = 29, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 20698, .adv_w = 252, .box_w = 11, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20814, .adv_w = 306, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20993, .adv_w = 255, .box_w = 15, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21188, .adv_w = 428, .box_w = 19, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 21388, .adv_w = 338, .box_w = 21, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21609, .adv_w = 552, .box_w = 35, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21977, .adv_w = 332, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22187, .adv_w = 338, .box_w = 23, .box_h = 29, .ofs_x = -2, .ofs_y = -8},
-    {.bitmap_index = 22521, .adv_w = 322, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22710, .adv_w = 205, .box_w = 10, .box_h = 37, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 22895, .adv_w = 186, .box_w = 3, .box_h = 37, .ofs_x = 4, .ofs_y = -8},
-    {.bitmap_index = 22951, .adv_w = 205, .box_w = 11, .box_h = 37, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 23155, .adv_w = 364, .box_w = 19, .box_h = 6, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 23212, .adv_w = 291, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 23325, .adv_w = 291, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 23445, .adv_w = 418, .box_w = 20, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 23795, .adv_w = 418, .box_w = 20, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 24135, .adv_w = 524, .box_w = 31, .box_h = 29, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 24585, .adv_w = 364, .box_w = 18, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 24900, .adv_w = 452, .box_w = 25, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 25250, .adv_w = 397, .box_w = 21, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 25544, .adv_w = 194, .box_w = 3, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 25586, .adv_w = 189, .box_w = 10, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25756, .adv_w = 330, .box_w = 16, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25980, .adv_w = 759, .box_w = 46, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26624, .adv_w = 760, .box_w = 41, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 27198, .adv_w = 529, .box_w = 31, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 27632, .adv_w = 445, .box_w = 22, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 28017, .adv_w = 528, .box_w = 23, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 28420, .adv_w = 429, .box_w = 27, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28893, .adv_w = 515, .box_w = 23, .box_h = 35, .ofs_x = 5, .ofs_y = -7},
-    {.bitmap_index = 29296, .adv_w = 469, .box_w = 29, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29702, .adv_w = 463, .box_w = 22, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 30010, .adv_w = 480, .box_w = 23, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 30332, .adv_w = 364, .box_w = 18, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 30584, .adv_w = 503, .box_w = 30, .box_h = 35, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 31109, .adv_w = 418, .box_w = 20, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 31389, .adv_w = 637, .box_w = 38, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 31921, .adv_w = 392, .box_w = 23, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 32243, .adv_w = 528, .box_w = 23, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 32565, .adv_w = 528, .box_w = 23, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 32968, .adv_w = 445, .box_w = 22, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 33276, .adv_w = 500, .box_w = 27, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 33654, .adv_w = 617, .box_w = 29, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 34060, .adv_w = 526, .box_w = 23, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 34382, .adv_w = 546, .box_w = 30, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 34802, .adv_w = 530, .box_w = 24, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 35138, .adv_w = 452, .box_w = 22, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 35446, .adv_w = 457, .box_w = 25, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 35796, .adv_w = 368, .box_w = 23, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36118, .adv_w = 429, .box_w = 27, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36496, .adv_w = 582, .box_w = 33, .box_h = 30, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 36991, .adv_w = 406, .box_w = 24, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37327, .adv_w = 527, .box_w = 27, .box_h = 35, .ofs_x = 5, .ofs_y = -7},
-    {.bitmap_index = 37800, .adv_w = 456, .box_w = 22, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 38108, .adv_w = 700, .box_w = 34, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 38584, .adv_w = 713, .box_w = 39, .box_h = 35, .ofs_x = 5, .ofs_y = -7},
-    {.bitmap_index = 39267, .adv_w = 521, .box_w = 31, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 39701, .adv_w = 618, .box_w = 29, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 40107, .adv_w = 453, .box_w = 22, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 40415, .adv_w = 451, .box_w = 25, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40765, .adv_w = 696, .box_w = 36, .box_h = 28, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 41269, .adv_w = 468, .box_w = 23, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 41591, .adv_w = 369, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 41780, .adv_w = 420, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 42121, .adv_w = 385, .box_w = 18, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 42310, .adv_w = 297, .box_w = 15, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 42468, .adv_w = 409, .box_w = 24, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 42780, .adv_w = 390, .box_w = 21, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43001, .adv_w = 516, .box_w = 32, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 43337, .adv_w = 337, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 43526, .adv_w = 436, .box_w = 19, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 43726, .adv_w = 436, .box_w = 19, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 44002, .adv_w = 364, .box_w = 19, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 44202, .adv_w = 399, .box_w = 21, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 44423, .adv_w = 502, .box_w = 24, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 44675, .adv_w = 429, .box_w = 19, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 44875, .adv_w = 404, .box_w = 22, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 45106, .adv_w = 430, .box_w = 19, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 45306, .adv_w = 438, .box_w = 22, .box_h = 29, .ofs_x = 4, .ofs_y = -8},
-    {.bitmap_index = 45625, .adv_w = 356, .box_w = 19, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 45825, .adv_w = 292, .box_w = 20, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 46035, .adv_w = 349, .box_w = 23, .box_h = 29, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 46369, .adv_w = 492, .box_w = 27, .box_h = 38, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 46882, .adv_w = 328, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 47092, .adv_w = 435, .box_w = 22, .box_h = 26, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 47378, .adv_w = 378, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 47567, .adv_w = 588, .box_w = 29, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 47872, .adv_w = 588, .box_w = 32, .box_h = 26, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 48288, .adv_w = 387, .box_w = 24, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 48540, .adv_w = 490, .box_w = 23, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48782, .adv_w = 354, .box_w = 17, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48961, .adv_w = 364, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 49171, .adv_w = 548, .box_w = 28, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 49465, .adv_w = 385, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 49654, .adv_w = 397, .box_w = 21, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 49959, .adv_w = 390, .box_w = 21, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 50253, .adv_w = 427, .box_w = 25, .box_h = 38, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 50728, .adv_w = 297, .box_w = 15, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 50946, .adv_w = 364, .box_w = 20, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 51156, .adv_w = 333, .box_w = 17, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 51335, .adv_w = 170, .box_w = 4, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 51395, .adv_w = 167, .box_w = 9, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 51521, .adv_w = 170, .box_w = 11, .box_h = 37, .ofs_x = -4, .ofs_y = -8},
-    {.bitmap_index = 51725, .adv_w = 583, .box_w = 35, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 52093, .adv_w = 600, .box_w = 33, .box_h = 21, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 52440, .adv_w = 427, .box_w = 26, .box_h = 30, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 52830, .adv_w = 364, .box_w = 19, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 53106, .adv_w = 436, .box_w = 19, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 53382, .adv_w = 349, .box_w = 23, .box_h = 37, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 53808, .adv_w = 406, .box_w = 18, .box_h = 26, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 54042, .adv_w = 365, .box_w = 18, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 54348, .adv_w = 278, .box_w = 14, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 54523, .adv_w = 320, .box_w = 20, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 54553, .adv_w = 640, .box_w = 40, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 54613, .adv_w = 128, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = 20},
-    {.bitmap_index = 54631, .adv_w = 128, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = 20},
-    {.bitmap_index = 54649, .adv_w = 128, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 54669, .adv_w = 226, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 20},
-    {.bitmap_index = 54714, .adv_w = 226, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 20},
-    {.bitmap_index = 54759, .adv_w = 390, .box_w = 21, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 54801, .adv_w = 529, .box_w = 25, .box_h = 28, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 55151, .adv_w = 765, .box_w = 42, .box_h = 29, .ofs_x = 4, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_40;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_40 = {
-#else
-lv_font_t montserrat_cyrillic_40 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 43,          /*The maximum line height required by the font*/
-    .base_line = 8,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -4,
-    .underline_thickness = 2,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_40,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_40*/
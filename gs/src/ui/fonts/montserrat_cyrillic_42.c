@@ -1,8458 +0,0 @@
-/*******************************************************************************
- * Size: 42 px
- * Bpp: 4
- * Opts: --bpp 4 --size 42 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_42.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_42
-#define MONTSERRAT_CYRILLIC_42 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_42
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xe, 0xf8, 0x0, 0xef, 0x70, 0xd, 0xf7, 0x0,
-    0xdf, 0x70, 0xd, 0xf6, 0x0, 0xcf, 0x60, 0xc,
-    0xf6, 0x0, 0xcf, 0x50, 0xb, 0xf5, 0x0, 0xbf,
-    0x50, 0xb, 0xf4, 0x0, 0xaf, 0x40, 0xa, 0xf4,
-    0x0, 0xaf, 0x30, 0x9, 0xf3, 0x0, 0x9f, 0x30,
-    0x9, 0xf2, 0x0, 0x9f, 0x20, 0x8, 0xf2, 0x0,
-    0x8f, 0x10, 0x4, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
-    0x10, 0x3f, 0xfd, 0x6, 0xff, 0xf0, 0xc, 0xf7,
-    0x0,
-
-    /* U+0022 "\"" */
-    0xef, 0x0, 0x0, 0x1f, 0xdd, 0xf0, 0x0, 0x1,
-    0xfd, 0xdf, 0x0, 0x0, 0xf, 0xcd, 0xf0, 0x0,
-    0x0, 0xfc, 0xdf, 0x0, 0x0, 0xf, 0xcc, 0xf0,
-    0x0, 0x0, 0xfc, 0xcf, 0x0, 0x0, 0xf, 0xbc,
-    0xe0, 0x0, 0x0, 0xfb, 0xce, 0x0, 0x0, 0xf,
-    0xbb, 0xe0, 0x0, 0x0, 0xfb, 0x9b, 0x0, 0x0,
-    0xb, 0x80,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0xa,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xfa, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x3a, 0xaa, 0xaa, 0xcf, 0xda, 0xaa,
-    0xaa, 0xaa, 0xac, 0xfc, 0xaa, 0xaa, 0xa6, 0x0,
-    0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x40, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x0, 0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x7a, 0xaa,
-    0xaa, 0xef, 0xba, 0xaa, 0xaa, 0xaa, 0xae, 0xfa,
-    0xaa, 0xaa, 0xa3, 0x0, 0x0, 0x0, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x65, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff,
-    0xfd, 0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xfd, 0x60, 0x0,
-    0x0, 0xb, 0xff, 0xc6, 0x20, 0xdb, 0x0, 0x37,
-    0xdf, 0xfd, 0x10, 0x0, 0xbf, 0xe4, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x3, 0xbc, 0x0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x20, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xe5, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0xc6, 0x10, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xfd, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49,
-    0xef, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xee, 0xdf, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x2, 0x7c, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x4d, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x2,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x2f, 0xf1, 0x7f, 0x50, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0x6f, 0xfb, 0x30,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x1b, 0xff, 0x20,
-    0x4, 0xef, 0xfd, 0x73, 0x0, 0xdb, 0x1, 0x49,
-    0xff, 0xe3, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0x7b, 0xdf, 0xff, 0xfd, 0xa6, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x5b, 0xef, 0xea, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0xa, 0xfa, 0x54, 0x6c, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0,
-    0xa, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x10, 0x0, 0x0, 0x0,
-    0xe, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x0,
-    0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0,
-    0x1, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x20, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xf8, 0x32, 0x39, 0xfb, 0x0, 0x1,
-    0xfb, 0x0, 0x1, 0x9e, 0xff, 0xe8, 0x10, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xfe, 0x70, 0x0, 0xb,
-    0xf1, 0x0, 0x3e, 0xe8, 0x55, 0x9f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x34, 0x30, 0x0, 0x0, 0x6f,
-    0x50, 0x1, 0xed, 0x10, 0x0, 0x2, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xe1,
-    0x0, 0xf, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0,
-    0x0, 0x8f, 0x10, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x7f, 0x20, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xc0, 0x0, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0,
-    0x0, 0xf, 0x90, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xec, 0x10, 0x0, 0x2, 0xec, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xe7, 0x44, 0x8f, 0xd1, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x5, 0xbe, 0xff, 0xda, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xfc, 0xaa, 0xcf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x10, 0x0,
-    0x2, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x1e, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x1b, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x5,
-    0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xd3, 0xbf, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0xfd, 0x5c, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x1,
-    0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf4, 0x0, 0x0, 0x1d, 0xfa, 0x0,
-    0x0, 0x0, 0x6, 0x70, 0x0, 0x4, 0xfe, 0x20,
-    0x0, 0x0, 0x1, 0xef, 0x90, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf8, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x80,
-    0x0, 0x6f, 0x70, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0xdf, 0x20,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x64, 0xfb, 0x0, 0x0, 0xcf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe,
-    0xf3, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xa0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf4, 0x0, 0x0, 0xa, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xd7, 0xff,
-    0x40, 0x0, 0x0, 0xbf, 0xfa, 0x30, 0x0, 0x0,
-    0x4, 0xaf, 0xfb, 0x10, 0x6f, 0xf3, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xdc, 0xcd, 0xff, 0xfd, 0x50,
-    0x0, 0x7, 0xfe, 0x30, 0x0, 0x0, 0x5, 0xad,
-    0xff, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x20,
-
-    /* U+0027 "'" */
-    0xef, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xc,
-    0xf0, 0xcf, 0xc, 0xe0, 0xce, 0xb, 0xe0, 0x9b,
-    0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0xbf, 0x40, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x3f, 0xd0, 0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x3f, 0xd0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0xb, 0xf4, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0xc, 0xf3,
-
-    /* U+0029 ")" */
-    0xbf, 0x40, 0x0, 0x2, 0xfd, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0xdf,
-    0x30, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x1, 0xff, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0xcf, 0x40, 0x0, 0xa,
-    0xf7, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x4, 0xfd, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x5f,
-    0xb0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0xe, 0xf2, 0x0, 0x1, 0xff, 0x0, 0x0, 0x4f,
-    0xb0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0xcf, 0x30,
-    0x0, 0x1f, 0xe0, 0x0, 0x7, 0xf9, 0x0, 0x0,
-    0xdf, 0x30, 0x0, 0x3f, 0xc0, 0x0, 0xa, 0xf5,
-    0x0, 0x2, 0xfd, 0x0, 0x0, 0xbf, 0x40, 0x0,
-    0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0xd9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd9, 0x0, 0x0, 0x0, 0x78, 0x10, 0x0,
-    0xd9, 0x0, 0x2, 0xb4, 0x9f, 0xe6, 0x0, 0xd9,
-    0x0, 0x8f, 0xf5, 0x3, 0xbf, 0xd4, 0xd9, 0x6e,
-    0xf9, 0x10, 0x0, 0x4, 0xdf, 0xff, 0xfb, 0x20,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfe, 0xfe, 0x60, 0x0, 0x6,
-    0xef, 0x91, 0xd9, 0x2b, 0xfd, 0x40, 0xbf, 0xc2,
-    0x0, 0xd9, 0x0, 0x5d, 0xf7, 0x55, 0x0, 0x0,
-    0xd9, 0x0, 0x0, 0x72, 0x0, 0x0, 0x0, 0xd9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x0, 0x0,
-    0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x87, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc,
-    0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x87, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x5, 0x71, 0x5f, 0xfc, 0x8f, 0xff, 0x1d, 0xfc,
-    0x5, 0xf8, 0x8, 0xf3, 0xc, 0xe0, 0xf, 0xa0,
-    0x3f, 0x60, 0x7f, 0x10,
-
-    /* U+002D "-" */
-    0x5e, 0xee, 0xee, 0xee, 0xee, 0xe5, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xf6,
-
-    /* U+002E "." */
-    0x6, 0x81, 0x6f, 0xfc, 0x8f, 0xfe, 0x1d, 0xf6,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x85,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0x94, 0x10, 0x1, 0x5c,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xfb, 0x0, 0x0,
-    0x0, 0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0x90, 0x0, 0x0, 0x9f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfb, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x8f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0xaf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0xaf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x8f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfb, 0x0, 0x0, 0x9f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0x90, 0x0, 0x0, 0x2, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0x94, 0x0, 0x1, 0x5b,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xfe, 0xb6,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xaf, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7,
-    0xfb,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x1, 0x6a, 0xde, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xa5, 0x20, 0x0, 0x13, 0x8e, 0xff, 0x60,
-    0x0, 0x9, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xed, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0033 "3" */
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfd, 0xb9, 0x62, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xc4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x14, 0x8d, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x2f, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x40, 0x2e, 0xfe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x1, 0xbf,
-    0xfe, 0x95, 0x20, 0x0, 0x3, 0x7d, 0xff, 0xb0,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6a,
-    0xdf, 0xff, 0xed, 0x95, 0x0, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xd0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x2e, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee,
-    0xec, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xfd, 0xb9, 0x50, 0x0, 0x0,
-    0x0, 0xd, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x47, 0xcf, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf3, 0x7f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x8, 0xff,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0x20, 0x5, 0xef, 0xfc, 0x73, 0x10, 0x0, 0x14,
-    0x9f, 0xfe, 0x30, 0x0, 0x1, 0x8e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x4, 0x8c, 0xef, 0xff, 0xeb, 0x72, 0x0, 0x0,
-    0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff, 0xfe,
-    0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff,
-    0xff, 0xee, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x26, 0xc7,
-    0x0, 0x0, 0x1, 0xcf, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x59, 0xbd, 0xdc,
-    0xa6, 0x10, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x6e,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0xaf,
-    0x70, 0x1c, 0xfe, 0x84, 0x10, 0x2, 0x5a, 0xff,
-    0xe3, 0x0, 0xaf, 0x70, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xfe, 0x20, 0xaf, 0x88, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0,
-    0x9f, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf3, 0x8f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x6f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfd, 0xf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4,
-    0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xc0, 0x0, 0x6, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0x20, 0x0, 0x0,
-    0x6f, 0xfd, 0x61, 0x0, 0x0, 0x27, 0xef, 0xe3,
-    0x0, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xed, 0xdf,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x8c, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfa, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf3, 0x0, 0x47, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xfd, 0xb7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
-    0xfd, 0xde, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x38, 0xff,
-    0xe3, 0x0, 0x0, 0x9, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xf2, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x10, 0xc, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0,
-    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x1, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x6,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xd0, 0x0, 0x0, 0x5, 0xff, 0xd7, 0x31, 0x0,
-    0x2, 0x5a, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0x8e, 0xff, 0xfd, 0xcc, 0xce,
-    0xff, 0xfb, 0x40, 0x0, 0x0, 0x4, 0xef, 0xe7,
-    0x20, 0x0, 0x0, 0x1, 0x5a, 0xff, 0xa0, 0x0,
-    0x4, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xc0, 0x1, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x80, 0x7f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x6d, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf6, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x47, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x1e, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf8, 0x0,
-    0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xfc, 0x0, 0x0, 0x5f, 0xfe, 0x83, 0x0,
-    0x0, 0x0, 0x26, 0xcf, 0xfc, 0x10, 0x0, 0x0,
-    0x2a, 0xff, 0xff, 0xed, 0xdd, 0xff, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xde, 0xff,
-    0xfe, 0xb8, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xff, 0xd9, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfe,
-    0xde, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0x83, 0x0, 0x0, 0x4, 0xaf, 0xfa, 0x0,
-    0x0, 0x1, 0xdf, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xa0, 0x0, 0xa, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xf7, 0x0, 0x1f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x10, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf4, 0x8f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfa, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0xfd, 0x9, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xe4, 0xfe, 0x0,
-    0xdf, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0x33, 0xff, 0x0, 0x1d, 0xff, 0xb5, 0x20, 0x0,
-    0x26, 0xcf, 0xe4, 0x2, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x59, 0xbc, 0xdc, 0xa6, 0x10,
-    0x0, 0x4, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0x30, 0x0, 0x0, 0x4e,
-    0x84, 0x10, 0x0, 0x2, 0x5b, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xee, 0xff, 0xff,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xdf,
-    0xff, 0xec, 0x95, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x1d, 0xf6, 0x8f, 0xfe, 0x6f, 0xfc, 0x6, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x81, 0x6f, 0xfc,
-    0x8f, 0xfe, 0x1d, 0xf6,
-
-    /* U+003B ";" */
-    0x1d, 0xf6, 0x8f, 0xfe, 0x6f, 0xfc, 0x6, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x71, 0x5f, 0xfc,
-    0x8f, 0xff, 0x1d, 0xfc, 0x5, 0xf8, 0x8, 0xf3,
-    0xc, 0xe0, 0xf, 0xa0, 0x3f, 0x60, 0x7f, 0x10,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x59, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x8e, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xef, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x1, 0x7d,
-    0xff, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
-    0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xd7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xfa,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x9f, 0xff, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xd7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x15,
-
-    /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xca, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe,
-
-    /* U+003E ">" */
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3a, 0xff, 0xfa, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
-    0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x6d, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3a, 0xff, 0xf9, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xff,
-    0xe9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8e, 0xff,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff, 0xec, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xee,
-    0xef, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x9f, 0xfd,
-    0x73, 0x0, 0x0, 0x3, 0x8e, 0xff, 0x50, 0x0,
-    0xbf, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0x30, 0x1b, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfb, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6a,
-    0xce, 0xff, 0xfe, 0xdb, 0x85, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xef, 0xff, 0xdb, 0xa9, 0x9a, 0xce,
-    0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xd8, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x9f, 0xfd, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xe2, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xec, 0x82,
-    0x0, 0x0, 0xdf, 0x10, 0x3, 0xfd, 0x0, 0x0,
-    0x0, 0x1f, 0xe1, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0xfc, 0xa9, 0xac, 0xff, 0xa1, 0x0, 0xdf, 0x10,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x9f, 0xf8, 0x10, 0x0, 0x0, 0x18,
-    0xfd, 0x20, 0xdf, 0x10, 0x0, 0xc, 0xf1, 0x0,
-    0x1, 0xfd, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xe1, 0xdf, 0x10,
-    0x0, 0x3, 0xf8, 0x0, 0x7, 0xf5, 0x0, 0x0,
-    0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xeb, 0xdf, 0x10, 0x0, 0x0, 0xcf, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x10,
-    0x0, 0x0, 0x6f, 0x40, 0x1f, 0xa0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x10, 0x0, 0x0, 0x2f, 0x80,
-    0x5f, 0x60, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10,
-    0x0, 0x0, 0xe, 0xc0, 0x7f, 0x40, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0xb, 0xe0,
-    0x9f, 0x20, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0xa, 0xf0, 0xaf, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x9, 0xf1,
-    0xaf, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0x0, 0x9, 0xf1, 0xaf, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x9, 0xf0,
-    0x9f, 0x20, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10,
-    0x0, 0x0, 0xa, 0xf0, 0x7f, 0x40, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x10, 0x0, 0x0, 0xc, 0xd0,
-    0x4f, 0x70, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x10,
-    0x0, 0x0, 0xf, 0xa0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x10, 0x0, 0x0, 0x4f, 0x60,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0xcf, 0x10,
-    0x0, 0x0, 0xaf, 0x10, 0x7, 0xf6, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xe1, 0xbf, 0x50, 0x0, 0x3, 0xfa, 0x0,
-    0x1, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfa,
-    0x30, 0x0, 0x0, 0x3a, 0xfd, 0x20, 0x6f, 0xd1,
-    0x0, 0x3e, 0xf2, 0x0, 0x0, 0x8f, 0x60, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xfe, 0xcb, 0xce, 0xff,
-    0xa1, 0x0, 0xc, 0xff, 0xcc, 0xff, 0x40, 0x0,
-    0x0, 0x1e, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xec, 0x82, 0x0, 0x0, 0x0, 0x8e,
-    0xfe, 0xa2, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xef, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xd8, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xdf, 0xff, 0xdb, 0xaa, 0xac, 0xef,
-    0xff, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7a,
-    0xce, 0xff, 0xfe, 0xc9, 0x62, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xdf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x4a, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfc, 0x3, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf5, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xd0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xdc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf,
-    0xf6, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0,
-    0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf2,
-
-    /* U+0042 "B" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec,
-    0x84, 0x0, 0x0, 0x0, 0xe, 0xfe, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xfd, 0x50, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x7d, 0xff, 0x80, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x60, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6d, 0xfe,
-    0x30, 0x0, 0xe, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xef, 0xff, 0xf7, 0x10, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0x20, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x24, 0x8d, 0xff, 0x80, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0x80, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfa, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xc0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0xfc, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0xaf, 0xfc,
-    0x10, 0xe, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xde, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x50,
-    0x0, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbe, 0xff,
-    0xfe, 0xc8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0xe8, 0x42, 0x0, 0x1, 0x37, 0xcf, 0xfe, 0x50,
-    0x0, 0x0, 0x0, 0x9f, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0x80, 0x0, 0x0,
-    0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf8, 0x0, 0x0, 0x9f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xbf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xd8, 0x41, 0x0, 0x1,
-    0x37, 0xcf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0xbe, 0xff, 0xfe, 0xb8, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xda,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x25, 0x9e, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0x60, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf7, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x50, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf2, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfb, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf2, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf7, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0x60, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x25, 0x9e, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0xef, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xda,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xd0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xe6, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60,
-
-    /* U+0046 "F" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfe, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xed, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbd, 0xff,
-    0xfe, 0xc9, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xe9, 0x52, 0x0, 0x1, 0x36, 0xaf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x9f, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xff, 0xb0, 0x0, 0x0,
-    0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdc, 0x0, 0x0, 0x9f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x56, 0x1a, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x36, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0xe, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xbf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x30, 0x0, 0x0, 0x9f, 0xfd, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xe9, 0x42, 0x0, 0x0,
-    0x36, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0xbd, 0xff, 0xfe, 0xc9, 0x51, 0x0, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x1e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x1e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x1e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x1e, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1e, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x1e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x1e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x1e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x10,
-
-    /* U+0049 "I" */
-    0xef, 0x4e, 0xf4, 0xef, 0x4e, 0xf4, 0xef, 0x4e,
-    0xf4, 0xef, 0x4e, 0xf4, 0xef, 0x4e, 0xf4, 0xef,
-    0x4e, 0xf4, 0xef, 0x4e, 0xf4, 0xef, 0x4e, 0xf4,
-    0xef, 0x4e, 0xf4, 0xef, 0x4e, 0xf4, 0xef, 0x4e,
-    0xf4, 0xef, 0x4e, 0xf4, 0xef, 0x4e, 0xf4, 0xef,
-    0x4e, 0xf4, 0xef, 0x40,
-
-    /* U+004A "J" */
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0xb, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x9f, 0xe4, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0xaf, 0xfa,
-    0x40, 0x0, 0x16, 0xef, 0xe1, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0,
-    0x16, 0xbe, 0xff, 0xda, 0x50, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xb0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xb0, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc1, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0xbf, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0xaf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0xaf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0xaf, 0xe2,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x9f, 0xe2, 0x0, 0x9f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x9f, 0xe2,
-    0x0, 0x0, 0xbf, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xcf, 0xe3, 0x0, 0x0, 0x0, 0xcf,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xa0, 0x0, 0x0, 0x0, 0xe, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x40, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfe, 0x20, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd,
-    0x10, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xfa, 0x0,
-
-    /* U+004C "L" */
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfe,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3,
-
-    /* U+004D "M" */
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0xef, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0xff, 0xe, 0xf5, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x4f, 0xf0, 0xef, 0x37, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x81, 0xff, 0xe, 0xf3, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x1f, 0xf0, 0xef, 0x30, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf5, 0x1, 0xff, 0xe, 0xf3, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x1f, 0xf0, 0xef, 0x30, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
-    0x1, 0xff, 0xe, 0xf3, 0x0, 0x8, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x1f, 0xf0, 0xef, 0x30, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x1,
-    0xff, 0xe, 0xf3, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x1f,
-    0xf0, 0xef, 0x30, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x1, 0xff,
-    0xe, 0xf3, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x1f, 0xf0,
-    0xef, 0x30, 0x0, 0x0, 0x9, 0xfa, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x1, 0xff, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x9,
-    0xf7, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0,
-
-    /* U+004E "N" */
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x1e, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x1e, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0xef, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x1e, 0xf4,
-    0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0xef, 0x40, 0x9f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x1e,
-    0xf4, 0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40, 0x1, 0xef,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x1e, 0xf4, 0x0, 0x3, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40, 0x0,
-    0x6, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x1e, 0xf4, 0x0, 0x0, 0xa, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xef, 0x40,
-    0x0, 0x0, 0xc, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x1e,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x4f, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x1e, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe1,
-    0x0, 0x0, 0x1, 0xff, 0x1e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0x0, 0x1f,
-    0xf1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xa0, 0x0, 0x1, 0xff, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0,
-    0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x1, 0xff, 0x1e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe,
-    0x10, 0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfc, 0x1, 0xff, 0x1e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf9, 0x1f, 0xf1, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7, 0xff,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf1, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf1, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x10,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff,
-    0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xd8, 0x42, 0x0, 0x1,
-    0x47, 0xcf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3b, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x9f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xb0, 0x0, 0x0, 0x4f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x70, 0x0, 0xe, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x20, 0x6, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x56, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf9, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xca, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xea, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x50, 0xdf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1, 0x6, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0xe, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x20, 0x0, 0x4f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x9f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xc0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0xd8, 0x41, 0x0, 0x1, 0x37, 0xcf, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
-    0xbe, 0xff, 0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xa6,
-    0x10, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0x5a, 0xff,
-    0xf5, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xf6, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf2, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf5, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x7e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x7e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf5, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf2, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xf6, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0x5a,
-    0xff, 0xf5, 0x0, 0xe, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xa6, 0x10,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff,
-    0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xd8, 0x42,
-    0x0, 0x1, 0x47, 0xcf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xb0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x70, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x20, 0x0, 0x6, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x50, 0x6, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0xa,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x50, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf1, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0xff, 0xd8, 0x41, 0x0, 0x1, 0x37, 0xcf,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x48, 0xbe, 0xff, 0xff, 0xd9,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x1, 0xcc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xc5, 0x0, 0x0, 0x17, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xcf, 0xff, 0xdc, 0xef, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfe, 0xb7, 0x10,
-    0x0,
-
-    /* U+0052 "R" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xa6,
-    0x10, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0x5a, 0xff,
-    0xf5, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xf6, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf2, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf5, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x7e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x7e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf5, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x1e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf2, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xf5, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0x49,
-    0xff, 0xf5, 0x0, 0xe, 0xfe, 0xee, 0xee, 0xee,
-    0xee, 0xef, 0xff, 0xff, 0x91, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xfd, 0x10,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf6, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x70, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x30, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xe0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x59, 0xce, 0xff, 0xfd, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff,
-    0xee, 0xef, 0xff, 0xfd, 0x60, 0x0, 0x0, 0xb,
-    0xff, 0xc6, 0x20, 0x0, 0x0, 0x37, 0xdf, 0xfd,
-    0x10, 0x0, 0xbf, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xbc, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xc6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xfd, 0x95, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xef, 0xff,
-    0xfd, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x59, 0xdf, 0xff, 0xe7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c,
-    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xb0, 0x6f, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0x20, 0x4, 0xef,
-    0xfd, 0x73, 0x0, 0x0, 0x1, 0x49, 0xff, 0xe3,
-    0x0, 0x0, 0x6, 0xdf, 0xff, 0xfe, 0xee, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x3, 0x7b,
-    0xdf, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x72, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x72, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x72, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x2f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x72,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x72, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x72, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x72, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x72, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x61, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x50, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x7f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc0, 0x2, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x10, 0x0, 0x2f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x60,
-    0x0, 0x0, 0x5f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xa5, 0x20, 0x0, 0x14, 0x8e, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x7b, 0xdf, 0xff, 0xeb, 0x83, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x61, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf7, 0x0, 0x2f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x90,
-    0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x8,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe0, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x60, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0x0, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0,
-    0x5, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0xdf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfa, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf5, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0xc, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x7, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x90, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0x6f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x6f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0xa,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x70, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0,
-    0x0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x20, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x20, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x90, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x50, 0x7, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x6, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf5, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x9f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x1, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0,
-    0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x80, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x10, 0x1e, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfc, 0xb, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xe1, 0x2, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf7, 0x0, 0x0,
-    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x8f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x70, 0x0, 0x0,
-    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x0, 0x1e, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x10, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-
-    /* U+0059 "Y" */
-    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x20, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x1e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x50,
-    0x0, 0x1, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x9f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x3f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf3, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd7, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xe9, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0,
-
-    /* U+005B "[" */
-    0xef, 0xff, 0xff, 0xee, 0xfd, 0xcc, 0xcb, 0xef,
-    0x30, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xef, 0x30,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0xef, 0x30, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0xef, 0x30, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0xef, 0x30, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xef, 0x30,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0xef, 0x30, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0xef, 0x30, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0xef, 0x30, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xef, 0x30,
-    0x0, 0xe, 0xfd, 0xcc, 0xcb, 0xef, 0xff, 0xff,
-    0xe0,
-
-    /* U+005C "\\" */
-    0x28, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf3,
-
-    /* U+005D "]" */
-    0xf, 0xff, 0xff, 0xfb, 0xc, 0xcc, 0xce, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6, 0xfb, 0xc, 0xcc, 0xce, 0xfb,
-    0xf, 0xff, 0xff, 0xfb,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x9a, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x33,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc,
-    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf5, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xe0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x20, 0x0, 0x2, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0,
-    0x0, 0xe, 0xd0, 0x0, 0x0, 0x4f, 0x70, 0x0,
-    0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x9,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0,
-
-    /* U+005F "_" */
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x4e, 0xfb, 0x0, 0x0, 0x0, 0x1c, 0xfc, 0x10,
-    0x0, 0x0, 0x8, 0xfe, 0x30, 0x0, 0x0, 0x5,
-    0xff, 0x40, 0x0, 0x0, 0x2, 0xcf, 0x60,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x8e, 0xff, 0xfe, 0xde, 0xff,
-    0xff, 0x60, 0x0, 0x3, 0xef, 0xfa, 0x40, 0x0,
-    0x0, 0x4b, 0xff, 0x80, 0x0, 0xaf, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x1, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x6b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x5, 0xef, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaf, 0xf4, 0x6, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x5f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x47, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x44, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf4, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0xdf, 0x40, 0x4f, 0xf9, 0x10,
-    0x0, 0x0, 0x5, 0xdf, 0x3b, 0xf4, 0x0, 0x4e,
-    0xff, 0xc9, 0x89, 0xbe, 0xfc, 0x20, 0xbf, 0x40,
-    0x0, 0x5, 0xad, 0xff, 0xfd, 0x94, 0x0, 0xb,
-    0xf4,
-
-    /* U+0062 "b" */
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x3, 0xcf, 0xff,
-    0xee, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x8, 0xf8,
-    0x6, 0xff, 0xb5, 0x10, 0x0, 0x26, 0xdf, 0xf9,
-    0x0, 0x0, 0x8f, 0x85, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfa, 0x0, 0x8, 0xfa, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
-    0x0, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf1, 0x8, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfd, 0x8, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x8f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x38, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x48, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x8f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x18, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0x8f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x8,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x10, 0x8f, 0x9f, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x8, 0xf7,
-    0x5f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x90, 0x0, 0x8f, 0x70, 0x6f, 0xfb, 0x41, 0x0,
-    0x2, 0x6d, 0xff, 0x90, 0x0, 0x8, 0xf7, 0x0,
-    0x3c, 0xff, 0xfe, 0xef, 0xff, 0xfd, 0x40, 0x0,
-    0x0, 0x8f, 0x70, 0x0, 0x4, 0x9d, 0xff, 0xfd,
-    0x94, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xec, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xee,
-    0xff, 0xff, 0xb2, 0x0, 0x0, 0x3, 0xef, 0xf9,
-    0x30, 0x0, 0x3, 0x8e, 0xfe, 0x30, 0x0, 0x3f,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2,
-    0x1, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xb1, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xb1, 0x0, 0x3f, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x3,
-    0xef, 0xf9, 0x30, 0x0, 0x3, 0x8e, 0xfe, 0x30,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xee, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff,
-    0xec, 0x82, 0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x28, 0xce,
-    0xff, 0xeb, 0x60, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x1a, 0xff, 0xff, 0xee, 0xff, 0xfe, 0x60, 0x2,
-    0xff, 0x0, 0x4, 0xef, 0xf8, 0x30, 0x0, 0x3,
-    0x8f, 0xfb, 0x2, 0xff, 0x0, 0x4f, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xb2, 0xff, 0x1,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0xff, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x2f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xa, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x1, 0xef,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9,
-    0xff, 0x0, 0x4f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xb2, 0xff, 0x0, 0x4, 0xef, 0xf8,
-    0x30, 0x0, 0x3, 0x8f, 0xfb, 0x2, 0xff, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xee, 0xff, 0xff, 0x70,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff,
-    0xeb, 0x60, 0x0, 0x2, 0xff,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x39, 0xcf, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xfe,
-    0xde, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xd6, 0x10, 0x0, 0x5, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x60, 0x0, 0x2, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0xa,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfc, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x30, 0x7f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xef, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x80, 0xdf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x90, 0x0, 0x0, 0x3f,
-    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf6,
-    0x0, 0x0, 0x3, 0xef, 0xf9, 0x40, 0x0, 0x1,
-    0x5b, 0xff, 0x90, 0x0, 0x0, 0x0, 0x19, 0xff,
-    0xff, 0xee, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xfd, 0x94, 0x0,
-    0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x2, 0x9e, 0xff, 0xd9, 0x20,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xdd, 0xff, 0xf1,
-    0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x5, 0x90,
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x2c, 0xcc, 0xdf, 0xfc, 0xcc, 0xcc, 0xcb, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xec, 0x72,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x2, 0xbf, 0xff,
-    0xdb, 0xbc, 0xff, 0xfa, 0x10, 0xd, 0xf3, 0x0,
-    0x5, 0xff, 0xd6, 0x10, 0x0, 0x0, 0x3a, 0xfe,
-    0x30, 0xdf, 0x30, 0x6, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0x2d, 0xf3, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xed,
-    0xdf, 0x30, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf3, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x38, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0xcf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x3e,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x3e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x38, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf3, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x30, 0xaf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3,
-    0x1, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0xef, 0x30, 0x4, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x1e, 0xf3, 0x0,
-    0x3, 0xef, 0xfa, 0x52, 0x0, 0x14, 0x8e, 0xfd,
-    0x10, 0xef, 0x30, 0x0, 0x1, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x16, 0xac, 0xdd, 0xc9, 0x50, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0xb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x3, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x50, 0x0, 0x5,
-    0xef, 0xfc, 0x63, 0x0, 0x0, 0x2, 0x7d, 0xff,
-    0x60, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xee,
-    0xef, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x8b, 0xef, 0xff, 0xec, 0x83, 0x0, 0x0,
-    0x0,
-
-    /* U+0068 "h" */
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20, 0x0,
-    0x0, 0x8f, 0x80, 0x8, 0xff, 0xff, 0xee, 0xff,
-    0xff, 0x90, 0x0, 0x8, 0xf8, 0xb, 0xfd, 0x72,
-    0x0, 0x0, 0x4a, 0xff, 0xc0, 0x0, 0x8f, 0x8a,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
-    0x8, 0xfd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x20, 0x8f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf8, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x18,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x18, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x18, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x18, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x18, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x18, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-
-    /* U+0069 "i" */
-    0xa, 0xfa, 0x2, 0xff, 0xf2, 0xe, 0xfe, 0x0,
-    0x15, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x8, 0xf8, 0x0, 0x8f, 0x80, 0x8, 0xf8,
-    0x0, 0x8f, 0x80, 0x8, 0xf8, 0x0, 0x8f, 0x80,
-    0x8, 0xf8, 0x0, 0x8f, 0x80, 0x8, 0xf8, 0x0,
-    0x8f, 0x80, 0x8, 0xf8, 0x0, 0x8f, 0x80, 0x8,
-    0xf8, 0x0, 0x8f, 0x80, 0x8, 0xf8, 0x0, 0x8f,
-    0x80, 0x8, 0xf8, 0x0, 0x8f, 0x80, 0x8, 0xf8,
-    0x0, 0x8f, 0x80, 0x8, 0xf8, 0x0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xef, 0x50,
-    0x2b, 0x30, 0x0, 0x2c, 0xfd, 0x0, 0x7f, 0xfe,
-    0xcd, 0xff, 0xe2, 0x0, 0x4, 0xae, 0xff, 0xd8,
-    0x10, 0x0,
-
-    /* U+006B "k" */
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfb,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xfa, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xf9, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0xaf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0xbf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x1, 0xcf, 0xd9, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x81, 0xdf, 0xc1, 0xb, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0xef, 0xb0,
-    0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xa0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xe2, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xa0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x30,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfe, 0x10, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfc, 0x0,
-
-    /* U+006C "l" */
-    0x8f, 0x88, 0xf8, 0x8f, 0x88, 0xf8, 0x8f, 0x88,
-    0xf8, 0x8f, 0x88, 0xf8, 0x8f, 0x88, 0xf8, 0x8f,
-    0x88, 0xf8, 0x8f, 0x88, 0xf8, 0x8f, 0x88, 0xf8,
-    0x8f, 0x88, 0xf8, 0x8f, 0x88, 0xf8, 0x8f, 0x88,
-    0xf8, 0x8f, 0x88, 0xf8, 0x8f, 0x88, 0xf8, 0x8f,
-    0x88, 0xf8, 0x8f, 0x88, 0xf8, 0x8f, 0x80,
-
-    /* U+006D "m" */
-    0x8f, 0x70, 0x0, 0x28, 0xce, 0xff, 0xeb, 0x60,
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfd, 0xa5,
-    0x0, 0x0, 0x8, 0xf7, 0x0, 0x9f, 0xfe, 0xcb,
-    0xce, 0xff, 0xe4, 0x0, 0x0, 0x2b, 0xff, 0xec,
-    0xbc, 0xef, 0xfd, 0x30, 0x0, 0x8f, 0x71, 0xdf,
-    0xa3, 0x0, 0x0, 0x3, 0xbf, 0xf5, 0x0, 0x3e,
-    0xfa, 0x30, 0x0, 0x0, 0x4c, 0xff, 0x40, 0x8,
-    0xf7, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf2, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x10, 0x8f, 0xdf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xac, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x8, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x38, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0x8f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x78, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x78, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x78, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf7, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x78, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x78, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf7, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x78,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x78, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-
-    /* U+006E "n" */
-    0x8f, 0x70, 0x0, 0x17, 0xbe, 0xff, 0xec, 0x82,
-    0x0, 0x0, 0x8, 0xf7, 0x0, 0x8f, 0xff, 0xcb,
-    0xbd, 0xff, 0xf9, 0x0, 0x0, 0x8f, 0x70, 0xcf,
-    0xb4, 0x0, 0x0, 0x1, 0x7f, 0xfc, 0x0, 0x8,
-    0xf7, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf9, 0x0, 0x8f, 0xdf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x8, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfc, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x8f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x8, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x18, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x18, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x18, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x18, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x18,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x18, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xec, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xee, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xf8, 0x30, 0x0, 0x3, 0x8e, 0xfe, 0x40,
-    0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x1, 0xaf, 0xf4, 0x0, 0x1, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x10, 0x9,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x1, 0xef, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x10, 0x0, 0x3f,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xf4,
-    0x0, 0x0, 0x3, 0xef, 0xf8, 0x30, 0x0, 0x3,
-    0x8e, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xff, 0xee, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x27, 0xbe, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x8f, 0x70, 0x0, 0x4, 0x9d, 0xff, 0xfd, 0x94,
-    0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x3c, 0xff,
-    0xfe, 0xef, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x8f,
-    0x70, 0x6f, 0xfb, 0x51, 0x0, 0x2, 0x6d, 0xff,
-    0x90, 0x0, 0x8, 0xf7, 0x5f, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x90, 0x0, 0x8f, 0x9f,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x60, 0x8, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x10, 0x8f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0x8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x18,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x48, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x38, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x8, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xe1, 0x8, 0xfa, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0, 0x8f,
-    0x85, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf9, 0x0, 0x8, 0xf8, 0x6, 0xff, 0xb4, 0x10,
-    0x0, 0x26, 0xdf, 0xf9, 0x0, 0x0, 0x8f, 0x80,
-    0x3, 0xcf, 0xff, 0xee, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x49, 0xdf, 0xff,
-    0xd9, 0x40, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xeb, 0x60,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xee, 0xff, 0xff, 0x70, 0x2, 0xff, 0x0, 0x4,
-    0xef, 0xf8, 0x30, 0x0, 0x3, 0x8f, 0xfb, 0x2,
-    0xff, 0x0, 0x4f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xb2, 0xff, 0x1, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0xff, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xa, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x1, 0xef, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0xff, 0x0, 0x4f,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xb2,
-    0xff, 0x0, 0x4, 0xef, 0xf8, 0x30, 0x0, 0x3,
-    0x8f, 0xfb, 0x2, 0xff, 0x0, 0x0, 0x1a, 0xff,
-    0xff, 0xee, 0xff, 0xfe, 0x60, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xeb, 0x60, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff,
-
-    /* U+0072 "r" */
-    0x8f, 0x70, 0x0, 0x38, 0xce, 0xd8, 0xf7, 0x1,
-    0xaf, 0xff, 0xeb, 0x8f, 0x71, 0xdf, 0xb4, 0x0,
-    0x8, 0xf7, 0xcf, 0x50, 0x0, 0x0, 0x8f, 0xdf,
-    0x50, 0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xfd, 0xa6, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xdd, 0xef, 0xff,
-    0xfa, 0x20, 0x0, 0xaf, 0xf7, 0x20, 0x0, 0x0,
-    0x38, 0xef, 0x90, 0x6, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0x10, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfd, 0x84, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xfd, 0xa7,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7b, 0xef,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x47, 0xcf, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x5f, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf1, 0x6f, 0xff, 0xa5, 0x10, 0x0,
-    0x0, 0x4a, 0xff, 0x50, 0x2, 0xaf, 0xff, 0xff,
-    0xdd, 0xef, 0xff, 0xe4, 0x0, 0x0, 0x1, 0x6a,
-    0xde, 0xff, 0xed, 0x95, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x2c, 0xcc, 0xdf, 0xfc, 0xcc, 0xcc, 0xcb, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x5, 0xa0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xdd, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x3, 0xae, 0xff, 0xd8, 0x10,
-
-    /* U+0075 "u" */
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfa, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x8f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
-    0x4f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfa, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0xfa, 0x5, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xc6, 0xfa, 0x0, 0x8f,
-    0xfd, 0x61, 0x0, 0x1, 0x5c, 0xfd, 0x16, 0xfa,
-    0x0, 0x6, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xa1,
-    0x6, 0xfa, 0x0, 0x0, 0x6, 0xad, 0xff, 0xfc,
-    0x82, 0x0, 0x6, 0xfa,
-
-    /* U+0076 "v" */
-    0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0xc,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x10, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf5, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x7f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf2, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x96, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0xa, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x4, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0xaf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf1, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x1,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x5, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0x0, 0x6, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0xa, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x50, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf2, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0x2e, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0xc,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x69, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xad, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xd0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf5, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0x60, 0x0, 0x0, 0x5, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x10, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf7,
-
-    /* U+0079 "y" */
-    0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0x0, 0x3, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x50, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x4f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf7, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x50, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa7,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0,
-    0x0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xce, 0x60, 0x0, 0x19, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfd, 0xef, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xd8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x32,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0x70, 0x0, 0x1,
-    0xef, 0xfd, 0xc6, 0x0, 0x0, 0x9f, 0xe3, 0x0,
-    0x0, 0x0, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x5c, 0xdf, 0xf5, 0x0, 0x0,
-    0x6, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xe3, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfe,
-    0xc6, 0x0, 0x0, 0x1, 0x8d, 0xff, 0x70,
-
-    /* U+007C "|" */
-    0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e,
-    0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef,
-    0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1,
-    0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e,
-    0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef,
-    0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1,
-    0xef, 0x1e, 0xf1, 0xef, 0x1e, 0xf1, 0xef, 0x1e,
-    0xf1, 0xef, 0x10,
-
-    /* U+007D "}" */
-    0xf, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0xcd, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfc,
-    0xa0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0x0, 0x0,
-    0x5, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x8f, 0x90,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x50, 0x0, 0x0, 0x0,
-    0x9f, 0xf1, 0x0, 0x0, 0xcd, 0xff, 0xf6, 0x0,
-    0x0, 0xf, 0xfe, 0xb3, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x7, 0xdf, 0xeb, 0x30, 0x0, 0x0, 0x0,
-    0x6, 0xf2, 0x0, 0xbf, 0xeb, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x8, 0xf0, 0x7, 0xf8, 0x0, 0x2,
-    0xdf, 0x90, 0x0, 0x0, 0xe, 0xc0, 0xe, 0xd0,
-    0x0, 0x0, 0xb, 0xfb, 0x10, 0x0, 0xaf, 0x50,
-    0x1f, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xfb, 0xbe,
-    0xfa, 0x0, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0xfd, 0x60, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x0, 0x9a, 0x10, 0x0, 0x9, 0xa2,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x5, 0xfb, 0x0,
-    0x0, 0x2, 0xfe, 0x10, 0x0, 0x2f, 0xe1, 0x0,
-    0x0, 0xd, 0xf3, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x4f, 0xd0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0,
-    0x1, 0xef, 0x30, 0x0, 0x1d, 0xf3, 0x0, 0x0,
-    0x0, 0x3f, 0xe1, 0x0, 0x3, 0xfe, 0x10, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x1e, 0xe1,
-
-    /* U+00BB "»" */
-    0xa, 0xa0, 0x0, 0x0, 0xaa, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x9f, 0x70, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0x2, 0xee, 0x10, 0x0, 0x1e, 0xe1, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x4, 0xfc, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x8f, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x1e, 0xe1, 0x0, 0x1, 0xee, 0x20,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0x9, 0xf7, 0x0, 0x0, 0x9f, 0x70, 0x0,
-    0x0, 0x5f, 0xb0, 0x0, 0x5, 0xfb, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x2f, 0xd1, 0x0, 0x0,
-    0xd, 0xf2, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x0, 0x78, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xe1, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xe8, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xc, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0x10, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x8b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9,
-
-    /* U+0402 "Ђ" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x13,
-    0x45, 0x53, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x2, 0x7b, 0xef,
-    0xff, 0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x8c, 0xff, 0xff,
-    0xc9, 0x88, 0x9b, 0xef, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x92, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x4f,
-    0xdc, 0xbc, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x12, 0x21, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xfd, 0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xd8,
-    0x41, 0x0, 0x1, 0x47, 0xcf, 0xfe, 0x50, 0x0,
-    0x0, 0x7, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xf8, 0x0, 0x0, 0x7f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xe5, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xa0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x50,
-    0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x7,
-    0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xf5, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xd8,
-    0x41, 0x0, 0x2, 0x48, 0xdf, 0xfd, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x49, 0xce, 0xff, 0xfd, 0xb7, 0x30, 0x0,
-    0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x0, 0x48, 0xce, 0xff, 0xfe, 0xb8,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
-    0xee, 0xef, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x8,
-    0xff, 0xd7, 0x30, 0x0, 0x0, 0x26, 0xbf, 0xfe,
-    0x30, 0x0, 0x7f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x9f, 0x10, 0x1, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xe8,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4c, 0xff, 0xfe, 0xa6, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xcf, 0xff,
-    0xfe, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x48, 0xcf, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x5b,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x3f, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x50, 0x2, 0xcf,
-    0xfe, 0x94, 0x10, 0x0, 0x0, 0x38, 0xef, 0xf6,
-    0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xee, 0xef,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1, 0x6a,
-    0xde, 0xff, 0xfd, 0xb8, 0x30, 0x0, 0x0,
-
-    /* U+0406 "І" */
-    0xbf, 0x7b, 0xf7, 0xbf, 0x7b, 0xf7, 0xbf, 0x7b,
-    0xf7, 0xbf, 0x7b, 0xf7, 0xbf, 0x7b, 0xf7, 0xbf,
-    0x7b, 0xf7, 0xbf, 0x7b, 0xf7, 0xbf, 0x7b, 0xf7,
-    0xbf, 0x7b, 0xf7, 0xbf, 0x7b, 0xf7, 0xbf, 0x7b,
-    0xf7, 0xbf, 0x7b, 0xf7, 0xbf, 0x7b, 0xf7, 0xbf,
-    0x7b, 0xf7, 0xbf, 0x70,
-
-    /* U+0407 "Ї" */
-    0x8f, 0xa0, 0x0, 0x4, 0xed, 0x1e, 0xff, 0x0,
-    0x0, 0xaf, 0xf5, 0x7f, 0x90, 0x0, 0x4, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa,
-    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7,
-    0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xb0,
-    0x9, 0xff, 0xb4, 0x0, 0x1, 0x6e, 0xfe, 0x10,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x6b, 0xef, 0xfe, 0xa5, 0x0, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xba, 0x74, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x13, 0x7c, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xa0,
-    0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfc,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd, 0x10,
-    0x11, 0x15, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x24, 0x8d, 0xff, 0xd2, 0x0,
-    0x7f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7e, 0xfe, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xec, 0x95, 0x0, 0x0, 0x0,
-
-    /* U+040A "Њ" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0, 0xbf, 0xfe,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xef, 0xff, 0xee, 0xee, 0xee, 0xee, 0xef, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7d, 0xff,
-    0xc0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x40, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xb0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xe0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x20, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf7, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6d, 0xff,
-    0x80, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcd, 0xef, 0xff, 0xd4, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x83, 0x0, 0x0, 0x0,
-
-    /* U+040B "Ћ" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x48, 0xbd,
-    0xee, 0xdc, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf0, 0x6b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfe, 0xa6,
-    0x31, 0x0, 0x14, 0x8e, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x85,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x20, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0x70, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x1, 0xef, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0xee, 0xee,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x20, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xfa, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x70, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf4, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x10,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x0, 0x78, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xcf, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf5, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf8, 0xcf, 0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfb, 0xc, 0xf5, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0x10, 0xcf, 0x5b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0xc, 0xf5,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x50, 0x0, 0xcf, 0x5b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x90, 0x0, 0xc,
-    0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xc0, 0x0, 0x0, 0xcf, 0x5b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xe1, 0x0, 0x0,
-    0xc, 0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf3, 0x0, 0x0, 0x0, 0xcf, 0x5b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0xc, 0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x5b,
-    0xf7, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0xbf, 0x70, 0x0, 0x0,
-    0x8, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x5b, 0xf7, 0x0, 0x0, 0x5, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf, 0x70, 0x0,
-    0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x5b, 0xf7, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf, 0x70,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x5b, 0xf7, 0x0, 0x7f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf,
-    0x70, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x5b, 0xf7, 0x1e, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0xbf, 0x7c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x5b, 0xfe, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf5, 0xbf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x5b, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd1,
-    0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe7, 0x31, 0x25,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3b, 0xff, 0xff, 0xfd, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x34, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x43, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0xa,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf2, 0x0, 0x2f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x60, 0x0, 0x0, 0x1, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0xbf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf8, 0x4f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x10, 0x1, 0x8f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xef, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xcf, 0xfe, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0xfe, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf8,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xd1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0xaf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0,
-    0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x6, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x70, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x50, 0x1, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf4, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc,
-
-    /* U+0411 "Б" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0xb, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x30, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcb, 0xa8, 0x51, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x25, 0xaf, 0xff, 0x70, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0x60,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x1b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xbb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xeb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xbb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x1b,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x60, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x7d, 0xff, 0x70, 0xb, 0xfe,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xdf, 0xff, 0xfc,
-    0x30, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdb, 0x72, 0x0, 0x0, 0x0,
-
-    /* U+0412 "В" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb,
-    0x71, 0x0, 0x0, 0x0, 0xbf, 0xec, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcd, 0xff, 0xff, 0xa1, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x9f, 0xfe, 0x20, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xd0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf6, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x90, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8f, 0xf8, 0x0, 0x0, 0xbf, 0xdc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcd, 0xff, 0xfa, 0x30, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa4, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x12, 0x5a, 0xff, 0xb1, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xfd, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xdf, 0xf5, 0x0, 0xbf, 0xec, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xdf, 0xff, 0xfc, 0x30, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xb7, 0x30, 0x0, 0x0,
-
-    /* U+0413 "Г" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xe6,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x48, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x83,
-
-    /* U+0415 "Е" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xe1, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90,
-
-    /* U+0416 "Ж" */
-    0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x80, 0x1, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf4, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0xee, 0xee, 0xff, 0xfe, 0xee,
-    0xee, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x20, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0xd, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x0, 0x0,
-    0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x90, 0x0, 0x0, 0x7f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0,
-    0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfe, 0x10, 0xc, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0,
-    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf5,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x1, 0x59, 0xce, 0xff, 0xfe, 0xb8,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
-    0x1, 0xcf, 0xfe, 0x95, 0x20, 0x0, 0x1, 0x38,
-    0xdf, 0xfa, 0x0, 0x0, 0x0, 0xec, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0, 0x0,
-    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0xaf, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcd, 0xdd, 0xdd, 0xde, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x5b, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x4e, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x20, 0x7f, 0xfa, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0,
-    0x5, 0xef, 0xfc, 0x84, 0x10, 0x0, 0x0, 0x13,
-    0x8e, 0xff, 0x70, 0x0, 0x0, 0x7, 0xdf, 0xff,
-    0xff, 0xee, 0xef, 0xff, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x7a, 0xce, 0xff, 0xfe, 0xda,
-    0x62, 0x0, 0x0, 0x0,
-
-    /* U+0418 "И" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0x5b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x5b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf8, 0xcf, 0x5b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfb, 0xc, 0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfd, 0x10, 0xcf, 0x5b,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0xc, 0xf5, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x50, 0x0, 0xcf,
-    0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x90, 0x0, 0xc, 0xf5, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0,
-    0xcf, 0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xe1, 0x0, 0x0, 0xc, 0xf5, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0,
-    0x0, 0xcf, 0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x5b, 0xf7, 0x0, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0xbf, 0x70, 0x0, 0x0, 0x8, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x5b, 0xf7, 0x0, 0x0,
-    0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf5, 0xbf, 0x70, 0x0, 0x2, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x5b, 0xf7, 0x0,
-    0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0xbf, 0x70, 0x0, 0xaf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x5b, 0xf7,
-    0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf5, 0xbf, 0x70, 0x4f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x5b,
-    0xf7, 0x1e, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0xbf, 0x7c, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x5b, 0xfe, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x5b, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x50,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0x2, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x90, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xa4, 0x11, 0x37, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xff,
-    0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x34, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf5, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf8, 0xcf, 0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfb, 0xc, 0xf5, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0x10, 0xcf, 0x5b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0xc, 0xf5,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x50, 0x0, 0xcf, 0x5b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x90, 0x0, 0xc,
-    0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xc0, 0x0, 0x0, 0xcf, 0x5b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xe1, 0x0, 0x0,
-    0xc, 0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf3, 0x0, 0x0, 0x0, 0xcf, 0x5b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0xc, 0xf5, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x5b,
-    0xf7, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0xbf, 0x70, 0x0, 0x0,
-    0x8, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x5b, 0xf7, 0x0, 0x0, 0x5, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf, 0x70, 0x0,
-    0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x5b, 0xf7, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf, 0x70,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x5b, 0xf7, 0x0, 0x7f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xbf,
-    0x70, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x5b, 0xf7, 0x1e, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0xbf, 0x7c, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x5b, 0xfe, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf5, 0xbf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x5b, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50,
-
-    /* U+041A "К" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x20, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0x70, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x1, 0xef, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0xee, 0xee,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x20, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xfa, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x70, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf4, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x10,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x1,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x4,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x11, 0x15, 0xdf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x7f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x7e, 0xfe, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-
-    /* U+041C "М" */
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x2b,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0xbf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x2b, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf2, 0xbf, 0xdf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0xff, 0x2b, 0xf6, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x4f, 0xf2, 0xbf, 0x64, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0xff, 0x2b, 0xf6, 0xb, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf2, 0xf, 0xf2, 0xbf, 0x60, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0xff, 0x2b, 0xf6, 0x0, 0x8f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0xf, 0xf2, 0xbf, 0x60, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50,
-    0x0, 0xff, 0x2b, 0xf6, 0x0, 0x5, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0xf, 0xf2, 0xbf, 0x60, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0xff, 0x2b, 0xf6, 0x0, 0x0, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0xf,
-    0xf2, 0xbf, 0x60, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x10, 0x0, 0x0, 0xff,
-    0x2b, 0xf6, 0x0, 0x0, 0x1, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0xf, 0xf3,
-    0xbf, 0x60, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xef, 0x3b,
-    0xf6, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0xe, 0xf3, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xef, 0x3b, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xe, 0xf3, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x3b, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x3f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x3b, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x3b, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x3b, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30,
-
-    /* U+041D "Н" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x3b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x3b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x3b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x3b,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x3b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x3b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x3b, 0xff, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf3, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x3b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x3b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x3b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x3b,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x3b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x3b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x30,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xad, 0xff,
-    0xfe, 0xca, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xfa, 0x52, 0x0,
-    0x1, 0x36, 0xbf, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8f, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf3, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x20, 0x0,
-    0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x50,
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x50,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
-    0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0,
-    0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x6f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8f, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xfa, 0x52, 0x0,
-    0x0, 0x36, 0xbf, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xad, 0xff,
-    0xfe, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x7b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x7b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf7, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x7b,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x7b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x7b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x7b, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x7b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x7b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf7, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x7b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x7b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf7, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x7b,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x7b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x7b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x70,
-
-    /* U+0420 "Р" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xa6,
-    0x20, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x2, 0x59, 0xef,
-    0xf7, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x3b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xab,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xab, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x3b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xd0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf4, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0x49,
-    0xef, 0xf7, 0x0, 0xb, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xa6, 0x20,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xad, 0xff,
-    0xfe, 0xca, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0xfa, 0x62, 0x0, 0x0, 0x26, 0xaf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xff, 0xc0, 0x0, 0x0,
-    0x5f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdc, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x6f, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdc, 0x10, 0x0, 0x0, 0x5f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x2c, 0xff, 0xfa, 0x52, 0x0, 0x0,
-    0x26, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xad, 0xff, 0xfe, 0xc9, 0x61, 0x0, 0x0, 0x0,
-
-    /* U+0422 "Т" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x43, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xb0, 0xa, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x9f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x10, 0x0, 0x1, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x0, 0x1,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x9,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x2, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x4f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfd, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x10, 0x1, 0x8f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xef,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xcf, 0xfe, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x58, 0xbd, 0xef, 0xff, 0xfe, 0xdb, 0x85, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xbf, 0xff, 0xff, 0xdc, 0xff, 0xcd, 0xef, 0xff,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xfe, 0x95, 0x10, 0x0, 0xff, 0x20, 0x1,
-    0x48, 0xdf, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfc, 0x40, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xaf, 0xfb, 0x10, 0x0, 0x0,
-    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x4, 0xef, 0xc1, 0x0,
-    0x0, 0x8f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfb,
-    0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x60, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe0, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfc, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf9, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xe0, 0x3, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xfb, 0x0, 0x0,
-    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x4, 0xef, 0xc1, 0x0,
-    0x0, 0x0, 0x9f, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x3, 0xaf, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfe, 0x95, 0x20,
-    0x0, 0xff, 0x20, 0x1, 0x48, 0xdf, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff,
-    0xff, 0xec, 0xff, 0xdd, 0xff, 0xff, 0xfc, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x58, 0xbd, 0xef, 0xff, 0xfe, 0xdb, 0x95, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf5, 0x0, 0x1e, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0x0, 0x9f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfd, 0x0, 0x0, 0x0, 0x4f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf9, 0x0, 0x0, 0x1e, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0xb,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe1, 0x7, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x3f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x10, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40, 0x0,
-    0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0x80, 0x0, 0x1, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
-    0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf8, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xe1, 0x0, 0x1, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xb0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x70, 0x8f, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x30,
-
-    /* U+0426 "Ц" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x80, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x80, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x80, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0xb,
-    0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xff, 0xfe, 0xee, 0xe3, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf4,
-
-    /* U+0427 "Ч" */
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xae, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xae, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xae, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xae, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xae,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xac, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0xc, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xa0, 0x2e, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xdf, 0xfa,
-    0x0, 0x3e, 0xff, 0xc6, 0x31, 0x0, 0x13, 0x59,
-    0xdf, 0xff, 0xef, 0xa0, 0x0, 0x19, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0x17, 0xfa, 0x0,
-    0x0, 0x1, 0x69, 0xce, 0xee, 0xdb, 0x85, 0x10,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-
-    /* U+0428 "Ш" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0xbf, 0xfe,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfe,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xf9,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9,
-
-    /* U+0429 "Щ" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf9, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x90, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x90, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf9, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x90, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x90, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x90, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0,
-    0x0, 0xb, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xef, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xff, 0xfe, 0xee, 0xe4, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x82,
-
-    /* U+042A "Ъ" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcb, 0x96, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x12, 0x5a, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x37, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcd, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x4b,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x4b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x4b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x4b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x4b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0xbf, 0xec, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcb, 0xa7, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x37, 0xdf, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0xdf, 0x4b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xfd, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xf9, 0x0, 0x0, 0x0, 0xdf,
-    0x4b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0xd, 0xf4,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x50, 0x0, 0x0, 0xdf, 0x4b,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf9, 0x0, 0x0, 0xd, 0xf4, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0xdf, 0x4b, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0xd, 0xf4, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0x0, 0xdf, 0x4b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0xd, 0xf4, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x50, 0x0, 0x0, 0xdf, 0x4b, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x0, 0xd, 0xf4, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf8, 0x0,
-    0x0, 0x0, 0xdf, 0x4b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfd, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0xaf, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0xdf, 0x4b, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcd, 0xef, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40,
-
-    /* U+042C "Ь" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xec, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcb, 0xa7, 0x30, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x37, 0xdf, 0xfc, 0x10, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xfd,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xf9, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x5b, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xab, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xab, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf8, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xfd, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0xaf, 0xfc, 0x10, 0xb, 0xfe,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xef, 0xff, 0xe7,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x0, 0x0, 0x59, 0xce, 0xff, 0xfe, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xa6, 0x31, 0x0,
-    0x2, 0x5a, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x1c,
-    0xff, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xff, 0xe3, 0x0, 0x0, 0xc, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x2, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xfb, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xe1, 0x0,
-    0x1d, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0x30, 0x0, 0xb, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb6, 0x31, 0x0,
-    0x2, 0x5a, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59,
-    0xce, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+042E "Ю" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xbe, 0xff, 0xfe, 0xb7, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xe9,
-    0x52, 0x0, 0x2, 0x59, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xe3, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0x30, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x1, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xe1, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0xc,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfb, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x40,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xc0, 0xbf, 0x70, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0xbf, 0x70,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf7, 0xbf, 0x70, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb, 0xbf, 0x70, 0x0, 0x0,
-    0xe, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xbf, 0x70, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xbf, 0x70, 0x0, 0x0, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0xbf, 0x70, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0xbf, 0x70,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf7, 0xbf, 0x70, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf2, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x40, 0xbf, 0x70, 0x0, 0x0, 0x0, 0xc,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfb, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe1, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0xff, 0x30, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe3, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xe9,
-    0x41, 0x0, 0x1, 0x59, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x50, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff,
-    0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x0, 0x48, 0xce, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x5, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xa, 0xff, 0xd8, 0x31, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0xb, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x71, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x6f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x7a, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0xdf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x7e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x7d, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x77, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x8f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0xcf, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x1, 0xbf, 0xfd, 0x73,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x7, 0xff, 0xcd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf7, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x5f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0xdf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-
-    /* U+0430 "а" */
-    0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x1, 0x8f, 0xff, 0xfe, 0xde, 0xff,
-    0xff, 0x60, 0x0, 0x4, 0xef, 0xf9, 0x40, 0x0,
-    0x0, 0x4b, 0xff, 0x70, 0x0, 0xbf, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x1, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x1, 0x6b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x6, 0xff, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaf, 0xf4, 0x6, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x41, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x6f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x48, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x45, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf4, 0xe, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0xdf, 0x40, 0x5f, 0xf8, 0x10,
-    0x0, 0x0, 0x5, 0xde, 0x3c, 0xf4, 0x0, 0x4e,
-    0xff, 0xc9, 0x89, 0xbf, 0xfc, 0x20, 0xcf, 0x40,
-    0x0, 0x6, 0xae, 0xff, 0xfd, 0x94, 0x0, 0xc,
-    0xf4,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x48, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0x9d, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xef, 0xff, 0xff,
-    0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xff, 0xea, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0xfe, 0xa5, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x39, 0xce, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x5f, 0xa0, 0x2, 0xbf, 0xff, 0xee,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x9, 0xf6, 0x4,
-    0xff, 0xb4, 0x0, 0x0, 0x15, 0xcf, 0xfc, 0x10,
-    0x0, 0xbf, 0x44, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfc, 0x0, 0xd, 0xf3, 0xee, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
-    0xef, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf2, 0xe, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0xef,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0xe, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0xcf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x2a, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x8f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x24, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x3, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x9,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf6, 0x0, 0x0, 0xd, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xa4, 0x0, 0x0, 0x4, 0xbf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xdc, 0xdf,
-    0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x7b, 0xef, 0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0432 "в" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x20,
-    0x0, 0x7, 0xfe, 0xbb, 0xbb, 0xbb, 0xbc, 0xdf,
-    0xff, 0x90, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xff, 0xa0, 0x7, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x7f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x7,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x90, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x7f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x90, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x26, 0xcf, 0x70, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0,
-    0x7, 0xfd, 0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xff,
-    0xe5, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf5, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xe0, 0x7f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x37, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x57, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfd, 0x7, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3a, 0xff, 0x30, 0x7f, 0xeb,
-    0xbb, 0xbb, 0xbb, 0xbc, 0xff, 0xfe, 0x40, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0,
-    0x0,
-
-    /* U+0433 "г" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7f, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe7,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x1c, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x7d, 0xff, 0xfc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xfe, 0xcc,
-    0xc2, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x9f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf2, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x48,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x81,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff,
-    0xde, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xe7, 0x20, 0x0, 0x3, 0xaf, 0xfa, 0x0,
-    0x0, 0x0, 0x2e, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xa0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf6, 0x0, 0x6,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x10, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xaf, 0xb8, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x82, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x91, 0x0, 0x0, 0x1d,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfa,
-    0x0, 0x0, 0x1, 0xcf, 0xfb, 0x51, 0x0, 0x0,
-    0x49, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xfe, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xa6, 0x10,
-    0x0, 0x0,
-
-    /* U+0436 "ж" */
-    0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x10, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x40, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xd0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0xc,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x10, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfb, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xcc, 0xcc, 0xdf, 0xfc, 0xcc,
-    0xcc, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x40, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x6, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x80, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1, 0x0,
-    0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0,
-    0x0, 0x0, 0x9, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x70, 0x0, 0x5, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x30, 0x1, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfd, 0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9,
-
-    /* U+0437 "з" */
-    0x0, 0x0, 0x59, 0xce, 0xff, 0xec, 0x84, 0x0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xfe, 0xef, 0xff,
-    0xfd, 0x40, 0x0, 0x8, 0xfe, 0x94, 0x10, 0x0,
-    0x2, 0x6d, 0xff, 0x60, 0x0, 0x15, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x49, 0x99, 0x9a, 0xcf, 0xfa, 0x20, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xfd, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0xaf,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x20, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xd0, 0x6f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf5, 0x3, 0xef, 0xe9, 0x40,
-    0x0, 0x0, 0x15, 0xdf, 0xf6, 0x0, 0x0, 0x8e,
-    0xff, 0xfe, 0xdd, 0xef, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x4, 0x9c, 0xef, 0xfe, 0xc8, 0x30, 0x0,
-    0x0,
-
-    /* U+0438 "и" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x17, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xf1, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x17,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xcf, 0xf1, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xe1, 0xff, 0x17, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0xf, 0xf1, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
-    0xff, 0x17, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf7, 0x0, 0xf, 0xf1, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x0, 0xff, 0x17, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0xf,
-    0xf1, 0x7f, 0xa0, 0x0, 0x0, 0x7, 0xfe, 0x10,
-    0x0, 0x0, 0xff, 0x17, 0xfa, 0x0, 0x0, 0x5,
-    0xff, 0x30, 0x0, 0x0, 0xf, 0xf1, 0x7f, 0xa0,
-    0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0xff,
-    0x17, 0xfa, 0x0, 0x1, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x7f, 0xa0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x17, 0xfa, 0x0,
-    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x7f, 0xa0, 0x7f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x17, 0xfa, 0x5f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x7f, 0xcf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x17,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x17, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-
-    /* U+0439 "й" */
-    0x0, 0x0, 0x56, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0x10, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x0, 0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x40, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xee, 0x10, 0x0, 0x0, 0x8f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x62, 0x24,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xbf, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x14, 0x43, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0x17, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0xff,
-    0x17, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x1f, 0xf1, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0xff, 0x17, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x50, 0xf, 0xf1,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x70,
-    0x0, 0xff, 0x17, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0xf, 0xf1, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0xff, 0x17,
-    0xfa, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0x0, 0x0,
-    0xf, 0xf1, 0x7f, 0xa0, 0x0, 0x0, 0x5f, 0xf3,
-    0x0, 0x0, 0x0, 0xff, 0x17, 0xfa, 0x0, 0x0,
-    0x3f, 0xf5, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x7f,
-    0xa0, 0x0, 0x1e, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x17, 0xfa, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x7f, 0xa0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x17, 0xfa,
-    0x7, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x7f, 0xa5, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x17, 0xfc, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x17, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-
-    /* U+043A "к" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf4, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x4,
-    0xfe, 0x10, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x1, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0xc, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xec,
-    0xcc, 0xcc, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x9, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x90,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf6, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x40, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x10, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xcf, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xef, 0xfa, 0x0, 0x0,
-    0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x1,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x7f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x1,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x2b, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0xaf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x9f,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa,
-
-    /* U+043C "м" */
-    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x67, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf6, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x67, 0xfe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfe, 0xf6, 0x7f, 0x7d, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x8f, 0x67, 0xf7,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x38, 0xf6, 0x7f, 0x70, 0xaf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x8f, 0x67,
-    0xf7, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe1, 0x8, 0xf6, 0x7f, 0x70, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x8f,
-    0x67, 0xf7, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x8, 0xf6, 0x7f, 0x70, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0x8f, 0x67, 0xf7, 0x0, 0x0, 0xaf, 0x70, 0x0,
-    0x0, 0x6f, 0x90, 0x0, 0x8, 0xf6, 0x7f, 0x70,
-    0x0, 0x1, 0xff, 0x10, 0x0, 0x1e, 0xe0, 0x0,
-    0x0, 0x8f, 0x67, 0xf7, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x9, 0xf5, 0x0, 0x0, 0x8, 0xf6, 0x7f,
-    0x70, 0x0, 0x0, 0xd, 0xf3, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x8f, 0x67, 0xf7, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0xcf, 0x20, 0x0, 0x0, 0x8, 0xf6,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0xaf, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x8f, 0x67, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x8,
-    0xf6, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x7, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x67, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x67, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf6,
-
-    /* U+043D "н" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x7f, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xf9, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x0, 0x6, 0xad, 0xff, 0xfc, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0xef, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xfa, 0x40, 0x0, 0x2, 0x7d, 0xff,
-    0x70, 0x0, 0x0, 0x1, 0xdf, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0xbf,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x40, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x7f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0xaf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x3a, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x27, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0xb, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0, 0x0,
-    0x1d, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf7, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xa4, 0x0,
-    0x0, 0x27, 0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xee, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xdf, 0xff,
-    0xc9, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x7f, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xef, 0xfb, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb,
-
-    /* U+0440 "р" */
-    0x6f, 0x90, 0x0, 0x3, 0x9c, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x2b, 0xff,
-    0xff, 0xef, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x6f,
-    0x90, 0x4f, 0xfc, 0x51, 0x0, 0x1, 0x6c, 0xff,
-    0xa0, 0x0, 0x6, 0xf9, 0x4f, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x6f, 0xae,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x6, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x20, 0x6f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0x6, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xe0, 0x6f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x26,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf5, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x66, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x56, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf2, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfe, 0x6, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90,
-    0x6f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf2, 0x6, 0xfb, 0xee, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x6f,
-    0xa3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfb, 0x0, 0x6, 0xfa, 0x4, 0xff, 0xc5, 0x10,
-    0x0, 0x16, 0xcf, 0xfa, 0x0, 0x0, 0x6f, 0xa0,
-    0x2, 0xbf, 0xff, 0xfe, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x39, 0xcf, 0xff,
-    0xda, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x0, 0x6, 0xad, 0xff, 0xfd, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xee,
-    0xff, 0xff, 0xd4, 0x0, 0x0, 0x1, 0xcf, 0xfb,
-    0x51, 0x0, 0x2, 0x6d, 0xff, 0x60, 0x0, 0x1d,
-    0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0xbf, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xd2, 0x5, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xd2, 0x0, 0x1d, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x1,
-    0xcf, 0xfb, 0x51, 0x0, 0x2, 0x6d, 0xff, 0x60,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xee, 0xff, 0xff,
-    0xd4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xad, 0xff,
-    0xfd, 0x94, 0x0, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0xee, 0xee, 0xee, 0xee, 0xff,
-    0xfe, 0xee, 0xee, 0xee, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x4, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0xdf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf5, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xd0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x6,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x4f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf8, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x2f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x91, 0x0, 0x6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xed, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8c, 0xff, 0xea,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x59, 0xce, 0xff, 0xff, 0xec, 0xa6,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfc, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xa5, 0x20,
-    0xe, 0xf2, 0x2, 0x59, 0xef, 0xfb, 0x10, 0x0,
-    0x0, 0x1c, 0xff, 0x70, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x5, 0xef, 0xe2, 0x0, 0x0, 0xcf,
-    0xe2, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x1b, 0xfe, 0x10, 0x6, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x8f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x8f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x6, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0xbf, 0xe2, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x1c,
-    0xfd, 0x10, 0x0, 0x1c, 0xff, 0x70, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x6, 0xef, 0xe2, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xa5, 0x20, 0xe, 0xf2,
-    0x1, 0x49, 0xef, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x69, 0xce, 0xff, 0xff, 0xec, 0x96, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfc, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0x10, 0x0, 0xc, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
-    0x0, 0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x70, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xe1, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x1e,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x4b, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x9e, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1,
-    0x0, 0x7f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xf7, 0x0, 0x0, 0x1, 0xdf,
-    0x70, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x7, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x0,
-    0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-
-    /* U+0446 "ц" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x7f, 0xfd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfe,
-    0xdd, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x87,
-
-    /* U+0447 "ч" */
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x4e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x4e, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x4e,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x4e, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x4b, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x6f,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0xef, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x8f, 0xf4, 0x3, 0xef, 0xf8, 0x31, 0x0, 0x24,
-    0x8c, 0xff, 0xff, 0x40, 0x1, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4d, 0xf4, 0x0, 0x0, 0x27,
-    0xab, 0xcb, 0x97, 0x30, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4,
-
-    /* U+0448 "ш" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x7f, 0xfd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xed, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0449 "щ" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x7f, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xff, 0xed, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xde, 0xff, 0xdd, 0xd6, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0xee, 0xee,
-    0xef, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0xaa, 0xaa,
-    0xaa, 0xbd, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2a,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xff, 0xba,
-    0xaa, 0xaa, 0xab, 0xef, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xa5, 0x0, 0x0,
-
-    /* U+044B "ы" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x7f, 0xd9, 0x99, 0x99,
-    0x99, 0xbe, 0xff, 0xd3, 0x0, 0x0, 0x6, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
-    0x30, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x6, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x6, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x6, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf6, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0, 0x6, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x6, 0xfa, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0xfd, 0x10, 0x0, 0x6, 0xfa,
-    0x7f, 0xea, 0xaa, 0xaa, 0xab, 0xcf, 0xff, 0xa1,
-    0x0, 0x0, 0x6, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x83, 0x0, 0x0, 0x0, 0x6, 0xfa,
-
-    /* U+044C "ь" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0,
-    0x0, 0x7f, 0xd9, 0x99, 0x99, 0x99, 0xbd, 0xff,
-    0xe4, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x2a, 0xff, 0x40, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xe0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf5, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf3, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xc0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0xfe, 0x20, 0x7f, 0xea, 0xaa, 0xaa,
-    0xab, 0xcf, 0xff, 0xc2, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xec, 0x83, 0x0, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x0, 0x48, 0xce, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xdc, 0xcd,
-    0xff, 0xfd, 0x40, 0x0, 0x0, 0xa, 0xff, 0xa4,
-    0x0, 0x0, 0x0, 0x5b, 0xff, 0x90, 0x0, 0x2,
-    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xb0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x7, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xac, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xf8, 0x0, 0x2e, 0xb2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xfb, 0x0, 0x0,
-    0xbf, 0xf9, 0x40, 0x0, 0x0, 0x15, 0xcf, 0xf9,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0xdc, 0xef,
-    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8c,
-    0xef, 0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
-    0xce, 0xff, 0xeb, 0x71, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xee, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xf8, 0x30, 0x0,
-    0x4, 0x9f, 0xfc, 0x10, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xd1, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xfb, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0x7f, 0xa0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x7f, 0xa0, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x7f, 0xa0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x7f,
-    0xa0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf9, 0x7f, 0xfe, 0xee,
-    0xee, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x7f, 0xa0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x7f, 0xa0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0x7f, 0xa0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0x7f, 0xa0, 0x0, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x7f, 0xa0, 0x0, 0x0, 0x8, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x40, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xfb, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xd1, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xe8, 0x20, 0x0, 0x3,
-    0x9f, 0xfc, 0x10, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xdd, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xeb, 0x71, 0x0,
-    0x0, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x5e, 0xff, 0xfe, 0xdd, 0xdd,
-    0xdd, 0xde, 0xfb, 0x0, 0x7f, 0xfb, 0x51, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x4f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb3, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0xa,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xb0, 0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x4f, 0xfc, 0x62, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x2a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x1,
-    0xef, 0xa9, 0x99, 0x99, 0x99, 0xaf, 0xb0, 0x0,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0xc, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x4, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb1,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfb,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x0, 0x28, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce,
-    0xff, 0xda, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x19, 0xff, 0xff, 0xde, 0xff, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xe7, 0x20, 0x0, 0x3,
-    0xaf, 0xfa, 0x0, 0x0, 0x0, 0x2e, 0xfa, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xa0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf6, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xc0, 0x7f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xaf, 0xb8, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x9f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x91,
-    0x0, 0x0, 0x1d, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xfa, 0x0, 0x0, 0x1, 0xcf, 0xfb,
-    0x51, 0x0, 0x0, 0x49, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x6, 0xef, 0xff, 0xfe, 0xef, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff,
-    0xfd, 0xa6, 0x10, 0x0, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xa0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xce, 0xff, 0xda, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xde, 0xff, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x2, 0xef, 0xe7, 0x20,
-    0x0, 0x3, 0xaf, 0xfa, 0x0, 0x0, 0x0, 0x2e,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x3, 0xef, 0xa0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xf6, 0x0, 0x6, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xc0, 0x7f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xaf, 0xb8,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x82, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x91, 0x0, 0x0, 0x1d, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xfa, 0x0, 0x0, 0x1,
-    0xcf, 0xfb, 0x51, 0x0, 0x0, 0x49, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xfe, 0xef,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0x3, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x19, 0x99, 0x9c, 0xfd,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x30, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x1,
-    0x6b, 0xef, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0x0, 0x6f, 0xff, 0xfe, 0xef,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0xa, 0xfe, 0x72, 0x0, 0x0, 0x39, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0x8f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xfb, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x50, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xdd,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xea, 0x30, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x88, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x78, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7f, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe7,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfe, 0xb8,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xfe,
-    0xdd, 0xef, 0xff, 0xd4, 0x0, 0x0, 0x0, 0xbf,
-    0xfb, 0x50, 0x0, 0x0, 0x15, 0xbf, 0xf9, 0x0,
-    0x0, 0xcf, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0xd1, 0x0, 0xaf, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x5f, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0x60, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0xc, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xde, 0x10,
-    0x0, 0xb, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x5b,
-    0xff, 0x90, 0x0, 0x0, 0x5, 0xef, 0xff, 0xdc,
-    0xce, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xdf, 0xff, 0xeb, 0x83, 0x0, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xfd, 0xa6, 0x10,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xdd, 0xef, 0xff,
-    0xfa, 0x10, 0x0, 0xbf, 0xf7, 0x20, 0x0, 0x0,
-    0x48, 0xef, 0x90, 0x6, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0x10, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfd, 0x73, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xfd, 0xa7,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7b, 0xef,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x47, 0xcf, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x6f, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf1, 0x6f, 0xff, 0x94, 0x10, 0x0,
-    0x0, 0x4a, 0xff, 0x50, 0x2, 0xaf, 0xff, 0xff,
-    0xdd, 0xef, 0xff, 0xd4, 0x0, 0x0, 0x1, 0x6a,
-    0xde, 0xff, 0xec, 0x95, 0x0, 0x0,
-
-    /* U+0456 "і" */
-    0x1, 0x52, 0x0, 0xdf, 0xf2, 0x1f, 0xff, 0x40,
-    0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x7, 0xfa, 0x0, 0x7f, 0xa0, 0x7, 0xfa,
-    0x0, 0x7f, 0xa0, 0x7, 0xfa, 0x0, 0x7f, 0xa0,
-    0x7, 0xfa, 0x0, 0x7f, 0xa0, 0x7, 0xfa, 0x0,
-    0x7f, 0xa0, 0x7, 0xfa, 0x0, 0x7f, 0xa0, 0x7,
-    0xfa, 0x0, 0x7f, 0xa0, 0x7, 0xfa, 0x0, 0x7f,
-    0xa0, 0x7, 0xfa, 0x0, 0x7f, 0xa0, 0x7, 0xfa,
-    0x0, 0x7f, 0xa0, 0x7, 0xfa, 0x0,
-
-    /* U+0457 "ї" */
-    0x3e, 0xd1, 0x1, 0xde, 0x38, 0xff, 0x50, 0x5f,
-    0xf8, 0x2e, 0xc1, 0x1, 0xce, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x15, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x3a, 0x20, 0x0, 0x2d, 0xfc, 0x0, 0x9f, 0xfe,
-    0xce, 0xff, 0xd1, 0x0, 0x5, 0xbe, 0xff, 0xc7,
-    0x0, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xda, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xe9, 0x99, 0x99, 0x99, 0xbd, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x9f, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x1, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfd, 0x0,
-    0x2, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x3, 0x8e,
-    0xff, 0x30, 0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xee, 0xee, 0xee,
-    0xff, 0xff, 0xfc, 0x20, 0x9, 0xff, 0xb3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xec, 0x94, 0x0, 0x0,
-
-    /* U+045A "њ" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xed,
-    0xdd, 0xdd, 0xdd, 0xca, 0x71, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x25, 0xbf,
-    0xfb, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xc0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xb0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xf9, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfb,
-    0xaa, 0xaa, 0xaa, 0xac, 0xff, 0xf7, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x71, 0x0,
-    0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x11, 0x18, 0xfb, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x1, 0x44, 0x44, 0x4a, 0xfc,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x1,
-    0x6b, 0xef, 0xfe, 0xc8, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x6, 0xff, 0xff, 0xee,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0xa, 0xfe, 0x72, 0x0, 0x0, 0x39, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa8, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfa, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x30,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x88, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xb1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xc0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x10, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0xc, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xec, 0xcc, 0xcc, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x6f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x9, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x90, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf2, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfd, 0x10, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-
-    /* U+045D "ѝ" */
-    0x0, 0x0, 0x68, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0x17, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0xff,
-    0x17, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x1f, 0xf1, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0xff, 0x17, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x50, 0xf, 0xf1,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x70,
-    0x0, 0xff, 0x17, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0xf, 0xf1, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0xff, 0x17,
-    0xfa, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0x0, 0x0,
-    0xf, 0xf1, 0x7f, 0xa0, 0x0, 0x0, 0x5f, 0xf3,
-    0x0, 0x0, 0x0, 0xff, 0x17, 0xfa, 0x0, 0x0,
-    0x3f, 0xf5, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x7f,
-    0xa0, 0x0, 0x1e, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x17, 0xfa, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x7f, 0xa0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x17, 0xfa,
-    0x7, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x7f, 0xa5, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x17, 0xfc, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x7f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x17, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x0, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xf9, 0x42, 0x25, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x34, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0x0, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0,
-    0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf2, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x91, 0x0, 0x6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xed, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x8c, 0xff, 0xea, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x27, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x27, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x27,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf2, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x27, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x27, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x27, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf2, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x27, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf2, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x27, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x27, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x27, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x7f, 0xfd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x27,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x82, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x47, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x7f, 0xfe, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0x37, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+2014 "—" */
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff,
-
-    /* U+2018 "‘" */
-    0x0, 0xbd, 0x0, 0xf9, 0x4, 0xf6, 0x8, 0xf2,
-    0xd, 0xe0, 0x1f, 0xb0, 0x6f, 0xf6, 0x8f, 0xfe,
-    0x5f, 0xfb, 0x5, 0x71,
-
-    /* U+2019 "’" */
-    0x1d, 0xf6, 0x8f, 0xfe, 0x5f, 0xfe, 0x7, 0xfa,
-    0x6, 0xf6, 0xa, 0xf1, 0xe, 0xc0, 0x1f, 0x80,
-    0x5f, 0x30, 0x48, 0x0,
-
-    /* U+201A "‚" */
-    0x5, 0x71, 0x5f, 0xfc, 0x8f, 0xff, 0x1d, 0xfc,
-    0x5, 0xf8, 0x8, 0xf3, 0xc, 0xe0, 0xf, 0xa0,
-    0x3f, 0x60, 0x7f, 0x10,
-
-    /* U+201C "“" */
-    0x0, 0xbd, 0x0, 0x0, 0x4f, 0x30, 0xf, 0x90,
-    0x0, 0x8, 0xf0, 0x4, 0xf6, 0x0, 0x0, 0xdc,
-    0x0, 0x8f, 0x20, 0x0, 0x1f, 0x90, 0xd, 0xe0,
-    0x0, 0x6, 0xf5, 0x1, 0xfb, 0x0, 0x0, 0xbf,
-    0x20, 0x6f, 0xf6, 0x0, 0xf, 0xfb, 0x8, 0xff,
-    0xe0, 0x2, 0xff, 0xf4, 0x5f, 0xfb, 0x0, 0xe,
-    0xff, 0x20, 0x57, 0x10, 0x0, 0x27, 0x30,
-
-    /* U+201D "”" */
-    0x1d, 0xf6, 0x0, 0x8, 0xfb, 0x8, 0xff, 0xe0,
-    0x1, 0xff, 0xf5, 0x5f, 0xfe, 0x0, 0xe, 0xff,
-    0x40, 0x7f, 0xa0, 0x0, 0x2e, 0xf1, 0x6, 0xf6,
-    0x0, 0x0, 0xfc, 0x0, 0xaf, 0x10, 0x0, 0x3f,
-    0x80, 0xe, 0xc0, 0x0, 0x7, 0xf3, 0x1, 0xf8,
-    0x0, 0x0, 0xae, 0x0, 0x5f, 0x30, 0x0, 0xe,
-    0xa0, 0x4, 0x80, 0x0, 0x0, 0x83, 0x0,
-
-    /* U+2026 "…" */
-    0x6, 0x81, 0x0, 0x0, 0x1, 0x86, 0x0, 0x0,
-    0x0, 0x48, 0x30, 0x6f, 0xfc, 0x0, 0x0, 0xc,
-    0xff, 0x60, 0x0, 0x2, 0xff, 0xf1, 0x8f, 0xfe,
-    0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x4, 0xff,
-    0xf2, 0x1d, 0xf6, 0x0, 0x0, 0x5, 0xfd, 0x10,
-    0x0, 0x0, 0xbf, 0x90,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xde, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4b, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x84,
-    0x10, 0x0, 0x1, 0x49, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xc4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x1,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x15, 0xff, 0xa1, 0x11, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x44, 0x7f,
-    0xfc, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x40, 0x0, 0xb, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x30, 0x0, 0x0, 0x4, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdc,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x29, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xc6, 0x20, 0x0, 0x0, 0x26,
-    0xbf, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xfe, 0xee, 0xff, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce,
-    0xff, 0xfe, 0xb8, 0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x66, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x78, 0x85, 0x10, 0x0, 0xe, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x0, 0x7e, 0xfe, 0xde,
-    0xff, 0x90, 0x0, 0xef, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0xbf, 0xa2, 0x0, 0x1, 0x8f, 0xc1,
-    0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0xef, 0xef,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x3e, 0xf4, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf7, 0xef, 0x33, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x7f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xf, 0xae, 0xf3,
-    0x6, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfa, 0xef, 0x30, 0xa, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x8e, 0xf3, 0x0, 0xc, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x1,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0xef,
-    0x30, 0x0, 0x2e, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x8, 0xf5, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0xe, 0xf3, 0x0, 0x0,
-    0x4f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0xc, 0xf8, 0x10, 0x0, 0x7,
-    0xfe, 0x10, 0xef, 0x30, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xcb, 0xcf, 0xfa, 0x10, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0xbf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x1,
-    0x69, 0xba, 0x72, 0x0, 0x0, 0xef, 0x30, 0x0,
-    0x0, 0x1, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x5, 0xff, 0x50,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0x2f, 0xf0, 0x0, 0x0, 0x46, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x50, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfd, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfa, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x12,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xe1, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xc0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x92, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x8f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 173, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 169, .box_w = 5, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 73, .adv_w = 240, .box_w = 9, .box_h = 11, .ofs_x = 3, .ofs_y = 18},
-    {.bitmap_index = 123, .adv_w = 464, .box_w = 27, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 515, .adv_w = 409, .box_w = 22, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 955, .adv_w = 549, .box_w = 32, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1419, .adv_w = 440, .box_w = 26, .box_h = 30, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 1809, .adv_w = 130, .box_w = 3, .box_h = 11, .ofs_x = 3, .ofs_y = 18},
-    {.bitmap_index = 1826, .adv_w = 216, .box_w = 8, .box_h = 39, .ofs_x = 4, .ofs_y = -8},
-    {.bitmap_index = 1982, .adv_w = 216, .box_w = 7, .box_h = 39, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 2119, .adv_w = 252, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 16},
-    {.bitmap_index = 2224, .adv_w = 382, .box_w = 18, .box_h = 18, .ofs_x = 3, .ofs_y = 6},
-    {.bitmap_index = 2386, .adv_w = 134, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 2406, .adv_w = 256, .box_w = 12, .box_h = 2, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 2418, .adv_w = 134, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2426, .adv_w = 215, .box_w = 16, .box_h = 40, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 2746, .adv_w = 442, .box_w = 24, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3094, .adv_w = 237, .box_w = 10, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3239, .adv_w = 378, .box_w = 22, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3558, .adv_w = 375, .box_w = 22, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3877, .adv_w = 439, .box_w = 26, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4254, .adv_w = 375, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4559, .adv_w = 405, .box_w = 22, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4878, .adv_w = 390, .box_w = 22, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5197, .adv_w = 425, .box_w = 23, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5531, .adv_w = 405, .box_w = 22, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5850, .adv_w = 134, .box_w = 4, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5894, .adv_w = 134, .box_w = 4, .box_h = 28, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 5950, .adv_w = 382, .box_w = 18, .box_h = 17, .ofs_x = 3, .ofs_y = 6},
-    {.bitmap_index = 6103, .adv_w = 382, .box_w = 18, .box_h = 11, .ofs_x = 3, .ofs_y = 9},
-    {.bitmap_index = 6202, .adv_w = 382, .box_w = 18, .box_h = 17, .ofs_x = 3, .ofs_y = 6},
-    {.bitmap_index = 6355, .adv_w = 378, .box_w = 21, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6660, .adv_w = 694, .box_w = 40, .box_h = 37, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 7400, .adv_w = 474, .box_w = 30, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7835, .adv_w = 505, .box_w = 25, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 8198, .adv_w = 474, .box_w = 27, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8590, .adv_w = 555, .box_w = 28, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 8996, .adv_w = 450, .box_w = 21, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 9301, .adv_w = 424, .box_w = 20, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 9591, .adv_w = 519, .box_w = 27, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9983, .adv_w = 547, .box_w = 25, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 10346, .adv_w = 198, .box_w = 3, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 10390, .adv_w = 330, .box_w = 17, .box_h = 29, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 10637, .adv_w = 472, .box_w = 25, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 11000, .adv_w = 393, .box_w = 20, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 11290, .adv_w = 642, .box_w = 31, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 11740, .adv_w = 547, .box_w = 25, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 12103, .adv_w = 563, .box_w = 31, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12553, .adv_w = 480, .box_w = 23, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 12887, .adv_w = 563, .box_w = 33, .box_h = 34, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 13448, .adv_w = 484, .box_w = 23, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 13782, .adv_w = 409, .box_w = 22, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14101, .adv_w = 378, .box_w = 24, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14449, .adv_w = 533, .box_w = 25, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 14812, .adv_w = 462, .box_w = 29, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15233, .adv_w = 738, .box_w = 44, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15871, .adv_w = 431, .box_w = 27, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16263, .adv_w = 420, .box_w = 27, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16655, .adv_w = 434, .box_w = 25, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17018, .adv_w = 206, .box_w = 7, .box_h = 39, .ofs_x = 5, .ofs_y = -8},
-    {.bitmap_index = 17155, .adv_w = 215, .box_w = 17, .box_h = 40, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 17495, .adv_w = 206, .box_w = 8, .box_h = 39, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 17651, .adv_w = 383, .box_w = 18, .box_h = 17, .ofs_x = 3, .ofs_y = 6},
-    {.bitmap_index = 17804, .adv_w = 336, .box_w = 21, .box_h = 2, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 17825, .adv_w = 403, .box_w = 9, .box_h = 5, .ofs_x = 6, .ofs_y = 25},
-    {.bitmap_index = 17848, .adv_w = 392, .box_w = 19, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18057, .adv_w = 454, .box_w = 23, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18414, .adv_w = 373, .box_w = 20, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18634, .adv_w = 454, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18975, .adv_w = 401, .box_w = 22, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19217, .adv_w = 220, .box_w = 16, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19465, .adv_w = 458, .box_w = 23, .box_h = 30, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 19810, .adv_w = 452, .box_w = 21, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20136, .adv_w = 175, .box_w = 5, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 20214, .adv_w = 179, .box_w = 12, .box_h = 39, .ofs_x = -4, .ofs_y = -8},
-    {.bitmap_index = 20448, .adv_w = 392, .box_w = 21, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20774, .adv_w = 175, .box_w = 3, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20821, .adv_w = 715, .box_w = 37, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 21228, .adv_w = 452, .box_w = 21, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 21459, .adv_w = 417, .box_w = 22, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21701, .adv_w = 454, .box_w = 23, .box_h = 30, .ofs_x = 4, .ofs_y = -8},
-    {.bitmap_index = 22046, .adv_w = 454, .box_w = 22, .box_h = 30, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 22376, .adv_w = 265, .box_w = 11, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 22497, .adv_w = 321, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22695, .adv_w = 267, .box_w = 16, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22911, .adv_w = 450, .box_w = 20, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 23131, .adv_w = 355, .box_w = 23, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23384, .adv_w = 579, .box_w = 36, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23780, .adv_w = 349, .box_w = 21, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24011, .adv_w = 355, .box_w = 25, .box_h = 30, .ofs_x = -2, .ofs_y = -8},
-    {.bitmap_index = 24386, .adv_w = 338, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24595, .adv_w = 215, .box_w = 11, .box_h = 39, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 24810, .adv_w = 196, .box_w = 3, .box_h = 39, .ofs_x = 5, .ofs_y = -8},
-    {.bitmap_index = 24869, .adv_w = 215, .box_w = 11, .box_h = 39, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 25084, .adv_w = 382, .box_w = 20, .box_h = 6, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 25144, .adv_w = 306, .box_w = 16, .box_h = 16, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 25272, .adv_w = 306, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 25400, .adv_w = 439, .box_w = 21, .box_h = 37, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 25789, .adv_w = 439, .box_w = 21, .box_h = 36, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 26167, .adv_w = 550, .box_w = 33, .box_h = 30, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26662, .adv_w = 382, .box_w = 19, .box_h = 37, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 27014, .adv_w = 474, .box_w = 26, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27391, .adv_w = 417, .box_w = 22, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27710, .adv_w = 204, .box_w = 3, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 27754, .adv_w = 198, .box_w = 11, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 27952, .adv_w = 347, .box_w = 16, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 28184, .adv_w = 797, .box_w = 48, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28880, .adv_w = 798, .box_w = 44, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 29518, .adv_w = 555, .box_w = 33, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29997, .adv_w = 467, .box_w = 24, .box_h = 37, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 30441, .adv_w = 554, .box_w = 25, .box_h = 37, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 30904, .adv_w = 451, .box_w = 27, .box_h = 37, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 31404, .adv_w = 541, .box_w = 24, .box_h = 36, .ofs_x = 5, .ofs_y = -7},
-    {.bitmap_index = 31836, .adv_w = 493, .box_w = 30, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 32271, .adv_w = 486, .box_w = 23, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 32605, .adv_w = 504, .box_w = 24, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 32953, .adv_w = 382, .box_w = 19, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 33229, .adv_w = 528, .box_w = 32, .box_h = 36, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 33805, .adv_w = 439, .box_w = 21, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 34110, .adv_w = 669, .box_w = 40, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34690, .adv_w = 411, .box_w = 24, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 35038, .adv_w = 554, .box_w = 25, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 35401, .adv_w = 554, .box_w = 25, .box_h = 37, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 35864, .adv_w = 467, .box_w = 24, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 36212, .adv_w = 525, .box_w = 28, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36618, .adv_w = 648, .box_w = 31, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 37068, .adv_w = 552, .box_w = 25, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 37431, .adv_w = 573, .box_w = 32, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 37895, .adv_w = 556, .box_w = 25, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 38258, .adv_w = 474, .box_w = 23, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 38592, .adv_w = 480, .box_w = 27, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 38984, .adv_w = 386, .box_w = 24, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 39332, .adv_w = 451, .box_w = 27, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39724, .adv_w = 611, .box_w = 34, .box_h = 31, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 40251, .adv_w = 427, .box_w = 25, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40614, .adv_w = 554, .box_w = 29, .box_h = 36, .ofs_x = 5, .ofs_y = -7},
-    {.bitmap_index = 41136, .adv_w = 479, .box_w = 23, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 41470, .adv_w = 734, .box_w = 36, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 41992, .adv_w = 749, .box_w = 41, .box_h = 36, .ofs_x = 5, .ofs_y = -7},
-    {.bitmap_index = 42730, .adv_w = 547, .box_w = 33, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 43209, .adv_w = 649, .box_w = 31, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 43659, .adv_w = 476, .box_w = 23, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 43993, .adv_w = 474, .box_w = 26, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 44370, .adv_w = 730, .box_w = 38, .box_h = 29, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 44921, .adv_w = 492, .box_w = 23, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 45255, .adv_w = 388, .box_w = 19, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 45464, .adv_w = 441, .box_w = 23, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 45832, .adv_w = 405, .box_w = 19, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 46041, .adv_w = 312, .box_w = 16, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 46217, .adv_w = 429, .box_w = 26, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 46581, .adv_w = 409, .box_w = 22, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 46823, .adv_w = 542, .box_w = 33, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 47186, .adv_w = 353, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 47395, .adv_w = 458, .box_w = 21, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 47626, .adv_w = 458, .box_w = 21, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 47952, .adv_w = 382, .box_w = 20, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48172, .adv_w = 419, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 48414, .adv_w = 527, .box_w = 25, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48689, .adv_w = 450, .box_w = 20, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 48909, .adv_w = 425, .box_w = 23, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 49162, .adv_w = 452, .box_w = 20, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 49382, .adv_w = 460, .box_w = 23, .box_h = 30, .ofs_x = 4, .ofs_y = -8},
-    {.bitmap_index = 49727, .adv_w = 374, .box_w = 20, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 49947, .adv_w = 306, .box_w = 21, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 50178, .adv_w = 367, .box_w = 24, .box_h = 30, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 50538, .adv_w = 516, .box_w = 28, .box_h = 39, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 51084, .adv_w = 345, .box_w = 21, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 51315, .adv_w = 456, .box_w = 23, .box_h = 28, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 51637, .adv_w = 397, .box_w = 19, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 51846, .adv_w = 617, .box_w = 31, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 52187, .adv_w = 617, .box_w = 34, .box_h = 27, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 52646, .adv_w = 407, .box_w = 25, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 52921, .adv_w = 515, .box_w = 24, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 53185, .adv_w = 372, .box_w = 18, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 53383, .adv_w = 382, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 53614, .adv_w = 575, .box_w = 30, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 53944, .adv_w = 404, .box_w = 19, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 54153, .adv_w = 417, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 54494, .adv_w = 409, .box_w = 22, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 54813, .adv_w = 448, .box_w = 26, .box_h = 40, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 55333, .adv_w = 312, .box_w = 16, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 55581, .adv_w = 382, .box_w = 21, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 55812, .adv_w = 349, .box_w = 18, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 56010, .adv_w = 178, .box_w = 5, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 56088, .adv_w = 175, .box_w = 9, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 56219, .adv_w = 179, .box_w = 12, .box_h = 39, .ofs_x = -4, .ofs_y = -8},
-    {.bitmap_index = 56453, .adv_w = 612, .box_w = 37, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 56860, .adv_w = 630, .box_w = 35, .box_h = 22, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 57245, .adv_w = 448, .box_w = 27, .box_h = 31, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 57664, .adv_w = 382, .box_w = 20, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 57974, .adv_w = 458, .box_w = 21, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 58300, .adv_w = 367, .box_w = 24, .box_h = 39, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 58768, .adv_w = 426, .box_w = 19, .box_h = 28, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 59034, .adv_w = 383, .box_w = 19, .box_h = 36, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 59376, .adv_w = 292, .box_w = 15, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 59579, .adv_w = 336, .box_w = 21, .box_h = 2, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 59600, .adv_w = 672, .box_w = 42, .box_h = 2, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 59642, .adv_w = 134, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = 21},
-    {.bitmap_index = 59662, .adv_w = 134, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = 21},
-    {.bitmap_index = 59682, .adv_w = 134, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 59702, .adv_w = 237, .box_w = 11, .box_h = 10, .ofs_x = 2, .ofs_y = 21},
-    {.bitmap_index = 59757, .adv_w = 237, .box_w = 11, .box_h = 10, .ofs_x = 2, .ofs_y = 21},
-    {.bitmap_index = 59812, .adv_w = 409, .box_w = 22, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 59856, .adv_w = 555, .box_w = 27, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 60248, .adv_w = 804, .box_w = 43, .box_h = 30, .ofs_x = 5, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_42;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_42 = {
-#else
-lv_font_t montserrat_cyrillic_42 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 45,          /*The maximum line height required by the font*/
-    .base_line = 8,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -4,
-    .underline_thickness = 2,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_42,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_42*/
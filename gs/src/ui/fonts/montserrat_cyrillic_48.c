@@ -1,10674 +0,0 @@
-/*******************************************************************************
- * Size: 48 px
- * Bpp: 4
- * Opts: --bpp 4 --size 48 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols "№" --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_48.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_48
-#define MONTSERRAT_CYRILLIC_48 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_48
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x5f, 0xf6, 0x5, 0xff, 0x60, 0x4f, 0xf6, 0x4,
-    0xff, 0x50, 0x4f, 0xf5, 0x3, 0xff, 0x50, 0x3f,
-    0xf4, 0x3, 0xff, 0x40, 0x2f, 0xf4, 0x2, 0xff,
-    0x30, 0x2f, 0xf3, 0x1, 0xff, 0x30, 0x1f, 0xf2,
-    0x1, 0xff, 0x20, 0xf, 0xf2, 0x0, 0xff, 0x10,
-    0xf, 0xf1, 0x0, 0xff, 0x10, 0xf, 0xf0, 0x0,
-    0xff, 0x0, 0xe, 0xf0, 0x0, 0xef, 0x0, 0xe,
-    0xf0, 0x0, 0x45, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xcd, 0x40, 0xdf, 0xff, 0xd, 0xff, 0xf0,
-    0x4e, 0xe5, 0x0,
-
-    /* U+0022 "\"" */
-    0x7f, 0xc0, 0x0, 0x0, 0xaf, 0x86, 0xfb, 0x0,
-    0x0, 0xa, 0xf8, 0x6f, 0xb0, 0x0, 0x0, 0xaf,
-    0x76, 0xfb, 0x0, 0x0, 0x9, 0xf7, 0x6f, 0xb0,
-    0x0, 0x0, 0x9f, 0x75, 0xfa, 0x0, 0x0, 0x9,
-    0xf7, 0x5f, 0xa0, 0x0, 0x0, 0x9f, 0x65, 0xfa,
-    0x0, 0x0, 0x8, 0xf6, 0x5f, 0xa0, 0x0, 0x0,
-    0x8f, 0x64, 0xf9, 0x0, 0x0, 0x8, 0xf6, 0x4f,
-    0x90, 0x0, 0x0, 0x8f, 0x54, 0xf9, 0x0, 0x0,
-    0x7, 0xf5, 0x14, 0x20, 0x0, 0x0, 0x24, 0x10,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xee, 0xee, 0xee,
-    0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfe,
-    0xee, 0xee, 0xe8, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x6, 0xee, 0xee, 0xee,
-    0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfe,
-    0xee, 0xee, 0xee, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b,
-    0xdf, 0xff, 0xfd, 0xb8, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xd8, 0x55, 0xfb, 0x35, 0x7b, 0xff, 0xff, 0x91,
-    0x0, 0x0, 0xbf, 0xfc, 0x30, 0x0, 0x2f, 0xa0,
-    0x0, 0x0, 0x5c, 0xff, 0x20, 0x0, 0x7f, 0xf9,
-    0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x4,
-    0x80, 0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x30, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0x0, 0x0,
-    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x10, 0x0, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf8, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xfc, 0x30, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xd7, 0x22,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4c, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c,
-    0xff, 0xff, 0xfe, 0xa6, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x4, 0x9e, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0,
-    0x0, 0x5, 0xdf, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x8f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x70, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x9f,
-    0xf2, 0x5f, 0xfb, 0x20, 0x0, 0x0, 0x2, 0xfa,
-    0x0, 0x0, 0x0, 0x6f, 0xf9, 0x0, 0x8f, 0xff,
-    0xa4, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2, 0xaf,
-    0xfc, 0x0, 0x0, 0x3c, 0xff, 0xfe, 0xa6, 0x44,
-    0xfb, 0x35, 0x8c, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9c,
-    0xef, 0xff, 0xed, 0xb7, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x85, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x5b, 0xef, 0xfb, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xfd, 0x86, 0x8c, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x8, 0xf7,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x1,
-    0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x60,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x10, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x10, 0x0,
-    0x0, 0xb, 0xf7, 0x0, 0x1, 0xee, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xe6, 0x10, 0x15, 0xdf, 0xa0, 0x0, 0xb, 0xf5,
-    0x0, 0x0, 0x5, 0x89, 0x96, 0x10, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x89, 0x85, 0x10,
-    0x0, 0x2, 0xfe, 0x10, 0x0, 0x6f, 0xe7, 0x20,
-    0x15, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x3, 0xfd,
-    0x10, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x7f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf2, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x60, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x40, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0x0, 0x4e, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfd, 0x87, 0x7c, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0xef, 0xfc, 0x70,
-    0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfd, 0xef, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf9, 0x20, 0x0, 0x5, 0xdf, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0,
-    0x4, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x20, 0x0, 0x8, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xfd, 0x10, 0x4d, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xfc, 0xaf, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xf9, 0x5f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xd3, 0x0, 0x4f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x90, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x15, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x6f, 0xf9, 0x0, 0x0, 0x0, 0x6,
-    0xfb, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x2f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf7, 0x0, 0x4, 0xfd, 0x0, 0x6, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x0, 0xbf, 0x80, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x3f,
-    0xf1, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0xf8, 0x0,
-    0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf4, 0x0, 0x0, 0x8, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xdf, 0xf4, 0x0, 0x0, 0xb, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0x60,
-    0xbf, 0xf3, 0x0, 0x0, 0xa, 0xff, 0xf9, 0x52,
-    0x0, 0x2, 0x48, 0xdf, 0xfd, 0x30, 0x0, 0xcf,
-    0xe3, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0xcf, 0xe2,
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xfe, 0xb8,
-    0x40, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xa0,
-
-    /* U+0027 "'" */
-    0x7f, 0xc6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xb5,
-    0xfa, 0x5f, 0xa5, 0xfa, 0x5f, 0xa4, 0xf9, 0x4f,
-    0x94, 0xf9, 0x14, 0x20,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x1, 0xff,
-    0x40, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0, 0x1f,
-    0xf4, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x2f, 0xf3, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0x1f,
-    0xf3, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0x0, 0x8f, 0xd0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0, 0x9, 0xfb,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x9,
-    0xfc, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0,
-    0x8, 0xfd, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x4f, 0xf1,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0xf,
-    0xf6, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0xd, 0xf7,
-    0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x1f,
-    0xf4, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-
-    /* U+0029 ")" */
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0x0, 0x0, 0xd, 0xf7,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x1, 0xff, 0x40,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x8f,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0xbf, 0xb0,
-    0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xe0, 0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0,
-    0x0, 0x5f, 0xf1, 0x0, 0x0, 0x5, 0xff, 0x10,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0,
-    0xb, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0xf, 0xf6, 0x0, 0x0, 0x2, 0xff, 0x30,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x1f,
-    0xf4, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x0,
-    0xaf, 0x90, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0,
-    0x7, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0,
-    0x0, 0x5f, 0xe0, 0x0, 0x0, 0xd, 0xf6, 0x0,
-    0x0, 0x6, 0xfd, 0x0, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x14, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x41,
-    0x9f, 0xb2, 0x0, 0xd, 0xd0, 0x0, 0x2b, 0xf9,
-    0x2a, 0xff, 0x91, 0xd, 0xd0, 0x19, 0xff, 0xb2,
-    0x0, 0x3c, 0xfe, 0x6d, 0xd6, 0xef, 0xc4, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x7f, 0xfc, 0x3d, 0xc3, 0xcf, 0xf7, 0x0,
-    0x5d, 0xfe, 0x50, 0xd, 0xd0, 0x5, 0xef, 0xe5,
-    0x7f, 0x80, 0x0, 0xd, 0xd0, 0x0, 0x8, 0xf7,
-    0x1, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x7, 0xfd, 0x32, 0xff, 0xfb, 0x2f, 0xff, 0xc0,
-    0x7f, 0xf9, 0x0, 0xcf, 0x40, 0xf, 0xf0, 0x4,
-    0xfb, 0x0, 0x8f, 0x60, 0xb, 0xf1, 0x0, 0xfd,
-    0x0, 0x18, 0x40, 0x0,
-
-    /* U+002D "-" */
-    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+002E "." */
-    0x0, 0x0, 0x0, 0x8f, 0xd3, 0x2f, 0xff, 0xb2,
-    0xff, 0xfb, 0x7, 0xfd, 0x20,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xc7, 0x53, 0x45, 0x9e, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfb, 0x20, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xf5, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x9,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x20, 0x0, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf9, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0xa,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x30, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa3,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfc, 0x4f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xd5, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xe5, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x1f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xa0, 0xef, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0xa, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x5f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xe0, 0x0, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf9, 0x0, 0x9, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0x7f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0x0, 0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x5, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xc7, 0x53, 0x45, 0x9e, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xb7, 0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x13, 0x33, 0x33, 0x33,
-    0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x1, 0x59, 0xce, 0xff, 0xfe, 0xc9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xfa, 0x75, 0x43, 0x45,
-    0x8d, 0xff, 0xfa, 0x0, 0x0, 0x1, 0xcf, 0xfd,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xfa,
-    0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0, 0x1, 0xb5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xe4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10,
-
-    /* U+0033 "3" */
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x3a, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x35,
-    0x9e, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfc, 0x0, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x2f, 0xfd,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xc0, 0x0, 0x6f, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xe2, 0x0, 0x0,
-    0x2c, 0xff, 0xfe, 0xa7, 0x54, 0x34, 0x58, 0xcf,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0x9c, 0xef, 0xff, 0xec,
-    0x95, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x24, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0xcf, 0xa2, 0x22, 0x22, 0x21, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xff, 0x73, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x33,
-    0x33, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x23, 0x69,
-    0xef, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf5, 0x1d, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0,
-    0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x50, 0xb, 0xff, 0xe8, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xf9, 0x0,
-    0x0, 0x7f, 0xff, 0xfc, 0x96, 0x43, 0x44, 0x69,
-    0xef, 0xff, 0x80, 0x0, 0x0, 0x1, 0x7e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x37, 0xbd, 0xff, 0xff, 0xdb,
-    0x72, 0x0, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xce, 0xff,
-    0xfe, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xfa,
-    0x74, 0x22, 0x23, 0x58, 0xdf, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf3, 0x0, 0x0, 0x3, 0x8c, 0xef,
-    0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x9f, 0xfd,
-    0x84, 0x21, 0x13, 0x5a, 0xff, 0xfd, 0x20, 0x0,
-    0x5f, 0xf1, 0xa, 0xfe, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xff, 0xe1, 0x0, 0x5f, 0xf2, 0x7f,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfc, 0x0, 0x4f, 0xf5, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x3f,
-    0xfd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xc0, 0x1f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0xf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0xb, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x7, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0xcf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xb0, 0x0,
-    0xb, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x40, 0x0, 0x1, 0xef, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfa,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xfe, 0x85, 0x21, 0x13, 0x5a, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xff,
-    0xc9, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x6f, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x37, 0xff, 0x66, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xe0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x6, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfe, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x80, 0x6,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf1, 0x0, 0x38, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x2, 0x7a, 0xde, 0xff, 0xfd,
-    0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xc7, 0x42,
-    0x11, 0x24, 0x6a, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0xb, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0xff, 0xe1, 0x0, 0x0, 0x7f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc,
-    0x0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x5, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0,
-    0x5, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x3, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0xef, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x30, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xfb, 0x0, 0x0, 0xa, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xa5, 0x21, 0x0,
-    0x2, 0x48, 0xef, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x60, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xfe, 0x95, 0x21, 0x0, 0x2,
-    0x48, 0xdf, 0xfe, 0x40, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
-    0xf7, 0x0, 0x1, 0xef, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x50, 0xa,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xe0, 0x1f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf6, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x8f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfd, 0x8f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfd, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfa, 0x1f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0xa,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xe0, 0x1, 0xef, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0x50, 0x0, 0x4f, 0xff, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xf8, 0x0, 0x0, 0x3,
-    0xdf, 0xff, 0xb7, 0x42, 0x11, 0x23, 0x69, 0xef,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x8b, 0xdf, 0xff, 0xfe,
-    0xc9, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x6, 0xad, 0xff, 0xfe, 0xc9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xfe, 0x85, 0x21,
-    0x12, 0x58, 0xef, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xe2, 0x0, 0x0, 0x0, 0xdf, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x10,
-    0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf3, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfb, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x10, 0x6f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x60, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0x3f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xd0, 0xf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf0, 0x9, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x8f, 0xf1, 0x1, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf8, 0x4f, 0xf3, 0x0, 0x5f, 0xfe, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xb0, 0x3f, 0xf3,
-    0x0, 0x5, 0xff, 0xfd, 0x73, 0x10, 0x1, 0x37,
-    0xcf, 0xfb, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff,
-    0xff, 0xda, 0x50, 0x0, 0x0, 0x4f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf6, 0x0,
-    0x0, 0x0, 0x4, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0xd,
-    0xfd, 0x85, 0x32, 0x23, 0x47, 0xbf, 0xff, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x27, 0xad, 0xef, 0xff, 0xdb, 0x84,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x7, 0xfd, 0x22, 0xff, 0xfb, 0x2f, 0xff, 0xb0,
-    0x8f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd3, 0x2f,
-    0xff, 0xb2, 0xff, 0xfb, 0x7, 0xfd, 0x20,
-
-    /* U+003B ";" */
-    0x7, 0xfd, 0x22, 0xff, 0xfb, 0x2f, 0xff, 0xb0,
-    0x8f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd3, 0x2f,
-    0xff, 0xb2, 0xff, 0xfc, 0x7, 0xff, 0x90, 0xc,
-    0xf4, 0x0, 0xff, 0x0, 0x4f, 0xb0, 0x8, 0xf6,
-    0x0, 0xbf, 0x10, 0xf, 0xd0, 0x1, 0x84, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xaf, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xfb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xfe,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xdf,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x9f, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x39, 0xff, 0xfe, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xc5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xef, 0xfe, 0x92, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xfc, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8e, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x70,
-
-    /* U+003D "=" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0,
-
-    /* U+003E ">" */
-    0x79, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xfe,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x9f, 0xff, 0xe8,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xcf, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xfe, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x9e, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xaf, 0xff, 0xd7, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7d, 0xff, 0xfa, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf,
-    0xff, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x0, 0x26, 0xad, 0xef, 0xff, 0xdb,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xfc, 0x85, 0x32, 0x23, 0x58,
-    0xdf, 0xff, 0x90, 0x0, 0x3, 0xef, 0xf9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xf9, 0x0,
-    0xe, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0x40, 0x3, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xdc, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x47, 0xac, 0xef, 0xff, 0xfe, 0xca, 0x73, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xff,
-    0xfe, 0xdc, 0xcd, 0xef, 0xff, 0xfe, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xef, 0xfe, 0x95, 0x20, 0x0,
-    0x0, 0x0, 0x3, 0x6a, 0xef, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5b, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xcf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xac, 0xcb,
-    0x96, 0x10, 0x0, 0x0, 0x6c, 0x80, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xa2, 0x0, 0x8, 0xfa, 0x0, 0x0, 0x5f, 0xe0,
-    0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0xc6, 0x30, 0x0, 0x26, 0xcf, 0xf6,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xf8, 0x8,
-    0xfa, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0xcf,
-    0x50, 0x0, 0x0, 0x0, 0x1e, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x8f, 0xa0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0xb, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0xfa, 0x0, 0x0,
-    0x0, 0x2f, 0xd0, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0xbf, 0x40, 0x0, 0x0, 0x0, 0xbf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x8, 0xf6,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x4f, 0x91, 0xfe,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0,
-    0x0, 0x0, 0xf, 0xd5, 0xfa, 0x0, 0x0, 0x0,
-    0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x5f, 0x90, 0x0, 0x0, 0x0, 0xaf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0xe,
-    0xe5, 0xf9, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x4f,
-    0xa0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0xf, 0xe3, 0xfc, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x6,
-    0xf7, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0xfa, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x7f, 0xc0,
-    0x0, 0x0, 0x7, 0xf9, 0x0, 0xb, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0xfb, 0x4, 0xff, 0x20, 0x0,
-    0x2, 0xff, 0x10, 0x0, 0x4f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xc6, 0x20, 0x0, 0x25,
-    0xbf, 0xfa, 0x0, 0xe, 0xfd, 0x30, 0x5, 0xef,
-    0x60, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x6b, 0xef, 0xff, 0xd9, 0x40, 0x0, 0x0,
-    0x0, 0x2a, 0xef, 0xea, 0x30, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xfa, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xe9, 0x52, 0x0,
-    0x0, 0x0, 0x3, 0x69, 0xef, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xbf, 0xff, 0xff, 0xed, 0xdd,
-    0xef, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x8a, 0xde, 0xff, 0xfe, 0xca,
-    0x74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x8b, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x13, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0xcf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x5f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
-    0x0, 0x6, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0x0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf4, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x10, 0x0, 0x0, 0xb, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x80, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf1, 0x0, 0x0, 0xaf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf7, 0x0, 0x2, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x0, 0x9, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60, 0x1f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe0,
-    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf5,
-
-    /* U+0042 "B" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xb8, 0x30, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd6, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x24, 0x7b, 0xff,
-    0xfb, 0x10, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfc,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x30, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf6, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x60, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xd0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf5, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
-    0xf8, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x13, 0x6a, 0xff, 0xf6, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x2, 0xff,
-    0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x24,
-    0x69, 0xef, 0xfd, 0x30, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0xff, 0x40, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xfe, 0x10, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x12, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x32, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xf2, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xf6, 0x0, 0x2f, 0xf5, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x12, 0x46, 0x9e, 0xff, 0xf6,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x95, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xbd,
-    0xff, 0xff, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x96, 0x54,
-    0x44, 0x68, 0xcf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0x92, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xef, 0xfc, 0x10, 0x0, 0x0,
-    0x3, 0xef, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x3,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0x20, 0x0, 0x1, 0xef,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0x30, 0x0, 0x0, 0x4, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xfc, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd,
-    0x96, 0x54, 0x44, 0x68, 0xcf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xbd,
-    0xff, 0xff, 0xdb, 0x83, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xec, 0x96, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf6, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x57, 0xae, 0xff, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xd1,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xd1, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xc0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x70, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x10, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf9, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfe, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x50, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf9, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x10, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x70, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xc0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xd1, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0xff, 0xd1, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f,
-    0xf6, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x57,
-    0xae, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xec, 0x96, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0045 "E" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x2f, 0xf6, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x30, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x2, 0xff, 0x62, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf6, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0,
-
-    /* U+0046 "F" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x2f, 0xf6, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x30, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x2f, 0xf7, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x30, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xad,
-    0xef, 0xff, 0xec, 0x95, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xfe, 0xa7, 0x54,
-    0x34, 0x58, 0xbf, 0xff, 0xfb, 0x20, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0x40, 0x0, 0x0,
-    0x3, 0xef, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0x20, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0x60, 0x0, 0x1, 0xef,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0x15,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x31, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0xaf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x4, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0xd, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x5f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x30, 0x0, 0xcf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf3, 0x0, 0x1, 0xef, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x30, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x0, 0x0, 0x3, 0xef, 0xfb, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0xff, 0x30, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xa3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0xa7, 0x54, 0x34, 0x68, 0xbf, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xad,
-    0xef, 0xff, 0xeb, 0x95, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x32, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x32, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x32, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x32, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x32, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x32,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x32, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0xff,
-    0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x5f, 0xf3, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x32, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x32, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x32, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x32, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x32,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x32, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x32, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-
-    /* U+0049 "I" */
-    0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4,
-    0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4,
-    0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4,
-    0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4,
-    0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4,
-    0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4,
-    0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4,
-    0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4,
-    0x2f, 0xf4,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x23, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x8f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xa0, 0x5e, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf6, 0xd, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x10, 0x2e, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0x70, 0x0, 0x3e, 0xff,
-    0xd8, 0x43, 0x35, 0x9f, 0xff, 0xa0, 0x0, 0x0,
-    0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0,
-
-    /* U+004B "K" */
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xb0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xb0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x2, 0xef, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x2, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2,
-    0xef, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x2, 0xef, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x2, 0xef, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x2, 0xef, 0xe2, 0x8f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x2,
-    0xef, 0xe2, 0x0, 0xaf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x42, 0xef, 0xe2,
-    0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf6, 0xef, 0xe2, 0x0, 0x0,
-    0x0, 0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x50, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x30, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfe,
-    0x20, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfd, 0x10,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-
-    /* U+004C "L" */
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf6, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x12, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0,
-
-    /* U+004D "M" */
-    0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf0, 0x2f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf0, 0x2f, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0,
-    0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xf0, 0x2f, 0xf9, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x9f, 0xf0, 0x2f, 0xf4, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x6f, 0xf0, 0x2f, 0xf4,
-    0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x6f, 0xf0,
-    0x2f, 0xf4, 0x9, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x60,
-    0x6f, 0xf0, 0x2f, 0xf4, 0x1, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfc, 0x0, 0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x6f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x0, 0x6f, 0xf0, 0x2f, 0xf4,
-    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x6f, 0xf0,
-    0x2f, 0xf4, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x0,
-    0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0, 0xaf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4,
-    0x0, 0x0, 0x7, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x6f, 0xf0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0xa, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x60, 0x0, 0x0,
-    0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x30, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf5, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0,
-
-    /* U+004E "N" */
-    0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x32, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x32, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x2f, 0xfd, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x32, 0xff, 0x5c, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f,
-    0xf4, 0x1e, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x32, 0xff, 0x40,
-    0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x6f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x32, 0xff, 0x40, 0x0, 0x9f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x2f, 0xf4, 0x0, 0x0, 0xcf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x32,
-    0xff, 0x40, 0x0, 0x1, 0xef, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4,
-    0x0, 0x0, 0x3, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x32, 0xff, 0x40, 0x0,
-    0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x32, 0xff, 0x40, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0x32, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x32, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf7, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0x3, 0xff,
-    0x32, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xe2, 0x0, 0x0, 0x3f, 0xf3, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xd0, 0x0, 0x3, 0xff, 0x32, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xa0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x70,
-    0x3, 0xff, 0x32, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x40, 0x3f,
-    0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfe, 0x23, 0xff, 0x32,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0x4f, 0xf3, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfd, 0xff, 0x32, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x32, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf3,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xad,
-    0xef, 0xff, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfd, 0x96, 0x44, 0x34, 0x68, 0xcf,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2c, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7e, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0x30, 0x0, 0x0, 0xb,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xe0, 0x0,
-    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf8, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x10, 0x4, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0xa, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xd0,
-    0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf1, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf5, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x1f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5,
-    0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf1, 0xa, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xd0, 0x4, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0xdf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x10,
-    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf8, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xef, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xf9,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfd, 0x96, 0x44, 0x34, 0x68, 0xcf,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xbd,
-    0xff, 0xff, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xb8, 0x40, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x10, 0x0, 0x0, 0x2f, 0xf7, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x45, 0x8b, 0xff, 0xfe, 0x50, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7f, 0xff, 0x70, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0x50, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0x10, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xe0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x22, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x62, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf6, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x52,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf2, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf7, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xf9, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x25, 0x8d, 0xff, 0xf7, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xb7, 0x10, 0x0, 0x0,
-    0x0, 0x2f, 0xf6, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xad,
-    0xef, 0xff, 0xdb, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfd, 0x96, 0x44, 0x34,
-    0x68, 0xcf, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xf9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0x30, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf8, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x4, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x70,
-    0x0, 0xa, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xd0, 0x0, 0xe, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x1f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf5, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0x0, 0xe, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0xa,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xd0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x70, 0x0, 0x0, 0xdf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x10, 0x0,
-    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf8, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xff, 0xf9, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7e, 0xff, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfd, 0x96, 0x44, 0x34, 0x68, 0xcf, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xbd,
-    0xff, 0xff, 0xfc, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xfe, 0x73, 0x0, 0x15, 0xaf, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xbe,
-    0xff, 0xfc, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xb8, 0x40, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x10, 0x0, 0x0, 0x2f, 0xf7, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x45, 0x8b, 0xff, 0xfe, 0x50, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7f, 0xff, 0x70, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0x60, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x10, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xe0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x22, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x62, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf6, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x52,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf2, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf6, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xf8, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x25, 0x8d, 0xff, 0xf6, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x91, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x2f, 0xf6, 0x22, 0x22, 0x22, 0x22, 0x21,
-    0x10, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf2, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xc0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x40, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
-    0x10, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf2, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x2, 0x7b, 0xde, 0xff, 0xfd,
-    0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd8, 0x53, 0x22,
-    0x35, 0x7b, 0xff, 0xff, 0x91, 0x0, 0x0, 0xbf,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0xff, 0x20, 0x0, 0x7f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0xf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
-    0xff, 0xea, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x7c, 0xff, 0xff, 0xfe,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0xcf, 0xff, 0xff, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x9e, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x70, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf2, 0x5f, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf9, 0x0, 0x8f, 0xff, 0xa4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xaf, 0xfc, 0x0, 0x0,
-    0x3c, 0xff, 0xfe, 0xa6, 0x42, 0x22, 0x35, 0x8c,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0x9c, 0xef, 0xff, 0xed,
-    0xb7, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x23, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0xcf, 0xc3, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x4f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf3, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0,
-    0xb, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x5, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x60, 0x0, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0,
-    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xbf, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xfe, 0xa7, 0x54, 0x44, 0x6a, 0xef, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xad, 0xff, 0xff,
-    0xda, 0x72, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x71, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf0, 0x9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x10, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xa0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf3, 0x0, 0x0, 0xc, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfb, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf2, 0x0, 0x0, 0x1, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xa0, 0x0, 0x0, 0x8f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x10, 0x0, 0xf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf8, 0x0, 0x7, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0x5f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0xd, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0057 "W" */
-    0xe, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x9, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xe0, 0x0, 0xdf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x8f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x2f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xa0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0xd,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x40, 0x8f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x7, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0x0, 0x2f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0,
-    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x1,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf7, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x30, 0x0, 0x0, 0xa, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x90, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xe0, 0x0, 0x0, 0x6f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0,
-    0x1, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0xbf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x0, 0x6, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x1, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xd0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x0, 0x1f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xa0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x42, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x98, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfd, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0058 "X" */
-    0x0, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x1e, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfc, 0x0, 0x0, 0x4,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xe1, 0x0, 0x0, 0x0, 0x7f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0,
-    0x1e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xa0, 0x0, 0x0, 0xcf,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf6, 0x0, 0x8, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x30, 0x4f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xd2, 0xef, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xc2, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x10, 0x5f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf4, 0x0, 0x9, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x80, 0x0, 0x0, 0xcf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb,
-    0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe1, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x0, 0x6, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf3, 0x0, 0x0, 0x2f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd,
-    0x0, 0x0, 0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0,
-    0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
-
-    /* U+0059 "Y" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0xd,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x3, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x30, 0x0, 0x9f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xf9, 0x0, 0x0, 0xe, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xe0, 0x0, 0x0, 0x5, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xbf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xb0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf5, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe,
-    0x10, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
-    0x0, 0x7, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x0, 0xbf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x85, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x13, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3e,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x31, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-
-    /* U+005B "[" */
-    0x2f, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff,
-    0xf9, 0x2f, 0xf4, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x92, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+005C "\\" */
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40,
-
-    /* U+005D "]" */
-    0xef, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9, 0xfd,
-    0xef, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xff, 0xfd,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf6, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x8f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x2f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfa, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60,
-    0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x50, 0x0, 0x0, 0x5f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x10, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x7f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-
-    /* U+005F "_" */
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x58, 0x86, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x1c, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0x80,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x0, 0x38, 0xbd, 0xff, 0xfe, 0xb7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x4e,
-    0xff, 0xfa, 0x63, 0x21, 0x24, 0x8e, 0xff, 0xc0,
-    0x0, 0x4, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfa, 0x0, 0x0, 0xc9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x3, 0x7a, 0xcd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xef, 0xf3, 0x0, 0x3, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x6f, 0xfe, 0x73, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0xb, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf3, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf3, 0xb, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xef, 0xf3, 0x3,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0x5f, 0xf3, 0x0, 0x6f, 0xfd, 0x61, 0x0, 0x0,
-    0x3, 0xaf, 0xf4, 0x2f, 0xf3, 0x0, 0x4, 0xdf,
-    0xff, 0xec, 0xcd, 0xff, 0xfb, 0x20, 0x2f, 0xf3,
-    0x0, 0x0, 0x4, 0x9d, 0xef, 0xfe, 0xc8, 0x30,
-    0x0, 0x2f, 0xf3,
-
-    /* U+0062 "b" */
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x49, 0xdf,
-    0xff, 0xeb, 0x72, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0xef, 0x70, 0xa, 0xff,
-    0xe8, 0x53, 0x23, 0x58, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0xef, 0x70, 0xcf, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xf8, 0x0, 0x0, 0xef, 0x7a,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0x70, 0x0, 0xef, 0xdf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x0,
-    0xef, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xfb, 0x0, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x20, 0xef, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0xef, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xe0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xe0, 0xef, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0xef, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x20, 0xef, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb,
-    0x0, 0xef, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf2, 0x0, 0xef, 0x6a,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0x60, 0x0, 0xef, 0x60, 0xcf, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xf8, 0x0, 0x0,
-    0xef, 0x60, 0xb, 0xff, 0xe8, 0x53, 0x22, 0x48,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0xef, 0x60, 0x0,
-    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
-    0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x49, 0xdf,
-    0xff, 0xeb, 0x72, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xec,
-    0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xfa, 0x63, 0x22, 0x46, 0xbf,
-    0xff, 0xa0, 0x0, 0x0, 0x2e, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xb0, 0x0, 0x1e,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x40, 0xa, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x40, 0x4, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x40, 0x0, 0x1d,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x40, 0x0, 0x2e, 0xff, 0x91, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xb0, 0x0, 0x0, 0x1b,
-    0xff, 0xfa, 0x63, 0x22, 0x36, 0xbf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xce, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x59, 0xdf,
-    0xff, 0xeb, 0x71, 0x0, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x91, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x2d, 0xff,
-    0xfa, 0x63, 0x22, 0x47, 0xbf, 0xfe, 0x30, 0xf,
-    0xf5, 0x0, 0x3, 0xef, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0xbf, 0xf4, 0xf, 0xf5, 0x0, 0x1e,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x2f, 0xf5, 0x0, 0xbf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xcf, 0xf5,
-    0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf5, 0xb, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf5, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x5f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x8f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf5, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0xaf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x9f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5,
-    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf5, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0xb,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf5, 0x4, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf5, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xcf, 0xf5, 0x0, 0x1e,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x2f, 0xf5, 0x0, 0x3, 0xef, 0xf9, 0x10,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xf4, 0xf, 0xf5,
-    0x0, 0x0, 0x2d, 0xff, 0xfa, 0x63, 0x22, 0x47,
-    0xbf, 0xfe, 0x40, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x59, 0xdf,
-    0xff, 0xeb, 0x71, 0x0, 0x0, 0xf, 0xf5,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xd7, 0x42, 0x12,
-    0x49, 0xef, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x4f,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfd,
-    0x10, 0x0, 0x0, 0x2f, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0, 0xc,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf7, 0x0, 0x5, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x1f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x8f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x29, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xf4, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x49, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x40, 0x0, 0x0, 0x1d, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0,
-    0x2d, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xf4, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfb,
-    0x74, 0x22, 0x35, 0x9e, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0xce, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-    0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xcf, 0xff, 0xc7,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x62,
-    0x1, 0x4a, 0xe0, 0x0, 0x0, 0x0, 0xcf, 0xe1,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x2, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xdf, 0xff, 0xec,
-    0x83, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0,
-    0xa, 0xfa, 0x0, 0x0, 0x3d, 0xff, 0xd7, 0x30,
-    0x0, 0x3, 0x7c, 0xff, 0x80, 0xa, 0xfa, 0x0,
-    0x4, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xfa, 0xa, 0xfa, 0x0, 0x2f, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x8a,
-    0xfa, 0x0, 0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfd, 0xfa, 0x6, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xfa, 0xd, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfa, 0x6f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfa, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0xaf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0xaf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfa, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x6f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfa, 0x2f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa,
-    0xd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfa, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfa, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0xfa, 0x0,
-    0x2f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0x7c, 0xfa, 0x0, 0x3, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf9, 0xc,
-    0xfa, 0x0, 0x0, 0x2d, 0xff, 0xfa, 0x63, 0x22,
-    0x36, 0xaf, 0xff, 0x80, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x59,
-    0xdf, 0xff, 0xeb, 0x83, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x60, 0x0, 0x8f, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xfd, 0x0, 0x0, 0x8f,
-    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf2, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xd9,
-    0x64, 0x22, 0x24, 0x6a, 0xef, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x69, 0xce, 0xff, 0xfe, 0xc9, 0x50, 0x0,
-    0x0, 0x0,
-
-    /* U+0068 "h" */
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x2, 0x7b,
-    0xef, 0xff, 0xda, 0x50, 0x0, 0x0, 0xe, 0xf7,
-    0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0xef, 0x70, 0x4f, 0xff, 0xa6, 0x32,
-    0x24, 0x6b, 0xff, 0xf8, 0x0, 0xe, 0xf7, 0x4f,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf7,
-    0x0, 0xef, 0x9e, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xf2, 0xe, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90,
-    0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xe, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0xef,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x6e, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x7e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf8, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x8e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x8e,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x8e, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x8e, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x8e, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x8e, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80,
-
-    /* U+0069 "i" */
-    0x2d, 0xf9, 0x9, 0xff, 0xf2, 0x9f, 0xff, 0x21,
-    0xad, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0xef, 0x70, 0xe, 0xf7,
-    0x0, 0xef, 0x70, 0xe, 0xf7, 0x0, 0xef, 0x70,
-    0xe, 0xf7, 0x0, 0xef, 0x70, 0xe, 0xf7, 0x0,
-    0xef, 0x70, 0xe, 0xf7, 0x0, 0xef, 0x70, 0xe,
-    0xf7, 0x0, 0xef, 0x70, 0xe, 0xf7, 0x0, 0xef,
-    0x70, 0xe, 0xf7, 0x0, 0xef, 0x70, 0xe, 0xf7,
-    0x0, 0xef, 0x70, 0xe, 0xf7, 0x0, 0xef, 0x70,
-    0xe, 0xf7, 0x0, 0xef, 0x70, 0xe, 0xf7, 0x0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
-    0x2, 0x0, 0x0, 0x0, 0xb, 0xff, 0x10, 0xc,
-    0xd6, 0x20, 0x14, 0xcf, 0xf7, 0x0, 0x1d, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x6b, 0xef,
-    0xfd, 0xa3, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xe2, 0xe, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xd2, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xd1, 0x0, 0xe, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc1, 0x0,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xb0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x9, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf7, 0x0, 0x0, 0x1d, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x2d, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x3e, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x4f,
-    0xfe, 0x25, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf7, 0x5f, 0xfd, 0x10, 0x8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xcf, 0xfc, 0x10,
-    0x0, 0xb, 0xff, 0x50, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfd, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf7, 0x0, 0x0, 0xe, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xe2, 0x0, 0xe, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xd0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xa0, 0xe, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x40,
-
-    /* U+006C "l" */
-    0xef, 0x7e, 0xf7, 0xef, 0x7e, 0xf7, 0xef, 0x7e,
-    0xf7, 0xef, 0x7e, 0xf7, 0xef, 0x7e, 0xf7, 0xef,
-    0x7e, 0xf7, 0xef, 0x7e, 0xf7, 0xef, 0x7e, 0xf7,
-    0xef, 0x7e, 0xf7, 0xef, 0x7e, 0xf7, 0xef, 0x7e,
-    0xf7, 0xef, 0x7e, 0xf7, 0xef, 0x7e, 0xf7, 0xef,
-    0x7e, 0xf7, 0xef, 0x7e, 0xf7, 0xef, 0x7e, 0xf7,
-    0xef, 0x7e, 0xf7, 0xef, 0x70,
-
-    /* U+006D "m" */
-    0xef, 0x60, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff,
-    0xfd, 0x94, 0x0, 0x0, 0x0, 0xef, 0x60, 0x3,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,
-    0x0, 0x0, 0xef, 0x60, 0x6f, 0xfc, 0x62, 0x0,
-    0x1, 0x5c, 0xff, 0xe2, 0x0, 0x4, 0xef, 0xe8,
-    0x30, 0x0, 0x14, 0x9f, 0xff, 0x60, 0x0, 0xef,
-    0x65, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfe, 0x10, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0xf4, 0x0, 0xef, 0x8f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x91, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfe,
-    0x0, 0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfb, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x60, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xb0, 0xef, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4,
-
-    /* U+006E "n" */
-    0xef, 0x60, 0x0, 0x2, 0x8b, 0xef, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0xe, 0xf6, 0x0, 0x2b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0xef,
-    0x60, 0x5f, 0xfd, 0x73, 0x0, 0x1, 0x38, 0xff,
-    0xf8, 0x0, 0xe, 0xf6, 0x5f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xf7, 0x0, 0xef, 0x8f,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf2, 0xe, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x90, 0xef, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0xef, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6e,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x7e, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x8e, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x8e, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x8e, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x8e, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x8e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf8, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x8e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xec,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xfa, 0x63,
-    0x22, 0x47, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0,
-    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x4, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x10, 0xb, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x70,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xd0, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf1, 0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x9f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf5, 0xaf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf6, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x8f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf4, 0x5f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xd0, 0xb, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x70, 0x3, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x10, 0x0,
-    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf6, 0x0, 0x0, 0x1d, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xb0,
-    0x0, 0x0, 0x2, 0xef, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0xfa, 0x63, 0x22, 0x47, 0xbf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xec,
-    0x83, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0xef, 0x60, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xeb,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60, 0x0,
-    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
-    0x0, 0x0, 0xef, 0x60, 0xa, 0xff, 0xe8, 0x53,
-    0x23, 0x58, 0xdf, 0xff, 0x60, 0x0, 0x0, 0xef,
-    0x60, 0xcf, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xf8, 0x0, 0x0, 0xef, 0x6a, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0x60,
-    0x0, 0xef, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf2, 0x0, 0xef, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xfb, 0x0, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20,
-    0xef, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x70, 0xef, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0xef, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
-    0xef, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x70, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x20, 0xef, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0xef,
-    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf2, 0x0, 0xef, 0x7a, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0x60,
-    0x0, 0xef, 0x70, 0xcf, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xf8, 0x0, 0x0, 0xef, 0x70,
-    0xb, 0xff, 0xe8, 0x53, 0x22, 0x48, 0xdf, 0xff,
-    0x60, 0x0, 0x0, 0xef, 0x70, 0x0, 0x5e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xeb,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xdf, 0xff, 0xeb,
-    0x71, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x2d, 0xff, 0xfa, 0x63,
-    0x22, 0x47, 0xbf, 0xfe, 0x40, 0xf, 0xf5, 0x0,
-    0x3, 0xef, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xbf, 0xf4, 0xf, 0xf5, 0x0, 0x1e, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x2f,
-    0xf5, 0x0, 0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xcf, 0xf5, 0x4, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf5, 0xb, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf5, 0x5f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x9f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf5, 0xaf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x8f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0x5f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf5, 0xb, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf5, 0x4, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf5, 0x0,
-    0xbf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xcf, 0xf5, 0x0, 0x1e, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x2f,
-    0xf5, 0x0, 0x3, 0xef, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0xbf, 0xf4, 0xf, 0xf5, 0x0, 0x0,
-    0x2d, 0xff, 0xfa, 0x63, 0x22, 0x47, 0xbf, 0xfe,
-    0x30, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x7e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xdf, 0xff, 0xeb,
-    0x71, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5,
-
-    /* U+0072 "r" */
-    0xef, 0x60, 0x0, 0x4, 0x9c, 0xee, 0xef, 0x60,
-    0x4, 0xdf, 0xff, 0xff, 0xef, 0x60, 0x7f, 0xfd,
-    0x74, 0x21, 0xef, 0x66, 0xfe, 0x50, 0x0, 0x0,
-    0xef, 0x8f, 0xe2, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x1, 0x6b, 0xdf, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x1d, 0xff,
-    0xc7, 0x42, 0x11, 0x35, 0x9d, 0xff, 0xf3, 0x0,
-    0xb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xcc, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x9f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
-    0xb8, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xcf, 0xff, 0xff, 0xff, 0xb7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x7a, 0xdf, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x8e, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf3, 0xb, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfe, 0x6, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0x1a,
-    0xff, 0xfe, 0x96, 0x32, 0x11, 0x35, 0x9e, 0xff,
-    0x80, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x15, 0x9c,
-    0xef, 0xff, 0xec, 0x84, 0x0, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x3, 0x87, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe2,
-    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x3f,
-    0xfe, 0x72, 0x1, 0x5b, 0xf1, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb7, 0x10,
-
-    /* U+0075 "u" */
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf0,
-    0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf0, 0xe, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0,
-    0xa, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf0, 0x5, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0,
-    0x0, 0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0x7f, 0xf0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x4f, 0xf0,
-    0x0, 0x4, 0xff, 0xfd, 0x84, 0x22, 0x35, 0x8e,
-    0xff, 0x70, 0x4f, 0xf0, 0x0, 0x0, 0x2b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x4f, 0xf0,
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xfc, 0x94,
-    0x0, 0x0, 0x4f, 0xf0,
-
-    /* U+0076 "v" */
-    0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x3f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x80, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x4,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0xe,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0xa,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
-    0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf6, 0x1, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfd, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x5e,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xb0, 0xef, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x90, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x3d, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x6,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xd0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf6, 0x1, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x4, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0x0,
-    0x0, 0x0, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0xef, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x8f,
-    0xb0, 0x0, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xbf, 0x70, 0x0, 0x0, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf7, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x1, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0xd,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9,
-    0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x50, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0xc, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x20, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x62,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfc, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0078 "x" */
-    0x1e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfc, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10, 0x0,
-    0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x40, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x60, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0, 0x4f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfe, 0x10, 0x2e, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfb, 0xc, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfe, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xd3, 0xef,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x4, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x8, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
-    0x0, 0x0, 0xb, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x1e, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf2, 0x0, 0x1, 0xef, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0,
-    0x0, 0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0x8f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x70,
-
-    /* U+0079 "y" */
-    0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x2f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0xb, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x10, 0x0, 0x4, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x6f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf4, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf1, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x9,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x7f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0, 0x0,
-    0x1, 0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfc, 0x62, 0x13, 0x7e, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xce, 0xfe, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0x40, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x8,
-    0xff, 0xb3, 0x10, 0x0, 0x0, 0x0, 0xef, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xe0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x31,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xf4,
-
-    /* U+007C "|" */
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-    0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1,
-
-    /* U+007D "}" */
-    0xef, 0xfd, 0x81, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x27, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xf6, 0x0, 0x0, 0x8, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x27,
-    0xff, 0xe0, 0x0, 0x0, 0xef, 0xff, 0xfe, 0x30,
-    0x0, 0x0, 0xef, 0xfd, 0x81, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x6, 0xce, 0xda, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xa1, 0x0, 0xcf, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf1, 0xa, 0xfc,
-    0x30, 0x15, 0xef, 0xc1, 0x0, 0x0, 0x0, 0xe,
-    0xe0, 0x3f, 0xd0, 0x0, 0x0, 0x1c, 0xfd, 0x20,
-    0x0, 0x0, 0x6f, 0x90, 0x8f, 0x50, 0x0, 0x0,
-    0x0, 0xbf, 0xe6, 0x0, 0x7, 0xff, 0x10, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0xff,
-    0xf4, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3a, 0xef, 0xea, 0x20, 0x0,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x0, 0xa, 0xd7, 0x0, 0x0, 0xa,
-    0xd8, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0,
-    0x4, 0xff, 0x20, 0x0, 0x0, 0x2e, 0xf5, 0x0,
-    0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x6f,
-    0xe1, 0x0, 0x0, 0x6f, 0xe1, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0,
-    0x1e, 0xf7, 0x0, 0x0, 0x1e, 0xf7, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x2f, 0xf5, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0x20, 0x0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x60, 0x0, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0x10, 0x0, 0x6, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x9f,
-    0xb0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0xc, 0xf8,
-
-    /* U+00BB "»" */
-    0x9, 0xd7, 0x0, 0x0, 0x9, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x1e, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xa0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x10,
-    0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x9,
-    0xfc, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xe1, 0x0, 0x0, 0x6f, 0xe1, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0, 0x0, 0x1e,
-    0xf6, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0xb, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x10, 0x0, 0x4, 0xfe, 0x10, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x0, 0x68, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xff, 0x93, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0xff, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x93, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-
-    /* U+0401 "Ё" */
-    0x0, 0x0, 0x0, 0x45, 0x0, 0x0, 0x0, 0x26,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xa0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0x4, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0x50, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x10, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0xff, 0x92, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x30, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3,
-
-    /* U+0402 "Ђ" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x8f, 0xf4, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0,
-    0x0, 0x25, 0x79, 0xbb, 0xba, 0x85, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf1, 0x5, 0xae, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfa, 0xff, 0xff, 0xfc,
-    0x97, 0x66, 0x68, 0xbf, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xfd, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf1, 0x0, 0x0, 0x0, 0x24, 0x20, 0x0,
-    0x15, 0xbf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfd, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
-    0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x88,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xf9, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8b, 0xef,
-    0xff, 0xed, 0xa7, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xd9, 0x64, 0x34, 0x56, 0x9c,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1b, 0xff,
-    0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6d,
-    0xff, 0xd2, 0x0, 0x0, 0x1d, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xb0, 0x0, 0x1d, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xa0, 0x0,
-    0xb, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
-    0x0, 0x1d, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x1d, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0xa0, 0x0, 0x0, 0x1b,
-    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x9f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xd9, 0x64, 0x34, 0x57, 0xae, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8b, 0xef,
-    0xff, 0xec, 0xa6, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xce, 0xff, 0xfe,
-    0xc9, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe9, 0x63,
-    0x22, 0x24, 0x6a, 0xef, 0xff, 0xc2, 0x0, 0x0,
-    0x7, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xaf, 0xf6, 0x0, 0x0, 0x3f, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xa0,
-    0x0, 0x0, 0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xe9, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xff,
-    0xff, 0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xff, 0xff,
-    0xc7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x7b, 0xef, 0xff, 0xfc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x7d, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3a, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0x9,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x60, 0x1f, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xfd,
-    0x0, 0x4, 0xef, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xff, 0xf3, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xb7, 0x43, 0x22, 0x34, 0x7a, 0xff,
-    0xfd, 0x30, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x8b, 0xdf, 0xff, 0xfe,
-    0xb8, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0406 "І" */
-    0xff, 0x8f, 0xf8, 0xff, 0x8f, 0xf8, 0xff, 0x8f,
-    0xf8, 0xff, 0x8f, 0xf8, 0xff, 0x8f, 0xf8, 0xff,
-    0x8f, 0xf8, 0xff, 0x8f, 0xf8, 0xff, 0x8f, 0xf8,
-    0xff, 0x8f, 0xf8, 0xff, 0x8f, 0xf8, 0xff, 0x8f,
-    0xf8, 0xff, 0x8f, 0xf8, 0xff, 0x8f, 0xf8, 0xff,
-    0x8f, 0xf8, 0xff, 0x8f, 0xf8, 0xff, 0x8f, 0xf8,
-    0xff, 0x80,
-
-    /* U+0407 "Ї" */
-    0x5, 0x40, 0x0, 0x0, 0x3, 0x50, 0x9f, 0xf7,
-    0x0, 0x0, 0x4f, 0xfb, 0xcf, 0xf9, 0x0, 0x0,
-    0x7f, 0xfe, 0x4e, 0xe3, 0x0, 0x0, 0x1c, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x1, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x36, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd,
-    0x2, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x90, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf3, 0x1, 0xdf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x1, 0xcf, 0xfe,
-    0x95, 0x33, 0x48, 0xef, 0xfd, 0x10, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x16, 0xbe, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfb, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x25,
-    0x9e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x6, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x90, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xf3,
-    0x0, 0x12, 0x13, 0xaf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x47,
-    0xbf, 0xff, 0xd2, 0x0, 0x6, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0x7f, 0xff, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x84,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+040A "Њ" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf9,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x3f, 0xfc, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x22, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x82, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x12, 0x5a, 0xff, 0xff, 0x40,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0x30, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xfd, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf4, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfd, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xdf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfb, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xfa, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x23, 0x7b, 0xff, 0xf9, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+040B "Ћ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0xbf, 0xd3, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x26, 0x9c, 0xef, 0xff, 0xeb, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xd0, 0x39, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0xdf, 0xff, 0xfc,
-    0x96, 0x43, 0x34, 0x69, 0xef, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfa, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xd0,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x68,
-    0x85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x10, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x30, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x50, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xb0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd1,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf5, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x93, 0x33, 0x33, 0x33, 0x5f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfe, 0x10, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfc, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xe1, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xd0,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x0, 0x0, 0x38, 0x87, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xce, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe,
-    0x1e, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x60, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf9, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfe, 0x10, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf4, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xd0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x1, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x1, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0xc, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x9f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x85, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0xaf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8,
-
-    /* U+040E "Ў" */
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x40, 0x0, 0x0, 0x1b,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xda, 0x89, 0xbf, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0x1f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfa, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x10, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x80, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
-    0x0, 0x0, 0xe, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x10, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf1, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x90, 0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x20, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x53,
-    0x35, 0xaf, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xcf, 0xfe,
-    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x9f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x9f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x9f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x9f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x9f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x9f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0xff, 0x93, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x4f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x9f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4,
-    0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0xa, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x50, 0x0, 0x3f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf6, 0x0, 0x0, 0x4,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf3, 0x0,
-    0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xa0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x20, 0x0, 0x7, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x6f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90,
-    0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x10,
-
-    /* U+0411 "Б" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0x92, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x84,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x36, 0xbf, 0xff, 0xd2, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f,
-    0xfe, 0x10, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf3, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfe, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfd, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf1, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x80, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0xfb, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x47, 0xcf,
-    0xff, 0xa0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xca, 0x62, 0x0, 0x0, 0x0,
-
-    /* U+0412 "В" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xca, 0x61, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x12, 0x48, 0xdf, 0xff, 0x50, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x40, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x90, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfb, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xc0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x70, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf2, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfa, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xfc, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x47, 0xdf, 0xf9,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x10, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x36, 0xaf,
-    0xff, 0x60, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0x80,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x40, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfd, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x6f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xe0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xfb, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x24, 0x7b, 0xff,
-    0xfa, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xed, 0xa7, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0413 "Г" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x93, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x2f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x13, 0x47, 0xef, 0xc3,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0xcf, 0xd3, 0x33, 0x32, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x7f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x8f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x8f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x48, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x87,
-
-    /* U+0415 "Е" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x10, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0xff, 0x92, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x30, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3,
-
-    /* U+0416 "Ж" */
-    0x7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0,
-    0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xc0, 0x0, 0x0, 0x5, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x20, 0x0, 0x0, 0x0, 0xaf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x2, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfd, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0,
-    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x43, 0x33,
-    0x33, 0x37, 0xff, 0x43, 0x33, 0x33, 0x36, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xd, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x9, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x50, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf2, 0x0, 0x1, 0xef, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0xa, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70,
-    0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3,
-
-    /* U+0417 "З" */
-    0x0, 0x0, 0x0, 0x4, 0x8b, 0xde, 0xff, 0xfd,
-    0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xfe, 0xa7,
-    0x54, 0x33, 0x35, 0x8c, 0xff, 0xfd, 0x30, 0x0,
-    0x0, 0xd, 0xfe, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x8f, 0xff, 0x30, 0x0, 0x0, 0x57,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x59, 0xef, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x12,
-    0x36, 0x9e, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x1, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x80, 0x8f, 0xf9, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe1, 0x0,
-    0xbf, 0xff, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2a, 0xff, 0xe3, 0x0, 0x0, 0x6e, 0xff,
-    0xfd, 0xa6, 0x43, 0x22, 0x23, 0x58, 0xcf, 0xff,
-    0xc2, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0x9b, 0xdf, 0xff, 0xfe,
-    0xca, 0x72, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0418 "И" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xce, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xfe, 0x1e, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x60, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf9, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xc0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x10, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x70, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xd0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfe, 0x20, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x1, 0xef,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x3f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x1, 0xef, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0xc, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x9f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x85, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-
-    /* U+0419 "Й" */
-    0x0, 0x0, 0x0, 0x68, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x30,
-    0x0, 0x0, 0x19, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x98, 0x9b,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x9c, 0xff, 0xfd, 0xa5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xce, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe,
-    0x1e, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x60, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf9, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfe, 0x10, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf4, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xd0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x1, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0x0, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0x6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x80, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x80,
-    0x1, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0x80, 0xc, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x9f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0x85, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0xaf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8,
-
-    /* U+041A "К" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xe1, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf3, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfb, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x10, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x20, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf9, 0x33,
-    0x33, 0x33, 0x35, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xe1, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xa0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x70, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x40, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x10,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x26, 0x57, 0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x6f, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x7f, 0xff, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-
-    /* U+041C "М" */
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x2f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf2, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x2f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf2, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x2f,
-    0xfa, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x9f,
-    0xf2, 0xff, 0x79, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xc3, 0xff, 0x3f, 0xf7, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf2, 0x3f, 0xf3, 0xff, 0x70, 0x6f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x3, 0xff, 0x3f, 0xf7, 0x0,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x10, 0x3f, 0xf3, 0xff,
-    0x70, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x60, 0x3, 0xff,
-    0x3f, 0xf7, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0,
-    0x3f, 0xf3, 0xff, 0x70, 0x0, 0x1e, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x3, 0xff, 0x3f, 0xf7, 0x0, 0x0, 0x6f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfa, 0x0, 0x0, 0x3f, 0xf3, 0xff, 0x70, 0x0,
-    0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x10, 0x0, 0x3, 0xff, 0x3f, 0xf7,
-    0x0, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x3f, 0xf3,
-    0xff, 0x70, 0x0, 0x0, 0xa, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x3,
-    0xff, 0x3f, 0xf7, 0x0, 0x0, 0x0, 0x1f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x7f, 0xf1, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x3f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0x3f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0,
-    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf6, 0x0, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe1, 0xa, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x94, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x3f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x3f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x3f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x30,
-
-    /* U+041D "Н" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0x92,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x3f, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x9c,
-    0xef, 0xff, 0xec, 0x95, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xff, 0xb7, 0x54, 0x34, 0x57, 0xbf,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x80, 0x0, 0x0, 0x6,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0,
-    0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfd, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x60, 0x0, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x4, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2,
-    0x9, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf7, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfa, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
-    0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfe, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfe, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0xc, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x9, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x4, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf2, 0x0, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfd, 0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xff, 0xa7, 0x54, 0x34, 0x57, 0xbf,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xac,
-    0xef, 0xff, 0xec, 0x96, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+041F "П" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0x93, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x3c, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-
-    /* U+0420 "Р" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec,
-    0x95, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x20,
-    0x0, 0x0, 0xff, 0x93, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x57, 0xbf, 0xff, 0xf7, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xff, 0xa0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x30, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xb0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf5, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf2, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x50, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xfa, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xc0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x8c,
-    0xff, 0xfa, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0, 0xff, 0x92,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x69, 0xce,
-    0xff, 0xfe, 0xc9, 0x51, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xcf, 0xff, 0xfb, 0x75, 0x43, 0x45,
-    0x7b, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xbf, 0xff, 0x40, 0x0, 0x0, 0xb, 0xff,
-    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xf2, 0x0, 0x0, 0xcf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1b, 0x70, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0x70, 0x0, 0x0, 0xc, 0xff,
-    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff,
-    0xfb, 0x75, 0x43, 0x45, 0x7b, 0xff, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xce,
-    0xff, 0xfe, 0xc9, 0x51, 0x0, 0x0, 0x0,
-
-    /* U+0422 "Т" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x13, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x8f, 0xf3, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x31,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x8,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0xe,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x60, 0x0, 0x0, 0x6, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0xd, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
-    0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x2,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x10, 0x0, 0xaf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf2, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xa4, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xef, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x95, 0x33, 0x5a, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x9c, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x47, 0xac, 0xef, 0xff, 0xff, 0xed,
-    0xb9, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xea, 0x74, 0x21, 0x6f, 0xf0, 0x12,
-    0x57, 0xbf, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0x93, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x4b, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xa0, 0x0,
-    0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf4, 0x0, 0x2, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0,
-    0x9, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0xe, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
-    0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0xe, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x9, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x30, 0x2, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0,
-    0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf4, 0x0, 0x0, 0x1e, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xa0, 0x0,
-    0x0, 0x3, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0x91, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0x93, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x4a, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xea, 0x74, 0x21, 0x6f, 0xf0, 0x12,
-    0x57, 0xbf, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x47, 0xac, 0xef, 0xff, 0xff, 0xed,
-    0xb9, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xd0, 0x0, 0xb,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf3, 0x0, 0x0, 0x1e, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf7, 0x0, 0x0, 0x0, 0x5f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe,
-    0x10, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb, 0x0,
-    0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x2f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf2, 0xc, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xd9, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfb, 0x6f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfe, 0x10, 0xaf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x40, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x90, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf2, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xd0, 0x0, 0x0, 0x3, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xa0, 0x0, 0x0, 0xdf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x50, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0,
-
-    /* U+0426 "Ц" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0xff,
-    0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0xef, 0xa3, 0x33, 0x33, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x0,
-
-    /* U+0427 "Ч" */
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x29, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x9f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x29, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x29, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf2, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x29, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x29, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x9f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x29, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf2, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x25,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x1f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x20, 0xaf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x2, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0x20, 0x6, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xaf, 0xff, 0xf2, 0x0, 0x6, 0xff, 0xfe, 0x95,
-    0x20, 0x0, 0x13, 0x58, 0xcf, 0xff, 0xfd, 0xff,
-    0x20, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x82, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x28, 0xcf, 0xff, 0xff, 0xff, 0xda, 0x62,
-    0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
-
-    /* U+0428 "Ш" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x6f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x6f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x6f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xff,
-    0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x3f, 0xf8, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60,
-
-    /* U+0429 "Щ" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x60, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60,
-    0x0, 0x0, 0xff, 0x93, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x3f, 0xf8, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0xff, 0x83, 0x33,
-    0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x86,
-
-    /* U+042A "Ъ" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x33, 0x33,
-    0x33, 0x33, 0x3d, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x24, 0x8d, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x35, 0x9e, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x84, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+042B "Ы" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf5, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x5f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf5, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x5f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0x62, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf5, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x58, 0xdf, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x2, 0xff, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0xff, 0x70, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0x30, 0x0, 0x0, 0x2,
-    0xff, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0,
-    0x0, 0x2f, 0xf5, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2,
-    0x0, 0x0, 0x2, 0xff, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x60, 0x0, 0x0, 0x2f, 0xf5, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf9, 0x0, 0x0, 0x2, 0xff, 0x5f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x2f,
-    0xf5, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0,
-    0x2, 0xff, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xa0,
-    0x0, 0x0, 0x2f, 0xf5, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x2, 0xff, 0x5f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x40, 0x0, 0x0, 0x2f, 0xf5, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf0, 0x0, 0x0, 0x2, 0xff,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
-    0x2f, 0xf5, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfe, 0x10, 0x0,
-    0x0, 0x2, 0xff, 0x5f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x2f, 0xf5, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x13, 0x6a, 0xff, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x2, 0xff, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xb8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x50,
-
-    /* U+042C "Ь" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xda, 0x62, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x58, 0xdf,
-    0xff, 0x70, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf7, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0x30, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xc0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfa, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf4, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x90, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xfe,
-    0x10, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf3, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x13, 0x6a, 0xff,
-    0xfd, 0x30, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xb8, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x0, 0x0, 0x3, 0x7a, 0xde, 0xff, 0xfd,
-    0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xc9, 0x64, 0x43, 0x46, 0x9d, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xfd,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0xd, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xc1, 0x0, 0x0, 0x3, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x90, 0x0, 0x4, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfc, 0x0, 0x0, 0xd, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xc1, 0x0, 0x0, 0x1, 0xcf, 0xfe, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd9, 0x64,
-    0x43, 0x46, 0x9d, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x7a, 0xde, 0xff, 0xfd,
-    0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x8c, 0xef, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc8,
-    0x64, 0x34, 0x58, 0xcf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xff, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7e, 0xff, 0xd2, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x9f, 0xfe, 0x30, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xe2, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x90, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x10, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xa0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0xff, 0x93, 0x33, 0x33,
-    0x33, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf0, 0xff, 0x80, 0x0, 0x0, 0x0, 0xcf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xa0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x10, 0xff, 0x80, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x90, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf2, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x9f, 0xfe, 0x30, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xc8,
-    0x64, 0x34, 0x58, 0xcf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x8c, 0xef, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x0, 0x0, 0x1, 0x59, 0xce, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff, 0xfa,
-    0x74, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0xff,
-    0x10, 0x0, 0x9f, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x7f,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x10, 0x2f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf1, 0x9, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x3f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x16, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x17, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x14,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf1, 0x1f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x10, 0xcf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x5, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0xb, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf1, 0x0, 0x1d, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x10, 0x0, 0x1c, 0xff, 0xfa, 0x63, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x4e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0x30, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x16, 0xff, 0x10, 0x0,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0xbf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0,
-    0x0, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x10, 0x0, 0xc, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10,
-    0x2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x10, 0x7f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x10,
-
-    /* U+0430 "а" */
-    0x0, 0x0, 0x0, 0x38, 0xbe, 0xff, 0xfd, 0xb7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x4e,
-    0xff, 0xe9, 0x63, 0x21, 0x24, 0x8e, 0xff, 0xb0,
-    0x0, 0x4, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfa, 0x0, 0x0, 0xd9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf2, 0x0, 0x0, 0x3, 0x8a, 0xcd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xef, 0xf2, 0x0, 0x4, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x7f, 0xfe, 0x73, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf2, 0x4, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0xc, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x3f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf2, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf2, 0xc, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xef, 0xf2, 0x3,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0x5f, 0xf2, 0x0, 0x7f, 0xfd, 0x50, 0x0, 0x0,
-    0x4, 0xaf, 0xf4, 0x2f, 0xf2, 0x0, 0x4, 0xdf,
-    0xff, 0xdc, 0xcd, 0xff, 0xfb, 0x20, 0x2f, 0xf2,
-    0x0, 0x0, 0x5, 0x9d, 0xff, 0xfe, 0xc8, 0x30,
-    0x0, 0x2f, 0xf2,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7a,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x7b, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8c, 0xff, 0xff,
-    0xff, 0xd9, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0xef, 0xff, 0xff, 0xc8, 0x41, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xfd, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0x4, 0x9c, 0xff,
-    0xfe, 0xb8, 0x30, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x30, 0x0, 0x0, 0xf, 0xf4, 0x0, 0xbf, 0xfd,
-    0x84, 0x22, 0x35, 0x8d, 0xff, 0xf8, 0x0, 0x0,
-    0x3f, 0xf1, 0xc, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0x90, 0x0, 0x5f, 0xf0, 0xbf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xf7, 0x0, 0x6f, 0xe5, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x7f,
-    0xde, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0x7f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf1, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x7f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf9, 0x6f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfc, 0x2f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0xf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0xb,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x6, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf5, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf0, 0x0, 0x9f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x1f, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x10,
-    0x0, 0x6, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xf5, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0x73,
-    0x10, 0x13, 0x7c, 0xff, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0xce, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-    0x0,
-
-    /* U+0432 "в" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x83,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x30, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x14, 0x9f, 0xff, 0x30, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xfe, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf6, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfa, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0xdf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0xd, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfe,
-    0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8e, 0xff, 0x30, 0xd, 0xfe, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xef, 0xff, 0xfb, 0x20, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0xaf, 0xd3, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf4, 0xd, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x4d, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf7, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x8d,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x3d, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0x5b, 0xff,
-    0xe2, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb1, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-
-    /* U+0433 "г" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0xdf, 0xa2, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0434 "д" */
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x1,
-    0x3b, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xb0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfc, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x8f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xc8, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc, 0x8f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc0,
-
-    /* U+0435 "е" */
-    0x0, 0x0, 0x0, 0x0, 0x59, 0xdf, 0xff, 0xdb,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xe9, 0x42, 0x12,
-    0x47, 0xdf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0x20, 0x0, 0x7,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xfc, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x11, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf5, 0x3f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x75, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xf9, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x95, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x40, 0x0, 0x0, 0xa, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
-    0xb, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xbf, 0xf8, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfd,
-    0x85, 0x32, 0x24, 0x7c, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbd, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+0436 "ж" */
-    0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf9, 0x0, 0x2f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfd, 0x0, 0x0, 0x6f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20, 0x0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x60, 0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x1e,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf8, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0xdf,
-    0x80, 0x0, 0x0, 0x7, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe1, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x0, 0x3, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x20, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x40, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0xdf, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xd0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x8, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0, 0x3,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xd0, 0x0, 0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xa0, 0xaf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x50,
-
-    /* U+0437 "з" */
-    0x0, 0x0, 0x5, 0x9c, 0xef, 0xff, 0xdb, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x96, 0x32, 0x23, 0x58, 0xcf, 0xff, 0x70,
-    0x0, 0x0, 0xea, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x13, 0x8e, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0xdd, 0xdd, 0xef, 0xff, 0xd7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xb0, 0xb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0x5f,
-    0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
-    0xf9, 0x0, 0x7, 0xff, 0xfd, 0x85, 0x21, 0x1,
-    0x36, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x19, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x8b, 0xef, 0xff, 0xdb, 0x72,
-    0x0, 0x0, 0x0,
-
-    /* U+0438 "и" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0x8d, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x8d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
-    0xdf, 0x8d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfa, 0xd, 0xf8, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfc, 0x0, 0xdf,
-    0x8d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0x10, 0xd, 0xf8, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x20, 0x0, 0xdf, 0x8d,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40,
-    0x0, 0xd, 0xf8, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x70, 0x0, 0x0, 0xdf, 0x8d, 0xf9,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0,
-    0xd, 0xf8, 0xdf, 0x90, 0x0, 0x0, 0x1, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0xdf, 0x8d, 0xf9, 0x0,
-    0x0, 0x0, 0xdf, 0xd1, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0xdf, 0x90, 0x0, 0x0, 0xbf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x8d, 0xf9, 0x0, 0x0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0xdf, 0x90, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x8d, 0xf9, 0x0, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0xdf,
-    0x90, 0x2e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x8d, 0xf9, 0x1d, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0xdf, 0x9b,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x8d, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf8, 0xdf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x8d, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0xdf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80,
-
-    /* U+0439 "й" */
-    0x0, 0x0, 0x48, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x68, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0,
-    0x0, 0x1, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xb4, 0x0, 0x26, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x27, 0x99, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x8d, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf8, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x8d, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf7, 0xdf, 0x8d, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0xd, 0xf8,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfc, 0x0, 0xdf, 0x8d, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x10, 0xd, 0xf8, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20,
-    0x0, 0xdf, 0x8d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x40, 0x0, 0xd, 0xf8, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x70, 0x0, 0x0,
-    0xdf, 0x8d, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x90, 0x0, 0x0, 0xd, 0xf8, 0xdf, 0x90, 0x0,
-    0x0, 0x1, 0xef, 0xc0, 0x0, 0x0, 0x0, 0xdf,
-    0x8d, 0xf9, 0x0, 0x0, 0x0, 0xdf, 0xd1, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0xdf, 0x90, 0x0, 0x0,
-    0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x8d,
-    0xf9, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0xdf, 0x90, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x8d, 0xf9,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0xdf, 0x90, 0x2e, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x8d, 0xf9, 0x1d,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0xdf, 0x9b, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x8d, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x8d, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0xdf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x80,
-
-    /* U+043A "к" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x50, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x90,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xd1, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x10,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf3, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x1,
-    0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x1e, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x2, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf5, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xe1, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xa0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf7, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf2,
-
-    /* U+043B "л" */
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0,
-    0x0, 0x1, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x3f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xc0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xc0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0,
-    0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc0, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0,
-    0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0xc, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0,
-    0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0,
-    0xb, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xfc, 0x23, 0x4b, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc9,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xfc, 0xaf, 0xfd, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xc0,
-
-    /* U+043C "м" */
-    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0xdf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf7, 0xdf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf7, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf7,
-    0xdf, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xdc, 0xf7, 0xdf, 0x6a,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x3c, 0xf7, 0xdf, 0x61, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0xc, 0xf7, 0xdf, 0x60, 0x6f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0xc, 0xf7,
-    0xdf, 0x60, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x60, 0xc, 0xf7, 0xdf, 0x60,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0xc, 0xf7, 0xdf, 0x60, 0x0, 0x9f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0xc, 0xf7, 0xdf, 0x60, 0x0, 0x1e, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xc, 0xf7,
-    0xdf, 0x60, 0x0, 0x6, 0xff, 0x10, 0x0, 0x0,
-    0x4, 0xfe, 0x10, 0x0, 0xc, 0xf7, 0xdf, 0x60,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0xd, 0xf6,
-    0x0, 0x0, 0xc, 0xf7, 0xdf, 0x60, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0xc, 0xf7, 0xdf, 0x60, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0xc, 0xf7,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0xef, 0x60, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0xc, 0xf7, 0xdf, 0x60,
-    0x0, 0x0, 0x0, 0x5f, 0xf1, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0xc, 0xf7, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0xb, 0xfa, 0xdf, 0x50, 0x0, 0x0, 0x0,
-    0xc, 0xf7, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf7, 0xdf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf7, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf7, 0xdf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf7,
-
-    /* U+043D "н" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xdf, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x17, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xfd,
-    0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x74,
-    0x22, 0x36, 0xaf, 0xff, 0xc2, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x8f, 0xfe, 0x30, 0x0, 0x0, 0xa, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe1,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x50, 0x6, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0,
-    0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf2, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf6, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x5f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0x5f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfb, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x3f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf9, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6,
-    0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf2, 0x6, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xc0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x40, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfb, 0x0, 0x0, 0xa, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xe1,
-    0x0, 0x0, 0x0, 0xbf, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x1, 0x8f, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfc, 0x74, 0x22, 0x36, 0xaf, 0xff,
-    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xfd,
-    0x95, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+043F "п" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf,
-    0xa2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x26, 0xff, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf1, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x1d,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf1, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x1d, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x1d, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf1, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x1d, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x1d, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf1, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10,
-
-    /* U+0440 "р" */
-    0xcf, 0x80, 0x0, 0x0, 0x49, 0xce, 0xff, 0xeb,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0x9, 0xff, 0xe9, 0x53,
-    0x22, 0x48, 0xdf, 0xff, 0x80, 0x0, 0x0, 0xcf,
-    0x80, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xfa, 0x0, 0x0, 0xcf, 0x88, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90,
-    0x0, 0xcf, 0xbf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0xcf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfd, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0xcf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xa0, 0xcf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xe0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf2, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf2, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0xcf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf0, 0xcf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0,
-    0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xa0, 0xcf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x40, 0xcf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0xcf,
-    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4, 0x0, 0xcf, 0xa8, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90,
-    0x0, 0xcf, 0xa0, 0xaf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xdf, 0xfa, 0x0, 0x0, 0xcf, 0xa0,
-    0x9, 0xff, 0xe9, 0x53, 0x22, 0x47, 0xdf, 0xff,
-    0x80, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xeb,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xbe, 0xff, 0xfd,
-    0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfc, 0x74, 0x22, 0x35, 0x9f,
-    0xff, 0xd2, 0x0, 0x0, 0xb, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xe1, 0x0, 0xa,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0x90, 0x6, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x70, 0x0, 0xef, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x70, 0x0, 0xa,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0x90, 0x0, 0xb, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xe1, 0x0, 0x0, 0x8,
-    0xff, 0xfc, 0x74, 0x22, 0x35, 0x9f, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xbe, 0xff, 0xfd, 0xa5, 0x0, 0x0, 0x0,
-
-    /* U+0442 "т" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2,
-    0x22, 0x22, 0x22, 0x22, 0x5f, 0xf4, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0443 "у" */
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x50, 0xc, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0x5f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x20, 0x0, 0x0, 0x0, 0x9, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x1, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xa0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x10, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xe0, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x70, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf5, 0x3f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xca, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0x10, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x83, 0x12, 0x5b, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xae,
-    0xff, 0xd9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x26, 0x9c, 0xdf, 0xff, 0xfe, 0xdb,
-    0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xfd, 0x96, 0x43, 0xcf, 0xa3,
-    0x47, 0xae, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x82, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x3, 0xaf, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xaf, 0xfb, 0x10, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x3d, 0xff, 0x70, 0x0,
-    0x0, 0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd,
-    0x0, 0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf5, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xb0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x5, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x6f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x37, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf4, 0x6f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x34, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf1, 0x2f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0xef, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x8, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0, 0x0,
-    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0x30, 0x0,
-    0x0, 0xaf, 0xfc, 0x20, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x3d, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x92, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x3, 0xaf, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0xfd, 0x96, 0x43,
-    0xcf, 0xa3, 0x47, 0xae, 0xff, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0xac,
-    0xef, 0xff, 0xfe, 0xdb, 0x85, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xa0, 0x0, 0x5f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x0,
-    0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0xcf, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0xa,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfe, 0x10, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x3, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf9, 0x1e, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xdf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xfc, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xe1, 0x6, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x40, 0x0, 0xaf,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf7, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xb0, 0x0, 0x0, 0x2,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x5, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe1, 0x0,
-    0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xfb, 0x0, 0x0, 0xdf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80,
-    0xa, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5,
-
-    /* U+0446 "ц" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0xdf, 0x91,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1d,
-    0xfa, 0x11, 0x11, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfc,
-
-    /* U+0447 "ч" */
-    0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x9f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x9f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x9f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x9f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x9f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x8f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x5f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x7, 0xff, 0xb1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xf3, 0x0,
-    0x9f, 0xff, 0x94, 0x10, 0x0, 0x24, 0x8c, 0xff,
-    0xff, 0xf3, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd7, 0x5f, 0xf3, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfe, 0xca, 0x62, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3,
-
-    /* U+0448 "ш" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xdf, 0xa1,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0xff, 0x51,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0xfe, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe,
-
-    /* U+0449 "щ" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0xdf, 0xa1, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x13, 0xff, 0x51, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x19, 0xfe, 0x11, 0x11, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x86,
-
-    /* U+044A "ъ" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x22,
-    0x22, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xed, 0xdd, 0xdd, 0xdd, 0xdc, 0xa7, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x2, 0x5a, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x14, 0x9f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xff,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72,
-    0x0, 0x0, 0x0,
-
-    /* U+044B "ы" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xad, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xad, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xad, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfa, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xad, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xad, 0xfe, 0xdd, 0xdd, 0xdd, 0xdc, 0xca,
-    0x73, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x0, 0xcf, 0xad, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x24, 0x9e, 0xff, 0x90, 0x0, 0x0,
-    0xc, 0xfa, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0xcf, 0xad,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfe, 0x0, 0x0, 0xc, 0xfa, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
-    0x0, 0xcf, 0xad, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0xc, 0xfa,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0xcf, 0xad, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0xc, 0xfa, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0xcf,
-    0xad, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0xc, 0xfa, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0,
-    0x0, 0x0, 0xcf, 0xad, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf5, 0x0, 0x0, 0xc,
-    0xfa, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0xcf, 0xad, 0xff,
-    0xee, 0xee, 0xee, 0xef, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0,
-
-    /* U+044C "ь" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xed, 0xdd, 0xdd, 0xdd, 0xcc,
-    0xa8, 0x40, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x1, 0x48, 0xef, 0xfa, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x80, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf1, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfc, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf1, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x70, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x37, 0xef, 0xf9, 0x0, 0xdf, 0xfe,
-    0xee, 0xee, 0xee, 0xef, 0xff, 0xfe, 0x60, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x50,
-    0x0, 0x0,
-
-    /* U+044D "э" */
-    0x0, 0x0, 0x3, 0x8b, 0xdf, 0xff, 0xeb, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xfd, 0x84, 0x20, 0x0, 0x25, 0xaf,
-    0xff, 0xa0, 0x0, 0x0, 0x1e, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0xfc, 0x10, 0x0,
-    0x4, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x9,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfa,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x6, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xc0, 0x0, 0x1e, 0xfe, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xaf, 0xfc, 0x10, 0x0,
-    0x2, 0xcf, 0xfe, 0x95, 0x31, 0x1, 0x36, 0xbf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x8b, 0xdf, 0xff, 0xeb, 0x72,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+044E "ю" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xbe, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfc, 0x74, 0x22, 0x36, 0xaf, 0xff,
-    0xb1, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xfd, 0x10, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xc0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x10, 0xdf,
-    0x90, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x80,
-    0xdf, 0x90, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xd0, 0xdf, 0x90, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0xdf, 0x90, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf5, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf6, 0xdf, 0xa3, 0x33,
-    0x33, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf5, 0xdf, 0x90,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0xdf,
-    0x90, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1,
-    0xdf, 0x90, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xd0, 0xdf, 0x90, 0x0, 0x0, 0x2, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x80, 0xdf, 0x90, 0x0, 0x0, 0x0, 0xbf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x10, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf7, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xc0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xfd, 0x10, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x63,
-    0x11, 0x25, 0xaf, 0xff, 0xb1, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xbe, 0xff, 0xfc, 0x94, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+044F "я" */
-    0x0, 0x0, 0x3, 0x8b, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x3c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x7f, 0xff,
-    0xb6, 0x32, 0x11, 0x11, 0x11, 0x11, 0x9f, 0xa0,
-    0x5f, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfa, 0xe, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xa6, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0xaf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xac, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfa, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xac, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfa, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xa6, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xa0, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0x0, 0x7f, 0xfe, 0x84, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0, 0x3c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x2, 0xcf, 0xfc, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xef, 0xa0, 0x0, 0x0, 0x4f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfa, 0x0, 0x0, 0x1e,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x0, 0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfa, 0x0, 0x9, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xa0, 0x5, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0x2,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xa0, 0xcf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfa, 0x9f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x0, 0x3, 0x88, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x59, 0xdf, 0xff, 0xdb, 0x61, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x1b, 0xff, 0xe9, 0x42, 0x12, 0x47, 0xdf, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0x40, 0x0, 0x0,
-    0xc, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0x20, 0x0, 0x7, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfc, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf5, 0x0, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xc0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x11, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf5, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x75, 0xff,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcf, 0xf9, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
-    0xa, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0xb, 0xff, 0xc4,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xf8, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfd, 0x85, 0x32, 0x24,
-    0x7c, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xbd, 0xff,
-    0xfe, 0xb7, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0, 0x6,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf3, 0x0, 0x0, 0xef, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x10, 0x0,
-    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x16, 0x20, 0x0, 0x0, 0x5, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x59, 0xdf, 0xff, 0xdb, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xe9, 0x42, 0x12, 0x47, 0xdf, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0x40, 0x0, 0x0, 0xc,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0x20, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xfc, 0x0, 0x1,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0x0, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x11, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x75, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcf, 0xf9, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0xa,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0x0, 0xb, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xbf, 0xf8, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfd, 0x85, 0x32, 0x24, 0x7c,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbd, 0xff, 0xfe,
-    0xb7, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0x0, 0x0, 0x68, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0xdd, 0xdd, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xfd, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x80, 0x1, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0x3, 0xef, 0xfa, 0x63, 0x22, 0x36, 0xaf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x82,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0xd, 0xf8, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xdf, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfc, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0,
-    0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0xd, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x90, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfa, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0xcf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xc6, 0x20, 0x15, 0xcf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x87,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0xdf, 0xa2, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x20, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe,
-    0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfc, 0x73, 0x10, 0x12,
-    0x48, 0xdf, 0xfe, 0x40, 0x0, 0x0, 0x9f, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xf4,
-    0x0, 0x9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xa0, 0x0, 0x5f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x6f, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xc0, 0x0, 0x0, 0x0,
-    0x4f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x80, 0x0, 0x0, 0x9f, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xf4,
-    0x0, 0x0, 0x7, 0xff, 0xfc, 0x63, 0x10, 0x1,
-    0x47, 0xcf, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x2a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe,
-    0xc9, 0x50, 0x0, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xec, 0x95,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0xb, 0xff,
-    0xd7, 0x42, 0x11, 0x35, 0x8d, 0xff, 0xf4, 0x0,
-    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xbd, 0x0, 0x2, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x7f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff,
-    0xc9, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xbf, 0xff, 0xff, 0xff, 0xc7, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x69, 0xcf, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x8d, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0xb, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x4, 0xff, 0xc5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70, 0x9,
-    0xff, 0xfe, 0xa6, 0x32, 0x11, 0x25, 0x8e, 0xff,
-    0xa0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x15, 0x9c,
-    0xef, 0xff, 0xec, 0x95, 0x0, 0x0, 0x0,
-
-    /* U+0456 "і" */
-    0x9, 0xd7, 0x7, 0xff, 0xf4, 0x8f, 0xff, 0x41,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0xdf, 0x90, 0xd, 0xf9,
-    0x0, 0xdf, 0x90, 0xd, 0xf9, 0x0, 0xdf, 0x90,
-    0xd, 0xf9, 0x0, 0xdf, 0x90, 0xd, 0xf9, 0x0,
-    0xdf, 0x90, 0xd, 0xf9, 0x0, 0xdf, 0x90, 0xd,
-    0xf9, 0x0, 0xdf, 0x90, 0xd, 0xf9, 0x0, 0xdf,
-    0x90, 0xd, 0xf9, 0x0, 0xdf, 0x90, 0xd, 0xf9,
-    0x0, 0xdf, 0x90, 0xd, 0xf9, 0x0, 0xdf, 0x90,
-    0xd, 0xf9, 0x0, 0xdf, 0x90, 0xd, 0xf9, 0x0,
-
-    /* U+0457 "ї" */
-    0xb, 0xf7, 0x0, 0xc, 0xf6, 0x5f, 0xff, 0x0,
-    0x6f, 0xfe, 0x2f, 0xfb, 0x0, 0x3f, 0xfb, 0x2,
-    0x50, 0x0, 0x2, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0xef, 0x70, 0x0,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x40,
-    0x2, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x0, 0xd,
-    0xd6, 0x20, 0x15, 0xdf, 0xf5, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x6b, 0xef,
-    0xfd, 0x92, 0x0, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xcf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0xdd,
-    0xdd, 0xdd, 0xde, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xaf, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x7f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xd0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0, 0x0,
-    0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0xcf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x0, 0x0, 0x5, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x0,
-    0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x1f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf4, 0x0, 0x0, 0xbf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xa0, 0x23, 0x4b,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xd3, 0x33, 0x33, 0x33, 0x34, 0x6a,
-    0xff, 0xfc, 0x0, 0x9f, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xaf, 0xfd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xda, 0x61, 0x0, 0x0,
-
-    /* U+045A "њ" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xb7, 0x10, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xdf, 0x91, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x1e, 0xf8, 0x11, 0x11, 0x11,
-    0x11, 0x25, 0x9f, 0xff, 0xb0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
-    0x80, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x6d, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x5d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfc, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x40, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6d, 0xff, 0x60,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xed, 0xdd, 0xdd, 0xdd, 0xef,
-    0xff, 0xfd, 0x40, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x0, 0x0, 0x6, 0x84, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x49, 0x99, 0x99, 0x9e, 0xfd, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xfd,
-    0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x3, 0xef, 0xfa, 0x63, 0x22, 0x36, 0xbf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x2f,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0xd,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfa, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0xd,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0xd, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfa, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0,
-    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x87,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x50, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf7, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x90, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xd1, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x10, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf3,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x1, 0xef, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x1e, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf5, 0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xe1,
-    0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfc, 0x0, 0x0, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xa0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf7, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf2,
-
-    /* U+045D "ѝ" */
-    0x0, 0x0, 0x68, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x8d, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf8, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x8d, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf7, 0xdf, 0x8d, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0xd, 0xf8,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfc, 0x0, 0xdf, 0x8d, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x10, 0xd, 0xf8, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20,
-    0x0, 0xdf, 0x8d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x40, 0x0, 0xd, 0xf8, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x70, 0x0, 0x0,
-    0xdf, 0x8d, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x90, 0x0, 0x0, 0xd, 0xf8, 0xdf, 0x90, 0x0,
-    0x0, 0x1, 0xef, 0xc0, 0x0, 0x0, 0x0, 0xdf,
-    0x8d, 0xf9, 0x0, 0x0, 0x0, 0xdf, 0xd1, 0x0,
-    0x0, 0x0, 0xd, 0xf8, 0xdf, 0x90, 0x0, 0x0,
-    0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x8d,
-    0xf9, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf8, 0xdf, 0x90, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x8d, 0xf9,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf8, 0xdf, 0x90, 0x2e, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x8d, 0xf9, 0x1d,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf8, 0xdf, 0x9b, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x8d, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x8d, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf8, 0xdf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x80,
-
-    /* U+045E "ў" */
-    0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe5, 0x0, 0x0,
-    0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfe, 0xa9, 0xbf, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0xcf, 0xfe, 0xc7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x50, 0xc, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xe0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0x0,
-    0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x6, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x80, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x1, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0xf,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xa0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10,
-    0x0, 0x0, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xe0, 0x0, 0xd, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x70, 0x4, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0xbf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xca, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0x10, 0x0, 0x0,
-    0x7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x83, 0x12, 0x5b, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xae, 0xff,
-    0xd9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+045F "џ" */
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x4d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf4, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x4d,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf4, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x4d, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x4d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf4, 0xdf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x4d, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf4, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x4d, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x4d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf4, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x4d, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x4d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf4, 0xdf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x4d,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf4, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x4d, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0xdf,
-    0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13,
-    0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf9,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x32, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xdf, 0xa2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+2014 "—" */
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+2018 "‘" */
-    0x0, 0x1f, 0xa0, 0x5, 0xf7, 0x0, 0x9f, 0x30,
-    0xe, 0xf0, 0x2, 0xfc, 0x0, 0x7f, 0x90, 0xb,
-    0xf5, 0x0, 0xff, 0xd2, 0x3f, 0xff, 0xb2, 0xff,
-    0xfa, 0x7, 0xfd, 0x20,
-
-    /* U+2019 "’" */
-    0x7, 0xfd, 0x32, 0xff, 0xfb, 0x2f, 0xff, 0xc0,
-    0x7f, 0xf9, 0x0, 0xcf, 0x40, 0xf, 0xf0, 0x4,
-    0xfb, 0x0, 0x8f, 0x60, 0xc, 0xf1, 0x0, 0xfc,
-    0x0, 0x17, 0x40, 0x0,
-
-    /* U+201A "‚" */
-    0x7, 0xfd, 0x32, 0xff, 0xfb, 0x2f, 0xff, 0xc0,
-    0x7f, 0xf9, 0x0, 0xcf, 0x40, 0xf, 0xf0, 0x4,
-    0xfb, 0x0, 0x8f, 0x60, 0xb, 0xf1, 0x0, 0xfd,
-    0x0, 0x18, 0x40, 0x0,
-
-    /* U+201C "“" */
-    0x0, 0x1f, 0xa0, 0x0, 0x0, 0xbf, 0x0, 0x5,
-    0xf7, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x9f, 0x30,
-    0x0, 0x4, 0xf9, 0x0, 0xe, 0xf0, 0x0, 0x0,
-    0x8f, 0x50, 0x2, 0xfc, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x7f, 0x90, 0x0, 0x1, 0xfe, 0x0, 0xb,
-    0xf5, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0xff, 0xd2,
-    0x0, 0xa, 0xff, 0x60, 0x3f, 0xff, 0xb0, 0x0,
-    0xdf, 0xff, 0x2, 0xff, 0xfa, 0x0, 0xc, 0xff,
-    0xf0, 0x7, 0xfd, 0x20, 0x0, 0x3d, 0xe6, 0x0,
-
-    /* U+201D "”" */
-    0x7, 0xfd, 0x30, 0x0, 0x3d, 0xf7, 0x2, 0xff,
-    0xfb, 0x0, 0xc, 0xff, 0xf1, 0x2f, 0xff, 0xc0,
-    0x0, 0xcf, 0xff, 0x10, 0x7f, 0xf9, 0x0, 0x3,
-    0xdf, 0xe0, 0x0, 0xcf, 0x40, 0x0, 0x7, 0xfa,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0xbf, 0x50, 0x4,
-    0xfb, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x8f, 0x60,
-    0x0, 0x2, 0xfb, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x6f, 0x70, 0x0, 0xfc, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x17, 0x40, 0x0, 0x0, 0x67, 0x0, 0x0,
-
-    /* U+2026 "…" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd3, 0x0,
-    0x0, 0x0, 0xaf, 0xc1, 0x0, 0x0, 0x0, 0xcf,
-    0xb0, 0x2f, 0xff, 0xb0, 0x0, 0x0, 0x4f, 0xff,
-    0x90, 0x0, 0x0, 0x7f, 0xff, 0x62, 0xff, 0xfb,
-    0x0, 0x0, 0x4, 0xff, 0xf8, 0x0, 0x0, 0x6,
-    0xff, 0xf6, 0x7, 0xfd, 0x20, 0x0, 0x0, 0x9,
-    0xfc, 0x10, 0x0, 0x0, 0xb, 0xfa, 0x0,
-
-    /* U+20B4 "₴" */
-    0x0, 0x0, 0x0, 0x0, 0x16, 0x9c, 0xef, 0xff,
-    0xec, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xff, 0xfc, 0x96, 0x42, 0x22, 0x46, 0x9e,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xf7, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x89, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x89, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x93, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x3, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xa7,
-    0x43, 0x22, 0x35, 0x7b, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8b, 0xdf, 0xff,
-    0xfd, 0xb7, 0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2116 "№" */
-    0x19, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x99, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x59, 0xbc, 0xb9, 0x50, 0x0,
-    0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0xdc, 0xef, 0xfe,
-    0x50, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x8, 0xfe, 0x61, 0x0, 0x1,
-    0x7f, 0xf7, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0x5f, 0xd1, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0x50, 0x2f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x2f, 0xf8, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x30, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x2f, 0xf4,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x2f,
-    0xf4, 0x9, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0xa,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x2f, 0xf4, 0x0, 0xcf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x2f, 0xf4, 0x0, 0x1e, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x2f, 0xf4, 0x0, 0x4, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x2f, 0xf4, 0x0, 0x0, 0x7f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x2f, 0xf4, 0x0, 0x0,
-    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x1e, 0xf7, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x10, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0xdf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x2, 0xdf,
-    0xd8, 0x54, 0x58, 0xef, 0xd2, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x2f, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x55, 0x52, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0x23, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x20, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7, 0x0,
-    0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x69, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x50, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x40, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xe1, 0x0, 0x3, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfc, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x90, 0x3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x33,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xd4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfe, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 197, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 194, .box_w = 5, .box_h = 33, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 83, .adv_w = 274, .box_w = 11, .box_h = 13, .ofs_x = 3, .ofs_y = 20},
-    {.bitmap_index = 155, .adv_w = 530, .box_w = 31, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 667, .adv_w = 468, .box_w = 25, .box_h = 45, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 1230, .adv_w = 627, .box_w = 36, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1824, .adv_w = 503, .box_w = 29, .box_h = 34, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 2317, .adv_w = 149, .box_w = 3, .box_h = 13, .ofs_x = 3, .ofs_y = 20},
-    {.bitmap_index = 2337, .adv_w = 247, .box_w = 9, .box_h = 44, .ofs_x = 5, .ofs_y = -9},
-    {.bitmap_index = 2535, .adv_w = 247, .box_w = 9, .box_h = 44, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 2733, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 18},
-    {.bitmap_index = 2869, .adv_w = 437, .box_w = 21, .box_h = 20, .ofs_x = 3, .ofs_y = 7},
-    {.bitmap_index = 3079, .adv_w = 154, .box_w = 5, .box_h = 11, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 3107, .adv_w = 293, .box_w = 14, .box_h = 3, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 3128, .adv_w = 154, .box_w = 5, .box_h = 5, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3141, .adv_w = 246, .box_w = 19, .box_h = 45, .ofs_x = -2, .ofs_y = -5},
-    {.bitmap_index = 3569, .adv_w = 505, .box_w = 27, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4015, .adv_w = 271, .box_w = 12, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4213, .adv_w = 432, .box_w = 25, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4626, .adv_w = 429, .box_w = 25, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5039, .adv_w = 502, .box_w = 29, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5518, .adv_w = 429, .box_w = 24, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5914, .adv_w = 462, .box_w = 26, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6343, .adv_w = 446, .box_w = 25, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6756, .adv_w = 485, .box_w = 26, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7185, .adv_w = 462, .box_w = 26, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7614, .adv_w = 154, .box_w = 5, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7677, .adv_w = 154, .box_w = 5, .box_h = 32, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 7757, .adv_w = 437, .box_w = 21, .box_h = 19, .ofs_x = 3, .ofs_y = 7},
-    {.bitmap_index = 7957, .adv_w = 437, .box_w = 21, .box_h = 13, .ofs_x = 3, .ofs_y = 10},
-    {.bitmap_index = 8094, .adv_w = 437, .box_w = 21, .box_h = 19, .ofs_x = 3, .ofs_y = 7},
-    {.bitmap_index = 8294, .adv_w = 432, .box_w = 24, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8690, .adv_w = 793, .box_w = 45, .box_h = 42, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 9635, .adv_w = 541, .box_w = 34, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10196, .adv_w = 578, .box_w = 29, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 10675, .adv_w = 542, .box_w = 31, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11187, .adv_w = 634, .box_w = 33, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 11732, .adv_w = 514, .box_w = 25, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 12145, .adv_w = 485, .box_w = 24, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 12541, .adv_w = 594, .box_w = 31, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13053, .adv_w = 625, .box_w = 29, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 13532, .adv_w = 227, .box_w = 4, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 13598, .adv_w = 377, .box_w = 19, .box_h = 33, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 13912, .adv_w = 540, .box_w = 29, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 14391, .adv_w = 449, .box_w = 23, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 14771, .adv_w = 734, .box_w = 36, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 15365, .adv_w = 625, .box_w = 29, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 15844, .adv_w = 644, .box_w = 36, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16438, .adv_w = 549, .box_w = 27, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 16884, .adv_w = 644, .box_w = 38, .box_h = 40, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 17644, .adv_w = 553, .box_w = 27, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 18090, .adv_w = 468, .box_w = 25, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18503, .adv_w = 432, .box_w = 27, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18949, .adv_w = 609, .box_w = 28, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 19411, .adv_w = 528, .box_w = 33, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19956, .adv_w = 843, .box_w = 50, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20781, .adv_w = 493, .box_w = 30, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21276, .adv_w = 480, .box_w = 30, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21771, .adv_w = 496, .box_w = 28, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22233, .adv_w = 235, .box_w = 9, .box_h = 44, .ofs_x = 5, .ofs_y = -9},
-    {.bitmap_index = 22431, .adv_w = 246, .box_w = 19, .box_h = 45, .ofs_x = -2, .ofs_y = -5},
-    {.bitmap_index = 22859, .adv_w = 235, .box_w = 8, .box_h = 44, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 23035, .adv_w = 438, .box_w = 20, .box_h = 20, .ofs_x = 4, .ofs_y = 7},
-    {.bitmap_index = 23235, .adv_w = 384, .box_w = 24, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 23259, .adv_w = 461, .box_w = 11, .box_h = 6, .ofs_x = 7, .ofs_y = 29},
-    {.bitmap_index = 23292, .adv_w = 448, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23567, .adv_w = 518, .box_w = 26, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 24022, .adv_w = 426, .box_w = 23, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24310, .adv_w = 518, .box_w = 26, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24765, .adv_w = 458, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 25078, .adv_w = 252, .box_w = 18, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25393, .adv_w = 524, .box_w = 26, .box_h = 34, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 25835, .adv_w = 517, .box_w = 23, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 26238, .adv_w = 200, .box_w = 5, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 26326, .adv_w = 204, .box_w = 14, .box_h = 44, .ofs_x = -5, .ofs_y = -9},
-    {.bitmap_index = 26634, .adv_w = 448, .box_w = 23, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 27037, .adv_w = 200, .box_w = 3, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 27090, .adv_w = 817, .box_w = 42, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 27615, .adv_w = 517, .box_w = 23, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 27903, .adv_w = 476, .box_w = 26, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 28228, .adv_w = 518, .box_w = 26, .box_h = 34, .ofs_x = 5, .ofs_y = -9},
-    {.bitmap_index = 28670, .adv_w = 518, .box_w = 26, .box_h = 34, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 29112, .adv_w = 303, .box_w = 12, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 29262, .adv_w = 367, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 29525, .adv_w = 306, .box_w = 18, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29804, .adv_w = 514, .box_w = 24, .box_h = 25, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 30104, .adv_w = 406, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 30429, .adv_w = 662, .box_w = 41, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 30942, .adv_w = 399, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 31230, .adv_w = 406, .box_w = 28, .box_h = 34, .ofs_x = -2, .ofs_y = -9},
-    {.bitmap_index = 31706, .adv_w = 386, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 31969, .adv_w = 246, .box_w = 13, .box_h = 44, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 32255, .adv_w = 223, .box_w = 4, .box_h = 44, .ofs_x = 5, .ofs_y = -9},
-    {.bitmap_index = 32343, .adv_w = 246, .box_w = 12, .box_h = 44, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 32607, .adv_w = 437, .box_w = 22, .box_h = 7, .ofs_x = 3, .ofs_y = 13},
-    {.bitmap_index = 32684, .adv_w = 349, .box_w = 18, .box_h = 18, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 32846, .adv_w = 349, .box_w = 19, .box_h = 18, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 33017, .adv_w = 502, .box_w = 24, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 33521, .adv_w = 502, .box_w = 24, .box_h = 41, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 34013, .adv_w = 629, .box_w = 38, .box_h = 34, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 34659, .adv_w = 436, .box_w = 21, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 35100, .adv_w = 542, .box_w = 29, .box_h = 33, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35579, .adv_w = 476, .box_w = 26, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 36008, .adv_w = 233, .box_w = 3, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 36058, .adv_w = 227, .box_w = 12, .box_h = 41, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36304, .adv_w = 396, .box_w = 19, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36618, .adv_w = 911, .box_w = 55, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 37526, .adv_w = 912, .box_w = 49, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 38335, .adv_w = 634, .box_w = 37, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 38946, .adv_w = 534, .box_w = 27, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 39513, .adv_w = 634, .box_w = 28, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 40101, .adv_w = 515, .box_w = 31, .box_h = 42, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40752, .adv_w = 618, .box_w = 27, .box_h = 41, .ofs_x = 6, .ofs_y = -8},
-    {.bitmap_index = 41306, .adv_w = 563, .box_w = 35, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 41884, .adv_w = 555, .box_w = 26, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 42313, .adv_w = 576, .box_w = 27, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 42759, .adv_w = 436, .box_w = 21, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 43106, .adv_w = 604, .box_w = 36, .box_h = 41, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 43844, .adv_w = 502, .box_w = 24, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 44240, .adv_w = 765, .box_w = 46, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 44999, .adv_w = 470, .box_w = 27, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 45445, .adv_w = 634, .box_w = 28, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 45907, .adv_w = 634, .box_w = 28, .box_h = 42, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 46495, .adv_w = 534, .box_w = 27, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 46941, .adv_w = 600, .box_w = 32, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 47469, .adv_w = 740, .box_w = 35, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 48047, .adv_w = 631, .box_w = 28, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 48509, .adv_w = 655, .box_w = 36, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 49103, .adv_w = 636, .box_w = 28, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 49565, .adv_w = 542, .box_w = 26, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 49994, .adv_w = 548, .box_w = 30, .box_h = 33, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 50489, .adv_w = 442, .box_w = 28, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 50951, .adv_w = 515, .box_w = 31, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 51463, .adv_w = 698, .box_w = 40, .box_h = 36, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 52183, .adv_w = 488, .box_w = 29, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 52662, .adv_w = 633, .box_w = 33, .box_h = 41, .ofs_x = 6, .ofs_y = -8},
-    {.bitmap_index = 53339, .adv_w = 548, .box_w = 27, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 53785, .adv_w = 839, .box_w = 41, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 54462, .adv_w = 856, .box_w = 46, .box_h = 41, .ofs_x = 6, .ofs_y = -8},
-    {.bitmap_index = 55405, .adv_w = 625, .box_w = 37, .box_h = 33, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 56016, .adv_w = 742, .box_w = 35, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 56594, .adv_w = 544, .box_w = 26, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 57023, .adv_w = 541, .box_w = 30, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 57518, .adv_w = 835, .box_w = 44, .box_h = 33, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 58244, .adv_w = 562, .box_w = 27, .box_h = 33, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 58690, .adv_w = 443, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 58965, .adv_w = 504, .box_w = 26, .box_h = 37, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 59446, .adv_w = 462, .box_w = 21, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 59709, .adv_w = 356, .box_w = 18, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 59934, .adv_w = 491, .box_w = 29, .box_h = 31, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 60384, .adv_w = 468, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 60697, .adv_w = 620, .box_w = 37, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 61160, .adv_w = 404, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 61435, .adv_w = 524, .box_w = 23, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 61723, .adv_w = 524, .box_w = 23, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 62126, .adv_w = 436, .box_w = 22, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 62401, .adv_w = 479, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 62714, .adv_w = 602, .box_w = 28, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 63064, .adv_w = 515, .box_w = 22, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 63339, .adv_w = 485, .box_w = 26, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 63664, .adv_w = 516, .box_w = 23, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 63952, .adv_w = 525, .box_w = 26, .box_h = 34, .ofs_x = 5, .ofs_y = -9},
-    {.bitmap_index = 64394, .adv_w = 428, .box_w = 23, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 64682, .adv_w = 350, .box_w = 23, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 64970, .adv_w = 419, .box_w = 27, .box_h = 34, .ofs_x = -1, .ofs_y = -9},
-    {.bitmap_index = 65429, .adv_w = 590, .box_w = 33, .box_h = 45, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 66172, .adv_w = 394, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 66472, .adv_w = 521, .box_w = 26, .box_h = 31, .ofs_x = 5, .ofs_y = -6},
-    {.bitmap_index = 66875, .adv_w = 454, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 67150, .adv_w = 705, .box_w = 34, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 67575, .adv_w = 705, .box_w = 38, .box_h = 31, .ofs_x = 5, .ofs_y = -6},
-    {.bitmap_index = 68164, .adv_w = 465, .box_w = 29, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 68527, .adv_w = 588, .box_w = 27, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 68865, .adv_w = 425, .box_w = 20, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 69115, .adv_w = 436, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 69415, .adv_w = 657, .box_w = 34, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 69840, .adv_w = 462, .box_w = 21, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 70103, .adv_w = 476, .box_w = 25, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 70541, .adv_w = 468, .box_w = 25, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 70954, .adv_w = 512, .box_w = 29, .box_h = 45, .ofs_x = -1, .ofs_y = -9},
-    {.bitmap_index = 71607, .adv_w = 356, .box_w = 18, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 71922, .adv_w = 436, .box_w = 24, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 72222, .adv_w = 399, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 72485, .adv_w = 204, .box_w = 5, .box_h = 35, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 72573, .adv_w = 200, .box_w = 10, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 72738, .adv_w = 204, .box_w = 14, .box_h = 44, .ofs_x = -5, .ofs_y = -9},
-    {.bitmap_index = 73046, .adv_w = 700, .box_w = 42, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 73571, .adv_w = 720, .box_w = 39, .box_h = 25, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 74059, .adv_w = 512, .box_w = 30, .box_h = 36, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 74599, .adv_w = 436, .box_w = 22, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 74984, .adv_w = 524, .box_w = 23, .box_h = 35, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 75387, .adv_w = 419, .box_w = 27, .box_h = 44, .ofs_x = -1, .ofs_y = -9},
-    {.bitmap_index = 75981, .adv_w = 487, .box_w = 21, .box_h = 31, .ofs_x = 5, .ofs_y = -6},
-    {.bitmap_index = 76307, .adv_w = 438, .box_w = 21, .box_h = 40, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 76727, .adv_w = 334, .box_w = 16, .box_h = 30, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 76967, .adv_w = 384, .box_w = 24, .box_h = 2, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 76991, .adv_w = 768, .box_w = 48, .box_h = 2, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 77039, .adv_w = 154, .box_w = 5, .box_h = 11, .ofs_x = 2, .ofs_y = 24},
-    {.bitmap_index = 77067, .adv_w = 154, .box_w = 5, .box_h = 11, .ofs_x = 2, .ofs_y = 24},
-    {.bitmap_index = 77095, .adv_w = 154, .box_w = 5, .box_h = 11, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 77123, .adv_w = 271, .box_w = 13, .box_h = 11, .ofs_x = 2, .ofs_y = 24},
-    {.bitmap_index = 77195, .adv_w = 271, .box_w = 13, .box_h = 11, .ofs_x = 2, .ofs_y = 24},
-    {.bitmap_index = 77267, .adv_w = 468, .box_w = 25, .box_h = 5, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 77330, .adv_w = 634, .box_w = 30, .box_h = 33, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 77825, .adv_w = 919, .box_w = 50, .box_h = 34, .ofs_x = 5, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24, 0x1c86
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7303, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-const lv_font_t lv_font_montserrat_cyrillic_48;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_48 = {
-#else
-lv_font_t montserrat_cyrillic_48 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 51,          /*The maximum line height required by the font*/
-    .base_line = 9,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -5,
-    .underline_thickness = 2,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_cyrillic_48,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_48*/
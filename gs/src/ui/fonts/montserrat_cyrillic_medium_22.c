@@ -1,3801 +0,0 @@
-/*******************************************************************************
- * Size: 22 px
- * Bpp: 4
- * Opts: --bpp 4 --size 22 --no-compress --stride 1 --align 1 --font Montserrat-Medium.ttf --range 32-127,1024-1119,1168-1169,8372,8211-8212,8216-8221,171,187,8230 --format lvgl -o montserrat_cyrillic_medium_22.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_CYRILLIC_MEDIUM_22
-#define MONTSERRAT_CYRILLIC_MEDIUM_22 1
-#endif
-
-#if MONTSERRAT_CYRILLIC_MEDIUM_22
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x4f, 0xf2, 0x3f, 0xf2, 0x3f, 0xf1, 0x2f, 0xf1,
-    0x1f, 0xf0, 0x1f, 0xf0, 0xf, 0xf0, 0xf, 0xe0,
-    0xf, 0xd0, 0xf, 0xd0, 0xa, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xb0, 0x6f, 0xf5, 0x2d, 0xd1,
-
-    /* U+0022 "\"" */
-    0x9f, 0x30, 0x9f, 0x39, 0xf3, 0x9, 0xf2, 0x8f,
-    0x20, 0x9f, 0x28, 0xf2, 0x8, 0xf2, 0x8f, 0x10,
-    0x8f, 0x17, 0xf1, 0x8, 0xf1, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x4f, 0x40, 0x0,
-    0x0, 0x1, 0xf7, 0x0, 0x6, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0x50, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0xa, 0xe0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7a, 0xad,
-    0xfa, 0xaa, 0xaf, 0xda, 0xa8, 0x0, 0x0, 0xbd,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xb0,
-    0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0xf9, 0x0,
-    0x3, 0xf5, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x0,
-    0x5f, 0x30, 0x0, 0x4a, 0xab, 0xfc, 0xaa, 0xac,
-    0xfa, 0xaa, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x7, 0xf1, 0x0, 0xb, 0xd0,
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0xa, 0xe0, 0x0, 0xf, 0x90, 0x0,
-    0x0, 0x0, 0xcc, 0x0, 0x1, 0xf7, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x65, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xca, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xef, 0xfe,
-    0xc7, 0x10, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x3f, 0xf8, 0x1c, 0xa0, 0x4a, 0xa0, 0x9,
-    0xfa, 0x0, 0xca, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0xc, 0xa0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0xca,
-    0x0, 0x0, 0x0, 0x2f, 0xfe, 0x7d, 0xa0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xfe, 0x94, 0x0, 0x0,
-    0x0, 0x6, 0xbf, 0xff, 0xfd, 0x30, 0x0, 0x0,
-    0x0, 0xcc, 0x9f, 0xff, 0x20, 0x0, 0x0, 0xc,
-    0xa0, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0xca, 0x0,
-    0x7f, 0xb0, 0x42, 0x0, 0xc, 0xa0, 0x9, 0xfa,
-    0xd, 0xf8, 0x20, 0xca, 0x17, 0xff, 0x40, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x28, 0xcf,
-    0xff, 0xea, 0x40, 0x0, 0x0, 0x0, 0xc, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xca, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0x50, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x6d, 0xfd, 0x40, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0x6, 0xf8, 0x5a, 0xf3, 0x0, 0x0, 0x4f,
-    0x60, 0x0, 0xe, 0x90, 0x0, 0xcb, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x1f, 0x50, 0x0, 0x8e, 0x0,
-    0x9, 0xf1, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x7e,
-    0x0, 0x4f, 0x60, 0x0, 0x0, 0xf, 0x80, 0x0,
-    0xbc, 0x0, 0xec, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x16, 0xf5, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x80, 0x3f, 0x70, 0x9f, 0xfb, 0x20,
-    0x0, 0x1, 0x31, 0x0, 0xdc, 0x9, 0xf6, 0x5d,
-    0xd0, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x1f, 0x60,
-    0x2, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0x70, 0x4f,
-    0x10, 0x0, 0xd9, 0x0, 0x0, 0x0, 0xdc, 0x0,
-    0x6f, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x8, 0xf2,
-    0x0, 0x4f, 0x10, 0x0, 0xc9, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x1f, 0x50, 0x1, 0xf5, 0x0, 0x0,
-    0xdd, 0x0, 0x0, 0x8, 0xe5, 0x3c, 0xd0, 0x0,
-    0x8, 0xf3, 0x0, 0x0, 0x0, 0x8e, 0xfb, 0x10,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x4c, 0xee, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfa, 0xaf, 0xf5, 0x0, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xf,
-    0xf2, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x8f,
-    0xc1, 0x8f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0xdf,
-    0xa0, 0x0, 0x53, 0x0, 0x3f, 0xf4, 0x1, 0xdf,
-    0xa0, 0xe, 0xe0, 0xb, 0xf6, 0x0, 0x1, 0xdf,
-    0xa4, 0xf9, 0x0, 0xff, 0x10, 0x0, 0x1, 0xdf,
-    0xff, 0x30, 0xe, 0xf4, 0x0, 0x0, 0x1, 0xef,
-    0xd0, 0x0, 0x9f, 0xe3, 0x0, 0x2, 0xaf, 0xff,
-    0xa0, 0x1, 0xcf, 0xfe, 0xce, 0xff, 0xc3, 0xdf,
-    0x80, 0x0, 0x6b, 0xef, 0xeb, 0x50, 0x1, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x9f, 0x39, 0xf3, 0x8f, 0x28, 0xf2, 0x8f, 0x17,
-    0xf1, 0x0, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x8f, 0x70, 0x1f, 0xf0, 0x8, 0xf8, 0x0,
-    0xdf, 0x30, 0x2f, 0xe0, 0x6, 0xfa, 0x0, 0x8f,
-    0x80, 0xb, 0xf5, 0x0, 0xcf, 0x40, 0xd, 0xf3,
-    0x0, 0xef, 0x20, 0xd, 0xf3, 0x0, 0xcf, 0x40,
-    0xb, 0xf5, 0x0, 0x8f, 0x70, 0x5, 0xfa, 0x0,
-    0x2f, 0xe0, 0x0, 0xdf, 0x30, 0x7, 0xf8, 0x0,
-    0x1f, 0xf0, 0x0, 0x8f, 0x70,
-
-    /* U+0029 ")" */
-    0x1f, 0xe0, 0x0, 0x9, 0xf7, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x7f, 0x90, 0x0,
-    0x4f, 0xc0, 0x0, 0x1f, 0xf0, 0x0, 0xe, 0xf2,
-    0x0, 0xd, 0xf3, 0x0, 0xc, 0xf4, 0x0, 0xb,
-    0xf5, 0x0, 0xc, 0xf4, 0x0, 0xd, 0xf3, 0x0,
-    0xe, 0xf2, 0x0, 0x1f, 0xf0, 0x0, 0x3f, 0xc0,
-    0x0, 0x7f, 0x90, 0x0, 0xcf, 0x40, 0x2, 0xfe,
-    0x0, 0x9, 0xf7, 0x0, 0x1f, 0xe0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x4, 0xf0, 0x0, 0x0, 0x40, 0x4f, 0x0,
-    0x50, 0x5f, 0xb6, 0xf4, 0xdf, 0x20, 0x4d, 0xff,
-    0xfc, 0x30, 0x0, 0x8f, 0xff, 0x60, 0x3, 0xef,
-    0xaf, 0xaf, 0xc2, 0x2a, 0x13, 0xf0, 0x3b, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0x1, 0x60, 0x0,
-    0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x6d, 0x40, 0x0, 0x0, 0x0, 0x8,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x6c, 0xcc,
-    0xef, 0xdc, 0xcc, 0x48, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x3, 0xb, 0xfb, 0xdf, 0xe4, 0xfb, 0x3f, 0x67,
-    0xf1, 0xbb, 0x0,
-
-    /* U+002D "-" */
-    0xad, 0xdd, 0xdd, 0x2c, 0xff, 0xff, 0xf2,
-
-    /* U+002E "." */
-    0x0, 0x9, 0xf9, 0xff, 0xe8, 0xf7,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0x0,
-    0xd, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x5f,
-    0x80, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0,
-    0x1, 0xfd, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x3, 0xae, 0xfd, 0x81, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x6, 0xff, 0x81,
-    0x3, 0xbf, 0xf1, 0x0, 0xef, 0x60, 0x0, 0x0,
-    0xbf, 0xa0, 0x5f, 0xd0, 0x0, 0x0, 0x3, 0xff,
-    0x1a, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xf5, 0xcf,
-    0x50, 0x0, 0x0, 0x0, 0xaf, 0x7e, 0xf4, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x9f, 0x9c, 0xf5, 0x0, 0x0, 0x0, 0xa,
-    0xf7, 0xaf, 0x80, 0x0, 0x0, 0x0, 0xdf, 0x55,
-    0xfd, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x1e, 0xf6,
-    0x0, 0x0, 0xb, 0xfa, 0x0, 0x6f, 0xf7, 0x10,
-    0x2b, 0xff, 0x10, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x3a, 0xef, 0xd8, 0x10, 0x0,
-
-    /* U+0031 "1" */
-    0xdf, 0xff, 0xfd, 0xcf, 0xff, 0xfd, 0x0, 0x5,
-    0xfd, 0x0, 0x5, 0xfd, 0x0, 0x5, 0xfd, 0x0,
-    0x5, 0xfd, 0x0, 0x5, 0xfd, 0x0, 0x5, 0xfd,
-    0x0, 0x5, 0xfd, 0x0, 0x5, 0xfd, 0x0, 0x5,
-    0xfd, 0x0, 0x5, 0xfd, 0x0, 0x5, 0xfd, 0x0,
-    0x5, 0xfd, 0x0, 0x5, 0xfd, 0x0, 0x5, 0xfd,
-
-    /* U+0032 "2" */
-    0x0, 0x39, 0xdf, 0xfd, 0x81, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x6f, 0xe7, 0x20, 0x15,
-    0xef, 0xc0, 0x6, 0x20, 0x0, 0x0, 0x4f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0033 "3" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x46, 0x8b, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x6, 0x0, 0x0, 0x0, 0x1e, 0xf6, 0x8f, 0xc5,
-    0x10, 0x14, 0xcf, 0xe0, 0x6f, 0xff, 0xff, 0xff,
-    0xfe, 0x30, 0x1, 0x7b, 0xef, 0xed, 0x81, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x3, 0x63, 0x0, 0x0, 0x1, 0xef, 0x70,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x8, 0xf8, 0x0, 0x0, 0x7f, 0xe1, 0x0, 0x0,
-    0x8f, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xec,
-    0x82, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x14, 0xbf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x7, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x4f, 0xe7,
-    0x20, 0x3, 0xbf, 0xf3, 0x3d, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x5a, 0xdf, 0xfd, 0x92, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x1, 0x7c, 0xef, 0xdb, 0x60, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xd0, 0x3, 0xff, 0xb3, 0x0,
-    0x4, 0x40, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x6a, 0xcb,
-    0x82, 0x0, 0xef, 0x6d, 0xff, 0xff, 0xff, 0x60,
-    0xef, 0xff, 0x71, 0x2, 0xaf, 0xf4, 0xdf, 0xf4,
-    0x0, 0x0, 0xa, 0xfb, 0xbf, 0xe0, 0x0, 0x0,
-    0x4, 0xfe, 0x8f, 0xd0, 0x0, 0x0, 0x3, 0xfe,
-    0x2f, 0xf2, 0x0, 0x0, 0x8, 0xfb, 0x9, 0xfd,
-    0x40, 0x0, 0x6f, 0xf4, 0x0, 0xaf, 0xfe, 0xdf,
-    0xff, 0x70, 0x0, 0x5, 0xbe, 0xfe, 0xa3, 0x0,
-
-    /* U+0037 "7" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x45, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x5f, 0xc0, 0x0,
-    0x0, 0x6, 0xfd, 0x5, 0xfc, 0x0, 0x0, 0x0,
-    0xdf, 0x60, 0x4d, 0x90, 0x0, 0x0, 0x4f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x2, 0x9d, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x4f, 0xff, 0xee, 0xff, 0xf7, 0x0, 0x1, 0xff,
-    0xa1, 0x0, 0x19, 0xff, 0x20, 0x5, 0xfe, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x7, 0xfc, 0x0, 0x0,
-    0x0, 0x8f, 0x90, 0x4, 0xfe, 0x10, 0x0, 0x0,
-    0xcf, 0x70, 0x0, 0xcf, 0xc4, 0x10, 0x3b, 0xfe,
-    0x10, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x8f, 0xfe, 0xcc, 0xef, 0xfa, 0x0, 0x7,
-    0xfe, 0x50, 0x0, 0x3, 0xdf, 0x90, 0xe, 0xf5,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0xf, 0xf3, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0xe, 0xf7, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x7, 0xff, 0x60, 0x0, 0x5,
-    0xef, 0xa0, 0x0, 0xaf, 0xff, 0xed, 0xff, 0xfc,
-    0x10, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x50, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x7, 0xcf, 0xfd, 0x91, 0x0, 0x0, 0x1c,
-    0xff, 0xed, 0xff, 0xf4, 0x0, 0xb, 0xfd, 0x30,
-    0x0, 0x8f, 0xf2, 0x2, 0xff, 0x20, 0x0, 0x0,
-    0x9f, 0xb0, 0x5f, 0xd0, 0x0, 0x0, 0x3, 0xff,
-    0x15, 0xfd, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x2f,
-    0xf3, 0x0, 0x0, 0xb, 0xff, 0x60, 0xbf, 0xe6,
-    0x10, 0x3a, 0xff, 0xf7, 0x1, 0xcf, 0xff, 0xff,
-    0xf9, 0xbf, 0x70, 0x0, 0x5a, 0xcc, 0x94, 0xc,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xf6, 0x0, 0x7, 0x20, 0x1,
-    0x6e, 0xfb, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x18, 0xce, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x8f, 0x8f, 0xfe, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0xff,
-    0xe8, 0xf7,
-
-    /* U+003B ";" */
-    0x8f, 0x8f, 0xfe, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0xef,
-    0xe7, 0xfc, 0x2f, 0x76, 0xf2, 0xac, 0x3, 0x20,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x17, 0x30, 0x0, 0x0,
-    0x3, 0xaf, 0xf5, 0x0, 0x1, 0x7d, 0xff, 0xc6,
-    0x0, 0x3a, 0xff, 0xe9, 0x20, 0x0, 0x7f, 0xfc,
-    0x50, 0x0, 0x0, 0x8, 0xfe, 0x71, 0x0, 0x0,
-    0x0, 0x18, 0xef, 0xfa, 0x40, 0x0, 0x0, 0x0,
-    0x5b, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x2, 0x8e,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x5, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x56, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xc4, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x50,
-
-    /* U+003E ">" */
-    0x56, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x92,
-    0x0, 0x0, 0x0, 0x17, 0xdf, 0xfc, 0x50, 0x0,
-    0x0, 0x0, 0x4a, 0xff, 0xe8, 0x20, 0x0, 0x0,
-    0x1, 0x6d, 0xff, 0x40, 0x0, 0x0, 0x2, 0x8f,
-    0xf5, 0x0, 0x0, 0x5c, 0xff, 0xd7, 0x0, 0x29,
-    0xef, 0xfa, 0x30, 0x0, 0x7f, 0xfd, 0x71, 0x0,
-    0x0, 0x8, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x4a, 0xdf, 0xfd, 0x81, 0x0, 0xa, 0xff,
-    0xfe, 0xff, 0xfe, 0x30, 0x8f, 0xe5, 0x0, 0x4,
-    0xef, 0xc0, 0x6, 0x10, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xe3, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xea, 0x87,
-    0x8a, 0xef, 0xd4, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x40, 0x0, 0x0, 0x0, 0x4d, 0xf8, 0x0, 0x0,
-    0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x0, 0x6, 0xf9, 0x0, 0x5, 0xcf, 0xfc,
-    0x50, 0xfe, 0xa, 0xf3, 0x0, 0xec, 0x0, 0xa,
-    0xff, 0xdc, 0xef, 0x9f, 0xe0, 0xe, 0xc0, 0x6f,
-    0x40, 0x7, 0xfd, 0x20, 0x0, 0x8f, 0xfe, 0x0,
-    0x6f, 0x2a, 0xf0, 0x0, 0xef, 0x20, 0x0, 0x0,
-    0xaf, 0xe0, 0x1, 0xf6, 0xdc, 0x0, 0x4f, 0xb0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0xe, 0x9e, 0xa0,
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0xda, 0xea, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0xd, 0xad, 0xc0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0xe9, 0xaf, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0xa, 0xfe, 0x0, 0x2f,
-    0x65, 0xf5, 0x0, 0x7f, 0xd2, 0x0, 0x8, 0xff,
-    0xf1, 0x9, 0xf1, 0xe, 0xd0, 0x0, 0xaf, 0xfc,
-    0xce, 0xf9, 0x9f, 0xec, 0xf8, 0x0, 0x6f, 0x90,
-    0x0, 0x5c, 0xff, 0xc5, 0x1, 0xbf, 0xe7, 0x0,
-    0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xc4, 0x0, 0x0,
-    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xfe, 0xa8, 0x89, 0xbf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xee, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x87,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x21, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x60, 0x0, 0x5, 0xfd, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0x9, 0xff, 0xcc, 0xcc, 0xcc,
-    0xef, 0xb0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xb0, 0x0,
-    0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x5, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0xc,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe0,
-
-    /* U+0042 "B" */
-    0xbf, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0, 0xbf,
-    0xed, 0xdd, 0xdd, 0xff, 0xfa, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x7, 0xff, 0x50, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0xbf, 0xa0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x8f, 0xb0, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0xbf, 0x80, 0x0, 0x0, 0x7, 0xff,
-    0x20, 0xbf, 0xed, 0xdd, 0xdd, 0xff, 0xf4, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0xbf,
-    0x80, 0x0, 0x0, 0x14, 0xcf, 0xd0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0xe, 0xf5, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0xbf, 0x80, 0x0, 0x0, 0x1,
-    0x9f, 0xf2, 0xbf, 0xed, 0xdd, 0xdd, 0xef, 0xff,
-    0x70, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0x93, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0xcf, 0xfa, 0x41, 0x2, 0x6e, 0xfc, 0x0, 0x9f,
-    0xf5, 0x0, 0x0, 0x0, 0x9, 0x20, 0x2f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x92, 0x0, 0xc, 0xff, 0xa4, 0x10, 0x16, 0xef,
-    0xc0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xea, 0x50, 0x0,
-
-    /* U+0044 "D" */
-    0xbf, 0xff, 0xff, 0xfe, 0xd9, 0x30, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x38, 0xff, 0xe1, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x2d, 0xfc, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x2d, 0xfc, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x38, 0xff, 0xe1, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0xbf, 0xff, 0xff, 0xfe, 0xd9, 0x30, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfe, 0xee, 0xee, 0xee, 0x30,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0x30, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0046 "F" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0x30, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0,
-    0xcf, 0xfa, 0x41, 0x1, 0x5c, 0xfe, 0x0, 0x9f,
-    0xf5, 0x0, 0x0, 0x0, 0x8, 0x30, 0x2f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x1c, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x8f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x12, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x9, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0xc, 0xff, 0xa4, 0x10, 0x25, 0xcf,
-    0xf1, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x2, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0048 "H" */
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0xa, 0xf8, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0xa, 0xf8, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0xa, 0xf8, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xa,
-    0xf8, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xa, 0xf8,
-
-    /* U+0049 "I" */
-    0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b,
-    0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf,
-    0x8b, 0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x8b, 0xf8,
-
-    /* U+004A "J" */
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0x10, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x3, 0x50, 0x0, 0x5, 0xfe, 0x0,
-    0xef, 0x70, 0x3, 0xef, 0x90, 0x8, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x4, 0xae, 0xfe, 0x91, 0x0,
-
-    /* U+004B "K" */
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xd1, 0xbf,
-    0x80, 0x0, 0x0, 0x8, 0xfe, 0x10, 0xbf, 0x80,
-    0x0, 0x0, 0x7f, 0xe2, 0x0, 0xbf, 0x80, 0x0,
-    0x6, 0xff, 0x30, 0x0, 0xbf, 0x80, 0x0, 0x5f,
-    0xf4, 0x0, 0x0, 0xbf, 0x80, 0x4, 0xff, 0x50,
-    0x0, 0x0, 0xbf, 0x80, 0x3f, 0xf7, 0x0, 0x0,
-    0x0, 0xbf, 0x83, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xbf, 0xae, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xc4, 0xff, 0x90, 0x0, 0x0, 0xbf, 0xfc,
-    0x0, 0x5f, 0xf6, 0x0, 0x0, 0xbf, 0xc0, 0x0,
-    0x8, 0xff, 0x30, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0xbf, 0xe1, 0x0, 0xbf, 0x80, 0x0, 0x0, 0xd,
-    0xfc, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x1, 0xef,
-    0x90, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xf6,
-
-    /* U+004C "L" */
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xb, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+004D "M" */
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xab, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfa, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xab, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfa, 0xbf, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0xaf, 0xef, 0xab, 0xf7, 0xef, 0x30, 0x0, 0x0,
-    0x3f, 0xd7, 0xfa, 0xbf, 0x65, 0xfc, 0x0, 0x0,
-    0xc, 0xf5, 0x6f, 0xab, 0xf6, 0xc, 0xf6, 0x0,
-    0x5, 0xfc, 0x6, 0xfa, 0xbf, 0x60, 0x3f, 0xe0,
-    0x0, 0xef, 0x30, 0x6f, 0xab, 0xf6, 0x0, 0xaf,
-    0x80, 0x7f, 0x90, 0x6, 0xfb, 0xbf, 0x60, 0x1,
-    0xff, 0x3f, 0xf1, 0x0, 0x6f, 0xbb, 0xf6, 0x0,
-    0x7, 0xff, 0xf7, 0x0, 0x6, 0xfb, 0xbf, 0x60,
-    0x0, 0xe, 0xfd, 0x0, 0x0, 0x6f, 0xbb, 0xf6,
-    0x0, 0x0, 0x5f, 0x50, 0x0, 0x6, 0xfb, 0xbf,
-    0x60, 0x0, 0x0, 0x10, 0x0, 0x0, 0x6f, 0xbb,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfb,
-
-    /* U+004E "N" */
-    0xbf, 0x70, 0x0, 0x0, 0x0, 0xa, 0xf8, 0xbf,
-    0xf4, 0x0, 0x0, 0x0, 0xa, 0xf8, 0xbf, 0xfe,
-    0x10, 0x0, 0x0, 0xa, 0xf8, 0xbf, 0xff, 0xc0,
-    0x0, 0x0, 0xa, 0xf8, 0xbf, 0xbf, 0xf9, 0x0,
-    0x0, 0xa, 0xf8, 0xbf, 0x85, 0xff, 0x50, 0x0,
-    0xa, 0xf8, 0xbf, 0x80, 0x9f, 0xf2, 0x0, 0xa,
-    0xf8, 0xbf, 0x80, 0xc, 0xfd, 0x0, 0xa, 0xf8,
-    0xbf, 0x80, 0x2, 0xef, 0xb0, 0xa, 0xf8, 0xbf,
-    0x80, 0x0, 0x4f, 0xf7, 0xa, 0xf8, 0xbf, 0x80,
-    0x0, 0x8, 0xff, 0x4a, 0xf8, 0xbf, 0x80, 0x0,
-    0x0, 0xbf, 0xeb, 0xf8, 0xbf, 0x80, 0x0, 0x0,
-    0x1e, 0xff, 0xf8, 0xbf, 0x80, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x6f,
-    0xf8, 0xbf, 0x80, 0x0, 0x0, 0x0, 0xa, 0xf8,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0xbf, 0xfa, 0x41, 0x2, 0x7e, 0xff,
-    0x40, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x1b,
-    0xfe, 0x10, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfa, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf1, 0xcf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x4e, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x6c, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf4, 0x8f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x12, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x8, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xbf, 0xe2, 0x0, 0xc,
-    0xff, 0xa4, 0x10, 0x26, 0xef, 0xf4, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0,
-    0x0, 0x2, 0x9d, 0xff, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xbf, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0xbf, 0x80, 0x0,
-    0x1, 0x6e, 0xfd, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x1e, 0xf6, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x9f,
-    0xab, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfb, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x9f, 0xab, 0xf8, 0x0,
-    0x0, 0x0, 0x1e, 0xf6, 0xbf, 0x80, 0x0, 0x1,
-    0x6e, 0xfd, 0xb, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x20, 0xbf, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xd3,
-    0x0, 0x0, 0x0, 0xbf, 0xfa, 0x41, 0x2, 0x7e,
-    0xff, 0x40, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0,
-    0x1, 0xbf, 0xe1, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfa, 0x0, 0x8f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x0, 0xcf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x50, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x40, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfa, 0x0, 0xa, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0xdf, 0xf9,
-    0x30, 0x1, 0x6d, 0xff, 0x50, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x4a, 0xef, 0xff, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe5, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xec,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xef, 0xd7, 0x0,
-
-    /* U+0052 "R" */
-    0xbf, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0xbf, 0x80, 0x0,
-    0x1, 0x6e, 0xfd, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x1e, 0xf6, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x9f,
-    0xab, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfb, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x9f, 0x9b, 0xf8, 0x0,
-    0x0, 0x0, 0x1e, 0xf5, 0xbf, 0x80, 0x0, 0x0,
-    0x5d, 0xfd, 0xb, 0xff, 0xee, 0xef, 0xff, 0xfd,
-    0x20, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0xbf, 0xa0, 0xb, 0xf8, 0x0, 0x0,
-    0x1, 0xef, 0x50, 0xbf, 0x80, 0x0, 0x0, 0x6,
-    0xfe, 0x1b, 0xf8, 0x0, 0x0, 0x0, 0xb, 0xfa,
-
-    /* U+0053 "S" */
-    0x0, 0x2, 0x9d, 0xff, 0xeb, 0x60, 0x0, 0x6,
-    0xff, 0xff, 0xef, 0xff, 0xe0, 0x3, 0xff, 0x92,
-    0x0, 0x4, 0xba, 0x0, 0x9f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xe7, 0x20, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xff, 0xea, 0x50, 0x0, 0x0, 0x0, 0x6b, 0xff,
-    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x38, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x4, 0x20,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0xdf, 0x94, 0x0,
-    0x1, 0x8f, 0xf3, 0x7, 0xff, 0xff, 0xef, 0xff,
-    0xf7, 0x0, 0x1, 0x7b, 0xef, 0xfd, 0x92, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0xf, 0xf3, 0xdf,
-    0x60, 0x0, 0x0, 0x0, 0xf, 0xf3, 0xdf, 0x60,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0xdf, 0x60, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0xf, 0xf3, 0xdf, 0x60, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0xdf, 0x60, 0x0, 0x0, 0x0, 0xf, 0xf3,
-    0xdf, 0x60, 0x0, 0x0, 0x0, 0xf, 0xf3, 0xcf,
-    0x60, 0x0, 0x0, 0x0, 0xf, 0xf2, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x8f, 0xc0, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0xdf, 0x80, 0xa, 0xff, 0x71, 0x0, 0x4d,
-    0xfe, 0x10, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xe3,
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xc7, 0x10, 0x0,
-
-    /* U+0056 "V" */
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf1, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0, 0x9,
-    0xfa, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x30, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x6f, 0xc0, 0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0,
-    0xd, 0xf5, 0x0, 0x0, 0x4, 0xff, 0x10, 0x0,
-    0x4, 0xfe, 0x0, 0x0, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x6f, 0xe0,
-    0x0, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfc, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf3, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x9d, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x8f,
-    0x90, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x40, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x2f, 0xf1,
-    0x0, 0x0, 0xb, 0xfc, 0xf9, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x0, 0xff,
-    0x3f, 0xe0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x8,
-    0xfb, 0x0, 0x0, 0x5f, 0xa0, 0xdf, 0x40, 0x0,
-    0xc, 0xf4, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0xb,
-    0xf5, 0x8, 0xf9, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x0, 0xef, 0x50, 0x1, 0xff, 0x0, 0x3f, 0xe0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x8, 0xfa, 0x0,
-    0x5f, 0xa0, 0x0, 0xdf, 0x30, 0xc, 0xf5, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0xb, 0xf5, 0x0, 0x8,
-    0xf9, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x51, 0xff, 0x0, 0x0, 0x3f, 0xe0, 0x6f, 0xb0,
-    0x0, 0x0, 0x0, 0x9, 0xfa, 0x6f, 0xa0, 0x0,
-    0x0, 0xdf, 0x3c, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfb, 0xf5, 0x0, 0x0, 0x8, 0xfa, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x1e, 0xf7, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0,
-    0x5f, 0xf3, 0x0, 0x0, 0x5, 0xff, 0x10, 0x0,
-    0x9f, 0xd0, 0x0, 0x1, 0xef, 0x50, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x3,
-    0xff, 0x40, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x8,
-    0xfe, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xbf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0xdf,
-    0xa0, 0x0, 0x0, 0x0, 0x8f, 0xd0, 0x2, 0xff,
-    0x50, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x7, 0xfe,
-    0x10, 0x0, 0x1e, 0xf8, 0x0, 0x0, 0xc, 0xfb,
-    0x0, 0xa, 0xfd, 0x0, 0x0, 0x0, 0x1f, 0xf7,
-    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f, 0xf3,
-
-    /* U+0059 "Y" */
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0x3, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x0, 0xaf, 0xb0, 0x0, 0x0, 0x5, 0xfd, 0x0,
-    0x0, 0x1f, 0xf4, 0x0, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0x8f, 0xb0, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x1, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x4f, 0xf1, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfa, 0x4f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xef, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+005B "[" */
-    0xbf, 0xff, 0xeb, 0xfd, 0xcb, 0xbf, 0x60, 0xb,
-    0xf6, 0x0, 0xbf, 0x60, 0xb, 0xf6, 0x0, 0xbf,
-    0x60, 0xb, 0xf6, 0x0, 0xbf, 0x60, 0xb, 0xf6,
-    0x0, 0xbf, 0x60, 0xb, 0xf6, 0x0, 0xbf, 0x60,
-    0xb, 0xf6, 0x0, 0xbf, 0x60, 0xb, 0xf6, 0x0,
-    0xbf, 0x60, 0xb, 0xf6, 0x0, 0xbf, 0x60, 0xb,
-    0xfd, 0xcb, 0xbf, 0xff, 0xe0,
-
-    /* U+005C "\\" */
-    0xaf, 0x30, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0,
-    0xd, 0xf1, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0xc,
-    0xf2,
-
-    /* U+005D "]" */
-    0x9f, 0xff, 0xf0, 0x7c, 0xcf, 0xf0, 0x0, 0x1f,
-    0xf0, 0x0, 0x1f, 0xf0, 0x0, 0x1f, 0xf0, 0x0,
-    0x1f, 0xf0, 0x0, 0x1f, 0xf0, 0x0, 0x1f, 0xf0,
-    0x0, 0x1f, 0xf0, 0x0, 0x1f, 0xf0, 0x0, 0x1f,
-    0xf0, 0x0, 0x1f, 0xf0, 0x0, 0x1f, 0xf0, 0x0,
-    0x1f, 0xf0, 0x0, 0x1f, 0xf0, 0x0, 0x1f, 0xf0,
-    0x0, 0x1f, 0xf0, 0x0, 0x1f, 0xf0, 0x0, 0x1f,
-    0xf0, 0x7c, 0xcf, 0xf0, 0x9f, 0xff, 0xf0,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x48, 0x30, 0x0, 0x0, 0x0, 0xd,
-    0xfb, 0x0, 0x0, 0x0, 0x4, 0xfc, 0xf1, 0x0,
-    0x0, 0x0, 0xae, 0x2f, 0x80, 0x0, 0x0, 0x1f,
-    0x80, 0xbe, 0x0, 0x0, 0x8, 0xf2, 0x4, 0xf5,
-    0x0, 0x0, 0xeb, 0x0, 0xe, 0xb0, 0x0, 0x5f,
-    0x50, 0x0, 0x8f, 0x20, 0xb, 0xe0, 0x0, 0x1,
-    0xf8, 0x2, 0xf8, 0x0, 0x0, 0xb, 0xe0,
-
-    /* U+005F "_" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x40,
-
-    /* U+0060 "`" */
-    0x1b, 0xfb, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0,
-    0x6, 0xfb, 0x0,
-
-    /* U+0061 "a" */
-    0x2, 0x8d, 0xff, 0xea, 0x20, 0x4, 0xff, 0xfe,
-    0xef, 0xff, 0x30, 0x1d, 0x61, 0x0, 0x2c, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0x3a, 0xef, 0xff, 0xff,
-    0xf3, 0x4f, 0xfc, 0x98, 0x88, 0xff, 0x3c, 0xf8,
-    0x0, 0x0, 0xe, 0xf3, 0xef, 0x30, 0x0, 0x1,
-    0xff, 0x3b, 0xf8, 0x0, 0x0, 0xbf, 0xf3, 0x3f,
-    0xfc, 0x99, 0xef, 0xef, 0x30, 0x2a, 0xef, 0xea,
-    0x2c, 0xf3,
-
-    /* U+0062 "b" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x4b, 0xef, 0xd8, 0x10, 0x0, 0xff,
-    0x9f, 0xff, 0xef, 0xfe, 0x40, 0xf, 0xff, 0xc3,
-    0x0, 0x2b, 0xfe, 0x10, 0xff, 0xd0, 0x0, 0x0,
-    0xc, 0xf9, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x5f,
-    0xe0, 0xff, 0x20, 0x0, 0x0, 0x1, 0xff, 0xf,
-    0xf2, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0xff, 0x50,
-    0x0, 0x0, 0x5, 0xfe, 0xf, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0x80, 0xff, 0xfc, 0x30, 0x3, 0xcf,
-    0xe1, 0xf, 0xf8, 0xff, 0xff, 0xff, 0xe3, 0x0,
-    0xff, 0x4, 0xbe, 0xfd, 0x81, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x7c, 0xef, 0xd8, 0x0, 0x0, 0x3d,
-    0xff, 0xfe, 0xff, 0xe2, 0x1, 0xef, 0xc3, 0x0,
-    0x2b, 0xf8, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x50,
-    0xe, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0x50, 0x1, 0xef,
-    0xc3, 0x0, 0x2c, 0xf9, 0x0, 0x2d, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x7c, 0xef, 0xd7, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x18, 0xdf, 0xeb, 0x41, 0xff, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0x9f, 0xf0, 0x1e, 0xfc,
-    0x20, 0x3, 0xcf, 0xff, 0x9, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0xef, 0x50, 0x0, 0x0, 0x5,
-    0xff, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x2f, 0xf0,
-    0xff, 0x10, 0x0, 0x0, 0x2, 0xff, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x9f, 0xc0, 0x0,
-    0x0, 0xc, 0xff, 0x1, 0xef, 0xa1, 0x0, 0x1a,
-    0xff, 0xf0, 0x4, 0xef, 0xfc, 0xdf, 0xf9, 0xff,
-    0x0, 0x1, 0x8d, 0xff, 0xb5, 0xf, 0xf0,
-
-    /* U+0065 "e" */
-    0x0, 0x1, 0x8d, 0xfe, 0xb5, 0x0, 0x0, 0x3,
-    0xef, 0xfd, 0xef, 0xfa, 0x0, 0x1, 0xef, 0x90,
-    0x0, 0x3d, 0xf8, 0x0, 0x8f, 0x90, 0x0, 0x0,
-    0x2f, 0xf1, 0xe, 0xf2, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf,
-    0xf9, 0x88, 0x88, 0x88, 0x88, 0x40, 0xef, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0x1e, 0xfc, 0x40, 0x1, 0x7f,
-    0x50, 0x0, 0x3e, 0xff, 0xfe, 0xff, 0xf5, 0x0,
-    0x0, 0x7, 0xce, 0xfd, 0x92, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x2, 0xbf, 0xfc, 0x30, 0x0, 0xef, 0xed,
-    0xf3, 0x0, 0x7f, 0xc0, 0x2, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xc0, 0x8c, 0xef, 0xdc, 0xc9, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x2, 0x8d, 0xfe, 0xc6, 0xd, 0xf2, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xbd, 0xf2, 0x3, 0xff,
-    0xb2, 0x0, 0x19, 0xff, 0xf2, 0xa, 0xfa, 0x0,
-    0x0, 0x0, 0x8f, 0xf2, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0x1f, 0xf2, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x1f,
-    0xf2, 0xa, 0xfb, 0x0, 0x0, 0x0, 0x9f, 0xf2,
-    0x3, 0xff, 0xa2, 0x0, 0x19, 0xff, 0xf2, 0x0,
-    0x5f, 0xff, 0xee, 0xff, 0xaf, 0xf2, 0x0, 0x2,
-    0x9d, 0xff, 0xc5, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf0, 0x0, 0x20, 0x0, 0x0,
-    0x0, 0x8f, 0xc0, 0x1, 0xec, 0x51, 0x0, 0x7,
-    0xff, 0x60, 0x2, 0xdf, 0xff, 0xee, 0xff, 0xf9,
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xea, 0x40, 0x0,
-
-    /* U+0068 "h" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0x15,
-    0xbe, 0xfd, 0x80, 0x0, 0xff, 0xbf, 0xff, 0xff,
-    0xfd, 0x0, 0xff, 0xfa, 0x20, 0x6, 0xff, 0x80,
-    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xd0, 0xff, 0x50,
-    0x0, 0x0, 0x2f, 0xf0, 0xff, 0x20, 0x0, 0x0,
-    0xf, 0xf0, 0xff, 0x10, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0xf, 0xf1, 0xff, 0x10,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0xf, 0xf1, 0xff, 0x10, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0xf, 0xf1,
-
-    /* U+0069 "i" */
-    0x1d, 0xe2, 0x5f, 0xf6, 0xa, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0xf, 0xf1, 0xf, 0xf1,
-    0xf, 0xf1, 0xf, 0xf1, 0xf, 0xf1, 0xf, 0xf1,
-    0xf, 0xf1, 0xf, 0xf1, 0xf, 0xf1, 0xf, 0xf1,
-    0xf, 0xf1,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0xc, 0xe3, 0x0, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x9, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0xf, 0xf2,
-    0x1, 0x0, 0x4f, 0xf0, 0xb, 0xfd, 0xff, 0x80,
-    0x8, 0xef, 0xe8, 0x0,
-
-    /* U+006B "k" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x2, 0xef, 0x80, 0xff, 0x10, 0x0, 0x3e,
-    0xf8, 0x0, 0xff, 0x10, 0x3, 0xff, 0x80, 0x0,
-    0xff, 0x10, 0x4f, 0xf8, 0x0, 0x0, 0xff, 0x15,
-    0xff, 0x90, 0x0, 0x0, 0xff, 0x7f, 0xff, 0x80,
-    0x0, 0x0, 0xff, 0xff, 0xbf, 0xf4, 0x0, 0x0,
-    0xff, 0xf6, 0xa, 0xfe, 0x20, 0x0, 0xff, 0x60,
-    0x0, 0xcf, 0xc0, 0x0, 0xff, 0x10, 0x0, 0x2e,
-    0xf9, 0x0, 0xff, 0x10, 0x0, 0x4, 0xff, 0x50,
-    0xff, 0x10, 0x0, 0x0, 0x7f, 0xf2,
-
-    /* U+006C "l" */
-    0xff, 0x1f, 0xf1, 0xff, 0x1f, 0xf1, 0xff, 0x1f,
-    0xf1, 0xff, 0x1f, 0xf1, 0xff, 0x1f, 0xf1, 0xff,
-    0x1f, 0xf1, 0xff, 0x1f, 0xf1, 0xff, 0x1f, 0xf1,
-    0xff, 0x10,
-
-    /* U+006D "m" */
-    0xff, 0x6, 0xcf, 0xfc, 0x60, 0x3, 0xae, 0xfe,
-    0xa2, 0x0, 0xff, 0xbf, 0xfd, 0xff, 0xfa, 0x6f,
-    0xfe, 0xdf, 0xff, 0x30, 0xff, 0xf7, 0x0, 0x7,
-    0xff, 0xfe, 0x30, 0x1, 0xcf, 0xd0, 0xff, 0xa0,
-    0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x2f, 0xf2,
-    0xff, 0x40, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0,
-    0xd, 0xf5, 0xff, 0x20, 0x0, 0x0, 0x6f, 0xc0,
-    0x0, 0x0, 0xc, 0xf5, 0xff, 0x10, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0xc, 0xf5, 0xff, 0x10,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0xc, 0xf5,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0xc, 0xf5, 0xff, 0x10, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0x0, 0xc, 0xf5, 0xff, 0x10, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0xc, 0xf5, 0xff, 0x10,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0xc, 0xf5,
-
-    /* U+006E "n" */
-    0xff, 0x6, 0xce, 0xfd, 0x80, 0x0, 0xff, 0xbf,
-    0xfd, 0xef, 0xfd, 0x0, 0xff, 0xf8, 0x0, 0x4,
-    0xef, 0x80, 0xff, 0xb0, 0x0, 0x0, 0x6f, 0xd0,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xf0, 0xff, 0x20,
-    0x0, 0x0, 0xf, 0xf0, 0xff, 0x10, 0x0, 0x0,
-    0xf, 0xf1, 0xff, 0x10, 0x0, 0x0, 0xf, 0xf1,
-    0xff, 0x10, 0x0, 0x0, 0xf, 0xf1, 0xff, 0x10,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0xf, 0xf1, 0xff, 0x10, 0x0, 0x0, 0xf, 0xf1,
-
-    /* U+006F "o" */
-    0x0, 0x1, 0x7c, 0xff, 0xc7, 0x10, 0x0, 0x0,
-    0x3e, 0xff, 0xfe, 0xff, 0xe3, 0x0, 0x1, 0xef,
-    0xb2, 0x0, 0x2b, 0xfe, 0x10, 0x8, 0xfc, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0xe, 0xf5, 0x0, 0x0,
-    0x0, 0x5f, 0xd0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x8, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x1,
-    0xef, 0xc3, 0x0, 0x3c, 0xfd, 0x10, 0x0, 0x3d,
-    0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x1, 0x7c,
-    0xff, 0xc7, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0xff, 0x5, 0xbe, 0xfd, 0x81, 0x0, 0xf, 0xfa,
-    0xff, 0xdd, 0xff, 0xe4, 0x0, 0xff, 0xfb, 0x10,
-    0x1, 0xaf, 0xe1, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0x90, 0xff, 0x50, 0x0, 0x0, 0x4, 0xfe,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0xff,
-    0x20, 0x0, 0x0, 0x1, 0xff, 0xf, 0xf5, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0xff, 0xd0, 0x0, 0x0,
-    0xd, 0xf8, 0xf, 0xff, 0xc3, 0x0, 0x3c, 0xfe,
-    0x10, 0xff, 0x9f, 0xff, 0xff, 0xfe, 0x30, 0xf,
-    0xf1, 0x4b, 0xef, 0xd8, 0x10, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x1, 0x8d, 0xfe, 0xb4, 0xf, 0xf0, 0x4,
-    0xef, 0xff, 0xff, 0xf8, 0xff, 0x1, 0xef, 0xb2,
-    0x0, 0x3c, 0xff, 0xf0, 0x9f, 0xc0, 0x0, 0x0,
-    0xd, 0xff, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0xff, 0x10, 0x0, 0x0, 0x2, 0xff, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0xef, 0x50,
-    0x0, 0x0, 0x5, 0xff, 0x9, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0x1e, 0xfc, 0x30, 0x3, 0xcf,
-    0xff, 0x0, 0x4e, 0xff, 0xff, 0xff, 0x9f, 0xf0,
-    0x0, 0x18, 0xdf, 0xeb, 0x41, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-
-    /* U+0072 "r" */
-    0xff, 0x5, 0xbe, 0x4f, 0xf8, 0xff, 0xf4, 0xff,
-    0xfc, 0x41, 0xf, 0xfd, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0xff, 0x10, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0xff, 0x10, 0x0, 0xf, 0xf1,
-    0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x29, 0xdf, 0xfd, 0x93, 0x0, 0x5f, 0xff,
-    0xde, 0xff, 0xc0, 0xe, 0xf8, 0x0, 0x1, 0x73,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xeb, 0x72,
-    0x0, 0x0, 0x28, 0xcf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x2, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x50, 0xd8, 0x20, 0x0, 0x4f, 0xf3, 0x4f,
-    0xff, 0xfe, 0xff, 0xf9, 0x0, 0x28, 0xcf, 0xfd,
-    0xb4, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x58, 0x30, 0x0, 0x0, 0xb, 0xf6, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xc0, 0x8c, 0xef, 0xdc, 0xc9, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x2, 0x0, 0x1, 0xff, 0xfe, 0xf4, 0x0,
-    0x2, 0xbe, 0xeb, 0x20,
-
-    /* U+0075 "u" */
-    0x1f, 0xf0, 0x0, 0x0, 0x3, 0xfe, 0x1f, 0xf0,
-    0x0, 0x0, 0x3, 0xfe, 0x1f, 0xf0, 0x0, 0x0,
-    0x3, 0xfe, 0x1f, 0xf0, 0x0, 0x0, 0x3, 0xfe,
-    0x1f, 0xf0, 0x0, 0x0, 0x3, 0xfe, 0x1f, 0xf0,
-    0x0, 0x0, 0x3, 0xfe, 0x1f, 0xf0, 0x0, 0x0,
-    0x4, 0xfe, 0x1f, 0xf1, 0x0, 0x0, 0x6, 0xfe,
-    0xe, 0xf5, 0x0, 0x0, 0xc, 0xfe, 0x9, 0xfe,
-    0x30, 0x0, 0x9f, 0xfe, 0x1, 0xdf, 0xfe, 0xdf,
-    0xfb, 0xfe, 0x0, 0x8, 0xdf, 0xfc, 0x52, 0xfe,
-
-    /* U+0076 "v" */
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0xff,
-    0x30, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x8f, 0x90,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x2f, 0xf1, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x1f,
-    0xe0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0xef, 0x20, 0x0,
-    0x0, 0x0, 0x6f, 0xb5, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x60, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0xbf, 0x50, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0,
-    0x6, 0xf7, 0x5f, 0xa0, 0x0, 0x0, 0x8f, 0xf5,
-    0x0, 0x0, 0xc, 0xf1, 0xf, 0xf0, 0x0, 0x0,
-    0xdf, 0xfb, 0x0, 0x0, 0x2f, 0xb0, 0x9, 0xf6,
-    0x0, 0x3, 0xfa, 0xdf, 0x10, 0x0, 0x8f, 0x50,
-    0x3, 0xfb, 0x0, 0x9, 0xf4, 0x8f, 0x70, 0x0,
-    0xdf, 0x0, 0x0, 0xef, 0x10, 0xf, 0xe0, 0x2f,
-    0xc0, 0x3, 0xfa, 0x0, 0x0, 0x8f, 0x60, 0x5f,
-    0x80, 0xc, 0xf2, 0x9, 0xf4, 0x0, 0x0, 0x2f,
-    0xc0, 0xbf, 0x20, 0x6, 0xf8, 0xe, 0xe0, 0x0,
-    0x0, 0xc, 0xf3, 0xfc, 0x0, 0x0, 0xfe, 0x5f,
-    0x80, 0x0, 0x0, 0x7, 0xfe, 0xf6, 0x0, 0x0,
-    0xaf, 0xdf, 0x30, 0x0, 0x0, 0x1, 0xff, 0xf1,
-    0x0, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xa0, 0x0, 0x0, 0xe, 0xf7, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x2f, 0xf4, 0x0, 0x0, 0x2f, 0xf3, 0x5, 0xfe,
-    0x10, 0x0, 0xcf, 0x70, 0x0, 0x9f, 0xb0, 0x9,
-    0xfb, 0x0, 0x0, 0xd, 0xf7, 0x4f, 0xe1, 0x0,
-    0x0, 0x2, 0xff, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0xdf, 0x60, 0x0,
-    0x0, 0x2f, 0xf4, 0x2f, 0xf3, 0x0, 0x0, 0xcf,
-    0x80, 0x6, 0xfe, 0x10, 0x9, 0xfc, 0x0, 0x0,
-    0xaf, 0xb0, 0x5f, 0xe1, 0x0, 0x0, 0xd, 0xf7,
-
-    /* U+0079 "y" */
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0xef,
-    0x40, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x7f, 0xb0,
-    0x0, 0x4, 0xfc, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x2f,
-    0xd0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x9f, 0x70,
-    0x0, 0x0, 0x0, 0xbf, 0x70, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x6, 0x10, 0x2e, 0xf5, 0x0,
-    0x0, 0x0, 0x4f, 0xfe, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x8, 0xef, 0xd7, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x70, 0xcc, 0xcc,
-    0xcc, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x20, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x1, 0xdf, 0x80, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x7f, 0xd1, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0xe,
-    0xfe, 0xcc, 0xcc, 0xcc, 0x72, 0xff, 0xff, 0xff,
-    0xff, 0xfa,
-
-    /* U+007B "{" */
-    0x0, 0x9, 0xef, 0x40, 0x9, 0xff, 0xd3, 0x0,
-    0xef, 0x60, 0x0, 0xf, 0xf2, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0xf, 0xf2, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0xf, 0xf2, 0x0, 0x1, 0xff, 0x10, 0x9,
-    0xef, 0xb0, 0x0, 0xcf, 0xf8, 0x0, 0x0, 0x3f,
-    0xf0, 0x0, 0x0, 0xff, 0x10, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0xff, 0x20, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0xdf, 0x60, 0x0, 0x8, 0xff, 0xd3, 0x0, 0x8,
-    0xef, 0x40,
-
-    /* U+007C "|" */
-    0xbf, 0x4b, 0xf4, 0xbf, 0x4b, 0xf4, 0xbf, 0x4b,
-    0xf4, 0xbf, 0x4b, 0xf4, 0xbf, 0x4b, 0xf4, 0xbf,
-    0x4b, 0xf4, 0xbf, 0x4b, 0xf4, 0xbf, 0x4b, 0xf4,
-    0xbf, 0x4b, 0xf4, 0xbf, 0x4b, 0xf4, 0xbf, 0x40,
-
-    /* U+007D "}" */
-    0x9f, 0xd6, 0x0, 0x7, 0xef, 0xf4, 0x0, 0x0,
-    0xaf, 0xa0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x5f, 0xd0, 0x0,
-    0x1, 0xef, 0xd5, 0x0, 0xb, 0xff, 0x70, 0x4,
-    0xfe, 0x10, 0x0, 0x5f, 0xb0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0xaf, 0x90, 0x7, 0xef, 0xf3, 0x0, 0x9f, 0xd5,
-    0x0, 0x0,
-
-    /* U+007E "~" */
-    0x1, 0x89, 0x50, 0x0, 0x9, 0x51, 0xef, 0xff,
-    0xa0, 0x2, 0xf5, 0x7f, 0x41, 0x8f, 0xd8, 0xdf,
-    0x1a, 0xb0, 0x0, 0x3c, 0xfd, 0x40,
-
-    /* U+00AB "«" */
-    0x0, 0x9, 0x80, 0x7, 0x91, 0x0, 0x9f, 0x50,
-    0x6f, 0x80, 0x5, 0xf9, 0x2, 0xfc, 0x0, 0x2f,
-    0xd0, 0xd, 0xf2, 0x0, 0xcf, 0x30, 0x8f, 0x70,
-    0x0, 0x6f, 0x90, 0x3f, 0xc0, 0x0, 0xa, 0xf4,
-    0x7, 0xf8, 0x0, 0x0, 0xde, 0x10, 0xbf, 0x40,
-    0x0, 0x3f, 0xb0, 0x1e, 0xe1,
-
-    /* U+00BB "»" */
-    0x9, 0x80, 0x7, 0x91, 0x0, 0x0, 0x7f, 0x70,
-    0x4f, 0xb0, 0x0, 0x0, 0xbf, 0x30, 0x8f, 0x70,
-    0x0, 0x1, 0xee, 0x10, 0xcf, 0x30, 0x0, 0x5,
-    0xfa, 0x2, 0xfd, 0x0, 0x0, 0xbf, 0x40, 0x7f,
-    0x70, 0x0, 0x7f, 0x80, 0x3f, 0xb0, 0x0, 0x3f,
-    0xc0, 0x1e, 0xe1, 0x0, 0xd, 0xe1, 0xa, 0xf4,
-    0x0, 0x0,
-
-    /* U+0400 "Ѐ" */
-    0x0, 0x8f, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0xee, 0xee, 0xee, 0x40,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0401 "Ё" */
-    0x0, 0x1e, 0xa0, 0xd, 0xb0, 0x0, 0x0, 0x3f,
-    0xd0, 0x2f, 0xe0, 0x0, 0x0, 0x3, 0x10, 0x2,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0xee, 0xee, 0xee, 0x40,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0402 "Ђ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0x48, 0xbc, 0xdb, 0x71, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x6, 0xff, 0xb5, 0x20, 0x15, 0xef,
-    0xd0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0,
-    0x2f, 0xf4, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0xc, 0xf7, 0x0, 0x0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x6, 0xfc,
-    0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x2, 0xcf, 0xe0, 0x0, 0x0,
-    0x6, 0xfc, 0x0, 0x4f, 0xef, 0xff, 0x40, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x5e, 0xfe, 0xa2, 0x0,
-
-    /* U+0403 "Ѓ" */
-    0x0, 0x0, 0x1, 0xdf, 0xa0, 0x0, 0x0, 0x1,
-    0xdf, 0x70, 0x0, 0x0, 0x1, 0xde, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0x79, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0404 "Є" */
-    0x0, 0x0, 0x3a, 0xdf, 0xfd, 0x94, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0xcf,
-    0xfa, 0x41, 0x13, 0x8f, 0xfa, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x1, 0xa1, 0x1f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xed, 0xdd, 0xdd, 0xdc, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xaf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xa1, 0x0, 0xcf, 0xfa, 0x31, 0x3,
-    0x8f, 0xfa, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xb1, 0x0, 0x0, 0x3a, 0xdf, 0xfd, 0x94, 0x0,
-
-    /* U+0405 "Ѕ" */
-    0x0, 0x18, 0xce, 0xfe, 0xb7, 0x10, 0x4, 0xff,
-    0xff, 0xef, 0xff, 0xf2, 0x1f, 0xfb, 0x30, 0x0,
-    0x49, 0xd0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x83, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xff, 0xea, 0x60, 0x0,
-    0x0, 0x5, 0xae, 0xff, 0xfe, 0x60, 0x0, 0x0,
-    0x0, 0x27, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x34, 0x0, 0x0, 0x0, 0x7, 0xfc, 0xaf, 0xb4,
-    0x0, 0x1, 0x6f, 0xf6, 0x5e, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x6a, 0xef, 0xfd, 0xa4, 0x0,
-
-    /* U+0406 "І" */
-    0x9f, 0x99, 0xf9, 0x9f, 0x99, 0xf9, 0x9f, 0x99,
-    0xf9, 0x9f, 0x99, 0xf9, 0x9f, 0x99, 0xf9, 0x9f,
-    0x99, 0xf9, 0x9f, 0x99, 0xf9, 0x9f, 0x99, 0xf9,
-
-    /* U+0407 "Ї" */
-    0x7e, 0x30, 0x6f, 0x4a, 0xf6, 0x9, 0xf7, 0x3,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0xb, 0xf8, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0xb, 0xf8, 0x0, 0x0, 0xbf, 0x80, 0x0, 0xb,
-    0xf8, 0x0, 0x0, 0xbf, 0x80, 0x0, 0xb, 0xf8,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0xbf, 0x80, 0x0, 0xb, 0xf8, 0x0,
-
-    /* U+0408 "Ј" */
-    0x0, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x8, 0xfa, 0x7, 0x10, 0x0, 0xc,
-    0xf8, 0x5f, 0xd3, 0x0, 0x7f, 0xf3, 0x1d, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x7c, 0xff, 0xc6, 0x0,
-
-    /* U+0409 "Љ" */
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfd, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xfc, 0x70, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x0, 0x5f, 0xfc, 0xcc, 0xcd, 0xff, 0xfe, 0x20,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x5f, 0xf0,
-    0x0, 0x0, 0x4, 0xef, 0xb0, 0x0, 0x4, 0xfa,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x4f, 0xf1, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
-    0x5f, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0xe, 0xf2, 0x0,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x17, 0xff, 0x90, 0x9f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0xee, 0xef,
-    0xff, 0xfc, 0x0, 0xaf, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+040A "Њ" */
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0,
-    0x9f, 0xfe, 0xee, 0xee, 0xee, 0xef, 0xff, 0xee,
-    0xef, 0xff, 0xfe, 0x20, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x5, 0xef, 0xc0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x5f, 0xf1, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x4f, 0xf0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x3, 0xef, 0xa0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xcc,
-    0xcc, 0xef, 0xfd, 0x10, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xfc, 0x70, 0x0,
-
-    /* U+040B "Ћ" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x5a, 0xde, 0xfd, 0x92, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x7, 0xff, 0xa5, 0x20, 0x16,
-    0xef, 0xe0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x3f, 0xf4, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xf7,
-
-    /* U+040C "Ќ" */
-    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0xbf, 0xa0, 0x9f, 0x80, 0x0, 0x0, 0x6,
-    0xfe, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0x9f, 0x80, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x9f, 0x80, 0x0, 0xdf, 0xa0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x3f, 0xf6, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x7, 0xff, 0x20, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x9f,
-    0x80, 0x0, 0x0, 0x1e, 0xf8, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x4, 0xff, 0x30, 0x9f, 0x80, 0x0,
-    0x0, 0x0, 0x9f, 0xd0,
-
-    /* U+040D "Ѝ" */
-    0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xa, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0x2, 0xff,
-    0xfb, 0x9f, 0x90, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x9f, 0x90, 0x0, 0x0, 0xaf, 0xe8, 0xfb, 0x9f,
-    0x90, 0x0, 0x5, 0xff, 0x37, 0xfb, 0x9f, 0x90,
-    0x0, 0x2f, 0xf7, 0x7, 0xfb, 0x9f, 0x90, 0x0,
-    0xdf, 0xb0, 0x7, 0xfb, 0x9f, 0x90, 0x9, 0xfe,
-    0x10, 0x7, 0xfb, 0x9f, 0x90, 0x5f, 0xf4, 0x0,
-    0x7, 0xfb, 0x9f, 0x92, 0xef, 0x70, 0x0, 0x7,
-    0xfb, 0x9f, 0x9c, 0xfb, 0x0, 0x0, 0x7, 0xfb,
-    0x9f, 0xff, 0xe1, 0x0, 0x0, 0x7, 0xfb, 0x9f,
-    0xff, 0x40, 0x0, 0x0, 0x7, 0xfb, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x9f, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xfb,
-
-    /* U+040E "Ў" */
-    0x0, 0x3, 0xf5, 0x0, 0x6, 0xf2, 0x0, 0x0,
-    0x0, 0xe, 0xd3, 0x3, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x21, 0x0, 0x0, 0x0, 0x6f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x5, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0xd, 0xf7, 0x0,
-    0x0, 0x0, 0xef, 0x20, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0xcf, 0x70, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x1, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x8f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x9f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0,
-    0x1, 0x1, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xfe, 0x91, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+040F "Џ" */
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xf5, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0xd, 0xf5, 0x9f, 0x90, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xd, 0xf5, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0xd, 0xf5, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x87, 0x0, 0x0, 0x0,
-
-    /* U+0410 "А" */
-    0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xd3, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0xc, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x5f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0,
-    0xef, 0x40, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x8, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0xaf, 0x90, 0x0, 0x0, 0x5f, 0xfc,
-    0xcc, 0xcc, 0xce, 0xff, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0xaf,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xef, 0x50, 0x1f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x8,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-
-    /* U+0411 "Б" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9, 0xff,
-    0xee, 0xee, 0xee, 0xee, 0xe0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xfe, 0xc7, 0x0, 0x9f, 0xec, 0xcc, 0xcd,
-    0xff, 0xfd, 0x19, 0xf9, 0x0, 0x0, 0x0, 0x5f,
-    0xf9, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x7f, 0xe9,
-    0xf9, 0x0, 0x0, 0x0, 0x4, 0xff, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x7f, 0xd9, 0xf9, 0x0, 0x0,
-    0x0, 0x5f, 0xf7, 0x9f, 0xec, 0xcc, 0xcd, 0xff,
-    0xfb, 0x9, 0xff, 0xff, 0xff, 0xfe, 0xb5, 0x0,
-
-    /* U+0412 "В" */
-    0x9f, 0xff, 0xff, 0xff, 0xda, 0x30, 0x0, 0x9f,
-    0xec, 0xcc, 0xcd, 0xff, 0xf5, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x1b, 0xff, 0x10, 0x9f, 0x90, 0x0,
-    0x0, 0x1, 0xff, 0x50, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xdf, 0x50, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0xff, 0x30, 0x9f, 0x90, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0x9f, 0xdb, 0xbb, 0xbc, 0xff, 0xa1, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0x16, 0xef, 0x60, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x5f, 0xe0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0x9f, 0x90, 0x0, 0x0, 0x2,
-    0xdf, 0xc0, 0x9f, 0xec, 0xcc, 0xcc, 0xef, 0xfe,
-    0x20, 0x9f, 0xff, 0xff, 0xff, 0xfc, 0x81, 0x0,
-
-    /* U+0413 "Г" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0x79, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0414 "Д" */
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0x6f, 0xd0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0,
-    0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0, 0x6f,
-    0xd0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x6f, 0xd0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x6f, 0xd0, 0x0, 0x0, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0x0, 0x1, 0xcf, 0x50,
-    0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x58, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x80,
-
-    /* U+0415 "Е" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0xee, 0xee, 0xee, 0x40,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-
-    /* U+0416 "Ж" */
-    0xd, 0xf6, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0xc, 0xf8, 0x0, 0x4f, 0xe1, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0,
-    0xaf, 0x90, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x1,
-    0xef, 0x50, 0x0, 0x1, 0xff, 0x30, 0x0, 0xc,
-    0xf6, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x2f, 0xf2,
-    0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0xc, 0xf6,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe0, 0x0, 0xcf, 0x60, 0x5, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfe, 0x10, 0xc, 0xf6, 0x0, 0x5f,
-    0xf3, 0x0, 0x0, 0x0, 0x3, 0xff, 0x50, 0x0,
-    0xcf, 0x60, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0,
-    0xcf, 0xc0, 0x0, 0xc, 0xf6, 0x0, 0x2, 0xff,
-    0x70, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0xcf,
-    0x60, 0x0, 0x8, 0xff, 0x10, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0xa, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0x0, 0x4f, 0xf4, 0x4, 0xff, 0x40, 0x0,
-    0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0xd0,
-
-    /* U+0417 "З" */
-    0x0, 0x49, 0xdf, 0xfe, 0xa5, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x6, 0xd6, 0x20,
-    0x1, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0x5e, 0xf7, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xdd, 0xdd,
-    0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xa0, 0xfd, 0x62, 0x0,
-    0x5, 0xcf, 0xf3, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x2, 0x8c, 0xef, 0xec, 0x81, 0x0,
-
-    /* U+0418 "И" */
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x9f, 0x90,
-    0x0, 0x0, 0x2, 0xff, 0xfb, 0x9f, 0x90, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0x9f, 0x90, 0x0, 0x0,
-    0xaf, 0xe8, 0xfb, 0x9f, 0x90, 0x0, 0x5, 0xff,
-    0x37, 0xfb, 0x9f, 0x90, 0x0, 0x2f, 0xf7, 0x7,
-    0xfb, 0x9f, 0x90, 0x0, 0xdf, 0xb0, 0x7, 0xfb,
-    0x9f, 0x90, 0x9, 0xfe, 0x10, 0x7, 0xfb, 0x9f,
-    0x90, 0x5f, 0xf4, 0x0, 0x7, 0xfb, 0x9f, 0x92,
-    0xef, 0x70, 0x0, 0x7, 0xfb, 0x9f, 0x9c, 0xfb,
-    0x0, 0x0, 0x7, 0xfb, 0x9f, 0xff, 0xe1, 0x0,
-    0x0, 0x7, 0xfb, 0x9f, 0xff, 0x40, 0x0, 0x0,
-    0x7, 0xfb, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-
-    /* U+0419 "Й" */
-    0x0, 0xa, 0xe0, 0x0, 0xd, 0xa0, 0x0, 0x0,
-    0x5, 0xf8, 0x11, 0x8f, 0x60, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x22, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xa, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0x2, 0xff,
-    0xfb, 0x9f, 0x90, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x9f, 0x90, 0x0, 0x0, 0xaf, 0xe8, 0xfb, 0x9f,
-    0x90, 0x0, 0x5, 0xff, 0x37, 0xfb, 0x9f, 0x90,
-    0x0, 0x2f, 0xf7, 0x7, 0xfb, 0x9f, 0x90, 0x0,
-    0xdf, 0xb0, 0x7, 0xfb, 0x9f, 0x90, 0x9, 0xfe,
-    0x10, 0x7, 0xfb, 0x9f, 0x90, 0x5f, 0xf4, 0x0,
-    0x7, 0xfb, 0x9f, 0x92, 0xef, 0x70, 0x0, 0x7,
-    0xfb, 0x9f, 0x9c, 0xfb, 0x0, 0x0, 0x7, 0xfb,
-    0x9f, 0xff, 0xe1, 0x0, 0x0, 0x7, 0xfb, 0x9f,
-    0xff, 0x40, 0x0, 0x0, 0x7, 0xfb, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x9f, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xfb,
-
-    /* U+041A "К" */
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0x9f,
-    0x80, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x1f, 0xf3, 0x0, 0x9f, 0x80, 0x0,
-    0x0, 0xcf, 0x80, 0x0, 0x9f, 0x80, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x2f, 0xf2,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x3f, 0xf6, 0x0, 0x0, 0x9f, 0x80, 0x0,
-    0x7, 0xff, 0x20, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0xbf, 0xc0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x1e,
-    0xf8, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x4, 0xff,
-    0x30, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-
-    /* U+041B "Л" */
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x1f,
-    0xe0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x1, 0xfd,
-    0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x4f, 0xa0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0,
-    0x2f, 0xf0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x9f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x2f,
-    0xfa, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff,
-
-    /* U+041C "М" */
-    0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfc, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xc9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xfc, 0x9f, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x9f, 0xef, 0xc9, 0xf8, 0xdf, 0x50, 0x0, 0x0,
-    0x2f, 0xe6, 0xfc, 0x9f, 0x84, 0xfe, 0x0, 0x0,
-    0xb, 0xf6, 0x5f, 0xc9, 0xf8, 0xb, 0xf7, 0x0,
-    0x4, 0xfd, 0x5, 0xfc, 0x9f, 0x80, 0x2f, 0xf1,
-    0x0, 0xdf, 0x40, 0x5f, 0xc9, 0xf8, 0x0, 0x8f,
-    0xa0, 0x6f, 0xb0, 0x5, 0xfc, 0x9f, 0x80, 0x0,
-    0xef, 0x4e, 0xf2, 0x0, 0x5f, 0xc9, 0xf8, 0x0,
-    0x6, 0xff, 0xf8, 0x0, 0x5, 0xfc, 0x9f, 0x80,
-    0x0, 0xc, 0xfe, 0x10, 0x0, 0x5f, 0xc9, 0xf8,
-    0x0, 0x0, 0x3f, 0x60, 0x0, 0x5, 0xfc, 0x9f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-
-    /* U+041D "Н" */
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x9, 0xfa, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xfa, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x9, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x9, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x9,
-    0xfa, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x9, 0xfa, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xfa, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x9, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x9, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x9,
-    0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x9, 0xfa,
-
-    /* U+041E "О" */
-    0x0, 0x0, 0x28, 0xcf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x30,
-    0x0, 0x0, 0xaf, 0xfb, 0x41, 0x2, 0x6d, 0xff,
-    0x50, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x20, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1, 0xbf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x5d, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf7, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x7b, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf5, 0x7f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x11, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x7, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0xb,
-    0xff, 0xa4, 0x10, 0x26, 0xdf, 0xf5, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x2, 0x8d, 0xff, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+041F "П" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x7, 0xfa, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x7,
-    0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x7, 0xfa,
-
-    /* U+0420 "Р" */
-    0x9f, 0xff, 0xff, 0xfe, 0xc7, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x30, 0x9f, 0x90, 0x0,
-    0x1, 0x5d, 0xfe, 0x19, 0xf9, 0x0, 0x0, 0x0,
-    0x1e, 0xf7, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x8f,
-    0xb9, 0xf9, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x8f, 0xb9, 0xf9, 0x0,
-    0x0, 0x0, 0x1e, 0xf7, 0x9f, 0x90, 0x0, 0x1,
-    0x5d, 0xfe, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x9f, 0xff, 0xff, 0xfe, 0xc7, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0421 "С" */
-    0x0, 0x0, 0x28, 0xcf, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0,
-    0xbf, 0xfb, 0x41, 0x1, 0x6d, 0xfd, 0x0, 0x7f,
-    0xf5, 0x0, 0x0, 0x0, 0x9, 0x20, 0x1f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x92, 0x0, 0xb, 0xff, 0xb4, 0x10, 0x16, 0xdf,
-    0xd0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xd3,
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+0422 "Т" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-
-    /* U+0423 "У" */
-    0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x5,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0xd,
-    0xf7, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x4f,
-    0xe0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0xcf,
-    0x70, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x4, 0xfe,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0xb, 0xf7,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x9f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0x1, 0xaf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xfe, 0x91, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0424 "Ф" */
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xff, 0xec, 0x93, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfe, 0xdf, 0xfd, 0xdf, 0xff, 0xb1, 0x0,
-    0x0, 0x9f, 0xf8, 0x20, 0xd, 0xf3, 0x0, 0x5d,
-    0xfd, 0x10, 0x4, 0xff, 0x30, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0xcf, 0xa0, 0xb, 0xf8, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x2f, 0xf1, 0xe, 0xf3,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0xd, 0xf4,
-    0xf, 0xf2, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0xc, 0xf5, 0xe, 0xf3, 0x0, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0xd, 0xf4, 0xb, 0xf9, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x2f, 0xf1, 0x4, 0xff,
-    0x40, 0x0, 0xd, 0xf3, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x9f, 0xf8, 0x20, 0xd, 0xf3, 0x0, 0x5d,
-    0xfe, 0x10, 0x0, 0x8, 0xff, 0xfe, 0xdf, 0xfd,
-    0xdf, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0425 "Х" */
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x1e, 0xf9, 0x0,
-    0x3f, 0xf4, 0x0, 0x0, 0xb, 0xfd, 0x0, 0x0,
-    0x9f, 0xe1, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0,
-    0xdf, 0xa0, 0x2, 0xff, 0x80, 0x0, 0x0, 0x3,
-    0xff, 0x50, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xef,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb2, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x9f, 0xe1, 0x6, 0xff,
-    0x40, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0xb, 0xfe,
-    0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x1e, 0xfa,
-    0x0, 0x9, 0xfe, 0x0, 0x0, 0x0, 0x5f, 0xf4,
-    0x4, 0xff, 0x40, 0x0, 0x0, 0x0, 0xaf, 0xe1,
-
-    /* U+0426 "Ц" */
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x85,
-
-    /* U+0427 "Ч" */
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xcd, 0xf5,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0xdf, 0x50, 0x0,
-    0x0, 0x0, 0x6f, 0xcd, 0xf5, 0x0, 0x0, 0x0,
-    0x6, 0xfc, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x6f,
-    0xcc, 0xf5, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x6f, 0xc7, 0xfe, 0x10,
-    0x0, 0x0, 0x6, 0xfc, 0x1f, 0xfe, 0x51, 0x1,
-    0x49, 0xff, 0xc0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x18, 0xce, 0xed, 0xa5, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc,
-
-    /* U+0428 "Ш" */
-    0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x7, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x7, 0xfb, 0x9f, 0x90, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb, 0x9f, 0x90,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb,
-    0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x7, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x7, 0xfb, 0x9f, 0x90, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb, 0x9f, 0x90,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb,
-    0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x7, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x7, 0xfb, 0x9f, 0x90, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb, 0x9f, 0x90,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb,
-    0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x7, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x7, 0xfb, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0429 "Щ" */
-    0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x9f, 0x90, 0x0, 0x0, 0xf,
-    0xf2, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x7, 0xfb, 0x0, 0x9f, 0x90, 0x0, 0x0, 0xf,
-    0xf2, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x88,
-
-    /* U+042A "Ъ" */
-    0xbf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0, 0x0,
-    0x0, 0x1f, 0xfc, 0xcc, 0xcd, 0xef, 0xfe, 0x30,
-    0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x3, 0xdf,
-    0xd0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x3f, 0xf2, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0xf, 0xf4, 0x0, 0x0, 0x1f, 0xf1,
-    0x0, 0x0, 0x0, 0x4f, 0xf1, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x0, 0x4, 0xef, 0xb0, 0x0, 0x0,
-    0x1f, 0xfc, 0xcc, 0xcc, 0xef, 0xfd, 0x10, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0,
-
-    /* U+042B "Ы" */
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf7, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf7, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf7, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x9f, 0xff,
-    0xff, 0xff, 0xeb, 0x40, 0x0, 0xb, 0xf7, 0x9f,
-    0xec, 0xcc, 0xce, 0xff, 0xf9, 0x0, 0xb, 0xf7,
-    0x9f, 0x90, 0x0, 0x0, 0x18, 0xff, 0x50, 0xb,
-    0xf7, 0x9f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0xb, 0xf7, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0xb, 0xf7, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x7f, 0xc0, 0xb, 0xf7, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0xbf, 0x90, 0xb, 0xf7, 0x9f, 0x90, 0x0,
-    0x0, 0x19, 0xff, 0x30, 0xb, 0xf7, 0x9f, 0xec,
-    0xcc, 0xcd, 0xff, 0xf6, 0x0, 0xb, 0xf7, 0x9f,
-    0xff, 0xff, 0xff, 0xd9, 0x20, 0x0, 0xb, 0xf7,
-
-    /* U+042C "Ь" */
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xeb, 0x40, 0x9, 0xfe, 0xcc,
-    0xcc, 0xef, 0xff, 0x90, 0x9f, 0x90, 0x0, 0x0,
-    0x18, 0xff, 0x59, 0xf9, 0x0, 0x0, 0x0, 0xb,
-    0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x7f, 0xc9,
-    0xf9, 0x0, 0x0, 0x0, 0x7, 0xfc, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0x99, 0xf9, 0x0, 0x0,
-    0x1, 0x9f, 0xf3, 0x9f, 0xec, 0xcc, 0xcd, 0xff,
-    0xf6, 0x9, 0xff, 0xff, 0xff, 0xfd, 0x92, 0x0,
-
-    /* U+042D "Э" */
-    0x0, 0x6, 0xbe, 0xff, 0xc7, 0x10, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x1f,
-    0xfc, 0x52, 0x2, 0x6d, 0xff, 0x50, 0x0, 0x57,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x4d, 0xdd,
-    0xdd, 0xdd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xa0, 0x5, 0x70, 0x0, 0x0, 0x0, 0xaf,
-    0xf2, 0x1, 0xff, 0xc5, 0x10, 0x16, 0xdf, 0xf5,
-    0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xfc, 0x71, 0x0, 0x0,
-
-    /* U+042E "Ю" */
-    0x9f, 0x90, 0x0, 0x0, 0x1, 0x7c, 0xef, 0xea,
-    0x40, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x6, 0xff,
-    0xfe, 0xef, 0xff, 0xa0, 0x0, 0x9f, 0x90, 0x0,
-    0x8, 0xff, 0x92, 0x0, 0x6, 0xef, 0xd0, 0x9,
-    0xf9, 0x0, 0x4, 0xff, 0x40, 0x0, 0x0, 0x1,
-    0xdf, 0xa0, 0x9f, 0x90, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x39, 0xf9, 0x0, 0x3f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x9f,
-    0x90, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xd9, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x9f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0xf9,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfd, 0x9f, 0x90, 0x4, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x99, 0xf9, 0x0, 0xe, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x9f, 0x90,
-    0x0, 0x6f, 0xf7, 0x0, 0x0, 0x0, 0x3e, 0xfa,
-    0x9, 0xf9, 0x0, 0x0, 0x9f, 0xfb, 0x41, 0x13,
-    0x9f, 0xfd, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xfe, 0xa4, 0x0, 0x0,
-
-    /* U+042F "Я" */
-    0x0, 0x7, 0xce, 0xff, 0xff, 0xff, 0xb0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xd, 0xfe, 0x51,
-    0x0, 0x0, 0x7f, 0xb5, 0xff, 0x10, 0x0, 0x0,
-    0x7, 0xfb, 0x9f, 0xa0, 0x0, 0x0, 0x0, 0x7f,
-    0xbb, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x9f,
-    0xa0, 0x0, 0x0, 0x0, 0x7f, 0xb6, 0xfe, 0x10,
-    0x0, 0x0, 0x7, 0xfb, 0xe, 0xfd, 0x40, 0x0,
-    0x0, 0x7f, 0xb0, 0x2e, 0xff, 0xfe, 0xee, 0xef,
-    0xfb, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0xdf, 0x50, 0x0, 0x7, 0xfb, 0x0, 0x8f,
-    0xc0, 0x0, 0x0, 0x7f, 0xb0, 0x2f, 0xf2, 0x0,
-    0x0, 0x7, 0xfb, 0xc, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xb6, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xfb,
-
-    /* U+0430 "а" */
-    0x2, 0x9d, 0xff, 0xd9, 0x20, 0x5, 0xff, 0xfe,
-    0xef, 0xff, 0x20, 0x1d, 0x50, 0x0, 0x2c, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x20, 0x4b, 0xef, 0xff, 0xff,
-    0xf3, 0x4f, 0xfc, 0x98, 0x88, 0xff, 0x3c, 0xf7,
-    0x0, 0x0, 0xe, 0xf3, 0xef, 0x30, 0x0, 0x1,
-    0xff, 0x3c, 0xf8, 0x0, 0x0, 0xbf, 0xf3, 0x4f,
-    0xfc, 0x9a, 0xef, 0xef, 0x30, 0x2a, 0xef, 0xea,
-    0x2c, 0xf3,
-
-    /* U+0431 "б" */
-    0x0, 0x0, 0x0, 0x0, 0x37, 0xaa, 0x0, 0x0,
-    0x1, 0x7b, 0xff, 0xff, 0xe0, 0x0, 0x8, 0xff,
-    0xff, 0xc9, 0x52, 0x0, 0xa, 0xff, 0x94, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x6c, 0xfe, 0xc6, 0x0, 0x6, 0xf8, 0xcf,
-    0xff, 0xff, 0xfb, 0x0, 0x9f, 0xff, 0x81, 0x0,
-    0x6f, 0xf9, 0x9, 0xff, 0x70, 0x0, 0x0, 0x4f,
-    0xf1, 0x9f, 0xf0, 0x0, 0x0, 0x0, 0xcf, 0x68,
-    0xfc, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x9f, 0x82, 0xff, 0x0, 0x0,
-    0x0, 0xc, 0xf6, 0xd, 0xf7, 0x0, 0x0, 0x4,
-    0xff, 0x10, 0x4f, 0xf7, 0x0, 0x4, 0xef, 0x80,
-    0x0, 0x7f, 0xff, 0xde, 0xff, 0xa0, 0x0, 0x0,
-    0x3a, 0xef, 0xeb, 0x40, 0x0,
-
-    /* U+0432 "в" */
-    0xff, 0xff, 0xff, 0xeb, 0x40, 0xf, 0xfb, 0xaa,
-    0xad, 0xff, 0x60, 0xff, 0x10, 0x0, 0x8, 0xfc,
-    0xf, 0xf1, 0x0, 0x0, 0x5f, 0xc0, 0xff, 0x10,
-    0x0, 0x3c, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0xff, 0x98, 0x88, 0xaf, 0xf7, 0xf, 0xf1,
-    0x0, 0x0, 0x2f, 0xf1, 0xff, 0x10, 0x0, 0x0,
-    0xef, 0x3f, 0xf1, 0x0, 0x0, 0x3f, 0xf1, 0xff,
-    0xba, 0xaa, 0xcf, 0xfa, 0xf, 0xff, 0xff, 0xff,
-    0xc7, 0x0,
-
-    /* U+0433 "г" */
-    0xff, 0xff, 0xff, 0xff, 0xaf, 0xfe, 0xee, 0xee,
-    0xe8, 0xff, 0x20, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0xf,
-    0xf2, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0,
-
-    /* U+0434 "д" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0xf, 0xfe, 0xee, 0xee, 0xff, 0x20, 0x0, 0xf,
-    0xe0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0xff, 0x20, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x7f, 0x80, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0xff, 0x20, 0x3,
-    0xfd, 0x0, 0x0, 0x0, 0xff, 0x20, 0xcf, 0xff,
-    0xee, 0xee, 0xee, 0xff, 0xed, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0xac, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xcb,
-
-    /* U+0435 "е" */
-    0x0, 0x1, 0x8d, 0xfe, 0xb5, 0x0, 0x0, 0x3,
-    0xef, 0xfd, 0xef, 0xfb, 0x0, 0x1, 0xef, 0x91,
-    0x0, 0x3d, 0xf9, 0x0, 0x8f, 0xa0, 0x0, 0x0,
-    0x1e, 0xf1, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x9f,
-    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xf9, 0x88, 0x88, 0x88, 0x88, 0x40, 0xdf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x10, 0x0,
-    0x0, 0x10, 0x0, 0x1d, 0xfd, 0x40, 0x1, 0x7f,
-    0x60, 0x0, 0x2d, 0xff, 0xfe, 0xff, 0xf6, 0x0,
-    0x0, 0x7, 0xce, 0xfd, 0x92, 0x0,
-
-    /* U+0436 "ж" */
-    0x2f, 0xf2, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x7,
-    0xfc, 0x0, 0x7f, 0xc0, 0x0, 0xb, 0xf6, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0xdf, 0x50, 0x0, 0xbf,
-    0x60, 0x0, 0xbf, 0x80, 0x0, 0x3, 0xfe, 0x0,
-    0xb, 0xf6, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0xbf, 0x60, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0xe, 0xfd, 0xdf, 0xfe, 0xde, 0xfa, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0xb, 0xf6,
-    0x1, 0xef, 0x60, 0x0, 0x0, 0x6f, 0xf1, 0x0,
-    0xbf, 0x60, 0x6, 0xff, 0x20, 0x0, 0x1f, 0xf6,
-    0x0, 0xb, 0xf6, 0x0, 0xb, 0xfb, 0x0, 0xb,
-    0xfc, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x2f, 0xf6,
-    0x6, 0xff, 0x20, 0x0, 0xb, 0xf6, 0x0, 0x0,
-    0x6f, 0xf1,
-
-    /* U+0437 "з" */
-    0x1, 0x7c, 0xef, 0xeb, 0x60, 0x0, 0xcf, 0xff,
-    0xdf, 0xff, 0xb0, 0x5, 0x61, 0x0, 0x5, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x0, 0x16, 0xfe, 0x10, 0x0, 0x3f, 0xff, 0xfd,
-    0x20, 0x0, 0x2, 0x88, 0x9d, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xc0, 0xc6, 0x10, 0x0, 0x4e, 0xf8, 0x3f,
-    0xff, 0xed, 0xff, 0xfc, 0x0, 0x28, 0xcf, 0xfe,
-    0xb5, 0x0,
-
-    /* U+0438 "и" */
-    0xff, 0x20, 0x0, 0x0, 0x2f, 0xf3, 0xff, 0x20,
-    0x0, 0x1, 0xdf, 0xf3, 0xff, 0x20, 0x0, 0xb,
-    0xff, 0xf3, 0xff, 0x20, 0x0, 0x8f, 0xde, 0xf3,
-    0xff, 0x20, 0x5, 0xff, 0x2e, 0xf3, 0xff, 0x20,
-    0x3f, 0xf4, 0xe, 0xf3, 0xff, 0x21, 0xef, 0x70,
-    0xe, 0xf3, 0xff, 0x3c, 0xfa, 0x0, 0xe, 0xf3,
-    0xff, 0xcf, 0xc0, 0x0, 0xe, 0xf3, 0xff, 0xfe,
-    0x10, 0x0, 0xe, 0xf3, 0xff, 0xf3, 0x0, 0x0,
-    0xe, 0xf3, 0xff, 0x60, 0x0, 0x0, 0xe, 0xf3,
-
-    /* U+0439 "й" */
-    0x0, 0x74, 0x0, 0x4, 0x70, 0x0, 0x0, 0xbe,
-    0x30, 0x3e, 0xb0, 0x0, 0x0, 0x1c, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x13, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x2f, 0xf3, 0xff, 0x20, 0x0, 0x1,
-    0xdf, 0xf3, 0xff, 0x20, 0x0, 0xb, 0xff, 0xf3,
-    0xff, 0x20, 0x0, 0x8f, 0xde, 0xf3, 0xff, 0x20,
-    0x5, 0xff, 0x2e, 0xf3, 0xff, 0x20, 0x3f, 0xf4,
-    0xe, 0xf3, 0xff, 0x21, 0xef, 0x70, 0xe, 0xf3,
-    0xff, 0x3c, 0xfa, 0x0, 0xe, 0xf3, 0xff, 0xcf,
-    0xc0, 0x0, 0xe, 0xf3, 0xff, 0xfe, 0x10, 0x0,
-    0xe, 0xf3, 0xff, 0xf3, 0x0, 0x0, 0xe, 0xf3,
-    0xff, 0x60, 0x0, 0x0, 0xe, 0xf3,
-
-    /* U+043A "к" */
-    0xff, 0x20, 0x0, 0x1, 0xef, 0x4f, 0xf2, 0x0,
-    0x0, 0xbf, 0x80, 0xff, 0x20, 0x0, 0x6f, 0xc0,
-    0xf, 0xf2, 0x0, 0x2f, 0xe1, 0x0, 0xff, 0x20,
-    0xd, 0xf4, 0x0, 0xf, 0xfd, 0xde, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xf, 0xf2,
-    0x1, 0xef, 0x80, 0x0, 0xff, 0x20, 0x4, 0xff,
-    0x40, 0xf, 0xf2, 0x0, 0x7, 0xfe, 0x20, 0xff,
-    0x20, 0x0, 0xa, 0xfc, 0xf, 0xf2, 0x0, 0x0,
-    0xd, 0xf9,
-
-    /* U+043B "л" */
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0xff, 0xee, 0xee, 0xef, 0xf1, 0x0, 0xf, 0xe0,
-    0x0, 0x1, 0xff, 0x10, 0x0, 0xfd, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x1f, 0xc0, 0x0, 0x1, 0xff,
-    0x10, 0x2, 0xfb, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x3f, 0xa0, 0x0, 0x1, 0xff, 0x10, 0x5, 0xf8,
-    0x0, 0x0, 0x1f, 0xf1, 0x0, 0x8f, 0x50, 0x0,
-    0x1, 0xff, 0x10, 0x1e, 0xf1, 0x0, 0x0, 0x1f,
-    0xf1, 0xaf, 0xfa, 0x0, 0x0, 0x1, 0xff, 0x1d,
-    0xfb, 0x10, 0x0, 0x0, 0x1f, 0xf1,
-
-    /* U+043C "м" */
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xc, 0xf7, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xef, 0xf7, 0xff, 0xdf, 0x30,
-    0x0, 0x8, 0xfd, 0xf7, 0xff, 0x4f, 0xc0, 0x0,
-    0x2f, 0xd6, 0xf7, 0xff, 0xb, 0xf5, 0x0, 0xaf,
-    0x36, 0xf7, 0xff, 0x2, 0xfd, 0x4, 0xfa, 0x6,
-    0xf7, 0xff, 0x0, 0x8f, 0x7d, 0xf1, 0x6, 0xf7,
-    0xff, 0x0, 0xe, 0xff, 0x70, 0x6, 0xf7, 0xff,
-    0x0, 0x5, 0xfd, 0x0, 0x6, 0xf7, 0xff, 0x0,
-    0x0, 0x94, 0x0, 0x6, 0xf7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7,
-
-    /* U+043D "н" */
-    0xff, 0x20, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0, 0x3f,
-    0xef, 0xf2, 0x0, 0x0, 0x3, 0xfe, 0xff, 0x20,
-    0x0, 0x0, 0x3f, 0xef, 0xfe, 0xdd, 0xdd, 0xde,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf2,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x3f, 0xef, 0xf2, 0x0, 0x0, 0x3, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0,
-    0x3, 0xfe,
-
-    /* U+043E "о" */
-    0x0, 0x0, 0x7c, 0xef, 0xd7, 0x10, 0x0, 0x0,
-    0x2d, 0xff, 0xfe, 0xff, 0xe3, 0x0, 0x1, 0xef,
-    0xc3, 0x0, 0x2b, 0xfe, 0x10, 0x7, 0xfd, 0x0,
-    0x0, 0x0, 0xcf, 0x80, 0xd, 0xf5, 0x0, 0x0,
-    0x0, 0x4f, 0xe0, 0xf, 0xf2, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0x7, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
-    0xdf, 0xc3, 0x0, 0x2c, 0xfe, 0x10, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x7c,
-    0xff, 0xd7, 0x10, 0x0,
-
-    /* U+043F "п" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xee,
-    0xee, 0xee, 0xfd, 0xff, 0x20, 0x0, 0x0, 0x4f,
-    0xdf, 0xf2, 0x0, 0x0, 0x4, 0xfd, 0xff, 0x20,
-    0x0, 0x0, 0x4f, 0xdf, 0xf2, 0x0, 0x0, 0x4,
-    0xfd, 0xff, 0x20, 0x0, 0x0, 0x4f, 0xdf, 0xf2,
-    0x0, 0x0, 0x4, 0xfd, 0xff, 0x20, 0x0, 0x0,
-    0x4f, 0xdf, 0xf2, 0x0, 0x0, 0x4, 0xfd, 0xff,
-    0x20, 0x0, 0x0, 0x4f, 0xdf, 0xf2, 0x0, 0x0,
-    0x4, 0xfd,
-
-    /* U+0440 "р" */
-    0xff, 0x15, 0xbe, 0xfd, 0x81, 0x0, 0xf, 0xf9,
-    0xff, 0xdd, 0xff, 0xf4, 0x0, 0xff, 0xfb, 0x10,
-    0x1, 0xaf, 0xf2, 0xf, 0xfd, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0xff, 0x60, 0x0, 0x0, 0x4, 0xff,
-    0xf, 0xf3, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0xff,
-    0x30, 0x0, 0x0, 0x1, 0xff, 0x1f, 0xf6, 0x0,
-    0x0, 0x0, 0x4f, 0xe0, 0xff, 0xd0, 0x0, 0x0,
-    0xc, 0xf9, 0xf, 0xff, 0xc3, 0x0, 0x2c, 0xff,
-    0x20, 0xff, 0x9f, 0xff, 0xff, 0xfe, 0x40, 0xf,
-    0xf2, 0x3b, 0xef, 0xd8, 0x10, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0441 "с" */
-    0x0, 0x0, 0x7c, 0xef, 0xd8, 0x10, 0x0, 0x2d,
-    0xff, 0xfe, 0xff, 0xe2, 0x1, 0xdf, 0xc3, 0x0,
-    0x2b, 0xf9, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x50,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfd, 0x0, 0x0, 0x0, 0x50, 0x0, 0xdf,
-    0xc3, 0x0, 0x2b, 0xf9, 0x0, 0x2d, 0xff, 0xfe,
-    0xff, 0xe2, 0x0, 0x0, 0x7c, 0xef, 0xd8, 0x10,
-
-    /* U+0442 "т" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xee, 0xef,
-    0xff, 0xee, 0xea, 0x0, 0x0, 0xaf, 0x70, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0,
-
-    /* U+0443 "у" */
-    0xb, 0xf7, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x4f, 0xc0, 0x0, 0xcf,
-    0x60, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x5f, 0xd0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0xe, 0xf4, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0x7, 0xfb, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x1, 0xff, 0x20, 0x7f, 0x90,
-    0x0, 0x0, 0x0, 0x9f, 0x90, 0xdf, 0x20, 0x0,
-    0x0, 0x0, 0x2f, 0xf6, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0x0, 0x6, 0x20, 0x1c, 0xf7, 0x0,
-    0x0, 0x0, 0x2f, 0xfe, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xdf, 0xe8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0444 "ф" */
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0xff,
-    0xda, 0x40, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x1e, 0xfc, 0x40, 0x3f,
-    0xe0, 0x16, 0xef, 0xb0, 0x9, 0xfc, 0x0, 0x3,
-    0xfe, 0x0, 0x2, 0xff, 0x40, 0xef, 0x40, 0x0,
-    0x3f, 0xe0, 0x0, 0x9, 0xf9, 0xf, 0xf1, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x5f, 0xb0, 0xff, 0x10,
-    0x0, 0x3f, 0xe0, 0x0, 0x6, 0xfb, 0xd, 0xf4,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x9f, 0x90, 0x8f,
-    0xc0, 0x0, 0x3f, 0xe0, 0x0, 0x2f, 0xf4, 0x1,
-    0xef, 0xc4, 0x3, 0xfe, 0x1, 0x6f, 0xfb, 0x0,
-    0x3, 0xef, 0xff, 0xef, 0xfd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x6b, 0xef, 0xff, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0445 "х" */
-    0x3f, 0xf2, 0x0, 0x0, 0x3f, 0xf2, 0x7, 0xfd,
-    0x0, 0x0, 0xdf, 0x50, 0x0, 0xbf, 0x90, 0xa,
-    0xf9, 0x0, 0x0, 0x1e, 0xf5, 0x6f, 0xd0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x0, 0x0, 0x0, 0x6, 0xfd, 0xef, 0x50, 0x0,
-    0x0, 0x3f, 0xf2, 0x3f, 0xf2, 0x0, 0x0, 0xdf,
-    0x60, 0x8, 0xfc, 0x0, 0xa, 0xfa, 0x0, 0x0,
-    0xcf, 0x90, 0x6f, 0xd0, 0x0, 0x0, 0x1e, 0xf5,
-
-    /* U+0446 "ц" */
-    0xff, 0x20, 0x0, 0x0, 0x7f, 0xa0, 0xf, 0xf2,
-    0x0, 0x0, 0x7, 0xfa, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0x7f, 0xa0, 0xf, 0xf2, 0x0, 0x0, 0x7,
-    0xfa, 0x0, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xa0,
-    0xf, 0xf2, 0x0, 0x0, 0x7, 0xfa, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x7f, 0xa0, 0xf, 0xf2, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x7f, 0xa0, 0xf, 0xf2, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0xff, 0xee, 0xee, 0xee, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0x60,
-
-    /* U+0447 "ч" */
-    0x1f, 0xf0, 0x0, 0x0, 0xc, 0xf5, 0x1f, 0xf0,
-    0x0, 0x0, 0xc, 0xf5, 0x1f, 0xf0, 0x0, 0x0,
-    0xc, 0xf5, 0x1f, 0xf0, 0x0, 0x0, 0xc, 0xf5,
-    0xf, 0xf2, 0x0, 0x0, 0xc, 0xf5, 0xd, 0xfb,
-    0x10, 0x0, 0x4e, 0xf5, 0x4, 0xff, 0xfd, 0xdf,
-    0xff, 0xf5, 0x0, 0x3b, 0xef, 0xeb, 0x5c, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-
-    /* U+0448 "ш" */
-    0xff, 0x20, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x7f,
-    0xaf, 0xf2, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x7,
-    0xfa, 0xff, 0x20, 0x0, 0xb, 0xf6, 0x0, 0x0,
-    0x7f, 0xaf, 0xf2, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x7, 0xfa, 0xff, 0x20, 0x0, 0xb, 0xf6, 0x0,
-    0x0, 0x7f, 0xaf, 0xf2, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x7, 0xfa, 0xff, 0x20, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x7f, 0xaf, 0xf2, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x7, 0xfa, 0xff, 0x20, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x7f, 0xaf, 0xf2, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x7, 0xfa, 0xff, 0xee, 0xee,
-    0xef, 0xfe, 0xee, 0xee, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-
-    /* U+0449 "щ" */
-    0xff, 0x20, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x7f,
-    0xa0, 0xf, 0xf2, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x7, 0xfa, 0x0, 0xff, 0x20, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x7f, 0xa0, 0xf, 0xf2, 0x0, 0x0,
-    0xbf, 0x60, 0x0, 0x7, 0xfa, 0x0, 0xff, 0x20,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x7f, 0xa0, 0xf,
-    0xf2, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x7, 0xfa,
-    0x0, 0xff, 0x20, 0x0, 0xb, 0xf6, 0x0, 0x0,
-    0x7f, 0xa0, 0xf, 0xf2, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x7, 0xfa, 0x0, 0xff, 0x20, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x7f, 0xa0, 0xf, 0xf2, 0x0,
-    0x0, 0xbf, 0x60, 0x0, 0x7, 0xfa, 0x0, 0xff,
-    0xee, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xff, 0xfe,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x30,
-
-    /* U+044A "ъ" */
-    0xef, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0xee, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xc6, 0x0, 0x0, 0x5, 0xfe, 0x99, 0x9b,
-    0xff, 0x90, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x3f,
-    0xf2, 0x0, 0x5, 0xfc, 0x0, 0x0, 0xc, 0xf5,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0x5, 0xfc, 0x0, 0x0, 0x4f, 0xf1, 0x0, 0x5,
-    0xfe, 0xaa, 0xac, 0xff, 0x80, 0x0, 0x5, 0xff,
-    0xff, 0xfe, 0xb5, 0x0,
-
-    /* U+044B "ы" */
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x6, 0xfb, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x6, 0xfb, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0xff, 0xff, 0xff, 0xea,
-    0x20, 0x6, 0xfb, 0xff, 0xa9, 0x9a, 0xef, 0xe2,
-    0x6, 0xfb, 0xff, 0x20, 0x0, 0xc, 0xf9, 0x6,
-    0xfb, 0xff, 0x20, 0x0, 0x5, 0xfc, 0x6, 0xfb,
-    0xff, 0x20, 0x0, 0x6, 0xfc, 0x6, 0xfb, 0xff,
-    0x20, 0x0, 0x1d, 0xf8, 0x6, 0xfb, 0xff, 0xaa,
-    0xab, 0xff, 0xe1, 0x6, 0xfb, 0xff, 0xff, 0xff,
-    0xd8, 0x10, 0x6, 0xfb,
-
-    /* U+044C "ь" */
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xea,
-    0x30, 0xff, 0xa9, 0x9a, 0xdf, 0xf3, 0xff, 0x20,
-    0x0, 0xa, 0xfb, 0xff, 0x20, 0x0, 0x3, 0xff,
-    0xff, 0x20, 0x0, 0x4, 0xfe, 0xff, 0x20, 0x0,
-    0xb, 0xfb, 0xff, 0xaa, 0xab, 0xef, 0xf2, 0xff,
-    0xff, 0xff, 0xd9, 0x20,
-
-    /* U+044D "э" */
-    0x0, 0x6c, 0xef, 0xda, 0x30, 0x0, 0x1d, 0xff,
-    0xdc, 0xef, 0xf9, 0x0, 0x1c, 0x81, 0x0, 0x4,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x1, 0x99, 0x99,
-    0x9b, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x1d, 0x91,
-    0x0, 0x5, 0xef, 0x90, 0x2d, 0xff, 0xdc, 0xff,
-    0xf9, 0x0, 0x0, 0x6c, 0xef, 0xea, 0x40, 0x0,
-
-    /* U+044E "ю" */
-    0xff, 0x20, 0x0, 0x4, 0xbe, 0xfd, 0x92, 0x0,
-    0xf, 0xf2, 0x0, 0x9, 0xff, 0xec, 0xef, 0xf5,
-    0x0, 0xff, 0x20, 0x7, 0xfe, 0x40, 0x0, 0x7f,
-    0xf3, 0xf, 0xf2, 0x1, 0xff, 0x30, 0x0, 0x0,
-    0x8f, 0xb0, 0xff, 0x20, 0x5f, 0xc0, 0x0, 0x0,
-    0x1, 0xff, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xd, 0xf3, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xef, 0x3f, 0xf2, 0x5, 0xfc, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0xff, 0x20, 0x1f, 0xf4,
-    0x0, 0x0, 0x9, 0xfb, 0xf, 0xf2, 0x0, 0x8f,
-    0xf6, 0x0, 0x19, 0xff, 0x30, 0xff, 0x20, 0x0,
-    0xaf, 0xff, 0xef, 0xff, 0x50, 0xf, 0xf2, 0x0,
-    0x0, 0x4b, 0xef, 0xd9, 0x20, 0x0,
-
-    /* U+044F "я" */
-    0x0, 0x7c, 0xff, 0xff, 0xff, 0x61, 0xdf, 0xff,
-    0xee, 0xef, 0xf6, 0x8f, 0xe4, 0x0, 0x0, 0x8f,
-    0x6c, 0xf7, 0x0, 0x0, 0x8, 0xf6, 0xcf, 0x60,
-    0x0, 0x0, 0x8f, 0x68, 0xfc, 0x0, 0x0, 0x8,
-    0xf6, 0x1d, 0xfe, 0xa8, 0x88, 0xcf, 0x60, 0x19,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xaf, 0x80, 0x0,
-    0x8f, 0x60, 0x4f, 0xd0, 0x0, 0x8, 0xf6, 0xe,
-    0xf4, 0x0, 0x0, 0x8f, 0x69, 0xfa, 0x0, 0x0,
-    0x8, 0xf6,
-
-    /* U+0450 "ѐ" */
-    0x0, 0x6, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xec, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xdf, 0xeb, 0x50, 0x0, 0x0,
-    0x3e, 0xff, 0xde, 0xff, 0xb0, 0x0, 0x1e, 0xf9,
-    0x10, 0x3, 0xdf, 0x90, 0x8, 0xfa, 0x0, 0x0,
-    0x1, 0xef, 0x10, 0xdf, 0x30, 0x0, 0x0, 0x9,
-    0xf6, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0x98, 0x88, 0x88, 0x88, 0x84, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd1, 0x0,
-    0x0, 0x1, 0x0, 0x1, 0xdf, 0xd4, 0x0, 0x17,
-    0xf6, 0x0, 0x2, 0xdf, 0xff, 0xef, 0xff, 0x60,
-    0x0, 0x0, 0x7c, 0xef, 0xd9, 0x20, 0x0,
-
-    /* U+0451 "ё" */
-    0x0, 0x2, 0xe9, 0x1, 0xea, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x31,
-    0x0, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8d, 0xfe, 0xb5, 0x0,
-    0x0, 0x3, 0xef, 0xfd, 0xef, 0xfb, 0x0, 0x1,
-    0xef, 0x91, 0x0, 0x3d, 0xf9, 0x0, 0x8f, 0xa0,
-    0x0, 0x0, 0x1e, 0xf1, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x9f, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xf, 0xf9, 0x88, 0x88, 0x88, 0x88, 0x40,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfd,
-    0x10, 0x0, 0x0, 0x10, 0x0, 0x1d, 0xfd, 0x40,
-    0x1, 0x7f, 0x60, 0x0, 0x2d, 0xff, 0xfe, 0xff,
-    0xf6, 0x0, 0x0, 0x7, 0xce, 0xfd, 0x92, 0x0,
-
-    /* U+0452 "ђ" */
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x88, 0xff, 0x88, 0x88, 0x82, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x15, 0xbe, 0xfd, 0x81, 0x0, 0x0, 0xf, 0xf9,
-    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0xff, 0xfa,
-    0x20, 0x5, 0xef, 0xa0, 0x0, 0xf, 0xfd, 0x0,
-    0x0, 0x6, 0xff, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0x1f, 0xf1, 0x0, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0xff, 0x30, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0xff, 0x30, 0x0, 0x0, 0xf,
-    0xf2, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0xff, 0x30, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x6, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xed, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0xfd, 0x70, 0x0,
-
-    /* U+0453 "ѓ" */
-    0x0, 0x0, 0x4, 0x87, 0x10, 0x0, 0x4, 0xfe,
-    0x40, 0x0, 0x4, 0xfd, 0x20, 0x0, 0x0, 0x77,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xfa, 0xff, 0xee, 0xee, 0xee, 0x8f,
-    0xf2, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+0454 "є" */
-    0x0, 0x0, 0x6c, 0xef, 0xea, 0x40, 0x0, 0x2,
-    0xdf, 0xfe, 0xce, 0xff, 0xa0, 0x0, 0xdf, 0xa2,
-    0x0, 0x2, 0xb7, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xf,
-    0xfa, 0x99, 0x99, 0x70, 0x0, 0x0, 0xdf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfc, 0x20, 0x0, 0x3d,
-    0xa0, 0x0, 0x2d, 0xff, 0xec, 0xef, 0xf9, 0x0,
-    0x0, 0x6, 0xce, 0xfe, 0xa3, 0x0,
-
-    /* U+0455 "ѕ" */
-    0x0, 0x7, 0xce, 0xfe, 0xb6, 0x0, 0x1d, 0xff,
-    0xee, 0xff, 0xf3, 0x8, 0xfd, 0x20, 0x0, 0x47,
-    0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x8, 0xfd,
-    0x40, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xfc, 0x95,
-    0x0, 0x0, 0x6, 0xad, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x1, 0x5d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x7b, 0x40, 0x0, 0x1b, 0xf9, 0xd,
-    0xff, 0xfe, 0xef, 0xfe, 0x20, 0x6, 0xbe, 0xfe,
-    0xc7, 0x10,
-
-    /* U+0456 "і" */
-    0x1c, 0xe3, 0x4f, 0xf7, 0x9, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf2, 0xf, 0xf2, 0xf, 0xf2,
-    0xf, 0xf2, 0xf, 0xf2, 0xf, 0xf2, 0xf, 0xf2,
-    0xf, 0xf2, 0xf, 0xf2, 0xf, 0xf2, 0xf, 0xf2,
-    0xf, 0xf2,
-
-    /* U+0457 "ї" */
-    0x5f, 0x53, 0xf7, 0x8f, 0x75, 0xf9, 0x3, 0x0,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0xff, 0x10, 0x0, 0xff, 0x10, 0x0, 0xff, 0x10,
-    0x0, 0xff, 0x10, 0x0, 0xff, 0x10, 0x0, 0xff,
-    0x10, 0x0, 0xff, 0x10, 0x0, 0xff, 0x10, 0x0,
-    0xff, 0x10, 0x0, 0xff, 0x10, 0x0, 0xff, 0x10,
-
-    /* U+0458 "ј" */
-    0x0, 0x0, 0x9, 0xb1, 0x0, 0x0, 0x4f, 0xf7,
-    0x0, 0x0, 0x1d, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0xf, 0xf2, 0x2, 0x0, 0x5f, 0xf0,
-    0xb, 0xfd, 0xff, 0x70, 0x9, 0xef, 0xe7, 0x0,
-
-    /* U+0459 "љ" */
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfe, 0xee, 0xef, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xd0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xea, 0x20, 0x0, 0x2f, 0xb0, 0x0, 0x2, 0xff,
-    0xa9, 0x9a, 0xef, 0xf2, 0x0, 0x3f, 0xa0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0xb, 0xfa, 0x0, 0x5f,
-    0x80, 0x0, 0x2, 0xff, 0x20, 0x0, 0x5, 0xfd,
-    0x0, 0x8f, 0x50, 0x0, 0x2, 0xff, 0x20, 0x0,
-    0x6, 0xfd, 0x1, 0xef, 0x10, 0x0, 0x2, 0xff,
-    0x20, 0x0, 0x2d, 0xf9, 0xaf, 0xfa, 0x0, 0x0,
-    0x2, 0xff, 0xdc, 0xcd, 0xff, 0xe1, 0xdf, 0xb1,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xd9, 0x10,
-
-    /* U+045A "њ" */
-    0xff, 0x20, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0,
-    0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7,
-    0x0, 0xff, 0xed, 0xdd, 0xdd, 0xef, 0xfd, 0xdd,
-    0xff, 0xfc, 0xf, 0xf2, 0x0, 0x0, 0x6, 0xfb,
-    0x0, 0x0, 0x5f, 0xf4, 0xff, 0x20, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0xdf, 0x5f, 0xf2, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x2f, 0xf2, 0xff,
-    0x20, 0x0, 0x0, 0x6f, 0xd9, 0x99, 0xbf, 0xfa,
-    0xf, 0xf2, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe,
-    0xc5, 0x0,
-
-    /* U+045B "ћ" */
-    0x0, 0x9, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x2, 0x33,
-    0xff, 0x63, 0x33, 0x31, 0x0, 0x0, 0x0, 0xf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x35, 0xbe, 0xfd, 0x81, 0x0, 0x0, 0xf, 0xfb,
-    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0xff, 0xfa,
-    0x20, 0x5, 0xff, 0x90, 0x0, 0xf, 0xfd, 0x0,
-    0x0, 0x6, 0xfe, 0x0, 0x0, 0xff, 0x60, 0x0,
-    0x0, 0x1f, 0xf1, 0x0, 0xf, 0xf3, 0x0, 0x0,
-    0x0, 0xff, 0x20, 0x0, 0xff, 0x30, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0,
-    0xff, 0x20, 0x0, 0xff, 0x30, 0x0, 0x0, 0xf,
-    0xf2, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0xff, 0x30, 0x0, 0x0, 0xf, 0xf2,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0xff, 0x20,
-
-    /* U+045C "ќ" */
-    0x0, 0x0, 0x1, 0x78, 0x30, 0x0, 0x0, 0x1,
-    0xcf, 0x80, 0x0, 0x0, 0x1, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x58, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x1e,
-    0xf4, 0xff, 0x20, 0x0, 0xb, 0xf8, 0xf, 0xf2,
-    0x0, 0x6, 0xfc, 0x0, 0xff, 0x20, 0x2, 0xfe,
-    0x10, 0xf, 0xf2, 0x0, 0xdf, 0x40, 0x0, 0xff,
-    0xdd, 0xef, 0x80, 0x0, 0xf, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0xff, 0x20, 0x1e, 0xf8, 0x0, 0xf,
-    0xf2, 0x0, 0x4f, 0xf4, 0x0, 0xff, 0x20, 0x0,
-    0x7f, 0xe2, 0xf, 0xf2, 0x0, 0x0, 0xaf, 0xc0,
-    0xff, 0x20, 0x0, 0x0, 0xdf, 0x90,
-
-    /* U+045D "ѝ" */
-    0x1, 0x78, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0x2f, 0xf3, 0xff, 0x20, 0x0, 0x1,
-    0xdf, 0xf3, 0xff, 0x20, 0x0, 0xb, 0xff, 0xf3,
-    0xff, 0x20, 0x0, 0x8f, 0xde, 0xf3, 0xff, 0x20,
-    0x5, 0xff, 0x2e, 0xf3, 0xff, 0x20, 0x3f, 0xf4,
-    0xe, 0xf3, 0xff, 0x21, 0xef, 0x70, 0xe, 0xf3,
-    0xff, 0x3c, 0xfa, 0x0, 0xe, 0xf3, 0xff, 0xcf,
-    0xc0, 0x0, 0xe, 0xf3, 0xff, 0xfe, 0x10, 0x0,
-    0xe, 0xf3, 0xff, 0xf3, 0x0, 0x0, 0xe, 0xf3,
-    0xff, 0x60, 0x0, 0x0, 0xe, 0xf3,
-
-    /* U+045E "ў" */
-    0x0, 0x6, 0xf1, 0x0, 0x1f, 0x50, 0x0, 0x0,
-    0x2, 0xfa, 0x12, 0xbf, 0x20, 0x0, 0x0, 0x0,
-    0x5e, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0,
-    0xd, 0xf3, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x4f,
-    0xc0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0xbf, 0x50,
-    0x0, 0x5f, 0xd0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x1, 0xff,
-    0x20, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0xdf, 0x20, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x6, 0x20,
-    0x1c, 0xf7, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xe8, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+045F "џ" */
-    0xff, 0x20, 0x0, 0x0, 0xff, 0x2f, 0xf2, 0x0,
-    0x0, 0xf, 0xf2, 0xff, 0x20, 0x0, 0x0, 0xff,
-    0x2f, 0xf2, 0x0, 0x0, 0xf, 0xf2, 0xff, 0x20,
-    0x0, 0x0, 0xff, 0x2f, 0xf2, 0x0, 0x0, 0xf,
-    0xf2, 0xff, 0x20, 0x0, 0x0, 0xff, 0x2f, 0xf2,
-    0x0, 0x0, 0xf, 0xf2, 0xff, 0x20, 0x0, 0x0,
-    0xff, 0x2f, 0xf2, 0x0, 0x0, 0xf, 0xf2, 0xff,
-    0xee, 0xee, 0xee, 0xff, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0x0,
-
-    /* U+0490 "Ґ" */
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x89, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0x79, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x9, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0,
-    0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0491 "ґ" */
-    0x0, 0x0, 0x0, 0x68, 0x10, 0x0, 0x0, 0xd,
-    0xf2, 0x0, 0x0, 0x0, 0xdf, 0x2f, 0xff, 0xff,
-    0xff, 0xf2, 0xff, 0xee, 0xee, 0xee, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0xf,
-    0xf2, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0xff, 0x20,
-    0x0, 0x0, 0xf, 0xf2, 0x0, 0x0, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0,
-
-    /* U+2013 "–" */
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff,
-
-    /* U+2014 "—" */
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+2018 "‘" */
-    0xb, 0xb1, 0xf7, 0x6f, 0x3b, 0xf4, 0xff, 0xdb,
-    0xfb, 0x3, 0x0,
-
-    /* U+2019 "’" */
-    0x8f, 0x8e, 0xfe, 0x7f, 0xc2, 0xf7, 0x6f, 0x2a,
-    0xc0, 0x32, 0x0,
-
-    /* U+201A "‚" */
-    0x3, 0xb, 0xfb, 0xdf, 0xe4, 0xfb, 0x3f, 0x67,
-    0xf1, 0xbb, 0x0,
-
-    /* U+201C "“" */
-    0xb, 0xb0, 0x9, 0xd0, 0x1f, 0x70, 0xe, 0x90,
-    0x6f, 0x30, 0x3f, 0x60, 0xbf, 0x40, 0x8f, 0x70,
-    0xff, 0xd0, 0xcf, 0xf0, 0xbf, 0xb0, 0x9f, 0xd0,
-    0x3, 0x0, 0x3, 0x0,
-
-    /* U+201D "”" */
-    0x8f, 0x80, 0x5f, 0xa0, 0xef, 0xe0, 0xbf, 0xf1,
-    0x7f, 0xc0, 0x5f, 0xf0, 0x2f, 0x70, 0xf, 0xa0,
-    0x6f, 0x20, 0x4f, 0x40, 0xac, 0x0, 0x7e, 0x0,
-    0x32, 0x0, 0x22, 0x0,
-
-    /* U+2026 "…" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x7, 0xfa, 0x0, 0x6f, 0xc0, 0xff, 0xe0,
-    0xd, 0xff, 0x0, 0xbf, 0xf2, 0x8f, 0x70, 0x6,
-    0xf9, 0x0, 0x5f, 0xa0,
-
-    /* U+20B4 "₴" */
-    0x0, 0x1, 0x6b, 0xef, 0xed, 0x81, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xa, 0x94, 0x0, 0x2, 0xaf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf9, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x3, 0xaf, 0xe4, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x13, 0x0,
-    0x0, 0x4f, 0xf8, 0x20, 0x0, 0x48, 0xeb, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xb7, 0x10, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 95, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 94, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 32, .adv_w = 138, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 57, .adv_w = 247, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 177, .adv_w = 219, .box_w = 13, .box_h = 22, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 320, .adv_w = 297, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 464, .adv_w = 241, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 592, .adv_w = 74, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 603, .adv_w = 119, .box_w = 5, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 656, .adv_w = 119, .box_w = 6, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 719, .adv_w = 141, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 760, .adv_w = 205, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 815, .adv_w = 80, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 826, .adv_w = 135, .box_w = 7, .box_h = 2, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 833, .adv_w = 80, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 839, .adv_w = 124, .box_w = 10, .box_h = 21, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 944, .adv_w = 235, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1048, .adv_w = 130, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1096, .adv_w = 202, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1192, .adv_w = 201, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1288, .adv_w = 235, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1408, .adv_w = 202, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1504, .adv_w = 217, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1600, .adv_w = 210, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1704, .adv_w = 227, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1816, .adv_w = 217, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1920, .adv_w = 80, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1938, .adv_w = 80, .box_w = 3, .box_h = 16, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1962, .adv_w = 205, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 2023, .adv_w = 205, .box_w = 11, .box_h = 7, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 2062, .adv_w = 205, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 2123, .adv_w = 202, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2219, .adv_w = 364, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2429, .adv_w = 258, .box_w = 18, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2573, .adv_w = 266, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2685, .adv_w = 254, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2805, .adv_w = 291, .box_w = 16, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2933, .adv_w = 236, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3029, .adv_w = 224, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3125, .adv_w = 272, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3245, .adv_w = 286, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3357, .adv_w = 109, .box_w = 3, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3381, .adv_w = 181, .box_w = 11, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 3469, .adv_w = 253, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3581, .adv_w = 209, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3669, .adv_w = 336, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3805, .adv_w = 286, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3917, .adv_w = 296, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4053, .adv_w = 254, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4157, .adv_w = 296, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 4328, .adv_w = 256, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4432, .adv_w = 219, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4536, .adv_w = 207, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4640, .adv_w = 278, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4752, .adv_w = 251, .box_w = 17, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 4888, .adv_w = 396, .box_w = 25, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5088, .adv_w = 237, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5208, .adv_w = 228, .box_w = 16, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5336, .adv_w = 231, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5448, .adv_w = 117, .box_w = 5, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 5501, .adv_w = 124, .box_w = 10, .box_h = 21, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 5606, .adv_w = 117, .box_w = 6, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5669, .adv_w = 205, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 5724, .adv_w = 176, .box_w = 11, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5741, .adv_w = 211, .box_w = 7, .box_h = 3, .ofs_x = 2, .ofs_y = 14},
-    {.bitmap_index = 5752, .adv_w = 210, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5818, .adv_w = 240, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5929, .adv_w = 201, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6001, .adv_w = 240, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6112, .adv_w = 215, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6190, .adv_w = 124, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6267, .adv_w = 243, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 6379, .adv_w = 240, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6481, .adv_w = 98, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6515, .adv_w = 100, .box_w = 8, .box_h = 21, .ofs_x = -3, .ofs_y = -4},
-    {.bitmap_index = 6599, .adv_w = 217, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6701, .adv_w = 98, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6727, .adv_w = 372, .box_w = 20, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6847, .adv_w = 240, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6919, .adv_w = 224, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7003, .adv_w = 240, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 7107, .adv_w = 240, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 7211, .adv_w = 144, .box_w = 7, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7253, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7319, .adv_w = 146, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7387, .adv_w = 238, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7459, .adv_w = 197, .box_w = 14, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7543, .adv_w = 316, .box_w = 20, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7663, .adv_w = 194, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7735, .adv_w = 197, .box_w = 14, .box_h = 16, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 7847, .adv_w = 183, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7913, .adv_w = 124, .box_w = 7, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 7987, .adv_w = 105, .box_w = 3, .box_h = 21, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 8019, .adv_w = 124, .box_w = 7, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 8093, .adv_w = 205, .box_w = 11, .box_h = 4, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 8115, .adv_w = 177, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 8160, .adv_w = 177, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 8210, .adv_w = 234, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8330, .adv_w = 234, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8450, .adv_w = 293, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8594, .adv_w = 203, .box_w = 11, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8704, .adv_w = 249, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8816, .adv_w = 224, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8912, .adv_w = 112, .box_w = 3, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8936, .adv_w = 109, .box_w = 7, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9006, .adv_w = 190, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9086, .adv_w = 418, .box_w = 26, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9294, .adv_w = 415, .box_w = 24, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9486, .adv_w = 296, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9630, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9770, .adv_w = 290, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9910, .adv_w = 243, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10060, .adv_w = 284, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 10200, .adv_w = 267, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10336, .adv_w = 257, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10440, .adv_w = 263, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10552, .adv_w = 203, .box_w = 11, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10640, .adv_w = 283, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 10820, .adv_w = 234, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10916, .adv_w = 362, .box_w = 23, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11100, .adv_w = 226, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11204, .adv_w = 290, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11316, .adv_w = 290, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11456, .adv_w = 250, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11568, .adv_w = 278, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11688, .adv_w = 339, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11824, .adv_w = 289, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11936, .adv_w = 298, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12072, .adv_w = 289, .box_w = 14, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12184, .adv_w = 251, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12288, .adv_w = 253, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12408, .adv_w = 212, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12512, .adv_w = 243, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12632, .adv_w = 326, .box_w = 20, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12802, .adv_w = 235, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12922, .adv_w = 292, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 13082, .adv_w = 259, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13186, .adv_w = 385, .box_w = 20, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13346, .adv_w = 394, .box_w = 22, .box_h = 20, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 13566, .adv_w = 291, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13710, .adv_w = 350, .box_w = 18, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13854, .adv_w = 251, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13958, .adv_w = 249, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14078, .adv_w = 387, .box_w = 21, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14246, .adv_w = 257, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14350, .adv_w = 207, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14416, .adv_w = 233, .box_w = 13, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14533, .adv_w = 216, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14599, .adv_w = 172, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14653, .adv_w = 234, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 14758, .adv_w = 221, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14836, .adv_w = 299, .box_w = 19, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14950, .adv_w = 191, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15016, .adv_w = 244, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15088, .adv_w = 244, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15190, .adv_w = 210, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15256, .adv_w = 226, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15334, .adv_w = 281, .box_w = 14, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15418, .adv_w = 240, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15484, .adv_w = 226, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15568, .adv_w = 238, .box_w = 11, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15634, .adv_w = 242, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 15738, .adv_w = 201, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15810, .adv_w = 174, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15876, .adv_w = 201, .box_w = 14, .box_h = 16, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 15988, .adv_w = 283, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 16167, .adv_w = 190, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16239, .adv_w = 243, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 16337, .adv_w = 214, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16409, .adv_w = 331, .box_w = 17, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16511, .adv_w = 331, .box_w = 19, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 16654, .adv_w = 225, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16738, .adv_w = 284, .box_w = 14, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16822, .adv_w = 202, .box_w = 10, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16882, .adv_w = 202, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16954, .adv_w = 308, .box_w = 17, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17056, .adv_w = 215, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17122, .adv_w = 221, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17233, .adv_w = 221, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17337, .adv_w = 238, .box_w = 15, .box_h = 21, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 17495, .adv_w = 172, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17572, .adv_w = 203, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17650, .adv_w = 189, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17716, .adv_w = 100, .box_w = 4, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17750, .adv_w = 98, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17798, .adv_w = 100, .box_w = 8, .box_h = 22, .ofs_x = -3, .ofs_y = -4},
-    {.bitmap_index = 17886, .adv_w = 329, .box_w = 20, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18006, .adv_w = 335, .box_w = 19, .box_h = 12, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18120, .adv_w = 237, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 18248, .adv_w = 210, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18342, .adv_w = 244, .box_w = 12, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18444, .adv_w = 201, .box_w = 14, .box_h = 21, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 18591, .adv_w = 227, .box_w = 11, .box_h = 15, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 18674, .adv_w = 205, .box_w = 11, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18779, .adv_w = 164, .box_w = 9, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18847, .adv_w = 176, .box_w = 11, .box_h = 2, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 18858, .adv_w = 352, .box_w = 22, .box_h = 2, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 18880, .adv_w = 80, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 18891, .adv_w = 80, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 18902, .adv_w = 80, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 18913, .adv_w = 146, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 18941, .adv_w = 146, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 18969, .adv_w = 243, .box_w = 14, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18997, .adv_w = 290, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10
-};
-
-static const uint16_t unicode_list_3[] = {
-    0x0, 0x1, 0x1b83, 0x1b84, 0x1b88, 0x1b89, 0x1b8a, 0x1b8c,
-    0x1b8d, 0x1b96, 0x1c24
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 171, .range_length = 17, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 1024, .range_length = 96, .glyph_id_start = 98,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1168, .range_length = 7205, .glyph_id_start = 194,
-        .unicode_list = unicode_list_3, .glyph_id_ofs_list = NULL, .list_length = 11, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    61, 9, 26, 26, 62, 63, 25, 3,
-    29, 29, 30, 64, 64, 62, 38, 29,
-    65, 29, 23, 66, 24, 63, 67, 26,
-    38, 24, 29, 29, 38, 29, 29, 29,
-    22, 29, 33, 25, 36, 65, 22, 38,
-    67, 29, 29, 67, 64, 29, 64, 22,
-    22, 29, 51, 46, 0, 68, 51, 49,
-    59, 0, 51, 51, 59, 51, 51, 51,
-    46, 51, 46, 47, 68, 58, 46, 59,
-    51, 51, 51, 51, 69, 51, 69, 46,
-    46, 51, 49, 49, 51, 0, 47, 56,
-    51, 51, 51, 69, 69, 45, 59, 51,
-    58, 51, 63, 0, 0, 0, 70, 71,
-    10, 70, 71, 10, 0
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    9, 49, 25, 25, 27, 25, 23, 3,
-    25, 25, 26, 50, 25, 27, 25, 25,
-    30, 25, 24, 25, 25, 25, 50, 25,
-    30, 51, 25, 25, 25, 50, 25, 25,
-    23, 25, 25, 23, 27, 30, 23, 30,
-    25, 52, 25, 25, 27, 25, 25, 51,
-    25, 30, 37, 23, 42, 42, 53, 39,
-    47, 54, 42, 42, 42, 53, 42, 42,
-    39, 42, 42, 39, 55, 46, 39, 47,
-    42, 45, 42, 42, 55, 42, 42, 54,
-    42, 47, 39, 39, 38, 42, 39, 43,
-    42, 42, 56, 53, 42, 57, 42, 42,
-    46, 42, 25, 42, 0, 0, 58, 59,
-    10, 58, 59, 10, 0
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 4, 0, 0, 0,
-    0, 2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 1, 1, 16, 0, 10, -8,
-    0, 0, 0, 0, -19, -21, 2, 17,
-    8, 6, -14, 2, 17, 1, 15, 4,
-    11, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 21, 3, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -11,
-    0, 0, 0, 0, 0, -7, 6, 7,
-    0, 0, -4, 0, -2, 4, 0, -4,
-    0, -4, -2, -7, 0, 0, 0, 0,
-    -4, 0, 0, -5, -5, 0, 0, -4,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, -4, 0, 0, -6,
-    0, -8, 0, -2, -4, 0, 0, -9,
-    -4, 0, -10, 0, -43, 0, 0, -7,
-    0, 7, 11, 0, 0, -7, 4, 4,
-    12, 7, -6, 7, 0, 0, -20, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -13, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, -7, -4, -17, 0, -14,
-    -2, 0, 0, 0, 0, 1, 14, 0,
-    -11, -3, -1, 1, 0, -6, 0, 0,
-    -2, -26, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -28, -3, 13,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -11, -9, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 12, 0, 4, 0, 0, -7, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    13, 3, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -13, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -12, 0, 0,
-    0, 0, 0, 0, 0, 2, 7, 4,
-    11, -4, 0, 0, 7, -4, -12, -48,
-    2, 10, 7, 1, -5, 0, 13, 0,
-    11, 0, 11, 0, -33, 0, -4, 11,
-    0, 12, -4, 7, 4, 0, 0, 1,
-    -4, 0, 0, -6, 28, 0, 28, 0,
-    11, 0, 15, 5, 6, 5, 0, 0,
-    0, 0, 0, 0, 0, 0, 11, 11,
-    0, 0, 0, -13, 0, 0, 0, 0,
-    1, -2, 0, 2, -6, -5, -7, 2,
-    0, -4, 0, 0, 0, -14, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -23, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 1, -19, 0, -22, 0,
-    0, 0, 0, -2, 0, 35, -4, -5,
-    4, 4, -3, 0, -5, 4, 0, 0,
-    -19, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -34, 0, 4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 1, 0, 0, 0, 0,
-    0, 0, 0, 0, -6, -6, 0, 21,
-    0, 0, -13, 0, 12, 0, -24, -34,
-    -24, -7, 11, 0, 0, -24, 0, 4,
-    -8, 0, -5, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 9,
-    11, -43, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -17, 0,
-    0, 0, 0, 0, 0, 0, 0, 17,
-    18, 0, 2, 0, 0, 0, 0, 0,
-    2, 2, -4, -7, 0, -1, -1, -4,
-    0, 0, -2, 0, 0, 0, -7, 0,
-    -3, 0, -8, -7, 0, -9, -12, -12,
-    -7, 0, -7, 0, -7, 0, 0, 0,
-    0, -3, 0, 0, 4, 0, 2, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, 0, 0, 4,
-    -2, 0, 0, 0, -2, 4, 4, -1,
-    0, 0, 0, -7, 0, -1, 0, 0,
-    0, 0, 0, 1, 0, 5, -2, 0,
-    -4, 0, -6, 0, 0, -2, 0, 11,
-    0, 0, -4, 0, 0, 0, 0, 0,
-    -1, 1, -2, -2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, -4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, -2, 0, -4,
-    -4, 0, 0, 0, 0, 0, 1, 0,
-    0, -2, 0, -4, -4, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    0, 0, 0, 0, -2, -5, 0, 0,
-    0, 0, 0, 0, 0, 0, -2, 0,
-    0, 0, 0, -11, -2, -11, 7, 0,
-    0, -7, 4, 7, 10, 0, -9, -1,
-    -4, 0, -1, -17, 4, -2, 2, -19,
-    4, 0, 0, 1, -18, 0, -19, -3,
-    -31, -2, 0, -18, 0, 7, 10, 0,
-    5, 0, 0, 0, 0, 1, 0, -6,
-    -5, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -8, -4, 0, 0, 0,
-    -4, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, -2, -2, 0, -2, -5, 0,
-    0, 0, 0, 0, 0, 0, -4, -4,
-    0, -2, -4, -3, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -3, -3, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -2, 0, -7, 4, 0, 0, -4,
-    2, 4, 4, 0, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, 0, 0, 2,
-    0, 0, -4, 0, -4, -2, -4, 0,
-    0, 0, 0, 0, 0, 0, 3, 0,
-    -3, 0, 0, 0, 0, -4, -5, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    0, -4, 0, 0, 11, -2, 1, -11,
-    0, 0, 10, -18, -18, -15, -7, 4,
-    0, -3, -23, -6, 0, -6, 0, -7,
-    5, -6, -23, 0, -10, 0, 0, 2,
-    -1, 3, -2, 0, 4, 0, -11, -13,
-    0, -18, -8, -7, -8, -11, -4, -10,
-    -1, -7, -10, -6, 0, 0, 0, 0,
-    0, 0, -7, 0, 4, 7, 0, 1,
-    0, -4, 0, 0, 0, 2, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, 0, -2, 0, -1,
-    -4, 0, -6, -8, -8, -1, 0, -11,
-    0, 0, 0, 0, 0, 0, -3, 0,
-    0, 0, 0, 1, -2, 0, 0, 0,
-    0, 0, 0, 0, 0, -3, 0, -2,
-    0, 0, 4, 0, 0, 0, 0, 0,
-    0, 0, 0, 17, 0, 0, 0, 0,
-    0, 0, 2, 0, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -6, 0, 4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    -7, 0, 0, 0, 0, -18, -11, 0,
-    0, 0, -5, -18, 0, 0, -4, 4,
-    0, -10, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -6, 0, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 4, 0, 0, 0,
-    0, 0, 0, 0, 0, 8, 8, 0,
-    -6, 0, 0, 0, 0, 4, 0, 2,
-    -7, -7, 0, -4, -4, -4, 0, 0,
-    0, 0, 0, 0, -11, 0, -4, 0,
-    -5, -4, 0, -8, -9, -11, -3, 0,
-    -7, 0, -11, 0, 0, 0, 0, 28,
-    0, 0, 2, 0, 0, -5, 0, 0,
-    -7, -7, -5, -6, -6, -4, 28, 0,
-    -4, -5, 0, -15, 0, 0, 0, 0,
-    0, -33, -6, 12, 11, -3, -15, 0,
-    4, -5, 0, -18, -2, -5, 4, -25,
-    -4, 5, 0, 5, -12, -5, -13, -12,
-    -15, 0, 0, -21, 0, 20, 0, 0,
-    -2, 0, 0, 0, -2, -2, -4, -10,
-    -12, -1, 4, 1, 0, -17, 1, 0,
-    -16, 0, 0, -12, -12, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, -2, -4, -5, 0, 0, -7, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, -1,
-    0, 0, -1, 0, -7, 0, 0, 7,
-    -1, 5, 0, -8, 4, -2, -1, -9,
-    -4, 0, -5, -4, -2, 0, -5, -6,
-    0, 0, -3, -1, -2, -6, -4, 0,
-    0, -4, 0, 4, -2, 0, -8, 0,
-    0, 0, -7, 0, -6, 0, -6, -6,
-    -1, -6, 0, -3, -8, -4, -5, 0,
-    0, 1, 5, 0, 0, 0, 0, 0,
-    0, 0, 0, -7, 4, 0, -5, 0,
-    -2, -4, -11, -2, -2, -2, -1, -2,
-    -4, -1, 0, 0, 0, 0, 0, -4,
-    -3, -3, 0, 0, 0, 0, 4, -2,
-    0, -2, 0, 0, 0, -2, -4, -2,
-    -3, -4, -3, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 3, 14,
-    -1, 0, -10, 0, -2, 7, 0, -4,
-    -15, -5, 5, 0, 0, -17, -6, 4,
-    -6, 2, 0, -2, -3, -11, 0, -5,
-    2, 0, 0, -6, 0, 0, 0, 4,
-    4, -7, -7, 0, -6, -4, -5, -4,
-    -4, 0, -6, 2, -7, -6, -5, -14,
-    -4, -4, -13, -8, -4, -5, 0, 6,
-    10, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -6, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -3, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, 0,
-    0, -5, 0, 0, -4, -4, 0, 0,
-    0, 0, -4, 0, 0, 0, 0, -2,
-    0, 0, 0, 0, 0, -2, 0, 0,
-    -8, 0, -8, -5, -5, -5, -2, 0,
-    0, 0, 0, 0, -5, 0, -7, 0,
-    0, 0, -12, 0, 2, -8, 7, 1,
-    -2, -17, 0, 0, -8, -4, 0, -14,
-    -9, -10, 0, 0, -15, -4, -14, -13,
-    -17, 0, -9, 0, 3, 24, -5, 0,
-    -8, -4, -1, -4, -6, -10, -6, -13,
-    -14, -8, -1, -1, -8, -10, 0, -9,
-    -15, -1, 0, -6, 0, 0, 0, -2,
-    0, 1, 0, 0, -25, -3, 11, 8,
-    -8, -13, 0, 1, -11, 0, -18, -2,
-    -4, 7, -32, -5, 1, 0, 0, -23,
-    -4, -18, -4, -26, 0, 0, -25, 0,
-    21, 1, 0, -2, 0, 0, 0, 0,
-    -2, -2, -13, -2, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, -15, -17,
-    0, 0, 0, 0, -11, 0, -3, 0,
-    -1, -10, -17, 0, 0, -2, -5, -11,
-    -4, 0, -2, 0, 0, 0, 0, -16,
-    -4, -12, -11, -3, -6, -9, -4, -6,
-    0, -7, -3, -12, -5, 0, -4, -7,
-    -4, -7, 0, 2, 0, -2, -12, 0,
-    0, -13, -6, -6, -15, -7, -3, -4,
-    0, 0, 4, 0, -6, 0, 0, 0,
-    0, 4, 0, 2, -7, 14, 0, -4,
-    -4, -4, 0, 0, 0, 0, 0, 0,
-    -11, 0, -4, 0, -5, -4, 0, -8,
-    -9, -11, -3, 0, -7, 3, 14, 0,
-    0, 0, 0, 28, 0, 0, 2, 0,
-    0, -5, 0, 0, -7, -7, -5, -6,
-    -6, -4, 28, 0, -4, -5, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, -2, -7, 0, 0,
-    0, 0, 0, -2, 0, 0, 0, -4,
-    -4, 0, 0, -7, -4, 0, 0, -7,
-    0, 6, -2, 0, 0, 0, 0, 0,
-    0, 2, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 2,
-    0, 7, 3, -3, 0, -11, -6, 0,
-    11, -12, -11, -7, -7, 14, 6, 4,
-    -31, -2, 7, -4, 0, -4, 4, -4,
-    -12, 0, -4, 4, -5, -3, -11, -3,
-    0, 0, 11, 7, 0, -10, 0, -19,
-    -5, 10, -5, -13, 1, -5, -12, -12,
-    -4, -5, -13, 0, -4, -24, -15, -7,
-    10, 15, 10, 10, 4, 0, -5, 0,
-    -10, 0, 3, 12, -8, -13, -14, -9,
-    11, 0, 1, -26, -3, 4, -6, -2,
-    -8, 0, -8, -13, -5, -5, -3, 0,
-    0, -8, -7, -4, 0, 11, 8, -4,
-    -19, 0, -19, -5, 0, -12, -20, -1,
-    -11, -6, -12, -10, -5, -8, -2, 0,
-    -13, -17, -7, -7, 9, 7, 11, 0,
-    0, -5, 0, -7, -3, 0, -4, -6,
-    0, 6, -12, 4, 0, 0, -19, 0,
-    -4, -8, -6, -2, -11, -9, -12, -8,
-    0, -11, -4, -8, -7, -11, -4, 0,
-    0, 1, 17, -6, 0, -11, -4, 0,
-    -4, -7, -8, -10, -10, -13, -5, -3,
-    -3, -18, -13, -4, -13, -19, 0, 0,
-    0, 2, 7, 0, -5, 0, -18, -4,
-    2, 7, -11, -13, -7, -12, 12, -4,
-    2, -33, -6, 7, -8, -6, -13, 0,
-    -11, -15, -4, -4, -3, -4, -7, -11,
-    -1, 0, 0, 11, 10, -2, -23, 0,
-    -21, -8, 8, -13, -24, -7, -12, -15,
-    -18, -12, -6, -11, 0, -4, -20, -19,
-    -8, 8, 7, 4, 10, 0, 0, 0,
-    0, -4, 0, 0, 4, -4, 7, 2,
-    -7, 7, 0, 0, -11, -1, 0, -1,
-    0, 1, 1, -3, 0, 0, 0, 0,
-    0, 0, -4, 0, 0, 0, 0, 3,
-    11, 1, 0, -4, 0, 0, 0, 0,
-    -2, -2, -4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1, 3, 0, 0, 0, 0, 3, 0,
-    -3, 0, 13, 0, 6, 1, 1, -5,
-    0, 7, 0, 0, 0, 3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 11, 0, 10, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -21, 0, -4, 6,
-    0, 11, 0, 0, 35, 4, -7, -7,
-    4, 4, -2, 1, -18, 0, 0, 17,
-    -21, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -24, 13, 49, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 3, 0, 0, 0, 0,
-    0, 0, 0, 0, -18, -18, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -6, 0, 0, -7, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    -4, -5, -5, -3, 0, 0, 0, 0,
-    0, 0, -2, 0, -10, 0, 0, 1,
-    0, 0, 4, 45, -7, -3, 11, 10,
-    -10, 4, 0, 0, 4, 4, -5, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -46, 10, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -10,
-    0, 0, 0, -10, 0, 0, 0, 0,
-    -8, -2, 0, 0, 0, -8, 0, -4,
-    0, -17, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -24, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, -4, 0, 0, 0, 0, 0, -18,
-    0, 0, -5, 0, 0, -4, -2, 0,
-    -5, 0, -10, 0, 0, 0, -6, 4,
-    -4, 0, 0, -10, -4, -8, 0, 0,
-    -10, 0, -4, 0, -17, 0, -4, 0,
-    0, -29, -7, -14, -4, -13, 0, 0,
-    -24, 0, -10, -2, 0, 0, 0, 0,
-    0, 0, 0, 0, -5, -6, -3, 0,
-    -2, -8, -10, -1, -2, -7, 0, 0,
-    -4, -1, 0, 0, 0, 0, -8, 0,
-    -8, 5, -4, 7, 0, -2, -8, -2,
-    -6, -7, 0, -4, -2, -2, 2, -10,
-    -1, 0, 0, 0, -31, -3, -5, 0,
-    -8, 0, -2, -17, -3, 0, 0, -2,
-    -3, 0, 0, 0, 0, 2, 0, -2,
-    -6, -2, 0, 0, 0, -1, -6, -6,
-    -2, 0, 0, 6, 8, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    5, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -8, 0, -2, 0, 0, 0, -7,
-    4, 0, 0, 0, -10, -4, -7, 0,
-    0, -10, 0, -4, 0, -17, 0, 0,
-    0, 0, -34, 0, -7, -13, -18, 0,
-    0, -24, 0, -2, -5, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, -5, -2,
-    0, -6, 0, -8, -3, -4, -8, 0,
-    0, -4, -1, 1, 0, 0, 6, -5,
-    0, 11, 17, -4, -4, -11, 4, 17,
-    6, 8, -10, 4, 15, 4, 10, 8,
-    10, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 22, 17, -6, -4,
-    0, -3, 28, 15, 28, 0, 0, 0,
-    4, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 15, 0, 17, 25, 0, 0,
-    -6, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, 0, 0, 0, 0,
-    0, 0, 0, 5, 0, 0, 0, 0,
-    -30, -4, -3, -14, -17, 0, 0, -24,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -7, -15, 0, -3, 0, 0, 0, 0,
-    0, 0, 0, -6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 5, 0,
-    0, 0, 0, -30, -4, -3, -14, -17,
-    0, 0, -14, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -7, -15, 0, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -3, 0, 0, 0, -8, 4, 0, -4,
-    3, 6, 4, -11, 0, -1, -3, 4,
-    0, 3, 0, 0, 0, 0, -9, 0,
-    -3, -2, -7, 0, -3, -14, 0, 22,
-    -4, 0, -8, -2, 0, -2, -6, 0,
-    -4, -10, -7, -4, 0, 1, 0, -6,
-    2, -8, 0, 0, 0, 1, 0, 0,
-    0, -6, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -2, 0, 0, 0, 0,
-    0, 0, 0, 0, 5, 0, 0, 0,
-    0, -30, -4, -3, -14, -17, 0, 0,
-    -24, 0, 0, 0, 0, 0, 0, 18,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -7, -15, 0, -3, 0, 0, 0,
-    0, 0, 0, 0, -6, 0, -11, -4,
-    -3, 11, -3, -4, -14, 1, -2, 1,
-    -2, -10, 1, 8, 1, 3, 1, 3,
-    -8, -14, -4, 0, -13, -7, -10, -15,
-    -14, 0, -6, -7, -4, -5, -3, -2,
-    -4, -2, 0, -2, -1, 5, 0, 5,
-    -2, 0, 1, -14, -7, -6, -13, -8,
-    0, 0, 0, 12, 12, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -2, -4, -4, 0, 0, -10, 0,
-    -2, 0, -6, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -21, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -4, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, -6,
-    -4, 4, 0, -6, -7, -2, 0, -10,
-    -2, -8, -2, -4, 0, -6, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -24, 0, 11, 0, 0, -6, 0,
-    0, 0, 0, -5, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -2, 0, 0, 0, -2, 0, -8,
-    0, 0, 15, -5, -12, -11, 2, 4,
-    4, -1, -10, 2, 5, 2, 11, 2,
-    12, -2, -10, 0, 0, -14, 0, 0,
-    -11, -10, 0, 0, -7, 0, -5, -6,
-    0, -5, 0, -5, 0, -2, 5, 0,
-    -3, -11, -4, 0, -9, 0, -4, -10,
-    -5, 1, -5, 0, 12, 6, 0, 0,
-    -3, 0, -7, 0, 0, 5, -8, 0,
-    4, -4, 3, 0, 0, -12, 0, -2,
-    -1, 0, -4, 4, -3, 0, 0, 0,
-    -14, -4, -8, 0, -11, 0, 0, -17,
-    0, 13, -4, 0, -6, 0, 2, 0,
-    -4, 0, -4, -11, 0, -4, 0, 0,
-    -3, -8, 0, -10, -3, 2, 0, 0,
-    0, 0, 0, 0, 0, -2, 0, 0,
-    4, -5, 1, 0, 0, -4, -2, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -22, 0, 8, 0, 0, -3,
-    0, 0, 0, 0, 1, 0, -4, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -4, 1, 3, 0,
-    -1, 0, 0, 2, 2, 0, 0, 0,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -20, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -13, -3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -14, -7, 0, 0,
-    0, -22, -14, -12, -9, -17, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -8, 0, 0, 0,
-    0, 0, -8, -3, 0, -6, 0, 0,
-    -15, -15, 0, 0, 0, 0, 0, 0,
-    0, 0, -71, -64, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -31, -47, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -2,
-    -52, -36, 0, -36, 0, 0, 0, -36,
-    -36, 0, 0, -31, 0, -7, -55, -47,
-    -33, 0, 0, 0, 0, 0, -10, -6,
-    0, 0, 0, -4, 0, 0, -8, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -13, 0, -3, 0, -1, -24,
-    0, -12, -15, -15, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, -6, 0, 0, -8, -7,
-    -4, -5, -5, -8, 0, 0, -8, -10,
-    4, 0, -5, 0, -10, 0, 3, 12,
-    -8, -13, -14, -9, 11, 0, 1, -26,
-    -3, 4, -6, -2, -8, 0, -8, -13,
-    -5, -5, -3, 0, 0, -8, -7, -4,
-    0, 11, 8, -4, -19, 0, -19, -12,
-    -7, -12, -20, -1, -11, -6, -12, -10,
-    -5, -8, -2, 0, -13, -17, -7, -7,
-    9, 7, 11, -2, -7, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -7, 0, -1, 0, 0, -14, -4, -12,
-    -8, -12, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -5, -8, 0, 0, -6, 0, -10, -5,
-    -6, -10, 0, 0, -8, -8, 0, -7,
-    0, 0, 0, 0, 0, 0, -8, 2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -17, 0, 1, 0, 0,
-    -9, 0, -9, 0, -11, 0, 0, 0,
-    2, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, -12, -7, 0, 0, 0,
-    0, -8, 0, -6, -12, 0, 0, -7,
-    -7, 0, 0, 0, 0, 0, 0, -3,
-    0, -7, -17, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -14, 0, 0, 0, 0, -3, -13, -8,
-    0, 0, 0, 0, 0, 0, 0, -8,
-    0, 0, 0, 0, 0, 0, 1, -3,
-    0, 0, -15, -1, -4, -12, -4, 4,
-    0, 0, 0, 6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -15, 0, 0, 0, 0, -39, 0,
-    -13, -11, -12, 0, 0, 0, -6, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -12, -13, 0, 0, -4, 0, -25,
-    -6, -3, -18, 0, 0, -17, -15, 1,
-    0, 0, 14, -4, 0, 0, 0, 0,
-    -6, -18, 0, 13, 4, 7, -13, 0,
-    15, -2, 11, 0, 13, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    18, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    10, 10, 1, 0, 0, 14, -4, 0,
-    0, 0, 0, -6, -18, 0, 17, 7,
-    6, -20, 0, 10, 0, 4, 0, 13,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 18, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 10, 10
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 71,
-    .right_class_cnt     = 59,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 4,
-    .bpp = 4,
-    .kern_classes = 1,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t montserrat_cyrillic_medium_22 = {
-#else
-lv_font_t montserrat_cyrillic_medium_22 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 24,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = NULL,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if MONTSERRAT_CYRILLIC_MEDIUM_22*/
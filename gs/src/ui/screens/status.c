@@ -280,6 +280,9 @@ void screen_status_hide(void)
 
 void screen_status_update(enum status_bar_element_e element, int value)
 {
+    if (!g_status_bar)
+        return;
+
     switch (element) {
     case STATUS_ELEMENT_LEFT:
         lv_label_set_text_fmt(g_status_label_left, "%s: %d%%", LV_SYMBOL_BATTERY_FULL, value);
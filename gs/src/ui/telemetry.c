@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "telemetry.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+
+/* Shortest time between two label updates of a field */
+static const uint32_t throttle_ms[TELEM_COUNT] = {
+    [TELEM_VIDEO_FPS]   = 500,
+    [TELEM_SERVER_PING] = 500,
+    [TELEM_LINK_RSSI]   = 250,
+};
+
+/*
+ * The value is stored before its bit is set (release), the taker clears the bits (acquire) before
+ * loading the values: it sees at least the value that set the bit, a newer one sets it again.
+ */
+static _Atomic int32_t latest[TELEM_COUNT];
+static atomic_uint changed;
+
+/* UI thread */
+static uint32_t pending;                // changed, not taken yet
+static uint32_t taken;                  // fields taken at least once
+static int32_t taken_value[TELEM_COUNT];
+static uint32_t taken_ms[TELEM_COUNT];
+
+void telem_set(telem_field_t field, int32_t value)
+{
+    if ((unsigned)field >= TELEM_COUNT)
+        return;
+    atomic_store_explicit(&latest[field], value, memory_order_relaxed);
+    atomic_fetch_or_explicit(&changed, 1u << field, memory_order_release);
+}
+
+int32_t telem_get(telem_field_t field)
+{
+    if ((unsigned)field >= TELEM_COUNT)
+        return 0;
+    return atomic_load_explicit(&latest[field], memory_order_relaxed);
+}
+
+uint32_t telem_take(uint32_t now_ms, int32_t values[TELEM_COUNT], uint32_t *wait_ms)
+{
+    pending |= atomic_exchange_explicit(&changed, 0, memory_order_acquire);
+
+    uint32_t due = 0, wait = TELEM_NOT_DUE;
+    for (int f = 0; f < TELEM_COUNT; f++) {
+        uint32_t bit = 1u << f;
+        if (!(pending & bit))
+            continue;
+        int32_t value = atomic_load_explicit(&latest[f], memory_order_relaxed);
+        bool seen = taken & bit;
+        if (seen && value == taken_value[f]) {
+            pending &= ~bit;
+            continue;
+        }
+        uint32_t since = now_ms - taken_ms[f];
+        if (seen && since < throttle_ms[f]) {
+            if (throttle_ms[f] - since < wait)
+                wait = throttle_ms[f] - since;
+            continue;
+        }
+        pending &= ~bit;
+        taken |= bit;
+        taken_value[f] = value;
+        taken_ms[f] = now_ms;
+        values[f] = value;
+        due |= bit;
+    }
+    if (wait_ms)
+        *wait_ms = wait;
+    return due;
+}
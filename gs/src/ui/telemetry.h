@@ -0,0 +1,37 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_TELEMETRY_H
+#define VD_LINK_TELEMETRY_H
+#include <stdint.h>
+
+/*
+ * Mailbox of the values other threads (decoder, RTP, WFB link) show in the UI.
+ * Producers store without locking, at any rate; the LVGL thread takes the fields that changed once
+ * per pass and updates only their labels, each field at most once per its throttle interval.
+ */
+typedef enum {
+    TELEM_VIDEO_FPS = 0,        // decoded frames per second
+    TELEM_SERVER_PING,          // ms
+    TELEM_LINK_RSSI,            // dBm, first antenna of the WFB video link
+    TELEM_COUNT
+} telem_field_t;
+
+#define TELEM_NOT_DUE   UINT32_MAX
+
+/* Any thread, lock-free */
+void telem_set(telem_field_t field, int32_t value);
+
+/* The latest value set, any thread */
+int32_t telem_get(telem_field_t field);
+
+/**
+ * UI thread only. The fields changed since they were last taken and due at now_ms, as a bit mask
+ * (1 << field), their values go to values. A change back to the value taken last is dropped, one
+ * inside the throttle interval is kept: *wait_ms is how long until the first of those is due,
+ * TELEM_NOT_DUE when there are none.
+ */
+uint32_t telem_take(uint32_t now_ms, int32_t values[TELEM_COUNT], uint32_t *wait_ms);
+
+#endif //VD_LINK_TELEMETRY_H
@@ -6,11 +6,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdatomic.h>
+#include <errno.h>
 #include <time.h>
 #include "ui.h"
+#include "blend.h"
+#include "compositor.h"
+#include "telemetry.h"
+#include "ui_font.h"
 #include "msp-osd.h"
 #include "lang/lang.h"
 #include "lvgl/lvgl.h"
+#include "trace.h"
 
 #ifdef PLATFORM_DESKTOP
 #include "sdl2_display.h"
@@ -29,84 +35,173 @@
 #include "screens/screens.h"
 #include "lvgl/src/display/lv_display_private.h"
 
-static void *lvgl_buf1 = NULL;
-static void *lvgl_buf2 = NULL;
 static lv_display_t *disp = NULL;
 static pthread_t tick_tid;
 static volatile bool tick_running = false;
 static void *fb_addr = NULL;
 static pthread_mutex_t lvgl_mutex = PTHREAD_MUTEX_INITIALIZER;
-static float fps = 0;
+static float fps = 0;                   // telemetry shown, LVGL thread
 static uint32_t server_ping = 0;
+static bool osd_composed = false;       // the MSP OSD was in the last composed frame
+static bool frame_pushed = false;       // LVGL flushed a frame in this tick thread pass
 
-#ifdef PLATFORM_DESKTOP
-static void blend_rgba8888_src_over(const uint32_t *src, uint32_t *dst, int width, int height)
-{
-    int count = width * height;
-
-    for (int i = 0; i < count; ++i) {
-        uint32_t s = src[i];
-        uint32_t d = dst[i];
-
-        uint8_t sa = (uint8_t)(s >> 24);
-        if (sa == 0) {
-            // fully transparent src -> keep dst
-            continue;
-        } else if (sa == 255) {
-            // fully opaque src -> just replace
-            dst[i] = s;
-            continue;
-        }
-
-        uint8_t sr = (uint8_t)(s >> 16);
-        uint8_t sg = (uint8_t)(s >> 8);
-        uint8_t sb = (uint8_t)(s >> 0);
+#define UI_IDLE_MAX_MS  1000            // longest tick thread sleep when no LVGL timer is due
 
-        uint8_t da = (uint8_t)(d >> 24);
-        uint8_t dr = (uint8_t)(d >> 16);
-        uint8_t dg = (uint8_t)(d >> 8);
-        uint8_t db = (uint8_t)(d >> 0);
+/* ui_wakeup() to the tick thread, the condvar runs on CLOCK_MONOTONIC */
+static pthread_mutex_t wake_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake_cond;
+static bool wake_pending = false;
 
-        uint8_t inv_sa = (uint8_t)(255 - sa);
+#ifdef PLATFORM_ROCKCHIP
+/*
+ * MSP OSD drawn at display size and orientation (msp_osd_set_surface): the LVGL layer is scaled and
+ * rotated into it once per LVGL flush, the OSD frame goes to the display as is.
+ * NULL when the OSD surface is the LVGL size, then the OSD is blended into the LVGL frame.
+ */
+static void *surface_buf = NULL;
+static int surface_width, surface_height, surface_rotate;
+static im_rect surface_ui_rect;     // where the LVGL layer lands, aspect kept, centered
 
-        // Straight alpha SRC_OVER: out = src + dst * (1 - alpha_src)
-        uint8_t out_r = (uint8_t)((sr * sa + dr * inv_sa + 127) / 255);
-        uint8_t out_g = (uint8_t)((sg * sa + dg * inv_sa + 127) / 255);
-        uint8_t out_b = (uint8_t)((sb * sa + db * inv_sa + 127) / 255);
-        uint8_t out_a = (uint8_t)((sa + (da * inv_sa + 127) / 255));
+/* ARGB copy of the 8-bit indexed MSP OSD for RGA, only the regions that changed are expanded */
+static uint32_t *osd_argb = NULL;
 
-        dst[i] = ((uint32_t)out_a << 24) | ((uint32_t)out_r << 16) | ((uint32_t)out_g << 8) | ((uint32_t)out_b << 0);
+static void *osd_frame_argb(void)
+{
+    void *osd_buf = msp_osd_get_fb_addr();
+    const uint32_t *palette;
+    if (osd_buf || !msp_osd_get_indexed_fb(&palette))
+        return osd_buf;
+
+    struct osd_rect_t rects[MSP_OSD_MAX_DIRTY_RECTS];
+    int n;
+    if (!osd_argb) {
+        osd_argb = malloc((size_t)surface_width * surface_height * sizeof(uint32_t));
+        if (!osd_argb) {
+            printf("[ UI ] Failed to allocate OSD expansion buffer\n");
+            return NULL;
+        }
+        msp_osd_take_dirty_rects(NULL, 0);
+        rects[0] = (struct osd_rect_t){ 0, 0, surface_width, surface_height };
+        n = 1;
+    } else {
+        n = msp_osd_take_dirty_rects(rects, MSP_OSD_MAX_DIRTY_RECTS);
     }
+    for (int i = 0; i < n; i++)
+        msp_osd_expand_indexed(osd_argb, &rects[i]);
+    return osd_argb;
 }
 #endif
 
 
-static void *tick_thread(void *arg)
+/*
+ * LVGL renders in direct mode into fb_addr, ARGB8888 is BGRA in memory already: only the area it
+ * redrew is touched. Almost transparent pixels are cleared there and the area goes to the compositor.
+ */
+static void ui_damage_area(const lv_area_t *area)
 {
-    (void)arg;
-    printf("[ UI ] Tick thread started\n");
-    struct timespec prev, now;
-    clock_gettime(CLOCK_MONOTONIC, &prev);
+    struct osd_rect_t r;
+    r.x = area->x1 < 0 ? 0 : area->x1;
+    r.y = area->y1 < 0 ? 0 : area->y1;
+    r.w = (area->x2 >= LVGL_BUFF_WIDTH ? LVGL_BUFF_WIDTH - 1 : area->x2) - r.x + 1;
+    r.h = (area->y2 >= LVGL_BUFF_HEIGHT ? LVGL_BUFF_HEIGHT - 1 : area->y2) - r.y + 1;
+    if (r.w <= 0 || r.h <= 0)
+        return;
 
-    while (tick_running) {
-        clock_gettime(CLOCK_MONOTONIC, &now);
-        pthread_mutex_lock(&lvgl_mutex);
-        int ms = (int)(now.tv_sec - prev.tv_sec) * 1000 + (now.tv_nsec - prev.tv_nsec) / 1000000;
-        if (ms > 0) {
-            lv_tick_inc(ms);
-            prev = now;
+    for (int32_t y = r.y; y < r.y + r.h; y++) {
+        uint32_t *px = (uint32_t *)fb_addr + (size_t)y * LVGL_BUFF_WIDTH + r.x;
+        for (int32_t x = 0; x < r.w; x++) {
+            if ((px[x] >> 24) < 32)
+                px[x] &= 0x00FFFFFF;
         }
-        lv_timer_handler();
-        pthread_mutex_unlock(&lvgl_mutex);
-        usleep(1000);
     }
+    comp_damage(COMP_LAYER_UI, &r);
+}
 
-    printf("[ UI ] Tick thread exiting\n");
-    return NULL;
+/*
+ * MSP OSD over the LVGL layer on the tiles either changed, only those go to the display.
+ * Returns true when drm_osd_frame_done_cb() follows once the frame is shown.
+ */
+static bool ui_compose_and_push(void)
+{
+    struct comp_layers_t layers = { .ui = (const uint32_t *)fb_addr };
+    layers.osd_indexed = msp_osd_get_indexed_fb(&layers.palette);
+    if (!layers.osd_indexed)
+        layers.osd = msp_osd_get_fb_addr();
+
+    bool has_osd = layers.osd || layers.osd_indexed;
+    if (has_osd != osd_composed) {
+        // the OSD started or stopped
+        osd_composed = has_osd;
+        msp_osd_take_dirty_rects(NULL, 0);
+        comp_damage_all();
+    } else if (has_osd) {
+        struct osd_rect_t rects[MSP_OSD_MAX_DIRTY_RECTS];
+        int n = msp_osd_take_dirty_rects(rects, MSP_OSD_MAX_DIRTY_RECTS);
+        for (int i = 0; i < n; i++)
+            comp_damage(COMP_LAYER_OSD, &rects[i]);
+    }
+
+    struct osd_rect_t damage[COMP_MAX_DAMAGE];
+    int n = comp_compose(&layers, damage, COMP_MAX_DAMAGE);
+    if (n == 0)
+        return false;   // nothing changed on screen
+#ifdef PLATFORM_ROCKCHIP
+    drm_push_new_osd_frame_damage(comp_frame(), LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT, damage, n);
+    return true;
+#endif
+#ifdef PLATFORM_DESKTOP
+    sdl2_push_new_osd_frame_damage(comp_frame(), LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT, damage, n);
+    return false;       // shown synchronously
+#endif
+}
+
+/*
+ * The frame to the display: through the OSD surface when there is one, else the compositor.
+ * The frame is copied out before it returns. Returns true when drm_osd_frame_done_cb() follows.
+ */
+static bool ui_push_frame(void)
+{
+#ifdef PLATFORM_ROCKCHIP
+    if (surface_buf) {
+        // Scale and rotate the LVGL layer into the OSD surface, then blend the OSD over it
+        void *osd_buf = osd_frame_argb();
+        if (osd_buf == NULL) {
+            // push only LVGL framebuffer if OSD is not available
+            drm_push_new_osd_frame(fb_addr, LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT);
+            return true;
+        }
+        rga_buffer_t ui = wrapbuffer_virtualaddr(fb_addr, LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT, RK_FORMAT_RGBA_8888);
+        rga_buffer_t surface = wrapbuffer_virtualaddr(surface_buf, surface_width, surface_height, RK_FORMAT_RGBA_8888);
+        rga_buffer_t osd = wrapbuffer_virtualaddr(osd_buf, surface_width, surface_height, RK_FORMAT_RGBA_8888);
+        rga_buffer_t pat = {0};
+        im_rect ui_rect = { 0, 0, LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT };
+        im_rect none = {0};
+        int usage = IM_SYNC;
+        if (surface_rotate == 90)
+            usage |= IM_HAL_TRANSFORM_ROT_90;
+        else if (surface_rotate == 180)
+            usage |= IM_HAL_TRANSFORM_ROT_180;
+        else if (surface_rotate == 270)
+            usage |= IM_HAL_TRANSFORM_ROT_270;
+
+        IM_STATUS ret = improcess(ui, surface, pat, ui_rect, surface_ui_rect, none, usage);
+        if (ret == IM_STATUS_SUCCESS)
+            ret = imblend(osd, surface, IM_ALPHA_BLEND_SRC_OVER);
+        if (ret != IM_STATUS_SUCCESS) {
+            fprintf(stderr, "RGA: OSD surface compose failed: %d\n", ret);
+            return false;
+        }
+        drm_push_new_osd_frame_rotated(surface_buf, surface_width, surface_height);
+        return true;
+    }
+#endif
+
+    return ui_compose_and_push();
 }
 
 static void ui_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map_u8)
 {
+    (void)px_map_u8;    // fb_addr, the areas are in place
     if (!tick_running) return;
    //printf("[ UI ] Flush callback called for area: (%d, %d) - (%d, %d)\n", area->x1, area->y1, area->x2, area->y2);
 
@@ -115,94 +210,146 @@ static void ui_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * p
         return;
     }
 
-    const lv_color32_t *px_map = (const lv_color32_t *)px_map_u8;
-    int32_t w = area->x2 - area->x1 + 1;
-    int32_t h = area->y2 - area->y1 + 1;
-
-    uint8_t *fb = (uint8_t *)fb_addr;
-
-    for (int32_t y = 0; y < h; y++) {
-        for (int32_t x = 0; x < w; x++) {
-            lv_color32_t color = px_map[y * w + x];
-
-            int32_t src_x = area->x1 + x;
-            int32_t src_y = area->y1 + y;
+    ui_damage_area(area);
+    if (!lv_display_flush_is_last(disp)) {
+        // more areas of this refresh follow, the frame goes out after the last one
+        lv_display_flush_ready(disp);
+        return;
+    }
+    frame_pushed = true;
+    TRACE_BEGIN(t_flush);
+    if (!ui_push_frame())
+        lv_display_flush_ready(disp);   // no page flip will release LVGL
+    TRACE_END(TRACE_LVGL_FLUSH, t_flush, 0);
+}
 
-            int32_t dst_x = src_x;
-            int32_t dst_y = src_y;
+void drm_osd_frame_done_cb(void)
+{
+#ifdef PLATFORM_ROCKCHIP
+    lv_display_flush_ready(disp);
+#endif
+}
 
+static uint32_t ui_tick_get_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
 
-            if (dst_x >= 0 && dst_x < LVGL_BUFF_WIDTH &&
-                dst_y >= 0 && dst_y < LVGL_BUFF_HEIGHT) {
+static void ui_signal(void)
+{
+    pthread_mutex_lock(&wake_lock);
+    wake_pending = true;
+    pthread_cond_signal(&wake_cond);
+    pthread_mutex_unlock(&wake_lock);
+}
 
-                size_t fb_offset = (dst_y * LVGL_BUFF_WIDTH + dst_x) * 4;
+void ui_wakeup(void)
+{
+    if (tick_running)
+        ui_signal();
+}
 
-                // ARGB8888 → BGRA8888
-                fb[fb_offset + 0] = color.blue;
-                fb[fb_offset + 1] = color.green;
-                fb[fb_offset + 2] = color.red;
-                if (color.alpha < 32) {
-                    fb[fb_offset + 3] = 0;
-                } else {
-                    fb[fb_offset + 3] = color.alpha;
-                }
-            }
-        }
-    }
-#ifdef PLATFORM_ROCKCHIP
-    // Squash OSD framebuffer with LVGL framebuffer
-    void *osd_buf = msp_osd_get_fb_addr();
-    if (osd_buf == NULL) {
-        // push only LVGL framebuffer if OSD is not available
-        drm_push_new_osd_frame(fb_addr, LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT);
-        return;
+/* Sleep up to ms or until ui_wakeup(). Returns true when woken */
+static bool ui_wait(uint32_t ms)
+{
+    struct timespec until;
+    clock_gettime(CLOCK_MONOTONIC, &until);
+    until.tv_sec += ms / 1000;
+    until.tv_nsec += (long)(ms % 1000) * 1000000;
+    if (until.tv_nsec >= 1000000000) {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000;
     }
-    void *dst_buf = fb_addr;
-
-    int width = LVGL_BUFF_WIDTH;
-    int height = LVGL_BUFF_HEIGHT;
 
-    rga_buffer_t src_osd = wrapbuffer_virtualaddr(osd_buf,  width, height, RK_FORMAT_RGBA_8888);
-    rga_buffer_t dst = wrapbuffer_virtualaddr(dst_buf,  width, height, RK_FORMAT_RGBA_8888);
+    pthread_mutex_lock(&wake_lock);
+    while (!wake_pending && tick_running) {
+        if (pthread_cond_timedwait(&wake_cond, &wake_lock, &until) == ETIMEDOUT)
+            break;
+    }
+    bool woken = wake_pending;
+    wake_pending = false;
+    pthread_mutex_unlock(&wake_lock);
+    return woken;
+}
 
-    IM_STATUS ret = imblend(src_osd, dst, IM_ALPHA_BLEND_SRC_OVER);
+/* Telemetry that changed to where it is shown. Returns ms until a throttled change is due */
+static uint32_t ui_take_telemetry(void)
+{
+    int32_t values[TELEM_COUNT];
+    uint32_t wait_ms;
+    uint32_t due = telem_take(lv_tick_get(), values, &wait_ms);
+
+    // the perf label reads these on its next update
+    if (due & (1u << TELEM_VIDEO_FPS))
+        fps = (float)values[TELEM_VIDEO_FPS];
+    if (due & (1u << TELEM_SERVER_PING))
+        server_ping = (uint32_t)values[TELEM_SERVER_PING];
+    if (due & (1u << TELEM_LINK_RSSI))
+        screen_status_update(STATUS_ELEMENT_MID, values[TELEM_LINK_RSSI]);
+    return wait_ms;
+}
 
-    if (ret != IM_STATUS_SUCCESS) {
-        fprintf(stderr, "RGA: imblend failed: %d\n", ret);
-        return;
-    }
+/*
+ * LVGL runs when its next timer is due (lv_timer_handler() says when) or on ui_wakeup(), not on a
+ * fixed tick: with nothing animating the thread sleeps and lvgl_mutex is free.
+ */
+static void *tick_thread(void *arg)
+{
+    (void)arg;
+    printf("[ UI ] Tick thread started\n");
+    TRACE_THREAD("ui");
+    bool woken = false;
 
-    // Push the new squashed frame to DRM
-    drm_push_new_osd_frame(fb_addr, LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT);
-#endif
+    while (tick_running) {
+        pthread_mutex_lock(&lvgl_mutex);
+        frame_pushed = false;
+        uint32_t telem_wait = ui_take_telemetry();
+        TRACE_BEGIN(t_pass);
+        uint32_t next = lv_timer_handler();
+        TRACE_END(TRACE_LVGL_PASS, t_pass, next);
+        if (telem_wait < next)
+            next = telem_wait;
+        if (woken && !frame_pushed && !disp->flushing) {
+            // the OSD changed while LVGL had nothing to redraw: the frame goes out on its own.
+            // It is copied out before the push returns, so LVGL's flush handshake stays out of it
+            TRACE_BEGIN(t_flush);
+            ui_push_frame();
+            TRACE_END(TRACE_LVGL_FLUSH, t_flush, 0);
+        }
+        pthread_mutex_unlock(&lvgl_mutex);
 
-#ifdef PLATFORM_DESKTOP
-    // Squash OSD framebuffer with LVGL framebuffer in software
-    void *osd_buf = msp_osd_get_fb_addr();
-    if (osd_buf == NULL) {
-        // No MSP OSD buff - draw only LVGL framebuffer
-        sdl2_push_new_osd_frame(fb_addr, LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT);
-        return;
+        if (next > UI_IDLE_MAX_MS)
+            next = UI_IDLE_MAX_MS;   // also LV_NO_TIMER_READY
+        woken = ui_wait(next ? next : 1);
     }
 
-    // osd_buf and fb_addr same RGBA8888/BGRA8888 size!!!
-    blend_rgba8888_src_over((const uint32_t *)osd_buf, (uint32_t *)fb_addr,LVGL_BUFF_WIDTH,LVGL_BUFF_HEIGHT);
-    sdl2_push_new_osd_frame(fb_addr, LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT);
-    lv_display_flush_ready(disp); // thread safe call
-#endif
+    printf("[ UI ] Tick thread exiting\n");
+    return NULL;
 }
 
-void drm_osd_frame_done_cb(void)
+#ifdef ENABLE_TRACE
+static void ui_trace_dump_cb(lv_event_t *e)
 {
-#ifdef PLATFORM_ROCKCHIP
-    lv_display_flush_ready(disp);
-#endif
+    (void)e;
+    trace_request_dump();
 }
+#endif
 
 int ui_init(void)
 {
+    blend_init();
+
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&wake_cond, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+
     pthread_mutex_lock(&lvgl_mutex);
     lv_init();
+    lv_tick_set_cb(ui_tick_get_ms);
 
     int width = LVGL_BUFF_WIDTH;
     int height = LVGL_BUFF_HEIGHT;
@@ -215,21 +362,44 @@ int ui_init(void)
 
     disp = lv_display_create(width, height);
 
+    // LVGL draws only the invalidated areas, straight into the UI layer; no buffers of its own
     size_t fb_size = LVGL_BUFF_WIDTH * LVGL_BUFF_HEIGHT * sizeof(lv_color32_t);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+    lv_display_set_buffers(disp, fb_addr, NULL, fb_size, LV_DISPLAY_RENDER_MODE_DIRECT);
 
-    lvgl_buf1 = malloc(fb_size);
-    lvgl_buf2 = malloc(fb_size);
-
-    if (!lvgl_buf1 || !lvgl_buf2) {
-        printf("[ UI ] Failed to allocate LVGL buffers\n");
-        if (lvgl_buf1)
-            free(lvgl_buf1);
-        if (lvgl_buf2)
-            free(lvgl_buf2);
+#ifdef PLATFORM_ROCKCHIP
+    msp_osd_get_surface(&surface_width, &surface_height, &surface_rotate);
+    if (surface_width != LVGL_BUFF_WIDTH || surface_height != LVGL_BUFF_HEIGHT || surface_rotate != 0) {
+        // outside the LVGL layer stays transparent, RGA only writes surface_ui_rect
+        surface_buf = calloc((size_t)surface_width * surface_height, 4);
+        if (!surface_buf) {
+            printf("[ UI ] Failed to allocate OSD surface buffer\n");
+            pthread_mutex_unlock(&lvgl_mutex);
+            return -1;
+        }
+        bool turned = surface_rotate == 90 || surface_rotate == 270;
+        int lw = turned ? surface_height : surface_width;
+        int lh = turned ? surface_width : surface_height;
+        float scale = (float)lw / LVGL_BUFF_WIDTH < (float)lh / LVGL_BUFF_HEIGHT ?
+                      (float)lw / LVGL_BUFF_WIDTH : (float)lh / LVGL_BUFF_HEIGHT;
+        int w = (int)(LVGL_BUFF_WIDTH * scale) & ~1;
+        int h = (int)(LVGL_BUFF_HEIGHT * scale) & ~1;
+        if (turned) {
+            int t = w; w = h; h = t;
+        }
+        surface_ui_rect = (im_rect){ (surface_width - w) / 2, (surface_height - h) / 2, w, h };
+        printf("[ UI ] Composing into %dx%d OSD surface, rotated %d\n", surface_width, surface_height, surface_rotate);
+    }
+    if (!surface_buf && comp_init(LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT) < 0) {
+        pthread_mutex_unlock(&lvgl_mutex);
         return -1;
     }
-
-    lv_display_set_buffers(disp, lvgl_buf1, lvgl_buf2, fb_size, LV_DISPLAY_RENDER_MODE_FULL);
+#else
+    if (comp_init(LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT) < 0) {
+        pthread_mutex_unlock(&lvgl_mutex);
+        return -1;
+    }
+#endif
 
     printf("[ UI ] Initialized LVGL display with size %dx%d\n", LVGL_BUFF_WIDTH, LVGL_BUFF_HEIGHT);
 
@@ -257,11 +427,15 @@ int ui_init(void)
     static lv_style_t style_transp_bg;
     lv_style_init(&style_transp_bg);
     lv_style_set_bg_opa(&style_transp_bg, LV_OPA_TRANSP);
-    lv_display_set_color_format(disp, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
     lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_text_font(lv_scr_act(), &montserrat_cyrillic_medium_20, LV_STYLE_STATE_CMP_SAME);
+    lv_obj_set_style_text_font(lv_scr_act(), ui_font_get("montserrat_cyrillic_medium", 20), LV_STYLE_STATE_CMP_SAME);
     lv_obj_add_style(lv_screen_active(), &style_transp_bg, LV_STYLE_STATE_CMP_SAME);
-    lv_obj_set_style_text_font(disp->perf_label, &montserrat_cyrillic_medium_16, LV_STYLE_STATE_CMP_SAME);
+    lv_obj_set_style_text_font(disp->perf_label, ui_font_get("montserrat_cyrillic_medium", 16), LV_STYLE_STATE_CMP_SAME);
+#ifdef ENABLE_TRACE
+    // a long press on the perf monitor dumps the trace
+    lv_obj_add_flag(disp->perf_label, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(disp->perf_label, ui_trace_dump_cb, LV_EVENT_LONG_PRESSED, NULL);
+#endif
 
     /* Disable scrolling and scrollbars on root screen */
     lv_obj_t *scr = lv_scr_act();
@@ -319,41 +493,49 @@ void ui_deinit(void)
     if (lv_is_initialized()) {
         lv_deinit();
     }
+    ui_font_deinit();
     pthread_mutex_unlock(&lvgl_mutex);
 
     tick_running = false;
+    ui_signal();
     pthread_join(tick_tid, NULL);
     pthread_mutex_destroy(&lvgl_mutex);
-
-    if (lvgl_buf1) {
-        free(lvgl_buf1);
-        lvgl_buf1 = NULL;
-    }
-    if (lvgl_buf2) {
-        free(lvgl_buf2);
-        lvgl_buf2 = NULL;
-    }
+    pthread_cond_destroy(&wake_cond);
 
     if (fb_addr) {
         free(fb_addr);
         fb_addr = NULL;
     }
-
+    comp_deinit();
+#ifdef PLATFORM_ROCKCHIP
+    free(surface_buf);
+    surface_buf = NULL;
+    free(osd_argb);
+    osd_argb = NULL;
+#endif
 }
 
 float ui_get_fps(void)
 {
-    return fps;
+    return (float)telem_get(TELEM_VIDEO_FPS);
 }
 
 void ui_set_fps(float data)
 {
-    fps = data;
+    telem_set(TELEM_VIDEO_FPS, (int32_t)data);
+    ui_wakeup();
 }
 
 void ui_set_server_ping(uint32_t data)
 {
-    server_ping = data;
+    telem_set(TELEM_SERVER_PING, (int32_t)data);
+    ui_wakeup();
+}
+
+void ui_set_link_rssi(int dbm)
+{
+    telem_set(TELEM_LINK_RSSI, dbm);
+    ui_wakeup();
 }
 
 void perf_update_timer_cb(lv_timer_t * t)
@@ -9,30 +9,18 @@
 #define LVGL_BUFF_WIDTH 1280
 #define LVGL_BUFF_HEIGHT 720
 
-LV_FONT_DECLARE(montserrat_cyrillic_14);
-LV_FONT_DECLARE(montserrat_cyrillic_16);
 LV_FONT_DECLARE(montserrat_cyrillic_medium_16);
-LV_FONT_DECLARE(montserrat_cyrillic_18);
-LV_FONT_DECLARE(montserrat_cyrillic_medium_18);
-LV_FONT_DECLARE(montserrat_cyrillic_20);
 LV_FONT_DECLARE(montserrat_cyrillic_medium_20);
-LV_FONT_DECLARE(montserrat_cyrillic_22);
-LV_FONT_DECLARE(montserrat_cyrillic_medium_22);
-LV_FONT_DECLARE(montserrat_cyrillic_24);
-LV_FONT_DECLARE(montserrat_cyrillic_26);
-LV_FONT_DECLARE(montserrat_cyrillic_28);
-LV_FONT_DECLARE(montserrat_cyrillic_30);
-LV_FONT_DECLARE(montserrat_cyrillic_32);
-LV_FONT_DECLARE(montserrat_cyrillic_34);
-LV_FONT_DECLARE(montserrat_cyrillic_36);
-LV_FONT_DECLARE(montserrat_cyrillic_38);
-LV_FONT_DECLARE(montserrat_cyrillic_40);
-LV_FONT_DECLARE(montserrat_cyrillic_42);
-LV_FONT_DECLARE(montserrat_cyrillic_48);
 
 int ui_init(void);
+
+/* Telemetry to show, from any thread without locking: the UI picks it up on its next pass */
 void ui_set_fps(float fps);
 void ui_set_server_ping(uint32_t data);
+void ui_set_link_rssi(int dbm);
 void ui_deinit(void);
 
+/* Run the LVGL thread now: new input or data to show, e.g. an MSP OSD frame. Any thread */
+void ui_wakeup(void);
+
 #endif //UI_H
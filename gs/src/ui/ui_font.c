@@ -0,0 +1,645 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include "ui_font.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ui.h"
+
+#define UI_FONT_CACHE_BUCKETS   512
+
+/* LVGL binary font, as lv_binfont_loader.c reads it: tables of <u32 length>"tag"<data> */
+struct binfont_head_t {
+    uint32_t version;
+    uint16_t tables_count;
+    uint16_t font_size;
+    uint16_t ascent;
+    int16_t descent;
+    uint16_t typo_ascent;
+    int16_t typo_descent;
+    uint16_t typo_line_gap;
+    int16_t min_y;
+    int16_t max_y;
+    uint16_t default_advance_width;
+    uint16_t kerning_scale;
+    uint8_t index_to_loc_format;
+    uint8_t glyph_id_format;
+    uint8_t advance_width_format;
+    uint8_t bits_per_pixel;
+    uint8_t xy_bits;
+    uint8_t wh_bits;
+    uint8_t advance_width_bits;
+    uint8_t compression_id;
+    uint8_t subpixels_mode;
+    uint8_t padding;
+    int16_t underline_position;
+    uint16_t underline_thickness;
+};
+
+struct binfont_cmap_t {
+    uint32_t data_offset;       // from the start of the cmap table
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t data_entries_count;
+    uint8_t format_type;        // lv_font_fmt_txt_cmap_type_t
+    uint8_t padding;
+};
+
+struct glyph_t {
+    uint32_t adv_w;             // 1/16 px
+    int32_t ofs_x, ofs_y;
+    uint32_t box_w, box_h;
+    uint32_t bitmap_bit;        // in the mapping
+};
+
+/* lv_font_t first: the font LVGL gets is the whole struct */
+struct binfont_t {
+    lv_font_t font;
+    char name[48];
+    const uint8_t *map;
+    size_t map_size;
+    struct binfont_head_t head;
+    struct binfont_cmap_t *cmaps;
+    uint32_t cmap_num;
+    uint32_t cmaps_start;
+    uint32_t loca;              // offsets array
+    uint32_t loca_count;
+    uint32_t glyf;              // table start, offsets are from here
+    uint32_t glyf_length;
+    uint8_t kern_format;        // 0 pairs, 3 classes, 0xFF none
+    uint32_t kern;              // first byte after the kern format
+};
+
+struct glyph_entry_t {
+    const struct binfont_t *font;
+    uint32_t gid;
+    lv_draw_buf_t buf;          // A8, what get_glyph_bitmap() returns
+    size_t bytes;
+    int refs;                   // drawn right now, not evicted
+    struct glyph_entry_t *next_hash;
+    struct glyph_entry_t *prev_lru, *next_lru;
+};
+
+/* compiled-in sizes, also the fallback when a binary font is missing */
+static const struct {
+    const char *family;
+    int size;
+    const lv_font_t *font;
+} builtin_fonts[] = {
+    { "montserrat_cyrillic_medium", 16, &montserrat_cyrillic_medium_16 },
+    { "montserrat_cyrillic_medium", 20, &montserrat_cyrillic_medium_20 },
+};
+
+static const char *font_dir = UI_FONT_PATH;
+static struct binfont_t *loaded[UI_FONT_MAX_LOADED];
+static int loaded_count = 0;
+static struct {
+    char family[48];
+    int size;
+    const lv_font_t *font;
+} lookups[UI_FONT_MAX_LOADED * 2];
+static int lookup_count = 0;
+
+static struct glyph_entry_t *buckets[UI_FONT_CACHE_BUCKETS];
+static struct glyph_entry_t *lru_head, *lru_tail;     // most recently used first
+static struct ui_font_stats_t stats;
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;  // the draw thread rasterises
+
+static uint32_t rd16(const uint8_t *p)
+{
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t rd32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t read_bits(const uint8_t *p, uint32_t *bit, int n)
+{
+    uint32_t v = 0;
+    while (n--) {
+        v = (v << 1) | ((p[*bit >> 3] >> (7 - (*bit & 7))) & 1);
+        (*bit)++;
+    }
+    return v;
+}
+
+static int32_t read_bits_signed(const uint8_t *p, uint32_t *bit, int n)
+{
+    uint32_t v = read_bits(p, bit, n);
+    if (n > 0 && (v & (1u << (n - 1))))
+        v |= ~0u << n;
+    return (int32_t)v;
+}
+
+/* Length of the table tag at offset, -1 if it isn't there */
+static int64_t table_at(const struct binfont_t *f, uint32_t offset, const char *tag)
+{
+    if ((uint64_t)offset + 8 > f->map_size || memcmp(f->map + offset + 4, tag, 4) != 0)
+        return -1;
+    uint32_t length = rd32(f->map + offset);
+    if (length < 8 || (uint64_t)offset + length > f->map_size)
+        return -1;
+    return length;
+}
+
+/* ---------------------------------------------------------------- glyph lookup */
+
+static uint32_t glyph_id(const struct binfont_t *f, uint32_t letter)
+{
+    if (letter == '\0')
+        return 0;
+    for (uint32_t i = 0; i < f->cmap_num; i++) {
+        const struct binfont_cmap_t *c = &f->cmaps[i];
+        uint32_t rcp = letter - c->range_start;
+        if (rcp >= c->range_length)
+            continue;
+        const uint8_t *data = f->map + f->cmaps_start + c->data_offset;
+
+        switch (c->format_type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            return c->glyph_id_start + rcp;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+            // offset 0 past the first code point is a missing one
+            if (data[rcp] == 0 && rcp != 0)
+                continue;
+            return c->glyph_id_start + data[rcp];
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+            uint32_t lo = 0, hi = c->data_entries_count;
+            while (lo < hi) {
+                uint32_t mid = (lo + hi) / 2;
+                uint32_t v = rd16(data + mid * 2);
+                if (v == rcp) {
+                    if (c->format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY)
+                        return c->glyph_id_start + mid;
+                    return c->glyph_id_start + rd16(data + c->data_entries_count * 2 + mid * 2);
+                }
+                if (v < rcp)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return 0;
+        }
+        default:
+            return 0;
+        }
+    }
+    return 0;
+}
+
+static bool glyph_read(const struct binfont_t *f, uint32_t gid, struct glyph_t *g)
+{
+    if (gid == 0 || gid >= f->loca_count)
+        return false;
+    const uint8_t *loca = f->map + f->loca;
+    uint32_t start, end;
+    if (f->head.index_to_loc_format == 0) {
+        start = rd16(loca + gid * 2);
+        end = gid + 1 < f->loca_count ? rd16(loca + (gid + 1) * 2) : f->glyf_length;
+    } else {
+        start = rd32(loca + gid * 4);
+        end = gid + 1 < f->loca_count ? rd32(loca + (gid + 1) * 4) : f->glyf_length;
+    }
+    if (start > end || end > f->glyf_length)
+        return false;
+
+    const struct binfont_head_t *h = &f->head;
+    const uint8_t *p = f->map + f->glyf;
+    uint32_t bit = start * 8;
+    g->adv_w = h->advance_width_bits ? read_bits(p, &bit, h->advance_width_bits) : h->default_advance_width;
+    if (h->advance_width_format == 0)
+        g->adv_w *= 16;
+    g->ofs_x = read_bits_signed(p, &bit, h->xy_bits);
+    g->ofs_y = read_bits_signed(p, &bit, h->xy_bits);
+    g->box_w = read_bits(p, &bit, h->wh_bits);
+    g->box_h = read_bits(p, &bit, h->wh_bits);
+    g->bitmap_bit = (uint32_t)(f->glyf * 8) + bit;
+    // the bitmap has to be inside the glyph record
+    return (uint64_t)bit + (uint64_t)g->box_w * g->box_h * h->bits_per_pixel <= (uint64_t)end * 8;
+}
+
+static int8_t kern_value(const struct binfont_t *f, uint32_t left, uint32_t right)
+{
+    const uint8_t *k = f->map + f->kern;
+    if (f->kern_format == 3) {
+        uint32_t mapping_length = rd16(k);
+        uint32_t cols = k[3];
+        if (left >= mapping_length || right >= mapping_length)
+            return 0;
+        uint32_t lc = k[4 + left];
+        uint32_t rc = k[4 + mapping_length + right];
+        // 0: no class, past the row or column count: a broken map, the table size covers only those
+        if (lc == 0 || rc == 0 || lc > k[2] || rc > cols)
+            return 0;
+        return (int8_t)k[4 + 2 * mapping_length + (lc - 1) * cols + (rc - 1)];
+    }
+    if (f->kern_format == 0) {
+        // pairs sorted by left, then right glyph id
+        uint32_t count = rd32(k);
+        int id_size = f->head.glyph_id_format ? 2 : 1;
+        const uint8_t *ids = k + 4;
+        uint32_t key = (left << 16) | right;
+        uint32_t lo = 0, hi = count;
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) / 2;
+            const uint8_t *pair = ids + (size_t)mid * 2 * id_size;
+            uint32_t v = id_size == 2 ? (rd16(pair) << 16) | rd16(pair + 2) : ((uint32_t)pair[0] << 16) | pair[1];
+            if (v == key)
+                return (int8_t)ids[(size_t)count * 2 * id_size + mid];
+            if (v < key)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+    }
+    return 0;
+}
+
+/* Same metrics as lv_font_get_glyph_dsc_fmt_txt() gives for the compiled font */
+static bool binfont_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter,
+                                  uint32_t letter_next)
+{
+    const struct binfont_t *f = (const struct binfont_t *)font;
+    bool is_tab = letter == '\t';
+    if (is_tab)
+        letter = ' ';
+    uint32_t gid = glyph_id(f, letter);
+    struct glyph_t g;
+    if (!gid || !glyph_read(f, gid, &g))
+        return false;
+
+    int32_t kv = 0;
+    if (f->kern_format != 0xFF) {
+        uint32_t gid_next = glyph_id(f, letter_next);
+        if (gid_next)
+            kv = ((int32_t)kern_value(f, gid, gid_next) * f->head.kerning_scale) >> 4;
+    }
+    uint32_t adv_w = g.adv_w;
+    if (is_tab)
+        adv_w *= 2;
+    adv_w += kv;
+
+    dsc->adv_w = (adv_w + (1 << 3)) >> 4;
+    dsc->box_w = g.box_w * (is_tab ? 2 : 1);
+    dsc->box_h = g.box_h;
+    dsc->ofs_x = g.ofs_x;
+    dsc->ofs_y = g.ofs_y;
+    dsc->stride = 0;
+    dsc->format = (lv_font_glyph_format_t)f->head.bits_per_pixel;
+    dsc->is_placeholder = false;
+    dsc->gid.index = gid;
+    return true;
+}
+
+/* ---------------------------------------------------------------- glyph cache */
+
+static uint32_t cache_bucket(const struct binfont_t *f, uint32_t gid)
+{
+    uintptr_t h = (uintptr_t)f / sizeof(struct binfont_t) * 2654435761u ^ gid * 40503u;
+    return (uint32_t)(h % UI_FONT_CACHE_BUCKETS);
+}
+
+static void lru_unlink(struct glyph_entry_t *e)
+{
+    if (e->prev_lru)
+        e->prev_lru->next_lru = e->next_lru;
+    else
+        lru_head = e->next_lru;
+    if (e->next_lru)
+        e->next_lru->prev_lru = e->prev_lru;
+    else
+        lru_tail = e->prev_lru;
+    e->prev_lru = e->next_lru = NULL;
+}
+
+static void lru_push_front(struct glyph_entry_t *e)
+{
+    e->next_lru = lru_head;
+    e->prev_lru = NULL;
+    if (lru_head)
+        lru_head->prev_lru = e;
+    lru_head = e;
+    if (!lru_tail)
+        lru_tail = e;
+}
+
+static void cache_remove(struct glyph_entry_t *e)
+{
+    struct glyph_entry_t **link = &buckets[cache_bucket(e->font, e->gid)];
+    while (*link != e)
+        link = &(*link)->next_hash;
+    *link = e->next_hash;
+    lru_unlink(e);
+    stats.cache_bytes -= e->bytes;
+    free(e);
+}
+
+/* Least recently used first, glyphs being drawn stay */
+static void cache_evict(size_t budget)
+{
+    struct glyph_entry_t *e = lru_tail;
+    while (e && stats.cache_bytes > budget) {
+        struct glyph_entry_t *prev = e->prev_lru;
+        if (e->refs == 0) {
+            cache_remove(e);
+            stats.evictions++;
+        }
+        e = prev;
+    }
+}
+
+static struct glyph_entry_t *glyph_rasterise(const struct binfont_t *f, uint32_t gid)
+{
+    struct glyph_t g;
+    if (!glyph_read(f, gid, &g) || g.box_w == 0 || g.box_h == 0)
+        return NULL;
+
+    uint32_t stride = lv_draw_buf_width_to_stride(g.box_w, LV_COLOR_FORMAT_A8);
+    size_t size = (size_t)stride * g.box_h;
+    struct glyph_entry_t *e = malloc(sizeof(*e) + size);
+    if (!e)
+        return NULL;
+    memset(e, 0, sizeof(*e) + size);
+    uint8_t *px = (uint8_t *)(e + 1);
+
+    // the bits of all rows follow each other, no padding
+    int bpp = f->head.bits_per_pixel;
+    uint32_t max = (1u << bpp) - 1;
+    uint32_t bit = g.bitmap_bit;
+    for (uint32_t y = 0; y < g.box_h; y++) {
+        for (uint32_t x = 0; x < g.box_w; x++)
+            px[y * stride + x] = (uint8_t)(read_bits(f->map, &bit, bpp) * 255 / max);
+    }
+
+    e->font = f;
+    e->gid = gid;
+    e->bytes = sizeof(*e) + size;
+    lv_draw_buf_init(&e->buf, g.box_w, g.box_h, LV_COLOR_FORMAT_A8, stride, px, (uint32_t)size);
+    return e;
+}
+
+static const void *binfont_get_glyph_bitmap(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf)
+{
+    (void)draw_buf;     // the cached bitmap is handed out instead
+    const struct binfont_t *f = (const struct binfont_t *)dsc->resolved_font;
+    uint32_t gid = dsc->gid.index;
+    if (!f || !gid || dsc->req_raw_bitmap)
+        return NULL;
+
+    pthread_mutex_lock(&cache_lock);
+    struct glyph_entry_t **bucket = &buckets[cache_bucket(f, gid)];
+    struct glyph_entry_t *e = *bucket;
+    while (e && !(e->font == f && e->gid == gid))
+        e = e->next_hash;
+    if (e) {
+        stats.hits++;
+        lru_unlink(e);
+    } else {
+        e = glyph_rasterise(f, gid);
+        if (!e) {
+            pthread_mutex_unlock(&cache_lock);
+            return NULL;
+        }
+        stats.misses++;
+        e->next_hash = *bucket;
+        *bucket = e;
+        stats.cache_bytes += e->bytes;
+        cache_evict(UI_FONT_CACHE_BYTES);
+    }
+    lru_push_front(e);
+    e->refs++;
+    pthread_mutex_unlock(&cache_lock);
+    dsc->entry = (lv_cache_entry_t *)e;   // back in binfont_release_glyph()
+    return &e->buf;
+}
+
+static void binfont_release_glyph(const lv_font_t *font, lv_font_glyph_dsc_t *dsc)
+{
+    (void)font;
+    struct glyph_entry_t *e = (struct glyph_entry_t *)dsc->entry;
+    pthread_mutex_lock(&cache_lock);
+    if (e && e->refs > 0)
+        e->refs--;
+    pthread_mutex_unlock(&cache_lock);
+    dsc->entry = NULL;
+}
+
+/* ---------------------------------------------------------------- loading */
+
+static void binfont_free(struct binfont_t *f)
+{
+    if (f->map)
+        munmap((void *)f->map, f->map_size);
+    free(f->cmaps);
+    free(f);
+}
+
+static bool binfont_parse(struct binfont_t *f)
+{
+    int64_t head_length = table_at(f, 0, "head");
+    if (head_length < 8 + (int64_t)sizeof(f->head))
+        return false;
+    memcpy(&f->head, f->map + 8, sizeof(f->head));
+    const struct binfont_head_t *h = &f->head;
+    if (h->compression_id != 0) {
+        printf("[ UI ] Font %s is compressed, convert it with --no-compress\n", f->name);
+        return false;
+    }
+    if (h->bits_per_pixel != 1 && h->bits_per_pixel != 2 && h->bits_per_pixel != 4 && h->bits_per_pixel != 8)
+        return false;
+    if (h->xy_bits > 32 || h->wh_bits > 32 || h->advance_width_bits > 32 || h->index_to_loc_format > 1)
+        return false;
+
+    f->cmaps_start = (uint32_t)head_length;
+    int64_t cmaps_length = table_at(f, f->cmaps_start, "cmap");
+    if (cmaps_length < 12)
+        return false;
+    f->cmap_num = rd32(f->map + f->cmaps_start + 8);
+    if (12 + (uint64_t)f->cmap_num * sizeof(struct binfont_cmap_t) > (uint64_t)cmaps_length)
+        return false;
+    f->cmaps = malloc((size_t)f->cmap_num * sizeof(struct binfont_cmap_t) + 1);
+    if (!f->cmaps)
+        return false;
+    memcpy(f->cmaps, f->map + f->cmaps_start + 12, (size_t)f->cmap_num * sizeof(struct binfont_cmap_t));
+    for (uint32_t i = 0; i < f->cmap_num; i++) {
+        const struct binfont_cmap_t *c = &f->cmaps[i];
+        uint64_t data = 0;
+        if (c->format_type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL)
+            data = c->range_length;
+        else if (c->format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY)
+            data = (uint64_t)c->data_entries_count * 2;
+        else if (c->format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL)
+            data = (uint64_t)c->data_entries_count * 4;
+        else if (c->format_type != LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY)
+            return false;
+        if ((uint64_t)c->data_offset + data > (uint64_t)cmaps_length)
+            return false;
+    }
+
+    uint32_t loca_start = f->cmaps_start + (uint32_t)cmaps_length;
+    int64_t loca_length = table_at(f, loca_start, "loca");
+    if (loca_length < 12)
+        return false;
+    f->loca_count = rd32(f->map + loca_start + 8);
+    f->loca = loca_start + 12;
+    if (12 + (uint64_t)f->loca_count * (h->index_to_loc_format ? 4 : 2) > (uint64_t)loca_length)
+        return false;
+
+    f->glyf = loca_start + (uint32_t)loca_length;
+    int64_t glyf_length = table_at(f, f->glyf, "glyf");
+    if (glyf_length < 8)
+        return false;
+    f->glyf_length = (uint32_t)glyf_length;
+
+    f->kern_format = 0xFF;
+    if (h->tables_count >= 4) {
+        uint32_t kern_start = f->glyf + f->glyf_length;
+        int64_t kern_length = table_at(f, kern_start, "kern");
+        if (kern_length < 12)
+            return false;
+        const uint8_t *k = f->map + kern_start + 12;
+        uint64_t need = 12;
+        f->kern = kern_start + 12;
+        f->kern_format = f->map[kern_start + 8];
+        if (f->kern_format == 3) {
+            need += 4 + 2 * (uint64_t)rd16(k) + (uint64_t)k[2] * k[3];
+        } else if (f->kern_format == 0) {
+            need += 4 + (uint64_t)rd32(k) * (h->glyph_id_format ? 5 : 3);
+        } else {
+            return false;
+        }
+        if (need > (uint64_t)kern_length)
+            return false;
+    }
+
+    lv_font_t *font = &f->font;
+    font->get_glyph_dsc = binfont_get_glyph_dsc;
+    font->get_glyph_bitmap = binfont_get_glyph_bitmap;
+    font->release_glyph = binfont_release_glyph;
+    font->base_line = -h->descent;
+    font->line_height = h->ascent - h->descent;
+    font->subpx = h->subpixels_mode;
+    font->underline_position = (int8_t)h->underline_position;
+    font->underline_thickness = (int8_t)h->underline_thickness;
+    return true;
+}
+
+const lv_font_t *ui_font_load(const char *path)
+{
+    if (loaded_count >= UI_FONT_MAX_LOADED) {
+        printf("[ UI ] Too many fonts loaded, %s skipped\n", path);
+        return NULL;
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    struct binfont_t *f = NULL;
+    if (fstat(fd, &st) == 0 && st.st_size > 8)
+        f = calloc(1, sizeof(*f));
+    if (f) {
+        const char *base = strrchr(path, '/');
+        snprintf(f->name, sizeof(f->name), "%s", base ? base + 1 : path);
+        f->map_size = (size_t)st.st_size;
+        void *map = mmap(NULL, f->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        f->map = map == MAP_FAILED ? NULL : map;
+    }
+    close(fd);
+    if (!f || !f->map || !binfont_parse(f)) {
+        printf("[ UI ] Failed to load font %s\n", path);
+        if (f)
+            binfont_free(f);
+        return NULL;
+    }
+
+    loaded[loaded_count++] = f;
+    stats.loaded++;
+    stats.mapped_bytes += f->map_size;
+    stats.heap_bytes += sizeof(*f) + (size_t)f->cmap_num * sizeof(struct binfont_cmap_t);
+    printf("[ UI ] Font %s mapped, %zu bytes\n", f->name, f->map_size);
+    return &f->font;
+}
+
+const lv_font_t *ui_font_get(const char *family, int size)
+{
+    for (int i = 0; i < lookup_count; i++) {
+        if (lookups[i].size == size && strcmp(lookups[i].family, family) == 0)
+            return lookups[i].font;
+    }
+
+    const lv_font_t *font = NULL;
+    const lv_font_t *closest = NULL;
+    int closest_diff = 0;
+    for (size_t i = 0; i < sizeof(builtin_fonts) / sizeof(builtin_fonts[0]); i++) {
+        if (strcmp(builtin_fonts[i].family, family) != 0)
+            continue;
+        int diff = abs(builtin_fonts[i].size - size);
+        if (diff == 0)
+            font = builtin_fonts[i].font;
+        if (!closest || diff < closest_diff) {
+            closest = builtin_fonts[i].font;
+            closest_diff = diff;
+        }
+    }
+    if (!font) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s_%d.bin", font_dir, family, size);
+        font = ui_font_load(path);
+    }
+    if (!font) {
+        printf("[ UI ] No font %s %d px, using the closest built in\n", family, size);
+        font = closest ? closest : &montserrat_cyrillic_medium_20;
+    }
+
+    // remembered either way, a missing file is looked for once
+    if (lookup_count < (int)(sizeof(lookups) / sizeof(lookups[0]))) {
+        snprintf(lookups[lookup_count].family, sizeof(lookups[0].family), "%s", family);
+        lookups[lookup_count].size = size;
+        lookups[lookup_count].font = font;
+        lookup_count++;
+    }
+    return font;
+}
+
+void ui_font_set_dir(const char *dir)
+{
+    font_dir = dir;
+}
+
+void ui_font_deinit(void)
+{
+    pthread_mutex_lock(&cache_lock);
+    while (lru_head)
+        cache_remove(lru_head);
+    pthread_mutex_unlock(&cache_lock);
+    for (int i = 0; i < loaded_count; i++)
+        binfont_free(loaded[i]);
+    loaded_count = 0;
+    lookup_count = 0;
+    pthread_mutex_lock(&cache_lock);
+    memset(&stats, 0, sizeof(stats));
+    pthread_mutex_unlock(&cache_lock);
+}
+
+void ui_font_get_stats(struct ui_font_stats_t *out)
+{
+    pthread_mutex_lock(&cache_lock);
+    *out = stats;
+    pthread_mutex_unlock(&cache_lock);
+}
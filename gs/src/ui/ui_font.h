@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef VD_LINK_UI_FONT_H
+#define VD_LINK_UI_FONT_H
+#include <stddef.h>
+#include <stdint.h>
+#include "lvgl/lvgl.h"
+
+/*
+ * UI fonts by family and size. The sizes the UI starts with are compiled in, the rest are LVGL binary
+ * fonts (lv_font_conv --format bin --no-compress) in UI_FONT_PATH, mapped on first use.
+ * Only the cmap headers of a mapped font are in RAM, glyph descriptors and bitmaps are read from the
+ * mapping when drawn. Glyphs rasterised to A8 are kept in one LRU cache for all fonts, locked, as
+ * the draw thread fills it. The calls below are from the LVGL thread.
+ */
+#ifdef PLATFORM_ROCKCHIP
+#define UI_FONT_PATH            "/usr/etc/msp-osd/fonts/ui"
+#endif
+
+#ifdef PLATFORM_DESKTOP
+#define UI_FONT_PATH            "../assets/fonts/ui"
+#endif
+
+#define UI_FONT_CACHE_BYTES     (256 * 1024)    // rasterised glyphs, all fonts
+#define UI_FONT_MAX_LOADED      16
+
+struct ui_font_stats_t {
+    int loaded;                 // binary fonts mapped
+    size_t mapped_bytes;
+    size_t heap_bytes;          // font descriptors and cmap headers
+    size_t cache_bytes;         // glyph cache, bitmaps included
+    uint64_t hits;
+    uint64_t misses;            // glyphs rasterised
+    uint64_t evictions;
+};
+
+/**
+ * "montserrat_cyrillic" or "montserrat_cyrillic_medium" at size px. Loads <dir>/<family>_<size>.bin
+ * the first time; when there is none, the compiled-in size of the family closest to it is returned.
+ * Never NULL.
+ */
+const lv_font_t *ui_font_get(const char *family, int size);
+
+/* Load binary fonts from dir instead of UI_FONT_PATH, before the first ui_font_get() */
+void ui_font_set_dir(const char *dir);
+
+/**
+ * Map the binary font at path. NULL if it can't be read or isn't a plain (uncompressed) LVGL binary
+ * font. It stays until ui_font_deinit()
+ */
+const lv_font_t *ui_font_load(const char *path);
+
+/* Unmap every binary font and drop the glyph cache. Nothing may draw with them any more */
+void ui_font_deinit(void);
+
+void ui_font_get_stats(struct ui_font_stats_t *stats);
+
+#endif //VD_LINK_UI_FONT_H
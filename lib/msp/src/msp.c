@@ -6,21 +6,82 @@
 #include <string.h>
 #include <stdio.h>
 #include "msp.h"
+#include "msp_dispatch.h"
 
-static uint8_t crc8_calc(uint8_t crc, unsigned char a, uint8_t poly)
+#define MSP_V1_HEADER_LEN   (3 + sizeof(msp_header_v1_t))     // "$M<" size cmd
+#define MSP_V2_HEADER_LEN   (3 + sizeof(msp_header_v2_t))     // "$X<" flags cmd size
+
+/* CRC-8/DVB-S2 (poly 0xD5) of every byte value, crc = crc8_table[crc ^ byte] */
+static const uint8_t crc8_table[256] = {
+    0x00, 0xD5, 0x7F, 0xAA, 0xFE, 0x2B, 0x81, 0x54, 0x29, 0xFC, 0x56, 0x83, 0xD7, 0x02, 0xA8, 0x7D,
+    0x52, 0x87, 0x2D, 0xF8, 0xAC, 0x79, 0xD3, 0x06, 0x7B, 0xAE, 0x04, 0xD1, 0x85, 0x50, 0xFA, 0x2F,
+    0xA4, 0x71, 0xDB, 0x0E, 0x5A, 0x8F, 0x25, 0xF0, 0x8D, 0x58, 0xF2, 0x27, 0x73, 0xA6, 0x0C, 0xD9,
+    0xF6, 0x23, 0x89, 0x5C, 0x08, 0xDD, 0x77, 0xA2, 0xDF, 0x0A, 0xA0, 0x75, 0x21, 0xF4, 0x5E, 0x8B,
+    0x9D, 0x48, 0xE2, 0x37, 0x63, 0xB6, 0x1C, 0xC9, 0xB4, 0x61, 0xCB, 0x1E, 0x4A, 0x9F, 0x35, 0xE0,
+    0xCF, 0x1A, 0xB0, 0x65, 0x31, 0xE4, 0x4E, 0x9B, 0xE6, 0x33, 0x99, 0x4C, 0x18, 0xCD, 0x67, 0xB2,
+    0x39, 0xEC, 0x46, 0x93, 0xC7, 0x12, 0xB8, 0x6D, 0x10, 0xC5, 0x6F, 0xBA, 0xEE, 0x3B, 0x91, 0x44,
+    0x6B, 0xBE, 0x14, 0xC1, 0x95, 0x40, 0xEA, 0x3F, 0x42, 0x97, 0x3D, 0xE8, 0xBC, 0x69, 0xC3, 0x16,
+    0xEF, 0x3A, 0x90, 0x45, 0x11, 0xC4, 0x6E, 0xBB, 0xC6, 0x13, 0xB9, 0x6C, 0x38, 0xED, 0x47, 0x92,
+    0xBD, 0x68, 0xC2, 0x17, 0x43, 0x96, 0x3C, 0xE9, 0x94, 0x41, 0xEB, 0x3E, 0x6A, 0xBF, 0x15, 0xC0,
+    0x4B, 0x9E, 0x34, 0xE1, 0xB5, 0x60, 0xCA, 0x1F, 0x62, 0xB7, 0x1D, 0xC8, 0x9C, 0x49, 0xE3, 0x36,
+    0x19, 0xCC, 0x66, 0xB3, 0xE7, 0x32, 0x98, 0x4D, 0x30, 0xE5, 0x4F, 0x9A, 0xCE, 0x1B, 0xB1, 0x64,
+    0x72, 0xA7, 0x0D, 0xD8, 0x8C, 0x59, 0xF3, 0x26, 0x5B, 0x8E, 0x24, 0xF1, 0xA5, 0x70, 0xDA, 0x0F,
+    0x20, 0xF5, 0x5F, 0x8A, 0xDE, 0x0B, 0xA1, 0x74, 0x09, 0xDC, 0x76, 0xA3, 0xF7, 0x22, 0x88, 0x5D,
+    0xD6, 0x03, 0xA9, 0x7C, 0x28, 0xFD, 0x57, 0x82, 0xFF, 0x2A, 0x80, 0x55, 0x01, 0xD4, 0x7E, 0xAB,
+    0x84, 0x51, 0xFB, 0x2E, 0x7A, 0xAF, 0x05, 0xD0, 0xAD, 0x78, 0xD2, 0x07, 0x53, 0x86, 0x2C, 0xF9,
+};
+
+static uint8_t crc8_calc(uint8_t crc, unsigned char a)
 {
-    crc ^= a;
-    for (int ii = 0; ii < 8; ++ii) {
-        if (crc & 0x80) {
-            crc = (crc << 1) ^ poly;
-        } else {
-            crc = crc << 1;
-        }
-    }
+    return crc8_table[crc ^ a];
+}
+
+static uint8_t crc8_update(uint8_t crc, const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+        crc = crc8_table[crc ^ data[i]];
     return crc;
 }
 
-void msp_process_received_data(msp_port_t *mspPort, uint8_t c)
+/* MSPv1 checksum, 8 bytes per step */
+static uint8_t xor_update(uint8_t checksum, const uint8_t *data, size_t len)
+{
+    uint64_t acc = 0;
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, data + i, sizeof(w));
+        acc ^= w;
+    }
+    acc ^= acc >> 32;
+    acc ^= acc >> 16;
+    acc ^= acc >> 8;
+    checksum ^= (uint8_t)acc;
+    for (; i < len; i++)
+        checksum ^= data[i];
+    return checksum;
+}
+
+/* Frame described by the port fields, payload either in the port or in the caller's buffer */
+static void msp_deliver(msp_port_t *mspPort, const uint8_t *payload)
+{
+    if (mspPort->callback)
+        mspPort->callback(mspPort->owner, mspPort->msp_version, mspPort->msp_cmd, mspPort->data_size, payload);
+    if (mspPort->dispatch) {
+        msp_view_t view = {
+            .version = mspPort->msp_version,
+            .type = mspPort->packet_type,
+            .flags = mspPort->cmd_flags,
+            .cmd = mspPort->msp_cmd,
+            .size = (uint16_t)mspPort->data_size,
+            .payload = payload,
+        };
+        msp_dispatch(mspPort->dispatch, &view);
+    }
+}
+
+/* Byte at a time parser, for frames split across input buffers */
+static bool msp_process_byte(msp_port_t *mspPort, uint8_t c)
 {
     switch (mspPort->msp_state) {
     default:
@@ -28,7 +89,7 @@ void msp_process_received_data(msp_port_t *mspPort, uint8_t c)
         if (c == '$') {
             mspPort->msp_state = MSP_HEADER_START;
         } else {
-            return;
+            return false;
         }
         break;
 
@@ -121,10 +182,9 @@ void msp_process_received_data(msp_port_t *mspPort, uint8_t c)
     case MSP_CHECKSUM_V1:
         if (mspPort->checksum1 == c) {
             mspPort->msp_state = MSP_COMMAND_RECEIVED;
-            if (mspPort->callback != 0) {
-                mspPort->callback(mspPort->owner, mspPort->msp_version, mspPort->msp_cmd, mspPort->data_size, mspPort->payload);
-                mspPort->msp_state = MSP_IDLE;
-            }
+            msp_deliver(mspPort, mspPort->payload);
+            mspPort->msp_state = MSP_IDLE;
+            return true;
         } else {
             mspPort->msp_state = MSP_IDLE;
         }
@@ -133,7 +193,7 @@ void msp_process_received_data(msp_port_t *mspPort, uint8_t c)
     case MSP_HEADER_V2_OVER_V1:     // V2 header is part of V1 payload - we need to calculate both checksums now
         mspPort->payload[mspPort->offset++] = c;
         mspPort->checksum1 ^= c;
-        mspPort->checksum2 = crc8_calc(mspPort->checksum2, c, 0xD5);
+        mspPort->checksum2 = crc8_calc(mspPort->checksum2, c);
         if (mspPort->offset == (sizeof(msp_header_v2_t) + sizeof(msp_header_v1_t))) {
             msp_header_v2_t * hdrv2 = (msp_header_v2_t *)&mspPort->payload[sizeof(msp_header_v1_t)];
             if (hdrv2->size > MSP_PORT_BUFF_SIZE) {
@@ -149,7 +209,7 @@ void msp_process_received_data(msp_port_t *mspPort, uint8_t c)
         break;
 
     case MSP_PAYLOAD_V2_OVER_V1:
-        mspPort->checksum2 = crc8_calc(mspPort->checksum2, c, 0xD5);
+        mspPort->checksum2 = crc8_calc(mspPort->checksum2, c);
         mspPort->checksum1 ^= c;
         mspPort->payload[mspPort->offset++] = c;
 
@@ -169,19 +229,23 @@ void msp_process_received_data(msp_port_t *mspPort, uint8_t c)
 
     case MSP_HEADER_V2_NATIVE:
         mspPort->payload[mspPort->offset++] = c;
-        mspPort->checksum2 = crc8_calc(mspPort->checksum2, c, 0xD5);
+        mspPort->checksum2 = crc8_calc(mspPort->checksum2, c);
         if (mspPort->offset == sizeof(msp_header_v2_t)) {
             msp_header_v2_t * hdrv2 = (msp_header_v2_t *)&mspPort->payload[0];
-            mspPort->data_size = hdrv2->size;
-            mspPort->msp_cmd = hdrv2->cmd;
-            mspPort->cmd_flags = hdrv2->flags;
-            mspPort->offset = 0;                // re-use buffer
-            mspPort->msp_state = mspPort->data_size > 0 ? MSP_PAYLOAD_V2_NATIVE : MSP_CHECKSUM_V2_NATIVE;
+            if (hdrv2->size > MSP_PORT_BUFF_SIZE) {
+                mspPort->msp_state = MSP_IDLE;
+            } else {
+                mspPort->data_size = hdrv2->size;
+                mspPort->msp_cmd = hdrv2->cmd;
+                mspPort->cmd_flags = hdrv2->flags;
+                mspPort->offset = 0;                // re-use buffer
+                mspPort->msp_state = mspPort->data_size > 0 ? MSP_PAYLOAD_V2_NATIVE : MSP_CHECKSUM_V2_NATIVE;
+            }
         }
         break;
 
     case MSP_PAYLOAD_V2_NATIVE:
-        mspPort->checksum2 = crc8_calc(mspPort->checksum2, c, 0xD5);
+        mspPort->checksum2 = crc8_calc(mspPort->checksum2, c);
         mspPort->payload[mspPort->offset++] = c;
 
         if (mspPort->offset == mspPort->data_size) {
@@ -192,15 +256,139 @@ void msp_process_received_data(msp_port_t *mspPort, uint8_t c)
     case MSP_CHECKSUM_V2_NATIVE:
         if (mspPort->checksum2 == c) {
             mspPort->msp_state = MSP_COMMAND_RECEIVED;
-            if (mspPort->callback != 0) {
-                mspPort->callback(mspPort->owner, mspPort->msp_version, mspPort->msp_cmd, mspPort->data_size, mspPort->payload);
-                mspPort->msp_state = MSP_IDLE;
-            }
+            msp_deliver(mspPort, mspPort->payload);
+            mspPort->msp_state = MSP_IDLE;
+            return true;
         } else {
             mspPort->msp_state = MSP_IDLE;
         }
         break;
     }
+    return false;
+}
+
+static bool msp_port_idle(const msp_port_t *mspPort)
+{
+    return mspPort->msp_state == MSP_IDLE || mspPort->msp_state == MSP_COMMAND_RECEIVED;
+}
+
+static msp_packet_type_t msp_packet_type(uint8_t c)
+{
+    return c == '<' ? MSP_PACKET_COMMAND : c == '>' ? MSP_PACKET_RESPONSE : MSP_PACKET_UNKNOWN;
+}
+
+/*
+ * Frame starting at frame[0] == '$' that lies completely in the input: checked and delivered in place.
+ * Returns its length, 0 if it's not a valid frame, -1 if the input ends before the frame does.
+ */
+static int msp_parse_frame(msp_port_t *mspPort, const uint8_t *frame, size_t avail)
+{
+    if (avail < 3)
+        return -1;
+    msp_packet_type_t type = msp_packet_type(frame[2]);
+    if (type == MSP_PACKET_UNKNOWN || (frame[1] != 'M' && frame[1] != 'X'))
+        return 0;
+
+    msp_version_t version;
+    msp_header_v2_t hdr;
+    const uint8_t *payload;
+    size_t len;
+
+    if (frame[1] == 'M') {
+        if (avail < MSP_V1_HEADER_LEN)
+            return -1;
+        uint8_t size = frame[3], cmd = frame[4];
+        if (size > MSP_PORT_BUFF_SIZE)
+            return 0;
+        len = MSP_V1_HEADER_LEN + size + 1;
+        if (cmd == MSP_V2_FRAME_ID) {
+            // MSPv1 payload must be big enough to hold V2 header + extra checksum
+            if (size < sizeof(msp_header_v2_t) + 1)
+                return 0;
+            if (avail < MSP_V1_HEADER_LEN + sizeof(msp_header_v2_t))
+                return -1;
+            memcpy(&hdr, frame + MSP_V1_HEADER_LEN, sizeof(hdr));
+            if (hdr.size > MSP_PORT_BUFF_SIZE)
+                return 0;
+            // v1 payload: v2 header, v2 payload, crc, then the v1 checksum
+            len = MSP_V1_HEADER_LEN + sizeof(msp_header_v2_t) + hdr.size + 2;
+            if (avail < len)
+                return -1;
+            const uint8_t *v2 = frame + MSP_V1_HEADER_LEN;
+            uint8_t crc = crc8_update(0, v2, sizeof(msp_header_v2_t) + hdr.size);
+            if (crc != v2[sizeof(msp_header_v2_t) + hdr.size] ||
+                xor_update(0, frame + 3, len - 4) != frame[len - 1])
+                return 0;
+            version = MSP_V2_OVER_V1;
+            payload = v2 + sizeof(msp_header_v2_t);
+        } else {
+            if (avail < len)
+                return -1;
+            if (xor_update(0, frame + 3, len - 4) != frame[len - 1])
+                return 0;
+            hdr = (msp_header_v2_t){ .flags = 0, .cmd = cmd, .size = size };
+            version = MSP_V1;
+            payload = frame + MSP_V1_HEADER_LEN;
+        }
+    } else {
+        if (avail < MSP_V2_HEADER_LEN)
+            return -1;
+        memcpy(&hdr, frame + 3, sizeof(hdr));
+        if (hdr.size > MSP_PORT_BUFF_SIZE)
+            return 0;
+        len = MSP_V2_HEADER_LEN + hdr.size + 1;
+        if (avail < len)
+            return -1;
+        if (crc8_update(0, frame + 3, len - 4) != frame[len - 1])
+            return 0;
+        version = MSP_V2_NATIVE;
+        payload = frame + MSP_V2_HEADER_LEN;
+    }
+
+    mspPort->msp_version = version;
+    mspPort->packet_type = type;
+    mspPort->msp_cmd = hdr.cmd;
+    mspPort->cmd_flags = hdr.flags;
+    mspPort->data_size = hdr.size;
+    msp_deliver(mspPort, payload);
+    return (int)len;
+}
+
+int msp_process_buffer(msp_port_t *mspPort, const uint8_t *buf, size_t len)
+{
+    int frames = 0;
+    size_t pos = 0;
+
+    while (pos < len) {
+        // finish a frame started in an earlier buffer
+        if (!msp_port_idle(mspPort)) {
+            frames += msp_process_byte(mspPort, buf[pos++]);
+            continue;
+        }
+
+        const uint8_t *start = memchr(buf + pos, '$', len - pos);
+        if (!start)
+            break;
+        pos = (size_t)(start - buf);
+
+        int n = msp_parse_frame(mspPort, start, len - pos);
+        if (n > 0) {
+            frames++;
+            pos += (size_t)n;
+        } else if (n == 0) {
+            pos++;          // not a frame, look for the next '$'
+        } else {
+            // frame continues in the next buffer, keep it in the port
+            while (pos < len)
+                frames += msp_process_byte(mspPort, buf[pos++]);
+        }
+    }
+    return frames;
+}
+
+void msp_process_received_data(msp_port_t *mspPort, uint8_t c)
+{
+    msp_process_buffer(mspPort, &c, 1);
 }
 
 uint16_t construct_msp_command_v1(uint8_t message_buffer[], uint8_t command, const uint8_t *payload, uint8_t size, msp_direction_t direction)
@@ -248,16 +436,12 @@ uint16_t construct_msp_command_v2(uint8_t message_buffer[], uint16_t function, c
 
     // Copy header buffer, adding each byte to the crc
     memcpy(message_buffer+3, &header, sizeof(msp_header_v2_t));
-    for (int i = 0; i < 5; i++) {
-        checksum = crc8_calc(checksum, message_buffer[3 + i], 0xD5);
-    }
+    checksum = crc8_update(checksum, message_buffer + 3, sizeof(msp_header_v2_t));
 
     // Copy payload, adding each byte to the crc
     if (size > 0 && payload != NULL) {
         memcpy(message_buffer+8, payload, size);
-        for (int i = 0; i < size; i++) {
-            checksum = crc8_calc(checksum, message_buffer[8 + i], 0xD5);
-        }
+        checksum = crc8_update(checksum, message_buffer + 8, size);
     }
 
     // Add checksum to message buffer
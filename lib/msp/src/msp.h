@@ -6,6 +6,7 @@
 #define MSP_H
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "msp_protocol.h"
 #include "msp_protocol_v2_betaflight.h"
 #include "msp_protocol_v2_common.h"
@@ -51,6 +52,8 @@ typedef void (*msp_msg_callback)(uint8_t owner, msp_version_t msp_version, uint1
 
 typedef int msp_descriptor_t;
 
+struct msp_dispatch_s;
+
 typedef struct mspPort_s {
     msp_state_t msp_state;
     uint8_t payload[MSP_PORT_BUFF_SIZE];
@@ -63,6 +66,7 @@ typedef struct mspPort_s {
     uint8_t checksum2;
     msp_descriptor_t descriptor;
     msp_msg_callback callback;
+    struct msp_dispatch_s *dispatch;    // when set, frames are also dispatched by command (msp_dispatch.h)
     msp_packet_type_t packet_type;
     uint8_t owner;
 }msp_port_t;
@@ -91,6 +95,26 @@ typedef enum {
       MSP_OUTBOUND
 }msp_direction_t;
 
+/* MSP_DISPLAYPORT sub commands, the first payload byte */
+typedef enum {
+    MSP_DISPLAYPORT_KEEPALIVE,
+    MSP_DISPLAYPORT_CLOSE,
+    MSP_DISPLAYPORT_CLEAR,
+    MSP_DISPLAYPORT_DRAW_STRING,
+    MSP_DISPLAYPORT_DRAW_SCREEN,
+    MSP_DISPLAYPORT_SET_OPTIONS,
+    MSP_DISPLAYPORT_DRAW_SYSTEM
+}msp_displayport_cmd_e;
+
+/**
+ * Parse a chunk of received bytes, calling the port callback and dispatch for every valid frame.
+ * Frames that lie completely in buf are checked in place and their payload is passed without a copy;
+ * a frame cut by the end of buf is kept in the port and completed by the next call.
+ * Returns the number of frames delivered from this chunk.
+ */
+int msp_process_buffer(msp_port_t *mspPort, const uint8_t *buf, size_t len);
+
+/* Single byte, same as msp_process_buffer(mspPort, &c, 1) */
 void msp_process_received_data(msp_port_t *mspPort, uint8_t c);
 
 uint16_t construct_msp_command_v1(uint8_t message_buffer[], uint8_t command, const uint8_t *payload, uint8_t size, msp_direction_t direction);
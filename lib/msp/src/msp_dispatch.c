@@ -0,0 +1,154 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "msp_dispatch.h"
+
+struct msp_handler_slot_t {
+    _Atomic(msp_handler_t) handler;     // NULL: free slot
+    void *_Atomic user;
+};
+
+struct msp_dispatch_entry_t {
+    struct msp_handler_slot_t slots[MSP_DISPATCH_MAX_HANDLERS];
+    atomic_uint count;
+};
+
+struct msp_dispatch_page_t {
+    struct msp_dispatch_entry_t entries[256];
+};
+
+/*
+ * Pages and slots are written under lock and published with release stores, the dispatching
+ * thread reads them without it.
+ */
+struct msp_dispatch_s {
+    struct msp_dispatch_page_t *_Atomic pages[MSP_DISPATCH_PAGES];
+    atomic_uint unhandled;
+    pthread_mutex_t lock;
+};
+
+static struct msp_dispatch_entry_t *msp_dispatch_entry(const msp_dispatch_t *dispatch, uint16_t cmd)
+{
+    struct msp_dispatch_page_t *page = atomic_load_explicit(&((msp_dispatch_t *)dispatch)->pages[cmd >> 8],
+                                                            memory_order_acquire);
+    return page ? &page->entries[cmd & 0xFF] : NULL;
+}
+
+msp_dispatch_t *msp_dispatch_create(void)
+{
+    msp_dispatch_t *dispatch = calloc(1, sizeof(*dispatch));
+    if (!dispatch)
+        return NULL;
+    struct msp_dispatch_page_t *v1 = calloc(1, sizeof(*v1));
+    if (!v1) {
+        free(dispatch);
+        return NULL;
+    }
+    atomic_init(&dispatch->pages[0], v1);
+    pthread_mutex_init(&dispatch->lock, NULL);
+    return dispatch;
+}
+
+void msp_dispatch_destroy(msp_dispatch_t *dispatch)
+{
+    if (!dispatch)
+        return;
+    for (int p = 0; p < MSP_DISPATCH_PAGES; p++)
+        free(atomic_load(&dispatch->pages[p]));
+    pthread_mutex_destroy(&dispatch->lock);
+    free(dispatch);
+}
+
+int msp_dispatch_register(msp_dispatch_t *dispatch, uint16_t cmd, msp_handler_t handler, void *user)
+{
+    if (!dispatch || !handler)
+        return -1;
+
+    int ret = -1;
+    pthread_mutex_lock(&dispatch->lock);
+    struct msp_dispatch_page_t *page = atomic_load_explicit(&dispatch->pages[cmd >> 8], memory_order_relaxed);
+    if (!page) {
+        page = calloc(1, sizeof(*page));
+        if (!page)
+            goto out;
+        atomic_store_explicit(&dispatch->pages[cmd >> 8], page, memory_order_release);
+    }
+
+    struct msp_dispatch_entry_t *entry = &page->entries[cmd & 0xFF];
+    for (int i = 0; i < MSP_DISPATCH_MAX_HANDLERS; i++) {
+        struct msp_handler_slot_t *slot = &entry->slots[i];
+        if (atomic_load_explicit(&slot->handler, memory_order_relaxed))
+            continue;
+        atomic_store_explicit(&slot->user, user, memory_order_relaxed);
+        atomic_store_explicit(&slot->handler, handler, memory_order_release);
+        ret = 0;
+        break;
+    }
+out:
+    pthread_mutex_unlock(&dispatch->lock);
+    return ret;
+}
+
+int msp_dispatch_unregister(msp_dispatch_t *dispatch, uint16_t cmd, msp_handler_t handler, void *user)
+{
+    if (!dispatch)
+        return -1;
+
+    int ret = -1;
+    pthread_mutex_lock(&dispatch->lock);
+    struct msp_dispatch_entry_t *entry = msp_dispatch_entry(dispatch, cmd);
+    for (int i = 0; entry && i < MSP_DISPATCH_MAX_HANDLERS; i++) {
+        struct msp_handler_slot_t *slot = &entry->slots[i];
+        if (atomic_load_explicit(&slot->handler, memory_order_relaxed) != handler ||
+            atomic_load_explicit(&slot->user, memory_order_relaxed) != user)
+            continue;
+        atomic_store_explicit(&slot->handler, NULL, memory_order_release);
+        ret = 0;
+        break;
+    }
+    pthread_mutex_unlock(&dispatch->lock);
+    return ret;
+}
+
+int msp_dispatch(msp_dispatch_t *dispatch, const msp_view_t *msg)
+{
+    struct msp_dispatch_entry_t *entry = msp_dispatch_entry(dispatch, msg->cmd);
+    int called = 0;
+    if (entry) {
+        atomic_fetch_add_explicit(&entry->count, 1, memory_order_relaxed);
+        for (int i = 0; i < MSP_DISPATCH_MAX_HANDLERS; i++) {
+            msp_handler_t handler = atomic_load_explicit(&entry->slots[i].handler, memory_order_acquire);
+            if (!handler)
+                continue;
+            handler(atomic_load_explicit(&entry->slots[i].user, memory_order_relaxed), msg);
+            called++;
+        }
+    }
+    if (!called)
+        atomic_fetch_add_explicit(&dispatch->unhandled, 1, memory_order_relaxed);
+    return called;
+}
+
+uint32_t msp_dispatch_count(const msp_dispatch_t *dispatch, uint16_t cmd)
+{
+    struct msp_dispatch_entry_t *entry = msp_dispatch_entry(dispatch, cmd);
+    return entry ? atomic_load_explicit(&entry->count, memory_order_relaxed) : 0;
+}
+
+uint32_t msp_dispatch_unhandled(const msp_dispatch_t *dispatch)
+{
+    return atomic_load_explicit(&((msp_dispatch_t *)dispatch)->unhandled, memory_order_relaxed);
+}
+
+float msp_rate_update(msp_rate_t *rate, uint32_t count, uint64_t now_us)
+{
+    if (rate->time_us && now_us > rate->time_us)
+        rate->hz = (float)(uint32_t)(count - rate->count) * 1e6f / (float)(now_us - rate->time_us);
+    rate->count = count;
+    rate->time_us = now_us;
+    return rate->hz;
+}
@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef MSP_DISPATCH_H
+#define MSP_DISPATCH_H
+#include <stdint.h>
+#include "msp.h"
+
+/*
+ * Dispatch of received MSP frames by command. Handlers register for a command and are called with
+ * a view of the frame; every delivered frame is counted per command so telemetry consumers can read
+ * message rates without a handler of their own.
+ *
+ * The table is paged by the high byte of the command: page 0 holds the MSPv1 commands and is always
+ * present, MSPv2 pages (0x10xx common, 0x30xx betaflight, ...) are added on first registration.
+ * Frames of commands in a page that doesn't exist only count as unhandled.
+ */
+
+#define MSP_DISPATCH_MAX_HANDLERS   4       // handlers per command
+#define MSP_DISPATCH_PAGES          256     // command >> 8
+
+/* Received frame. payload points into the receive buffer and is valid only during the handler call */
+typedef struct {
+    msp_version_t version;
+    msp_packet_type_t type;
+    uint8_t flags;
+    uint16_t cmd;
+    uint16_t size;
+    const uint8_t *payload;
+} msp_view_t;
+
+typedef void (*msp_handler_t)(void *user, const msp_view_t *msg);
+
+typedef struct msp_dispatch_s msp_dispatch_t;
+
+msp_dispatch_t *msp_dispatch_create(void);
+void msp_dispatch_destroy(msp_dispatch_t *dispatch);
+
+/**
+ * Call handler(user, msg) for every frame of cmd. Safe while frames are being dispatched.
+ * Returns 0, -1 if cmd already has MSP_DISPATCH_MAX_HANDLERS handlers or on allocation failure.
+ */
+int msp_dispatch_register(msp_dispatch_t *dispatch, uint16_t cmd, msp_handler_t handler, void *user);
+
+/**
+ * Remove a handler added with the same cmd, handler and user. It doesn't wait for a call already
+ * running on the dispatching thread: release user only after that thread has stopped.
+ * Returns 0, -1 if not registered.
+ */
+int msp_dispatch_unregister(msp_dispatch_t *dispatch, uint16_t cmd, msp_handler_t handler, void *user);
+
+/* Count the frame and call its handlers. Returns the number of handlers called */
+int msp_dispatch(msp_dispatch_t *dispatch, const msp_view_t *msg);
+
+/* Frames of cmd dispatched so far (wraps around), 0 for commands without a page */
+uint32_t msp_dispatch_count(const msp_dispatch_t *dispatch, uint16_t cmd);
+
+/* Frames dispatched so far with no handler registered */
+uint32_t msp_dispatch_unhandled(const msp_dispatch_t *dispatch);
+
+/* Message rate from successive samples of a counter, owned by the consumer */
+typedef struct {
+    uint32_t count;
+    uint64_t time_us;
+    float hz;
+} msp_rate_t;
+
+/**
+ * Update rate with the counter value read at now_us. The first sample only sets the base.
+ * Returns the messages per second over the interval since the previous sample.
+ */
+float msp_rate_update(msp_rate_t *rate, uint32_t count, uint64_t now_us);
+
+#endif //MSP_DISPATCH_H
@@ -0,0 +1,209 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#include <string.h>
+#include "osd_delta.h"
+
+#define OSD_DELTA_MERGE_GAP     2       // unchanged cells sent as literals rather than ending the run
+
+static int cell_page(uint16_t cell)
+{
+    return (cell >> 8) & 0x3;
+}
+
+static uint16_t base_cell(const uint16_t *base, int i)
+{
+    return base ? base[i] : 0;
+}
+
+static void put_be16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static uint16_t get_be16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+/*
+ * Unchanged cells from i that are cheaper to send than to skip: at most OSD_DELTA_MERGE_GAP of them,
+ * on page, followed by a changed cell on page. 0 if the run should end.
+ */
+static int mergeable_gap(const uint16_t *map, const uint16_t *base, int i, int page)
+{
+    for (int g = 0; g <= OSD_DELTA_MERGE_GAP && i + g < OSD_DELTA_CELLS; g++) {
+        if (cell_page(map[i + g]) != page)
+            return 0;
+        if (map[i + g] != base_cell(base, i + g))
+            return g;
+    }
+    return 0;
+}
+
+size_t osd_delta_encode(const uint16_t *map, const uint16_t *base, const struct osd_delta_info_t *info,
+                        uint8_t *out)
+{
+    struct osd_delta_header_t hdr = {
+        .magic = OSD_DELTA_MAGIC,
+        .type = (uint8_t)(base ? OSD_DELTA_DELTA : OSD_DELTA_KEYFRAME),
+        .options = info->options,
+        .font = info->font,
+    };
+    put_be16((uint8_t *)&hdr.seq, info->seq);
+    put_be16((uint8_t *)&hdr.base_seq, base ? info->base_seq : info->seq);
+    memcpy(out, &hdr, sizeof(hdr));
+    size_t o = sizeof(hdr);
+
+    int run_end = 0;
+    int i = 0;
+    while (i < OSD_DELTA_CELLS) {
+        if (map[i] == base_cell(base, i)) {
+            i++;
+            continue;
+        }
+
+        for (unsigned skip = (unsigned)(i - run_end); ; skip >>= 7) {
+            if (skip < 0x80) {
+                out[o++] = (uint8_t)skip;
+                break;
+            }
+            out[o++] = (uint8_t)(skip | 0x80);
+        }
+
+        int page = cell_page(map[i]);
+        size_t head = o++;
+        int n = 0;
+        while (i < OSD_DELTA_CELLS && n < OSD_DELTA_RUN_MAX && cell_page(map[i]) == page) {
+            if (map[i] == base_cell(base, i)) {
+                int gap = mergeable_gap(map, base, i, page);
+                if (gap == 0 || n + gap >= OSD_DELTA_RUN_MAX)
+                    break;
+            }
+            out[o++] = (uint8_t)map[i];
+            n++;
+            i++;
+        }
+        out[head] = (uint8_t)(n | page << 6);
+        run_end = i;
+    }
+    return o;
+}
+
+int osd_delta_parse_header(const uint8_t *pkt, size_t len, struct osd_delta_info_t *info)
+{
+    if (len < sizeof(struct osd_delta_header_t) || pkt[0] != OSD_DELTA_MAGIC)
+        return -1;
+    const struct osd_delta_header_t *hdr = (const struct osd_delta_header_t *)pkt;
+    if (hdr->type != OSD_DELTA_KEYFRAME && hdr->type != OSD_DELTA_DELTA)
+        return -1;
+    info->type = (enum osd_delta_type_t)hdr->type;
+    info->seq = get_be16((const uint8_t *)&hdr->seq);
+    info->base_seq = get_be16((const uint8_t *)&hdr->base_seq);
+    info->options = hdr->options;
+    info->font = hdr->font;
+    return 0;
+}
+
+int osd_delta_apply(const uint8_t *pkt, size_t len, uint16_t *map)
+{
+    struct osd_delta_info_t info;
+    if (osd_delta_parse_header(pkt, len, &info) < 0)
+        return -1;
+    if (info.type == OSD_DELTA_KEYFRAME)
+        memset(map, 0, OSD_DELTA_CELLS * sizeof(map[0]));
+
+    const uint8_t *p = pkt + sizeof(struct osd_delta_header_t), *end = pkt + len;
+    unsigned pos = 0;
+    int written = 0;
+    while (p < end) {
+        unsigned skip = 0;
+        for (int shift = 0; ; shift += 7) {
+            if (p == end || shift > 14)
+                return -1;
+            uint8_t b = *p++;
+            skip |= (unsigned)(b & 0x7F) << shift;
+            if (!(b & 0x80))
+                break;
+        }
+        if (p == end)
+            return -1;
+        uint8_t head = *p++;
+        unsigned n = head & OSD_DELTA_RUN_MAX;
+        uint16_t page = (uint16_t)(head >> 6) << 8;
+        pos += skip;
+        if (n == 0 || pos + n > OSD_DELTA_CELLS || (size_t)(end - p) < n)
+            return -1;
+        for (unsigned k = 0; k < n; k++)
+            map[pos + k] = page | p[k];
+        p += n;
+        pos += n;
+        written += (int)n;
+    }
+    return written;
+}
+
+void osd_delta_encode_ack(uint16_t seq, uint8_t *out)
+{
+    out[0] = OSD_DELTA_ACK_MAGIC;
+    out[1] = 0;
+    put_be16(out + 2, seq);
+}
+
+int osd_delta_parse_ack(const uint8_t *pkt, size_t len)
+{
+    if (len != OSD_DELTA_ACK_SIZE || pkt[0] != OSD_DELTA_ACK_MAGIC || pkt[1] != 0)
+        return -1;
+    return get_be16(pkt + 2);
+}
+
+void osd_delta_sender_init(struct osd_delta_sender_t *sender)
+{
+    memset(sender, 0, sizeof(*sender));
+    sender->acked = -1;
+    sender->keyframe = -1;
+}
+
+size_t osd_delta_sender_encode(struct osd_delta_sender_t *sender, const uint16_t *map, uint8_t options,
+                               uint8_t font, uint64_t now_us, uint8_t *out)
+{
+    int slot = sender->seq % OSD_DELTA_HISTORY;
+    int base = sender->acked >= 0 ? sender->acked : sender->keyframe;
+    // the base is about to be overwritten: too old to be worth a delta anyway
+    bool keyframe = base < 0 || base == slot || now_us - sender->keyframe_us >= OSD_DELTA_KEYFRAME_US;
+
+    struct osd_delta_info_t info = {
+        .type = keyframe ? OSD_DELTA_KEYFRAME : OSD_DELTA_DELTA,
+        .seq = sender->seq,
+        .base_seq = keyframe ? sender->seq : sender->map_seq[base],
+        .options = options,
+        .font = font,
+    };
+    size_t len = osd_delta_encode(map, keyframe ? NULL : sender->maps[base], &info, out);
+
+    if (sender->acked == slot)
+        sender->acked = -1;
+    if (sender->keyframe == slot)
+        sender->keyframe = -1;
+    memcpy(sender->maps[slot], map, sizeof(sender->maps[slot]));
+    sender->map_seq[slot] = sender->seq;
+    sender->map_valid[slot] = true;
+    if (keyframe) {
+        sender->keyframe = slot;
+        sender->keyframe_us = now_us;
+    }
+    sender->seq++;
+    return len;
+}
+
+void osd_delta_sender_ack(struct osd_delta_sender_t *sender, uint16_t seq)
+{
+    int slot = seq % OSD_DELTA_HISTORY;
+    if (!sender->map_valid[slot] || sender->map_seq[slot] != seq)
+        return;
+    if (sender->acked >= 0 && (int16_t)(uint16_t)(seq - sender->map_seq[sender->acked]) <= 0)
+        return;
+    sender->acked = slot;
+}
@@ -0,0 +1,114 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/**
+ * Copyright (C) 2025 Vitaliy N <vitaliy.nimych@gmail.com>
+ */
+#ifndef OSD_DELTA_H
+#define OSD_DELTA_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Compact OSD transport: instead of forwarding MSP DisplayPort, the drone keeps the character map and
+ * sends the cells that changed against a map the GS acknowledged, with a periodic keyframe (the whole
+ * map against a blank one). Deltas are self-contained given their base map, so a lost packet costs
+ * nothing but its own update.
+ *
+ * Packet: osd_delta_header_t, then runs until the end of the packet. A run is
+ *   skip   varint, cells left as in the base
+ *   head   count (1..63) | page << 6
+ *   count  bytes, low 8 bits of the cells; the high bits (font page) are the run's page
+ * Cells are in map memory order, map[col][row] with rows contiguous, so a run follows a column.
+ *
+ * Acknowledgement, GS to drone: OSD_DELTA_ACK_MAGIC, 0, seq (big endian) of the last applied map.
+ */
+
+#define OSD_DELTA_COLS          53
+#define OSD_DELTA_ROWS          20
+#define OSD_DELTA_CELLS         (OSD_DELTA_COLS * OSD_DELTA_ROWS)
+
+#define OSD_DELTA_MAGIC         'D'     // first byte of a datagram, never '$' of MSP
+#define OSD_DELTA_ACK_MAGIC     'A'
+#define OSD_DELTA_ACK_SIZE      4
+
+#define OSD_DELTA_RUN_MAX       63
+/* Worst case: every cell changed, alternating pages */
+#define OSD_DELTA_MAX_PACKET    (sizeof(struct osd_delta_header_t) + OSD_DELTA_CELLS * 3)
+
+#define OSD_DELTA_HISTORY       32              // maps kept as possible bases, both ends
+#define OSD_DELTA_KEYFRAME_US   1000000         // keyframe at least this often
+
+#define OSD_DELTA_OPTIONS_UNKNOWN 0xFF
+
+enum osd_delta_type_t {
+    OSD_DELTA_KEYFRAME = 0,
+    OSD_DELTA_DELTA = 1,
+};
+
+struct osd_delta_header_t {
+    uint8_t magic;
+    uint8_t type;               // osd_delta_type_t
+    uint16_t seq;               // big endian, +1 per map
+    uint16_t base_seq;          // big endian, delta: the map it applies to
+    uint8_t options;            // DisplayPort set options (msp_hd_options_e), OSD_DELTA_OPTIONS_UNKNOWN
+    uint8_t font;
+} __attribute__((packed));
+
+struct osd_delta_info_t {
+    enum osd_delta_type_t type;
+    uint16_t seq;
+    uint16_t base_seq;
+    uint8_t options;
+    uint8_t font;
+};
+
+/**
+ * Encode map as cells changed against base, a keyframe when base is NULL.
+ * out must hold OSD_DELTA_MAX_PACKET bytes. Returns the packet size.
+ */
+size_t osd_delta_encode(const uint16_t *map, const uint16_t *base, const struct osd_delta_info_t *info,
+                        uint8_t *out);
+
+/** Header of a packet, -1 if it isn't one */
+int osd_delta_parse_header(const uint8_t *pkt, size_t len, struct osd_delta_info_t *info);
+
+/**
+ * Apply a packet to map, which holds its base (anything for a keyframe, it's cleared).
+ * Only changed cells are written. Returns the number of cells written, -1 on a malformed packet
+ * (map may be partly updated).
+ */
+int osd_delta_apply(const uint8_t *pkt, size_t len, uint16_t *map);
+
+/* Acknowledgement datagram of seq into out[OSD_DELTA_ACK_SIZE] */
+void osd_delta_encode_ack(uint16_t seq, uint8_t *out);
+
+/** seq of an acknowledgement datagram, -1 if it isn't one */
+int osd_delta_parse_ack(const uint8_t *pkt, size_t len);
+
+/*
+ * Drone side: maps sent recently, the base of the next delta is the newest one the GS acknowledged,
+ * or the last keyframe while no acknowledgements arrive (one-way link).
+ */
+struct osd_delta_sender_t {
+    uint16_t seq;                               // of the next packet
+    uint16_t maps[OSD_DELTA_HISTORY][OSD_DELTA_CELLS];
+    uint16_t map_seq[OSD_DELTA_HISTORY];
+    bool map_valid[OSD_DELTA_HISTORY];
+    int acked;                                  // history slot of the newest acknowledged map, -1
+    int keyframe;                               // history slot of the last keyframe, -1
+    uint64_t keyframe_us;
+};
+
+void osd_delta_sender_init(struct osd_delta_sender_t *sender);
+
+/**
+ * Packet for map, a keyframe if no base is known or OSD_DELTA_KEYFRAME_US passed since the last one.
+ * out must hold OSD_DELTA_MAX_PACKET bytes. Returns the packet size.
+ */
+size_t osd_delta_sender_encode(struct osd_delta_sender_t *sender, const uint16_t *map, uint8_t options,
+                               uint8_t font, uint64_t now_us, uint8_t *out);
+
+/* The GS applied seq. Older than the current base, or no longer in the history: ignored */
+void osd_delta_sender_ack(struct osd_delta_sender_t *sender, uint16_t seq);
+
+#endif //OSD_DELTA_H